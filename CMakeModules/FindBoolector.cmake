@@ -0,0 +1,24 @@
+# - Try to find Boolector
+# Once done, this will define
+#
+#  BOOLECTOR_FOUND - system has Boolector
+#  BOOLECTOR_INCLUDE_DIRS - the Boolector include directories
+#  BOOLECTOR_LIBRARIES - link these to use Boolector
+
+include(LibFindMacros)
+
+# Include dir
+find_path(BOOLECTOR_INCLUDE_DIR
+  NAMES boolector/boolector.h
+)
+
+# Finally the library itself
+find_library(BOOLECTOR_LIBRARY
+  NAMES boolector
+)
+
+# Set the include dir variables and the libraries and let libfind_process do the rest.
+# NOTE: Singular variables for this library, plural for libraries this this lib depends on.
+set(BOOLECTOR_PROCESS_INCLUDES BOOLECTOR_INCLUDE_DIR BOOLECTOR_INCLUDE_DIRS)
+set(BOOLECTOR_PROCESS_LIBS BOOLECTOR_LIBRARY BOOLECTOR_LIBRARIES)
+libfind_process(BOOLECTOR)
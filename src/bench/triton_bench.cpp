@@ -0,0 +1,397 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+/*
+** The benchmark suite of libTriton. Built with -DBENCHMARKS=ON.
+**
+** Usage:
+**
+**  $ ./triton_bench [--iterations N] [--filter name] [trace ...]
+**
+** The micro benchmarks measure the disassembly, the semantics of each class
+** of instructions, the construction of ASTs, getFullAst(), freeAstNodes() and
+** getModel(). Each trace given (recorded by the pintool, see TraceWriter) is
+** replayed as a macro benchmark, with and without the symbolic engine.
+**
+** The overhead of the Python bindings is measured by triton_bench.py.
+*/
+
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <set>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <api.hpp>
+#include <ast.hpp>
+#include <astNodeAllocator.hpp>
+#include <exceptions.hpp>
+#include <x86Specifications.hpp>
+
+using namespace triton;
+using namespace triton::arch;
+using namespace triton::arch::x86;
+
+
+
+/* An instruction of a benchmark */
+struct BenchInstruction {
+  const char*    opcodes;
+  triton::uint32 size;
+};
+
+
+/* A class of instructions benchmarked by buildSemantics() */
+struct BenchClass {
+  const char*                   name;
+  std::vector<BenchInstruction> instructions;
+};
+
+
+static const std::vector<BenchClass> benchClasses = {
+  {"mov", {
+    {"\x48\x89\xd8",                 3}, /* mov    rax, rbx                */
+    {"\x48\x8b\x43\x08",             4}, /* mov    rax, qword ptr [rbx+8]  */
+    {"\x48\x89\x43\x10",             4}, /* mov    qword ptr [rbx+16], rax */
+    {"\x48\xc7\xc1\x10\x00\x00\x00", 7}, /* mov    rcx, 0x10               */
+    {"\x0f\xb6\x13",                 3}, /* movzx  edx, byte ptr [rbx]     */
+    {"\x48\x8d\x34\xc3",             4}, /* lea    rsi, [rbx+rax*8]        */
+  }},
+  {"arith", {
+    {"\x48\x01\xd8",                 3}, /* add    rax, rbx                */
+    {"\x48\x29\xc8",                 3}, /* sub    rax, rcx                */
+    {"\x48\x83\xc0\x01",             4}, /* add    rax, 1                  */
+    {"\x48\xff\xc1",                 3}, /* inc    rcx                     */
+    {"\x48\x0f\xaf\xc3",             4}, /* imul   rax, rbx                */
+    {"\x48\x39\xc8",                 3}, /* cmp    rax, rcx                */
+  }},
+  {"logic", {
+    {"\x48\x31\xd8",                 3}, /* xor    rax, rbx                */
+    {"\x48\x21\xc8",                 3}, /* and    rax, rcx                */
+    {"\x48\x09\xd0",                 3}, /* or     rax, rdx                */
+    {"\x48\xf7\xd0",                 3}, /* not    rax                     */
+    {"\x48\x85\xc0",                 3}, /* test   rax, rax                */
+  }},
+  {"shift", {
+    {"\x48\xc1\xe0\x04",             4}, /* shl    rax, 4                  */
+    {"\x48\xc1\xe8\x03",             4}, /* shr    rax, 3                  */
+    {"\x48\xd3\xf8",                 3}, /* sar    rax, cl                 */
+    {"\x48\xc1\xc0\x0d",             4}, /* rol    rax, 13                 */
+  }},
+  {"stack", {
+    {"\x53",                         1}, /* push   rbx                     */
+    {"\x58",                         1}, /* pop    rax                     */
+    {"\x50",                         1}, /* push   rax                     */
+    {"\x5b",                         1}, /* pop    rbx                     */
+  }},
+  {"branch", {
+    {"\x0f\x84\x00\x00\x00\x00",     6}, /* je     +0                      */
+    {"\x0f\x87\x00\x00\x00\x00",     6}, /* ja     +0                      */
+    {"\xe9\x00\x00\x00\x00",         5}, /* jmp    +0                      */
+  }},
+  {"sse", {
+    {"\x66\x0f\xef\xc1",             4}, /* pxor   xmm0, xmm1              */
+    {"\xf3\x0f\x6f\x03",             4}, /* movdqu xmm0, xmmword ptr [rbx] */
+    {"\x66\x0f\xd7\xd1",             4}, /* pmovmskb edx, xmm1             */
+    {"\x66\x0f\x74\xc1",             4}, /* pcmpeqb xmm0, xmm1             */
+  }},
+};
+
+
+/* The options of the suite */
+static triton::usize iterations = 20000;
+static std::string   filter;
+
+
+/* A wall clock timer */
+class Timer {
+  private:
+    std::chrono::steady_clock::time_point begin;
+
+  public:
+    Timer() {
+      this->begin = std::chrono::steady_clock::now();
+    }
+
+    double seconds(void) const {
+      return std::chrono::duration<double>(std::chrono::steady_clock::now() - this->begin).count();
+    }
+};
+
+
+/* Returns true if a benchmark must be run */
+static bool selected(const std::string& name) {
+  return filter.empty() || name.find(filter) != std::string::npos;
+}
+
+
+/* Prints the result of a benchmark */
+static void report(const std::string& name, triton::usize count, const std::string& unit, double seconds, const std::string& extra="") {
+  std::cout << std::left << std::setw(32) << name
+            << std::right << std::setw(14) << std::fixed << std::setprecision(0) << (seconds > 0 ? count / seconds : 0) << " " << std::left << std::setw(12) << (unit + "/s")
+            << std::right << std::setw(10) << std::setprecision(3) << (seconds * 1000) << " ms";
+  if (!extra.empty())
+    std::cout << "  " << extra;
+  std::cout << std::endl;
+}
+
+
+/* Returns the bytes reserved per live AST node */
+static std::string bytesPerNode(void) {
+  triton::ast::AstNodeAllocator* allocator = api.getAstNodeAllocator();
+  std::ostringstream ret;
+
+  if (allocator == nullptr || allocator->getLiveNodes() == 0)
+    return "";
+
+  ret << std::fixed << std::setprecision(1) << (static_cast<double>(allocator->getReservedBytes()) / allocator->getLiveNodes()) << " bytes/node";
+  return ret.str();
+}
+
+
+/* Resets the engines and sets up a concrete context */
+static void resetContext(void) {
+  api.setArchitecture(ARCH_X86_64);
+  api.setConcreteRegisterValue(Register(ID_REG_RBX, 0x100000));
+  api.setConcreteRegisterValue(Register(ID_REG_RSP, 0x7fff0000));
+  api.setConcreteRegisterValue(Register(ID_REG_RCX, 3));
+}
+
+
+/* Disassembly throughput */
+static void benchDisassembly(void) {
+  triton::usize count = 0;
+
+  resetContext();
+
+  Timer timer;
+  for (triton::usize index = 0; index < iterations; index++) {
+    for (auto it = benchClasses.begin(); it != benchClasses.end(); it++) {
+      for (auto inst = it->instructions.begin(); inst != it->instructions.end(); inst++) {
+        Instruction instruction(reinterpret_cast<const triton::uint8*>(inst->opcodes), inst->size);
+        instruction.setAddress(0x400000);
+        api.disassembly(instruction);
+        count++;
+      }
+    }
+  }
+
+  report("disassembly", count, "insns", timer.seconds());
+}
+
+
+/* buildSemantics() per class of instructions */
+static void benchSemantics(const BenchClass& benchClass, bool symbolic) {
+  const triton::usize batch = 1000;
+  std::vector<Instruction> instructions;
+  triton::usize count = 0;
+  double seconds = 0;
+  std::string extra;
+
+  for (triton::usize done = 0; done < iterations; done += batch) {
+    resetContext();
+    api.enableSymbolicEngine(symbolic);
+
+    /* Decoded out of the timing */
+    instructions.clear();
+    for (triton::usize index = 0; index < batch; index++) {
+      const BenchInstruction& inst = benchClass.instructions[index % benchClass.instructions.size()];
+      instructions.push_back(Instruction(reinterpret_cast<const triton::uint8*>(inst.opcodes), inst.size));
+      instructions.back().setAddress(0x400000);
+      api.disassembly(instructions.back());
+    }
+
+    Timer timer;
+    for (auto it = instructions.begin(); it != instructions.end(); it++)
+      api.buildSemantics(*it);
+    seconds += timer.seconds();
+    count   += batch;
+
+    if (symbolic)
+      extra = bytesPerNode();
+  }
+
+  report(std::string("semantics/") + benchClass.name + (symbolic ? "" : "/taint"), count, "insns", seconds, extra);
+}
+
+
+/* Construction of ASTs, with and without dictionaries */
+static void benchAstConstruction(bool dictionaries) {
+  triton::usize count = 0;
+
+  resetContext();
+  api.enableMode(triton::modes::AST_DICTIONARIES, dictionaries);
+
+  auto var = triton::ast::variable(*api.newSymbolicVariable(32));
+
+  Timer timer;
+  for (triton::usize index = 0; index < iterations; index++) {
+    /* Half of the nodes are built twice */
+    triton::ast::bvadd(var, triton::ast::bvxor(triton::ast::bv(index >> 1, 32), var));
+    count += 4;
+  }
+  double seconds = timer.seconds();
+
+  std::ostringstream extra;
+  extra << api.getAllocatedAstNodes().size() << " nodes kept, " << bytesPerNode();
+  report(dictionaries ? "ast/construction/dictionaries" : "ast/construction", count, "nodes", seconds, extra.str());
+
+  api.enableMode(triton::modes::AST_DICTIONARIES, false);
+}
+
+
+/* getFullAst() on a chain of dependent instructions */
+static void benchFullAst(void) {
+  triton::usize count = 0;
+  triton::usize id    = 0;
+
+  resetContext();
+  api.convertRegisterToSymbolicVariable(TRITON_X86_REG_RBX);
+
+  for (triton::usize index = 0; index < iterations; index++) {
+    Instruction inst(reinterpret_cast<const triton::uint8*>(index & 1 ? "\x48\x01\xd8" : "\x48\x31\xc3"), 3); /* add rax, rbx / xor rbx, rax */
+    inst.setAddress(0x400000);
+    api.processing(inst);
+  }
+  id = api.getSymbolicRegisterId(TRITON_X86_REG_RAX);
+
+  Timer timer;
+  auto node = api.getFullAstFromId(id);
+  double seconds = timer.seconds();
+
+  std::set<triton::ast::AbstractNode*> nodes;
+  api.extractUniqueAstNodes(nodes, node);
+  count = nodes.size();
+
+  report("ast/getFullAst", count, "nodes", seconds);
+}
+
+
+/* freeAstNodes() */
+static void benchFreeAstNodes(void) {
+  std::set<triton::ast::AbstractNode*> nodes;
+
+  resetContext();
+
+  auto var = triton::ast::variable(*api.newSymbolicVariable(32));
+  auto node = var;
+  for (triton::usize index = 0; index < iterations; index++)
+    node = triton::ast::bvadd(node, triton::ast::bv(index, 32));
+  api.extractUniqueAstNodes(nodes, node);
+
+  triton::usize count = nodes.size();
+  Timer timer;
+  api.freeAstNodes(nodes);
+  report("ast/freeAstNodes", count, "nodes", timer.seconds());
+}
+
+
+/* getModel() on the formulas of the crackme samples */
+static void benchModels(void) {
+  const triton::uint8 key[] = "elite";
+  const triton::usize size  = sizeof(key) - 1;
+  const triton::usize queries = 20;
+  std::vector<triton::ast::AbstractNode*> inputs;
+
+  resetContext();
+
+  for (triton::usize index = 0; index < size; index++)
+    inputs.push_back(triton::ast::variable(*api.newSymbolicVariable(8)));
+
+  /* crackme_xor: (input[i] ^ 0x55) == key[i] for each i */
+  triton::ast::AbstractNode* xorFormula = nullptr;
+  for (triton::usize index = 0; index < size; index++) {
+    auto check = triton::ast::equal(triton::ast::bvxor(inputs[index], triton::ast::bv(0x55, 8)), triton::ast::bv(key[index], 8));
+    xorFormula = (xorFormula == nullptr ? check : triton::ast::land(xorFormula, check));
+  }
+
+  /* crackme_hash: hash = hash * 31 + input[i], on 32 bits */
+  triton::ast::AbstractNode* hash = triton::ast::bv(0, 32);
+  for (triton::usize index = 0; index < size; index++)
+    hash = triton::ast::bvadd(triton::ast::bvmul(hash, triton::ast::bv(31, 32)), triton::ast::zx(24, inputs[index]));
+  auto hashFormula = triton::ast::equal(hash, triton::ast::bv(0xad3e7b5d, 32));
+
+  Timer timer1;
+  for (triton::usize index = 0; index < queries; index++)
+    api.getModel(xorFormula);
+  report("solver/getModel/xor", queries, "queries", timer1.seconds());
+
+  Timer timer2;
+  for (triton::usize index = 0; index < queries; index++)
+    api.getModel(hashFormula);
+  report("solver/getModel/hash", queries, "queries", timer2.seconds());
+}
+
+
+/* Replays a trace */
+static void benchTrace(const std::string& path, bool symbolic) {
+  std::string name = std::string("trace/") + path + (symbolic ? "" : "/taint");
+
+  resetContext();
+  api.enableSymbolicEngine(symbolic);
+
+  Timer timer;
+  triton::usize count = api.replayTrace(path);
+  report(name, count, "insns", timer.seconds(), symbolic ? bytesPerNode() : "");
+}
+
+
+int main(int ac, const char** av) {
+  std::vector<std::string> traces;
+
+  for (int index = 1; index < ac; index++) {
+    if (!std::strcmp(av[index], "--iterations") && index + 1 < ac)
+      iterations = std::strtoull(av[++index], nullptr, 0);
+    else if (!std::strcmp(av[index], "--filter") && index + 1 < ac)
+      filter = av[++index];
+    else
+      traces.push_back(av[index]);
+  }
+
+  try {
+    if (selected("disassembly"))
+      benchDisassembly();
+
+    for (auto it = benchClasses.begin(); it != benchClasses.end(); it++) {
+      if (selected(std::string("semantics/") + it->name)) {
+        benchSemantics(*it, true);
+        benchSemantics(*it, false);
+      }
+    }
+
+    if (selected("ast/construction")) {
+      benchAstConstruction(false);
+      benchAstConstruction(true);
+    }
+
+    if (selected("ast/getFullAst"))
+      benchFullAst();
+
+    if (selected("ast/freeAstNodes"))
+      benchFreeAstNodes();
+
+    if (selected("solver/getModel"))
+      benchModels();
+
+    for (auto it = traces.begin(); it != traces.end(); it++) {
+      if (selected("trace/")) {
+        benchTrace(*it, true);
+        benchTrace(*it, false);
+      }
+    }
+  }
+  catch (const triton::exceptions::Exception& e) {
+    std::cerr << "triton_bench: " << e.what() << std::endl;
+    return -1;
+  }
+
+  return 0;
+}
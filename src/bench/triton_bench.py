@@ -0,0 +1,273 @@
+#!/usr/bin/env python2
+## -*- coding: utf-8 -*-
+##
+##  The benchmark suite of the Python bindings, the counterpart of triton_bench.
+##
+##  The micro benchmarks measure the cost of crossing the binding boundary:
+##  the creation of Instruction objects, processing(), the concrete and taint
+##  accessors, the callbacks, the creation of AST wrappers, the extraction of
+##  models and the export of the taint map. The macro benchmarks run the
+##  examples of src/examples/python and the ctf-writeups as subprocesses.
+##
+##  Usage (from the root of the tree, with the triton module installed):
+##
+##  $ python2 ./src/bench/triton_bench.py [--iterations N] [--filter name] [--macro]
+##                                        [--save baseline.json] [--compare baseline.json]
+##
+##  --save writes the results of the run, --compare prints the ratio of each
+##  result to the one of a saved run (> 1.00x means slower). Baselines depend on
+##  the machine, so they are recorded and compared on the same one.
+##
+
+import json
+import os
+import subprocess
+import sys
+import time
+
+from triton     import *
+from triton.ast import *
+
+
+ROOT = os.path.abspath(os.path.join(os.path.dirname(__file__), '..', '..'))
+
+# Instructions of the processing benchmarks (x86-64)
+CODE = [
+    "\x48\x89\xd8",                 # mov    rax, rbx
+    "\x48\x8b\x43\x08",             # mov    rax, qword ptr [rbx+8]
+    "\x48\x01\xd8",                 # add    rax, rbx
+    "\x48\x31\xc8",                 # xor    rax, rcx
+    "\x48\x89\x43\x10",             # mov    qword ptr [rbx+16], rax
+    "\x48\x39\xc8",                 # cmp    rax, rcx
+]
+
+# The macro benchmarks: name, working directory and command line
+MACRO = [
+    ('examples/code_coverage_crackme_xor',   'src/examples/python',                                  ['code_coverage_crackme_xor.py']),
+    ('examples/symbolic_emulation_crackme',  'src/examples/python',                                  ['symbolic_emulation_crackme_xor.py']),
+    ('examples/hooking_libc',                '.',                                                    ['src/examples/python/hooking_libc.py']),
+    ('examples/small_symbolic_emulator',     'src/examples/python',                                  ['small_x86-64_symbolic_emulator.py', './samples/sample_1', 'hello']),
+    ('ctf/defcamp-2015-r100',                'src/examples/python/ctf-writeups/defcamp-2015-r100',   ['solve.py']),
+    ('ctf/defcon-2016-baby-re',              'src/examples/python/ctf-writeups/defcon-2016-baby-re', ['solve.py']),
+    ('ctf/hackover-ctf-2015-r150',           'src/examples/python/ctf-writeups/hackover-ctf-2015-r150', ['solve.py', './rvs']),
+]
+
+iterations = 20000
+results    = dict()
+
+
+def report(name, count, unit, seconds):
+    results[name] = (seconds * 1e9 / count) if count else 0.0
+    print '%-40s %12d %-8s %10.3f s %14.0f %s/s %10.1f ns/%s' %(name, count, unit, seconds, count / seconds if seconds else 0, unit, results[name], unit)
+    sys.stdout.flush()
+
+
+def reset():
+    resetEngines()
+    setArchitecture(ARCH.X86_64)
+    setConcreteRegisterValue(Register(REG.RBX, 0x1000))
+
+
+def benchInstructionCreation():
+    start = time.time()
+    for index in xrange(iterations):
+        inst = Instruction()
+        inst.setOpcode(CODE[index % len(CODE)])
+        inst.setAddress(0x400000)
+    report('instruction/create', iterations, 'insns', time.time() - start)
+
+
+def benchProcessing(symbolic):
+    reset()
+    if not symbolic:
+        enableSymbolicEngine(False)
+    insts = list()
+    for index in xrange(iterations):
+        inst = Instruction()
+        inst.setOpcode(CODE[index % len(CODE)])
+        inst.setAddress(0x400000 + index * 8)
+        insts.append(inst)
+
+    start = time.time()
+    for inst in insts:
+        processing(inst)
+    report('processing' + ('' if symbolic else '/taint'), iterations, 'insns', time.time() - start)
+
+
+def benchCallbacks():
+    # The overhead of a GET_CONCRETE_MEMORY_VALUE callback per memory read
+    hits = [0]
+    def onRead(mem):
+        hits[0] += 1
+
+    reset()
+    addCallback(onRead, CALLBACK.GET_CONCRETE_MEMORY_VALUE)
+    start = time.time()
+    for index in xrange(iterations):
+        inst = Instruction("\x48\x8b\x43\x08")
+        processing(inst)
+    elapsed = time.time() - start
+    removeCallback(onRead, CALLBACK.GET_CONCRETE_MEMORY_VALUE)
+    report('callbacks/memory', hits[0], 'calls', elapsed)
+
+
+def benchAccessors():
+    reset()
+    rax = REG.RAX
+    mem = MemoryAccess(0x2000, CPUSIZE.QWORD)
+
+    start = time.time()
+    for index in xrange(iterations):
+        getConcreteRegisterValue(rax)
+    report('accessors/getConcreteRegisterValue', iterations, 'calls', time.time() - start)
+
+    start = time.time()
+    for index in xrange(iterations):
+        setConcreteMemoryValue(0x2000 + (index & 0xff), index & 0xff)
+    report('accessors/setConcreteMemoryValue', iterations, 'calls', time.time() - start)
+
+    start = time.time()
+    for index in xrange(iterations):
+        getConcreteMemoryValue(mem)
+    report('accessors/getConcreteMemoryValue', iterations, 'calls', time.time() - start)
+
+    start = time.time()
+    for index in xrange(iterations):
+        isRegisterTainted(rax)
+    report('accessors/isRegisterTainted', iterations, 'calls', time.time() - start)
+
+    start = time.time()
+    for index in xrange(iterations):
+        buildSymbolicRegister(rax)
+    report('accessors/buildSymbolicRegister', iterations, 'calls', time.time() - start)
+
+
+def benchAst():
+    reset()
+    a = bv(1, 64)
+    b = bv(2, 64)
+
+    start = time.time()
+    for index in xrange(iterations):
+        bv(index, 64)
+    report('ast/bv', iterations, 'nodes', time.time() - start)
+
+    start = time.time()
+    for index in xrange(iterations):
+        bvadd(a, b)
+    report('ast/bvadd', iterations, 'nodes', time.time() - start)
+
+    node = bvadd(bvxor(a, b), bvmul(a, b))
+    start = time.time()
+    for index in xrange(iterations):
+        node.getChilds()
+    report('ast/getChilds', iterations, 'calls', time.time() - start)
+
+
+def benchModels():
+    reset()
+    var  = newSymbolicVariable(8)
+    node = variable(var)
+    count = max(1, iterations / 100)
+
+    start = time.time()
+    for index in xrange(count):
+        getModel(equal(bvxor(node, bv(0x55, 8)), bv(index & 0xff, 8)))
+    report('solver/getModel', count, 'queries', time.time() - start)
+
+
+def benchTaintExport():
+    reset()
+    for index in xrange(64):
+        taintMemory(MemoryAccess(0x100000 + index * 0x100, CPUSIZE.DQWORD))
+    count = max(1, iterations / 100)
+
+    start = time.time()
+    for index in xrange(count):
+        getTaintedMemory()
+    report('taint/getTaintedMemory', count, 'calls', time.time() - start)
+
+    start = time.time()
+    for index in xrange(count):
+        getTaintedMemoryBuffer()
+    report('taint/getTaintedMemoryBuffer', count, 'calls', time.time() - start)
+
+
+def benchMacro(name, cwd, command):
+    devnull = open(os.devnull, 'w')
+    start = time.time()
+    status = subprocess.call([sys.executable] + command, cwd=os.path.join(ROOT, cwd), stdout=devnull, stderr=devnull)
+    elapsed = time.time() - start
+    devnull.close()
+    if status != 0:
+        print '%-40s failed (%d)' %('macro/' + name, status)
+        return
+    report('macro/' + name, 1, 'runs', elapsed)
+
+
+def main(argv):
+    global iterations
+
+    pattern  = None
+    macro    = False
+    save     = None
+    compare  = None
+
+    index = 0
+    while index < len(argv):
+        if argv[index] == '--iterations':
+            iterations = int(argv[index + 1])
+            index += 1
+        elif argv[index] == '--filter':
+            pattern = argv[index + 1]
+            index += 1
+        elif argv[index] == '--macro':
+            macro = True
+        elif argv[index] == '--save':
+            save = argv[index + 1]
+            index += 1
+        elif argv[index] == '--compare':
+            compare = argv[index + 1]
+            index += 1
+        else:
+            print 'Syntax: %s [--iterations N] [--filter name] [--macro] [--save file] [--compare file]' %(sys.argv[0])
+            return -1
+        index += 1
+
+    micro = [
+        ('instruction', benchInstructionCreation),
+        ('processing',  lambda: benchProcessing(True)),
+        ('processing',  lambda: benchProcessing(False)),
+        ('callbacks',   benchCallbacks),
+        ('accessors',   benchAccessors),
+        ('ast',         benchAst),
+        ('solver',      benchModels),
+        ('taint',       benchTaintExport),
+    ]
+
+    for name, function in micro:
+        if pattern is None or pattern in name:
+            function()
+
+    if macro:
+        for name, cwd, command in MACRO:
+            if pattern is None or pattern in name:
+                benchMacro(name, cwd, command)
+
+    if compare is not None:
+        with open(compare) as fd:
+            baseline = json.load(fd)
+        print
+        for name in sorted(results):
+            if name in baseline and baseline[name]:
+                print '%-40s %6.2fx' %(name, results[name] / baseline[name])
+
+    if save is not None:
+        with open(save, 'w') as fd:
+            json.dump(results, fd, indent=2, sort_keys=True)
+
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main(sys.argv[1:]))
@@ -5,12 +5,38 @@
 **  This program is under the terms of the BSD License.
 */
 
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
 #include <list>
 #include <map>
+#include <memory>
 #include <new>
+#include <sstream>
+#include <thread>
+#include <utility>
 
 #include <api.hpp>
+#include <astEvaluator.hpp>
+#include <astNodeAllocator.hpp>
+#include <astSerialization.hpp>
+#include <astSmtParser.hpp>
+#include <coreUtils.hpp>
+#include <coverageDriver.hpp>
+#include <decodeAhead.hpp>
 #include <exceptions.hpp>
+#include <hugePageArena.hpp>
+#include <mappedFile.hpp>
+#include <pagedMemory.hpp>
+#include <perfCounters.hpp>
+#include <traceEvents.hpp>
+#include <traceFile.hpp>
+#include <x8664Cpu.hpp>
+#include <x86Cpu.hpp>
+#include <x86Specifications.hpp>
 
 
 
@@ -182,9 +208,17 @@ Note that only the version `71313` of Pin is supported.
 
 namespace triton {
 
-  /* External access to the API */
+  /* The default API */
   triton::API api = triton::API();
 
+  /* The API bound to each thread */
+  static thread_local triton::API* boundApi = &triton::api;
+
+
+  triton::API& getCurrentApi(void) {
+    return *boundApi;
+  }
+
 
   API::API() {
     this->callbacks           = triton::callbacks::Callbacks();
@@ -197,11 +231,38 @@ namespace triton {
     this->symbolic            = nullptr;
     this->taint               = nullptr;
     this->z3Interface         = nullptr;
+    this->syscalls            = nullptr;
+    this->summaries           = nullptr;
+    this->dependencyExport    = nullptr;
+    this->uniqueSnapshotId    = 0;
+    this->undoFlag            = false;
+    this->profile             = triton::profiles::FULL;
+    this->stateMergingLimit   = 32;
+    this->mergedBranches      = 0;
+
+    this->disassembledInstructions = 0;
+    this->disassemblyTime          = 0;
+    this->decodedAhead             = 0;
+    this->memorySoftLimit          = 0;
+    this->memoryHardLimit          = 0;
+    this->memorySoftLimitReported  = false;
   }
 
 
   API::~API() {
     this->removeEngines();
+    if (boundApi == this)
+      boundApi = &triton::api;
+  }
+
+
+
+  /* Context API =================================================================================== */
+
+  triton::API* API::bind(void) {
+    triton::API* previous = boundApi;
+    boundApi = this;
+    return previous;
   }
 
 
@@ -231,17 +292,26 @@ namespace triton {
   }
 
 
-  void API::setArchitecture(triton::uint32 arch) {
+  void API::setArchitecture(triton::uint32 arch, triton::uint32 profile) {
+    if (profile > triton::profiles::DISASSEMBLY)
+      throw triton::exceptions::API("API::setArchitecture(): Invalid profile.");
+
     /* Setup and init the targeted architecture */
     this->arch.setArchitecture(arch);
 
     /* remove and re-init previous engines (when setArchitecture() has been called twice) */
     this->removeEngines();
+    this->profile = profile;
     this->initEngines();
     this->removeAllCallbacks();
   }
 
 
+  triton::uint32 API::getEngineProfile(void) const {
+    return this->profile;
+  }
+
+
   void API::clearArchitecture(void) {
     this->checkArchitecture();
     this->arch.clearArchitecture();
@@ -283,6 +353,11 @@ namespace triton {
   }
 
 
+  const triton::arch::RegisterSpecificationEntry& API::getRegisterSpecificationEntry(triton::uint32 regId) const {
+    return this->arch.getRegisterSpecificationEntry(regId);
+  }
+
+
   std::set<triton::arch::Register*> API::getAllRegisters(void) const {
     this->checkArchitecture();
     return this->arch.getAllRegisters();
@@ -310,11 +385,43 @@ namespace triton {
   }
 
 
+  void API::getConcreteMemoryAreaValue(triton::uint64 baseAddr, triton::uint8* area, triton::usize size, bool execCallbacks) const {
+    this->arch.getConcreteMemoryAreaValue(baseAddr, area, size, execCallbacks);
+  }
+
+
   triton::uint512 API::getConcreteRegisterValue(const triton::arch::Register& reg, bool execCallbacks) const {
+    /* The concrete value of a deferred flag is synchronized when it is built */
+    if (this->symbolic)
+      this->symbolic->materializeLazyFlag(reg);
     return this->arch.getConcreteRegisterValue(reg, execCallbacks);
   }
 
 
+  triton::arch::x86::RegisterContext API::getConcreteRegisterContext(void) {
+    triton::arch::x86::RegisterContext context;
+
+    this->checkArchitecture();
+
+    /* The concrete values of the deferred flags are synchronized when they are built */
+    if (this->symbolic)
+      this->symbolic->materializeLazyFlags();
+
+    switch (this->getArchitecture()) {
+      case triton::arch::ARCH_X86_64:
+        dynamic_cast<triton::arch::x86::x8664Cpu*>(this->getCpu())->getConcreteRegisterContext(context);
+        break;
+      case triton::arch::ARCH_X86:
+        dynamic_cast<triton::arch::x86::x86Cpu*>(this->getCpu())->getConcreteRegisterContext(context);
+        break;
+      default:
+        throw triton::exceptions::API("API::getConcreteRegisterContext(): Invalid architecture.");
+    }
+
+    return context;
+  }
+
+
   void API::setConcreteMemoryValue(triton::uint64 addr, triton::uint8 value) {
     this->arch.setConcreteMemoryValue(addr, value);
   }
@@ -336,10 +443,33 @@ namespace triton {
 
 
   void API::setConcreteRegisterValue(const triton::arch::Register& reg) {
+    /* Build a deferred flag before its concrete value is overwritten */
+    if (this->symbolic)
+      this->symbolic->materializeLazyFlag(reg);
     this->arch.setConcreteRegisterValue(reg);
   }
 
 
+  void API::setConcreteRegisterContext(const triton::arch::x86::RegisterContext& context) {
+    this->checkArchitecture();
+
+    /* Build the deferred flags before their concrete values are overwritten */
+    if (this->symbolic)
+      this->symbolic->materializeLazyFlags();
+
+    switch (this->getArchitecture()) {
+      case triton::arch::ARCH_X86_64:
+        dynamic_cast<triton::arch::x86::x8664Cpu*>(this->getCpu())->setConcreteRegisterContext(context);
+        break;
+      case triton::arch::ARCH_X86:
+        dynamic_cast<triton::arch::x86::x86Cpu*>(this->getCpu())->setConcreteRegisterContext(context);
+        break;
+      default:
+        throw triton::exceptions::API("API::setConcreteRegisterContext(): Invalid architecture.");
+    }
+  }
+
+
   bool API::isMemoryMapped(triton::uint64 baseAddr, triton::usize size) {
     return this->arch.isMemoryMapped(baseAddr, size);
   }
@@ -350,9 +480,247 @@ namespace triton {
   }
 
 
+  void API::loadBinary(const std::list<triton::format::MemoryMapping>& areas) {
+    const triton::uint64 pageSize = triton::arch::PagedMemory::pageSize;
+    std::vector<triton::uint8> zeros(pageSize, 0);
+
+    this->checkArchitecture();
+
+    /* Zero-fill first, the content of an area may overlap the tail of another one */
+    for (auto it = areas.begin(); it != areas.end(); it++) {
+      triton::uint64 addr = it->getVirtualAddress() + it->getSize();
+      triton::uint64 end  = it->getVirtualAddress() + it->getVirtualSize();
+      while (addr < end) {
+        triton::usize size = static_cast<triton::usize>(std::min(end - addr, pageSize));
+        this->arch.setConcreteMemoryAreaValue(addr, zeros.data(), size);
+        addr += size;
+      }
+    }
+
+    for (auto it = areas.begin(); it != areas.end(); it++) {
+      if (it->getSize())
+        this->arch.setConcreteMemoryAreaValue(it->getVirtualAddress(), it->getMemoryArea(), static_cast<triton::usize>(it->getSize()));
+    }
+  }
+
+
+  void API::loadBinary(const triton::format::AbstractBinary& binary) {
+    this->loadBinary(binary.getMemoryMapping());
+  }
+
+
+  void API::loadBinary(const triton::format::BinaryInterface& binary) {
+    this->loadBinary(binary.getMemoryMapping());
+  }
+
+
+  triton::usize API::loadCoreDump(const triton::format::CoreDump& dump) {
+    const std::list<triton::format::MemoryMapping>& areas = dump.getMemoryMapping();
+
+    this->checkArchitecture();
+
+    /* The pages are filled from the dump on their first access */
+    triton::arch::PagedMemory& memory = this->getCpu()->getPagedMemory();
+    for (auto it = areas.begin(); it != areas.end(); it++)
+      memory.mapLazy(it->getVirtualAddress(), dump.getFile(), static_cast<triton::usize>(it->getOffset()), static_cast<triton::usize>(it->getSize()));
+
+    return areas.size();
+  }
+
+
+  triton::usize API::loadCoreDump(const std::string& path) {
+    this->checkArchitecture();
+    return this->loadCoreDump(triton::format::CoreDump(path));
+  }
+
+
+  triton::usize API::predecode(const std::list<triton::format::MemoryMapping>& areas, triton::uint32 threads) {
+    /* A chunk is swept by one thread, its last instruction may end in the next chunk */
+    const triton::usize chunkSize = 0x10000;
+    std::vector<std::pair<const triton::format::MemoryMapping*, triton::uint64>> chunks;
+
+    this->checkArchitecture();
+    triton::arch::CpuInterface* cpu = this->getCpu();
+    triton::arch::DecodeCache& cache = cpu->getDecodeCache();
+
+    for (auto it = areas.begin(); it != areas.end(); it++) {
+      if (it->isExecutable()) {
+        for (triton::uint64 offset = 0; offset < it->getSize(); offset += chunkSize)
+          chunks.push_back(std::make_pair(&(*it), offset));
+      }
+    }
+
+    if (threads == 0)
+      threads = std::max<triton::uint32>(std::thread::hardware_concurrency(), 1);
+    threads = std::min<triton::uint32>(threads, static_cast<triton::uint32>(std::max<triton::usize>(chunks.size(), 1)));
+
+    std::vector<std::vector<std::pair<triton::uint64, triton::arch::DecodedInstruction>>> decoded(chunks.size());
+    std::vector<std::string> errors(threads);
+    std::vector<std::thread> workers;
+    std::atomic<triton::usize> next(0);
+
+    for (triton::uint32 index = 0; index < threads; index++) {
+      workers.push_back(std::thread([&, index]() {
+        /* Registers and memory accesses of the operands are built through this API */
+        this->bind();
+
+        triton::usize handle = 0;
+        try {
+          handle = cpu->openDecoder();
+        }
+        catch (const triton::exceptions::Exception& e) {
+          errors[index] = e.what();
+          return;
+        }
+
+        for (triton::usize chunk = next++; chunk < chunks.size(); chunk = next++) {
+          const triton::format::MemoryMapping* area = chunks[chunk].first;
+          const triton::uint8* raw  = area->getMemoryArea();
+          triton::uint64 size       = area->getSize();
+          triton::uint64 offset     = chunks[chunk].second;
+          triton::uint64 end        = std::min<triton::uint64>(offset + chunkSize, size);
+          triton::arch::DecodedInstruction instruction;
+
+          while (offset < end) {
+            bool valid = false;
+            try {
+              valid = cpu->decode(handle, raw + offset, static_cast<triton::usize>(std::min<triton::uint64>(size - offset, 16)), area->getVirtualAddress() + offset, instruction);
+            }
+            catch (const triton::exceptions::Exception&) {
+            }
+
+            if (!valid) {
+              offset++;
+              continue;
+            }
+
+            decoded[chunk].push_back(std::make_pair(area->getVirtualAddress() + offset, instruction));
+            offset += instruction.opcodes.size();
+          }
+        }
+
+        cpu->closeDecoder(handle);
+      }));
+    }
+
+    for (auto it = workers.begin(); it != workers.end(); it++)
+      it->join();
+
+    for (auto it = errors.begin(); it != errors.end(); it++) {
+      if (!it->empty())
+        throw triton::exceptions::API("API::predecode(): " + *it);
+    }
+
+    /* The chunks are cached in order of address, the cache is never flushed by the ones which do not fit */
+    triton::usize count = 0;
+    for (auto chunk = decoded.begin(); chunk != decoded.end(); chunk++) {
+      for (auto it = chunk->begin(); it != chunk->end(); it++) {
+        if (cache.isFull())
+          return count;
+        cache.insert(it->first, it->second);
+        count++;
+      }
+    }
+
+    return count;
+  }
+
+
+  triton::usize API::predecode(const triton::format::AbstractBinary& binary, triton::uint32 threads) {
+    return this->predecode(binary.getMemoryMapping(), threads);
+  }
+
+
+  triton::usize API::predecode(const triton::format::BinaryInterface& binary, triton::uint32 threads) {
+    return this->predecode(binary.getMemoryMapping(), threads);
+  }
+
+
+  /* Returns the path of the file of the decode cache of the executable areas and their ranges of addresses */
+  static std::string getDecodeCachePath(const std::string& directory, triton::uint32 arch, const std::list<triton::format::MemoryMapping>& areas, triton::uint64& key, std::vector<std::pair<triton::uint64, triton::uint64>>& ranges) {
+    std::ostringstream path;
+
+    /* FNV-1a of the architecture and of the address, the size and the content of every executable area */
+    key = 0xcbf29ce484222325;
+    auto hash = [&key](const triton::uint8* data, triton::usize size) {
+      for (triton::usize index = 0; index < size; index++)
+        key = (key ^ data[index]) * 0x100000001b3;
+    };
+
+    hash(reinterpret_cast<const triton::uint8*>(&arch), sizeof(arch));
+    for (auto it = areas.begin(); it != areas.end(); it++) {
+      if (!it->isExecutable())
+        continue;
+
+      triton::uint64 addr = it->getVirtualAddress();
+      triton::uint64 size = it->getSize();
+      hash(reinterpret_cast<const triton::uint8*>(&addr), sizeof(addr));
+      hash(reinterpret_cast<const triton::uint8*>(&size), sizeof(size));
+      hash(it->getMemoryArea(), static_cast<triton::usize>(size));
+      ranges.push_back(std::make_pair(addr, addr + size));
+    }
+
+    path << directory << "/" << std::hex << std::setfill('0') << std::setw(16) << key << ".tdc";
+    return path.str();
+  }
+
+
+  triton::usize API::saveDecodeCache(const std::string& directory, const std::list<triton::format::MemoryMapping>& areas) {
+    std::vector<std::pair<triton::uint64, triton::uint64>> ranges;
+    triton::uint64 key = 0;
+
+    this->checkArchitecture();
+    std::string path = getDecodeCachePath(directory, this->getArchitecture(), areas, key, ranges);
+
+    return this->getCpu()->getDecodeCache().save(path, key, ranges);
+  }
+
+
+  triton::usize API::saveDecodeCache(const std::string& directory, const triton::format::AbstractBinary& binary) {
+    return this->saveDecodeCache(directory, binary.getMemoryMapping());
+  }
+
+
+  triton::usize API::saveDecodeCache(const std::string& directory, const triton::format::BinaryInterface& binary) {
+    return this->saveDecodeCache(directory, binary.getMemoryMapping());
+  }
+
+
+  triton::usize API::loadDecodeCache(const std::string& directory, const std::list<triton::format::MemoryMapping>& areas) {
+    std::vector<std::pair<triton::uint64, triton::uint64>> ranges;
+    triton::uint64 key = 0;
+
+    this->checkArchitecture();
+    std::string path = getDecodeCachePath(directory, this->getArchitecture(), areas, key, ranges);
+
+    return this->getCpu()->getDecodeCache().load(path, key);
+  }
+
+
+  triton::usize API::loadDecodeCache(const std::string& directory, const triton::format::AbstractBinary& binary) {
+    return this->loadDecodeCache(directory, binary.getMemoryMapping());
+  }
+
+
+  triton::usize API::loadDecodeCache(const std::string& directory, const triton::format::BinaryInterface& binary) {
+    return this->loadDecodeCache(directory, binary.getMemoryMapping());
+  }
+
+
   void API::disassembly(triton::arch::Instruction& inst) const {
     this->checkArchitecture();
-    this->arch.disassembly(inst);
+
+    triton::uint64 start = triton::utils::getMonotonicTime();
+    {
+      triton::utils::PerfScope perf(triton::utils::PERF_DISASSEMBLY);
+      this->arch.disassembly(inst);
+    }
+    triton::uint64 end = triton::utils::getMonotonicTime();
+    this->disassemblyTime += end - start;
+    this->disassembledInstructions++;
+
+    if (triton::utils::TraceEvents::isEnabled())
+      triton::utils::TraceEvents::record("disassembly", "pipeline", start, end);
   }
 
 
@@ -366,14 +734,25 @@ namespace triton {
     if (this->modes == nullptr)
       throw triton::exceptions::API("API::initEngines(): No enough memory.");
 
+    this->disassembledInstructions = 0;
+    this->disassemblyTime          = 0;
+    this->decodedAhead             = 0;
+    this->memorySoftLimitReported  = false;
+    this->mergedBranches           = 0;
+
+    /* The journal of the CPU is kept across the engines */
+    this->undoFlag = false;
+    this->undoSteps.clear();
+    this->arch.clearJournal();
+
+    /* Nothing else is needed to disassemble */
+    if (this->profile == triton::profiles::DISASSEMBLY)
+      return;
+
     this->symbolic = new(std::nothrow) triton::engines::symbolic::SymbolicEngine(&this->arch, this->modes, &this->callbacks);
     if (this->symbolic == nullptr)
       throw triton::exceptions::API("API::initEngines(): No enough memory.");
 
-    this->solver = new(std::nothrow) triton::engines::solver::SolverEngine(this->symbolic);
-    if (this->solver == nullptr)
-      throw triton::exceptions::API("API::initEngines(): No enough memory.");
-
     this->astGarbageCollector = new(std::nothrow) triton::ast::AstGarbageCollector(this->modes);
     if (this->astGarbageCollector == nullptr)
       throw triton::exceptions::API("API::initEngines(): No enough memory.");
@@ -386,6 +765,30 @@ namespace triton {
     if (this->irBuilder == nullptr)
       throw triton::exceptions::API("API::initEngines(): No enough memory.");
 
+    this->syscalls = new(std::nothrow) triton::os::unix::SyscallEmulator(this);
+    if (this->syscalls == nullptr)
+      throw triton::exceptions::API("API::initEngines(): No enough memory.");
+
+    this->summaries = new(std::nothrow) triton::os::unix::FunctionSummaries(this);
+    if (this->summaries == nullptr)
+      throw triton::exceptions::API("API::initEngines(): No enough memory.");
+
+    /* The emulation only needs the concrete semantics */
+    if (this->profile == triton::profiles::EMULATION) {
+      this->symbolic->enable(false);
+      this->taint->enable(false);
+      return;
+    }
+
+    this->solver = new(std::nothrow) triton::engines::solver::SolverEngine(this->symbolic);
+    if (this->solver == nullptr)
+      throw triton::exceptions::API("API::initEngines(): No enough memory.");
+
+    /* The solver bounds the addresses of the POINTER_SOLVER policy */
+    this->symbolic->setPointerBoundsSolver([this](triton::ast::AbstractNode* node, triton::uint64& min, triton::uint64& max) {
+      return this->solver->getUnsignedBounds(node, min, max);
+    });
+
     this->z3Interface = new(std::nothrow) triton::ast::Z3Interface(this->symbolic);
     if (this->z3Interface == nullptr)
       throw triton::exceptions::API("API::initEngines(): No enough memory.");
@@ -394,13 +797,32 @@ namespace triton {
 
   void API::removeEngines(void) {
     if (this->isArchitectureValid()) {
+      /* The recorder is shared by the process, it is stopped with the modes which enabled it */
+      if (this->modes != nullptr && this->modes->isModeEnabled(triton::modes::TRACE_EVENTS))
+        triton::utils::TraceEvents::enable(false);
+      if (this->modes != nullptr && this->modes->isModeEnabled(triton::modes::PERF_COUNTERS))
+        triton::utils::PerfCounters::enable(false);
+      if (this->modes != nullptr && this->modes->isModeEnabled(triton::modes::HUGE_PAGES))
+        triton::utils::HugePageArena::enable(false);
+
+      /* Snapshots hold symbolic expressions and states of this architecture */
+      for (auto it = this->snapshots.begin(); it != this->snapshots.end(); it++)
+        this->deleteSnapshot(it->second);
+      this->snapshots.clear();
+
+      /* The pending expressions are written before the file is closed */
+      this->stopDependencyExport();
+
+      /* Symbolic expressions release their nodes, so they must be deleted before the nodes */
+      delete this->symbolic;
       delete this->astGarbageCollector;
       delete this->irBuilder;
       delete this->modes;
       delete this->solver;
-      delete this->symbolic;
       delete this->taint;
       delete this->z3Interface;
+      delete this->syscalls;
+      delete this->summaries;
 
       this->astGarbageCollector = nullptr;
       this->irBuilder           = nullptr;
@@ -409,6 +831,8 @@ namespace triton {
       this->symbolic            = nullptr;
       this->taint               = nullptr;
       this->z3Interface         = nullptr;
+      this->syscalls            = nullptr;
+      this->summaries           = nullptr;
     }
   }
 
@@ -422,198 +846,1462 @@ namespace triton {
   }
 
 
-  bool API::processing(triton::arch::Instruction& inst) {
+  std::map<std::string, triton::usize> API::getStatistics(void) const {
+    std::map<std::string, triton::usize> stats;
+
     this->checkArchitecture();
-    this->disassembly(inst);
-    return this->buildSemantics(inst);
-  }
 
+    /* Pipeline */
+    stats["cpu.memoryPages"]          = this->arch.getNumberOfMemoryPages();
+    stats["disassembly.instructions"] = this->disassembledInstructions;
+    stats["disassembly.time"]         = this->disassemblyTime;
+    stats["disassembly.decodedAhead"] = this->decodedAhead;
+
+    /* The other components are not created by every profile */
+    if (this->astGarbageCollector) {
+      triton::ast::AstNodeAllocator* allocator = this->astGarbageCollector->getAstNodeAllocator();
+      std::map<std::string, triton::usize> live = triton::ast::AstDictionaries::getStatsByKind(allocator->getLiveNodesPerKind());
+      for (auto it = live.begin(); it != live.end(); it++)
+        stats["ast.live." + it->first] = it->second;
+
+      std::map<std::string, triton::usize> dictionaries = this->astGarbageCollector->getAstDictionariesStats();
+      stats["ast.liveNodes"]            = allocator->getLiveNodes();
+      stats["ast.peakNodes"]            = allocator->getPeakNodes();
+      stats["ast.reservedBytes"]        = allocator->getReservedBytes();
+      stats["ast.dictionaries.lookups"] = dictionaries["allocatedNodes"];
+      stats["ast.dictionaries.hits"]    = dictionaries["hits"];
+      stats["ast.dictionaries.size"]    = dictionaries["allocatedDictionaries"];
+    }
 
+    if (this->symbolic) {
+      stats["symbolic.expressions"]     = this->symbolic->getNumberOfSymbolicExpressions();
+      stats["symbolic.variables"]       = this->symbolic->getNumberOfSymbolicVariables();
+    }
 
-  /* IR builder API ================================================================================= */
+    if (this->taint) {
+      stats["taint.bytes"]              = this->taint->getNumberOfTaintedBytes();
+      stats["taint.registers"]          = this->taint->getNumberOfTaintedRegisters();
+    }
 
-  void API::checkIrBuilder(void) const {
-    if (!this->irBuilder)
-      throw triton::exceptions::API("API::checkIrBuilder(): IR builder is undefined.");
-  }
+    if (this->solver) {
+      std::map<std::string, triton::usize> solver = this->solver->getStatistics();
+      for (auto it = solver.begin(); it != solver.end(); it++)
+        stats["solver." + it->first] = it->second;
+    }
 
+    if (this->irBuilder) {
+      std::map<std::string, triton::usize> semantics = this->irBuilder->getStatistics();
+      for (auto it = semantics.begin(); it != semantics.end(); it++)
+        stats["semantics." + it->first] = it->second;
+    }
 
-  bool API::buildSemantics(triton::arch::Instruction& inst) {
-    this->checkIrBuilder();
-    return this->irBuilder->buildSemantics(inst);
+    if (this->modes && this->modes->isModeEnabled(triton::modes::PERF_COUNTERS)) {
+      std::map<std::string, triton::usize> perf = triton::utils::PerfCounters::getStatistics();
+      for (auto it = perf.begin(); it != perf.end(); it++)
+        stats["perf." + it->first] = it->second;
+    }
+
+    if (this->modes && this->modes->isModeEnabled(triton::modes::HUGE_PAGES)) {
+      std::map<std::string, triton::usize> arena = triton::utils::HugePageArena::getStatistics();
+      for (auto it = arena.begin(); it != arena.end(); it++)
+        stats["hugePages." + it->first] = it->second;
+    }
+
+    return stats;
   }
 
 
+  std::map<std::string, triton::usize> API::getMemoryUsage(void) const {
+    std::map<std::string, triton::usize> usage;
 
-  /* AST garbage collector API ====================================================================== */
+    this->checkArchitecture();
 
-  void API::checkAstGarbageCollector(void) const {
-    if (!this->astGarbageCollector)
-      throw triton::exceptions::API("API::checkAstGarbageCollector(): AST garbage collector is undefined.");
+    /* A component which is not created by the profile uses nothing */
+    usage["ast.dictionaries"] = this->astGarbageCollector ? this->astGarbageCollector->getAstDictionariesMemoryUsage() : 0;
+    usage["ast.nodes"]        = this->astGarbageCollector ? this->astGarbageCollector->getMemoryUsage() : 0;
+    usage["cpu"]              = this->arch.getMemoryUsage();
+    usage["pathManager"]      = this->symbolic ? this->symbolic->getPathManagerMemoryUsage() : 0;
+    usage["symbolic"]         = this->symbolic ? this->symbolic->getMemoryUsage() : 0;
+    usage["taint"]            = this->taint ? this->taint->getMemoryUsage() : 0;
+    usage["total"]            = this->getTotalMemoryUsage();
+
+    return usage;
   }
 
 
-  void API::freeAllAstNodes(void) {
-    this->checkAstGarbageCollector();
-    this->astGarbageCollector->freeAllAstNodes();
-  }
+  triton::usize API::getTotalMemoryUsage(void) const {
+    triton::usize usage = this->arch.getMemoryUsage();
 
+    if (this->astGarbageCollector)
+      usage += this->astGarbageCollector->getAstDictionariesMemoryUsage() + this->astGarbageCollector->getMemoryUsage();
 
-  void API::freeAstNodes(std::set<triton::ast::AbstractNode*>& nodes) {
-    this->checkAstGarbageCollector();
-    this->astGarbageCollector->freeAstNodes(nodes);
-  }
+    if (this->symbolic)
+      usage += this->symbolic->getPathManagerMemoryUsage() + this->symbolic->getMemoryUsage();
 
+    if (this->taint)
+      usage += this->taint->getMemoryUsage();
 
-  void API::extractUniqueAstNodes(std::set<triton::ast::AbstractNode*>& uniqueNodes, triton::ast::AbstractNode* root) const {
-    this->checkAstGarbageCollector();
-    this->astGarbageCollector->extractUniqueAstNodes(uniqueNodes, root);
+    return usage;
   }
 
 
-  triton::ast::AbstractNode* API::recordAstNode(triton::ast::AbstractNode* node) {
-    this->checkAstGarbageCollector();
-    return this->astGarbageCollector->recordAstNode(node);
+  void API::setMemoryLimits(triton::usize soft, triton::usize hard) {
+    if (soft != 0 && hard != 0 && soft > hard)
+      throw triton::exceptions::API("API::setMemoryLimits(): The soft limit cannot be greater than the hard limit.");
+
+    this->memorySoftLimit         = soft;
+    this->memoryHardLimit         = hard;
+    this->memorySoftLimitReported = false;
   }
 
 
-  void API::recordVariableAstNode(const std::string& name, triton::ast::AbstractNode* node) {
-    this->checkAstGarbageCollector();
-    this->astGarbageCollector->recordVariableAstNode(name, node);
-  }
+  void API::checkMemoryLimits(void) {
+    triton::usize usage = this->getTotalMemoryUsage();
 
+    if (this->memoryHardLimit != 0 && usage > this->memoryHardLimit) {
+      this->processCallbacks(triton::callbacks::MEMORY_LIMIT, true, usage);
+      this->memorySoftLimitReported = true;
 
-  const std::set<triton::ast::AbstractNode*>& API::getAllocatedAstNodes(void) const {
-    this->checkAstGarbageCollector();
-    return this->astGarbageCollector->getAllocatedAstNodes();
-  }
+      /* The callbacks did not free enough, drop the symbolic state */
+      usage = this->getTotalMemoryUsage();
+      if (usage > this->memoryHardLimit) {
+        this->concretizeAllRegister();
+        this->concretizeAllMemory();
+        this->collectUnreachableExpressions();
+        if (this->getTotalMemoryUsage() > this->memoryHardLimit)
+          throw triton::exceptions::API("API::checkMemoryLimits(): The hard memory limit is exceeded even after concretizing every register and memory cell.");
+      }
+      return;
+    }
 
+    if (this->memorySoftLimit != 0 && usage > this->memorySoftLimit) {
+      if (!this->memorySoftLimitReported) {
+        this->memorySoftLimitReported = true;
+        this->processCallbacks(triton::callbacks::MEMORY_LIMIT, false, usage);
+      }
+      return;
+    }
 
-  std::map<std::string, triton::usize> API::getAstDictionariesStats(void) const {
-    this->checkAstGarbageCollector();
-    return this->astGarbageCollector->getAstDictionariesStats();
+    this->memorySoftLimitReported = false;
   }
 
 
-  const std::map<std::string, triton::ast::AbstractNode*>& API::getAstVariableNodes(void) const {
-    this->checkAstGarbageCollector();
-    return this->astGarbageCollector->getAstVariableNodes();
-  }
+  bool API::processing(triton::arch::Instruction& inst) {
+    bool ret = false;
 
+    this->checkArchitecture();
+    this->disassembly(inst);
 
-  triton::ast::AbstractNode* API::getAstVariableNode(const std::string& name) const {
-    this->checkAstGarbageCollector();
-    return this->astGarbageCollector->getAstVariableNode(name);
-  }
+    if (this->undoFlag)
+      this->startUndoStep(true);
 
+    ret = this->buildSemantics(inst);
 
-  void API::setAllocatedAstNodes(const std::set<triton::ast::AbstractNode*>& nodes) {
-    this->checkAstGarbageCollector();
-    this->astGarbageCollector->setAllocatedAstNodes(nodes);
-  }
+    if (this->memorySoftLimit != 0 || this->memoryHardLimit != 0)
+      this->checkMemoryLimits();
 
+    #ifdef TRITON_PYTHON_BINDINGS
+    /* Batched callbacks are delivered at the end of every basic block */
+    if (this->callbacks.isBatchedCallbackDefined() && inst.isControlFlow())
+      this->callbacks.flushCallbacks();
+    #endif
 
-  void API::setAstVariableNodes(const std::map<std::string, triton::ast::AbstractNode*>& nodes) {
-    this->checkAstGarbageCollector();
-    this->astGarbageCollector->setAstVariableNodes(nodes);
+    return ret;
   }
 
 
-  /* AST representation API ========================================================================= */
+  triton::usize API::processBlock(triton::uint64 addr, const triton::uint8* area, triton::usize size, triton::usize count) {
+    triton::arch::Instruction inst;
+    triton::usize offset    = 0;
+    triton::usize processed = 0;
 
-  triton::uint32 API::getAstRepresentationMode(void) const {
-    return triton::ast::representations::astRepresentation.getMode();
-  }
+    this->checkArchitecture();
 
+    if (area == nullptr && size != 0)
+      throw triton::exceptions::API("API::processBlock(): The buffer cannot be null.");
+
+    /* The same instruction is reused, so its containers are only allocated once */
+    while (offset < size && (count == 0 || processed < count)) {
+      inst.reset();
+      inst.setOpcodes(area + offset, static_cast<triton::uint32>(std::min<triton::usize>(size - offset, 16)));
+      inst.setAddress(addr + offset);
+      this->processing(inst);
+      offset += inst.getSize();
+      processed++;
+    }
 
-  void API::setAstRepresentationMode(triton::uint32 mode) {
-    triton::ast::representations::astRepresentation.setMode(mode);
+    return processed;
   }
 
 
+  triton::usize API::emulate(triton::uint64 start, const std::set<triton::uint64>& stopAddresses, triton::usize maxInsns) {
+    std::map<triton::uint64, triton::callbacks::addressHookCallback> hooks;
 
-  /* Callbacks API ================================================================================= */
+    for (triton::uint64 addr : stopAddresses)
+      hooks[addr] = [](triton::uint64) { return false; };
 
-  void API::addCallback(triton::callbacks::getConcreteMemoryValueCallback cb) {
-    this->callbacks.addCallback(cb);
+    return this->run(start, hooks, maxInsns);
   }
 
 
-  void API::addCallback(triton::callbacks::getConcreteRegisterValueCallback cb) {
-    this->callbacks.addCallback(cb);
-  }
+  /* Counts the edge to `dst` into an AFL-style edge map */
+  static inline void countEdge(triton::uint8* edgeMap, triton::uint64 dst, triton::uint32& previous) {
+    triton::uint64 hash = dst * 0x9e3779b97f4a7c15;
+    triton::uint32 current = static_cast<triton::uint32>(hash >> 48) & (triton::engines::exploration::EDGE_MAP_SIZE - 1);
 
+    triton::uint8& counter = edgeMap[current ^ previous];
+    if (counter != 0xff)
+      counter++;
 
-  void API::addCallback(triton::callbacks::symbolicSimplificationCallback cb) {
-    this->callbacks.addCallback(cb);
+    previous = current >> 1;
   }
 
 
-  #ifdef TRITON_PYTHON_BINDINGS
-  void API::addCallback(PyObject* function, triton::callbacks::callback_e kind) {
-    this->callbacks.addCallback(function, kind);
-  }
-  #endif
+  triton::usize API::run(triton::uint64 entry, const std::map<triton::uint64, triton::callbacks::addressHookCallback>& hooks, triton::usize maxInsns, triton::uint8* edgeMap) {
+    triton::arch::Instruction inst;
+    triton::usize processed = 0;
+    triton::uint64 pc       = entry;
+    triton::uint32 previous = 0;
+    MergedBranch merge;
+
+    this->checkArchitecture();
+    this->checkIrBuilder();
+    this->checkFunctionSummaries();
+    this->setConcreteRegisterValue(triton::arch::Register(TRITON_X86_REG_PC.getId(), entry));
+
+    /* The next blocks are decoded by a helper thread, which is stopped whatever the way run() returns */
+    std::unique_ptr<triton::arch::DecodeAhead> ahead;
+    triton::arch::DecodeCache& cache = this->getCpu()->getDecodeCache();
+    bool blockStart = true;
+    if (this->isModeEnabled(triton::modes::DECODE_AHEAD))
+      ahead.reset(new triton::arch::DecodeAhead(this->getCpu(), [this]() { this->bind(); }));
+
+    /* The counted loops are only looked for once per loop head and run */
+    bool loops = this->isModeEnabled(triton::modes::LOOP_SUMMARIES);
+    std::set<triton::uint64> uncounted;
+
+    /* The expressions kept by a merge must not be collected */
+    bool merging = this->isSymbolicEngineEnabled() && this->isModeEnabled(triton::modes::STATE_MERGING) && !this->isModeEnabled(triton::modes::ONLY_LIVE_EXPRESSIONS);
+    merge.join = 0;
+
+    while (pc && (maxInsns == 0 || processed < maxInsns)) {
+      /* The taken side of a merged branch has reached the join */
+      if (merge.join != 0 && pc == merge.join)
+        this->mergeStates(merge);
+
+      /* The hooks of the user take precedence over the function summaries */
+      const triton::callbacks::addressHookCallback* hook = nullptr;
+      auto it = hooks.find(pc);
+      if (it != hooks.end())
+        hook = &it->second;
+      else
+        hook = this->summaries->getHook(pc);
+
+      if (hook != nullptr) {
+        /* Only the learned summaries are known to keep the function being learned pure */
+        if (this->summaries->isLearning() && (it != hooks.end() || !this->summaries->isLearned(pc)))
+          this->summaries->abortLearning();
+
+        if (!(*hook)(pc))
+          break;
+
+        /* The hook may have redirected the execution (e.g. to simulate a routine) */
+        triton::uint64 next = this->getConcreteRegisterValue(TRITON_X86_REG_PC).convert_to<triton::uint64>();
+        if (next != pc) {
+          if (edgeMap != nullptr)
+            countEdge(edgeMap, next, previous);
+          pc = next;
+          blockStart = true;
+          continue;
+        }
+      }
+
+      /* The code of a new block is copied for the helper, the memory is only read by this thread */
+      if (ahead != nullptr) {
+        this->decodedAhead += ahead->drain(cache);
+        if (blockStart && !cache.contains(pc))
+          ahead->request(pc, this->getConcreteMemoryAreaValue(pc, triton::arch::DecodeAhead::window, false));
+        blockStart = false;
+      }
+
+      /* Fetch the opcodes */
+      std::vector<triton::uint8> opcodes = this->getConcreteMemoryAreaValue(pc, 16);
+
+      inst.reset();
+      inst.setOpcodes(opcodes.data(), static_cast<triton::uint32>(opcodes.size()));
+      inst.setAddress(pc);
+
+      /* The function being learned sees symbolic variables instead of the memory it loads */
+      if (this->summaries->isLearning())
+        this->summaries->prepareInstruction(inst);
+
+      triton::usize constraints = (merging ? this->symbolic->getNumberOfPathConstraints() : 0);
+
+      this->processing(inst);
+      processed++;
+
+      if (this->summaries->isLearning())
+        this->summaries->observeInstruction(inst);
+
+      /* The taken side of a merged branch records its stores until the join */
+      if (merge.join != 0) {
+        for (const auto& store : inst.getStoreAccess()) {
+          for (triton::uint32 index = 0; index < store.first.getSize(); index++)
+            merge.stores.insert(store.first.getAddress() + index);
+        }
+        if (merge.remaining == 0)
+          this->releaseMerge(merge);
+        else
+          merge.remaining--;
+      }
+
+      /* A symbolic branch is merged if its sides join soon enough */
+      else if (merging && inst.isBranch() && !this->summaries->isLearning() && this->symbolic->getNumberOfPathConstraints() == constraints + 1) {
+        const triton::engines::symbolic::PathConstraint& branch = this->symbolic->getPathConstraints().back();
+        if (branch.isMultipleBranches() && branch.getTakenPathConstraintAst()->isSymbolized())
+          this->prepareMerge(inst, hooks, merge);
+      }
+
+      if (inst.getType() == triton::arch::x86::ID_INS_HLT)
+        break;
+
+      /* The syscall is emulated natively, an exit stops the emulation */
+      if (inst.getType() == triton::arch::x86::ID_INS_SYSCALL && this->isSyscallEmulationEnabled() && !this->syscalls->emulate())
+        break;
+
+      /* Next */
+      pc = this->getConcreteRegisterValue(TRITON_X86_REG_PC).convert_to<triton::uint64>();
+
+      if (edgeMap != nullptr && inst.isControlFlow())
+        countEdge(edgeMap, pc, previous);
+
+      /* A branch taken backwards closes a loop, a counted one gets its iterations but the last one at once */
+      if (loops && inst.isBranch() && pc <= inst.getAddress() && merge.join == 0 && !this->summaries->isLearning() && uncounted.find(pc) == uncounted.end()) {
+        if (!this->summarizeLoop(pc, inst, hooks))
+          uncounted.insert(pc);
+      }
+
+      blockStart = inst.isControlFlow();
+    }
 
+    /* The blocks decoded ahead and not reached yet are kept for the next runs */
+    if (ahead != nullptr) {
+      ahead->finish();
+      this->decodedAhead += ahead->drain(cache);
+    }
 
-  void API::removeAllCallbacks(void) {
-    this->callbacks.removeAllCallbacks();
+    if (merge.join != 0)
+      this->releaseMerge(merge);
+
+    return processed;
   }
 
 
-  void API::removeCallback(triton::callbacks::getConcreteMemoryValueCallback cb) {
-    this->callbacks.removeCallback(cb);
+  void API::setStateMergingLimit(triton::usize limit) {
+    this->stateMergingLimit = limit;
   }
 
 
-  void API::removeCallback(triton::callbacks::getConcreteRegisterValueCallback cb) {
-    this->callbacks.removeCallback(cb);
+  triton::usize API::getStateMergingLimit(void) const {
+    return this->stateMergingLimit;
   }
 
 
-  void API::removeCallback(triton::callbacks::symbolicSimplificationCallback cb) {
-    this->callbacks.removeCallback(cb);
+  triton::usize API::getNumberOfMergedBranches(void) const {
+    return this->mergedBranches;
   }
 
 
-  #ifdef TRITON_PYTHON_BINDINGS
-  void API::removeCallback(PyObject* function, triton::callbacks::callback_e kind) {
-    this->callbacks.removeCallback(function, kind);
-  }
-  #endif
+  /* Replaces the references to the expressions from `firstExprId`, which are deleted when a side is rewound, by their AST */
+  static triton::ast::AbstractNode* unrollReferences(triton::ast::AbstractNode* node, triton::usize firstExprId, std::unordered_map<triton::ast::AbstractNode*, triton::ast::AbstractNode*>& unrolled) {
+    std::vector<std::pair<triton::ast::AbstractNode*, bool>> worklist;
 
+    worklist.push_back(std::make_pair(node, false));
+    while (!worklist.empty()) {
+      triton::ast::AbstractNode* current = worklist.back().first;
+      bool expanded = worklist.back().second;
+      std::vector<triton::ast::AbstractNode*> childs;
 
-  triton::ast::AbstractNode* API::processCallbacks(triton::callbacks::callback_e kind, triton::ast::AbstractNode* node) const {
-    if (this->callbacks.isDefined)
-      return this->callbacks.processCallbacks(kind, node);
-    return node;
-  }
+      if (unrolled.find(current) != unrolled.end()) {
+        worklist.pop_back();
+        continue;
+      }
 
+      if (current->getKind() == triton::ast::REFERENCE_NODE) {
+        triton::ast::ReferenceNode* ref = reinterpret_cast<triton::ast::ReferenceNode*>(current);
+        if (ref->getValue() >= firstExprId && ref->getSymbolicExpression() != nullptr)
+          childs.push_back(ref->getAst());
+      }
+      else
+        childs = current->getChilds();
 
-  void API::processCallbacks(triton::callbacks::callback_e kind, const triton::arch::MemoryAccess& mem) const {
-    if (this->callbacks.isDefined)
-      this->callbacks.processCallbacks(kind, mem);
-  }
+      if (!expanded) {
+        worklist.back().second = true;
+        for (auto it = childs.rbegin(); it != childs.rend(); it++) {
+          if (unrolled.find(*it) == unrolled.end())
+            worklist.push_back(std::make_pair(*it, false));
+        }
+        continue;
+      }
 
+      worklist.pop_back();
 
-  void API::processCallbacks(triton::callbacks::callback_e kind, const triton::arch::Register& reg) const {
-    if (this->callbacks.isDefined)
-      this->callbacks.processCallbacks(kind, reg);
-  }
+      if (current->getKind() == triton::ast::REFERENCE_NODE) {
+        unrolled[current] = (childs.empty() ? current : unrolled.at(childs.front()));
+        continue;
+      }
 
+      std::vector<triton::ast::AbstractNode*> newChilds;
+      bool changed = false;
 
+      for (auto it = childs.begin(); it != childs.end(); it++) {
+        triton::ast::AbstractNode* child = unrolled.at(*it);
+        changed = changed || (child != *it);
+        newChilds.push_back(child);
+      }
 
-  /* Modes API======================================================================================= */
+      unrolled[current] = (changed ? triton::ast::newInstance(current, newChilds) : current);
+    }
 
-  void API::checkModes(void) const {
-    if (!this->modes)
-      throw triton::exceptions::API("API::checkModes(): Modes interface is undefined.");
+    return unrolled.at(node);
+  }
+
+
+  bool API::speculate(triton::uint64 pc, const std::map<triton::uint64, triton::callbacks::addressHookCallback>& hooks, triton::usize limit, const std::set<triton::uint64>* joins, std::vector<triton::uint64>& trace, std::set<triton::uint64>& stores) {
+    triton::arch::Instruction inst;
+
+    for (triton::usize count = 0; ; count++) {
+      trace.push_back(pc);
+
+      if (joins != nullptr && joins->find(pc) != joins->end())
+        return true;
+
+      /* The hooks and the summaries may have side effects which are not journaled */
+      if (count == limit || pc == 0 || hooks.find(pc) != hooks.end() || this->summaries->getHook(pc) != nullptr)
+        return false;
+
+      std::vector<triton::uint8> opcodes = this->getConcreteMemoryAreaValue(pc, 16);
+
+      inst.reset();
+      inst.setOpcodes(opcodes.data(), static_cast<triton::uint32>(opcodes.size()));
+      inst.setAddress(pc);
+      this->processing(inst);
+
+      for (const auto& store : inst.getStoreAccess()) {
+        for (triton::uint32 index = 0; index < store.first.getSize(); index++)
+          stores.insert(store.first.getAddress() + index);
+      }
+
+      if (inst.getType() == triton::arch::x86::ID_INS_HLT || inst.getType() == triton::arch::x86::ID_INS_SYSCALL)
+        return false;
+
+      pc = this->getConcreteRegisterValue(TRITON_X86_REG_PC).convert_to<triton::uint64>();
+    }
+  }
+
+
+  bool API::summarizeLoop(triton::uint64 head, const triton::arch::Instruction& branch, const std::map<triton::uint64, triton::callbacks::addressHookCallback>& hooks) {
+    std::vector<triton::arch::Instruction> body;
+    triton::uint64 addr = head;
+
+    /* The body is straight-line code, and the hooks must see each of its iterations */
+    while (addr <= branch.getAddress() && body.size() < 16) {
+      if (hooks.find(addr) != hooks.end() || this->summaries->getHook(addr) != nullptr)
+        return false;
+
+      if (addr == branch.getAddress()) {
+        body.push_back(branch);
+        break;
+      }
+
+      std::vector<triton::uint8> opcodes = this->getConcreteMemoryAreaValue(addr, 16);
+      body.push_back(triton::arch::Instruction());
+      body.back().setOpcodes(opcodes.data(), static_cast<triton::uint32>(opcodes.size()));
+      body.back().setAddress(addr);
+      this->disassembly(body.back());
+
+      if (body.back().isControlFlow())
+        return false;
+
+      addr = body.back().getNextAddress();
+    }
+
+    if (body.empty() || body.back().getAddress() != branch.getAddress())
+      return false;
+
+    /* The iterations applied are undone as one instruction */
+    if (this->undoFlag)
+      this->startUndoStep(true);
+
+    return this->irBuilder->buildInductionLoopSemantics(body);
+  }
+
+
+  bool API::prepareMerge(const triton::arch::Instruction& inst, const std::map<triton::uint64, triton::callbacks::addressHookCallback>& hooks, MergedBranch& merge) {
+    const triton::engines::symbolic::PathConstraint& branch = this->symbolic->getPathConstraints().back();
+    std::unordered_map<triton::ast::AbstractNode*, triton::ast::AbstractNode*> unrolled;
+    std::vector<triton::uint64> takenTrace;
+    std::vector<triton::uint64> otherTrace;
+    std::set<triton::uint64> takenStores;
+    std::set<triton::uint64> otherStores;
+    triton::uint64 taken = this->getConcreteRegisterValue(TRITON_X86_REG_PC).convert_to<triton::uint64>();
+    triton::uint64 other = 0;
+    triton::usize step   = this->undoSteps.size();
+    bool journal         = this->undoFlag;
+
+    for (const auto& target : branch.getBranchConstraints()) {
+      if (!std::get<0>(target) && std::get<2>(target) != taken) {
+        other = std::get<2>(target);
+        break;
+      }
+    }
+
+    if (other == 0)
+      return false;
+
+    merge.address         = inst.getAddress();
+    merge.join            = 0;
+    merge.remaining       = 0;
+    merge.condition       = branch.getTakenPathConstraintAst();
+    merge.pathConstraints = this->symbolic->getNumberOfPathConstraints() - 1;
+    merge.condition->incReference();
+
+    /* The sides are rewound with the undo journal */
+    this->undoFlag = true;
+
+    try {
+      this->checkpoint();
+      merge.firstExprId = this->symbolic->getNextSymbolicExpressionId();
+
+      for (const triton::arch::Register* reg : this->getParentRegisters())
+        merge.initial[reg->getId()] = std::make_pair(this->getSymbolicRegisterId(*reg), this->getConcreteRegisterValue(*reg));
+
+      /* The taken side gives the candidate joins */
+      this->speculate(taken, hooks, this->stateMergingLimit, nullptr, takenTrace, takenStores);
+      this->rewindTo(step);
+
+      /* A byte stored by the taken side only keeps its value of the branch on the other side */
+      for (triton::uint64 addr : takenStores) {
+        MergedValue value = {this->buildSymbolicMemory(triton::arch::MemoryAccess(addr, BYTE_SIZE)), this->isMemoryTainted(addr), false};
+        value.node->incReference();
+        merge.memory[addr] = value;
+      }
+
+      std::set<triton::uint64> joins(takenTrace.begin(), takenTrace.end());
+
+      this->checkpoint();
+      this->setConcreteRegisterValue(triton::arch::Register(TRITON_X86_REG_PC.getId(), other));
+
+      if (this->speculate(other, hooks, this->stateMergingLimit, &joins, otherTrace, otherStores)) {
+        merge.join      = otherTrace.back();
+        merge.remaining = std::find(takenTrace.begin(), takenTrace.end(), merge.join) - takenTrace.begin();
+
+        for (const triton::arch::Register* reg : this->getParentRegisters()) {
+          const std::pair<triton::usize, triton::uint512>& initial = merge.initial.at(reg->getId());
+          if (reg->getId() == TRITON_X86_REG_PC.getId())
+            continue;
+          if (!this->symbolic->isLazyFlag(*reg) && this->getSymbolicRegisterId(*reg) == initial.first && this->getConcreteRegisterValue(*reg) == initial.second)
+            continue;
+          MergedValue value = {unrollReferences(this->buildSymbolicRegister(*reg), merge.firstExprId, unrolled), this->isRegisterTainted(*reg), true};
+          value.node->incReference();
+          merge.registers[reg->getId()] = value;
+        }
+
+        for (triton::uint64 addr : otherStores) {
+          MergedValue value = {unrollReferences(this->buildSymbolicMemory(triton::arch::MemoryAccess(addr, BYTE_SIZE)), merge.firstExprId, unrolled), this->isMemoryTainted(addr), true};
+          value.node->incReference();
+          if (merge.memory.find(addr) != merge.memory.end())
+            merge.memory.at(addr).node->decReference();
+          merge.memory[addr] = value;
+        }
+
+        const std::vector<triton::engines::symbolic::PathConstraint>& constraints = this->symbolic->getPathConstraints();
+        for (triton::usize index = merge.pathConstraints + 1; index < constraints.size(); index++) {
+          triton::ast::AbstractNode* node = constraints[index].getTakenPathConstraintAst();
+          if (!node->isSymbolized())
+            continue;
+          node = unrollReferences(node, merge.firstExprId, unrolled);
+          node->incReference();
+          merge.otherConstraints.push_back(node);
+        }
+      }
+
+      this->rewindTo(step);
+    }
+    catch (const std::exception&) {
+      if (this->undoSteps.size() > step)
+        this->rewindTo(step);
+      if (!journal)
+        this->clearUndoJournal();
+      this->undoFlag = journal;
+      this->releaseMerge(merge);
+      throw;
+    }
+
+    if (!journal)
+      this->clearUndoJournal();
+    this->undoFlag = journal;
+
+    if (merge.join == 0) {
+      this->releaseMerge(merge);
+      return false;
+    }
+
+    return true;
+  }
+
+
+  void API::mergeStates(MergedBranch& merge) {
+    const std::vector<triton::engines::symbolic::PathConstraint>& constraints = this->symbolic->getPathConstraints();
+    triton::ast::AbstractNode* takenSide = merge.condition;
+    triton::ast::AbstractNode* otherSide = triton::ast::lnot(merge.condition);
+    triton::ast::AbstractNode* predicate = nullptr;
+    bool symbolized = !merge.otherConstraints.empty();
+
+    /* The registers changed by either side select their value with the condition of the taken side */
+    for (const triton::arch::Register* reg : this->getParentRegisters()) {
+      auto initial = merge.initial.find(reg->getId());
+      auto value   = merge.registers.find(reg->getId());
+
+      if (reg->getId() == TRITON_X86_REG_PC.getId() || initial == merge.initial.end())
+        continue;
+
+      bool changed = this->symbolic->isLazyFlag(*reg) || this->getSymbolicRegisterId(*reg) != initial->second.first || this->getConcreteRegisterValue(*reg) != initial->second.second;
+      if (!changed && value == merge.registers.end())
+        continue;
+
+      triton::ast::AbstractNode* otherNode = nullptr;
+      if (value != merge.registers.end())
+        otherNode = value->second.node;
+      else if (initial->second.first != triton::engines::symbolic::UNSET)
+        otherNode = triton::ast::extract(reg->getHigh(), reg->getLow(), triton::ast::reference(initial->second.first));
+      else
+        otherNode = triton::ast::bv(initial->second.second, reg->getBitSize());
+
+      triton::ast::AbstractNode* node = triton::ast::ite(merge.condition, this->buildSymbolicRegister(*reg), otherNode);
+      triton::engines::symbolic::SymbolicExpression* expr = this->newSymbolicExpression(node, "merged state");
+      this->assignSymbolicExpressionToRegister(expr, triton::arch::Register(reg->getId(), this->getConcreteRegisterValue(*reg)));
+
+      if (value != merge.registers.end() && value->second.tainted)
+        this->taintRegister(*reg);
+    }
+
+    /* The bytes stored by the taken side have all been stored by its speculation */
+    for (auto it = merge.memory.begin(); it != merge.memory.end(); it++) {
+      if (!it->second.stored && merge.stores.find(it->first) == merge.stores.end())
+        continue;
+
+      triton::arch::MemoryAccess mem(it->first, BYTE_SIZE);
+      triton::ast::AbstractNode* node = triton::ast::ite(merge.condition, this->buildSymbolicMemory(mem), it->second.node);
+      triton::engines::symbolic::SymbolicExpression* expr = this->newSymbolicExpression(node, "merged state");
+      this->assignSymbolicExpressionToMemory(expr, triton::arch::MemoryAccess(it->first, BYTE_SIZE, this->getConcreteMemoryValue(it->first)));
+
+      if (it->second.tainted)
+        this->taintMemory(it->first);
+    }
+
+    /* The path predicate of each side, the disjunction is trivially true if no side has any */
+    for (triton::usize index = merge.pathConstraints + 1; index < constraints.size(); index++) {
+      triton::ast::AbstractNode* node = constraints[index].getTakenPathConstraintAst();
+      if (node->isSymbolized()) {
+        takenSide  = triton::ast::land(takenSide, node);
+        symbolized = true;
+      }
+    }
+
+    for (auto it = merge.otherConstraints.begin(); it != merge.otherConstraints.end(); it++)
+      otherSide = triton::ast::land(otherSide, *it);
+
+    if (symbolized) {
+      predicate = triton::ast::lor(takenSide, otherSide);
+      predicate->incReference();
+    }
+
+    this->symbolic->truncatePathConstraints(merge.pathConstraints);
+
+    if (predicate != nullptr) {
+      triton::engines::symbolic::PathConstraint pco;
+      pco.addBranchConstraint(true, merge.address, merge.join, predicate);
+      this->symbolic->addPathConstraint(pco);
+      predicate->decReference();
+    }
+
+    this->mergedBranches++;
+    this->releaseMerge(merge);
+  }
+
+
+  void API::releaseMerge(MergedBranch& merge) {
+    merge.condition->decReference();
+
+    for (auto it = merge.registers.begin(); it != merge.registers.end(); it++)
+      it->second.node->decReference();
+
+    for (auto it = merge.memory.begin(); it != merge.memory.end(); it++)
+      it->second.node->decReference();
+
+    for (auto it = merge.otherConstraints.begin(); it != merge.otherConstraints.end(); it++)
+      (*it)->decReference();
+
+    merge.join = 0;
+    merge.initial.clear();
+    merge.registers.clear();
+    merge.memory.clear();
+    merge.stores.clear();
+    merge.otherConstraints.clear();
+  }
+
+
+
+  triton::usize API::replayTrace(const std::string& path, triton::usize maxInsns, triton::uint64 start) {
+    triton::format::TraceInstruction record;
+    triton::format::TraceReader trace;
+    triton::arch::Instruction inst;
+    triton::usize processed = 0;
+
+    this->checkArchitecture();
+
+    trace.open(path);
+    if (trace.getArchitecture() != this->getArchitecture())
+      throw triton::exceptions::API("API::replayTrace(): The trace has been recorded on another architecture.");
+
+    if (!trace.seek(start))
+      return 0;
+
+    while ((maxInsns == 0 || processed < maxInsns) && trace.next(record)) {
+      /* Synchronize the concrete state with the trace */
+      for (const auto& reg : record.registers)
+        this->setConcreteRegisterValue(triton::arch::Register(reg.first, reg.second));
+
+      for (const auto& mem : record.memoryReads)
+        this->setConcreteMemoryAreaValue(mem.first, mem.second);
+
+      inst.reset();
+      inst.setOpcodes(record.opcodes.data(), static_cast<triton::uint32>(record.opcodes.size()));
+      inst.setAddress(record.address);
+      inst.setThreadId(record.threadId);
+      this->processing(inst);
+      processed++;
+    }
+
+    return processed;
+  }
+
+
+
+  /* Snapshot API ================================================================================== */
+
+  void API::deleteSnapshot(Snapshot& snap) {
+    delete snap.cpu;
+    delete snap.symbolic;
+    delete snap.taint;
+    snap.cpu      = nullptr;
+    snap.symbolic = nullptr;
+    snap.taint    = nullptr;
+
+    /* The expressions of the engine copy have released their nodes, the frozen ones may be freed now */
+    if (this->astGarbageCollector)
+      this->astGarbageCollector->releaseAstGeneration(snap.generation);
+  }
+
+
+  triton::usize API::snapshot(void) {
+    Snapshot snap;
+
+    this->checkArchitecture();
+    this->checkSymbolic();
+    this->checkTaint();
+    this->checkAstGarbageCollector();
+
+    /* The CPU copy shares the pages of the concrete memory */
+    switch (this->getArchitecture()) {
+      case triton::arch::ARCH_X86_64:
+        snap.cpu = new(std::nothrow) triton::arch::x86::x8664Cpu(*dynamic_cast<triton::arch::x86::x8664Cpu*>(this->getCpu()));
+        break;
+      case triton::arch::ARCH_X86:
+        snap.cpu = new(std::nothrow) triton::arch::x86::x86Cpu(*dynamic_cast<triton::arch::x86::x86Cpu*>(this->getCpu()));
+        break;
+      default:
+        snap.cpu = nullptr;
+        break;
+    }
+
+    /* The engine copy shares the symbolic expressions and variables */
+    snap.symbolic = new(std::nothrow) triton::engines::symbolic::SymbolicEngine(*this->symbolic);
+    snap.taint    = new(std::nothrow) triton::engines::taint::TaintEngine(*this->taint);
+
+    if (snap.cpu == nullptr || snap.symbolic == nullptr || snap.taint == nullptr) {
+      this->deleteSnapshot(snap);
+      throw triton::exceptions::API("API::snapshot(): Not enough memory.");
+    }
+
+    /* The nodes are not copied, they are frozen and shared with the snapshot */
+    snap.generation = this->astGarbageCollector->freezeAstNodes();
+    snap.variables  = this->astGarbageCollector->getAstVariableNodes();
+
+    this->snapshots[this->uniqueSnapshotId] = std::move(snap);
+    return this->uniqueSnapshotId++;
+  }
+
+
+  void API::restore(triton::usize id) {
+    this->checkArchitecture();
+    this->checkSymbolic();
+    this->checkTaint();
+    this->checkAstGarbageCollector();
+
+    auto snap = this->snapshots.find(id);
+    if (snap == this->snapshots.end())
+      throw triton::exceptions::API("API::restore(): Snapshot not found.");
+
+    /* The steps of the undo journal are relative to the state replaced */
+    this->clearUndoJournal();
+
+    switch (this->getArchitecture()) {
+      case triton::arch::ARCH_X86_64:
+        *dynamic_cast<triton::arch::x86::x8664Cpu*>(this->getCpu()) = *dynamic_cast<triton::arch::x86::x8664Cpu*>(snap->second.cpu);
+        break;
+      case triton::arch::ARCH_X86:
+        *dynamic_cast<triton::arch::x86::x86Cpu*>(this->getCpu()) = *dynamic_cast<triton::arch::x86::x86Cpu*>(snap->second.cpu);
+        break;
+    }
+
+    /* The engines drop their expressions which are not held by the snapshot */
+    *this->symbolic = *snap->second.symbolic;
+    *this->taint    = *snap->second.taint;
+
+    /*
+     * The nodes allocated since the last freeze are not held by any snapshot and are freed. The
+     * frozen nodes are never freed by the garbage collector, so the variables of the snapshot are
+     * still allocated, unless every node has been freed since.
+     */
+    this->astGarbageCollector->setAstGeneration(snap->second.generation);
+    if (this->astGarbageCollector->getAstGeneration() == snap->second.generation)
+      this->astGarbageCollector->setAstVariableNodes(snap->second.variables);
+    else
+      this->astGarbageCollector->setAstVariableNodes(std::unordered_map<triton::usize, triton::ast::AbstractNode*>());
+  }
+
+
+  void API::removeSnapshot(triton::usize id) {
+    auto snap = this->snapshots.find(id);
+    if (snap == this->snapshots.end())
+      throw triton::exceptions::API("API::removeSnapshot(): Snapshot not found.");
+
+    this->deleteSnapshot(snap->second);
+    this->snapshots.erase(snap);
+  }
+
+
+  std::vector<triton::usize> API::getSnapshots(void) const {
+    std::vector<triton::usize> ids;
+
+    for (auto it = this->snapshots.begin(); it != this->snapshots.end(); it++)
+      ids.push_back(it->first);
+
+    return ids;
+  }
+
+
+  /* The version of the checkpoint files */
+  static const triton::uint32 checkpointVersion = 1;
+
+  /* The header of the checkpoint files, followed by the registers, the taint, the symbolic state and the memory pages */
+  struct CheckpointHeader {
+    char magic[4];
+    triton::uint32 version;
+    triton::uint32 arch;
+    triton::uint32 registers;
+    triton::uint64 taintSize;
+    triton::uint64 symbolicSize;
+  };
+
+
+  void API::saveCheckpoint(const std::string& path) {
+    std::ostringstream taint;
+    std::ostringstream symbolic;
+    CheckpointHeader header;
+
+    this->checkArchitecture();
+
+    /* The engines are not created by every profile */
+    if (this->taint)
+      this->taint->serializeState(taint);
+    if (this->symbolic)
+      this->symbolic->serializeState(symbolic);
+
+    std::set<triton::arch::Register*> registers = this->getParentRegisters();
+    std::string taintState    = taint.str();
+    std::string symbolicState = symbolic.str();
+
+    std::memcpy(header.magic, "TRCK", sizeof(header.magic));
+    header.version      = checkpointVersion;
+    header.arch         = this->getArchitecture();
+    header.registers    = static_cast<triton::uint32>(registers.size());
+    header.taintSize    = taintState.size();
+    header.symbolicSize = symbolicState.size();
+
+    /* Written aside and renamed, so the pages of a checkpoint loaded from the same path stay mapped */
+    std::string temporary = path + ".tmp";
+    std::ofstream file(temporary, std::ios::out | std::ios::binary | std::ios::trunc);
+    if (!file.is_open())
+      throw triton::exceptions::API("API::saveCheckpoint(): Cannot open the file.");
+
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    for (auto it = registers.begin(); it != registers.end(); it++) {
+      triton::uint32 id = (*it)->getId();
+      triton::uint8 value[64] = {0};
+      triton::utils::fromUintToBuffer(this->arch.getConcreteRegisterValue(**it, false), value);
+      file.write(reinterpret_cast<const char*>(&id), sizeof(id));
+      file.write(reinterpret_cast<const char*>(value), sizeof(value));
+    }
+
+    file.write(taintState.data(), taintState.size());
+    file.write(symbolicState.data(), symbolicState.size());
+    this->getCpu()->getPagedMemory().save(file);
+    file.close();
+
+    if (file.fail()) {
+      std::remove(temporary.c_str());
+      throw triton::exceptions::API("API::saveCheckpoint(): Cannot write the file.");
+    }
+
+    #if defined(_WIN32)
+    std::remove(path.c_str());
+    #endif
+    if (std::rename(temporary.c_str(), path.c_str()) != 0) {
+      std::remove(temporary.c_str());
+      throw triton::exceptions::API("API::saveCheckpoint(): Cannot write the file.");
+    }
+  }
+
+
+  void API::loadCheckpoint(const std::string& path) {
+    auto file = std::make_shared<triton::format::MappedFile>();
+    CheckpointHeader header;
+
+    this->checkArchitecture();
+
+    file->open(path);
+    const triton::uint8* data = file->getData();
+    triton::usize size        = file->getSize();
+    triton::usize recordSize  = sizeof(triton::uint32) + 64;
+
+    if (size < sizeof(header))
+      throw triton::exceptions::API("API::loadCheckpoint(): The file is not a checkpoint.");
+
+    std::memcpy(&header, data, sizeof(header));
+    if (std::memcmp(header.magic, "TRCK", sizeof(header.magic)) != 0 || header.version != checkpointVersion)
+      throw triton::exceptions::API("API::loadCheckpoint(): The file is not a checkpoint.");
+
+    if (header.arch != this->getArchitecture())
+      throw triton::exceptions::API("API::loadCheckpoint(): The checkpoint has been taken on another architecture.");
+
+    triton::usize offset = sizeof(header);
+    if (header.registers > (size - offset) / recordSize)
+      throw triton::exceptions::API("API::loadCheckpoint(): The file is truncated.");
+
+    const triton::uint8* registers = data + offset;
+    offset += header.registers * recordSize;
+
+    if (header.taintSize > size - offset || header.symbolicSize > size - offset - header.taintSize)
+      throw triton::exceptions::API("API::loadCheckpoint(): The file is truncated.");
+
+    std::istringstream taint(std::string(reinterpret_cast<const char*>(data + offset), static_cast<triton::usize>(header.taintSize)));
+    offset += static_cast<triton::usize>(header.taintSize);
+    std::istringstream symbolic(std::string(reinterpret_cast<const char*>(data + offset), static_cast<triton::usize>(header.symbolicSize)));
+    offset += static_cast<triton::usize>(header.symbolicSize);
+
+    /* The steps of the undo journal are relative to the state replaced */
+    this->clearUndoJournal();
+
+    /* The pages stay in the mapping until they are written */
+    this->getCpu()->getPagedMemory().load(file, offset);
+
+    for (triton::uint32 index = 0; index < header.registers; index++) {
+      triton::uint32 id = 0;
+      std::memcpy(&id, registers + index * recordSize, sizeof(id));
+      if (!this->arch.isRegisterValid(id))
+        throw triton::exceptions::API("API::loadCheckpoint(): Invalid register.");
+      this->arch.setConcreteRegisterValue(triton::arch::Register(id, triton::utils::fromBufferToUint<triton::uint512>(registers + index * recordSize + sizeof(id))));
+    }
+
+    /* The current symbolic state is dropped before the one of the checkpoint is added */
+    if (this->symbolic) {
+      this->symbolic->concretizeAllRegister();
+      this->symbolic->concretizeAllMemory();
+      this->symbolic->clearPathConstraints();
+      this->collectUnreachableExpressions();
+      if (header.symbolicSize)
+        this->symbolic->deserializeState(symbolic);
+    }
+
+    if (this->taint && header.taintSize)
+      this->taint->deserializeState(taint);
+  }
+
+
+
+  /* Undo API ======================================================================================= */
+
+  void API::startUndoStep(bool instruction) {
+    this->arch.startJournal();
+    this->symbolic->startJournal();
+    this->taint->startJournal();
+    this->undoSteps.push_back(instruction);
+  }
+
+
+  void API::rollbackUndoStep(void) {
+    std::vector<triton::ast::AbstractNode*> asts;
+
+    this->taint->rollbackJournal();
+    this->symbolic->rollbackJournal(&asts);
+    this->arch.rollbackJournal();
+    this->undoSteps.pop_back();
+
+    /* The nodes of the expressions deleted are freed if nothing else holds them */
+    for (auto it = asts.begin(); it != asts.end(); it++)
+      this->astGarbageCollector->releaseAstNode(*it);
+  }
+
+
+  void API::clearUndoJournal(void) {
+    this->arch.clearJournal();
+    if (this->symbolic)
+      this->symbolic->clearJournal();
+    if (this->taint)
+      this->taint->clearJournal();
+    this->undoSteps.clear();
+  }
+
+
+  void API::enableUndoJournal(bool flag) {
+    this->checkSymbolic();
+    this->checkTaint();
+    this->clearUndoJournal();
+    this->undoFlag = flag;
+  }
+
+
+  bool API::isUndoJournalEnabled(void) const {
+    return this->undoFlag;
+  }
+
+
+  triton::usize API::checkpoint(void) {
+    if (!this->undoFlag)
+      throw triton::exceptions::API("API::checkpoint(): The undo journal is disabled.");
+
+    this->startUndoStep(false);
+    return this->undoSteps.size() - 1;
+  }
+
+
+  triton::usize API::stepBack(triton::usize count) {
+    triton::usize reverted = 0;
+
+    while (reverted < count && !this->undoSteps.empty()) {
+      if (this->undoSteps.back())
+        reverted++;
+      this->rollbackUndoStep();
+    }
+
+    return reverted;
+  }
+
+
+  void API::rewindTo(triton::usize id) {
+    if (id >= this->undoSteps.size())
+      throw triton::exceptions::API("API::rewindTo(): The step has been reverted already.");
+
+    while (this->undoSteps.size() > id)
+      this->rollbackUndoStep();
+  }
+
+
+
+  /* IR builder API ================================================================================= */
+
+  void API::checkIrBuilder(void) const {
+    if (!this->irBuilder)
+      throw triton::exceptions::API("API::checkIrBuilder(): IR builder is undefined.");
+  }
+
+
+  bool API::buildSemantics(triton::arch::Instruction& inst) {
+    this->checkIrBuilder();
+    return this->irBuilder->buildSemantics(inst);
+  }
+
+
+  const std::map<triton::uint32, triton::arch::OpcodeProfile>& API::getOpcodeProfile(void) const {
+    this->checkIrBuilder();
+    return this->irBuilder->getOpcodeProfile();
+  }
+
+
+  void API::clearOpcodeProfile(void) {
+    this->checkIrBuilder();
+    this->irBuilder->clearOpcodeProfile();
+  }
+
+
+  void API::dumpOpcodeProfile(std::ostream& stream, bool json) const {
+    this->checkIrBuilder();
+    this->irBuilder->dumpOpcodeProfile(stream, json);
+  }
+
+
+  void API::dumpTraceEvents(std::ostream& stream) const {
+    triton::utils::TraceEvents::dump(stream);
+  }
+
+
+  void API::clearTraceEvents(void) {
+    triton::utils::TraceEvents::clear();
+  }
+
+
+  void API::clearPerfCounters(void) {
+    triton::utils::PerfCounters::clear();
+  }
+
+
+
+  /* AST garbage collector API ====================================================================== */
+
+  void API::checkAstGarbageCollector(void) const {
+    if (!this->astGarbageCollector)
+      throw triton::exceptions::API("API::checkAstGarbageCollector(): AST garbage collector is undefined.");
+  }
+
+
+  void API::freeAllAstNodes(void) {
+    this->checkAstGarbageCollector();
+    /* Unrolled ASTs and simplifications cached by the symbolic engine may be among them */
+    if (this->symbolic) {
+      this->symbolic->clearFullAsts();
+      this->symbolic->clearSimplifications();
+    }
+    /* So may the nodes held by the solver session */
+    if (this->solver)
+      this->solver->releaseSessionNodes();
+    this->astGarbageCollector->freeAllAstNodes();
+  }
+
+
+  void API::freeAstNodes(std::set<triton::ast::AbstractNode*>& nodes) {
+    this->checkAstGarbageCollector();
+    /* Unrolled ASTs and simplifications cached by the symbolic engine may be among them */
+    if (this->symbolic) {
+      this->symbolic->clearFullAsts();
+      this->symbolic->clearSimplifications();
+    }
+    /* So may the nodes held by the solver session */
+    if (this->solver)
+      this->solver->releaseSessionNodes();
+    this->astGarbageCollector->freeAstNodes(nodes);
+  }
+
+
+  void API::extractUniqueAstNodes(std::set<triton::ast::AbstractNode*>& uniqueNodes, triton::ast::AbstractNode* root) const {
+    this->checkAstGarbageCollector();
+    this->astGarbageCollector->extractUniqueAstNodes(uniqueNodes, root);
+  }
+
+
+  triton::ast::AbstractNode* API::recordAstNode(triton::ast::AbstractNode* node) {
+    this->checkAstGarbageCollector();
+    node = this->astGarbageCollector->recordAstNode(node);
+
+    /* A small expression is used instead of a reference to it */
+    if (this->symbolic != nullptr && node->getKind() == triton::ast::REFERENCE_NODE && this->modes->isModeEnabled(triton::modes::INLINE_REFERENCES))
+      node = this->symbolic->inlineReference(node);
+
+    /* Children are built first, so they are already folded and rewritten */
+    if (this->symbolic != nullptr && this->modes->isModeEnabled(triton::modes::CONCRETE_FOLDING))
+      node = this->symbolic->foldConcreteNode(node);
+
+    if (this->symbolic != nullptr && this->modes->isModeEnabled(triton::modes::AST_REWRITING))
+      node = this->symbolic->rewriteNode(node);
+
+    return node;
+  }
+
+
+  triton::ast::AstNodeAllocator* API::getAstNodeAllocator(void) {
+    this->checkAstGarbageCollector();
+    return this->astGarbageCollector->getAstNodeAllocator();
+  }
+
+
+  triton::ast::AbstractNode* API::getConstantAstNode(const triton::uint512& value, triton::uint32 size) {
+    this->checkAstGarbageCollector();
+    return this->astGarbageCollector->getConstantNode(value, size);
+  }
+
+
+  void API::recordVariableAstNode(triton::usize symVarId, triton::ast::AbstractNode* node) {
+    this->checkAstGarbageCollector();
+    this->astGarbageCollector->recordVariableAstNode(symVarId, node);
+  }
+
+
+  const std::set<triton::ast::AbstractNode*>& API::getAllocatedAstNodes(void) const {
+    this->checkAstGarbageCollector();
+    return this->astGarbageCollector->getAllocatedAstNodes();
+  }
+
+
+  std::map<std::string, triton::usize> API::getAstDictionariesStats(void) const {
+    this->checkAstGarbageCollector();
+    return this->astGarbageCollector->getAstDictionariesStats();
+  }
+
+
+  const std::unordered_map<triton::usize, triton::ast::AbstractNode*>& API::getAstVariableNodes(void) const {
+    this->checkAstGarbageCollector();
+    return this->astGarbageCollector->getAstVariableNodes();
+  }
+
+
+  triton::ast::AbstractNode* API::getAstVariableNode(triton::usize symVarId) const {
+    this->checkAstGarbageCollector();
+    return this->astGarbageCollector->getAstVariableNode(symVarId);
+  }
+
+
+  void API::setAllocatedAstNodes(const std::set<triton::ast::AbstractNode*>& nodes) {
+    this->checkAstGarbageCollector();
+    this->astGarbageCollector->setAllocatedAstNodes(nodes);
+  }
+
+
+  std::shared_ptr<triton::ast::AstGeneration> API::freezeAstNodes(void) {
+    this->checkAstGarbageCollector();
+    return this->astGarbageCollector->freezeAstNodes();
+  }
+
+
+  void API::setAstGeneration(const std::shared_ptr<triton::ast::AstGeneration>& generation) {
+    this->checkAstGarbageCollector();
+    this->astGarbageCollector->setAstGeneration(generation);
+  }
+
+
+  void API::releaseAstGeneration(std::shared_ptr<triton::ast::AstGeneration>& generation) {
+    this->checkAstGarbageCollector();
+    this->astGarbageCollector->releaseAstGeneration(generation);
+  }
+
+
+  triton::usize API::getNumberOfFrozenAstNodes(void) const {
+    this->checkAstGarbageCollector();
+    return this->astGarbageCollector->getNumberOfFrozenAstNodes();
+  }
+
+
+  void API::setAstVariableNodes(const std::unordered_map<triton::usize, triton::ast::AbstractNode*>& nodes) {
+    this->checkAstGarbageCollector();
+    this->astGarbageCollector->setAstVariableNodes(nodes);
+  }
+
+
+  /* AST representation API ========================================================================= */
+
+  triton::uint32 API::getAstRepresentationMode(void) const {
+    return triton::ast::representations::astRepresentation.getMode();
+  }
+
+
+  void API::setAstRepresentationMode(triton::uint32 mode) {
+    triton::ast::representations::astRepresentation.setMode(mode);
+  }
+
+
+  void API::serializeAsts(std::ostream& stream, const std::vector<triton::ast::AbstractNode*>& asts) const {
+    triton::ast::serialize(stream, asts);
+  }
+
+
+  std::vector<triton::ast::AbstractNode*> API::deserializeAsts(std::istream& stream) const {
+    this->checkAstGarbageCollector();
+    return triton::ast::deserialize(stream);
+  }
+
+
+  std::vector<triton::ast::AbstractNode*> API::parseSmt(std::istream& stream) const {
+    this->checkAstGarbageCollector();
+    return triton::ast::parseSmt(stream);
+  }
+
+
+
+  /* Callbacks API ================================================================================= */
+
+  void API::addCallback(triton::callbacks::getConcreteMemoryValueCallback cb) {
+    this->callbacks.addCallback(cb);
+  }
+
+
+  void API::addCallback(triton::callbacks::getConcreteMemoryAreaValueCallback cb) {
+    this->callbacks.addCallback(cb);
+  }
+
+
+  void API::addCallback(triton::callbacks::getConcreteRegisterValueCallback cb) {
+    this->callbacks.addCallback(cb);
+  }
+
+
+  void API::addCallback(triton::callbacks::symbolicSimplificationCallback cb) {
+    this->callbacks.addCallback(cb);
+  }
+
+
+  void API::addCallback(triton::callbacks::memoryLimitCallback cb) {
+    this->callbacks.addCallback(cb);
+  }
+
+
+  void API::addCallback(triton::callbacks::expressionLimitCallback cb) {
+    this->callbacks.addCallback(cb);
+  }
+
+
+  void API::addCallback(triton::callbacks::memoryMissCallback cb) {
+    this->callbacks.addCallback(cb);
+  }
+
+
+  #ifdef TRITON_PYTHON_BINDINGS
+  void API::addCallback(PyObject* function, triton::callbacks::callback_e kind) {
+    this->callbacks.addCallback(function, kind);
+  }
+
+
+  void API::addBatchedCallback(PyObject* function, triton::callbacks::callback_e kind, triton::usize size) {
+    this->callbacks.addBatchedCallback(function, kind, size);
+  }
+
+
+  void API::flushCallbacks(void) const {
+    this->callbacks.flushCallbacks();
+  }
+
+
+  bool API::isPythonCallbackDefined(void) const {
+    return this->callbacks.isPythonCallbackDefined();
+  }
+  #endif
+
+
+  void API::removeAllCallbacks(void) {
+    this->callbacks.removeAllCallbacks();
+  }
+
+
+  void API::removeCallback(triton::callbacks::getConcreteMemoryValueCallback cb) {
+    this->callbacks.removeCallback(cb);
+  }
+
+
+  void API::removeCallback(triton::callbacks::getConcreteMemoryAreaValueCallback cb) {
+    this->callbacks.removeCallback(cb);
+  }
+
+
+  void API::removeCallback(triton::callbacks::getConcreteRegisterValueCallback cb) {
+    this->callbacks.removeCallback(cb);
+  }
+
+
+  void API::removeCallback(triton::callbacks::symbolicSimplificationCallback cb) {
+    this->callbacks.removeCallback(cb);
+  }
+
+
+  void API::removeCallback(triton::callbacks::memoryLimitCallback cb) {
+    this->callbacks.removeCallback(cb);
+  }
+
+
+  void API::removeCallback(triton::callbacks::expressionLimitCallback cb) {
+    this->callbacks.removeCallback(cb);
+  }
+
+
+  void API::removeCallback(triton::callbacks::memoryMissCallback cb) {
+    this->callbacks.removeCallback(cb);
+  }
+
+
+  #ifdef TRITON_PYTHON_BINDINGS
+  void API::removeCallback(PyObject* function, triton::callbacks::callback_e kind) {
+    this->callbacks.removeCallback(function, kind);
+  }
+  #endif
+
+
+  triton::ast::AbstractNode* API::processCallbacks(triton::callbacks::callback_e kind, triton::ast::AbstractNode* node) const {
+    if (this->callbacks.isCallbackDefined(kind))
+      return this->callbacks.processCallbacks(kind, node);
+    return node;
+  }
+
+
+  void API::processCallbacks(triton::callbacks::callback_e kind, const triton::arch::MemoryAccess& mem) const {
+    if (this->callbacks.isCallbackDefined(kind))
+      this->callbacks.processCallbacks(kind, mem);
+  }
+
+
+  void API::processCallbacks(triton::callbacks::callback_e kind, const triton::arch::Register& reg) const {
+    if (this->callbacks.isCallbackDefined(kind))
+      this->callbacks.processCallbacks(kind, reg);
+  }
+
+
+  void API::processCallbacks(triton::callbacks::callback_e kind, bool hard, triton::usize usage) const {
+    if (this->callbacks.isCallbackDefined(kind))
+      this->callbacks.processCallbacks(kind, hard, usage);
+  }
+
+
+  void API::processCallbacks(triton::callbacks::callback_e kind, triton::uint64 baseAddr, triton::usize size) const {
+    if (this->callbacks.isCallbackDefined(kind))
+      this->callbacks.processCallbacks(kind, baseAddr, size);
+  }
+
+
+  void API::processCallbacks(triton::callbacks::callback_e kind, triton::engines::symbolic::SymbolicExpression* expr) const {
+    if (this->callbacks.isCallbackDefined(kind))
+      this->callbacks.processCallbacks(kind, expr);
+  }
+
+
+
+  /* Modes API======================================================================================= */
+
+  void API::checkModes(void) const {
+    if (!this->modes)
+      throw triton::exceptions::API("API::checkModes(): Modes interface is undefined.");
   }
 
 
   void API::enableMode(enum triton::modes::mode_e mode, bool flag) {
     this->checkModes();
     this->modes->enableMode(mode, flag);
+
+    if (mode == triton::modes::TRACE_EVENTS)
+      triton::utils::TraceEvents::enable(flag);
+
+    if (mode == triton::modes::PERF_COUNTERS)
+      triton::utils::PerfCounters::enable(flag);
+
+    if (mode == triton::modes::HUGE_PAGES)
+      triton::utils::HugePageArena::enable(flag);
   }
 
 
@@ -650,75 +2338,247 @@ namespace triton {
   }
 
 
+  std::vector<triton::engines::symbolic::SymbolicVariable*> API::convertMemoryAreaToSymbolicVariables(triton::uint64 baseAddr, triton::usize size, const std::string& symVarComment, triton::uint32 wordSize) {
+    this->checkSymbolic();
+
+    if (this->astGarbageCollector != nullptr && wordSize != 0)
+      this->astGarbageCollector->getAstNodeAllocator()->reserve(sizeof(triton::ast::VariableNode), size / wordSize);
+
+    return this->symbolic->convertMemoryAreaToSymbolicVariables(baseAddr, size, symVarComment, wordSize);
+  }
+
+
   triton::engines::symbolic::SymbolicVariable* API::convertRegisterToSymbolicVariable(const triton::arch::Register& reg, const std::string& symVarComment) {
     this->checkSymbolic();
     return this->symbolic->convertRegisterToSymbolicVariable(reg, symVarComment);
   }
 
 
-  triton::ast::AbstractNode* API::buildSymbolicOperand(triton::arch::OperandWrapper& op) {
+  triton::ast::AbstractNode* API::buildSymbolicOperand(triton::arch::OperandWrapper& op) {
+    this->checkSymbolic();
+    return this->symbolic->buildSymbolicOperand(op);
+  }
+
+
+  triton::ast::AbstractNode* API::buildSymbolicOperand(triton::arch::Instruction& inst, triton::arch::OperandWrapper& op) {
+    this->checkSymbolic();
+    return this->symbolic->buildSymbolicOperand(inst, op);
+  }
+
+
+  triton::ast::AbstractNode* API::buildSymbolicImmediate(const triton::arch::Immediate& imm) {
+    this->checkSymbolic();
+    return this->symbolic->buildSymbolicImmediate(imm);
+  }
+
+
+  triton::ast::AbstractNode* API::buildSymbolicImmediate(triton::arch::Instruction& inst, triton::arch::Immediate& imm) {
+    this->checkSymbolic();
+    return this->symbolic->buildSymbolicImmediate(inst, imm);
+  }
+
+
+  triton::ast::AbstractNode* API::buildSymbolicMemory(const triton::arch::MemoryAccess& mem) {
+    this->checkSymbolic();
+    return this->symbolic->buildSymbolicMemory(mem);
+  }
+
+
+  triton::ast::AbstractNode* API::buildSymbolicMemory(triton::arch::Instruction& inst, triton::arch::MemoryAccess& mem) {
+    this->checkSymbolic();
+    return this->symbolic->buildSymbolicMemory(inst, mem);
+  }
+
+
+  triton::ast::AbstractNode* API::buildSymbolicRegister(const triton::arch::Register& reg) {
+    this->checkSymbolic();
+    return this->symbolic->buildSymbolicRegister(reg);
+  }
+
+
+  triton::ast::AbstractNode* API::buildSymbolicRegister(triton::arch::Instruction& inst, triton::arch::Register& reg) {
+    this->checkSymbolic();
+    return this->symbolic->buildSymbolicRegister(inst, reg);
+  }
+
+
+  triton::engines::symbolic::SymbolicExpression* API::newSymbolicExpression(triton::ast::AbstractNode* node, const std::string& comment) {
+    this->checkSymbolic();
+    return this->symbolic->newSymbolicExpression(node, triton::engines::symbolic::UNDEF, comment);
+  }
+
+
+  triton::engines::symbolic::SymbolicVariable* API::newSymbolicVariable(triton::uint32 varSize, const std::string& comment) {
+    this->checkSymbolic();
+    return this->symbolic->newSymbolicVariable(triton::engines::symbolic::UNDEF, 0, varSize, comment);
+  }
+
+
+  void API::removeSymbolicExpression(triton::usize symExprId) {
+    this->checkSymbolic();
+    return this->symbolic->removeSymbolicExpression(symExprId);
+  }
+
+
+  void API::pinSymbolicExpression(triton::usize symExprId) {
+    this->checkSymbolic();
+    this->symbolic->pinSymbolicExpression(symExprId);
+  }
+
+
+  void API::unpinSymbolicExpression(triton::usize symExprId) {
+    this->checkSymbolic();
+    this->symbolic->unpinSymbolicExpression(symExprId);
+  }
+
+
+  void API::collectUnreachableExpressions(void) {
+    std::vector<triton::ast::AbstractNode*> asts;
+
+    this->checkSymbolic();
+    this->checkAstGarbageCollector();
+
+    this->symbolic->collectUnreachableExpressions(std::vector<triton::engines::symbolic::SymbolicExpression*>(), asts);
+    for (auto it = asts.begin(); it != asts.end(); it++)
+      this->astGarbageCollector->releaseAstNode(*it);
+  }
+
+
+  void API::setNodeBudget(triton::usize budget) {
+    this->checkSymbolic();
+    this->symbolic->setNodeBudget(budget);
+  }
+
+
+  triton::usize API::getNodeBudget(void) const {
+    this->checkSymbolic();
+    return this->symbolic->getNodeBudget();
+  }
+
+
+  void API::setInstructionWindow(triton::usize size) {
+    this->checkSymbolic();
+    this->symbolic->setInstructionWindow(size);
+  }
+
+
+  triton::usize API::getInstructionWindow(void) const {
+    this->checkSymbolic();
+    return this->symbolic->getInstructionWindow();
+  }
+
+
+  void API::exportDependencies(const std::string& path, bool csv) {
+    this->checkSymbolic();
+
+    triton::engines::symbolic::DependencyFileSink* sink = new(std::nothrow) triton::engines::symbolic::DependencyFileSink(path, csv);
+    if (sink == nullptr)
+      throw triton::exceptions::API("API::exportDependencies(): No enough memory.");
+
+    this->setDependencySink(sink);
+    this->dependencyExport = sink;
+  }
+
+
+  void API::stopDependencyExport(void) {
+    if (this->dependencyExport == nullptr)
+      return;
+
+    this->setDependencySink(nullptr);
+  }
+
+
+  void API::setDependencySink(triton::engines::symbolic::DependencySink* sink) {
+    this->checkSymbolic();
+    this->symbolic->setDependencySink(sink);
+
+    /* The exported file is closed once detached */
+    delete this->dependencyExport;
+    this->dependencyExport = nullptr;
+  }
+
+
+  void API::setPointerPolicy(triton::uint64 address, triton::engines::symbolic::pointer_policy_e policy, triton::uint32 range) {
+    this->checkSymbolic();
+    this->symbolic->setPointerPolicy(address, policy, range);
+  }
+
+
+  void API::setDefaultPointerPolicy(triton::engines::symbolic::pointer_policy_e policy, triton::uint32 range) {
+    this->checkSymbolic();
+    this->symbolic->setDefaultPointerPolicy(policy, range);
+  }
+
+
+  const triton::engines::symbolic::PointerPolicy& API::getPointerPolicy(triton::uint64 address) const {
+    this->checkSymbolic();
+    return this->symbolic->getPointerPolicy(address);
+  }
+
+
+  void API::clearPointerPolicies(void) {
     this->checkSymbolic();
-    return this->symbolic->buildSymbolicOperand(op);
+    this->symbolic->clearPointerPolicies();
   }
 
 
-  triton::ast::AbstractNode* API::buildSymbolicOperand(triton::arch::Instruction& inst, triton::arch::OperandWrapper& op) {
+  void API::addSymbolicRegion(triton::uint64 start, triton::uint64 end) {
     this->checkSymbolic();
-    return this->symbolic->buildSymbolicOperand(inst, op);
+    this->symbolic->addSymbolicRegion(start, end);
   }
 
 
-  triton::ast::AbstractNode* API::buildSymbolicImmediate(const triton::arch::Immediate& imm) {
+  void API::removeSymbolicRegion(triton::uint64 start, triton::uint64 end) {
     this->checkSymbolic();
-    return this->symbolic->buildSymbolicImmediate(imm);
+    this->symbolic->removeSymbolicRegion(start, end);
   }
 
 
-  triton::ast::AbstractNode* API::buildSymbolicImmediate(triton::arch::Instruction& inst, triton::arch::Immediate& imm) {
+  void API::clearSymbolicRegions(void) {
     this->checkSymbolic();
-    return this->symbolic->buildSymbolicImmediate(inst, imm);
+    this->symbolic->clearSymbolicRegions();
   }
 
 
-  triton::ast::AbstractNode* API::buildSymbolicMemory(const triton::arch::MemoryAccess& mem) {
+  const std::map<triton::uint64, triton::uint64>& API::getSymbolicRegions(void) const {
     this->checkSymbolic();
-    return this->symbolic->buildSymbolicMemory(mem);
+    return this->symbolic->getSymbolicRegions();
   }
 
 
-  triton::ast::AbstractNode* API::buildSymbolicMemory(triton::arch::Instruction& inst, triton::arch::MemoryAccess& mem) {
+  void API::setExpressionLimits(triton::uint32 depth, triton::uint64 size) {
     this->checkSymbolic();
-    return this->symbolic->buildSymbolicMemory(inst, mem);
+    this->symbolic->setExpressionLimits(depth, size);
   }
 
 
-  triton::ast::AbstractNode* API::buildSymbolicRegister(const triton::arch::Register& reg) {
+  void API::setInlineReferenceSize(triton::usize size) {
     this->checkSymbolic();
-    return this->symbolic->buildSymbolicRegister(reg);
+    this->symbolic->setInlineReferenceSize(size);
   }
 
 
-  triton::ast::AbstractNode* API::buildSymbolicRegister(triton::arch::Instruction& inst, triton::arch::Register& reg) {
+  triton::usize API::getInlineReferenceSize(void) const {
     this->checkSymbolic();
-    return this->symbolic->buildSymbolicRegister(inst, reg);
+    return this->symbolic->getInlineReferenceSize();
   }
 
 
-  triton::engines::symbolic::SymbolicExpression* API::newSymbolicExpression(triton::ast::AbstractNode* node, const std::string& comment) {
+  const std::map<triton::uint64, triton::engines::symbolic::ExpressionProfile>& API::getExpressionProfile(void) const {
     this->checkSymbolic();
-    return this->symbolic->newSymbolicExpression(node, triton::engines::symbolic::UNDEF, comment);
+    return this->symbolic->getExpressionProfile();
   }
 
 
-  triton::engines::symbolic::SymbolicVariable* API::newSymbolicVariable(triton::uint32 varSize, const std::string& comment) {
+  void API::clearExpressionProfile(void) {
     this->checkSymbolic();
-    return this->symbolic->newSymbolicVariable(triton::engines::symbolic::UNDEF, 0, varSize, comment);
+    this->symbolic->clearExpressionProfile();
   }
 
 
-  void API::removeSymbolicExpression(triton::usize symExprId) {
+  void API::dumpExpressionProfile(std::ostream& stream, triton::usize count, bool json) const {
     this->checkSymbolic();
-    return this->symbolic->removeSymbolicExpression(symExprId);
+    this->symbolic->dumpExpressionProfile(stream, count, json);
   }
 
 
@@ -770,8 +2630,15 @@ namespace triton {
   }
 
 
+  triton::usize API::getSymbolicMemoryId(triton::uint64 addr, triton::uint32& offset) const {
+    this->checkSymbolic();
+    return this->symbolic->getSymbolicMemoryId(addr, offset);
+  }
+
+
   std::map<triton::arch::Register, triton::engines::symbolic::SymbolicExpression*> API::getSymbolicRegisters(void) const {
     this->checkSymbolic();
+    this->symbolic->materializeLazyFlags();
     return this->symbolic->getSymbolicRegisters();
   }
 
@@ -782,8 +2649,34 @@ namespace triton {
   }
 
 
+  std::map<triton::uint64, triton::engines::symbolic::SymbolicExpression*> API::getSymbolicMemory(triton::uint64 start, triton::uint64 end) const {
+    this->checkSymbolic();
+    return this->symbolic->getSymbolicMemory(start, end);
+  }
+
+
+  void API::forEachSymbolicRegister(const std::function<void(const triton::arch::Register&, triton::engines::symbolic::SymbolicExpression*)>& callback) const {
+    this->checkSymbolic();
+    this->symbolic->materializeLazyFlags();
+    this->symbolic->forEachSymbolicRegister(callback);
+  }
+
+
+  void API::forEachSymbolicMemory(triton::uint64 start, triton::uint64 end, const std::function<void(triton::uint64, triton::engines::symbolic::SymbolicExpression*)>& callback) const {
+    this->checkSymbolic();
+    this->symbolic->forEachSymbolicMemory(start, end, callback);
+  }
+
+
+  void API::forEachSymbolicMemoryId(const std::function<void(triton::uint64, triton::usize)>& callback) const {
+    this->checkSymbolic();
+    this->symbolic->forEachSymbolicMemoryId(callback);
+  }
+
+
   triton::usize API::getSymbolicRegisterId(const triton::arch::Register& reg) const {
     this->checkSymbolic();
+    this->symbolic->materializeLazyFlag(reg);
     return this->symbolic->getSymbolicRegisterId(reg);
   }
 
@@ -812,12 +2705,21 @@ namespace triton {
   }
 
 
+  triton::ast::AbstractNode* API::getMemoryArray(void) {
+    this->checkSymbolic();
+    return this->symbolic->getMemoryArray();
+  }
+
+
+  void API::initMemoryArrayArea(triton::uint64 baseAddr, triton::usize size) {
+    this->checkSymbolic();
+    this->symbolic->initMemoryArrayArea(baseAddr, size);
+  }
+
+
   triton::ast::AbstractNode* API::processSimplification(triton::ast::AbstractNode* node, bool z3) const {
     this->checkSymbolic();
-    if (z3 == true)
-      node = this->processZ3Simplification(node);
-    node = this->symbolic->processSimplification(node);
-    return node;
+    return this->symbolic->processSimplification(node, z3, this->modes->isModeEnabled(triton::modes::MBA_SIMPLIFICATION));
   }
 
 
@@ -851,6 +2753,18 @@ namespace triton {
   }
 
 
+  std::vector<triton::usize> API::getPathConstraintsSlice(triton::usize index) const {
+    this->checkSymbolic();
+    return this->symbolic->getPathConstraintsSlice(index);
+  }
+
+
+  triton::ast::AbstractNode* API::getPathConstraintsSliceAst(triton::usize index) const {
+    this->checkSymbolic();
+    return this->symbolic->getPathConstraintsSliceAst(index);
+  }
+
+
   void API::addPathConstraint(const triton::arch::Instruction& inst, triton::engines::symbolic::SymbolicExpression* expr) {
     this->checkSymbolic();
     this->symbolic->addPathConstraint(inst, expr);
@@ -863,6 +2777,30 @@ namespace triton {
   }
 
 
+  triton::usize API::getMaxPathConstraintsPerBranch(void) const {
+    this->checkSymbolic();
+    return this->symbolic->getMaxPathConstraintsPerBranch();
+  }
+
+
+  void API::setMaxPathConstraintsPerBranch(triton::usize limit) {
+    this->checkSymbolic();
+    this->symbolic->setMaxPathConstraintsPerBranch(limit);
+  }
+
+
+  void API::serializeSymbolicState(std::ostream& stream) {
+    this->checkSymbolic();
+    this->symbolic->serializeState(stream);
+  }
+
+
+  void API::deserializeSymbolicState(std::istream& stream) {
+    this->checkSymbolic();
+    this->symbolic->deserializeState(stream);
+  }
+
+
   void API::enableSymbolicEngine(bool flag) {
     this->checkSymbolic();
     this->symbolic->enable(flag);
@@ -895,6 +2833,7 @@ namespace triton {
 
   bool API::isRegisterSymbolized(const triton::arch::Register& reg) const {
     this->checkSymbolic();
+    this->symbolic->materializeLazyFlag(reg);
     return this->symbolic->isRegisterSymbolized(reg);
   }
 
@@ -929,6 +2868,57 @@ namespace triton {
   }
 
 
+  triton::uint512 API::evaluateAst(triton::ast::AbstractNode* node, const std::map<triton::usize, triton::uint512>& assignment) const {
+    this->checkSymbolic();
+    triton::ast::AstEvaluator evaluator(node);
+    return evaluator.evaluate(assignment);
+  }
+
+
+  std::vector<triton::uint512> API::evaluateAst(triton::ast::AbstractNode* node, const std::vector<std::map<triton::usize, triton::uint512>>& assignments) const {
+    this->checkSymbolic();
+    triton::ast::AstEvaluator evaluator(node);
+    std::vector<triton::uint512> ret;
+
+    if (evaluator.isWide()) {
+      for (auto it = assignments.begin(); it != assignments.end(); it++)
+        ret.push_back(evaluator.evaluate(*it));
+      return ret;
+    }
+
+    /* One row of values per assignment, the variables not assigned keep their concrete value */
+    const auto& variables = evaluator.getVariables();
+    std::vector<triton::uint64> values(assignments.size() * variables.size());
+    std::vector<triton::uint64> results(assignments.size());
+
+    for (triton::usize row = 0; row < assignments.size(); row++) {
+      for (triton::usize index = 0; index < variables.size(); index++) {
+        auto value = assignments[row].find(variables[index]->getId());
+        triton::uint512 v = (value != assignments[row].end() ? value->second : variables[index]->getConcreteValue());
+        values[row * variables.size() + index] = (v & 0xffffffffffffffffULL).convert_to<triton::uint64>();
+      }
+    }
+
+    evaluator.execute(values.data(), assignments.size(), results.data());
+    ret.assign(results.begin(), results.end());
+
+    return ret;
+  }
+
+
+  std::vector<triton::usize> API::filterAssignments(triton::ast::AbstractNode* node, const std::vector<std::map<triton::usize, triton::uint512>>& assignments) const {
+    std::vector<triton::uint512> values = this->evaluateAst(node, assignments);
+    std::vector<triton::usize> ret;
+
+    for (triton::usize index = 0; index < values.size(); index++) {
+      if (values[index] != 0)
+        ret.push_back(index);
+    }
+
+    return ret;
+  }
+
+
   triton::ast::AbstractNode* API::getFullAst(triton::ast::AbstractNode* node) {
     this->checkSymbolic();
     return this->symbolic->getFullAst(node);
@@ -955,19 +2945,19 @@ namespace triton {
   }
 
 
-  std::list<triton::engines::symbolic::SymbolicExpression*> API::getTaintedSymbolicExpressions(void) const {
+  std::list<triton::engines::symbolic::SymbolicExpression*> API::getTaintedSymbolicExpressions(triton::usize fromId) const {
     this->checkSymbolic();
-    return this->symbolic->getTaintedSymbolicExpressions();
+    return this->symbolic->getTaintedSymbolicExpressions(fromId);
   }
 
 
-  const std::map<triton::usize, triton::engines::symbolic::SymbolicExpression*>& API::getSymbolicExpressions(void) const {
+  std::map<triton::usize, triton::engines::symbolic::SymbolicExpression*> API::getSymbolicExpressions(void) const {
     this->checkSymbolic();
     return this->symbolic->getSymbolicExpressions();
   }
 
 
-  const std::map<triton::usize, triton::engines::symbolic::SymbolicVariable*>& API::getSymbolicVariables(void) const {
+  std::map<triton::usize, triton::engines::symbolic::SymbolicVariable*> API::getSymbolicVariables(void) const {
     this->checkSymbolic();
     return this->symbolic->getSymbolicVariables();
   }
@@ -982,15 +2972,219 @@ namespace triton {
   }
 
 
-  std::map<triton::uint32, triton::engines::solver::SolverModel> API::getModel(triton::ast::AbstractNode* node) const {
+  std::map<triton::uint32, triton::engines::solver::SolverModel> API::getModel(triton::ast::AbstractNode* node, triton::uint32 timeout) const {
+    this->checkSolver();
+    return this->solver->getModel(node, timeout);
+  }
+
+
+  std::map<triton::uint32, triton::engines::solver::SolverModel> API::getPartialModel(triton::ast::AbstractNode* node, const std::vector<triton::engines::symbolic::SymbolicVariable*>& freeVariables, triton::uint32 timeout) const {
+    this->checkSolver();
+    return this->solver->getPartialModel(node, freeVariables, timeout);
+  }
+
+
+  std::list<std::map<triton::uint32, triton::engines::solver::SolverModel>> API::getModels(triton::ast::AbstractNode* node, triton::uint32 limit, triton::uint32 threads) const {
+    this->checkSolver();
+    return this->solver->getModels(node, limit, threads);
+  }
+
+
+  triton::usize API::getModelAsync(triton::ast::AbstractNode* node, triton::uint32 timeout) {
+    this->checkSolver();
+    return this->solver->getModelAsync(node, timeout);
+  }
+
+
+  bool API::isAsyncModelReady(triton::usize id) const {
+    this->checkSolver();
+    return this->solver->isAsyncModelReady(id);
+  }
+
+
+  std::map<triton::uint32, triton::engines::solver::SolverModel> API::getAsyncModel(triton::usize id) {
+    this->checkSolver();
+    return this->solver->getAsyncModel(id);
+  }
+
+
+  void API::setSolverTimeout(triton::uint32 timeout) {
+    this->checkSolver();
+    this->solver->setTimeout(timeout);
+  }
+
+
+  void API::setSolverLocalSearchBudget(triton::uint32 budget) {
+    this->checkSolver();
+    this->solver->setLocalSearchBudget(budget);
+  }
+
+
+  void API::setSolverMemoryLimit(triton::uint32 limit) {
+    this->checkSolver();
+    this->solver->setMemoryLimit(limit);
+  }
+
+
+  void API::setSolverResourceLimit(triton::uint32 limit) {
+    this->checkSolver();
+    this->solver->setResourceLimit(limit);
+  }
+
+
+  void API::setSolverBackend(triton::engines::solver::solver_e backend) {
+    this->checkSolver();
+    this->solver->setBackend(backend);
+  }
+
+
+  triton::engines::solver::solver_e API::getSolverBackend(void) const {
+    this->checkSolver();
+    return this->solver->getBackend();
+  }
+
+
+  void API::setSolverPortfolioSize(triton::uint32 size) {
+    this->checkSolver();
+    this->solver->setPortfolioSize(size);
+  }
+
+
+  void API::setRemoteSolver(const std::string& address) {
+    this->checkSolver();
+    this->solver->setRemoteSolver(address);
+  }
+
+
+  const std::string& API::getRemoteSolver(void) const {
+    this->checkSolver();
+    return this->solver->getRemoteSolver();
+  }
+
+
+  triton::engines::solver::status_e API::getLastSolverStatus(void) const {
+    this->checkSolver();
+    return this->solver->getLastStatus();
+  }
+
+
+  triton::usize API::getQueryCacheHits(void) const {
+    this->checkSolver();
+    return this->solver->getQueryCacheHits();
+  }
+
+
+  triton::usize API::getQueryCacheMisses(void) const {
+    this->checkSolver();
+    return this->solver->getQueryCacheMisses();
+  }
+
+
+  void API::clearQueryCache(void) {
+    this->checkSolver();
+    this->solver->clearQueryCache();
+  }
+
+
+  void API::startSolverSession(void) {
+    this->checkSolver();
+    this->solver->startSession();
+  }
+
+
+  void API::stopSolverSession(void) {
+    this->checkSolver();
+    this->solver->stopSession();
+  }
+
+
+  bool API::isSolverSessionStarted(void) const {
+    this->checkSolver();
+    return this->solver->isSessionStarted();
+  }
+
+
+  std::map<triton::uint32, triton::engines::solver::SolverModel> API::getSessionModel(const std::vector<triton::ast::AbstractNode*>& prefix, triton::ast::AbstractNode* node) {
     this->checkSolver();
-    return this->solver->getModel(node);
+    return this->solver->getSessionModel(prefix, node);
   }
 
 
-  std::list<std::map<triton::uint32, triton::engines::solver::SolverModel>> API::getModels(triton::ast::AbstractNode* node, triton::uint32 limit) const {
+  std::vector<std::map<triton::uint32, triton::engines::solver::SolverModel>> API::getModelsForBranches(const std::vector<triton::ast::AbstractNode*>& pathConstraints) const {
     this->checkSolver();
-    return this->solver->getModels(node, limit);
+    return this->solver->getModelsForBranches(pathConstraints);
+  }
+
+
+
+  /* Syscall emulation API ========================================================================= */
+
+  void API::checkSyscallEmulator(void) const {
+    if (!this->syscalls)
+      throw triton::exceptions::API("API::checkSyscallEmulator(): Syscall emulator is undefined.");
+  }
+
+
+  triton::os::unix::SyscallEmulator* API::getSyscallEmulator(void) {
+    this->checkSyscallEmulator();
+    return this->syscalls;
+  }
+
+
+  void API::enableSyscallEmulation(bool flag) {
+    this->checkSyscallEmulator();
+    this->syscalls->enable(flag);
+  }
+
+
+  bool API::isSyscallEmulationEnabled(void) const {
+    this->checkSyscallEmulator();
+    return this->syscalls->isEnabled();
+  }
+
+
+
+  /* Function summaries API ======================================================================== */
+
+  void API::checkFunctionSummaries(void) const {
+    if (!this->summaries)
+      throw triton::exceptions::API("API::checkFunctionSummaries(): Function summaries are undefined.");
+  }
+
+
+  triton::os::unix::FunctionSummaries* API::getFunctionSummaries(void) {
+    this->checkFunctionSummaries();
+    return this->summaries;
+  }
+
+
+  void API::addFunctionSummary(triton::uint64 addr, const std::string& name) {
+    this->checkFunctionSummaries();
+    this->summaries->attach(addr, name);
+  }
+
+
+  triton::usize API::addFunctionSummaries(const triton::format::AbstractBinary& binary) {
+    this->checkFunctionSummaries();
+    return this->summaries->attach(binary.getSymbolIndex());
+  }
+
+
+  triton::usize API::addFunctionSummaries(const triton::format::BinaryInterface& binary) {
+    this->checkFunctionSummaries();
+    return this->summaries->attach(binary.getSymbolIndex());
+  }
+
+
+  void API::addLearnedFunctionSummary(triton::uint64 addr, triton::uint32 argc) {
+    this->checkFunctionSummaries();
+    this->summaries->learn(addr, argc);
+  }
+
+
+  void API::removeFunctionSummary(triton::uint64 addr) {
+    this->checkFunctionSummaries();
+    this->summaries->detach(addr);
   }
 
 
@@ -1030,13 +3224,19 @@ namespace triton {
   }
 
 
-  const std::set<triton::uint64>& API::getTaintedMemory(void) const {
+  std::set<triton::uint64> API::getTaintedMemory(void) const {
     this->checkTaint();
     return this->taint->getTaintedMemory();
   }
 
 
-  const std::set<triton::arch::Register>& API::getTaintedRegisters(void) const {
+  void API::forEachTaintedMemoryRange(const std::function<void(triton::uint64, triton::usize)>& callback) const {
+    this->checkTaint();
+    this->taint->forEachTaintedMemoryRange(callback);
+  }
+
+
+  std::set<triton::arch::Register> API::getTaintedRegisters(void) const {
     this->checkTaint();
     return this->taint->getTaintedRegisters();
   }
@@ -1110,12 +3310,30 @@ namespace triton {
   }
 
 
+  bool API::taintMemoryArea(triton::uint64 baseAddr, triton::usize size) {
+    this->checkTaint();
+    return this->taint->taintMemoryArea(baseAddr, size);
+  }
+
+
   bool API::taintRegister(const triton::arch::Register& reg) {
     this->checkTaint();
     return this->taint->taintRegister(reg);
   }
 
 
+  bool API::taintAssignmentMemoryArea(triton::uint64 dst, triton::uint64 src, triton::usize size) {
+    this->checkTaint();
+    return this->taint->taintAssignmentMemoryArea(dst, src, size);
+  }
+
+
+  bool API::taintUnionMemoryArea(triton::uint64 dst, triton::uint64 src, triton::usize size) {
+    this->checkTaint();
+    return this->taint->taintUnionMemoryArea(dst, src, size);
+  }
+
+
   bool API::untaintMemory(triton::uint64 addr) {
     this->checkTaint();
     return this->taint->untaintMemory(addr);
@@ -1128,12 +3346,42 @@ namespace triton {
   }
 
 
+  bool API::untaintMemoryArea(triton::uint64 baseAddr, triton::usize size) {
+    this->checkTaint();
+    return this->taint->untaintMemoryArea(baseAddr, size);
+  }
+
+
   bool API::untaintRegister(const triton::arch::Register& reg) {
     this->checkTaint();
     return this->taint->untaintRegister(reg);
   }
 
 
+  bool API::labelMemory(triton::uint64 addr, triton::uint32 label) {
+    this->checkTaint();
+    return this->taint->labelMemory(addr, label);
+  }
+
+
+  bool API::labelRegister(const triton::arch::Register& reg, triton::uint32 label) {
+    this->checkTaint();
+    return this->taint->labelRegister(reg, label);
+  }
+
+
+  std::set<triton::uint32> API::getMemoryLabels(triton::uint64 addr, triton::usize size) const {
+    this->checkTaint();
+    return this->taint->getMemoryLabels(addr, size);
+  }
+
+
+  std::set<triton::uint32> API::getRegisterLabels(const triton::arch::Register& reg) const {
+    this->checkTaint();
+    return this->taint->getRegisterLabels(reg);
+  }
+
+
   bool API::taintUnion(const triton::arch::OperandWrapper& op1, const triton::arch::OperandWrapper& op2) {
     this->checkTaint();
     return this->taint->taintUnion(op1, op2);
@@ -49,6 +49,9 @@ namespace triton {
       /* Setup global variables */
       this->arch = arch;
 
+      /* The journals hold the values of the previous CPU */
+      this->clearJournal();
+
       /* Allocate and init the good arch */
       switch (this->arch) {
         case triton::arch::ARCH_X86_64:
@@ -155,6 +158,16 @@ namespace triton {
     }
 
 
+    const triton::arch::RegisterSpecificationEntry& Architecture::getRegisterSpecificationEntry(triton::uint32 regId) const {
+      static const triton::arch::RegisterSpecificationEntry invalid = {"unknown", 0, 0, 0};
+
+      if (!this->cpu)
+        return invalid;
+
+      return this->cpu->getRegisterSpecificationEntry(regId);
+    }
+
+
     std::set<triton::arch::Register*> Architecture::getAllRegisters(void) const {
       if (!this->cpu)
         throw triton::exceptions::Architecture("Architecture::getAllRegisters(): You must define an architecture.");
@@ -197,6 +210,13 @@ namespace triton {
     }
 
 
+    void Architecture::getConcreteMemoryAreaValue(triton::uint64 baseAddr, triton::uint8* area, triton::usize size, bool execCallbacks) const {
+      if (!this->cpu)
+        throw triton::exceptions::Architecture("Architecture::getConcreteMemoryAreaValue(): You must define an architecture.");
+      this->cpu->getConcreteMemoryAreaValue(baseAddr, area, size, execCallbacks);
+    }
+
+
     triton::uint512 Architecture::getConcreteRegisterValue(const triton::arch::Register& reg, bool execCallbacks) const {
       if (!this->cpu)
         throw triton::exceptions::Architecture("Architecture::getConcreteRegisterValue(): You must define an architecture.");
@@ -207,6 +227,7 @@ namespace triton {
     void Architecture::setConcreteMemoryValue(triton::uint64 addr, triton::uint8 value) {
       if (!this->cpu)
         throw triton::exceptions::Architecture("Architecture::setConcreteMemoryValue(): You must define an architecture.");
+      this->recordMemory(addr, 1);
       this->cpu->setConcreteMemoryValue(addr, value);
     }
 
@@ -214,6 +235,7 @@ namespace triton {
     void Architecture::setConcreteMemoryValue(const triton::arch::MemoryAccess& mem) {
       if (!this->cpu)
         throw triton::exceptions::Architecture("Architecture::setConcreteMemoryValue(): You must define an architecture.");
+      this->recordMemory(mem.getAddress(), mem.getSize());
       this->cpu->setConcreteMemoryValue(mem);
     }
 
@@ -221,6 +243,7 @@ namespace triton {
     void Architecture::setConcreteMemoryAreaValue(triton::uint64 baseAddr, const std::vector<triton::uint8>& values) {
       if (!this->cpu)
         throw triton::exceptions::Architecture("Architecture::setConcreteMemoryAreaValue(): You must define an architecture.");
+      this->recordMemory(baseAddr, values.size());
       this->cpu->setConcreteMemoryAreaValue(baseAddr, values);
     }
 
@@ -228,6 +251,7 @@ namespace triton {
     void Architecture::setConcreteMemoryAreaValue(triton::uint64 baseAddr, const triton::uint8* area, triton::usize size) {
       if (!this->cpu)
         throw triton::exceptions::Architecture("Architecture::setConcreteMemoryAreaValue(): You must define an architecture.");
+      this->recordMemory(baseAddr, size);
       this->cpu->setConcreteMemoryAreaValue(baseAddr, area, size);
     }
 
@@ -235,10 +259,71 @@ namespace triton {
     void Architecture::setConcreteRegisterValue(const triton::arch::Register& reg) {
       if (!this->cpu)
         throw triton::exceptions::Architecture("Architecture::setConcreteRegisterValue(): You must define an architecture.");
+      this->recordRegister(reg);
       this->cpu->setConcreteRegisterValue(reg);
     }
 
 
+    void Architecture::recordRegister(const triton::arch::Register& reg) {
+      if (this->journalMarks.empty())
+        return;
+
+      triton::arch::Register parent(reg.getParentId());
+      this->journalRegisters.push_back(triton::arch::Register(parent.getId(), this->cpu->getConcreteRegisterValue(parent, false)));
+    }
+
+
+    void Architecture::recordMemory(triton::uint64 addr, triton::usize size) {
+      if (this->journalMarks.empty())
+        return;
+
+      for (triton::usize index = 0; index < size; index++) {
+        bool mapped = this->cpu->isMemoryMapped(addr + index);
+        this->journalMemory.push_back(std::make_tuple(addr + index, (mapped ? this->cpu->getConcreteMemoryValue(addr + index) : 0), mapped));
+      }
+    }
+
+
+    void Architecture::startJournal(void) {
+      if (this->journalMarks.empty()) {
+        this->journalRegisters.clear();
+        this->journalMemory.clear();
+      }
+      this->journalMarks.push_back(std::make_pair(this->journalRegisters.size(), this->journalMemory.size()));
+    }
+
+
+    void Architecture::rollbackJournal(void) {
+      if (this->journalMarks.empty())
+        return;
+
+      std::pair<triton::usize, triton::usize> mark = this->journalMarks.back();
+      this->journalMarks.pop_back();
+
+      /* Restore in the reverse order, the restorations are not journaled as the mark is popped */
+      for (triton::usize index = this->journalRegisters.size(); index > mark.first; index--)
+        this->cpu->setConcreteRegisterValue(this->journalRegisters[index - 1]);
+
+      for (triton::usize index = this->journalMemory.size(); index > mark.second; index--) {
+        const auto& entry = this->journalMemory[index - 1];
+        if (std::get<2>(entry))
+          this->cpu->setConcreteMemoryValue(std::get<0>(entry), std::get<1>(entry));
+        else
+          this->cpu->unmapMemory(std::get<0>(entry));
+      }
+
+      this->journalRegisters.erase(this->journalRegisters.begin() + mark.first, this->journalRegisters.end());
+      this->journalMemory.erase(this->journalMemory.begin() + mark.second, this->journalMemory.end());
+    }
+
+
+    void Architecture::clearJournal(void) {
+      this->journalRegisters.clear();
+      this->journalMemory.clear();
+      this->journalMarks.clear();
+    }
+
+
     bool Architecture::isMemoryMapped(triton::uint64 baseAddr, triton::usize size) {
       if (!this->cpu)
         throw triton::exceptions::Architecture("Architecture::isMemoryMapped(): You must define an architecture.");
@@ -252,6 +337,20 @@ namespace triton {
       this->cpu->unmapMemory(baseAddr, size);
     }
 
+
+    triton::usize Architecture::getNumberOfMemoryPages(void) const {
+      if (!this->cpu)
+        throw triton::exceptions::Architecture("Architecture::getNumberOfMemoryPages(): You must define an architecture.");
+      return this->cpu->getNumberOfMemoryPages();
+    }
+
+
+    triton::usize Architecture::getMemoryUsage(void) const {
+      if (!this->cpu)
+        throw triton::exceptions::Architecture("Architecture::getMemoryUsage(): You must define an architecture.");
+      return this->cpu->getMemoryUsage();
+    }
+
   }; /* arch namespace */
 }; /* triton namespace */
 
@@ -0,0 +1,152 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#include <algorithm>
+#include <iterator>
+
+#include <decodeAhead.hpp>
+#include <exceptions.hpp>
+
+
+
+namespace triton {
+  namespace arch {
+
+    DecodeAhead::DecodeAhead(const triton::arch::CpuInterface* cpu, const std::function<void(void)>& init) : ready(false) {
+      this->cpu       = cpu;
+      this->init      = init;
+      this->finishing = false;
+      this->stopping  = false;
+      this->helper    = std::thread(&DecodeAhead::work, this);
+    }
+
+
+    DecodeAhead::~DecodeAhead() {
+      if (!this->helper.joinable())
+        return;
+
+      {
+        std::lock_guard<std::mutex> guard(this->lock);
+        this->stopping = true;
+      }
+      this->wakeup.notify_one();
+      this->helper.join();
+    }
+
+
+    void DecodeAhead::finish(void) {
+      if (!this->helper.joinable())
+        return;
+
+      {
+        std::lock_guard<std::mutex> guard(this->lock);
+        this->finishing = true;
+      }
+      this->wakeup.notify_one();
+      this->helper.join();
+    }
+
+
+    void DecodeAhead::request(triton::uint64 addr, std::vector<triton::uint8>&& bytes) {
+      {
+        std::lock_guard<std::mutex> guard(this->lock);
+        if (this->requests.size() >= DecodeAhead::maxPending)
+          this->requests.pop_front();
+        this->requests.push_back(Request());
+        this->requests.back().addr  = addr;
+        this->requests.back().bytes = std::move(bytes);
+      }
+      this->wakeup.notify_one();
+    }
+
+
+    triton::usize DecodeAhead::drain(triton::arch::DecodeCache& cache) {
+      std::vector<std::pair<triton::uint64, triton::arch::DecodedInstruction>> decoded;
+      triton::usize count = 0;
+
+      if (!this->ready.load(std::memory_order_acquire))
+        return 0;
+
+      {
+        std::lock_guard<std::mutex> guard(this->lock);
+        decoded.swap(this->decoded);
+        this->ready.store(false, std::memory_order_release);
+      }
+
+      /* An entry of the cache may be newer than the bytes the helper decoded */
+      for (auto it = decoded.begin(); it != decoded.end() && !cache.isFull(); it++) {
+        if (cache.contains(it->first))
+          continue;
+        cache.insert(it->first, it->second);
+        count++;
+      }
+
+      return count;
+    }
+
+
+    void DecodeAhead::work(void) {
+      triton::usize handle = 0;
+
+      /* Registers and memory accesses of the operands are built through the API bound by init */
+      try {
+        this->init();
+        handle = this->cpu->openDecoder();
+      }
+      catch (const triton::exceptions::Exception&) {
+        return;
+      }
+
+      while (true) {
+        std::vector<std::pair<triton::uint64, triton::arch::DecodedInstruction>> block;
+        Request current;
+
+        {
+          std::unique_lock<std::mutex> guard(this->lock);
+          this->wakeup.wait(guard, [this]() { return this->stopping || this->finishing || !this->requests.empty(); });
+          if (this->stopping || this->requests.empty())
+            break;
+          current = std::move(this->requests.front());
+          this->requests.pop_front();
+        }
+
+        /* Straight-line code, up to maxBlocks control flow instructions */
+        triton::usize offset = 0;
+        triton::usize blocks = 0;
+        while (offset < current.bytes.size() && blocks < DecodeAhead::maxBlocks) {
+          triton::arch::DecodedInstruction instruction;
+          triton::uint64 addr = current.addr + offset;
+          bool valid = false;
+
+          try {
+            valid = this->cpu->decode(handle, current.bytes.data() + offset, std::min<triton::usize>(current.bytes.size() - offset, 16), addr, instruction);
+          }
+          catch (const triton::exceptions::Exception&) {
+          }
+
+          if (!valid)
+            break;
+
+          offset += instruction.opcodes.size();
+          if (instruction.controlFlow)
+            blocks++;
+
+          block.push_back(std::make_pair(addr, std::move(instruction)));
+        }
+
+        if (!block.empty()) {
+          std::lock_guard<std::mutex> guard(this->lock);
+          std::move(block.begin(), block.end(), std::back_inserter(this->decoded));
+          this->ready.store(true, std::memory_order_release);
+        }
+      }
+
+      this->cpu->closeDecoder(handle);
+    }
+
+  }; /* arch namespace */
+}; /* triton namespace */
@@ -0,0 +1,287 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#include <cstring>
+#include <fstream>
+
+#include <decodeCache.hpp>
+#include <exceptions.hpp>
+#include <mappedFile.hpp>
+
+
+
+namespace triton {
+  namespace arch {
+
+    const DecodedInstruction* DecodeCache::find(const triton::arch::Instruction& inst) const {
+      auto it = this->entries.find(inst.getAddress());
+
+      if (it == this->entries.end())
+        return nullptr;
+
+      const DecodedInstruction& decoded = it->second;
+      if (inst.getSize() < decoded.opcodes.size())
+        return nullptr;
+
+      if (std::memcmp(inst.getOpcodes(), decoded.opcodes.data(), decoded.opcodes.size()) != 0)
+        return nullptr;
+
+      return &decoded;
+    }
+
+
+    bool DecodeCache::contains(triton::uint64 addr) const {
+      return (this->entries.find(addr) != this->entries.end());
+    }
+
+
+    void DecodeCache::insert(triton::uint64 addr, const DecodedInstruction& decoded) {
+      if (this->entries.size() >= DecodeCache::maxEntries && this->entries.find(addr) == this->entries.end())
+        this->entries.clear();
+      this->entries[addr] = decoded;
+    }
+
+
+    void DecodeCache::apply(const DecodedInstruction& decoded, triton::arch::Instruction& inst) const {
+      inst.setDisassembly(decoded.disassembly);
+      inst.setSize(static_cast<triton::uint32>(decoded.opcodes.size()));
+      inst.setType(decoded.type);
+      inst.setPrefix(decoded.prefix);
+
+      for (auto it = decoded.operands.begin(); it != decoded.operands.end(); it++) {
+        if (it->getType() == triton::arch::OP_REG)
+          inst.operands.push_back(triton::arch::OperandWrapper(inst.getRegisterState(it->getConstRegister().getId())));
+        else
+          inst.operands.push_back(*it);
+      }
+
+      if (decoded.branch)
+        inst.setBranch(true);
+
+      if (decoded.controlFlow)
+        inst.setControlFlow(true);
+    }
+
+
+    void DecodeCache::clear(void) {
+      this->entries.clear();
+    }
+
+
+    triton::usize DecodeCache::size(void) const {
+      return this->entries.size();
+    }
+
+
+    bool DecodeCache::isFull(void) const {
+      return (this->entries.size() >= DecodeCache::maxEntries);
+    }
+
+
+    void DecodeCache::writeUnsigned(std::string& buffer, triton::uint64 value) {
+      do {
+        triton::uint8 byte = (value & 0x7f);
+        value >>= 7;
+        buffer.push_back(static_cast<char>(value ? (byte | 0x80) : byte));
+      } while (value);
+    }
+
+
+    triton::uint64 DecodeCache::readUnsigned(const triton::uint8* data, triton::usize size, triton::usize& offset) {
+      triton::uint64 value = 0;
+
+      for (triton::uint32 shift = 0; shift < 64; shift += 7) {
+        if (offset >= size)
+          throw triton::exceptions::Disassembly("DecodeCache::load(): The file is truncated.");
+
+        triton::uint8 byte = data[offset++];
+        value |= (static_cast<triton::uint64>(byte & 0x7f) << shift);
+        if ((byte & 0x80) == 0)
+          return value;
+      }
+
+      throw triton::exceptions::Disassembly("DecodeCache::load(): Invalid varint.");
+    }
+
+
+    triton::usize DecodeCache::save(const std::string& path, triton::uint64 key, const std::vector<std::pair<triton::uint64, triton::uint64>>& ranges) const {
+      std::string buffer("TRDC");
+      std::string records;
+      triton::usize count = 0;
+
+      for (auto range = ranges.begin(); range != ranges.end(); range++) {
+        for (auto it = this->entries.lower_bound(range->first); it != this->entries.end() && it->first < range->second; it++) {
+          const DecodedInstruction& decoded = it->second;
+
+          DecodeCache::writeUnsigned(records, it->first);
+          DecodeCache::writeUnsigned(records, decoded.opcodes.size());
+          records.append(reinterpret_cast<const char*>(decoded.opcodes.data()), decoded.opcodes.size());
+          DecodeCache::writeUnsigned(records, decoded.disassembly ? decoded.disassembly->size() : 0);
+          if (decoded.disassembly)
+            records.append(*decoded.disassembly);
+          DecodeCache::writeUnsigned(records, decoded.type);
+          DecodeCache::writeUnsigned(records, decoded.prefix);
+          DecodeCache::writeUnsigned(records, (decoded.branch ? 1 : 0) | (decoded.controlFlow ? 2 : 0));
+          DecodeCache::writeUnsigned(records, decoded.operands.size());
+
+          for (auto op = decoded.operands.begin(); op != decoded.operands.end(); op++) {
+            DecodeCache::writeUnsigned(records, op->getType());
+            switch (op->getType()) {
+              case triton::arch::OP_IMM:
+                DecodeCache::writeUnsigned(records, op->getConstImmediate().getValue());
+                DecodeCache::writeUnsigned(records, op->getConstImmediate().getSize());
+                break;
+
+              case triton::arch::OP_MEM: {
+                const triton::arch::MemoryAccess& mem = op->getConstMemory();
+                DecodeCache::writeUnsigned(records, mem.getHigh());
+                DecodeCache::writeUnsigned(records, mem.getLow());
+                DecodeCache::writeUnsigned(records, mem.getConstSegmentRegister().getId());
+                DecodeCache::writeUnsigned(records, mem.getConstBaseRegister().getId());
+                DecodeCache::writeUnsigned(records, mem.getConstIndexRegister().getId());
+                DecodeCache::writeUnsigned(records, mem.getConstDisplacement().getValue());
+                DecodeCache::writeUnsigned(records, mem.getConstDisplacement().getSize());
+                DecodeCache::writeUnsigned(records, mem.getConstScale().getValue());
+                DecodeCache::writeUnsigned(records, mem.getConstScale().getSize());
+                DecodeCache::writeUnsigned(records, mem.getPcRelative());
+                break;
+              }
+
+              default:
+                DecodeCache::writeUnsigned(records, op->getConstRegister().getId());
+                break;
+            }
+          }
+
+          count++;
+        }
+      }
+
+      DecodeCache::writeUnsigned(buffer, triton::arch::decodeCacheVersion);
+      DecodeCache::writeUnsigned(buffer, key);
+      DecodeCache::writeUnsigned(buffer, count);
+      buffer.append(records);
+
+      std::ofstream file(path, std::ios::out | std::ios::binary | std::ios::trunc);
+      if (!file.is_open())
+        throw triton::exceptions::Disassembly("DecodeCache::save(): Cannot open the file.");
+
+      file.write(buffer.data(), buffer.size());
+      if (!file)
+        throw triton::exceptions::Disassembly("DecodeCache::save(): Cannot write the file.");
+
+      return count;
+    }
+
+
+    triton::usize DecodeCache::load(const std::string& path, triton::uint64 key) {
+      triton::format::MappedFile file;
+      triton::usize offset = 4;
+
+      /* A missing file is a cache miss */
+      try {
+        file.open(path);
+      }
+      catch (const triton::exceptions::Format&) {
+        return 0;
+      }
+
+      const triton::uint8* data = file.getData();
+      triton::usize size        = file.getSize();
+
+      if (size < 4 || std::memcmp(data, "TRDC", 4) != 0)
+        return 0;
+
+      if (DecodeCache::readUnsigned(data, size, offset) != triton::arch::decodeCacheVersion)
+        return 0;
+
+      if (DecodeCache::readUnsigned(data, size, offset) != key)
+        return 0;
+
+      triton::usize count = static_cast<triton::usize>(DecodeCache::readUnsigned(data, size, offset));
+      triton::usize read  = 0;
+
+      for (; read < count && !this->isFull(); read++) {
+        DecodedInstruction decoded;
+
+        triton::uint64 addr   = DecodeCache::readUnsigned(data, size, offset);
+        triton::usize opcodes = static_cast<triton::usize>(DecodeCache::readUnsigned(data, size, offset));
+        if (opcodes > size - offset)
+          throw triton::exceptions::Disassembly("DecodeCache::load(): The file is truncated.");
+        decoded.opcodes.assign(data + offset, data + offset + opcodes);
+        offset += opcodes;
+
+        triton::usize length = static_cast<triton::usize>(DecodeCache::readUnsigned(data, size, offset));
+        if (length > size - offset)
+          throw triton::exceptions::Disassembly("DecodeCache::load(): The file is truncated.");
+        decoded.disassembly = std::make_shared<const std::string>(reinterpret_cast<const char*>(data + offset), length);
+        offset += length;
+
+        decoded.type   = static_cast<triton::uint32>(DecodeCache::readUnsigned(data, size, offset));
+        decoded.prefix = static_cast<triton::uint32>(DecodeCache::readUnsigned(data, size, offset));
+
+        triton::uint64 flags = DecodeCache::readUnsigned(data, size, offset);
+        decoded.branch      = ((flags & 1) != 0);
+        decoded.controlFlow = ((flags & 2) != 0);
+
+        triton::uint64 operands = DecodeCache::readUnsigned(data, size, offset);
+        for (triton::uint64 index = 0; index < operands; index++) {
+          switch (DecodeCache::readUnsigned(data, size, offset)) {
+            case triton::arch::OP_IMM: {
+              triton::uint64 value = DecodeCache::readUnsigned(data, size, offset);
+              triton::uint32 bytes = static_cast<triton::uint32>(DecodeCache::readUnsigned(data, size, offset));
+              decoded.operands.push_back(triton::arch::OperandWrapper(triton::arch::Immediate(value, bytes)));
+              break;
+            }
+
+            case triton::arch::OP_MEM: {
+              triton::arch::MemoryAccess mem;
+              triton::uint32 high = static_cast<triton::uint32>(DecodeCache::readUnsigned(data, size, offset));
+              triton::uint32 low  = static_cast<triton::uint32>(DecodeCache::readUnsigned(data, size, offset));
+              mem.setPair(std::make_pair(high, low));
+
+              triton::arch::Register segment(static_cast<triton::uint32>(DecodeCache::readUnsigned(data, size, offset)));
+              triton::arch::Register base(static_cast<triton::uint32>(DecodeCache::readUnsigned(data, size, offset)));
+              triton::arch::Register index(static_cast<triton::uint32>(DecodeCache::readUnsigned(data, size, offset)));
+              triton::uint64 dispValue  = DecodeCache::readUnsigned(data, size, offset);
+              triton::uint32 dispSize   = static_cast<triton::uint32>(DecodeCache::readUnsigned(data, size, offset));
+              triton::uint64 scaleValue = DecodeCache::readUnsigned(data, size, offset);
+              triton::uint32 scaleSize  = static_cast<triton::uint32>(DecodeCache::readUnsigned(data, size, offset));
+              triton::arch::Immediate disp(dispValue, dispSize);
+              triton::arch::Immediate scale(scaleValue, scaleSize);
+
+              mem.setSegmentRegister(segment);
+              mem.setBaseRegister(base);
+              mem.setIndexRegister(index);
+              mem.setDisplacement(disp);
+              mem.setScale(scale);
+
+              triton::uint64 pcRelative = DecodeCache::readUnsigned(data, size, offset);
+              if (pcRelative)
+                mem.setPcRelative(pcRelative);
+
+              decoded.operands.push_back(triton::arch::OperandWrapper(mem));
+              break;
+            }
+
+            case triton::arch::OP_REG:
+              decoded.operands.push_back(triton::arch::OperandWrapper(triton::arch::Register(static_cast<triton::uint32>(DecodeCache::readUnsigned(data, size, offset)))));
+              break;
+
+            default:
+              throw triton::exceptions::Disassembly("DecodeCache::load(): Invalid operand.");
+          }
+        }
+
+        this->insert(addr, decoded);
+      }
+
+      return read;
+    }
+
+  }; /* arch namespace */
+}; /* triton namespace */
@@ -5,6 +5,7 @@
 **  This program is under the terms of the BSD License.
 */
 
+#include <algorithm>
 #include <cstring>
 
 #include <exceptions.hpp>
@@ -16,6 +17,39 @@
 namespace triton {
   namespace arch {
 
+    /* Records an access once, like a set would, but keeps the order of insertion and the capacity of the vector */
+    template <typename T>
+    static void insertAccess(std::vector<std::pair<T, triton::ast::AbstractNode*>>& accesses, const T& operand, triton::ast::AbstractNode* node) {
+      for (const auto& access : accesses) {
+        if (access.second == node && !(access.first < operand) && !(operand < access.first))
+          return;
+      }
+      accesses.push_back(std::make_pair(operand, node));
+    }
+
+
+    /* Builds the memory access of a handle, with the value of its AST */
+    static triton::arch::MemoryAccess getMemoryAccess(const triton::arch::MemoryHandle& handle, triton::ast::AbstractNode* node) {
+      triton::arch::MemoryAccess mem = handle.getMemoryAccess();
+
+      if (node && handle.size && node->getBitvectorSize() == mem.getBitSize())
+        mem.setConcreteValue(node->evaluate());
+
+      return mem;
+    }
+
+
+    /* Builds the register of a handle, with the value of its AST */
+    static triton::arch::Register getRegister(const triton::arch::RegisterHandle& handle, triton::ast::AbstractNode* node) {
+      triton::arch::Register reg = handle.getRegister();
+
+      if (node && reg.isValid() && node->getBitvectorSize() == reg.getBitSize())
+        reg.setConcreteValue(node->evaluate());
+
+      return reg;
+    }
+
+
     Instruction::Instruction() {
       this->address         = 0;
       this->branch          = false;
@@ -61,6 +95,7 @@ namespace triton {
       this->prefix              = other.prefix;
       this->readRegisters       = other.readRegisters;
       this->registerState       = other.registerState;
+      this->registerStateIndex  = other.registerStateIndex;
       this->size                = other.size;
       this->storeAccess         = other.storeAccess;
       this->symbolicExpressions = other.symbolicExpressions;
@@ -69,10 +104,8 @@ namespace triton {
       this->type                = other.type;
       this->writtenRegisters    = other.writtenRegisters;
 
+      this->disassembly         = other.disassembly;
       std::memcpy(this->opcodes, other.opcodes, sizeof(this->opcodes));
-
-      this->disassembly.clear();
-      this->disassembly.str(other.disassembly.str());
     }
 
 
@@ -102,7 +135,9 @@ namespace triton {
 
 
     std::string Instruction::getDisassembly(void) const {
-      return this->disassembly.str();
+      if (this->disassembly == nullptr)
+        return std::string();
+      return *this->disassembly;
     }
 
 
@@ -134,27 +169,71 @@ namespace triton {
     }
 
 
-    const std::set<std::pair<triton::arch::MemoryAccess, triton::ast::AbstractNode*>>& Instruction::getLoadAccess(void) const {
+    std::vector<std::pair<triton::arch::MemoryAccess, triton::ast::AbstractNode*>> Instruction::getLoadAccess(void) const {
+      std::vector<std::pair<triton::arch::MemoryAccess, triton::ast::AbstractNode*>> ret;
+
+      ret.reserve(this->loadAccess.size());
+      for (auto it = this->loadAccess.begin(); it != this->loadAccess.end(); it++)
+        ret.push_back(std::make_pair(getMemoryAccess(it->first, it->second), it->second));
+
+      return ret;
+    }
+
+
+    std::vector<std::pair<triton::arch::MemoryAccess, triton::ast::AbstractNode*>> Instruction::getStoreAccess(void) const {
+      std::vector<std::pair<triton::arch::MemoryAccess, triton::ast::AbstractNode*>> ret;
+
+      ret.reserve(this->storeAccess.size());
+      for (auto it = this->storeAccess.begin(); it != this->storeAccess.end(); it++)
+        ret.push_back(std::make_pair(getMemoryAccess(it->first, it->second), it->second));
+
+      return ret;
+    }
+
+
+    std::vector<std::pair<triton::arch::Register, triton::ast::AbstractNode*>> Instruction::getReadRegisters(void) const {
+      std::vector<std::pair<triton::arch::Register, triton::ast::AbstractNode*>> ret;
+
+      ret.reserve(this->readRegisters.size());
+      for (auto it = this->readRegisters.begin(); it != this->readRegisters.end(); it++)
+        ret.push_back(std::make_pair(getRegister(it->first, it->second), it->second));
+
+      return ret;
+    }
+
+
+    std::vector<std::pair<triton::arch::Register, triton::ast::AbstractNode*>> Instruction::getWrittenRegisters(void) const {
+      std::vector<std::pair<triton::arch::Register, triton::ast::AbstractNode*>> ret;
+
+      ret.reserve(this->writtenRegisters.size());
+      for (auto it = this->writtenRegisters.begin(); it != this->writtenRegisters.end(); it++)
+        ret.push_back(std::make_pair(getRegister(it->first, it->second), it->second));
+
+      return ret;
+    }
+
+
+    const std::vector<std::pair<triton::arch::MemoryHandle, triton::ast::AbstractNode*>>& Instruction::getLoadAccessHandles(void) const {
       return this->loadAccess;
     }
 
 
-    const std::set<std::pair<triton::arch::MemoryAccess, triton::ast::AbstractNode*>>& Instruction::getStoreAccess(void) const {
+    const std::vector<std::pair<triton::arch::MemoryHandle, triton::ast::AbstractNode*>>& Instruction::getStoreAccessHandles(void) const {
       return this->storeAccess;
     }
 
 
-    const std::set<std::pair<triton::arch::Register, triton::ast::AbstractNode*>>& Instruction::getReadRegisters(void) const {
+    const std::vector<std::pair<triton::arch::RegisterHandle, triton::ast::AbstractNode*>>& Instruction::getReadRegisterHandles(void) const {
       return this->readRegisters;
     }
 
 
-    const std::set<std::pair<triton::arch::Register, triton::ast::AbstractNode*>>& Instruction::getWrittenRegisters(void) const {
+    const std::vector<std::pair<triton::arch::RegisterHandle, triton::ast::AbstractNode*>>& Instruction::getWrittenRegisterHandles(void) const {
       return this->writtenRegisters;
     }
 
 
-    const std::set<std::pair<triton::arch::Immediate, triton::ast::AbstractNode*>>& Instruction::getReadImmediates(void) const {
+    const std::vector<std::pair<triton::arch::Immediate, triton::ast::AbstractNode*>>& Instruction::getReadImmediates(void) const {
       return this->readImmediates;
     }
 
@@ -166,15 +245,28 @@ namespace triton {
 
     /* If there is a concrete value recorded, build the appropriate Register. Otherwise, perfrom the analysis on zero. */
     triton::arch::Register Instruction::getRegisterState(triton::uint32 regId) {
-      triton::arch::Register reg(regId);
-      if (this->registerState.find(regId) != this->registerState.end())
-        reg = this->registerState[regId];
-      return reg;
+      triton::usize index = this->findRegisterState(regId);
+
+      if (index < this->registerState.size())
+        return this->registerState[index];
+
+      return triton::arch::Register(regId);
+    }
+
+
+    /* The index may be stale if registerState has been modified directly, so each entry is checked */
+    triton::usize Instruction::findRegisterState(triton::uint32 regId) const {
+      if (regId < this->registerStateIndex.size()) {
+        triton::usize index = this->registerStateIndex[regId];
+        if (index < this->registerState.size() && this->registerState[index].getId() == regId)
+          return index;
+      }
+      return this->registerState.size();
     }
 
 
     void Instruction::setLoadAccess(const triton::arch::MemoryAccess& mem, triton::ast::AbstractNode* node) {
-      this->loadAccess.insert(std::make_pair(mem, node));
+      insertAccess(this->loadAccess, triton::arch::MemoryHandle(mem), node);
     }
 
 
@@ -182,7 +274,7 @@ namespace triton {
       auto it = this->loadAccess.begin();
 
       while (it != this->loadAccess.end()) {
-        if (it->first.getAddress() == mem.getAddress())
+        if (it->first.address == mem.getAddress())
           it = this->loadAccess.erase(it);
         else
           ++it;
@@ -191,7 +283,7 @@ namespace triton {
 
 
     void Instruction::setStoreAccess(const triton::arch::MemoryAccess& mem, triton::ast::AbstractNode* node) {
-      this->storeAccess.insert(std::make_pair(mem, node));
+      insertAccess(this->storeAccess, triton::arch::MemoryHandle(mem), node);
     }
 
 
@@ -199,7 +291,7 @@ namespace triton {
       auto it = this->storeAccess.begin();
 
       while (it != this->storeAccess.end()) {
-        if (it->first.getAddress() == mem.getAddress())
+        if (it->first.address == mem.getAddress())
           it = this->storeAccess.erase(it);
         else
           ++it;
@@ -208,7 +300,7 @@ namespace triton {
 
 
     void Instruction::setReadRegister(const triton::arch::Register& reg, triton::ast::AbstractNode* node) {
-      this->readRegisters.insert(std::make_pair(reg, node));
+      insertAccess(this->readRegisters, triton::arch::RegisterHandle(reg), node);
     }
 
 
@@ -216,7 +308,7 @@ namespace triton {
       auto it = this->readRegisters.begin();
 
       while (it != this->readRegisters.end()) {
-        if (it->first.getId() == reg.getId())
+        if (it->first.id == reg.getId())
           it = this->readRegisters.erase(it);
         else
           ++it;
@@ -225,7 +317,7 @@ namespace triton {
 
 
     void Instruction::setWrittenRegister(const triton::arch::Register& reg, triton::ast::AbstractNode* node) {
-      this->writtenRegisters.insert(std::make_pair(reg, node));
+      insertAccess(this->writtenRegisters, triton::arch::RegisterHandle(reg), node);
     }
 
 
@@ -233,7 +325,7 @@ namespace triton {
       auto it = this->writtenRegisters.begin();
 
       while (it != this->writtenRegisters.end()) {
-        if (it->first.getId() == reg.getId())
+        if (it->first.id == reg.getId())
           it = this->writtenRegisters.erase(it);
         else
           ++it;
@@ -242,7 +334,7 @@ namespace triton {
 
 
     void Instruction::setReadImmediate(const triton::arch::Immediate& imm, triton::ast::AbstractNode* node) {
-      this->readImmediates.insert(std::make_pair(imm, node));
+      insertAccess(this->readImmediates, imm, node);
     }
 
 
@@ -274,8 +366,12 @@ namespace triton {
 
 
     void Instruction::setDisassembly(const std::string& str) {
-      this->disassembly.clear();
-      this->disassembly.str(str);
+      this->disassembly = std::make_shared<const std::string>(str);
+    }
+
+
+    void Instruction::setDisassembly(const std::shared_ptr<const std::string>& str) {
+      this->disassembly = str;
     }
 
 
@@ -296,7 +392,19 @@ namespace triton {
 
 
     void Instruction::updateContext(const triton::arch::Register& reg) {
-      this->registerState[reg.getId()] = reg;
+      triton::uint32 regId = reg.getId();
+      triton::usize index  = this->findRegisterState(regId);
+
+      if (index < this->registerState.size()) {
+        this->registerState[index] = reg;
+        return;
+      }
+
+      if (regId >= this->registerStateIndex.size())
+        this->registerStateIndex.resize(regId + 1, 0);
+
+      this->registerStateIndex[regId] = static_cast<triton::uint32>(this->registerState.size());
+      this->registerState.push_back(reg);
     }
 
 
@@ -361,25 +469,23 @@ namespace triton {
           }
           break;
 
-        case triton::arch::OP_MEM:
+        case triton::arch::OP_MEM: {
+          triton::arch::MemoryHandle mem(target.getConstMemory());
           for (auto&& pair : this->loadAccess) {
-            const triton::arch::MemoryAccess& m1 = pair.first;
-            const triton::arch::MemoryAccess& m2 = target.getConstMemory();
-
-            if (m1.isOverlapWith(m2))
+            if (pair.first.isOverlapWith(mem))
               return true;
           }
           break;
+        }
 
-        case triton::arch::OP_REG:
+        case triton::arch::OP_REG: {
+          triton::arch::RegisterHandle reg(target.getConstRegister());
           for (auto&& pair : this->readRegisters) {
-            const triton::arch::Register& r1 = pair.first;
-            const triton::arch::Register& r2 = target.getConstRegister();
-
-            if (r1.isOverlapWith(r2))
+            if (pair.first.isOverlapWith(reg))
               return true;
           }
           break;
+        }
 
         default:
           throw triton::exceptions::Instruction("Instruction::isReadFrom(): Invalid type operand.");
@@ -395,25 +501,23 @@ namespace triton {
         case triton::arch::OP_IMM:
           break;
 
-        case triton::arch::OP_MEM:
+        case triton::arch::OP_MEM: {
+          triton::arch::MemoryHandle mem(target.getConstMemory());
           for (auto&& pair : this->storeAccess) {
-            const triton::arch::MemoryAccess& m1 = pair.first;
-            const triton::arch::MemoryAccess& m2 = target.getConstMemory();
-
-            if (m1.isOverlapWith(m2))
+            if (pair.first.isOverlapWith(mem))
               return true;
           }
           break;
+        }
 
-        case triton::arch::OP_REG:
+        case triton::arch::OP_REG: {
+          triton::arch::RegisterHandle reg(target.getConstRegister());
           for (auto&& pair : this->writtenRegisters) {
-            const triton::arch::Register& r1 = pair.first;
-            const triton::arch::Register& r2 = target.getConstRegister();
-
-            if (r1.isOverlapWith(r2))
+            if (pair.first.isOverlapWith(reg))
               return true;
           }
           break;
+        }
 
         default:
           throw triton::exceptions::Instruction("Instruction::isWriteTo(): Invalid type operand.");
@@ -449,6 +553,7 @@ namespace triton {
       this->partialReset();
       this->memoryAccess.clear();
       this->registerState.clear();
+      this->registerStateIndex.clear();
     }
 
 
@@ -462,7 +567,7 @@ namespace triton {
       this->tid             = 0;
       this->type            = 0;
 
-      this->disassembly.clear();
+      this->disassembly.reset();
       this->loadAccess.clear();
       this->operands.clear();
       this->readImmediates.clear();
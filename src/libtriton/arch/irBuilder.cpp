@@ -5,13 +5,19 @@
 **  This program is under the terms of the BSD License.
 */
 
+#include <algorithm>
 #include <new>
+#include <utility>
+#include <vector>
 
+#include <coreUtils.hpp>
 #include <exceptions.hpp>
 #include <irBuilder.hpp>
 #include <memoryAccess.hpp>
 #include <operandWrapper.hpp>
 #include <register.hpp>
+#include <perfCounters.hpp>
+#include <traceEvents.hpp>
 #include <x86Semantics.hpp>
 
 
@@ -40,45 +46,97 @@ namespace triton {
       if (taintEngine == nullptr)
         throw triton::exceptions::IrBuilder("IrBuilder::IrBuilder(): The taint engines API must be defined.");
 
-      this->architecture              = architecture;
-      this->astGarbageCollector       = astGarbageCollector;
-      this->backupAstGarbageCollector = new(std::nothrow) triton::ast::AstGarbageCollector(modes, true);
-      this->backupSymbolicEngine      = new(std::nothrow) triton::engines::symbolic::SymbolicEngine(architecture, modes, nullptr, true);
-      this->modes                     = modes;
-      this->symbolicEngine            = symbolicEngine;
-      this->taintEngine               = taintEngine;
-      this->x86Isa                    = new(std::nothrow) triton::arch::x86::x86Semantics(architecture, symbolicEngine, taintEngine);
-
-      if (this->x86Isa == nullptr || this->backupSymbolicEngine == nullptr || this->backupAstGarbageCollector == nullptr)
+      this->architecture           = architecture;
+      this->astGarbageCollector    = astGarbageCollector;
+      this->collectedNodes         = 0;
+      this->concreteInstructions   = 0;
+      this->instructions           = 0;
+      this->modes                  = modes;
+      this->nativeInstructions     = 0;
+      this->postIrTime             = 0;
+      this->semanticsTime          = 0;
+      this->summarizedInstructions = 0;
+      this->summarizedLoops        = 0;
+      this->symbolicEngine         = symbolicEngine;
+      this->taintEngine            = taintEngine;
+      this->x86Isa                 = new(std::nothrow) triton::arch::x86::x86Semantics(architecture, symbolicEngine, taintEngine);
+
+      if (this->x86Isa == nullptr)
         throw triton::exceptions::IrBuilder("IrBuilder::IrBuilder(): Not enough memory.");
     }
 
 
     IrBuilder::~IrBuilder() {
-      delete this->backupSymbolicEngine;
-      delete this->backupAstGarbageCollector;
       delete this->x86Isa;
     }
 
 
     bool IrBuilder::buildSemantics(triton::arch::Instruction& inst) {
+      triton::utils::PerfScope perfSemantics(triton::utils::PERF_SEMANTICS);
+      triton::uint64 start = triton::utils::getMonotonicTime();
       bool ret = false;
 
       if (this->architecture->getArchitecture() == triton::arch::ARCH_INVALID)
         throw triton::exceptions::IrBuilder("IrBuilder::buildSemantics(): You must define an architecture.");
 
       /* Stage 1 - Update the context memory */
-      std::list<triton::arch::MemoryAccess>::iterator it1;
+      std::vector<triton::arch::MemoryAccess>::iterator it1;
       for (it1 = inst.memoryAccess.begin(); it1 != inst.memoryAccess.end(); it1++) {
         this->architecture->setConcreteMemoryValue(*it1);
       }
 
       /* Stage 2 - Update the context register */
-      std::map<triton::uint32, triton::arch::Register>::iterator it2;
+      std::vector<triton::arch::Register>::iterator it2;
       for (it2 = inst.registerState.begin(); it2 != inst.registerState.end(); it2++) {
-        this->architecture->setConcreteRegisterValue(it2->second);
+        this->symbolicEngine->materializeLazyFlag(*it2);
+        this->architecture->setConcreteRegisterValue(*it2);
+      }
+
+      /* Taint only - Spread the taint of a summarized instruction without building its semantics */
+      if (!this->symbolicEngine->isEnabled() && this->modes->isModeEnabled(triton::modes::TAINT_SUMMARIES)) {
+        if (this->buildTaintSemantics(inst)) {
+          this->instructions++;
+          this->summarizedInstructions++;
+          this->semanticsTime += triton::utils::getMonotonicTime() - start;
+          return true;
+        }
+      }
+
+      /* Loops - Build all the iterations of a repeated instruction at once (the memory array only sees the stores) */
+      if (this->modes->isModeEnabled(triton::modes::LOOP_SUMMARIES) && !this->modes->isModeEnabled(triton::modes::MEMORY_ARRAY)) {
+        if (this->buildLoopSemantics(inst)) {
+          this->instructions++;
+          this->summarizedLoops++;
+          this->semanticsTime += triton::utils::getMonotonicTime() - start;
+          return true;
+        }
+      }
+
+      /* Native - Execute natively an instruction whose operands are concrete (the memory array only sees the stores) */
+      if (this->modes->isModeEnabled(triton::modes::NATIVE_SEMANTICS) && !this->modes->isModeEnabled(triton::modes::MEMORY_ARRAY)) {
+        if (this->buildNativeSemantics(inst)) {
+          this->instructions++;
+          this->nativeInstructions++;
+          this->semanticsTime += triton::utils::getMonotonicTime() - start;
+          return true;
+        }
       }
 
+      /* The profile covers the ASTs of memory operands and the semantics */
+      bool profiling            = this->modes->isModeEnabled(triton::modes::OPCODE_PROFILING);
+      bool exprProfiling        = this->modes->isModeEnabled(triton::modes::EXPRESSION_PROFILING);
+      triton::uint64 cycles     = (profiling ? triton::utils::getCycles() : 0);
+      triton::usize allocations = ((profiling || exprProfiling) ? this->astGarbageCollector->getAstNodeAllocator()->getAllocations() : 0);
+
+      /*
+       * Outside the symbolic regions, the registers and the memory are read as constants, LEAs included.
+       * With NATIVE_SEMANTICS, so are they while no expression can be symbolized.
+       */
+      bool concrete = !this->symbolicEngine->isSymbolicRegion(inst.getAddress());
+      if (this->modes->isModeEnabled(triton::modes::NATIVE_SEMANTICS) && this->symbolicEngine->isEnabled() && !this->symbolicEngine->isSymbolized())
+        concrete = true;
+      this->symbolicEngine->setConcreteOnly(concrete);
+
       /* Stage 3 - Initialize the target address of memory operands */
       std::vector<triton::arch::OperandWrapper>::iterator it3;
       for (it3 = inst.operands.begin(); it3 != inst.operands.end(); it3++) {
@@ -97,27 +155,162 @@ namespace triton {
           ret = this->x86Isa->buildSemantics(inst);
       }
 
+      if (profiling) {
+        OpcodeProfile& profile = this->opcodeProfile[inst.getType()];
+        if (profile.calls++ == 0) {
+          std::string disassembly = inst.getDisassembly();
+          profile.mnemonic = disassembly.substr(0, disassembly.find(' '));
+        }
+        profile.cycles      += triton::utils::getCycles() - cycles;
+        profile.nodes       += this->astGarbageCollector->getAstNodeAllocator()->getAllocations() - allocations;
+        profile.expressions += inst.symbolicExpressions.size();
+      }
+
+      /* Before the post IR processing, which may remove the expressions */
+      if (exprProfiling)
+        this->symbolicEngine->profileExpressions(inst, this->astGarbageCollector->getAstNodeAllocator()->getAllocations() - allocations);
+
+      triton::uint64 end = triton::utils::getMonotonicTime();
+      this->semanticsTime += end - start;
+      this->instructions++;
+      perfSemantics.stop();
+
       /* Post IR processing */
-      this->postIrInit(inst);
+      {
+        triton::utils::PerfScope perfGc(triton::utils::PERF_GC);
+        this->postIrInit(inst);
+      }
+      triton::uint64 postEnd = triton::utils::getMonotonicTime();
+      this->postIrTime += postEnd - end;
+
+      if (triton::utils::TraceEvents::isEnabled()) {
+        triton::utils::TraceEvents::record("buildSemantics", "pipeline", start, end);
+        triton::utils::TraceEvents::record("postIrInit", "pipeline", end, postEnd);
+      }
+
+      return ret;
+    }
+
+
+    bool IrBuilder::buildTaintSemantics(triton::arch::Instruction& inst) {
+      bool ret = false;
+
+      /* Initialize the target address of memory operands without their AST */
+      for (auto it = inst.operands.begin(); it != inst.operands.end(); it++) {
+        if (it->getType() == triton::arch::OP_MEM)
+          it->getMemory().initConcreteAddress();
+      }
+
+      switch (this->architecture->getArchitecture()) {
+        case triton::arch::ARCH_X86:
+        case triton::arch::ARCH_X86_64:
+          ret = this->x86Isa->buildTaintSemantics(inst);
+      }
+
+      /* Otherwise, the semantics are built as usual */
+      if (ret) {
+        inst.symbolicExpressions.clear();
+        inst.memoryAccess.clear();
+        inst.registerState.clear();
+      }
+
+      return ret;
+    }
+
+
+    bool IrBuilder::buildLoopSemantics(triton::arch::Instruction& inst) {
+      bool ret = false;
+
+      inst.symbolicExpressions.clear();
+
+      switch (this->architecture->getArchitecture()) {
+        case triton::arch::ARCH_X86:
+        case triton::arch::ARCH_X86_64:
+          ret = this->x86Isa->buildLoopSemantics(inst);
+      }
+
+      /* Otherwise, the semantics are built as usual. The expressions of the symbolized indexes are kept */
+      if (ret) {
+        inst.memoryAccess.clear();
+        inst.registerState.clear();
+      }
+
+      return ret;
+    }
+
+
+    bool IrBuilder::buildInductionLoopSemantics(const std::vector<triton::arch::Instruction>& body) {
+      triton::usize iterations = 0;
+      bool ret                 = false;
+
+      switch (this->architecture->getArchitecture()) {
+        case triton::arch::ARCH_X86:
+        case triton::arch::ARCH_X86_64:
+          ret = this->x86Isa->buildInductionLoopSemantics(body, iterations);
+      }
+
+      if (iterations != 0)
+        this->summarizedLoops++;
+
+      return ret;
+    }
+
+
+    bool IrBuilder::buildNativeSemantics(triton::arch::Instruction& inst) {
+      bool ret = false;
+
+      /* A branch records a path constraint, concrete or not, unless only the symbolized ones are tracked */
+      if (inst.isControlFlow() && this->symbolicEngine->isEnabled() && !this->modes->isModeEnabled(triton::modes::PC_TRACKING_SYMBOLIC))
+        return false;
+
+      /* Initialize the target address of memory operands without their AST */
+      for (auto it = inst.operands.begin(); it != inst.operands.end(); it++) {
+        if (it->getType() == triton::arch::OP_MEM)
+          it->getMemory().initConcreteAddress();
+      }
+
+      switch (this->architecture->getArchitecture()) {
+        case triton::arch::ARCH_X86:
+        case triton::arch::ARCH_X86_64:
+          ret = this->x86Isa->buildNativeSemantics(inst);
+      }
+
+      /* Otherwise, the semantics are built as usual */
+      if (ret) {
+        inst.symbolicExpressions.clear();
+        inst.memoryAccess.clear();
+        inst.registerState.clear();
+      }
 
       return ret;
     }
 
 
     void IrBuilder::preIrInit(triton::arch::Instruction& inst) {
+      /* The expressions built since the previous instruction do not belong to an instruction */
+      if (this->symbolicEngine->getDependencySink() != nullptr)
+        this->symbolicEngine->writeDependencies(0);
+
       /* Clear previous expressions if exist */
       inst.symbolicExpressions.clear();
 
-      /* Backup the symbolic engine in the case where only the taint is available. */
+      /*
+       * In the case where only the taint is available, journal what the
+       * instruction changes instead of copying the whole symbolic state.
+       */
       if (!this->symbolicEngine->isEnabled()) {
-        *this->backupSymbolicEngine = *this->symbolicEngine;
-        *this->backupAstGarbageCollector = *this->astGarbageCollector;
+        this->symbolicEngine->startJournal();
+        this->astGarbageCollector->startJournal();
       }
+
+      /* Otherwise, the temporary nodes of the instruction are freed by postIrInit() */
+      else
+        this->astGarbageCollector->startNursery();
     }
 
 
     void IrBuilder::postIrInit(triton::arch::Instruction& inst) {
-      std::set<triton::ast::AbstractNode*> uniqueNodes;
+      std::vector<triton::ast::AbstractNode*> roots;
       std::vector<triton::engines::symbolic::SymbolicExpression*> newVector;
 
       /* Clear unused data */
@@ -133,8 +326,23 @@ namespace triton {
        * is enable we must compute semanitcs to spread the taint.
        */
       if (!this->symbolicEngine->isEnabled()) {
-        this->removeSymbolicExpressions(inst, uniqueNodes);
-        *this->symbolicEngine = *this->backupSymbolicEngine;
+        this->removeSymbolicExpressions(inst, roots);
+        this->symbolicEngine->rollbackJournal();
+      }
+
+      /*
+       * Outside the symbolic regions, the expressions only computed the
+       * concrete state. They are removed and their destinations concretized.
+       */
+      if (this->symbolicEngine->isConcreteOnly()) {
+        for (auto it = inst.symbolicExpressions.begin(); it != inst.symbolicExpressions.end(); it++) {
+          if ((*it)->isRegister() || (*it)->isMemory())
+            this->pinAstRoot(roots, (*it)->getAst());
+        }
+        this->symbolicEngine->removeConcreteExpressions(inst.symbolicExpressions);
+        this->symbolicEngine->setConcreteOnly(false);
+        inst.symbolicExpressions.clear();
+        this->concreteInstructions++;
       }
 
       /*
@@ -143,7 +351,7 @@ namespace triton {
        * expressions untainted and their AST nodes.
        */
       if (this->modes->isModeEnabled(triton::modes::ONLY_ON_TAINTED) && !inst.isTainted()) {
-        this->removeSymbolicExpressions(inst, uniqueNodes);
+        this->removeSymbolicExpressions(inst, roots);
       }
 
       /*
@@ -154,7 +362,7 @@ namespace triton {
       if (this->modes->isModeEnabled(triton::modes::ONLY_ON_SYMBOLIZED)) {
         for (auto it = inst.symbolicExpressions.begin(); it != inst.symbolicExpressions.end(); it++) {
           if ((*it)->getAst()->isSymbolized() == false) {
-            this->astGarbageCollector->extractUniqueAstNodes(uniqueNodes, (*it)->getAst());
+            this->pinAstRoot(roots, (*it)->getAst());
             this->symbolicEngine->removeSymbolicExpression((*it)->getId());
           }
           else
@@ -171,42 +379,192 @@ namespace triton {
         /* Memory operands */
         for (auto it = inst.operands.begin(); it!= inst.operands.end(); it++) {
           if (it->getType() == triton::arch::OP_MEM) {
-            this->astGarbageCollector->extractUniqueAstNodes(uniqueNodes, it->getMemory().getLeaAst());
+            this->pinAstRoot(roots, it->getMemory().getLeaAst());
           }
         }
 
         /* Implicit and explicit semantics - MEM */
-        const auto& loadAccess     = inst.getLoadAccess();
-        const auto& readRegisters  = inst.getReadRegisters();
+        const auto& loadAccess     = inst.getLoadAccessHandles();
+        const auto& readRegisters  = inst.getReadRegisterHandles();
         const auto& readImmediates = inst.getReadImmediates();
 
         for (auto it = loadAccess.begin(); it != loadAccess.end(); it++)
-          this->astGarbageCollector->extractUniqueAstNodes(uniqueNodes, std::get<1>(*it));
+          this->pinAstRoot(roots, std::get<1>(*it));
 
         /* Implicit and explicit semantics - REG */
         for (auto it = readRegisters.begin(); it != readRegisters.end(); it++)
-          this->astGarbageCollector->extractUniqueAstNodes(uniqueNodes, std::get<1>(*it));
+          this->pinAstRoot(roots, std::get<1>(*it));
 
         /* Implicit and explicit semantics - IMM */
         for (auto it = readImmediates.begin(); it != readImmediates.end(); it++)
-          this->astGarbageCollector->extractUniqueAstNodes(uniqueNodes, std::get<1>(*it));
+          this->pinAstRoot(roots, std::get<1>(*it));
       }
 
-      /* Free collected nodes */
-      this->astGarbageCollector->freeAstNodes(uniqueNodes);
+      /*
+       * Report the expressions which exceed the expression limits and,
+       * if asked, concretize their destination before they spread.
+       */
+      if (this->symbolicEngine->isExpressionLimitSet())
+        this->symbolicEngine->checkExpressionLimits(inst.symbolicExpressions);
+
+      /*
+       * Stream the expressions of the instruction to the dependency sink
+       * before the collections below may remove them.
+       */
+      if (this->symbolicEngine->getDependencySink() != nullptr)
+        this->symbolicEngine->writeDependencies(inst.getAddress());
+
+      /*
+       * If the symbolic engine only keeps live expressions, collect the
+       * unreachable ones once there are enough expressions.
+       */
+      if (this->symbolicEngine->isCollectionNeeded())
+        this->symbolicEngine->collectUnreachableExpressions(inst.symbolicExpressions, roots);
+
+      /*
+       * With an instruction window, concretize the references which leave
+       * it and collect their expressions once per window.
+       */
+      if (this->symbolicEngine->slideInstructionWindow())
+        this->symbolicEngine->collectUnreachableExpressions(inst.symbolicExpressions, roots);
+
+      /*
+       * Under memory pressure, concretize the oldest symbolic references
+       * so their expressions become unreachable and are collected.
+       */
+      bool relieved = this->symbolicEngine->isNodeBudgetExceeded(this->astGarbageCollector->getAllocatedAstNodes().size());
+      if (relieved) {
+        this->symbolicEngine->concretizeOldestReferences();
+        this->symbolicEngine->collectUnreachableExpressions(inst.symbolicExpressions, roots);
+      }
+
+      /*
+       * Release pinned roots. A node is only freed when its last holder
+       * (parent, symbolic expression, aligned memory) is gone, so nodes
+       * still used by other expressions survive.
+       */
+      for (auto it = roots.begin(); it != roots.end(); it++)
+        this->astGarbageCollector->releaseAstNode(*it);
+
+      /*
+       * The nodes built by the instruction which are neither held by a
+       * reference nor by the instruction itself are temporaries.
+       */
+      if (this->symbolicEngine->isEnabled()) {
+        std::vector<triton::ast::AbstractNode*> survivors;
+        this->getInstructionAsts(inst, survivors);
+        this->collectedNodes += this->astGarbageCollector->collectNursery(survivors);
+      }
+
+      if (relieved)
+        this->symbolicEngine->updateNodeBudgetThreshold(this->astGarbageCollector->getAllocatedAstNodes().size());
 
       if (!this->symbolicEngine->isEnabled())
-        *this->astGarbageCollector = *this->backupAstGarbageCollector;
+        this->astGarbageCollector->rollbackJournal();
+    }
+
+
+    void IrBuilder::getInstructionAsts(const triton::arch::Instruction& inst, std::vector<triton::ast::AbstractNode*>& asts) const {
+      for (auto it = inst.operands.begin(); it != inst.operands.end(); it++) {
+        if (it->getType() == triton::arch::OP_MEM)
+          asts.push_back(it->getConstMemory().getLeaAst());
+      }
+
+      for (auto it = inst.getLoadAccessHandles().begin(); it != inst.getLoadAccessHandles().end(); it++)
+        asts.push_back(std::get<1>(*it));
+
+      for (auto it = inst.getStoreAccessHandles().begin(); it != inst.getStoreAccessHandles().end(); it++)
+        asts.push_back(std::get<1>(*it));
+
+      for (auto it = inst.getReadRegisterHandles().begin(); it != inst.getReadRegisterHandles().end(); it++)
+        asts.push_back(std::get<1>(*it));
+
+      for (auto it = inst.getWrittenRegisterHandles().begin(); it != inst.getWrittenRegisterHandles().end(); it++)
+        asts.push_back(std::get<1>(*it));
+
+      for (auto it = inst.getReadImmediates().begin(); it != inst.getReadImmediates().end(); it++)
+        asts.push_back(std::get<1>(*it));
+    }
+
+
+    void IrBuilder::pinAstRoot(std::vector<triton::ast::AbstractNode*>& roots, triton::ast::AbstractNode* node) {
+      if (node == nullptr)
+        return;
+      node->incReference();
+      roots.push_back(node);
     }
 
 
-    void IrBuilder::removeSymbolicExpressions(triton::arch::Instruction& inst, std::set<triton::ast::AbstractNode*>& uniqueNodes) {
+    void IrBuilder::removeSymbolicExpressions(triton::arch::Instruction& inst, std::vector<triton::ast::AbstractNode*>& roots) {
       for (auto it = inst.symbolicExpressions.begin(); it != inst.symbolicExpressions.end(); it++) {
-        this->astGarbageCollector->extractUniqueAstNodes(uniqueNodes, (*it)->getAst());
+        this->pinAstRoot(roots, (*it)->getAst());
         this->symbolicEngine->removeSymbolicExpression((*it)->getId());
       }
       inst.symbolicExpressions.clear();
     }
 
+
+    std::map<std::string, triton::usize> IrBuilder::getStatistics(void) const {
+      std::map<std::string, triton::usize> stats;
+
+      stats["instructions"] = this->instructions;
+      stats["summarized"]   = this->summarizedInstructions;
+      stats["loops"]        = this->summarizedLoops;
+      stats["concrete"]     = this->concreteInstructions;
+      stats["native"]       = this->nativeInstructions;
+      stats["time"]         = this->semanticsTime;
+      stats["postIrTime"]   = this->postIrTime;
+      stats["collected"]    = this->collectedNodes;
+
+      return stats;
+    }
+
+
+    const std::map<triton::uint32, OpcodeProfile>& IrBuilder::getOpcodeProfile(void) const {
+      return this->opcodeProfile;
+    }
+
+
+    void IrBuilder::clearOpcodeProfile(void) {
+      this->opcodeProfile.clear();
+    }
+
+
+    void IrBuilder::dumpOpcodeProfile(std::ostream& stream, bool json) const {
+      std::vector<std::pair<triton::uint32, const OpcodeProfile*>> sorted;
+
+      for (auto it = this->opcodeProfile.begin(); it != this->opcodeProfile.end(); it++)
+        sorted.push_back(std::make_pair(it->first, &it->second));
+
+      std::stable_sort(sorted.begin(), sorted.end(), [](const std::pair<triton::uint32, const OpcodeProfile*>& a, const std::pair<triton::uint32, const OpcodeProfile*>& b) {
+        return a.second->cycles > b.second->cycles;
+      });
+
+      if (json)
+        stream << "[";
+      else
+        stream << "opcode,mnemonic,calls,cycles,nodes,expressions" << std::endl;
+
+      for (auto it = sorted.begin(); it != sorted.end(); it++) {
+        const OpcodeProfile& profile = *it->second;
+        if (json) {
+          stream << (it == sorted.begin() ? "" : ",") << std::endl;
+          stream << "  {\"opcode\": "        << it->first
+                 << ", \"mnemonic\": \""    << profile.mnemonic
+                 << "\", \"calls\": "       << profile.calls
+                 << ", \"cycles\": "        << profile.cycles
+                 << ", \"nodes\": "         << profile.nodes
+                 << ", \"expressions\": "   << profile.expressions << "}";
+        }
+        else {
+          stream << it->first << "," << profile.mnemonic << "," << profile.calls << "," << profile.cycles << ","
+                 << profile.nodes << "," << profile.expressions << std::endl;
+        }
+      }
+
+      if (json)
+        stream << std::endl << "]" << std::endl;
+    }
+
   }; /* arch namespace */
 }; /* triton namespace */
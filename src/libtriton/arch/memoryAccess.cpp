@@ -5,6 +5,8 @@
 **  This program is under the terms of the BSD License.
 */
 
+#include <utility>
+
 #include <api.hpp>
 #include <cpuSize.hpp>
 #include <exceptions.hpp>
@@ -55,6 +57,11 @@ namespace triton {
     }
 
 
+    MemoryAccess::MemoryAccess(MemoryAccess&& other) : BitsVector(other) {
+      this->move(other);
+    }
+
+
     MemoryAccess::~MemoryAccess() {
     }
 
@@ -81,7 +88,7 @@ namespace triton {
 
     triton::uint64 MemoryAccess::getSegmentValue(void) {
       if (this->segmentReg.isValid())
-        return triton::api.getConcreteRegisterValue(this->segmentReg).convert_to<triton::uint64>();
+        return triton::getCurrentApi().getConcreteRegisterValue(this->segmentReg).convert_to<triton::uint64>();
       return 0;
     }
 
@@ -98,7 +105,7 @@ namespace triton {
 
     triton::uint64 MemoryAccess::getAccessMask(void) {
       triton::uint64 mask = -1;
-      return (mask >> (QWORD_SIZE_BIT - triton::api.cpuRegisterBitSize()));
+      return (mask >> (QWORD_SIZE_BIT - triton::getCurrentApi().cpuRegisterBitSize()));
     }
 
 
@@ -112,13 +119,34 @@ namespace triton {
       else if (this->displacement.getBitSize())
         return this->displacement.getBitSize();
 
-      return triton::api.cpuRegisterBitSize();
+      return triton::getCurrentApi().cpuRegisterBitSize();
+    }
+
+
+    bool MemoryAccess::isLeaSymbolized(void) {
+      triton::engines::symbolic::SymbolicEngine* symbolic = triton::getCurrentApi().getSymbolicEngine();
+
+      /* Outside the symbolic regions, the registers are read as constants */
+      if (symbolic == nullptr || symbolic->isConcreteOnly())
+        return false;
+
+      if (this->baseReg.isValid() && !this->pcRelative && symbolic->isRegisterSymbolized(this->baseReg))
+        return true;
+
+      return this->indexReg.isValid() && symbolic->isRegisterSymbolized(this->indexReg);
     }
 
 
-    void MemoryAccess::initAddress(bool force) {
+    void MemoryAccess::initAddress(bool force, bool lea) {
       /* Otherwise, try to compute the address */
-      if (triton::api.isArchitectureValid() && this->getBitSize() >= BYTE_SIZE_BIT) {
+      if (triton::getCurrentApi().isArchitectureValid() && this->getBitSize() >= BYTE_SIZE_BIT) {
+        /* The LEA AST is only needed if the address depends on a symbolic variable */
+        if (!lea && !triton::getCurrentApi().isModeEnabled(triton::modes::LEA_ASTS) && !this->isLeaSymbolized()) {
+          this->ast = nullptr;
+          this->initConcreteAddress(force);
+          return;
+        }
+
         triton::arch::Register& base  = this->baseReg;
         triton::arch::Register& index = this->indexReg;
         triton::uint64 segmentValue   = this->getSegmentValue();
@@ -128,10 +156,10 @@ namespace triton {
 
         /* Initialize the AST of the memory access (LEA) */
         this->ast = triton::ast::bvadd(
-                      (this->pcRelative ? triton::ast::bv(this->pcRelative, bitSize) : (base.isValid() ? triton::api.buildSymbolicRegister(base) : triton::ast::bv(0, bitSize))),
+                      (this->pcRelative ? triton::ast::bv(this->pcRelative, bitSize) : (base.isValid() ? triton::getCurrentApi().buildSymbolicRegister(base) : triton::ast::bv(0, bitSize))),
                       triton::ast::bvadd(
                         triton::ast::bvmul(
-                          (index.isValid() ? triton::api.buildSymbolicRegister(index) : triton::ast::bv(0, bitSize)),
+                          (index.isValid() ? triton::getCurrentApi().buildSymbolicRegister(index) : triton::ast::bv(0, bitSize)),
                           triton::ast::bv(scaleValue, bitSize)
                         ),
                         triton::ast::bv(dispValue, bitSize)
@@ -153,6 +181,47 @@ namespace triton {
     }
 
 
+    void MemoryAccess::initConcreteAddress(bool force) {
+      /* The address is computed as initAddress() does, on the concrete values */
+      if (triton::getCurrentApi().isArchitectureValid() && this->getBitSize() >= BYTE_SIZE_BIT && (!this->address || force)) {
+        triton::arch::Register& base  = this->baseReg;
+        triton::arch::Register& index = this->indexReg;
+        triton::uint64 segmentValue   = this->getSegmentValue();
+        triton::uint64 scaleValue     = this->getScaleValue();
+        triton::uint64 dispValue      = this->getDisplacementValue();
+        triton::uint32 bitSize        = this->getAccessSize();
+        triton::uint64 mask           = (bitSize >= QWORD_SIZE_BIT) ? static_cast<triton::uint64>(-1) : ((static_cast<triton::uint64>(1) << bitSize) - 1);
+        triton::uint64 baseValue      = 0;
+        triton::uint64 indexValue     = 0;
+        triton::uint64 addr           = 0;
+
+        if (this->pcRelative)
+          baseValue = this->pcRelative;
+        else if (base.isValid())
+          baseValue = triton::getCurrentApi().getConcreteRegisterValue(base).convert_to<triton::uint64>();
+
+        if (index.isValid())
+          indexValue = triton::getCurrentApi().getConcreteRegisterValue(index).convert_to<triton::uint64>();
+
+        addr = (baseValue + (indexValue * scaleValue) + dispValue) & mask;
+
+        /* Use segments as base address instead of selector into the GDT. */
+        if (segmentValue) {
+          triton::uint32 segmentSize = this->segmentReg.getBitSize();
+          triton::uint64 segmentMask = (segmentSize >= QWORD_SIZE_BIT) ? static_cast<triton::uint64>(-1) : ((static_cast<triton::uint64>(1) << segmentSize) - 1);
+
+          /* Sign-extends the offset to the size of the segment */
+          if (bitSize < QWORD_SIZE_BIT && ((addr >> (bitSize - 1)) & 1))
+            addr |= ~mask;
+
+          addr = (segmentValue + addr) & segmentMask;
+        }
+
+        this->address = addr;
+      }
+    }
+
+
     triton::uint32 MemoryAccess::getBitSize(void) const {
       return this->getVectorSize();
     }
@@ -297,6 +366,12 @@ namespace triton {
     }
 
 
+    void MemoryAccess::operator=(MemoryAccess&& other) {
+      BitsVector::operator=(other);
+      this->move(other);
+    }
+
+
     void MemoryAccess::copy(const MemoryAccess& other) {
       this->address              = other.address;
       this->ast                  = other.ast;
@@ -311,6 +386,20 @@ namespace triton {
     }
 
 
+    void MemoryAccess::move(MemoryAccess& other) {
+      this->address              = other.address;
+      this->ast                  = other.ast;
+      this->baseReg              = std::move(other.baseReg);
+      this->concreteValue        = other.concreteValue;
+      this->concreteValueDefined = other.concreteValueDefined;
+      this->displacement         = other.displacement;
+      this->indexReg             = std::move(other.indexReg);
+      this->pcRelative           = other.pcRelative;
+      this->scale                = other.scale;
+      this->segmentReg           = std::move(other.segmentReg);
+    }
+
+
     std::ostream& operator<<(std::ostream& stream, const MemoryAccess& mem) {
       stream << "[@0x"
              << std::hex << mem.getAddress()
@@ -0,0 +1,98 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#include <operandHandles.hpp>
+
+
+
+namespace triton {
+  namespace arch {
+
+    RegisterHandle::RegisterHandle() {
+      this->high   = 0;
+      this->id     = triton::arch::INVALID_REGISTER_ID;
+      this->low    = 0;
+      this->parent = triton::arch::INVALID_REGISTER_ID;
+    }
+
+
+    RegisterHandle::RegisterHandle(const triton::arch::Register& reg) {
+      this->high   = static_cast<triton::uint16>(reg.getHigh());
+      this->id     = reg.getId();
+      this->low    = static_cast<triton::uint16>(reg.getLow());
+      this->parent = reg.getParentId();
+    }
+
+
+    triton::uint32 RegisterHandle::getBitSize(void) const {
+      return (this->high - this->low) + 1;
+    }
+
+
+    bool RegisterHandle::isOverlapWith(const RegisterHandle& other) const {
+      if (this->parent == other.parent) {
+        if (this->low <= other.low && other.low <= this->high) return true;
+        if (other.low <= this->low && this->low <= other.high) return true;
+      }
+      return false;
+    }
+
+
+    triton::arch::Register RegisterHandle::getRegister(void) const {
+      return triton::arch::Register(this->id);
+    }
+
+
+    bool operator==(const RegisterHandle& reg1, const RegisterHandle& reg2) {
+      return (reg1.id == reg2.id);
+    }
+
+
+    bool operator<(const RegisterHandle& reg1, const RegisterHandle& reg2) {
+      return (reg1.id < reg2.id);
+    }
+
+
+    MemoryHandle::MemoryHandle() {
+      this->address = 0;
+      this->size    = 0;
+    }
+
+
+    MemoryHandle::MemoryHandle(const triton::arch::MemoryAccess& mem) {
+      this->address = mem.getAddress();
+      this->size    = mem.getSize();
+    }
+
+
+    bool MemoryHandle::isOverlapWith(const MemoryHandle& other) const {
+      if (this->address <= other.address && other.address < (this->address + this->size)) return true;
+      if (other.address <= this->address && this->address < (other.address + other.size)) return true;
+      return false;
+    }
+
+
+    triton::arch::MemoryAccess MemoryHandle::getMemoryAccess(void) const {
+      if (this->size == 0)
+        return triton::arch::MemoryAccess();
+      return triton::arch::MemoryAccess(this->address, this->size);
+    }
+
+
+    bool operator==(const MemoryHandle& mem1, const MemoryHandle& mem2) {
+      return (mem1.address == mem2.address && mem1.size == mem2.size);
+    }
+
+
+    bool operator<(const MemoryHandle& mem1, const MemoryHandle& mem2) {
+      if (mem1.address != mem2.address)
+        return (mem1.address < mem2.address);
+      return (mem1.size < mem2.size);
+    }
+
+  }; /* arch namespace */
+}; /* triton namespace */
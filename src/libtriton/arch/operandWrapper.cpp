@@ -5,6 +5,8 @@
 **  This program is under the terms of the BSD License.
 */
 
+#include <utility>
+
 #include <exceptions.hpp>
 #include <operandWrapper.hpp>
 
@@ -31,6 +33,18 @@ namespace triton {
     }
 
 
+    OperandWrapper::OperandWrapper(triton::arch::MemoryAccess&& mem) {
+      this->mem = std::move(mem);
+      this->type = triton::arch::OP_MEM;
+    }
+
+
+    OperandWrapper::OperandWrapper(triton::arch::Register&& reg) {
+      this->reg = std::move(reg);
+      this->type = triton::arch::OP_REG;
+    }
+
+
     OperandWrapper::~OperandWrapper() {
     }
 
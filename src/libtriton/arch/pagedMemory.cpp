@@ -0,0 +1,456 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#include <algorithm>
+#include <cstring>
+
+#include <coreUtils.hpp>
+#include <exceptions.hpp>
+#include <hugePageArena.hpp>
+#include <pagedMemory.hpp>
+
+
+
+namespace triton {
+  namespace arch {
+
+    /* Returns the number of bits set in a word */
+    static triton::uint32 countBits(triton::uint64 word) {
+      word = word - ((word >> 1) & 0x5555555555555555ULL);
+      word = (word & 0x3333333333333333ULL) + ((word >> 2) & 0x3333333333333333ULL);
+      word = (word + (word >> 4)) & 0x0f0f0f0f0f0f0f0fULL;
+      return static_cast<triton::uint32>((word * 0x0101010101010101ULL) >> 56);
+    }
+
+
+    /* Returns the mask of `count` bits starting at `bit` */
+    static triton::uint64 bitMask(triton::uint32 bit, triton::uint32 count) {
+      if (count >= 64)
+        return ~0ULL;
+      return ((1ULL << count) - 1) << bit;
+    }
+
+
+    /* Returns the number of padding bytes which align `offset` on `alignment` */
+    static triton::usize padding(triton::uint64 offset, triton::uint64 alignment) {
+      return static_cast<triton::usize>((alignment - (offset % alignment)) % alignment);
+    }
+
+
+    PagedMemory::PagedMemory() {
+      this->cachedNumber   = 0;
+      this->cachedPage     = nullptr;
+      this->cachedWritable = false;
+    }
+
+
+    PagedMemory::PagedMemory(const PagedMemory& other) {
+      this->backings       = other.backings;
+      this->faultedPages   = other.faultedPages;
+      this->lazyAreas      = other.lazyAreas;
+      this->missedPages    = other.missedPages;
+      this->pages          = other.pages;
+      this->cachedNumber   = 0;
+      this->cachedPage     = nullptr;
+      this->cachedWritable = false;
+      /* Pages of the other memory are shared now */
+      other.cachedWritable = false;
+    }
+
+
+    void PagedMemory::operator=(const PagedMemory& other) {
+      this->backings       = other.backings;
+      this->faultedPages   = other.faultedPages;
+      this->lazyAreas      = other.lazyAreas;
+      this->missedPages    = other.missedPages;
+      this->pages          = other.pages;
+      this->cachedNumber   = 0;
+      this->cachedPage     = nullptr;
+      this->cachedWritable = false;
+      /* Pages of the other memory are shared now */
+      other.cachedWritable = false;
+    }
+
+
+    void PagedMemory::mapBytes(Page* page, triton::uint32 offset, triton::uint32 length) {
+      while (length) {
+        triton::uint32 shift = (offset & 63);
+        triton::uint32 n     = std::min<triton::uint32>(64 - shift, length);
+        triton::uint64 mask  = bitMask(shift, n);
+        triton::uint64& word = page->mapped[offset >> 6];
+        page->count += countBits(mask & ~word);
+        word   |= mask;
+        offset += n;
+        length -= n;
+      }
+    }
+
+
+    PagedMemory::Page* PagedMemory::faultPage(triton::uint64 number) const {
+      Page* page = nullptr;
+
+      if (this->lazyAreas.empty() || this->faultedPages.find(number) != this->faultedPages.end())
+        return nullptr;
+
+      triton::uint64 first = (number << PagedMemory::pageBits);
+      triton::uint64 last  = first + (PagedMemory::pageSize - 1);
+
+      /* The areas do not overlap, so the ones covering the page are the last ones starting before its end */
+      auto it = this->lazyAreas.upper_bound(last);
+      while (it != this->lazyAreas.begin()) {
+        it--;
+
+        triton::uint64 areaLast = it->first + (it->second.size - 1);
+        if (areaLast < first)
+          break;
+
+        if (page == nullptr) {
+          std::shared_ptr<Page> created = std::allocate_shared<Page>(triton::utils::HugePageAllocator<Page>());
+          page = created.get();
+          this->pages[number] = created;
+        }
+
+        triton::uint64 low  = std::max(first, it->first);
+        triton::uint64 high = std::min(last, areaLast);
+        triton::uint32 offset = static_cast<triton::uint32>(low - first);
+        triton::uint32 length = static_cast<triton::uint32>(high - low + 1);
+        std::memcpy(page->bytes + offset, it->second.data + (low - it->first), length);
+        PagedMemory::mapBytes(page, offset, length);
+      }
+
+      if (page != nullptr)
+        this->faultedPages.insert(number);
+
+      return page;
+    }
+
+
+    const PagedMemory::Page* PagedMemory::findPage(triton::uint64 addr) const {
+      triton::uint64 number = (addr >> PagedMemory::pageBits);
+
+      if (this->cachedPage != nullptr && this->cachedNumber == number)
+        return this->cachedPage;
+
+      auto it = this->pages.find(number);
+      if (it == this->pages.end()) {
+        Page* page = this->faultPage(number);
+        if (page == nullptr)
+          return nullptr;
+        this->cachedNumber   = number;
+        this->cachedPage     = page;
+        this->cachedWritable = true;
+        return page;
+      }
+
+      /* Pages are owned by the map, the pointer stays valid until the page is erased or duplicated */
+      this->cachedNumber   = number;
+      this->cachedPage     = it->second.get();
+      this->cachedWritable = it->second.unique();
+
+      return this->cachedPage;
+    }
+
+
+    PagedMemory::Page* PagedMemory::findWritablePage(triton::uint64 addr, bool create) {
+      triton::uint64 number = (addr >> PagedMemory::pageBits);
+
+      if (this->cachedPage != nullptr && this->cachedNumber == number && this->cachedWritable)
+        return this->cachedPage;
+
+      auto it = this->pages.find(number);
+      if (it == this->pages.end()) {
+        Page* page = this->faultPage(number);
+        if (page != nullptr) {
+          this->cachedNumber   = number;
+          this->cachedPage     = page;
+          this->cachedWritable = true;
+          return page;
+        }
+        if (!create)
+          return nullptr;
+        /* Value-initialized, every byte is zero and unmapped */
+        it = this->pages.insert(std::make_pair(number, std::allocate_shared<Page>(triton::utils::HugePageAllocator<Page>()))).first;
+      }
+
+      /* Copy-on-write, the shared page stays with the other memories (or in the mapped file) */
+      else if (!it->second.unique())
+        it->second = std::allocate_shared<Page>(triton::utils::HugePageAllocator<Page>(), *it->second);
+
+      this->cachedNumber   = number;
+      this->cachedPage     = it->second.get();
+      this->cachedWritable = true;
+
+      return this->cachedPage;
+    }
+
+
+    triton::uint8 PagedMemory::read(triton::uint64 addr) const {
+      const Page* page = this->findPage(addr);
+
+      if (page == nullptr)
+        return 0x00;
+
+      return page->bytes[addr & (PagedMemory::pageSize - 1)];
+    }
+
+
+    void PagedMemory::read(triton::uint64 baseAddr, triton::uint8* area, triton::usize size) const {
+      while (size) {
+        triton::uint32 offset = static_cast<triton::uint32>(baseAddr & (PagedMemory::pageSize - 1));
+        triton::usize length  = std::min<triton::usize>(PagedMemory::pageSize - offset, size);
+        const Page* page      = this->findPage(baseAddr);
+
+        /* Unmapped bytes are always zero inside a page */
+        if (page != nullptr)
+          std::memcpy(area, page->bytes + offset, length);
+        else
+          std::memset(area, 0x00, length);
+
+        area     += length;
+        baseAddr += length;
+        size     -= length;
+      }
+    }
+
+
+    void PagedMemory::write(triton::uint64 addr, triton::uint8 value) {
+      this->write(addr, &value, 1);
+    }
+
+
+    void PagedMemory::write(triton::uint64 baseAddr, const triton::uint8* area, triton::usize size) {
+      while (size) {
+        triton::uint32 offset = static_cast<triton::uint32>(baseAddr & (PagedMemory::pageSize - 1));
+        triton::usize length  = std::min<triton::usize>(PagedMemory::pageSize - offset, size);
+        Page* page            = this->findWritablePage(baseAddr, true);
+
+        std::memcpy(page->bytes + offset, area, length);
+
+        /* Map the bytes written */
+        PagedMemory::mapBytes(page, offset, static_cast<triton::uint32>(length));
+
+        area     += length;
+        baseAddr += length;
+        size     -= length;
+      }
+    }
+
+
+    bool PagedMemory::isMapped(triton::uint64 baseAddr, triton::usize size) const {
+      while (size) {
+        triton::uint32 offset = static_cast<triton::uint32>(baseAddr & (PagedMemory::pageSize - 1));
+        triton::usize length  = std::min<triton::usize>(PagedMemory::pageSize - offset, size);
+        const Page* page      = this->findPage(baseAddr);
+
+        if (page == nullptr)
+          return false;
+
+        triton::uint32 bit  = offset;
+        triton::uint32 left = static_cast<triton::uint32>(length);
+        while (left) {
+          triton::uint32 shift = (bit & 63);
+          triton::uint32 n     = std::min<triton::uint32>(64 - shift, left);
+          triton::uint64 mask  = bitMask(shift, n);
+          if ((page->mapped[bit >> 6] & mask) != mask)
+            return false;
+          bit  += n;
+          left -= n;
+        }
+
+        baseAddr += length;
+        size     -= length;
+      }
+
+      return true;
+    }
+
+
+    void PagedMemory::unmap(triton::uint64 baseAddr, triton::usize size) {
+      while (size) {
+        triton::uint32 offset = static_cast<triton::uint32>(baseAddr & (PagedMemory::pageSize - 1));
+        triton::usize length  = std::min<triton::usize>(PagedMemory::pageSize - offset, size);
+        Page* page            = this->findWritablePage(baseAddr, false);
+
+        if (page != nullptr) {
+          std::memset(page->bytes + offset, 0x00, length);
+
+          triton::uint32 bit  = offset;
+          triton::uint32 left = static_cast<triton::uint32>(length);
+          while (left) {
+            triton::uint32 shift = (bit & 63);
+            triton::uint32 n     = std::min<triton::uint32>(64 - shift, left);
+            triton::uint64 mask  = bitMask(shift, n);
+            triton::uint64& word = page->mapped[bit >> 6];
+            page->count -= countBits(mask & word);
+            word &= ~mask;
+            bit  += n;
+            left -= n;
+          }
+
+          /* Release unmapped pages */
+          if (page->count == 0) {
+            this->pages.erase(baseAddr >> PagedMemory::pageBits);
+            this->cachedPage = nullptr;
+          }
+        }
+
+        baseAddr += length;
+        size     -= length;
+      }
+    }
+
+
+    void PagedMemory::clear(void) {
+      this->backings.clear();
+      this->faultedPages.clear();
+      this->lazyAreas.clear();
+      this->missedPages.clear();
+      this->pages.clear();
+      this->cachedPage = nullptr;
+    }
+
+
+    triton::usize PagedMemory::resolveMisses(triton::uint64 baseAddr, triton::usize size, const std::function<bool(triton::uint64, triton::uint8*)>& handler) const {
+      triton::usize filled = 0;
+
+      if (size == 0)
+        return 0;
+
+      triton::uint64 last = ((baseAddr + (size - 1)) >> PagedMemory::pageBits);
+      for (triton::uint64 number = (baseAddr >> PagedMemory::pageBits); number <= last; number++) {
+        if (this->findPage(number << PagedMemory::pageBits) != nullptr || !this->missedPages.insert(number).second)
+          continue;
+
+        /* Value-initialized, the handler gets a page of zeros */
+        std::shared_ptr<Page> page = std::allocate_shared<Page>(triton::utils::HugePageAllocator<Page>());
+        if (handler(number << PagedMemory::pageBits, page->bytes)) {
+          PagedMemory::mapBytes(page.get(), 0, PagedMemory::pageSize);
+          this->pages[number] = page;
+          this->cachedPage    = nullptr;
+          filled++;
+        }
+      }
+
+      return filled;
+    }
+
+
+    triton::usize PagedMemory::getNumberOfPages(void) const {
+      return this->pages.size();
+    }
+
+
+    triton::usize PagedMemory::getMemoryUsage(void) const {
+      triton::usize node = triton::utils::getTreeNodeSize(sizeof(std::pair<const triton::uint64, std::shared_ptr<Page>>));
+      return this->pages.size() * (node + sizeof(Page));
+    }
+
+
+    void PagedMemory::mapLazy(triton::uint64 baseAddr, const std::shared_ptr<triton::format::MappedFile>& file, triton::usize offset, triton::usize size) {
+      std::vector<triton::uint64> allocated;
+
+      if (offset > file->getSize() || size > file->getSize() - offset)
+        throw triton::exceptions::Architecture("PagedMemory::mapLazy(): The area is not in the file.");
+
+      if (size == 0)
+        return;
+
+      triton::uint64 first = (baseAddr >> PagedMemory::pageBits);
+      triton::uint64 last  = ((baseAddr + (size - 1)) >> PagedMemory::pageBits);
+
+      this->lazyAreas[baseAddr] = LazyArea{file, file->getData() + offset, size};
+      this->faultedPages.erase(this->faultedPages.lower_bound(first), this->faultedPages.upper_bound(last));
+
+      /* The pages already allocated are not faulted, they get the bytes of the area now */
+      for (auto it = this->pages.lower_bound(first); it != this->pages.end() && it->first <= last; it++)
+        allocated.push_back(it->first);
+
+      for (auto it = allocated.begin(); it != allocated.end(); it++) {
+        triton::uint64 low  = std::max(baseAddr, (*it << PagedMemory::pageBits));
+        triton::uint64 high = std::min(baseAddr + (size - 1), (*it << PagedMemory::pageBits) + (PagedMemory::pageSize - 1));
+        this->write(low, file->getData() + offset + (low - baseAddr), static_cast<triton::usize>(high - low + 1));
+        this->faultedPages.insert(*it);
+      }
+    }
+
+
+    void PagedMemory::save(std::ostream& stream) const {
+      static const char zeros[PagedMemory::pageAlignment] = {0};
+      triton::uint64 recordSize = sizeof(Page);
+      triton::usize stride      = sizeof(Page) + padding(sizeof(Page), PagedMemory::pageAlignment);
+
+      /* The pages of the lazy areas are written with the other ones */
+      for (auto it = this->lazyAreas.begin(); it != this->lazyAreas.end(); it++) {
+        triton::uint64 last = ((it->first + (it->second.size - 1)) >> PagedMemory::pageBits);
+        for (triton::uint64 number = (it->first >> PagedMemory::pageBits); number <= last; number++) {
+          if (this->pages.find(number) == this->pages.end())
+            this->faultPage(number);
+        }
+      }
+
+      triton::uint64 count = this->pages.size();
+      stream.write(reinterpret_cast<const char*>(&recordSize), sizeof(recordSize));
+      stream.write(reinterpret_cast<const char*>(&count), sizeof(count));
+      for (auto it = this->pages.begin(); it != this->pages.end(); it++)
+        stream.write(reinterpret_cast<const char*>(&it->first), sizeof(it->first));
+
+      stream.write(zeros, padding(static_cast<triton::uint64>(stream.tellp()), PagedMemory::pageAlignment));
+      for (auto it = this->pages.begin(); it != this->pages.end(); it++) {
+        stream.write(reinterpret_cast<const char*>(it->second.get()), sizeof(Page));
+        stream.write(zeros, stride - sizeof(Page));
+      }
+    }
+
+
+    triton::usize PagedMemory::load(const std::shared_ptr<triton::format::MappedFile>& file, triton::usize offset) {
+      const triton::uint8* data = file->getData();
+      triton::usize size        = file->getSize();
+      triton::usize stride      = sizeof(Page) + padding(sizeof(Page), PagedMemory::pageAlignment);
+      triton::uint64 recordSize = 0;
+      triton::uint64 count      = 0;
+
+      if (offset > size || size - offset < sizeof(recordSize) + sizeof(count))
+        throw triton::exceptions::Architecture("PagedMemory::load(): The pages are truncated.");
+
+      std::memcpy(&recordSize, data + offset, sizeof(recordSize));
+      std::memcpy(&count, data + offset + sizeof(recordSize), sizeof(count));
+      offset += sizeof(recordSize) + sizeof(count);
+
+      if (recordSize != sizeof(Page))
+        throw triton::exceptions::Architecture("PagedMemory::load(): The pages have been written by another build.");
+
+      if (count > (size - offset) / sizeof(triton::uint64))
+        throw triton::exceptions::Architecture("PagedMemory::load(): The pages are truncated.");
+
+      const triton::uint8* numbers = data + offset;
+      offset += static_cast<triton::usize>(count) * sizeof(triton::uint64);
+      offset += padding(offset, PagedMemory::pageAlignment);
+
+      if (offset > size || count > (size - offset) / stride)
+        throw triton::exceptions::Architecture("PagedMemory::load(): The pages are truncated.");
+
+      /* The pages share the ownership of the mapping, which is held by the backings so they are never written in place */
+      this->pages.clear();
+      this->faultedPages.clear();
+      this->lazyAreas.clear();
+      this->backings.clear();
+      this->backings.push_back(file);
+      this->cachedPage     = nullptr;
+      this->cachedWritable = false;
+
+      for (triton::usize index = 0; index < count; index++) {
+        triton::uint64 number = 0;
+        std::memcpy(&number, numbers + index * sizeof(number), sizeof(number));
+        Page* page = reinterpret_cast<Page*>(const_cast<triton::uint8*>(data + offset + index * stride));
+        this->pages.emplace_hint(this->pages.end(), number, std::shared_ptr<Page>(file, page));
+      }
+
+      return offset + static_cast<triton::usize>(count) * stride;
+    }
+
+  }; /* arch namespace */
+}; /* triton namespace */
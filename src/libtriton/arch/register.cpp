@@ -5,6 +5,8 @@
 **  This program is under the terms of the BSD License.
 */
 
+#include <utility>
+
 #include <api.hpp>
 #include <exceptions.hpp>
 #include <register.hpp>
@@ -21,7 +23,7 @@ namespace triton {
 
 
     Register::Register(triton::uint32 regId) {
-      if (!triton::api.isArchitectureValid()) {
+      if (!triton::getCurrentApi().isArchitectureValid()) {
         this->clear();
         return;
       }
@@ -38,7 +40,7 @@ namespace triton {
 
 
     Register::Register(triton::uint32 regId, triton::uint512 concreteValue, bool immutable) {
-      if (!triton::api.isArchitectureValid()) {
+      if (!triton::getCurrentApi().isArchitectureValid()) {
         this->clear();
         return;
       }
@@ -55,6 +57,11 @@ namespace triton {
     }
 
 
+    Register::Register(Register&& other) : BitsVector(other) {
+      this->move(other);
+    }
+
+
     Register::~Register() {
     }
 
@@ -65,6 +72,12 @@ namespace triton {
     }
 
 
+    void Register::operator=(Register&& other) {
+      BitsVector::operator=(other);
+      this->move(other);
+    }
+
+
     void Register::clear(void) {
       this->concreteValue        = 0;
       this->concreteValueDefined = false;
@@ -76,18 +89,16 @@ namespace triton {
 
 
     void Register::setup(triton::uint32 regId) {
-      triton::arch::RegisterSpecification regInfo;
-
       this->id = regId;
-      if (!triton::api.isCpuRegisterValid(regId))
+      if (!triton::getCurrentApi().isCpuRegisterValid(regId))
         this->id = triton::arch::INVALID_REGISTER_ID;
 
-      regInfo      = triton::api.getRegisterSpecification(this->id);
-      this->name   = regInfo.getName();
-      this->parent = regInfo.getParentId();
+      const triton::arch::RegisterSpecificationEntry& regInfo = triton::getCurrentApi().getRegisterSpecificationEntry(this->id);
+      this->name   = regInfo.name;
+      this->parent = regInfo.parentId;
 
-      this->setHigh(regInfo.getHigh());
-      this->setLow(regInfo.getLow());
+      this->setHigh(regInfo.high);
+      this->setLow(regInfo.low);
     }
 
 
@@ -101,6 +112,16 @@ namespace triton {
     }
 
 
+    void Register::move(Register& other) {
+      this->concreteValue        = other.concreteValue;
+      this->concreteValueDefined = other.concreteValueDefined;
+      this->id                   = other.id;
+      this->immutable            = false;
+      this->name                 = other.name;
+      this->parent               = other.parent;
+    }
+
+
     triton::uint32 Register::getAbstractLow(void) const {
       return this->getLow();
     }
@@ -121,6 +142,11 @@ namespace triton {
     }
 
 
+    triton::uint32 Register::getParentId(void) const {
+      return this->parent;
+    }
+
+
     triton::uint32 Register::getBitSize(void) const {
       return this->getVectorSize();
     }
@@ -169,17 +195,17 @@ namespace triton {
 
 
     bool Register::isValid(void) const {
-      return triton::api.isCpuRegisterValid(this->id);
+      return triton::getCurrentApi().isCpuRegisterValid(this->id);
     }
 
 
     bool Register::isRegister(void) const {
-      return triton::api.isCpuRegister(this->id);
+      return triton::getCurrentApi().isCpuRegister(this->id);
     }
 
 
     bool Register::isFlag(void) const {
-      return triton::api.isCpuFlag(this->id);
+      return triton::getCurrentApi().isCpuFlag(this->id);
     }
 
 
@@ -189,7 +215,7 @@ namespace triton {
 
 
     bool Register::isOverlapWith(const Register& other) const {
-      if (this->getParent().getId() == other.getParent().getId()) {
+      if (this->getParentId() == other.getParentId()) {
         if (this->getLow() <= other.getLow() && other.getLow() <= this->getHigh()) return true;
         if (other.getLow() <= this->getLow() && this->getLow() <= other.getHigh()) return true;
       }
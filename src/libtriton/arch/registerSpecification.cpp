@@ -28,6 +28,14 @@ namespace triton {
     }
 
 
+    RegisterSpecification::RegisterSpecification(const RegisterSpecificationEntry& entry) {
+      this->name     = entry.name;
+      this->high     = entry.high;
+      this->low      = entry.low;
+      this->parentId = entry.parentId;
+    }
+
+
     RegisterSpecification::RegisterSpecification(const RegisterSpecification& other) {
       this->name     = other.name;
       this->high     = other.high;
@@ -5,6 +5,7 @@
 **  This program is under the terms of the BSD License.
 */
 
+#include <algorithm>
 #include <cstring>
 
 #include <architecture.hpp>
@@ -27,17 +28,21 @@ namespace triton {
 
       x86Cpu::x86Cpu(triton::callbacks::Callbacks* callbacks) {
         this->callbacks = callbacks;
+        this->handle    = 0;
         this->clear();
       }
 
 
       x86Cpu::x86Cpu(const x86Cpu& other) {
+        this->handle = 0;
         this->copy(other);
       }
 
 
       x86Cpu::~x86Cpu() {
         this->memory.clear();
+        if (this->handle != 0)
+          this->closeDecoder(this->handle);
       }
 
 
@@ -330,13 +335,7 @@ namespace triton {
 
         /* Update python env ======================================================== */
         #ifdef TRITON_PYTHON_BINDINGS
-          triton::bindings::python::initRegNamespace();
-          triton::bindings::python::initCpuSizeNamespace();
-          triton::bindings::python::initX86OpcodesNamespace();
-          triton::bindings::python::initX86PrefixesNamespace();
-          #if defined(__unix__) || defined(__APPLE__)
-            triton::bindings::python::initSyscallNamespace();
-          #endif
+          triton::bindings::python::clearArchitectureNamespaces();
         #endif
       }
 
@@ -406,6 +405,47 @@ namespace triton {
       }
 
 
+      void x86Cpu::setConcreteRegisterContext(const triton::arch::x86::RegisterContext& context) {
+        triton::uint8* gprs[8]     = {this->eax, this->ebx, this->ecx, this->edx, this->edi, this->esi, this->ebp, this->esp};
+        triton::uint8* segments[6] = {this->cs, this->ds, this->es, this->fs, this->gs, this->ss};
+        triton::uint8* xmms[8]     = {this->xmm0, this->xmm1, this->xmm2, this->xmm3, this->xmm4, this->xmm5, this->xmm6, this->xmm7};
+
+        for (triton::uint32 index = 0; index < 8; index++)
+          (*((triton::uint32*)(gprs[index]))) = static_cast<triton::uint32>(context.gprs[index]);
+
+        for (triton::uint32 index = 0; index < 6; index++)
+          (*((triton::uint32*)(segments[index]))) = static_cast<triton::uint32>(context.segments[index]);
+
+        (*((triton::uint32*)(this->eip)))    = static_cast<triton::uint32>(context.pc);
+        (*((triton::uint32*)(this->eflags))) = static_cast<triton::uint32>(context.flags);
+
+        for (triton::uint32 index = 0; index < 8; index++)
+          std::memcpy(xmms[index], context.xmms[index], DQWORD_SIZE);
+      }
+
+
+      void x86Cpu::getConcreteRegisterContext(triton::arch::x86::RegisterContext& context) const {
+        const triton::uint8* gprs[8]     = {this->eax, this->ebx, this->ecx, this->edx, this->edi, this->esi, this->ebp, this->esp};
+        const triton::uint8* segments[6] = {this->cs, this->ds, this->es, this->fs, this->gs, this->ss};
+        const triton::uint8* xmms[8]     = {this->xmm0, this->xmm1, this->xmm2, this->xmm3, this->xmm4, this->xmm5, this->xmm6, this->xmm7};
+
+        /* The registers the x86 CPU does not have are zero */
+        std::memset(&context, 0x00, sizeof(context));
+
+        for (triton::uint32 index = 0; index < 8; index++)
+          context.gprs[index] = (*((const triton::uint32*)(gprs[index])));
+
+        for (triton::uint32 index = 0; index < 6; index++)
+          context.segments[index] = (*((const triton::uint32*)(segments[index])));
+
+        context.pc    = (*((const triton::uint32*)(this->eip)));
+        context.flags = (*((const triton::uint32*)(this->eflags)));
+
+        for (triton::uint32 index = 0; index < 8; index++)
+          std::memcpy(context.xmms[index], xmms[index], DQWORD_SIZE);
+      }
+
+
       void x86Cpu::operator=(const x86Cpu& other) {
         this->copy(other);
       }
@@ -483,6 +523,11 @@ namespace triton {
       }
 
 
+      const triton::arch::RegisterSpecificationEntry& x86Cpu::getRegisterSpecificationEntry(triton::uint32 regId) const {
+        return this->getX86RegisterSpecificationEntry(triton::arch::ARCH_X86, regId);
+      }
+
+
       std::set<triton::arch::Register*> x86Cpu::getAllRegisters(void) const {
         std::set<triton::arch::Register*> ret;
 
@@ -528,125 +573,172 @@ namespace triton {
       }
 
 
-      void x86Cpu::disassembly(triton::arch::Instruction& inst) const {
-        triton::extlibs::capstone::csh       handle;
-        triton::extlibs::capstone::cs_insn*  insn;
-        triton::usize                        count = 0;
-
-        /* Check if the opcodes and opcodes' size are defined */
-        if (inst.getOpcodes() == nullptr || inst.getSize() == 0)
-          throw triton::exceptions::Disassembly("x86Cpu::disassembly(): Opcodes and opcodesSize must be definied.");
+      triton::usize x86Cpu::openDecoder(void) const {
+        triton::extlibs::capstone::csh handle;
 
-        /* Open capstone */
         if (triton::extlibs::capstone::cs_open(triton::extlibs::capstone::CS_ARCH_X86, triton::extlibs::capstone::CS_MODE_32, &handle) != triton::extlibs::capstone::CS_ERR_OK)
-          throw triton::exceptions::Disassembly("x86Cpu::disassembly(): Cannot open capstone.");
+          throw triton::exceptions::Disassembly("x86Cpu::openDecoder(): Cannot open capstone.");
 
         /* Init capstone's options */
         triton::extlibs::capstone::cs_option(handle, triton::extlibs::capstone::CS_OPT_DETAIL, triton::extlibs::capstone::CS_OPT_ON);
         triton::extlibs::capstone::cs_option(handle, triton::extlibs::capstone::CS_OPT_SYNTAX, triton::extlibs::capstone::CS_OPT_SYNTAX_INTEL);
 
-        /* Let's disass and build our operands */
-        count = triton::extlibs::capstone::cs_disasm(handle, inst.getOpcodes(), inst.getSize(), inst.getAddress(), 0, &insn);
-        if (count > 0) {
-          triton::extlibs::capstone::cs_detail* detail = insn->detail;
-          for (triton::uint32 j = 0; j < 1; j++) {
+        return handle;
+      }
+
+
+      void x86Cpu::closeDecoder(triton::usize handle) const {
+        triton::extlibs::capstone::csh csHandle = handle;
+        triton::extlibs::capstone::cs_close(&csHandle);
+      }
+
+
+      bool x86Cpu::decode(triton::usize handle, const triton::uint8* opcodes, triton::usize size, triton::uint64 addr, triton::arch::DecodedInstruction& decoded) const {
+        triton::extlibs::capstone::cs_insn*  insn;
+        triton::usize                        count = 0;
 
-            /* Init the disassembly */
-            std::stringstream str;
+        /* Let's disass and build our operands */
+        count = triton::extlibs::capstone::cs_disasm(handle, opcodes, size, addr, 1, &insn);
+        if (count == 0)
+          return false;
 
-            /* Add mnemonic */
-            str << insn[j].mnemonic;
+        triton::extlibs::capstone::cs_detail* detail = insn->detail;
 
-            /* Add operands */
-            if (detail->x86.op_count)
-              str << " " <<  insn[j].op_str;
+        decoded.branch      = false;
+        decoded.controlFlow = false;
+        decoded.operands.clear();
+        for (triton::uint32 j = 0; j < 1; j++) {
 
-            inst.setDisassembly(str.str());
+          /* Init the disassembly, formatted once and shared by the instructions of the decode cache */
+          std::string str = insn[j].mnemonic;
 
-            /* Refine the size */
-            inst.setSize(insn[j].size);
+          /* Add operands */
+          if (detail->x86.op_count) {
+            str += " ";
+            str += insn[j].op_str;
+          }
 
-            /* Init the instruction's type */
-            inst.setType(this->capstoneInstructionToTritonInstruction(insn[j].id));
+          decoded.disassembly = std::make_shared<const std::string>(std::move(str));
 
-            /* Init the instruction's prefix */
-            inst.setPrefix(this->capstonePrefixToTritonPrefix(detail->x86.prefix[0]));
+          /* Refine the size */
+          decoded.opcodes.assign(opcodes, opcodes + insn[j].size);
 
-            /* Init operands */
-            for (triton::uint32 n = 0; n < detail->x86.op_count; n++) {
-              triton::extlibs::capstone::cs_x86_op* op = &(detail->x86.operands[n]);
-              switch(op->type) {
+          /* Init the instruction's type */
+          decoded.type = this->capstoneInstructionToTritonInstruction(insn[j].id);
 
-                case triton::extlibs::capstone::X86_OP_IMM:
-                  inst.operands.push_back(triton::arch::OperandWrapper(triton::arch::Immediate(op->imm, op->size)));
-                  break;
+          /* Init the instruction's prefix */
+          decoded.prefix = this->capstonePrefixToTritonPrefix(detail->x86.prefix[0]);
 
-                case triton::extlibs::capstone::X86_OP_MEM: {
-                  triton::arch::MemoryAccess mem;
+          /* Init operands */
+          for (triton::uint32 n = 0; n < detail->x86.op_count; n++) {
+            triton::extlibs::capstone::cs_x86_op* op = &(detail->x86.operands[n]);
+            switch(op->type) {
 
-                  /* Set the size of the memory access */
-                  mem.setPair(std::make_pair(((op->size * BYTE_SIZE_BIT) - 1), 0));
+              case triton::extlibs::capstone::X86_OP_IMM:
+                decoded.operands.push_back(triton::arch::OperandWrapper(triton::arch::Immediate(op->imm, op->size)));
+                break;
 
-                  /* LEA if exists */
-                  triton::arch::Register segment(this->capstoneRegisterToTritonRegister(op->mem.segment));
-                  triton::arch::Register base(this->capstoneRegisterToTritonRegister(op->mem.base));
-                  triton::arch::Register index(this->capstoneRegisterToTritonRegister(op->mem.index));
-                  triton::arch::Immediate disp(op->mem.disp, base.isValid() ? base.getSize() : index.isValid() ? index.getSize() : this->registerSize());
-                  triton::arch::Immediate scale(op->mem.scale, base.isValid() ? base.getSize() : index.isValid() ? index.getSize() : this->registerSize());
+              case triton::extlibs::capstone::X86_OP_MEM: {
+                triton::arch::MemoryAccess mem;
 
-                  /* Specify that LEA contains a PC relative */
-                  if (base.getId() == TRITON_X86_REG_PC.getId())
-                    mem.setPcRelative(inst.getNextAddress());
+                /* Set the size of the memory access */
+                mem.setPair(std::make_pair(((op->size * BYTE_SIZE_BIT) - 1), 0));
 
-                  mem.setSegmentRegister(segment);
-                  mem.setBaseRegister(base);
-                  mem.setIndexRegister(index);
-                  mem.setDisplacement(disp);
-                  mem.setScale(scale);
+                /* LEA if exists */
+                triton::arch::Register segment(this->capstoneRegisterToTritonRegister(op->mem.segment));
+                triton::arch::Register base(this->capstoneRegisterToTritonRegister(op->mem.base));
+                triton::arch::Register index(this->capstoneRegisterToTritonRegister(op->mem.index));
+                triton::arch::Immediate disp(op->mem.disp, base.isValid() ? base.getSize() : index.isValid() ? index.getSize() : this->registerSize());
+                triton::arch::Immediate scale(op->mem.scale, base.isValid() ? base.getSize() : index.isValid() ? index.getSize() : this->registerSize());
 
-                  inst.operands.push_back(triton::arch::OperandWrapper(mem));
-                  break;
-                }
+                /* Specify that LEA contains a PC relative */
+                if (base.getId() == TRITON_X86_REG_PC.getId())
+                  mem.setPcRelative(addr + insn[j].size);
 
-                case triton::extlibs::capstone::X86_OP_REG:
-                  inst.operands.push_back(triton::arch::OperandWrapper(inst.getRegisterState(this->capstoneRegisterToTritonRegister(op->reg))));
-                  break;
+                mem.setSegmentRegister(segment);
+                mem.setBaseRegister(base);
+                mem.setIndexRegister(index);
+                mem.setDisplacement(disp);
+                mem.setScale(scale);
 
-                default:
-                  break;
+                decoded.operands.push_back(triton::arch::OperandWrapper(mem));
+                break;
               }
-            }
 
-          }
-          /* Set branch */
-          if (detail->groups_count > 0) {
-            for (triton::uint32 n = 0; n < detail->groups_count; n++) {
-              if (detail->groups[n] == triton::extlibs::capstone::X86_GRP_JUMP)
-                inst.setBranch(true);
-              if (detail->groups[n] == triton::extlibs::capstone::X86_GRP_JUMP ||
-                  detail->groups[n] == triton::extlibs::capstone::X86_GRP_CALL ||
-                  detail->groups[n] == triton::extlibs::capstone::X86_GRP_RET)
-                inst.setControlFlow(true);
+              case triton::extlibs::capstone::X86_OP_REG:
+                decoded.operands.push_back(triton::arch::OperandWrapper(triton::arch::Register(this->capstoneRegisterToTritonRegister(op->reg))));
+                break;
+
+              default:
+                break;
             }
           }
-          triton::extlibs::capstone::cs_free(insn, count);
+
+        }
+        /* Set branch */
+        if (detail->groups_count > 0) {
+          for (triton::uint32 n = 0; n < detail->groups_count; n++) {
+            if (detail->groups[n] == triton::extlibs::capstone::X86_GRP_JUMP)
+              decoded.branch = true;
+            if (detail->groups[n] == triton::extlibs::capstone::X86_GRP_JUMP ||
+                detail->groups[n] == triton::extlibs::capstone::X86_GRP_CALL ||
+                detail->groups[n] == triton::extlibs::capstone::X86_GRP_RET)
+              decoded.controlFlow = true;
+          }
         }
-        else
+        /* Free capstone stuffs */
+        triton::extlibs::capstone::cs_free(insn, count);
+
+        return true;
+      }
+
+
+      void x86Cpu::disassembly(triton::arch::Instruction& inst) const {
+        triton::arch::DecodedInstruction decoded;
+
+        /* Check if the opcodes and opcodes' size are defined */
+        if (inst.getOpcodes() == nullptr || inst.getSize() == 0)
+          throw triton::exceptions::Disassembly("x86Cpu::disassembly(): Opcodes and opcodesSize must be definied.");
+
+        /* Reuse the decoding of an instruction already seen */
+        const triton::arch::DecodedInstruction* cached = this->decodeCache.find(inst);
+        if (cached != nullptr) {
+          this->decodeCache.apply(*cached, inst);
+          return;
+        }
+
+        /* Open capstone once per CPU */
+        if (this->handle == 0)
+          this->handle = this->openDecoder();
+
+        if (!this->decode(this->handle, inst.getOpcodes(), inst.getSize(), inst.getAddress(), decoded))
           throw triton::exceptions::Disassembly("x86Cpu::disassembly(): Failed to disassemble the given code.");
 
-        triton::extlibs::capstone::cs_close(&handle);
-        return;
+        /* Record and apply the decoding */
+        this->decodeCache.insert(inst.getAddress(), decoded);
+        this->decodeCache.apply(decoded, inst);
+      }
+
+
+      triton::arch::DecodeCache& x86Cpu::getDecodeCache(void) {
+        return this->decodeCache;
       }
 
 
       triton::uint8 x86Cpu::getConcreteMemoryValue(triton::uint64 addr) const {
-        if (this->memory.find(addr) == this->memory.end())
-          return 0x00;
-        return this->memory.at(addr);
+        return this->memory.read(addr);
+      }
+
+
+      void x86Cpu::resolveMemoryMisses(triton::uint64 baseAddr, triton::usize size) const {
+        this->memory.resolveMisses(baseAddr, size, [this](triton::uint64 pageAddr, triton::uint8* page) {
+          return this->callbacks->processCallbacks(triton::callbacks::MEMORY_MISS, pageAddr, page, triton::arch::PagedMemory::pageSize);
+        });
       }
 
 
       triton::uint512 x86Cpu::getConcreteMemoryValue(const triton::arch::MemoryAccess& mem, bool execCallbacks) const {
+        triton::uint8 area[DQQWORD_SIZE];
         triton::uint512 ret = 0;
         triton::uint64 addr = mem.getAddress();
         triton::uint32 size = mem.getSize();
@@ -654,33 +746,59 @@ namespace triton {
         if (size == 0 || size > DQQWORD_SIZE)
           throw triton::exceptions::Cpu("x86Cpu::getConcreteMemoryValue(): Invalid size memory.");
 
-        if (execCallbacks && this->callbacks)
-          this->callbacks->processCallbacks(triton::callbacks::GET_CONCRETE_MEMORY_VALUE, mem);
+        if (execCallbacks && this->callbacks && this->callbacks->isDefined) {
+          if (this->callbacks->isCallbackDefined(triton::callbacks::MEMORY_MISS))
+            this->resolveMemoryMisses(addr, size);
+          if (this->callbacks->isCallbackDefined(triton::callbacks::GET_CONCRETE_MEMORY_AREA_VALUE))
+            this->callbacks->processCallbacks(triton::callbacks::GET_CONCRETE_MEMORY_AREA_VALUE, addr, size);
+          if (this->callbacks->isCallbackDefined(triton::callbacks::GET_CONCRETE_MEMORY_VALUE))
+            this->callbacks->processCallbacks(triton::callbacks::GET_CONCRETE_MEMORY_VALUE, mem);
+        }
 
-        for (triton::sint32 i = size-1; i >= 0; i--)
-          ret = ((ret << BYTE_SIZE_BIT) | this->getConcreteMemoryValue(addr+i));
+        this->memory.read(addr, area, size);
+
+        /* Assemble the little endian value a qword at a time */
+        for (triton::sint32 i = ((size - 1) / QWORD_SIZE) * QWORD_SIZE; i >= 0; i -= QWORD_SIZE) {
+          triton::uint64 qword = 0;
+          for (triton::sint32 j = std::min<triton::sint32>(size - i, QWORD_SIZE) - 1; j >= 0; j--)
+            qword = ((qword << BYTE_SIZE_BIT) | area[i + j]);
+          ret = ((ret << QWORD_SIZE_BIT) | qword);
+        }
 
         return ret;
       }
 
 
       std::vector<triton::uint8> x86Cpu::getConcreteMemoryAreaValue(triton::uint64 baseAddr, triton::usize size, bool execCallbacks) const {
-        std::vector<triton::uint8> area;
+        std::vector<triton::uint8> area(size);
 
-        for (triton::usize index = 0; index < size; index++) {
-          if (execCallbacks && this->callbacks)
-            this->callbacks->processCallbacks(triton::callbacks::GET_CONCRETE_MEMORY_VALUE, MemoryAccess(baseAddr+index, BYTE_SIZE));
-          area.push_back(this->getConcreteMemoryValue(baseAddr+index));
-        }
+        this->getConcreteMemoryAreaValue(baseAddr, area.data(), size, execCallbacks);
 
         return area;
       }
 
 
+      void x86Cpu::getConcreteMemoryAreaValue(triton::uint64 baseAddr, triton::uint8* area, triton::usize size, bool execCallbacks) const {
+        if (execCallbacks && this->callbacks && this->callbacks->isDefined && size) {
+          if (this->callbacks->isCallbackDefined(triton::callbacks::MEMORY_MISS))
+            this->resolveMemoryMisses(baseAddr, size);
+          if (this->callbacks->isCallbackDefined(triton::callbacks::GET_CONCRETE_MEMORY_AREA_VALUE))
+            this->callbacks->processCallbacks(triton::callbacks::GET_CONCRETE_MEMORY_AREA_VALUE, baseAddr, size);
+          if (this->callbacks->isCallbackDefined(triton::callbacks::GET_CONCRETE_MEMORY_VALUE)) {
+            for (triton::usize index = 0; index < size; index++)
+              this->callbacks->processCallbacks(triton::callbacks::GET_CONCRETE_MEMORY_VALUE, MemoryAccess(baseAddr+index, BYTE_SIZE));
+          }
+        }
+
+        if (size)
+          this->memory.read(baseAddr, area, size);
+      }
+
+
       triton::uint512 x86Cpu::getConcreteRegisterValue(const triton::arch::Register& reg, bool execCallbacks) const {
         triton::uint512 value = 0;
 
-        if (execCallbacks && this->callbacks)
+        if (execCallbacks && this->callbacks && this->callbacks->isCallbackDefined(triton::callbacks::GET_CONCRETE_REGISTER_VALUE))
           this->callbacks->processCallbacks(triton::callbacks::GET_CONCRETE_REGISTER_VALUE, reg);
 
         switch (reg.getId()) {
@@ -814,11 +932,12 @@ namespace triton {
 
 
       void x86Cpu::setConcreteMemoryValue(triton::uint64 addr, triton::uint8 value) {
-        this->memory[addr] = value;
+        this->memory.write(addr, value);
       }
 
 
       void x86Cpu::setConcreteMemoryValue(const triton::arch::MemoryAccess& mem) {
+        triton::uint8 area[DQQWORD_SIZE];
         triton::uint64 addr = mem.getAddress();
         triton::uint32 size = mem.getSize();
         triton::uint512 cv  = mem.getConcreteValue();
@@ -827,23 +946,21 @@ namespace triton {
           throw triton::exceptions::Cpu("x86Cpu::setConcreteMemoryValue(): Invalid size memory.");
 
         for (triton::uint32 i = 0; i < size; i++) {
-          this->memory[addr+i] = (cv & 0xff).convert_to<triton::uint8>();
+          area[i] = (cv & 0xff).convert_to<triton::uint8>();
           cv >>= 8;
         }
+
+        this->memory.write(addr, area, size);
       }
 
 
       void x86Cpu::setConcreteMemoryAreaValue(triton::uint64 baseAddr, const std::vector<triton::uint8>& values) {
-        for (triton::usize index = 0; index < values.size(); index++) {
-          this->memory[baseAddr+index] = values[index];
-        }
+        this->memory.write(baseAddr, values.data(), values.size());
       }
 
 
       void x86Cpu::setConcreteMemoryAreaValue(triton::uint64 baseAddr, const triton::uint8* area, triton::usize size) {
-        for (triton::usize index = 0; index < size; index++) {
-          this->memory[baseAddr+index] = area[index];
-        }
+        this->memory.write(baseAddr, area, size);
       }
 
 
@@ -1079,19 +1196,27 @@ namespace triton {
 
 
       bool x86Cpu::isMemoryMapped(triton::uint64 baseAddr, triton::usize size) {
-        for (triton::usize index = 0; index < size; index++) {
-          if (this->memory.find(baseAddr + index) == this->memory.end())
-            return false;
-        }
-        return true;
+        return this->memory.isMapped(baseAddr, size);
       }
 
 
       void x86Cpu::unmapMemory(triton::uint64 baseAddr, triton::usize size) {
-        for (triton::usize index = 0; index < size; index++) {
-          if (this->memory.find(baseAddr + index) != this->memory.end())
-            this->memory.erase(baseAddr + index);
-        }
+        this->memory.unmap(baseAddr, size);
+      }
+
+
+      triton::usize x86Cpu::getNumberOfMemoryPages(void) const {
+        return this->memory.getNumberOfPages();
+      }
+
+
+      triton::usize x86Cpu::getMemoryUsage(void) const {
+        return sizeof(*this) + this->memory.getMemoryUsage();
+      }
+
+
+      triton::arch::PagedMemory& x86Cpu::getPagedMemory(void) {
+        return this->memory;
       }
 
     }; /* x86 namespace */
@@ -328,6 +328,8 @@ namespace triton {
         this->architecture    = architecture;
         this->symbolicEngine  = symbolicEngine;
         this->taintEngine     = taintEngine;
+        this->handlers        = &x86Semantics::getHandlers();
+        this->taintSummaries  = &x86Semantics::getTaintSummaries();
 
         if (this->architecture == nullptr)
           throw triton::exceptions::Semantics("x86Semantics::x86Semantics(): The architecture API must be defined.");
@@ -344,296 +346,1314 @@ namespace triton {
       }
 
 
+      const std::vector<x86Semantics::handler_t>& x86Semantics::getHandlers(void) {
+        /* Built once, the handlers do not depend on the instance */
+        static const std::vector<handler_t> handlers = [] () {
+          std::vector<handler_t> table(ID_INST_LAST_ITEM, nullptr);
+
+          table[ID_INS_AAD]         = &x86Semantics::aad_s;
+          table[ID_INS_ADC]         = &x86Semantics::adc_s;
+          table[ID_INS_ADD]         = &x86Semantics::add_s;
+          table[ID_INS_AND]         = &x86Semantics::and_s;
+          table[ID_INS_ANDN]        = &x86Semantics::andn_s;
+          table[ID_INS_ANDNPD]      = &x86Semantics::andnpd_s;
+          table[ID_INS_ANDNPS]      = &x86Semantics::andnps_s;
+          table[ID_INS_ANDPD]       = &x86Semantics::andpd_s;
+          table[ID_INS_ANDPS]       = &x86Semantics::andps_s;
+          table[ID_INS_BEXTR]       = &x86Semantics::bextr_s;
+          table[ID_INS_BLSI]        = &x86Semantics::blsi_s;
+          table[ID_INS_BLSMSK]      = &x86Semantics::blsmsk_s;
+          table[ID_INS_BLSR]        = &x86Semantics::blsr_s;
+          table[ID_INS_BSF]         = &x86Semantics::bsf_s;
+          table[ID_INS_BSR]         = &x86Semantics::bsr_s;
+          table[ID_INS_BSWAP]       = &x86Semantics::bswap_s;
+          table[ID_INS_BT]          = &x86Semantics::bt_s;
+          table[ID_INS_BTC]         = &x86Semantics::btc_s;
+          table[ID_INS_BTR]         = &x86Semantics::btr_s;
+          table[ID_INS_BTS]         = &x86Semantics::bts_s;
+          table[ID_INS_CALL]        = &x86Semantics::call_s;
+          table[ID_INS_CBW]         = &x86Semantics::cbw_s;
+          table[ID_INS_CDQ]         = &x86Semantics::cdq_s;
+          table[ID_INS_CDQE]        = &x86Semantics::cdqe_s;
+          table[ID_INS_CLC]         = &x86Semantics::clc_s;
+          table[ID_INS_CLD]         = &x86Semantics::cld_s;
+          table[ID_INS_CLFLUSH]     = &x86Semantics::clflush_s;
+          table[ID_INS_CLTS]        = &x86Semantics::clts_s;
+          table[ID_INS_CLI]         = &x86Semantics::cli_s;
+          table[ID_INS_CMC]         = &x86Semantics::cmc_s;
+          table[ID_INS_CMOVA]       = &x86Semantics::cmova_s;
+          table[ID_INS_CMOVAE]      = &x86Semantics::cmovae_s;
+          table[ID_INS_CMOVB]       = &x86Semantics::cmovb_s;
+          table[ID_INS_CMOVBE]      = &x86Semantics::cmovbe_s;
+          table[ID_INS_CMOVE]       = &x86Semantics::cmove_s;
+          table[ID_INS_CMOVG]       = &x86Semantics::cmovg_s;
+          table[ID_INS_CMOVGE]      = &x86Semantics::cmovge_s;
+          table[ID_INS_CMOVL]       = &x86Semantics::cmovl_s;
+          table[ID_INS_CMOVLE]      = &x86Semantics::cmovle_s;
+          table[ID_INS_CMOVNE]      = &x86Semantics::cmovne_s;
+          table[ID_INS_CMOVNO]      = &x86Semantics::cmovno_s;
+          table[ID_INS_CMOVNP]      = &x86Semantics::cmovnp_s;
+          table[ID_INS_CMOVNS]      = &x86Semantics::cmovns_s;
+          table[ID_INS_CMOVO]       = &x86Semantics::cmovo_s;
+          table[ID_INS_CMOVP]       = &x86Semantics::cmovp_s;
+          table[ID_INS_CMOVS]       = &x86Semantics::cmovs_s;
+          table[ID_INS_CMP]         = &x86Semantics::cmp_s;
+          table[ID_INS_CMPSB]       = &x86Semantics::cmpsb_s;
+          table[ID_INS_CMPSD]       = &x86Semantics::cmpsd_s;
+          table[ID_INS_CMPSQ]       = &x86Semantics::cmpsq_s;
+          table[ID_INS_CMPSW]       = &x86Semantics::cmpsw_s;
+          table[ID_INS_CMPXCHG]     = &x86Semantics::cmpxchg_s;
+          table[ID_INS_CMPXCHG16B]  = &x86Semantics::cmpxchg16b_s;
+          table[ID_INS_CMPXCHG8B]   = &x86Semantics::cmpxchg8b_s;
+          table[ID_INS_CPUID]       = &x86Semantics::cpuid_s;
+          table[ID_INS_CQO]         = &x86Semantics::cqo_s;
+          table[ID_INS_CWD]         = &x86Semantics::cwd_s;
+          table[ID_INS_CWDE]        = &x86Semantics::cwde_s;
+          table[ID_INS_DEC]         = &x86Semantics::dec_s;
+          table[ID_INS_DIV]         = &x86Semantics::div_s;
+          table[ID_INS_EXTRACTPS]   = &x86Semantics::extractps_s;
+          table[ID_INS_IDIV]        = &x86Semantics::idiv_s;
+          table[ID_INS_IMUL]        = &x86Semantics::imul_s;
+          table[ID_INS_INC]         = &x86Semantics::inc_s;
+          table[ID_INS_INVD]        = &x86Semantics::invd_s;
+          table[ID_INS_INVLPG]      = &x86Semantics::invlpg_s;
+          table[ID_INS_JA]          = &x86Semantics::ja_s;
+          table[ID_INS_JAE]         = &x86Semantics::jae_s;
+          table[ID_INS_JB]          = &x86Semantics::jb_s;
+          table[ID_INS_JBE]         = &x86Semantics::jbe_s;
+          table[ID_INS_JE]          = &x86Semantics::je_s;
+          table[ID_INS_JG]          = &x86Semantics::jg_s;
+          table[ID_INS_JGE]         = &x86Semantics::jge_s;
+          table[ID_INS_JL]          = &x86Semantics::jl_s;
+          table[ID_INS_JLE]         = &x86Semantics::jle_s;
+          table[ID_INS_JMP]         = &x86Semantics::jmp_s;
+          table[ID_INS_JNE]         = &x86Semantics::jne_s;
+          table[ID_INS_JNO]         = &x86Semantics::jno_s;
+          table[ID_INS_JNP]         = &x86Semantics::jnp_s;
+          table[ID_INS_JNS]         = &x86Semantics::jns_s;
+          table[ID_INS_JO]          = &x86Semantics::jo_s;
+          table[ID_INS_JP]          = &x86Semantics::jp_s;
+          table[ID_INS_JS]          = &x86Semantics::js_s;
+          table[ID_INS_LAHF]        = &x86Semantics::lahf_s;
+          table[ID_INS_LDDQU]       = &x86Semantics::lddqu_s;
+          table[ID_INS_LDMXCSR]     = &x86Semantics::ldmxcsr_s;
+          table[ID_INS_LEA]         = &x86Semantics::lea_s;
+          table[ID_INS_LEAVE]       = &x86Semantics::leave_s;
+          table[ID_INS_LFENCE]      = &x86Semantics::lfence_s;
+          table[ID_INS_LODSB]       = &x86Semantics::lodsb_s;
+          table[ID_INS_LODSD]       = &x86Semantics::lodsd_s;
+          table[ID_INS_LODSQ]       = &x86Semantics::lodsq_s;
+          table[ID_INS_LODSW]       = &x86Semantics::lodsw_s;
+          table[ID_INS_MFENCE]      = &x86Semantics::mfence_s;
+          table[ID_INS_MOV]         = &x86Semantics::mov_s;
+          table[ID_INS_MOVABS]      = &x86Semantics::movabs_s;
+          table[ID_INS_MOVAPD]      = &x86Semantics::movapd_s;
+          table[ID_INS_MOVAPS]      = &x86Semantics::movaps_s;
+          table[ID_INS_MOVD]        = &x86Semantics::movd_s;
+          table[ID_INS_MOVDDUP]     = &x86Semantics::movddup_s;
+          table[ID_INS_MOVDQ2Q]     = &x86Semantics::movdq2q_s;
+          table[ID_INS_MOVDQA]      = &x86Semantics::movdqa_s;
+          table[ID_INS_MOVDQU]      = &x86Semantics::movdqu_s;
+          table[ID_INS_MOVHLPS]     = &x86Semantics::movhlps_s;
+          table[ID_INS_MOVHPD]      = &x86Semantics::movhpd_s;
+          table[ID_INS_MOVHPS]      = &x86Semantics::movhps_s;
+          table[ID_INS_MOVLHPS]     = &x86Semantics::movlhps_s;
+          table[ID_INS_MOVLPD]      = &x86Semantics::movlpd_s;
+          table[ID_INS_MOVLPS]      = &x86Semantics::movlps_s;
+          table[ID_INS_MOVMSKPD]    = &x86Semantics::movmskpd_s;
+          table[ID_INS_MOVMSKPS]    = &x86Semantics::movmskps_s;
+          table[ID_INS_MOVNTDQ]     = &x86Semantics::movntdq_s;
+          table[ID_INS_MOVNTI]      = &x86Semantics::movnti_s;
+          table[ID_INS_MOVNTPD]     = &x86Semantics::movntpd_s;
+          table[ID_INS_MOVNTPS]     = &x86Semantics::movntps_s;
+          table[ID_INS_MOVNTQ]      = &x86Semantics::movntq_s;
+          table[ID_INS_MOVQ2DQ]     = &x86Semantics::movq2dq_s;
+          table[ID_INS_MOVQ]        = &x86Semantics::movq_s;
+          table[ID_INS_MOVSB]       = &x86Semantics::movsb_s;
+          table[ID_INS_MOVSD]       = &x86Semantics::movsd_s;
+          table[ID_INS_MOVSHDUP]    = &x86Semantics::movshdup_s;
+          table[ID_INS_MOVSLDUP]    = &x86Semantics::movsldup_s;
+          table[ID_INS_MOVSQ]       = &x86Semantics::movsq_s;
+          table[ID_INS_MOVSW]       = &x86Semantics::movsw_s;
+          table[ID_INS_MOVSX]       = &x86Semantics::movsx_s;
+          table[ID_INS_MOVSXD]      = &x86Semantics::movsxd_s;
+          table[ID_INS_MOVUPD]      = &x86Semantics::movupd_s;
+          table[ID_INS_MOVUPS]      = &x86Semantics::movups_s;
+          table[ID_INS_MOVZX]       = &x86Semantics::movzx_s;
+          table[ID_INS_MUL]         = &x86Semantics::mul_s;
+          table[ID_INS_MULX]        = &x86Semantics::mulx_s;
+          table[ID_INS_NEG]         = &x86Semantics::neg_s;
+          table[ID_INS_NOP]         = &x86Semantics::nop_s;
+          table[ID_INS_NOT]         = &x86Semantics::not_s;
+          table[ID_INS_OR]          = &x86Semantics::or_s;
+          table[ID_INS_ORPD]        = &x86Semantics::orpd_s;
+          table[ID_INS_ORPS]        = &x86Semantics::orps_s;
+          table[ID_INS_PADDB]       = &x86Semantics::paddb_s;
+          table[ID_INS_PADDD]       = &x86Semantics::paddd_s;
+          table[ID_INS_PADDQ]       = &x86Semantics::paddq_s;
+          table[ID_INS_PADDW]       = &x86Semantics::paddw_s;
+          table[ID_INS_PAND]        = &x86Semantics::pand_s;
+          table[ID_INS_PANDN]       = &x86Semantics::pandn_s;
+          table[ID_INS_PAUSE]       = &x86Semantics::pause_s;
+          table[ID_INS_PAVGB]       = &x86Semantics::pavgb_s;
+          table[ID_INS_PAVGW]       = &x86Semantics::pavgw_s;
+          table[ID_INS_PCMPEQB]     = &x86Semantics::pcmpeqb_s;
+          table[ID_INS_PCMPEQD]     = &x86Semantics::pcmpeqd_s;
+          table[ID_INS_PCMPEQW]     = &x86Semantics::pcmpeqw_s;
+          table[ID_INS_PCMPGTB]     = &x86Semantics::pcmpgtb_s;
+          table[ID_INS_PCMPGTD]     = &x86Semantics::pcmpgtd_s;
+          table[ID_INS_PCMPGTW]     = &x86Semantics::pcmpgtw_s;
+          table[ID_INS_PMAXSB]      = &x86Semantics::pmaxsb_s;
+          table[ID_INS_PMAXSD]      = &x86Semantics::pmaxsd_s;
+          table[ID_INS_PMAXSW]      = &x86Semantics::pmaxsw_s;
+          table[ID_INS_PMAXUB]      = &x86Semantics::pmaxub_s;
+          table[ID_INS_PMAXUD]      = &x86Semantics::pmaxud_s;
+          table[ID_INS_PMAXUW]      = &x86Semantics::pmaxuw_s;
+          table[ID_INS_PMINSB]      = &x86Semantics::pminsb_s;
+          table[ID_INS_PMINSD]      = &x86Semantics::pminsd_s;
+          table[ID_INS_PMINSW]      = &x86Semantics::pminsw_s;
+          table[ID_INS_PMINUB]      = &x86Semantics::pminub_s;
+          table[ID_INS_PMINUD]      = &x86Semantics::pminud_s;
+          table[ID_INS_PMINUW]      = &x86Semantics::pminuw_s;
+          table[ID_INS_PMOVMSKB]    = &x86Semantics::pmovmskb_s;
+          table[ID_INS_PMOVSXBD]    = &x86Semantics::pmovsxbd_s;
+          table[ID_INS_PMOVSXBQ]    = &x86Semantics::pmovsxbq_s;
+          table[ID_INS_PMOVSXBW]    = &x86Semantics::pmovsxbw_s;
+          table[ID_INS_PMOVSXDQ]    = &x86Semantics::pmovsxdq_s;
+          table[ID_INS_PMOVSXWD]    = &x86Semantics::pmovsxwd_s;
+          table[ID_INS_PMOVSXWQ]    = &x86Semantics::pmovsxwq_s;
+          table[ID_INS_PMOVZXBD]    = &x86Semantics::pmovzxbd_s;
+          table[ID_INS_PMOVZXBQ]    = &x86Semantics::pmovzxbq_s;
+          table[ID_INS_PMOVZXBW]    = &x86Semantics::pmovzxbw_s;
+          table[ID_INS_PMOVZXDQ]    = &x86Semantics::pmovzxdq_s;
+          table[ID_INS_PMOVZXWD]    = &x86Semantics::pmovzxwd_s;
+          table[ID_INS_PMOVZXWQ]    = &x86Semantics::pmovzxwq_s;
+          table[ID_INS_POP]         = &x86Semantics::pop_s;
+          table[ID_INS_POPAL]       = &x86Semantics::popal_s;
+          table[ID_INS_POPFD]       = &x86Semantics::popfd_s;
+          table[ID_INS_POPFQ]       = &x86Semantics::popfq_s;
+          table[ID_INS_POR]         = &x86Semantics::por_s;
+          table[ID_INS_PREFETCH]    = &x86Semantics::prefetchx_s;
+          table[ID_INS_PREFETCHNTA] = &x86Semantics::prefetchx_s;
+          table[ID_INS_PREFETCHT0]  = &x86Semantics::prefetchx_s;
+          table[ID_INS_PREFETCHT1]  = &x86Semantics::prefetchx_s;
+          table[ID_INS_PREFETCHT2]  = &x86Semantics::prefetchx_s;
+          table[ID_INS_PREFETCHW]   = &x86Semantics::prefetchx_s;
+          table[ID_INS_PSHUFD]      = &x86Semantics::pshufd_s;
+          table[ID_INS_PSHUFHW]     = &x86Semantics::pshufhw_s;
+          table[ID_INS_PSHUFLW]     = &x86Semantics::pshuflw_s;
+          table[ID_INS_PSHUFW]      = &x86Semantics::pshufw_s;
+          table[ID_INS_PSLLDQ]      = &x86Semantics::pslldq_s;
+          table[ID_INS_PSRLDQ]      = &x86Semantics::psrldq_s;
+          table[ID_INS_PSUBB]       = &x86Semantics::psubb_s;
+          table[ID_INS_PSUBD]       = &x86Semantics::psubd_s;
+          table[ID_INS_PSUBQ]       = &x86Semantics::psubq_s;
+          table[ID_INS_PSUBW]       = &x86Semantics::psubw_s;
+          table[ID_INS_PTEST]       = &x86Semantics::ptest_s;
+          table[ID_INS_PUNPCKHBW]   = &x86Semantics::punpckhbw_s;
+          table[ID_INS_PUNPCKHDQ]   = &x86Semantics::punpckhdq_s;
+          table[ID_INS_PUNPCKHQDQ]  = &x86Semantics::punpckhqdq_s;
+          table[ID_INS_PUNPCKHWD]   = &x86Semantics::punpckhwd_s;
+          table[ID_INS_PUNPCKLBW]   = &x86Semantics::punpcklbw_s;
+          table[ID_INS_PUNPCKLDQ]   = &x86Semantics::punpckldq_s;
+          table[ID_INS_PUNPCKLQDQ]  = &x86Semantics::punpcklqdq_s;
+          table[ID_INS_PUNPCKLWD]   = &x86Semantics::punpcklwd_s;
+          table[ID_INS_PUSH]        = &x86Semantics::push_s;
+          table[ID_INS_PUSHAL]      = &x86Semantics::pushal_s;
+          table[ID_INS_PUSHFD]      = &x86Semantics::pushfd_s;
+          table[ID_INS_PUSHFQ]      = &x86Semantics::pushfq_s;
+          table[ID_INS_PXOR]        = &x86Semantics::pxor_s;
+          table[ID_INS_RCL]         = &x86Semantics::rcl_s;
+          table[ID_INS_RCR]         = &x86Semantics::rcr_s;
+          table[ID_INS_RDTSC]       = &x86Semantics::rdtsc_s;
+          table[ID_INS_RET]         = &x86Semantics::ret_s;
+          table[ID_INS_ROL]         = &x86Semantics::rol_s;
+          table[ID_INS_ROR]         = &x86Semantics::ror_s;
+          table[ID_INS_RORX]        = &x86Semantics::rorx_s;
+          table[ID_INS_SAHF]        = &x86Semantics::sahf_s;
+          table[ID_INS_SAL]         = &x86Semantics::shl_s;
+          table[ID_INS_SAR]         = &x86Semantics::sar_s;
+          table[ID_INS_SARX]        = &x86Semantics::sarx_s;
+          table[ID_INS_SBB]         = &x86Semantics::sbb_s;
+          table[ID_INS_SCASB]       = &x86Semantics::scasb_s;
+          table[ID_INS_SCASD]       = &x86Semantics::scasd_s;
+          table[ID_INS_SCASQ]       = &x86Semantics::scasq_s;
+          table[ID_INS_SCASW]       = &x86Semantics::scasw_s;
+          table[ID_INS_SETA]        = &x86Semantics::seta_s;
+          table[ID_INS_SETAE]       = &x86Semantics::setae_s;
+          table[ID_INS_SETB]        = &x86Semantics::setb_s;
+          table[ID_INS_SETBE]       = &x86Semantics::setbe_s;
+          table[ID_INS_SETE]        = &x86Semantics::sete_s;
+          table[ID_INS_SETG]        = &x86Semantics::setg_s;
+          table[ID_INS_SETGE]       = &x86Semantics::setge_s;
+          table[ID_INS_SETL]        = &x86Semantics::setl_s;
+          table[ID_INS_SETLE]       = &x86Semantics::setle_s;
+          table[ID_INS_SETNE]       = &x86Semantics::setne_s;
+          table[ID_INS_SETNO]       = &x86Semantics::setno_s;
+          table[ID_INS_SETNP]       = &x86Semantics::setnp_s;
+          table[ID_INS_SETNS]       = &x86Semantics::setns_s;
+          table[ID_INS_SETO]        = &x86Semantics::seto_s;
+          table[ID_INS_SETP]        = &x86Semantics::setp_s;
+          table[ID_INS_SETS]        = &x86Semantics::sets_s;
+          table[ID_INS_SFENCE]      = &x86Semantics::sfence_s;
+          table[ID_INS_SHL]         = &x86Semantics::shl_s;
+          table[ID_INS_SHLD]        = &x86Semantics::shld_s;
+          table[ID_INS_SHLX]        = &x86Semantics::shlx_s;
+          table[ID_INS_SHR]         = &x86Semantics::shr_s;
+          table[ID_INS_SHRD]        = &x86Semantics::shrd_s;
+          table[ID_INS_SHRX]        = &x86Semantics::shrx_s;
+          table[ID_INS_STC]         = &x86Semantics::stc_s;
+          table[ID_INS_STD]         = &x86Semantics::std_s;
+          table[ID_INS_STI]         = &x86Semantics::sti_s;
+          table[ID_INS_STMXCSR]     = &x86Semantics::stmxcsr_s;
+          table[ID_INS_STOSB]       = &x86Semantics::stosb_s;
+          table[ID_INS_STOSD]       = &x86Semantics::stosd_s;
+          table[ID_INS_STOSQ]       = &x86Semantics::stosq_s;
+          table[ID_INS_STOSW]       = &x86Semantics::stosw_s;
+          table[ID_INS_SUB]         = &x86Semantics::sub_s;
+          table[ID_INS_SYSCALL]     = &x86Semantics::syscall_s;
+          table[ID_INS_TEST]        = &x86Semantics::test_s;
+          table[ID_INS_TZCNT]       = &x86Semantics::tzcnt_s;
+          table[ID_INS_UNPCKHPD]    = &x86Semantics::unpckhpd_s;
+          table[ID_INS_UNPCKHPS]    = &x86Semantics::unpckhps_s;
+          table[ID_INS_UNPCKLPD]    = &x86Semantics::unpcklpd_s;
+          table[ID_INS_UNPCKLPS]    = &x86Semantics::unpcklps_s;
+          table[ID_INS_VMOVDQA]     = &x86Semantics::vmovdqa_s;
+          table[ID_INS_VMOVDQU]     = &x86Semantics::vmovdqu_s;
+          table[ID_INS_VPAND]       = &x86Semantics::vpand_s;
+          table[ID_INS_VPANDN]      = &x86Semantics::vpandn_s;
+          table[ID_INS_VPOR]        = &x86Semantics::vpor_s;
+          table[ID_INS_VPTEST]      = &x86Semantics::vptest_s;
+          table[ID_INS_VPSHUFD]     = &x86Semantics::vpshufd_s;
+          table[ID_INS_VPXOR]       = &x86Semantics::vpxor_s;
+          table[ID_INS_WBINVD]      = &x86Semantics::wbinvd_s;
+          table[ID_INS_XADD]        = &x86Semantics::xadd_s;
+          table[ID_INS_XCHG]        = &x86Semantics::xchg_s;
+          table[ID_INS_XOR]         = &x86Semantics::xor_s;
+          table[ID_INS_XORPD]       = &x86Semantics::xorpd_s;
+          table[ID_INS_XORPS]       = &x86Semantics::xorps_s;
+
+          return table;
+        }();
+
+        return handlers;
+      }
+
+
+      const std::vector<x86Semantics::TaintSummary>& x86Semantics::getTaintSummaries(void) {
+        /* Built once, each summary mirrors the taint spreading of the handler of the instruction */
+        static const std::vector<TaintSummary> summaries = [] () {
+          std::vector<TaintSummary> table(ID_INST_LAST_ITEM, TaintSummary{SPREAD_INVALID, FLAGS_NONE, 0});
+
+          table[ID_INS_ADC]    = TaintSummary{SPREAD_UNION_CF, FLAGS_ARITH,  2};
+          table[ID_INS_ADD]    = TaintSummary{SPREAD_UNION,    FLAGS_ARITH,  2};
+          table[ID_INS_AND]    = TaintSummary{SPREAD_UNION,    FLAGS_LOGIC,  2};
+          table[ID_INS_CMP]    = TaintSummary{SPREAD_COMPARE,  FLAGS_ARITH,  2};
+          table[ID_INS_DEC]    = TaintSummary{SPREAD_SELF,     FLAGS_INCDEC, 1};
+          table[ID_INS_INC]    = TaintSummary{SPREAD_SELF,     FLAGS_INCDEC, 1};
+          table[ID_INS_MOV]    = TaintSummary{SPREAD_ASSIGN,   FLAGS_NONE,   2};
+          table[ID_INS_MOVSX]  = TaintSummary{SPREAD_ASSIGN,   FLAGS_NONE,   2};
+          table[ID_INS_MOVSXD] = TaintSummary{SPREAD_ASSIGN,   FLAGS_NONE,   2};
+          table[ID_INS_MOVZX]  = TaintSummary{SPREAD_ASSIGN,   FLAGS_NONE,   2};
+          table[ID_INS_NEG]    = TaintSummary{SPREAD_SELF,     FLAGS_ARITH,  1};
+          table[ID_INS_NOP]    = TaintSummary{SPREAD_NONE,     FLAGS_NONE,   0};
+          table[ID_INS_NOT]    = TaintSummary{SPREAD_SELF,     FLAGS_NONE,   1};
+          table[ID_INS_OR]     = TaintSummary{SPREAD_UNION,    FLAGS_LOGIC,  2};
+          table[ID_INS_SBB]    = TaintSummary{SPREAD_UNION_CF, FLAGS_ARITH,  2};
+          table[ID_INS_SUB]    = TaintSummary{SPREAD_UNION,    FLAGS_ARITH,  2};
+          table[ID_INS_TEST]   = TaintSummary{SPREAD_COMPARE,  FLAGS_LOGIC,  2};
+          table[ID_INS_XOR]    = TaintSummary{SPREAD_UNION,    FLAGS_LOGIC,  2};
+
+          return table;
+        }();
+
+        return summaries;
+      }
+
+
       bool x86Semantics::buildSemantics(triton::arch::Instruction& inst) {
+        triton::uint32 type = inst.getType();
+
+        if (type >= this->handlers->size() || (*this->handlers)[type] == nullptr)
+          return false;
+
+        (this->*(*this->handlers)[type])(inst);
+        return true;
+      }
+
+
+      /* Returns the shape of an operand: its type and the parent id of a register or the size of a memory access */
+      static triton::uint64 getOperandShape(const triton::arch::OperandWrapper& op) {
+        triton::uint64 shape = (static_cast<triton::uint64>(op.getType()) << 32);
+
+        switch (op.getType()) {
+          case triton::arch::OP_REG: return shape | op.getConstRegister().getParentId();
+          case triton::arch::OP_MEM: return shape | op.getConstMemory().getSize();
+          default:                   return shape;
+        }
+      }
+
+
+      /* Returns the location of an operand in a taint plan */
+      static triton::engines::taint::TaintLocation getLocation(const triton::arch::Instruction& inst, triton::uint32 index) {
+        const triton::arch::OperandWrapper& op = inst.operands[index];
+
+        switch (op.getType()) {
+          case triton::arch::OP_IMM: return triton::engines::taint::TaintLocation{triton::engines::taint::LOCATION_IMMEDIATE, 0};
+          case triton::arch::OP_MEM: return triton::engines::taint::TaintLocation{triton::engines::taint::LOCATION_MEMORY, index};
+          case triton::arch::OP_REG: return triton::engines::taint::TaintLocation{triton::engines::taint::LOCATION_REGISTER, op.getConstRegister().getParentId()};
+          default:                   return triton::engines::taint::TaintLocation{triton::engines::taint::LOCATION_NONE, 0};
+        }
+      }
+
+
+      bool x86Semantics::compileTaintPlan(const TaintSummary& summary, const triton::arch::Instruction& inst, triton::engines::taint::TaintPlan& plan) const {
+        using namespace triton::engines::taint;
+
+        std::vector<TaintLocation> locations;
+        for (triton::uint32 index = 0; index < summary.operands; index++) {
+          locations.push_back(getLocation(inst, index));
+          if (locations.back().kind == LOCATION_NONE)
+            return false;
+        }
+
+        /* The destination of a spreading is written */
+        if (summary.spread != SPREAD_COMPARE && summary.spread != SPREAD_NONE && locations[0].kind == LOCATION_IMMEDIATE)
+          return false;
+
+        TaintLocation cf = TaintLocation{LOCATION_REGISTER, TRITON_X86_REG_CF.getParentId()};
+
+        /* Spread taint, the steps mirror the calls of the summarized path */
+        switch (summary.spread) {
+          case SPREAD_ASSIGN:   plan.add(PLAN_ASSIGN, locations[0], locations[1]); break;
+          case SPREAD_COMPARE:  plan.add(PLAN_TEST, locations[0]); plan.add(PLAN_TEST, locations[1]); break;
+          case SPREAD_SELF:     plan.add(PLAN_UNION, locations[0], locations[0]); break;
+          case SPREAD_UNION:    plan.add(PLAN_UNION, locations[0], locations[1]); break;
+          case SPREAD_UNION_CF: plan.add(PLAN_UNION, locations[0], locations[1]); plan.add(PLAN_UNION, locations[0], cf); break;
+          default:              break;
+        }
+
+        /* Spread taint to the flags */
+        std::vector<triton::arch::Register> results;
+        std::vector<triton::arch::Register> cleared;
+        switch (summary.flags) {
+          case FLAGS_ARITH:  results = {TRITON_X86_REG_AF, TRITON_X86_REG_CF, TRITON_X86_REG_OF, TRITON_X86_REG_PF, TRITON_X86_REG_SF, TRITON_X86_REG_ZF}; break;
+          case FLAGS_INCDEC: results = {TRITON_X86_REG_AF, TRITON_X86_REG_OF, TRITON_X86_REG_PF, TRITON_X86_REG_SF, TRITON_X86_REG_ZF}; break;
+          case FLAGS_LOGIC:  results = {TRITON_X86_REG_PF, TRITON_X86_REG_SF, TRITON_X86_REG_ZF}; cleared = {TRITON_X86_REG_CF, TRITON_X86_REG_OF}; break;
+          default:           break;
+        }
+
+        /* The control flow of these instructions is sequential */
+        cleared.push_back(TRITON_X86_REG_PC);
+
+        for (auto it = results.begin(); it != results.end(); it++)
+          plan.add(PLAN_SET, TaintLocation{LOCATION_REGISTER, it->getParentId()});
+
+        for (auto it = cleared.begin(); it != cleared.end(); it++)
+          plan.add(PLAN_CLEAR, TaintLocation{LOCATION_REGISTER, it->getParentId()});
+
+        return true;
+      }
+
+
+      bool x86Semantics::buildTaintSemantics(triton::arch::Instruction& inst) {
+        triton::uint32 type = inst.getType();
+        bool tainted        = triton::engines::taint::UNTAINTED;
+
+        if (type >= this->taintSummaries->size())
+          return false;
+
+        const TaintSummary& summary = (*this->taintSummaries)[type];
+        if (summary.spread == SPREAD_INVALID || inst.operands.size() < summary.operands)
+          return false;
+
+        /* The plan of the instruction is reused while the shape of its operands is the same */
+        auto cached = this->taintPlans.find(inst.getAddress());
+        bool valid  = (cached != this->taintPlans.end() && cached->second.type == type && cached->second.shape.size() == summary.operands);
+        for (triton::uint32 index = 0; valid && index < summary.operands; index++)
+          valid = (cached->second.shape[index] == getOperandShape(inst.operands[index]));
+
+        if (!valid) {
+          CachedTaintPlan entry;
+          entry.type = type;
+          for (triton::uint32 index = 0; index < summary.operands; index++)
+            entry.shape.push_back(getOperandShape(inst.operands[index]));
+
+          if (this->compileTaintPlan(summary, inst, entry.plan)) {
+            if (this->taintPlans.size() >= x86Semantics::maxTaintPlans && cached == this->taintPlans.end())
+              this->taintPlans.clear();
+            cached = this->taintPlans.insert(std::make_pair(inst.getAddress(), entry)).first;
+            cached->second = entry;
+          }
+          else {
+            this->taintPlans.erase(inst.getAddress());
+            cached = this->taintPlans.end();
+          }
+        }
+
+        /* Otherwise (e.g. labels are used), the summary is spread by the abstract methods */
+        if (cached != this->taintPlans.end() && this->taintEngine->runPlan(cached->second.plan, inst.operands, tainted)) {
+          inst.setTaint(tainted);
+          return true;
+        }
+
+        /* Spread taint */
+        switch (summary.spread) {
+          case SPREAD_ASSIGN:
+            tainted = this->taintEngine->taintAssignment(inst.operands[0], inst.operands[1]);
+            break;
+
+          case SPREAD_COMPARE:
+            tainted = this->taintEngine->isTainted(inst.operands[0]) | this->taintEngine->isTainted(inst.operands[1]);
+            break;
+
+          case SPREAD_SELF:
+            tainted = this->taintEngine->taintUnion(inst.operands[0], inst.operands[0]);
+            break;
+
+          case SPREAD_UNION:
+            tainted = this->taintEngine->taintUnion(inst.operands[0], inst.operands[1]);
+            break;
+
+          case SPREAD_UNION_CF:
+            this->taintEngine->taintUnion(inst.operands[0], inst.operands[1]);
+            tainted = this->taintEngine->taintUnion(inst.operands[0], triton::arch::OperandWrapper(TRITON_X86_REG_CF));
+            break;
+
+          default:
+            break;
+        }
+
+        /* Spread taint to the flags */
+        switch (summary.flags) {
+          case FLAGS_ARITH:
+            this->taintEngine->setTaintRegister(TRITON_X86_REG_AF, tainted);
+            this->taintEngine->setTaintRegister(TRITON_X86_REG_CF, tainted);
+            this->taintEngine->setTaintRegister(TRITON_X86_REG_OF, tainted);
+            this->taintEngine->setTaintRegister(TRITON_X86_REG_PF, tainted);
+            this->taintEngine->setTaintRegister(TRITON_X86_REG_SF, tainted);
+            this->taintEngine->setTaintRegister(TRITON_X86_REG_ZF, tainted);
+            break;
+
+          case FLAGS_INCDEC:
+            this->taintEngine->setTaintRegister(TRITON_X86_REG_AF, tainted);
+            this->taintEngine->setTaintRegister(TRITON_X86_REG_OF, tainted);
+            this->taintEngine->setTaintRegister(TRITON_X86_REG_PF, tainted);
+            this->taintEngine->setTaintRegister(TRITON_X86_REG_SF, tainted);
+            this->taintEngine->setTaintRegister(TRITON_X86_REG_ZF, tainted);
+            break;
+
+          case FLAGS_LOGIC:
+            this->taintEngine->setTaintRegister(TRITON_X86_REG_CF, triton::engines::taint::UNTAINTED);
+            this->taintEngine->setTaintRegister(TRITON_X86_REG_OF, triton::engines::taint::UNTAINTED);
+            this->taintEngine->setTaintRegister(TRITON_X86_REG_PF, tainted);
+            this->taintEngine->setTaintRegister(TRITON_X86_REG_SF, tainted);
+            this->taintEngine->setTaintRegister(TRITON_X86_REG_ZF, tainted);
+            break;
+
+          default:
+            break;
+        }
+
+        /* The control flow of these instructions is sequential */
+        this->taintEngine->setTaintRegister(TRITON_X86_REG_PC, triton::engines::taint::UNTAINTED);
+
+        inst.setTaint(tainted);
+        return true;
+      }
+
+
+      bool x86Semantics::buildLoopSemantics(triton::arch::Instruction& inst) {
+        triton::uint32 size = 0;
+        bool copy           = false;
+
+        if (inst.getPrefix() != ID_PREFIX_REP || inst.operands.size() != 2 || inst.operands[0].getType() != triton::arch::OP_MEM)
+          return false;
+
         switch (inst.getType()) {
-          case ID_INS_AAD:            this->aad_s(inst);          break;
-          case ID_INS_ADC:            this->adc_s(inst);          break;
-          case ID_INS_ADD:            this->add_s(inst);          break;
-          case ID_INS_AND:            this->and_s(inst);          break;
-          case ID_INS_ANDN:           this->andn_s(inst);         break;
-          case ID_INS_ANDNPD:         this->andnpd_s(inst);       break;
-          case ID_INS_ANDNPS:         this->andnps_s(inst);       break;
-          case ID_INS_ANDPD:          this->andpd_s(inst);        break;
-          case ID_INS_ANDPS:          this->andps_s(inst);        break;
-          case ID_INS_BEXTR:          this->bextr_s(inst);        break;
-          case ID_INS_BLSI:           this->blsi_s(inst);         break;
-          case ID_INS_BLSMSK:         this->blsmsk_s(inst);       break;
-          case ID_INS_BLSR:           this->blsr_s(inst);         break;
-          case ID_INS_BSF:            this->bsf_s(inst);          break;
-          case ID_INS_BSR:            this->bsr_s(inst);          break;
-          case ID_INS_BSWAP:          this->bswap_s(inst);        break;
-          case ID_INS_BT:             this->bt_s(inst);           break;
-          case ID_INS_BTC:            this->btc_s(inst);          break;
-          case ID_INS_BTR:            this->btr_s(inst);          break;
-          case ID_INS_BTS:            this->bts_s(inst);          break;
-          case ID_INS_CALL:           this->call_s(inst);         break;
-          case ID_INS_CBW:            this->cbw_s(inst);          break;
-          case ID_INS_CDQ:            this->cdq_s(inst);          break;
-          case ID_INS_CDQE:           this->cdqe_s(inst);         break;
-          case ID_INS_CLC:            this->clc_s(inst);          break;
-          case ID_INS_CLD:            this->cld_s(inst);          break;
-          case ID_INS_CLFLUSH:        this->clflush_s(inst);      break;
-          case ID_INS_CLTS:           this->clts_s(inst);         break;
-          case ID_INS_CLI:            this->cli_s(inst);          break;
-          case ID_INS_CMC:            this->cmc_s(inst);          break;
-          case ID_INS_CMOVA:          this->cmova_s(inst);        break;
-          case ID_INS_CMOVAE:         this->cmovae_s(inst);       break;
-          case ID_INS_CMOVB:          this->cmovb_s(inst);        break;
-          case ID_INS_CMOVBE:         this->cmovbe_s(inst);       break;
-          case ID_INS_CMOVE:          this->cmove_s(inst);        break;
-          case ID_INS_CMOVG:          this->cmovg_s(inst);        break;
-          case ID_INS_CMOVGE:         this->cmovge_s(inst);       break;
-          case ID_INS_CMOVL:          this->cmovl_s(inst);        break;
-          case ID_INS_CMOVLE:         this->cmovle_s(inst);       break;
-          case ID_INS_CMOVNE:         this->cmovne_s(inst);       break;
-          case ID_INS_CMOVNO:         this->cmovno_s(inst);       break;
-          case ID_INS_CMOVNP:         this->cmovnp_s(inst);       break;
-          case ID_INS_CMOVNS:         this->cmovns_s(inst);       break;
-          case ID_INS_CMOVO:          this->cmovo_s(inst);        break;
-          case ID_INS_CMOVP:          this->cmovp_s(inst);        break;
-          case ID_INS_CMOVS:          this->cmovs_s(inst);        break;
-          case ID_INS_CMP:            this->cmp_s(inst);          break;
-          case ID_INS_CMPSB:          this->cmpsb_s(inst);        break;
-          case ID_INS_CMPSD:          this->cmpsd_s(inst);        break;
-          case ID_INS_CMPSQ:          this->cmpsq_s(inst);        break;
-          case ID_INS_CMPSW:          this->cmpsw_s(inst);        break;
-          case ID_INS_CMPXCHG:        this->cmpxchg_s(inst);      break;
-          case ID_INS_CMPXCHG16B:     this->cmpxchg16b_s(inst);   break;
-          case ID_INS_CMPXCHG8B:      this->cmpxchg8b_s(inst);    break;
-          case ID_INS_CPUID:          this->cpuid_s(inst);        break;
-          case ID_INS_CQO:            this->cqo_s(inst);          break;
-          case ID_INS_CWD:            this->cwd_s(inst);          break;
-          case ID_INS_CWDE:           this->cwde_s(inst);         break;
-          case ID_INS_DEC:            this->dec_s(inst);          break;
-          case ID_INS_DIV:            this->div_s(inst);          break;
-          case ID_INS_EXTRACTPS:      this->extractps_s(inst);    break;
-          case ID_INS_IDIV:           this->idiv_s(inst);         break;
-          case ID_INS_IMUL:           this->imul_s(inst);         break;
-          case ID_INS_INC:            this->inc_s(inst);          break;
-          case ID_INS_INVD:           this->invd_s(inst);         break;
-          case ID_INS_INVLPG:         this->invlpg_s(inst);       break;
-          case ID_INS_JA:             this->ja_s(inst);           break;
-          case ID_INS_JAE:            this->jae_s(inst);          break;
-          case ID_INS_JB:             this->jb_s(inst);           break;
-          case ID_INS_JBE:            this->jbe_s(inst);          break;
-          case ID_INS_JE:             this->je_s(inst);           break;
-          case ID_INS_JG:             this->jg_s(inst);           break;
-          case ID_INS_JGE:            this->jge_s(inst);          break;
-          case ID_INS_JL:             this->jl_s(inst);           break;
-          case ID_INS_JLE:            this->jle_s(inst);          break;
-          case ID_INS_JMP:            this->jmp_s(inst);          break;
-          case ID_INS_JNE:            this->jne_s(inst);          break;
-          case ID_INS_JNO:            this->jno_s(inst);          break;
-          case ID_INS_JNP:            this->jnp_s(inst);          break;
-          case ID_INS_JNS:            this->jns_s(inst);          break;
-          case ID_INS_JO:             this->jo_s(inst);           break;
-          case ID_INS_JP:             this->jp_s(inst);           break;
-          case ID_INS_JS:             this->js_s(inst);           break;
-          case ID_INS_LAHF:           this->lahf_s(inst);         break;
-          case ID_INS_LDDQU:          this->lddqu_s(inst);        break;
-          case ID_INS_LDMXCSR:        this->ldmxcsr_s(inst);      break;
-          case ID_INS_LEA:            this->lea_s(inst);          break;
-          case ID_INS_LEAVE:          this->leave_s(inst);        break;
-          case ID_INS_LFENCE:         this->lfence_s(inst);       break;
-          case ID_INS_LODSB:          this->lodsb_s(inst);        break;
-          case ID_INS_LODSD:          this->lodsd_s(inst);        break;
-          case ID_INS_LODSQ:          this->lodsq_s(inst);        break;
-          case ID_INS_LODSW:          this->lodsw_s(inst);        break;
-          case ID_INS_MFENCE:         this->mfence_s(inst);       break;
-          case ID_INS_MOV:            this->mov_s(inst);          break;
-          case ID_INS_MOVABS:         this->movabs_s(inst);       break;
-          case ID_INS_MOVAPD:         this->movapd_s(inst);       break;
-          case ID_INS_MOVAPS:         this->movaps_s(inst);       break;
-          case ID_INS_MOVD:           this->movd_s(inst);         break;
-          case ID_INS_MOVDDUP:        this->movddup_s(inst);      break;
-          case ID_INS_MOVDQ2Q:        this->movdq2q_s(inst);      break;
-          case ID_INS_MOVDQA:         this->movdqa_s(inst);       break;
-          case ID_INS_MOVDQU:         this->movdqu_s(inst);       break;
-          case ID_INS_MOVHLPS:        this->movhlps_s(inst);      break;
-          case ID_INS_MOVHPD:         this->movhpd_s(inst);       break;
-          case ID_INS_MOVHPS:         this->movhps_s(inst);       break;
-          case ID_INS_MOVLHPS:        this->movlhps_s(inst);      break;
-          case ID_INS_MOVLPD:         this->movlpd_s(inst);       break;
-          case ID_INS_MOVLPS:         this->movlps_s(inst);       break;
-          case ID_INS_MOVMSKPD:       this->movmskpd_s(inst);     break;
-          case ID_INS_MOVMSKPS:       this->movmskps_s(inst);     break;
-          case ID_INS_MOVNTDQ:        this->movntdq_s(inst);      break;
-          case ID_INS_MOVNTI:         this->movnti_s(inst);       break;
-          case ID_INS_MOVNTPD:        this->movntpd_s(inst);      break;
-          case ID_INS_MOVNTPS:        this->movntps_s(inst);      break;
-          case ID_INS_MOVNTQ:         this->movntq_s(inst);       break;
-          case ID_INS_MOVQ2DQ:        this->movq2dq_s(inst);      break;
-          case ID_INS_MOVQ:           this->movq_s(inst);         break;
-          case ID_INS_MOVSB:          this->movsb_s(inst);        break;
-          case ID_INS_MOVSD:          this->movsd_s(inst);        break;
-          case ID_INS_MOVSHDUP:       this->movshdup_s(inst);     break;
-          case ID_INS_MOVSLDUP:       this->movsldup_s(inst);     break;
-          case ID_INS_MOVSQ:          this->movsq_s(inst);        break;
-          case ID_INS_MOVSW:          this->movsw_s(inst);        break;
-          case ID_INS_MOVSX:          this->movsx_s(inst);        break;
-          case ID_INS_MOVSXD:         this->movsxd_s(inst);       break;
-          case ID_INS_MOVUPD:         this->movupd_s(inst);       break;
-          case ID_INS_MOVUPS:         this->movups_s(inst);       break;
-          case ID_INS_MOVZX:          this->movzx_s(inst);        break;
-          case ID_INS_MUL:            this->mul_s(inst);          break;
-          case ID_INS_MULX:           this->mulx_s(inst);         break;
-          case ID_INS_NEG:            this->neg_s(inst);          break;
-          case ID_INS_NOP:            this->nop_s(inst);          break;
-          case ID_INS_NOT:            this->not_s(inst);          break;
-          case ID_INS_OR:             this->or_s(inst);           break;
-          case ID_INS_ORPD:           this->orpd_s(inst);         break;
-          case ID_INS_ORPS:           this->orps_s(inst);         break;
-          case ID_INS_PADDB:          this->paddb_s(inst);        break;
-          case ID_INS_PADDD:          this->paddd_s(inst);        break;
-          case ID_INS_PADDQ:          this->paddq_s(inst);        break;
-          case ID_INS_PADDW:          this->paddw_s(inst);        break;
-          case ID_INS_PAND:           this->pand_s(inst);         break;
-          case ID_INS_PANDN:          this->pandn_s(inst);        break;
-          case ID_INS_PAUSE:          this->pause_s(inst);        break;
-          case ID_INS_PAVGB:          this->pavgb_s(inst);        break;
-          case ID_INS_PAVGW:          this->pavgw_s(inst);        break;
-          case ID_INS_PCMPEQB:        this->pcmpeqb_s(inst);      break;
-          case ID_INS_PCMPEQD:        this->pcmpeqd_s(inst);      break;
-          case ID_INS_PCMPEQW:        this->pcmpeqw_s(inst);      break;
-          case ID_INS_PCMPGTB:        this->pcmpgtb_s(inst);      break;
-          case ID_INS_PCMPGTD:        this->pcmpgtd_s(inst);      break;
-          case ID_INS_PCMPGTW:        this->pcmpgtw_s(inst);      break;
-          case ID_INS_PMAXSB:         this->pmaxsb_s(inst);       break;
-          case ID_INS_PMAXSD:         this->pmaxsd_s(inst);       break;
-          case ID_INS_PMAXSW:         this->pmaxsw_s(inst);       break;
-          case ID_INS_PMAXUB:         this->pmaxub_s(inst);       break;
-          case ID_INS_PMAXUD:         this->pmaxud_s(inst);       break;
-          case ID_INS_PMAXUW:         this->pmaxuw_s(inst);       break;
-          case ID_INS_PMINSB:         this->pminsb_s(inst);       break;
-          case ID_INS_PMINSD:         this->pminsd_s(inst);       break;
-          case ID_INS_PMINSW:         this->pminsw_s(inst);       break;
-          case ID_INS_PMINUB:         this->pminub_s(inst);       break;
-          case ID_INS_PMINUD:         this->pminud_s(inst);       break;
-          case ID_INS_PMINUW:         this->pminuw_s(inst);       break;
-          case ID_INS_PMOVMSKB:       this->pmovmskb_s(inst);     break;
-          case ID_INS_PMOVSXBD:       this->pmovsxbd_s(inst);     break;
-          case ID_INS_PMOVSXBQ:       this->pmovsxbq_s(inst);     break;
-          case ID_INS_PMOVSXBW:       this->pmovsxbw_s(inst);     break;
-          case ID_INS_PMOVSXDQ:       this->pmovsxdq_s(inst);     break;
-          case ID_INS_PMOVSXWD:       this->pmovsxwd_s(inst);     break;
-          case ID_INS_PMOVSXWQ:       this->pmovsxwq_s(inst);     break;
-          case ID_INS_PMOVZXBD:       this->pmovzxbd_s(inst);     break;
-          case ID_INS_PMOVZXBQ:       this->pmovzxbq_s(inst);     break;
-          case ID_INS_PMOVZXBW:       this->pmovzxbw_s(inst);     break;
-          case ID_INS_PMOVZXDQ:       this->pmovzxdq_s(inst);     break;
-          case ID_INS_PMOVZXWD:       this->pmovzxwd_s(inst);     break;
-          case ID_INS_PMOVZXWQ:       this->pmovzxwq_s(inst);     break;
-          case ID_INS_POP:            this->pop_s(inst);          break;
-          case ID_INS_POPAL:          this->popal_s(inst);        break;
-          case ID_INS_POPFD:          this->popfd_s(inst);        break;
-          case ID_INS_POPFQ:          this->popfq_s(inst);        break;
-          case ID_INS_POR:            this->por_s(inst);          break;
-          case ID_INS_PREFETCH:       this->prefetchx_s(inst);    break;
-          case ID_INS_PREFETCHNTA:    this->prefetchx_s(inst);    break;
-          case ID_INS_PREFETCHT0:     this->prefetchx_s(inst);    break;
-          case ID_INS_PREFETCHT1:     this->prefetchx_s(inst);    break;
-          case ID_INS_PREFETCHT2:     this->prefetchx_s(inst);    break;
-          case ID_INS_PREFETCHW:      this->prefetchx_s(inst);    break;
-          case ID_INS_PSHUFD:         this->pshufd_s(inst);       break;
-          case ID_INS_PSHUFHW:        this->pshufhw_s(inst);      break;
-          case ID_INS_PSHUFLW:        this->pshuflw_s(inst);      break;
-          case ID_INS_PSHUFW:         this->pshufw_s(inst);       break;
-          case ID_INS_PSLLDQ:         this->pslldq_s(inst);       break;
-          case ID_INS_PSRLDQ:         this->psrldq_s(inst);       break;
-          case ID_INS_PSUBB:          this->psubb_s(inst);        break;
-          case ID_INS_PSUBD:          this->psubd_s(inst);        break;
-          case ID_INS_PSUBQ:          this->psubq_s(inst);        break;
-          case ID_INS_PSUBW:          this->psubw_s(inst);        break;
-          case ID_INS_PTEST:          this->ptest_s(inst);        break;
-          case ID_INS_PUNPCKHBW:      this->punpckhbw_s(inst);    break;
-          case ID_INS_PUNPCKHDQ:      this->punpckhdq_s(inst);    break;
-          case ID_INS_PUNPCKHQDQ:     this->punpckhqdq_s(inst);   break;
-          case ID_INS_PUNPCKHWD:      this->punpckhwd_s(inst);    break;
-          case ID_INS_PUNPCKLBW:      this->punpcklbw_s(inst);    break;
-          case ID_INS_PUNPCKLDQ:      this->punpckldq_s(inst);    break;
-          case ID_INS_PUNPCKLQDQ:     this->punpcklqdq_s(inst);   break;
-          case ID_INS_PUNPCKLWD:      this->punpcklwd_s(inst);    break;
-          case ID_INS_PUSH:           this->push_s(inst);         break;
-          case ID_INS_PUSHAL:         this->pushal_s(inst);       break;
-          case ID_INS_PUSHFD:         this->pushfd_s(inst);       break;
-          case ID_INS_PUSHFQ:         this->pushfq_s(inst);       break;
-          case ID_INS_PXOR:           this->pxor_s(inst);         break;
-          case ID_INS_RCL:            this->rcl_s(inst);          break;
-          case ID_INS_RCR:            this->rcr_s(inst);          break;
-          case ID_INS_RDTSC:          this->rdtsc_s(inst);        break;
-          case ID_INS_RET:            this->ret_s(inst);          break;
-          case ID_INS_ROL:            this->rol_s(inst);          break;
-          case ID_INS_ROR:            this->ror_s(inst);          break;
-          case ID_INS_RORX:           this->rorx_s(inst);         break;
-          case ID_INS_SAHF:           this->sahf_s(inst);         break;
-          case ID_INS_SAL:            this->shl_s(inst);          break;
-          case ID_INS_SAR:            this->sar_s(inst);          break;
-          case ID_INS_SARX:           this->sarx_s(inst);         break;
-          case ID_INS_SBB:            this->sbb_s(inst);          break;
-          case ID_INS_SCASB:          this->scasb_s(inst);        break;
-          case ID_INS_SCASD:          this->scasd_s(inst);        break;
-          case ID_INS_SCASQ:          this->scasq_s(inst);        break;
-          case ID_INS_SCASW:          this->scasw_s(inst);        break;
-          case ID_INS_SETA:           this->seta_s(inst);         break;
-          case ID_INS_SETAE:          this->setae_s(inst);        break;
-          case ID_INS_SETB:           this->setb_s(inst);         break;
-          case ID_INS_SETBE:          this->setbe_s(inst);        break;
-          case ID_INS_SETE:           this->sete_s(inst);         break;
-          case ID_INS_SETG:           this->setg_s(inst);         break;
-          case ID_INS_SETGE:          this->setge_s(inst);        break;
-          case ID_INS_SETL:           this->setl_s(inst);         break;
-          case ID_INS_SETLE:          this->setle_s(inst);        break;
-          case ID_INS_SETNE:          this->setne_s(inst);        break;
-          case ID_INS_SETNO:          this->setno_s(inst);        break;
-          case ID_INS_SETNP:          this->setnp_s(inst);        break;
-          case ID_INS_SETNS:          this->setns_s(inst);        break;
-          case ID_INS_SETO:           this->seto_s(inst);         break;
-          case ID_INS_SETP:           this->setp_s(inst);         break;
-          case ID_INS_SETS:           this->sets_s(inst);         break;
-          case ID_INS_SFENCE:         this->sfence_s(inst);       break;
-          case ID_INS_SHL:            this->shl_s(inst);          break;
-          case ID_INS_SHLD:           this->shld_s(inst);         break;
-          case ID_INS_SHLX:           this->shlx_s(inst);         break;
-          case ID_INS_SHR:            this->shr_s(inst);          break;
-          case ID_INS_SHRD:           this->shrd_s(inst);         break;
-          case ID_INS_SHRX:           this->shrx_s(inst);         break;
-          case ID_INS_STC:            this->stc_s(inst);          break;
-          case ID_INS_STD:            this->std_s(inst);          break;
-          case ID_INS_STI:            this->sti_s(inst);          break;
-          case ID_INS_STMXCSR:        this->stmxcsr_s(inst);      break;
-          case ID_INS_STOSB:          this->stosb_s(inst);        break;
-          case ID_INS_STOSD:          this->stosd_s(inst);        break;
-          case ID_INS_STOSQ:          this->stosq_s(inst);        break;
-          case ID_INS_STOSW:          this->stosw_s(inst);        break;
-          case ID_INS_SUB:            this->sub_s(inst);          break;
-          case ID_INS_SYSCALL:        this->syscall_s(inst);      break;
-          case ID_INS_TEST:           this->test_s(inst);         break;
-          case ID_INS_TZCNT:          this->tzcnt_s(inst);        break;
-          case ID_INS_UNPCKHPD:       this->unpckhpd_s(inst);     break;
-          case ID_INS_UNPCKHPS:       this->unpckhps_s(inst);     break;
-          case ID_INS_UNPCKLPD:       this->unpcklpd_s(inst);     break;
-          case ID_INS_UNPCKLPS:       this->unpcklps_s(inst);     break;
-          case ID_INS_VMOVDQA:        this->vmovdqa_s(inst);      break;
-          case ID_INS_VMOVDQU:        this->vmovdqu_s(inst);      break;
-          case ID_INS_VPAND:          this->vpand_s(inst);        break;
-          case ID_INS_VPANDN:         this->vpandn_s(inst);       break;
-          case ID_INS_VPOR:           this->vpor_s(inst);         break;
-          case ID_INS_VPTEST:         this->vptest_s(inst);       break;
-          case ID_INS_VPSHUFD:        this->vpshufd_s(inst);      break;
-          case ID_INS_VPXOR:          this->vpxor_s(inst);        break;
-          case ID_INS_WBINVD:         this->wbinvd_s(inst);       break;
-          case ID_INS_XADD:           this->xadd_s(inst);         break;
-          case ID_INS_XCHG:           this->xchg_s(inst);         break;
-          case ID_INS_XOR:            this->xor_s(inst);          break;
-          case ID_INS_XORPD:          this->xorpd_s(inst);        break;
-          case ID_INS_XORPS:          this->xorps_s(inst);        break;
+          case ID_INS_MOVSB: copy = true;  size = BYTE_SIZE;  break;
+          case ID_INS_MOVSW: copy = true;  size = WORD_SIZE;  break;
+          case ID_INS_MOVSD: copy = true;  size = DWORD_SIZE; break;
+          case ID_INS_MOVSQ: copy = true;  size = QWORD_SIZE; break;
+          case ID_INS_STOSB: copy = false; size = BYTE_SIZE;  break;
+          case ID_INS_STOSW: copy = false; size = WORD_SIZE;  break;
+          case ID_INS_STOSD: copy = false; size = DWORD_SIZE; break;
+          case ID_INS_STOSQ: copy = false; size = QWORD_SIZE; break;
+          default:
+            return false;
+        }
+
+        triton::arch::Register pc      = TRITON_X86_REG_PC.getParent();
+        triton::arch::Register counter = TRITON_X86_REG_CX.getParent();
+        triton::arch::Register index1  = TRITON_X86_REG_DI.getParent();
+        triton::arch::Register index2  = TRITON_X86_REG_SI.getParent();
+        triton::arch::Register df      = TRITON_X86_REG_DF;
+        bool symbolic                  = this->symbolicEngine->isEnabled();
+
+        /* The number of iterations and the direction must be concrete */
+        if (symbolic) {
+          this->symbolicEngine->materializeLazyFlag(df);
+          if (this->symbolicEngine->isRegisterSymbolized(counter) || this->symbolicEngine->isRegisterSymbolized(df))
+            return false;
+        }
+
+        triton::uint64 mask  = (counter.getBitSize() == QWORD_SIZE_BIT ? 0xffffffffffffffff : 0xffffffff);
+        triton::uint64 count = this->architecture->getConcreteRegisterValue(counter).convert_to<triton::uint64>();
+        triton::uint64 dst   = this->architecture->getConcreteRegisterValue(index1).convert_to<triton::uint64>();
+        triton::uint64 src   = this->architecture->getConcreteRegisterValue(index2).convert_to<triton::uint64>();
+        bool backward        = (this->architecture->getConcreteRegisterValue(df) != 0);
+        triton::uint64 total = count * size;
+
+        if (count != 0 && total / count != size)
+          return false;
+
+        /* The lowest addresses of the areas, the elements are processed downwards if DF is set */
+        triton::uint64 dstBase = (backward ? dst - (total - size) : dst) & mask;
+        triton::uint64 srcBase = (backward ? src - (total - size) : src) & mask;
+
+        if (count != 0 && copy) {
+          /* An overlapping copy replicates the bytes already copied, it is emulated */
+          if (dstBase < srcBase + total && srcBase < dstBase + total)
+            return false;
+
+          this->architecture->setConcreteMemoryAreaValue(dstBase, this->architecture->getConcreteMemoryAreaValue(srcBase, total));
+          if (symbolic)
+            this->symbolicEngine->copyMemoryReferences(dstBase, srcBase, total);
+          this->taintEngine->taintAssignmentMemoryArea(dstBase, srcBase, total);
+        }
+
+        else if (count != 0) {
+          const triton::arch::Register& accumulator = inst.operands[1].getConstRegister();
+          triton::uint64 value = this->architecture->getConcreteRegisterValue(accumulator).convert_to<triton::uint64>();
+
+          std::vector<triton::uint8> area(total);
+          for (triton::uint64 index = 0; index < total; index++)
+            area[index] = static_cast<triton::uint8>(value >> ((index % size) * BYTE_SIZE_BIT));
+          this->architecture->setConcreteMemoryAreaValue(dstBase, area);
+
+          /* Every element references the same expression of the accumulator */
+          if (symbolic) {
+            this->symbolicEngine->concretizeMemoryArea(dstBase, total);
+            if (this->symbolicEngine->isRegisterSymbolized(accumulator)) {
+              auto expr = this->symbolicEngine->newSymbolicExpression(this->symbolicEngine->buildSymbolicRegister(accumulator), triton::engines::symbolic::MEM, "STOS operation");
+              for (triton::uint64 index = 0; index < total; index += size)
+                this->symbolicEngine->assignSymbolicExpressionToMemory(expr, triton::arch::MemoryAccess(dstBase + index, size));
+            }
+          }
+
+          if (this->taintEngine->isRegisterTainted(accumulator))
+            this->taintEngine->taintMemoryArea(dstBase, total);
+          else
+            this->taintEngine->untaintMemoryArea(dstBase, total);
+        }
+
+        /* The registers after the last iteration, a symbolized index keeps its expression */
+        this->architecture->setConcreteRegisterValue(triton::arch::Register(counter.getId(), 0));
+        this->architecture->setConcreteRegisterValue(triton::arch::Register(pc.getId(), inst.getNextAddress()));
+        if (symbolic) {
+          this->symbolicEngine->concretizeRegister(counter);
+          this->symbolicEngine->concretizeRegister(pc);
+        }
+
+        for (triton::uint32 index = 0; index < (copy ? 2 : 1); index++) {
+          triton::arch::Register& reg = (index == 0 ? index1 : index2);
+
+          if (symbolic && this->symbolicEngine->isRegisterSymbolized(reg)) {
+            auto op   = this->symbolicEngine->buildSymbolicRegister(reg);
+            auto node = (backward ? triton::ast::bvsub(op, triton::ast::bv(total, reg.getBitSize())) : triton::ast::bvadd(op, triton::ast::bv(total, reg.getBitSize())));
+            this->symbolicEngine->createSymbolicRegisterExpression(inst, node, reg, (index == 0 ? "Index (DI) operation" : "Index (SI) operation"));
+            continue;
+          }
+
+          triton::uint64 value = (index == 0 ? dst : src);
+          this->architecture->setConcreteRegisterValue(triton::arch::Register(reg.getId(), (backward ? value - total : value + total) & mask));
+          if (symbolic)
+            this->symbolicEngine->concretizeRegister(reg);
+        }
+
+        this->taintEngine->setTaintRegister(pc, this->taintEngine->isRegisterTainted(counter));
+
+        inst.setTaint(this->taintEngine->isRegisterTainted(pc));
+        return true;
+      }
+
+
+      /*
+       * Returns the number of iterations of a counted loop, the first j >= 1 such that `cond` is false on value + j * stride,
+       * or 0 if the loop may wrap around or never ends. The values are `mask` wide, the order is signed if `isSigned` is true.
+       */
+      static triton::uint64 getLoopTripCount(triton::uint32 cond, bool isSigned, triton::uint64 value, triton::uint64 stride, triton::uint64 limit, triton::uint64 mask) {
+        triton::uint64 bias = (isSigned ? (mask >> 1) + 1 : 0);
+        triton::uint64 half = (mask >> 1) + 1;
+
+        if (stride == 0)
+          return 0;
+
+        /* The value reaches the limit exactly */
+        if (cond == ID_INS_JNE) {
+          triton::uint64 distance = (stride < half ? limit - value : value - limit) & mask;
+          triton::uint64 step     = (stride < half ? stride : (0 - stride) & mask);
+          if (distance == 0 || distance % step != 0)
+            return 0;
+          return distance / step;
+        }
+
+        /* Signed orders are compared as unsigned ones once biased */
+        value = (value + bias) & mask;
+        limit = (limit + bias) & mask;
+
+        switch (cond) {
+          case ID_INS_JBE:
+          case ID_INS_JLE:
+            if (limit == mask)
+              return 0;
+            limit++;
+            cond = ID_INS_JB;
+            break;
+
+          case ID_INS_JAE:
+          case ID_INS_JGE:
+            if (limit == 0)
+              return 0;
+            limit--;
+            cond = ID_INS_JA;
+            break;
+
+          case ID_INS_JL:
+            cond = ID_INS_JB;
+            break;
+
+          case ID_INS_JG:
+            cond = ID_INS_JA;
+            break;
+
+          default:
+            break;
+        }
+
+        /* Upwards while below the limit */
+        if (cond == ID_INS_JB && stride < half) {
+          if (stride > mask - value || stride - 1 > mask - limit)
+            return 0;
+          if (value + stride >= limit)
+            return 1;
+          return (limit - value) / stride + ((limit - value) % stride != 0);
+        }
+
+        /* Downwards while above the limit */
+        if (cond == ID_INS_JA && stride >= half) {
+          stride = (0 - stride) & mask;
+          if (stride > value || stride - 1 > limit)
+            return 0;
+          if (value - stride <= limit)
+            return 1;
+          return (value - limit) / stride + ((value - limit) % stride != 0);
+        }
+
+        return 0;
+      }
+
+
+      bool x86Semantics::buildInductionLoopSemantics(const std::vector<triton::arch::Instruction>& body, triton::usize& iterations) {
+        /* An induction variable gets a constant and loop invariant registers scaled by coefficients at each iteration */
+        struct Induction {
+          triton::arch::Register reg;
+          triton::uint64 constant;
+          std::vector<std::pair<triton::arch::Register, triton::uint64>> invariants;
+        };
+
+        triton::arch::Register stack = TRITON_X86_REG_SP.getParent();
+        triton::arch::Register pc    = TRITON_X86_REG_PC.getParent();
+        std::map<triton::uint32, Induction> inductions;
+        std::vector<triton::arch::Register> invariants;
+        bool symbolic = this->symbolicEngine->isEnabled();
+
+        iterations = 0;
+
+        if (body.size() < 2 || body.size() > 16)
+          return false;
+
+        /* Only the full general purpose registers are followed, their updates wrap at their size */
+        auto isInduction = [&](const triton::arch::OperandWrapper& op) {
+          if (op.getType() != triton::arch::OP_REG)
+            return false;
+          const triton::arch::Register& reg = op.getConstRegister();
+          return (reg.getId() == reg.getParentId() && reg.getSize() == stack.getSize() && !this->architecture->isFlag(reg) && reg.getId() != stack.getId() && reg.getId() != pc.getId());
+        };
+
+        const triton::arch::Instruction& branch = body.back();
+        const triton::arch::Instruction& tested = body[body.size() - 2];
+        triton::uint64 mask  = (stack.getBitSize() == QWORD_SIZE_BIT ? 0xffffffffffffffff : 0xffffffff);
+        triton::uint32 cond  = branch.getType();
+        bool isSigned        = false;
+
+        switch (cond) {
+          case ID_INS_JNE:
+          case ID_INS_JB:
+          case ID_INS_JBE:
+          case ID_INS_JA:
+          case ID_INS_JAE:
+            break;
+          case ID_INS_JL:
+          case ID_INS_JLE:
+          case ID_INS_JG:
+          case ID_INS_JGE:
+            isSigned = true;
+            break;
+          default:
+            return false;
+        }
+
+        /* The body only moves its induction variables by loop invariant amounts, without any memory access */
+        for (triton::usize index = 0; index + 1 < body.size(); index++) {
+          const triton::arch::Instruction& inst = body[index];
+          triton::uint64 constant = 0;
+          triton::uint64 sign     = 1;
+
+          if (inst.getPrefix() != ID_PREFIX_INVALID || inst.operands.empty() || !isInduction(inst.operands[0]))
+            return false;
+
+          /* The comparison only reads the variable, it must come last */
+          if (inst.getType() == ID_INS_CMP || inst.getType() == ID_INS_TEST) {
+            if (index + 2 != body.size())
+              return false;
+            continue;
+          }
+
+          const triton::arch::Register& dst = inst.operands[0].getConstRegister();
+          Induction& induction = inductions[dst.getId()];
+          induction.reg = dst;
+
+          switch (inst.getType()) {
+            case ID_INS_INC:
+              constant = 1;
+              break;
+
+            case ID_INS_DEC:
+              constant = mask;
+              break;
+
+            case ID_INS_ADD:
+            case ID_INS_SUB:
+              sign = (inst.getType() == ID_INS_SUB ? mask : 1);
+              if (inst.operands[1].getType() == triton::arch::OP_IMM) {
+                constant = (sign * inst.operands[1].getConstImmediate().getValue()) & mask;
+                break;
+              }
+              if (!isInduction(inst.operands[1]) || inst.operands[1].getConstRegister().getId() == dst.getId())
+                return false;
+              induction.invariants.push_back(std::make_pair(inst.operands[1].getConstRegister(), sign));
+              invariants.push_back(inst.operands[1].getConstRegister());
+              break;
+
+            case ID_INS_LEA: {
+              const triton::arch::MemoryAccess& mem = inst.operands[1].getConstMemory();
+              if (mem.getConstBaseRegister().getId() != dst.getId() || mem.getConstIndexRegister().isValid() || mem.getConstSegmentRegister().isValid())
+                return false;
+              constant = mem.getConstDisplacement().getValue();
+              break;
+            }
+
+            default:
+              return false;
+          }
+
+          induction.constant = (induction.constant + constant) & mask;
+        }
+
+        /* A loop invariant register is not moved by the body */
+        for (const auto& reg : invariants) {
+          if (inductions.find(reg.getId()) != inductions.end())
+            return false;
+        }
+
+        /* The value compared and the limit */
+        triton::uint64 limit = 0;
+        switch (tested.getType()) {
+          case ID_INS_CMP:
+            if (tested.operands[1].getType() != triton::arch::OP_IMM)
+              return false;
+            limit = tested.operands[1].getConstImmediate().getValue() & mask;
+            break;
+
+          case ID_INS_TEST:
+            if (!isInduction(tested.operands[1]) || tested.operands[1].getConstRegister().getId() != tested.operands[0].getConstRegister().getId() || cond != ID_INS_JNE)
+              return false;
+            break;
+
+          case ID_INS_LEA:
+            return false;
+
           default:
+            /* The flags of the last update, only ZF is meaningful for the loop */
+            if (cond != ID_INS_JNE)
+              return false;
+            break;
+        }
+
+        auto counter = inductions.find(tested.operands[0].getConstRegister().getId());
+        if (counter == inductions.end())
+          return false;
+
+        /* The number of iterations must be concrete */
+        if (symbolic && this->symbolicEngine->isRegisterSymbolized(counter->second.reg))
+          return false;
+
+        triton::uint64 stride = counter->second.constant;
+        for (const auto& invariant : counter->second.invariants) {
+          if (symbolic && this->symbolicEngine->isRegisterSymbolized(invariant.first))
             return false;
+          stride += invariant.second * this->architecture->getConcreteRegisterValue(invariant.first).convert_to<triton::uint64>();
+        }
+
+        triton::uint64 value = this->architecture->getConcreteRegisterValue(counter->second.reg).convert_to<triton::uint64>();
+        triton::uint64 count = getLoopTripCount(cond, isSigned, value, stride & mask, limit, mask);
+        if (count == 0)
+          return false;
+
+        /* The last iteration is processed as usual, it sets the flags and leaves the loop */
+        iterations = count - 1;
+        if (iterations == 0)
+          return true;
+
+        for (auto& entry : inductions) {
+          Induction& induction = entry.second;
+          triton::uint64 last = this->architecture->getConcreteRegisterValue(induction.reg).convert_to<triton::uint64>() + iterations * induction.constant;
+          bool tainted        = this->taintEngine->isRegisterTainted(induction.reg);
+          bool symbolized     = (symbolic && this->symbolicEngine->isRegisterSymbolized(induction.reg));
+
+          for (const auto& invariant : induction.invariants) {
+            last += iterations * invariant.second * this->architecture->getConcreteRegisterValue(invariant.first).convert_to<triton::uint64>();
+            tainted |= this->taintEngine->isRegisterTainted(invariant.first);
+            symbolized |= (symbolic && this->symbolicEngine->isRegisterSymbolized(invariant.first));
+          }
+
+          /* A symbolized variable gets a single expression of its closed form */
+          if (symbolized) {
+            auto node = triton::ast::bvadd(this->symbolicEngine->buildSymbolicRegister(induction.reg), triton::ast::bv((iterations * induction.constant) & mask, induction.reg.getBitSize()));
+            for (const auto& invariant : induction.invariants)
+              node = triton::ast::bvadd(node, triton::ast::bvmul(this->symbolicEngine->buildSymbolicRegister(invariant.first), triton::ast::bv((iterations * invariant.second) & mask, induction.reg.getBitSize())));
+            auto expr = this->symbolicEngine->newSymbolicExpression(node, triton::engines::symbolic::REG, "Loop induction operation");
+            this->symbolicEngine->assignSymbolicExpressionToRegister(expr, induction.reg);
+          }
+
+          this->architecture->setConcreteRegisterValue(triton::arch::Register(induction.reg.getId(), last & mask));
+          if (symbolic && !symbolized)
+            this->symbolicEngine->concretizeRegister(induction.reg);
+
+          this->taintEngine->setTaintRegister(induction.reg, tainted);
+        }
+
+        return true;
+      }
+
+
+      bool x86Semantics::buildNativeSemantics(triton::arch::Instruction& inst) {
+        triton::uint32 type          = inst.getType();
+        triton::arch::Register stack = TRITON_X86_REG_SP.getParent();
+        triton::arch::Register pc    = TRITON_X86_REG_PC.getParent();
+        triton::uint32 stackSize     = stack.getSize();
+        triton::uint64 next          = inst.getNextAddress();
+        bool taken                   = false;
+
+        if (inst.getPrefix() != ID_PREFIX_INVALID)
+          return false;
+
+        /* The flags read by the conditional jumps */
+        std::vector<const triton::arch::Register*> flags;
+        switch (type) {
+          case ID_INS_JA:   flags = {&TRITON_X86_REG_CF, &TRITON_X86_REG_ZF};                     break;
+          case ID_INS_JAE:  flags = {&TRITON_X86_REG_CF};                                         break;
+          case ID_INS_JB:   flags = {&TRITON_X86_REG_CF};                                         break;
+          case ID_INS_JBE:  flags = {&TRITON_X86_REG_CF, &TRITON_X86_REG_ZF};                     break;
+          case ID_INS_JE:   flags = {&TRITON_X86_REG_ZF};                                         break;
+          case ID_INS_JG:   flags = {&TRITON_X86_REG_ZF, &TRITON_X86_REG_SF, &TRITON_X86_REG_OF}; break;
+          case ID_INS_JGE:  flags = {&TRITON_X86_REG_SF, &TRITON_X86_REG_OF};                     break;
+          case ID_INS_JL:   flags = {&TRITON_X86_REG_SF, &TRITON_X86_REG_OF};                     break;
+          case ID_INS_JLE:  flags = {&TRITON_X86_REG_ZF, &TRITON_X86_REG_SF, &TRITON_X86_REG_OF}; break;
+          case ID_INS_JNE:  flags = {&TRITON_X86_REG_ZF};                                         break;
+          case ID_INS_JNO:  flags = {&TRITON_X86_REG_OF};                                         break;
+          case ID_INS_JNP:  flags = {&TRITON_X86_REG_PF};                                         break;
+          case ID_INS_JNS:  flags = {&TRITON_X86_REG_SF};                                         break;
+          case ID_INS_JO:   flags = {&TRITON_X86_REG_OF};                                         break;
+          case ID_INS_JP:   flags = {&TRITON_X86_REG_PF};                                         break;
+          case ID_INS_JS:   flags = {&TRITON_X86_REG_SF};                                         break;
+          default:
+            break;
+        }
+
+        /* The inputs must be concrete */
+        switch (type) {
+          case ID_INS_ADD:
+          case ID_INS_AND:
+          case ID_INS_CMP:
+          case ID_INS_MOV:
+          case ID_INS_MOVSX:
+          case ID_INS_MOVSXD:
+          case ID_INS_MOVZX:
+          case ID_INS_OR:
+          case ID_INS_SUB:
+          case ID_INS_TEST:
+          case ID_INS_XOR:
+            if (inst.operands.size() != 2 || !this->isConcreteOperand_n(inst.operands[0]) || !this->isConcreteOperand_n(inst.operands[1]))
+              return false;
+            break;
+
+          case ID_INS_LEA:
+            if (inst.operands.size() != 2 || !this->isConcreteOperand_n(inst.operands[0]) || !this->isConcreteOperand_n(inst.operands[1], false))
+              return false;
+            break;
+
+          case ID_INS_DEC:
+          case ID_INS_INC:
+          case ID_INS_NEG:
+          case ID_INS_NOT:
+          case ID_INS_JMP:
+            if (inst.operands.size() != 1 || !this->isConcreteOperand_n(inst.operands[0]))
+              return false;
+            break;
+
+          case ID_INS_CALL:
+          case ID_INS_PUSH:
+            if (inst.operands.size() != 1 || !this->isConcreteOperand_n(inst.operands[0]) || !this->isConcreteRegister_n(stack))
+              return false;
+            break;
+
+          /* Intel: pop rsp and a pop into memory compute their destination after the increment of the stack */
+          case ID_INS_POP: {
+            if (inst.operands.size() != 1 || inst.operands[0].getType() != triton::arch::OP_REG || inst.operands[0].getConstRegister().getParentId() == stack.getId())
+              return false;
+            triton::uint64 sp = this->architecture->getConcreteRegisterValue(stack).convert_to<triton::uint64>();
+            if (!this->isConcreteOperand_n(inst.operands[0]) || !this->isConcreteRegister_n(stack) || !this->isConcreteOperand_n(triton::arch::MemoryAccess(sp, inst.operands[0].getSize())))
+              return false;
+            break;
+          }
+
+          case ID_INS_RET: {
+            if (inst.operands.size() > 1)
+              return false;
+            triton::uint64 sp = this->architecture->getConcreteRegisterValue(stack).convert_to<triton::uint64>();
+            if (!this->isConcreteRegister_n(stack) || !this->isConcreteOperand_n(triton::arch::MemoryAccess(sp, stackSize)))
+              return false;
+            break;
+          }
+
+          case ID_INS_NOP:
+            break;
+
+          default:
+            if (flags.empty() || inst.operands.size() != 1 || !this->isConcreteOperand_n(inst.operands[0]))
+              return false;
+            for (auto it = flags.begin(); it != flags.end(); it++) {
+              if (!this->isConcreteRegister_n(**it))
+                return false;
+            }
+            break;
+        }
+
+        /* Executes the instruction */
+        switch (type) {
+          case ID_INS_ADD:
+          case ID_INS_CMP:
+          case ID_INS_SUB: {
+            triton::uint32 bits = inst.operands[0].getBitSize();
+            triton::uint64 mask = (bits >= QWORD_SIZE_BIT ? 0xffffffffffffffff : ((1ULL << bits) - 1));
+            triton::uint64 op1  = this->getConcreteOperand_n(inst.operands[0]);
+            triton::uint64 op2  = this->getConcreteOperand_n(inst.operands[1]) & mask;
+            bool sub            = (type != ID_INS_ADD);
+            triton::uint64 res  = (sub ? op1 - op2 : op1 + op2) & mask;
+            if (type != ID_INS_CMP)
+              this->setConcreteOperand_n(inst.operands[0], res);
+            this->setArithFlags_n(op1, op2, res, bits, sub, true);
+            break;
+          }
+
+          case ID_INS_DEC:
+          case ID_INS_INC:
+          case ID_INS_NEG: {
+            triton::uint32 bits = inst.operands[0].getBitSize();
+            triton::uint64 mask = (bits >= QWORD_SIZE_BIT ? 0xffffffffffffffff : ((1ULL << bits) - 1));
+            triton::uint64 op1  = this->getConcreteOperand_n(inst.operands[0]);
+            if (type == ID_INS_NEG) {
+              triton::uint64 res = (0 - op1) & mask;
+              this->setConcreteOperand_n(inst.operands[0], res);
+              this->setArithFlags_n(0, op1, res, bits, true, true);
+            }
+            else {
+              triton::uint64 res = (type == ID_INS_INC ? op1 + 1 : op1 - 1) & mask;
+              this->setConcreteOperand_n(inst.operands[0], res);
+              this->setArithFlags_n(op1, 1, res, bits, (type == ID_INS_DEC), false);
+            }
+            break;
+          }
+
+          case ID_INS_AND:
+          case ID_INS_OR:
+          case ID_INS_TEST:
+          case ID_INS_XOR: {
+            triton::uint32 bits = inst.operands[0].getBitSize();
+            triton::uint64 mask = (bits >= QWORD_SIZE_BIT ? 0xffffffffffffffff : ((1ULL << bits) - 1));
+            triton::uint64 op1  = this->getConcreteOperand_n(inst.operands[0]);
+            triton::uint64 op2  = this->getConcreteOperand_n(inst.operands[1]) & mask;
+            triton::uint64 res  = (type == ID_INS_OR ? op1 | op2 : type == ID_INS_XOR ? op1 ^ op2 : op1 & op2);
+            if (type != ID_INS_TEST)
+              this->setConcreteOperand_n(inst.operands[0], res);
+            this->setConcreteFlag_n(TRITON_X86_REG_CF, false);
+            this->setConcreteFlag_n(TRITON_X86_REG_OF, false);
+            this->setResultFlags_n(res, bits);
+            break;
+          }
+
+          case ID_INS_NOT: {
+            triton::uint32 bits = inst.operands[0].getBitSize();
+            triton::uint64 mask = (bits >= QWORD_SIZE_BIT ? 0xffffffffffffffff : ((1ULL << bits) - 1));
+            this->setConcreteOperand_n(inst.operands[0], ~this->getConcreteOperand_n(inst.operands[0]) & mask);
+            break;
+          }
+
+          case ID_INS_MOV:
+          case ID_INS_MOVZX:
+            this->setConcreteOperand_n(inst.operands[0], this->getConcreteOperand_n(inst.operands[1]));
+            break;
+
+          case ID_INS_MOVSX:
+          case ID_INS_MOVSXD: {
+            triton::uint32 bits = inst.operands[1].getBitSize();
+            triton::uint64 src  = this->getConcreteOperand_n(inst.operands[1]);
+            if (bits < QWORD_SIZE_BIT && ((src >> (bits - 1)) & 1))
+              src |= ~((1ULL << bits) - 1);
+            this->setConcreteOperand_n(inst.operands[0], src);
+            break;
+          }
+
+          case ID_INS_LEA:
+            this->setConcreteOperand_n(inst.operands[0], inst.operands[1].getConstMemory().getAddress());
+            break;
+
+          case ID_INS_NOP:
+            break;
+
+          case ID_INS_PUSH: {
+            /* An immediate is pushed with the size of the stack */
+            triton::uint32 size = (inst.operands[0].getType() == triton::arch::OP_IMM ? stackSize : inst.operands[0].getSize());
+            triton::uint64 src  = this->getConcreteOperand_n(inst.operands[0]);
+            triton::uint64 sp   = this->architecture->getConcreteRegisterValue(stack).convert_to<triton::uint64>() - size;
+            this->setConcreteRegister_n(stack, sp);
+            this->setConcreteMemory_n(triton::arch::MemoryAccess(sp, size), src);
+            break;
+          }
+
+          case ID_INS_POP: {
+            triton::uint32 size = inst.operands[0].getSize();
+            triton::uint64 sp   = this->architecture->getConcreteRegisterValue(stack).convert_to<triton::uint64>();
+            triton::uint64 dst  = this->architecture->getConcreteMemoryValue(triton::arch::MemoryAccess(sp, size)).convert_to<triton::uint64>();
+            this->setConcreteRegister_n(stack, sp + size);
+            this->setConcreteOperand_n(inst.operands[0], dst);
+            break;
+          }
+
+          case ID_INS_CALL: {
+            triton::uint64 target = this->getConcreteOperand_n(inst.operands[0]);
+            triton::uint64 sp     = this->architecture->getConcreteRegisterValue(stack).convert_to<triton::uint64>() - stackSize;
+            this->setConcreteRegister_n(stack, sp);
+            this->setConcreteMemory_n(triton::arch::MemoryAccess(sp, stackSize), next);
+            next = target;
+            break;
+          }
+
+          case ID_INS_RET: {
+            triton::uint64 sp = this->architecture->getConcreteRegisterValue(stack).convert_to<triton::uint64>();
+            next = this->architecture->getConcreteMemoryValue(triton::arch::MemoryAccess(sp, stackSize)).convert_to<triton::uint64>();
+            sp  += stackSize;
+            if (inst.operands.size() > 0)
+              sp += inst.operands[0].getConstImmediate().getValue();
+            this->setConcreteRegister_n(stack, sp);
+            break;
+          }
+
+          case ID_INS_JMP:
+            next = this->getConcreteOperand_n(inst.operands[0]);
+            inst.setConditionTaken(true);
+            break;
+
+          /* The conditional jumps */
+          default: {
+            bool cf = (this->architecture->getConcreteRegisterValue(TRITON_X86_REG_CF) != 0);
+            bool of = (this->architecture->getConcreteRegisterValue(TRITON_X86_REG_OF) != 0);
+            bool pf = (this->architecture->getConcreteRegisterValue(TRITON_X86_REG_PF) != 0);
+            bool sf = (this->architecture->getConcreteRegisterValue(TRITON_X86_REG_SF) != 0);
+            bool zf = (this->architecture->getConcreteRegisterValue(TRITON_X86_REG_ZF) != 0);
+
+            switch (type) {
+              case ID_INS_JA:  taken = !cf && !zf;       break;
+              case ID_INS_JAE: taken = !cf;              break;
+              case ID_INS_JB:  taken = cf;               break;
+              case ID_INS_JBE: taken = cf || zf;         break;
+              case ID_INS_JE:  taken = zf;               break;
+              case ID_INS_JG:  taken = !zf && sf == of;  break;
+              case ID_INS_JGE: taken = (sf == of);       break;
+              case ID_INS_JL:  taken = (sf != of);       break;
+              case ID_INS_JLE: taken = zf || sf != of;   break;
+              case ID_INS_JNE: taken = !zf;              break;
+              case ID_INS_JNO: taken = !of;              break;
+              case ID_INS_JNP: taken = !pf;              break;
+              case ID_INS_JNS: taken = !sf;              break;
+              case ID_INS_JO:  taken = of;               break;
+              case ID_INS_JP:  taken = pf;               break;
+              case ID_INS_JS:  taken = sf;               break;
+            }
+
+            if (taken)
+              next = this->getConcreteOperand_n(inst.operands[0]);
+            inst.setConditionTaken(taken);
+            break;
+          }
         }
+
+        this->setConcreteRegister_n(pc, next);
+
+        inst.setTaint(triton::engines::taint::UNTAINTED);
         return true;
       }
 
 
+      bool x86Semantics::isConcreteRegister_n(const triton::arch::Register& reg) {
+        if (!reg.isValid())
+          return true;
+
+        /* Only the registers up to 64 bits are executed natively */
+        if (reg.getSize() > QWORD_SIZE)
+          return false;
+
+        if (this->symbolicEngine->isEnabled()) {
+          if (this->architecture->isFlag(reg))
+            this->symbolicEngine->materializeLazyFlag(reg);
+          if (this->symbolicEngine->isRegisterSymbolized(reg))
+            return false;
+        }
+
+        return !this->taintEngine->isRegisterTainted(reg);
+      }
+
+
+      bool x86Semantics::isConcreteOperand_n(const triton::arch::OperandWrapper& op, bool content) {
+        switch (op.getType()) {
+          case triton::arch::OP_IMM:
+            return true;
+
+          case triton::arch::OP_REG:
+            return this->isConcreteRegister_n(op.getConstRegister());
+
+          case triton::arch::OP_MEM: {
+            const triton::arch::MemoryAccess& mem = op.getConstMemory();
+
+            if (!this->isConcreteRegister_n(mem.getConstBaseRegister())  ||
+                !this->isConcreteRegister_n(mem.getConstIndexRegister()) ||
+                !this->isConcreteRegister_n(mem.getConstSegmentRegister()))
+              return false;
+
+            if (!content)
+              return true;
+
+            if (mem.getSize() > QWORD_SIZE || (this->symbolicEngine->isEnabled() && this->symbolicEngine->isMemorySymbolized(mem)))
+              return false;
+
+            return !this->taintEngine->isMemoryTainted(mem);
+          }
+
+          default:
+            return false;
+        }
+      }
+
+
+      triton::uint64 x86Semantics::getConcreteOperand_n(const triton::arch::OperandWrapper& op) const {
+        switch (op.getType()) {
+          case triton::arch::OP_IMM: return op.getConstImmediate().getValue();
+          case triton::arch::OP_REG: return this->architecture->getConcreteRegisterValue(op.getConstRegister()).convert_to<triton::uint64>();
+          case triton::arch::OP_MEM: return this->architecture->getConcreteMemoryValue(op.getConstMemory()).convert_to<triton::uint64>();
+          default:
+            throw triton::exceptions::Semantics("x86Semantics::getConcreteOperand_n(): Invalid operand.");
+        }
+      }
+
+
+      void x86Semantics::setConcreteRegister_n(const triton::arch::Register& reg, triton::uint64 value) {
+        triton::arch::Register dst = reg;
+
+        /* In AMD64, if a reg32 is written, it clears the 32-bit MSB of the corresponding register */
+        if (reg.getSize() == DWORD_SIZE && this->architecture->getArchitecture() == triton::arch::ARCH_X86_64 && reg.getParent().getSize() == QWORD_SIZE)
+          dst = reg.getParent();
+
+        triton::uint32 bits = dst.getBitSize();
+        dst.setConcreteValue(value & (bits >= QWORD_SIZE_BIT ? 0xffffffffffffffff : ((1ULL << bits) - 1)));
+        this->architecture->setConcreteRegisterValue(dst);
+
+        if (this->symbolicEngine->isEnabled())
+          this->symbolicEngine->concretizeRegister(dst);
+        this->taintEngine->setTaintRegister(dst, triton::engines::taint::UNTAINTED);
+      }
+
+
+      void x86Semantics::setConcreteMemory_n(const triton::arch::MemoryAccess& mem, triton::uint64 value) {
+        triton::uint32 bits = mem.getBitSize();
+        this->architecture->setConcreteMemoryValue(triton::arch::MemoryAccess(mem.getAddress(), mem.getSize(), value & (bits >= QWORD_SIZE_BIT ? 0xffffffffffffffff : ((1ULL << bits) - 1))));
+
+        if (this->symbolicEngine->isEnabled())
+          this->symbolicEngine->concretizeMemory(mem);
+        this->taintEngine->setTaintMemory(mem, triton::engines::taint::UNTAINTED);
+      }
+
+
+      void x86Semantics::setConcreteOperand_n(const triton::arch::OperandWrapper& op, triton::uint64 value) {
+        if (op.getType() == triton::arch::OP_REG)
+          this->setConcreteRegister_n(op.getConstRegister(), value);
+        else
+          this->setConcreteMemory_n(op.getConstMemory(), value);
+      }
+
+
+      void x86Semantics::setConcreteFlag_n(const triton::arch::Register& flag, bool value) {
+        triton::arch::Register dst = flag;
+
+        dst.setConcreteValue(value);
+        this->architecture->setConcreteRegisterValue(dst);
+
+        /* The deferred expression of the flag is overwritten */
+        if (this->symbolicEngine->isEnabled()) {
+          this->symbolicEngine->dropLazyFlag(dst);
+          this->symbolicEngine->concretizeRegister(dst);
+        }
+        this->taintEngine->setTaintRegister(dst, triton::engines::taint::UNTAINTED);
+      }
+
+
+      void x86Semantics::setResultFlags_n(triton::uint64 result, triton::uint32 bits) {
+        triton::uint8 low = static_cast<triton::uint8>(result);
+
+        /* pf is set if the least significant byte has an even number of bits set */
+        low ^= low >> 4;
+        low ^= low >> 2;
+        low ^= low >> 1;
+
+        this->setConcreteFlag_n(TRITON_X86_REG_PF, (low & 1) == 0);
+        this->setConcreteFlag_n(TRITON_X86_REG_SF, ((result >> (bits - 1)) & 1) != 0);
+        this->setConcreteFlag_n(TRITON_X86_REG_ZF, result == 0);
+      }
+
+
+      void x86Semantics::setArithFlags_n(triton::uint64 op1, triton::uint64 op2, triton::uint64 result, triton::uint32 bits, bool sub, bool carry) {
+        triton::uint64 overflow = (sub ? (op1 ^ op2) & (op1 ^ result) : (op1 ^ result) & (op2 ^ result));
+
+        this->setConcreteFlag_n(TRITON_X86_REG_AF, ((op1 ^ op2 ^ result) & 0x10) != 0);
+        this->setConcreteFlag_n(TRITON_X86_REG_OF, ((overflow >> (bits - 1)) & 1) != 0);
+        if (carry)
+          this->setConcreteFlag_n(TRITON_X86_REG_CF, (sub ? op1 < op2 : result < op1));
+
+        this->setResultFlags_n(result, bits);
+      }
+
+
       triton::uint64 x86Semantics::alignAddStack_s(triton::arch::Instruction& inst, triton::uint32 delta) {
         auto dst = triton::arch::OperandWrapper(TRITON_X86_REG_SP.getParent());
 
@@ -700,6 +1720,74 @@ namespace triton {
       }
 
 
+      template <triton::uint32 type>
+      triton::ast::AbstractNode* x86Semantics::operand_s(triton::arch::Instruction& inst, triton::arch::OperandWrapper& op) {
+        /* The type is a template parameter, so only one of these branches is compiled in each specialization */
+        if (type == triton::arch::OP_REG)
+          return this->symbolicEngine->buildSymbolicRegister(inst, op.getRegister());
+        if (type == triton::arch::OP_MEM)
+          return this->symbolicEngine->buildSymbolicMemory(inst, op.getMemory());
+        return this->symbolicEngine->buildSymbolicImmediate(inst, op.getImmediate());
+      }
+
+
+      template <triton::uint32 type>
+      triton::engines::symbolic::SymbolicExpression* x86Semantics::assign_s(triton::arch::Instruction& inst,
+                                                                            triton::ast::AbstractNode* node,
+                                                                            triton::arch::OperandWrapper& dst,
+                                                                            const std::string& comment) {
+        if (type == triton::arch::OP_REG)
+          return this->symbolicEngine->createSymbolicRegisterExpression(inst, node, dst.getRegister(), comment);
+        return this->symbolicEngine->createSymbolicMemoryExpression(inst, node, dst.getMemory(), comment);
+      }
+
+
+      template <triton::uint32 type>
+      bool x86Semantics::isTainted_s(const triton::arch::OperandWrapper& op) const {
+        if (type == triton::arch::OP_REG)
+          return this->taintEngine->isRegisterTainted(op.getConstRegister());
+        if (type == triton::arch::OP_MEM)
+          return this->taintEngine->isMemoryTainted(op.getConstMemory());
+        return triton::engines::taint::UNTAINTED;
+      }
+
+
+      template <triton::uint32 dstType, triton::uint32 srcType>
+      bool x86Semantics::taintUnion_s(const triton::arch::OperandWrapper& dst, const triton::arch::OperandWrapper& src) {
+        if (dstType == triton::arch::OP_REG) {
+          if (srcType == triton::arch::OP_REG)
+            return this->taintEngine->taintUnionRegisterRegister(dst.getConstRegister(), src.getConstRegister());
+          if (srcType == triton::arch::OP_MEM)
+            return this->taintEngine->taintUnionRegisterMemory(dst.getConstRegister(), src.getConstMemory());
+          return this->taintEngine->taintUnionRegisterImmediate(dst.getConstRegister());
+        }
+
+        if (srcType == triton::arch::OP_REG)
+          return this->taintEngine->taintUnionMemoryRegister(dst.getConstMemory(), src.getConstRegister());
+        if (srcType == triton::arch::OP_MEM)
+          return this->taintEngine->taintUnionMemoryMemory(dst.getConstMemory(), src.getConstMemory());
+        return this->taintEngine->taintUnionMemoryImmediate(dst.getConstMemory());
+      }
+
+
+      template <triton::uint32 dstType, triton::uint32 srcType>
+      bool x86Semantics::taintAssignment_s(const triton::arch::OperandWrapper& dst, const triton::arch::OperandWrapper& src) {
+        if (dstType == triton::arch::OP_REG) {
+          if (srcType == triton::arch::OP_REG)
+            return this->taintEngine->taintAssignmentRegisterRegister(dst.getConstRegister(), src.getConstRegister());
+          if (srcType == triton::arch::OP_MEM)
+            return this->taintEngine->taintAssignmentRegisterMemory(dst.getConstRegister(), src.getConstMemory());
+          return this->taintEngine->taintAssignmentRegisterImmediate(dst.getConstRegister());
+        }
+
+        if (srcType == triton::arch::OP_REG)
+          return this->taintEngine->taintAssignmentMemoryRegister(dst.getConstMemory(), src.getConstRegister());
+        if (srcType == triton::arch::OP_MEM)
+          return this->taintEngine->taintAssignmentMemoryMemory(dst.getConstMemory(), src.getConstMemory());
+        return this->taintEngine->taintAssignmentMemoryImmediate(dst.getConstMemory());
+      }
+
+
       void x86Semantics::controlFlow_s(triton::arch::Instruction& inst) {
         auto pc      = triton::arch::OperandWrapper(TRITON_X86_REG_PC.getParent());
         auto counter = triton::arch::OperandWrapper(TRITON_X86_REG_CX.getParent());
@@ -810,34 +1898,37 @@ namespace triton {
                               triton::ast::AbstractNode* op2,
                               bool vol) {
 
-        auto bvSize = dst.getBitSize();
-        auto low    = vol ? 0 : dst.getAbstractLow();
-        auto high   = vol ? bvSize-1 : dst.getAbstractHigh();
+        auto bvSize   = dst.getBitSize();
+        auto low      = vol ? 0 : dst.getAbstractLow();
+        auto high     = vol ? bvSize-1 : dst.getAbstractHigh();
+        auto parentId = parent->getId();
 
         /*
          * Create the semantic.
          * af = 0x10 == (0x10 & (regDst ^ op1 ^ op2))
          */
-        auto node = triton::ast::ite(
-                      triton::ast::equal(
-                        triton::ast::bv(0x10, bvSize),
-                        triton::ast::bvand(
-                          triton::ast::bv(0x10, bvSize),
-                          triton::ast::bvxor(
-                            triton::ast::extract(high, low, triton::ast::reference(parent->getId())),
-                            triton::ast::bvxor(op1, op2)
-                          )
-                        )
-                      ),
-                      triton::ast::bv(1, 1),
-                      triton::ast::bv(0, 1)
-                    );
-
-        /* Create the symbolic expression */
-        auto expr = this->symbolicEngine->createSymbolicFlagExpression(inst, node, TRITON_X86_REG_AF, "Adjust flag");
+        auto builder = [=](void) -> triton::ast::AbstractNode* {
+          return triton::ast::ite(
+                   triton::ast::equal(
+                     triton::ast::bv(0x10, bvSize),
+                     triton::ast::bvand(
+                       triton::ast::bv(0x10, bvSize),
+                       triton::ast::bvxor(
+                         triton::ast::extract(high, low, triton::ast::reference(parentId)),
+                         triton::ast::bvxor(op1, op2)
+                       )
+                     )
+                   ),
+                   triton::ast::bv(1, 1),
+                   triton::ast::bv(0, 1)
+                 );
+        };
 
         /* Spread the taint from the parent to the child */
-        expr->isTainted = this->taintEngine->setTaintRegister(TRITON_X86_REG_AF, parent->isTainted);
+        bool isTainted = this->taintEngine->setTaintRegister(TRITON_X86_REG_AF, parent->isTainted);
+
+        /* Create the symbolic expression */
+        this->symbolicEngine->createLazySymbolicFlagExpression(inst, TRITON_X86_REG_AF, parent, {op1, op2}, builder, isTainted, "Adjust flag");
       }
 
 
@@ -885,31 +1976,34 @@ namespace triton {
                                  triton::ast::AbstractNode* op2,
                                  bool vol) {
 
-        auto bvSize = dst.getBitSize();
-        auto low    = vol ? 0 : dst.getAbstractLow();
-        auto high   = vol ? bvSize-1 : dst.getAbstractHigh();
+        auto bvSize   = dst.getBitSize();
+        auto low      = vol ? 0 : dst.getAbstractLow();
+        auto high     = vol ? bvSize-1 : dst.getAbstractHigh();
+        auto parentId = parent->getId();
 
         /*
          * Create the semantic.
          * cf = MSB((op1 & op2) ^ ((op1 ^ op2 ^ parent) & (op1 ^ op2)));
          */
-        auto node = triton::ast::extract(bvSize-1, bvSize-1,
-                      triton::ast::bvxor(
-                        triton::ast::bvand(op1, op2),
-                        triton::ast::bvand(
-                          triton::ast::bvxor(
-                            triton::ast::bvxor(op1, op2),
-                            triton::ast::extract(high, low, triton::ast::reference(parent->getId()))
-                          ),
-                        triton::ast::bvxor(op1, op2))
-                      )
-                    );
-
-        /* Create the symbolic expression */
-        auto expr = this->symbolicEngine->createSymbolicFlagExpression(inst, node, TRITON_X86_REG_CF, "Carry flag");
+        auto builder = [=](void) -> triton::ast::AbstractNode* {
+          return triton::ast::extract(bvSize-1, bvSize-1,
+                   triton::ast::bvxor(
+                     triton::ast::bvand(op1, op2),
+                     triton::ast::bvand(
+                       triton::ast::bvxor(
+                         triton::ast::bvxor(op1, op2),
+                         triton::ast::extract(high, low, triton::ast::reference(parentId))
+                       ),
+                     triton::ast::bvxor(op1, op2))
+                   )
+                 );
+        };
 
         /* Spread the taint from the parent to the child */
-        expr->isTainted = this->taintEngine->setTaintRegister(TRITON_X86_REG_CF, parent->isTainted);
+        bool isTainted = this->taintEngine->setTaintRegister(TRITON_X86_REG_CF, parent->isTainted);
+
+        /* Create the symbolic expression */
+        this->symbolicEngine->createLazySymbolicFlagExpression(inst, TRITON_X86_REG_CF, parent, {op1, op2}, builder, isTainted, "Carry flag");
       }
 
 
@@ -1387,29 +2481,32 @@ namespace triton {
                                  triton::ast::AbstractNode* op2,
                                  bool vol) {
 
-        auto bvSize = dst.getBitSize();
-        auto low    = vol ? 0 : dst.getAbstractLow();
-        auto high   = vol ? bvSize-1 : dst.getAbstractHigh();
+        auto bvSize   = dst.getBitSize();
+        auto low      = vol ? 0 : dst.getAbstractLow();
+        auto high     = vol ? bvSize-1 : dst.getAbstractHigh();
+        auto parentId = parent->getId();
 
         /*
          * Create the semantic.
          * cf = extract(bvSize, bvSize (((op1 ^ op2 ^ res) ^ ((op1 ^ res) & (op1 ^ op2)))))
          */
-        auto node = triton::ast::extract(bvSize-1, bvSize-1,
-                      triton::ast::bvxor(
-                        triton::ast::bvxor(op1, triton::ast::bvxor(op2, triton::ast::extract(high, low, triton::ast::reference(parent->getId())))),
-                        triton::ast::bvand(
-                          triton::ast::bvxor(op1, triton::ast::extract(high, low, triton::ast::reference(parent->getId()))),
-                          triton::ast::bvxor(op1, op2)
-                        )
-                      )
-                    );
-
-        /* Create the symbolic expression */
-        auto expr = this->symbolicEngine->createSymbolicFlagExpression(inst, node, TRITON_X86_REG_CF, "Carry flag");
+        auto builder = [=](void) -> triton::ast::AbstractNode* {
+          return triton::ast::extract(bvSize-1, bvSize-1,
+                   triton::ast::bvxor(
+                     triton::ast::bvxor(op1, triton::ast::bvxor(op2, triton::ast::extract(high, low, triton::ast::reference(parentId)))),
+                     triton::ast::bvand(
+                       triton::ast::bvxor(op1, triton::ast::extract(high, low, triton::ast::reference(parentId))),
+                       triton::ast::bvxor(op1, op2)
+                     )
+                   )
+                 );
+        };
 
         /* Spread the taint from the parent to the child */
-        expr->isTainted = this->taintEngine->setTaintRegister(TRITON_X86_REG_CF, parent->isTainted);
+        bool isTainted = this->taintEngine->setTaintRegister(TRITON_X86_REG_CF, parent->isTainted);
+
+        /* Create the symbolic expression */
+        this->symbolicEngine->createLazySymbolicFlagExpression(inst, TRITON_X86_REG_CF, parent, {op1, op2}, builder, isTainted, "Carry flag");
       }
 
 
@@ -1420,26 +2517,29 @@ namespace triton {
                                  triton::ast::AbstractNode* op2,
                                  bool vol) {
 
-        auto bvSize = dst.getBitSize();
-        auto low    = vol ? 0 : dst.getAbstractLow();
-        auto high   = vol ? bvSize-1 : dst.getAbstractHigh();
+        auto bvSize   = dst.getBitSize();
+        auto low      = vol ? 0 : dst.getAbstractLow();
+        auto high     = vol ? bvSize-1 : dst.getAbstractHigh();
+        auto parentId = parent->getId();
 
         /*
          * Create the semantic.
          * of = MSB((op1 ^ ~op2) & (op1 ^ regDst))
          */
-        auto node = triton::ast::extract(bvSize-1, bvSize-1,
-                      triton::ast::bvand(
-                        triton::ast::bvxor(op1, triton::ast::bvnot(op2)),
-                        triton::ast::bvxor(op1, triton::ast::extract(high, low, triton::ast::reference(parent->getId())))
-                      )
-                    );
-
-        /* Create the symbolic expression */
-        auto expr = this->symbolicEngine->createSymbolicFlagExpression(inst, node, TRITON_X86_REG_OF, "Overflow flag");
+        auto builder = [=](void) -> triton::ast::AbstractNode* {
+          return triton::ast::extract(bvSize-1, bvSize-1,
+                   triton::ast::bvand(
+                     triton::ast::bvxor(op1, triton::ast::bvnot(op2)),
+                     triton::ast::bvxor(op1, triton::ast::extract(high, low, triton::ast::reference(parentId)))
+                   )
+                 );
+        };
 
         /* Spread the taint from the parent to the child */
-        expr->isTainted = this->taintEngine->setTaintRegister(TRITON_X86_REG_OF, parent->isTainted);
+        bool isTainted = this->taintEngine->setTaintRegister(TRITON_X86_REG_OF, parent->isTainted);
+
+        /* Create the symbolic expression */
+        this->symbolicEngine->createLazySymbolicFlagExpression(inst, TRITON_X86_REG_OF, parent, {op1, op2}, builder, isTainted, "Overflow flag");
       }
 
 
@@ -1791,26 +2891,29 @@ namespace triton {
                                  triton::ast::AbstractNode* op2,
                                  bool vol) {
 
-        auto bvSize = dst.getBitSize();
-        auto low    = vol ? 0 : dst.getAbstractLow();
-        auto high   = vol ? bvSize-1 : dst.getAbstractHigh();
+        auto bvSize   = dst.getBitSize();
+        auto low      = vol ? 0 : dst.getAbstractLow();
+        auto high     = vol ? bvSize-1 : dst.getAbstractHigh();
+        auto parentId = parent->getId();
 
         /*
          * Create the semantic.
          * of = high:bool((op1 ^ op2) & (op1 ^ regDst))
          */
-        auto node = triton::ast::extract(bvSize-1, bvSize-1,
-                      triton::ast::bvand(
-                        triton::ast::bvxor(op1, op2),
-                        triton::ast::bvxor(op1, triton::ast::extract(high, low, triton::ast::reference(parent->getId())))
-                      )
-                    );
-
-        /* Create the symbolic expression */
-        auto expr = this->symbolicEngine->createSymbolicFlagExpression(inst, node, TRITON_X86_REG_OF, "Overflow flag");
+        auto builder = [=](void) -> triton::ast::AbstractNode* {
+          return triton::ast::extract(bvSize-1, bvSize-1,
+                   triton::ast::bvand(
+                     triton::ast::bvxor(op1, op2),
+                     triton::ast::bvxor(op1, triton::ast::extract(high, low, triton::ast::reference(parentId)))
+                   )
+                 );
+        };
 
         /* Spread the taint from the parent to the child */
-        expr->isTainted = this->taintEngine->setTaintRegister(TRITON_X86_REG_OF, parent->isTainted);
+        bool isTainted = this->taintEngine->setTaintRegister(TRITON_X86_REG_OF, parent->isTainted);
+
+        /* Create the symbolic expression */
+        this->symbolicEngine->createLazySymbolicFlagExpression(inst, TRITON_X86_REG_OF, parent, {op1, op2}, builder, isTainted, "Overflow flag");
       }
 
 
@@ -1819,8 +2922,9 @@ namespace triton {
                               triton::arch::OperandWrapper& dst,
                               bool vol) {
 
-        auto low    = vol ? 0 : dst.getAbstractLow();
-        auto high   = vol ? BYTE_SIZE_BIT-1 : !low ? BYTE_SIZE_BIT-1 : WORD_SIZE_BIT-1;
+        auto low      = vol ? 0 : dst.getAbstractLow();
+        auto high     = vol ? BYTE_SIZE_BIT-1 : !low ? BYTE_SIZE_BIT-1 : WORD_SIZE_BIT-1;
+        auto parentId = parent->getId();
 
         /*
          * Create the semantics.
@@ -1828,24 +2932,27 @@ namespace triton {
          * pf is set to one if there is an even number of bit set to 1 in the least
          * significant byte of the result.
          */
-        auto node = triton::ast::bv(1, 1);
-        for (triton::uint32 counter = 0; counter <= BYTE_SIZE_BIT-1; counter++) {
-          node = triton::ast::bvxor(
-                   node,
-                   triton::ast::extract(0, 0,
-                     triton::ast::bvlshr(
-                       triton::ast::extract(high, low, triton::ast::reference(parent->getId())),
-                       triton::ast::bv(counter, BYTE_SIZE_BIT)
-                     )
-                  )
-                );
-        }
-
-        /* Create the symbolic expression */
-        auto expr = this->symbolicEngine->createSymbolicFlagExpression(inst, node, TRITON_X86_REG_PF, "Parity flag");
+        auto builder = [=](void) -> triton::ast::AbstractNode* {
+          auto node = triton::ast::bv(1, 1);
+          for (triton::uint32 counter = 0; counter <= BYTE_SIZE_BIT-1; counter++) {
+            node = triton::ast::bvxor(
+                     node,
+                     triton::ast::extract(0, 0,
+                       triton::ast::bvlshr(
+                         triton::ast::extract(high, low, triton::ast::reference(parentId)),
+                         triton::ast::bv(counter, BYTE_SIZE_BIT)
+                       )
+                    )
+                  );
+          }
+          return node;
+        };
 
         /* Spread the taint from the parent to the child */
-        expr->isTainted = this->taintEngine->setTaintRegister(TRITON_X86_REG_PF, parent->isTainted);
+        bool isTainted = this->taintEngine->setTaintRegister(TRITON_X86_REG_PF, parent->isTainted);
+
+        /* Create the symbolic expression */
+        this->symbolicEngine->createLazySymbolicFlagExpression(inst, TRITON_X86_REG_PF, parent, {}, builder, isTainted, "Parity flag");
       }
 
 
@@ -1896,20 +3003,23 @@ namespace triton {
                               triton::arch::OperandWrapper& dst,
                               bool vol) {
 
-        auto bvSize = dst.getBitSize();
-        auto high   = vol ? bvSize-1 : dst.getAbstractHigh();
+        auto bvSize   = dst.getBitSize();
+        auto high     = vol ? bvSize-1 : dst.getAbstractHigh();
+        auto parentId = parent->getId();
 
         /*
          * Create the semantic.
          * sf = high:bool(regDst)
          */
-        auto node = triton::ast::extract(high, high, triton::ast::reference(parent->getId()));
-
-        /* Create the symbolic expression */
-        auto expr = this->symbolicEngine->createSymbolicFlagExpression(inst, node, TRITON_X86_REG_SF, "Sign flag");
+        auto builder = [=](void) -> triton::ast::AbstractNode* {
+          return triton::ast::extract(high, high, triton::ast::reference(parentId));
+        };
 
         /* Spread the taint from the parent to the child */
-        expr->isTainted = this->taintEngine->setTaintRegister(TRITON_X86_REG_SF, parent->isTainted);
+        bool isTainted = this->taintEngine->setTaintRegister(TRITON_X86_REG_SF, parent->isTainted);
+
+        /* Create the symbolic expression */
+        this->symbolicEngine->createLazySymbolicFlagExpression(inst, TRITON_X86_REG_SF, parent, {}, builder, isTainted, "Sign flag");
       }
 
 
@@ -2016,28 +3126,31 @@ namespace triton {
                               triton::arch::OperandWrapper& dst,
                               bool vol) {
 
-        auto bvSize = dst.getBitSize();
-        auto low    = vol ? 0 : dst.getAbstractLow();
-        auto high   = vol ? bvSize-1 : dst.getAbstractHigh();
+        auto bvSize   = dst.getBitSize();
+        auto low      = vol ? 0 : dst.getAbstractLow();
+        auto high     = vol ? bvSize-1 : dst.getAbstractHigh();
+        auto parentId = parent->getId();
 
         /*
          * Create the semantic.
          * zf = 0 == regDst
          */
-        auto node = triton::ast::ite(
-                      triton::ast::equal(
-                        triton::ast::extract(high, low, triton::ast::reference(parent->getId())),
-                        triton::ast::bv(0, bvSize)
-                      ),
-                      triton::ast::bv(1, 1),
-                      triton::ast::bv(0, 1)
-                    );
-
-        /* Create the symbolic expression */
-        auto expr = this->symbolicEngine->createSymbolicFlagExpression(inst, node, TRITON_X86_REG_ZF, "Zero flag");
+        auto builder = [=](void) -> triton::ast::AbstractNode* {
+          return triton::ast::ite(
+                   triton::ast::equal(
+                     triton::ast::extract(high, low, triton::ast::reference(parentId)),
+                     triton::ast::bv(0, bvSize)
+                   ),
+                   triton::ast::bv(1, 1),
+                   triton::ast::bv(0, 1)
+                 );
+        };
 
         /* Spread the taint from the parent to the child */
-        expr->isTainted = this->taintEngine->setTaintRegister(TRITON_X86_REG_ZF, parent->isTainted);
+        bool isTainted = this->taintEngine->setTaintRegister(TRITON_X86_REG_ZF, parent->isTainted);
+
+        /* Create the symbolic expression */
+        this->symbolicEngine->createLazySymbolicFlagExpression(inst, TRITON_X86_REG_ZF, parent, {}, builder, isTainted, "Zero flag");
       }
 
 
@@ -2175,22 +3288,23 @@ namespace triton {
       }
 
 
-      void x86Semantics::add_s(triton::arch::Instruction& inst) {
+      template <triton::uint32 dstType, triton::uint32 srcType>
+      void x86Semantics::addForm_s(triton::arch::Instruction& inst) {
         auto& dst = inst.operands[0];
         auto& src = inst.operands[1];
 
         /* Create symbolic operands */
-        auto op1 = this->symbolicEngine->buildSymbolicOperand(inst, dst);
-        auto op2 = this->symbolicEngine->buildSymbolicOperand(inst, src);
+        auto op1 = this->operand_s<dstType>(inst, dst);
+        auto op2 = this->operand_s<srcType>(inst, src);
 
         /* Create the semantics */
         auto node = triton::ast::bvadd(op1, op2);
 
         /* Create symbolic expression */
-        auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "ADD operation");
+        auto expr = this->assign_s<dstType>(inst, node, dst, "ADD operation");
 
         /* Spread taint */
-        expr->isTainted = this->taintEngine->taintUnion(dst, src);
+        expr->isTainted = this->taintUnion_s<dstType, srcType>(dst, src);
 
         /* Upate symbolic flags */
         this->af_s(inst, expr, dst, op1, op2);
@@ -2205,6 +3319,19 @@ namespace triton {
       }
 
 
+      void x86Semantics::add_s(triton::arch::Instruction& inst) {
+        switch (operandsForm(inst.operands[0].getType(), inst.operands[1].getType())) {
+          case operandsForm(triton::arch::OP_REG, triton::arch::OP_REG): this->addForm_s<triton::arch::OP_REG, triton::arch::OP_REG>(inst); break;
+          case operandsForm(triton::arch::OP_REG, triton::arch::OP_IMM): this->addForm_s<triton::arch::OP_REG, triton::arch::OP_IMM>(inst); break;
+          case operandsForm(triton::arch::OP_REG, triton::arch::OP_MEM): this->addForm_s<triton::arch::OP_REG, triton::arch::OP_MEM>(inst); break;
+          case operandsForm(triton::arch::OP_MEM, triton::arch::OP_REG): this->addForm_s<triton::arch::OP_MEM, triton::arch::OP_REG>(inst); break;
+          case operandsForm(triton::arch::OP_MEM, triton::arch::OP_IMM): this->addForm_s<triton::arch::OP_MEM, triton::arch::OP_IMM>(inst); break;
+          default:
+            throw triton::exceptions::Semantics("x86Semantics::add_s(): Invalid operands.");
+        }
+      }
+
+
       void x86Semantics::and_s(triton::arch::Instruction& inst) {
         auto& dst = inst.operands[0];
         auto& src = inst.operands[1];
@@ -3740,13 +4867,14 @@ namespace triton {
       }
 
 
-      void x86Semantics::cmp_s(triton::arch::Instruction& inst) {
+      template <triton::uint32 dstType, triton::uint32 srcType>
+      void x86Semantics::cmpForm_s(triton::arch::Instruction& inst) {
         auto& dst = inst.operands[0];
         auto& src = inst.operands[1];
 
         /* Create symbolic operands */
-        auto op1 = this->symbolicEngine->buildSymbolicOperand(inst, dst);
-        auto op2 = triton::ast::sx(dst.getBitSize() - src.getBitSize(), this->symbolicEngine->buildSymbolicOperand(inst, src));
+        auto op1 = this->operand_s<dstType>(inst, dst);
+        auto op2 = triton::ast::sx(dst.getBitSize() - src.getBitSize(), this->operand_s<srcType>(inst, src));
 
         /* Create the semantics */
         auto node = triton::ast::bvsub(op1, op2);
@@ -3755,7 +4883,7 @@ namespace triton {
         auto expr = this->symbolicEngine->createSymbolicVolatileExpression(inst, node, "CMP operation");
 
         /* Spread taint */
-        expr->isTainted = this->taintEngine->isTainted(dst) | this->taintEngine->isTainted(src);
+        expr->isTainted = this->isTainted_s<dstType>(dst) | this->isTainted_s<srcType>(src);
 
         /* Upate symbolic flags */
         this->af_s(inst, expr, dst, op1, op2, true);
@@ -3770,6 +4898,19 @@ namespace triton {
       }
 
 
+      void x86Semantics::cmp_s(triton::arch::Instruction& inst) {
+        switch (operandsForm(inst.operands[0].getType(), inst.operands[1].getType())) {
+          case operandsForm(triton::arch::OP_REG, triton::arch::OP_REG): this->cmpForm_s<triton::arch::OP_REG, triton::arch::OP_REG>(inst); break;
+          case operandsForm(triton::arch::OP_REG, triton::arch::OP_IMM): this->cmpForm_s<triton::arch::OP_REG, triton::arch::OP_IMM>(inst); break;
+          case operandsForm(triton::arch::OP_REG, triton::arch::OP_MEM): this->cmpForm_s<triton::arch::OP_REG, triton::arch::OP_MEM>(inst); break;
+          case operandsForm(triton::arch::OP_MEM, triton::arch::OP_REG): this->cmpForm_s<triton::arch::OP_MEM, triton::arch::OP_REG>(inst); break;
+          case operandsForm(triton::arch::OP_MEM, triton::arch::OP_IMM): this->cmpForm_s<triton::arch::OP_MEM, triton::arch::OP_IMM>(inst); break;
+          default:
+            throw triton::exceptions::Semantics("x86Semantics::cmp_s(): Invalid operands.");
+        }
+      }
+
+
       void x86Semantics::cmpsb_s(triton::arch::Instruction& inst) {
         auto& dst    = inst.operands[0];
         auto& src    = inst.operands[1];
@@ -5457,7 +6598,7 @@ namespace triton {
           op3 = triton::ast::bv(0, leaSize);
 
         /* Base with PC */
-        if (this->architecture->isRegisterValid(srcBase) && (srcBase.getParent().getId() == TRITON_X86_REG_PC.getId()))
+        if (this->architecture->isRegisterValid(srcBase) && (srcBase.getParentId() == TRITON_X86_REG_PC.getId()))
           op3 = triton::ast::bvadd(op3, triton::ast::bv(inst.getSize(), leaSize));
 
         /* Index */
@@ -5486,7 +6627,7 @@ namespace triton {
         auto expr = this->symbolicEngine->createSymbolicRegisterExpression(inst, node, dst, "LEA operation");
 
         /* Spread taint */
-        expr->isTainted = this->taintEngine->setTaint(dst, this->taintEngine->isTainted(srcBase) | this->taintEngine->isTainted(srcIndex));
+        expr->isTainted = this->taintEngine->setTaintRegister(dst, this->taintEngine->isRegisterTainted(srcBase) | this->taintEngine->isRegisterTainted(srcIndex));
 
         /* Upate the symbolic control flow */
         this->controlFlow_s(inst);
@@ -5673,12 +6814,13 @@ namespace triton {
       }
 
 
-      void x86Semantics::mov_s(triton::arch::Instruction& inst) {
+      template <triton::uint32 dstType, triton::uint32 srcType>
+      void x86Semantics::movForm_s(triton::arch::Instruction& inst) {
         auto& dst = inst.operands[0];
         auto& src = inst.operands[1];
 
         /* Create the semantics */
-        auto node = this->symbolicEngine->buildSymbolicOperand(inst, src);
+        auto node = this->operand_s<srcType>(inst, src);
 
         /*
          * Special cases:
@@ -5689,7 +6831,7 @@ namespace triton {
          *
          * The code below, handles the case: MOV r/m{16/32/64}, Sreg
          */
-        if (src.getType() == triton::arch::OP_REG) {
+        if (srcType == triton::arch::OP_REG) {
           uint32 id = src.getConstRegister().getId();
           if (id >= triton::arch::x86::ID_REG_CS && id <= triton::arch::x86::ID_REG_SS) {
             node = triton::ast::extract(dst.getBitSize()-1, 0, node);
@@ -5699,7 +6841,7 @@ namespace triton {
         /*
          * The code below, handles the case: MOV Sreg, r/m{16/32/64}
          */
-        if (dst.getType() == triton::arch::OP_REG) {
+        if (dstType == triton::arch::OP_REG) {
           uint32 id = dst.getConstRegister().getId();
           if (id >= triton::arch::x86::ID_REG_CS && id <= triton::arch::x86::ID_REG_SS) {
             node = triton::ast::extract(WORD_SIZE_BIT-1, 0, node);
@@ -5707,16 +6849,29 @@ namespace triton {
         }
 
         /* Create symbolic expression */
-        auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "MOV operation");
+        auto expr = this->assign_s<dstType>(inst, node, dst, "MOV operation");
 
         /* Spread taint */
-        expr->isTainted = this->taintEngine->taintAssignment(dst, src);
+        expr->isTainted = this->taintAssignment_s<dstType, srcType>(dst, src);
 
         /* Upate the symbolic control flow */
         this->controlFlow_s(inst);
       }
 
 
+      void x86Semantics::mov_s(triton::arch::Instruction& inst) {
+        switch (operandsForm(inst.operands[0].getType(), inst.operands[1].getType())) {
+          case operandsForm(triton::arch::OP_REG, triton::arch::OP_REG): this->movForm_s<triton::arch::OP_REG, triton::arch::OP_REG>(inst); break;
+          case operandsForm(triton::arch::OP_REG, triton::arch::OP_IMM): this->movForm_s<triton::arch::OP_REG, triton::arch::OP_IMM>(inst); break;
+          case operandsForm(triton::arch::OP_REG, triton::arch::OP_MEM): this->movForm_s<triton::arch::OP_REG, triton::arch::OP_MEM>(inst); break;
+          case operandsForm(triton::arch::OP_MEM, triton::arch::OP_REG): this->movForm_s<triton::arch::OP_MEM, triton::arch::OP_REG>(inst); break;
+          case operandsForm(triton::arch::OP_MEM, triton::arch::OP_IMM): this->movForm_s<triton::arch::OP_MEM, triton::arch::OP_IMM>(inst); break;
+          default:
+            throw triton::exceptions::Semantics("x86Semantics::mov_s(): Invalid operands.");
+        }
+      }
+
+
       void x86Semantics::movabs_s(triton::arch::Instruction& inst) {
         auto& dst = inst.operands[0];
         auto& src = inst.operands[1];
@@ -6922,39 +8077,10 @@ namespace triton {
         auto op2 = this->symbolicEngine->buildSymbolicOperand(inst, src);
 
         /* Create the semantics */
-        std::list<triton::ast::AbstractNode*> packed;
-
-        switch (dst.getBitSize()) {
-
-          /* XMM */
-          case DQWORD_SIZE_BIT:
-            packed.push_back(triton::ast::bvadd(triton::ast::extract(127, 120, op1), triton::ast::extract(127, 120, op2)));
-            packed.push_back(triton::ast::bvadd(triton::ast::extract(119, 112, op1), triton::ast::extract(119, 112, op2)));
-            packed.push_back(triton::ast::bvadd(triton::ast::extract(111, 104, op1), triton::ast::extract(111, 104, op2)));
-            packed.push_back(triton::ast::bvadd(triton::ast::extract(103, 96,  op1), triton::ast::extract(103, 96,  op2)));
-            packed.push_back(triton::ast::bvadd(triton::ast::extract(95,  88,  op1), triton::ast::extract(95,  88,  op2)));
-            packed.push_back(triton::ast::bvadd(triton::ast::extract(87,  80,  op1), triton::ast::extract(87,  80,  op2)));
-            packed.push_back(triton::ast::bvadd(triton::ast::extract(79,  72,  op1), triton::ast::extract(79,  72,  op2)));
-            packed.push_back(triton::ast::bvadd(triton::ast::extract(71,  64,  op1), triton::ast::extract(71,  64,  op2)));
-
-          /* MMX */
-          case QWORD_SIZE_BIT:
-            packed.push_back(triton::ast::bvadd(triton::ast::extract(63,  56,  op1), triton::ast::extract(63,  56,  op2)));
-            packed.push_back(triton::ast::bvadd(triton::ast::extract(55,  48,  op1), triton::ast::extract(55,  48,  op2)));
-            packed.push_back(triton::ast::bvadd(triton::ast::extract(47,  40,  op1), triton::ast::extract(47,  40,  op2)));
-            packed.push_back(triton::ast::bvadd(triton::ast::extract(39,  32,  op1), triton::ast::extract(39,  32,  op2)));
-            packed.push_back(triton::ast::bvadd(triton::ast::extract(31,  24,  op1), triton::ast::extract(31,  24,  op2)));
-            packed.push_back(triton::ast::bvadd(triton::ast::extract(23,  16,  op1), triton::ast::extract(23,  16,  op2)));
-            packed.push_back(triton::ast::bvadd(triton::ast::extract(15,  8,   op1), triton::ast::extract(15,  8,   op2)));
-            packed.push_back(triton::ast::bvadd(triton::ast::extract(7,   0,   op1), triton::ast::extract(7,   0,   op2)));
-            break;
-
-          default:
-            throw triton::exceptions::Semantics("x86Semantics::paddb_s(): Invalid operand size.");
-
-        }
+        if (dst.getBitSize() != DQWORD_SIZE_BIT && dst.getBitSize() != QWORD_SIZE_BIT)
+          throw triton::exceptions::Semantics("x86Semantics::paddb_s(): Invalid operand size.");
 
-        auto node = triton::ast::concat(packed);
+        auto node = triton::ast::vadd(BYTE_SIZE_BIT, op1, op2);
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "PADDB operation");
@@ -6976,27 +8102,10 @@ namespace triton {
         auto op2 = this->symbolicEngine->buildSymbolicOperand(inst, src);
 
         /* Create the semantics */
-        std::list<triton::ast::AbstractNode*> packed;
-
-        switch (dst.getBitSize()) {
-
-          /* XMM */
-          case DQWORD_SIZE_BIT:
-            packed.push_back(triton::ast::bvadd(triton::ast::extract(127, 96, op1), triton::ast::extract(127, 96, op2)));
-            packed.push_back(triton::ast::bvadd(triton::ast::extract(95,  64, op1), triton::ast::extract(95,  64, op2)));
-
-          /* MMX */
-          case QWORD_SIZE_BIT:
-            packed.push_back(triton::ast::bvadd(triton::ast::extract(63,  32, op1), triton::ast::extract(63,  32, op2)));
-            packed.push_back(triton::ast::bvadd(triton::ast::extract(31,  0,  op1), triton::ast::extract(31,  0,  op2)));
-            break;
+        if (dst.getBitSize() != DQWORD_SIZE_BIT && dst.getBitSize() != QWORD_SIZE_BIT)
+          throw triton::exceptions::Semantics("x86Semantics::paddd_s(): Invalid operand size.");
 
-          default:
-            throw triton::exceptions::Semantics("x86Semantics::paddd_s(): Invalid operand size.");
-
-        }
-
-        auto node = triton::ast::concat(packed);
+        auto node = triton::ast::vadd(DWORD_SIZE_BIT, op1, op2);
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "PADDD operation");
@@ -7018,25 +8127,10 @@ namespace triton {
         auto op2 = this->symbolicEngine->buildSymbolicOperand(inst, src);
 
         /* Create the semantics */
-        std::list<triton::ast::AbstractNode*> packed;
-
-        switch (dst.getBitSize()) {
-
-          /* XMM */
-          case DQWORD_SIZE_BIT:
-            packed.push_back(triton::ast::bvadd(triton::ast::extract(127, 64, op1), triton::ast::extract(127, 64, op2)));
-
-          /* MMX */
-          case QWORD_SIZE_BIT:
-            packed.push_back(triton::ast::bvadd(triton::ast::extract(63,  0,  op1), triton::ast::extract(63,  0,  op2)));
-            break;
-
-          default:
-            throw triton::exceptions::Semantics("x86Semantics::paddq_s(): Invalid operand size.");
-
-        }
+        if (dst.getBitSize() != DQWORD_SIZE_BIT && dst.getBitSize() != QWORD_SIZE_BIT)
+          throw triton::exceptions::Semantics("x86Semantics::paddq_s(): Invalid operand size.");
 
-        auto node = triton::ast::concat(packed);
+        auto node = triton::ast::vadd(QWORD_SIZE_BIT, op1, op2);
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "PADDQ operation");
@@ -7058,31 +8152,10 @@ namespace triton {
         auto op2 = this->symbolicEngine->buildSymbolicOperand(inst, src);
 
         /* Create the semantics */
-        std::list<triton::ast::AbstractNode*> packed;
-
-        switch (dst.getBitSize()) {
-
-          /* XMM */
-          case DQWORD_SIZE_BIT:
-            packed.push_back(triton::ast::bvadd(triton::ast::extract(127, 112, op1), triton::ast::extract(127, 112, op2)));
-            packed.push_back(triton::ast::bvadd(triton::ast::extract(111, 96,  op1), triton::ast::extract(111, 96,  op2)));
-            packed.push_back(triton::ast::bvadd(triton::ast::extract(95,  80,  op1), triton::ast::extract(95,  80,  op2)));
-            packed.push_back(triton::ast::bvadd(triton::ast::extract(79,  64,  op1), triton::ast::extract(79,  64,  op2)));
-
-          /* MMX */
-          case QWORD_SIZE_BIT:
-            packed.push_back(triton::ast::bvadd(triton::ast::extract(63,  48,  op1), triton::ast::extract(63,  48,  op2)));
-            packed.push_back(triton::ast::bvadd(triton::ast::extract(47,  32,  op1), triton::ast::extract(47,  32,  op2)));
-            packed.push_back(triton::ast::bvadd(triton::ast::extract(31,  16,  op1), triton::ast::extract(31,  16,  op2)));
-            packed.push_back(triton::ast::bvadd(triton::ast::extract(15,  0,   op1), triton::ast::extract(15,  0,   op2)));
-            break;
-
-          default:
-            throw triton::exceptions::Semantics("x86Semantics::paddw_s(): Invalid operand size.");
+        if (dst.getBitSize() != DQWORD_SIZE_BIT && dst.getBitSize() != QWORD_SIZE_BIT)
+          throw triton::exceptions::Semantics("x86Semantics::paddw_s(): Invalid operand size.");
 
-        }
-
-        auto node = triton::ast::concat(packed);
+        auto node = triton::ast::vadd(WORD_SIZE_BIT, op1, op2);
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "PADDW operation");
@@ -7240,20 +8313,7 @@ namespace triton {
         auto op2 = this->symbolicEngine->buildSymbolicOperand(inst, src);
 
         /* Create the semantics */
-        std::list<triton::ast::AbstractNode *> pck;
-        for (triton::uint32 index = 0; index < dst.getSize(); index++) {
-          uint32 high = (dst.getBitSize() - 1) - (index * BYTE_SIZE_BIT);
-          uint32 low  = (dst.getBitSize() - BYTE_SIZE_BIT) - (index * BYTE_SIZE_BIT);
-          pck.push_back(triton::ast::ite(
-                          triton::ast::equal(
-                            triton::ast::extract(high, low, op1),
-                            triton::ast::extract(high, low, op2)),
-                          triton::ast::bv(0xff, BYTE_SIZE_BIT),
-                          triton::ast::bv(0x00, BYTE_SIZE_BIT))
-                       );
-        }
-
-        auto node = triton::ast::concat(pck);
+        auto node = triton::ast::veq(BYTE_SIZE_BIT, op1, op2);
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "PCMPEQB operation");
@@ -7275,20 +8335,7 @@ namespace triton {
         auto op2 = this->symbolicEngine->buildSymbolicOperand(inst, src);
 
         /* Create the semantics */
-        std::list<triton::ast::AbstractNode *> pck;
-        for (triton::uint32 index = 0; index < dst.getSize() / DWORD_SIZE; index++) {
-          uint32 high = (dst.getBitSize() - 1) - (index * DWORD_SIZE_BIT);
-          uint32 low  = (dst.getBitSize() - DWORD_SIZE_BIT) - (index * DWORD_SIZE_BIT);
-          pck.push_back(triton::ast::ite(
-                          triton::ast::equal(
-                            triton::ast::extract(high, low, op1),
-                            triton::ast::extract(high, low, op2)),
-                          triton::ast::bv(0xffffffff, DWORD_SIZE_BIT),
-                          triton::ast::bv(0x00000000, DWORD_SIZE_BIT))
-                       );
-        }
-
-        auto node = triton::ast::concat(pck);
+        auto node = triton::ast::veq(DWORD_SIZE_BIT, op1, op2);
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "PCMPEQD operation");
@@ -7310,20 +8357,7 @@ namespace triton {
         auto op2 = this->symbolicEngine->buildSymbolicOperand(inst, src);
 
         /* Create the semantics */
-        std::list<triton::ast::AbstractNode *> pck;
-        for (triton::uint32 index = 0; index < dst.getSize() / WORD_SIZE; index++) {
-          uint32 high = (dst.getBitSize() - 1) - (index * WORD_SIZE_BIT);
-          uint32 low  = (dst.getBitSize() - WORD_SIZE_BIT) - (index * WORD_SIZE_BIT);
-          pck.push_back(triton::ast::ite(
-                          triton::ast::equal(
-                            triton::ast::extract(high, low, op1),
-                            triton::ast::extract(high, low, op2)),
-                          triton::ast::bv(0xffff, WORD_SIZE_BIT),
-                          triton::ast::bv(0x0000, WORD_SIZE_BIT))
-                       );
-        }
-
-        auto node = triton::ast::concat(pck);
+        auto node = triton::ast::veq(WORD_SIZE_BIT, op1, op2);
 
         /* Create symbolic expression */
         auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "PCMPEQW operation");
@@ -8241,7 +9275,8 @@ namespace triton {
       }
 
 
-      void x86Semantics::pop_s(triton::arch::Instruction& inst) {
+      template <triton::uint32 dstType>
+      void x86Semantics::popForm_s(triton::arch::Instruction& inst) {
         bool  stackRelative = false;
         auto  stack         = TRITON_X86_REG_SP.getParent();
         auto  stackValue    = this->architecture->getConcreteRegisterValue(stack).convert_to<triton::uint64>();
@@ -8249,7 +9284,7 @@ namespace triton {
         auto  src           = triton::arch::OperandWrapper(triton::arch::MemoryAccess(stackValue, dst.getSize()));
 
         /* Create symbolic operands */
-        auto op1 = this->symbolicEngine->buildSymbolicOperand(inst, src);
+        auto op1 = this->operand_s<triton::arch::OP_MEM>(inst, src);
 
         /* Create the semantics */
         auto node = op1;
@@ -8261,8 +9296,8 @@ namespace triton {
          * memory, the POP instruction computes the effective address of the operand after it increments
          * the ESP register.
          */
-        if (dst.getType() == triton::arch::OP_MEM) {
-          if (dst.getMemory().getBaseRegister().getParent().getId() == stack.getId()) {
+        if (dstType == triton::arch::OP_MEM) {
+          if (dst.getMemory().getBaseRegister().getParentId() == stack.getId()) {
             /* Align the stack */
             alignAddStack_s(inst, src.getSize());
 
@@ -8274,10 +9309,10 @@ namespace triton {
         }
 
         /* Create symbolic expression */
-        auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "POP operation");
+        auto expr = this->assign_s<dstType>(inst, node, dst, "POP operation");
 
         /* Spread taint */
-        expr->isTainted = this->taintEngine->taintAssignment(dst, src);
+        expr->isTainted = this->taintAssignment_s<dstType, triton::arch::OP_MEM>(dst, src);
 
         /* Create the semantics - side effect */
         if (!stackRelative)
@@ -8288,6 +9323,16 @@ namespace triton {
       }
 
 
+      void x86Semantics::pop_s(triton::arch::Instruction& inst) {
+        switch (inst.operands[0].getType()) {
+          case triton::arch::OP_REG: this->popForm_s<triton::arch::OP_REG>(inst); break;
+          case triton::arch::OP_MEM: this->popForm_s<triton::arch::OP_MEM>(inst); break;
+          default:
+            throw triton::exceptions::Semantics("x86Semantics::pop_s(): Invalid operand.");
+        }
+      }
+
+
       void x86Semantics::popal_s(triton::arch::Instruction& inst) {
         auto stack      = TRITON_X86_REG_SP.getParent();
         auto stackValue = this->architecture->getConcreteRegisterValue(stack).convert_to<triton::uint64>();
@@ -9437,13 +10482,14 @@ namespace triton {
       }
 
 
-      void x86Semantics::push_s(triton::arch::Instruction& inst) {
+      template <triton::uint32 srcType>
+      void x86Semantics::pushForm_s(triton::arch::Instruction& inst) {
         auto& src           = inst.operands[0];
         auto stack          = TRITON_X86_REG_SP.getParent();
         triton::uint32 size = stack.getSize();
 
         /* If it's an immediate source, the memory access is always based on the arch size */
-        if (src.getType() != triton::arch::OP_IMM)
+        if (srcType != triton::arch::OP_IMM)
           size = src.getSize();
 
         /* Create the semantics - side effect */
@@ -9451,22 +10497,33 @@ namespace triton {
         auto  dst        = triton::arch::OperandWrapper(triton::arch::MemoryAccess(stackValue, size));
 
         /* Create symbolic operands */
-        auto op1 = this->symbolicEngine->buildSymbolicOperand(inst, src);
+        auto op1 = this->operand_s<srcType>(inst, src);
 
         /* Create the semantics */
         auto node = triton::ast::zx(dst.getBitSize() - src.getBitSize(), op1);
 
         /* Create symbolic expression */
-        auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "PUSH operation");
+        auto expr = this->assign_s<triton::arch::OP_MEM>(inst, node, dst, "PUSH operation");
 
         /* Spread taint */
-        expr->isTainted = this->taintEngine->taintAssignment(dst, src);
+        expr->isTainted = this->taintAssignment_s<triton::arch::OP_MEM, srcType>(dst, src);
 
         /* Upate the symbolic control flow */
         this->controlFlow_s(inst);
       }
 
 
+      void x86Semantics::push_s(triton::arch::Instruction& inst) {
+        switch (inst.operands[0].getType()) {
+          case triton::arch::OP_REG: this->pushForm_s<triton::arch::OP_REG>(inst); break;
+          case triton::arch::OP_MEM: this->pushForm_s<triton::arch::OP_MEM>(inst); break;
+          case triton::arch::OP_IMM: this->pushForm_s<triton::arch::OP_IMM>(inst); break;
+          default:
+            throw triton::exceptions::Semantics("x86Semantics::push_s(): Invalid operand.");
+        }
+      }
+
+
       void x86Semantics::pushal_s(triton::arch::Instruction& inst) {
         auto stack      = TRITON_X86_REG_SP.getParent();
         auto stackValue = this->architecture->getConcreteRegisterValue(stack).convert_to<triton::uint64>();
@@ -9834,7 +10891,7 @@ namespace triton {
 
         /* Create symbolic operands */
         auto op1 = triton::ast::bv(0, dst1.getBitSize());
-        auto op2 = triton::ast::bv(this->symbolicEngine->getSymbolicExpressions().size(), dst2.getBitSize());
+        auto op2 = triton::ast::bv(this->symbolicEngine->getNumberOfSymbolicExpressions(), dst2.getBitSize());
 
         /* Create symbolic expression */
         auto expr1 = this->symbolicEngine->createSymbolicExpression(inst, op1, dst1, "RDTSC EDX operation");
@@ -11330,22 +12387,23 @@ namespace triton {
       }
 
 
-      void x86Semantics::sub_s(triton::arch::Instruction& inst) {
+      template <triton::uint32 dstType, triton::uint32 srcType>
+      void x86Semantics::subForm_s(triton::arch::Instruction& inst) {
         auto& dst = inst.operands[0];
         auto& src = inst.operands[1];
 
         /* Create symbolic operands */
-        auto op1 = this->symbolicEngine->buildSymbolicOperand(inst, dst);
-        auto op2 = this->symbolicEngine->buildSymbolicOperand(inst, src);
+        auto op1 = this->operand_s<dstType>(inst, dst);
+        auto op2 = this->operand_s<srcType>(inst, src);
 
         /* Create the semantics */
         auto node = triton::ast::bvsub(op1, op2);
 
         /* Create symbolic expression */
-        auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "SUB operation");
+        auto expr = this->assign_s<dstType>(inst, node, dst, "SUB operation");
 
         /* Spread taint */
-        expr->isTainted = this->taintEngine->taintUnion(dst, src);
+        expr->isTainted = this->taintUnion_s<dstType, srcType>(dst, src);
 
         /* Upate symbolic flags */
         this->af_s(inst, expr, dst, op1, op2);
@@ -11360,6 +12418,19 @@ namespace triton {
       }
 
 
+      void x86Semantics::sub_s(triton::arch::Instruction& inst) {
+        switch (operandsForm(inst.operands[0].getType(), inst.operands[1].getType())) {
+          case operandsForm(triton::arch::OP_REG, triton::arch::OP_REG): this->subForm_s<triton::arch::OP_REG, triton::arch::OP_REG>(inst); break;
+          case operandsForm(triton::arch::OP_REG, triton::arch::OP_IMM): this->subForm_s<triton::arch::OP_REG, triton::arch::OP_IMM>(inst); break;
+          case operandsForm(triton::arch::OP_REG, triton::arch::OP_MEM): this->subForm_s<triton::arch::OP_REG, triton::arch::OP_MEM>(inst); break;
+          case operandsForm(triton::arch::OP_MEM, triton::arch::OP_REG): this->subForm_s<triton::arch::OP_MEM, triton::arch::OP_REG>(inst); break;
+          case operandsForm(triton::arch::OP_MEM, triton::arch::OP_IMM): this->subForm_s<triton::arch::OP_MEM, triton::arch::OP_IMM>(inst); break;
+          default:
+            throw triton::exceptions::Semantics("x86Semantics::sub_s(): Invalid operands.");
+        }
+      }
+
+
       void x86Semantics::syscall_s(triton::arch::Instruction& inst) {
         auto dst1 = triton::arch::OperandWrapper(TRITON_X86_REG_RCX);
         auto dst2 = triton::arch::OperandWrapper(TRITON_X86_REG_R11);
@@ -12075,22 +13146,23 @@ namespace triton {
       }
 
 
-      void x86Semantics::xor_s(triton::arch::Instruction& inst) {
+      template <triton::uint32 dstType, triton::uint32 srcType>
+      void x86Semantics::xorForm_s(triton::arch::Instruction& inst) {
         auto& dst = inst.operands[0];
         auto& src = inst.operands[1];
 
         /* Create symbolic operands */
-        auto op1 = this->symbolicEngine->buildSymbolicOperand(inst, dst);
-        auto op2 = this->symbolicEngine->buildSymbolicOperand(inst, src);
+        auto op1 = this->operand_s<dstType>(inst, dst);
+        auto op2 = this->operand_s<srcType>(inst, src);
 
         /* Create the semantics */
         auto node = triton::ast::bvxor(op1, op2);
 
         /* Create symbolic expression */
-        auto expr = this->symbolicEngine->createSymbolicExpression(inst, node, dst, "XOR operation");
+        auto expr = this->assign_s<dstType>(inst, node, dst, "XOR operation");
 
         /* Spread taint */
-        expr->isTainted = this->taintEngine->taintUnion(dst, src);
+        expr->isTainted = this->taintUnion_s<dstType, srcType>(dst, src);
 
         /* Upate symbolic flags */
         this->clearFlag_s(inst, TRITON_X86_REG_CF, "Clears carry flag");
@@ -12104,6 +13176,19 @@ namespace triton {
       }
 
 
+      void x86Semantics::xor_s(triton::arch::Instruction& inst) {
+        switch (operandsForm(inst.operands[0].getType(), inst.operands[1].getType())) {
+          case operandsForm(triton::arch::OP_REG, triton::arch::OP_REG): this->xorForm_s<triton::arch::OP_REG, triton::arch::OP_REG>(inst); break;
+          case operandsForm(triton::arch::OP_REG, triton::arch::OP_IMM): this->xorForm_s<triton::arch::OP_REG, triton::arch::OP_IMM>(inst); break;
+          case operandsForm(triton::arch::OP_REG, triton::arch::OP_MEM): this->xorForm_s<triton::arch::OP_REG, triton::arch::OP_MEM>(inst); break;
+          case operandsForm(triton::arch::OP_MEM, triton::arch::OP_REG): this->xorForm_s<triton::arch::OP_MEM, triton::arch::OP_REG>(inst); break;
+          case operandsForm(triton::arch::OP_MEM, triton::arch::OP_IMM): this->xorForm_s<triton::arch::OP_MEM, triton::arch::OP_IMM>(inst); break;
+          default:
+            throw triton::exceptions::Semantics("x86Semantics::xor_s(): Invalid operands.");
+        }
+      }
+
+
       void x86Semantics::xorpd_s(triton::arch::Instruction& inst) {
         auto& dst = inst.operands[0];
         auto& src = inst.operands[1];
@@ -5,6 +5,8 @@
 **  This program is under the terms of the BSD License.
 */
 
+#include <vector>
+
 #include <architecture.hpp>
 #include <cpuSize.hpp>
 #include <externalLibs.hpp>
@@ -444,7240 +446,1936 @@ namespace triton {
       };
 
 
-      x86Specifications::x86Specifications() {
-      }
-
-
-      x86Specifications::~x86Specifications() {
-      }
-
-
-      triton::arch::RegisterSpecification x86Specifications::getX86RegisterSpecification(triton::uint32 arch, triton::uint32 regId) const {
-        triton::arch::RegisterSpecification ret;
-
-        if (arch != triton::arch::ARCH_X86 && arch != triton::arch::ARCH_X86_64)
-          return ret;
-
-        switch (regId) {
-
-          case triton::arch::x86::ID_REG_RAX:
-            ret.setName("rax");
-            ret.setHigh(QWORD_SIZE_BIT-1);
-            ret.setLow(0);
-            ret.setParentId(triton::arch::x86::ID_REG_RAX);
-            break;
-
-          case triton::arch::x86::ID_REG_EAX:
-            ret.setName("eax");
-            ret.setHigh(DWORD_SIZE_BIT-1);
-            ret.setLow(0);
-            ret.setParentId((arch == triton::arch::ARCH_X86_64) ? triton::arch::x86::ID_REG_RAX : triton::arch::x86::ID_REG_EAX);
-            break;
-
-          case triton::arch::x86::ID_REG_AX:
-            ret.setName("ax");
-            ret.setHigh(WORD_SIZE_BIT-1);
-            ret.setLow(0);
-            ret.setParentId((arch == triton::arch::ARCH_X86_64) ? triton::arch::x86::ID_REG_RAX : triton::arch::x86::ID_REG_EAX);
-            break;
-
-          case triton::arch::x86::ID_REG_AH:
-            ret.setName("ah");
-            ret.setHigh(WORD_SIZE_BIT-1);
-            ret.setLow(BYTE_SIZE_BIT);
-            ret.setParentId((arch == triton::arch::ARCH_X86_64) ? triton::arch::x86::ID_REG_RAX : triton::arch::x86::ID_REG_EAX);
-            break;
-
-          case triton::arch::x86::ID_REG_AL:
-            ret.setName("al");
-            ret.setHigh(BYTE_SIZE_BIT-1);
-            ret.setLow(0);
-            ret.setParentId((arch == triton::arch::ARCH_X86_64) ? triton::arch::x86::ID_REG_RAX : triton::arch::x86::ID_REG_EAX);
-            break;
-
-          case triton::arch::x86::ID_REG_RBX:
-            ret.setName("rbx");
-            ret.setHigh(QWORD_SIZE_BIT-1);
-            ret.setLow(0);
-            ret.setParentId(triton::arch::x86::ID_REG_RBX);
-            break;
-
-          case triton::arch::x86::ID_REG_EBX:
-            ret.setName("ebx");
-            ret.setHigh(DWORD_SIZE_BIT-1);
-            ret.setLow(0);
-            ret.setParentId((arch == triton::arch::ARCH_X86_64) ? triton::arch::x86::ID_REG_RBX : triton::arch::x86::ID_REG_EBX);
-            break;
-
-          case triton::arch::x86::ID_REG_BX:
-            ret.setName("bx");
-            ret.setHigh(WORD_SIZE_BIT-1);
-            ret.setLow(0);
-            ret.setParentId((arch == triton::arch::ARCH_X86_64) ? triton::arch::x86::ID_REG_RBX : triton::arch::x86::ID_REG_EBX);
-            break;
-
-          case triton::arch::x86::ID_REG_BH:
-            ret.setName("bh");
-            ret.setHigh(WORD_SIZE_BIT-1);
-            ret.setLow(BYTE_SIZE_BIT);
-            ret.setParentId((arch == triton::arch::ARCH_X86_64) ? triton::arch::x86::ID_REG_RBX : triton::arch::x86::ID_REG_EBX);
-            break;
-
-          case triton::arch::x86::ID_REG_BL:
-            ret.setName("bl");
-            ret.setHigh(BYTE_SIZE_BIT-1);
-            ret.setLow(0);
-            ret.setParentId((arch == triton::arch::ARCH_X86_64) ? triton::arch::x86::ID_REG_RBX : triton::arch::x86::ID_REG_EBX);
-            break;
-
-          case triton::arch::x86::ID_REG_RCX:
-            ret.setName("rcx");
-            ret.setHigh(QWORD_SIZE_BIT-1);
-            ret.setLow(0);
-            ret.setParentId(triton::arch::x86::ID_REG_RCX);
-            break;
-
-          case triton::arch::x86::ID_REG_ECX:
-            ret.setName("ecx");
-            ret.setHigh(DWORD_SIZE_BIT-1);
-            ret.setLow(0);
-            ret.setParentId((arch == triton::arch::ARCH_X86_64) ? triton::arch::x86::ID_REG_RCX : triton::arch::x86::ID_REG_ECX);
-            break;
-
-          case triton::arch::x86::ID_REG_CX:
-            ret.setName("cx");
-            ret.setHigh(WORD_SIZE_BIT-1);
-            ret.setLow(0);
-            ret.setParentId((arch == triton::arch::ARCH_X86_64) ? triton::arch::x86::ID_REG_RCX : triton::arch::x86::ID_REG_ECX);
-            break;
-
-          case triton::arch::x86::ID_REG_CH:
-            ret.setName("ch");
-            ret.setHigh(WORD_SIZE_BIT-1);
-            ret.setLow(BYTE_SIZE_BIT);
-            ret.setParentId((arch == triton::arch::ARCH_X86_64) ? triton::arch::x86::ID_REG_RCX : triton::arch::x86::ID_REG_ECX);
-            break;
-
-          case triton::arch::x86::ID_REG_CL:
-            ret.setName("cl");
-            ret.setHigh(BYTE_SIZE_BIT-1);
-            ret.setLow(0);
-            ret.setParentId((arch == triton::arch::ARCH_X86_64) ? triton::arch::x86::ID_REG_RCX : triton::arch::x86::ID_REG_ECX);
-            break;
-
-          case triton::arch::x86::ID_REG_RDX:
-            ret.setName("rdx");
-            ret.setHigh(QWORD_SIZE_BIT-1);
-            ret.setLow(0);
-            ret.setParentId(triton::arch::x86::ID_REG_RDX);
-            break;
-
-          case triton::arch::x86::ID_REG_EDX:
-            ret.setName("edx");
-            ret.setHigh(DWORD_SIZE_BIT-1);
-            ret.setLow(0);
-            ret.setParentId((arch == triton::arch::ARCH_X86_64) ? triton::arch::x86::ID_REG_RDX : triton::arch::x86::ID_REG_EDX);
-            break;
-
-          case triton::arch::x86::ID_REG_DX:
-            ret.setName("dx");
-            ret.setHigh(WORD_SIZE_BIT-1);
-            ret.setLow(0);
-            ret.setParentId((arch == triton::arch::ARCH_X86_64) ? triton::arch::x86::ID_REG_RDX : triton::arch::x86::ID_REG_EDX);
-            break;
-
-          case triton::arch::x86::ID_REG_DH:
-            ret.setName("dh");
-            ret.setHigh(WORD_SIZE_BIT-1);
-            ret.setLow(BYTE_SIZE_BIT);
-            ret.setParentId((arch == triton::arch::ARCH_X86_64) ? triton::arch::x86::ID_REG_RDX : triton::arch::x86::ID_REG_EDX);
-            break;
-
-          case triton::arch::x86::ID_REG_DL:
-            ret.setName("dl");
-            ret.setHigh(BYTE_SIZE_BIT-1);
-            ret.setLow(0);
-            ret.setParentId((arch == triton::arch::ARCH_X86_64) ? triton::arch::x86::ID_REG_RDX : triton::arch::x86::ID_REG_EDX);
-            break;
-
-          case triton::arch::x86::ID_REG_RDI:
-            ret.setName("rdi");
-            ret.setHigh(QWORD_SIZE_BIT-1);
-            ret.setLow(0);
-            ret.setParentId(triton::arch::x86::ID_REG_RDI);
-            break;
-
-          case triton::arch::x86::ID_REG_EDI:
-            ret.setName("edi");
-            ret.setHigh(DWORD_SIZE_BIT-1);
-            ret.setLow(0);
-            ret.setParentId((arch == triton::arch::ARCH_X86_64) ? triton::arch::x86::ID_REG_RDI : triton::arch::x86::ID_REG_EDI);
-            break;
-
-          case triton::arch::x86::ID_REG_DI:
-            ret.setName("di");
-            ret.setHigh(WORD_SIZE_BIT-1);
-            ret.setLow(0);
-            ret.setParentId((arch == triton::arch::ARCH_X86_64) ? triton::arch::x86::ID_REG_RDI : triton::arch::x86::ID_REG_EDI);
-            break;
-
-          case triton::arch::x86::ID_REG_DIL:
-            ret.setName("dil");
-            ret.setHigh(BYTE_SIZE_BIT-1);
-            ret.setLow(0);
-            ret.setParentId((arch == triton::arch::ARCH_X86_64) ? triton::arch::x86::ID_REG_RDI : triton::arch::x86::ID_REG_EDI);
-            break;
-
-          case triton::arch::x86::ID_REG_RSI:
-            ret.setName("rsi");
-            ret.setHigh(QWORD_SIZE_BIT-1);
-            ret.setLow(0);
-            ret.setParentId(triton::arch::x86::ID_REG_RSI);
-            break;
-
-          case triton::arch::x86::ID_REG_ESI:
-            ret.setName("esi");
-            ret.setHigh(DWORD_SIZE_BIT-1);
-            ret.setLow(0);
-            ret.setParentId((arch == triton::arch::ARCH_X86_64) ? triton::arch::x86::ID_REG_RSI : triton::arch::x86::ID_REG_ESI);
-            break;
-
-          case triton::arch::x86::ID_REG_SI:
-            ret.setName("si");
-            ret.setHigh(WORD_SIZE_BIT-1);
-            ret.setLow(0);
-            ret.setParentId((arch == triton::arch::ARCH_X86_64) ? triton::arch::x86::ID_REG_RSI : triton::arch::x86::ID_REG_ESI);
-            break;
-
-          case triton::arch::x86::ID_REG_SIL:
-            ret.setName("sil");
-            ret.setHigh(BYTE_SIZE_BIT-1);
-            ret.setLow(0);
-            ret.setParentId((arch == triton::arch::ARCH_X86_64) ? triton::arch::x86::ID_REG_RSI : triton::arch::x86::ID_REG_ESI);
-            break;
-
-          case triton::arch::x86::ID_REG_RBP:
-            ret.setName("rbp");
-            ret.setHigh(QWORD_SIZE_BIT-1);
-            ret.setLow(0);
-            ret.setParentId(triton::arch::x86::ID_REG_RBP);
-            break;
-
-          case triton::arch::x86::ID_REG_EBP:
-            ret.setName("ebp");
-            ret.setHigh(DWORD_SIZE_BIT-1);
-            ret.setLow(0);
-            ret.setParentId((arch == triton::arch::ARCH_X86_64) ? triton::arch::x86::ID_REG_RBP : triton::arch::x86::ID_REG_EBP);
-            break;
-
-          case triton::arch::x86::ID_REG_BP:
-            ret.setName("bp");
-            ret.setHigh(WORD_SIZE_BIT-1);
-            ret.setLow(0);
-            ret.setParentId((arch == triton::arch::ARCH_X86_64) ? triton::arch::x86::ID_REG_RBP : triton::arch::x86::ID_REG_EBP);
-            break;
-
-          case triton::arch::x86::ID_REG_BPL:
-            ret.setName("bpl");
-            ret.setHigh(BYTE_SIZE_BIT-1);
-            ret.setLow(0);
-            ret.setParentId((arch == triton::arch::ARCH_X86_64) ? triton::arch::x86::ID_REG_RBP : triton::arch::x86::ID_REG_EBP);
-            break;
-
-          case triton::arch::x86::ID_REG_RSP:
-            ret.setName("rsp");
-            ret.setHigh(QWORD_SIZE_BIT-1);
-            ret.setLow(0);
-            ret.setParentId(triton::arch::x86::ID_REG_RSP);
-            break;
-
-          case triton::arch::x86::ID_REG_ESP:
-            ret.setName("esp");
-            ret.setHigh(DWORD_SIZE_BIT-1);
-            ret.setLow(0);
-            ret.setParentId((arch == triton::arch::ARCH_X86_64) ? triton::arch::x86::ID_REG_RSP : triton::arch::x86::ID_REG_ESP);
-            break;
-
-          case triton::arch::x86::ID_REG_SP:
-            ret.setName("sp");
-            ret.setHigh(WORD_SIZE_BIT-1);
-            ret.setLow(0);
-            ret.setParentId((arch == triton::arch::ARCH_X86_64) ? triton::arch::x86::ID_REG_RSP : triton::arch::x86::ID_REG_ESP);
-            break;
-
-          case triton::arch::x86::ID_REG_SPL:
-            ret.setName("spl");
-            ret.setHigh(BYTE_SIZE_BIT-1);
-            ret.setLow(0);
-            ret.setParentId((arch == triton::arch::ARCH_X86_64) ? triton::arch::x86::ID_REG_RSP : triton::arch::x86::ID_REG_ESP);
-            break;
-
-          case triton::arch::x86::ID_REG_RIP:
-            ret.setName("rip");
-            ret.setHigh(QWORD_SIZE_BIT-1);
-            ret.setLow(0);
-            ret.setParentId(triton::arch::x86::ID_REG_RIP);
-            break;
-
-          case triton::arch::x86::ID_REG_EIP:
-            ret.setName("eip");
-            ret.setHigh(DWORD_SIZE_BIT-1);
-            ret.setLow(0);
-            ret.setParentId((arch == triton::arch::ARCH_X86_64) ? triton::arch::x86::ID_REG_RIP : triton::arch::x86::ID_REG_EIP);
-            break;
-
-          case triton::arch::x86::ID_REG_IP:
-            ret.setName("ip");
-            ret.setHigh(WORD_SIZE_BIT-1);
-            ret.setLow(0);
-            ret.setParentId((arch == triton::arch::ARCH_X86_64) ? triton::arch::x86::ID_REG_RIP : triton::arch::x86::ID_REG_EIP);
-            break;
-
-          case triton::arch::x86::ID_REG_EFLAGS:
-            ret.setName("eflags");
-            ret.setHigh((arch == triton::arch::ARCH_X86_64) ? QWORD_SIZE_BIT-1 : DWORD_SIZE_BIT-1);
-            ret.setLow(0);
-            ret.setParentId(triton::arch::x86::ID_REG_EFLAGS);
-            break;
-
-          case triton::arch::x86::ID_REG_R8:
-            ret.setName("r8");
-            ret.setHigh(QWORD_SIZE_BIT-1);
-            ret.setLow(0);
-            ret.setParentId(triton::arch::x86::ID_REG_R8);
-            break;
-
-          case triton::arch::x86::ID_REG_R8D:
-            ret.setName("r8d");
-            ret.setHigh(DWORD_SIZE_BIT-1);
-            ret.setLow(0);
-            ret.setParentId(triton::arch::x86::ID_REG_R8);
-            break;
-
-          case triton::arch::x86::ID_REG_R8W:
-            ret.setName("r8w");
-            ret.setHigh(WORD_SIZE_BIT-1);
-            ret.setLow(0);
-            ret.setParentId(triton::arch::x86::ID_REG_R8);
-            break;
-
-          case triton::arch::x86::ID_REG_R8B:
-            ret.setName("r8b");
-            ret.setHigh(BYTE_SIZE_BIT-1);
-            ret.setLow(0);
-            ret.setParentId(triton::arch::x86::ID_REG_R8);
-            break;
-
-          case triton::arch::x86::ID_REG_R9:
-            ret.setName("r9");
-            ret.setHigh(QWORD_SIZE_BIT-1);
-            ret.setLow(0);
-            ret.setParentId(triton::arch::x86::ID_REG_R9);
-            break;
-
-          case triton::arch::x86::ID_REG_R9D:
-            ret.setName("r9d");
-            ret.setHigh(DWORD_SIZE_BIT-1);
-            ret.setLow(0);
-            ret.setParentId(triton::arch::x86::ID_REG_R9);
-            break;
-
-          case triton::arch::x86::ID_REG_R9W:
-            ret.setName("r9w");
-            ret.setHigh(WORD_SIZE_BIT-1);
-            ret.setLow(0);
-            ret.setParentId(triton::arch::x86::ID_REG_R9);
-            break;
-
-          case triton::arch::x86::ID_REG_R9B:
-            ret.setName("r9b");
-            ret.setHigh(BYTE_SIZE_BIT-1);
-            ret.setLow(0);
-            ret.setParentId(triton::arch::x86::ID_REG_R9);
-            break;
-
-          case triton::arch::x86::ID_REG_R10:
-            ret.setName("r10");
-            ret.setHigh(QWORD_SIZE_BIT-1);
-            ret.setLow(0);
-            ret.setParentId(triton::arch::x86::ID_REG_R10);
-            break;
-
-          case triton::arch::x86::ID_REG_R10D:
-            ret.setName("r10d");
-            ret.setHigh(DWORD_SIZE_BIT-1);
-            ret.setLow(0);
-            ret.setParentId(triton::arch::x86::ID_REG_R10);
-            break;
-
-          case triton::arch::x86::ID_REG_R10W:
-            ret.setName("r10w");
-            ret.setHigh(WORD_SIZE_BIT-1);
-            ret.setLow(0);
-            ret.setParentId(triton::arch::x86::ID_REG_R10);
-            break;
-
-          case triton::arch::x86::ID_REG_R10B:
-            ret.setName("r10b");
-            ret.setHigh(BYTE_SIZE_BIT-1);
-            ret.setLow(0);
-            ret.setParentId(triton::arch::x86::ID_REG_R10);
-            break;
-
-          case triton::arch::x86::ID_REG_R11:
-            ret.setName("r11");
-            ret.setHigh(QWORD_SIZE_BIT-1);
-            ret.setLow(0);
-            ret.setParentId(triton::arch::x86::ID_REG_R11);
-            break;
-
-          case triton::arch::x86::ID_REG_R11D:
-            ret.setName("r11d");
-            ret.setHigh(DWORD_SIZE_BIT-1);
-            ret.setLow(0);
-            ret.setParentId(triton::arch::x86::ID_REG_R11);
-            break;
-
-          case triton::arch::x86::ID_REG_R11W:
-            ret.setName("r11w");
-            ret.setHigh(WORD_SIZE_BIT-1);
-            ret.setLow(0);
-            ret.setParentId(triton::arch::x86::ID_REG_R11);
-            break;
-
-          case triton::arch::x86::ID_REG_R11B:
-            ret.setName("r11b");
-            ret.setHigh(BYTE_SIZE_BIT-1);
-            ret.setLow(0);
-            ret.setParentId(triton::arch::x86::ID_REG_R11);
-            break;
-
-          case triton::arch::x86::ID_REG_R12:
-            ret.setName("r12");
-            ret.setHigh(QWORD_SIZE_BIT-1);
-            ret.setLow(0);
-            ret.setParentId(triton::arch::x86::ID_REG_R12);
-            break;
-
-          case triton::arch::x86::ID_REG_R12D:
-            ret.setName("r12d");
-            ret.setHigh(DWORD_SIZE_BIT-1);
-            ret.setLow(0);
-            ret.setParentId(triton::arch::x86::ID_REG_R12);
-            break;
-
-          case triton::arch::x86::ID_REG_R12W:
-            ret.setName("r12w");
-            ret.setHigh(WORD_SIZE_BIT-1);
-            ret.setLow(0);
-            ret.setParentId(triton::arch::x86::ID_REG_R12);
-            break;
-
-          case triton::arch::x86::ID_REG_R12B:
-            ret.setName("r12b");
-            ret.setHigh(BYTE_SIZE_BIT-1);
-            ret.setLow(0);
-            ret.setParentId(triton::arch::x86::ID_REG_R12);
-            break;
-
-          case triton::arch::x86::ID_REG_R13:
-            ret.setName("r13");
-            ret.setHigh(QWORD_SIZE_BIT-1);
-            ret.setLow(0);
-            ret.setParentId(triton::arch::x86::ID_REG_R13);
-            break;
-
-          case triton::arch::x86::ID_REG_R13D:
-            ret.setName("r13d");
-            ret.setHigh(DWORD_SIZE_BIT-1);
-            ret.setLow(0);
-            ret.setParentId(triton::arch::x86::ID_REG_R13);
-            break;
-
-          case triton::arch::x86::ID_REG_R13W:
-            ret.setName("r13w");
-            ret.setHigh(WORD_SIZE_BIT-1);
-            ret.setLow(0);
-            ret.setParentId(triton::arch::x86::ID_REG_R13);
-            break;
-
-          case triton::arch::x86::ID_REG_R13B:
-            ret.setName("r13b");
-            ret.setHigh(BYTE_SIZE_BIT-1);
-            ret.setLow(0);
-            ret.setParentId(triton::arch::x86::ID_REG_R13);
-            break;
-
-          case triton::arch::x86::ID_REG_R14:
-            ret.setName("r14");
-            ret.setHigh(QWORD_SIZE_BIT-1);
-            ret.setLow(0);
-            ret.setParentId(triton::arch::x86::ID_REG_R14);
-            break;
-
-          case triton::arch::x86::ID_REG_R14D:
-            ret.setName("r14d");
-            ret.setHigh(DWORD_SIZE_BIT-1);
-            ret.setLow(0);
-            ret.setParentId(triton::arch::x86::ID_REG_R14);
-            break;
-
-          case triton::arch::x86::ID_REG_R14W:
-            ret.setName("r14w");
-            ret.setHigh(WORD_SIZE_BIT-1);
-            ret.setLow(0);
-            ret.setParentId(triton::arch::x86::ID_REG_R14);
-            break;
-
-          case triton::arch::x86::ID_REG_R14B:
-            ret.setName("r14b");
-            ret.setHigh(BYTE_SIZE_BIT-1);
-            ret.setLow(0);
-            ret.setParentId(triton::arch::x86::ID_REG_R14);
-            break;
-
-          case triton::arch::x86::ID_REG_R15:
-            ret.setName("r15");
-            ret.setHigh(QWORD_SIZE_BIT-1);
-            ret.setLow(0);
-            ret.setParentId(triton::arch::x86::ID_REG_R15);
-            break;
-
-          case triton::arch::x86::ID_REG_R15D:
-            ret.setName("r15d");
-            ret.setHigh(DWORD_SIZE_BIT-1);
-            ret.setLow(0);
-            ret.setParentId(triton::arch::x86::ID_REG_R15);
-            break;
-
-          case triton::arch::x86::ID_REG_R15W:
-            ret.setName("r15w");
-            ret.setHigh(WORD_SIZE_BIT-1);
-            ret.setLow(0);
-            ret.setParentId(triton::arch::x86::ID_REG_R15);
-            break;
-
-          case triton::arch::x86::ID_REG_R15B:
-            ret.setName("r15b");
-            ret.setHigh(BYTE_SIZE_BIT-1);
-            ret.setLow(0);
-            ret.setParentId(triton::arch::x86::ID_REG_R15);
-            break;
-
-          case triton::arch::x86::ID_REG_MM0:
-            ret.setName("mm0");
-            ret.setHigh(QWORD_SIZE_BIT-1);
-            ret.setLow(0);
-            ret.setParentId(triton::arch::x86::ID_REG_MM0);
-            break;
-
-          case triton::arch::x86::ID_REG_MM1:
-            ret.setName("mm1");
-            ret.setHigh(QWORD_SIZE_BIT-1);
-            ret.setLow(0);
-            ret.setParentId(triton::arch::x86::ID_REG_MM1);
-            break;
-
-          case triton::arch::x86::ID_REG_MM2:
-            ret.setName("mm2");
-            ret.setHigh(QWORD_SIZE_BIT-1);
-            ret.setLow(0);
-            ret.setParentId(triton::arch::x86::ID_REG_MM2);
-            break;
-
-          case triton::arch::x86::ID_REG_MM3:
-            ret.setName("mm3");
-            ret.setHigh(QWORD_SIZE_BIT-1);
-            ret.setLow(0);
-            ret.setParentId(triton::arch::x86::ID_REG_MM3);
-            break;
-
-          case triton::arch::x86::ID_REG_MM4:
-            ret.setName("mm4");
-            ret.setHigh(QWORD_SIZE_BIT-1);
-            ret.setLow(0);
-            ret.setParentId(triton::arch::x86::ID_REG_MM4);
-            break;
-
-          case triton::arch::x86::ID_REG_MM5:
-            ret.setName("mm5");
-            ret.setHigh(QWORD_SIZE_BIT-1);
-            ret.setLow(0);
-            ret.setParentId(triton::arch::x86::ID_REG_MM5);
-            break;
-
-          case triton::arch::x86::ID_REG_MM6:
-            ret.setName("mm6");
-            ret.setHigh(QWORD_SIZE_BIT-1);
-            ret.setLow(0);
-            ret.setParentId(triton::arch::x86::ID_REG_MM6);
-            break;
-
-          case triton::arch::x86::ID_REG_MM7:
-            ret.setName("mm7");
-            ret.setHigh(QWORD_SIZE_BIT-1);
-            ret.setLow(0);
-            ret.setParentId(triton::arch::x86::ID_REG_MM7);
-            break;
-
-          case triton::arch::x86::ID_REG_XMM0:
-            ret.setName("xmm0");
-            ret.setHigh(DQWORD_SIZE_BIT-1);
-            ret.setLow(0);
-            ret.setParentId(triton::arch::x86::ID_REG_XMM0);
-            break;
-
-          case triton::arch::x86::ID_REG_XMM1:
-            ret.setName("xmm1");
-            ret.setHigh(DQWORD_SIZE_BIT-1);
-            ret.setLow(0);
-            ret.setParentId(triton::arch::x86::ID_REG_XMM1);
-            break;
-
-          case triton::arch::x86::ID_REG_XMM2:
-            ret.setName("xmm2");
-            ret.setHigh(DQWORD_SIZE_BIT-1);
-            ret.setLow(0);
-            ret.setParentId(triton::arch::x86::ID_REG_XMM2);
-            break;
-
-          case triton::arch::x86::ID_REG_XMM3:
-            ret.setName("xmm3");
-            ret.setHigh(DQWORD_SIZE_BIT-1);
-            ret.setLow(0);
-            ret.setParentId(triton::arch::x86::ID_REG_XMM3);
-            break;
-
-          case triton::arch::x86::ID_REG_XMM4:
-            ret.setName("xmm4");
-            ret.setHigh(DQWORD_SIZE_BIT-1);
-            ret.setLow(0);
-            ret.setParentId(triton::arch::x86::ID_REG_XMM4);
-            break;
-
-          case triton::arch::x86::ID_REG_XMM5:
-            ret.setName("xmm5");
-            ret.setHigh(DQWORD_SIZE_BIT-1);
-            ret.setLow(0);
-            ret.setParentId(triton::arch::x86::ID_REG_XMM5);
-            break;
-
-          case triton::arch::x86::ID_REG_XMM6:
-            ret.setName("xmm6");
-            ret.setHigh(DQWORD_SIZE_BIT-1);
-            ret.setLow(0);
-            ret.setParentId(triton::arch::x86::ID_REG_XMM6);
-            break;
-
-          case triton::arch::x86::ID_REG_XMM7:
-            ret.setName("xmm7");
-            ret.setHigh(DQWORD_SIZE_BIT-1);
-            ret.setLow(0);
-            ret.setParentId(triton::arch::x86::ID_REG_XMM7);
-            break;
-
-          case triton::arch::x86::ID_REG_XMM8:
-            ret.setName("xmm8");
-            ret.setHigh(DQWORD_SIZE_BIT-1);
-            ret.setLow(0);
-            ret.setParentId(triton::arch::x86::ID_REG_XMM8);
-            break;
-
-          case triton::arch::x86::ID_REG_XMM9:
-            ret.setName("xmm9");
-            ret.setHigh(DQWORD_SIZE_BIT-1);
-            ret.setLow(0);
-            ret.setParentId(triton::arch::x86::ID_REG_XMM9);
-            break;
-
-          case triton::arch::x86::ID_REG_XMM10:
-            ret.setName("xmm10");
-            ret.setHigh(DQWORD_SIZE_BIT-1);
-            ret.setLow(0);
-            ret.setParentId(triton::arch::x86::ID_REG_XMM10);
-            break;
-
-          case triton::arch::x86::ID_REG_XMM11:
-            ret.setName("xmm11");
-            ret.setHigh(DQWORD_SIZE_BIT-1);
-            ret.setLow(0);
-            ret.setParentId(triton::arch::x86::ID_REG_XMM11);
-            break;
-
-          case triton::arch::x86::ID_REG_XMM12:
-            ret.setName("xmm12");
-            ret.setHigh(DQWORD_SIZE_BIT-1);
-            ret.setLow(0);
-            ret.setParentId(triton::arch::x86::ID_REG_XMM12);
-            break;
-
-          case triton::arch::x86::ID_REG_XMM13:
-            ret.setName("xmm13");
-            ret.setHigh(DQWORD_SIZE_BIT-1);
-            ret.setLow(0);
-            ret.setParentId(triton::arch::x86::ID_REG_XMM13);
-            break;
-
-          case triton::arch::x86::ID_REG_XMM14:
-            ret.setName("xmm14");
-            ret.setHigh(DQWORD_SIZE_BIT-1);
-            ret.setLow(0);
-            ret.setParentId(triton::arch::x86::ID_REG_XMM14);
-            break;
-
-          case triton::arch::x86::ID_REG_XMM15:
-            ret.setName("xmm15");
-            ret.setHigh(DQWORD_SIZE_BIT-1);
-            ret.setLow(0);
-            ret.setParentId(triton::arch::x86::ID_REG_XMM15);
-            break;
-
-          case triton::arch::x86::ID_REG_YMM0:
-            ret.setName("ymm0");
-            ret.setHigh(QQWORD_SIZE_BIT-1);
-            ret.setLow(0);
-            ret.setParentId(triton::arch::x86::ID_REG_YMM0);
-            break;
-
-          case triton::arch::x86::ID_REG_YMM1:
-            ret.setName("ymm1");
-            ret.setHigh(QQWORD_SIZE_BIT-1);
-            ret.setLow(0);
-            ret.setParentId(triton::arch::x86::ID_REG_YMM1);
-            break;
-
-          case triton::arch::x86::ID_REG_YMM2:
-            ret.setName("ymm2");
-            ret.setHigh(QQWORD_SIZE_BIT-1);
-            ret.setLow(0);
-            ret.setParentId(triton::arch::x86::ID_REG_YMM2);
-            break;
-
-          case triton::arch::x86::ID_REG_YMM3:
-            ret.setName("ymm3");
-            ret.setHigh(QQWORD_SIZE_BIT-1);
-            ret.setLow(0);
-            ret.setParentId(triton::arch::x86::ID_REG_YMM3);
-            break;
+      /*
+       * The specifications of the registers, indexed by register id. The parent of a
+       * sub-register and the size of a segment register depend on the mode.
+       */
+      static constexpr triton::arch::RegisterSpecificationEntry x86RegisterSpecifications[] = {
+        {"unknown", 0,                  0,             triton::arch::x86::ID_REG_INVALID}, /* ID_REG_INVALID */
+        {"rax",     QWORD_SIZE_BIT-1,   0,             triton::arch::x86::ID_REG_RAX},     /* ID_REG_RAX */
+        {"rbx",     QWORD_SIZE_BIT-1,   0,             triton::arch::x86::ID_REG_RBX},     /* ID_REG_RBX */
+        {"rcx",     QWORD_SIZE_BIT-1,   0,             triton::arch::x86::ID_REG_RCX},     /* ID_REG_RCX */
+        {"rdx",     QWORD_SIZE_BIT-1,   0,             triton::arch::x86::ID_REG_RDX},     /* ID_REG_RDX */
+        {"rdi",     QWORD_SIZE_BIT-1,   0,             triton::arch::x86::ID_REG_RDI},     /* ID_REG_RDI */
+        {"rsi",     QWORD_SIZE_BIT-1,   0,             triton::arch::x86::ID_REG_RSI},     /* ID_REG_RSI */
+        {"rbp",     QWORD_SIZE_BIT-1,   0,             triton::arch::x86::ID_REG_RBP},     /* ID_REG_RBP */
+        {"rsp",     QWORD_SIZE_BIT-1,   0,             triton::arch::x86::ID_REG_RSP},     /* ID_REG_RSP */
+        {"rip",     QWORD_SIZE_BIT-1,   0,             triton::arch::x86::ID_REG_RIP},     /* ID_REG_RIP */
+        {"r8",      QWORD_SIZE_BIT-1,   0,             triton::arch::x86::ID_REG_R8},      /* ID_REG_R8 */
+        {"r8d",     DWORD_SIZE_BIT-1,   0,             triton::arch::x86::ID_REG_R8},      /* ID_REG_R8D */
+        {"r8w",     WORD_SIZE_BIT-1,    0,             triton::arch::x86::ID_REG_R8},      /* ID_REG_R8W */
+        {"r8b",     BYTE_SIZE_BIT-1,    0,             triton::arch::x86::ID_REG_R8},      /* ID_REG_R8B */
+        {"r9",      QWORD_SIZE_BIT-1,   0,             triton::arch::x86::ID_REG_R9},      /* ID_REG_R9 */
+        {"r9d",     DWORD_SIZE_BIT-1,   0,             triton::arch::x86::ID_REG_R9},      /* ID_REG_R9D */
+        {"r9w",     WORD_SIZE_BIT-1,    0,             triton::arch::x86::ID_REG_R9},      /* ID_REG_R9W */
+        {"r9b",     BYTE_SIZE_BIT-1,    0,             triton::arch::x86::ID_REG_R9},      /* ID_REG_R9B */
+        {"r10",     QWORD_SIZE_BIT-1,   0,             triton::arch::x86::ID_REG_R10},     /* ID_REG_R10 */
+        {"r10d",    DWORD_SIZE_BIT-1,   0,             triton::arch::x86::ID_REG_R10},     /* ID_REG_R10D */
+        {"r10w",    WORD_SIZE_BIT-1,    0,             triton::arch::x86::ID_REG_R10},     /* ID_REG_R10W */
+        {"r10b",    BYTE_SIZE_BIT-1,    0,             triton::arch::x86::ID_REG_R10},     /* ID_REG_R10B */
+        {"r11",     QWORD_SIZE_BIT-1,   0,             triton::arch::x86::ID_REG_R11},     /* ID_REG_R11 */
+        {"r11d",    DWORD_SIZE_BIT-1,   0,             triton::arch::x86::ID_REG_R11},     /* ID_REG_R11D */
+        {"r11w",    WORD_SIZE_BIT-1,    0,             triton::arch::x86::ID_REG_R11},     /* ID_REG_R11W */
+        {"r11b",    BYTE_SIZE_BIT-1,    0,             triton::arch::x86::ID_REG_R11},     /* ID_REG_R11B */
+        {"r12",     QWORD_SIZE_BIT-1,   0,             triton::arch::x86::ID_REG_R12},     /* ID_REG_R12 */
+        {"r12d",    DWORD_SIZE_BIT-1,   0,             triton::arch::x86::ID_REG_R12},     /* ID_REG_R12D */
+        {"r12w",    WORD_SIZE_BIT-1,    0,             triton::arch::x86::ID_REG_R12},     /* ID_REG_R12W */
+        {"r12b",    BYTE_SIZE_BIT-1,    0,             triton::arch::x86::ID_REG_R12},     /* ID_REG_R12B */
+        {"r13",     QWORD_SIZE_BIT-1,   0,             triton::arch::x86::ID_REG_R13},     /* ID_REG_R13 */
+        {"r13d",    DWORD_SIZE_BIT-1,   0,             triton::arch::x86::ID_REG_R13},     /* ID_REG_R13D */
+        {"r13w",    WORD_SIZE_BIT-1,    0,             triton::arch::x86::ID_REG_R13},     /* ID_REG_R13W */
+        {"r13b",    BYTE_SIZE_BIT-1,    0,             triton::arch::x86::ID_REG_R13},     /* ID_REG_R13B */
+        {"r14",     QWORD_SIZE_BIT-1,   0,             triton::arch::x86::ID_REG_R14},     /* ID_REG_R14 */
+        {"r14d",    DWORD_SIZE_BIT-1,   0,             triton::arch::x86::ID_REG_R14},     /* ID_REG_R14D */
+        {"r14w",    WORD_SIZE_BIT-1,    0,             triton::arch::x86::ID_REG_R14},     /* ID_REG_R14W */
+        {"r14b",    BYTE_SIZE_BIT-1,    0,             triton::arch::x86::ID_REG_R14},     /* ID_REG_R14B */
+        {"r15",     QWORD_SIZE_BIT-1,   0,             triton::arch::x86::ID_REG_R15},     /* ID_REG_R15 */
+        {"r15d",    DWORD_SIZE_BIT-1,   0,             triton::arch::x86::ID_REG_R15},     /* ID_REG_R15D */
+        {"r15w",    WORD_SIZE_BIT-1,    0,             triton::arch::x86::ID_REG_R15},     /* ID_REG_R15W */
+        {"r15b",    BYTE_SIZE_BIT-1,    0,             triton::arch::x86::ID_REG_R15},     /* ID_REG_R15B */
+        {"eax",     DWORD_SIZE_BIT-1,   0,             triton::arch::x86::ID_REG_EAX},     /* ID_REG_EAX */
+        {"ax",      WORD_SIZE_BIT-1,    0,             triton::arch::x86::ID_REG_EAX},     /* ID_REG_AX */
+        {"ah",      WORD_SIZE_BIT-1,    BYTE_SIZE_BIT, triton::arch::x86::ID_REG_EAX},     /* ID_REG_AH */
+        {"al",      BYTE_SIZE_BIT-1,    0,             triton::arch::x86::ID_REG_EAX},     /* ID_REG_AL */
+        {"ebx",     DWORD_SIZE_BIT-1,   0,             triton::arch::x86::ID_REG_EBX},     /* ID_REG_EBX */
+        {"bx",      WORD_SIZE_BIT-1,    0,             triton::arch::x86::ID_REG_EBX},     /* ID_REG_BX */
+        {"bh",      WORD_SIZE_BIT-1,    BYTE_SIZE_BIT, triton::arch::x86::ID_REG_EBX},     /* ID_REG_BH */
+        {"bl",      BYTE_SIZE_BIT-1,    0,             triton::arch::x86::ID_REG_EBX},     /* ID_REG_BL */
+        {"ecx",     DWORD_SIZE_BIT-1,   0,             triton::arch::x86::ID_REG_ECX},     /* ID_REG_ECX */
+        {"cx",      WORD_SIZE_BIT-1,    0,             triton::arch::x86::ID_REG_ECX},     /* ID_REG_CX */
+        {"ch",      WORD_SIZE_BIT-1,    BYTE_SIZE_BIT, triton::arch::x86::ID_REG_ECX},     /* ID_REG_CH */
+        {"cl",      BYTE_SIZE_BIT-1,    0,             triton::arch::x86::ID_REG_ECX},     /* ID_REG_CL */
+        {"edx",     DWORD_SIZE_BIT-1,   0,             triton::arch::x86::ID_REG_EDX},     /* ID_REG_EDX */
+        {"dx",      WORD_SIZE_BIT-1,    0,             triton::arch::x86::ID_REG_EDX},     /* ID_REG_DX */
+        {"dh",      WORD_SIZE_BIT-1,    BYTE_SIZE_BIT, triton::arch::x86::ID_REG_EDX},     /* ID_REG_DH */
+        {"dl",      BYTE_SIZE_BIT-1,    0,             triton::arch::x86::ID_REG_EDX},     /* ID_REG_DL */
+        {"edi",     DWORD_SIZE_BIT-1,   0,             triton::arch::x86::ID_REG_EDI},     /* ID_REG_EDI */
+        {"di",      WORD_SIZE_BIT-1,    0,             triton::arch::x86::ID_REG_EDI},     /* ID_REG_DI */
+        {"dil",     BYTE_SIZE_BIT-1,    0,             triton::arch::x86::ID_REG_EDI},     /* ID_REG_DIL */
+        {"esi",     DWORD_SIZE_BIT-1,   0,             triton::arch::x86::ID_REG_ESI},     /* ID_REG_ESI */
+        {"si",      WORD_SIZE_BIT-1,    0,             triton::arch::x86::ID_REG_ESI},     /* ID_REG_SI */
+        {"sil",     BYTE_SIZE_BIT-1,    0,             triton::arch::x86::ID_REG_ESI},     /* ID_REG_SIL */
+        {"ebp",     DWORD_SIZE_BIT-1,   0,             triton::arch::x86::ID_REG_EBP},     /* ID_REG_EBP */
+        {"bp",      WORD_SIZE_BIT-1,    0,             triton::arch::x86::ID_REG_EBP},     /* ID_REG_BP */
+        {"bpl",     BYTE_SIZE_BIT-1,    0,             triton::arch::x86::ID_REG_EBP},     /* ID_REG_BPL */
+        {"esp",     DWORD_SIZE_BIT-1,   0,             triton::arch::x86::ID_REG_ESP},     /* ID_REG_ESP */
+        {"sp",      WORD_SIZE_BIT-1,    0,             triton::arch::x86::ID_REG_ESP},     /* ID_REG_SP */
+        {"spl",     BYTE_SIZE_BIT-1,    0,             triton::arch::x86::ID_REG_ESP},     /* ID_REG_SPL */
+        {"eip",     DWORD_SIZE_BIT-1,   0,             triton::arch::x86::ID_REG_EIP},     /* ID_REG_EIP */
+        {"ip",      WORD_SIZE_BIT-1,    0,             triton::arch::x86::ID_REG_EIP},     /* ID_REG_IP */
+        {"eflags",  DWORD_SIZE_BIT-1,   0,             triton::arch::x86::ID_REG_EFLAGS},  /* ID_REG_EFLAGS */
+        {"mm0",     QWORD_SIZE_BIT-1,   0,             triton::arch::x86::ID_REG_MM0},     /* ID_REG_MM0 */
+        {"mm1",     QWORD_SIZE_BIT-1,   0,             triton::arch::x86::ID_REG_MM1},     /* ID_REG_MM1 */
+        {"mm2",     QWORD_SIZE_BIT-1,   0,             triton::arch::x86::ID_REG_MM2},     /* ID_REG_MM2 */
+        {"mm3",     QWORD_SIZE_BIT-1,   0,             triton::arch::x86::ID_REG_MM3},     /* ID_REG_MM3 */
+        {"mm4",     QWORD_SIZE_BIT-1,   0,             triton::arch::x86::ID_REG_MM4},     /* ID_REG_MM4 */
+        {"mm5",     QWORD_SIZE_BIT-1,   0,             triton::arch::x86::ID_REG_MM5},     /* ID_REG_MM5 */
+        {"mm6",     QWORD_SIZE_BIT-1,   0,             triton::arch::x86::ID_REG_MM6},     /* ID_REG_MM6 */
+        {"mm7",     QWORD_SIZE_BIT-1,   0,             triton::arch::x86::ID_REG_MM7},     /* ID_REG_MM7 */
+        {"mxcsr",   DWORD_SIZE_BIT-1,   0,             triton::arch::x86::ID_REG_MXCSR},   /* ID_REG_MXCSR */
+        {"xmm0",    DQWORD_SIZE_BIT-1,  0,             triton::arch::x86::ID_REG_XMM0},    /* ID_REG_XMM0 */
+        {"xmm1",    DQWORD_SIZE_BIT-1,  0,             triton::arch::x86::ID_REG_XMM1},    /* ID_REG_XMM1 */
+        {"xmm2",    DQWORD_SIZE_BIT-1,  0,             triton::arch::x86::ID_REG_XMM2},    /* ID_REG_XMM2 */
+        {"xmm3",    DQWORD_SIZE_BIT-1,  0,             triton::arch::x86::ID_REG_XMM3},    /* ID_REG_XMM3 */
+        {"xmm4",    DQWORD_SIZE_BIT-1,  0,             triton::arch::x86::ID_REG_XMM4},    /* ID_REG_XMM4 */
+        {"xmm5",    DQWORD_SIZE_BIT-1,  0,             triton::arch::x86::ID_REG_XMM5},    /* ID_REG_XMM5 */
+        {"xmm6",    DQWORD_SIZE_BIT-1,  0,             triton::arch::x86::ID_REG_XMM6},    /* ID_REG_XMM6 */
+        {"xmm7",    DQWORD_SIZE_BIT-1,  0,             triton::arch::x86::ID_REG_XMM7},    /* ID_REG_XMM7 */
+        {"xmm8",    DQWORD_SIZE_BIT-1,  0,             triton::arch::x86::ID_REG_XMM8},    /* ID_REG_XMM8 */
+        {"xmm9",    DQWORD_SIZE_BIT-1,  0,             triton::arch::x86::ID_REG_XMM9},    /* ID_REG_XMM9 */
+        {"xmm10",   DQWORD_SIZE_BIT-1,  0,             triton::arch::x86::ID_REG_XMM10},   /* ID_REG_XMM10 */
+        {"xmm11",   DQWORD_SIZE_BIT-1,  0,             triton::arch::x86::ID_REG_XMM11},   /* ID_REG_XMM11 */
+        {"xmm12",   DQWORD_SIZE_BIT-1,  0,             triton::arch::x86::ID_REG_XMM12},   /* ID_REG_XMM12 */
+        {"xmm13",   DQWORD_SIZE_BIT-1,  0,             triton::arch::x86::ID_REG_XMM13},   /* ID_REG_XMM13 */
+        {"xmm14",   DQWORD_SIZE_BIT-1,  0,             triton::arch::x86::ID_REG_XMM14},   /* ID_REG_XMM14 */
+        {"xmm15",   DQWORD_SIZE_BIT-1,  0,             triton::arch::x86::ID_REG_XMM15},   /* ID_REG_XMM15 */
+        {"ymm0",    QQWORD_SIZE_BIT-1,  0,             triton::arch::x86::ID_REG_YMM0},    /* ID_REG_YMM0 */
+        {"ymm1",    QQWORD_SIZE_BIT-1,  0,             triton::arch::x86::ID_REG_YMM1},    /* ID_REG_YMM1 */
+        {"ymm2",    QQWORD_SIZE_BIT-1,  0,             triton::arch::x86::ID_REG_YMM2},    /* ID_REG_YMM2 */
+        {"ymm3",    QQWORD_SIZE_BIT-1,  0,             triton::arch::x86::ID_REG_YMM3},    /* ID_REG_YMM3 */
+        {"ymm4",    QQWORD_SIZE_BIT-1,  0,             triton::arch::x86::ID_REG_YMM4},    /* ID_REG_YMM4 */
+        {"ymm5",    QQWORD_SIZE_BIT-1,  0,             triton::arch::x86::ID_REG_YMM5},    /* ID_REG_YMM5 */
+        {"ymm6",    QQWORD_SIZE_BIT-1,  0,             triton::arch::x86::ID_REG_YMM6},    /* ID_REG_YMM6 */
+        {"ymm7",    QQWORD_SIZE_BIT-1,  0,             triton::arch::x86::ID_REG_YMM7},    /* ID_REG_YMM7 */
+        {"ymm8",    QQWORD_SIZE_BIT-1,  0,             triton::arch::x86::ID_REG_YMM8},    /* ID_REG_YMM8 */
+        {"ymm9",    QQWORD_SIZE_BIT-1,  0,             triton::arch::x86::ID_REG_YMM9},    /* ID_REG_YMM9 */
+        {"ymm10",   QQWORD_SIZE_BIT-1,  0,             triton::arch::x86::ID_REG_YMM10},   /* ID_REG_YMM10 */
+        {"ymm11",   QQWORD_SIZE_BIT-1,  0,             triton::arch::x86::ID_REG_YMM11},   /* ID_REG_YMM11 */
+        {"ymm12",   QQWORD_SIZE_BIT-1,  0,             triton::arch::x86::ID_REG_YMM12},   /* ID_REG_YMM12 */
+        {"ymm13",   QQWORD_SIZE_BIT-1,  0,             triton::arch::x86::ID_REG_YMM13},   /* ID_REG_YMM13 */
+        {"ymm14",   QQWORD_SIZE_BIT-1,  0,             triton::arch::x86::ID_REG_YMM14},   /* ID_REG_YMM14 */
+        {"ymm15",   QQWORD_SIZE_BIT-1,  0,             triton::arch::x86::ID_REG_YMM15},   /* ID_REG_YMM15 */
+        {"zmm0",    DQQWORD_SIZE_BIT-1, 0,             triton::arch::x86::ID_REG_ZMM0},    /* ID_REG_ZMM0 */
+        {"zmm1",    DQQWORD_SIZE_BIT-1, 0,             triton::arch::x86::ID_REG_ZMM1},    /* ID_REG_ZMM1 */
+        {"zmm2",    DQQWORD_SIZE_BIT-1, 0,             triton::arch::x86::ID_REG_ZMM2},    /* ID_REG_ZMM2 */
+        {"zmm3",    DQQWORD_SIZE_BIT-1, 0,             triton::arch::x86::ID_REG_ZMM3},    /* ID_REG_ZMM3 */
+        {"zmm4",    DQQWORD_SIZE_BIT-1, 0,             triton::arch::x86::ID_REG_ZMM4},    /* ID_REG_ZMM4 */
+        {"zmm5",    DQQWORD_SIZE_BIT-1, 0,             triton::arch::x86::ID_REG_ZMM5},    /* ID_REG_ZMM5 */
+        {"zmm6",    DQQWORD_SIZE_BIT-1, 0,             triton::arch::x86::ID_REG_ZMM6},    /* ID_REG_ZMM6 */
+        {"zmm7",    DQQWORD_SIZE_BIT-1, 0,             triton::arch::x86::ID_REG_ZMM7},    /* ID_REG_ZMM7 */
+        {"zmm8",    DQQWORD_SIZE_BIT-1, 0,             triton::arch::x86::ID_REG_ZMM8},    /* ID_REG_ZMM8 */
+        {"zmm9",    DQQWORD_SIZE_BIT-1, 0,             triton::arch::x86::ID_REG_ZMM9},    /* ID_REG_ZMM9 */
+        {"zmm10",   DQQWORD_SIZE_BIT-1, 0,             triton::arch::x86::ID_REG_ZMM10},   /* ID_REG_ZMM10 */
+        {"zmm11",   DQQWORD_SIZE_BIT-1, 0,             triton::arch::x86::ID_REG_ZMM11},   /* ID_REG_ZMM11 */
+        {"zmm12",   DQQWORD_SIZE_BIT-1, 0,             triton::arch::x86::ID_REG_ZMM12},   /* ID_REG_ZMM12 */
+        {"zmm13",   DQQWORD_SIZE_BIT-1, 0,             triton::arch::x86::ID_REG_ZMM13},   /* ID_REG_ZMM13 */
+        {"zmm14",   DQQWORD_SIZE_BIT-1, 0,             triton::arch::x86::ID_REG_ZMM14},   /* ID_REG_ZMM14 */
+        {"zmm15",   DQQWORD_SIZE_BIT-1, 0,             triton::arch::x86::ID_REG_ZMM15},   /* ID_REG_ZMM15 */
+        {"zmm16",   DQQWORD_SIZE_BIT-1, 0,             triton::arch::x86::ID_REG_ZMM16},   /* ID_REG_ZMM16 */
+        {"zmm17",   DQQWORD_SIZE_BIT-1, 0,             triton::arch::x86::ID_REG_ZMM17},   /* ID_REG_ZMM17 */
+        {"zmm18",   DQQWORD_SIZE_BIT-1, 0,             triton::arch::x86::ID_REG_ZMM18},   /* ID_REG_ZMM18 */
+        {"zmm19",   DQQWORD_SIZE_BIT-1, 0,             triton::arch::x86::ID_REG_ZMM19},   /* ID_REG_ZMM19 */
+        {"zmm20",   DQQWORD_SIZE_BIT-1, 0,             triton::arch::x86::ID_REG_ZMM20},   /* ID_REG_ZMM20 */
+        {"zmm21",   DQQWORD_SIZE_BIT-1, 0,             triton::arch::x86::ID_REG_ZMM21},   /* ID_REG_ZMM21 */
+        {"zmm22",   DQQWORD_SIZE_BIT-1, 0,             triton::arch::x86::ID_REG_ZMM22},   /* ID_REG_ZMM22 */
+        {"zmm23",   DQQWORD_SIZE_BIT-1, 0,             triton::arch::x86::ID_REG_ZMM23},   /* ID_REG_ZMM23 */
+        {"zmm24",   DQQWORD_SIZE_BIT-1, 0,             triton::arch::x86::ID_REG_ZMM24},   /* ID_REG_ZMM24 */
+        {"zmm25",   DQQWORD_SIZE_BIT-1, 0,             triton::arch::x86::ID_REG_ZMM25},   /* ID_REG_ZMM25 */
+        {"zmm26",   DQQWORD_SIZE_BIT-1, 0,             triton::arch::x86::ID_REG_ZMM26},   /* ID_REG_ZMM26 */
+        {"zmm27",   DQQWORD_SIZE_BIT-1, 0,             triton::arch::x86::ID_REG_ZMM27},   /* ID_REG_ZMM27 */
+        {"zmm28",   DQQWORD_SIZE_BIT-1, 0,             triton::arch::x86::ID_REG_ZMM28},   /* ID_REG_ZMM28 */
+        {"zmm29",   DQQWORD_SIZE_BIT-1, 0,             triton::arch::x86::ID_REG_ZMM29},   /* ID_REG_ZMM29 */
+        {"zmm30",   DQQWORD_SIZE_BIT-1, 0,             triton::arch::x86::ID_REG_ZMM30},   /* ID_REG_ZMM30 */
+        {"zmm31",   DQQWORD_SIZE_BIT-1, 0,             triton::arch::x86::ID_REG_ZMM31},   /* ID_REG_ZMM31 */
+        {"cr0",     DWORD_SIZE_BIT-1,   0,             triton::arch::x86::ID_REG_CR0},     /* ID_REG_CR0 */
+        {"cr1",     DWORD_SIZE_BIT-1,   0,             triton::arch::x86::ID_REG_CR1},     /* ID_REG_CR1 */
+        {"cr2",     DWORD_SIZE_BIT-1,   0,             triton::arch::x86::ID_REG_CR2},     /* ID_REG_CR2 */
+        {"cr3",     DWORD_SIZE_BIT-1,   0,             triton::arch::x86::ID_REG_CR3},     /* ID_REG_CR3 */
+        {"cr4",     DWORD_SIZE_BIT-1,   0,             triton::arch::x86::ID_REG_CR4},     /* ID_REG_CR4 */
+        {"cr5",     DWORD_SIZE_BIT-1,   0,             triton::arch::x86::ID_REG_CR5},     /* ID_REG_CR5 */
+        {"cr6",     DWORD_SIZE_BIT-1,   0,             triton::arch::x86::ID_REG_CR6},     /* ID_REG_CR6 */
+        {"cr7",     DWORD_SIZE_BIT-1,   0,             triton::arch::x86::ID_REG_CR7},     /* ID_REG_CR7 */
+        {"cr8",     DWORD_SIZE_BIT-1,   0,             triton::arch::x86::ID_REG_CR8},     /* ID_REG_CR8 */
+        {"cr9",     DWORD_SIZE_BIT-1,   0,             triton::arch::x86::ID_REG_CR9},     /* ID_REG_CR9 */
+        {"cr10",    DWORD_SIZE_BIT-1,   0,             triton::arch::x86::ID_REG_CR10},    /* ID_REG_CR10 */
+        {"cr11",    DWORD_SIZE_BIT-1,   0,             triton::arch::x86::ID_REG_CR11},    /* ID_REG_CR11 */
+        {"cr12",    DWORD_SIZE_BIT-1,   0,             triton::arch::x86::ID_REG_CR12},    /* ID_REG_CR12 */
+        {"cr13",    DWORD_SIZE_BIT-1,   0,             triton::arch::x86::ID_REG_CR13},    /* ID_REG_CR13 */
+        {"cr14",    DWORD_SIZE_BIT-1,   0,             triton::arch::x86::ID_REG_CR14},    /* ID_REG_CR14 */
+        {"cr15",    DWORD_SIZE_BIT-1,   0,             triton::arch::x86::ID_REG_CR15},    /* ID_REG_CR15 */
+        {"af",      0,                  0,             triton::arch::x86::ID_REG_AF},      /* ID_REG_AF */
+        {"cf",      0,                  0,             triton::arch::x86::ID_REG_CF},      /* ID_REG_CF */
+        {"df",      0,                  0,             triton::arch::x86::ID_REG_DF},      /* ID_REG_DF */
+        {"if",      0,                  0,             triton::arch::x86::ID_REG_IF},      /* ID_REG_IF */
+        {"of",      0,                  0,             triton::arch::x86::ID_REG_OF},      /* ID_REG_OF */
+        {"pf",      0,                  0,             triton::arch::x86::ID_REG_PF},      /* ID_REG_PF */
+        {"sf",      0,                  0,             triton::arch::x86::ID_REG_SF},      /* ID_REG_SF */
+        {"tf",      0,                  0,             triton::arch::x86::ID_REG_TF},      /* ID_REG_TF */
+        {"zf",      0,                  0,             triton::arch::x86::ID_REG_ZF},      /* ID_REG_ZF */
+        {"ie",      0,                  0,             triton::arch::x86::ID_REG_IE},      /* ID_REG_IE */
+        {"de",      0,                  0,             triton::arch::x86::ID_REG_DE},      /* ID_REG_DE */
+        {"ze",      0,                  0,             triton::arch::x86::ID_REG_ZE},      /* ID_REG_ZE */
+        {"oe",      0,                  0,             triton::arch::x86::ID_REG_OE},      /* ID_REG_OE */
+        {"ue",      0,                  0,             triton::arch::x86::ID_REG_UE},      /* ID_REG_UE */
+        {"pe",      0,                  0,             triton::arch::x86::ID_REG_PE},      /* ID_REG_PE */
+        {"da",      0,                  0,             triton::arch::x86::ID_REG_DAZ},     /* ID_REG_DAZ */
+        {"im",      0,                  0,             triton::arch::x86::ID_REG_IM},      /* ID_REG_IM */
+        {"dm",      0,                  0,             triton::arch::x86::ID_REG_DM},      /* ID_REG_DM */
+        {"zm",      0,                  0,             triton::arch::x86::ID_REG_ZM},      /* ID_REG_ZM */
+        {"om",      0,                  0,             triton::arch::x86::ID_REG_OM},      /* ID_REG_OM */
+        {"um",      0,                  0,             triton::arch::x86::ID_REG_UM},      /* ID_REG_UM */
+        {"pm",      0,                  0,             triton::arch::x86::ID_REG_PM},      /* ID_REG_PM */
+        {"rl",      0,                  0,             triton::arch::x86::ID_REG_RL},      /* ID_REG_RL */
+        {"rh",      0,                  0,             triton::arch::x86::ID_REG_RH},      /* ID_REG_RH */
+        {"fz",      0,                  0,             triton::arch::x86::ID_REG_FZ},      /* ID_REG_FZ */
+        {"cs",      DWORD_SIZE_BIT-1,   0,             triton::arch::x86::ID_REG_CS},      /* ID_REG_CS */
+        {"ds",      DWORD_SIZE_BIT-1,   0,             triton::arch::x86::ID_REG_DS},      /* ID_REG_DS */
+        {"es",      DWORD_SIZE_BIT-1,   0,             triton::arch::x86::ID_REG_ES},      /* ID_REG_ES */
+        {"fs",      DWORD_SIZE_BIT-1,   0,             triton::arch::x86::ID_REG_FS},      /* ID_REG_FS */
+        {"gs",      DWORD_SIZE_BIT-1,   0,             triton::arch::x86::ID_REG_GS},      /* ID_REG_GS */
+        {"ss",      DWORD_SIZE_BIT-1,   0,             triton::arch::x86::ID_REG_SS},      /* ID_REG_SS */
+      };
 
-          case triton::arch::x86::ID_REG_YMM4:
-            ret.setName("ymm4");
-            ret.setHigh(QQWORD_SIZE_BIT-1);
-            ret.setLow(0);
-            ret.setParentId(triton::arch::x86::ID_REG_YMM4);
-            break;
 
-          case triton::arch::x86::ID_REG_YMM5:
-            ret.setName("ymm5");
-            ret.setHigh(QQWORD_SIZE_BIT-1);
-            ret.setLow(0);
-            ret.setParentId(triton::arch::x86::ID_REG_YMM5);
-            break;
+      static constexpr triton::arch::RegisterSpecificationEntry x8664RegisterSpecifications[] = {
+        {"unknown", 0,                  0,             triton::arch::x86::ID_REG_INVALID}, /* ID_REG_INVALID */
+        {"rax",     QWORD_SIZE_BIT-1,   0,             triton::arch::x86::ID_REG_RAX},     /* ID_REG_RAX */
+        {"rbx",     QWORD_SIZE_BIT-1,   0,             triton::arch::x86::ID_REG_RBX},     /* ID_REG_RBX */
+        {"rcx",     QWORD_SIZE_BIT-1,   0,             triton::arch::x86::ID_REG_RCX},     /* ID_REG_RCX */
+        {"rdx",     QWORD_SIZE_BIT-1,   0,             triton::arch::x86::ID_REG_RDX},     /* ID_REG_RDX */
+        {"rdi",     QWORD_SIZE_BIT-1,   0,             triton::arch::x86::ID_REG_RDI},     /* ID_REG_RDI */
+        {"rsi",     QWORD_SIZE_BIT-1,   0,             triton::arch::x86::ID_REG_RSI},     /* ID_REG_RSI */
+        {"rbp",     QWORD_SIZE_BIT-1,   0,             triton::arch::x86::ID_REG_RBP},     /* ID_REG_RBP */
+        {"rsp",     QWORD_SIZE_BIT-1,   0,             triton::arch::x86::ID_REG_RSP},     /* ID_REG_RSP */
+        {"rip",     QWORD_SIZE_BIT-1,   0,             triton::arch::x86::ID_REG_RIP},     /* ID_REG_RIP */
+        {"r8",      QWORD_SIZE_BIT-1,   0,             triton::arch::x86::ID_REG_R8},      /* ID_REG_R8 */
+        {"r8d",     DWORD_SIZE_BIT-1,   0,             triton::arch::x86::ID_REG_R8},      /* ID_REG_R8D */
+        {"r8w",     WORD_SIZE_BIT-1,    0,             triton::arch::x86::ID_REG_R8},      /* ID_REG_R8W */
+        {"r8b",     BYTE_SIZE_BIT-1,    0,             triton::arch::x86::ID_REG_R8},      /* ID_REG_R8B */
+        {"r9",      QWORD_SIZE_BIT-1,   0,             triton::arch::x86::ID_REG_R9},      /* ID_REG_R9 */
+        {"r9d",     DWORD_SIZE_BIT-1,   0,             triton::arch::x86::ID_REG_R9},      /* ID_REG_R9D */
+        {"r9w",     WORD_SIZE_BIT-1,    0,             triton::arch::x86::ID_REG_R9},      /* ID_REG_R9W */
+        {"r9b",     BYTE_SIZE_BIT-1,    0,             triton::arch::x86::ID_REG_R9},      /* ID_REG_R9B */
+        {"r10",     QWORD_SIZE_BIT-1,   0,             triton::arch::x86::ID_REG_R10},     /* ID_REG_R10 */
+        {"r10d",    DWORD_SIZE_BIT-1,   0,             triton::arch::x86::ID_REG_R10},     /* ID_REG_R10D */
+        {"r10w",    WORD_SIZE_BIT-1,    0,             triton::arch::x86::ID_REG_R10},     /* ID_REG_R10W */
+        {"r10b",    BYTE_SIZE_BIT-1,    0,             triton::arch::x86::ID_REG_R10},     /* ID_REG_R10B */
+        {"r11",     QWORD_SIZE_BIT-1,   0,             triton::arch::x86::ID_REG_R11},     /* ID_REG_R11 */
+        {"r11d",    DWORD_SIZE_BIT-1,   0,             triton::arch::x86::ID_REG_R11},     /* ID_REG_R11D */
+        {"r11w",    WORD_SIZE_BIT-1,    0,             triton::arch::x86::ID_REG_R11},     /* ID_REG_R11W */
+        {"r11b",    BYTE_SIZE_BIT-1,    0,             triton::arch::x86::ID_REG_R11},     /* ID_REG_R11B */
+        {"r12",     QWORD_SIZE_BIT-1,   0,             triton::arch::x86::ID_REG_R12},     /* ID_REG_R12 */
+        {"r12d",    DWORD_SIZE_BIT-1,   0,             triton::arch::x86::ID_REG_R12},     /* ID_REG_R12D */
+        {"r12w",    WORD_SIZE_BIT-1,    0,             triton::arch::x86::ID_REG_R12},     /* ID_REG_R12W */
+        {"r12b",    BYTE_SIZE_BIT-1,    0,             triton::arch::x86::ID_REG_R12},     /* ID_REG_R12B */
+        {"r13",     QWORD_SIZE_BIT-1,   0,             triton::arch::x86::ID_REG_R13},     /* ID_REG_R13 */
+        {"r13d",    DWORD_SIZE_BIT-1,   0,             triton::arch::x86::ID_REG_R13},     /* ID_REG_R13D */
+        {"r13w",    WORD_SIZE_BIT-1,    0,             triton::arch::x86::ID_REG_R13},     /* ID_REG_R13W */
+        {"r13b",    BYTE_SIZE_BIT-1,    0,             triton::arch::x86::ID_REG_R13},     /* ID_REG_R13B */
+        {"r14",     QWORD_SIZE_BIT-1,   0,             triton::arch::x86::ID_REG_R14},     /* ID_REG_R14 */
+        {"r14d",    DWORD_SIZE_BIT-1,   0,             triton::arch::x86::ID_REG_R14},     /* ID_REG_R14D */
+        {"r14w",    WORD_SIZE_BIT-1,    0,             triton::arch::x86::ID_REG_R14},     /* ID_REG_R14W */
+        {"r14b",    BYTE_SIZE_BIT-1,    0,             triton::arch::x86::ID_REG_R14},     /* ID_REG_R14B */
+        {"r15",     QWORD_SIZE_BIT-1,   0,             triton::arch::x86::ID_REG_R15},     /* ID_REG_R15 */
+        {"r15d",    DWORD_SIZE_BIT-1,   0,             triton::arch::x86::ID_REG_R15},     /* ID_REG_R15D */
+        {"r15w",    WORD_SIZE_BIT-1,    0,             triton::arch::x86::ID_REG_R15},     /* ID_REG_R15W */
+        {"r15b",    BYTE_SIZE_BIT-1,    0,             triton::arch::x86::ID_REG_R15},     /* ID_REG_R15B */
+        {"eax",     DWORD_SIZE_BIT-1,   0,             triton::arch::x86::ID_REG_RAX},     /* ID_REG_EAX */
+        {"ax",      WORD_SIZE_BIT-1,    0,             triton::arch::x86::ID_REG_RAX},     /* ID_REG_AX */
+        {"ah",      WORD_SIZE_BIT-1,    BYTE_SIZE_BIT, triton::arch::x86::ID_REG_RAX},     /* ID_REG_AH */
+        {"al",      BYTE_SIZE_BIT-1,    0,             triton::arch::x86::ID_REG_RAX},     /* ID_REG_AL */
+        {"ebx",     DWORD_SIZE_BIT-1,   0,             triton::arch::x86::ID_REG_RBX},     /* ID_REG_EBX */
+        {"bx",      WORD_SIZE_BIT-1,    0,             triton::arch::x86::ID_REG_RBX},     /* ID_REG_BX */
+        {"bh",      WORD_SIZE_BIT-1,    BYTE_SIZE_BIT, triton::arch::x86::ID_REG_RBX},     /* ID_REG_BH */
+        {"bl",      BYTE_SIZE_BIT-1,    0,             triton::arch::x86::ID_REG_RBX},     /* ID_REG_BL */
+        {"ecx",     DWORD_SIZE_BIT-1,   0,             triton::arch::x86::ID_REG_RCX},     /* ID_REG_ECX */
+        {"cx",      WORD_SIZE_BIT-1,    0,             triton::arch::x86::ID_REG_RCX},     /* ID_REG_CX */
+        {"ch",      WORD_SIZE_BIT-1,    BYTE_SIZE_BIT, triton::arch::x86::ID_REG_RCX},     /* ID_REG_CH */
+        {"cl",      BYTE_SIZE_BIT-1,    0,             triton::arch::x86::ID_REG_RCX},     /* ID_REG_CL */
+        {"edx",     DWORD_SIZE_BIT-1,   0,             triton::arch::x86::ID_REG_RDX},     /* ID_REG_EDX */
+        {"dx",      WORD_SIZE_BIT-1,    0,             triton::arch::x86::ID_REG_RDX},     /* ID_REG_DX */
+        {"dh",      WORD_SIZE_BIT-1,    BYTE_SIZE_BIT, triton::arch::x86::ID_REG_RDX},     /* ID_REG_DH */
+        {"dl",      BYTE_SIZE_BIT-1,    0,             triton::arch::x86::ID_REG_RDX},     /* ID_REG_DL */
+        {"edi",     DWORD_SIZE_BIT-1,   0,             triton::arch::x86::ID_REG_RDI},     /* ID_REG_EDI */
+        {"di",      WORD_SIZE_BIT-1,    0,             triton::arch::x86::ID_REG_RDI},     /* ID_REG_DI */
+        {"dil",     BYTE_SIZE_BIT-1,    0,             triton::arch::x86::ID_REG_RDI},     /* ID_REG_DIL */
+        {"esi",     DWORD_SIZE_BIT-1,   0,             triton::arch::x86::ID_REG_RSI},     /* ID_REG_ESI */
+        {"si",      WORD_SIZE_BIT-1,    0,             triton::arch::x86::ID_REG_RSI},     /* ID_REG_SI */
+        {"sil",     BYTE_SIZE_BIT-1,    0,             triton::arch::x86::ID_REG_RSI},     /* ID_REG_SIL */
+        {"ebp",     DWORD_SIZE_BIT-1,   0,             triton::arch::x86::ID_REG_RBP},     /* ID_REG_EBP */
+        {"bp",      WORD_SIZE_BIT-1,    0,             triton::arch::x86::ID_REG_RBP},     /* ID_REG_BP */
+        {"bpl",     BYTE_SIZE_BIT-1,    0,             triton::arch::x86::ID_REG_RBP},     /* ID_REG_BPL */
+        {"esp",     DWORD_SIZE_BIT-1,   0,             triton::arch::x86::ID_REG_RSP},     /* ID_REG_ESP */
+        {"sp",      WORD_SIZE_BIT-1,    0,             triton::arch::x86::ID_REG_RSP},     /* ID_REG_SP */
+        {"spl",     BYTE_SIZE_BIT-1,    0,             triton::arch::x86::ID_REG_RSP},     /* ID_REG_SPL */
+        {"eip",     DWORD_SIZE_BIT-1,   0,             triton::arch::x86::ID_REG_RIP},     /* ID_REG_EIP */
+        {"ip",      WORD_SIZE_BIT-1,    0,             triton::arch::x86::ID_REG_RIP},     /* ID_REG_IP */
+        {"eflags",  QWORD_SIZE_BIT-1,   0,             triton::arch::x86::ID_REG_EFLAGS},  /* ID_REG_EFLAGS */
+        {"mm0",     QWORD_SIZE_BIT-1,   0,             triton::arch::x86::ID_REG_MM0},     /* ID_REG_MM0 */
+        {"mm1",     QWORD_SIZE_BIT-1,   0,             triton::arch::x86::ID_REG_MM1},     /* ID_REG_MM1 */
+        {"mm2",     QWORD_SIZE_BIT-1,   0,             triton::arch::x86::ID_REG_MM2},     /* ID_REG_MM2 */
+        {"mm3",     QWORD_SIZE_BIT-1,   0,             triton::arch::x86::ID_REG_MM3},     /* ID_REG_MM3 */
+        {"mm4",     QWORD_SIZE_BIT-1,   0,             triton::arch::x86::ID_REG_MM4},     /* ID_REG_MM4 */
+        {"mm5",     QWORD_SIZE_BIT-1,   0,             triton::arch::x86::ID_REG_MM5},     /* ID_REG_MM5 */
+        {"mm6",     QWORD_SIZE_BIT-1,   0,             triton::arch::x86::ID_REG_MM6},     /* ID_REG_MM6 */
+        {"mm7",     QWORD_SIZE_BIT-1,   0,             triton::arch::x86::ID_REG_MM7},     /* ID_REG_MM7 */
+        {"mxcsr",   QWORD_SIZE_BIT-1,   0,             triton::arch::x86::ID_REG_MXCSR},   /* ID_REG_MXCSR */
+        {"xmm0",    DQWORD_SIZE_BIT-1,  0,             triton::arch::x86::ID_REG_XMM0},    /* ID_REG_XMM0 */
+        {"xmm1",    DQWORD_SIZE_BIT-1,  0,             triton::arch::x86::ID_REG_XMM1},    /* ID_REG_XMM1 */
+        {"xmm2",    DQWORD_SIZE_BIT-1,  0,             triton::arch::x86::ID_REG_XMM2},    /* ID_REG_XMM2 */
+        {"xmm3",    DQWORD_SIZE_BIT-1,  0,             triton::arch::x86::ID_REG_XMM3},    /* ID_REG_XMM3 */
+        {"xmm4",    DQWORD_SIZE_BIT-1,  0,             triton::arch::x86::ID_REG_XMM4},    /* ID_REG_XMM4 */
+        {"xmm5",    DQWORD_SIZE_BIT-1,  0,             triton::arch::x86::ID_REG_XMM5},    /* ID_REG_XMM5 */
+        {"xmm6",    DQWORD_SIZE_BIT-1,  0,             triton::arch::x86::ID_REG_XMM6},    /* ID_REG_XMM6 */
+        {"xmm7",    DQWORD_SIZE_BIT-1,  0,             triton::arch::x86::ID_REG_XMM7},    /* ID_REG_XMM7 */
+        {"xmm8",    DQWORD_SIZE_BIT-1,  0,             triton::arch::x86::ID_REG_XMM8},    /* ID_REG_XMM8 */
+        {"xmm9",    DQWORD_SIZE_BIT-1,  0,             triton::arch::x86::ID_REG_XMM9},    /* ID_REG_XMM9 */
+        {"xmm10",   DQWORD_SIZE_BIT-1,  0,             triton::arch::x86::ID_REG_XMM10},   /* ID_REG_XMM10 */
+        {"xmm11",   DQWORD_SIZE_BIT-1,  0,             triton::arch::x86::ID_REG_XMM11},   /* ID_REG_XMM11 */
+        {"xmm12",   DQWORD_SIZE_BIT-1,  0,             triton::arch::x86::ID_REG_XMM12},   /* ID_REG_XMM12 */
+        {"xmm13",   DQWORD_SIZE_BIT-1,  0,             triton::arch::x86::ID_REG_XMM13},   /* ID_REG_XMM13 */
+        {"xmm14",   DQWORD_SIZE_BIT-1,  0,             triton::arch::x86::ID_REG_XMM14},   /* ID_REG_XMM14 */
+        {"xmm15",   DQWORD_SIZE_BIT-1,  0,             triton::arch::x86::ID_REG_XMM15},   /* ID_REG_XMM15 */
+        {"ymm0",    QQWORD_SIZE_BIT-1,  0,             triton::arch::x86::ID_REG_YMM0},    /* ID_REG_YMM0 */
+        {"ymm1",    QQWORD_SIZE_BIT-1,  0,             triton::arch::x86::ID_REG_YMM1},    /* ID_REG_YMM1 */
+        {"ymm2",    QQWORD_SIZE_BIT-1,  0,             triton::arch::x86::ID_REG_YMM2},    /* ID_REG_YMM2 */
+        {"ymm3",    QQWORD_SIZE_BIT-1,  0,             triton::arch::x86::ID_REG_YMM3},    /* ID_REG_YMM3 */
+        {"ymm4",    QQWORD_SIZE_BIT-1,  0,             triton::arch::x86::ID_REG_YMM4},    /* ID_REG_YMM4 */
+        {"ymm5",    QQWORD_SIZE_BIT-1,  0,             triton::arch::x86::ID_REG_YMM5},    /* ID_REG_YMM5 */
+        {"ymm6",    QQWORD_SIZE_BIT-1,  0,             triton::arch::x86::ID_REG_YMM6},    /* ID_REG_YMM6 */
+        {"ymm7",    QQWORD_SIZE_BIT-1,  0,             triton::arch::x86::ID_REG_YMM7},    /* ID_REG_YMM7 */
+        {"ymm8",    QQWORD_SIZE_BIT-1,  0,             triton::arch::x86::ID_REG_YMM8},    /* ID_REG_YMM8 */
+        {"ymm9",    QQWORD_SIZE_BIT-1,  0,             triton::arch::x86::ID_REG_YMM9},    /* ID_REG_YMM9 */
+        {"ymm10",   QQWORD_SIZE_BIT-1,  0,             triton::arch::x86::ID_REG_YMM10},   /* ID_REG_YMM10 */
+        {"ymm11",   QQWORD_SIZE_BIT-1,  0,             triton::arch::x86::ID_REG_YMM11},   /* ID_REG_YMM11 */
+        {"ymm12",   QQWORD_SIZE_BIT-1,  0,             triton::arch::x86::ID_REG_YMM12},   /* ID_REG_YMM12 */
+        {"ymm13",   QQWORD_SIZE_BIT-1,  0,             triton::arch::x86::ID_REG_YMM13},   /* ID_REG_YMM13 */
+        {"ymm14",   QQWORD_SIZE_BIT-1,  0,             triton::arch::x86::ID_REG_YMM14},   /* ID_REG_YMM14 */
+        {"ymm15",   QQWORD_SIZE_BIT-1,  0,             triton::arch::x86::ID_REG_YMM15},   /* ID_REG_YMM15 */
+        {"zmm0",    DQQWORD_SIZE_BIT-1, 0,             triton::arch::x86::ID_REG_ZMM0},    /* ID_REG_ZMM0 */
+        {"zmm1",    DQQWORD_SIZE_BIT-1, 0,             triton::arch::x86::ID_REG_ZMM1},    /* ID_REG_ZMM1 */
+        {"zmm2",    DQQWORD_SIZE_BIT-1, 0,             triton::arch::x86::ID_REG_ZMM2},    /* ID_REG_ZMM2 */
+        {"zmm3",    DQQWORD_SIZE_BIT-1, 0,             triton::arch::x86::ID_REG_ZMM3},    /* ID_REG_ZMM3 */
+        {"zmm4",    DQQWORD_SIZE_BIT-1, 0,             triton::arch::x86::ID_REG_ZMM4},    /* ID_REG_ZMM4 */
+        {"zmm5",    DQQWORD_SIZE_BIT-1, 0,             triton::arch::x86::ID_REG_ZMM5},    /* ID_REG_ZMM5 */
+        {"zmm6",    DQQWORD_SIZE_BIT-1, 0,             triton::arch::x86::ID_REG_ZMM6},    /* ID_REG_ZMM6 */
+        {"zmm7",    DQQWORD_SIZE_BIT-1, 0,             triton::arch::x86::ID_REG_ZMM7},    /* ID_REG_ZMM7 */
+        {"zmm8",    DQQWORD_SIZE_BIT-1, 0,             triton::arch::x86::ID_REG_ZMM8},    /* ID_REG_ZMM8 */
+        {"zmm9",    DQQWORD_SIZE_BIT-1, 0,             triton::arch::x86::ID_REG_ZMM9},    /* ID_REG_ZMM9 */
+        {"zmm10",   DQQWORD_SIZE_BIT-1, 0,             triton::arch::x86::ID_REG_ZMM10},   /* ID_REG_ZMM10 */
+        {"zmm11",   DQQWORD_SIZE_BIT-1, 0,             triton::arch::x86::ID_REG_ZMM11},   /* ID_REG_ZMM11 */
+        {"zmm12",   DQQWORD_SIZE_BIT-1, 0,             triton::arch::x86::ID_REG_ZMM12},   /* ID_REG_ZMM12 */
+        {"zmm13",   DQQWORD_SIZE_BIT-1, 0,             triton::arch::x86::ID_REG_ZMM13},   /* ID_REG_ZMM13 */
+        {"zmm14",   DQQWORD_SIZE_BIT-1, 0,             triton::arch::x86::ID_REG_ZMM14},   /* ID_REG_ZMM14 */
+        {"zmm15",   DQQWORD_SIZE_BIT-1, 0,             triton::arch::x86::ID_REG_ZMM15},   /* ID_REG_ZMM15 */
+        {"zmm16",   DQQWORD_SIZE_BIT-1, 0,             triton::arch::x86::ID_REG_ZMM16},   /* ID_REG_ZMM16 */
+        {"zmm17",   DQQWORD_SIZE_BIT-1, 0,             triton::arch::x86::ID_REG_ZMM17},   /* ID_REG_ZMM17 */
+        {"zmm18",   DQQWORD_SIZE_BIT-1, 0,             triton::arch::x86::ID_REG_ZMM18},   /* ID_REG_ZMM18 */
+        {"zmm19",   DQQWORD_SIZE_BIT-1, 0,             triton::arch::x86::ID_REG_ZMM19},   /* ID_REG_ZMM19 */
+        {"zmm20",   DQQWORD_SIZE_BIT-1, 0,             triton::arch::x86::ID_REG_ZMM20},   /* ID_REG_ZMM20 */
+        {"zmm21",   DQQWORD_SIZE_BIT-1, 0,             triton::arch::x86::ID_REG_ZMM21},   /* ID_REG_ZMM21 */
+        {"zmm22",   DQQWORD_SIZE_BIT-1, 0,             triton::arch::x86::ID_REG_ZMM22},   /* ID_REG_ZMM22 */
+        {"zmm23",   DQQWORD_SIZE_BIT-1, 0,             triton::arch::x86::ID_REG_ZMM23},   /* ID_REG_ZMM23 */
+        {"zmm24",   DQQWORD_SIZE_BIT-1, 0,             triton::arch::x86::ID_REG_ZMM24},   /* ID_REG_ZMM24 */
+        {"zmm25",   DQQWORD_SIZE_BIT-1, 0,             triton::arch::x86::ID_REG_ZMM25},   /* ID_REG_ZMM25 */
+        {"zmm26",   DQQWORD_SIZE_BIT-1, 0,             triton::arch::x86::ID_REG_ZMM26},   /* ID_REG_ZMM26 */
+        {"zmm27",   DQQWORD_SIZE_BIT-1, 0,             triton::arch::x86::ID_REG_ZMM27},   /* ID_REG_ZMM27 */
+        {"zmm28",   DQQWORD_SIZE_BIT-1, 0,             triton::arch::x86::ID_REG_ZMM28},   /* ID_REG_ZMM28 */
+        {"zmm29",   DQQWORD_SIZE_BIT-1, 0,             triton::arch::x86::ID_REG_ZMM29},   /* ID_REG_ZMM29 */
+        {"zmm30",   DQQWORD_SIZE_BIT-1, 0,             triton::arch::x86::ID_REG_ZMM30},   /* ID_REG_ZMM30 */
+        {"zmm31",   DQQWORD_SIZE_BIT-1, 0,             triton::arch::x86::ID_REG_ZMM31},   /* ID_REG_ZMM31 */
+        {"cr0",     QWORD_SIZE_BIT-1,   0,             triton::arch::x86::ID_REG_CR0},     /* ID_REG_CR0 */
+        {"cr1",     QWORD_SIZE_BIT-1,   0,             triton::arch::x86::ID_REG_CR1},     /* ID_REG_CR1 */
+        {"cr2",     QWORD_SIZE_BIT-1,   0,             triton::arch::x86::ID_REG_CR2},     /* ID_REG_CR2 */
+        {"cr3",     QWORD_SIZE_BIT-1,   0,             triton::arch::x86::ID_REG_CR3},     /* ID_REG_CR3 */
+        {"cr4",     QWORD_SIZE_BIT-1,   0,             triton::arch::x86::ID_REG_CR4},     /* ID_REG_CR4 */
+        {"cr5",     QWORD_SIZE_BIT-1,   0,             triton::arch::x86::ID_REG_CR5},     /* ID_REG_CR5 */
+        {"cr6",     QWORD_SIZE_BIT-1,   0,             triton::arch::x86::ID_REG_CR6},     /* ID_REG_CR6 */
+        {"cr7",     QWORD_SIZE_BIT-1,   0,             triton::arch::x86::ID_REG_CR7},     /* ID_REG_CR7 */
+        {"cr8",     QWORD_SIZE_BIT-1,   0,             triton::arch::x86::ID_REG_CR8},     /* ID_REG_CR8 */
+        {"cr9",     QWORD_SIZE_BIT-1,   0,             triton::arch::x86::ID_REG_CR9},     /* ID_REG_CR9 */
+        {"cr10",    QWORD_SIZE_BIT-1,   0,             triton::arch::x86::ID_REG_CR10},    /* ID_REG_CR10 */
+        {"cr11",    QWORD_SIZE_BIT-1,   0,             triton::arch::x86::ID_REG_CR11},    /* ID_REG_CR11 */
+        {"cr12",    QWORD_SIZE_BIT-1,   0,             triton::arch::x86::ID_REG_CR12},    /* ID_REG_CR12 */
+        {"cr13",    QWORD_SIZE_BIT-1,   0,             triton::arch::x86::ID_REG_CR13},    /* ID_REG_CR13 */
+        {"cr14",    QWORD_SIZE_BIT-1,   0,             triton::arch::x86::ID_REG_CR14},    /* ID_REG_CR14 */
+        {"cr15",    QWORD_SIZE_BIT-1,   0,             triton::arch::x86::ID_REG_CR15},    /* ID_REG_CR15 */
+        {"af",      0,                  0,             triton::arch::x86::ID_REG_AF},      /* ID_REG_AF */
+        {"cf",      0,                  0,             triton::arch::x86::ID_REG_CF},      /* ID_REG_CF */
+        {"df",      0,                  0,             triton::arch::x86::ID_REG_DF},      /* ID_REG_DF */
+        {"if",      0,                  0,             triton::arch::x86::ID_REG_IF},      /* ID_REG_IF */
+        {"of",      0,                  0,             triton::arch::x86::ID_REG_OF},      /* ID_REG_OF */
+        {"pf",      0,                  0,             triton::arch::x86::ID_REG_PF},      /* ID_REG_PF */
+        {"sf",      0,                  0,             triton::arch::x86::ID_REG_SF},      /* ID_REG_SF */
+        {"tf",      0,                  0,             triton::arch::x86::ID_REG_TF},      /* ID_REG_TF */
+        {"zf",      0,                  0,             triton::arch::x86::ID_REG_ZF},      /* ID_REG_ZF */
+        {"ie",      0,                  0,             triton::arch::x86::ID_REG_IE},      /* ID_REG_IE */
+        {"de",      0,                  0,             triton::arch::x86::ID_REG_DE},      /* ID_REG_DE */
+        {"ze",      0,                  0,             triton::arch::x86::ID_REG_ZE},      /* ID_REG_ZE */
+        {"oe",      0,                  0,             triton::arch::x86::ID_REG_OE},      /* ID_REG_OE */
+        {"ue",      0,                  0,             triton::arch::x86::ID_REG_UE},      /* ID_REG_UE */
+        {"pe",      0,                  0,             triton::arch::x86::ID_REG_PE},      /* ID_REG_PE */
+        {"da",      0,                  0,             triton::arch::x86::ID_REG_DAZ},     /* ID_REG_DAZ */
+        {"im",      0,                  0,             triton::arch::x86::ID_REG_IM},      /* ID_REG_IM */
+        {"dm",      0,                  0,             triton::arch::x86::ID_REG_DM},      /* ID_REG_DM */
+        {"zm",      0,                  0,             triton::arch::x86::ID_REG_ZM},      /* ID_REG_ZM */
+        {"om",      0,                  0,             triton::arch::x86::ID_REG_OM},      /* ID_REG_OM */
+        {"um",      0,                  0,             triton::arch::x86::ID_REG_UM},      /* ID_REG_UM */
+        {"pm",      0,                  0,             triton::arch::x86::ID_REG_PM},      /* ID_REG_PM */
+        {"rl",      0,                  0,             triton::arch::x86::ID_REG_RL},      /* ID_REG_RL */
+        {"rh",      0,                  0,             triton::arch::x86::ID_REG_RH},      /* ID_REG_RH */
+        {"fz",      0,                  0,             triton::arch::x86::ID_REG_FZ},      /* ID_REG_FZ */
+        {"cs",      QWORD_SIZE_BIT-1,   0,             triton::arch::x86::ID_REG_CS},      /* ID_REG_CS */
+        {"ds",      QWORD_SIZE_BIT-1,   0,             triton::arch::x86::ID_REG_DS},      /* ID_REG_DS */
+        {"es",      QWORD_SIZE_BIT-1,   0,             triton::arch::x86::ID_REG_ES},      /* ID_REG_ES */
+        {"fs",      QWORD_SIZE_BIT-1,   0,             triton::arch::x86::ID_REG_FS},      /* ID_REG_FS */
+        {"gs",      QWORD_SIZE_BIT-1,   0,             triton::arch::x86::ID_REG_GS},      /* ID_REG_GS */
+        {"ss",      QWORD_SIZE_BIT-1,   0,             triton::arch::x86::ID_REG_SS},      /* ID_REG_SS */
+      };
 
-          case triton::arch::x86::ID_REG_YMM6:
-            ret.setName("ymm6");
-            ret.setHigh(QQWORD_SIZE_BIT-1);
-            ret.setLow(0);
-            ret.setParentId(triton::arch::x86::ID_REG_YMM6);
-            break;
 
-          case triton::arch::x86::ID_REG_YMM7:
-            ret.setName("ymm7");
-            ret.setHigh(QQWORD_SIZE_BIT-1);
-            ret.setLow(0);
-            ret.setParentId(triton::arch::x86::ID_REG_YMM7);
-            break;
+      static_assert(sizeof(x86RegisterSpecifications) / sizeof(x86RegisterSpecifications[0]) == triton::arch::x86::ID_REG_LAST_ITEM, "The x86 register specifications do not match the register ids.");
+      static_assert(sizeof(x8664RegisterSpecifications) / sizeof(x8664RegisterSpecifications[0]) == triton::arch::x86::ID_REG_LAST_ITEM, "The x86-64 register specifications do not match the register ids.");
+
+
+      /* Capstone's register ids (first) and their triton's register ids (second) */
+      static constexpr triton::uint32 capstoneRegisters[][2] = {
+        {triton::extlibs::capstone::X86_REG_RAX,    triton::arch::x86::ID_REG_RAX},
+        {triton::extlibs::capstone::X86_REG_EAX,    triton::arch::x86::ID_REG_EAX},
+        {triton::extlibs::capstone::X86_REG_AX,     triton::arch::x86::ID_REG_AX},
+        {triton::extlibs::capstone::X86_REG_AH,     triton::arch::x86::ID_REG_AH},
+        {triton::extlibs::capstone::X86_REG_AL,     triton::arch::x86::ID_REG_AL},
+        {triton::extlibs::capstone::X86_REG_RBX,    triton::arch::x86::ID_REG_RBX},
+        {triton::extlibs::capstone::X86_REG_EBX,    triton::arch::x86::ID_REG_EBX},
+        {triton::extlibs::capstone::X86_REG_BX,     triton::arch::x86::ID_REG_BX},
+        {triton::extlibs::capstone::X86_REG_BH,     triton::arch::x86::ID_REG_BH},
+        {triton::extlibs::capstone::X86_REG_BL,     triton::arch::x86::ID_REG_BL},
+        {triton::extlibs::capstone::X86_REG_RCX,    triton::arch::x86::ID_REG_RCX},
+        {triton::extlibs::capstone::X86_REG_ECX,    triton::arch::x86::ID_REG_ECX},
+        {triton::extlibs::capstone::X86_REG_CX,     triton::arch::x86::ID_REG_CX},
+        {triton::extlibs::capstone::X86_REG_CH,     triton::arch::x86::ID_REG_CH},
+        {triton::extlibs::capstone::X86_REG_CL,     triton::arch::x86::ID_REG_CL},
+        {triton::extlibs::capstone::X86_REG_RDX,    triton::arch::x86::ID_REG_RDX},
+        {triton::extlibs::capstone::X86_REG_EDX,    triton::arch::x86::ID_REG_EDX},
+        {triton::extlibs::capstone::X86_REG_DX,     triton::arch::x86::ID_REG_DX},
+        {triton::extlibs::capstone::X86_REG_DH,     triton::arch::x86::ID_REG_DH},
+        {triton::extlibs::capstone::X86_REG_DL,     triton::arch::x86::ID_REG_DL},
+        {triton::extlibs::capstone::X86_REG_RDI,    triton::arch::x86::ID_REG_RDI},
+        {triton::extlibs::capstone::X86_REG_EDI,    triton::arch::x86::ID_REG_EDI},
+        {triton::extlibs::capstone::X86_REG_DI,     triton::arch::x86::ID_REG_DI},
+        {triton::extlibs::capstone::X86_REG_DIL,    triton::arch::x86::ID_REG_DIL},
+        {triton::extlibs::capstone::X86_REG_RSI,    triton::arch::x86::ID_REG_RSI},
+        {triton::extlibs::capstone::X86_REG_ESI,    triton::arch::x86::ID_REG_ESI},
+        {triton::extlibs::capstone::X86_REG_SI,     triton::arch::x86::ID_REG_SI},
+        {triton::extlibs::capstone::X86_REG_SIL,    triton::arch::x86::ID_REG_SIL},
+        {triton::extlibs::capstone::X86_REG_RBP,    triton::arch::x86::ID_REG_RBP},
+        {triton::extlibs::capstone::X86_REG_EBP,    triton::arch::x86::ID_REG_EBP},
+        {triton::extlibs::capstone::X86_REG_BP,     triton::arch::x86::ID_REG_BP},
+        {triton::extlibs::capstone::X86_REG_BPL,    triton::arch::x86::ID_REG_BPL},
+        {triton::extlibs::capstone::X86_REG_RSP,    triton::arch::x86::ID_REG_RSP},
+        {triton::extlibs::capstone::X86_REG_ESP,    triton::arch::x86::ID_REG_ESP},
+        {triton::extlibs::capstone::X86_REG_SP,     triton::arch::x86::ID_REG_SP},
+        {triton::extlibs::capstone::X86_REG_SPL,    triton::arch::x86::ID_REG_SPL},
+        {triton::extlibs::capstone::X86_REG_RIP,    triton::arch::x86::ID_REG_RIP},
+        {triton::extlibs::capstone::X86_REG_EIP,    triton::arch::x86::ID_REG_EIP},
+        {triton::extlibs::capstone::X86_REG_IP,     triton::arch::x86::ID_REG_IP},
+        {triton::extlibs::capstone::X86_REG_EFLAGS, triton::arch::x86::ID_REG_EFLAGS},
+        {triton::extlibs::capstone::X86_REG_R8,     triton::arch::x86::ID_REG_R8},
+        {triton::extlibs::capstone::X86_REG_R8D,    triton::arch::x86::ID_REG_R8D},
+        {triton::extlibs::capstone::X86_REG_R8W,    triton::arch::x86::ID_REG_R8W},
+        {triton::extlibs::capstone::X86_REG_R8B,    triton::arch::x86::ID_REG_R8B},
+        {triton::extlibs::capstone::X86_REG_R9,     triton::arch::x86::ID_REG_R9},
+        {triton::extlibs::capstone::X86_REG_R9D,    triton::arch::x86::ID_REG_R9D},
+        {triton::extlibs::capstone::X86_REG_R9W,    triton::arch::x86::ID_REG_R9W},
+        {triton::extlibs::capstone::X86_REG_R9B,    triton::arch::x86::ID_REG_R9B},
+        {triton::extlibs::capstone::X86_REG_R10,    triton::arch::x86::ID_REG_R10},
+        {triton::extlibs::capstone::X86_REG_R10D,   triton::arch::x86::ID_REG_R10D},
+        {triton::extlibs::capstone::X86_REG_R10W,   triton::arch::x86::ID_REG_R10W},
+        {triton::extlibs::capstone::X86_REG_R10B,   triton::arch::x86::ID_REG_R10B},
+        {triton::extlibs::capstone::X86_REG_R11,    triton::arch::x86::ID_REG_R11},
+        {triton::extlibs::capstone::X86_REG_R11D,   triton::arch::x86::ID_REG_R11D},
+        {triton::extlibs::capstone::X86_REG_R11W,   triton::arch::x86::ID_REG_R11W},
+        {triton::extlibs::capstone::X86_REG_R11B,   triton::arch::x86::ID_REG_R11B},
+        {triton::extlibs::capstone::X86_REG_R12,    triton::arch::x86::ID_REG_R12},
+        {triton::extlibs::capstone::X86_REG_R12D,   triton::arch::x86::ID_REG_R12D},
+        {triton::extlibs::capstone::X86_REG_R12W,   triton::arch::x86::ID_REG_R12W},
+        {triton::extlibs::capstone::X86_REG_R12B,   triton::arch::x86::ID_REG_R12B},
+        {triton::extlibs::capstone::X86_REG_R13,    triton::arch::x86::ID_REG_R13},
+        {triton::extlibs::capstone::X86_REG_R13D,   triton::arch::x86::ID_REG_R13D},
+        {triton::extlibs::capstone::X86_REG_R13W,   triton::arch::x86::ID_REG_R13W},
+        {triton::extlibs::capstone::X86_REG_R13B,   triton::arch::x86::ID_REG_R13B},
+        {triton::extlibs::capstone::X86_REG_R14,    triton::arch::x86::ID_REG_R14},
+        {triton::extlibs::capstone::X86_REG_R14D,   triton::arch::x86::ID_REG_R14D},
+        {triton::extlibs::capstone::X86_REG_R14W,   triton::arch::x86::ID_REG_R14W},
+        {triton::extlibs::capstone::X86_REG_R14B,   triton::arch::x86::ID_REG_R14B},
+        {triton::extlibs::capstone::X86_REG_R15,    triton::arch::x86::ID_REG_R15},
+        {triton::extlibs::capstone::X86_REG_R15D,   triton::arch::x86::ID_REG_R15D},
+        {triton::extlibs::capstone::X86_REG_R15W,   triton::arch::x86::ID_REG_R15W},
+        {triton::extlibs::capstone::X86_REG_R15B,   triton::arch::x86::ID_REG_R15B},
+        {triton::extlibs::capstone::X86_REG_MM0,    triton::arch::x86::ID_REG_MM0},
+        {triton::extlibs::capstone::X86_REG_MM1,    triton::arch::x86::ID_REG_MM1},
+        {triton::extlibs::capstone::X86_REG_MM2,    triton::arch::x86::ID_REG_MM2},
+        {triton::extlibs::capstone::X86_REG_MM3,    triton::arch::x86::ID_REG_MM3},
+        {triton::extlibs::capstone::X86_REG_MM4,    triton::arch::x86::ID_REG_MM4},
+        {triton::extlibs::capstone::X86_REG_MM5,    triton::arch::x86::ID_REG_MM5},
+        {triton::extlibs::capstone::X86_REG_MM6,    triton::arch::x86::ID_REG_MM6},
+        {triton::extlibs::capstone::X86_REG_MM7,    triton::arch::x86::ID_REG_MM7},
+        {triton::extlibs::capstone::X86_REG_XMM0,   triton::arch::x86::ID_REG_XMM0},
+        {triton::extlibs::capstone::X86_REG_XMM1,   triton::arch::x86::ID_REG_XMM1},
+        {triton::extlibs::capstone::X86_REG_XMM2,   triton::arch::x86::ID_REG_XMM2},
+        {triton::extlibs::capstone::X86_REG_XMM3,   triton::arch::x86::ID_REG_XMM3},
+        {triton::extlibs::capstone::X86_REG_XMM4,   triton::arch::x86::ID_REG_XMM4},
+        {triton::extlibs::capstone::X86_REG_XMM5,   triton::arch::x86::ID_REG_XMM5},
+        {triton::extlibs::capstone::X86_REG_XMM6,   triton::arch::x86::ID_REG_XMM6},
+        {triton::extlibs::capstone::X86_REG_XMM7,   triton::arch::x86::ID_REG_XMM7},
+        {triton::extlibs::capstone::X86_REG_XMM8,   triton::arch::x86::ID_REG_XMM8},
+        {triton::extlibs::capstone::X86_REG_XMM9,   triton::arch::x86::ID_REG_XMM9},
+        {triton::extlibs::capstone::X86_REG_XMM10,  triton::arch::x86::ID_REG_XMM10},
+        {triton::extlibs::capstone::X86_REG_XMM11,  triton::arch::x86::ID_REG_XMM11},
+        {triton::extlibs::capstone::X86_REG_XMM12,  triton::arch::x86::ID_REG_XMM12},
+        {triton::extlibs::capstone::X86_REG_XMM13,  triton::arch::x86::ID_REG_XMM13},
+        {triton::extlibs::capstone::X86_REG_XMM14,  triton::arch::x86::ID_REG_XMM14},
+        {triton::extlibs::capstone::X86_REG_XMM15,  triton::arch::x86::ID_REG_XMM15},
+        {triton::extlibs::capstone::X86_REG_YMM0,   triton::arch::x86::ID_REG_YMM0},
+        {triton::extlibs::capstone::X86_REG_YMM1,   triton::arch::x86::ID_REG_YMM1},
+        {triton::extlibs::capstone::X86_REG_YMM2,   triton::arch::x86::ID_REG_YMM2},
+        {triton::extlibs::capstone::X86_REG_YMM3,   triton::arch::x86::ID_REG_YMM3},
+        {triton::extlibs::capstone::X86_REG_YMM4,   triton::arch::x86::ID_REG_YMM4},
+        {triton::extlibs::capstone::X86_REG_YMM5,   triton::arch::x86::ID_REG_YMM5},
+        {triton::extlibs::capstone::X86_REG_YMM6,   triton::arch::x86::ID_REG_YMM6},
+        {triton::extlibs::capstone::X86_REG_YMM7,   triton::arch::x86::ID_REG_YMM7},
+        {triton::extlibs::capstone::X86_REG_YMM8,   triton::arch::x86::ID_REG_YMM8},
+        {triton::extlibs::capstone::X86_REG_YMM9,   triton::arch::x86::ID_REG_YMM9},
+        {triton::extlibs::capstone::X86_REG_YMM10,  triton::arch::x86::ID_REG_YMM10},
+        {triton::extlibs::capstone::X86_REG_YMM11,  triton::arch::x86::ID_REG_YMM11},
+        {triton::extlibs::capstone::X86_REG_YMM12,  triton::arch::x86::ID_REG_YMM12},
+        {triton::extlibs::capstone::X86_REG_YMM13,  triton::arch::x86::ID_REG_YMM13},
+        {triton::extlibs::capstone::X86_REG_YMM14,  triton::arch::x86::ID_REG_YMM14},
+        {triton::extlibs::capstone::X86_REG_YMM15,  triton::arch::x86::ID_REG_YMM15},
+        {triton::extlibs::capstone::X86_REG_ZMM0,   triton::arch::x86::ID_REG_ZMM0},
+        {triton::extlibs::capstone::X86_REG_ZMM1,   triton::arch::x86::ID_REG_ZMM1},
+        {triton::extlibs::capstone::X86_REG_ZMM2,   triton::arch::x86::ID_REG_ZMM2},
+        {triton::extlibs::capstone::X86_REG_ZMM3,   triton::arch::x86::ID_REG_ZMM3},
+        {triton::extlibs::capstone::X86_REG_ZMM4,   triton::arch::x86::ID_REG_ZMM4},
+        {triton::extlibs::capstone::X86_REG_ZMM5,   triton::arch::x86::ID_REG_ZMM5},
+        {triton::extlibs::capstone::X86_REG_ZMM6,   triton::arch::x86::ID_REG_ZMM6},
+        {triton::extlibs::capstone::X86_REG_ZMM7,   triton::arch::x86::ID_REG_ZMM7},
+        {triton::extlibs::capstone::X86_REG_ZMM8,   triton::arch::x86::ID_REG_ZMM8},
+        {triton::extlibs::capstone::X86_REG_ZMM9,   triton::arch::x86::ID_REG_ZMM9},
+        {triton::extlibs::capstone::X86_REG_ZMM10,  triton::arch::x86::ID_REG_ZMM10},
+        {triton::extlibs::capstone::X86_REG_ZMM11,  triton::arch::x86::ID_REG_ZMM11},
+        {triton::extlibs::capstone::X86_REG_ZMM12,  triton::arch::x86::ID_REG_ZMM12},
+        {triton::extlibs::capstone::X86_REG_ZMM13,  triton::arch::x86::ID_REG_ZMM13},
+        {triton::extlibs::capstone::X86_REG_ZMM14,  triton::arch::x86::ID_REG_ZMM14},
+        {triton::extlibs::capstone::X86_REG_ZMM15,  triton::arch::x86::ID_REG_ZMM15},
+        {triton::extlibs::capstone::X86_REG_ZMM16,  triton::arch::x86::ID_REG_ZMM16},
+        {triton::extlibs::capstone::X86_REG_ZMM17,  triton::arch::x86::ID_REG_ZMM17},
+        {triton::extlibs::capstone::X86_REG_ZMM18,  triton::arch::x86::ID_REG_ZMM18},
+        {triton::extlibs::capstone::X86_REG_ZMM19,  triton::arch::x86::ID_REG_ZMM19},
+        {triton::extlibs::capstone::X86_REG_ZMM20,  triton::arch::x86::ID_REG_ZMM20},
+        {triton::extlibs::capstone::X86_REG_ZMM21,  triton::arch::x86::ID_REG_ZMM21},
+        {triton::extlibs::capstone::X86_REG_ZMM22,  triton::arch::x86::ID_REG_ZMM22},
+        {triton::extlibs::capstone::X86_REG_ZMM23,  triton::arch::x86::ID_REG_ZMM23},
+        {triton::extlibs::capstone::X86_REG_ZMM24,  triton::arch::x86::ID_REG_ZMM24},
+        {triton::extlibs::capstone::X86_REG_ZMM25,  triton::arch::x86::ID_REG_ZMM25},
+        {triton::extlibs::capstone::X86_REG_ZMM26,  triton::arch::x86::ID_REG_ZMM26},
+        {triton::extlibs::capstone::X86_REG_ZMM27,  triton::arch::x86::ID_REG_ZMM27},
+        {triton::extlibs::capstone::X86_REG_ZMM28,  triton::arch::x86::ID_REG_ZMM28},
+        {triton::extlibs::capstone::X86_REG_ZMM29,  triton::arch::x86::ID_REG_ZMM29},
+        {triton::extlibs::capstone::X86_REG_ZMM30,  triton::arch::x86::ID_REG_ZMM30},
+        {triton::extlibs::capstone::X86_REG_ZMM31,  triton::arch::x86::ID_REG_ZMM31},
+        {triton::extlibs::capstone::X86_REG_CR0,    triton::arch::x86::ID_REG_CR0},
+        {triton::extlibs::capstone::X86_REG_CR1,    triton::arch::x86::ID_REG_CR1},
+        {triton::extlibs::capstone::X86_REG_CR2,    triton::arch::x86::ID_REG_CR2},
+        {triton::extlibs::capstone::X86_REG_CR3,    triton::arch::x86::ID_REG_CR3},
+        {triton::extlibs::capstone::X86_REG_CR4,    triton::arch::x86::ID_REG_CR4},
+        {triton::extlibs::capstone::X86_REG_CR5,    triton::arch::x86::ID_REG_CR5},
+        {triton::extlibs::capstone::X86_REG_CR6,    triton::arch::x86::ID_REG_CR6},
+        {triton::extlibs::capstone::X86_REG_CR7,    triton::arch::x86::ID_REG_CR7},
+        {triton::extlibs::capstone::X86_REG_CR8,    triton::arch::x86::ID_REG_CR8},
+        {triton::extlibs::capstone::X86_REG_CR9,    triton::arch::x86::ID_REG_CR9},
+        {triton::extlibs::capstone::X86_REG_CR10,   triton::arch::x86::ID_REG_CR10},
+        {triton::extlibs::capstone::X86_REG_CR11,   triton::arch::x86::ID_REG_CR11},
+        {triton::extlibs::capstone::X86_REG_CR12,   triton::arch::x86::ID_REG_CR12},
+        {triton::extlibs::capstone::X86_REG_CR13,   triton::arch::x86::ID_REG_CR13},
+        {triton::extlibs::capstone::X86_REG_CR14,   triton::arch::x86::ID_REG_CR14},
+        {triton::extlibs::capstone::X86_REG_CR15,   triton::arch::x86::ID_REG_CR15},
+        {triton::extlibs::capstone::X86_REG_CS,     triton::arch::x86::ID_REG_CS},
+        {triton::extlibs::capstone::X86_REG_DS,     triton::arch::x86::ID_REG_DS},
+        {triton::extlibs::capstone::X86_REG_ES,     triton::arch::x86::ID_REG_ES},
+        {triton::extlibs::capstone::X86_REG_FS,     triton::arch::x86::ID_REG_FS},
+        {triton::extlibs::capstone::X86_REG_GS,     triton::arch::x86::ID_REG_GS},
+        {triton::extlibs::capstone::X86_REG_SS,     triton::arch::x86::ID_REG_SS}
+      };
 
-          case triton::arch::x86::ID_REG_YMM8:
-            ret.setName("ymm8");
-            ret.setHigh(QQWORD_SIZE_BIT-1);
-            ret.setLow(0);
-            ret.setParentId(triton::arch::x86::ID_REG_YMM8);
-            break;
 
-          case triton::arch::x86::ID_REG_YMM9:
-            ret.setName("ymm9");
-            ret.setHigh(QQWORD_SIZE_BIT-1);
-            ret.setLow(0);
-            ret.setParentId(triton::arch::x86::ID_REG_YMM9);
-            break;
+      /* Capstone's instruction ids (first) and their triton's instruction ids (second) */
+      static constexpr triton::uint32 capstoneInstructions[][2] = {
+        {triton::extlibs::capstone::X86_INS_INVALID,          triton::arch::x86::ID_INST_INVALID},
+        {triton::extlibs::capstone::X86_INS_AAA,              triton::arch::x86::ID_INS_AAA},
+        {triton::extlibs::capstone::X86_INS_AAD,              triton::arch::x86::ID_INS_AAD},
+        {triton::extlibs::capstone::X86_INS_AAM,              triton::arch::x86::ID_INS_AAM},
+        {triton::extlibs::capstone::X86_INS_AAS,              triton::arch::x86::ID_INS_AAS},
+        {triton::extlibs::capstone::X86_INS_FABS,             triton::arch::x86::ID_INS_FABS},
+        {triton::extlibs::capstone::X86_INS_ADC,              triton::arch::x86::ID_INS_ADC},
+        {triton::extlibs::capstone::X86_INS_ADCX,             triton::arch::x86::ID_INS_ADCX},
+        {triton::extlibs::capstone::X86_INS_ADD,              triton::arch::x86::ID_INS_ADD},
+        {triton::extlibs::capstone::X86_INS_ADDPD,            triton::arch::x86::ID_INS_ADDPD},
+        {triton::extlibs::capstone::X86_INS_ADDPS,            triton::arch::x86::ID_INS_ADDPS},
+        {triton::extlibs::capstone::X86_INS_ADDSD,            triton::arch::x86::ID_INS_ADDSD},
+        {triton::extlibs::capstone::X86_INS_ADDSS,            triton::arch::x86::ID_INS_ADDSS},
+        {triton::extlibs::capstone::X86_INS_ADDSUBPD,         triton::arch::x86::ID_INS_ADDSUBPD},
+        {triton::extlibs::capstone::X86_INS_ADDSUBPS,         triton::arch::x86::ID_INS_ADDSUBPS},
+        {triton::extlibs::capstone::X86_INS_FADD,             triton::arch::x86::ID_INS_FADD},
+        {triton::extlibs::capstone::X86_INS_FIADD,            triton::arch::x86::ID_INS_FIADD},
+        {triton::extlibs::capstone::X86_INS_FADDP,            triton::arch::x86::ID_INS_FADDP},
+        {triton::extlibs::capstone::X86_INS_ADOX,             triton::arch::x86::ID_INS_ADOX},
+        {triton::extlibs::capstone::X86_INS_AESDECLAST,       triton::arch::x86::ID_INS_AESDECLAST},
+        {triton::extlibs::capstone::X86_INS_AESDEC,           triton::arch::x86::ID_INS_AESDEC},
+        {triton::extlibs::capstone::X86_INS_AESENCLAST,       triton::arch::x86::ID_INS_AESENCLAST},
+        {triton::extlibs::capstone::X86_INS_AESENC,           triton::arch::x86::ID_INS_AESENC},
+        {triton::extlibs::capstone::X86_INS_AESIMC,           triton::arch::x86::ID_INS_AESIMC},
+        {triton::extlibs::capstone::X86_INS_AESKEYGENASSIST,  triton::arch::x86::ID_INS_AESKEYGENASSIST},
+        {triton::extlibs::capstone::X86_INS_AND,              triton::arch::x86::ID_INS_AND},
+        {triton::extlibs::capstone::X86_INS_ANDN,             triton::arch::x86::ID_INS_ANDN},
+        {triton::extlibs::capstone::X86_INS_ANDNPD,           triton::arch::x86::ID_INS_ANDNPD},
+        {triton::extlibs::capstone::X86_INS_ANDNPS,           triton::arch::x86::ID_INS_ANDNPS},
+        {triton::extlibs::capstone::X86_INS_ANDPD,            triton::arch::x86::ID_INS_ANDPD},
+        {triton::extlibs::capstone::X86_INS_ANDPS,            triton::arch::x86::ID_INS_ANDPS},
+        {triton::extlibs::capstone::X86_INS_ARPL,             triton::arch::x86::ID_INS_ARPL},
+        {triton::extlibs::capstone::X86_INS_BEXTR,            triton::arch::x86::ID_INS_BEXTR},
+        {triton::extlibs::capstone::X86_INS_BLCFILL,          triton::arch::x86::ID_INS_BLCFILL},
+        {triton::extlibs::capstone::X86_INS_BLCI,             triton::arch::x86::ID_INS_BLCI},
+        {triton::extlibs::capstone::X86_INS_BLCIC,            triton::arch::x86::ID_INS_BLCIC},
+        {triton::extlibs::capstone::X86_INS_BLCMSK,           triton::arch::x86::ID_INS_BLCMSK},
+        {triton::extlibs::capstone::X86_INS_BLCS,             triton::arch::x86::ID_INS_BLCS},
+        {triton::extlibs::capstone::X86_INS_BLENDPD,          triton::arch::x86::ID_INS_BLENDPD},
+        {triton::extlibs::capstone::X86_INS_BLENDPS,          triton::arch::x86::ID_INS_BLENDPS},
+        {triton::extlibs::capstone::X86_INS_BLENDVPD,         triton::arch::x86::ID_INS_BLENDVPD},
+        {triton::extlibs::capstone::X86_INS_BLENDVPS,         triton::arch::x86::ID_INS_BLENDVPS},
+        {triton::extlibs::capstone::X86_INS_BLSFILL,          triton::arch::x86::ID_INS_BLSFILL},
+        {triton::extlibs::capstone::X86_INS_BLSI,             triton::arch::x86::ID_INS_BLSI},
+        {triton::extlibs::capstone::X86_INS_BLSIC,            triton::arch::x86::ID_INS_BLSIC},
+        {triton::extlibs::capstone::X86_INS_BLSMSK,           triton::arch::x86::ID_INS_BLSMSK},
+        {triton::extlibs::capstone::X86_INS_BLSR,             triton::arch::x86::ID_INS_BLSR},
+        {triton::extlibs::capstone::X86_INS_BOUND,            triton::arch::x86::ID_INS_BOUND},
+        {triton::extlibs::capstone::X86_INS_BSF,              triton::arch::x86::ID_INS_BSF},
+        {triton::extlibs::capstone::X86_INS_BSR,              triton::arch::x86::ID_INS_BSR},
+        {triton::extlibs::capstone::X86_INS_BSWAP,            triton::arch::x86::ID_INS_BSWAP},
+        {triton::extlibs::capstone::X86_INS_BT,               triton::arch::x86::ID_INS_BT},
+        {triton::extlibs::capstone::X86_INS_BTC,              triton::arch::x86::ID_INS_BTC},
+        {triton::extlibs::capstone::X86_INS_BTR,              triton::arch::x86::ID_INS_BTR},
+        {triton::extlibs::capstone::X86_INS_BTS,              triton::arch::x86::ID_INS_BTS},
+        {triton::extlibs::capstone::X86_INS_BZHI,             triton::arch::x86::ID_INS_BZHI},
+        {triton::extlibs::capstone::X86_INS_CALL,             triton::arch::x86::ID_INS_CALL},
+        {triton::extlibs::capstone::X86_INS_CBW,              triton::arch::x86::ID_INS_CBW},
+        {triton::extlibs::capstone::X86_INS_CDQ,              triton::arch::x86::ID_INS_CDQ},
+        {triton::extlibs::capstone::X86_INS_CDQE,             triton::arch::x86::ID_INS_CDQE},
+        {triton::extlibs::capstone::X86_INS_FCHS,             triton::arch::x86::ID_INS_FCHS},
+        {triton::extlibs::capstone::X86_INS_CLAC,             triton::arch::x86::ID_INS_CLAC},
+        {triton::extlibs::capstone::X86_INS_CLC,              triton::arch::x86::ID_INS_CLC},
+        {triton::extlibs::capstone::X86_INS_CLD,              triton::arch::x86::ID_INS_CLD},
+        {triton::extlibs::capstone::X86_INS_CLFLUSH,          triton::arch::x86::ID_INS_CLFLUSH},
+        {triton::extlibs::capstone::X86_INS_CLGI,             triton::arch::x86::ID_INS_CLGI},
+        {triton::extlibs::capstone::X86_INS_CLI,              triton::arch::x86::ID_INS_CLI},
+        {triton::extlibs::capstone::X86_INS_CLTS,             triton::arch::x86::ID_INS_CLTS},
+        {triton::extlibs::capstone::X86_INS_CMC,              triton::arch::x86::ID_INS_CMC},
+        {triton::extlibs::capstone::X86_INS_CMOVA,            triton::arch::x86::ID_INS_CMOVA},
+        {triton::extlibs::capstone::X86_INS_CMOVAE,           triton::arch::x86::ID_INS_CMOVAE},
+        {triton::extlibs::capstone::X86_INS_CMOVB,            triton::arch::x86::ID_INS_CMOVB},
+        {triton::extlibs::capstone::X86_INS_CMOVBE,           triton::arch::x86::ID_INS_CMOVBE},
+        {triton::extlibs::capstone::X86_INS_FCMOVBE,          triton::arch::x86::ID_INS_FCMOVBE},
+        {triton::extlibs::capstone::X86_INS_FCMOVB,           triton::arch::x86::ID_INS_FCMOVB},
+        {triton::extlibs::capstone::X86_INS_CMOVE,            triton::arch::x86::ID_INS_CMOVE},
+        {triton::extlibs::capstone::X86_INS_FCMOVE,           triton::arch::x86::ID_INS_FCMOVE},
+        {triton::extlibs::capstone::X86_INS_CMOVG,            triton::arch::x86::ID_INS_CMOVG},
+        {triton::extlibs::capstone::X86_INS_CMOVGE,           triton::arch::x86::ID_INS_CMOVGE},
+        {triton::extlibs::capstone::X86_INS_CMOVL,            triton::arch::x86::ID_INS_CMOVL},
+        {triton::extlibs::capstone::X86_INS_CMOVLE,           triton::arch::x86::ID_INS_CMOVLE},
+        {triton::extlibs::capstone::X86_INS_FCMOVNBE,         triton::arch::x86::ID_INS_FCMOVNBE},
+        {triton::extlibs::capstone::X86_INS_FCMOVNB,          triton::arch::x86::ID_INS_FCMOVNB},
+        {triton::extlibs::capstone::X86_INS_CMOVNE,           triton::arch::x86::ID_INS_CMOVNE},
+        {triton::extlibs::capstone::X86_INS_FCMOVNE,          triton::arch::x86::ID_INS_FCMOVNE},
+        {triton::extlibs::capstone::X86_INS_CMOVNO,           triton::arch::x86::ID_INS_CMOVNO},
+        {triton::extlibs::capstone::X86_INS_CMOVNP,           triton::arch::x86::ID_INS_CMOVNP},
+        {triton::extlibs::capstone::X86_INS_FCMOVNU,          triton::arch::x86::ID_INS_FCMOVNU},
+        {triton::extlibs::capstone::X86_INS_CMOVNS,           triton::arch::x86::ID_INS_CMOVNS},
+        {triton::extlibs::capstone::X86_INS_CMOVO,            triton::arch::x86::ID_INS_CMOVO},
+        {triton::extlibs::capstone::X86_INS_CMOVP,            triton::arch::x86::ID_INS_CMOVP},
+        {triton::extlibs::capstone::X86_INS_FCMOVU,           triton::arch::x86::ID_INS_FCMOVU},
+        {triton::extlibs::capstone::X86_INS_CMOVS,            triton::arch::x86::ID_INS_CMOVS},
+        {triton::extlibs::capstone::X86_INS_CMP,              triton::arch::x86::ID_INS_CMP},
+        {triton::extlibs::capstone::X86_INS_CMPPD,            triton::arch::x86::ID_INS_CMPPD},
+        {triton::extlibs::capstone::X86_INS_CMPPS,            triton::arch::x86::ID_INS_CMPPS},
+        {triton::extlibs::capstone::X86_INS_CMPSB,            triton::arch::x86::ID_INS_CMPSB},
+        {triton::extlibs::capstone::X86_INS_CMPSD,            triton::arch::x86::ID_INS_CMPSD},
+        {triton::extlibs::capstone::X86_INS_CMPSQ,            triton::arch::x86::ID_INS_CMPSQ},
+        {triton::extlibs::capstone::X86_INS_CMPSS,            triton::arch::x86::ID_INS_CMPSS},
+        {triton::extlibs::capstone::X86_INS_CMPSW,            triton::arch::x86::ID_INS_CMPSW},
+        {triton::extlibs::capstone::X86_INS_CMPXCHG16B,       triton::arch::x86::ID_INS_CMPXCHG16B},
+        {triton::extlibs::capstone::X86_INS_CMPXCHG,          triton::arch::x86::ID_INS_CMPXCHG},
+        {triton::extlibs::capstone::X86_INS_CMPXCHG8B,        triton::arch::x86::ID_INS_CMPXCHG8B},
+        {triton::extlibs::capstone::X86_INS_COMISD,           triton::arch::x86::ID_INS_COMISD},
+        {triton::extlibs::capstone::X86_INS_COMISS,           triton::arch::x86::ID_INS_COMISS},
+        {triton::extlibs::capstone::X86_INS_FCOMP,            triton::arch::x86::ID_INS_FCOMP},
+        {triton::extlibs::capstone::X86_INS_FCOMPI,           triton::arch::x86::ID_INS_FCOMPI},
+        {triton::extlibs::capstone::X86_INS_FCOMI,            triton::arch::x86::ID_INS_FCOMI},
+        {triton::extlibs::capstone::X86_INS_FCOM,             triton::arch::x86::ID_INS_FCOM},
+        {triton::extlibs::capstone::X86_INS_FCOS,             triton::arch::x86::ID_INS_FCOS},
+        {triton::extlibs::capstone::X86_INS_CPUID,            triton::arch::x86::ID_INS_CPUID},
+        {triton::extlibs::capstone::X86_INS_CQO,              triton::arch::x86::ID_INS_CQO},
+        {triton::extlibs::capstone::X86_INS_CRC32,            triton::arch::x86::ID_INS_CRC32},
+        {triton::extlibs::capstone::X86_INS_CVTDQ2PD,         triton::arch::x86::ID_INS_CVTDQ2PD},
+        {triton::extlibs::capstone::X86_INS_CVTDQ2PS,         triton::arch::x86::ID_INS_CVTDQ2PS},
+        {triton::extlibs::capstone::X86_INS_CVTPD2DQ,         triton::arch::x86::ID_INS_CVTPD2DQ},
+        {triton::extlibs::capstone::X86_INS_CVTPD2PS,         triton::arch::x86::ID_INS_CVTPD2PS},
+        {triton::extlibs::capstone::X86_INS_CVTPS2DQ,         triton::arch::x86::ID_INS_CVTPS2DQ},
+        {triton::extlibs::capstone::X86_INS_CVTPS2PD,         triton::arch::x86::ID_INS_CVTPS2PD},
+        {triton::extlibs::capstone::X86_INS_CVTSD2SI,         triton::arch::x86::ID_INS_CVTSD2SI},
+        {triton::extlibs::capstone::X86_INS_CVTSD2SS,         triton::arch::x86::ID_INS_CVTSD2SS},
+        {triton::extlibs::capstone::X86_INS_CVTSI2SD,         triton::arch::x86::ID_INS_CVTSI2SD},
+        {triton::extlibs::capstone::X86_INS_CVTSI2SS,         triton::arch::x86::ID_INS_CVTSI2SS},
+        {triton::extlibs::capstone::X86_INS_CVTSS2SD,         triton::arch::x86::ID_INS_CVTSS2SD},
+        {triton::extlibs::capstone::X86_INS_CVTSS2SI,         triton::arch::x86::ID_INS_CVTSS2SI},
+        {triton::extlibs::capstone::X86_INS_CVTTPD2DQ,        triton::arch::x86::ID_INS_CVTTPD2DQ},
+        {triton::extlibs::capstone::X86_INS_CVTTPS2DQ,        triton::arch::x86::ID_INS_CVTTPS2DQ},
+        {triton::extlibs::capstone::X86_INS_CVTTSD2SI,        triton::arch::x86::ID_INS_CVTTSD2SI},
+        {triton::extlibs::capstone::X86_INS_CVTTSS2SI,        triton::arch::x86::ID_INS_CVTTSS2SI},
+        {triton::extlibs::capstone::X86_INS_CWD,              triton::arch::x86::ID_INS_CWD},
+        {triton::extlibs::capstone::X86_INS_CWDE,             triton::arch::x86::ID_INS_CWDE},
+        {triton::extlibs::capstone::X86_INS_DAA,              triton::arch::x86::ID_INS_DAA},
+        {triton::extlibs::capstone::X86_INS_DAS,              triton::arch::x86::ID_INS_DAS},
+        {triton::extlibs::capstone::X86_INS_DATA16,           triton::arch::x86::ID_INS_DATA16},
+        {triton::extlibs::capstone::X86_INS_DEC,              triton::arch::x86::ID_INS_DEC},
+        {triton::extlibs::capstone::X86_INS_DIV,              triton::arch::x86::ID_INS_DIV},
+        {triton::extlibs::capstone::X86_INS_DIVPD,            triton::arch::x86::ID_INS_DIVPD},
+        {triton::extlibs::capstone::X86_INS_DIVPS,            triton::arch::x86::ID_INS_DIVPS},
+        {triton::extlibs::capstone::X86_INS_FDIVR,            triton::arch::x86::ID_INS_FDIVR},
+        {triton::extlibs::capstone::X86_INS_FIDIVR,           triton::arch::x86::ID_INS_FIDIVR},
+        {triton::extlibs::capstone::X86_INS_FDIVRP,           triton::arch::x86::ID_INS_FDIVRP},
+        {triton::extlibs::capstone::X86_INS_DIVSD,            triton::arch::x86::ID_INS_DIVSD},
+        {triton::extlibs::capstone::X86_INS_DIVSS,            triton::arch::x86::ID_INS_DIVSS},
+        {triton::extlibs::capstone::X86_INS_FDIV,             triton::arch::x86::ID_INS_FDIV},
+        {triton::extlibs::capstone::X86_INS_FIDIV,            triton::arch::x86::ID_INS_FIDIV},
+        {triton::extlibs::capstone::X86_INS_FDIVP,            triton::arch::x86::ID_INS_FDIVP},
+        {triton::extlibs::capstone::X86_INS_DPPD,             triton::arch::x86::ID_INS_DPPD},
+        {triton::extlibs::capstone::X86_INS_DPPS,             triton::arch::x86::ID_INS_DPPS},
+        {triton::extlibs::capstone::X86_INS_RET,              triton::arch::x86::ID_INS_RET},
+        {triton::extlibs::capstone::X86_INS_ENCLS,            triton::arch::x86::ID_INS_ENCLS},
+        {triton::extlibs::capstone::X86_INS_ENCLU,            triton::arch::x86::ID_INS_ENCLU},
+        {triton::extlibs::capstone::X86_INS_ENTER,            triton::arch::x86::ID_INS_ENTER},
+        {triton::extlibs::capstone::X86_INS_EXTRACTPS,        triton::arch::x86::ID_INS_EXTRACTPS},
+        {triton::extlibs::capstone::X86_INS_EXTRQ,            triton::arch::x86::ID_INS_EXTRQ},
+        {triton::extlibs::capstone::X86_INS_F2XM1,            triton::arch::x86::ID_INS_F2XM1},
+        {triton::extlibs::capstone::X86_INS_LCALL,            triton::arch::x86::ID_INS_LCALL},
+        {triton::extlibs::capstone::X86_INS_LJMP,             triton::arch::x86::ID_INS_LJMP},
+        {triton::extlibs::capstone::X86_INS_FBLD,             triton::arch::x86::ID_INS_FBLD},
+        {triton::extlibs::capstone::X86_INS_FBSTP,            triton::arch::x86::ID_INS_FBSTP},
+        {triton::extlibs::capstone::X86_INS_FCOMPP,           triton::arch::x86::ID_INS_FCOMPP},
+        {triton::extlibs::capstone::X86_INS_FDECSTP,          triton::arch::x86::ID_INS_FDECSTP},
+        {triton::extlibs::capstone::X86_INS_FEMMS,            triton::arch::x86::ID_INS_FEMMS},
+        {triton::extlibs::capstone::X86_INS_FFREE,            triton::arch::x86::ID_INS_FFREE},
+        {triton::extlibs::capstone::X86_INS_FICOM,            triton::arch::x86::ID_INS_FICOM},
+        {triton::extlibs::capstone::X86_INS_FICOMP,           triton::arch::x86::ID_INS_FICOMP},
+        {triton::extlibs::capstone::X86_INS_FINCSTP,          triton::arch::x86::ID_INS_FINCSTP},
+        {triton::extlibs::capstone::X86_INS_FLDCW,            triton::arch::x86::ID_INS_FLDCW},
+        {triton::extlibs::capstone::X86_INS_FLDENV,           triton::arch::x86::ID_INS_FLDENV},
+        {triton::extlibs::capstone::X86_INS_FLDL2E,           triton::arch::x86::ID_INS_FLDL2E},
+        {triton::extlibs::capstone::X86_INS_FLDL2T,           triton::arch::x86::ID_INS_FLDL2T},
+        {triton::extlibs::capstone::X86_INS_FLDLG2,           triton::arch::x86::ID_INS_FLDLG2},
+        {triton::extlibs::capstone::X86_INS_FLDLN2,           triton::arch::x86::ID_INS_FLDLN2},
+        {triton::extlibs::capstone::X86_INS_FLDPI,            triton::arch::x86::ID_INS_FLDPI},
+        {triton::extlibs::capstone::X86_INS_FNCLEX,           triton::arch::x86::ID_INS_FNCLEX},
+        {triton::extlibs::capstone::X86_INS_FNINIT,           triton::arch::x86::ID_INS_FNINIT},
+        {triton::extlibs::capstone::X86_INS_FNOP,             triton::arch::x86::ID_INS_FNOP},
+        {triton::extlibs::capstone::X86_INS_FNSTCW,           triton::arch::x86::ID_INS_FNSTCW},
+        {triton::extlibs::capstone::X86_INS_FNSTSW,           triton::arch::x86::ID_INS_FNSTSW},
+        {triton::extlibs::capstone::X86_INS_FPATAN,           triton::arch::x86::ID_INS_FPATAN},
+        {triton::extlibs::capstone::X86_INS_FPREM,            triton::arch::x86::ID_INS_FPREM},
+        {triton::extlibs::capstone::X86_INS_FPREM1,           triton::arch::x86::ID_INS_FPREM1},
+        {triton::extlibs::capstone::X86_INS_FPTAN,            triton::arch::x86::ID_INS_FPTAN},
+        {triton::extlibs::capstone::X86_INS_FRNDINT,          triton::arch::x86::ID_INS_FRNDINT},
+        {triton::extlibs::capstone::X86_INS_FRSTOR,           triton::arch::x86::ID_INS_FRSTOR},
+        {triton::extlibs::capstone::X86_INS_FNSAVE,           triton::arch::x86::ID_INS_FNSAVE},
+        {triton::extlibs::capstone::X86_INS_FSCALE,           triton::arch::x86::ID_INS_FSCALE},
+        {triton::extlibs::capstone::X86_INS_FSETPM,           triton::arch::x86::ID_INS_FSETPM},
+        {triton::extlibs::capstone::X86_INS_FSINCOS,          triton::arch::x86::ID_INS_FSINCOS},
+        {triton::extlibs::capstone::X86_INS_FNSTENV,          triton::arch::x86::ID_INS_FNSTENV},
+        {triton::extlibs::capstone::X86_INS_FXAM,             triton::arch::x86::ID_INS_FXAM},
+        {triton::extlibs::capstone::X86_INS_FXRSTOR,          triton::arch::x86::ID_INS_FXRSTOR},
+        {triton::extlibs::capstone::X86_INS_FXRSTOR64,        triton::arch::x86::ID_INS_FXRSTOR64},
+        {triton::extlibs::capstone::X86_INS_FXSAVE,           triton::arch::x86::ID_INS_FXSAVE},
+        {triton::extlibs::capstone::X86_INS_FXSAVE64,         triton::arch::x86::ID_INS_FXSAVE64},
+        {triton::extlibs::capstone::X86_INS_FXTRACT,          triton::arch::x86::ID_INS_FXTRACT},
+        {triton::extlibs::capstone::X86_INS_FYL2X,            triton::arch::x86::ID_INS_FYL2X},
+        {triton::extlibs::capstone::X86_INS_FYL2XP1,          triton::arch::x86::ID_INS_FYL2XP1},
+        {triton::extlibs::capstone::X86_INS_MOVAPD,           triton::arch::x86::ID_INS_MOVAPD},
+        {triton::extlibs::capstone::X86_INS_MOVAPS,           triton::arch::x86::ID_INS_MOVAPS},
+        {triton::extlibs::capstone::X86_INS_ORPD,             triton::arch::x86::ID_INS_ORPD},
+        {triton::extlibs::capstone::X86_INS_ORPS,             triton::arch::x86::ID_INS_ORPS},
+        {triton::extlibs::capstone::X86_INS_VMOVAPD,          triton::arch::x86::ID_INS_VMOVAPD},
+        {triton::extlibs::capstone::X86_INS_VMOVAPS,          triton::arch::x86::ID_INS_VMOVAPS},
+        {triton::extlibs::capstone::X86_INS_XORPD,            triton::arch::x86::ID_INS_XORPD},
+        {triton::extlibs::capstone::X86_INS_XORPS,            triton::arch::x86::ID_INS_XORPS},
+        {triton::extlibs::capstone::X86_INS_GETSEC,           triton::arch::x86::ID_INS_GETSEC},
+        {triton::extlibs::capstone::X86_INS_HADDPD,           triton::arch::x86::ID_INS_HADDPD},
+        {triton::extlibs::capstone::X86_INS_HADDPS,           triton::arch::x86::ID_INS_HADDPS},
+        {triton::extlibs::capstone::X86_INS_HLT,              triton::arch::x86::ID_INS_HLT},
+        {triton::extlibs::capstone::X86_INS_HSUBPD,           triton::arch::x86::ID_INS_HSUBPD},
+        {triton::extlibs::capstone::X86_INS_HSUBPS,           triton::arch::x86::ID_INS_HSUBPS},
+        {triton::extlibs::capstone::X86_INS_IDIV,             triton::arch::x86::ID_INS_IDIV},
+        {triton::extlibs::capstone::X86_INS_FILD,             triton::arch::x86::ID_INS_FILD},
+        {triton::extlibs::capstone::X86_INS_IMUL,             triton::arch::x86::ID_INS_IMUL},
+        {triton::extlibs::capstone::X86_INS_IN,               triton::arch::x86::ID_INS_IN},
+        {triton::extlibs::capstone::X86_INS_INC,              triton::arch::x86::ID_INS_INC},
+        {triton::extlibs::capstone::X86_INS_INSB,             triton::arch::x86::ID_INS_INSB},
+        {triton::extlibs::capstone::X86_INS_INSERTPS,         triton::arch::x86::ID_INS_INSERTPS},
+        {triton::extlibs::capstone::X86_INS_INSERTQ,          triton::arch::x86::ID_INS_INSERTQ},
+        {triton::extlibs::capstone::X86_INS_INSD,             triton::arch::x86::ID_INS_INSD},
+        {triton::extlibs::capstone::X86_INS_INSW,             triton::arch::x86::ID_INS_INSW},
+        {triton::extlibs::capstone::X86_INS_INT,              triton::arch::x86::ID_INS_INT},
+        {triton::extlibs::capstone::X86_INS_INT1,             triton::arch::x86::ID_INS_INT1},
+        {triton::extlibs::capstone::X86_INS_INT3,             triton::arch::x86::ID_INS_INT3},
+        {triton::extlibs::capstone::X86_INS_INTO,             triton::arch::x86::ID_INS_INTO},
+        {triton::extlibs::capstone::X86_INS_INVD,             triton::arch::x86::ID_INS_INVD},
+        {triton::extlibs::capstone::X86_INS_INVEPT,           triton::arch::x86::ID_INS_INVEPT},
+        {triton::extlibs::capstone::X86_INS_INVLPG,           triton::arch::x86::ID_INS_INVLPG},
+        {triton::extlibs::capstone::X86_INS_INVLPGA,          triton::arch::x86::ID_INS_INVLPGA},
+        {triton::extlibs::capstone::X86_INS_INVPCID,          triton::arch::x86::ID_INS_INVPCID},
+        {triton::extlibs::capstone::X86_INS_INVVPID,          triton::arch::x86::ID_INS_INVVPID},
+        {triton::extlibs::capstone::X86_INS_IRET,             triton::arch::x86::ID_INS_IRET},
+        {triton::extlibs::capstone::X86_INS_IRETD,            triton::arch::x86::ID_INS_IRETD},
+        {triton::extlibs::capstone::X86_INS_IRETQ,            triton::arch::x86::ID_INS_IRETQ},
+        {triton::extlibs::capstone::X86_INS_FISTTP,           triton::arch::x86::ID_INS_FISTTP},
+        {triton::extlibs::capstone::X86_INS_FIST,             triton::arch::x86::ID_INS_FIST},
+        {triton::extlibs::capstone::X86_INS_FISTP,            triton::arch::x86::ID_INS_FISTP},
+        {triton::extlibs::capstone::X86_INS_UCOMISD,          triton::arch::x86::ID_INS_UCOMISD},
+        {triton::extlibs::capstone::X86_INS_UCOMISS,          triton::arch::x86::ID_INS_UCOMISS},
+        {triton::extlibs::capstone::X86_INS_VCMP,             triton::arch::x86::ID_INS_VCMP},
+        {triton::extlibs::capstone::X86_INS_VCOMISD,          triton::arch::x86::ID_INS_VCOMISD},
+        {triton::extlibs::capstone::X86_INS_VCOMISS,          triton::arch::x86::ID_INS_VCOMISS},
+        {triton::extlibs::capstone::X86_INS_VCVTSD2SS,        triton::arch::x86::ID_INS_VCVTSD2SS},
+        {triton::extlibs::capstone::X86_INS_VCVTSI2SD,        triton::arch::x86::ID_INS_VCVTSI2SD},
+        {triton::extlibs::capstone::X86_INS_VCVTSI2SS,        triton::arch::x86::ID_INS_VCVTSI2SS},
+        {triton::extlibs::capstone::X86_INS_VCVTSS2SD,        triton::arch::x86::ID_INS_VCVTSS2SD},
+        {triton::extlibs::capstone::X86_INS_VCVTTSD2SI,       triton::arch::x86::ID_INS_VCVTTSD2SI},
+        {triton::extlibs::capstone::X86_INS_VCVTTSD2USI,      triton::arch::x86::ID_INS_VCVTTSD2USI},
+        {triton::extlibs::capstone::X86_INS_VCVTTSS2SI,       triton::arch::x86::ID_INS_VCVTTSS2SI},
+        {triton::extlibs::capstone::X86_INS_VCVTTSS2USI,      triton::arch::x86::ID_INS_VCVTTSS2USI},
+        {triton::extlibs::capstone::X86_INS_VCVTUSI2SD,       triton::arch::x86::ID_INS_VCVTUSI2SD},
+        {triton::extlibs::capstone::X86_INS_VCVTUSI2SS,       triton::arch::x86::ID_INS_VCVTUSI2SS},
+        {triton::extlibs::capstone::X86_INS_VUCOMISD,         triton::arch::x86::ID_INS_VUCOMISD},
+        {triton::extlibs::capstone::X86_INS_VUCOMISS,         triton::arch::x86::ID_INS_VUCOMISS},
+        {triton::extlibs::capstone::X86_INS_JAE,              triton::arch::x86::ID_INS_JAE},
+        {triton::extlibs::capstone::X86_INS_JA,               triton::arch::x86::ID_INS_JA},
+        {triton::extlibs::capstone::X86_INS_JBE,              triton::arch::x86::ID_INS_JBE},
+        {triton::extlibs::capstone::X86_INS_JB,               triton::arch::x86::ID_INS_JB},
+        {triton::extlibs::capstone::X86_INS_JCXZ,             triton::arch::x86::ID_INS_JCXZ},
+        {triton::extlibs::capstone::X86_INS_JECXZ,            triton::arch::x86::ID_INS_JECXZ},
+        {triton::extlibs::capstone::X86_INS_JE,               triton::arch::x86::ID_INS_JE},
+        {triton::extlibs::capstone::X86_INS_JGE,              triton::arch::x86::ID_INS_JGE},
+        {triton::extlibs::capstone::X86_INS_JG,               triton::arch::x86::ID_INS_JG},
+        {triton::extlibs::capstone::X86_INS_JLE,              triton::arch::x86::ID_INS_JLE},
+        {triton::extlibs::capstone::X86_INS_JL,               triton::arch::x86::ID_INS_JL},
+        {triton::extlibs::capstone::X86_INS_JMP,              triton::arch::x86::ID_INS_JMP},
+        {triton::extlibs::capstone::X86_INS_JNE,              triton::arch::x86::ID_INS_JNE},
+        {triton::extlibs::capstone::X86_INS_JNO,              triton::arch::x86::ID_INS_JNO},
+        {triton::extlibs::capstone::X86_INS_JNP,              triton::arch::x86::ID_INS_JNP},
+        {triton::extlibs::capstone::X86_INS_JNS,              triton::arch::x86::ID_INS_JNS},
+        {triton::extlibs::capstone::X86_INS_JO,               triton::arch::x86::ID_INS_JO},
+        {triton::extlibs::capstone::X86_INS_JP,               triton::arch::x86::ID_INS_JP},
+        {triton::extlibs::capstone::X86_INS_JRCXZ,            triton::arch::x86::ID_INS_JRCXZ},
+        {triton::extlibs::capstone::X86_INS_JS,               triton::arch::x86::ID_INS_JS},
+        {triton::extlibs::capstone::X86_INS_KANDB,            triton::arch::x86::ID_INS_KANDB},
+        {triton::extlibs::capstone::X86_INS_KANDD,            triton::arch::x86::ID_INS_KANDD},
+        {triton::extlibs::capstone::X86_INS_KANDNB,           triton::arch::x86::ID_INS_KANDNB},
+        {triton::extlibs::capstone::X86_INS_KANDND,           triton::arch::x86::ID_INS_KANDND},
+        {triton::extlibs::capstone::X86_INS_KANDNQ,           triton::arch::x86::ID_INS_KANDNQ},
+        {triton::extlibs::capstone::X86_INS_KANDNW,           triton::arch::x86::ID_INS_KANDNW},
+        {triton::extlibs::capstone::X86_INS_KANDQ,            triton::arch::x86::ID_INS_KANDQ},
+        {triton::extlibs::capstone::X86_INS_KANDW,            triton::arch::x86::ID_INS_KANDW},
+        {triton::extlibs::capstone::X86_INS_KMOVB,            triton::arch::x86::ID_INS_KMOVB},
+        {triton::extlibs::capstone::X86_INS_KMOVD,            triton::arch::x86::ID_INS_KMOVD},
+        {triton::extlibs::capstone::X86_INS_KMOVQ,            triton::arch::x86::ID_INS_KMOVQ},
+        {triton::extlibs::capstone::X86_INS_KMOVW,            triton::arch::x86::ID_INS_KMOVW},
+        {triton::extlibs::capstone::X86_INS_KNOTB,            triton::arch::x86::ID_INS_KNOTB},
+        {triton::extlibs::capstone::X86_INS_KNOTD,            triton::arch::x86::ID_INS_KNOTD},
+        {triton::extlibs::capstone::X86_INS_KNOTQ,            triton::arch::x86::ID_INS_KNOTQ},
+        {triton::extlibs::capstone::X86_INS_KNOTW,            triton::arch::x86::ID_INS_KNOTW},
+        {triton::extlibs::capstone::X86_INS_KORB,             triton::arch::x86::ID_INS_KORB},
+        {triton::extlibs::capstone::X86_INS_KORD,             triton::arch::x86::ID_INS_KORD},
+        {triton::extlibs::capstone::X86_INS_KORQ,             triton::arch::x86::ID_INS_KORQ},
+        {triton::extlibs::capstone::X86_INS_KORTESTW,         triton::arch::x86::ID_INS_KORTESTW},
+        {triton::extlibs::capstone::X86_INS_KORW,             triton::arch::x86::ID_INS_KORW},
+        {triton::extlibs::capstone::X86_INS_KSHIFTLW,         triton::arch::x86::ID_INS_KSHIFTLW},
+        {triton::extlibs::capstone::X86_INS_KSHIFTRW,         triton::arch::x86::ID_INS_KSHIFTRW},
+        {triton::extlibs::capstone::X86_INS_KUNPCKBW,         triton::arch::x86::ID_INS_KUNPCKBW},
+        {triton::extlibs::capstone::X86_INS_KXNORB,           triton::arch::x86::ID_INS_KXNORB},
+        {triton::extlibs::capstone::X86_INS_KXNORD,           triton::arch::x86::ID_INS_KXNORD},
+        {triton::extlibs::capstone::X86_INS_KXNORQ,           triton::arch::x86::ID_INS_KXNORQ},
+        {triton::extlibs::capstone::X86_INS_KXNORW,           triton::arch::x86::ID_INS_KXNORW},
+        {triton::extlibs::capstone::X86_INS_KXORB,            triton::arch::x86::ID_INS_KXORB},
+        {triton::extlibs::capstone::X86_INS_KXORD,            triton::arch::x86::ID_INS_KXORD},
+        {triton::extlibs::capstone::X86_INS_KXORQ,            triton::arch::x86::ID_INS_KXORQ},
+        {triton::extlibs::capstone::X86_INS_KXORW,            triton::arch::x86::ID_INS_KXORW},
+        {triton::extlibs::capstone::X86_INS_LAHF,             triton::arch::x86::ID_INS_LAHF},
+        {triton::extlibs::capstone::X86_INS_LAR,              triton::arch::x86::ID_INS_LAR},
+        {triton::extlibs::capstone::X86_INS_LDDQU,            triton::arch::x86::ID_INS_LDDQU},
+        {triton::extlibs::capstone::X86_INS_LDMXCSR,          triton::arch::x86::ID_INS_LDMXCSR},
+        {triton::extlibs::capstone::X86_INS_LDS,              triton::arch::x86::ID_INS_LDS},
+        {triton::extlibs::capstone::X86_INS_FLDZ,             triton::arch::x86::ID_INS_FLDZ},
+        {triton::extlibs::capstone::X86_INS_FLD1,             triton::arch::x86::ID_INS_FLD1},
+        {triton::extlibs::capstone::X86_INS_FLD,              triton::arch::x86::ID_INS_FLD},
+        {triton::extlibs::capstone::X86_INS_LEA,              triton::arch::x86::ID_INS_LEA},
+        {triton::extlibs::capstone::X86_INS_LEAVE,            triton::arch::x86::ID_INS_LEAVE},
+        {triton::extlibs::capstone::X86_INS_LES,              triton::arch::x86::ID_INS_LES},
+        {triton::extlibs::capstone::X86_INS_LFENCE,           triton::arch::x86::ID_INS_LFENCE},
+        {triton::extlibs::capstone::X86_INS_LFS,              triton::arch::x86::ID_INS_LFS},
+        {triton::extlibs::capstone::X86_INS_LGDT,             triton::arch::x86::ID_INS_LGDT},
+        {triton::extlibs::capstone::X86_INS_LGS,              triton::arch::x86::ID_INS_LGS},
+        {triton::extlibs::capstone::X86_INS_LIDT,             triton::arch::x86::ID_INS_LIDT},
+        {triton::extlibs::capstone::X86_INS_LLDT,             triton::arch::x86::ID_INS_LLDT},
+        {triton::extlibs::capstone::X86_INS_LMSW,             triton::arch::x86::ID_INS_LMSW},
+        {triton::extlibs::capstone::X86_INS_OR,               triton::arch::x86::ID_INS_OR},
+        {triton::extlibs::capstone::X86_INS_SUB,              triton::arch::x86::ID_INS_SUB},
+        {triton::extlibs::capstone::X86_INS_XOR,              triton::arch::x86::ID_INS_XOR},
+        {triton::extlibs::capstone::X86_INS_LODSB,            triton::arch::x86::ID_INS_LODSB},
+        {triton::extlibs::capstone::X86_INS_LODSD,            triton::arch::x86::ID_INS_LODSD},
+        {triton::extlibs::capstone::X86_INS_LODSQ,            triton::arch::x86::ID_INS_LODSQ},
+        {triton::extlibs::capstone::X86_INS_LODSW,            triton::arch::x86::ID_INS_LODSW},
+        {triton::extlibs::capstone::X86_INS_LOOP,             triton::arch::x86::ID_INS_LOOP},
+        {triton::extlibs::capstone::X86_INS_LOOPE,            triton::arch::x86::ID_INS_LOOPE},
+        {triton::extlibs::capstone::X86_INS_LOOPNE,           triton::arch::x86::ID_INS_LOOPNE},
+        {triton::extlibs::capstone::X86_INS_RETF,             triton::arch::x86::ID_INS_RETF},
+        {triton::extlibs::capstone::X86_INS_RETFQ,            triton::arch::x86::ID_INS_RETFQ},
+        {triton::extlibs::capstone::X86_INS_LSL,              triton::arch::x86::ID_INS_LSL},
+        {triton::extlibs::capstone::X86_INS_LSS,              triton::arch::x86::ID_INS_LSS},
+        {triton::extlibs::capstone::X86_INS_LTR,              triton::arch::x86::ID_INS_LTR},
+        {triton::extlibs::capstone::X86_INS_XADD,             triton::arch::x86::ID_INS_XADD},
+        {triton::extlibs::capstone::X86_INS_LZCNT,            triton::arch::x86::ID_INS_LZCNT},
+        {triton::extlibs::capstone::X86_INS_MASKMOVDQU,       triton::arch::x86::ID_INS_MASKMOVDQU},
+        {triton::extlibs::capstone::X86_INS_MAXPD,            triton::arch::x86::ID_INS_MAXPD},
+        {triton::extlibs::capstone::X86_INS_MAXPS,            triton::arch::x86::ID_INS_MAXPS},
+        {triton::extlibs::capstone::X86_INS_MAXSD,            triton::arch::x86::ID_INS_MAXSD},
+        {triton::extlibs::capstone::X86_INS_MAXSS,            triton::arch::x86::ID_INS_MAXSS},
+        {triton::extlibs::capstone::X86_INS_MFENCE,           triton::arch::x86::ID_INS_MFENCE},
+        {triton::extlibs::capstone::X86_INS_MINPD,            triton::arch::x86::ID_INS_MINPD},
+        {triton::extlibs::capstone::X86_INS_MINPS,            triton::arch::x86::ID_INS_MINPS},
+        {triton::extlibs::capstone::X86_INS_MINSD,            triton::arch::x86::ID_INS_MINSD},
+        {triton::extlibs::capstone::X86_INS_MINSS,            triton::arch::x86::ID_INS_MINSS},
+        {triton::extlibs::capstone::X86_INS_CVTPD2PI,         triton::arch::x86::ID_INS_CVTPD2PI},
+        {triton::extlibs::capstone::X86_INS_CVTPI2PD,         triton::arch::x86::ID_INS_CVTPI2PD},
+        {triton::extlibs::capstone::X86_INS_CVTPI2PS,         triton::arch::x86::ID_INS_CVTPI2PS},
+        {triton::extlibs::capstone::X86_INS_CVTPS2PI,         triton::arch::x86::ID_INS_CVTPS2PI},
+        {triton::extlibs::capstone::X86_INS_CVTTPD2PI,        triton::arch::x86::ID_INS_CVTTPD2PI},
+        {triton::extlibs::capstone::X86_INS_CVTTPS2PI,        triton::arch::x86::ID_INS_CVTTPS2PI},
+        {triton::extlibs::capstone::X86_INS_EMMS,             triton::arch::x86::ID_INS_EMMS},
+        {triton::extlibs::capstone::X86_INS_MASKMOVQ,         triton::arch::x86::ID_INS_MASKMOVQ},
+        {triton::extlibs::capstone::X86_INS_MOVD,             triton::arch::x86::ID_INS_MOVD},
+        {triton::extlibs::capstone::X86_INS_MOVDQ2Q,          triton::arch::x86::ID_INS_MOVDQ2Q},
+        {triton::extlibs::capstone::X86_INS_MOVNTQ,           triton::arch::x86::ID_INS_MOVNTQ},
+        {triton::extlibs::capstone::X86_INS_MOVQ2DQ,          triton::arch::x86::ID_INS_MOVQ2DQ},
+        {triton::extlibs::capstone::X86_INS_MOVQ,             triton::arch::x86::ID_INS_MOVQ},
+        {triton::extlibs::capstone::X86_INS_PABSB,            triton::arch::x86::ID_INS_PABSB},
+        {triton::extlibs::capstone::X86_INS_PABSD,            triton::arch::x86::ID_INS_PABSD},
+        {triton::extlibs::capstone::X86_INS_PABSW,            triton::arch::x86::ID_INS_PABSW},
+        {triton::extlibs::capstone::X86_INS_PACKSSDW,         triton::arch::x86::ID_INS_PACKSSDW},
+        {triton::extlibs::capstone::X86_INS_PACKSSWB,         triton::arch::x86::ID_INS_PACKSSWB},
+        {triton::extlibs::capstone::X86_INS_PACKUSWB,         triton::arch::x86::ID_INS_PACKUSWB},
+        {triton::extlibs::capstone::X86_INS_PADDB,            triton::arch::x86::ID_INS_PADDB},
+        {triton::extlibs::capstone::X86_INS_PADDD,            triton::arch::x86::ID_INS_PADDD},
+        {triton::extlibs::capstone::X86_INS_PADDQ,            triton::arch::x86::ID_INS_PADDQ},
+        {triton::extlibs::capstone::X86_INS_PADDSB,           triton::arch::x86::ID_INS_PADDSB},
+        {triton::extlibs::capstone::X86_INS_PADDSW,           triton::arch::x86::ID_INS_PADDSW},
+        {triton::extlibs::capstone::X86_INS_PADDUSB,          triton::arch::x86::ID_INS_PADDUSB},
+        {triton::extlibs::capstone::X86_INS_PADDUSW,          triton::arch::x86::ID_INS_PADDUSW},
+        {triton::extlibs::capstone::X86_INS_PADDW,            triton::arch::x86::ID_INS_PADDW},
+        {triton::extlibs::capstone::X86_INS_PALIGNR,          triton::arch::x86::ID_INS_PALIGNR},
+        {triton::extlibs::capstone::X86_INS_PANDN,            triton::arch::x86::ID_INS_PANDN},
+        {triton::extlibs::capstone::X86_INS_PAND,             triton::arch::x86::ID_INS_PAND},
+        {triton::extlibs::capstone::X86_INS_PAVGB,            triton::arch::x86::ID_INS_PAVGB},
+        {triton::extlibs::capstone::X86_INS_PAVGW,            triton::arch::x86::ID_INS_PAVGW},
+        {triton::extlibs::capstone::X86_INS_PCMPEQB,          triton::arch::x86::ID_INS_PCMPEQB},
+        {triton::extlibs::capstone::X86_INS_PCMPEQD,          triton::arch::x86::ID_INS_PCMPEQD},
+        {triton::extlibs::capstone::X86_INS_PCMPEQW,          triton::arch::x86::ID_INS_PCMPEQW},
+        {triton::extlibs::capstone::X86_INS_PCMPGTB,          triton::arch::x86::ID_INS_PCMPGTB},
+        {triton::extlibs::capstone::X86_INS_PCMPGTD,          triton::arch::x86::ID_INS_PCMPGTD},
+        {triton::extlibs::capstone::X86_INS_PCMPGTW,          triton::arch::x86::ID_INS_PCMPGTW},
+        {triton::extlibs::capstone::X86_INS_PEXTRW,           triton::arch::x86::ID_INS_PEXTRW},
+        {triton::extlibs::capstone::X86_INS_PHADDSW,          triton::arch::x86::ID_INS_PHADDSW},
+        {triton::extlibs::capstone::X86_INS_PHADDW,           triton::arch::x86::ID_INS_PHADDW},
+        {triton::extlibs::capstone::X86_INS_PHADDD,           triton::arch::x86::ID_INS_PHADDD},
+        {triton::extlibs::capstone::X86_INS_PHSUBD,           triton::arch::x86::ID_INS_PHSUBD},
+        {triton::extlibs::capstone::X86_INS_PHSUBSW,          triton::arch::x86::ID_INS_PHSUBSW},
+        {triton::extlibs::capstone::X86_INS_PHSUBW,           triton::arch::x86::ID_INS_PHSUBW},
+        {triton::extlibs::capstone::X86_INS_PINSRW,           triton::arch::x86::ID_INS_PINSRW},
+        {triton::extlibs::capstone::X86_INS_PMADDUBSW,        triton::arch::x86::ID_INS_PMADDUBSW},
+        {triton::extlibs::capstone::X86_INS_PMADDWD,          triton::arch::x86::ID_INS_PMADDWD},
+        {triton::extlibs::capstone::X86_INS_PMAXSW,           triton::arch::x86::ID_INS_PMAXSW},
+        {triton::extlibs::capstone::X86_INS_PMAXUB,           triton::arch::x86::ID_INS_PMAXUB},
+        {triton::extlibs::capstone::X86_INS_PMINSW,           triton::arch::x86::ID_INS_PMINSW},
+        {triton::extlibs::capstone::X86_INS_PMINUB,           triton::arch::x86::ID_INS_PMINUB},
+        {triton::extlibs::capstone::X86_INS_PMOVMSKB,         triton::arch::x86::ID_INS_PMOVMSKB},
+        {triton::extlibs::capstone::X86_INS_PMULHRSW,         triton::arch::x86::ID_INS_PMULHRSW},
+        {triton::extlibs::capstone::X86_INS_PMULHUW,          triton::arch::x86::ID_INS_PMULHUW},
+        {triton::extlibs::capstone::X86_INS_PMULHW,           triton::arch::x86::ID_INS_PMULHW},
+        {triton::extlibs::capstone::X86_INS_PMULLW,           triton::arch::x86::ID_INS_PMULLW},
+        {triton::extlibs::capstone::X86_INS_PMULUDQ,          triton::arch::x86::ID_INS_PMULUDQ},
+        {triton::extlibs::capstone::X86_INS_POR,              triton::arch::x86::ID_INS_POR},
+        {triton::extlibs::capstone::X86_INS_PSADBW,           triton::arch::x86::ID_INS_PSADBW},
+        {triton::extlibs::capstone::X86_INS_PSHUFB,           triton::arch::x86::ID_INS_PSHUFB},
+        {triton::extlibs::capstone::X86_INS_PSHUFW,           triton::arch::x86::ID_INS_PSHUFW},
+        {triton::extlibs::capstone::X86_INS_PSIGNB,           triton::arch::x86::ID_INS_PSIGNB},
+        {triton::extlibs::capstone::X86_INS_PSIGND,           triton::arch::x86::ID_INS_PSIGND},
+        {triton::extlibs::capstone::X86_INS_PSIGNW,           triton::arch::x86::ID_INS_PSIGNW},
+        {triton::extlibs::capstone::X86_INS_PSLLD,            triton::arch::x86::ID_INS_PSLLD},
+        {triton::extlibs::capstone::X86_INS_PSLLQ,            triton::arch::x86::ID_INS_PSLLQ},
+        {triton::extlibs::capstone::X86_INS_PSLLW,            triton::arch::x86::ID_INS_PSLLW},
+        {triton::extlibs::capstone::X86_INS_PSRAD,            triton::arch::x86::ID_INS_PSRAD},
+        {triton::extlibs::capstone::X86_INS_PSRAW,            triton::arch::x86::ID_INS_PSRAW},
+        {triton::extlibs::capstone::X86_INS_PSRLD,            triton::arch::x86::ID_INS_PSRLD},
+        {triton::extlibs::capstone::X86_INS_PSRLQ,            triton::arch::x86::ID_INS_PSRLQ},
+        {triton::extlibs::capstone::X86_INS_PSRLW,            triton::arch::x86::ID_INS_PSRLW},
+        {triton::extlibs::capstone::X86_INS_PSUBB,            triton::arch::x86::ID_INS_PSUBB},
+        {triton::extlibs::capstone::X86_INS_PSUBD,            triton::arch::x86::ID_INS_PSUBD},
+        {triton::extlibs::capstone::X86_INS_PSUBQ,            triton::arch::x86::ID_INS_PSUBQ},
+        {triton::extlibs::capstone::X86_INS_PSUBSB,           triton::arch::x86::ID_INS_PSUBSB},
+        {triton::extlibs::capstone::X86_INS_PSUBSW,           triton::arch::x86::ID_INS_PSUBSW},
+        {triton::extlibs::capstone::X86_INS_PSUBUSB,          triton::arch::x86::ID_INS_PSUBUSB},
+        {triton::extlibs::capstone::X86_INS_PSUBUSW,          triton::arch::x86::ID_INS_PSUBUSW},
+        {triton::extlibs::capstone::X86_INS_PSUBW,            triton::arch::x86::ID_INS_PSUBW},
+        {triton::extlibs::capstone::X86_INS_PUNPCKHBW,        triton::arch::x86::ID_INS_PUNPCKHBW},
+        {triton::extlibs::capstone::X86_INS_PUNPCKHDQ,        triton::arch::x86::ID_INS_PUNPCKHDQ},
+        {triton::extlibs::capstone::X86_INS_PUNPCKHWD,        triton::arch::x86::ID_INS_PUNPCKHWD},
+        {triton::extlibs::capstone::X86_INS_PUNPCKLBW,        triton::arch::x86::ID_INS_PUNPCKLBW},
+        {triton::extlibs::capstone::X86_INS_PUNPCKLDQ,        triton::arch::x86::ID_INS_PUNPCKLDQ},
+        {triton::extlibs::capstone::X86_INS_PUNPCKLWD,        triton::arch::x86::ID_INS_PUNPCKLWD},
+        {triton::extlibs::capstone::X86_INS_PXOR,             triton::arch::x86::ID_INS_PXOR},
+        {triton::extlibs::capstone::X86_INS_MONITOR,          triton::arch::x86::ID_INS_MONITOR},
+        {triton::extlibs::capstone::X86_INS_MONTMUL,          triton::arch::x86::ID_INS_MONTMUL},
+        {triton::extlibs::capstone::X86_INS_MOV,              triton::arch::x86::ID_INS_MOV},
+        {triton::extlibs::capstone::X86_INS_MOVABS,           triton::arch::x86::ID_INS_MOVABS},
+        {triton::extlibs::capstone::X86_INS_MOVBE,            triton::arch::x86::ID_INS_MOVBE},
+        {triton::extlibs::capstone::X86_INS_MOVDDUP,          triton::arch::x86::ID_INS_MOVDDUP},
+        {triton::extlibs::capstone::X86_INS_MOVDQA,           triton::arch::x86::ID_INS_MOVDQA},
+        {triton::extlibs::capstone::X86_INS_MOVDQU,           triton::arch::x86::ID_INS_MOVDQU},
+        {triton::extlibs::capstone::X86_INS_MOVHLPS,          triton::arch::x86::ID_INS_MOVHLPS},
+        {triton::extlibs::capstone::X86_INS_MOVHPD,           triton::arch::x86::ID_INS_MOVHPD},
+        {triton::extlibs::capstone::X86_INS_MOVHPS,           triton::arch::x86::ID_INS_MOVHPS},
+        {triton::extlibs::capstone::X86_INS_MOVLHPS,          triton::arch::x86::ID_INS_MOVLHPS},
+        {triton::extlibs::capstone::X86_INS_MOVLPD,           triton::arch::x86::ID_INS_MOVLPD},
+        {triton::extlibs::capstone::X86_INS_MOVLPS,           triton::arch::x86::ID_INS_MOVLPS},
+        {triton::extlibs::capstone::X86_INS_MOVMSKPD,         triton::arch::x86::ID_INS_MOVMSKPD},
+        {triton::extlibs::capstone::X86_INS_MOVMSKPS,         triton::arch::x86::ID_INS_MOVMSKPS},
+        {triton::extlibs::capstone::X86_INS_MOVNTDQA,         triton::arch::x86::ID_INS_MOVNTDQA},
+        {triton::extlibs::capstone::X86_INS_MOVNTDQ,          triton::arch::x86::ID_INS_MOVNTDQ},
+        {triton::extlibs::capstone::X86_INS_MOVNTI,           triton::arch::x86::ID_INS_MOVNTI},
+        {triton::extlibs::capstone::X86_INS_MOVNTPD,          triton::arch::x86::ID_INS_MOVNTPD},
+        {triton::extlibs::capstone::X86_INS_MOVNTPS,          triton::arch::x86::ID_INS_MOVNTPS},
+        {triton::extlibs::capstone::X86_INS_MOVNTSD,          triton::arch::x86::ID_INS_MOVNTSD},
+        {triton::extlibs::capstone::X86_INS_MOVNTSS,          triton::arch::x86::ID_INS_MOVNTSS},
+        {triton::extlibs::capstone::X86_INS_MOVSB,            triton::arch::x86::ID_INS_MOVSB},
+        {triton::extlibs::capstone::X86_INS_MOVSD,            triton::arch::x86::ID_INS_MOVSD},
+        {triton::extlibs::capstone::X86_INS_MOVSHDUP,         triton::arch::x86::ID_INS_MOVSHDUP},
+        {triton::extlibs::capstone::X86_INS_MOVSLDUP,         triton::arch::x86::ID_INS_MOVSLDUP},
+        {triton::extlibs::capstone::X86_INS_MOVSQ,            triton::arch::x86::ID_INS_MOVSQ},
+        {triton::extlibs::capstone::X86_INS_MOVSS,            triton::arch::x86::ID_INS_MOVSS},
+        {triton::extlibs::capstone::X86_INS_MOVSW,            triton::arch::x86::ID_INS_MOVSW},
+        {triton::extlibs::capstone::X86_INS_MOVSX,            triton::arch::x86::ID_INS_MOVSX},
+        {triton::extlibs::capstone::X86_INS_MOVSXD,           triton::arch::x86::ID_INS_MOVSXD},
+        {triton::extlibs::capstone::X86_INS_MOVUPD,           triton::arch::x86::ID_INS_MOVUPD},
+        {triton::extlibs::capstone::X86_INS_MOVUPS,           triton::arch::x86::ID_INS_MOVUPS},
+        {triton::extlibs::capstone::X86_INS_MOVZX,            triton::arch::x86::ID_INS_MOVZX},
+        {triton::extlibs::capstone::X86_INS_MPSADBW,          triton::arch::x86::ID_INS_MPSADBW},
+        {triton::extlibs::capstone::X86_INS_MUL,              triton::arch::x86::ID_INS_MUL},
+        {triton::extlibs::capstone::X86_INS_MULPD,            triton::arch::x86::ID_INS_MULPD},
+        {triton::extlibs::capstone::X86_INS_MULPS,            triton::arch::x86::ID_INS_MULPS},
+        {triton::extlibs::capstone::X86_INS_MULSD,            triton::arch::x86::ID_INS_MULSD},
+        {triton::extlibs::capstone::X86_INS_MULSS,            triton::arch::x86::ID_INS_MULSS},
+        {triton::extlibs::capstone::X86_INS_MULX,             triton::arch::x86::ID_INS_MULX},
+        {triton::extlibs::capstone::X86_INS_FMUL,             triton::arch::x86::ID_INS_FMUL},
+        {triton::extlibs::capstone::X86_INS_FIMUL,            triton::arch::x86::ID_INS_FIMUL},
+        {triton::extlibs::capstone::X86_INS_FMULP,            triton::arch::x86::ID_INS_FMULP},
+        {triton::extlibs::capstone::X86_INS_MWAIT,            triton::arch::x86::ID_INS_MWAIT},
+        {triton::extlibs::capstone::X86_INS_NEG,              triton::arch::x86::ID_INS_NEG},
+        {triton::extlibs::capstone::X86_INS_NOP,              triton::arch::x86::ID_INS_NOP},
+        {triton::extlibs::capstone::X86_INS_NOT,              triton::arch::x86::ID_INS_NOT},
+        {triton::extlibs::capstone::X86_INS_OUT,              triton::arch::x86::ID_INS_OUT},
+        {triton::extlibs::capstone::X86_INS_OUTSB,            triton::arch::x86::ID_INS_OUTSB},
+        {triton::extlibs::capstone::X86_INS_OUTSD,            triton::arch::x86::ID_INS_OUTSD},
+        {triton::extlibs::capstone::X86_INS_OUTSW,            triton::arch::x86::ID_INS_OUTSW},
+        {triton::extlibs::capstone::X86_INS_PACKUSDW,         triton::arch::x86::ID_INS_PACKUSDW},
+        {triton::extlibs::capstone::X86_INS_PAUSE,            triton::arch::x86::ID_INS_PAUSE},
+        {triton::extlibs::capstone::X86_INS_PAVGUSB,          triton::arch::x86::ID_INS_PAVGUSB},
+        {triton::extlibs::capstone::X86_INS_PBLENDVB,         triton::arch::x86::ID_INS_PBLENDVB},
+        {triton::extlibs::capstone::X86_INS_PBLENDW,          triton::arch::x86::ID_INS_PBLENDW},
+        {triton::extlibs::capstone::X86_INS_PCLMULQDQ,        triton::arch::x86::ID_INS_PCLMULQDQ},
+        {triton::extlibs::capstone::X86_INS_PCMPEQQ,          triton::arch::x86::ID_INS_PCMPEQQ},
+        {triton::extlibs::capstone::X86_INS_PCMPESTRI,        triton::arch::x86::ID_INS_PCMPESTRI},
+        {triton::extlibs::capstone::X86_INS_PCMPESTRM,        triton::arch::x86::ID_INS_PCMPESTRM},
+        {triton::extlibs::capstone::X86_INS_PCMPGTQ,          triton::arch::x86::ID_INS_PCMPGTQ},
+        {triton::extlibs::capstone::X86_INS_PCMPISTRI,        triton::arch::x86::ID_INS_PCMPISTRI},
+        {triton::extlibs::capstone::X86_INS_PCMPISTRM,        triton::arch::x86::ID_INS_PCMPISTRM},
+        {triton::extlibs::capstone::X86_INS_PDEP,             triton::arch::x86::ID_INS_PDEP},
+        {triton::extlibs::capstone::X86_INS_PEXT,             triton::arch::x86::ID_INS_PEXT},
+        {triton::extlibs::capstone::X86_INS_PEXTRB,           triton::arch::x86::ID_INS_PEXTRB},
+        {triton::extlibs::capstone::X86_INS_PEXTRD,           triton::arch::x86::ID_INS_PEXTRD},
+        {triton::extlibs::capstone::X86_INS_PEXTRQ,           triton::arch::x86::ID_INS_PEXTRQ},
+        {triton::extlibs::capstone::X86_INS_PF2ID,            triton::arch::x86::ID_INS_PF2ID},
+        {triton::extlibs::capstone::X86_INS_PF2IW,            triton::arch::x86::ID_INS_PF2IW},
+        {triton::extlibs::capstone::X86_INS_PFACC,            triton::arch::x86::ID_INS_PFACC},
+        {triton::extlibs::capstone::X86_INS_PFADD,            triton::arch::x86::ID_INS_PFADD},
+        {triton::extlibs::capstone::X86_INS_PFCMPEQ,          triton::arch::x86::ID_INS_PFCMPEQ},
+        {triton::extlibs::capstone::X86_INS_PFCMPGE,          triton::arch::x86::ID_INS_PFCMPGE},
+        {triton::extlibs::capstone::X86_INS_PFCMPGT,          triton::arch::x86::ID_INS_PFCMPGT},
+        {triton::extlibs::capstone::X86_INS_PFMAX,            triton::arch::x86::ID_INS_PFMAX},
+        {triton::extlibs::capstone::X86_INS_PFMIN,            triton::arch::x86::ID_INS_PFMIN},
+        {triton::extlibs::capstone::X86_INS_PFMUL,            triton::arch::x86::ID_INS_PFMUL},
+        {triton::extlibs::capstone::X86_INS_PFNACC,           triton::arch::x86::ID_INS_PFNACC},
+        {triton::extlibs::capstone::X86_INS_PFPNACC,          triton::arch::x86::ID_INS_PFPNACC},
+        {triton::extlibs::capstone::X86_INS_PFRCPIT1,         triton::arch::x86::ID_INS_PFRCPIT1},
+        {triton::extlibs::capstone::X86_INS_PFRCPIT2,         triton::arch::x86::ID_INS_PFRCPIT2},
+        {triton::extlibs::capstone::X86_INS_PFRCP,            triton::arch::x86::ID_INS_PFRCP},
+        {triton::extlibs::capstone::X86_INS_PFRSQIT1,         triton::arch::x86::ID_INS_PFRSQIT1},
+        {triton::extlibs::capstone::X86_INS_PFRSQRT,          triton::arch::x86::ID_INS_PFRSQRT},
+        {triton::extlibs::capstone::X86_INS_PFSUBR,           triton::arch::x86::ID_INS_PFSUBR},
+        {triton::extlibs::capstone::X86_INS_PFSUB,            triton::arch::x86::ID_INS_PFSUB},
+        {triton::extlibs::capstone::X86_INS_PHMINPOSUW,       triton::arch::x86::ID_INS_PHMINPOSUW},
+        {triton::extlibs::capstone::X86_INS_PI2FD,            triton::arch::x86::ID_INS_PI2FD},
+        {triton::extlibs::capstone::X86_INS_PI2FW,            triton::arch::x86::ID_INS_PI2FW},
+        {triton::extlibs::capstone::X86_INS_PINSRB,           triton::arch::x86::ID_INS_PINSRB},
+        {triton::extlibs::capstone::X86_INS_PINSRD,           triton::arch::x86::ID_INS_PINSRD},
+        {triton::extlibs::capstone::X86_INS_PINSRQ,           triton::arch::x86::ID_INS_PINSRQ},
+        {triton::extlibs::capstone::X86_INS_PMAXSB,           triton::arch::x86::ID_INS_PMAXSB},
+        {triton::extlibs::capstone::X86_INS_PMAXSD,           triton::arch::x86::ID_INS_PMAXSD},
+        {triton::extlibs::capstone::X86_INS_PMAXUD,           triton::arch::x86::ID_INS_PMAXUD},
+        {triton::extlibs::capstone::X86_INS_PMAXUW,           triton::arch::x86::ID_INS_PMAXUW},
+        {triton::extlibs::capstone::X86_INS_PMINSB,           triton::arch::x86::ID_INS_PMINSB},
+        {triton::extlibs::capstone::X86_INS_PMINSD,           triton::arch::x86::ID_INS_PMINSD},
+        {triton::extlibs::capstone::X86_INS_PMINUD,           triton::arch::x86::ID_INS_PMINUD},
+        {triton::extlibs::capstone::X86_INS_PMINUW,           triton::arch::x86::ID_INS_PMINUW},
+        {triton::extlibs::capstone::X86_INS_PMOVSXBD,         triton::arch::x86::ID_INS_PMOVSXBD},
+        {triton::extlibs::capstone::X86_INS_PMOVSXBQ,         triton::arch::x86::ID_INS_PMOVSXBQ},
+        {triton::extlibs::capstone::X86_INS_PMOVSXBW,         triton::arch::x86::ID_INS_PMOVSXBW},
+        {triton::extlibs::capstone::X86_INS_PMOVSXDQ,         triton::arch::x86::ID_INS_PMOVSXDQ},
+        {triton::extlibs::capstone::X86_INS_PMOVSXWD,         triton::arch::x86::ID_INS_PMOVSXWD},
+        {triton::extlibs::capstone::X86_INS_PMOVSXWQ,         triton::arch::x86::ID_INS_PMOVSXWQ},
+        {triton::extlibs::capstone::X86_INS_PMOVZXBD,         triton::arch::x86::ID_INS_PMOVZXBD},
+        {triton::extlibs::capstone::X86_INS_PMOVZXBQ,         triton::arch::x86::ID_INS_PMOVZXBQ},
+        {triton::extlibs::capstone::X86_INS_PMOVZXBW,         triton::arch::x86::ID_INS_PMOVZXBW},
+        {triton::extlibs::capstone::X86_INS_PMOVZXDQ,         triton::arch::x86::ID_INS_PMOVZXDQ},
+        {triton::extlibs::capstone::X86_INS_PMOVZXWD,         triton::arch::x86::ID_INS_PMOVZXWD},
+        {triton::extlibs::capstone::X86_INS_PMOVZXWQ,         triton::arch::x86::ID_INS_PMOVZXWQ},
+        {triton::extlibs::capstone::X86_INS_PMULDQ,           triton::arch::x86::ID_INS_PMULDQ},
+        {triton::extlibs::capstone::X86_INS_PMULHRW,          triton::arch::x86::ID_INS_PMULHRW},
+        {triton::extlibs::capstone::X86_INS_PMULLD,           triton::arch::x86::ID_INS_PMULLD},
+        {triton::extlibs::capstone::X86_INS_POP,              triton::arch::x86::ID_INS_POP},
+        {triton::extlibs::capstone::X86_INS_POPAW,            triton::arch::x86::ID_INS_POPAW},
+        {triton::extlibs::capstone::X86_INS_POPAL,            triton::arch::x86::ID_INS_POPAL},
+        {triton::extlibs::capstone::X86_INS_POPCNT,           triton::arch::x86::ID_INS_POPCNT},
+        {triton::extlibs::capstone::X86_INS_POPF,             triton::arch::x86::ID_INS_POPF},
+        {triton::extlibs::capstone::X86_INS_POPFD,            triton::arch::x86::ID_INS_POPFD},
+        {triton::extlibs::capstone::X86_INS_POPFQ,            triton::arch::x86::ID_INS_POPFQ},
+        {triton::extlibs::capstone::X86_INS_PREFETCH,         triton::arch::x86::ID_INS_PREFETCH},
+        {triton::extlibs::capstone::X86_INS_PREFETCHNTA,      triton::arch::x86::ID_INS_PREFETCHNTA},
+        {triton::extlibs::capstone::X86_INS_PREFETCHT0,       triton::arch::x86::ID_INS_PREFETCHT0},
+        {triton::extlibs::capstone::X86_INS_PREFETCHT1,       triton::arch::x86::ID_INS_PREFETCHT1},
+        {triton::extlibs::capstone::X86_INS_PREFETCHT2,       triton::arch::x86::ID_INS_PREFETCHT2},
+        {triton::extlibs::capstone::X86_INS_PREFETCHW,        triton::arch::x86::ID_INS_PREFETCHW},
+        {triton::extlibs::capstone::X86_INS_PSHUFD,           triton::arch::x86::ID_INS_PSHUFD},
+        {triton::extlibs::capstone::X86_INS_PSHUFHW,          triton::arch::x86::ID_INS_PSHUFHW},
+        {triton::extlibs::capstone::X86_INS_PSHUFLW,          triton::arch::x86::ID_INS_PSHUFLW},
+        {triton::extlibs::capstone::X86_INS_PSLLDQ,           triton::arch::x86::ID_INS_PSLLDQ},
+        {triton::extlibs::capstone::X86_INS_PSRLDQ,           triton::arch::x86::ID_INS_PSRLDQ},
+        {triton::extlibs::capstone::X86_INS_PSWAPD,           triton::arch::x86::ID_INS_PSWAPD},
+        {triton::extlibs::capstone::X86_INS_PTEST,            triton::arch::x86::ID_INS_PTEST},
+        {triton::extlibs::capstone::X86_INS_PUNPCKHQDQ,       triton::arch::x86::ID_INS_PUNPCKHQDQ},
+        {triton::extlibs::capstone::X86_INS_PUNPCKLQDQ,       triton::arch::x86::ID_INS_PUNPCKLQDQ},
+        {triton::extlibs::capstone::X86_INS_PUSH,             triton::arch::x86::ID_INS_PUSH},
+        {triton::extlibs::capstone::X86_INS_PUSHAW,           triton::arch::x86::ID_INS_PUSHAW},
+        {triton::extlibs::capstone::X86_INS_PUSHAL,           triton::arch::x86::ID_INS_PUSHAL},
+        {triton::extlibs::capstone::X86_INS_PUSHF,            triton::arch::x86::ID_INS_PUSHF},
+        {triton::extlibs::capstone::X86_INS_PUSHFD,           triton::arch::x86::ID_INS_PUSHFD},
+        {triton::extlibs::capstone::X86_INS_PUSHFQ,           triton::arch::x86::ID_INS_PUSHFQ},
+        {triton::extlibs::capstone::X86_INS_RCL,              triton::arch::x86::ID_INS_RCL},
+        {triton::extlibs::capstone::X86_INS_RCPPS,            triton::arch::x86::ID_INS_RCPPS},
+        {triton::extlibs::capstone::X86_INS_RCPSS,            triton::arch::x86::ID_INS_RCPSS},
+        {triton::extlibs::capstone::X86_INS_RCR,              triton::arch::x86::ID_INS_RCR},
+        {triton::extlibs::capstone::X86_INS_RDFSBASE,         triton::arch::x86::ID_INS_RDFSBASE},
+        {triton::extlibs::capstone::X86_INS_RDGSBASE,         triton::arch::x86::ID_INS_RDGSBASE},
+        {triton::extlibs::capstone::X86_INS_RDMSR,            triton::arch::x86::ID_INS_RDMSR},
+        {triton::extlibs::capstone::X86_INS_RDPMC,            triton::arch::x86::ID_INS_RDPMC},
+        {triton::extlibs::capstone::X86_INS_RDRAND,           triton::arch::x86::ID_INS_RDRAND},
+        {triton::extlibs::capstone::X86_INS_RDSEED,           triton::arch::x86::ID_INS_RDSEED},
+        {triton::extlibs::capstone::X86_INS_RDTSC,            triton::arch::x86::ID_INS_RDTSC},
+        {triton::extlibs::capstone::X86_INS_RDTSCP,           triton::arch::x86::ID_INS_RDTSCP},
+        {triton::extlibs::capstone::X86_INS_ROL,              triton::arch::x86::ID_INS_ROL},
+        {triton::extlibs::capstone::X86_INS_ROR,              triton::arch::x86::ID_INS_ROR},
+        {triton::extlibs::capstone::X86_INS_RORX,             triton::arch::x86::ID_INS_RORX},
+        {triton::extlibs::capstone::X86_INS_ROUNDPD,          triton::arch::x86::ID_INS_ROUNDPD},
+        {triton::extlibs::capstone::X86_INS_ROUNDPS,          triton::arch::x86::ID_INS_ROUNDPS},
+        {triton::extlibs::capstone::X86_INS_ROUNDSD,          triton::arch::x86::ID_INS_ROUNDSD},
+        {triton::extlibs::capstone::X86_INS_ROUNDSS,          triton::arch::x86::ID_INS_ROUNDSS},
+        {triton::extlibs::capstone::X86_INS_RSM,              triton::arch::x86::ID_INS_RSM},
+        {triton::extlibs::capstone::X86_INS_RSQRTPS,          triton::arch::x86::ID_INS_RSQRTPS},
+        {triton::extlibs::capstone::X86_INS_RSQRTSS,          triton::arch::x86::ID_INS_RSQRTSS},
+        {triton::extlibs::capstone::X86_INS_SAHF,             triton::arch::x86::ID_INS_SAHF},
+        {triton::extlibs::capstone::X86_INS_SAL,              triton::arch::x86::ID_INS_SAL},
+        {triton::extlibs::capstone::X86_INS_SALC,             triton::arch::x86::ID_INS_SALC},
+        {triton::extlibs::capstone::X86_INS_SAR,              triton::arch::x86::ID_INS_SAR},
+        {triton::extlibs::capstone::X86_INS_SARX,             triton::arch::x86::ID_INS_SARX},
+        {triton::extlibs::capstone::X86_INS_SBB,              triton::arch::x86::ID_INS_SBB},
+        {triton::extlibs::capstone::X86_INS_SCASB,            triton::arch::x86::ID_INS_SCASB},
+        {triton::extlibs::capstone::X86_INS_SCASD,            triton::arch::x86::ID_INS_SCASD},
+        {triton::extlibs::capstone::X86_INS_SCASQ,            triton::arch::x86::ID_INS_SCASQ},
+        {triton::extlibs::capstone::X86_INS_SCASW,            triton::arch::x86::ID_INS_SCASW},
+        {triton::extlibs::capstone::X86_INS_SETAE,            triton::arch::x86::ID_INS_SETAE},
+        {triton::extlibs::capstone::X86_INS_SETA,             triton::arch::x86::ID_INS_SETA},
+        {triton::extlibs::capstone::X86_INS_SETBE,            triton::arch::x86::ID_INS_SETBE},
+        {triton::extlibs::capstone::X86_INS_SETB,             triton::arch::x86::ID_INS_SETB},
+        {triton::extlibs::capstone::X86_INS_SETE,             triton::arch::x86::ID_INS_SETE},
+        {triton::extlibs::capstone::X86_INS_SETGE,            triton::arch::x86::ID_INS_SETGE},
+        {triton::extlibs::capstone::X86_INS_SETG,             triton::arch::x86::ID_INS_SETG},
+        {triton::extlibs::capstone::X86_INS_SETLE,            triton::arch::x86::ID_INS_SETLE},
+        {triton::extlibs::capstone::X86_INS_SETL,             triton::arch::x86::ID_INS_SETL},
+        {triton::extlibs::capstone::X86_INS_SETNE,            triton::arch::x86::ID_INS_SETNE},
+        {triton::extlibs::capstone::X86_INS_SETNO,            triton::arch::x86::ID_INS_SETNO},
+        {triton::extlibs::capstone::X86_INS_SETNP,            triton::arch::x86::ID_INS_SETNP},
+        {triton::extlibs::capstone::X86_INS_SETNS,            triton::arch::x86::ID_INS_SETNS},
+        {triton::extlibs::capstone::X86_INS_SETO,             triton::arch::x86::ID_INS_SETO},
+        {triton::extlibs::capstone::X86_INS_SETP,             triton::arch::x86::ID_INS_SETP},
+        {triton::extlibs::capstone::X86_INS_SETS,             triton::arch::x86::ID_INS_SETS},
+        {triton::extlibs::capstone::X86_INS_SFENCE,           triton::arch::x86::ID_INS_SFENCE},
+        {triton::extlibs::capstone::X86_INS_SGDT,             triton::arch::x86::ID_INS_SGDT},
+        {triton::extlibs::capstone::X86_INS_SHA1MSG1,         triton::arch::x86::ID_INS_SHA1MSG1},
+        {triton::extlibs::capstone::X86_INS_SHA1MSG2,         triton::arch::x86::ID_INS_SHA1MSG2},
+        {triton::extlibs::capstone::X86_INS_SHA1NEXTE,        triton::arch::x86::ID_INS_SHA1NEXTE},
+        {triton::extlibs::capstone::X86_INS_SHA1RNDS4,        triton::arch::x86::ID_INS_SHA1RNDS4},
+        {triton::extlibs::capstone::X86_INS_SHA256MSG1,       triton::arch::x86::ID_INS_SHA256MSG1},
+        {triton::extlibs::capstone::X86_INS_SHA256MSG2,       triton::arch::x86::ID_INS_SHA256MSG2},
+        {triton::extlibs::capstone::X86_INS_SHA256RNDS2,      triton::arch::x86::ID_INS_SHA256RNDS2},
+        {triton::extlibs::capstone::X86_INS_SHL,              triton::arch::x86::ID_INS_SHL},
+        {triton::extlibs::capstone::X86_INS_SHLD,             triton::arch::x86::ID_INS_SHLD},
+        {triton::extlibs::capstone::X86_INS_SHLX,             triton::arch::x86::ID_INS_SHLX},
+        {triton::extlibs::capstone::X86_INS_SHR,              triton::arch::x86::ID_INS_SHR},
+        {triton::extlibs::capstone::X86_INS_SHRD,             triton::arch::x86::ID_INS_SHRD},
+        {triton::extlibs::capstone::X86_INS_SHRX,             triton::arch::x86::ID_INS_SHRX},
+        {triton::extlibs::capstone::X86_INS_SHUFPD,           triton::arch::x86::ID_INS_SHUFPD},
+        {triton::extlibs::capstone::X86_INS_SHUFPS,           triton::arch::x86::ID_INS_SHUFPS},
+        {triton::extlibs::capstone::X86_INS_SIDT,             triton::arch::x86::ID_INS_SIDT},
+        {triton::extlibs::capstone::X86_INS_FSIN,             triton::arch::x86::ID_INS_FSIN},
+        {triton::extlibs::capstone::X86_INS_SKINIT,           triton::arch::x86::ID_INS_SKINIT},
+        {triton::extlibs::capstone::X86_INS_SLDT,             triton::arch::x86::ID_INS_SLDT},
+        {triton::extlibs::capstone::X86_INS_SMSW,             triton::arch::x86::ID_INS_SMSW},
+        {triton::extlibs::capstone::X86_INS_SQRTPD,           triton::arch::x86::ID_INS_SQRTPD},
+        {triton::extlibs::capstone::X86_INS_SQRTPS,           triton::arch::x86::ID_INS_SQRTPS},
+        {triton::extlibs::capstone::X86_INS_SQRTSD,           triton::arch::x86::ID_INS_SQRTSD},
+        {triton::extlibs::capstone::X86_INS_SQRTSS,           triton::arch::x86::ID_INS_SQRTSS},
+        {triton::extlibs::capstone::X86_INS_FSQRT,            triton::arch::x86::ID_INS_FSQRT},
+        {triton::extlibs::capstone::X86_INS_STAC,             triton::arch::x86::ID_INS_STAC},
+        {triton::extlibs::capstone::X86_INS_STC,              triton::arch::x86::ID_INS_STC},
+        {triton::extlibs::capstone::X86_INS_STD,              triton::arch::x86::ID_INS_STD},
+        {triton::extlibs::capstone::X86_INS_STGI,             triton::arch::x86::ID_INS_STGI},
+        {triton::extlibs::capstone::X86_INS_STI,              triton::arch::x86::ID_INS_STI},
+        {triton::extlibs::capstone::X86_INS_STMXCSR,          triton::arch::x86::ID_INS_STMXCSR},
+        {triton::extlibs::capstone::X86_INS_STOSB,            triton::arch::x86::ID_INS_STOSB},
+        {triton::extlibs::capstone::X86_INS_STOSD,            triton::arch::x86::ID_INS_STOSD},
+        {triton::extlibs::capstone::X86_INS_STOSQ,            triton::arch::x86::ID_INS_STOSQ},
+        {triton::extlibs::capstone::X86_INS_STOSW,            triton::arch::x86::ID_INS_STOSW},
+        {triton::extlibs::capstone::X86_INS_STR,              triton::arch::x86::ID_INS_STR},
+        {triton::extlibs::capstone::X86_INS_FST,              triton::arch::x86::ID_INS_FST},
+        {triton::extlibs::capstone::X86_INS_FSTP,             triton::arch::x86::ID_INS_FSTP},
+        {triton::extlibs::capstone::X86_INS_FSTPNCE,          triton::arch::x86::ID_INS_FSTPNCE},
+        {triton::extlibs::capstone::X86_INS_SUBPD,            triton::arch::x86::ID_INS_SUBPD},
+        {triton::extlibs::capstone::X86_INS_SUBPS,            triton::arch::x86::ID_INS_SUBPS},
+        {triton::extlibs::capstone::X86_INS_FSUBR,            triton::arch::x86::ID_INS_FSUBR},
+        {triton::extlibs::capstone::X86_INS_FISUBR,           triton::arch::x86::ID_INS_FISUBR},
+        {triton::extlibs::capstone::X86_INS_FSUBRP,           triton::arch::x86::ID_INS_FSUBRP},
+        {triton::extlibs::capstone::X86_INS_SUBSD,            triton::arch::x86::ID_INS_SUBSD},
+        {triton::extlibs::capstone::X86_INS_SUBSS,            triton::arch::x86::ID_INS_SUBSS},
+        {triton::extlibs::capstone::X86_INS_FSUB,             triton::arch::x86::ID_INS_FSUB},
+        {triton::extlibs::capstone::X86_INS_FISUB,            triton::arch::x86::ID_INS_FISUB},
+        {triton::extlibs::capstone::X86_INS_FSUBP,            triton::arch::x86::ID_INS_FSUBP},
+        {triton::extlibs::capstone::X86_INS_SWAPGS,           triton::arch::x86::ID_INS_SWAPGS},
+        {triton::extlibs::capstone::X86_INS_SYSCALL,          triton::arch::x86::ID_INS_SYSCALL},
+        {triton::extlibs::capstone::X86_INS_SYSENTER,         triton::arch::x86::ID_INS_SYSENTER},
+        {triton::extlibs::capstone::X86_INS_SYSEXIT,          triton::arch::x86::ID_INS_SYSEXIT},
+        {triton::extlibs::capstone::X86_INS_SYSRET,           triton::arch::x86::ID_INS_SYSRET},
+        {triton::extlibs::capstone::X86_INS_T1MSKC,           triton::arch::x86::ID_INS_T1MSKC},
+        {triton::extlibs::capstone::X86_INS_TEST,             triton::arch::x86::ID_INS_TEST},
+        {triton::extlibs::capstone::X86_INS_UD2,              triton::arch::x86::ID_INS_UD2},
+        {triton::extlibs::capstone::X86_INS_FTST,             triton::arch::x86::ID_INS_FTST},
+        {triton::extlibs::capstone::X86_INS_TZCNT,            triton::arch::x86::ID_INS_TZCNT},
+        {triton::extlibs::capstone::X86_INS_TZMSK,            triton::arch::x86::ID_INS_TZMSK},
+        {triton::extlibs::capstone::X86_INS_FUCOMPI,          triton::arch::x86::ID_INS_FUCOMPI},
+        {triton::extlibs::capstone::X86_INS_FUCOMI,           triton::arch::x86::ID_INS_FUCOMI},
+        {triton::extlibs::capstone::X86_INS_FUCOMPP,          triton::arch::x86::ID_INS_FUCOMPP},
+        {triton::extlibs::capstone::X86_INS_FUCOMP,           triton::arch::x86::ID_INS_FUCOMP},
+        {triton::extlibs::capstone::X86_INS_FUCOM,            triton::arch::x86::ID_INS_FUCOM},
+        {triton::extlibs::capstone::X86_INS_UD2B,             triton::arch::x86::ID_INS_UD2B},
+        {triton::extlibs::capstone::X86_INS_UNPCKHPD,         triton::arch::x86::ID_INS_UNPCKHPD},
+        {triton::extlibs::capstone::X86_INS_UNPCKHPS,         triton::arch::x86::ID_INS_UNPCKHPS},
+        {triton::extlibs::capstone::X86_INS_UNPCKLPD,         triton::arch::x86::ID_INS_UNPCKLPD},
+        {triton::extlibs::capstone::X86_INS_UNPCKLPS,         triton::arch::x86::ID_INS_UNPCKLPS},
+        {triton::extlibs::capstone::X86_INS_VADDPD,           triton::arch::x86::ID_INS_VADDPD},
+        {triton::extlibs::capstone::X86_INS_VADDPS,           triton::arch::x86::ID_INS_VADDPS},
+        {triton::extlibs::capstone::X86_INS_VADDSD,           triton::arch::x86::ID_INS_VADDSD},
+        {triton::extlibs::capstone::X86_INS_VADDSS,           triton::arch::x86::ID_INS_VADDSS},
+        {triton::extlibs::capstone::X86_INS_VADDSUBPD,        triton::arch::x86::ID_INS_VADDSUBPD},
+        {triton::extlibs::capstone::X86_INS_VADDSUBPS,        triton::arch::x86::ID_INS_VADDSUBPS},
+        {triton::extlibs::capstone::X86_INS_VAESDECLAST,      triton::arch::x86::ID_INS_VAESDECLAST},
+        {triton::extlibs::capstone::X86_INS_VAESDEC,          triton::arch::x86::ID_INS_VAESDEC},
+        {triton::extlibs::capstone::X86_INS_VAESENCLAST,      triton::arch::x86::ID_INS_VAESENCLAST},
+        {triton::extlibs::capstone::X86_INS_VAESENC,          triton::arch::x86::ID_INS_VAESENC},
+        {triton::extlibs::capstone::X86_INS_VAESIMC,          triton::arch::x86::ID_INS_VAESIMC},
+        {triton::extlibs::capstone::X86_INS_VAESKEYGENASSIST, triton::arch::x86::ID_INS_VAESKEYGENASSIST},
+        {triton::extlibs::capstone::X86_INS_VALIGND,          triton::arch::x86::ID_INS_VALIGND},
+        {triton::extlibs::capstone::X86_INS_VALIGNQ,          triton::arch::x86::ID_INS_VALIGNQ},
+        {triton::extlibs::capstone::X86_INS_VANDNPD,          triton::arch::x86::ID_INS_VANDNPD},
+        {triton::extlibs::capstone::X86_INS_VANDNPS,          triton::arch::x86::ID_INS_VANDNPS},
+        {triton::extlibs::capstone::X86_INS_VANDPD,           triton::arch::x86::ID_INS_VANDPD},
+        {triton::extlibs::capstone::X86_INS_VANDPS,           triton::arch::x86::ID_INS_VANDPS},
+        {triton::extlibs::capstone::X86_INS_VBLENDMPD,        triton::arch::x86::ID_INS_VBLENDMPD},
+        {triton::extlibs::capstone::X86_INS_VBLENDMPS,        triton::arch::x86::ID_INS_VBLENDMPS},
+        {triton::extlibs::capstone::X86_INS_VBLENDPD,         triton::arch::x86::ID_INS_VBLENDPD},
+        {triton::extlibs::capstone::X86_INS_VBLENDPS,         triton::arch::x86::ID_INS_VBLENDPS},
+        {triton::extlibs::capstone::X86_INS_VBLENDVPD,        triton::arch::x86::ID_INS_VBLENDVPD},
+        {triton::extlibs::capstone::X86_INS_VBLENDVPS,        triton::arch::x86::ID_INS_VBLENDVPS},
+        {triton::extlibs::capstone::X86_INS_VBROADCASTF128,   triton::arch::x86::ID_INS_VBROADCASTF128},
+        {triton::extlibs::capstone::X86_INS_VBROADCASTI128,   triton::arch::x86::ID_INS_VBROADCASTI128},
+        {triton::extlibs::capstone::X86_INS_VBROADCASTI32X4,  triton::arch::x86::ID_INS_VBROADCASTI32X4},
+        {triton::extlibs::capstone::X86_INS_VBROADCASTI64X4,  triton::arch::x86::ID_INS_VBROADCASTI64X4},
+        {triton::extlibs::capstone::X86_INS_VBROADCASTSD,     triton::arch::x86::ID_INS_VBROADCASTSD},
+        {triton::extlibs::capstone::X86_INS_VBROADCASTSS,     triton::arch::x86::ID_INS_VBROADCASTSS},
+        {triton::extlibs::capstone::X86_INS_VCMPPD,           triton::arch::x86::ID_INS_VCMPPD},
+        {triton::extlibs::capstone::X86_INS_VCMPPS,           triton::arch::x86::ID_INS_VCMPPS},
+        {triton::extlibs::capstone::X86_INS_VCMPSD,           triton::arch::x86::ID_INS_VCMPSD},
+        {triton::extlibs::capstone::X86_INS_VCMPSS,           triton::arch::x86::ID_INS_VCMPSS},
+        {triton::extlibs::capstone::X86_INS_VCVTDQ2PD,        triton::arch::x86::ID_INS_VCVTDQ2PD},
+        {triton::extlibs::capstone::X86_INS_VCVTDQ2PS,        triton::arch::x86::ID_INS_VCVTDQ2PS},
+        {triton::extlibs::capstone::X86_INS_VCVTPD2DQX,       triton::arch::x86::ID_INS_VCVTPD2DQX},
+        {triton::extlibs::capstone::X86_INS_VCVTPD2DQ,        triton::arch::x86::ID_INS_VCVTPD2DQ},
+        {triton::extlibs::capstone::X86_INS_VCVTPD2PSX,       triton::arch::x86::ID_INS_VCVTPD2PSX},
+        {triton::extlibs::capstone::X86_INS_VCVTPD2PS,        triton::arch::x86::ID_INS_VCVTPD2PS},
+        {triton::extlibs::capstone::X86_INS_VCVTPD2UDQ,       triton::arch::x86::ID_INS_VCVTPD2UDQ},
+        {triton::extlibs::capstone::X86_INS_VCVTPH2PS,        triton::arch::x86::ID_INS_VCVTPH2PS},
+        {triton::extlibs::capstone::X86_INS_VCVTPS2DQ,        triton::arch::x86::ID_INS_VCVTPS2DQ},
+        {triton::extlibs::capstone::X86_INS_VCVTPS2PD,        triton::arch::x86::ID_INS_VCVTPS2PD},
+        {triton::extlibs::capstone::X86_INS_VCVTPS2PH,        triton::arch::x86::ID_INS_VCVTPS2PH},
+        {triton::extlibs::capstone::X86_INS_VCVTPS2UDQ,       triton::arch::x86::ID_INS_VCVTPS2UDQ},
+        {triton::extlibs::capstone::X86_INS_VCVTSD2SI,        triton::arch::x86::ID_INS_VCVTSD2SI},
+        {triton::extlibs::capstone::X86_INS_VCVTSD2USI,       triton::arch::x86::ID_INS_VCVTSD2USI},
+        {triton::extlibs::capstone::X86_INS_VCVTSS2SI,        triton::arch::x86::ID_INS_VCVTSS2SI},
+        {triton::extlibs::capstone::X86_INS_VCVTSS2USI,       triton::arch::x86::ID_INS_VCVTSS2USI},
+        {triton::extlibs::capstone::X86_INS_VCVTTPD2DQX,      triton::arch::x86::ID_INS_VCVTTPD2DQX},
+        {triton::extlibs::capstone::X86_INS_VCVTTPD2DQ,       triton::arch::x86::ID_INS_VCVTTPD2DQ},
+        {triton::extlibs::capstone::X86_INS_VCVTTPD2UDQ,      triton::arch::x86::ID_INS_VCVTTPD2UDQ},
+        {triton::extlibs::capstone::X86_INS_VCVTTPS2DQ,       triton::arch::x86::ID_INS_VCVTTPS2DQ},
+        {triton::extlibs::capstone::X86_INS_VCVTTPS2UDQ,      triton::arch::x86::ID_INS_VCVTTPS2UDQ},
+        {triton::extlibs::capstone::X86_INS_VCVTUDQ2PD,       triton::arch::x86::ID_INS_VCVTUDQ2PD},
+        {triton::extlibs::capstone::X86_INS_VCVTUDQ2PS,       triton::arch::x86::ID_INS_VCVTUDQ2PS},
+        {triton::extlibs::capstone::X86_INS_VDIVPD,           triton::arch::x86::ID_INS_VDIVPD},
+        {triton::extlibs::capstone::X86_INS_VDIVPS,           triton::arch::x86::ID_INS_VDIVPS},
+        {triton::extlibs::capstone::X86_INS_VDIVSD,           triton::arch::x86::ID_INS_VDIVSD},
+        {triton::extlibs::capstone::X86_INS_VDIVSS,           triton::arch::x86::ID_INS_VDIVSS},
+        {triton::extlibs::capstone::X86_INS_VDPPD,            triton::arch::x86::ID_INS_VDPPD},
+        {triton::extlibs::capstone::X86_INS_VDPPS,            triton::arch::x86::ID_INS_VDPPS},
+        {triton::extlibs::capstone::X86_INS_VERR,             triton::arch::x86::ID_INS_VERR},
+        {triton::extlibs::capstone::X86_INS_VERW,             triton::arch::x86::ID_INS_VERW},
+        {triton::extlibs::capstone::X86_INS_VEXTRACTF128,     triton::arch::x86::ID_INS_VEXTRACTF128},
+        {triton::extlibs::capstone::X86_INS_VEXTRACTF32X4,    triton::arch::x86::ID_INS_VEXTRACTF32X4},
+        {triton::extlibs::capstone::X86_INS_VEXTRACTF64X4,    triton::arch::x86::ID_INS_VEXTRACTF64X4},
+        {triton::extlibs::capstone::X86_INS_VEXTRACTI128,     triton::arch::x86::ID_INS_VEXTRACTI128},
+        {triton::extlibs::capstone::X86_INS_VEXTRACTI32X4,    triton::arch::x86::ID_INS_VEXTRACTI32X4},
+        {triton::extlibs::capstone::X86_INS_VEXTRACTI64X4,    triton::arch::x86::ID_INS_VEXTRACTI64X4},
+        {triton::extlibs::capstone::X86_INS_VEXTRACTPS,       triton::arch::x86::ID_INS_VEXTRACTPS},
+        {triton::extlibs::capstone::X86_INS_VFMADD132PD,      triton::arch::x86::ID_INS_VFMADD132PD},
+        {triton::extlibs::capstone::X86_INS_VFMADD132PS,      triton::arch::x86::ID_INS_VFMADD132PS},
+        {triton::extlibs::capstone::X86_INS_VFMADD213PD,      triton::arch::x86::ID_INS_VFMADD213PD},
+        {triton::extlibs::capstone::X86_INS_VFMADD213PS,      triton::arch::x86::ID_INS_VFMADD213PS},
+        {triton::extlibs::capstone::X86_INS_VFMADDPD,         triton::arch::x86::ID_INS_VFMADDPD},
+        {triton::extlibs::capstone::X86_INS_VFMADD231PD,      triton::arch::x86::ID_INS_VFMADD231PD},
+        {triton::extlibs::capstone::X86_INS_VFMADDPS,         triton::arch::x86::ID_INS_VFMADDPS},
+        {triton::extlibs::capstone::X86_INS_VFMADD231PS,      triton::arch::x86::ID_INS_VFMADD231PS},
+        {triton::extlibs::capstone::X86_INS_VFMADDSD,         triton::arch::x86::ID_INS_VFMADDSD},
+        {triton::extlibs::capstone::X86_INS_VFMADD213SD,      triton::arch::x86::ID_INS_VFMADD213SD},
+        {triton::extlibs::capstone::X86_INS_VFMADD132SD,      triton::arch::x86::ID_INS_VFMADD132SD},
+        {triton::extlibs::capstone::X86_INS_VFMADD231SD,      triton::arch::x86::ID_INS_VFMADD231SD},
+        {triton::extlibs::capstone::X86_INS_VFMADDSS,         triton::arch::x86::ID_INS_VFMADDSS},
+        {triton::extlibs::capstone::X86_INS_VFMADD213SS,      triton::arch::x86::ID_INS_VFMADD213SS},
+        {triton::extlibs::capstone::X86_INS_VFMADD132SS,      triton::arch::x86::ID_INS_VFMADD132SS},
+        {triton::extlibs::capstone::X86_INS_VFMADD231SS,      triton::arch::x86::ID_INS_VFMADD231SS},
+        {triton::extlibs::capstone::X86_INS_VFMADDSUB132PD,   triton::arch::x86::ID_INS_VFMADDSUB132PD},
+        {triton::extlibs::capstone::X86_INS_VFMADDSUB132PS,   triton::arch::x86::ID_INS_VFMADDSUB132PS},
+        {triton::extlibs::capstone::X86_INS_VFMADDSUB213PD,   triton::arch::x86::ID_INS_VFMADDSUB213PD},
+        {triton::extlibs::capstone::X86_INS_VFMADDSUB213PS,   triton::arch::x86::ID_INS_VFMADDSUB213PS},
+        {triton::extlibs::capstone::X86_INS_VFMADDSUBPD,      triton::arch::x86::ID_INS_VFMADDSUBPD},
+        {triton::extlibs::capstone::X86_INS_VFMADDSUB231PD,   triton::arch::x86::ID_INS_VFMADDSUB231PD},
+        {triton::extlibs::capstone::X86_INS_VFMADDSUBPS,      triton::arch::x86::ID_INS_VFMADDSUBPS},
+        {triton::extlibs::capstone::X86_INS_VFMADDSUB231PS,   triton::arch::x86::ID_INS_VFMADDSUB231PS},
+        {triton::extlibs::capstone::X86_INS_VFMSUB132PD,      triton::arch::x86::ID_INS_VFMSUB132PD},
+        {triton::extlibs::capstone::X86_INS_VFMSUB132PS,      triton::arch::x86::ID_INS_VFMSUB132PS},
+        {triton::extlibs::capstone::X86_INS_VFMSUB213PD,      triton::arch::x86::ID_INS_VFMSUB213PD},
+        {triton::extlibs::capstone::X86_INS_VFMSUB213PS,      triton::arch::x86::ID_INS_VFMSUB213PS},
+        {triton::extlibs::capstone::X86_INS_VFMSUBADD132PD,   triton::arch::x86::ID_INS_VFMSUBADD132PD},
+        {triton::extlibs::capstone::X86_INS_VFMSUBADD132PS,   triton::arch::x86::ID_INS_VFMSUBADD132PS},
+        {triton::extlibs::capstone::X86_INS_VFMSUBADD213PD,   triton::arch::x86::ID_INS_VFMSUBADD213PD},
+        {triton::extlibs::capstone::X86_INS_VFMSUBADD213PS,   triton::arch::x86::ID_INS_VFMSUBADD213PS},
+        {triton::extlibs::capstone::X86_INS_VFMSUBADDPD,      triton::arch::x86::ID_INS_VFMSUBADDPD},
+        {triton::extlibs::capstone::X86_INS_VFMSUBADD231PD,   triton::arch::x86::ID_INS_VFMSUBADD231PD},
+        {triton::extlibs::capstone::X86_INS_VFMSUBADDPS,      triton::arch::x86::ID_INS_VFMSUBADDPS},
+        {triton::extlibs::capstone::X86_INS_VFMSUBADD231PS,   triton::arch::x86::ID_INS_VFMSUBADD231PS},
+        {triton::extlibs::capstone::X86_INS_VFMSUBPD,         triton::arch::x86::ID_INS_VFMSUBPD},
+        {triton::extlibs::capstone::X86_INS_VFMSUB231PD,      triton::arch::x86::ID_INS_VFMSUB231PD},
+        {triton::extlibs::capstone::X86_INS_VFMSUBPS,         triton::arch::x86::ID_INS_VFMSUBPS},
+        {triton::extlibs::capstone::X86_INS_VFMSUB231PS,      triton::arch::x86::ID_INS_VFMSUB231PS},
+        {triton::extlibs::capstone::X86_INS_VFMSUBSD,         triton::arch::x86::ID_INS_VFMSUBSD},
+        {triton::extlibs::capstone::X86_INS_VFMSUB213SD,      triton::arch::x86::ID_INS_VFMSUB213SD},
+        {triton::extlibs::capstone::X86_INS_VFMSUB132SD,      triton::arch::x86::ID_INS_VFMSUB132SD},
+        {triton::extlibs::capstone::X86_INS_VFMSUB231SD,      triton::arch::x86::ID_INS_VFMSUB231SD},
+        {triton::extlibs::capstone::X86_INS_VFMSUBSS,         triton::arch::x86::ID_INS_VFMSUBSS},
+        {triton::extlibs::capstone::X86_INS_VFMSUB213SS,      triton::arch::x86::ID_INS_VFMSUB213SS},
+        {triton::extlibs::capstone::X86_INS_VFMSUB132SS,      triton::arch::x86::ID_INS_VFMSUB132SS},
+        {triton::extlibs::capstone::X86_INS_VFMSUB231SS,      triton::arch::x86::ID_INS_VFMSUB231SS},
+        {triton::extlibs::capstone::X86_INS_VFNMADD132PD,     triton::arch::x86::ID_INS_VFNMADD132PD},
+        {triton::extlibs::capstone::X86_INS_VFNMADD132PS,     triton::arch::x86::ID_INS_VFNMADD132PS},
+        {triton::extlibs::capstone::X86_INS_VFNMADD213PD,     triton::arch::x86::ID_INS_VFNMADD213PD},
+        {triton::extlibs::capstone::X86_INS_VFNMADD213PS,     triton::arch::x86::ID_INS_VFNMADD213PS},
+        {triton::extlibs::capstone::X86_INS_VFNMADDPD,        triton::arch::x86::ID_INS_VFNMADDPD},
+        {triton::extlibs::capstone::X86_INS_VFNMADD231PD,     triton::arch::x86::ID_INS_VFNMADD231PD},
+        {triton::extlibs::capstone::X86_INS_VFNMADDPS,        triton::arch::x86::ID_INS_VFNMADDPS},
+        {triton::extlibs::capstone::X86_INS_VFNMADD231PS,     triton::arch::x86::ID_INS_VFNMADD231PS},
+        {triton::extlibs::capstone::X86_INS_VFNMADDSD,        triton::arch::x86::ID_INS_VFNMADDSD},
+        {triton::extlibs::capstone::X86_INS_VFNMADD213SD,     triton::arch::x86::ID_INS_VFNMADD213SD},
+        {triton::extlibs::capstone::X86_INS_VFNMADD132SD,     triton::arch::x86::ID_INS_VFNMADD132SD},
+        {triton::extlibs::capstone::X86_INS_VFNMADD231SD,     triton::arch::x86::ID_INS_VFNMADD231SD},
+        {triton::extlibs::capstone::X86_INS_VFNMADDSS,        triton::arch::x86::ID_INS_VFNMADDSS},
+        {triton::extlibs::capstone::X86_INS_VFNMADD213SS,     triton::arch::x86::ID_INS_VFNMADD213SS},
+        {triton::extlibs::capstone::X86_INS_VFNMADD132SS,     triton::arch::x86::ID_INS_VFNMADD132SS},
+        {triton::extlibs::capstone::X86_INS_VFNMADD231SS,     triton::arch::x86::ID_INS_VFNMADD231SS},
+        {triton::extlibs::capstone::X86_INS_VFNMSUB132PD,     triton::arch::x86::ID_INS_VFNMSUB132PD},
+        {triton::extlibs::capstone::X86_INS_VFNMSUB132PS,     triton::arch::x86::ID_INS_VFNMSUB132PS},
+        {triton::extlibs::capstone::X86_INS_VFNMSUB213PD,     triton::arch::x86::ID_INS_VFNMSUB213PD},
+        {triton::extlibs::capstone::X86_INS_VFNMSUB213PS,     triton::arch::x86::ID_INS_VFNMSUB213PS},
+        {triton::extlibs::capstone::X86_INS_VFNMSUBPD,        triton::arch::x86::ID_INS_VFNMSUBPD},
+        {triton::extlibs::capstone::X86_INS_VFNMSUB231PD,     triton::arch::x86::ID_INS_VFNMSUB231PD},
+        {triton::extlibs::capstone::X86_INS_VFNMSUBPS,        triton::arch::x86::ID_INS_VFNMSUBPS},
+        {triton::extlibs::capstone::X86_INS_VFNMSUB231PS,     triton::arch::x86::ID_INS_VFNMSUB231PS},
+        {triton::extlibs::capstone::X86_INS_VFNMSUBSD,        triton::arch::x86::ID_INS_VFNMSUBSD},
+        {triton::extlibs::capstone::X86_INS_VFNMSUB213SD,     triton::arch::x86::ID_INS_VFNMSUB213SD},
+        {triton::extlibs::capstone::X86_INS_VFNMSUB132SD,     triton::arch::x86::ID_INS_VFNMSUB132SD},
+        {triton::extlibs::capstone::X86_INS_VFNMSUB231SD,     triton::arch::x86::ID_INS_VFNMSUB231SD},
+        {triton::extlibs::capstone::X86_INS_VFNMSUBSS,        triton::arch::x86::ID_INS_VFNMSUBSS},
+        {triton::extlibs::capstone::X86_INS_VFNMSUB213SS,     triton::arch::x86::ID_INS_VFNMSUB213SS},
+        {triton::extlibs::capstone::X86_INS_VFNMSUB132SS,     triton::arch::x86::ID_INS_VFNMSUB132SS},
+        {triton::extlibs::capstone::X86_INS_VFNMSUB231SS,     triton::arch::x86::ID_INS_VFNMSUB231SS},
+        {triton::extlibs::capstone::X86_INS_VFRCZPD,          triton::arch::x86::ID_INS_VFRCZPD},
+        {triton::extlibs::capstone::X86_INS_VFRCZPS,          triton::arch::x86::ID_INS_VFRCZPS},
+        {triton::extlibs::capstone::X86_INS_VFRCZSD,          triton::arch::x86::ID_INS_VFRCZSD},
+        {triton::extlibs::capstone::X86_INS_VFRCZSS,          triton::arch::x86::ID_INS_VFRCZSS},
+        {triton::extlibs::capstone::X86_INS_VORPD,            triton::arch::x86::ID_INS_VORPD},
+        {triton::extlibs::capstone::X86_INS_VORPS,            triton::arch::x86::ID_INS_VORPS},
+        {triton::extlibs::capstone::X86_INS_VXORPD,           triton::arch::x86::ID_INS_VXORPD},
+        {triton::extlibs::capstone::X86_INS_VXORPS,           triton::arch::x86::ID_INS_VXORPS},
+        {triton::extlibs::capstone::X86_INS_VGATHERDPD,       triton::arch::x86::ID_INS_VGATHERDPD},
+        {triton::extlibs::capstone::X86_INS_VGATHERDPS,       triton::arch::x86::ID_INS_VGATHERDPS},
+        {triton::extlibs::capstone::X86_INS_VGATHERPF0DPD,    triton::arch::x86::ID_INS_VGATHERPF0DPD},
+        {triton::extlibs::capstone::X86_INS_VGATHERPF0DPS,    triton::arch::x86::ID_INS_VGATHERPF0DPS},
+        {triton::extlibs::capstone::X86_INS_VGATHERPF0QPD,    triton::arch::x86::ID_INS_VGATHERPF0QPD},
+        {triton::extlibs::capstone::X86_INS_VGATHERPF0QPS,    triton::arch::x86::ID_INS_VGATHERPF0QPS},
+        {triton::extlibs::capstone::X86_INS_VGATHERPF1DPD,    triton::arch::x86::ID_INS_VGATHERPF1DPD},
+        {triton::extlibs::capstone::X86_INS_VGATHERPF1DPS,    triton::arch::x86::ID_INS_VGATHERPF1DPS},
+        {triton::extlibs::capstone::X86_INS_VGATHERPF1QPD,    triton::arch::x86::ID_INS_VGATHERPF1QPD},
+        {triton::extlibs::capstone::X86_INS_VGATHERPF1QPS,    triton::arch::x86::ID_INS_VGATHERPF1QPS},
+        {triton::extlibs::capstone::X86_INS_VGATHERQPD,       triton::arch::x86::ID_INS_VGATHERQPD},
+        {triton::extlibs::capstone::X86_INS_VGATHERQPS,       triton::arch::x86::ID_INS_VGATHERQPS},
+        {triton::extlibs::capstone::X86_INS_VHADDPD,          triton::arch::x86::ID_INS_VHADDPD},
+        {triton::extlibs::capstone::X86_INS_VHADDPS,          triton::arch::x86::ID_INS_VHADDPS},
+        {triton::extlibs::capstone::X86_INS_VHSUBPD,          triton::arch::x86::ID_INS_VHSUBPD},
+        {triton::extlibs::capstone::X86_INS_VHSUBPS,          triton::arch::x86::ID_INS_VHSUBPS},
+        {triton::extlibs::capstone::X86_INS_VINSERTF128,      triton::arch::x86::ID_INS_VINSERTF128},
+        {triton::extlibs::capstone::X86_INS_VINSERTF32X4,     triton::arch::x86::ID_INS_VINSERTF32X4},
+        {triton::extlibs::capstone::X86_INS_VINSERTF64X4,     triton::arch::x86::ID_INS_VINSERTF64X4},
+        {triton::extlibs::capstone::X86_INS_VINSERTI128,      triton::arch::x86::ID_INS_VINSERTI128},
+        {triton::extlibs::capstone::X86_INS_VINSERTI32X4,     triton::arch::x86::ID_INS_VINSERTI32X4},
+        {triton::extlibs::capstone::X86_INS_VINSERTI64X4,     triton::arch::x86::ID_INS_VINSERTI64X4},
+        {triton::extlibs::capstone::X86_INS_VINSERTPS,        triton::arch::x86::ID_INS_VINSERTPS},
+        {triton::extlibs::capstone::X86_INS_VLDDQU,           triton::arch::x86::ID_INS_VLDDQU},
+        {triton::extlibs::capstone::X86_INS_VLDMXCSR,         triton::arch::x86::ID_INS_VLDMXCSR},
+        {triton::extlibs::capstone::X86_INS_VMASKMOVDQU,      triton::arch::x86::ID_INS_VMASKMOVDQU},
+        {triton::extlibs::capstone::X86_INS_VMASKMOVPD,       triton::arch::x86::ID_INS_VMASKMOVPD},
+        {triton::extlibs::capstone::X86_INS_VMASKMOVPS,       triton::arch::x86::ID_INS_VMASKMOVPS},
+        {triton::extlibs::capstone::X86_INS_VMAXPD,           triton::arch::x86::ID_INS_VMAXPD},
+        {triton::extlibs::capstone::X86_INS_VMAXPS,           triton::arch::x86::ID_INS_VMAXPS},
+        {triton::extlibs::capstone::X86_INS_VMAXSD,           triton::arch::x86::ID_INS_VMAXSD},
+        {triton::extlibs::capstone::X86_INS_VMAXSS,           triton::arch::x86::ID_INS_VMAXSS},
+        {triton::extlibs::capstone::X86_INS_VMCALL,           triton::arch::x86::ID_INS_VMCALL},
+        {triton::extlibs::capstone::X86_INS_VMCLEAR,          triton::arch::x86::ID_INS_VMCLEAR},
+        {triton::extlibs::capstone::X86_INS_VMFUNC,           triton::arch::x86::ID_INS_VMFUNC},
+        {triton::extlibs::capstone::X86_INS_VMINPD,           triton::arch::x86::ID_INS_VMINPD},
+        {triton::extlibs::capstone::X86_INS_VMINPS,           triton::arch::x86::ID_INS_VMINPS},
+        {triton::extlibs::capstone::X86_INS_VMINSD,           triton::arch::x86::ID_INS_VMINSD},
+        {triton::extlibs::capstone::X86_INS_VMINSS,           triton::arch::x86::ID_INS_VMINSS},
+        {triton::extlibs::capstone::X86_INS_VMLAUNCH,         triton::arch::x86::ID_INS_VMLAUNCH},
+        {triton::extlibs::capstone::X86_INS_VMLOAD,           triton::arch::x86::ID_INS_VMLOAD},
+        {triton::extlibs::capstone::X86_INS_VMMCALL,          triton::arch::x86::ID_INS_VMMCALL},
+        {triton::extlibs::capstone::X86_INS_VMOVQ,            triton::arch::x86::ID_INS_VMOVQ},
+        {triton::extlibs::capstone::X86_INS_VMOVDDUP,         triton::arch::x86::ID_INS_VMOVDDUP},
+        {triton::extlibs::capstone::X86_INS_VMOVD,            triton::arch::x86::ID_INS_VMOVD},
+        {triton::extlibs::capstone::X86_INS_VMOVDQA32,        triton::arch::x86::ID_INS_VMOVDQA32},
+        {triton::extlibs::capstone::X86_INS_VMOVDQA64,        triton::arch::x86::ID_INS_VMOVDQA64},
+        {triton::extlibs::capstone::X86_INS_VMOVDQA,          triton::arch::x86::ID_INS_VMOVDQA},
+        {triton::extlibs::capstone::X86_INS_VMOVDQU16,        triton::arch::x86::ID_INS_VMOVDQU16},
+        {triton::extlibs::capstone::X86_INS_VMOVDQU32,        triton::arch::x86::ID_INS_VMOVDQU32},
+        {triton::extlibs::capstone::X86_INS_VMOVDQU64,        triton::arch::x86::ID_INS_VMOVDQU64},
+        {triton::extlibs::capstone::X86_INS_VMOVDQU8,         triton::arch::x86::ID_INS_VMOVDQU8},
+        {triton::extlibs::capstone::X86_INS_VMOVDQU,          triton::arch::x86::ID_INS_VMOVDQU},
+        {triton::extlibs::capstone::X86_INS_VMOVHLPS,         triton::arch::x86::ID_INS_VMOVHLPS},
+        {triton::extlibs::capstone::X86_INS_VMOVHPD,          triton::arch::x86::ID_INS_VMOVHPD},
+        {triton::extlibs::capstone::X86_INS_VMOVHPS,          triton::arch::x86::ID_INS_VMOVHPS},
+        {triton::extlibs::capstone::X86_INS_VMOVLHPS,         triton::arch::x86::ID_INS_VMOVLHPS},
+        {triton::extlibs::capstone::X86_INS_VMOVLPD,          triton::arch::x86::ID_INS_VMOVLPD},
+        {triton::extlibs::capstone::X86_INS_VMOVLPS,          triton::arch::x86::ID_INS_VMOVLPS},
+        {triton::extlibs::capstone::X86_INS_VMOVMSKPD,        triton::arch::x86::ID_INS_VMOVMSKPD},
+        {triton::extlibs::capstone::X86_INS_VMOVMSKPS,        triton::arch::x86::ID_INS_VMOVMSKPS},
+        {triton::extlibs::capstone::X86_INS_VMOVNTDQA,        triton::arch::x86::ID_INS_VMOVNTDQA},
+        {triton::extlibs::capstone::X86_INS_VMOVNTDQ,         triton::arch::x86::ID_INS_VMOVNTDQ},
+        {triton::extlibs::capstone::X86_INS_VMOVNTPD,         triton::arch::x86::ID_INS_VMOVNTPD},
+        {triton::extlibs::capstone::X86_INS_VMOVNTPS,         triton::arch::x86::ID_INS_VMOVNTPS},
+        {triton::extlibs::capstone::X86_INS_VMOVSD,           triton::arch::x86::ID_INS_VMOVSD},
+        {triton::extlibs::capstone::X86_INS_VMOVSHDUP,        triton::arch::x86::ID_INS_VMOVSHDUP},
+        {triton::extlibs::capstone::X86_INS_VMOVSLDUP,        triton::arch::x86::ID_INS_VMOVSLDUP},
+        {triton::extlibs::capstone::X86_INS_VMOVSS,           triton::arch::x86::ID_INS_VMOVSS},
+        {triton::extlibs::capstone::X86_INS_VMOVUPD,          triton::arch::x86::ID_INS_VMOVUPD},
+        {triton::extlibs::capstone::X86_INS_VMOVUPS,          triton::arch::x86::ID_INS_VMOVUPS},
+        {triton::extlibs::capstone::X86_INS_VMPSADBW,         triton::arch::x86::ID_INS_VMPSADBW},
+        {triton::extlibs::capstone::X86_INS_VMPTRLD,          triton::arch::x86::ID_INS_VMPTRLD},
+        {triton::extlibs::capstone::X86_INS_VMPTRST,          triton::arch::x86::ID_INS_VMPTRST},
+        {triton::extlibs::capstone::X86_INS_VMREAD,           triton::arch::x86::ID_INS_VMREAD},
+        {triton::extlibs::capstone::X86_INS_VMRESUME,         triton::arch::x86::ID_INS_VMRESUME},
+        {triton::extlibs::capstone::X86_INS_VMRUN,            triton::arch::x86::ID_INS_VMRUN},
+        {triton::extlibs::capstone::X86_INS_VMSAVE,           triton::arch::x86::ID_INS_VMSAVE},
+        {triton::extlibs::capstone::X86_INS_VMULPD,           triton::arch::x86::ID_INS_VMULPD},
+        {triton::extlibs::capstone::X86_INS_VMULPS,           triton::arch::x86::ID_INS_VMULPS},
+        {triton::extlibs::capstone::X86_INS_VMULSD,           triton::arch::x86::ID_INS_VMULSD},
+        {triton::extlibs::capstone::X86_INS_VMULSS,           triton::arch::x86::ID_INS_VMULSS},
+        {triton::extlibs::capstone::X86_INS_VMWRITE,          triton::arch::x86::ID_INS_VMWRITE},
+        {triton::extlibs::capstone::X86_INS_VMXOFF,           triton::arch::x86::ID_INS_VMXOFF},
+        {triton::extlibs::capstone::X86_INS_VMXON,            triton::arch::x86::ID_INS_VMXON},
+        {triton::extlibs::capstone::X86_INS_VPABSB,           triton::arch::x86::ID_INS_VPABSB},
+        {triton::extlibs::capstone::X86_INS_VPABSD,           triton::arch::x86::ID_INS_VPABSD},
+        {triton::extlibs::capstone::X86_INS_VPABSQ,           triton::arch::x86::ID_INS_VPABSQ},
+        {triton::extlibs::capstone::X86_INS_VPABSW,           triton::arch::x86::ID_INS_VPABSW},
+        {triton::extlibs::capstone::X86_INS_VPACKSSDW,        triton::arch::x86::ID_INS_VPACKSSDW},
+        {triton::extlibs::capstone::X86_INS_VPACKSSWB,        triton::arch::x86::ID_INS_VPACKSSWB},
+        {triton::extlibs::capstone::X86_INS_VPACKUSDW,        triton::arch::x86::ID_INS_VPACKUSDW},
+        {triton::extlibs::capstone::X86_INS_VPACKUSWB,        triton::arch::x86::ID_INS_VPACKUSWB},
+        {triton::extlibs::capstone::X86_INS_VPADDB,           triton::arch::x86::ID_INS_VPADDB},
+        {triton::extlibs::capstone::X86_INS_VPADDD,           triton::arch::x86::ID_INS_VPADDD},
+        {triton::extlibs::capstone::X86_INS_VPADDQ,           triton::arch::x86::ID_INS_VPADDQ},
+        {triton::extlibs::capstone::X86_INS_VPADDSB,          triton::arch::x86::ID_INS_VPADDSB},
+        {triton::extlibs::capstone::X86_INS_VPADDSW,          triton::arch::x86::ID_INS_VPADDSW},
+        {triton::extlibs::capstone::X86_INS_VPADDUSB,         triton::arch::x86::ID_INS_VPADDUSB},
+        {triton::extlibs::capstone::X86_INS_VPADDUSW,         triton::arch::x86::ID_INS_VPADDUSW},
+        {triton::extlibs::capstone::X86_INS_VPADDW,           triton::arch::x86::ID_INS_VPADDW},
+        {triton::extlibs::capstone::X86_INS_VPALIGNR,         triton::arch::x86::ID_INS_VPALIGNR},
+        {triton::extlibs::capstone::X86_INS_VPANDD,           triton::arch::x86::ID_INS_VPANDD},
+        {triton::extlibs::capstone::X86_INS_VPANDND,          triton::arch::x86::ID_INS_VPANDND},
+        {triton::extlibs::capstone::X86_INS_VPANDNQ,          triton::arch::x86::ID_INS_VPANDNQ},
+        {triton::extlibs::capstone::X86_INS_VPANDN,           triton::arch::x86::ID_INS_VPANDN},
+        {triton::extlibs::capstone::X86_INS_VPANDQ,           triton::arch::x86::ID_INS_VPANDQ},
+        {triton::extlibs::capstone::X86_INS_VPAND,            triton::arch::x86::ID_INS_VPAND},
+        {triton::extlibs::capstone::X86_INS_VPAVGB,           triton::arch::x86::ID_INS_VPAVGB},
+        {triton::extlibs::capstone::X86_INS_VPAVGW,           triton::arch::x86::ID_INS_VPAVGW},
+        {triton::extlibs::capstone::X86_INS_VPBLENDD,         triton::arch::x86::ID_INS_VPBLENDD},
+        {triton::extlibs::capstone::X86_INS_VPBLENDMD,        triton::arch::x86::ID_INS_VPBLENDMD},
+        {triton::extlibs::capstone::X86_INS_VPBLENDMQ,        triton::arch::x86::ID_INS_VPBLENDMQ},
+        {triton::extlibs::capstone::X86_INS_VPBLENDVB,        triton::arch::x86::ID_INS_VPBLENDVB},
+        {triton::extlibs::capstone::X86_INS_VPBLENDW,         triton::arch::x86::ID_INS_VPBLENDW},
+        {triton::extlibs::capstone::X86_INS_VPBROADCASTB,     triton::arch::x86::ID_INS_VPBROADCASTB},
+        {triton::extlibs::capstone::X86_INS_VPBROADCASTD,     triton::arch::x86::ID_INS_VPBROADCASTD},
+        {triton::extlibs::capstone::X86_INS_VPBROADCASTMB2Q,  triton::arch::x86::ID_INS_VPBROADCASTMB2Q},
+        {triton::extlibs::capstone::X86_INS_VPBROADCASTMW2D,  triton::arch::x86::ID_INS_VPBROADCASTMW2D},
+        {triton::extlibs::capstone::X86_INS_VPBROADCASTQ,     triton::arch::x86::ID_INS_VPBROADCASTQ},
+        {triton::extlibs::capstone::X86_INS_VPBROADCASTW,     triton::arch::x86::ID_INS_VPBROADCASTW},
+        {triton::extlibs::capstone::X86_INS_VPCLMULQDQ,       triton::arch::x86::ID_INS_VPCLMULQDQ},
+        {triton::extlibs::capstone::X86_INS_VPCMOV,           triton::arch::x86::ID_INS_VPCMOV},
+        {triton::extlibs::capstone::X86_INS_VPCMP,            triton::arch::x86::ID_INS_VPCMP},
+        {triton::extlibs::capstone::X86_INS_VPCMPD,           triton::arch::x86::ID_INS_VPCMPD},
+        {triton::extlibs::capstone::X86_INS_VPCMPEQB,         triton::arch::x86::ID_INS_VPCMPEQB},
+        {triton::extlibs::capstone::X86_INS_VPCMPEQD,         triton::arch::x86::ID_INS_VPCMPEQD},
+        {triton::extlibs::capstone::X86_INS_VPCMPEQQ,         triton::arch::x86::ID_INS_VPCMPEQQ},
+        {triton::extlibs::capstone::X86_INS_VPCMPEQW,         triton::arch::x86::ID_INS_VPCMPEQW},
+        {triton::extlibs::capstone::X86_INS_VPCMPESTRI,       triton::arch::x86::ID_INS_VPCMPESTRI},
+        {triton::extlibs::capstone::X86_INS_VPCMPESTRM,       triton::arch::x86::ID_INS_VPCMPESTRM},
+        {triton::extlibs::capstone::X86_INS_VPCMPGTB,         triton::arch::x86::ID_INS_VPCMPGTB},
+        {triton::extlibs::capstone::X86_INS_VPCMPGTD,         triton::arch::x86::ID_INS_VPCMPGTD},
+        {triton::extlibs::capstone::X86_INS_VPCMPGTQ,         triton::arch::x86::ID_INS_VPCMPGTQ},
+        {triton::extlibs::capstone::X86_INS_VPCMPGTW,         triton::arch::x86::ID_INS_VPCMPGTW},
+        {triton::extlibs::capstone::X86_INS_VPCMPISTRI,       triton::arch::x86::ID_INS_VPCMPISTRI},
+        {triton::extlibs::capstone::X86_INS_VPCMPISTRM,       triton::arch::x86::ID_INS_VPCMPISTRM},
+        {triton::extlibs::capstone::X86_INS_VPCMPQ,           triton::arch::x86::ID_INS_VPCMPQ},
+        {triton::extlibs::capstone::X86_INS_VPCMPUD,          triton::arch::x86::ID_INS_VPCMPUD},
+        {triton::extlibs::capstone::X86_INS_VPCMPUQ,          triton::arch::x86::ID_INS_VPCMPUQ},
+        {triton::extlibs::capstone::X86_INS_VPCOMB,           triton::arch::x86::ID_INS_VPCOMB},
+        {triton::extlibs::capstone::X86_INS_VPCOMD,           triton::arch::x86::ID_INS_VPCOMD},
+        {triton::extlibs::capstone::X86_INS_VPCOMQ,           triton::arch::x86::ID_INS_VPCOMQ},
+        {triton::extlibs::capstone::X86_INS_VPCOMUB,          triton::arch::x86::ID_INS_VPCOMUB},
+        {triton::extlibs::capstone::X86_INS_VPCOMUD,          triton::arch::x86::ID_INS_VPCOMUD},
+        {triton::extlibs::capstone::X86_INS_VPCOMUQ,          triton::arch::x86::ID_INS_VPCOMUQ},
+        {triton::extlibs::capstone::X86_INS_VPCOMUW,          triton::arch::x86::ID_INS_VPCOMUW},
+        {triton::extlibs::capstone::X86_INS_VPCOMW,           triton::arch::x86::ID_INS_VPCOMW},
+        {triton::extlibs::capstone::X86_INS_VPCONFLICTD,      triton::arch::x86::ID_INS_VPCONFLICTD},
+        {triton::extlibs::capstone::X86_INS_VPCONFLICTQ,      triton::arch::x86::ID_INS_VPCONFLICTQ},
+        {triton::extlibs::capstone::X86_INS_VPERM2F128,       triton::arch::x86::ID_INS_VPERM2F128},
+        {triton::extlibs::capstone::X86_INS_VPERM2I128,       triton::arch::x86::ID_INS_VPERM2I128},
+        {triton::extlibs::capstone::X86_INS_VPERMD,           triton::arch::x86::ID_INS_VPERMD},
+        {triton::extlibs::capstone::X86_INS_VPERMI2D,         triton::arch::x86::ID_INS_VPERMI2D},
+        {triton::extlibs::capstone::X86_INS_VPERMI2PD,        triton::arch::x86::ID_INS_VPERMI2PD},
+        {triton::extlibs::capstone::X86_INS_VPERMI2PS,        triton::arch::x86::ID_INS_VPERMI2PS},
+        {triton::extlibs::capstone::X86_INS_VPERMI2Q,         triton::arch::x86::ID_INS_VPERMI2Q},
+        {triton::extlibs::capstone::X86_INS_VPERMIL2PD,       triton::arch::x86::ID_INS_VPERMIL2PD},
+        {triton::extlibs::capstone::X86_INS_VPERMIL2PS,       triton::arch::x86::ID_INS_VPERMIL2PS},
+        {triton::extlibs::capstone::X86_INS_VPERMILPD,        triton::arch::x86::ID_INS_VPERMILPD},
+        {triton::extlibs::capstone::X86_INS_VPERMILPS,        triton::arch::x86::ID_INS_VPERMILPS},
+        {triton::extlibs::capstone::X86_INS_VPERMPD,          triton::arch::x86::ID_INS_VPERMPD},
+        {triton::extlibs::capstone::X86_INS_VPERMPS,          triton::arch::x86::ID_INS_VPERMPS},
+        {triton::extlibs::capstone::X86_INS_VPERMQ,           triton::arch::x86::ID_INS_VPERMQ},
+        {triton::extlibs::capstone::X86_INS_VPERMT2D,         triton::arch::x86::ID_INS_VPERMT2D},
+        {triton::extlibs::capstone::X86_INS_VPERMT2PD,        triton::arch::x86::ID_INS_VPERMT2PD},
+        {triton::extlibs::capstone::X86_INS_VPERMT2PS,        triton::arch::x86::ID_INS_VPERMT2PS},
+        {triton::extlibs::capstone::X86_INS_VPERMT2Q,         triton::arch::x86::ID_INS_VPERMT2Q},
+        {triton::extlibs::capstone::X86_INS_VPEXTRB,          triton::arch::x86::ID_INS_VPEXTRB},
+        {triton::extlibs::capstone::X86_INS_VPEXTRD,          triton::arch::x86::ID_INS_VPEXTRD},
+        {triton::extlibs::capstone::X86_INS_VPEXTRQ,          triton::arch::x86::ID_INS_VPEXTRQ},
+        {triton::extlibs::capstone::X86_INS_VPEXTRW,          triton::arch::x86::ID_INS_VPEXTRW},
+        {triton::extlibs::capstone::X86_INS_VPGATHERDD,       triton::arch::x86::ID_INS_VPGATHERDD},
+        {triton::extlibs::capstone::X86_INS_VPGATHERDQ,       triton::arch::x86::ID_INS_VPGATHERDQ},
+        {triton::extlibs::capstone::X86_INS_VPGATHERQD,       triton::arch::x86::ID_INS_VPGATHERQD},
+        {triton::extlibs::capstone::X86_INS_VPGATHERQQ,       triton::arch::x86::ID_INS_VPGATHERQQ},
+        {triton::extlibs::capstone::X86_INS_VPHADDBD,         triton::arch::x86::ID_INS_VPHADDBD},
+        {triton::extlibs::capstone::X86_INS_VPHADDBQ,         triton::arch::x86::ID_INS_VPHADDBQ},
+        {triton::extlibs::capstone::X86_INS_VPHADDBW,         triton::arch::x86::ID_INS_VPHADDBW},
+        {triton::extlibs::capstone::X86_INS_VPHADDDQ,         triton::arch::x86::ID_INS_VPHADDDQ},
+        {triton::extlibs::capstone::X86_INS_VPHADDD,          triton::arch::x86::ID_INS_VPHADDD},
+        {triton::extlibs::capstone::X86_INS_VPHADDSW,         triton::arch::x86::ID_INS_VPHADDSW},
+        {triton::extlibs::capstone::X86_INS_VPHADDUBD,        triton::arch::x86::ID_INS_VPHADDUBD},
+        {triton::extlibs::capstone::X86_INS_VPHADDUBQ,        triton::arch::x86::ID_INS_VPHADDUBQ},
+        {triton::extlibs::capstone::X86_INS_VPHADDUBW,        triton::arch::x86::ID_INS_VPHADDUBW},
+        {triton::extlibs::capstone::X86_INS_VPHADDUDQ,        triton::arch::x86::ID_INS_VPHADDUDQ},
+        {triton::extlibs::capstone::X86_INS_VPHADDUWD,        triton::arch::x86::ID_INS_VPHADDUWD},
+        {triton::extlibs::capstone::X86_INS_VPHADDUWQ,        triton::arch::x86::ID_INS_VPHADDUWQ},
+        {triton::extlibs::capstone::X86_INS_VPHADDWD,         triton::arch::x86::ID_INS_VPHADDWD},
+        {triton::extlibs::capstone::X86_INS_VPHADDWQ,         triton::arch::x86::ID_INS_VPHADDWQ},
+        {triton::extlibs::capstone::X86_INS_VPHADDW,          triton::arch::x86::ID_INS_VPHADDW},
+        {triton::extlibs::capstone::X86_INS_VPHMINPOSUW,      triton::arch::x86::ID_INS_VPHMINPOSUW},
+        {triton::extlibs::capstone::X86_INS_VPHSUBBW,         triton::arch::x86::ID_INS_VPHSUBBW},
+        {triton::extlibs::capstone::X86_INS_VPHSUBDQ,         triton::arch::x86::ID_INS_VPHSUBDQ},
+        {triton::extlibs::capstone::X86_INS_VPHSUBD,          triton::arch::x86::ID_INS_VPHSUBD},
+        {triton::extlibs::capstone::X86_INS_VPHSUBSW,         triton::arch::x86::ID_INS_VPHSUBSW},
+        {triton::extlibs::capstone::X86_INS_VPHSUBWD,         triton::arch::x86::ID_INS_VPHSUBWD},
+        {triton::extlibs::capstone::X86_INS_VPHSUBW,          triton::arch::x86::ID_INS_VPHSUBW},
+        {triton::extlibs::capstone::X86_INS_VPINSRB,          triton::arch::x86::ID_INS_VPINSRB},
+        {triton::extlibs::capstone::X86_INS_VPINSRD,          triton::arch::x86::ID_INS_VPINSRD},
+        {triton::extlibs::capstone::X86_INS_VPINSRQ,          triton::arch::x86::ID_INS_VPINSRQ},
+        {triton::extlibs::capstone::X86_INS_VPINSRW,          triton::arch::x86::ID_INS_VPINSRW},
+        {triton::extlibs::capstone::X86_INS_VPLZCNTD,         triton::arch::x86::ID_INS_VPLZCNTD},
+        {triton::extlibs::capstone::X86_INS_VPLZCNTQ,         triton::arch::x86::ID_INS_VPLZCNTQ},
+        {triton::extlibs::capstone::X86_INS_VPMACSDD,         triton::arch::x86::ID_INS_VPMACSDD},
+        {triton::extlibs::capstone::X86_INS_VPMACSDQH,        triton::arch::x86::ID_INS_VPMACSDQH},
+        {triton::extlibs::capstone::X86_INS_VPMACSDQL,        triton::arch::x86::ID_INS_VPMACSDQL},
+        {triton::extlibs::capstone::X86_INS_VPMACSSDD,        triton::arch::x86::ID_INS_VPMACSSDD},
+        {triton::extlibs::capstone::X86_INS_VPMACSSDQH,       triton::arch::x86::ID_INS_VPMACSSDQH},
+        {triton::extlibs::capstone::X86_INS_VPMACSSDQL,       triton::arch::x86::ID_INS_VPMACSSDQL},
+        {triton::extlibs::capstone::X86_INS_VPMACSSWD,        triton::arch::x86::ID_INS_VPMACSSWD},
+        {triton::extlibs::capstone::X86_INS_VPMACSSWW,        triton::arch::x86::ID_INS_VPMACSSWW},
+        {triton::extlibs::capstone::X86_INS_VPMACSWD,         triton::arch::x86::ID_INS_VPMACSWD},
+        {triton::extlibs::capstone::X86_INS_VPMACSWW,         triton::arch::x86::ID_INS_VPMACSWW},
+        {triton::extlibs::capstone::X86_INS_VPMADCSSWD,       triton::arch::x86::ID_INS_VPMADCSSWD},
+        {triton::extlibs::capstone::X86_INS_VPMADCSWD,        triton::arch::x86::ID_INS_VPMADCSWD},
+        {triton::extlibs::capstone::X86_INS_VPMADDUBSW,       triton::arch::x86::ID_INS_VPMADDUBSW},
+        {triton::extlibs::capstone::X86_INS_VPMADDWD,         triton::arch::x86::ID_INS_VPMADDWD},
+        {triton::extlibs::capstone::X86_INS_VPMASKMOVD,       triton::arch::x86::ID_INS_VPMASKMOVD},
+        {triton::extlibs::capstone::X86_INS_VPMASKMOVQ,       triton::arch::x86::ID_INS_VPMASKMOVQ},
+        {triton::extlibs::capstone::X86_INS_VPMAXSB,          triton::arch::x86::ID_INS_VPMAXSB},
+        {triton::extlibs::capstone::X86_INS_VPMAXSD,          triton::arch::x86::ID_INS_VPMAXSD},
+        {triton::extlibs::capstone::X86_INS_VPMAXSQ,          triton::arch::x86::ID_INS_VPMAXSQ},
+        {triton::extlibs::capstone::X86_INS_VPMAXSW,          triton::arch::x86::ID_INS_VPMAXSW},
+        {triton::extlibs::capstone::X86_INS_VPMAXUB,          triton::arch::x86::ID_INS_VPMAXUB},
+        {triton::extlibs::capstone::X86_INS_VPMAXUD,          triton::arch::x86::ID_INS_VPMAXUD},
+        {triton::extlibs::capstone::X86_INS_VPMAXUQ,          triton::arch::x86::ID_INS_VPMAXUQ},
+        {triton::extlibs::capstone::X86_INS_VPMAXUW,          triton::arch::x86::ID_INS_VPMAXUW},
+        {triton::extlibs::capstone::X86_INS_VPMINSB,          triton::arch::x86::ID_INS_VPMINSB},
+        {triton::extlibs::capstone::X86_INS_VPMINSD,          triton::arch::x86::ID_INS_VPMINSD},
+        {triton::extlibs::capstone::X86_INS_VPMINSQ,          triton::arch::x86::ID_INS_VPMINSQ},
+        {triton::extlibs::capstone::X86_INS_VPMINSW,          triton::arch::x86::ID_INS_VPMINSW},
+        {triton::extlibs::capstone::X86_INS_VPMINUB,          triton::arch::x86::ID_INS_VPMINUB},
+        {triton::extlibs::capstone::X86_INS_VPMINUD,          triton::arch::x86::ID_INS_VPMINUD},
+        {triton::extlibs::capstone::X86_INS_VPMINUQ,          triton::arch::x86::ID_INS_VPMINUQ},
+        {triton::extlibs::capstone::X86_INS_VPMINUW,          triton::arch::x86::ID_INS_VPMINUW},
+        {triton::extlibs::capstone::X86_INS_VPMOVDB,          triton::arch::x86::ID_INS_VPMOVDB},
+        {triton::extlibs::capstone::X86_INS_VPMOVDW,          triton::arch::x86::ID_INS_VPMOVDW},
+        {triton::extlibs::capstone::X86_INS_VPMOVMSKB,        triton::arch::x86::ID_INS_VPMOVMSKB},
+        {triton::extlibs::capstone::X86_INS_VPMOVQB,          triton::arch::x86::ID_INS_VPMOVQB},
+        {triton::extlibs::capstone::X86_INS_VPMOVQD,          triton::arch::x86::ID_INS_VPMOVQD},
+        {triton::extlibs::capstone::X86_INS_VPMOVQW,          triton::arch::x86::ID_INS_VPMOVQW},
+        {triton::extlibs::capstone::X86_INS_VPMOVSDB,         triton::arch::x86::ID_INS_VPMOVSDB},
+        {triton::extlibs::capstone::X86_INS_VPMOVSDW,         triton::arch::x86::ID_INS_VPMOVSDW},
+        {triton::extlibs::capstone::X86_INS_VPMOVSQB,         triton::arch::x86::ID_INS_VPMOVSQB},
+        {triton::extlibs::capstone::X86_INS_VPMOVSQD,         triton::arch::x86::ID_INS_VPMOVSQD},
+        {triton::extlibs::capstone::X86_INS_VPMOVSQW,         triton::arch::x86::ID_INS_VPMOVSQW},
+        {triton::extlibs::capstone::X86_INS_VPMOVSXBD,        triton::arch::x86::ID_INS_VPMOVSXBD},
+        {triton::extlibs::capstone::X86_INS_VPMOVSXBQ,        triton::arch::x86::ID_INS_VPMOVSXBQ},
+        {triton::extlibs::capstone::X86_INS_VPMOVSXBW,        triton::arch::x86::ID_INS_VPMOVSXBW},
+        {triton::extlibs::capstone::X86_INS_VPMOVSXDQ,        triton::arch::x86::ID_INS_VPMOVSXDQ},
+        {triton::extlibs::capstone::X86_INS_VPMOVSXWD,        triton::arch::x86::ID_INS_VPMOVSXWD},
+        {triton::extlibs::capstone::X86_INS_VPMOVSXWQ,        triton::arch::x86::ID_INS_VPMOVSXWQ},
+        {triton::extlibs::capstone::X86_INS_VPMOVUSDB,        triton::arch::x86::ID_INS_VPMOVUSDB},
+        {triton::extlibs::capstone::X86_INS_VPMOVUSDW,        triton::arch::x86::ID_INS_VPMOVUSDW},
+        {triton::extlibs::capstone::X86_INS_VPMOVUSQB,        triton::arch::x86::ID_INS_VPMOVUSQB},
+        {triton::extlibs::capstone::X86_INS_VPMOVUSQD,        triton::arch::x86::ID_INS_VPMOVUSQD},
+        {triton::extlibs::capstone::X86_INS_VPMOVUSQW,        triton::arch::x86::ID_INS_VPMOVUSQW},
+        {triton::extlibs::capstone::X86_INS_VPMOVZXBD,        triton::arch::x86::ID_INS_VPMOVZXBD},
+        {triton::extlibs::capstone::X86_INS_VPMOVZXBQ,        triton::arch::x86::ID_INS_VPMOVZXBQ},
+        {triton::extlibs::capstone::X86_INS_VPMOVZXBW,        triton::arch::x86::ID_INS_VPMOVZXBW},
+        {triton::extlibs::capstone::X86_INS_VPMOVZXDQ,        triton::arch::x86::ID_INS_VPMOVZXDQ},
+        {triton::extlibs::capstone::X86_INS_VPMOVZXWD,        triton::arch::x86::ID_INS_VPMOVZXWD},
+        {triton::extlibs::capstone::X86_INS_VPMOVZXWQ,        triton::arch::x86::ID_INS_VPMOVZXWQ},
+        {triton::extlibs::capstone::X86_INS_VPMULDQ,          triton::arch::x86::ID_INS_VPMULDQ},
+        {triton::extlibs::capstone::X86_INS_VPMULHRSW,        triton::arch::x86::ID_INS_VPMULHRSW},
+        {triton::extlibs::capstone::X86_INS_VPMULHUW,         triton::arch::x86::ID_INS_VPMULHUW},
+        {triton::extlibs::capstone::X86_INS_VPMULHW,          triton::arch::x86::ID_INS_VPMULHW},
+        {triton::extlibs::capstone::X86_INS_VPMULLD,          triton::arch::x86::ID_INS_VPMULLD},
+        {triton::extlibs::capstone::X86_INS_VPMULLW,          triton::arch::x86::ID_INS_VPMULLW},
+        {triton::extlibs::capstone::X86_INS_VPMULUDQ,         triton::arch::x86::ID_INS_VPMULUDQ},
+        {triton::extlibs::capstone::X86_INS_VPORD,            triton::arch::x86::ID_INS_VPORD},
+        {triton::extlibs::capstone::X86_INS_VPORQ,            triton::arch::x86::ID_INS_VPORQ},
+        {triton::extlibs::capstone::X86_INS_VPOR,             triton::arch::x86::ID_INS_VPOR},
+        {triton::extlibs::capstone::X86_INS_VPPERM,           triton::arch::x86::ID_INS_VPPERM},
+        {triton::extlibs::capstone::X86_INS_VPROTB,           triton::arch::x86::ID_INS_VPROTB},
+        {triton::extlibs::capstone::X86_INS_VPROTD,           triton::arch::x86::ID_INS_VPROTD},
+        {triton::extlibs::capstone::X86_INS_VPROTQ,           triton::arch::x86::ID_INS_VPROTQ},
+        {triton::extlibs::capstone::X86_INS_VPROTW,           triton::arch::x86::ID_INS_VPROTW},
+        {triton::extlibs::capstone::X86_INS_VPSADBW,          triton::arch::x86::ID_INS_VPSADBW},
+        {triton::extlibs::capstone::X86_INS_VPSCATTERDD,      triton::arch::x86::ID_INS_VPSCATTERDD},
+        {triton::extlibs::capstone::X86_INS_VPSCATTERDQ,      triton::arch::x86::ID_INS_VPSCATTERDQ},
+        {triton::extlibs::capstone::X86_INS_VPSCATTERQD,      triton::arch::x86::ID_INS_VPSCATTERQD},
+        {triton::extlibs::capstone::X86_INS_VPSCATTERQQ,      triton::arch::x86::ID_INS_VPSCATTERQQ},
+        {triton::extlibs::capstone::X86_INS_VPSHAB,           triton::arch::x86::ID_INS_VPSHAB},
+        {triton::extlibs::capstone::X86_INS_VPSHAD,           triton::arch::x86::ID_INS_VPSHAD},
+        {triton::extlibs::capstone::X86_INS_VPSHAQ,           triton::arch::x86::ID_INS_VPSHAQ},
+        {triton::extlibs::capstone::X86_INS_VPSHAW,           triton::arch::x86::ID_INS_VPSHAW},
+        {triton::extlibs::capstone::X86_INS_VPSHLB,           triton::arch::x86::ID_INS_VPSHLB},
+        {triton::extlibs::capstone::X86_INS_VPSHLD,           triton::arch::x86::ID_INS_VPSHLD},
+        {triton::extlibs::capstone::X86_INS_VPSHLQ,           triton::arch::x86::ID_INS_VPSHLQ},
+        {triton::extlibs::capstone::X86_INS_VPSHLW,           triton::arch::x86::ID_INS_VPSHLW},
+        {triton::extlibs::capstone::X86_INS_VPSHUFB,          triton::arch::x86::ID_INS_VPSHUFB},
+        {triton::extlibs::capstone::X86_INS_VPSHUFD,          triton::arch::x86::ID_INS_VPSHUFD},
+        {triton::extlibs::capstone::X86_INS_VPSHUFHW,         triton::arch::x86::ID_INS_VPSHUFHW},
+        {triton::extlibs::capstone::X86_INS_VPSHUFLW,         triton::arch::x86::ID_INS_VPSHUFLW},
+        {triton::extlibs::capstone::X86_INS_VPSIGNB,          triton::arch::x86::ID_INS_VPSIGNB},
+        {triton::extlibs::capstone::X86_INS_VPSIGND,          triton::arch::x86::ID_INS_VPSIGND},
+        {triton::extlibs::capstone::X86_INS_VPSIGNW,          triton::arch::x86::ID_INS_VPSIGNW},
+        {triton::extlibs::capstone::X86_INS_VPSLLDQ,          triton::arch::x86::ID_INS_VPSLLDQ},
+        {triton::extlibs::capstone::X86_INS_VPSLLD,           triton::arch::x86::ID_INS_VPSLLD},
+        {triton::extlibs::capstone::X86_INS_VPSLLQ,           triton::arch::x86::ID_INS_VPSLLQ},
+        {triton::extlibs::capstone::X86_INS_VPSLLVD,          triton::arch::x86::ID_INS_VPSLLVD},
+        {triton::extlibs::capstone::X86_INS_VPSLLVQ,          triton::arch::x86::ID_INS_VPSLLVQ},
+        {triton::extlibs::capstone::X86_INS_VPSLLW,           triton::arch::x86::ID_INS_VPSLLW},
+        {triton::extlibs::capstone::X86_INS_VPSRAD,           triton::arch::x86::ID_INS_VPSRAD},
+        {triton::extlibs::capstone::X86_INS_VPSRAQ,           triton::arch::x86::ID_INS_VPSRAQ},
+        {triton::extlibs::capstone::X86_INS_VPSRAVD,          triton::arch::x86::ID_INS_VPSRAVD},
+        {triton::extlibs::capstone::X86_INS_VPSRAVQ,          triton::arch::x86::ID_INS_VPSRAVQ},
+        {triton::extlibs::capstone::X86_INS_VPSRAW,           triton::arch::x86::ID_INS_VPSRAW},
+        {triton::extlibs::capstone::X86_INS_VPSRLDQ,          triton::arch::x86::ID_INS_VPSRLDQ},
+        {triton::extlibs::capstone::X86_INS_VPSRLD,           triton::arch::x86::ID_INS_VPSRLD},
+        {triton::extlibs::capstone::X86_INS_VPSRLQ,           triton::arch::x86::ID_INS_VPSRLQ},
+        {triton::extlibs::capstone::X86_INS_VPSRLVD,          triton::arch::x86::ID_INS_VPSRLVD},
+        {triton::extlibs::capstone::X86_INS_VPSRLVQ,          triton::arch::x86::ID_INS_VPSRLVQ},
+        {triton::extlibs::capstone::X86_INS_VPSRLW,           triton::arch::x86::ID_INS_VPSRLW},
+        {triton::extlibs::capstone::X86_INS_VPSUBB,           triton::arch::x86::ID_INS_VPSUBB},
+        {triton::extlibs::capstone::X86_INS_VPSUBD,           triton::arch::x86::ID_INS_VPSUBD},
+        {triton::extlibs::capstone::X86_INS_VPSUBQ,           triton::arch::x86::ID_INS_VPSUBQ},
+        {triton::extlibs::capstone::X86_INS_VPSUBSB,          triton::arch::x86::ID_INS_VPSUBSB},
+        {triton::extlibs::capstone::X86_INS_VPSUBSW,          triton::arch::x86::ID_INS_VPSUBSW},
+        {triton::extlibs::capstone::X86_INS_VPSUBUSB,         triton::arch::x86::ID_INS_VPSUBUSB},
+        {triton::extlibs::capstone::X86_INS_VPSUBUSW,         triton::arch::x86::ID_INS_VPSUBUSW},
+        {triton::extlibs::capstone::X86_INS_VPSUBW,           triton::arch::x86::ID_INS_VPSUBW},
+        {triton::extlibs::capstone::X86_INS_VPTESTMD,         triton::arch::x86::ID_INS_VPTESTMD},
+        {triton::extlibs::capstone::X86_INS_VPTESTMQ,         triton::arch::x86::ID_INS_VPTESTMQ},
+        {triton::extlibs::capstone::X86_INS_VPTESTNMD,        triton::arch::x86::ID_INS_VPTESTNMD},
+        {triton::extlibs::capstone::X86_INS_VPTESTNMQ,        triton::arch::x86::ID_INS_VPTESTNMQ},
+        {triton::extlibs::capstone::X86_INS_VPTEST,           triton::arch::x86::ID_INS_VPTEST},
+        {triton::extlibs::capstone::X86_INS_VPUNPCKHBW,       triton::arch::x86::ID_INS_VPUNPCKHBW},
+        {triton::extlibs::capstone::X86_INS_VPUNPCKHDQ,       triton::arch::x86::ID_INS_VPUNPCKHDQ},
+        {triton::extlibs::capstone::X86_INS_VPUNPCKHQDQ,      triton::arch::x86::ID_INS_VPUNPCKHQDQ},
+        {triton::extlibs::capstone::X86_INS_VPUNPCKHWD,       triton::arch::x86::ID_INS_VPUNPCKHWD},
+        {triton::extlibs::capstone::X86_INS_VPUNPCKLBW,       triton::arch::x86::ID_INS_VPUNPCKLBW},
+        {triton::extlibs::capstone::X86_INS_VPUNPCKLDQ,       triton::arch::x86::ID_INS_VPUNPCKLDQ},
+        {triton::extlibs::capstone::X86_INS_VPUNPCKLQDQ,      triton::arch::x86::ID_INS_VPUNPCKLQDQ},
+        {triton::extlibs::capstone::X86_INS_VPUNPCKLWD,       triton::arch::x86::ID_INS_VPUNPCKLWD},
+        {triton::extlibs::capstone::X86_INS_VPXORD,           triton::arch::x86::ID_INS_VPXORD},
+        {triton::extlibs::capstone::X86_INS_VPXORQ,           triton::arch::x86::ID_INS_VPXORQ},
+        {triton::extlibs::capstone::X86_INS_VPXOR,            triton::arch::x86::ID_INS_VPXOR},
+        {triton::extlibs::capstone::X86_INS_VRCP14PD,         triton::arch::x86::ID_INS_VRCP14PD},
+        {triton::extlibs::capstone::X86_INS_VRCP14PS,         triton::arch::x86::ID_INS_VRCP14PS},
+        {triton::extlibs::capstone::X86_INS_VRCP14SD,         triton::arch::x86::ID_INS_VRCP14SD},
+        {triton::extlibs::capstone::X86_INS_VRCP14SS,         triton::arch::x86::ID_INS_VRCP14SS},
+        {triton::extlibs::capstone::X86_INS_VRCP28PD,         triton::arch::x86::ID_INS_VRCP28PD},
+        {triton::extlibs::capstone::X86_INS_VRCP28PS,         triton::arch::x86::ID_INS_VRCP28PS},
+        {triton::extlibs::capstone::X86_INS_VRCP28SD,         triton::arch::x86::ID_INS_VRCP28SD},
+        {triton::extlibs::capstone::X86_INS_VRCP28SS,         triton::arch::x86::ID_INS_VRCP28SS},
+        {triton::extlibs::capstone::X86_INS_VRCPPS,           triton::arch::x86::ID_INS_VRCPPS},
+        {triton::extlibs::capstone::X86_INS_VRCPSS,           triton::arch::x86::ID_INS_VRCPSS},
+        {triton::extlibs::capstone::X86_INS_VRNDSCALEPD,      triton::arch::x86::ID_INS_VRNDSCALEPD},
+        {triton::extlibs::capstone::X86_INS_VRNDSCALEPS,      triton::arch::x86::ID_INS_VRNDSCALEPS},
+        {triton::extlibs::capstone::X86_INS_VRNDSCALESD,      triton::arch::x86::ID_INS_VRNDSCALESD},
+        {triton::extlibs::capstone::X86_INS_VRNDSCALESS,      triton::arch::x86::ID_INS_VRNDSCALESS},
+        {triton::extlibs::capstone::X86_INS_VROUNDPD,         triton::arch::x86::ID_INS_VROUNDPD},
+        {triton::extlibs::capstone::X86_INS_VROUNDPS,         triton::arch::x86::ID_INS_VROUNDPS},
+        {triton::extlibs::capstone::X86_INS_VROUNDSD,         triton::arch::x86::ID_INS_VROUNDSD},
+        {triton::extlibs::capstone::X86_INS_VROUNDSS,         triton::arch::x86::ID_INS_VROUNDSS},
+        {triton::extlibs::capstone::X86_INS_VRSQRT14PD,       triton::arch::x86::ID_INS_VRSQRT14PD},
+        {triton::extlibs::capstone::X86_INS_VRSQRT14PS,       triton::arch::x86::ID_INS_VRSQRT14PS},
+        {triton::extlibs::capstone::X86_INS_VRSQRT14SD,       triton::arch::x86::ID_INS_VRSQRT14SD},
+        {triton::extlibs::capstone::X86_INS_VRSQRT14SS,       triton::arch::x86::ID_INS_VRSQRT14SS},
+        {triton::extlibs::capstone::X86_INS_VRSQRT28PD,       triton::arch::x86::ID_INS_VRSQRT28PD},
+        {triton::extlibs::capstone::X86_INS_VRSQRT28PS,       triton::arch::x86::ID_INS_VRSQRT28PS},
+        {triton::extlibs::capstone::X86_INS_VRSQRT28SD,       triton::arch::x86::ID_INS_VRSQRT28SD},
+        {triton::extlibs::capstone::X86_INS_VRSQRT28SS,       triton::arch::x86::ID_INS_VRSQRT28SS},
+        {triton::extlibs::capstone::X86_INS_VRSQRTPS,         triton::arch::x86::ID_INS_VRSQRTPS},
+        {triton::extlibs::capstone::X86_INS_VRSQRTSS,         triton::arch::x86::ID_INS_VRSQRTSS},
+        {triton::extlibs::capstone::X86_INS_VSCATTERDPD,      triton::arch::x86::ID_INS_VSCATTERDPD},
+        {triton::extlibs::capstone::X86_INS_VSCATTERDPS,      triton::arch::x86::ID_INS_VSCATTERDPS},
+        {triton::extlibs::capstone::X86_INS_VSCATTERPF0DPD,   triton::arch::x86::ID_INS_VSCATTERPF0DPD},
+        {triton::extlibs::capstone::X86_INS_VSCATTERPF0DPS,   triton::arch::x86::ID_INS_VSCATTERPF0DPS},
+        {triton::extlibs::capstone::X86_INS_VSCATTERPF0QPD,   triton::arch::x86::ID_INS_VSCATTERPF0QPD},
+        {triton::extlibs::capstone::X86_INS_VSCATTERPF0QPS,   triton::arch::x86::ID_INS_VSCATTERPF0QPS},
+        {triton::extlibs::capstone::X86_INS_VSCATTERPF1DPD,   triton::arch::x86::ID_INS_VSCATTERPF1DPD},
+        {triton::extlibs::capstone::X86_INS_VSCATTERPF1DPS,   triton::arch::x86::ID_INS_VSCATTERPF1DPS},
+        {triton::extlibs::capstone::X86_INS_VSCATTERPF1QPD,   triton::arch::x86::ID_INS_VSCATTERPF1QPD},
+        {triton::extlibs::capstone::X86_INS_VSCATTERPF1QPS,   triton::arch::x86::ID_INS_VSCATTERPF1QPS},
+        {triton::extlibs::capstone::X86_INS_VSCATTERQPD,      triton::arch::x86::ID_INS_VSCATTERQPD},
+        {triton::extlibs::capstone::X86_INS_VSCATTERQPS,      triton::arch::x86::ID_INS_VSCATTERQPS},
+        {triton::extlibs::capstone::X86_INS_VSHUFPD,          triton::arch::x86::ID_INS_VSHUFPD},
+        {triton::extlibs::capstone::X86_INS_VSHUFPS,          triton::arch::x86::ID_INS_VSHUFPS},
+        {triton::extlibs::capstone::X86_INS_VSQRTPD,          triton::arch::x86::ID_INS_VSQRTPD},
+        {triton::extlibs::capstone::X86_INS_VSQRTPS,          triton::arch::x86::ID_INS_VSQRTPS},
+        {triton::extlibs::capstone::X86_INS_VSQRTSD,          triton::arch::x86::ID_INS_VSQRTSD},
+        {triton::extlibs::capstone::X86_INS_VSQRTSS,          triton::arch::x86::ID_INS_VSQRTSS},
+        {triton::extlibs::capstone::X86_INS_VSTMXCSR,         triton::arch::x86::ID_INS_VSTMXCSR},
+        {triton::extlibs::capstone::X86_INS_VSUBPD,           triton::arch::x86::ID_INS_VSUBPD},
+        {triton::extlibs::capstone::X86_INS_VSUBPS,           triton::arch::x86::ID_INS_VSUBPS},
+        {triton::extlibs::capstone::X86_INS_VSUBSD,           triton::arch::x86::ID_INS_VSUBSD},
+        {triton::extlibs::capstone::X86_INS_VSUBSS,           triton::arch::x86::ID_INS_VSUBSS},
+        {triton::extlibs::capstone::X86_INS_VTESTPD,          triton::arch::x86::ID_INS_VTESTPD},
+        {triton::extlibs::capstone::X86_INS_VTESTPS,          triton::arch::x86::ID_INS_VTESTPS},
+        {triton::extlibs::capstone::X86_INS_VUNPCKHPD,        triton::arch::x86::ID_INS_VUNPCKHPD},
+        {triton::extlibs::capstone::X86_INS_VUNPCKHPS,        triton::arch::x86::ID_INS_VUNPCKHPS},
+        {triton::extlibs::capstone::X86_INS_VUNPCKLPD,        triton::arch::x86::ID_INS_VUNPCKLPD},
+        {triton::extlibs::capstone::X86_INS_VUNPCKLPS,        triton::arch::x86::ID_INS_VUNPCKLPS},
+        {triton::extlibs::capstone::X86_INS_VZEROALL,         triton::arch::x86::ID_INS_VZEROALL},
+        {triton::extlibs::capstone::X86_INS_VZEROUPPER,       triton::arch::x86::ID_INS_VZEROUPPER},
+        {triton::extlibs::capstone::X86_INS_WAIT,             triton::arch::x86::ID_INS_WAIT},
+        {triton::extlibs::capstone::X86_INS_WBINVD,           triton::arch::x86::ID_INS_WBINVD},
+        {triton::extlibs::capstone::X86_INS_WRFSBASE,         triton::arch::x86::ID_INS_WRFSBASE},
+        {triton::extlibs::capstone::X86_INS_WRGSBASE,         triton::arch::x86::ID_INS_WRGSBASE},
+        {triton::extlibs::capstone::X86_INS_WRMSR,            triton::arch::x86::ID_INS_WRMSR},
+        {triton::extlibs::capstone::X86_INS_XABORT,           triton::arch::x86::ID_INS_XABORT},
+        {triton::extlibs::capstone::X86_INS_XACQUIRE,         triton::arch::x86::ID_INS_XACQUIRE},
+        {triton::extlibs::capstone::X86_INS_XBEGIN,           triton::arch::x86::ID_INS_XBEGIN},
+        {triton::extlibs::capstone::X86_INS_XCHG,             triton::arch::x86::ID_INS_XCHG},
+        {triton::extlibs::capstone::X86_INS_FXCH,             triton::arch::x86::ID_INS_FXCH},
+        {triton::extlibs::capstone::X86_INS_XCRYPTCBC,        triton::arch::x86::ID_INS_XCRYPTCBC},
+        {triton::extlibs::capstone::X86_INS_XCRYPTCFB,        triton::arch::x86::ID_INS_XCRYPTCFB},
+        {triton::extlibs::capstone::X86_INS_XCRYPTCTR,        triton::arch::x86::ID_INS_XCRYPTCTR},
+        {triton::extlibs::capstone::X86_INS_XCRYPTECB,        triton::arch::x86::ID_INS_XCRYPTECB},
+        {triton::extlibs::capstone::X86_INS_XCRYPTOFB,        triton::arch::x86::ID_INS_XCRYPTOFB},
+        {triton::extlibs::capstone::X86_INS_XEND,             triton::arch::x86::ID_INS_XEND},
+        {triton::extlibs::capstone::X86_INS_XGETBV,           triton::arch::x86::ID_INS_XGETBV},
+        {triton::extlibs::capstone::X86_INS_XLATB,            triton::arch::x86::ID_INS_XLATB},
+        {triton::extlibs::capstone::X86_INS_XRELEASE,         triton::arch::x86::ID_INS_XRELEASE},
+        {triton::extlibs::capstone::X86_INS_XRSTOR,           triton::arch::x86::ID_INS_XRSTOR},
+        {triton::extlibs::capstone::X86_INS_XRSTOR64,         triton::arch::x86::ID_INS_XRSTOR64},
+        {triton::extlibs::capstone::X86_INS_XSAVE,            triton::arch::x86::ID_INS_XSAVE},
+        {triton::extlibs::capstone::X86_INS_XSAVE64,          triton::arch::x86::ID_INS_XSAVE64},
+        {triton::extlibs::capstone::X86_INS_XSAVEOPT,         triton::arch::x86::ID_INS_XSAVEOPT},
+        {triton::extlibs::capstone::X86_INS_XSAVEOPT64,       triton::arch::x86::ID_INS_XSAVEOPT64},
+        {triton::extlibs::capstone::X86_INS_XSETBV,           triton::arch::x86::ID_INS_XSETBV},
+        {triton::extlibs::capstone::X86_INS_XSHA1,            triton::arch::x86::ID_INS_XSHA1},
+        {triton::extlibs::capstone::X86_INS_XSHA256,          triton::arch::x86::ID_INS_XSHA256},
+        {triton::extlibs::capstone::X86_INS_XSTORE,           triton::arch::x86::ID_INS_XSTORE},
+        {triton::extlibs::capstone::X86_INS_XTEST,            triton::arch::x86::ID_INS_XTEST}
+      };
 
-          case triton::arch::x86::ID_REG_YMM10:
-            ret.setName("ymm10");
-            ret.setHigh(QQWORD_SIZE_BIT-1);
-            ret.setLow(0);
-            ret.setParentId(triton::arch::x86::ID_REG_YMM10);
-            break;
 
-          case triton::arch::x86::ID_REG_YMM11:
-            ret.setName("ymm11");
-            ret.setHigh(QQWORD_SIZE_BIT-1);
-            ret.setLow(0);
-            ret.setParentId(triton::arch::x86::ID_REG_YMM11);
-            break;
+      /* Returns a table indexed by capstone's id. Ids which are not in `pairs` are `invalid` */
+      template <triton::usize N>
+      static std::vector<triton::uint32> getCapstoneTable(const triton::uint32 (&pairs)[N][2], triton::usize size, triton::uint32 invalid) {
+        std::vector<triton::uint32> ret(size, invalid);
 
-          case triton::arch::x86::ID_REG_YMM12:
-            ret.setName("ymm12");
-            ret.setHigh(QQWORD_SIZE_BIT-1);
-            ret.setLow(0);
-            ret.setParentId(triton::arch::x86::ID_REG_YMM12);
-            break;
+        for (triton::usize index = 0; index < N; index++) {
+          if (pairs[index][0] < size)
+            ret[pairs[index][0]] = pairs[index][1];
+        }
 
-          case triton::arch::x86::ID_REG_YMM13:
-            ret.setName("ymm13");
-            ret.setHigh(QQWORD_SIZE_BIT-1);
-            ret.setLow(0);
-            ret.setParentId(triton::arch::x86::ID_REG_YMM13);
-            break;
+        return ret;
+      }
 
-          case triton::arch::x86::ID_REG_YMM14:
-            ret.setName("ymm14");
-            ret.setHigh(QQWORD_SIZE_BIT-1);
-            ret.setLow(0);
-            ret.setParentId(triton::arch::x86::ID_REG_YMM14);
-            break;
 
-          case triton::arch::x86::ID_REG_YMM15:
-            ret.setName("ymm15");
-            ret.setHigh(QQWORD_SIZE_BIT-1);
-            ret.setLow(0);
-            ret.setParentId(triton::arch::x86::ID_REG_YMM15);
-            break;
+      /* The dense tables used to translate the ids of the decoded instructions */
+      static const std::vector<triton::uint32> capstoneRegisterTable    = getCapstoneTable(capstoneRegisters, triton::extlibs::capstone::X86_REG_ENDING, triton::arch::x86::ID_REG_INVALID);
+      static const std::vector<triton::uint32> capstoneInstructionTable = getCapstoneTable(capstoneInstructions, triton::extlibs::capstone::X86_INS_ENDING, triton::arch::x86::ID_INST_INVALID);
 
-          case triton::arch::x86::ID_REG_ZMM0:
-            ret.setName("zmm0");
-            ret.setHigh(DQQWORD_SIZE_BIT-1);
-            ret.setLow(0);
-            ret.setParentId(triton::arch::x86::ID_REG_ZMM0);
-            break;
 
-          case triton::arch::x86::ID_REG_ZMM1:
-            ret.setName("zmm1");
-            ret.setHigh(DQQWORD_SIZE_BIT-1);
-            ret.setLow(0);
-            ret.setParentId(triton::arch::x86::ID_REG_ZMM1);
-            break;
+      x86Specifications::x86Specifications() {
+      }
 
-          case triton::arch::x86::ID_REG_ZMM2:
-            ret.setName("zmm2");
-            ret.setHigh(DQQWORD_SIZE_BIT-1);
-            ret.setLow(0);
-            ret.setParentId(triton::arch::x86::ID_REG_ZMM2);
-            break;
 
-          case triton::arch::x86::ID_REG_ZMM3:
-            ret.setName("zmm3");
-            ret.setHigh(DQQWORD_SIZE_BIT-1);
-            ret.setLow(0);
-            ret.setParentId(triton::arch::x86::ID_REG_ZMM3);
-            break;
+      x86Specifications::~x86Specifications() {
+      }
 
-          case triton::arch::x86::ID_REG_ZMM4:
-            ret.setName("zmm4");
-            ret.setHigh(DQQWORD_SIZE_BIT-1);
-            ret.setLow(0);
-            ret.setParentId(triton::arch::x86::ID_REG_ZMM4);
-            break;
 
-          case triton::arch::x86::ID_REG_ZMM5:
-            ret.setName("zmm5");
-            ret.setHigh(DQQWORD_SIZE_BIT-1);
-            ret.setLow(0);
-            ret.setParentId(triton::arch::x86::ID_REG_ZMM5);
-            break;
+      const triton::arch::RegisterSpecificationEntry& x86Specifications::getX86RegisterSpecificationEntry(triton::uint32 arch, triton::uint32 regId) const {
+        if (regId >= triton::arch::x86::ID_REG_LAST_ITEM)
+          regId = triton::arch::x86::ID_REG_INVALID;
 
-          case triton::arch::x86::ID_REG_ZMM6:
-            ret.setName("zmm6");
-            ret.setHigh(DQQWORD_SIZE_BIT-1);
-            ret.setLow(0);
-            ret.setParentId(triton::arch::x86::ID_REG_ZMM6);
-            break;
+        if (arch == triton::arch::ARCH_X86_64)
+          return x8664RegisterSpecifications[regId];
 
-          case triton::arch::x86::ID_REG_ZMM7:
-            ret.setName("zmm7");
-            ret.setHigh(DQQWORD_SIZE_BIT-1);
-            ret.setLow(0);
-            ret.setParentId(triton::arch::x86::ID_REG_ZMM7);
-            break;
+        if (arch == triton::arch::ARCH_X86)
+          return x86RegisterSpecifications[regId];
 
-          case triton::arch::x86::ID_REG_ZMM8:
-            ret.setName("zmm8");
-            ret.setHigh(DQQWORD_SIZE_BIT-1);
-            ret.setLow(0);
-            ret.setParentId(triton::arch::x86::ID_REG_ZMM8);
-            break;
+        return x86RegisterSpecifications[triton::arch::x86::ID_REG_INVALID];
+      }
 
-          case triton::arch::x86::ID_REG_ZMM9:
-            ret.setName("zmm9");
-            ret.setHigh(DQQWORD_SIZE_BIT-1);
-            ret.setLow(0);
-            ret.setParentId(triton::arch::x86::ID_REG_ZMM9);
-            break;
 
-          case triton::arch::x86::ID_REG_ZMM10:
-            ret.setName("zmm10");
-            ret.setHigh(DQQWORD_SIZE_BIT-1);
-            ret.setLow(0);
-            ret.setParentId(triton::arch::x86::ID_REG_ZMM10);
-            break;
+      triton::arch::RegisterSpecification x86Specifications::getX86RegisterSpecification(triton::uint32 arch, triton::uint32 regId) const {
+        return triton::arch::RegisterSpecification(this->getX86RegisterSpecificationEntry(arch, regId));
+      }
 
-          case triton::arch::x86::ID_REG_ZMM11:
-            ret.setName("zmm11");
-            ret.setHigh(DQQWORD_SIZE_BIT-1);
-            ret.setLow(0);
-            ret.setParentId(triton::arch::x86::ID_REG_ZMM11);
-            break;
 
-          case triton::arch::x86::ID_REG_ZMM12:
-            ret.setName("zmm12");
-            ret.setHigh(DQQWORD_SIZE_BIT-1);
-            ret.setLow(0);
-            ret.setParentId(triton::arch::x86::ID_REG_ZMM12);
-            break;
+      triton::uint32 x86Specifications::capstoneRegisterToTritonRegister(triton::uint32 id) const {
+        if (id >= capstoneRegisterTable.size())
+          return triton::arch::x86::ID_REG_INVALID;
+        return capstoneRegisterTable[id];
+      }
 
-          case triton::arch::x86::ID_REG_ZMM13:
-            ret.setName("zmm13");
-            ret.setHigh(DQQWORD_SIZE_BIT-1);
-            ret.setLow(0);
-            ret.setParentId(triton::arch::x86::ID_REG_ZMM13);
-            break;
 
-          case triton::arch::x86::ID_REG_ZMM14:
-            ret.setName("zmm14");
-            ret.setHigh(DQQWORD_SIZE_BIT-1);
-            ret.setLow(0);
-            ret.setParentId(triton::arch::x86::ID_REG_ZMM14);
-            break;
-
-          case triton::arch::x86::ID_REG_ZMM15:
-            ret.setName("zmm15");
-            ret.setHigh(DQQWORD_SIZE_BIT-1);
-            ret.setLow(0);
-            ret.setParentId(triton::arch::x86::ID_REG_ZMM15);
-            break;
-
-          case triton::arch::x86::ID_REG_ZMM16:
-            ret.setName("zmm16");
-            ret.setHigh(DQQWORD_SIZE_BIT-1);
-            ret.setLow(0);
-            ret.setParentId(triton::arch::x86::ID_REG_ZMM16);
-            break;
-
-          case triton::arch::x86::ID_REG_ZMM17:
-            ret.setName("zmm17");
-            ret.setHigh(DQQWORD_SIZE_BIT-1);
-            ret.setLow(0);
-            ret.setParentId(triton::arch::x86::ID_REG_ZMM17);
-            break;
-
-          case triton::arch::x86::ID_REG_ZMM18:
-            ret.setName("zmm18");
-            ret.setHigh(DQQWORD_SIZE_BIT-1);
-            ret.setLow(0);
-            ret.setParentId(triton::arch::x86::ID_REG_ZMM18);
-            break;
-
-          case triton::arch::x86::ID_REG_ZMM19:
-            ret.setName("zmm19");
-            ret.setHigh(DQQWORD_SIZE_BIT-1);
-            ret.setLow(0);
-            ret.setParentId(triton::arch::x86::ID_REG_ZMM19);
-            break;
-
-          case triton::arch::x86::ID_REG_ZMM20:
-            ret.setName("zmm20");
-            ret.setHigh(DQQWORD_SIZE_BIT-1);
-            ret.setLow(0);
-            ret.setParentId(triton::arch::x86::ID_REG_ZMM20);
-            break;
-
-          case triton::arch::x86::ID_REG_ZMM21:
-            ret.setName("zmm21");
-            ret.setHigh(DQQWORD_SIZE_BIT-1);
-            ret.setLow(0);
-            ret.setParentId(triton::arch::x86::ID_REG_ZMM21);
-            break;
-
-          case triton::arch::x86::ID_REG_ZMM22:
-            ret.setName("zmm22");
-            ret.setHigh(DQQWORD_SIZE_BIT-1);
-            ret.setLow(0);
-            ret.setParentId(triton::arch::x86::ID_REG_ZMM22);
-            break;
-
-          case triton::arch::x86::ID_REG_ZMM23:
-            ret.setName("zmm23");
-            ret.setHigh(DQQWORD_SIZE_BIT-1);
-            ret.setLow(0);
-            ret.setParentId(triton::arch::x86::ID_REG_ZMM23);
-            break;
-
-          case triton::arch::x86::ID_REG_ZMM24:
-            ret.setName("zmm24");
-            ret.setHigh(DQQWORD_SIZE_BIT-1);
-            ret.setLow(0);
-            ret.setParentId(triton::arch::x86::ID_REG_ZMM24);
-            break;
-
-          case triton::arch::x86::ID_REG_ZMM25:
-            ret.setName("zmm25");
-            ret.setHigh(DQQWORD_SIZE_BIT-1);
-            ret.setLow(0);
-            ret.setParentId(triton::arch::x86::ID_REG_ZMM25);
-            break;
-
-          case triton::arch::x86::ID_REG_ZMM26:
-            ret.setName("zmm26");
-            ret.setHigh(DQQWORD_SIZE_BIT-1);
-            ret.setLow(0);
-            ret.setParentId(triton::arch::x86::ID_REG_ZMM26);
-            break;
-
-          case triton::arch::x86::ID_REG_ZMM27:
-            ret.setName("zmm27");
-            ret.setHigh(DQQWORD_SIZE_BIT-1);
-            ret.setLow(0);
-            ret.setParentId(triton::arch::x86::ID_REG_ZMM27);
-            break;
-
-          case triton::arch::x86::ID_REG_ZMM28:
-            ret.setName("zmm28");
-            ret.setHigh(DQQWORD_SIZE_BIT-1);
-            ret.setLow(0);
-            ret.setParentId(triton::arch::x86::ID_REG_ZMM28);
-            break;
-
-          case triton::arch::x86::ID_REG_ZMM29:
-            ret.setName("zmm29");
-            ret.setHigh(DQQWORD_SIZE_BIT-1);
-            ret.setLow(0);
-            ret.setParentId(triton::arch::x86::ID_REG_ZMM29);
-            break;
-
-          case triton::arch::x86::ID_REG_ZMM30:
-            ret.setName("zmm30");
-            ret.setHigh(DQQWORD_SIZE_BIT-1);
-            ret.setLow(0);
-            ret.setParentId(triton::arch::x86::ID_REG_ZMM30);
-            break;
-
-          case triton::arch::x86::ID_REG_ZMM31:
-            ret.setName("zmm31");
-            ret.setHigh(DQQWORD_SIZE_BIT-1);
-            ret.setLow(0);
-            ret.setParentId(triton::arch::x86::ID_REG_ZMM31);
-            break;
-
-          case triton::arch::x86::ID_REG_MXCSR:
-            ret.setName("mxcsr");
-            ret.setHigh((arch == triton::arch::ARCH_X86_64) ? QWORD_SIZE_BIT-1 : DWORD_SIZE_BIT-1);
-            ret.setLow(0);
-            ret.setParentId(triton::arch::x86::ID_REG_MXCSR);
-            break;
-
-          case triton::arch::x86::ID_REG_CR0:
-            ret.setName("cr0");
-            ret.setHigh((arch == triton::arch::ARCH_X86_64) ? QWORD_SIZE_BIT-1 : DWORD_SIZE_BIT-1);
-            ret.setLow(0);
-            ret.setParentId(triton::arch::x86::ID_REG_CR0);
-            break;
-
-          case triton::arch::x86::ID_REG_CR1:
-            ret.setName("cr1");
-            ret.setHigh((arch == triton::arch::ARCH_X86_64) ? QWORD_SIZE_BIT-1 : DWORD_SIZE_BIT-1);
-            ret.setLow(0);
-            ret.setParentId(triton::arch::x86::ID_REG_CR1);
-            break;
-
-          case triton::arch::x86::ID_REG_CR2:
-            ret.setName("cr2");
-            ret.setHigh((arch == triton::arch::ARCH_X86_64) ? QWORD_SIZE_BIT-1 : DWORD_SIZE_BIT-1);
-            ret.setLow(0);
-            ret.setParentId(triton::arch::x86::ID_REG_CR2);
-            break;
-
-          case triton::arch::x86::ID_REG_CR3:
-            ret.setName("cr3");
-            ret.setHigh((arch == triton::arch::ARCH_X86_64) ? QWORD_SIZE_BIT-1 : DWORD_SIZE_BIT-1);
-            ret.setLow(0);
-            ret.setParentId(triton::arch::x86::ID_REG_CR3);
-            break;
-
-          case triton::arch::x86::ID_REG_CR4:
-            ret.setName("cr4");
-            ret.setHigh((arch == triton::arch::ARCH_X86_64) ? QWORD_SIZE_BIT-1 : DWORD_SIZE_BIT-1);
-            ret.setLow(0);
-            ret.setParentId(triton::arch::x86::ID_REG_CR4);
-            break;
-
-          case triton::arch::x86::ID_REG_CR5:
-            ret.setName("cr5");
-            ret.setHigh((arch == triton::arch::ARCH_X86_64) ? QWORD_SIZE_BIT-1 : DWORD_SIZE_BIT-1);
-            ret.setLow(0);
-            ret.setParentId(triton::arch::x86::ID_REG_CR5);
-            break;
-
-          case triton::arch::x86::ID_REG_CR6:
-            ret.setName("cr6");
-            ret.setHigh((arch == triton::arch::ARCH_X86_64) ? QWORD_SIZE_BIT-1 : DWORD_SIZE_BIT-1);
-            ret.setLow(0);
-            ret.setParentId(triton::arch::x86::ID_REG_CR6);
-            break;
-
-          case triton::arch::x86::ID_REG_CR7:
-            ret.setName("cr7");
-            ret.setHigh((arch == triton::arch::ARCH_X86_64) ? QWORD_SIZE_BIT-1 : DWORD_SIZE_BIT-1);
-            ret.setLow(0);
-            ret.setParentId(triton::arch::x86::ID_REG_CR7);
-            break;
-
-          case triton::arch::x86::ID_REG_CR8:
-            ret.setName("cr8");
-            ret.setHigh((arch == triton::arch::ARCH_X86_64) ? QWORD_SIZE_BIT-1 : DWORD_SIZE_BIT-1);
-            ret.setLow(0);
-            ret.setParentId(triton::arch::x86::ID_REG_CR8);
-            break;
-
-          case triton::arch::x86::ID_REG_CR9:
-            ret.setName("cr9");
-            ret.setHigh((arch == triton::arch::ARCH_X86_64) ? QWORD_SIZE_BIT-1 : DWORD_SIZE_BIT-1);
-            ret.setLow(0);
-            ret.setParentId(triton::arch::x86::ID_REG_CR9);
-            break;
-
-          case triton::arch::x86::ID_REG_CR10:
-            ret.setName("cr10");
-            ret.setHigh((arch == triton::arch::ARCH_X86_64) ? QWORD_SIZE_BIT-1 : DWORD_SIZE_BIT-1);
-            ret.setLow(0);
-            ret.setParentId(triton::arch::x86::ID_REG_CR10);
-            break;
-
-          case triton::arch::x86::ID_REG_CR11:
-            ret.setName("cr11");
-            ret.setHigh((arch == triton::arch::ARCH_X86_64) ? QWORD_SIZE_BIT-1 : DWORD_SIZE_BIT-1);
-            ret.setLow(0);
-            ret.setParentId(triton::arch::x86::ID_REG_CR11);
-            break;
-
-          case triton::arch::x86::ID_REG_CR12:
-            ret.setName("cr12");
-            ret.setHigh((arch == triton::arch::ARCH_X86_64) ? QWORD_SIZE_BIT-1 : DWORD_SIZE_BIT-1);
-            ret.setLow(0);
-            ret.setParentId(triton::arch::x86::ID_REG_CR12);
-            break;
-
-          case triton::arch::x86::ID_REG_CR13:
-            ret.setName("cr13");
-            ret.setHigh((arch == triton::arch::ARCH_X86_64) ? QWORD_SIZE_BIT-1 : DWORD_SIZE_BIT-1);
-            ret.setLow(0);
-            ret.setParentId(triton::arch::x86::ID_REG_CR13);
-            break;
-
-          case triton::arch::x86::ID_REG_CR14:
-            ret.setName("cr14");
-            ret.setHigh((arch == triton::arch::ARCH_X86_64) ? QWORD_SIZE_BIT-1 : DWORD_SIZE_BIT-1);
-            ret.setLow(0);
-            ret.setParentId(triton::arch::x86::ID_REG_CR14);
-            break;
-
-          case triton::arch::x86::ID_REG_CR15:
-            ret.setName("cr15");
-            ret.setHigh((arch == triton::arch::ARCH_X86_64) ? QWORD_SIZE_BIT-1 : DWORD_SIZE_BIT-1);
-            ret.setLow(0);
-            ret.setParentId(triton::arch::x86::ID_REG_CR15);
-            break;
-
-          case triton::arch::x86::ID_REG_IE:
-            ret.setName("ie");
-            ret.setHigh(0);
-            ret.setLow(0);
-            ret.setParentId(triton::arch::x86::ID_REG_IE);
-            break;
-
-          case triton::arch::x86::ID_REG_DE:
-            ret.setName("de");
-            ret.setHigh(0);
-            ret.setLow(0);
-            ret.setParentId(triton::arch::x86::ID_REG_DE);
-            break;
-
-          case triton::arch::x86::ID_REG_ZE:
-            ret.setName("ze");
-            ret.setHigh(0);
-            ret.setLow(0);
-            ret.setParentId(triton::arch::x86::ID_REG_ZE);
-            break;
-
-          case triton::arch::x86::ID_REG_OE:
-            ret.setName("oe");
-            ret.setHigh(0);
-            ret.setLow(0);
-            ret.setParentId(triton::arch::x86::ID_REG_OE);
-            break;
-
-          case triton::arch::x86::ID_REG_UE:
-            ret.setName("ue");
-            ret.setHigh(0);
-            ret.setLow(0);
-            ret.setParentId(triton::arch::x86::ID_REG_UE);
-            break;
-
-          case triton::arch::x86::ID_REG_PE:
-            ret.setName("pe");
-            ret.setHigh(0);
-            ret.setLow(0);
-            ret.setParentId(triton::arch::x86::ID_REG_PE);
-            break;
-
-          case triton::arch::x86::ID_REG_DAZ:
-            ret.setName("da");
-            ret.setHigh(0);
-            ret.setLow(0);
-            ret.setParentId(triton::arch::x86::ID_REG_DAZ);
-            break;
-
-          case triton::arch::x86::ID_REG_IM:
-            ret.setName("im");
-            ret.setHigh(0);
-            ret.setLow(0);
-            ret.setParentId(triton::arch::x86::ID_REG_IM);
-            break;
-
-          case triton::arch::x86::ID_REG_DM:
-            ret.setName("dm");
-            ret.setHigh(0);
-            ret.setLow(0);
-            ret.setParentId(triton::arch::x86::ID_REG_DM);
-            break;
-
-          case triton::arch::x86::ID_REG_ZM:
-            ret.setName("zm");
-            ret.setHigh(0);
-            ret.setLow(0);
-            ret.setParentId(triton::arch::x86::ID_REG_ZM);
-            break;
-
-          case triton::arch::x86::ID_REG_OM:
-            ret.setName("om");
-            ret.setHigh(0);
-            ret.setLow(0);
-            ret.setParentId(triton::arch::x86::ID_REG_OM);
-            break;
-
-          case triton::arch::x86::ID_REG_UM:
-            ret.setName("um");
-            ret.setHigh(0);
-            ret.setLow(0);
-            ret.setParentId(triton::arch::x86::ID_REG_UM);
-            break;
-
-          case triton::arch::x86::ID_REG_PM:
-            ret.setName("pm");
-            ret.setHigh(0);
-            ret.setLow(0);
-            ret.setParentId(triton::arch::x86::ID_REG_PM);
-            break;
-
-          case triton::arch::x86::ID_REG_RL:
-            ret.setName("rl");
-            ret.setHigh(0);
-            ret.setLow(0);
-            ret.setParentId(triton::arch::x86::ID_REG_RL);
-            break;
-
-          case triton::arch::x86::ID_REG_RH:
-            ret.setName("rh");
-            ret.setHigh(0);
-            ret.setLow(0);
-            ret.setParentId(triton::arch::x86::ID_REG_RH);
-            break;
-
-          case triton::arch::x86::ID_REG_FZ:
-            ret.setName("fz");
-            ret.setHigh(0);
-            ret.setLow(0);
-            ret.setParentId(triton::arch::x86::ID_REG_FZ);
-            break;
-
-          case triton::arch::x86::ID_REG_AF:
-            ret.setName("af");
-            ret.setHigh(0);
-            ret.setLow(0);
-            ret.setParentId(triton::arch::x86::ID_REG_AF);
-            break;
-
-          case triton::arch::x86::ID_REG_CF:
-            ret.setName("cf");
-            ret.setHigh(0);
-            ret.setLow(0);
-            ret.setParentId(triton::arch::x86::ID_REG_CF);
-            break;
-
-          case triton::arch::x86::ID_REG_DF:
-            ret.setName("df");
-            ret.setHigh(0);
-            ret.setLow(0);
-            ret.setParentId(triton::arch::x86::ID_REG_DF);
-            break;
-
-          case triton::arch::x86::ID_REG_IF:
-            ret.setName("if");
-            ret.setHigh(0);
-            ret.setLow(0);
-            ret.setParentId(triton::arch::x86::ID_REG_IF);
-            break;
-
-          case triton::arch::x86::ID_REG_OF:
-            ret.setName("of");
-            ret.setHigh(0);
-            ret.setLow(0);
-            ret.setParentId(triton::arch::x86::ID_REG_OF);
-            break;
-
-          case triton::arch::x86::ID_REG_PF:
-            ret.setName("pf");
-            ret.setHigh(0);
-            ret.setLow(0);
-            ret.setParentId(triton::arch::x86::ID_REG_PF);
-            break;
-
-          case triton::arch::x86::ID_REG_SF:
-            ret.setName("sf");
-            ret.setHigh(0);
-            ret.setLow(0);
-            ret.setParentId(triton::arch::x86::ID_REG_SF);
-            break;
-
-          case triton::arch::x86::ID_REG_TF:
-            ret.setName("tf");
-            ret.setHigh(0);
-            ret.setLow(0);
-            ret.setParentId(triton::arch::x86::ID_REG_TF);
-            break;
-
-          case triton::arch::x86::ID_REG_ZF:
-            ret.setName("zf");
-            ret.setHigh(0);
-            ret.setLow(0);
-            ret.setParentId(triton::arch::x86::ID_REG_ZF);
-            break;
-
-          case triton::arch::x86::ID_REG_CS:
-            ret.setName("cs");
-            ret.setHigh((arch == triton::arch::ARCH_X86_64) ? QWORD_SIZE_BIT-1 : DWORD_SIZE_BIT-1);
-            ret.setLow(0);
-            ret.setParentId(triton::arch::x86::ID_REG_CS);
-            break;
-
-          case triton::arch::x86::ID_REG_DS:
-            ret.setName("ds");
-            ret.setHigh((arch == triton::arch::ARCH_X86_64) ? QWORD_SIZE_BIT-1 : DWORD_SIZE_BIT-1);
-            ret.setLow(0);
-            ret.setParentId(triton::arch::x86::ID_REG_DS);
-            break;
-
-          case triton::arch::x86::ID_REG_ES:
-            ret.setName("es");
-            ret.setHigh((arch == triton::arch::ARCH_X86_64) ? QWORD_SIZE_BIT-1 : DWORD_SIZE_BIT-1);
-            ret.setLow(0);
-            ret.setParentId(triton::arch::x86::ID_REG_ES);
-            break;
-
-          case triton::arch::x86::ID_REG_FS:
-            ret.setName("fs");
-            ret.setHigh((arch == triton::arch::ARCH_X86_64) ? QWORD_SIZE_BIT-1 : DWORD_SIZE_BIT-1);
-            ret.setLow(0);
-            ret.setParentId(triton::arch::x86::ID_REG_FS);
-            break;
-
-          case triton::arch::x86::ID_REG_GS:
-            ret.setName("gs");
-            ret.setHigh((arch == triton::arch::ARCH_X86_64) ? QWORD_SIZE_BIT-1 : DWORD_SIZE_BIT-1);
-            ret.setLow(0);
-            ret.setParentId(triton::arch::x86::ID_REG_GS);
-            break;
-
-          case triton::arch::x86::ID_REG_SS:
-            ret.setName("ss");
-            ret.setHigh((arch == triton::arch::ARCH_X86_64) ? QWORD_SIZE_BIT-1 : DWORD_SIZE_BIT-1);
-            ret.setLow(0);
-            ret.setParentId(triton::arch::x86::ID_REG_SS);
-            break;
-
-        }
-        return ret;
-      }
-
-
-      triton::uint32 x86Specifications::capstoneRegisterToTritonRegister(triton::uint32 id) const {
-        triton::uint32 tritonId = triton::arch::x86::ID_REG_INVALID;
-
-        switch (id) {
-
-          case triton::extlibs::capstone::X86_REG_RAX:
-            tritonId = triton::arch::x86::ID_REG_RAX;
-            break;
-
-          case triton::extlibs::capstone::X86_REG_EAX:
-            tritonId = triton::arch::x86::ID_REG_EAX;
-            break;
-
-          case triton::extlibs::capstone::X86_REG_AX:
-            tritonId = triton::arch::x86::ID_REG_AX;
-            break;
-
-          case triton::extlibs::capstone::X86_REG_AH:
-            tritonId = triton::arch::x86::ID_REG_AH;
-            break;
-
-          case triton::extlibs::capstone::X86_REG_AL:
-            tritonId = triton::arch::x86::ID_REG_AL;
-            break;
-
-          case triton::extlibs::capstone::X86_REG_RBX:
-            tritonId = triton::arch::x86::ID_REG_RBX;
-            break;
-
-          case triton::extlibs::capstone::X86_REG_EBX:
-            tritonId = triton::arch::x86::ID_REG_EBX;
-            break;
-
-          case triton::extlibs::capstone::X86_REG_BX:
-            tritonId = triton::arch::x86::ID_REG_BX;
-            break;
-
-          case triton::extlibs::capstone::X86_REG_BH:
-            tritonId = triton::arch::x86::ID_REG_BH;
-            break;
-
-          case triton::extlibs::capstone::X86_REG_BL:
-            tritonId = triton::arch::x86::ID_REG_BL;
-            break;
-
-          case triton::extlibs::capstone::X86_REG_RCX:
-            tritonId = triton::arch::x86::ID_REG_RCX;
-            break;
-
-          case triton::extlibs::capstone::X86_REG_ECX:
-            tritonId = triton::arch::x86::ID_REG_ECX;
-            break;
-
-          case triton::extlibs::capstone::X86_REG_CX:
-            tritonId = triton::arch::x86::ID_REG_CX;
-            break;
-
-          case triton::extlibs::capstone::X86_REG_CH:
-            tritonId = triton::arch::x86::ID_REG_CH;
-            break;
-
-          case triton::extlibs::capstone::X86_REG_CL:
-            tritonId = triton::arch::x86::ID_REG_CL;
-            break;
-
-          case triton::extlibs::capstone::X86_REG_RDX:
-            tritonId = triton::arch::x86::ID_REG_RDX;
-            break;
-
-          case triton::extlibs::capstone::X86_REG_EDX:
-            tritonId = triton::arch::x86::ID_REG_EDX;
-            break;
-
-          case triton::extlibs::capstone::X86_REG_DX:
-            tritonId = triton::arch::x86::ID_REG_DX;
-            break;
-
-          case triton::extlibs::capstone::X86_REG_DH:
-            tritonId = triton::arch::x86::ID_REG_DH;
-            break;
-
-          case triton::extlibs::capstone::X86_REG_DL:
-            tritonId = triton::arch::x86::ID_REG_DL;
-            break;
-
-          case triton::extlibs::capstone::X86_REG_RDI:
-            tritonId = triton::arch::x86::ID_REG_RDI;
-            break;
-
-          case triton::extlibs::capstone::X86_REG_EDI:
-            tritonId = triton::arch::x86::ID_REG_EDI;
-            break;
-
-          case triton::extlibs::capstone::X86_REG_DI:
-            tritonId = triton::arch::x86::ID_REG_DI;
-            break;
-
-          case triton::extlibs::capstone::X86_REG_DIL:
-            tritonId = triton::arch::x86::ID_REG_DIL;
-            break;
-
-          case triton::extlibs::capstone::X86_REG_RSI:
-            tritonId = triton::arch::x86::ID_REG_RSI;
-            break;
-
-          case triton::extlibs::capstone::X86_REG_ESI:
-            tritonId = triton::arch::x86::ID_REG_ESI;
-            break;
-
-          case triton::extlibs::capstone::X86_REG_SI:
-            tritonId = triton::arch::x86::ID_REG_SI;
-            break;
-
-          case triton::extlibs::capstone::X86_REG_SIL:
-            tritonId = triton::arch::x86::ID_REG_SIL;
-            break;
-
-          case triton::extlibs::capstone::X86_REG_RBP:
-            tritonId = triton::arch::x86::ID_REG_RBP;
-            break;
-
-          case triton::extlibs::capstone::X86_REG_EBP:
-            tritonId = triton::arch::x86::ID_REG_EBP;
-            break;
-
-          case triton::extlibs::capstone::X86_REG_BP:
-            tritonId = triton::arch::x86::ID_REG_BP;
-            break;
-
-          case triton::extlibs::capstone::X86_REG_BPL:
-            tritonId = triton::arch::x86::ID_REG_BPL;
-            break;
-
-          case triton::extlibs::capstone::X86_REG_RSP:
-            tritonId = triton::arch::x86::ID_REG_RSP;
-            break;
-
-          case triton::extlibs::capstone::X86_REG_ESP:
-            tritonId = triton::arch::x86::ID_REG_ESP;
-            break;
-
-          case triton::extlibs::capstone::X86_REG_SP:
-            tritonId = triton::arch::x86::ID_REG_SP;
-            break;
-
-          case triton::extlibs::capstone::X86_REG_SPL:
-            tritonId = triton::arch::x86::ID_REG_SPL;
-            break;
-
-          case triton::extlibs::capstone::X86_REG_RIP:
-            tritonId = triton::arch::x86::ID_REG_RIP;
-            break;
-
-          case triton::extlibs::capstone::X86_REG_EIP:
-            tritonId = triton::arch::x86::ID_REG_EIP;
-            break;
-
-          case triton::extlibs::capstone::X86_REG_IP:
-            tritonId = triton::arch::x86::ID_REG_IP;
-            break;
-
-          case triton::extlibs::capstone::X86_REG_EFLAGS:
-            tritonId = triton::arch::x86::ID_REG_EFLAGS;
-            break;
-
-          case triton::extlibs::capstone::X86_REG_R8:
-            tritonId = triton::arch::x86::ID_REG_R8;
-            break;
-
-          case triton::extlibs::capstone::X86_REG_R8D:
-            tritonId = triton::arch::x86::ID_REG_R8D;
-            break;
-
-          case triton::extlibs::capstone::X86_REG_R8W:
-            tritonId = triton::arch::x86::ID_REG_R8W;
-            break;
-
-          case triton::extlibs::capstone::X86_REG_R8B:
-            tritonId = triton::arch::x86::ID_REG_R8B;
-            break;
-
-          case triton::extlibs::capstone::X86_REG_R9:
-            tritonId = triton::arch::x86::ID_REG_R9;
-            break;
-
-          case triton::extlibs::capstone::X86_REG_R9D:
-            tritonId = triton::arch::x86::ID_REG_R9D;
-            break;
-
-          case triton::extlibs::capstone::X86_REG_R9W:
-            tritonId = triton::arch::x86::ID_REG_R9W;
-            break;
-
-          case triton::extlibs::capstone::X86_REG_R9B:
-            tritonId = triton::arch::x86::ID_REG_R9B;
-            break;
-
-          case triton::extlibs::capstone::X86_REG_R10:
-            tritonId = triton::arch::x86::ID_REG_R10;
-            break;
-
-          case triton::extlibs::capstone::X86_REG_R10D:
-            tritonId = triton::arch::x86::ID_REG_R10D;
-            break;
-
-          case triton::extlibs::capstone::X86_REG_R10W:
-            tritonId = triton::arch::x86::ID_REG_R10W;
-            break;
-
-          case triton::extlibs::capstone::X86_REG_R10B:
-            tritonId = triton::arch::x86::ID_REG_R10B;
-            break;
-
-          case triton::extlibs::capstone::X86_REG_R11:
-            tritonId = triton::arch::x86::ID_REG_R11;
-            break;
-
-          case triton::extlibs::capstone::X86_REG_R11D:
-            tritonId = triton::arch::x86::ID_REG_R11D;
-            break;
-
-          case triton::extlibs::capstone::X86_REG_R11W:
-            tritonId = triton::arch::x86::ID_REG_R11W;
-            break;
-
-          case triton::extlibs::capstone::X86_REG_R11B:
-            tritonId = triton::arch::x86::ID_REG_R11B;
-            break;
-
-          case triton::extlibs::capstone::X86_REG_R12:
-            tritonId = triton::arch::x86::ID_REG_R12;
-            break;
-
-          case triton::extlibs::capstone::X86_REG_R12D:
-            tritonId = triton::arch::x86::ID_REG_R12D;
-            break;
-
-          case triton::extlibs::capstone::X86_REG_R12W:
-            tritonId = triton::arch::x86::ID_REG_R12W;
-            break;
-
-          case triton::extlibs::capstone::X86_REG_R12B:
-            tritonId = triton::arch::x86::ID_REG_R12B;
-            break;
-
-          case triton::extlibs::capstone::X86_REG_R13:
-            tritonId = triton::arch::x86::ID_REG_R13;
-            break;
-
-          case triton::extlibs::capstone::X86_REG_R13D:
-            tritonId = triton::arch::x86::ID_REG_R13D;
-            break;
-
-          case triton::extlibs::capstone::X86_REG_R13W:
-            tritonId = triton::arch::x86::ID_REG_R13W;
-            break;
-
-          case triton::extlibs::capstone::X86_REG_R13B:
-            tritonId = triton::arch::x86::ID_REG_R13B;
-            break;
-
-          case triton::extlibs::capstone::X86_REG_R14:
-            tritonId = triton::arch::x86::ID_REG_R14;
-            break;
-
-          case triton::extlibs::capstone::X86_REG_R14D:
-            tritonId = triton::arch::x86::ID_REG_R14D;
-            break;
-
-          case triton::extlibs::capstone::X86_REG_R14W:
-            tritonId = triton::arch::x86::ID_REG_R14W;
-            break;
-
-          case triton::extlibs::capstone::X86_REG_R14B:
-            tritonId = triton::arch::x86::ID_REG_R14B;
-            break;
-
-          case triton::extlibs::capstone::X86_REG_R15:
-            tritonId = triton::arch::x86::ID_REG_R15;
-            break;
-
-          case triton::extlibs::capstone::X86_REG_R15D:
-            tritonId = triton::arch::x86::ID_REG_R15D;
-            break;
-
-          case triton::extlibs::capstone::X86_REG_R15W:
-            tritonId = triton::arch::x86::ID_REG_R15W;
-            break;
-
-          case triton::extlibs::capstone::X86_REG_R15B:
-            tritonId = triton::arch::x86::ID_REG_R15B;
-            break;
-
-          case triton::extlibs::capstone::X86_REG_MM0:
-            tritonId = triton::arch::x86::ID_REG_MM0;
-            break;
-
-          case triton::extlibs::capstone::X86_REG_MM1:
-            tritonId = triton::arch::x86::ID_REG_MM1;
-            break;
-
-          case triton::extlibs::capstone::X86_REG_MM2:
-            tritonId = triton::arch::x86::ID_REG_MM2;
-            break;
-
-          case triton::extlibs::capstone::X86_REG_MM3:
-            tritonId = triton::arch::x86::ID_REG_MM3;
-            break;
-
-          case triton::extlibs::capstone::X86_REG_MM4:
-            tritonId = triton::arch::x86::ID_REG_MM4;
-            break;
-
-          case triton::extlibs::capstone::X86_REG_MM5:
-            tritonId = triton::arch::x86::ID_REG_MM5;
-            break;
-
-          case triton::extlibs::capstone::X86_REG_MM6:
-            tritonId = triton::arch::x86::ID_REG_MM6;
-            break;
-
-          case triton::extlibs::capstone::X86_REG_MM7:
-            tritonId = triton::arch::x86::ID_REG_MM7;
-            break;
-
-          case triton::extlibs::capstone::X86_REG_XMM0:
-            tritonId = triton::arch::x86::ID_REG_XMM0;
-            break;
-
-          case triton::extlibs::capstone::X86_REG_XMM1:
-            tritonId = triton::arch::x86::ID_REG_XMM1;
-            break;
-
-          case triton::extlibs::capstone::X86_REG_XMM2:
-            tritonId = triton::arch::x86::ID_REG_XMM2;
-            break;
-
-          case triton::extlibs::capstone::X86_REG_XMM3:
-            tritonId = triton::arch::x86::ID_REG_XMM3;
-            break;
-
-          case triton::extlibs::capstone::X86_REG_XMM4:
-            tritonId = triton::arch::x86::ID_REG_XMM4;
-            break;
-
-          case triton::extlibs::capstone::X86_REG_XMM5:
-            tritonId = triton::arch::x86::ID_REG_XMM5;
-            break;
-
-          case triton::extlibs::capstone::X86_REG_XMM6:
-            tritonId = triton::arch::x86::ID_REG_XMM6;
-            break;
-
-          case triton::extlibs::capstone::X86_REG_XMM7:
-            tritonId = triton::arch::x86::ID_REG_XMM7;
-            break;
-
-          case triton::extlibs::capstone::X86_REG_XMM8:
-            tritonId = triton::arch::x86::ID_REG_XMM8;
-            break;
-
-          case triton::extlibs::capstone::X86_REG_XMM9:
-            tritonId = triton::arch::x86::ID_REG_XMM9;
-            break;
-
-          case triton::extlibs::capstone::X86_REG_XMM10:
-            tritonId = triton::arch::x86::ID_REG_XMM10;
-            break;
-
-          case triton::extlibs::capstone::X86_REG_XMM11:
-            tritonId = triton::arch::x86::ID_REG_XMM11;
-            break;
-
-          case triton::extlibs::capstone::X86_REG_XMM12:
-            tritonId = triton::arch::x86::ID_REG_XMM12;
-            break;
-
-          case triton::extlibs::capstone::X86_REG_XMM13:
-            tritonId = triton::arch::x86::ID_REG_XMM13;
-            break;
-
-          case triton::extlibs::capstone::X86_REG_XMM14:
-            tritonId = triton::arch::x86::ID_REG_XMM14;
-            break;
-
-          case triton::extlibs::capstone::X86_REG_XMM15:
-            tritonId = triton::arch::x86::ID_REG_XMM15;
-            break;
-
-          case triton::extlibs::capstone::X86_REG_YMM0:
-            tritonId = triton::arch::x86::ID_REG_YMM0;
-            break;
-
-          case triton::extlibs::capstone::X86_REG_YMM1:
-            tritonId = triton::arch::x86::ID_REG_YMM1;
-            break;
-
-          case triton::extlibs::capstone::X86_REG_YMM2:
-            tritonId = triton::arch::x86::ID_REG_YMM2;
-            break;
-
-          case triton::extlibs::capstone::X86_REG_YMM3:
-            tritonId = triton::arch::x86::ID_REG_YMM3;
-            break;
-
-          case triton::extlibs::capstone::X86_REG_YMM4:
-            tritonId = triton::arch::x86::ID_REG_YMM4;
-            break;
-
-          case triton::extlibs::capstone::X86_REG_YMM5:
-            tritonId = triton::arch::x86::ID_REG_YMM5;
-            break;
-
-          case triton::extlibs::capstone::X86_REG_YMM6:
-            tritonId = triton::arch::x86::ID_REG_YMM6;
-            break;
-
-          case triton::extlibs::capstone::X86_REG_YMM7:
-            tritonId = triton::arch::x86::ID_REG_YMM7;
-            break;
-
-          case triton::extlibs::capstone::X86_REG_YMM8:
-            tritonId = triton::arch::x86::ID_REG_YMM8;
-            break;
-
-          case triton::extlibs::capstone::X86_REG_YMM9:
-            tritonId = triton::arch::x86::ID_REG_YMM9;
-            break;
-
-          case triton::extlibs::capstone::X86_REG_YMM10:
-            tritonId = triton::arch::x86::ID_REG_YMM10;
-            break;
-
-          case triton::extlibs::capstone::X86_REG_YMM11:
-            tritonId = triton::arch::x86::ID_REG_YMM11;
-            break;
-
-          case triton::extlibs::capstone::X86_REG_YMM12:
-            tritonId = triton::arch::x86::ID_REG_YMM12;
-            break;
-
-          case triton::extlibs::capstone::X86_REG_YMM13:
-            tritonId = triton::arch::x86::ID_REG_YMM13;
-            break;
-
-          case triton::extlibs::capstone::X86_REG_YMM14:
-            tritonId = triton::arch::x86::ID_REG_YMM14;
-            break;
-
-          case triton::extlibs::capstone::X86_REG_YMM15:
-            tritonId = triton::arch::x86::ID_REG_YMM15;
-            break;
-
-          case triton::extlibs::capstone::X86_REG_ZMM0:
-            tritonId = triton::arch::x86::ID_REG_ZMM0;
-            break;
-
-          case triton::extlibs::capstone::X86_REG_ZMM1:
-            tritonId = triton::arch::x86::ID_REG_ZMM1;
-            break;
-
-          case triton::extlibs::capstone::X86_REG_ZMM2:
-            tritonId = triton::arch::x86::ID_REG_ZMM2;
-            break;
-
-          case triton::extlibs::capstone::X86_REG_ZMM3:
-            tritonId = triton::arch::x86::ID_REG_ZMM3;
-            break;
-
-          case triton::extlibs::capstone::X86_REG_ZMM4:
-            tritonId = triton::arch::x86::ID_REG_ZMM4;
-            break;
-
-          case triton::extlibs::capstone::X86_REG_ZMM5:
-            tritonId = triton::arch::x86::ID_REG_ZMM5;
-            break;
-
-          case triton::extlibs::capstone::X86_REG_ZMM6:
-            tritonId = triton::arch::x86::ID_REG_ZMM6;
-            break;
-
-          case triton::extlibs::capstone::X86_REG_ZMM7:
-            tritonId = triton::arch::x86::ID_REG_ZMM7;
-            break;
-
-          case triton::extlibs::capstone::X86_REG_ZMM8:
-            tritonId = triton::arch::x86::ID_REG_ZMM8;
-            break;
-
-          case triton::extlibs::capstone::X86_REG_ZMM9:
-            tritonId = triton::arch::x86::ID_REG_ZMM9;
-            break;
-
-          case triton::extlibs::capstone::X86_REG_ZMM10:
-            tritonId = triton::arch::x86::ID_REG_ZMM10;
-            break;
-
-          case triton::extlibs::capstone::X86_REG_ZMM11:
-            tritonId = triton::arch::x86::ID_REG_ZMM11;
-            break;
-
-          case triton::extlibs::capstone::X86_REG_ZMM12:
-            tritonId = triton::arch::x86::ID_REG_ZMM12;
-            break;
-
-          case triton::extlibs::capstone::X86_REG_ZMM13:
-            tritonId = triton::arch::x86::ID_REG_ZMM13;
-            break;
-
-          case triton::extlibs::capstone::X86_REG_ZMM14:
-            tritonId = triton::arch::x86::ID_REG_ZMM14;
-            break;
-
-          case triton::extlibs::capstone::X86_REG_ZMM15:
-            tritonId = triton::arch::x86::ID_REG_ZMM15;
-            break;
-
-          case triton::extlibs::capstone::X86_REG_ZMM16:
-            tritonId = triton::arch::x86::ID_REG_ZMM16;
-            break;
-
-          case triton::extlibs::capstone::X86_REG_ZMM17:
-            tritonId = triton::arch::x86::ID_REG_ZMM17;
-            break;
-
-          case triton::extlibs::capstone::X86_REG_ZMM18:
-            tritonId = triton::arch::x86::ID_REG_ZMM18;
-            break;
-
-          case triton::extlibs::capstone::X86_REG_ZMM19:
-            tritonId = triton::arch::x86::ID_REG_ZMM19;
-            break;
-
-          case triton::extlibs::capstone::X86_REG_ZMM20:
-            tritonId = triton::arch::x86::ID_REG_ZMM20;
-            break;
-
-          case triton::extlibs::capstone::X86_REG_ZMM21:
-            tritonId = triton::arch::x86::ID_REG_ZMM21;
-            break;
-
-          case triton::extlibs::capstone::X86_REG_ZMM22:
-            tritonId = triton::arch::x86::ID_REG_ZMM22;
-            break;
-
-          case triton::extlibs::capstone::X86_REG_ZMM23:
-            tritonId = triton::arch::x86::ID_REG_ZMM23;
-            break;
-
-          case triton::extlibs::capstone::X86_REG_ZMM24:
-            tritonId = triton::arch::x86::ID_REG_ZMM24;
-            break;
-
-          case triton::extlibs::capstone::X86_REG_ZMM25:
-            tritonId = triton::arch::x86::ID_REG_ZMM25;
-            break;
-
-          case triton::extlibs::capstone::X86_REG_ZMM26:
-            tritonId = triton::arch::x86::ID_REG_ZMM26;
-            break;
-
-          case triton::extlibs::capstone::X86_REG_ZMM27:
-            tritonId = triton::arch::x86::ID_REG_ZMM27;
-            break;
-
-          case triton::extlibs::capstone::X86_REG_ZMM28:
-            tritonId = triton::arch::x86::ID_REG_ZMM28;
-            break;
-
-          case triton::extlibs::capstone::X86_REG_ZMM29:
-            tritonId = triton::arch::x86::ID_REG_ZMM29;
-            break;
-
-          case triton::extlibs::capstone::X86_REG_ZMM30:
-            tritonId = triton::arch::x86::ID_REG_ZMM30;
-            break;
-
-          case triton::extlibs::capstone::X86_REG_ZMM31:
-            tritonId = triton::arch::x86::ID_REG_ZMM31;
-            break;
-
-          case triton::extlibs::capstone::X86_REG_CR0:
-            tritonId = triton::arch::x86::ID_REG_CR0;
-            break;
-
-          case triton::extlibs::capstone::X86_REG_CR1:
-            tritonId = triton::arch::x86::ID_REG_CR1;
-            break;
-
-          case triton::extlibs::capstone::X86_REG_CR2:
-            tritonId = triton::arch::x86::ID_REG_CR2;
-            break;
-
-          case triton::extlibs::capstone::X86_REG_CR3:
-            tritonId = triton::arch::x86::ID_REG_CR3;
-            break;
-
-          case triton::extlibs::capstone::X86_REG_CR4:
-            tritonId = triton::arch::x86::ID_REG_CR4;
-            break;
-
-          case triton::extlibs::capstone::X86_REG_CR5:
-            tritonId = triton::arch::x86::ID_REG_CR5;
-            break;
-
-          case triton::extlibs::capstone::X86_REG_CR6:
-            tritonId = triton::arch::x86::ID_REG_CR6;
-            break;
-
-          case triton::extlibs::capstone::X86_REG_CR7:
-            tritonId = triton::arch::x86::ID_REG_CR7;
-            break;
-
-          case triton::extlibs::capstone::X86_REG_CR8:
-            tritonId = triton::arch::x86::ID_REG_CR8;
-            break;
-
-          case triton::extlibs::capstone::X86_REG_CR9:
-            tritonId = triton::arch::x86::ID_REG_CR9;
-            break;
-
-          case triton::extlibs::capstone::X86_REG_CR10:
-            tritonId = triton::arch::x86::ID_REG_CR10;
-            break;
-
-          case triton::extlibs::capstone::X86_REG_CR11:
-            tritonId = triton::arch::x86::ID_REG_CR11;
-            break;
-
-          case triton::extlibs::capstone::X86_REG_CR12:
-            tritonId = triton::arch::x86::ID_REG_CR12;
-            break;
-
-          case triton::extlibs::capstone::X86_REG_CR13:
-            tritonId = triton::arch::x86::ID_REG_CR13;
-            break;
-
-          case triton::extlibs::capstone::X86_REG_CR14:
-            tritonId = triton::arch::x86::ID_REG_CR14;
-            break;
-
-          case triton::extlibs::capstone::X86_REG_CR15:
-            tritonId = triton::arch::x86::ID_REG_CR15;
-            break;
-
-          case triton::extlibs::capstone::X86_REG_CS:
-            tritonId = triton::arch::x86::ID_REG_CS;
-            break;
-
-          case triton::extlibs::capstone::X86_REG_DS:
-            tritonId = triton::arch::x86::ID_REG_DS;
-            break;
-
-          case triton::extlibs::capstone::X86_REG_ES:
-            tritonId = triton::arch::x86::ID_REG_ES;
-            break;
-
-          case triton::extlibs::capstone::X86_REG_FS:
-            tritonId = triton::arch::x86::ID_REG_FS;
-            break;
-
-          case triton::extlibs::capstone::X86_REG_GS:
-            tritonId = triton::arch::x86::ID_REG_GS;
-            break;
-
-          case triton::extlibs::capstone::X86_REG_SS:
-            tritonId = triton::arch::x86::ID_REG_SS;
-            break;
-
-          default:
-            tritonId = triton::arch::x86::ID_REG_INVALID;
-            break;
-
-        }
-        return tritonId;
-      }
-
-
-      triton::uint32 x86Specifications::capstoneInstructionToTritonInstruction(triton::uint32 id) const {
-        triton::uint32 tritonId = triton::arch::x86::ID_INST_INVALID;
-
-        switch (id) {
-
-          case triton::extlibs::capstone::X86_INS_INVALID:
-            tritonId = triton::arch::x86::ID_INST_INVALID;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_AAA:
-            tritonId = triton::arch::x86::ID_INS_AAA;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_AAD:
-            tritonId = triton::arch::x86::ID_INS_AAD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_AAM:
-            tritonId = triton::arch::x86::ID_INS_AAM;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_AAS:
-            tritonId = triton::arch::x86::ID_INS_AAS;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_FABS:
-            tritonId = triton::arch::x86::ID_INS_FABS;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_ADC:
-            tritonId = triton::arch::x86::ID_INS_ADC;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_ADCX:
-            tritonId = triton::arch::x86::ID_INS_ADCX;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_ADD:
-            tritonId = triton::arch::x86::ID_INS_ADD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_ADDPD:
-            tritonId = triton::arch::x86::ID_INS_ADDPD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_ADDPS:
-            tritonId = triton::arch::x86::ID_INS_ADDPS;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_ADDSD:
-            tritonId = triton::arch::x86::ID_INS_ADDSD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_ADDSS:
-            tritonId = triton::arch::x86::ID_INS_ADDSS;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_ADDSUBPD:
-            tritonId = triton::arch::x86::ID_INS_ADDSUBPD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_ADDSUBPS:
-            tritonId = triton::arch::x86::ID_INS_ADDSUBPS;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_FADD:
-            tritonId = triton::arch::x86::ID_INS_FADD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_FIADD:
-            tritonId = triton::arch::x86::ID_INS_FIADD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_FADDP:
-            tritonId = triton::arch::x86::ID_INS_FADDP;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_ADOX:
-            tritonId = triton::arch::x86::ID_INS_ADOX;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_AESDECLAST:
-            tritonId = triton::arch::x86::ID_INS_AESDECLAST;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_AESDEC:
-            tritonId = triton::arch::x86::ID_INS_AESDEC;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_AESENCLAST:
-            tritonId = triton::arch::x86::ID_INS_AESENCLAST;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_AESENC:
-            tritonId = triton::arch::x86::ID_INS_AESENC;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_AESIMC:
-            tritonId = triton::arch::x86::ID_INS_AESIMC;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_AESKEYGENASSIST:
-            tritonId = triton::arch::x86::ID_INS_AESKEYGENASSIST;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_AND:
-            tritonId = triton::arch::x86::ID_INS_AND;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_ANDN:
-            tritonId = triton::arch::x86::ID_INS_ANDN;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_ANDNPD:
-            tritonId = triton::arch::x86::ID_INS_ANDNPD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_ANDNPS:
-            tritonId = triton::arch::x86::ID_INS_ANDNPS;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_ANDPD:
-            tritonId = triton::arch::x86::ID_INS_ANDPD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_ANDPS:
-            tritonId = triton::arch::x86::ID_INS_ANDPS;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_ARPL:
-            tritonId = triton::arch::x86::ID_INS_ARPL;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_BEXTR:
-            tritonId = triton::arch::x86::ID_INS_BEXTR;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_BLCFILL:
-            tritonId = triton::arch::x86::ID_INS_BLCFILL;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_BLCI:
-            tritonId = triton::arch::x86::ID_INS_BLCI;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_BLCIC:
-            tritonId = triton::arch::x86::ID_INS_BLCIC;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_BLCMSK:
-            tritonId = triton::arch::x86::ID_INS_BLCMSK;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_BLCS:
-            tritonId = triton::arch::x86::ID_INS_BLCS;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_BLENDPD:
-            tritonId = triton::arch::x86::ID_INS_BLENDPD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_BLENDPS:
-            tritonId = triton::arch::x86::ID_INS_BLENDPS;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_BLENDVPD:
-            tritonId = triton::arch::x86::ID_INS_BLENDVPD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_BLENDVPS:
-            tritonId = triton::arch::x86::ID_INS_BLENDVPS;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_BLSFILL:
-            tritonId = triton::arch::x86::ID_INS_BLSFILL;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_BLSI:
-            tritonId = triton::arch::x86::ID_INS_BLSI;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_BLSIC:
-            tritonId = triton::arch::x86::ID_INS_BLSIC;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_BLSMSK:
-            tritonId = triton::arch::x86::ID_INS_BLSMSK;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_BLSR:
-            tritonId = triton::arch::x86::ID_INS_BLSR;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_BOUND:
-            tritonId = triton::arch::x86::ID_INS_BOUND;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_BSF:
-            tritonId = triton::arch::x86::ID_INS_BSF;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_BSR:
-            tritonId = triton::arch::x86::ID_INS_BSR;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_BSWAP:
-            tritonId = triton::arch::x86::ID_INS_BSWAP;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_BT:
-            tritonId = triton::arch::x86::ID_INS_BT;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_BTC:
-            tritonId = triton::arch::x86::ID_INS_BTC;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_BTR:
-            tritonId = triton::arch::x86::ID_INS_BTR;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_BTS:
-            tritonId = triton::arch::x86::ID_INS_BTS;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_BZHI:
-            tritonId = triton::arch::x86::ID_INS_BZHI;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_CALL:
-            tritonId = triton::arch::x86::ID_INS_CALL;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_CBW:
-            tritonId = triton::arch::x86::ID_INS_CBW;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_CDQ:
-            tritonId = triton::arch::x86::ID_INS_CDQ;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_CDQE:
-            tritonId = triton::arch::x86::ID_INS_CDQE;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_FCHS:
-            tritonId = triton::arch::x86::ID_INS_FCHS;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_CLAC:
-            tritonId = triton::arch::x86::ID_INS_CLAC;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_CLC:
-            tritonId = triton::arch::x86::ID_INS_CLC;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_CLD:
-            tritonId = triton::arch::x86::ID_INS_CLD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_CLFLUSH:
-            tritonId = triton::arch::x86::ID_INS_CLFLUSH;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_CLGI:
-            tritonId = triton::arch::x86::ID_INS_CLGI;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_CLI:
-            tritonId = triton::arch::x86::ID_INS_CLI;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_CLTS:
-            tritonId = triton::arch::x86::ID_INS_CLTS;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_CMC:
-            tritonId = triton::arch::x86::ID_INS_CMC;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_CMOVA:
-            tritonId = triton::arch::x86::ID_INS_CMOVA;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_CMOVAE:
-            tritonId = triton::arch::x86::ID_INS_CMOVAE;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_CMOVB:
-            tritonId = triton::arch::x86::ID_INS_CMOVB;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_CMOVBE:
-            tritonId = triton::arch::x86::ID_INS_CMOVBE;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_FCMOVBE:
-            tritonId = triton::arch::x86::ID_INS_FCMOVBE;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_FCMOVB:
-            tritonId = triton::arch::x86::ID_INS_FCMOVB;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_CMOVE:
-            tritonId = triton::arch::x86::ID_INS_CMOVE;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_FCMOVE:
-            tritonId = triton::arch::x86::ID_INS_FCMOVE;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_CMOVG:
-            tritonId = triton::arch::x86::ID_INS_CMOVG;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_CMOVGE:
-            tritonId = triton::arch::x86::ID_INS_CMOVGE;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_CMOVL:
-            tritonId = triton::arch::x86::ID_INS_CMOVL;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_CMOVLE:
-            tritonId = triton::arch::x86::ID_INS_CMOVLE;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_FCMOVNBE:
-            tritonId = triton::arch::x86::ID_INS_FCMOVNBE;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_FCMOVNB:
-            tritonId = triton::arch::x86::ID_INS_FCMOVNB;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_CMOVNE:
-            tritonId = triton::arch::x86::ID_INS_CMOVNE;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_FCMOVNE:
-            tritonId = triton::arch::x86::ID_INS_FCMOVNE;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_CMOVNO:
-            tritonId = triton::arch::x86::ID_INS_CMOVNO;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_CMOVNP:
-            tritonId = triton::arch::x86::ID_INS_CMOVNP;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_FCMOVNU:
-            tritonId = triton::arch::x86::ID_INS_FCMOVNU;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_CMOVNS:
-            tritonId = triton::arch::x86::ID_INS_CMOVNS;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_CMOVO:
-            tritonId = triton::arch::x86::ID_INS_CMOVO;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_CMOVP:
-            tritonId = triton::arch::x86::ID_INS_CMOVP;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_FCMOVU:
-            tritonId = triton::arch::x86::ID_INS_FCMOVU;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_CMOVS:
-            tritonId = triton::arch::x86::ID_INS_CMOVS;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_CMP:
-            tritonId = triton::arch::x86::ID_INS_CMP;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_CMPPD:
-            tritonId = triton::arch::x86::ID_INS_CMPPD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_CMPPS:
-            tritonId = triton::arch::x86::ID_INS_CMPPS;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_CMPSB:
-            tritonId = triton::arch::x86::ID_INS_CMPSB;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_CMPSD:
-            tritonId = triton::arch::x86::ID_INS_CMPSD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_CMPSQ:
-            tritonId = triton::arch::x86::ID_INS_CMPSQ;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_CMPSS:
-            tritonId = triton::arch::x86::ID_INS_CMPSS;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_CMPSW:
-            tritonId = triton::arch::x86::ID_INS_CMPSW;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_CMPXCHG16B:
-            tritonId = triton::arch::x86::ID_INS_CMPXCHG16B;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_CMPXCHG:
-            tritonId = triton::arch::x86::ID_INS_CMPXCHG;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_CMPXCHG8B:
-            tritonId = triton::arch::x86::ID_INS_CMPXCHG8B;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_COMISD:
-            tritonId = triton::arch::x86::ID_INS_COMISD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_COMISS:
-            tritonId = triton::arch::x86::ID_INS_COMISS;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_FCOMP:
-            tritonId = triton::arch::x86::ID_INS_FCOMP;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_FCOMPI:
-            tritonId = triton::arch::x86::ID_INS_FCOMPI;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_FCOMI:
-            tritonId = triton::arch::x86::ID_INS_FCOMI;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_FCOM:
-            tritonId = triton::arch::x86::ID_INS_FCOM;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_FCOS:
-            tritonId = triton::arch::x86::ID_INS_FCOS;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_CPUID:
-            tritonId = triton::arch::x86::ID_INS_CPUID;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_CQO:
-            tritonId = triton::arch::x86::ID_INS_CQO;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_CRC32:
-            tritonId = triton::arch::x86::ID_INS_CRC32;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_CVTDQ2PD:
-            tritonId = triton::arch::x86::ID_INS_CVTDQ2PD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_CVTDQ2PS:
-            tritonId = triton::arch::x86::ID_INS_CVTDQ2PS;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_CVTPD2DQ:
-            tritonId = triton::arch::x86::ID_INS_CVTPD2DQ;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_CVTPD2PS:
-            tritonId = triton::arch::x86::ID_INS_CVTPD2PS;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_CVTPS2DQ:
-            tritonId = triton::arch::x86::ID_INS_CVTPS2DQ;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_CVTPS2PD:
-            tritonId = triton::arch::x86::ID_INS_CVTPS2PD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_CVTSD2SI:
-            tritonId = triton::arch::x86::ID_INS_CVTSD2SI;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_CVTSD2SS:
-            tritonId = triton::arch::x86::ID_INS_CVTSD2SS;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_CVTSI2SD:
-            tritonId = triton::arch::x86::ID_INS_CVTSI2SD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_CVTSI2SS:
-            tritonId = triton::arch::x86::ID_INS_CVTSI2SS;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_CVTSS2SD:
-            tritonId = triton::arch::x86::ID_INS_CVTSS2SD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_CVTSS2SI:
-            tritonId = triton::arch::x86::ID_INS_CVTSS2SI;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_CVTTPD2DQ:
-            tritonId = triton::arch::x86::ID_INS_CVTTPD2DQ;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_CVTTPS2DQ:
-            tritonId = triton::arch::x86::ID_INS_CVTTPS2DQ;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_CVTTSD2SI:
-            tritonId = triton::arch::x86::ID_INS_CVTTSD2SI;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_CVTTSS2SI:
-            tritonId = triton::arch::x86::ID_INS_CVTTSS2SI;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_CWD:
-            tritonId = triton::arch::x86::ID_INS_CWD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_CWDE:
-            tritonId = triton::arch::x86::ID_INS_CWDE;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_DAA:
-            tritonId = triton::arch::x86::ID_INS_DAA;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_DAS:
-            tritonId = triton::arch::x86::ID_INS_DAS;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_DATA16:
-            tritonId = triton::arch::x86::ID_INS_DATA16;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_DEC:
-            tritonId = triton::arch::x86::ID_INS_DEC;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_DIV:
-            tritonId = triton::arch::x86::ID_INS_DIV;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_DIVPD:
-            tritonId = triton::arch::x86::ID_INS_DIVPD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_DIVPS:
-            tritonId = triton::arch::x86::ID_INS_DIVPS;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_FDIVR:
-            tritonId = triton::arch::x86::ID_INS_FDIVR;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_FIDIVR:
-            tritonId = triton::arch::x86::ID_INS_FIDIVR;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_FDIVRP:
-            tritonId = triton::arch::x86::ID_INS_FDIVRP;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_DIVSD:
-            tritonId = triton::arch::x86::ID_INS_DIVSD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_DIVSS:
-            tritonId = triton::arch::x86::ID_INS_DIVSS;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_FDIV:
-            tritonId = triton::arch::x86::ID_INS_FDIV;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_FIDIV:
-            tritonId = triton::arch::x86::ID_INS_FIDIV;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_FDIVP:
-            tritonId = triton::arch::x86::ID_INS_FDIVP;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_DPPD:
-            tritonId = triton::arch::x86::ID_INS_DPPD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_DPPS:
-            tritonId = triton::arch::x86::ID_INS_DPPS;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_RET:
-            tritonId = triton::arch::x86::ID_INS_RET;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_ENCLS:
-            tritonId = triton::arch::x86::ID_INS_ENCLS;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_ENCLU:
-            tritonId = triton::arch::x86::ID_INS_ENCLU;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_ENTER:
-            tritonId = triton::arch::x86::ID_INS_ENTER;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_EXTRACTPS:
-            tritonId = triton::arch::x86::ID_INS_EXTRACTPS;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_EXTRQ:
-            tritonId = triton::arch::x86::ID_INS_EXTRQ;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_F2XM1:
-            tritonId = triton::arch::x86::ID_INS_F2XM1;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_LCALL:
-            tritonId = triton::arch::x86::ID_INS_LCALL;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_LJMP:
-            tritonId = triton::arch::x86::ID_INS_LJMP;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_FBLD:
-            tritonId = triton::arch::x86::ID_INS_FBLD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_FBSTP:
-            tritonId = triton::arch::x86::ID_INS_FBSTP;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_FCOMPP:
-            tritonId = triton::arch::x86::ID_INS_FCOMPP;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_FDECSTP:
-            tritonId = triton::arch::x86::ID_INS_FDECSTP;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_FEMMS:
-            tritonId = triton::arch::x86::ID_INS_FEMMS;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_FFREE:
-            tritonId = triton::arch::x86::ID_INS_FFREE;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_FICOM:
-            tritonId = triton::arch::x86::ID_INS_FICOM;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_FICOMP:
-            tritonId = triton::arch::x86::ID_INS_FICOMP;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_FINCSTP:
-            tritonId = triton::arch::x86::ID_INS_FINCSTP;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_FLDCW:
-            tritonId = triton::arch::x86::ID_INS_FLDCW;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_FLDENV:
-            tritonId = triton::arch::x86::ID_INS_FLDENV;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_FLDL2E:
-            tritonId = triton::arch::x86::ID_INS_FLDL2E;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_FLDL2T:
-            tritonId = triton::arch::x86::ID_INS_FLDL2T;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_FLDLG2:
-            tritonId = triton::arch::x86::ID_INS_FLDLG2;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_FLDLN2:
-            tritonId = triton::arch::x86::ID_INS_FLDLN2;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_FLDPI:
-            tritonId = triton::arch::x86::ID_INS_FLDPI;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_FNCLEX:
-            tritonId = triton::arch::x86::ID_INS_FNCLEX;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_FNINIT:
-            tritonId = triton::arch::x86::ID_INS_FNINIT;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_FNOP:
-            tritonId = triton::arch::x86::ID_INS_FNOP;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_FNSTCW:
-            tritonId = triton::arch::x86::ID_INS_FNSTCW;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_FNSTSW:
-            tritonId = triton::arch::x86::ID_INS_FNSTSW;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_FPATAN:
-            tritonId = triton::arch::x86::ID_INS_FPATAN;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_FPREM:
-            tritonId = triton::arch::x86::ID_INS_FPREM;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_FPREM1:
-            tritonId = triton::arch::x86::ID_INS_FPREM1;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_FPTAN:
-            tritonId = triton::arch::x86::ID_INS_FPTAN;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_FRNDINT:
-            tritonId = triton::arch::x86::ID_INS_FRNDINT;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_FRSTOR:
-            tritonId = triton::arch::x86::ID_INS_FRSTOR;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_FNSAVE:
-            tritonId = triton::arch::x86::ID_INS_FNSAVE;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_FSCALE:
-            tritonId = triton::arch::x86::ID_INS_FSCALE;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_FSETPM:
-            tritonId = triton::arch::x86::ID_INS_FSETPM;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_FSINCOS:
-            tritonId = triton::arch::x86::ID_INS_FSINCOS;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_FNSTENV:
-            tritonId = triton::arch::x86::ID_INS_FNSTENV;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_FXAM:
-            tritonId = triton::arch::x86::ID_INS_FXAM;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_FXRSTOR:
-            tritonId = triton::arch::x86::ID_INS_FXRSTOR;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_FXRSTOR64:
-            tritonId = triton::arch::x86::ID_INS_FXRSTOR64;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_FXSAVE:
-            tritonId = triton::arch::x86::ID_INS_FXSAVE;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_FXSAVE64:
-            tritonId = triton::arch::x86::ID_INS_FXSAVE64;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_FXTRACT:
-            tritonId = triton::arch::x86::ID_INS_FXTRACT;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_FYL2X:
-            tritonId = triton::arch::x86::ID_INS_FYL2X;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_FYL2XP1:
-            tritonId = triton::arch::x86::ID_INS_FYL2XP1;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_MOVAPD:
-            tritonId = triton::arch::x86::ID_INS_MOVAPD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_MOVAPS:
-            tritonId = triton::arch::x86::ID_INS_MOVAPS;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_ORPD:
-            tritonId = triton::arch::x86::ID_INS_ORPD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_ORPS:
-            tritonId = triton::arch::x86::ID_INS_ORPS;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VMOVAPD:
-            tritonId = triton::arch::x86::ID_INS_VMOVAPD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VMOVAPS:
-            tritonId = triton::arch::x86::ID_INS_VMOVAPS;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_XORPD:
-            tritonId = triton::arch::x86::ID_INS_XORPD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_XORPS:
-            tritonId = triton::arch::x86::ID_INS_XORPS;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_GETSEC:
-            tritonId = triton::arch::x86::ID_INS_GETSEC;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_HADDPD:
-            tritonId = triton::arch::x86::ID_INS_HADDPD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_HADDPS:
-            tritonId = triton::arch::x86::ID_INS_HADDPS;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_HLT:
-            tritonId = triton::arch::x86::ID_INS_HLT;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_HSUBPD:
-            tritonId = triton::arch::x86::ID_INS_HSUBPD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_HSUBPS:
-            tritonId = triton::arch::x86::ID_INS_HSUBPS;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_IDIV:
-            tritonId = triton::arch::x86::ID_INS_IDIV;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_FILD:
-            tritonId = triton::arch::x86::ID_INS_FILD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_IMUL:
-            tritonId = triton::arch::x86::ID_INS_IMUL;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_IN:
-            tritonId = triton::arch::x86::ID_INS_IN;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_INC:
-            tritonId = triton::arch::x86::ID_INS_INC;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_INSB:
-            tritonId = triton::arch::x86::ID_INS_INSB;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_INSERTPS:
-            tritonId = triton::arch::x86::ID_INS_INSERTPS;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_INSERTQ:
-            tritonId = triton::arch::x86::ID_INS_INSERTQ;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_INSD:
-            tritonId = triton::arch::x86::ID_INS_INSD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_INSW:
-            tritonId = triton::arch::x86::ID_INS_INSW;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_INT:
-            tritonId = triton::arch::x86::ID_INS_INT;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_INT1:
-            tritonId = triton::arch::x86::ID_INS_INT1;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_INT3:
-            tritonId = triton::arch::x86::ID_INS_INT3;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_INTO:
-            tritonId = triton::arch::x86::ID_INS_INTO;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_INVD:
-            tritonId = triton::arch::x86::ID_INS_INVD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_INVEPT:
-            tritonId = triton::arch::x86::ID_INS_INVEPT;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_INVLPG:
-            tritonId = triton::arch::x86::ID_INS_INVLPG;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_INVLPGA:
-            tritonId = triton::arch::x86::ID_INS_INVLPGA;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_INVPCID:
-            tritonId = triton::arch::x86::ID_INS_INVPCID;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_INVVPID:
-            tritonId = triton::arch::x86::ID_INS_INVVPID;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_IRET:
-            tritonId = triton::arch::x86::ID_INS_IRET;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_IRETD:
-            tritonId = triton::arch::x86::ID_INS_IRETD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_IRETQ:
-            tritonId = triton::arch::x86::ID_INS_IRETQ;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_FISTTP:
-            tritonId = triton::arch::x86::ID_INS_FISTTP;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_FIST:
-            tritonId = triton::arch::x86::ID_INS_FIST;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_FISTP:
-            tritonId = triton::arch::x86::ID_INS_FISTP;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_UCOMISD:
-            tritonId = triton::arch::x86::ID_INS_UCOMISD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_UCOMISS:
-            tritonId = triton::arch::x86::ID_INS_UCOMISS;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VCMP:
-            tritonId = triton::arch::x86::ID_INS_VCMP;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VCOMISD:
-            tritonId = triton::arch::x86::ID_INS_VCOMISD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VCOMISS:
-            tritonId = triton::arch::x86::ID_INS_VCOMISS;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VCVTSD2SS:
-            tritonId = triton::arch::x86::ID_INS_VCVTSD2SS;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VCVTSI2SD:
-            tritonId = triton::arch::x86::ID_INS_VCVTSI2SD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VCVTSI2SS:
-            tritonId = triton::arch::x86::ID_INS_VCVTSI2SS;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VCVTSS2SD:
-            tritonId = triton::arch::x86::ID_INS_VCVTSS2SD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VCVTTSD2SI:
-            tritonId = triton::arch::x86::ID_INS_VCVTTSD2SI;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VCVTTSD2USI:
-            tritonId = triton::arch::x86::ID_INS_VCVTTSD2USI;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VCVTTSS2SI:
-            tritonId = triton::arch::x86::ID_INS_VCVTTSS2SI;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VCVTTSS2USI:
-            tritonId = triton::arch::x86::ID_INS_VCVTTSS2USI;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VCVTUSI2SD:
-            tritonId = triton::arch::x86::ID_INS_VCVTUSI2SD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VCVTUSI2SS:
-            tritonId = triton::arch::x86::ID_INS_VCVTUSI2SS;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VUCOMISD:
-            tritonId = triton::arch::x86::ID_INS_VUCOMISD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VUCOMISS:
-            tritonId = triton::arch::x86::ID_INS_VUCOMISS;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_JAE:
-            tritonId = triton::arch::x86::ID_INS_JAE;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_JA:
-            tritonId = triton::arch::x86::ID_INS_JA;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_JBE:
-            tritonId = triton::arch::x86::ID_INS_JBE;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_JB:
-            tritonId = triton::arch::x86::ID_INS_JB;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_JCXZ:
-            tritonId = triton::arch::x86::ID_INS_JCXZ;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_JECXZ:
-            tritonId = triton::arch::x86::ID_INS_JECXZ;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_JE:
-            tritonId = triton::arch::x86::ID_INS_JE;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_JGE:
-            tritonId = triton::arch::x86::ID_INS_JGE;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_JG:
-            tritonId = triton::arch::x86::ID_INS_JG;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_JLE:
-            tritonId = triton::arch::x86::ID_INS_JLE;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_JL:
-            tritonId = triton::arch::x86::ID_INS_JL;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_JMP:
-            tritonId = triton::arch::x86::ID_INS_JMP;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_JNE:
-            tritonId = triton::arch::x86::ID_INS_JNE;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_JNO:
-            tritonId = triton::arch::x86::ID_INS_JNO;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_JNP:
-            tritonId = triton::arch::x86::ID_INS_JNP;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_JNS:
-            tritonId = triton::arch::x86::ID_INS_JNS;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_JO:
-            tritonId = triton::arch::x86::ID_INS_JO;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_JP:
-            tritonId = triton::arch::x86::ID_INS_JP;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_JRCXZ:
-            tritonId = triton::arch::x86::ID_INS_JRCXZ;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_JS:
-            tritonId = triton::arch::x86::ID_INS_JS;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_KANDB:
-            tritonId = triton::arch::x86::ID_INS_KANDB;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_KANDD:
-            tritonId = triton::arch::x86::ID_INS_KANDD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_KANDNB:
-            tritonId = triton::arch::x86::ID_INS_KANDNB;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_KANDND:
-            tritonId = triton::arch::x86::ID_INS_KANDND;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_KANDNQ:
-            tritonId = triton::arch::x86::ID_INS_KANDNQ;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_KANDNW:
-            tritonId = triton::arch::x86::ID_INS_KANDNW;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_KANDQ:
-            tritonId = triton::arch::x86::ID_INS_KANDQ;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_KANDW:
-            tritonId = triton::arch::x86::ID_INS_KANDW;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_KMOVB:
-            tritonId = triton::arch::x86::ID_INS_KMOVB;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_KMOVD:
-            tritonId = triton::arch::x86::ID_INS_KMOVD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_KMOVQ:
-            tritonId = triton::arch::x86::ID_INS_KMOVQ;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_KMOVW:
-            tritonId = triton::arch::x86::ID_INS_KMOVW;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_KNOTB:
-            tritonId = triton::arch::x86::ID_INS_KNOTB;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_KNOTD:
-            tritonId = triton::arch::x86::ID_INS_KNOTD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_KNOTQ:
-            tritonId = triton::arch::x86::ID_INS_KNOTQ;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_KNOTW:
-            tritonId = triton::arch::x86::ID_INS_KNOTW;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_KORB:
-            tritonId = triton::arch::x86::ID_INS_KORB;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_KORD:
-            tritonId = triton::arch::x86::ID_INS_KORD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_KORQ:
-            tritonId = triton::arch::x86::ID_INS_KORQ;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_KORTESTW:
-            tritonId = triton::arch::x86::ID_INS_KORTESTW;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_KORW:
-            tritonId = triton::arch::x86::ID_INS_KORW;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_KSHIFTLW:
-            tritonId = triton::arch::x86::ID_INS_KSHIFTLW;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_KSHIFTRW:
-            tritonId = triton::arch::x86::ID_INS_KSHIFTRW;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_KUNPCKBW:
-            tritonId = triton::arch::x86::ID_INS_KUNPCKBW;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_KXNORB:
-            tritonId = triton::arch::x86::ID_INS_KXNORB;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_KXNORD:
-            tritonId = triton::arch::x86::ID_INS_KXNORD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_KXNORQ:
-            tritonId = triton::arch::x86::ID_INS_KXNORQ;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_KXNORW:
-            tritonId = triton::arch::x86::ID_INS_KXNORW;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_KXORB:
-            tritonId = triton::arch::x86::ID_INS_KXORB;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_KXORD:
-            tritonId = triton::arch::x86::ID_INS_KXORD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_KXORQ:
-            tritonId = triton::arch::x86::ID_INS_KXORQ;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_KXORW:
-            tritonId = triton::arch::x86::ID_INS_KXORW;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_LAHF:
-            tritonId = triton::arch::x86::ID_INS_LAHF;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_LAR:
-            tritonId = triton::arch::x86::ID_INS_LAR;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_LDDQU:
-            tritonId = triton::arch::x86::ID_INS_LDDQU;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_LDMXCSR:
-            tritonId = triton::arch::x86::ID_INS_LDMXCSR;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_LDS:
-            tritonId = triton::arch::x86::ID_INS_LDS;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_FLDZ:
-            tritonId = triton::arch::x86::ID_INS_FLDZ;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_FLD1:
-            tritonId = triton::arch::x86::ID_INS_FLD1;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_FLD:
-            tritonId = triton::arch::x86::ID_INS_FLD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_LEA:
-            tritonId = triton::arch::x86::ID_INS_LEA;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_LEAVE:
-            tritonId = triton::arch::x86::ID_INS_LEAVE;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_LES:
-            tritonId = triton::arch::x86::ID_INS_LES;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_LFENCE:
-            tritonId = triton::arch::x86::ID_INS_LFENCE;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_LFS:
-            tritonId = triton::arch::x86::ID_INS_LFS;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_LGDT:
-            tritonId = triton::arch::x86::ID_INS_LGDT;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_LGS:
-            tritonId = triton::arch::x86::ID_INS_LGS;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_LIDT:
-            tritonId = triton::arch::x86::ID_INS_LIDT;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_LLDT:
-            tritonId = triton::arch::x86::ID_INS_LLDT;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_LMSW:
-            tritonId = triton::arch::x86::ID_INS_LMSW;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_OR:
-            tritonId = triton::arch::x86::ID_INS_OR;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_SUB:
-            tritonId = triton::arch::x86::ID_INS_SUB;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_XOR:
-            tritonId = triton::arch::x86::ID_INS_XOR;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_LODSB:
-            tritonId = triton::arch::x86::ID_INS_LODSB;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_LODSD:
-            tritonId = triton::arch::x86::ID_INS_LODSD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_LODSQ:
-            tritonId = triton::arch::x86::ID_INS_LODSQ;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_LODSW:
-            tritonId = triton::arch::x86::ID_INS_LODSW;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_LOOP:
-            tritonId = triton::arch::x86::ID_INS_LOOP;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_LOOPE:
-            tritonId = triton::arch::x86::ID_INS_LOOPE;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_LOOPNE:
-            tritonId = triton::arch::x86::ID_INS_LOOPNE;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_RETF:
-            tritonId = triton::arch::x86::ID_INS_RETF;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_RETFQ:
-            tritonId = triton::arch::x86::ID_INS_RETFQ;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_LSL:
-            tritonId = triton::arch::x86::ID_INS_LSL;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_LSS:
-            tritonId = triton::arch::x86::ID_INS_LSS;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_LTR:
-            tritonId = triton::arch::x86::ID_INS_LTR;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_XADD:
-            tritonId = triton::arch::x86::ID_INS_XADD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_LZCNT:
-            tritonId = triton::arch::x86::ID_INS_LZCNT;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_MASKMOVDQU:
-            tritonId = triton::arch::x86::ID_INS_MASKMOVDQU;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_MAXPD:
-            tritonId = triton::arch::x86::ID_INS_MAXPD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_MAXPS:
-            tritonId = triton::arch::x86::ID_INS_MAXPS;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_MAXSD:
-            tritonId = triton::arch::x86::ID_INS_MAXSD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_MAXSS:
-            tritonId = triton::arch::x86::ID_INS_MAXSS;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_MFENCE:
-            tritonId = triton::arch::x86::ID_INS_MFENCE;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_MINPD:
-            tritonId = triton::arch::x86::ID_INS_MINPD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_MINPS:
-            tritonId = triton::arch::x86::ID_INS_MINPS;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_MINSD:
-            tritonId = triton::arch::x86::ID_INS_MINSD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_MINSS:
-            tritonId = triton::arch::x86::ID_INS_MINSS;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_CVTPD2PI:
-            tritonId = triton::arch::x86::ID_INS_CVTPD2PI;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_CVTPI2PD:
-            tritonId = triton::arch::x86::ID_INS_CVTPI2PD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_CVTPI2PS:
-            tritonId = triton::arch::x86::ID_INS_CVTPI2PS;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_CVTPS2PI:
-            tritonId = triton::arch::x86::ID_INS_CVTPS2PI;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_CVTTPD2PI:
-            tritonId = triton::arch::x86::ID_INS_CVTTPD2PI;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_CVTTPS2PI:
-            tritonId = triton::arch::x86::ID_INS_CVTTPS2PI;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_EMMS:
-            tritonId = triton::arch::x86::ID_INS_EMMS;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_MASKMOVQ:
-            tritonId = triton::arch::x86::ID_INS_MASKMOVQ;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_MOVD:
-            tritonId = triton::arch::x86::ID_INS_MOVD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_MOVDQ2Q:
-            tritonId = triton::arch::x86::ID_INS_MOVDQ2Q;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_MOVNTQ:
-            tritonId = triton::arch::x86::ID_INS_MOVNTQ;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_MOVQ2DQ:
-            tritonId = triton::arch::x86::ID_INS_MOVQ2DQ;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_MOVQ:
-            tritonId = triton::arch::x86::ID_INS_MOVQ;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_PABSB:
-            tritonId = triton::arch::x86::ID_INS_PABSB;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_PABSD:
-            tritonId = triton::arch::x86::ID_INS_PABSD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_PABSW:
-            tritonId = triton::arch::x86::ID_INS_PABSW;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_PACKSSDW:
-            tritonId = triton::arch::x86::ID_INS_PACKSSDW;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_PACKSSWB:
-            tritonId = triton::arch::x86::ID_INS_PACKSSWB;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_PACKUSWB:
-            tritonId = triton::arch::x86::ID_INS_PACKUSWB;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_PADDB:
-            tritonId = triton::arch::x86::ID_INS_PADDB;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_PADDD:
-            tritonId = triton::arch::x86::ID_INS_PADDD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_PADDQ:
-            tritonId = triton::arch::x86::ID_INS_PADDQ;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_PADDSB:
-            tritonId = triton::arch::x86::ID_INS_PADDSB;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_PADDSW:
-            tritonId = triton::arch::x86::ID_INS_PADDSW;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_PADDUSB:
-            tritonId = triton::arch::x86::ID_INS_PADDUSB;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_PADDUSW:
-            tritonId = triton::arch::x86::ID_INS_PADDUSW;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_PADDW:
-            tritonId = triton::arch::x86::ID_INS_PADDW;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_PALIGNR:
-            tritonId = triton::arch::x86::ID_INS_PALIGNR;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_PANDN:
-            tritonId = triton::arch::x86::ID_INS_PANDN;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_PAND:
-            tritonId = triton::arch::x86::ID_INS_PAND;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_PAVGB:
-            tritonId = triton::arch::x86::ID_INS_PAVGB;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_PAVGW:
-            tritonId = triton::arch::x86::ID_INS_PAVGW;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_PCMPEQB:
-            tritonId = triton::arch::x86::ID_INS_PCMPEQB;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_PCMPEQD:
-            tritonId = triton::arch::x86::ID_INS_PCMPEQD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_PCMPEQW:
-            tritonId = triton::arch::x86::ID_INS_PCMPEQW;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_PCMPGTB:
-            tritonId = triton::arch::x86::ID_INS_PCMPGTB;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_PCMPGTD:
-            tritonId = triton::arch::x86::ID_INS_PCMPGTD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_PCMPGTW:
-            tritonId = triton::arch::x86::ID_INS_PCMPGTW;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_PEXTRW:
-            tritonId = triton::arch::x86::ID_INS_PEXTRW;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_PHADDSW:
-            tritonId = triton::arch::x86::ID_INS_PHADDSW;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_PHADDW:
-            tritonId = triton::arch::x86::ID_INS_PHADDW;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_PHADDD:
-            tritonId = triton::arch::x86::ID_INS_PHADDD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_PHSUBD:
-            tritonId = triton::arch::x86::ID_INS_PHSUBD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_PHSUBSW:
-            tritonId = triton::arch::x86::ID_INS_PHSUBSW;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_PHSUBW:
-            tritonId = triton::arch::x86::ID_INS_PHSUBW;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_PINSRW:
-            tritonId = triton::arch::x86::ID_INS_PINSRW;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_PMADDUBSW:
-            tritonId = triton::arch::x86::ID_INS_PMADDUBSW;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_PMADDWD:
-            tritonId = triton::arch::x86::ID_INS_PMADDWD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_PMAXSW:
-            tritonId = triton::arch::x86::ID_INS_PMAXSW;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_PMAXUB:
-            tritonId = triton::arch::x86::ID_INS_PMAXUB;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_PMINSW:
-            tritonId = triton::arch::x86::ID_INS_PMINSW;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_PMINUB:
-            tritonId = triton::arch::x86::ID_INS_PMINUB;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_PMOVMSKB:
-            tritonId = triton::arch::x86::ID_INS_PMOVMSKB;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_PMULHRSW:
-            tritonId = triton::arch::x86::ID_INS_PMULHRSW;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_PMULHUW:
-            tritonId = triton::arch::x86::ID_INS_PMULHUW;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_PMULHW:
-            tritonId = triton::arch::x86::ID_INS_PMULHW;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_PMULLW:
-            tritonId = triton::arch::x86::ID_INS_PMULLW;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_PMULUDQ:
-            tritonId = triton::arch::x86::ID_INS_PMULUDQ;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_POR:
-            tritonId = triton::arch::x86::ID_INS_POR;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_PSADBW:
-            tritonId = triton::arch::x86::ID_INS_PSADBW;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_PSHUFB:
-            tritonId = triton::arch::x86::ID_INS_PSHUFB;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_PSHUFW:
-            tritonId = triton::arch::x86::ID_INS_PSHUFW;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_PSIGNB:
-            tritonId = triton::arch::x86::ID_INS_PSIGNB;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_PSIGND:
-            tritonId = triton::arch::x86::ID_INS_PSIGND;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_PSIGNW:
-            tritonId = triton::arch::x86::ID_INS_PSIGNW;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_PSLLD:
-            tritonId = triton::arch::x86::ID_INS_PSLLD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_PSLLQ:
-            tritonId = triton::arch::x86::ID_INS_PSLLQ;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_PSLLW:
-            tritonId = triton::arch::x86::ID_INS_PSLLW;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_PSRAD:
-            tritonId = triton::arch::x86::ID_INS_PSRAD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_PSRAW:
-            tritonId = triton::arch::x86::ID_INS_PSRAW;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_PSRLD:
-            tritonId = triton::arch::x86::ID_INS_PSRLD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_PSRLQ:
-            tritonId = triton::arch::x86::ID_INS_PSRLQ;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_PSRLW:
-            tritonId = triton::arch::x86::ID_INS_PSRLW;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_PSUBB:
-            tritonId = triton::arch::x86::ID_INS_PSUBB;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_PSUBD:
-            tritonId = triton::arch::x86::ID_INS_PSUBD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_PSUBQ:
-            tritonId = triton::arch::x86::ID_INS_PSUBQ;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_PSUBSB:
-            tritonId = triton::arch::x86::ID_INS_PSUBSB;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_PSUBSW:
-            tritonId = triton::arch::x86::ID_INS_PSUBSW;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_PSUBUSB:
-            tritonId = triton::arch::x86::ID_INS_PSUBUSB;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_PSUBUSW:
-            tritonId = triton::arch::x86::ID_INS_PSUBUSW;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_PSUBW:
-            tritonId = triton::arch::x86::ID_INS_PSUBW;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_PUNPCKHBW:
-            tritonId = triton::arch::x86::ID_INS_PUNPCKHBW;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_PUNPCKHDQ:
-            tritonId = triton::arch::x86::ID_INS_PUNPCKHDQ;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_PUNPCKHWD:
-            tritonId = triton::arch::x86::ID_INS_PUNPCKHWD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_PUNPCKLBW:
-            tritonId = triton::arch::x86::ID_INS_PUNPCKLBW;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_PUNPCKLDQ:
-            tritonId = triton::arch::x86::ID_INS_PUNPCKLDQ;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_PUNPCKLWD:
-            tritonId = triton::arch::x86::ID_INS_PUNPCKLWD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_PXOR:
-            tritonId = triton::arch::x86::ID_INS_PXOR;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_MONITOR:
-            tritonId = triton::arch::x86::ID_INS_MONITOR;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_MONTMUL:
-            tritonId = triton::arch::x86::ID_INS_MONTMUL;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_MOV:
-            tritonId = triton::arch::x86::ID_INS_MOV;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_MOVABS:
-            tritonId = triton::arch::x86::ID_INS_MOVABS;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_MOVBE:
-            tritonId = triton::arch::x86::ID_INS_MOVBE;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_MOVDDUP:
-            tritonId = triton::arch::x86::ID_INS_MOVDDUP;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_MOVDQA:
-            tritonId = triton::arch::x86::ID_INS_MOVDQA;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_MOVDQU:
-            tritonId = triton::arch::x86::ID_INS_MOVDQU;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_MOVHLPS:
-            tritonId = triton::arch::x86::ID_INS_MOVHLPS;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_MOVHPD:
-            tritonId = triton::arch::x86::ID_INS_MOVHPD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_MOVHPS:
-            tritonId = triton::arch::x86::ID_INS_MOVHPS;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_MOVLHPS:
-            tritonId = triton::arch::x86::ID_INS_MOVLHPS;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_MOVLPD:
-            tritonId = triton::arch::x86::ID_INS_MOVLPD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_MOVLPS:
-            tritonId = triton::arch::x86::ID_INS_MOVLPS;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_MOVMSKPD:
-            tritonId = triton::arch::x86::ID_INS_MOVMSKPD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_MOVMSKPS:
-            tritonId = triton::arch::x86::ID_INS_MOVMSKPS;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_MOVNTDQA:
-            tritonId = triton::arch::x86::ID_INS_MOVNTDQA;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_MOVNTDQ:
-            tritonId = triton::arch::x86::ID_INS_MOVNTDQ;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_MOVNTI:
-            tritonId = triton::arch::x86::ID_INS_MOVNTI;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_MOVNTPD:
-            tritonId = triton::arch::x86::ID_INS_MOVNTPD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_MOVNTPS:
-            tritonId = triton::arch::x86::ID_INS_MOVNTPS;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_MOVNTSD:
-            tritonId = triton::arch::x86::ID_INS_MOVNTSD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_MOVNTSS:
-            tritonId = triton::arch::x86::ID_INS_MOVNTSS;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_MOVSB:
-            tritonId = triton::arch::x86::ID_INS_MOVSB;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_MOVSD:
-            tritonId = triton::arch::x86::ID_INS_MOVSD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_MOVSHDUP:
-            tritonId = triton::arch::x86::ID_INS_MOVSHDUP;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_MOVSLDUP:
-            tritonId = triton::arch::x86::ID_INS_MOVSLDUP;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_MOVSQ:
-            tritonId = triton::arch::x86::ID_INS_MOVSQ;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_MOVSS:
-            tritonId = triton::arch::x86::ID_INS_MOVSS;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_MOVSW:
-            tritonId = triton::arch::x86::ID_INS_MOVSW;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_MOVSX:
-            tritonId = triton::arch::x86::ID_INS_MOVSX;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_MOVSXD:
-            tritonId = triton::arch::x86::ID_INS_MOVSXD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_MOVUPD:
-            tritonId = triton::arch::x86::ID_INS_MOVUPD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_MOVUPS:
-            tritonId = triton::arch::x86::ID_INS_MOVUPS;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_MOVZX:
-            tritonId = triton::arch::x86::ID_INS_MOVZX;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_MPSADBW:
-            tritonId = triton::arch::x86::ID_INS_MPSADBW;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_MUL:
-            tritonId = triton::arch::x86::ID_INS_MUL;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_MULPD:
-            tritonId = triton::arch::x86::ID_INS_MULPD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_MULPS:
-            tritonId = triton::arch::x86::ID_INS_MULPS;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_MULSD:
-            tritonId = triton::arch::x86::ID_INS_MULSD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_MULSS:
-            tritonId = triton::arch::x86::ID_INS_MULSS;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_MULX:
-            tritonId = triton::arch::x86::ID_INS_MULX;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_FMUL:
-            tritonId = triton::arch::x86::ID_INS_FMUL;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_FIMUL:
-            tritonId = triton::arch::x86::ID_INS_FIMUL;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_FMULP:
-            tritonId = triton::arch::x86::ID_INS_FMULP;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_MWAIT:
-            tritonId = triton::arch::x86::ID_INS_MWAIT;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_NEG:
-            tritonId = triton::arch::x86::ID_INS_NEG;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_NOP:
-            tritonId = triton::arch::x86::ID_INS_NOP;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_NOT:
-            tritonId = triton::arch::x86::ID_INS_NOT;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_OUT:
-            tritonId = triton::arch::x86::ID_INS_OUT;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_OUTSB:
-            tritonId = triton::arch::x86::ID_INS_OUTSB;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_OUTSD:
-            tritonId = triton::arch::x86::ID_INS_OUTSD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_OUTSW:
-            tritonId = triton::arch::x86::ID_INS_OUTSW;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_PACKUSDW:
-            tritonId = triton::arch::x86::ID_INS_PACKUSDW;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_PAUSE:
-            tritonId = triton::arch::x86::ID_INS_PAUSE;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_PAVGUSB:
-            tritonId = triton::arch::x86::ID_INS_PAVGUSB;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_PBLENDVB:
-            tritonId = triton::arch::x86::ID_INS_PBLENDVB;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_PBLENDW:
-            tritonId = triton::arch::x86::ID_INS_PBLENDW;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_PCLMULQDQ:
-            tritonId = triton::arch::x86::ID_INS_PCLMULQDQ;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_PCMPEQQ:
-            tritonId = triton::arch::x86::ID_INS_PCMPEQQ;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_PCMPESTRI:
-            tritonId = triton::arch::x86::ID_INS_PCMPESTRI;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_PCMPESTRM:
-            tritonId = triton::arch::x86::ID_INS_PCMPESTRM;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_PCMPGTQ:
-            tritonId = triton::arch::x86::ID_INS_PCMPGTQ;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_PCMPISTRI:
-            tritonId = triton::arch::x86::ID_INS_PCMPISTRI;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_PCMPISTRM:
-            tritonId = triton::arch::x86::ID_INS_PCMPISTRM;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_PDEP:
-            tritonId = triton::arch::x86::ID_INS_PDEP;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_PEXT:
-            tritonId = triton::arch::x86::ID_INS_PEXT;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_PEXTRB:
-            tritonId = triton::arch::x86::ID_INS_PEXTRB;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_PEXTRD:
-            tritonId = triton::arch::x86::ID_INS_PEXTRD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_PEXTRQ:
-            tritonId = triton::arch::x86::ID_INS_PEXTRQ;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_PF2ID:
-            tritonId = triton::arch::x86::ID_INS_PF2ID;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_PF2IW:
-            tritonId = triton::arch::x86::ID_INS_PF2IW;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_PFACC:
-            tritonId = triton::arch::x86::ID_INS_PFACC;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_PFADD:
-            tritonId = triton::arch::x86::ID_INS_PFADD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_PFCMPEQ:
-            tritonId = triton::arch::x86::ID_INS_PFCMPEQ;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_PFCMPGE:
-            tritonId = triton::arch::x86::ID_INS_PFCMPGE;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_PFCMPGT:
-            tritonId = triton::arch::x86::ID_INS_PFCMPGT;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_PFMAX:
-            tritonId = triton::arch::x86::ID_INS_PFMAX;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_PFMIN:
-            tritonId = triton::arch::x86::ID_INS_PFMIN;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_PFMUL:
-            tritonId = triton::arch::x86::ID_INS_PFMUL;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_PFNACC:
-            tritonId = triton::arch::x86::ID_INS_PFNACC;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_PFPNACC:
-            tritonId = triton::arch::x86::ID_INS_PFPNACC;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_PFRCPIT1:
-            tritonId = triton::arch::x86::ID_INS_PFRCPIT1;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_PFRCPIT2:
-            tritonId = triton::arch::x86::ID_INS_PFRCPIT2;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_PFRCP:
-            tritonId = triton::arch::x86::ID_INS_PFRCP;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_PFRSQIT1:
-            tritonId = triton::arch::x86::ID_INS_PFRSQIT1;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_PFRSQRT:
-            tritonId = triton::arch::x86::ID_INS_PFRSQRT;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_PFSUBR:
-            tritonId = triton::arch::x86::ID_INS_PFSUBR;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_PFSUB:
-            tritonId = triton::arch::x86::ID_INS_PFSUB;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_PHMINPOSUW:
-            tritonId = triton::arch::x86::ID_INS_PHMINPOSUW;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_PI2FD:
-            tritonId = triton::arch::x86::ID_INS_PI2FD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_PI2FW:
-            tritonId = triton::arch::x86::ID_INS_PI2FW;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_PINSRB:
-            tritonId = triton::arch::x86::ID_INS_PINSRB;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_PINSRD:
-            tritonId = triton::arch::x86::ID_INS_PINSRD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_PINSRQ:
-            tritonId = triton::arch::x86::ID_INS_PINSRQ;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_PMAXSB:
-            tritonId = triton::arch::x86::ID_INS_PMAXSB;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_PMAXSD:
-            tritonId = triton::arch::x86::ID_INS_PMAXSD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_PMAXUD:
-            tritonId = triton::arch::x86::ID_INS_PMAXUD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_PMAXUW:
-            tritonId = triton::arch::x86::ID_INS_PMAXUW;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_PMINSB:
-            tritonId = triton::arch::x86::ID_INS_PMINSB;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_PMINSD:
-            tritonId = triton::arch::x86::ID_INS_PMINSD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_PMINUD:
-            tritonId = triton::arch::x86::ID_INS_PMINUD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_PMINUW:
-            tritonId = triton::arch::x86::ID_INS_PMINUW;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_PMOVSXBD:
-            tritonId = triton::arch::x86::ID_INS_PMOVSXBD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_PMOVSXBQ:
-            tritonId = triton::arch::x86::ID_INS_PMOVSXBQ;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_PMOVSXBW:
-            tritonId = triton::arch::x86::ID_INS_PMOVSXBW;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_PMOVSXDQ:
-            tritonId = triton::arch::x86::ID_INS_PMOVSXDQ;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_PMOVSXWD:
-            tritonId = triton::arch::x86::ID_INS_PMOVSXWD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_PMOVSXWQ:
-            tritonId = triton::arch::x86::ID_INS_PMOVSXWQ;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_PMOVZXBD:
-            tritonId = triton::arch::x86::ID_INS_PMOVZXBD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_PMOVZXBQ:
-            tritonId = triton::arch::x86::ID_INS_PMOVZXBQ;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_PMOVZXBW:
-            tritonId = triton::arch::x86::ID_INS_PMOVZXBW;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_PMOVZXDQ:
-            tritonId = triton::arch::x86::ID_INS_PMOVZXDQ;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_PMOVZXWD:
-            tritonId = triton::arch::x86::ID_INS_PMOVZXWD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_PMOVZXWQ:
-            tritonId = triton::arch::x86::ID_INS_PMOVZXWQ;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_PMULDQ:
-            tritonId = triton::arch::x86::ID_INS_PMULDQ;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_PMULHRW:
-            tritonId = triton::arch::x86::ID_INS_PMULHRW;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_PMULLD:
-            tritonId = triton::arch::x86::ID_INS_PMULLD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_POP:
-            tritonId = triton::arch::x86::ID_INS_POP;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_POPAW:
-            tritonId = triton::arch::x86::ID_INS_POPAW;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_POPAL:
-            tritonId = triton::arch::x86::ID_INS_POPAL;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_POPCNT:
-            tritonId = triton::arch::x86::ID_INS_POPCNT;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_POPF:
-            tritonId = triton::arch::x86::ID_INS_POPF;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_POPFD:
-            tritonId = triton::arch::x86::ID_INS_POPFD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_POPFQ:
-            tritonId = triton::arch::x86::ID_INS_POPFQ;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_PREFETCH:
-            tritonId = triton::arch::x86::ID_INS_PREFETCH;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_PREFETCHNTA:
-            tritonId = triton::arch::x86::ID_INS_PREFETCHNTA;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_PREFETCHT0:
-            tritonId = triton::arch::x86::ID_INS_PREFETCHT0;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_PREFETCHT1:
-            tritonId = triton::arch::x86::ID_INS_PREFETCHT1;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_PREFETCHT2:
-            tritonId = triton::arch::x86::ID_INS_PREFETCHT2;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_PREFETCHW:
-            tritonId = triton::arch::x86::ID_INS_PREFETCHW;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_PSHUFD:
-            tritonId = triton::arch::x86::ID_INS_PSHUFD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_PSHUFHW:
-            tritonId = triton::arch::x86::ID_INS_PSHUFHW;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_PSHUFLW:
-            tritonId = triton::arch::x86::ID_INS_PSHUFLW;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_PSLLDQ:
-            tritonId = triton::arch::x86::ID_INS_PSLLDQ;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_PSRLDQ:
-            tritonId = triton::arch::x86::ID_INS_PSRLDQ;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_PSWAPD:
-            tritonId = triton::arch::x86::ID_INS_PSWAPD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_PTEST:
-            tritonId = triton::arch::x86::ID_INS_PTEST;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_PUNPCKHQDQ:
-            tritonId = triton::arch::x86::ID_INS_PUNPCKHQDQ;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_PUNPCKLQDQ:
-            tritonId = triton::arch::x86::ID_INS_PUNPCKLQDQ;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_PUSH:
-            tritonId = triton::arch::x86::ID_INS_PUSH;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_PUSHAW:
-            tritonId = triton::arch::x86::ID_INS_PUSHAW;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_PUSHAL:
-            tritonId = triton::arch::x86::ID_INS_PUSHAL;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_PUSHF:
-            tritonId = triton::arch::x86::ID_INS_PUSHF;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_PUSHFD:
-            tritonId = triton::arch::x86::ID_INS_PUSHFD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_PUSHFQ:
-            tritonId = triton::arch::x86::ID_INS_PUSHFQ;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_RCL:
-            tritonId = triton::arch::x86::ID_INS_RCL;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_RCPPS:
-            tritonId = triton::arch::x86::ID_INS_RCPPS;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_RCPSS:
-            tritonId = triton::arch::x86::ID_INS_RCPSS;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_RCR:
-            tritonId = triton::arch::x86::ID_INS_RCR;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_RDFSBASE:
-            tritonId = triton::arch::x86::ID_INS_RDFSBASE;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_RDGSBASE:
-            tritonId = triton::arch::x86::ID_INS_RDGSBASE;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_RDMSR:
-            tritonId = triton::arch::x86::ID_INS_RDMSR;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_RDPMC:
-            tritonId = triton::arch::x86::ID_INS_RDPMC;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_RDRAND:
-            tritonId = triton::arch::x86::ID_INS_RDRAND;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_RDSEED:
-            tritonId = triton::arch::x86::ID_INS_RDSEED;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_RDTSC:
-            tritonId = triton::arch::x86::ID_INS_RDTSC;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_RDTSCP:
-            tritonId = triton::arch::x86::ID_INS_RDTSCP;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_ROL:
-            tritonId = triton::arch::x86::ID_INS_ROL;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_ROR:
-            tritonId = triton::arch::x86::ID_INS_ROR;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_RORX:
-            tritonId = triton::arch::x86::ID_INS_RORX;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_ROUNDPD:
-            tritonId = triton::arch::x86::ID_INS_ROUNDPD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_ROUNDPS:
-            tritonId = triton::arch::x86::ID_INS_ROUNDPS;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_ROUNDSD:
-            tritonId = triton::arch::x86::ID_INS_ROUNDSD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_ROUNDSS:
-            tritonId = triton::arch::x86::ID_INS_ROUNDSS;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_RSM:
-            tritonId = triton::arch::x86::ID_INS_RSM;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_RSQRTPS:
-            tritonId = triton::arch::x86::ID_INS_RSQRTPS;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_RSQRTSS:
-            tritonId = triton::arch::x86::ID_INS_RSQRTSS;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_SAHF:
-            tritonId = triton::arch::x86::ID_INS_SAHF;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_SAL:
-            tritonId = triton::arch::x86::ID_INS_SAL;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_SALC:
-            tritonId = triton::arch::x86::ID_INS_SALC;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_SAR:
-            tritonId = triton::arch::x86::ID_INS_SAR;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_SARX:
-            tritonId = triton::arch::x86::ID_INS_SARX;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_SBB:
-            tritonId = triton::arch::x86::ID_INS_SBB;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_SCASB:
-            tritonId = triton::arch::x86::ID_INS_SCASB;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_SCASD:
-            tritonId = triton::arch::x86::ID_INS_SCASD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_SCASQ:
-            tritonId = triton::arch::x86::ID_INS_SCASQ;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_SCASW:
-            tritonId = triton::arch::x86::ID_INS_SCASW;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_SETAE:
-            tritonId = triton::arch::x86::ID_INS_SETAE;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_SETA:
-            tritonId = triton::arch::x86::ID_INS_SETA;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_SETBE:
-            tritonId = triton::arch::x86::ID_INS_SETBE;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_SETB:
-            tritonId = triton::arch::x86::ID_INS_SETB;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_SETE:
-            tritonId = triton::arch::x86::ID_INS_SETE;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_SETGE:
-            tritonId = triton::arch::x86::ID_INS_SETGE;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_SETG:
-            tritonId = triton::arch::x86::ID_INS_SETG;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_SETLE:
-            tritonId = triton::arch::x86::ID_INS_SETLE;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_SETL:
-            tritonId = triton::arch::x86::ID_INS_SETL;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_SETNE:
-            tritonId = triton::arch::x86::ID_INS_SETNE;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_SETNO:
-            tritonId = triton::arch::x86::ID_INS_SETNO;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_SETNP:
-            tritonId = triton::arch::x86::ID_INS_SETNP;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_SETNS:
-            tritonId = triton::arch::x86::ID_INS_SETNS;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_SETO:
-            tritonId = triton::arch::x86::ID_INS_SETO;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_SETP:
-            tritonId = triton::arch::x86::ID_INS_SETP;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_SETS:
-            tritonId = triton::arch::x86::ID_INS_SETS;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_SFENCE:
-            tritonId = triton::arch::x86::ID_INS_SFENCE;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_SGDT:
-            tritonId = triton::arch::x86::ID_INS_SGDT;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_SHA1MSG1:
-            tritonId = triton::arch::x86::ID_INS_SHA1MSG1;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_SHA1MSG2:
-            tritonId = triton::arch::x86::ID_INS_SHA1MSG2;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_SHA1NEXTE:
-            tritonId = triton::arch::x86::ID_INS_SHA1NEXTE;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_SHA1RNDS4:
-            tritonId = triton::arch::x86::ID_INS_SHA1RNDS4;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_SHA256MSG1:
-            tritonId = triton::arch::x86::ID_INS_SHA256MSG1;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_SHA256MSG2:
-            tritonId = triton::arch::x86::ID_INS_SHA256MSG2;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_SHA256RNDS2:
-            tritonId = triton::arch::x86::ID_INS_SHA256RNDS2;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_SHL:
-            tritonId = triton::arch::x86::ID_INS_SHL;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_SHLD:
-            tritonId = triton::arch::x86::ID_INS_SHLD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_SHLX:
-            tritonId = triton::arch::x86::ID_INS_SHLX;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_SHR:
-            tritonId = triton::arch::x86::ID_INS_SHR;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_SHRD:
-            tritonId = triton::arch::x86::ID_INS_SHRD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_SHRX:
-            tritonId = triton::arch::x86::ID_INS_SHRX;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_SHUFPD:
-            tritonId = triton::arch::x86::ID_INS_SHUFPD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_SHUFPS:
-            tritonId = triton::arch::x86::ID_INS_SHUFPS;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_SIDT:
-            tritonId = triton::arch::x86::ID_INS_SIDT;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_FSIN:
-            tritonId = triton::arch::x86::ID_INS_FSIN;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_SKINIT:
-            tritonId = triton::arch::x86::ID_INS_SKINIT;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_SLDT:
-            tritonId = triton::arch::x86::ID_INS_SLDT;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_SMSW:
-            tritonId = triton::arch::x86::ID_INS_SMSW;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_SQRTPD:
-            tritonId = triton::arch::x86::ID_INS_SQRTPD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_SQRTPS:
-            tritonId = triton::arch::x86::ID_INS_SQRTPS;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_SQRTSD:
-            tritonId = triton::arch::x86::ID_INS_SQRTSD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_SQRTSS:
-            tritonId = triton::arch::x86::ID_INS_SQRTSS;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_FSQRT:
-            tritonId = triton::arch::x86::ID_INS_FSQRT;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_STAC:
-            tritonId = triton::arch::x86::ID_INS_STAC;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_STC:
-            tritonId = triton::arch::x86::ID_INS_STC;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_STD:
-            tritonId = triton::arch::x86::ID_INS_STD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_STGI:
-            tritonId = triton::arch::x86::ID_INS_STGI;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_STI:
-            tritonId = triton::arch::x86::ID_INS_STI;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_STMXCSR:
-            tritonId = triton::arch::x86::ID_INS_STMXCSR;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_STOSB:
-            tritonId = triton::arch::x86::ID_INS_STOSB;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_STOSD:
-            tritonId = triton::arch::x86::ID_INS_STOSD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_STOSQ:
-            tritonId = triton::arch::x86::ID_INS_STOSQ;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_STOSW:
-            tritonId = triton::arch::x86::ID_INS_STOSW;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_STR:
-            tritonId = triton::arch::x86::ID_INS_STR;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_FST:
-            tritonId = triton::arch::x86::ID_INS_FST;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_FSTP:
-            tritonId = triton::arch::x86::ID_INS_FSTP;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_FSTPNCE:
-            tritonId = triton::arch::x86::ID_INS_FSTPNCE;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_SUBPD:
-            tritonId = triton::arch::x86::ID_INS_SUBPD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_SUBPS:
-            tritonId = triton::arch::x86::ID_INS_SUBPS;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_FSUBR:
-            tritonId = triton::arch::x86::ID_INS_FSUBR;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_FISUBR:
-            tritonId = triton::arch::x86::ID_INS_FISUBR;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_FSUBRP:
-            tritonId = triton::arch::x86::ID_INS_FSUBRP;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_SUBSD:
-            tritonId = triton::arch::x86::ID_INS_SUBSD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_SUBSS:
-            tritonId = triton::arch::x86::ID_INS_SUBSS;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_FSUB:
-            tritonId = triton::arch::x86::ID_INS_FSUB;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_FISUB:
-            tritonId = triton::arch::x86::ID_INS_FISUB;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_FSUBP:
-            tritonId = triton::arch::x86::ID_INS_FSUBP;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_SWAPGS:
-            tritonId = triton::arch::x86::ID_INS_SWAPGS;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_SYSCALL:
-            tritonId = triton::arch::x86::ID_INS_SYSCALL;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_SYSENTER:
-            tritonId = triton::arch::x86::ID_INS_SYSENTER;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_SYSEXIT:
-            tritonId = triton::arch::x86::ID_INS_SYSEXIT;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_SYSRET:
-            tritonId = triton::arch::x86::ID_INS_SYSRET;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_T1MSKC:
-            tritonId = triton::arch::x86::ID_INS_T1MSKC;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_TEST:
-            tritonId = triton::arch::x86::ID_INS_TEST;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_UD2:
-            tritonId = triton::arch::x86::ID_INS_UD2;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_FTST:
-            tritonId = triton::arch::x86::ID_INS_FTST;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_TZCNT:
-            tritonId = triton::arch::x86::ID_INS_TZCNT;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_TZMSK:
-            tritonId = triton::arch::x86::ID_INS_TZMSK;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_FUCOMPI:
-            tritonId = triton::arch::x86::ID_INS_FUCOMPI;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_FUCOMI:
-            tritonId = triton::arch::x86::ID_INS_FUCOMI;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_FUCOMPP:
-            tritonId = triton::arch::x86::ID_INS_FUCOMPP;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_FUCOMP:
-            tritonId = triton::arch::x86::ID_INS_FUCOMP;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_FUCOM:
-            tritonId = triton::arch::x86::ID_INS_FUCOM;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_UD2B:
-            tritonId = triton::arch::x86::ID_INS_UD2B;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_UNPCKHPD:
-            tritonId = triton::arch::x86::ID_INS_UNPCKHPD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_UNPCKHPS:
-            tritonId = triton::arch::x86::ID_INS_UNPCKHPS;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_UNPCKLPD:
-            tritonId = triton::arch::x86::ID_INS_UNPCKLPD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_UNPCKLPS:
-            tritonId = triton::arch::x86::ID_INS_UNPCKLPS;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VADDPD:
-            tritonId = triton::arch::x86::ID_INS_VADDPD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VADDPS:
-            tritonId = triton::arch::x86::ID_INS_VADDPS;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VADDSD:
-            tritonId = triton::arch::x86::ID_INS_VADDSD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VADDSS:
-            tritonId = triton::arch::x86::ID_INS_VADDSS;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VADDSUBPD:
-            tritonId = triton::arch::x86::ID_INS_VADDSUBPD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VADDSUBPS:
-            tritonId = triton::arch::x86::ID_INS_VADDSUBPS;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VAESDECLAST:
-            tritonId = triton::arch::x86::ID_INS_VAESDECLAST;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VAESDEC:
-            tritonId = triton::arch::x86::ID_INS_VAESDEC;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VAESENCLAST:
-            tritonId = triton::arch::x86::ID_INS_VAESENCLAST;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VAESENC:
-            tritonId = triton::arch::x86::ID_INS_VAESENC;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VAESIMC:
-            tritonId = triton::arch::x86::ID_INS_VAESIMC;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VAESKEYGENASSIST:
-            tritonId = triton::arch::x86::ID_INS_VAESKEYGENASSIST;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VALIGND:
-            tritonId = triton::arch::x86::ID_INS_VALIGND;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VALIGNQ:
-            tritonId = triton::arch::x86::ID_INS_VALIGNQ;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VANDNPD:
-            tritonId = triton::arch::x86::ID_INS_VANDNPD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VANDNPS:
-            tritonId = triton::arch::x86::ID_INS_VANDNPS;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VANDPD:
-            tritonId = triton::arch::x86::ID_INS_VANDPD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VANDPS:
-            tritonId = triton::arch::x86::ID_INS_VANDPS;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VBLENDMPD:
-            tritonId = triton::arch::x86::ID_INS_VBLENDMPD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VBLENDMPS:
-            tritonId = triton::arch::x86::ID_INS_VBLENDMPS;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VBLENDPD:
-            tritonId = triton::arch::x86::ID_INS_VBLENDPD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VBLENDPS:
-            tritonId = triton::arch::x86::ID_INS_VBLENDPS;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VBLENDVPD:
-            tritonId = triton::arch::x86::ID_INS_VBLENDVPD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VBLENDVPS:
-            tritonId = triton::arch::x86::ID_INS_VBLENDVPS;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VBROADCASTF128:
-            tritonId = triton::arch::x86::ID_INS_VBROADCASTF128;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VBROADCASTI128:
-            tritonId = triton::arch::x86::ID_INS_VBROADCASTI128;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VBROADCASTI32X4:
-            tritonId = triton::arch::x86::ID_INS_VBROADCASTI32X4;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VBROADCASTI64X4:
-            tritonId = triton::arch::x86::ID_INS_VBROADCASTI64X4;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VBROADCASTSD:
-            tritonId = triton::arch::x86::ID_INS_VBROADCASTSD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VBROADCASTSS:
-            tritonId = triton::arch::x86::ID_INS_VBROADCASTSS;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VCMPPD:
-            tritonId = triton::arch::x86::ID_INS_VCMPPD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VCMPPS:
-            tritonId = triton::arch::x86::ID_INS_VCMPPS;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VCMPSD:
-            tritonId = triton::arch::x86::ID_INS_VCMPSD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VCMPSS:
-            tritonId = triton::arch::x86::ID_INS_VCMPSS;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VCVTDQ2PD:
-            tritonId = triton::arch::x86::ID_INS_VCVTDQ2PD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VCVTDQ2PS:
-            tritonId = triton::arch::x86::ID_INS_VCVTDQ2PS;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VCVTPD2DQX:
-            tritonId = triton::arch::x86::ID_INS_VCVTPD2DQX;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VCVTPD2DQ:
-            tritonId = triton::arch::x86::ID_INS_VCVTPD2DQ;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VCVTPD2PSX:
-            tritonId = triton::arch::x86::ID_INS_VCVTPD2PSX;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VCVTPD2PS:
-            tritonId = triton::arch::x86::ID_INS_VCVTPD2PS;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VCVTPD2UDQ:
-            tritonId = triton::arch::x86::ID_INS_VCVTPD2UDQ;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VCVTPH2PS:
-            tritonId = triton::arch::x86::ID_INS_VCVTPH2PS;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VCVTPS2DQ:
-            tritonId = triton::arch::x86::ID_INS_VCVTPS2DQ;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VCVTPS2PD:
-            tritonId = triton::arch::x86::ID_INS_VCVTPS2PD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VCVTPS2PH:
-            tritonId = triton::arch::x86::ID_INS_VCVTPS2PH;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VCVTPS2UDQ:
-            tritonId = triton::arch::x86::ID_INS_VCVTPS2UDQ;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VCVTSD2SI:
-            tritonId = triton::arch::x86::ID_INS_VCVTSD2SI;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VCVTSD2USI:
-            tritonId = triton::arch::x86::ID_INS_VCVTSD2USI;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VCVTSS2SI:
-            tritonId = triton::arch::x86::ID_INS_VCVTSS2SI;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VCVTSS2USI:
-            tritonId = triton::arch::x86::ID_INS_VCVTSS2USI;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VCVTTPD2DQX:
-            tritonId = triton::arch::x86::ID_INS_VCVTTPD2DQX;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VCVTTPD2DQ:
-            tritonId = triton::arch::x86::ID_INS_VCVTTPD2DQ;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VCVTTPD2UDQ:
-            tritonId = triton::arch::x86::ID_INS_VCVTTPD2UDQ;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VCVTTPS2DQ:
-            tritonId = triton::arch::x86::ID_INS_VCVTTPS2DQ;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VCVTTPS2UDQ:
-            tritonId = triton::arch::x86::ID_INS_VCVTTPS2UDQ;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VCVTUDQ2PD:
-            tritonId = triton::arch::x86::ID_INS_VCVTUDQ2PD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VCVTUDQ2PS:
-            tritonId = triton::arch::x86::ID_INS_VCVTUDQ2PS;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VDIVPD:
-            tritonId = triton::arch::x86::ID_INS_VDIVPD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VDIVPS:
-            tritonId = triton::arch::x86::ID_INS_VDIVPS;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VDIVSD:
-            tritonId = triton::arch::x86::ID_INS_VDIVSD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VDIVSS:
-            tritonId = triton::arch::x86::ID_INS_VDIVSS;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VDPPD:
-            tritonId = triton::arch::x86::ID_INS_VDPPD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VDPPS:
-            tritonId = triton::arch::x86::ID_INS_VDPPS;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VERR:
-            tritonId = triton::arch::x86::ID_INS_VERR;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VERW:
-            tritonId = triton::arch::x86::ID_INS_VERW;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VEXTRACTF128:
-            tritonId = triton::arch::x86::ID_INS_VEXTRACTF128;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VEXTRACTF32X4:
-            tritonId = triton::arch::x86::ID_INS_VEXTRACTF32X4;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VEXTRACTF64X4:
-            tritonId = triton::arch::x86::ID_INS_VEXTRACTF64X4;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VEXTRACTI128:
-            tritonId = triton::arch::x86::ID_INS_VEXTRACTI128;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VEXTRACTI32X4:
-            tritonId = triton::arch::x86::ID_INS_VEXTRACTI32X4;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VEXTRACTI64X4:
-            tritonId = triton::arch::x86::ID_INS_VEXTRACTI64X4;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VEXTRACTPS:
-            tritonId = triton::arch::x86::ID_INS_VEXTRACTPS;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VFMADD132PD:
-            tritonId = triton::arch::x86::ID_INS_VFMADD132PD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VFMADD132PS:
-            tritonId = triton::arch::x86::ID_INS_VFMADD132PS;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VFMADD213PD:
-            tritonId = triton::arch::x86::ID_INS_VFMADD213PD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VFMADD213PS:
-            tritonId = triton::arch::x86::ID_INS_VFMADD213PS;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VFMADDPD:
-            tritonId = triton::arch::x86::ID_INS_VFMADDPD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VFMADD231PD:
-            tritonId = triton::arch::x86::ID_INS_VFMADD231PD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VFMADDPS:
-            tritonId = triton::arch::x86::ID_INS_VFMADDPS;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VFMADD231PS:
-            tritonId = triton::arch::x86::ID_INS_VFMADD231PS;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VFMADDSD:
-            tritonId = triton::arch::x86::ID_INS_VFMADDSD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VFMADD213SD:
-            tritonId = triton::arch::x86::ID_INS_VFMADD213SD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VFMADD132SD:
-            tritonId = triton::arch::x86::ID_INS_VFMADD132SD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VFMADD231SD:
-            tritonId = triton::arch::x86::ID_INS_VFMADD231SD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VFMADDSS:
-            tritonId = triton::arch::x86::ID_INS_VFMADDSS;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VFMADD213SS:
-            tritonId = triton::arch::x86::ID_INS_VFMADD213SS;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VFMADD132SS:
-            tritonId = triton::arch::x86::ID_INS_VFMADD132SS;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VFMADD231SS:
-            tritonId = triton::arch::x86::ID_INS_VFMADD231SS;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VFMADDSUB132PD:
-            tritonId = triton::arch::x86::ID_INS_VFMADDSUB132PD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VFMADDSUB132PS:
-            tritonId = triton::arch::x86::ID_INS_VFMADDSUB132PS;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VFMADDSUB213PD:
-            tritonId = triton::arch::x86::ID_INS_VFMADDSUB213PD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VFMADDSUB213PS:
-            tritonId = triton::arch::x86::ID_INS_VFMADDSUB213PS;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VFMADDSUBPD:
-            tritonId = triton::arch::x86::ID_INS_VFMADDSUBPD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VFMADDSUB231PD:
-            tritonId = triton::arch::x86::ID_INS_VFMADDSUB231PD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VFMADDSUBPS:
-            tritonId = triton::arch::x86::ID_INS_VFMADDSUBPS;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VFMADDSUB231PS:
-            tritonId = triton::arch::x86::ID_INS_VFMADDSUB231PS;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VFMSUB132PD:
-            tritonId = triton::arch::x86::ID_INS_VFMSUB132PD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VFMSUB132PS:
-            tritonId = triton::arch::x86::ID_INS_VFMSUB132PS;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VFMSUB213PD:
-            tritonId = triton::arch::x86::ID_INS_VFMSUB213PD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VFMSUB213PS:
-            tritonId = triton::arch::x86::ID_INS_VFMSUB213PS;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VFMSUBADD132PD:
-            tritonId = triton::arch::x86::ID_INS_VFMSUBADD132PD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VFMSUBADD132PS:
-            tritonId = triton::arch::x86::ID_INS_VFMSUBADD132PS;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VFMSUBADD213PD:
-            tritonId = triton::arch::x86::ID_INS_VFMSUBADD213PD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VFMSUBADD213PS:
-            tritonId = triton::arch::x86::ID_INS_VFMSUBADD213PS;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VFMSUBADDPD:
-            tritonId = triton::arch::x86::ID_INS_VFMSUBADDPD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VFMSUBADD231PD:
-            tritonId = triton::arch::x86::ID_INS_VFMSUBADD231PD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VFMSUBADDPS:
-            tritonId = triton::arch::x86::ID_INS_VFMSUBADDPS;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VFMSUBADD231PS:
-            tritonId = triton::arch::x86::ID_INS_VFMSUBADD231PS;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VFMSUBPD:
-            tritonId = triton::arch::x86::ID_INS_VFMSUBPD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VFMSUB231PD:
-            tritonId = triton::arch::x86::ID_INS_VFMSUB231PD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VFMSUBPS:
-            tritonId = triton::arch::x86::ID_INS_VFMSUBPS;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VFMSUB231PS:
-            tritonId = triton::arch::x86::ID_INS_VFMSUB231PS;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VFMSUBSD:
-            tritonId = triton::arch::x86::ID_INS_VFMSUBSD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VFMSUB213SD:
-            tritonId = triton::arch::x86::ID_INS_VFMSUB213SD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VFMSUB132SD:
-            tritonId = triton::arch::x86::ID_INS_VFMSUB132SD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VFMSUB231SD:
-            tritonId = triton::arch::x86::ID_INS_VFMSUB231SD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VFMSUBSS:
-            tritonId = triton::arch::x86::ID_INS_VFMSUBSS;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VFMSUB213SS:
-            tritonId = triton::arch::x86::ID_INS_VFMSUB213SS;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VFMSUB132SS:
-            tritonId = triton::arch::x86::ID_INS_VFMSUB132SS;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VFMSUB231SS:
-            tritonId = triton::arch::x86::ID_INS_VFMSUB231SS;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VFNMADD132PD:
-            tritonId = triton::arch::x86::ID_INS_VFNMADD132PD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VFNMADD132PS:
-            tritonId = triton::arch::x86::ID_INS_VFNMADD132PS;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VFNMADD213PD:
-            tritonId = triton::arch::x86::ID_INS_VFNMADD213PD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VFNMADD213PS:
-            tritonId = triton::arch::x86::ID_INS_VFNMADD213PS;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VFNMADDPD:
-            tritonId = triton::arch::x86::ID_INS_VFNMADDPD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VFNMADD231PD:
-            tritonId = triton::arch::x86::ID_INS_VFNMADD231PD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VFNMADDPS:
-            tritonId = triton::arch::x86::ID_INS_VFNMADDPS;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VFNMADD231PS:
-            tritonId = triton::arch::x86::ID_INS_VFNMADD231PS;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VFNMADDSD:
-            tritonId = triton::arch::x86::ID_INS_VFNMADDSD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VFNMADD213SD:
-            tritonId = triton::arch::x86::ID_INS_VFNMADD213SD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VFNMADD132SD:
-            tritonId = triton::arch::x86::ID_INS_VFNMADD132SD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VFNMADD231SD:
-            tritonId = triton::arch::x86::ID_INS_VFNMADD231SD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VFNMADDSS:
-            tritonId = triton::arch::x86::ID_INS_VFNMADDSS;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VFNMADD213SS:
-            tritonId = triton::arch::x86::ID_INS_VFNMADD213SS;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VFNMADD132SS:
-            tritonId = triton::arch::x86::ID_INS_VFNMADD132SS;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VFNMADD231SS:
-            tritonId = triton::arch::x86::ID_INS_VFNMADD231SS;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VFNMSUB132PD:
-            tritonId = triton::arch::x86::ID_INS_VFNMSUB132PD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VFNMSUB132PS:
-            tritonId = triton::arch::x86::ID_INS_VFNMSUB132PS;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VFNMSUB213PD:
-            tritonId = triton::arch::x86::ID_INS_VFNMSUB213PD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VFNMSUB213PS:
-            tritonId = triton::arch::x86::ID_INS_VFNMSUB213PS;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VFNMSUBPD:
-            tritonId = triton::arch::x86::ID_INS_VFNMSUBPD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VFNMSUB231PD:
-            tritonId = triton::arch::x86::ID_INS_VFNMSUB231PD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VFNMSUBPS:
-            tritonId = triton::arch::x86::ID_INS_VFNMSUBPS;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VFNMSUB231PS:
-            tritonId = triton::arch::x86::ID_INS_VFNMSUB231PS;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VFNMSUBSD:
-            tritonId = triton::arch::x86::ID_INS_VFNMSUBSD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VFNMSUB213SD:
-            tritonId = triton::arch::x86::ID_INS_VFNMSUB213SD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VFNMSUB132SD:
-            tritonId = triton::arch::x86::ID_INS_VFNMSUB132SD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VFNMSUB231SD:
-            tritonId = triton::arch::x86::ID_INS_VFNMSUB231SD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VFNMSUBSS:
-            tritonId = triton::arch::x86::ID_INS_VFNMSUBSS;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VFNMSUB213SS:
-            tritonId = triton::arch::x86::ID_INS_VFNMSUB213SS;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VFNMSUB132SS:
-            tritonId = triton::arch::x86::ID_INS_VFNMSUB132SS;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VFNMSUB231SS:
-            tritonId = triton::arch::x86::ID_INS_VFNMSUB231SS;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VFRCZPD:
-            tritonId = triton::arch::x86::ID_INS_VFRCZPD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VFRCZPS:
-            tritonId = triton::arch::x86::ID_INS_VFRCZPS;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VFRCZSD:
-            tritonId = triton::arch::x86::ID_INS_VFRCZSD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VFRCZSS:
-            tritonId = triton::arch::x86::ID_INS_VFRCZSS;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VORPD:
-            tritonId = triton::arch::x86::ID_INS_VORPD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VORPS:
-            tritonId = triton::arch::x86::ID_INS_VORPS;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VXORPD:
-            tritonId = triton::arch::x86::ID_INS_VXORPD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VXORPS:
-            tritonId = triton::arch::x86::ID_INS_VXORPS;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VGATHERDPD:
-            tritonId = triton::arch::x86::ID_INS_VGATHERDPD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VGATHERDPS:
-            tritonId = triton::arch::x86::ID_INS_VGATHERDPS;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VGATHERPF0DPD:
-            tritonId = triton::arch::x86::ID_INS_VGATHERPF0DPD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VGATHERPF0DPS:
-            tritonId = triton::arch::x86::ID_INS_VGATHERPF0DPS;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VGATHERPF0QPD:
-            tritonId = triton::arch::x86::ID_INS_VGATHERPF0QPD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VGATHERPF0QPS:
-            tritonId = triton::arch::x86::ID_INS_VGATHERPF0QPS;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VGATHERPF1DPD:
-            tritonId = triton::arch::x86::ID_INS_VGATHERPF1DPD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VGATHERPF1DPS:
-            tritonId = triton::arch::x86::ID_INS_VGATHERPF1DPS;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VGATHERPF1QPD:
-            tritonId = triton::arch::x86::ID_INS_VGATHERPF1QPD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VGATHERPF1QPS:
-            tritonId = triton::arch::x86::ID_INS_VGATHERPF1QPS;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VGATHERQPD:
-            tritonId = triton::arch::x86::ID_INS_VGATHERQPD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VGATHERQPS:
-            tritonId = triton::arch::x86::ID_INS_VGATHERQPS;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VHADDPD:
-            tritonId = triton::arch::x86::ID_INS_VHADDPD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VHADDPS:
-            tritonId = triton::arch::x86::ID_INS_VHADDPS;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VHSUBPD:
-            tritonId = triton::arch::x86::ID_INS_VHSUBPD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VHSUBPS:
-            tritonId = triton::arch::x86::ID_INS_VHSUBPS;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VINSERTF128:
-            tritonId = triton::arch::x86::ID_INS_VINSERTF128;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VINSERTF32X4:
-            tritonId = triton::arch::x86::ID_INS_VINSERTF32X4;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VINSERTF64X4:
-            tritonId = triton::arch::x86::ID_INS_VINSERTF64X4;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VINSERTI128:
-            tritonId = triton::arch::x86::ID_INS_VINSERTI128;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VINSERTI32X4:
-            tritonId = triton::arch::x86::ID_INS_VINSERTI32X4;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VINSERTI64X4:
-            tritonId = triton::arch::x86::ID_INS_VINSERTI64X4;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VINSERTPS:
-            tritonId = triton::arch::x86::ID_INS_VINSERTPS;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VLDDQU:
-            tritonId = triton::arch::x86::ID_INS_VLDDQU;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VLDMXCSR:
-            tritonId = triton::arch::x86::ID_INS_VLDMXCSR;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VMASKMOVDQU:
-            tritonId = triton::arch::x86::ID_INS_VMASKMOVDQU;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VMASKMOVPD:
-            tritonId = triton::arch::x86::ID_INS_VMASKMOVPD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VMASKMOVPS:
-            tritonId = triton::arch::x86::ID_INS_VMASKMOVPS;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VMAXPD:
-            tritonId = triton::arch::x86::ID_INS_VMAXPD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VMAXPS:
-            tritonId = triton::arch::x86::ID_INS_VMAXPS;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VMAXSD:
-            tritonId = triton::arch::x86::ID_INS_VMAXSD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VMAXSS:
-            tritonId = triton::arch::x86::ID_INS_VMAXSS;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VMCALL:
-            tritonId = triton::arch::x86::ID_INS_VMCALL;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VMCLEAR:
-            tritonId = triton::arch::x86::ID_INS_VMCLEAR;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VMFUNC:
-            tritonId = triton::arch::x86::ID_INS_VMFUNC;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VMINPD:
-            tritonId = triton::arch::x86::ID_INS_VMINPD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VMINPS:
-            tritonId = triton::arch::x86::ID_INS_VMINPS;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VMINSD:
-            tritonId = triton::arch::x86::ID_INS_VMINSD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VMINSS:
-            tritonId = triton::arch::x86::ID_INS_VMINSS;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VMLAUNCH:
-            tritonId = triton::arch::x86::ID_INS_VMLAUNCH;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VMLOAD:
-            tritonId = triton::arch::x86::ID_INS_VMLOAD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VMMCALL:
-            tritonId = triton::arch::x86::ID_INS_VMMCALL;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VMOVQ:
-            tritonId = triton::arch::x86::ID_INS_VMOVQ;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VMOVDDUP:
-            tritonId = triton::arch::x86::ID_INS_VMOVDDUP;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VMOVD:
-            tritonId = triton::arch::x86::ID_INS_VMOVD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VMOVDQA32:
-            tritonId = triton::arch::x86::ID_INS_VMOVDQA32;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VMOVDQA64:
-            tritonId = triton::arch::x86::ID_INS_VMOVDQA64;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VMOVDQA:
-            tritonId = triton::arch::x86::ID_INS_VMOVDQA;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VMOVDQU16:
-            tritonId = triton::arch::x86::ID_INS_VMOVDQU16;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VMOVDQU32:
-            tritonId = triton::arch::x86::ID_INS_VMOVDQU32;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VMOVDQU64:
-            tritonId = triton::arch::x86::ID_INS_VMOVDQU64;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VMOVDQU8:
-            tritonId = triton::arch::x86::ID_INS_VMOVDQU8;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VMOVDQU:
-            tritonId = triton::arch::x86::ID_INS_VMOVDQU;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VMOVHLPS:
-            tritonId = triton::arch::x86::ID_INS_VMOVHLPS;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VMOVHPD:
-            tritonId = triton::arch::x86::ID_INS_VMOVHPD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VMOVHPS:
-            tritonId = triton::arch::x86::ID_INS_VMOVHPS;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VMOVLHPS:
-            tritonId = triton::arch::x86::ID_INS_VMOVLHPS;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VMOVLPD:
-            tritonId = triton::arch::x86::ID_INS_VMOVLPD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VMOVLPS:
-            tritonId = triton::arch::x86::ID_INS_VMOVLPS;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VMOVMSKPD:
-            tritonId = triton::arch::x86::ID_INS_VMOVMSKPD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VMOVMSKPS:
-            tritonId = triton::arch::x86::ID_INS_VMOVMSKPS;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VMOVNTDQA:
-            tritonId = triton::arch::x86::ID_INS_VMOVNTDQA;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VMOVNTDQ:
-            tritonId = triton::arch::x86::ID_INS_VMOVNTDQ;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VMOVNTPD:
-            tritonId = triton::arch::x86::ID_INS_VMOVNTPD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VMOVNTPS:
-            tritonId = triton::arch::x86::ID_INS_VMOVNTPS;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VMOVSD:
-            tritonId = triton::arch::x86::ID_INS_VMOVSD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VMOVSHDUP:
-            tritonId = triton::arch::x86::ID_INS_VMOVSHDUP;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VMOVSLDUP:
-            tritonId = triton::arch::x86::ID_INS_VMOVSLDUP;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VMOVSS:
-            tritonId = triton::arch::x86::ID_INS_VMOVSS;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VMOVUPD:
-            tritonId = triton::arch::x86::ID_INS_VMOVUPD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VMOVUPS:
-            tritonId = triton::arch::x86::ID_INS_VMOVUPS;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VMPSADBW:
-            tritonId = triton::arch::x86::ID_INS_VMPSADBW;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VMPTRLD:
-            tritonId = triton::arch::x86::ID_INS_VMPTRLD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VMPTRST:
-            tritonId = triton::arch::x86::ID_INS_VMPTRST;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VMREAD:
-            tritonId = triton::arch::x86::ID_INS_VMREAD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VMRESUME:
-            tritonId = triton::arch::x86::ID_INS_VMRESUME;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VMRUN:
-            tritonId = triton::arch::x86::ID_INS_VMRUN;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VMSAVE:
-            tritonId = triton::arch::x86::ID_INS_VMSAVE;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VMULPD:
-            tritonId = triton::arch::x86::ID_INS_VMULPD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VMULPS:
-            tritonId = triton::arch::x86::ID_INS_VMULPS;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VMULSD:
-            tritonId = triton::arch::x86::ID_INS_VMULSD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VMULSS:
-            tritonId = triton::arch::x86::ID_INS_VMULSS;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VMWRITE:
-            tritonId = triton::arch::x86::ID_INS_VMWRITE;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VMXOFF:
-            tritonId = triton::arch::x86::ID_INS_VMXOFF;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VMXON:
-            tritonId = triton::arch::x86::ID_INS_VMXON;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPABSB:
-            tritonId = triton::arch::x86::ID_INS_VPABSB;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPABSD:
-            tritonId = triton::arch::x86::ID_INS_VPABSD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPABSQ:
-            tritonId = triton::arch::x86::ID_INS_VPABSQ;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPABSW:
-            tritonId = triton::arch::x86::ID_INS_VPABSW;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPACKSSDW:
-            tritonId = triton::arch::x86::ID_INS_VPACKSSDW;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPACKSSWB:
-            tritonId = triton::arch::x86::ID_INS_VPACKSSWB;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPACKUSDW:
-            tritonId = triton::arch::x86::ID_INS_VPACKUSDW;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPACKUSWB:
-            tritonId = triton::arch::x86::ID_INS_VPACKUSWB;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPADDB:
-            tritonId = triton::arch::x86::ID_INS_VPADDB;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPADDD:
-            tritonId = triton::arch::x86::ID_INS_VPADDD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPADDQ:
-            tritonId = triton::arch::x86::ID_INS_VPADDQ;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPADDSB:
-            tritonId = triton::arch::x86::ID_INS_VPADDSB;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPADDSW:
-            tritonId = triton::arch::x86::ID_INS_VPADDSW;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPADDUSB:
-            tritonId = triton::arch::x86::ID_INS_VPADDUSB;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPADDUSW:
-            tritonId = triton::arch::x86::ID_INS_VPADDUSW;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPADDW:
-            tritonId = triton::arch::x86::ID_INS_VPADDW;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPALIGNR:
-            tritonId = triton::arch::x86::ID_INS_VPALIGNR;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPANDD:
-            tritonId = triton::arch::x86::ID_INS_VPANDD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPANDND:
-            tritonId = triton::arch::x86::ID_INS_VPANDND;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPANDNQ:
-            tritonId = triton::arch::x86::ID_INS_VPANDNQ;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPANDN:
-            tritonId = triton::arch::x86::ID_INS_VPANDN;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPANDQ:
-            tritonId = triton::arch::x86::ID_INS_VPANDQ;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPAND:
-            tritonId = triton::arch::x86::ID_INS_VPAND;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPAVGB:
-            tritonId = triton::arch::x86::ID_INS_VPAVGB;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPAVGW:
-            tritonId = triton::arch::x86::ID_INS_VPAVGW;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPBLENDD:
-            tritonId = triton::arch::x86::ID_INS_VPBLENDD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPBLENDMD:
-            tritonId = triton::arch::x86::ID_INS_VPBLENDMD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPBLENDMQ:
-            tritonId = triton::arch::x86::ID_INS_VPBLENDMQ;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPBLENDVB:
-            tritonId = triton::arch::x86::ID_INS_VPBLENDVB;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPBLENDW:
-            tritonId = triton::arch::x86::ID_INS_VPBLENDW;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPBROADCASTB:
-            tritonId = triton::arch::x86::ID_INS_VPBROADCASTB;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPBROADCASTD:
-            tritonId = triton::arch::x86::ID_INS_VPBROADCASTD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPBROADCASTMB2Q:
-            tritonId = triton::arch::x86::ID_INS_VPBROADCASTMB2Q;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPBROADCASTMW2D:
-            tritonId = triton::arch::x86::ID_INS_VPBROADCASTMW2D;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPBROADCASTQ:
-            tritonId = triton::arch::x86::ID_INS_VPBROADCASTQ;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPBROADCASTW:
-            tritonId = triton::arch::x86::ID_INS_VPBROADCASTW;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPCLMULQDQ:
-            tritonId = triton::arch::x86::ID_INS_VPCLMULQDQ;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPCMOV:
-            tritonId = triton::arch::x86::ID_INS_VPCMOV;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPCMP:
-            tritonId = triton::arch::x86::ID_INS_VPCMP;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPCMPD:
-            tritonId = triton::arch::x86::ID_INS_VPCMPD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPCMPEQB:
-            tritonId = triton::arch::x86::ID_INS_VPCMPEQB;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPCMPEQD:
-            tritonId = triton::arch::x86::ID_INS_VPCMPEQD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPCMPEQQ:
-            tritonId = triton::arch::x86::ID_INS_VPCMPEQQ;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPCMPEQW:
-            tritonId = triton::arch::x86::ID_INS_VPCMPEQW;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPCMPESTRI:
-            tritonId = triton::arch::x86::ID_INS_VPCMPESTRI;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPCMPESTRM:
-            tritonId = triton::arch::x86::ID_INS_VPCMPESTRM;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPCMPGTB:
-            tritonId = triton::arch::x86::ID_INS_VPCMPGTB;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPCMPGTD:
-            tritonId = triton::arch::x86::ID_INS_VPCMPGTD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPCMPGTQ:
-            tritonId = triton::arch::x86::ID_INS_VPCMPGTQ;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPCMPGTW:
-            tritonId = triton::arch::x86::ID_INS_VPCMPGTW;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPCMPISTRI:
-            tritonId = triton::arch::x86::ID_INS_VPCMPISTRI;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPCMPISTRM:
-            tritonId = triton::arch::x86::ID_INS_VPCMPISTRM;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPCMPQ:
-            tritonId = triton::arch::x86::ID_INS_VPCMPQ;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPCMPUD:
-            tritonId = triton::arch::x86::ID_INS_VPCMPUD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPCMPUQ:
-            tritonId = triton::arch::x86::ID_INS_VPCMPUQ;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPCOMB:
-            tritonId = triton::arch::x86::ID_INS_VPCOMB;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPCOMD:
-            tritonId = triton::arch::x86::ID_INS_VPCOMD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPCOMQ:
-            tritonId = triton::arch::x86::ID_INS_VPCOMQ;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPCOMUB:
-            tritonId = triton::arch::x86::ID_INS_VPCOMUB;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPCOMUD:
-            tritonId = triton::arch::x86::ID_INS_VPCOMUD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPCOMUQ:
-            tritonId = triton::arch::x86::ID_INS_VPCOMUQ;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPCOMUW:
-            tritonId = triton::arch::x86::ID_INS_VPCOMUW;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPCOMW:
-            tritonId = triton::arch::x86::ID_INS_VPCOMW;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPCONFLICTD:
-            tritonId = triton::arch::x86::ID_INS_VPCONFLICTD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPCONFLICTQ:
-            tritonId = triton::arch::x86::ID_INS_VPCONFLICTQ;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPERM2F128:
-            tritonId = triton::arch::x86::ID_INS_VPERM2F128;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPERM2I128:
-            tritonId = triton::arch::x86::ID_INS_VPERM2I128;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPERMD:
-            tritonId = triton::arch::x86::ID_INS_VPERMD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPERMI2D:
-            tritonId = triton::arch::x86::ID_INS_VPERMI2D;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPERMI2PD:
-            tritonId = triton::arch::x86::ID_INS_VPERMI2PD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPERMI2PS:
-            tritonId = triton::arch::x86::ID_INS_VPERMI2PS;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPERMI2Q:
-            tritonId = triton::arch::x86::ID_INS_VPERMI2Q;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPERMIL2PD:
-            tritonId = triton::arch::x86::ID_INS_VPERMIL2PD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPERMIL2PS:
-            tritonId = triton::arch::x86::ID_INS_VPERMIL2PS;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPERMILPD:
-            tritonId = triton::arch::x86::ID_INS_VPERMILPD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPERMILPS:
-            tritonId = triton::arch::x86::ID_INS_VPERMILPS;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPERMPD:
-            tritonId = triton::arch::x86::ID_INS_VPERMPD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPERMPS:
-            tritonId = triton::arch::x86::ID_INS_VPERMPS;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPERMQ:
-            tritonId = triton::arch::x86::ID_INS_VPERMQ;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPERMT2D:
-            tritonId = triton::arch::x86::ID_INS_VPERMT2D;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPERMT2PD:
-            tritonId = triton::arch::x86::ID_INS_VPERMT2PD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPERMT2PS:
-            tritonId = triton::arch::x86::ID_INS_VPERMT2PS;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPERMT2Q:
-            tritonId = triton::arch::x86::ID_INS_VPERMT2Q;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPEXTRB:
-            tritonId = triton::arch::x86::ID_INS_VPEXTRB;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPEXTRD:
-            tritonId = triton::arch::x86::ID_INS_VPEXTRD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPEXTRQ:
-            tritonId = triton::arch::x86::ID_INS_VPEXTRQ;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPEXTRW:
-            tritonId = triton::arch::x86::ID_INS_VPEXTRW;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPGATHERDD:
-            tritonId = triton::arch::x86::ID_INS_VPGATHERDD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPGATHERDQ:
-            tritonId = triton::arch::x86::ID_INS_VPGATHERDQ;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPGATHERQD:
-            tritonId = triton::arch::x86::ID_INS_VPGATHERQD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPGATHERQQ:
-            tritonId = triton::arch::x86::ID_INS_VPGATHERQQ;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPHADDBD:
-            tritonId = triton::arch::x86::ID_INS_VPHADDBD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPHADDBQ:
-            tritonId = triton::arch::x86::ID_INS_VPHADDBQ;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPHADDBW:
-            tritonId = triton::arch::x86::ID_INS_VPHADDBW;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPHADDDQ:
-            tritonId = triton::arch::x86::ID_INS_VPHADDDQ;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPHADDD:
-            tritonId = triton::arch::x86::ID_INS_VPHADDD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPHADDSW:
-            tritonId = triton::arch::x86::ID_INS_VPHADDSW;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPHADDUBD:
-            tritonId = triton::arch::x86::ID_INS_VPHADDUBD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPHADDUBQ:
-            tritonId = triton::arch::x86::ID_INS_VPHADDUBQ;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPHADDUBW:
-            tritonId = triton::arch::x86::ID_INS_VPHADDUBW;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPHADDUDQ:
-            tritonId = triton::arch::x86::ID_INS_VPHADDUDQ;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPHADDUWD:
-            tritonId = triton::arch::x86::ID_INS_VPHADDUWD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPHADDUWQ:
-            tritonId = triton::arch::x86::ID_INS_VPHADDUWQ;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPHADDWD:
-            tritonId = triton::arch::x86::ID_INS_VPHADDWD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPHADDWQ:
-            tritonId = triton::arch::x86::ID_INS_VPHADDWQ;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPHADDW:
-            tritonId = triton::arch::x86::ID_INS_VPHADDW;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPHMINPOSUW:
-            tritonId = triton::arch::x86::ID_INS_VPHMINPOSUW;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPHSUBBW:
-            tritonId = triton::arch::x86::ID_INS_VPHSUBBW;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPHSUBDQ:
-            tritonId = triton::arch::x86::ID_INS_VPHSUBDQ;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPHSUBD:
-            tritonId = triton::arch::x86::ID_INS_VPHSUBD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPHSUBSW:
-            tritonId = triton::arch::x86::ID_INS_VPHSUBSW;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPHSUBWD:
-            tritonId = triton::arch::x86::ID_INS_VPHSUBWD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPHSUBW:
-            tritonId = triton::arch::x86::ID_INS_VPHSUBW;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPINSRB:
-            tritonId = triton::arch::x86::ID_INS_VPINSRB;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPINSRD:
-            tritonId = triton::arch::x86::ID_INS_VPINSRD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPINSRQ:
-            tritonId = triton::arch::x86::ID_INS_VPINSRQ;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPINSRW:
-            tritonId = triton::arch::x86::ID_INS_VPINSRW;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPLZCNTD:
-            tritonId = triton::arch::x86::ID_INS_VPLZCNTD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPLZCNTQ:
-            tritonId = triton::arch::x86::ID_INS_VPLZCNTQ;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPMACSDD:
-            tritonId = triton::arch::x86::ID_INS_VPMACSDD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPMACSDQH:
-            tritonId = triton::arch::x86::ID_INS_VPMACSDQH;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPMACSDQL:
-            tritonId = triton::arch::x86::ID_INS_VPMACSDQL;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPMACSSDD:
-            tritonId = triton::arch::x86::ID_INS_VPMACSSDD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPMACSSDQH:
-            tritonId = triton::arch::x86::ID_INS_VPMACSSDQH;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPMACSSDQL:
-            tritonId = triton::arch::x86::ID_INS_VPMACSSDQL;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPMACSSWD:
-            tritonId = triton::arch::x86::ID_INS_VPMACSSWD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPMACSSWW:
-            tritonId = triton::arch::x86::ID_INS_VPMACSSWW;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPMACSWD:
-            tritonId = triton::arch::x86::ID_INS_VPMACSWD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPMACSWW:
-            tritonId = triton::arch::x86::ID_INS_VPMACSWW;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPMADCSSWD:
-            tritonId = triton::arch::x86::ID_INS_VPMADCSSWD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPMADCSWD:
-            tritonId = triton::arch::x86::ID_INS_VPMADCSWD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPMADDUBSW:
-            tritonId = triton::arch::x86::ID_INS_VPMADDUBSW;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPMADDWD:
-            tritonId = triton::arch::x86::ID_INS_VPMADDWD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPMASKMOVD:
-            tritonId = triton::arch::x86::ID_INS_VPMASKMOVD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPMASKMOVQ:
-            tritonId = triton::arch::x86::ID_INS_VPMASKMOVQ;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPMAXSB:
-            tritonId = triton::arch::x86::ID_INS_VPMAXSB;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPMAXSD:
-            tritonId = triton::arch::x86::ID_INS_VPMAXSD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPMAXSQ:
-            tritonId = triton::arch::x86::ID_INS_VPMAXSQ;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPMAXSW:
-            tritonId = triton::arch::x86::ID_INS_VPMAXSW;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPMAXUB:
-            tritonId = triton::arch::x86::ID_INS_VPMAXUB;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPMAXUD:
-            tritonId = triton::arch::x86::ID_INS_VPMAXUD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPMAXUQ:
-            tritonId = triton::arch::x86::ID_INS_VPMAXUQ;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPMAXUW:
-            tritonId = triton::arch::x86::ID_INS_VPMAXUW;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPMINSB:
-            tritonId = triton::arch::x86::ID_INS_VPMINSB;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPMINSD:
-            tritonId = triton::arch::x86::ID_INS_VPMINSD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPMINSQ:
-            tritonId = triton::arch::x86::ID_INS_VPMINSQ;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPMINSW:
-            tritonId = triton::arch::x86::ID_INS_VPMINSW;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPMINUB:
-            tritonId = triton::arch::x86::ID_INS_VPMINUB;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPMINUD:
-            tritonId = triton::arch::x86::ID_INS_VPMINUD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPMINUQ:
-            tritonId = triton::arch::x86::ID_INS_VPMINUQ;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPMINUW:
-            tritonId = triton::arch::x86::ID_INS_VPMINUW;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPMOVDB:
-            tritonId = triton::arch::x86::ID_INS_VPMOVDB;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPMOVDW:
-            tritonId = triton::arch::x86::ID_INS_VPMOVDW;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPMOVMSKB:
-            tritonId = triton::arch::x86::ID_INS_VPMOVMSKB;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPMOVQB:
-            tritonId = triton::arch::x86::ID_INS_VPMOVQB;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPMOVQD:
-            tritonId = triton::arch::x86::ID_INS_VPMOVQD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPMOVQW:
-            tritonId = triton::arch::x86::ID_INS_VPMOVQW;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPMOVSDB:
-            tritonId = triton::arch::x86::ID_INS_VPMOVSDB;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPMOVSDW:
-            tritonId = triton::arch::x86::ID_INS_VPMOVSDW;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPMOVSQB:
-            tritonId = triton::arch::x86::ID_INS_VPMOVSQB;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPMOVSQD:
-            tritonId = triton::arch::x86::ID_INS_VPMOVSQD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPMOVSQW:
-            tritonId = triton::arch::x86::ID_INS_VPMOVSQW;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPMOVSXBD:
-            tritonId = triton::arch::x86::ID_INS_VPMOVSXBD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPMOVSXBQ:
-            tritonId = triton::arch::x86::ID_INS_VPMOVSXBQ;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPMOVSXBW:
-            tritonId = triton::arch::x86::ID_INS_VPMOVSXBW;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPMOVSXDQ:
-            tritonId = triton::arch::x86::ID_INS_VPMOVSXDQ;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPMOVSXWD:
-            tritonId = triton::arch::x86::ID_INS_VPMOVSXWD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPMOVSXWQ:
-            tritonId = triton::arch::x86::ID_INS_VPMOVSXWQ;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPMOVUSDB:
-            tritonId = triton::arch::x86::ID_INS_VPMOVUSDB;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPMOVUSDW:
-            tritonId = triton::arch::x86::ID_INS_VPMOVUSDW;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPMOVUSQB:
-            tritonId = triton::arch::x86::ID_INS_VPMOVUSQB;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPMOVUSQD:
-            tritonId = triton::arch::x86::ID_INS_VPMOVUSQD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPMOVUSQW:
-            tritonId = triton::arch::x86::ID_INS_VPMOVUSQW;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPMOVZXBD:
-            tritonId = triton::arch::x86::ID_INS_VPMOVZXBD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPMOVZXBQ:
-            tritonId = triton::arch::x86::ID_INS_VPMOVZXBQ;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPMOVZXBW:
-            tritonId = triton::arch::x86::ID_INS_VPMOVZXBW;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPMOVZXDQ:
-            tritonId = triton::arch::x86::ID_INS_VPMOVZXDQ;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPMOVZXWD:
-            tritonId = triton::arch::x86::ID_INS_VPMOVZXWD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPMOVZXWQ:
-            tritonId = triton::arch::x86::ID_INS_VPMOVZXWQ;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPMULDQ:
-            tritonId = triton::arch::x86::ID_INS_VPMULDQ;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPMULHRSW:
-            tritonId = triton::arch::x86::ID_INS_VPMULHRSW;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPMULHUW:
-            tritonId = triton::arch::x86::ID_INS_VPMULHUW;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPMULHW:
-            tritonId = triton::arch::x86::ID_INS_VPMULHW;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPMULLD:
-            tritonId = triton::arch::x86::ID_INS_VPMULLD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPMULLW:
-            tritonId = triton::arch::x86::ID_INS_VPMULLW;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPMULUDQ:
-            tritonId = triton::arch::x86::ID_INS_VPMULUDQ;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPORD:
-            tritonId = triton::arch::x86::ID_INS_VPORD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPORQ:
-            tritonId = triton::arch::x86::ID_INS_VPORQ;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPOR:
-            tritonId = triton::arch::x86::ID_INS_VPOR;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPPERM:
-            tritonId = triton::arch::x86::ID_INS_VPPERM;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPROTB:
-            tritonId = triton::arch::x86::ID_INS_VPROTB;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPROTD:
-            tritonId = triton::arch::x86::ID_INS_VPROTD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPROTQ:
-            tritonId = triton::arch::x86::ID_INS_VPROTQ;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPROTW:
-            tritonId = triton::arch::x86::ID_INS_VPROTW;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPSADBW:
-            tritonId = triton::arch::x86::ID_INS_VPSADBW;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPSCATTERDD:
-            tritonId = triton::arch::x86::ID_INS_VPSCATTERDD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPSCATTERDQ:
-            tritonId = triton::arch::x86::ID_INS_VPSCATTERDQ;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPSCATTERQD:
-            tritonId = triton::arch::x86::ID_INS_VPSCATTERQD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPSCATTERQQ:
-            tritonId = triton::arch::x86::ID_INS_VPSCATTERQQ;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPSHAB:
-            tritonId = triton::arch::x86::ID_INS_VPSHAB;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPSHAD:
-            tritonId = triton::arch::x86::ID_INS_VPSHAD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPSHAQ:
-            tritonId = triton::arch::x86::ID_INS_VPSHAQ;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPSHAW:
-            tritonId = triton::arch::x86::ID_INS_VPSHAW;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPSHLB:
-            tritonId = triton::arch::x86::ID_INS_VPSHLB;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPSHLD:
-            tritonId = triton::arch::x86::ID_INS_VPSHLD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPSHLQ:
-            tritonId = triton::arch::x86::ID_INS_VPSHLQ;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPSHLW:
-            tritonId = triton::arch::x86::ID_INS_VPSHLW;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPSHUFB:
-            tritonId = triton::arch::x86::ID_INS_VPSHUFB;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPSHUFD:
-            tritonId = triton::arch::x86::ID_INS_VPSHUFD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPSHUFHW:
-            tritonId = triton::arch::x86::ID_INS_VPSHUFHW;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPSHUFLW:
-            tritonId = triton::arch::x86::ID_INS_VPSHUFLW;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPSIGNB:
-            tritonId = triton::arch::x86::ID_INS_VPSIGNB;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPSIGND:
-            tritonId = triton::arch::x86::ID_INS_VPSIGND;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPSIGNW:
-            tritonId = triton::arch::x86::ID_INS_VPSIGNW;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPSLLDQ:
-            tritonId = triton::arch::x86::ID_INS_VPSLLDQ;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPSLLD:
-            tritonId = triton::arch::x86::ID_INS_VPSLLD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPSLLQ:
-            tritonId = triton::arch::x86::ID_INS_VPSLLQ;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPSLLVD:
-            tritonId = triton::arch::x86::ID_INS_VPSLLVD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPSLLVQ:
-            tritonId = triton::arch::x86::ID_INS_VPSLLVQ;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPSLLW:
-            tritonId = triton::arch::x86::ID_INS_VPSLLW;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPSRAD:
-            tritonId = triton::arch::x86::ID_INS_VPSRAD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPSRAQ:
-            tritonId = triton::arch::x86::ID_INS_VPSRAQ;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPSRAVD:
-            tritonId = triton::arch::x86::ID_INS_VPSRAVD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPSRAVQ:
-            tritonId = triton::arch::x86::ID_INS_VPSRAVQ;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPSRAW:
-            tritonId = triton::arch::x86::ID_INS_VPSRAW;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPSRLDQ:
-            tritonId = triton::arch::x86::ID_INS_VPSRLDQ;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPSRLD:
-            tritonId = triton::arch::x86::ID_INS_VPSRLD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPSRLQ:
-            tritonId = triton::arch::x86::ID_INS_VPSRLQ;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPSRLVD:
-            tritonId = triton::arch::x86::ID_INS_VPSRLVD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPSRLVQ:
-            tritonId = triton::arch::x86::ID_INS_VPSRLVQ;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPSRLW:
-            tritonId = triton::arch::x86::ID_INS_VPSRLW;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPSUBB:
-            tritonId = triton::arch::x86::ID_INS_VPSUBB;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPSUBD:
-            tritonId = triton::arch::x86::ID_INS_VPSUBD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPSUBQ:
-            tritonId = triton::arch::x86::ID_INS_VPSUBQ;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPSUBSB:
-            tritonId = triton::arch::x86::ID_INS_VPSUBSB;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPSUBSW:
-            tritonId = triton::arch::x86::ID_INS_VPSUBSW;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPSUBUSB:
-            tritonId = triton::arch::x86::ID_INS_VPSUBUSB;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPSUBUSW:
-            tritonId = triton::arch::x86::ID_INS_VPSUBUSW;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPSUBW:
-            tritonId = triton::arch::x86::ID_INS_VPSUBW;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPTESTMD:
-            tritonId = triton::arch::x86::ID_INS_VPTESTMD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPTESTMQ:
-            tritonId = triton::arch::x86::ID_INS_VPTESTMQ;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPTESTNMD:
-            tritonId = triton::arch::x86::ID_INS_VPTESTNMD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPTESTNMQ:
-            tritonId = triton::arch::x86::ID_INS_VPTESTNMQ;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPTEST:
-            tritonId = triton::arch::x86::ID_INS_VPTEST;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPUNPCKHBW:
-            tritonId = triton::arch::x86::ID_INS_VPUNPCKHBW;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPUNPCKHDQ:
-            tritonId = triton::arch::x86::ID_INS_VPUNPCKHDQ;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPUNPCKHQDQ:
-            tritonId = triton::arch::x86::ID_INS_VPUNPCKHQDQ;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPUNPCKHWD:
-            tritonId = triton::arch::x86::ID_INS_VPUNPCKHWD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPUNPCKLBW:
-            tritonId = triton::arch::x86::ID_INS_VPUNPCKLBW;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPUNPCKLDQ:
-            tritonId = triton::arch::x86::ID_INS_VPUNPCKLDQ;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPUNPCKLQDQ:
-            tritonId = triton::arch::x86::ID_INS_VPUNPCKLQDQ;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPUNPCKLWD:
-            tritonId = triton::arch::x86::ID_INS_VPUNPCKLWD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPXORD:
-            tritonId = triton::arch::x86::ID_INS_VPXORD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPXORQ:
-            tritonId = triton::arch::x86::ID_INS_VPXORQ;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VPXOR:
-            tritonId = triton::arch::x86::ID_INS_VPXOR;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VRCP14PD:
-            tritonId = triton::arch::x86::ID_INS_VRCP14PD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VRCP14PS:
-            tritonId = triton::arch::x86::ID_INS_VRCP14PS;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VRCP14SD:
-            tritonId = triton::arch::x86::ID_INS_VRCP14SD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VRCP14SS:
-            tritonId = triton::arch::x86::ID_INS_VRCP14SS;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VRCP28PD:
-            tritonId = triton::arch::x86::ID_INS_VRCP28PD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VRCP28PS:
-            tritonId = triton::arch::x86::ID_INS_VRCP28PS;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VRCP28SD:
-            tritonId = triton::arch::x86::ID_INS_VRCP28SD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VRCP28SS:
-            tritonId = triton::arch::x86::ID_INS_VRCP28SS;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VRCPPS:
-            tritonId = triton::arch::x86::ID_INS_VRCPPS;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VRCPSS:
-            tritonId = triton::arch::x86::ID_INS_VRCPSS;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VRNDSCALEPD:
-            tritonId = triton::arch::x86::ID_INS_VRNDSCALEPD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VRNDSCALEPS:
-            tritonId = triton::arch::x86::ID_INS_VRNDSCALEPS;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VRNDSCALESD:
-            tritonId = triton::arch::x86::ID_INS_VRNDSCALESD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VRNDSCALESS:
-            tritonId = triton::arch::x86::ID_INS_VRNDSCALESS;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VROUNDPD:
-            tritonId = triton::arch::x86::ID_INS_VROUNDPD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VROUNDPS:
-            tritonId = triton::arch::x86::ID_INS_VROUNDPS;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VROUNDSD:
-            tritonId = triton::arch::x86::ID_INS_VROUNDSD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VROUNDSS:
-            tritonId = triton::arch::x86::ID_INS_VROUNDSS;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VRSQRT14PD:
-            tritonId = triton::arch::x86::ID_INS_VRSQRT14PD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VRSQRT14PS:
-            tritonId = triton::arch::x86::ID_INS_VRSQRT14PS;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VRSQRT14SD:
-            tritonId = triton::arch::x86::ID_INS_VRSQRT14SD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VRSQRT14SS:
-            tritonId = triton::arch::x86::ID_INS_VRSQRT14SS;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VRSQRT28PD:
-            tritonId = triton::arch::x86::ID_INS_VRSQRT28PD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VRSQRT28PS:
-            tritonId = triton::arch::x86::ID_INS_VRSQRT28PS;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VRSQRT28SD:
-            tritonId = triton::arch::x86::ID_INS_VRSQRT28SD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VRSQRT28SS:
-            tritonId = triton::arch::x86::ID_INS_VRSQRT28SS;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VRSQRTPS:
-            tritonId = triton::arch::x86::ID_INS_VRSQRTPS;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VRSQRTSS:
-            tritonId = triton::arch::x86::ID_INS_VRSQRTSS;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VSCATTERDPD:
-            tritonId = triton::arch::x86::ID_INS_VSCATTERDPD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VSCATTERDPS:
-            tritonId = triton::arch::x86::ID_INS_VSCATTERDPS;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VSCATTERPF0DPD:
-            tritonId = triton::arch::x86::ID_INS_VSCATTERPF0DPD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VSCATTERPF0DPS:
-            tritonId = triton::arch::x86::ID_INS_VSCATTERPF0DPS;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VSCATTERPF0QPD:
-            tritonId = triton::arch::x86::ID_INS_VSCATTERPF0QPD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VSCATTERPF0QPS:
-            tritonId = triton::arch::x86::ID_INS_VSCATTERPF0QPS;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VSCATTERPF1DPD:
-            tritonId = triton::arch::x86::ID_INS_VSCATTERPF1DPD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VSCATTERPF1DPS:
-            tritonId = triton::arch::x86::ID_INS_VSCATTERPF1DPS;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VSCATTERPF1QPD:
-            tritonId = triton::arch::x86::ID_INS_VSCATTERPF1QPD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VSCATTERPF1QPS:
-            tritonId = triton::arch::x86::ID_INS_VSCATTERPF1QPS;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VSCATTERQPD:
-            tritonId = triton::arch::x86::ID_INS_VSCATTERQPD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VSCATTERQPS:
-            tritonId = triton::arch::x86::ID_INS_VSCATTERQPS;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VSHUFPD:
-            tritonId = triton::arch::x86::ID_INS_VSHUFPD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VSHUFPS:
-            tritonId = triton::arch::x86::ID_INS_VSHUFPS;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VSQRTPD:
-            tritonId = triton::arch::x86::ID_INS_VSQRTPD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VSQRTPS:
-            tritonId = triton::arch::x86::ID_INS_VSQRTPS;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VSQRTSD:
-            tritonId = triton::arch::x86::ID_INS_VSQRTSD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VSQRTSS:
-            tritonId = triton::arch::x86::ID_INS_VSQRTSS;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VSTMXCSR:
-            tritonId = triton::arch::x86::ID_INS_VSTMXCSR;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VSUBPD:
-            tritonId = triton::arch::x86::ID_INS_VSUBPD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VSUBPS:
-            tritonId = triton::arch::x86::ID_INS_VSUBPS;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VSUBSD:
-            tritonId = triton::arch::x86::ID_INS_VSUBSD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VSUBSS:
-            tritonId = triton::arch::x86::ID_INS_VSUBSS;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VTESTPD:
-            tritonId = triton::arch::x86::ID_INS_VTESTPD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VTESTPS:
-            tritonId = triton::arch::x86::ID_INS_VTESTPS;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VUNPCKHPD:
-            tritonId = triton::arch::x86::ID_INS_VUNPCKHPD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VUNPCKHPS:
-            tritonId = triton::arch::x86::ID_INS_VUNPCKHPS;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VUNPCKLPD:
-            tritonId = triton::arch::x86::ID_INS_VUNPCKLPD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VUNPCKLPS:
-            tritonId = triton::arch::x86::ID_INS_VUNPCKLPS;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VZEROALL:
-            tritonId = triton::arch::x86::ID_INS_VZEROALL;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_VZEROUPPER:
-            tritonId = triton::arch::x86::ID_INS_VZEROUPPER;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_WAIT:
-            tritonId = triton::arch::x86::ID_INS_WAIT;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_WBINVD:
-            tritonId = triton::arch::x86::ID_INS_WBINVD;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_WRFSBASE:
-            tritonId = triton::arch::x86::ID_INS_WRFSBASE;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_WRGSBASE:
-            tritonId = triton::arch::x86::ID_INS_WRGSBASE;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_WRMSR:
-            tritonId = triton::arch::x86::ID_INS_WRMSR;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_XABORT:
-            tritonId = triton::arch::x86::ID_INS_XABORT;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_XACQUIRE:
-            tritonId = triton::arch::x86::ID_INS_XACQUIRE;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_XBEGIN:
-            tritonId = triton::arch::x86::ID_INS_XBEGIN;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_XCHG:
-            tritonId = triton::arch::x86::ID_INS_XCHG;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_FXCH:
-            tritonId = triton::arch::x86::ID_INS_FXCH;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_XCRYPTCBC:
-            tritonId = triton::arch::x86::ID_INS_XCRYPTCBC;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_XCRYPTCFB:
-            tritonId = triton::arch::x86::ID_INS_XCRYPTCFB;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_XCRYPTCTR:
-            tritonId = triton::arch::x86::ID_INS_XCRYPTCTR;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_XCRYPTECB:
-            tritonId = triton::arch::x86::ID_INS_XCRYPTECB;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_XCRYPTOFB:
-            tritonId = triton::arch::x86::ID_INS_XCRYPTOFB;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_XEND:
-            tritonId = triton::arch::x86::ID_INS_XEND;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_XGETBV:
-            tritonId = triton::arch::x86::ID_INS_XGETBV;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_XLATB:
-            tritonId = triton::arch::x86::ID_INS_XLATB;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_XRELEASE:
-            tritonId = triton::arch::x86::ID_INS_XRELEASE;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_XRSTOR:
-            tritonId = triton::arch::x86::ID_INS_XRSTOR;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_XRSTOR64:
-            tritonId = triton::arch::x86::ID_INS_XRSTOR64;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_XSAVE:
-            tritonId = triton::arch::x86::ID_INS_XSAVE;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_XSAVE64:
-            tritonId = triton::arch::x86::ID_INS_XSAVE64;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_XSAVEOPT:
-            tritonId = triton::arch::x86::ID_INS_XSAVEOPT;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_XSAVEOPT64:
-            tritonId = triton::arch::x86::ID_INS_XSAVEOPT64;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_XSETBV:
-            tritonId = triton::arch::x86::ID_INS_XSETBV;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_XSHA1:
-            tritonId = triton::arch::x86::ID_INS_XSHA1;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_XSHA256:
-            tritonId = triton::arch::x86::ID_INS_XSHA256;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_XSTORE:
-            tritonId = triton::arch::x86::ID_INS_XSTORE;
-            break;
-
-          case triton::extlibs::capstone::X86_INS_XTEST:
-            tritonId = triton::arch::x86::ID_INS_XTEST;
-            break;
-
-          default:
-            tritonId = triton::arch::x86::ID_INST_INVALID;
-            break;
-
-        }
-        return tritonId;
+      triton::uint32 x86Specifications::capstoneInstructionToTritonInstruction(triton::uint32 id) const {
+        if (id >= capstoneInstructionTable.size())
+          return triton::arch::x86::ID_INST_INVALID;
+        return capstoneInstructionTable[id];
       }
 
 
@@ -5,12 +5,16 @@
 **  This program is under the terms of the BSD License.
 */
 
+#include <algorithm>
 #include <cmath>
+#include <limits>
 #include <new>
 
 #include <api.hpp>
 #include <ast.hpp>
 #include <astRepresentation.hpp>
+#include <astWord.hpp>
+#include <cpuSize.hpp>
 #include <exceptions.hpp>
 #include <tritonToZ3Ast.hpp>
 #include <z3Result.hpp>
@@ -20,38 +24,269 @@
 namespace triton {
   namespace ast {
 
+    /* ====== Evaluation of the words */
+
+
+    /*
+     * Evaluates the signed operations, the arithmetic shift and the rotations on values of `size`
+     * bits. Nodes up to 64 bits use `triton::uint64`, so they never build a `triton::uint512`.
+     */
+    template <typename T>
+    static T evaluateWord(enum kind_e kind, const T& a, const T& b, triton::uint32 size) {
+      typedef typename Word<T>::Signed S;
+
+      T mask = Word<T>::mask(size);
+      S op1  = 0;
+      S op2  = 0;
+
+      switch (kind) {
+        case BVASHR_NODE: {
+          bool sign = (((a >> (size - 1)) & 1) != 0);
+          if (b >= size)
+            return (sign ? mask : static_cast<T>(0));
+          triton::uint32 shift = Word<T>::toUint32(b);
+          T value = (a >> shift);
+          if (sign)
+            value |= (mask & ~(mask >> shift));
+          return value;
+        }
+
+        /* The rotation `b` is lesser than `size` */
+        case BVROL_NODE:
+          if (b == 0)
+            return a;
+          return (((a << Word<T>::toUint32(b)) | (a >> (size - Word<T>::toUint32(b)))) & mask);
+
+        case BVROR_NODE:
+          if (b == 0)
+            return a;
+          return (((a >> Word<T>::toUint32(b)) | (a << (size - Word<T>::toUint32(b)))) & mask);
+
+        default:
+          break;
+      }
+
+      op1 = Word<T>::toSigned(a, size);
+      op2 = Word<T>::toSigned(b, size);
+
+      switch (kind) {
+        case BVSGE_NODE:
+          return static_cast<T>(op1 >= op2);
+
+        case BVSGT_NODE:
+          return static_cast<T>(op1 > op2);
+
+        case BVSLE_NODE:
+          return static_cast<T>(op1 <= op2);
+
+        case BVSLT_NODE:
+          return static_cast<T>(op1 < op2);
+
+        /* A division by -1 is a negation, the native one would overflow on the lowest value */
+        case BVSDIV_NODE:
+          if (op2 == 0)
+            return (op1 < 0 ? static_cast<T>(1) : mask);
+          if (op2 == -1)
+            return ((static_cast<T>(0) - a) & mask);
+          return (Word<T>::fromSigned(op1 / op2) & mask);
+
+        /* The remainder has the sign of the divisor */
+        case BVSMOD_NODE: {
+          if (op2 == 0)
+            return a;
+          if (op2 == -1)
+            return 0;
+          S rem = (op1 % op2);
+          if (rem != 0 && ((rem < 0) != (op2 < 0)))
+            rem += op2;
+          return (Word<T>::fromSigned(rem) & mask);
+        }
+
+        /* The remainder has the sign of the dividend */
+        case BVSREM_NODE:
+          if (op2 == 0)
+            return a;
+          if (op2 == -1)
+            return 0;
+          return (Word<T>::fromSigned(op1 % op2) & mask);
+
+        default:
+          throw triton::exceptions::Ast("triton::ast::evaluateWord(): Invalid kind node.");
+      }
+    }
+
+
+    /* Returns true if the value of a node is not zero */
+    static inline bool isTrue(AbstractNode* node) {
+      if (node->getBitvectorSize() <= 64)
+        return node->evaluate64() != 0;
+      return node->evaluate() != 0;
+    }
+
+
     /* ====== Abstract node */
 
     AbstractNode::AbstractNode(enum kind_e kind) {
-      this->eval        = 0;
-      this->kind        = kind;
-      this->size        = 0;
-      this->symbolized  = false;
+      this->eval           = 0;
+      this->wideEval       = nullptr;
+      this->depth          = 1;
+      this->frozen         = false;
+      this->immortal       = false;
+      this->kind           = kind;
+      this->knownOnes      = 0;
+      this->knownZeros     = 0;
+      this->maximum        = 0xffffffffffffffff;
+      this->minimum        = 0;
+      this->referenceCount = 0;
+      this->size           = 0;
+      this->structuralHash = 0;
+      this->symbolized     = false;
+      this->unrolledSize   = 1;
+      this->variables      = nullptr;
     }
 
 
     AbstractNode::AbstractNode() {
-      this->eval        = 0;
-      this->kind        = UNDEFINED_NODE;
-      this->size        = 0;
-      this->symbolized  = false;
+      this->eval           = 0;
+      this->wideEval       = nullptr;
+      this->depth          = 1;
+      this->frozen         = false;
+      this->immortal       = false;
+      this->kind           = UNDEFINED_NODE;
+      this->knownOnes      = 0;
+      this->knownZeros     = 0;
+      this->maximum        = 0xffffffffffffffff;
+      this->minimum        = 0;
+      this->referenceCount = 0;
+      this->size           = 0;
+      this->structuralHash = 0;
+      this->symbolized     = false;
+      this->unrolledSize   = 1;
+      this->variables      = nullptr;
     }
 
 
     AbstractNode::AbstractNode(const AbstractNode& copy) {
-      this->eval        = copy.eval;
-      this->kind        = copy.kind;
-      this->parents     = copy.parents;
-      this->size        = copy.size;
-      this->symbolized  = copy.symbolized;
+      this->eval           = copy.eval;
+      this->wideEval       = nullptr;
+      this->depth          = copy.depth;
+      this->frozen         = false;
+      this->immortal       = false;
+      this->kind           = copy.kind;
+      this->knownOnes      = copy.knownOnes;
+      this->knownZeros     = copy.knownZeros;
+      this->maximum        = copy.maximum;
+      this->minimum        = copy.minimum;
+      this->parents        = copy.parents;
+      this->referenceCount = 0;
+      this->size           = copy.size;
+      this->structuralHash = 0;
+      this->symbolized     = copy.symbolized;
+      this->unrolledSize   = copy.unrolledSize;
+      this->variables      = copy.variables;
+
+      if (copy.wideEval != nullptr)
+        this->setEvaluation(*copy.wideEval);
 
       for (triton::uint32 index = 0; index < copy.childs.size(); index++)
-        this->childs.push_back(triton::ast::newInstance(copy.childs[index]));
+        this->addChild(triton::ast::newInstance(copy.childs[index]));
     }
 
 
     AbstractNode::~AbstractNode() {
-      /* virtual */
+      delete this->wideEval;
+    }
+
+
+    void* AbstractNode::operator new(std::size_t size) {
+      void* ptr = triton::ast::AstNodeAllocator::allocateOnHeap(size);
+      if (ptr == nullptr)
+        throw std::bad_alloc();
+      return ptr;
+    }
+
+
+    void* AbstractNode::operator new(std::size_t size, const std::nothrow_t&) throw() {
+      return triton::ast::AstNodeAllocator::allocateOnHeap(size);
+    }
+
+
+    void* AbstractNode::operator new(std::size_t size, AstNodeAllocator* allocator) throw() {
+      if (allocator == nullptr)
+        return triton::ast::AstNodeAllocator::allocateOnHeap(size);
+      return allocator->allocate(size);
+    }
+
+
+    void AbstractNode::operator delete(void* ptr) {
+      triton::ast::AstNodeAllocator::deallocate(ptr);
+    }
+
+
+    void AbstractNode::operator delete(void* ptr, const std::nothrow_t&) throw() {
+      triton::ast::AstNodeAllocator::deallocate(ptr);
+    }
+
+
+    void AbstractNode::operator delete(void* ptr, AstNodeAllocator* allocator) throw() {
+      triton::ast::AstNodeAllocator::deallocate(ptr);
+    }
+
+
+    triton::uint64 AbstractNode::getStructuralHash(void) const {
+      return this->structuralHash;
+    }
+
+
+    void AbstractNode::setStructuralHash(triton::uint64 hash) {
+      this->structuralHash = hash;
+    }
+
+
+    triton::uint32 AbstractNode::getReferenceCount(void) const {
+      return this->referenceCount.load(std::memory_order_acquire);
+    }
+
+
+    void AbstractNode::incReference(void) {
+      if (!this->immortal)
+        this->referenceCount.fetch_add(1, std::memory_order_relaxed);
+    }
+
+
+    triton::uint32 AbstractNode::decReference(void) {
+      triton::uint32 count = this->referenceCount.load(std::memory_order_relaxed);
+
+      /* Frozen nodes may be released by several states at once, the count never goes below 0 */
+      while (count && !this->immortal) {
+        if (this->referenceCount.compare_exchange_weak(count, count - 1, std::memory_order_acq_rel, std::memory_order_relaxed))
+          return count - 1;
+      }
+
+      return count;
+    }
+
+
+    bool AbstractNode::isImmortal(void) const {
+      return this->immortal;
+    }
+
+
+    void AbstractNode::setImmortal(void) {
+      /* A count of one is never dropped, so the node is never freed by the garbage collector */
+      this->immortal       = true;
+      this->referenceCount = 1;
+      this->parents.clear();
+    }
+
+
+    bool AbstractNode::isFrozen(void) const {
+      return this->frozen;
+    }
+
+
+    void AbstractNode::setFrozen(void) {
+      this->frozen = true;
     }
 
 
@@ -72,7 +307,20 @@ namespace triton {
     }
 
 
+    triton::uint64 AbstractNode::getBitvectorMask64(void) const {
+      if (this->size >= 64)
+        return 0xffffffffffffffff;
+      return ((static_cast<triton::uint64>(1) << this->size) - 1);
+    }
+
+
     bool AbstractNode::isSigned(void) const {
+      if (this->size == 0)
+        return false;
+
+      if (this->wideEval != nullptr)
+        return (((*this->wideEval >> (this->size-1)) & 1) != 0);
+
       if ((this->eval >> (this->size-1)) & 1)
         return true;
       return false;
@@ -84,38 +332,564 @@ namespace triton {
     }
 
 
+    const VariableSet* AbstractNode::getVariables(void) const {
+      return this->variables;
+    }
+
+
+    triton::uint32 AbstractNode::getDepth(void) const {
+      return this->depth;
+    }
+
+
+    triton::uint64 AbstractNode::getUnrolledSize(void) const {
+      return this->unrolledSize;
+    }
+
+
+    triton::uint64 AbstractNode::getKnownZeros(void) const {
+      return this->knownZeros;
+    }
+
+
+    triton::uint64 AbstractNode::getKnownOnes(void) const {
+      return this->knownOnes;
+    }
+
+
+    triton::uint64 AbstractNode::getMinimum(void) const {
+      return this->minimum;
+    }
+
+
+    triton::uint64 AbstractNode::getMaximum(void) const {
+      return this->maximum;
+    }
+
+
+    bool AbstractNode::isKnown(void) const {
+      return this->size != 0 && this->size <= 64 && (this->knownZeros | this->knownOnes) == this->getBitvectorMask64();
+    }
+
+
+    void AbstractNode::initMetrics(void) {
+      this->depth        = 1;
+      this->unrolledSize = 1;
+      this->variables    = nullptr;
+
+      for (triton::uint32 index = 0; index < this->childs.size(); index++) {
+        const AbstractNode* child = this->childs[index];
+
+        this->depth = std::max(this->depth, child->depth + 1);
+
+        /* A shared subtree is counted once per use, so the size saturates instead of wrapping */
+        if (child->unrolledSize > std::numeric_limits<triton::uint64>::max() - this->unrolledSize)
+          this->unrolledSize = std::numeric_limits<triton::uint64>::max();
+        else
+          this->unrolledSize += child->unrolledSize;
+
+        this->variables = VariableSet::merge(this->variables, child->variables);
+      }
+
+      this->initDomain();
+    }
+
+
+    /* Returns the mask of the size lowest bits */
+    static inline triton::uint64 domainMask(triton::uint32 size) {
+      return (size >= 64) ? 0xffffffffffffffff : ((static_cast<triton::uint64>(1) << size) - 1);
+    }
+
+
+    /* Returns true if the abstract value of a node is tracked */
+    static inline bool isTracked(const AbstractNode* node) {
+      return node->getBitvectorSize() != 0 && node->getBitvectorSize() <= 64;
+    }
+
+
+    /* Returns 1 if a logical node is known to be true, 0 if it is known to be false, -1 otherwise */
+    static inline triton::sint32 knownLogical(const AbstractNode* node) {
+      if (node->getKnownOnes() & 1)
+        return 1;
+      if (node->getKnownZeros() & 1)
+        return 0;
+      return -1;
+    }
+
+
+    /* Known bits of a + b + carry, a bit of the sum is known if the bits of a, b and the carry into it are known */
+    static void addKnownBits(triton::uint64 mask, triton::uint64 zeros0, triton::uint64 ones0, triton::uint64 zeros1, triton::uint64 ones1, bool carry, triton::uint64& zeros, triton::uint64& ones) {
+      triton::uint64 highest = ((~zeros0 & mask) + (~zeros1 & mask) + carry) & mask;
+      triton::uint64 lowest  = (ones0 + ones1 + carry) & mask;
+      triton::uint64 known   = (zeros0 | ones0) & (zeros1 | ones1) & (~(highest ^ zeros0 ^ zeros1) | (lowest ^ ones0 ^ ones1)) & mask;
+
+      zeros = ~lowest & known;
+      ones  = lowest & known;
+    }
+
+
+    /* Rotates the size lowest bits of a value to the left */
+    static inline triton::uint64 rotateLeft(triton::uint64 value, triton::uint32 rot, triton::uint32 size) {
+      if (rot == 0)
+        return value;
+      return ((value << rot) | (value >> (size - rot))) & domainMask(size);
+    }
+
+
+    /* The signed interval of a node, false if it holds both positive and negative values */
+    static bool signedInterval(const AbstractNode* node, triton::sint64& minimum, triton::sint64& maximum) {
+      triton::uint32 shift = 64 - node->getBitvectorSize();
+
+      if ((node->getMinimum() >> (node->getBitvectorSize() - 1)) != (node->getMaximum() >> (node->getBitvectorSize() - 1)))
+        return false;
+
+      minimum = static_cast<triton::sint64>(node->getMinimum() << shift) >> shift;
+      maximum = static_cast<triton::sint64>(node->getMaximum() << shift) >> shift;
+      return true;
+    }
+
+
+    void AbstractNode::initDomain(void) {
+      triton::uint64 mask    = this->getBitvectorMask64();
+      triton::uint64 zeros   = 0;
+      triton::uint64 ones    = 0;
+      triton::uint64 minimum = 0;
+      triton::uint64 maximum = mask;
+      triton::sint32 result  = -1;
+
+      /* The value of a tree without variable is known */
+      if (!this->symbolized || !isTracked(this)) {
+        this->setDomain(~this->eval, this->eval, this->eval, this->eval);
+        return;
+      }
+
+      const AbstractNode* a = (this->childs.size() > 0) ? this->childs[0] : nullptr;
+      const AbstractNode* b = (this->childs.size() > 1) ? this->childs[1] : nullptr;
+      const AbstractNode* c = (this->childs.size() > 2) ? this->childs[2] : nullptr;
+
+      switch (this->kind) {
+        case BVADD_NODE:
+          addKnownBits(mask, a->knownZeros, a->knownOnes, b->knownZeros, b->knownOnes, false, zeros, ones);
+          if (a->maximum <= mask - b->maximum) {
+            minimum = a->minimum + b->minimum;
+            maximum = a->maximum + b->maximum;
+          }
+          break;
+
+        /* a - b = a + ~b + 1 */
+        case BVSUB_NODE:
+          addKnownBits(mask, a->knownZeros, a->knownOnes, b->knownOnes, b->knownZeros, true, zeros, ones);
+          if (a->minimum >= b->maximum) {
+            minimum = a->minimum - b->maximum;
+            maximum = a->maximum - b->minimum;
+          }
+          break;
+
+        /* -a = 0 + ~a + 1 */
+        case BVNEG_NODE:
+          addKnownBits(mask, mask, 0, a->knownOnes, a->knownZeros, true, zeros, ones);
+          if (a->minimum != 0) {
+            minimum = mask - a->maximum + 1;
+            maximum = mask - a->minimum + 1;
+          }
+          break;
+
+        /* The trailing zeros add up */
+        case BVMUL_NODE: {
+          triton::uint32 trailing = 0;
+          while (trailing < this->size && ((a->knownZeros >> trailing) & 1))
+            trailing++;
+          for (triton::uint32 index = 0; index < this->size && ((b->knownZeros >> index) & 1); index++)
+            trailing++;
+          zeros = domainMask(std::min(trailing, this->size));
+          if (b->maximum == 0 || a->maximum <= mask / b->maximum) {
+            minimum = a->minimum * b->minimum;
+            maximum = a->maximum * b->maximum;
+          }
+          break;
+        }
+
+        case BVAND_NODE:
+        case BVNAND_NODE:
+          zeros   = a->knownZeros | b->knownZeros;
+          ones    = a->knownOnes & b->knownOnes;
+          maximum = std::min(a->maximum, b->maximum);
+          break;
+
+        case BVOR_NODE:
+        case BVNOR_NODE:
+          zeros   = a->knownZeros & b->knownZeros;
+          ones    = a->knownOnes | b->knownOnes;
+          minimum = std::max(a->minimum, b->minimum);
+          break;
+
+        case BVXOR_NODE:
+        case BVXNOR_NODE:
+          zeros = (a->knownZeros & b->knownZeros) | (a->knownOnes & b->knownOnes);
+          ones  = (a->knownZeros & b->knownOnes) | (a->knownOnes & b->knownZeros);
+          break;
+
+        case BVNOT_NODE:
+          zeros   = a->knownOnes;
+          ones    = a->knownZeros;
+          minimum = mask - a->maximum;
+          maximum = mask - a->minimum;
+          break;
+
+        /* Shifts by a known amount */
+        case BVSHL_NODE:
+        case BVLSHR_NODE:
+        case BVASHR_NODE: {
+          if (!b->isKnown()) {
+            if (this->kind == BVLSHR_NODE)
+              maximum = a->maximum;
+            break;
+          }
+          triton::uint64 shift = b->knownOnes;
+          if (this->kind == BVSHL_NODE) {
+            if (shift >= this->size) {
+              zeros = mask;
+              break;
+            }
+            zeros = (a->knownZeros << shift) | domainMask(static_cast<triton::uint32>(shift));
+            ones  = a->knownOnes << shift;
+            if (a->maximum <= (mask >> shift)) {
+              minimum = a->minimum << shift;
+              maximum = a->maximum << shift;
+            }
+          }
+          else if (this->kind == BVLSHR_NODE) {
+            if (shift >= this->size) {
+              zeros = mask;
+              break;
+            }
+            zeros   = (a->knownZeros >> shift) | (mask & ~(mask >> shift));
+            ones    = a->knownOnes >> shift;
+            minimum = a->minimum >> shift;
+            maximum = a->maximum >> shift;
+          }
+          else {
+            /* The sign bit is copied into the shifted bits */
+            shift = std::min<triton::uint64>(shift, this->size - 1);
+            zeros = a->knownZeros >> shift;
+            ones  = a->knownOnes >> shift;
+            if ((a->knownZeros >> (this->size - 1)) & 1)
+              zeros |= mask & ~(mask >> shift);
+            if ((a->knownOnes >> (this->size - 1)) & 1)
+              ones |= mask & ~(mask >> shift);
+          }
+          break;
+        }
+
+        case BVUDIV_NODE:
+          if (b->minimum != 0) {
+            minimum = a->minimum / b->maximum;
+            maximum = a->maximum / b->minimum;
+          }
+          break;
+
+        /* a % 0 = a */
+        case BVUREM_NODE:
+          maximum = (b->minimum != 0) ? std::min(a->maximum, b->maximum - 1) : a->maximum;
+          break;
+
+        case BVROL_NODE:
+        case BVROR_NODE: {
+          triton::uint32 rot = reinterpret_cast<DecimalNode*>(this->childs[0])->getValue().convert_to<triton::uint32>() % this->size;
+          if (this->kind == BVROR_NODE)
+            rot = (this->size - rot) % this->size;
+          zeros = rotateLeft(b->knownZeros, rot, this->size);
+          ones  = rotateLeft(b->knownOnes, rot, this->size);
+          break;
+        }
+
+        case ZX_NODE:
+          zeros   = b->knownZeros | (mask & ~b->getBitvectorMask64());
+          ones    = b->knownOnes;
+          minimum = b->minimum;
+          maximum = b->maximum;
+          break;
+
+        case SX_NODE: {
+          triton::uint64 extension = mask & ~b->getBitvectorMask64();
+          zeros = b->knownZeros;
+          ones  = b->knownOnes;
+          if ((b->knownZeros >> (b->size - 1)) & 1) {
+            zeros  |= extension;
+            minimum = b->minimum;
+            maximum = b->maximum;
+          }
+          if ((b->knownOnes >> (b->size - 1)) & 1) {
+            ones   |= extension;
+            minimum = b->minimum | extension;
+            maximum = b->maximum | extension;
+          }
+          break;
+        }
+
+        case EXTRACT_NODE: {
+          triton::uint32 low = reinterpret_cast<DecimalNode*>(this->childs[1])->getValue().convert_to<triton::uint32>();
+          if (!isTracked(c))
+            break;
+          zeros = c->knownZeros >> low;
+          ones  = c->knownOnes >> low;
+          /* The extraction of the lowest bits of a small value is the value */
+          if (low == 0 && c->maximum <= mask) {
+            minimum = c->minimum;
+            maximum = c->maximum;
+          }
+          break;
+        }
+
+        /* The first child holds the highest bits */
+        case CONCAT_NODE:
+          for (triton::uint32 index = 0; index < this->childs.size(); index++) {
+            const AbstractNode* child = this->childs[index];
+            if (child->size < 64) {
+              zeros <<= child->size;
+              ones  <<= child->size;
+            }
+            zeros |= child->knownZeros;
+            ones  |= child->knownOnes;
+          }
+          break;
+
+        case ITE_NODE:
+          if (knownLogical(a) != -1) {
+            const AbstractNode* branch = knownLogical(a) ? b : c;
+            zeros   = branch->knownZeros;
+            ones    = branch->knownOnes;
+            minimum = branch->minimum;
+            maximum = branch->maximum;
+          }
+          else {
+            zeros   = b->knownZeros & c->knownZeros;
+            ones    = b->knownOnes & c->knownOnes;
+            minimum = std::min(b->minimum, c->minimum);
+            maximum = std::max(b->maximum, c->maximum);
+          }
+          break;
+
+        case EQUAL_NODE:
+        case DISTINCT_NODE:
+          if (a == b)
+            result = 1;
+          else if (isTracked(a) && ((a->knownOnes & b->knownZeros) || (a->knownZeros & b->knownOnes) || a->maximum < b->minimum || b->maximum < a->minimum))
+            result = 0;
+          if (result != -1 && this->kind == DISTINCT_NODE)
+            result = !result;
+          break;
+
+        case BVUGE_NODE:
+        case BVUGT_NODE:
+        case BVULE_NODE:
+        case BVULT_NODE: {
+          /* a > b is b < a */
+          const AbstractNode* x = (this->kind == BVUGE_NODE || this->kind == BVUGT_NODE) ? b : a;
+          const AbstractNode* y = (x == a) ? b : a;
+          bool strict = (this->kind == BVUGT_NODE || this->kind == BVULT_NODE);
+          if (!isTracked(a))
+            break;
+          if (strict ? x->maximum < y->minimum : x->maximum <= y->minimum)
+            result = 1;
+          else if (strict ? x->minimum >= y->maximum : x->minimum > y->maximum)
+            result = 0;
+          break;
+        }
+
+        case BVSGE_NODE:
+        case BVSGT_NODE:
+        case BVSLE_NODE:
+        case BVSLT_NODE: {
+          const AbstractNode* x = (this->kind == BVSGE_NODE || this->kind == BVSGT_NODE) ? b : a;
+          const AbstractNode* y = (x == a) ? b : a;
+          bool strict = (this->kind == BVSGT_NODE || this->kind == BVSLT_NODE);
+          triton::sint64 xmin = 0, xmax = 0, ymin = 0, ymax = 0;
+          if (!isTracked(a) || !signedInterval(x, xmin, xmax) || !signedInterval(y, ymin, ymax))
+            break;
+          if (strict ? xmax < ymin : xmax <= ymin)
+            result = 1;
+          else if (strict ? xmin >= ymax : xmin > ymax)
+            result = 0;
+          break;
+        }
+
+        case LAND_NODE:
+        case LOR_NODE: {
+          /* The absorbing value of and is false, the one of or is true */
+          triton::sint32 absorbing = (this->kind == LOR_NODE);
+          result = !absorbing;
+          for (triton::uint32 index = 0; index < this->childs.size(); index++) {
+            triton::sint32 value = knownLogical(this->childs[index]);
+            if (value == absorbing) {
+              result = absorbing;
+              break;
+            }
+            if (value == -1)
+              result = -1;
+          }
+          break;
+        }
+
+        case LNOT_NODE:
+          result = knownLogical(a);
+          if (result != -1)
+            result = !result;
+          break;
+
+        default:
+          break;
+      }
+
+      /* The negated operators */
+      if (this->kind == BVNAND_NODE || this->kind == BVNOR_NODE || this->kind == BVXNOR_NODE) {
+        std::swap(zeros, ones);
+        triton::uint64 lowest = minimum;
+        minimum = mask - std::min(maximum, mask);
+        maximum = mask - lowest;
+      }
+
+      if (result != -1) {
+        zeros   = !result;
+        ones    = result;
+        minimum = result;
+        maximum = result;
+      }
+
+      this->setDomain(zeros, ones, minimum, maximum);
+    }
+
+
+    void AbstractNode::setDomain(triton::uint64 zeros, triton::uint64 ones, triton::uint64 minimum, triton::uint64 maximum) {
+      triton::uint64 mask = this->getBitvectorMask64();
+
+      if (!isTracked(this)) {
+        this->knownZeros = 0;
+        this->knownOnes  = 0;
+        this->minimum    = 0;
+        this->maximum    = 0xffffffffffffffff;
+        return;
+      }
+
+      /* The known bits bound the interval */
+      zeros  &= mask;
+      ones   &= mask;
+      minimum = std::max(minimum, ones);
+      maximum = std::min(maximum, ~zeros & mask);
+
+      /* Facts which contradict each other are forgotten, they do not happen unless a child is wrong */
+      if ((zeros & ones) != 0 || minimum > maximum) {
+        zeros   = 0;
+        ones    = 0;
+        minimum = 0;
+        maximum = mask;
+      }
+
+      /* The highest bits shared by the bounds of the interval are known */
+      triton::uint64 diff = minimum ^ maximum;
+      for (triton::uint32 shift = 1; shift < 64; shift <<= 1)
+        diff |= diff >> shift;
+
+      this->knownZeros = zeros | (~minimum & ~diff & mask);
+      this->knownOnes  = ones | (minimum & ~diff);
+      this->minimum    = minimum;
+      this->maximum    = maximum;
+    }
+
+
     triton::uint512 AbstractNode::evaluate(void) const {
+      if (this->wideEval != nullptr)
+        return *this->wideEval;
       return this->eval;
     }
 
 
+    triton::uint64 AbstractNode::evaluate64(void) const {
+      if (this->wideEval != nullptr)
+        return static_cast<triton::uint64>(*this->wideEval & 0xffffffffffffffff);
+      return this->eval;
+    }
+
+
+    void AbstractNode::setEvaluation(const triton::uint512& value) {
+      if (this->size <= 64) {
+        this->setEvaluation64(static_cast<triton::uint64>(value & 0xffffffffffffffff));
+        return;
+      }
+
+      if (this->wideEval == nullptr) {
+        this->wideEval = new(std::nothrow) triton::uint512(value);
+        if (this->wideEval == nullptr)
+          throw triton::exceptions::Ast("AbstractNode::setEvaluation(): Not enough memory.");
+      }
+      else
+        *this->wideEval = value;
+
+      this->eval = 0;
+    }
+
+
+    void AbstractNode::setEvaluation64(triton::uint64 value) {
+      if (this->wideEval != nullptr) {
+        delete this->wideEval;
+        this->wideEval = nullptr;
+      }
+      this->eval = value;
+    }
+
+
     std::vector<AbstractNode*>& AbstractNode::getChilds(void) {
       return this->childs;
     }
 
 
-    std::set<AbstractNode*>& AbstractNode::getParents(void) {
+    const std::vector<AbstractNode*>& AbstractNode::getParents(void) const {
       return this->parents;
     }
 
 
     void AbstractNode::setParent(AbstractNode* p) {
-      this->parents.insert(p);
+      /* An immortal node is shared by too many trees, it never changes so its parents are never updated */
+      if (this->immortal)
+        return;
+
+      /* A frozen node is shared read-only, the nodes built over it are not recorded */
+      if (this->frozen)
+        return;
+
+      /* Most nodes have one or two parents, a sorted vector avoids one allocation per edge */
+      std::vector<AbstractNode*>::iterator it = std::lower_bound(this->parents.begin(), this->parents.end(), p);
+      if (it == this->parents.end() || *it != p)
+        this->parents.insert(it, p);
     }
 
 
     void AbstractNode::removeParent(AbstractNode* p) {
-      this->parents.erase(p);
+      if (this->frozen)
+        return;
+
+      std::vector<AbstractNode*>::iterator it = std::lower_bound(this->parents.begin(), this->parents.end(), p);
+      if (it != this->parents.end() && *it == p)
+        this->parents.erase(it);
     }
 
 
-    void AbstractNode::setParent(std::set<AbstractNode*>& p) {
-      for (std::set<AbstractNode*>::iterator it = p.begin(); it != p.end(); it++)
-        this->parents.insert(*it);
+    void AbstractNode::clearParents(void) {
+      if (this->frozen)
+        return;
+
+      this->parents.clear();
+    }
+
+
+    void AbstractNode::setParent(const std::vector<AbstractNode*>& p) {
+      for (std::vector<AbstractNode*>::const_iterator it = p.begin(); it != p.end(); it++)
+        this->setParent(*it);
     }
 
 
     void AbstractNode::addChild(AbstractNode* child) {
+      child->incReference();
       this->childs.push_back(child);
     }
 
@@ -127,11 +901,19 @@ namespace triton {
       if (child == nullptr)
         throw triton::exceptions::Ast("AbstractNode::setChild(): child cannot be null.");
 
+      if (this->immortal)
+        throw triton::exceptions::Ast("AbstractNode::setChild(): An immortal node cannot be modified.");
+
+      if (this->frozen)
+        throw triton::exceptions::Ast("AbstractNode::setChild(): A frozen node cannot be modified.");
+
       /* Setup the parent of the child */
       child->setParent(this);
+      child->incReference();
 
       /* Remove the parent of the old child */
       this->childs[index]->removeParent(this);
+      this->childs[index]->decReference();
 
       /* Setup the child of the parent */
       this->childs[index] = child;
@@ -143,6 +925,69 @@ namespace triton {
     }
 
 
+    /* ====== array */
+
+
+    ArrayNode::ArrayNode(triton::uint32 indexSize, std::string name) {
+      this->kind      = ARRAY_NODE;
+      this->indexSize = indexSize;
+      this->name      = name;
+      this->init();
+    }
+
+
+    ArrayNode::ArrayNode(const ArrayNode& copy) : AbstractNode(copy) {
+      this->indexSize = copy.indexSize;
+      this->name      = copy.name;
+    }
+
+
+    ArrayNode::~ArrayNode() {
+    }
+
+
+    void ArrayNode::init(void) {
+      if (this->indexSize == 0 || this->indexSize > QWORD_SIZE_BIT)
+        throw triton::exceptions::Ast("ArrayNode::init(): The size of the indexes must be between 1 and 64 bits.");
+
+      /* Init attributes. An array is not a bitvector and its cells are unknown. */
+      this->size        = 0;
+      this->symbolized  = true;
+      this->setEvaluation64(0);
+
+      /* Init the depth and the unrolled size */
+      this->initMetrics();
+
+      /* Init parents */
+      for (triton::uint32 index = 0; index < this->parents.size(); index++)
+        this->parents[index]->init();
+    }
+
+
+    triton::uint32 ArrayNode::getIndexSize(void) {
+      return this->indexSize;
+    }
+
+
+    std::string ArrayNode::getName(void) {
+      return this->name;
+    }
+
+
+    void ArrayNode::accept(AstVisitor& v) {
+      v(*this);
+    }
+
+
+    triton::uint512 ArrayNode::hash(triton::uint32 deep) {
+      triton::uint512 h = this->kind * this->indexSize;
+      triton::uint32 index = 1;
+      for (std::string::iterator it = this->name.begin(); it != this->name.end(); it++)
+        h = h ^ triton::ast::pow(*it, index++);
+      return triton::ast::rotl(h, deep);
+    }
+
+
     /* ====== assert */
 
 
@@ -167,7 +1012,7 @@ namespace triton {
 
       /* Init attributes */
       this->size = 1;
-      this->eval = 0;
+      this->setEvaluation64(0);
 
       /* Init childs and spread information */
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
@@ -175,9 +1020,12 @@ namespace triton {
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
+      /* Init the depth and the unrolled size */
+      this->initMetrics();
+
       /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      for (triton::uint32 index = 0; index < this->parents.size(); index++)
+        this->parents[index]->init();
     }
 
 
@@ -223,7 +1071,10 @@ namespace triton {
 
       /* Init attributes */
       this->size = this->childs[0]->getBitvectorSize();
-      this->eval = ((this->childs[0]->evaluate() + this->childs[1]->evaluate()) & this->getBitvectorMask());
+      if (this->size <= 64)
+        this->setEvaluation64((this->childs[0]->evaluate64() + this->childs[1]->evaluate64()) & this->getBitvectorMask64());
+      else
+        this->setEvaluation((this->childs[0]->evaluate() + this->childs[1]->evaluate()) & this->getBitvectorMask());
 
       /* Init childs and spread information */
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
@@ -231,9 +1082,12 @@ namespace triton {
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
+      /* Init the depth and the unrolled size */
+      this->initMetrics();
+
       /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      for (triton::uint32 index = 0; index < this->parents.size(); index++)
+        this->parents[index]->init();
     }
 
 
@@ -279,7 +1133,10 @@ namespace triton {
 
       /* Init attributes */
       this->size = this->childs[0]->getBitvectorSize();
-      this->eval = (this->childs[0]->evaluate() & this->childs[1]->evaluate());
+      if (this->size <= 64)
+        this->setEvaluation64(this->childs[0]->evaluate64() & this->childs[1]->evaluate64());
+      else
+        this->setEvaluation(this->childs[0]->evaluate() & this->childs[1]->evaluate());
 
       /* Init childs and spread information */
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
@@ -287,9 +1144,12 @@ namespace triton {
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
+      /* Init the depth and the unrolled size */
+      this->initMetrics();
+
       /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      for (triton::uint32 index = 0; index < this->parents.size(); index++)
+        this->parents[index]->init();
     }
 
 
@@ -328,9 +1188,7 @@ namespace triton {
 
 
     void BvashrNode::init(void) {
-      triton::uint32 shift  = 0;
-      triton::uint512 mask  = 0;
-      triton::uint512 value = 0;
+      triton::uint32 size = 0;
 
       if (this->childs.size() < 2)
         throw triton::exceptions::Ast("BvashrNode::init(): Must take at least two childs.");
@@ -338,37 +1196,13 @@ namespace triton {
       if (this->childs[0]->getBitvectorSize() != this->childs[1]->getBitvectorSize())
         throw triton::exceptions::Ast("BvashrNode::init(): Must take two nodes of same size.");
 
-      value = this->childs[0]->evaluate();
-      shift = this->childs[1]->evaluate().convert_to<triton::uint32>();
-
       /* Init attributes */
+      size = this->childs[0]->getBitvectorSize();
       this->size = this->childs[0]->getBitvectorSize();
-
-      /* Mask based on the sign */
-      if (this->childs[0]->isSigned()) {
-        mask = 1;
-        mask = ((mask << (this->size-1)) & this->getBitvectorMask());
-      }
-
-      if (shift >= this->size && this->childs[0]->isSigned()) {
-        this->eval = -1;
-        this->eval &= this->getBitvectorMask();
-      }
-
-      else if (shift >= this->size && !this->childs[0]->isSigned()) {
-        this->eval = 0;
-      }
-
-      else if (shift == 0) {
-        this->eval = value;
-      }
-
-      else {
-        this->eval = value & this->getBitvectorMask();
-        for (triton::uint32 index = 0; index < shift; index++) {
-          this->eval = (((this->eval >> 1) | mask) & this->getBitvectorMask());
-        }
-      }
+      if (size <= 64)
+        this->setEvaluation64(evaluateWord<triton::uint64>(this->kind, this->childs[0]->evaluate64(), this->childs[1]->evaluate64(), size));
+      else
+        this->setEvaluation(evaluateWord<triton::uint512>(this->kind, this->childs[0]->evaluate(), this->childs[1]->evaluate(), size));
 
       /* Init childs and spread information */
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
@@ -376,9 +1210,12 @@ namespace triton {
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
+      /* Init the depth and the unrolled size */
+      this->initMetrics();
+
       /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      for (triton::uint32 index = 0; index < this->parents.size(); index++)
+        this->parents[index]->init();
     }
 
 
@@ -432,7 +1269,7 @@ namespace triton {
 
       /* Init attributes */
       this->size = size;
-      this->eval = 0;
+      this->setEvaluation(0);
 
       /* Init childs and spread information */
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
@@ -440,9 +1277,12 @@ namespace triton {
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
+      /* Init the depth and the unrolled size */
+      this->initMetrics();
+
       /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      for (triton::uint32 index = 0; index < this->parents.size(); index++)
+        this->parents[index]->init();
     }
 
 
@@ -488,7 +1328,10 @@ namespace triton {
 
       /* Init attributes */
       this->size = this->childs[0]->getBitvectorSize();
-      this->eval = (this->childs[0]->evaluate() >> this->childs[1]->evaluate().convert_to<triton::uint32>());
+      if (this->size <= 64)
+        this->setEvaluation64((this->childs[1]->evaluate64() >= 64) ? 0 : (this->childs[0]->evaluate64() >> this->childs[1]->evaluate64()));
+      else
+        this->setEvaluation(this->childs[0]->evaluate() >> this->childs[1]->evaluate().convert_to<triton::uint32>());
 
       /* Init childs and spread information */
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
@@ -496,9 +1339,12 @@ namespace triton {
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
+      /* Init the depth and the unrolled size */
+      this->initMetrics();
+
       /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      for (triton::uint32 index = 0; index < this->parents.size(); index++)
+        this->parents[index]->init();
     }
 
 
@@ -544,7 +1390,10 @@ namespace triton {
 
       /* Init attributes */
       this->size = this->childs[0]->getBitvectorSize();
-      this->eval = ((this->childs[0]->evaluate() * this->childs[1]->evaluate()) & this->getBitvectorMask());
+      if (this->size <= 64)
+        this->setEvaluation64((this->childs[0]->evaluate64() * this->childs[1]->evaluate64()) & this->getBitvectorMask64());
+      else
+        this->setEvaluation((this->childs[0]->evaluate() * this->childs[1]->evaluate()) & this->getBitvectorMask());
 
       /* Init childs and spread information */
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
@@ -552,9 +1401,12 @@ namespace triton {
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
+      /* Init the depth and the unrolled size */
+      this->initMetrics();
+
       /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      for (triton::uint32 index = 0; index < this->parents.size(); index++)
+        this->parents[index]->init();
     }
 
 
@@ -600,7 +1452,10 @@ namespace triton {
 
       /* Init attributes */
       this->size = this->childs[0]->getBitvectorSize();
-      this->eval = (~(this->childs[0]->evaluate() & this->childs[1]->evaluate()) & this->getBitvectorMask());
+      if (this->size <= 64)
+        this->setEvaluation64(~(this->childs[0]->evaluate64() & this->childs[1]->evaluate64()) & this->getBitvectorMask64());
+      else
+        this->setEvaluation(~(this->childs[0]->evaluate() & this->childs[1]->evaluate()) & this->getBitvectorMask());
 
       /* Init childs and spread information */
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
@@ -608,9 +1463,12 @@ namespace triton {
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
+      /* Init the depth and the unrolled size */
+      this->initMetrics();
+
       /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      for (triton::uint32 index = 0; index < this->parents.size(); index++)
+        this->parents[index]->init();
     }
 
 
@@ -652,7 +1510,10 @@ namespace triton {
 
       /* Init attributes */
       this->size = this->childs[0]->getBitvectorSize();
-      this->eval = ((-(this->childs[0]->evaluate().convert_to<triton::sint512>())).convert_to<triton::uint512>() & this->getBitvectorMask());
+      if (this->size <= 64)
+        this->setEvaluation64((0 - this->childs[0]->evaluate64()) & this->getBitvectorMask64());
+      else
+        this->setEvaluation((-(this->childs[0]->evaluate().convert_to<triton::sint512>())).convert_to<triton::uint512>() & this->getBitvectorMask());
 
       /* Init childs and spread information */
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
@@ -660,9 +1521,12 @@ namespace triton {
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
+      /* Init the depth and the unrolled size */
+      this->initMetrics();
+
       /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      for (triton::uint32 index = 0; index < this->parents.size(); index++)
+        this->parents[index]->init();
     }
 
 
@@ -708,7 +1572,10 @@ namespace triton {
 
       /* Init attributes */
       this->size = this->childs[0]->getBitvectorSize();
-      this->eval = (~(this->childs[0]->evaluate() | this->childs[1]->evaluate()) & this->getBitvectorMask());
+      if (this->size <= 64)
+        this->setEvaluation64(~(this->childs[0]->evaluate64() | this->childs[1]->evaluate64()) & this->getBitvectorMask64());
+      else
+        this->setEvaluation(~(this->childs[0]->evaluate() | this->childs[1]->evaluate()) & this->getBitvectorMask());
 
       /* Init childs and spread information */
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
@@ -716,9 +1583,12 @@ namespace triton {
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
+      /* Init the depth and the unrolled size */
+      this->initMetrics();
+
       /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      for (triton::uint32 index = 0; index < this->parents.size(); index++)
+        this->parents[index]->init();
     }
 
 
@@ -760,7 +1630,10 @@ namespace triton {
 
       /* Init attributes */
       this->size = this->childs[0]->getBitvectorSize();
-      this->eval = (~this->childs[0]->evaluate() & this->getBitvectorMask());
+      if (this->size <= 64)
+        this->setEvaluation64(~this->childs[0]->evaluate64() & this->getBitvectorMask64());
+      else
+        this->setEvaluation(~this->childs[0]->evaluate() & this->getBitvectorMask());
 
       /* Init childs and spread information */
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
@@ -768,9 +1641,12 @@ namespace triton {
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
+      /* Init the depth and the unrolled size */
+      this->initMetrics();
+
       /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      for (triton::uint32 index = 0; index < this->parents.size(); index++)
+        this->parents[index]->init();
     }
 
 
@@ -816,7 +1692,10 @@ namespace triton {
 
       /* Init attributes */
       this->size = this->childs[0]->getBitvectorSize();
-      this->eval = (this->childs[0]->evaluate() | this->childs[1]->evaluate());
+      if (this->size <= 64)
+        this->setEvaluation64(this->childs[0]->evaluate64() | this->childs[1]->evaluate64());
+      else
+        this->setEvaluation(this->childs[0]->evaluate() | this->childs[1]->evaluate());
 
       /* Init childs and spread information */
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
@@ -824,9 +1703,12 @@ namespace triton {
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
+      /* Init the depth and the unrolled size */
+      this->initMetrics();
+
       /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      for (triton::uint32 index = 0; index < this->parents.size(); index++)
+        this->parents[index]->init();
     }
 
 
@@ -873,8 +1755,7 @@ namespace triton {
 
 
     void BvrolNode::init(void) {
-      triton::uint32 rot    = 0;
-      triton::uint512 value = 0;
+      triton::uint32 rot = 0;
 
       if (this->childs.size() < 2)
         throw triton::exceptions::Ast("BvrolNode::init(): Must take at least two childs.");
@@ -882,13 +1763,15 @@ namespace triton {
       if (this->childs[0]->getKind() != DECIMAL_NODE)
         throw triton::exceptions::Ast("BvrolNode::init(): rot must be a DECIMAL_NODE.");
 
-      rot   = reinterpret_cast<DecimalNode*>(this->childs[0])->getValue().convert_to<triton::uint32>();
-      value = this->childs[1]->evaluate();
+      rot = reinterpret_cast<DecimalNode*>(this->childs[0])->getValue().convert_to<triton::uint32>();
 
       /* Init attributes */
       this->size = this->childs[1]->getBitvectorSize();
       rot %= this->size;
-      this->eval = (((value << rot) | (value >> (this->size - rot))) & this->getBitvectorMask());
+      if (this->size <= 64)
+        this->setEvaluation64(evaluateWord<triton::uint64>(this->kind, this->childs[1]->evaluate64(), rot, this->size));
+      else
+        this->setEvaluation(evaluateWord<triton::uint512>(this->kind, this->childs[1]->evaluate(), rot, this->size));
 
       /* Init childs and spread information */
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
@@ -896,9 +1779,12 @@ namespace triton {
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
+      /* Init the depth and the unrolled size */
+      this->initMetrics();
+
       /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      for (triton::uint32 index = 0; index < this->parents.size(); index++)
+        this->parents[index]->init();
     }
 
 
@@ -944,8 +1830,7 @@ namespace triton {
 
 
     void BvrorNode::init(void) {
-      triton::uint32 rot    = 0;
-      triton::uint512 value = 0;
+      triton::uint32 rot = 0;
 
       if (this->childs.size() < 2)
         throw triton::exceptions::Ast("BvrorNode::init(): Must take at least two childs.");
@@ -953,13 +1838,15 @@ namespace triton {
       if (this->childs[0]->getKind() != DECIMAL_NODE)
         throw triton::exceptions::Ast("BvrorNode::init(): rot must be a DECIMAL_NODE.");
 
-      rot   = reinterpret_cast<DecimalNode*>(this->childs[0])->getValue().convert_to<triton::uint32>();
-      value = this->childs[1]->evaluate();
+      rot = reinterpret_cast<DecimalNode*>(this->childs[0])->getValue().convert_to<triton::uint32>();
 
       /* Init attributes */
       this->size = this->childs[1]->getBitvectorSize();
       rot %= this->size;
-      this->eval = (((value >> rot) | (value << (this->size - rot))) & this->getBitvectorMask());
+      if (this->size <= 64)
+        this->setEvaluation64(evaluateWord<triton::uint64>(this->kind, this->childs[1]->evaluate64(), rot, this->size));
+      else
+        this->setEvaluation(evaluateWord<triton::uint512>(this->kind, this->childs[1]->evaluate(), rot, this->size));
 
       /* Init childs and spread information */
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
@@ -967,9 +1854,12 @@ namespace triton {
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
+      /* Init the depth and the unrolled size */
+      this->initMetrics();
+
       /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      for (triton::uint32 index = 0; index < this->parents.size(); index++)
+        this->parents[index]->init();
     }
 
 
@@ -1007,8 +1897,7 @@ namespace triton {
 
 
     void BvsdivNode::init(void) {
-      triton::sint512 op1Signed = 0;
-      triton::sint512 op2Signed = 0;
+      triton::uint32 size = 0;
 
       if (this->childs.size() < 2)
         throw triton::exceptions::Ast("BvsdivNode::init(): Must take at least two childs.");
@@ -1016,19 +1905,13 @@ namespace triton {
       if (this->childs[0]->getBitvectorSize() != this->childs[1]->getBitvectorSize())
         throw triton::exceptions::Ast("BvsdivNode::init(): Must take two nodes of same size.");
 
-      /* Sign extend */
-      op1Signed = triton::ast::modularSignExtend(this->childs[0]);
-      op2Signed = triton::ast::modularSignExtend(this->childs[1]);
-
       /* Init attributes */
+      size = this->childs[0]->getBitvectorSize();
       this->size = this->childs[0]->getBitvectorSize();
-
-      if (op2Signed == 0) {
-        this->eval = (op1Signed < 0 ? 1 : -1);
-        this->eval &= this->getBitvectorMask();
-      }
+      if (size <= 64)
+        this->setEvaluation64(evaluateWord<triton::uint64>(this->kind, this->childs[0]->evaluate64(), this->childs[1]->evaluate64(), size));
       else
-        this->eval = ((op1Signed / op2Signed).convert_to<triton::uint512>() & this->getBitvectorMask());
+        this->setEvaluation(evaluateWord<triton::uint512>(this->kind, this->childs[0]->evaluate(), this->childs[1]->evaluate(), size));
 
       /* Init childs and spread information */
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
@@ -1036,9 +1919,12 @@ namespace triton {
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
+      /* Init the depth and the unrolled size */
+      this->initMetrics();
+
       /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      for (triton::uint32 index = 0; index < this->parents.size(); index++)
+        this->parents[index]->init();
     }
 
 
@@ -1076,8 +1962,7 @@ namespace triton {
 
 
     void BvsgeNode::init(void) {
-      triton::sint512 op1Signed = 0;
-      triton::sint512 op2Signed = 0;
+      triton::uint32 size = 0;
 
       if (this->childs.size() < 2)
         throw triton::exceptions::Ast("BvsgeNode::init(): Must take at least two childs.");
@@ -1085,13 +1970,13 @@ namespace triton {
       if (this->childs[0]->getBitvectorSize() != this->childs[1]->getBitvectorSize())
         throw triton::exceptions::Ast("BvsgeNode::init(): Must take two nodes of same size.");
 
-      /* Sign extend */
-      op1Signed = triton::ast::modularSignExtend(this->childs[0]);
-      op2Signed = triton::ast::modularSignExtend(this->childs[1]);
-
       /* Init attributes */
+      size = this->childs[0]->getBitvectorSize();
       this->size = 1;
-      this->eval = (op1Signed >= op2Signed);
+      if (size <= 64)
+        this->setEvaluation64(evaluateWord<triton::uint64>(this->kind, this->childs[0]->evaluate64(), this->childs[1]->evaluate64(), size));
+      else
+        this->setEvaluation(evaluateWord<triton::uint512>(this->kind, this->childs[0]->evaluate(), this->childs[1]->evaluate(), size));
 
       /* Init childs and spread information */
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
@@ -1099,9 +1984,12 @@ namespace triton {
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
+      /* Init the depth and the unrolled size */
+      this->initMetrics();
+
       /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      for (triton::uint32 index = 0; index < this->parents.size(); index++)
+        this->parents[index]->init();
     }
 
 
@@ -1139,8 +2027,7 @@ namespace triton {
 
 
     void BvsgtNode::init(void) {
-      triton::sint512 op1Signed = 0;
-      triton::sint512 op2Signed = 0;
+      triton::uint32 size = 0;
 
       if (this->childs.size() < 2)
         throw triton::exceptions::Ast("BvsgtNode::init(): Must take at least two childs.");
@@ -1148,13 +2035,13 @@ namespace triton {
       if (this->childs[0]->getBitvectorSize() != this->childs[1]->getBitvectorSize())
         throw triton::exceptions::Ast("BvsgtNode::init(): Must take two nodes of same size.");
 
-      /* Sign extend */
-      op1Signed = triton::ast::modularSignExtend(this->childs[0]);
-      op2Signed = triton::ast::modularSignExtend(this->childs[1]);
-
       /* Init attributes */
+      size = this->childs[0]->getBitvectorSize();
       this->size = 1;
-      this->eval = (op1Signed > op2Signed);
+      if (size <= 64)
+        this->setEvaluation64(evaluateWord<triton::uint64>(this->kind, this->childs[0]->evaluate64(), this->childs[1]->evaluate64(), size));
+      else
+        this->setEvaluation(evaluateWord<triton::uint512>(this->kind, this->childs[0]->evaluate(), this->childs[1]->evaluate(), size));
 
       /* Init childs and spread information */
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
@@ -1162,9 +2049,12 @@ namespace triton {
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
+      /* Init the depth and the unrolled size */
+      this->initMetrics();
+
       /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      for (triton::uint32 index = 0; index < this->parents.size(); index++)
+        this->parents[index]->init();
     }
 
 
@@ -1210,7 +2100,10 @@ namespace triton {
 
       /* Init attributes */
       this->size = this->childs[0]->getBitvectorSize();
-      this->eval = ((this->childs[0]->evaluate() << this->childs[1]->evaluate().convert_to<triton::uint32>()) & this->getBitvectorMask());
+      if (this->size <= 64)
+        this->setEvaluation64((this->childs[1]->evaluate64() >= 64) ? 0 : ((this->childs[0]->evaluate64() << this->childs[1]->evaluate64()) & this->getBitvectorMask64()));
+      else
+        this->setEvaluation((this->childs[0]->evaluate() << this->childs[1]->evaluate().convert_to<triton::uint32>()) & this->getBitvectorMask());
 
       /* Init childs and spread information */
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
@@ -1218,9 +2111,12 @@ namespace triton {
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
+      /* Init the depth and the unrolled size */
+      this->initMetrics();
+
       /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      for (triton::uint32 index = 0; index < this->parents.size(); index++)
+        this->parents[index]->init();
     }
 
 
@@ -1258,8 +2154,7 @@ namespace triton {
 
 
     void BvsleNode::init(void) {
-      triton::sint512 op1Signed = 0;
-      triton::sint512 op2Signed = 0;
+      triton::uint32 size = 0;
 
       if (this->childs.size() < 2)
         throw triton::exceptions::Ast("BvsleNode::init(): Must take at least two childs.");
@@ -1267,13 +2162,13 @@ namespace triton {
       if (this->childs[0]->getBitvectorSize() != this->childs[1]->getBitvectorSize())
         throw triton::exceptions::Ast("BvsleNode::init(): Must take two nodes of same size.");
 
-      /* Sign extend */
-      op1Signed = triton::ast::modularSignExtend(this->childs[0]);
-      op2Signed = triton::ast::modularSignExtend(this->childs[1]);
-
       /* Init attributes */
+      size = this->childs[0]->getBitvectorSize();
       this->size = 1;
-      this->eval = (op1Signed <= op2Signed);
+      if (size <= 64)
+        this->setEvaluation64(evaluateWord<triton::uint64>(this->kind, this->childs[0]->evaluate64(), this->childs[1]->evaluate64(), size));
+      else
+        this->setEvaluation(evaluateWord<triton::uint512>(this->kind, this->childs[0]->evaluate(), this->childs[1]->evaluate(), size));
 
       /* Init childs and spread information */
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
@@ -1281,9 +2176,12 @@ namespace triton {
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
+      /* Init the depth and the unrolled size */
+      this->initMetrics();
+
       /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      for (triton::uint32 index = 0; index < this->parents.size(); index++)
+        this->parents[index]->init();
     }
 
 
@@ -1321,8 +2219,7 @@ namespace triton {
 
 
     void BvsltNode::init(void) {
-      triton::sint512 op1Signed = 0;
-      triton::sint512 op2Signed = 0;
+      triton::uint32 size = 0;
 
       if (this->childs.size() < 2)
         throw triton::exceptions::Ast("BvsltNode::init(): Must take at least two childs.");
@@ -1330,13 +2227,13 @@ namespace triton {
       if (this->childs[0]->getBitvectorSize() != this->childs[1]->getBitvectorSize())
         throw triton::exceptions::Ast("BvsltNode::init(): Must take two nodes of same size.");
 
-      /* Sign extend */
-      op1Signed = triton::ast::modularSignExtend(this->childs[0]);
-      op2Signed = triton::ast::modularSignExtend(this->childs[1]);
-
       /* Init attributes */
+      size = this->childs[0]->getBitvectorSize();
       this->size = 1;
-      this->eval = (op1Signed < op2Signed);
+      if (size <= 64)
+        this->setEvaluation64(evaluateWord<triton::uint64>(this->kind, this->childs[0]->evaluate64(), this->childs[1]->evaluate64(), size));
+      else
+        this->setEvaluation(evaluateWord<triton::uint512>(this->kind, this->childs[0]->evaluate(), this->childs[1]->evaluate(), size));
 
       /* Init childs and spread information */
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
@@ -1344,9 +2241,12 @@ namespace triton {
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
+      /* Init the depth and the unrolled size */
+      this->initMetrics();
+
       /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      for (triton::uint32 index = 0; index < this->parents.size(); index++)
+        this->parents[index]->init();
     }
 
 
@@ -1384,8 +2284,7 @@ namespace triton {
 
 
     void BvsmodNode::init(void) {
-      triton::sint512 op1Signed = 0;
-      triton::sint512 op2Signed = 0;
+      triton::uint32 size = 0;
 
       if (this->childs.size() < 2)
         throw triton::exceptions::Ast("BvsmodNode::init(): Must take at least two childs.");
@@ -1393,17 +2292,13 @@ namespace triton {
       if (this->childs[0]->getBitvectorSize() != this->childs[1]->getBitvectorSize())
         throw triton::exceptions::Ast("BvsmodNode::init(): Must take two nodes of same size.");
 
-      /* Sign extend */
-      op1Signed = triton::ast::modularSignExtend(this->childs[0]);
-      op2Signed = triton::ast::modularSignExtend(this->childs[1]);
-
       /* Init attributes */
+      size = this->childs[0]->getBitvectorSize();
       this->size = this->childs[0]->getBitvectorSize();
-
-      if (this->childs[1]->evaluate() == 0)
-        this->eval = this->childs[0]->evaluate();
+      if (size <= 64)
+        this->setEvaluation64(evaluateWord<triton::uint64>(this->kind, this->childs[0]->evaluate64(), this->childs[1]->evaluate64(), size));
       else
-        this->eval = ((((op1Signed % op2Signed) + op2Signed) % op2Signed).convert_to<triton::uint512>() & this->getBitvectorMask());
+        this->setEvaluation(evaluateWord<triton::uint512>(this->kind, this->childs[0]->evaluate(), this->childs[1]->evaluate(), size));
 
       /* Init childs and spread information */
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
@@ -1411,9 +2306,12 @@ namespace triton {
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
+      /* Init the depth and the unrolled size */
+      this->initMetrics();
+
       /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      for (triton::uint32 index = 0; index < this->parents.size(); index++)
+        this->parents[index]->init();
     }
 
 
@@ -1451,8 +2349,7 @@ namespace triton {
 
 
     void BvsremNode::init(void) {
-      triton::sint512 op1Signed = 0;
-      triton::sint512 op2Signed = 0;
+      triton::uint32 size = 0;
 
       if (this->childs.size() < 2)
         throw triton::exceptions::Ast("BvsremNode::init(): Must take at least two childs.");
@@ -1460,17 +2357,13 @@ namespace triton {
       if (this->childs[0]->getBitvectorSize() != this->childs[1]->getBitvectorSize())
         throw triton::exceptions::Ast("BvsremNode::init(): Must take two nodes of same size.");
 
-      /* Sign extend */
-      op1Signed = triton::ast::modularSignExtend(this->childs[0]);
-      op2Signed = triton::ast::modularSignExtend(this->childs[1]);
-
       /* Init attributes */
+      size = this->childs[0]->getBitvectorSize();
       this->size = this->childs[0]->getBitvectorSize();
-
-      if (this->childs[1]->evaluate() == 0)
-        this->eval = this->childs[0]->evaluate();
+      if (size <= 64)
+        this->setEvaluation64(evaluateWord<triton::uint64>(this->kind, this->childs[0]->evaluate64(), this->childs[1]->evaluate64(), size));
       else
-        this->eval = ((op1Signed - ((op1Signed / op2Signed) * op2Signed)).convert_to<triton::uint512>() & this->getBitvectorMask());
+        this->setEvaluation(evaluateWord<triton::uint512>(this->kind, this->childs[0]->evaluate(), this->childs[1]->evaluate(), size));
 
       /* Init childs and spread information */
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
@@ -1478,9 +2371,12 @@ namespace triton {
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
+      /* Init the depth and the unrolled size */
+      this->initMetrics();
+
       /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      for (triton::uint32 index = 0; index < this->parents.size(); index++)
+        this->parents[index]->init();
     }
 
 
@@ -1526,7 +2422,10 @@ namespace triton {
 
       /* Init attributes */
       this->size = this->childs[0]->getBitvectorSize();
-      this->eval = ((this->childs[0]->evaluate() - this->childs[1]->evaluate()) & this->getBitvectorMask());
+      if (this->size <= 64)
+        this->setEvaluation64((this->childs[0]->evaluate64() - this->childs[1]->evaluate64()) & this->getBitvectorMask64());
+      else
+        this->setEvaluation((this->childs[0]->evaluate() - this->childs[1]->evaluate()) & this->getBitvectorMask());
 
       /* Init childs and spread information */
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
@@ -1534,9 +2433,12 @@ namespace triton {
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
+      /* Init the depth and the unrolled size */
+      this->initMetrics();
+
       /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      for (triton::uint32 index = 0; index < this->parents.size(); index++)
+        this->parents[index]->init();
     }
 
 
@@ -1583,10 +2485,16 @@ namespace triton {
       /* Init attributes */
       this->size = this->childs[0]->getBitvectorSize();
 
-      if (this->childs[1]->evaluate() == 0)
-        this->eval = (-1 & this->getBitvectorMask());
+      if (this->size <= 64) {
+        if (this->childs[1]->evaluate64() == 0)
+          this->setEvaluation64(this->getBitvectorMask64());
+        else
+          this->setEvaluation64(this->childs[0]->evaluate64() / this->childs[1]->evaluate64());
+      }
+      else if (this->childs[1]->evaluate() == 0)
+        this->setEvaluation(-1 & this->getBitvectorMask());
       else
-        this->eval = (this->childs[0]->evaluate() / this->childs[1]->evaluate());
+        this->setEvaluation(this->childs[0]->evaluate() / this->childs[1]->evaluate());
 
       /* Init childs and spread information */
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
@@ -1594,9 +2502,12 @@ namespace triton {
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
+      /* Init the depth and the unrolled size */
+      this->initMetrics();
+
       /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      for (triton::uint32 index = 0; index < this->parents.size(); index++)
+        this->parents[index]->init();
     }
 
 
@@ -1642,7 +2553,10 @@ namespace triton {
 
       /* Init attributes */
       this->size = 1;
-      this->eval = (this->childs[0]->evaluate() >= this->childs[1]->evaluate());
+      if (this->childs[0]->getBitvectorSize() <= 64)
+        this->setEvaluation64(this->childs[0]->evaluate64() >= this->childs[1]->evaluate64());
+      else
+        this->setEvaluation(this->childs[0]->evaluate() >= this->childs[1]->evaluate());
 
       /* Init childs and spread information */
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
@@ -1650,9 +2564,12 @@ namespace triton {
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
+      /* Init the depth and the unrolled size */
+      this->initMetrics();
+
       /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      for (triton::uint32 index = 0; index < this->parents.size(); index++)
+        this->parents[index]->init();
     }
 
 
@@ -1698,7 +2615,10 @@ namespace triton {
 
       /* Init attributes */
       this->size = 1;
-      this->eval = (this->childs[0]->evaluate() > this->childs[1]->evaluate());
+      if (this->childs[0]->getBitvectorSize() <= 64)
+        this->setEvaluation64(this->childs[0]->evaluate64() > this->childs[1]->evaluate64());
+      else
+        this->setEvaluation(this->childs[0]->evaluate() > this->childs[1]->evaluate());
 
       /* Init childs and spread information */
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
@@ -1706,9 +2626,12 @@ namespace triton {
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
+      /* Init the depth and the unrolled size */
+      this->initMetrics();
+
       /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      for (triton::uint32 index = 0; index < this->parents.size(); index++)
+        this->parents[index]->init();
     }
 
 
@@ -1754,7 +2677,10 @@ namespace triton {
 
       /* Init attributes */
       this->size = 1;
-      this->eval = (this->childs[0]->evaluate() <= this->childs[1]->evaluate());
+      if (this->childs[0]->getBitvectorSize() <= 64)
+        this->setEvaluation64(this->childs[0]->evaluate64() <= this->childs[1]->evaluate64());
+      else
+        this->setEvaluation(this->childs[0]->evaluate() <= this->childs[1]->evaluate());
 
       /* Init childs and spread information */
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
@@ -1762,9 +2688,12 @@ namespace triton {
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
+      /* Init the depth and the unrolled size */
+      this->initMetrics();
+
       /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      for (triton::uint32 index = 0; index < this->parents.size(); index++)
+        this->parents[index]->init();
     }
 
 
@@ -1810,7 +2739,10 @@ namespace triton {
 
       /* Init attributes */
       this->size = 1;
-      this->eval = (this->childs[0]->evaluate() < this->childs[1]->evaluate());
+      if (this->childs[0]->getBitvectorSize() <= 64)
+        this->setEvaluation64(this->childs[0]->evaluate64() < this->childs[1]->evaluate64());
+      else
+        this->setEvaluation(this->childs[0]->evaluate() < this->childs[1]->evaluate());
 
       /* Init childs and spread information */
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
@@ -1818,9 +2750,12 @@ namespace triton {
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
+      /* Init the depth and the unrolled size */
+      this->initMetrics();
+
       /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      for (triton::uint32 index = 0; index < this->parents.size(); index++)
+        this->parents[index]->init();
     }
 
 
@@ -1867,10 +2802,16 @@ namespace triton {
       /* Init attributes */
       this->size = this->childs[0]->getBitvectorSize();
 
-      if (this->childs[1]->evaluate() == 0)
-        this->eval = this->childs[0]->evaluate();
+      if (this->size <= 64) {
+        if (this->childs[1]->evaluate64() == 0)
+          this->setEvaluation64(this->childs[0]->evaluate64());
+        else
+          this->setEvaluation64(this->childs[0]->evaluate64() % this->childs[1]->evaluate64());
+      }
+      else if (this->childs[1]->evaluate() == 0)
+        this->setEvaluation(this->childs[0]->evaluate());
       else
-        this->eval = (this->childs[0]->evaluate() % this->childs[1]->evaluate());
+        this->setEvaluation(this->childs[0]->evaluate() % this->childs[1]->evaluate());
 
       /* Init childs and spread information */
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
@@ -1878,9 +2819,12 @@ namespace triton {
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
+      /* Init the depth and the unrolled size */
+      this->initMetrics();
+
       /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      for (triton::uint32 index = 0; index < this->parents.size(); index++)
+        this->parents[index]->init();
     }
 
 
@@ -1926,7 +2870,10 @@ namespace triton {
 
       /* Init attributes */
       this->size = this->childs[0]->getBitvectorSize();
-      this->eval = (~(this->childs[0]->evaluate() ^ this->childs[1]->evaluate()) & this->getBitvectorMask());
+      if (this->size <= 64)
+        this->setEvaluation64(~(this->childs[0]->evaluate64() ^ this->childs[1]->evaluate64()) & this->getBitvectorMask64());
+      else
+        this->setEvaluation(~(this->childs[0]->evaluate() ^ this->childs[1]->evaluate()) & this->getBitvectorMask());
 
       /* Init childs and spread information */
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
@@ -1934,9 +2881,12 @@ namespace triton {
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
+      /* Init the depth and the unrolled size */
+      this->initMetrics();
+
       /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      for (triton::uint32 index = 0; index < this->parents.size(); index++)
+        this->parents[index]->init();
     }
 
 
@@ -1982,7 +2932,10 @@ namespace triton {
 
       /* Init attributes */
       this->size = this->childs[0]->getBitvectorSize();
-      this->eval = (this->childs[0]->evaluate() ^ this->childs[1]->evaluate());
+      if (this->size <= 64)
+        this->setEvaluation64(this->childs[0]->evaluate64() ^ this->childs[1]->evaluate64());
+      else
+        this->setEvaluation(this->childs[0]->evaluate() ^ this->childs[1]->evaluate());
 
       /* Init childs and spread information */
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
@@ -1990,9 +2943,12 @@ namespace triton {
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
+      /* Init the depth and the unrolled size */
+      this->initMetrics();
+
       /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      for (triton::uint32 index = 0; index < this->parents.size(); index++)
+        this->parents[index]->init();
     }
 
 
@@ -2021,6 +2977,14 @@ namespace triton {
     }
 
 
+    BvNode::BvNode(AbstractNode* value, AbstractNode* size) {
+      this->kind = BV_NODE;
+      this->addChild(value);
+      this->addChild(size);
+      this->init();
+    }
+
+
     BvNode::BvNode(const BvNode& copy) : AbstractNode(copy) {
     }
 
@@ -2050,7 +3014,7 @@ namespace triton {
 
       /* Init attributes */
       this->size = size;
-      this->eval = (value & this->getBitvectorMask());
+      this->setEvaluation(value & this->getBitvectorMask());
 
       /* Init childs and spread information */
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
@@ -2058,9 +3022,12 @@ namespace triton {
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
+      /* Init the depth and the unrolled size */
+      this->initMetrics();
+
       /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      for (triton::uint32 index = 0; index < this->parents.size(); index++)
+        this->parents[index]->init();
     }
 
 
@@ -2103,7 +3070,7 @@ namespace triton {
 
       /* Init attributes */
       this->size = 0;
-      this->eval = 0;
+      this->setEvaluation(0);
 
       /* Init childs and spread information */
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
@@ -2111,9 +3078,12 @@ namespace triton {
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
+      /* Init the depth and the unrolled size */
+      this->initMetrics();
+
       /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      for (triton::uint32 index = 0; index < this->parents.size(); index++)
+        this->parents[index]->init();
     }
 
 
@@ -2179,9 +3149,18 @@ namespace triton {
       if (this->size > MAX_BITS_SUPPORTED)
         throw triton::exceptions::Ast("ConcatNode::init(): Size connot be greater than MAX_BITS_SUPPORTED.");
 
-      this->eval = this->childs[0]->evaluate();
-      for (triton::uint32 index = 0; index < this->childs.size()-1; index++)
-        this->eval = ((this->eval << this->childs[index+1]->getBitvectorSize()) | this->childs[index+1]->evaluate());
+      if (this->size <= 64) {
+        triton::uint64 value = this->childs[0]->evaluate64();
+        for (triton::uint32 index = 0; index < this->childs.size()-1; index++)
+          value = ((value << this->childs[index+1]->getBitvectorSize()) | this->childs[index+1]->evaluate64());
+        this->setEvaluation64(value);
+      }
+      else {
+        triton::uint512 value = this->childs[0]->evaluate();
+        for (triton::uint32 index = 0; index < this->childs.size()-1; index++)
+          value = ((value << this->childs[index+1]->getBitvectorSize()) | this->childs[index+1]->evaluate());
+        this->setEvaluation(value);
+      }
 
       /* Init childs and spread information */
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
@@ -2189,9 +3168,12 @@ namespace triton {
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
+      /* Init the depth and the unrolled size */
+      this->initMetrics();
+
       /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      for (triton::uint32 index = 0; index < this->parents.size(); index++)
+        this->parents[index]->init();
     }
 
 
@@ -2230,13 +3212,16 @@ namespace triton {
 
     void DecimalNode::init(void) {
       /* Init attributes */
-      this->eval        = 0;
       this->size        = 0;
       this->symbolized  = false;
+      this->setEvaluation64(0);
+
+      /* Init the depth and the unrolled size */
+      this->initMetrics();
 
       /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      for (triton::uint32 index = 0; index < this->parents.size(); index++)
+        this->parents[index]->init();
     }
 
 
@@ -2287,7 +3272,7 @@ namespace triton {
 
       /* Init attributes */
       this->size = this->childs[1]->getBitvectorSize();
-      this->eval = this->childs[1]->evaluate();
+      this->setEvaluation(this->childs[1]->evaluate());
 
       /* Init childs and spread information */
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
@@ -2295,9 +3280,12 @@ namespace triton {
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
+      /* Init the depth and the unrolled size */
+      this->initMetrics();
+
       /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      for (triton::uint32 index = 0; index < this->parents.size(); index++)
+        this->parents[index]->init();
     }
 
 
@@ -2340,7 +3328,10 @@ namespace triton {
 
       /* Init attributes */
       this->size = 1;
-      this->eval = (this->childs[0]->evaluate() != this->childs[1]->evaluate());
+      if (this->childs[0]->getBitvectorSize() <= 64 && this->childs[1]->getBitvectorSize() <= 64)
+        this->setEvaluation64(this->childs[0]->evaluate64() != this->childs[1]->evaluate64());
+      else
+        this->setEvaluation(this->childs[0]->evaluate() != this->childs[1]->evaluate());
 
       /* Init childs and spread information */
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
@@ -2348,9 +3339,12 @@ namespace triton {
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
+      /* Init the depth and the unrolled size */
+      this->initMetrics();
+
       /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      for (triton::uint32 index = 0; index < this->parents.size(); index++)
+        this->parents[index]->init();
     }
 
 
@@ -2393,7 +3387,10 @@ namespace triton {
 
       /* Init attributes */
       this->size = 1;
-      this->eval = (this->childs[0]->evaluate() == this->childs[1]->evaluate());
+      if (this->childs[0]->getBitvectorSize() <= 64 && this->childs[1]->getBitvectorSize() <= 64)
+        this->setEvaluation64(this->childs[0]->evaluate64() == this->childs[1]->evaluate64());
+      else
+        this->setEvaluation(this->childs[0]->evaluate() == this->childs[1]->evaluate());
 
       /* Init childs and spread information */
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
@@ -2401,9 +3398,12 @@ namespace triton {
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
+      /* Init the depth and the unrolled size */
+      this->initMetrics();
+
       /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      for (triton::uint32 index = 0; index < this->parents.size(); index++)
+        this->parents[index]->init();
     }
 
 
@@ -2459,7 +3459,10 @@ namespace triton {
 
       /* Init attributes */
       this->size = ((high - low) + 1);
-      this->eval = ((this->childs[2]->evaluate() >> low) & this->getBitvectorMask());
+      if (this->childs[2]->getBitvectorSize() <= 64 && low < 64)
+        this->setEvaluation64((this->childs[2]->evaluate64() >> low) & this->getBitvectorMask64());
+      else
+        this->setEvaluation((this->childs[2]->evaluate() >> low) & this->getBitvectorMask());
 
       if (this->size > this->childs[2]->getBitvectorSize() || high >= this->childs[2]->getBitvectorSize())
         throw triton::exceptions::Ast("ExtractNode::init(): The size of the extraction is higher than the child expression.");
@@ -2470,9 +3473,12 @@ namespace triton {
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
+      /* Init the depth and the unrolled size */
+      this->initMetrics();
+
       /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      for (triton::uint32 index = 0; index < this->parents.size(); index++)
+        this->parents[index]->init();
     }
 
 
@@ -2519,7 +3525,10 @@ namespace triton {
 
       /* Init attributes */
       this->size = this->childs[1]->getBitvectorSize();
-      this->eval = this->childs[0]->evaluate() ? this->childs[1]->evaluate() : this->childs[2]->evaluate();
+      if (this->size <= 64 && this->childs[0]->getBitvectorSize() <= 64)
+        this->setEvaluation64(this->childs[0]->evaluate64() ? this->childs[1]->evaluate64() : this->childs[2]->evaluate64());
+      else
+        this->setEvaluation(this->childs[0]->evaluate() ? this->childs[1]->evaluate() : this->childs[2]->evaluate());
 
       /* Init childs and spread information */
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
@@ -2527,9 +3536,12 @@ namespace triton {
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
+      /* Init the depth and the unrolled size */
+      this->initMetrics();
+
       /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      for (triton::uint32 index = 0; index < this->parents.size(); index++)
+        this->parents[index]->init();
     }
 
 
@@ -2572,7 +3584,7 @@ namespace triton {
 
       /* Init attributes */
       this->size = 1;
-      this->eval = (this->childs[0]->evaluate() && this->childs[1]->evaluate());
+      this->setEvaluation64(isTrue(this->childs[0]) && isTrue(this->childs[1]));
 
       /* Init childs and spread information */
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
@@ -2580,9 +3592,12 @@ namespace triton {
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
+      /* Init the depth and the unrolled size */
+      this->initMetrics();
+
       /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      for (triton::uint32 index = 0; index < this->parents.size(); index++)
+        this->parents[index]->init();
     }
 
 
@@ -2629,7 +3644,7 @@ namespace triton {
 
       /* Init attributes */
       this->size = this->childs[2]->getBitvectorSize();
-      this->eval = this->childs[2]->evaluate();
+      this->setEvaluation(this->childs[2]->evaluate());
 
       /* Init childs and spread information */
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
@@ -2637,9 +3652,12 @@ namespace triton {
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
+      /* Init the depth and the unrolled size */
+      this->initMetrics();
+
       /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      for (triton::uint32 index = 0; index < this->parents.size(); index++)
+        this->parents[index]->init();
     }
 
 
@@ -2671,70 +3689,253 @@ namespace triton {
     }
 
 
-    LnotNode::~LnotNode() {
-    }
+    LnotNode::~LnotNode() {
+    }
+
+
+    void LnotNode::init(void) {
+      if (this->childs.size() < 1)
+        throw triton::exceptions::Ast("LnotNode::init(): Must take at least one child.");
+
+      /* Init attributes */
+      this->size = 1;
+      this->setEvaluation64(!isTrue(this->childs[0]));
+
+      /* Init childs and spread information */
+      for (triton::uint32 index = 0; index < this->childs.size(); index++) {
+        this->childs[index]->setParent(this);
+        this->symbolized |= this->childs[index]->isSymbolized();
+      }
+
+      /* Init the depth and the unrolled size */
+      this->initMetrics();
+
+      /* Init parents */
+      for (triton::uint32 index = 0; index < this->parents.size(); index++)
+        this->parents[index]->init();
+    }
+
+
+    void LnotNode::accept(AstVisitor& v) {
+      v(*this);
+    }
+
+
+    triton::uint512 LnotNode::hash(triton::uint32 deep) {
+      triton::uint512 h = this->kind, s = this->childs.size();
+      if (s) h = h * s;
+      for (triton::uint32 index = 0; index < this->childs.size(); index++)
+        h = h * this->childs[index]->hash(deep+1);
+      return triton::ast::rotl(h, deep);
+    }
+
+
+    /* ====== Lor */
+
+
+    LorNode::LorNode(AbstractNode* expr1, AbstractNode* expr2) {
+      this->kind = LOR_NODE;
+      this->addChild(expr1);
+      this->addChild(expr2);
+      this->init();
+    }
+
+
+    LorNode::LorNode(const LorNode& copy) : AbstractNode(copy) {
+    }
+
+
+    LorNode::~LorNode() {
+    }
+
+
+    void LorNode::init(void) {
+      if (this->childs.size() < 2)
+        throw triton::exceptions::Ast("LorNode::init(): Must take at least two childs.");
+
+      /* Init attributes */
+      this->size = 1;
+      this->setEvaluation64(isTrue(this->childs[0]) || isTrue(this->childs[1]));
+
+      /* Init childs and spread information */
+      for (triton::uint32 index = 0; index < this->childs.size(); index++) {
+        this->childs[index]->setParent(this);
+        this->symbolized |= this->childs[index]->isSymbolized();
+      }
+
+      /* Init the depth and the unrolled size */
+      this->initMetrics();
+
+      /* Init parents */
+      for (triton::uint32 index = 0; index < this->parents.size(); index++)
+        this->parents[index]->init();
+    }
+
+
+    void LorNode::accept(AstVisitor& v) {
+      v(*this);
+    }
+
+
+    triton::uint512 LorNode::hash(triton::uint32 deep) {
+      triton::uint512 h = this->kind, s = this->childs.size();
+      if (s) h = h * s;
+      for (triton::uint32 index = 0; index < this->childs.size(); index++)
+        h = h * this->childs[index]->hash(deep+1);
+      return triton::ast::rotl(h, deep);
+    }
+
+
+    /* ====== Reference node */
+
+
+    ReferenceNode::ReferenceNode(triton::usize value) {
+      this->kind      = REFERENCE_NODE;
+      this->value     = value;
+      this->expr      = nullptr;
+      this->deletions = 0;
+      this->init();
+    }
+
+
+    ReferenceNode::ReferenceNode(const ReferenceNode& copy) : AbstractNode(copy) {
+      this->value     = copy.value;
+      this->expr      = copy.expr;
+      this->deletions = copy.deletions;
+    }
+
+
+    ReferenceNode::~ReferenceNode() {
+    }
+
+
+    void ReferenceNode::init(void) {
+      /* Init attributes */
+      triton::engines::symbolic::SymbolicExpression* expr = this->getSymbolicExpression();
+      if (expr == nullptr) {
+        this->size         = 0;
+        this->symbolized   = false;
+        this->variables    = nullptr;
+        this->depth        = 1;
+        this->unrolledSize = 1;
+        this->setEvaluation64(0);
+        this->setDomain(0, 0, 0, 0);
+      }
+      else {
+        AbstractNode* ast = expr->getAst();
+        this->size        = ast->getBitvectorSize();
+        this->symbolized  = ast->isSymbolized();
+        if (this->size <= 64)
+          this->setEvaluation64(ast->evaluate64());
+        else
+          this->setEvaluation(ast->evaluate());
+
+        /* A reference is unrolled into the tree of its expression */
+        this->depth        = ast->getDepth();
+        this->unrolledSize = ast->getUnrolledSize();
+        this->variables    = ast->getVariables();
+        this->setDomain(ast->getKnownZeros(), ast->getKnownOnes(), ast->getMinimum(), ast->getMaximum());
+
+        ast->setParent(this);
+      }
+
+      /* Init parents */
+      for (triton::uint32 index = 0; index < this->parents.size(); index++)
+        this->parents[index]->init();
+    }
+
+
+    triton::usize ReferenceNode::getValue(void) {
+      return this->value;
+    }
+
+
+    triton::engines::symbolic::SymbolicExpression* ReferenceNode::getSymbolicExpression(void) {
+      triton::usize deletions = triton::engines::symbolic::SymbolicExpression::getDeletions();
 
+      /* A kept expression is alive until an expression is deleted */
+      if (this->expr != nullptr && this->deletions == deletions)
+        return this->expr;
 
-    void LnotNode::init(void) {
-      if (this->childs.size() < 1)
-        throw triton::exceptions::Ast("LnotNode::init(): Must take at least one child.");
+      triton::engines::symbolic::SymbolicEngine* engine = triton::getCurrentApi().getSymbolicEngine();
+      this->expr      = (engine->isSymbolicExpressionIdExists(this->value) ? engine->getSymbolicExpressionFromId(this->value) : nullptr);
+      this->deletions = deletions;
 
-      /* Init attributes */
-      this->size = 1;
-      this->eval = !(this->childs[0]->evaluate());
+      return this->expr;
+    }
 
-      /* Init childs and spread information */
-      for (triton::uint32 index = 0; index < this->childs.size(); index++) {
-        this->childs[index]->setParent(this);
-        this->symbolized |= this->childs[index]->isSymbolized();
-      }
 
-      /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+    AbstractNode* ReferenceNode::getAst(void) {
+      triton::engines::symbolic::SymbolicExpression* expr = this->getSymbolicExpression();
+      if (expr == nullptr)
+        throw triton::exceptions::Ast("ReferenceNode::getAst(): The symbolic expression does not exist.");
+      return expr->getAst();
     }
 
 
-    void LnotNode::accept(AstVisitor& v) {
+    void ReferenceNode::accept(AstVisitor& v) {
       v(*this);
     }
 
 
-    triton::uint512 LnotNode::hash(triton::uint32 deep) {
-      triton::uint512 h = this->kind, s = this->childs.size();
-      if (s) h = h * s;
-      for (triton::uint32 index = 0; index < this->childs.size(); index++)
-        h = h * this->childs[index]->hash(deep+1);
-      return triton::ast::rotl(h, deep);
+    triton::uint512 ReferenceNode::hash(triton::uint32 deep) {
+      triton::uint512 hash = this->kind ^ this->value;
+      return hash;
     }
 
 
-    /* ====== Lor */
+    /* ====== select */
 
 
-    LorNode::LorNode(AbstractNode* expr1, AbstractNode* expr2) {
-      this->kind = LOR_NODE;
-      this->addChild(expr1);
-      this->addChild(expr2);
+    SelectNode::SelectNode(AbstractNode* array, AbstractNode* index) {
+      this->kind = SELECT_NODE;
+      this->addChild(array);
+      this->addChild(index);
       this->init();
     }
 
 
-    LorNode::LorNode(const LorNode& copy) : AbstractNode(copy) {
+    SelectNode::SelectNode(const SelectNode& copy) : AbstractNode(copy) {
     }
 
 
-    LorNode::~LorNode() {
+    SelectNode::~SelectNode() {
     }
 
 
-    void LorNode::init(void) {
+    void SelectNode::init(void) {
+      AbstractNode* array = nullptr;
+      triton::uint64 address = 0;
+      triton::uint64 value = 0;
+      bool found = false;
+
       if (this->childs.size() < 2)
-        throw triton::exceptions::Ast("LorNode::init(): Must take at least two childs.");
+        throw triton::exceptions::Ast("SelectNode::init(): Must take at least two childs.");
+
+      array = triton::ast::getArray(this->childs[0]);
+      if (array == nullptr)
+        throw triton::exceptions::Ast("SelectNode::init(): The first child must be an array.");
+
+      if (this->childs[1]->getBitvectorSize() != triton::ast::getArrayIndexSize(array))
+        throw triton::exceptions::Ast("SelectNode::init(): The size of the index must be the size of the indexes of the array.");
+
+      /* The value is the last byte stored at this index, otherwise the concrete memory */
+      address = this->childs[1]->evaluate64();
+      while (array->getKind() == STORE_NODE) {
+        if (array->getChilds()[1]->evaluate64() == address) {
+          value = array->getChilds()[2]->evaluate64();
+          found = true;
+          break;
+        }
+        array = triton::ast::getArray(array->getChilds()[0]);
+      }
+
+      if (!found)
+        value = triton::getCurrentApi().getConcreteMemoryValue(address);
 
       /* Init attributes */
-      this->size = 1;
-      this->eval = (this->childs[0]->evaluate() || this->childs[1]->evaluate());
+      this->size = BYTE_SIZE_BIT;
+      this->setEvaluation64(value);
 
       /* Init childs and spread information */
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
@@ -2742,79 +3943,95 @@ namespace triton {
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
+      /* Init the depth and the unrolled size */
+      this->initMetrics();
+
       /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      for (triton::uint32 index = 0; index < this->parents.size(); index++)
+        this->parents[index]->init();
     }
 
 
-    void LorNode::accept(AstVisitor& v) {
+    void SelectNode::accept(AstVisitor& v) {
       v(*this);
     }
 
 
-    triton::uint512 LorNode::hash(triton::uint32 deep) {
+    triton::uint512 SelectNode::hash(triton::uint32 deep) {
       triton::uint512 h = this->kind, s = this->childs.size();
       if (s) h = h * s;
       for (triton::uint32 index = 0; index < this->childs.size(); index++)
-        h = h * this->childs[index]->hash(deep+1);
+        h = h * triton::ast::pow(this->childs[index]->hash(deep+1), index+1);
       return triton::ast::rotl(h, deep);
     }
 
 
-    /* ====== Reference node */
+    /* ====== store */
 
 
-    ReferenceNode::ReferenceNode(triton::usize value) {
-      this->kind  = REFERENCE_NODE;
-      this->value = value;
+    StoreNode::StoreNode(AbstractNode* array, AbstractNode* index, AbstractNode* value) {
+      this->kind = STORE_NODE;
+      this->addChild(array);
+      this->addChild(index);
+      this->addChild(value);
       this->init();
     }
 
 
-    ReferenceNode::ReferenceNode(const ReferenceNode& copy) : AbstractNode(copy) {
-      this->value = copy.value;
+    StoreNode::StoreNode(const StoreNode& copy) : AbstractNode(copy) {
     }
 
 
-    ReferenceNode::~ReferenceNode() {
+    StoreNode::~StoreNode() {
     }
 
 
-    void ReferenceNode::init(void) {
-      /* Init attributes */
-      if (!triton::api.isSymbolicExpressionIdExists(this->value)) {
-        this->eval        = 0;
-        this->size        = 0;
-        this->symbolized  = false;
-      }
-      else {
-        this->eval        = triton::api.getAstFromId(this->value)->evaluate();
-        this->size        = triton::api.getAstFromId(this->value)->getBitvectorSize();
-        this->symbolized  = triton::api.getAstFromId(this->value)->isSymbolized();
+    void StoreNode::init(void) {
+      AbstractNode* array = nullptr;
 
-        triton::api.getAstFromId(this->value)->setParent(this);
-      }
+      if (this->childs.size() < 3)
+        throw triton::exceptions::Ast("StoreNode::init(): Must take at least three childs.");
 
-      /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
-    }
+      array = triton::ast::getArray(this->childs[0]);
+      if (array == nullptr)
+        throw triton::exceptions::Ast("StoreNode::init(): The first child must be an array.");
 
+      if (this->childs[1]->getBitvectorSize() != triton::ast::getArrayIndexSize(array))
+        throw triton::exceptions::Ast("StoreNode::init(): The size of the index must be the size of the indexes of the array.");
 
-    triton::usize ReferenceNode::getValue(void) {
-      return this->value;
+      if (this->childs[2]->getBitvectorSize() != BYTE_SIZE_BIT)
+        throw triton::exceptions::Ast("StoreNode::init(): The value must be a byte.");
+
+      /* Init attributes. An array is not a bitvector. */
+      this->size = 0;
+      this->setEvaluation64(0);
+
+      /* Init childs and spread information */
+      for (triton::uint32 index = 0; index < this->childs.size(); index++) {
+        this->childs[index]->setParent(this);
+        this->symbolized |= this->childs[index]->isSymbolized();
+      }
+
+      /* Init the depth and the unrolled size */
+      this->initMetrics();
+
+      /* Init parents */
+      for (triton::uint32 index = 0; index < this->parents.size(); index++)
+        this->parents[index]->init();
     }
 
 
-    void ReferenceNode::accept(AstVisitor& v) {
+    void StoreNode::accept(AstVisitor& v) {
       v(*this);
     }
 
 
-    triton::uint512 ReferenceNode::hash(triton::uint32 deep) {
-      triton::uint512 hash = this->kind ^ this->value;
-      return hash;
+    triton::uint512 StoreNode::hash(triton::uint32 deep) {
+      triton::uint512 h = this->kind, s = this->childs.size();
+      if (s) h = h * s;
+      for (triton::uint32 index = 0; index < this->childs.size(); index++)
+        h = h * triton::ast::pow(this->childs[index]->hash(deep+1), index+1);
+      return triton::ast::rotl(h, deep);
     }
 
 
@@ -2839,13 +4056,16 @@ namespace triton {
 
     void StringNode::init(void) {
       /* Init attributes */
-      this->eval        = 0;
       this->size        = 0;
       this->symbolized  = false;
+      this->setEvaluation64(0);
+
+      /* Init the depth and the unrolled size */
+      this->initMetrics();
 
       /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      for (triton::uint32 index = 0; index < this->parents.size(); index++)
+        this->parents[index]->init();
     }
 
 
@@ -2903,7 +4123,10 @@ namespace triton {
       if (size > MAX_BITS_SUPPORTED)
         throw triton::exceptions::Ast("SxNode::SxNode(): Size connot be greater than MAX_BITS_SUPPORTED.");
 
-      this->eval = ((((this->childs[1]->evaluate() >> (this->childs[1]->getBitvectorSize()-1)) == 0) ? this->childs[1]->evaluate() : (this->childs[1]->evaluate() | ~(this->childs[1]->getBitvectorMask()))) & this->getBitvectorMask());
+      if (this->size <= 64)
+        this->setEvaluation64((this->childs[1]->isSigned() ? (this->childs[1]->evaluate64() | ~(this->childs[1]->getBitvectorMask64())) : this->childs[1]->evaluate64()) & this->getBitvectorMask64());
+      else
+        this->setEvaluation((((this->childs[1]->evaluate() >> (this->childs[1]->getBitvectorSize()-1)) == 0) ? this->childs[1]->evaluate() : (this->childs[1]->evaluate() | ~(this->childs[1]->getBitvectorMask()))) & this->getBitvectorMask());
 
       /* Init childs and spread information */
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
@@ -2911,9 +4134,12 @@ namespace triton {
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
+      /* Init the depth and the unrolled size */
+      this->initMetrics();
+
       /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      for (triton::uint32 index = 0; index < this->parents.size(); index++)
+        this->parents[index]->init();
     }
 
 
@@ -2931,18 +4157,113 @@ namespace triton {
     }
 
 
+    /* ====== vadd */
+
+
+    /*
+     * Applies a lane-wise operation (VADD_NODE or VEQ_NODE) to two vectors of `size` bits. The
+     * lanes are computed in place on the machine words, without a node per lane.
+     */
+    template <typename T>
+    static T evaluateLanes(triton::uint32 kind, T value1, T value2, triton::uint32 size, triton::uint32 lane, T mask) {
+      T result = 0;
+
+      for (triton::uint32 low = 0; low < size; low += lane) {
+        T a = ((value1 >> low) & mask);
+        T b = ((value2 >> low) & mask);
+        if (kind == VADD_NODE)
+          result |= (((a + b) & mask) << low);
+        else if (a == b)
+          result |= (mask << low);
+      }
+
+      return result;
+    }
+
+
+    VaddNode::VaddNode(triton::uint32 lane, AbstractNode* expr1, AbstractNode* expr2) {
+      this->kind = VADD_NODE;
+      this->addChild(triton::ast::decimal(lane));
+      this->addChild(expr1);
+      this->addChild(expr2);
+      this->init();
+    }
+
+
+    VaddNode::VaddNode(const VaddNode& copy) : AbstractNode(copy) {
+    }
+
+
+    VaddNode::~VaddNode() {
+    }
+
+
+    void VaddNode::init(void) {
+      triton::uint512 mask = -1;
+      triton::uint32 lane  = 0;
+
+      if (this->childs.size() < 3)
+        throw triton::exceptions::Ast("VaddNode::init(): Must take at least three childs.");
+
+      if (this->childs[0]->getKind() != DECIMAL_NODE)
+        throw triton::exceptions::Ast("VaddNode::init(): The lane must be a DECIMAL_NODE.");
+
+      if (this->childs[1]->getBitvectorSize() != this->childs[2]->getBitvectorSize())
+        throw triton::exceptions::Ast("VaddNode::init(): Must take two nodes of same size.");
+
+      lane = reinterpret_cast<DecimalNode*>(this->childs[0])->getValue().convert_to<triton::uint32>();
+      if (lane == 0 || this->childs[1]->getBitvectorSize() % lane != 0)
+        throw triton::exceptions::Ast("VaddNode::init(): The lane must divide the size of the vectors.");
+
+      /* Init attributes */
+      this->size = this->childs[1]->getBitvectorSize();
+      mask = (mask >> (512 - lane));
+      if (this->size <= 64)
+        this->setEvaluation64(evaluateLanes<triton::uint64>(this->kind, this->childs[1]->evaluate64(), this->childs[2]->evaluate64(), this->size, lane, mask.convert_to<triton::uint64>()));
+      else
+        this->setEvaluation(evaluateLanes<triton::uint512>(this->kind, this->childs[1]->evaluate(), this->childs[2]->evaluate(), this->size, lane, mask));
+
+      /* Init childs and spread information */
+      for (triton::uint32 index = 0; index < this->childs.size(); index++) {
+        this->childs[index]->setParent(this);
+        this->symbolized |= this->childs[index]->isSymbolized();
+      }
+
+      /* Init the depth and the unrolled size */
+      this->initMetrics();
+
+      /* Init parents */
+      for (triton::uint32 index = 0; index < this->parents.size(); index++)
+        this->parents[index]->init();
+    }
+
+
+    void VaddNode::accept(AstVisitor& v) {
+      v(*this);
+    }
+
+
+    triton::uint512 VaddNode::hash(triton::uint32 deep) {
+      triton::uint512 h = this->kind, s = this->childs.size();
+      if (s) h = h * s;
+      for (triton::uint32 index = 0; index < this->childs.size(); index++)
+        h = h * triton::ast::pow(this->childs[index]->hash(deep+1), index+1);
+      return triton::ast::rotl(h, deep);
+    }
+
+
     /* ====== Variable node */
 
 
     VariableNode::VariableNode(triton::engines::symbolic::SymbolicVariable& symVar) {
+      this->id    = symVar.getId();
       this->kind  = VARIABLE_NODE;
-      this->value = symVar.getName();
       this->init();
     }
 
 
     VariableNode::VariableNode(const VariableNode& copy) : AbstractNode(copy) {
-      this->value = copy.value;
+      this->id = copy.id;
     }
 
 
@@ -2953,23 +4274,32 @@ namespace triton {
     void VariableNode::init(void) {
       triton::engines::symbolic::SymbolicVariable* symVar = nullptr;
 
-      symVar = triton::api.getSymbolicVariableFromName(this->value);
+      symVar = triton::getCurrentApi().getSymbolicVariableFromId(this->id);
       if (symVar) {
         this->size        = symVar->getSize();
-        this->eval        = (symVar->getConcreteValue() & this->getBitvectorMask());
+        this->setEvaluation(symVar->getConcreteValue() & this->getBitvectorMask());
         this->symbolized  = true;
       }
       else
         throw triton::exceptions::Ast("VariableNode::init(): Variable not found.");
 
+      /* Init the depth and the unrolled size */
+      this->initMetrics();
+      this->variables = VariableSet::singleton(symVar->getId());
+
       /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      for (triton::uint32 index = 0; index < this->parents.size(); index++)
+        this->parents[index]->init();
     }
 
 
     std::string VariableNode::getValue(void) {
-      return this->value;
+      return TRITON_SYMVAR_NAME + std::to_string(this->id);
+    }
+
+
+    triton::usize VariableNode::getVariableId(void) const {
+      return this->id;
     }
 
 
@@ -2981,12 +4311,87 @@ namespace triton {
     triton::uint512 VariableNode::hash(triton::uint32 deep) {
       triton::uint512 h = this->kind;
       triton::uint32 index = 1;
-      for (std::string::iterator it = this->value.begin(); it != this->value.end(); it++)
+      std::string value = this->getValue();
+      for (std::string::iterator it = value.begin(); it != value.end(); it++)
         h = h ^ triton::ast::pow(*it, index++);
       return triton::ast::rotl(h, deep);
     }
 
 
+    /* ====== veq */
+
+
+    VeqNode::VeqNode(triton::uint32 lane, AbstractNode* expr1, AbstractNode* expr2) {
+      this->kind = VEQ_NODE;
+      this->addChild(triton::ast::decimal(lane));
+      this->addChild(expr1);
+      this->addChild(expr2);
+      this->init();
+    }
+
+
+    VeqNode::VeqNode(const VeqNode& copy) : AbstractNode(copy) {
+    }
+
+
+    VeqNode::~VeqNode() {
+    }
+
+
+    void VeqNode::init(void) {
+      triton::uint512 mask = -1;
+      triton::uint32 lane  = 0;
+
+      if (this->childs.size() < 3)
+        throw triton::exceptions::Ast("VeqNode::init(): Must take at least three childs.");
+
+      if (this->childs[0]->getKind() != DECIMAL_NODE)
+        throw triton::exceptions::Ast("VeqNode::init(): The lane must be a DECIMAL_NODE.");
+
+      if (this->childs[1]->getBitvectorSize() != this->childs[2]->getBitvectorSize())
+        throw triton::exceptions::Ast("VeqNode::init(): Must take two nodes of same size.");
+
+      lane = reinterpret_cast<DecimalNode*>(this->childs[0])->getValue().convert_to<triton::uint32>();
+      if (lane == 0 || this->childs[1]->getBitvectorSize() % lane != 0)
+        throw triton::exceptions::Ast("VeqNode::init(): The lane must divide the size of the vectors.");
+
+      /* Init attributes */
+      this->size = this->childs[1]->getBitvectorSize();
+      mask = (mask >> (512 - lane));
+      if (this->size <= 64)
+        this->setEvaluation64(evaluateLanes<triton::uint64>(this->kind, this->childs[1]->evaluate64(), this->childs[2]->evaluate64(), this->size, lane, mask.convert_to<triton::uint64>()));
+      else
+        this->setEvaluation(evaluateLanes<triton::uint512>(this->kind, this->childs[1]->evaluate(), this->childs[2]->evaluate(), this->size, lane, mask));
+
+      /* Init childs and spread information */
+      for (triton::uint32 index = 0; index < this->childs.size(); index++) {
+        this->childs[index]->setParent(this);
+        this->symbolized |= this->childs[index]->isSymbolized();
+      }
+
+      /* Init the depth and the unrolled size */
+      this->initMetrics();
+
+      /* Init parents */
+      for (triton::uint32 index = 0; index < this->parents.size(); index++)
+        this->parents[index]->init();
+    }
+
+
+    void VeqNode::accept(AstVisitor& v) {
+      v(*this);
+    }
+
+
+    triton::uint512 VeqNode::hash(triton::uint32 deep) {
+      triton::uint512 h = this->kind, s = this->childs.size();
+      if (s) h = h * s;
+      for (triton::uint32 index = 0; index < this->childs.size(); index++)
+        h = h * triton::ast::pow(this->childs[index]->hash(deep+1), index+1);
+      return triton::ast::rotl(h, deep);
+    }
+
+
     /* ====== zx */
 
 
@@ -3022,7 +4427,10 @@ namespace triton {
       if (size > MAX_BITS_SUPPORTED)
         throw triton::exceptions::Ast("ZxNode::init(): Size connot be greater than MAX_BITS_SUPPORTED.");
 
-      this->eval = (this->childs[1]->evaluate() & this->getBitvectorMask());
+      if (this->size <= 64)
+        this->setEvaluation64(this->childs[1]->evaluate64() & this->getBitvectorMask64());
+      else
+        this->setEvaluation(this->childs[1]->evaluate() & this->getBitvectorMask());
 
       /* Init childs and spread information */
       for (triton::uint32 index = 0; index < this->childs.size(); index++) {
@@ -3030,9 +4438,12 @@ namespace triton {
         this->symbolized |= this->childs[index]->isSymbolized();
       }
 
+      /* Init the depth and the unrolled size */
+      this->initMetrics();
+
       /* Init parents */
-      for (std::set<AbstractNode*>::iterator it = this->parents.begin(); it != this->parents.end(); it++)
-        (*it)->init();
+      for (triton::uint32 index = 0; index < this->parents.size(); index++)
+        this->parents[index]->init();
     }
 
 
@@ -3117,451 +4528,522 @@ namespace triton {
 
 
 
+/* ====== Array utils */
+
+namespace triton {
+  namespace ast {
+
+    AbstractNode* getArray(AbstractNode* node) {
+      /* The AST of an array expression is an array */
+      while (node->getKind() == REFERENCE_NODE) {
+        triton::engines::symbolic::SymbolicExpression* expr = reinterpret_cast<ReferenceNode*>(node)->getSymbolicExpression();
+        if (expr == nullptr)
+          return nullptr;
+        node = expr->getAst();
+      }
+
+      if (node->getKind() == ARRAY_NODE || node->getKind() == STORE_NODE)
+        return node;
+
+      return nullptr;
+    }
+
+
+    triton::uint32 getArrayIndexSize(AbstractNode* array) {
+      if (array->getKind() == ARRAY_NODE)
+        return reinterpret_cast<ArrayNode*>(array)->getIndexSize();
+      return array->getChilds()[1]->getBitvectorSize();
+    }
+
+  }; /* ast namespace */
+}; /* triton namespace */
+
+
+
 /* ====== Node builders */
 
 namespace triton {
   namespace ast {
 
+    AbstractNode* array(triton::uint32 indexSize, std::string name) {
+      AbstractNode* node = new(triton::getCurrentApi().getAstNodeAllocator()) ArrayNode(indexSize, name);
+      if (node == nullptr)
+        throw triton::exceptions::Ast("Node builders - Not enough memory");
+      return triton::getCurrentApi().recordAstNode(node);
+    }
+
+
     AbstractNode* assert_(AbstractNode* expr) {
-      AbstractNode* node = new(std::nothrow) AssertNode(expr);
+      AbstractNode* node = new(triton::getCurrentApi().getAstNodeAllocator()) AssertNode(expr);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
+      return triton::getCurrentApi().recordAstNode(node);
     }
 
 
     AbstractNode* bv(triton::uint512 value, triton::uint32 size) {
-      AbstractNode* node = new(std::nothrow) BvNode(value, size);
+      /* Small constants are shared and never freed */
+      AbstractNode* node = triton::getCurrentApi().getConstantAstNode(value, size);
+      if (node != nullptr)
+        return node;
+
+      node = new(triton::getCurrentApi().getAstNodeAllocator()) BvNode(value, size);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
+      return triton::getCurrentApi().recordAstNode(node);
     }
 
 
     AbstractNode* bvadd(AbstractNode* expr1, AbstractNode* expr2) {
-      AbstractNode* node = new(std::nothrow) BvaddNode(expr1, expr2);
+      AbstractNode* node = new(triton::getCurrentApi().getAstNodeAllocator()) BvaddNode(expr1, expr2);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
+      return triton::getCurrentApi().recordAstNode(node);
     }
 
 
     AbstractNode* bvand(AbstractNode* expr1, AbstractNode* expr2) {
-      AbstractNode* node = new(std::nothrow) BvandNode(expr1, expr2);
+      AbstractNode* node = new(triton::getCurrentApi().getAstNodeAllocator()) BvandNode(expr1, expr2);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
+      return triton::getCurrentApi().recordAstNode(node);
     }
 
 
     AbstractNode* bvashr(AbstractNode* expr1, AbstractNode* expr2) {
-      AbstractNode* node = new(std::nothrow) BvashrNode(expr1, expr2);
+      AbstractNode* node = new(triton::getCurrentApi().getAstNodeAllocator()) BvashrNode(expr1, expr2);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
+      return triton::getCurrentApi().recordAstNode(node);
     }
 
 
     AbstractNode* bvdecl(triton::uint32 size) {
-      AbstractNode* node = new(std::nothrow) BvdeclNode(size);
+      AbstractNode* node = new(triton::getCurrentApi().getAstNodeAllocator()) BvdeclNode(size);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
+      return triton::getCurrentApi().recordAstNode(node);
     }
 
 
     AbstractNode* bvfalse(void) {
-      AbstractNode* node = new(std::nothrow) BvNode(0, 1);
-      if (node == nullptr)
-        throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
+      return triton::ast::bv(0, 1);
     }
 
 
     AbstractNode* bvlshr(AbstractNode* expr1, AbstractNode* expr2) {
-      AbstractNode* node = new(std::nothrow) BvlshrNode(expr1, expr2);
+      AbstractNode* node = new(triton::getCurrentApi().getAstNodeAllocator()) BvlshrNode(expr1, expr2);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
+      return triton::getCurrentApi().recordAstNode(node);
     }
 
 
     AbstractNode* bvmul(AbstractNode* expr1, AbstractNode* expr2) {
-      AbstractNode* node = new(std::nothrow) BvmulNode(expr1, expr2);
+      AbstractNode* node = new(triton::getCurrentApi().getAstNodeAllocator()) BvmulNode(expr1, expr2);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
+      return triton::getCurrentApi().recordAstNode(node);
     }
 
 
     AbstractNode* bvnand(AbstractNode* expr1, AbstractNode* expr2) {
-      AbstractNode* node = new(std::nothrow) BvnandNode(expr1, expr2);
+      AbstractNode* node = new(triton::getCurrentApi().getAstNodeAllocator()) BvnandNode(expr1, expr2);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
+      return triton::getCurrentApi().recordAstNode(node);
     }
 
 
     AbstractNode* bvneg(AbstractNode* expr) {
-      AbstractNode* node = new(std::nothrow) BvnegNode(expr);
+      AbstractNode* node = new(triton::getCurrentApi().getAstNodeAllocator()) BvnegNode(expr);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
+      return triton::getCurrentApi().recordAstNode(node);
     }
 
 
     AbstractNode* bvnor(AbstractNode* expr1, AbstractNode* expr2) {
-      AbstractNode* node = new(std::nothrow) BvnorNode(expr1, expr2);
+      AbstractNode* node = new(triton::getCurrentApi().getAstNodeAllocator()) BvnorNode(expr1, expr2);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
+      return triton::getCurrentApi().recordAstNode(node);
     }
 
 
     AbstractNode* bvnot(AbstractNode* expr) {
-      AbstractNode* node = new(std::nothrow) BvnotNode(expr);
+      AbstractNode* node = new(triton::getCurrentApi().getAstNodeAllocator()) BvnotNode(expr);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
+      return triton::getCurrentApi().recordAstNode(node);
     }
 
 
     AbstractNode* bvor(AbstractNode* expr1, AbstractNode* expr2) {
-      AbstractNode* node = new(std::nothrow) BvorNode(expr1, expr2);
+      AbstractNode* node = new(triton::getCurrentApi().getAstNodeAllocator()) BvorNode(expr1, expr2);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
+      return triton::getCurrentApi().recordAstNode(node);
     }
 
 
     AbstractNode* bvrol(triton::uint32 rot, AbstractNode* expr) {
-      AbstractNode* node = new(std::nothrow) BvrolNode(rot, expr);
+      AbstractNode* node = new(triton::getCurrentApi().getAstNodeAllocator()) BvrolNode(rot, expr);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
+      return triton::getCurrentApi().recordAstNode(node);
     }
 
 
     AbstractNode* bvrol(AbstractNode* rot, AbstractNode* expr) {
-      AbstractNode* node = new(std::nothrow) BvrolNode(rot, expr);
+      AbstractNode* node = new(triton::getCurrentApi().getAstNodeAllocator()) BvrolNode(rot, expr);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
+      return triton::getCurrentApi().recordAstNode(node);
     }
 
 
     AbstractNode* bvror(triton::uint32 rot, AbstractNode* expr) {
-      AbstractNode* node = new(std::nothrow) BvrorNode(rot, expr);
+      AbstractNode* node = new(triton::getCurrentApi().getAstNodeAllocator()) BvrorNode(rot, expr);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
+      return triton::getCurrentApi().recordAstNode(node);
     }
 
 
     AbstractNode* bvror(AbstractNode* rot, AbstractNode* expr) {
-      AbstractNode* node = new(std::nothrow) BvrorNode(rot, expr);
+      AbstractNode* node = new(triton::getCurrentApi().getAstNodeAllocator()) BvrorNode(rot, expr);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
+      return triton::getCurrentApi().recordAstNode(node);
     }
 
 
     AbstractNode* bvsdiv(AbstractNode* expr1, AbstractNode* expr2) {
-      AbstractNode* node = new(std::nothrow) BvsdivNode(expr1, expr2);
+      AbstractNode* node = new(triton::getCurrentApi().getAstNodeAllocator()) BvsdivNode(expr1, expr2);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
+      return triton::getCurrentApi().recordAstNode(node);
     }
 
 
     AbstractNode* bvsge(AbstractNode* expr1, AbstractNode* expr2) {
-      AbstractNode* node = new(std::nothrow) BvsgeNode(expr1, expr2);
+      AbstractNode* node = new(triton::getCurrentApi().getAstNodeAllocator()) BvsgeNode(expr1, expr2);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
+      return triton::getCurrentApi().recordAstNode(node);
     }
 
 
     AbstractNode* bvsgt(AbstractNode* expr1, AbstractNode* expr2) {
-      AbstractNode* node = new(std::nothrow) BvsgtNode(expr1, expr2);
+      AbstractNode* node = new(triton::getCurrentApi().getAstNodeAllocator()) BvsgtNode(expr1, expr2);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
+      return triton::getCurrentApi().recordAstNode(node);
     }
 
 
     AbstractNode* bvshl(AbstractNode* expr1, AbstractNode* expr2) {
-      AbstractNode* node = new(std::nothrow) BvshlNode(expr1, expr2);
+      AbstractNode* node = new(triton::getCurrentApi().getAstNodeAllocator()) BvshlNode(expr1, expr2);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
+      return triton::getCurrentApi().recordAstNode(node);
     }
 
 
     AbstractNode* bvsle(AbstractNode* expr1, AbstractNode* expr2) {
-      AbstractNode* node = new(std::nothrow) BvsleNode(expr1, expr2);
+      AbstractNode* node = new(triton::getCurrentApi().getAstNodeAllocator()) BvsleNode(expr1, expr2);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
+      return triton::getCurrentApi().recordAstNode(node);
     }
 
 
     AbstractNode* bvslt(AbstractNode* expr1, AbstractNode* expr2) {
-      AbstractNode* node = new(std::nothrow) BvsltNode(expr1, expr2);
+      AbstractNode* node = new(triton::getCurrentApi().getAstNodeAllocator()) BvsltNode(expr1, expr2);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
+      return triton::getCurrentApi().recordAstNode(node);
     }
 
 
     AbstractNode* bvsmod(AbstractNode* expr1, AbstractNode* expr2) {
-      AbstractNode* node = new(std::nothrow) BvsmodNode(expr1, expr2);
+      AbstractNode* node = new(triton::getCurrentApi().getAstNodeAllocator()) BvsmodNode(expr1, expr2);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
+      return triton::getCurrentApi().recordAstNode(node);
     }
 
 
     AbstractNode* bvsrem(AbstractNode* expr1, AbstractNode* expr2) {
-      AbstractNode* node = new(std::nothrow) BvsremNode(expr1, expr2);
+      AbstractNode* node = new(triton::getCurrentApi().getAstNodeAllocator()) BvsremNode(expr1, expr2);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
+      return triton::getCurrentApi().recordAstNode(node);
     }
 
 
     AbstractNode* bvsub(AbstractNode* expr1, AbstractNode* expr2) {
-      AbstractNode* node = new(std::nothrow) BvsubNode(expr1, expr2);
+      AbstractNode* node = new(triton::getCurrentApi().getAstNodeAllocator()) BvsubNode(expr1, expr2);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
+      return triton::getCurrentApi().recordAstNode(node);
     }
 
 
     AbstractNode* bvtrue(void) {
-      AbstractNode* node = new(std::nothrow) BvNode(1, 1);
-      if (node == nullptr)
-        throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
+      return triton::ast::bv(1, 1);
     }
 
 
     AbstractNode* bvudiv(AbstractNode* expr1, AbstractNode* expr2) {
-      AbstractNode* node = new(std::nothrow) BvudivNode(expr1, expr2);
+      AbstractNode* node = new(triton::getCurrentApi().getAstNodeAllocator()) BvudivNode(expr1, expr2);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
+      return triton::getCurrentApi().recordAstNode(node);
     }
 
 
     AbstractNode* bvuge(AbstractNode* expr1, AbstractNode* expr2) {
-      AbstractNode* node = new(std::nothrow) BvugeNode(expr1, expr2);
+      AbstractNode* node = new(triton::getCurrentApi().getAstNodeAllocator()) BvugeNode(expr1, expr2);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
+      return triton::getCurrentApi().recordAstNode(node);
     }
 
 
     AbstractNode* bvugt(AbstractNode* expr1, AbstractNode* expr2) {
-      AbstractNode* node = new(std::nothrow) BvugtNode(expr1, expr2);
+      AbstractNode* node = new(triton::getCurrentApi().getAstNodeAllocator()) BvugtNode(expr1, expr2);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
+      return triton::getCurrentApi().recordAstNode(node);
     }
 
 
     AbstractNode* bvule(AbstractNode* expr1, AbstractNode* expr2) {
-      AbstractNode* node = new(std::nothrow) BvuleNode(expr1, expr2);
+      AbstractNode* node = new(triton::getCurrentApi().getAstNodeAllocator()) BvuleNode(expr1, expr2);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
+      return triton::getCurrentApi().recordAstNode(node);
     }
 
 
     AbstractNode* bvult(AbstractNode* expr1, AbstractNode* expr2) {
-      AbstractNode* node = new(std::nothrow) BvultNode(expr1, expr2);
+      AbstractNode* node = new(triton::getCurrentApi().getAstNodeAllocator()) BvultNode(expr1, expr2);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
+      return triton::getCurrentApi().recordAstNode(node);
     }
 
 
     AbstractNode* bvurem(AbstractNode* expr1, AbstractNode* expr2) {
-      AbstractNode* node = new(std::nothrow) BvuremNode(expr1, expr2);
+      AbstractNode* node = new(triton::getCurrentApi().getAstNodeAllocator()) BvuremNode(expr1, expr2);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
+      return triton::getCurrentApi().recordAstNode(node);
     }
 
 
      AbstractNode* bvxnor(AbstractNode* expr1, AbstractNode* expr2) {
-      AbstractNode* node = new(std::nothrow) BvxnorNode(expr1, expr2);
+      AbstractNode* node = new(triton::getCurrentApi().getAstNodeAllocator()) BvxnorNode(expr1, expr2);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
+      return triton::getCurrentApi().recordAstNode(node);
     }
 
 
     AbstractNode* bvxor(AbstractNode* expr1, AbstractNode* expr2) {
-      AbstractNode* node = new(std::nothrow) BvxorNode(expr1, expr2);
+      AbstractNode* node = new(triton::getCurrentApi().getAstNodeAllocator()) BvxorNode(expr1, expr2);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
+      return triton::getCurrentApi().recordAstNode(node);
     }
 
 
     AbstractNode* compound(std::vector<AbstractNode*> exprs) {
-      AbstractNode* node = new(std::nothrow) CompoundNode(exprs);
+      AbstractNode* node = new(triton::getCurrentApi().getAstNodeAllocator()) CompoundNode(exprs);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
+      return triton::getCurrentApi().recordAstNode(node);
     }
 
 
     AbstractNode* concat(AbstractNode* expr1, AbstractNode* expr2) {
-      AbstractNode* node = new(std::nothrow) ConcatNode(expr1, expr2);
+      AbstractNode* node = new(triton::getCurrentApi().getAstNodeAllocator()) ConcatNode(expr1, expr2);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
+      return triton::getCurrentApi().recordAstNode(node);
     }
 
 
     AbstractNode* concat(std::vector<AbstractNode*> exprs) {
-      AbstractNode* node = new(std::nothrow) ConcatNode(exprs);
+      AbstractNode* node = new(triton::getCurrentApi().getAstNodeAllocator()) ConcatNode(exprs);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
+      return triton::getCurrentApi().recordAstNode(node);
     }
 
 
     AbstractNode* concat(std::list<AbstractNode*> exprs) {
-      AbstractNode* node = new(std::nothrow) ConcatNode(exprs);
+      AbstractNode* node = new(triton::getCurrentApi().getAstNodeAllocator()) ConcatNode(exprs);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
+      return triton::getCurrentApi().recordAstNode(node);
     }
 
 
     AbstractNode* decimal(triton::uint512 value) {
-      AbstractNode* node = new(std::nothrow) DecimalNode(value);
+      AbstractNode* node = new(triton::getCurrentApi().getAstNodeAllocator()) DecimalNode(value);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
+      return triton::getCurrentApi().recordAstNode(node);
     }
 
 
     AbstractNode* declareFunction(std::string name, AbstractNode* bvDecl) {
-      AbstractNode* node = new(std::nothrow) DeclareFunctionNode(name, bvDecl);
+      AbstractNode* node = new(triton::getCurrentApi().getAstNodeAllocator()) DeclareFunctionNode(name, bvDecl);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
+      return triton::getCurrentApi().recordAstNode(node);
     }
 
 
     AbstractNode* distinct(AbstractNode* expr1, AbstractNode* expr2) {
-      AbstractNode* node = new(std::nothrow) DistinctNode(expr1, expr2);
+      AbstractNode* node = new(triton::getCurrentApi().getAstNodeAllocator()) DistinctNode(expr1, expr2);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
+      return triton::getCurrentApi().recordAstNode(node);
     }
 
 
     AbstractNode* equal(AbstractNode* expr1, AbstractNode* expr2) {
-      AbstractNode* node = new(std::nothrow) EqualNode(expr1, expr2);
+      AbstractNode* node = new(triton::getCurrentApi().getAstNodeAllocator()) EqualNode(expr1, expr2);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
+      return triton::getCurrentApi().recordAstNode(node);
     }
 
 
     AbstractNode* extract(triton::uint32 high, triton::uint32 low, AbstractNode* expr) {
-      AbstractNode* node = new(std::nothrow) ExtractNode(high, low, expr);
+      AbstractNode* node = new(triton::getCurrentApi().getAstNodeAllocator()) ExtractNode(high, low, expr);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
+      return triton::getCurrentApi().recordAstNode(node);
     }
 
 
     AbstractNode* ite(AbstractNode* ifExpr, AbstractNode* thenExpr, AbstractNode* elseExpr) {
-      AbstractNode* node = new(std::nothrow) IteNode(ifExpr, thenExpr, elseExpr);
+      AbstractNode* node = new(triton::getCurrentApi().getAstNodeAllocator()) IteNode(ifExpr, thenExpr, elseExpr);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
+      return triton::getCurrentApi().recordAstNode(node);
     }
 
 
     AbstractNode* land(AbstractNode* expr1, AbstractNode* expr2) {
-      AbstractNode* node = new(std::nothrow) LandNode(expr1, expr2);
+      AbstractNode* node = new(triton::getCurrentApi().getAstNodeAllocator()) LandNode(expr1, expr2);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
+      return triton::getCurrentApi().recordAstNode(node);
     }
 
 
     AbstractNode* let(std::string alias, AbstractNode* expr2, AbstractNode* expr3) {
-      AbstractNode* node = new(std::nothrow) LetNode(alias, expr2, expr3);
+      AbstractNode* node = new(triton::getCurrentApi().getAstNodeAllocator()) LetNode(alias, expr2, expr3);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
+      return triton::getCurrentApi().recordAstNode(node);
     }
 
 
     AbstractNode* lnot(AbstractNode* expr) {
-      AbstractNode* node = new(std::nothrow) LnotNode(expr);
+      AbstractNode* node = new(triton::getCurrentApi().getAstNodeAllocator()) LnotNode(expr);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
+      return triton::getCurrentApi().recordAstNode(node);
     }
 
 
     AbstractNode* lor(AbstractNode* expr1, AbstractNode* expr2) {
-      AbstractNode* node = new(std::nothrow) LorNode(expr1, expr2);
+      AbstractNode* node = new(triton::getCurrentApi().getAstNodeAllocator()) LorNode(expr1, expr2);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
+      return triton::getCurrentApi().recordAstNode(node);
     }
 
 
     AbstractNode* reference(triton::usize value) {
-      AbstractNode* node = new(std::nothrow) ReferenceNode(value);
+      AbstractNode* node = new(triton::getCurrentApi().getAstNodeAllocator()) ReferenceNode(value);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
+      return triton::getCurrentApi().recordAstNode(node);
+    }
+
+
+    AbstractNode* select(AbstractNode* array, AbstractNode* index) {
+      AbstractNode* node = new(triton::getCurrentApi().getAstNodeAllocator()) SelectNode(array, index);
+      if (node == nullptr)
+        throw triton::exceptions::Ast("Node builders - Not enough memory");
+      return triton::getCurrentApi().recordAstNode(node);
+    }
+
+
+    AbstractNode* store(AbstractNode* array, AbstractNode* index, AbstractNode* value) {
+      AbstractNode* node = new(triton::getCurrentApi().getAstNodeAllocator()) StoreNode(array, index, value);
+      if (node == nullptr)
+        throw triton::exceptions::Ast("Node builders - Not enough memory");
+      return triton::getCurrentApi().recordAstNode(node);
     }
 
 
     AbstractNode* string(std::string value) {
-      AbstractNode* node = new(std::nothrow) StringNode(value);
+      AbstractNode* node = new(triton::getCurrentApi().getAstNodeAllocator()) StringNode(value);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
+      return triton::getCurrentApi().recordAstNode(node);
     }
 
 
     AbstractNode* sx(triton::uint32 sizeExt, AbstractNode* expr) {
-      AbstractNode* node = new(std::nothrow) SxNode(sizeExt, expr);
+      AbstractNode* node = new(triton::getCurrentApi().getAstNodeAllocator()) SxNode(sizeExt, expr);
+      if (node == nullptr)
+        throw triton::exceptions::Ast("Node builders - Not enough memory");
+      return triton::getCurrentApi().recordAstNode(node);
+    }
+
+
+    AbstractNode* vadd(triton::uint32 lane, AbstractNode* expr1, AbstractNode* expr2) {
+      AbstractNode* node = new(triton::getCurrentApi().getAstNodeAllocator()) VaddNode(lane, expr1, expr2);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
+      return triton::getCurrentApi().recordAstNode(node);
     }
 
 
     AbstractNode* variable(triton::engines::symbolic::SymbolicVariable& symVar) {
       AbstractNode* ret  = nullptr;
-      AbstractNode* node = new(std::nothrow) VariableNode(symVar);
+      AbstractNode* node = new(triton::getCurrentApi().getAstNodeAllocator()) VariableNode(symVar);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
-      ret = triton::api.recordAstNode(node);
-      triton::api.recordVariableAstNode(symVar.getName(), ret);
+      ret = triton::getCurrentApi().recordAstNode(node);
+      triton::getCurrentApi().recordVariableAstNode(symVar.getId(), ret);
       return ret;
     }
 
 
+    AbstractNode* veq(triton::uint32 lane, AbstractNode* expr1, AbstractNode* expr2) {
+      AbstractNode* node = new(triton::getCurrentApi().getAstNodeAllocator()) VeqNode(lane, expr1, expr2);
+      if (node == nullptr)
+        throw triton::exceptions::Ast("Node builders - Not enough memory");
+      return triton::getCurrentApi().recordAstNode(node);
+    }
+
+
     AbstractNode* zx(triton::uint32 sizeExt, AbstractNode* expr) {
-      AbstractNode* node = new(std::nothrow) ZxNode(sizeExt, expr);
+      AbstractNode* node = new(triton::getCurrentApi().getAstNodeAllocator()) ZxNode(sizeExt, expr);
       if (node == nullptr)
         throw triton::exceptions::Ast("Node builders - Not enough memory");
-      return triton::api.recordAstNode(node);
+      return triton::getCurrentApi().recordAstNode(node);
     }
 
 
@@ -3572,6 +5054,7 @@ namespace triton {
         return nullptr;
 
       switch (node->getKind()) {
+        case ARRAY_NODE:                newNode = new(std::nothrow) ArrayNode(*reinterpret_cast<ArrayNode*>(node)); break;
         case ASSERT_NODE:               newNode = new(std::nothrow) AssertNode(*reinterpret_cast<AssertNode*>(node)); break;
         case BVADD_NODE:                newNode = new(std::nothrow) BvaddNode(*reinterpret_cast<BvaddNode*>(node)); break;
         case BVAND_NODE:                newNode = new(std::nothrow) BvandNode(*reinterpret_cast<BvandNode*>(node)); break;
@@ -3617,9 +5100,13 @@ namespace triton {
         case LNOT_NODE:                 newNode = new(std::nothrow) LnotNode(*reinterpret_cast<LnotNode*>(node)); break;
         case LOR_NODE:                  newNode = new(std::nothrow) LorNode(*reinterpret_cast<LorNode*>(node)); break;
         case REFERENCE_NODE:            newNode = new(std::nothrow) ReferenceNode(*reinterpret_cast<ReferenceNode*>(node)); break;
+        case SELECT_NODE:               newNode = new(std::nothrow) SelectNode(*reinterpret_cast<SelectNode*>(node)); break;
+        case STORE_NODE:                newNode = new(std::nothrow) StoreNode(*reinterpret_cast<StoreNode*>(node)); break;
         case STRING_NODE:               newNode = new(std::nothrow) StringNode(*reinterpret_cast<StringNode*>(node)); break;
         case SX_NODE:                   newNode = new(std::nothrow) SxNode(*reinterpret_cast<SxNode*>(node)); break;
+        case VADD_NODE:                 newNode = new(std::nothrow) VaddNode(*reinterpret_cast<VaddNode*>(node)); break;
         case VARIABLE_NODE:             newNode = new(std::nothrow) VariableNode(*reinterpret_cast<VariableNode*>(node)); break;
+        case VEQ_NODE:                  newNode = new(std::nothrow) VeqNode(*reinterpret_cast<VeqNode*>(node)); break;
         case ZX_NODE:                   newNode = new(std::nothrow) ZxNode(*reinterpret_cast<ZxNode*>(node)); break;
         default:
           throw triton::exceptions::Ast("triton::ast::newInstance(): Invalid kind node.");
@@ -3631,6 +5118,34 @@ namespace triton {
       return newNode;
     }
 
+
+    AbstractNode* newInstance(AbstractNode* node, const std::vector<AbstractNode*>& childs) {
+      AbstractNode* newNode = nullptr;
+      std::vector<AbstractNode*> saved;
+
+      if (node == nullptr)
+        return nullptr;
+
+      /* Detach the children, so that the copy constructor does not duplicate them */
+      saved.swap(node->getChilds());
+      try {
+        newNode = triton::ast::newInstance(node);
+      }
+      catch (const triton::exceptions::Ast&) {
+        saved.swap(node->getChilds());
+        throw;
+      }
+      saved.swap(node->getChilds());
+
+      /* The copy is not a child of the parents of the original node */
+      newNode->clearParents();
+      for (triton::uint32 index = 0; index < childs.size(); index++)
+        newNode->addChild(childs[index]);
+      newNode->init();
+
+      return triton::getCurrentApi().recordAstNode(newNode);
+    }
+
   }; /* ast namespace */
 }; /* triton namespace */
 
@@ -5,6 +5,9 @@
 **  This program is under the terms of the BSD License.
 */
 
+#include <functional>
+#include <utility>
+
 #include <astDictionaries.hpp>
 
 
@@ -12,11 +15,73 @@
 namespace triton {
   namespace ast {
 
+    /* The names of the kinds of nodes in the statistics */
+    static const std::vector<std::pair<std::string, triton::uint32>> statsKinds = {
+      {"array",           triton::ast::ARRAY_NODE},
+      {"assert",          triton::ast::ASSERT_NODE},
+      {"bvadd",           triton::ast::BVADD_NODE},
+      {"bvand",           triton::ast::BVAND_NODE},
+      {"bvashr",          triton::ast::BVASHR_NODE},
+      {"bvdecl",          triton::ast::BVDECL_NODE},
+      {"bvlshr",          triton::ast::BVLSHR_NODE},
+      {"bvmul",           triton::ast::BVMUL_NODE},
+      {"bvnand",          triton::ast::BVNAND_NODE},
+      {"bvneg",           triton::ast::BVNEG_NODE},
+      {"bvnor",           triton::ast::BVNOR_NODE},
+      {"bvnot",           triton::ast::BVNOT_NODE},
+      {"bvor",            triton::ast::BVOR_NODE},
+      {"bvrol",           triton::ast::BVROL_NODE},
+      {"bvror",           triton::ast::BVROR_NODE},
+      {"bvsdiv",          triton::ast::BVSDIV_NODE},
+      {"bvsge",           triton::ast::BVSGE_NODE},
+      {"bvsgt",           triton::ast::BVSGT_NODE},
+      {"bvshl",           triton::ast::BVSHL_NODE},
+      {"bvsle",           triton::ast::BVSLE_NODE},
+      {"bvslt",           triton::ast::BVSLT_NODE},
+      {"bvsmod",          triton::ast::BVSMOD_NODE},
+      {"bvsrem",          triton::ast::BVSREM_NODE},
+      {"bvsub",           triton::ast::BVSUB_NODE},
+      {"bvudiv",          triton::ast::BVUDIV_NODE},
+      {"bvuge",           triton::ast::BVUGE_NODE},
+      {"bvugt",           triton::ast::BVUGT_NODE},
+      {"bvule",           triton::ast::BVULE_NODE},
+      {"bvult",           triton::ast::BVULT_NODE},
+      {"bvurem",          triton::ast::BVUREM_NODE},
+      {"bvxnor",          triton::ast::BVXNOR_NODE},
+      {"bvxor",           triton::ast::BVXOR_NODE},
+      {"bv",              triton::ast::BV_NODE},
+      {"compound",        triton::ast::COMPOUND_NODE},
+      {"concat",          triton::ast::CONCAT_NODE},
+      {"decimal",         triton::ast::DECIMAL_NODE},
+      {"declareFunction", triton::ast::DECLARE_FUNCTION_NODE},
+      {"distinct",        triton::ast::DISTINCT_NODE},
+      {"equal",           triton::ast::EQUAL_NODE},
+      {"extract",         triton::ast::EXTRACT_NODE},
+      {"ite",             triton::ast::ITE_NODE},
+      {"land",            triton::ast::LAND_NODE},
+      {"let",             triton::ast::LET_NODE},
+      {"lnot",            triton::ast::LNOT_NODE},
+      {"lor",             triton::ast::LOR_NODE},
+      {"reference",       triton::ast::REFERENCE_NODE},
+      {"select",          triton::ast::SELECT_NODE},
+      {"store",           triton::ast::STORE_NODE},
+      {"string",          triton::ast::STRING_NODE},
+      {"sx",              triton::ast::SX_NODE},
+      {"vadd",            triton::ast::VADD_NODE},
+      {"variable",        triton::ast::VARIABLE_NODE},
+      {"veq",             triton::ast::VEQ_NODE},
+      {"zx",              triton::ast::ZX_NODE},
+    };
+
+
     AstDictionaries::AstDictionaries(bool isBackup) {
       this->allocatedNodes  = 0;
       this->backupFlag      = isBackup;
+      this->hits            = 0;
+      this->tableSize       = 0;
 
-      this->linkDictionaries();
+      this->table.resize(AstDictionaries::initialCapacity, nullptr);
+      this->kindSize.resize(triton::ast::VEQ_NODE + 1, 0);
     }
 
 
@@ -27,7 +92,7 @@ namespace triton {
 
     AstDictionaries::~AstDictionaries() {
       if (this->backupFlag == false) {
-        for (auto it = this->allocatedDictionaries.begin(); it != this->allocatedDictionaries.end(); it++)
+        for (auto it = this->table.begin(); it != this->table.end(); it++)
           delete *it;
       }
     }
@@ -39,243 +104,171 @@ namespace triton {
 
 
     void AstDictionaries::copy(const AstDictionaries& other) {
-      /* Global information */
-      this->allocatedNodes              = other.allocatedNodes;
-      this->allocatedDictionaries       = other.allocatedDictionaries;
-      this->backupFlag                  = true;
-
-      /* Dictionnaries */
-      this->assertDictionary            = other.assertDictionary;
-      this->bvaddDictionary             = other.bvaddDictionary;
-      this->bvandDictionary             = other.bvandDictionary;
-      this->bvashrDictionary            = other.bvashrDictionary;
-      this->bvdeclDictionary            = other.bvdeclDictionary;
-      this->bvlshrDictionary            = other.bvlshrDictionary;
-      this->bvmulDictionary             = other.bvmulDictionary;
-      this->bvnandDictionary            = other.bvnandDictionary;
-      this->bvnegDictionary             = other.bvnegDictionary;
-      this->bvnorDictionary             = other.bvnorDictionary;
-      this->bvnotDictionary             = other.bvnotDictionary;
-      this->bvorDictionary              = other.bvorDictionary;
-      this->bvrolDictionary             = other.bvrolDictionary;
-      this->bvrorDictionary             = other.bvrorDictionary;
-      this->bvsdivDictionary            = other.bvsdivDictionary;
-      this->bvsgeDictionary             = other.bvsgeDictionary;
-      this->bvsgtDictionary             = other.bvsgtDictionary;
-      this->bvshlDictionary             = other.bvshlDictionary;
-      this->bvsleDictionary             = other.bvsleDictionary;
-      this->bvsltDictionary             = other.bvsltDictionary;
-      this->bvsmodDictionary            = other.bvsmodDictionary;
-      this->bvsremDictionary            = other.bvsremDictionary;
-      this->bvsubDictionary             = other.bvsubDictionary;
-      this->bvudivDictionary            = other.bvudivDictionary;
-      this->bvugeDictionary             = other.bvugeDictionary;
-      this->bvugtDictionary             = other.bvugtDictionary;
-      this->bvuleDictionary             = other.bvuleDictionary;
-      this->bvultDictionary             = other.bvultDictionary;
-      this->bvuremDictionary            = other.bvuremDictionary;
-      this->bvxnorDictionary            = other.bvxnorDictionary;
-      this->bvxorDictionary             = other.bvxorDictionary;
-      this->bvDictionary                = other.bvDictionary;
-      this->compoundDictionary          = other.compoundDictionary;
-      this->concatDictionary            = other.concatDictionary;
-      this->decimalDictionary           = other.decimalDictionary;
-      this->declareFunctionDictionary   = other.declareFunctionDictionary;
-      this->distinctDictionary          = other.distinctDictionary;
-      this->equalDictionary             = other.equalDictionary;
-      this->extractDictionary           = other.extractDictionary;
-      this->iteDictionary               = other.iteDictionary;
-      this->landDictionary              = other.landDictionary;
-      this->letDictionary               = other.letDictionary;
-      this->lnotDictionary              = other.lnotDictionary;
-      this->lorDictionary               = other.lorDictionary;
-      this->referenceDictionary         = other.referenceDictionary;
-      this->stringDictionary            = other.stringDictionary;
-      this->sxDictionary                = other.sxDictionary;
-      this->variableDictionary          = other.variableDictionary;
-      this->zxDictionary                = other.zxDictionary;
-
-      this->linkDictionaries();
+      this->allocatedNodes  = other.allocatedNodes;
+      this->backupFlag      = true;
+      this->hits            = other.hits;
+      this->kindSize        = other.kindSize;
+      this->table           = other.table;
+      this->tableSize       = other.tableSize;
     }
 
 
-    void AstDictionaries::linkDictionaries(void) {
-      this->dictionaries[triton::ast::ASSERT_NODE]             = &this->assertDictionary;
-      this->dictionaries[triton::ast::BVADD_NODE]              = &this->bvaddDictionary;
-      this->dictionaries[triton::ast::BVAND_NODE]              = &this->bvandDictionary;
-      this->dictionaries[triton::ast::BVASHR_NODE]             = &this->bvashrDictionary;
-      this->dictionaries[triton::ast::BVDECL_NODE]             = &this->bvdeclDictionary;
-      this->dictionaries[triton::ast::BVLSHR_NODE]             = &this->bvlshrDictionary;
-      this->dictionaries[triton::ast::BVMUL_NODE]              = &this->bvmulDictionary;
-      this->dictionaries[triton::ast::BVNAND_NODE]             = &this->bvnandDictionary;
-      this->dictionaries[triton::ast::BVNEG_NODE]              = &this->bvnegDictionary;
-      this->dictionaries[triton::ast::BVNOR_NODE]              = &this->bvnorDictionary;
-      this->dictionaries[triton::ast::BVNOT_NODE]              = &this->bvnotDictionary;
-      this->dictionaries[triton::ast::BVOR_NODE]               = &this->bvorDictionary;
-      this->dictionaries[triton::ast::BVROL_NODE]              = &this->bvrolDictionary;
-      this->dictionaries[triton::ast::BVROR_NODE]              = &this->bvrorDictionary;
-      this->dictionaries[triton::ast::BVSDIV_NODE]             = &this->bvsdivDictionary;
-      this->dictionaries[triton::ast::BVSGE_NODE]              = &this->bvsgeDictionary;
-      this->dictionaries[triton::ast::BVSGT_NODE]              = &this->bvsgtDictionary;
-      this->dictionaries[triton::ast::BVSHL_NODE]              = &this->bvshlDictionary;
-      this->dictionaries[triton::ast::BVSLE_NODE]              = &this->bvsleDictionary;
-      this->dictionaries[triton::ast::BVSLT_NODE]              = &this->bvsltDictionary;
-      this->dictionaries[triton::ast::BVSMOD_NODE]             = &this->bvsmodDictionary;
-      this->dictionaries[triton::ast::BVSREM_NODE]             = &this->bvsremDictionary;
-      this->dictionaries[triton::ast::BVSUB_NODE]              = &this->bvsubDictionary;
-      this->dictionaries[triton::ast::BVUDIV_NODE]             = &this->bvudivDictionary;
-      this->dictionaries[triton::ast::BVUGE_NODE]              = &this->bvugeDictionary;
-      this->dictionaries[triton::ast::BVUGT_NODE]              = &this->bvugtDictionary;
-      this->dictionaries[triton::ast::BVULE_NODE]              = &this->bvuleDictionary;
-      this->dictionaries[triton::ast::BVULT_NODE]              = &this->bvultDictionary;
-      this->dictionaries[triton::ast::BVUREM_NODE]             = &this->bvuremDictionary;
-      this->dictionaries[triton::ast::BVXNOR_NODE]             = &this->bvxnorDictionary;
-      this->dictionaries[triton::ast::BVXOR_NODE]              = &this->bvxorDictionary;
-      this->dictionaries[triton::ast::BV_NODE]                 = &this->bvDictionary;
-      this->dictionaries[triton::ast::COMPOUND_NODE]           = &this->compoundDictionary;
-      this->dictionaries[triton::ast::CONCAT_NODE]             = &this->concatDictionary;
-      this->dictionaries[triton::ast::DECIMAL_NODE]            = &this->decimalDictionary;
-      this->dictionaries[triton::ast::DECLARE_FUNCTION_NODE]   = &this->declareFunctionDictionary;
-      this->dictionaries[triton::ast::DISTINCT_NODE]           = &this->distinctDictionary;
-      this->dictionaries[triton::ast::EQUAL_NODE]              = &this->equalDictionary;
-      this->dictionaries[triton::ast::EXTRACT_NODE]            = &this->extractDictionary;
-      this->dictionaries[triton::ast::ITE_NODE]                = &this->iteDictionary;
-      this->dictionaries[triton::ast::LAND_NODE]               = &this->landDictionary;
-      this->dictionaries[triton::ast::LET_NODE]                = &this->letDictionary;
-      this->dictionaries[triton::ast::LNOT_NODE]               = &this->lnotDictionary;
-      this->dictionaries[triton::ast::LOR_NODE]                = &this->lorDictionary;
-      this->dictionaries[triton::ast::REFERENCE_NODE]          = &this->referenceDictionary;
-      this->dictionaries[triton::ast::STRING_NODE]             = &this->stringDictionary;
-      this->dictionaries[triton::ast::SX_NODE]                 = &this->sxDictionary;
-      this->dictionaries[triton::ast::VARIABLE_NODE]           = &this->variableDictionary;
-      this->dictionaries[triton::ast::ZX_NODE]                 = &this->zxDictionary;
+    void AstDictionaries::clearAstDictionaries(void) {
+      this->table.assign(AstDictionaries::initialCapacity, nullptr);
+      this->kindSize.assign(triton::ast::VEQ_NODE + 1, 0);
+      this->tableSize = 0;
     }
 
 
-    triton::ast::AbstractNode* AstDictionaries::browseAstDictionaries(triton::ast::AbstractNode* node) {
-      this->allocatedNodes++;
-      triton::uint32 kind = node->getKind();
+    triton::uint64 AstDictionaries::computeStructuralHash(triton::ast::AbstractNode* node) {
+      /* FNV-1a like mixing, one 64-bit word at a time */
+      triton::uint64 hash = 0xcbf29ce484222325;
+      auto mix = [&hash](triton::uint64 value) {
+        hash ^= value;
+        hash *= 0x100000001b3;
+        hash ^= (hash >> 32);
+      };
 
-      switch (kind) {
+      mix(node->getKind());
+      mix(node->getBitvectorSize());
 
+      switch (node->getKind()) {
         case triton::ast::DECIMAL_NODE: {
-          auto value       = static_cast<triton::ast::DecimalNode*>(node)->getValue();
-          auto dictionary  = static_cast<std::map<triton::uint512, triton::ast::AbstractNode*>*>((this->dictionaries[kind]));
-          if (dictionary->find(value) != dictionary->end()) {
-            delete node;
-            return (*dictionary)[value];
-          }
-          (*dictionary)[value] = node;
+          triton::uint512 value = static_cast<triton::ast::DecimalNode*>(node)->getValue();
+          do {
+            mix(static_cast<triton::uint64>(value & 0xffffffffffffffff));
+            value >>= 64;
+          } while (value != 0);
           break;
         }
 
-        case triton::ast::REFERENCE_NODE: {
-          auto value       = static_cast<triton::ast::ReferenceNode*>(node)->getValue();
-          auto dictionary  = static_cast<std::map<triton::usize, triton::ast::AbstractNode*>*>((this->dictionaries[kind]));
-          if (dictionary->find(value) != dictionary->end()) {
-            delete node;
-            return (*dictionary)[value];
-          }
-          (*dictionary)[value] = node;
+        case triton::ast::ARRAY_NODE:
+          mix(static_cast<triton::ast::ArrayNode*>(node)->getIndexSize());
+          mix(std::hash<std::string>()(static_cast<triton::ast::ArrayNode*>(node)->getName()));
           break;
-        }
 
-        case triton::ast::STRING_NODE: {
-          auto value       = static_cast<triton::ast::StringNode*>(node)->getValue();
-          auto dictionary  = static_cast<std::map<std::string, triton::ast::AbstractNode*>*>((this->dictionaries[kind]));
-          if (dictionary->find(value) != dictionary->end()) {
-            delete node;
-            return (*dictionary)[value];
-          }
-          (*dictionary)[value] = node;
+        case triton::ast::REFERENCE_NODE:
+          mix(static_cast<triton::ast::ReferenceNode*>(node)->getValue());
           break;
-        }
 
-        case triton::ast::VARIABLE_NODE: {
-          auto value       = static_cast<triton::ast::VariableNode*>(node)->getValue();
-          auto dictionary  = static_cast<std::map<std::string, triton::ast::AbstractNode*>*>((this->dictionaries[kind]));
-          if (dictionary->find(value) != dictionary->end()) {
-            delete node;
-            return (*dictionary)[value];
-          }
-          (*dictionary)[value] = node;
+        case triton::ast::STRING_NODE:
+          mix(std::hash<std::string>()(static_cast<triton::ast::StringNode*>(node)->getValue()));
           break;
-        }
 
-        default: {
-          auto value       = node->getChilds();
-          auto dictionary  = static_cast<std::map<std::vector<triton::ast::AbstractNode*>, triton::ast::AbstractNode*>*>((this->dictionaries[kind]));
-          if (dictionary->find(value) != dictionary->end()) {
-            delete node;
-            return (*dictionary)[value];
-          }
-          (*dictionary)[value] = node;
+        case triton::ast::VARIABLE_NODE:
+          mix(static_cast<triton::ast::VariableNode*>(node)->getVariableId());
           break;
-        }
 
+        default:
+          break;
+      }
+
+      for (auto it = node->getChilds().begin(); it != node->getChilds().end(); it++)
+        mix(reinterpret_cast<triton::uint64>(*it));
+
+      /* 0 means that the node is not recorded */
+      return (hash == 0) ? 1 : hash;
+    }
+
+
+    bool AstDictionaries::isStructurallyEqual(triton::ast::AbstractNode* node1, triton::ast::AbstractNode* node2) {
+      if (node1->getKind() != node2->getKind())
+        return false;
+
+      if (node1->getBitvectorSize() != node2->getBitvectorSize())
+        return false;
+
+      switch (node1->getKind()) {
+        case triton::ast::ARRAY_NODE:
+          return static_cast<triton::ast::ArrayNode*>(node1)->getIndexSize() == static_cast<triton::ast::ArrayNode*>(node2)->getIndexSize() &&
+                 static_cast<triton::ast::ArrayNode*>(node1)->getName() == static_cast<triton::ast::ArrayNode*>(node2)->getName();
+
+        case triton::ast::DECIMAL_NODE:
+          return static_cast<triton::ast::DecimalNode*>(node1)->getValue() == static_cast<triton::ast::DecimalNode*>(node2)->getValue();
+
+        case triton::ast::REFERENCE_NODE:
+          return static_cast<triton::ast::ReferenceNode*>(node1)->getValue() == static_cast<triton::ast::ReferenceNode*>(node2)->getValue();
+
+        case triton::ast::STRING_NODE:
+          return static_cast<triton::ast::StringNode*>(node1)->getValue() == static_cast<triton::ast::StringNode*>(node2)->getValue();
+
+        case triton::ast::VARIABLE_NODE:
+          return static_cast<triton::ast::VariableNode*>(node1)->getVariableId() == static_cast<triton::ast::VariableNode*>(node2)->getVariableId();
+
+        default:
+          return node1->getChilds() == node2->getChilds();
+      }
+    }
+
+
+    void AstDictionaries::growTable(void) {
+      std::vector<triton::ast::AbstractNode*> grown(this->table.size() * 2, nullptr);
+      triton::usize mask = grown.size() - 1;
+
+      /* Stored hashes avoid browsing trees again */
+      for (auto it = this->table.begin(); it != this->table.end(); it++) {
+        if (*it == nullptr)
+          continue;
+        triton::usize index = (*it)->getStructuralHash() & mask;
+        while (grown[index] != nullptr)
+          index = (index + 1) & mask;
+        grown[index] = *it;
       }
 
-      this->allocatedDictionaries.insert(node);
+      this->table.swap(grown);
+    }
+
+
+    triton::ast::AbstractNode* AstDictionaries::browseAstDictionaries(triton::ast::AbstractNode* node) {
+      this->allocatedNodes++;
+
+      /* Keep the load factor under 1/2 */
+      if ((this->tableSize + 1) * 2 > this->table.size())
+        this->growTable();
+
+      triton::uint64 hash  = AstDictionaries::computeStructuralHash(node);
+      triton::usize mask   = this->table.size() - 1;
+      triton::usize index  = hash & mask;
+
+      while (this->table[index] != nullptr) {
+        triton::ast::AbstractNode* other = this->table[index];
+        if (other->getStructuralHash() == hash && AstDictionaries::isStructurallyEqual(node, other)) {
+          this->hits++;
+          delete node;
+          return other;
+        }
+        index = (index + 1) & mask;
+      }
+
+      node->setStructuralHash(hash);
+      this->table[index] = node;
+      this->tableSize++;
+      this->kindSize[node->getKind()]++;
+
       return nullptr;
     }
 
 
-    std::map<std::string, triton::usize> AstDictionaries::getAstDictionariesStats(void) const {
+    std::map<std::string, triton::usize> AstDictionaries::getStatsByKind(const std::vector<triton::usize>& counters) {
       std::map<std::string, triton::usize> stats;
-      stats["assert"]                 = this->assertDictionary.size();
-      stats["bvadd"]                  = this->bvaddDictionary.size();
-      stats["bvand"]                  = this->bvandDictionary.size();
-      stats["bvashr"]                 = this->bvashrDictionary.size();
-      stats["bvdecl"]                 = this->bvdeclDictionary.size();
-      stats["bvlshr"]                 = this->bvlshrDictionary.size();
-      stats["bvmul"]                  = this->bvmulDictionary.size();
-      stats["bvnand"]                 = this->bvnandDictionary.size();
-      stats["bvneg"]                  = this->bvnegDictionary.size();
-      stats["bvnor"]                  = this->bvnorDictionary.size();
-      stats["bvnot"]                  = this->bvnotDictionary.size();
-      stats["bvor"]                   = this->bvorDictionary.size();
-      stats["bvrol"]                  = this->bvrolDictionary.size();
-      stats["bvror"]                  = this->bvrorDictionary.size();
-      stats["bvsdiv"]                 = this->bvsdivDictionary.size();
-      stats["bvsge"]                  = this->bvsgeDictionary.size();
-      stats["bvsgt"]                  = this->bvsgtDictionary.size();
-      stats["bvshl"]                  = this->bvshlDictionary.size();
-      stats["bvsle"]                  = this->bvsleDictionary.size();
-      stats["bvslt"]                  = this->bvsltDictionary.size();
-      stats["bvsmod"]                 = this->bvsmodDictionary.size();
-      stats["bvsrem"]                 = this->bvsremDictionary.size();
-      stats["bvsub"]                  = this->bvsubDictionary.size();
-      stats["bvudiv"]                 = this->bvudivDictionary.size();
-      stats["bvuge"]                  = this->bvugeDictionary.size();
-      stats["bvugt"]                  = this->bvugtDictionary.size();
-      stats["bvule"]                  = this->bvuleDictionary.size();
-      stats["bvult"]                  = this->bvultDictionary.size();
-      stats["bvurem"]                 = this->bvuremDictionary.size();
-      stats["bvxnor"]                 = this->bvxnorDictionary.size();
-      stats["bvxor"]                  = this->bvxorDictionary.size();
-      stats["bv"]                     = this->bvDictionary.size();
-      stats["compound"]               = this->compoundDictionary.size();
-      stats["concat"]                 = this->concatDictionary.size();
-      stats["decimal"]                = this->decimalDictionary.size();
-      stats["declareFunction"]        = this->declareFunctionDictionary.size();
-      stats["distinct"]               = this->distinctDictionary.size();
-      stats["equal"]                  = this->equalDictionary.size();
-      stats["extract"]                = this->extractDictionary.size();
-      stats["ite"]                    = this->iteDictionary.size();
-      stats["land"]                   = this->landDictionary.size();
-      stats["let"]                    = this->letDictionary.size();
-      stats["lnot"]                   = this->lnotDictionary.size();
-      stats["lor"]                    = this->lorDictionary.size();
-      stats["reference"]              = this->referenceDictionary.size();
-      stats["string"]                 = this->stringDictionary.size();
-      stats["sx"]                     = this->sxDictionary.size();
-      stats["variable"]               = this->variableDictionary.size();
-      stats["zx"]                     = this->zxDictionary.size();
-      stats["allocatedDictionaries"]  = this->allocatedDictionaries.size();
+      for (auto it = statsKinds.begin(); it != statsKinds.end(); it++)
+        stats[it->first] = (it->second < counters.size() ? counters[it->second] : 0);
+      return stats;
+    }
+
+
+    std::map<std::string, triton::usize> AstDictionaries::getAstDictionariesStats(void) const {
+      std::map<std::string, triton::usize> stats = AstDictionaries::getStatsByKind(this->kindSize);
+      stats["allocatedDictionaries"]  = this->tableSize;
       stats["allocatedNodes"]         = this->allocatedNodes;
+      stats["hits"]                   = this->hits;
       return stats;
     }
 
+
+    triton::usize AstDictionaries::getAstDictionariesMemoryUsage(void) const {
+      return this->table.capacity() * sizeof(triton::ast::AbstractNode*) + this->kindSize.capacity() * sizeof(triton::usize);
+    }
+
   }; /* ast namespace */
 }; /*triton namespace */
-
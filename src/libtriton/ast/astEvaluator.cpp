@@ -0,0 +1,575 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#include <algorithm>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+
+#include <api.hpp>
+#include <astEvaluator.hpp>
+#include <astTraversal.hpp>
+#include <astWord.hpp>
+#include <exceptions.hpp>
+
+
+
+namespace triton {
+  namespace ast {
+
+    AstEvaluator::AstEvaluator(triton::ast::AbstractNode* root) {
+      this->compile(std::vector<triton::ast::AbstractNode*>(1, root));
+    }
+
+
+    AstEvaluator::AstEvaluator(const std::vector<triton::ast::AbstractNode*>& asts) {
+      this->compile(asts);
+    }
+
+
+    void AstEvaluator::compile(const std::vector<triton::ast::AbstractNode*>& asts) {
+      std::unordered_map<triton::ast::AbstractNode*, triton::uint32> indexes;
+      std::unordered_map<triton::usize, triton::usize> variableIndexes;
+      std::unordered_set<triton::ast::AbstractNode*> visited;
+      std::vector<triton::ast::AbstractNode*> nodes;
+      std::vector<triton::uint512> constants;
+
+      this->wide = false;
+
+      for (auto it = asts.begin(); it != asts.end(); it++) {
+        if (*it == nullptr)
+          throw triton::exceptions::Ast("AstEvaluator::compile(): The AST cannot be null.");
+        triton::ast::nodesExtraction(nodes, *it, visited, true);
+      }
+
+      for (auto it = nodes.begin(); it != nodes.end(); it++) {
+        triton::ast::AbstractNode* node = *it;
+        triton::uint32 output = static_cast<triton::uint32>(this->sizes.size());
+
+        switch (node->getKind()) {
+          case ARRAY_NODE:
+          case BVDECL_NODE:
+          case COMPOUND_NODE:
+          case DECLARE_FUNCTION_NODE:
+          case FUNCTION_NODE:
+          case LET_NODE:
+          case PARAM_NODE:
+          case SELECT_NODE:
+          case STORE_NODE:
+          case STRING_NODE:
+          case UNDEFINED_NODE:
+            throw triton::exceptions::Ast("AstEvaluator::compile(): Unsupported node.");
+          default:
+            break;
+        }
+
+        indexes[node] = output;
+        this->sizes.push_back(node->getBitvectorSize());
+        constants.push_back(0);
+        if (node->getBitvectorSize() > 64)
+          this->wide = true;
+
+        /* Nodes without variable are folded (the evaluation of an assert node is always 0) */
+        if (!node->isSymbolized() && node->getKind() != ASSERT_NODE) {
+          constants[output] = node->evaluate();
+          continue;
+        }
+
+        if (node->getKind() == VARIABLE_NODE) {
+          triton::usize id = reinterpret_cast<VariableNode*>(node)->getVariableId();
+          if (variableIndexes.find(id) == variableIndexes.end()) {
+            triton::engines::symbolic::SymbolicVariable* symVar = triton::getCurrentApi().getSymbolicVariableFromId(id);
+            if (symVar == nullptr)
+              throw triton::exceptions::Ast("AstEvaluator::compile(): Variable not found.");
+            variableIndexes[id] = this->variables.size();
+            this->variables.push_back(symVar);
+          }
+          this->inputs.push_back(std::make_pair(output, variableIndexes[id]));
+          continue;
+        }
+
+        Instruction inst;
+        inst.kind      = node->getKind();
+        inst.output    = output;
+        inst.first     = static_cast<triton::uint32>(this->operands.size());
+        inst.immediate = 0;
+
+        /* A reference node copies the register of the AST it targets, walked before it */
+        if (node->getKind() == REFERENCE_NODE) {
+          this->operands.push_back(indexes[reinterpret_cast<ReferenceNode*>(node)->getAst()]);
+        }
+        else {
+          std::vector<AbstractNode*>& childs = node->getChilds();
+          for (auto child = childs.begin(); child != childs.end(); child++)
+            this->operands.push_back(indexes[*child]);
+        }
+
+        if (node->getKind() == EXTRACT_NODE)
+          inst.immediate = reinterpret_cast<DecimalNode*>(node->getChilds()[1])->getValue().convert_to<triton::uint32>();
+
+        else if (node->getKind() == BVROL_NODE || node->getKind() == BVROR_NODE)
+          inst.immediate = reinterpret_cast<DecimalNode*>(node->getChilds()[0])->getValue().convert_to<triton::uint32>() % node->getBitvectorSize();
+
+        else if (node->getKind() == VADD_NODE || node->getKind() == VEQ_NODE)
+          inst.immediate = reinterpret_cast<DecimalNode*>(node->getChilds()[0])->getValue().convert_to<triton::uint32>();
+
+        inst.count = static_cast<triton::uint32>(this->operands.size()) - inst.first;
+        this->program.push_back(inst);
+      }
+
+      for (auto it = asts.begin(); it != asts.end(); it++)
+        this->roots.push_back(indexes[*it]);
+
+      /* Constant registers are never written by the program */
+      if (this->wide) {
+        this->registers = constants;
+      }
+      else {
+        this->registers64.resize(constants.size());
+        for (triton::usize index = 0; index < constants.size(); index++)
+          this->registers64[index] = constants[index].convert_to<triton::uint64>();
+      }
+    }
+
+
+    /*
+     * The lane i of the register r is regs[r * stride + i]. Every instruction is applied to all the
+     * lanes before the next one, so the dispatch is paid once per instruction and the inner loops are
+     * plain native operations over arrays.
+     */
+    template <typename T>
+    void AstEvaluator::run(T* regs, triton::usize stride, triton::usize lanes) const {
+      typedef typename Word<T>::Signed S;
+
+      for (auto inst = this->program.begin(); inst != this->program.end(); inst++) {
+        const triton::uint32* ops = &this->operands[inst->first];
+        triton::uint32 size       = this->sizes[inst->output];
+        T mask                    = Word<T>::mask(size);
+        T* out                    = regs + inst->output * stride;
+        const T* a                = regs + ops[0] * stride;
+        const T* b                = (inst->count > 1 ? regs + ops[1] * stride : a);
+        const T* c                = (inst->count > 2 ? regs + ops[2] * stride : a);
+
+        switch (inst->kind) {
+          case ASSERT_NODE:
+            for (triton::usize i = 0; i < lanes; i++)
+              out[i] = static_cast<T>(a[i] != 0);
+            break;
+
+          case BVADD_NODE:
+            for (triton::usize i = 0; i < lanes; i++)
+              out[i] = ((a[i] + b[i]) & mask);
+            break;
+
+          case BVAND_NODE:
+            for (triton::usize i = 0; i < lanes; i++)
+              out[i] = (a[i] & b[i]);
+            break;
+
+          case BVASHR_NODE:
+            for (triton::usize i = 0; i < lanes; i++) {
+              bool sign = (((a[i] >> (size - 1)) & 1) != 0);
+              if (b[i] >= size) {
+                out[i] = (sign ? mask : static_cast<T>(0));
+              }
+              else {
+                triton::uint32 shift = Word<T>::toUint32(b[i]);
+                out[i] = (a[i] >> shift);
+                if (sign)
+                  out[i] |= (mask & ~(mask >> shift));
+              }
+            }
+            break;
+
+          case BVLSHR_NODE:
+            for (triton::usize i = 0; i < lanes; i++)
+              out[i] = ((b[i] >= size) ? static_cast<T>(0) : static_cast<T>(a[i] >> Word<T>::toUint32(b[i])));
+            break;
+
+          case BVMUL_NODE:
+            for (triton::usize i = 0; i < lanes; i++)
+              out[i] = ((a[i] * b[i]) & mask);
+            break;
+
+          case BVNAND_NODE:
+            for (triton::usize i = 0; i < lanes; i++)
+              out[i] = (~(a[i] & b[i]) & mask);
+            break;
+
+          case BVNEG_NODE:
+            for (triton::usize i = 0; i < lanes; i++)
+              out[i] = ((static_cast<T>(0) - a[i]) & mask);
+            break;
+
+          case BVNOR_NODE:
+            for (triton::usize i = 0; i < lanes; i++)
+              out[i] = (~(a[i] | b[i]) & mask);
+            break;
+
+          case BVNOT_NODE:
+            for (triton::usize i = 0; i < lanes; i++)
+              out[i] = (~a[i] & mask);
+            break;
+
+          case BVOR_NODE:
+            for (triton::usize i = 0; i < lanes; i++)
+              out[i] = (a[i] | b[i]);
+            break;
+
+          case BVROL_NODE:
+            for (triton::usize i = 0; i < lanes; i++) {
+              if (inst->immediate == 0)
+                out[i] = b[i];
+              else
+                out[i] = (((b[i] << inst->immediate) | (b[i] >> (size - inst->immediate))) & mask);
+            }
+            break;
+
+          case BVROR_NODE:
+            for (triton::usize i = 0; i < lanes; i++) {
+              if (inst->immediate == 0)
+                out[i] = b[i];
+              else
+                out[i] = (((b[i] >> inst->immediate) | (b[i] << (size - inst->immediate))) & mask);
+            }
+            break;
+
+          /* Divisions by -1 are negations, they do not overflow */
+          case BVSDIV_NODE:
+            for (triton::usize i = 0; i < lanes; i++) {
+              S op1 = Word<T>::toSigned(a[i], size);
+              S op2 = Word<T>::toSigned(b[i], size);
+              if (op2 == 0)
+                out[i] = (op1 < 0 ? static_cast<T>(1) : mask);
+              else if (op2 == -1)
+                out[i] = ((static_cast<T>(0) - a[i]) & mask);
+              else
+                out[i] = (Word<T>::fromSigned(op1 / op2) & mask);
+            }
+            break;
+
+          case BVSGE_NODE:
+            for (triton::usize i = 0; i < lanes; i++)
+              out[i] = static_cast<T>(Word<T>::toSigned(a[i], this->sizes[ops[0]]) >= Word<T>::toSigned(b[i], this->sizes[ops[1]]));
+            break;
+
+          case BVSGT_NODE:
+            for (triton::usize i = 0; i < lanes; i++)
+              out[i] = static_cast<T>(Word<T>::toSigned(a[i], this->sizes[ops[0]]) > Word<T>::toSigned(b[i], this->sizes[ops[1]]));
+            break;
+
+          case BVSHL_NODE:
+            for (triton::usize i = 0; i < lanes; i++)
+              out[i] = ((b[i] >= size) ? static_cast<T>(0) : static_cast<T>((a[i] << Word<T>::toUint32(b[i])) & mask));
+            break;
+
+          case BVSLE_NODE:
+            for (triton::usize i = 0; i < lanes; i++)
+              out[i] = static_cast<T>(Word<T>::toSigned(a[i], this->sizes[ops[0]]) <= Word<T>::toSigned(b[i], this->sizes[ops[1]]));
+            break;
+
+          case BVSLT_NODE:
+            for (triton::usize i = 0; i < lanes; i++)
+              out[i] = static_cast<T>(Word<T>::toSigned(a[i], this->sizes[ops[0]]) < Word<T>::toSigned(b[i], this->sizes[ops[1]]));
+            break;
+
+          /* The remainder takes the sign of the divisor */
+          case BVSMOD_NODE:
+            for (triton::usize i = 0; i < lanes; i++) {
+              S op1 = Word<T>::toSigned(a[i], size);
+              S op2 = Word<T>::toSigned(b[i], size);
+              if (op2 == 0)
+                out[i] = a[i];
+              else if (op2 == -1)
+                out[i] = 0;
+              else {
+                S rem = (op1 % op2);
+                if (rem != 0 && ((rem < 0) != (op2 < 0)))
+                  rem += op2;
+                out[i] = (Word<T>::fromSigned(rem) & mask);
+              }
+            }
+            break;
+
+          /* The remainder takes the sign of the dividend */
+          case BVSREM_NODE:
+            for (triton::usize i = 0; i < lanes; i++) {
+              S op1 = Word<T>::toSigned(a[i], size);
+              S op2 = Word<T>::toSigned(b[i], size);
+              if (op2 == 0)
+                out[i] = a[i];
+              else if (op2 == -1)
+                out[i] = 0;
+              else
+                out[i] = (Word<T>::fromSigned(op1 % op2) & mask);
+            }
+            break;
+
+          case BVSUB_NODE:
+            for (triton::usize i = 0; i < lanes; i++)
+              out[i] = ((a[i] - b[i]) & mask);
+            break;
+
+          case BVUDIV_NODE:
+            for (triton::usize i = 0; i < lanes; i++)
+              out[i] = ((b[i] == 0) ? mask : static_cast<T>(a[i] / b[i]));
+            break;
+
+          case BVUGE_NODE:
+            for (triton::usize i = 0; i < lanes; i++)
+              out[i] = static_cast<T>(a[i] >= b[i]);
+            break;
+
+          case BVUGT_NODE:
+            for (triton::usize i = 0; i < lanes; i++)
+              out[i] = static_cast<T>(a[i] > b[i]);
+            break;
+
+          case BVULE_NODE:
+            for (triton::usize i = 0; i < lanes; i++)
+              out[i] = static_cast<T>(a[i] <= b[i]);
+            break;
+
+          case BVULT_NODE:
+            for (triton::usize i = 0; i < lanes; i++)
+              out[i] = static_cast<T>(a[i] < b[i]);
+            break;
+
+          case BVUREM_NODE:
+            for (triton::usize i = 0; i < lanes; i++)
+              out[i] = ((b[i] == 0) ? a[i] : static_cast<T>(a[i] % b[i]));
+            break;
+
+          case BVXNOR_NODE:
+            for (triton::usize i = 0; i < lanes; i++)
+              out[i] = (~(a[i] ^ b[i]) & mask);
+            break;
+
+          case BVXOR_NODE:
+            for (triton::usize i = 0; i < lanes; i++)
+              out[i] = (a[i] ^ b[i]);
+            break;
+
+          case CONCAT_NODE:
+            for (triton::usize i = 0; i < lanes; i++)
+              out[i] = a[i];
+            for (triton::uint32 index = 1; index < inst->count; index++) {
+              const T* op = regs + ops[index] * stride;
+              for (triton::usize i = 0; i < lanes; i++)
+                out[i] = ((out[i] << this->sizes[ops[index]]) | op[i]);
+            }
+            break;
+
+          case DISTINCT_NODE:
+            for (triton::usize i = 0; i < lanes; i++)
+              out[i] = static_cast<T>(a[i] != b[i]);
+            break;
+
+          case EQUAL_NODE:
+            for (triton::usize i = 0; i < lanes; i++)
+              out[i] = static_cast<T>(a[i] == b[i]);
+            break;
+
+          case EXTRACT_NODE:
+            for (triton::usize i = 0; i < lanes; i++)
+              out[i] = ((c[i] >> inst->immediate) & mask);
+            break;
+
+          case ITE_NODE:
+            for (triton::usize i = 0; i < lanes; i++)
+              out[i] = ((a[i] != 0) ? b[i] : c[i]);
+            break;
+
+          case LAND_NODE:
+            for (triton::usize i = 0; i < lanes; i++)
+              out[i] = 1;
+            for (triton::uint32 index = 0; index < inst->count; index++) {
+              const T* op = regs + ops[index] * stride;
+              for (triton::usize i = 0; i < lanes; i++) {
+                if (op[i] == 0)
+                  out[i] = 0;
+              }
+            }
+            break;
+
+          case LNOT_NODE:
+            for (triton::usize i = 0; i < lanes; i++)
+              out[i] = static_cast<T>(a[i] == 0);
+            break;
+
+          case LOR_NODE:
+            for (triton::usize i = 0; i < lanes; i++)
+              out[i] = 0;
+            for (triton::uint32 index = 0; index < inst->count; index++) {
+              const T* op = regs + ops[index] * stride;
+              for (triton::usize i = 0; i < lanes; i++) {
+                if (op[i] != 0)
+                  out[i] = 1;
+              }
+            }
+            break;
+
+          case REFERENCE_NODE:
+            for (triton::usize i = 0; i < lanes; i++)
+              out[i] = a[i];
+            break;
+
+          case SX_NODE: {
+            triton::uint32 from = this->sizes[ops[1]];
+            T high = ~Word<T>::mask(from);
+            for (triton::usize i = 0; i < lanes; i++) {
+              if ((b[i] >> (from - 1)) & 1)
+                out[i] = ((b[i] | high) & mask);
+              else
+                out[i] = b[i];
+            }
+            break;
+          }
+
+          /* The immediate is the size of the elements of the vectors */
+          case VADD_NODE:
+          case VEQ_NODE: {
+            T element = Word<T>::mask(inst->immediate);
+            for (triton::usize i = 0; i < lanes; i++) {
+              out[i] = 0;
+              for (triton::uint32 low = 0; low < size; low += inst->immediate) {
+                T x = ((b[i] >> low) & element);
+                T y = ((c[i] >> low) & element);
+                if (inst->kind == VADD_NODE)
+                  out[i] |= (((x + y) & element) << low);
+                else if (x == y)
+                  out[i] |= (element << low);
+              }
+            }
+            break;
+          }
+
+          case ZX_NODE:
+            for (triton::usize i = 0; i < lanes; i++)
+              out[i] = b[i];
+            break;
+
+          default:
+            throw triton::exceptions::Ast("AstEvaluator::run(): Invalid instruction.");
+        }
+      }
+    }
+
+
+    const std::vector<triton::engines::symbolic::SymbolicVariable*>& AstEvaluator::getVariables(void) const {
+      return this->variables;
+    }
+
+
+    triton::usize AstEvaluator::getNumberOfInstructions(void) const {
+      return this->program.size();
+    }
+
+
+    void AstEvaluator::execute(const std::vector<triton::uint512>& values) {
+      if (values.size() != this->variables.size())
+        throw triton::exceptions::Ast("AstEvaluator::execute(): Expects one value per symbolic variable.");
+
+      if (this->wide) {
+        for (auto it = this->inputs.begin(); it != this->inputs.end(); it++)
+          this->registers[it->first] = (values[it->second] & Word<triton::uint512>::mask(this->sizes[it->first]));
+        this->run(this->registers.data(), 1, 1);
+      }
+      else {
+        for (auto it = this->inputs.begin(); it != this->inputs.end(); it++)
+          this->registers64[it->first] = (values[it->second] & Word<triton::uint512>::mask(this->sizes[it->first])).convert_to<triton::uint64>();
+        this->run(this->registers64.data(), 1, 1);
+      }
+    }
+
+
+    void AstEvaluator::execute(const triton::uint64* values, triton::usize count, triton::uint64* results, triton::usize root) {
+      if (this->wide)
+        throw triton::exceptions::Ast("AstEvaluator::execute(): A node does not fit in 64 bits.");
+
+      if (root >= this->roots.size())
+        throw triton::exceptions::Ast("AstEvaluator::execute(): Invalid root.");
+
+      /* The constant registers are replicated in every lane once */
+      if (this->lanes64.empty()) {
+        this->lanes64.resize(this->registers64.size() * AstEvaluator::batchSize);
+        for (triton::usize index = 0; index < this->registers64.size(); index++)
+          std::fill_n(this->lanes64.begin() + index * AstEvaluator::batchSize, AstEvaluator::batchSize, this->registers64[index]);
+      }
+
+      triton::usize width  = this->variables.size();
+      triton::uint64* regs = this->lanes64.data();
+      const triton::uint64* output = regs + this->roots[root] * AstEvaluator::batchSize;
+
+      for (triton::usize first = 0; first < count; first += AstEvaluator::batchSize) {
+        triton::usize lanes = (count - first < AstEvaluator::batchSize ? count - first : AstEvaluator::batchSize);
+
+        for (auto it = this->inputs.begin(); it != this->inputs.end(); it++) {
+          triton::uint64 mask = Word<triton::uint64>::mask(this->sizes[it->first]);
+          triton::uint64* input = regs + it->first * AstEvaluator::batchSize;
+          for (triton::usize i = 0; i < lanes; i++)
+            input[i] = (values[(first + i) * width + it->second] & mask);
+        }
+
+        this->run(regs, AstEvaluator::batchSize, lanes);
+        std::copy(output, output + lanes, results + first);
+      }
+    }
+
+
+    std::vector<triton::usize> AstEvaluator::filter(const triton::uint64* values, triton::usize count, triton::usize root) {
+      std::vector<triton::usize> ret;
+      triton::uint64 results[AstEvaluator::batchSize];
+
+      for (triton::usize first = 0; first < count; first += AstEvaluator::batchSize) {
+        triton::usize lanes = (count - first < AstEvaluator::batchSize ? count - first : AstEvaluator::batchSize);
+        this->execute(values + first * this->variables.size(), lanes, results, root);
+        for (triton::usize i = 0; i < lanes; i++) {
+          if (results[i] != 0)
+            ret.push_back(first + i);
+        }
+      }
+
+      return ret;
+    }
+
+
+    bool AstEvaluator::isWide(void) const {
+      return this->wide;
+    }
+
+
+    triton::uint512 AstEvaluator::getValue(triton::usize root) const {
+      if (root >= this->roots.size())
+        throw triton::exceptions::Ast("AstEvaluator::getValue(): Invalid root.");
+
+      if (this->wide)
+        return this->registers[this->roots[root]];
+
+      return this->registers64[this->roots[root]];
+    }
+
+
+    triton::uint512 AstEvaluator::evaluate(const std::vector<triton::uint512>& values) {
+      this->execute(values);
+      return this->getValue(0);
+    }
+
+
+    triton::uint512 AstEvaluator::evaluate(const std::map<triton::usize, triton::uint512>& assignment) {
+      std::vector<triton::uint512> values;
+
+      for (auto it = this->variables.begin(); it != this->variables.end(); it++) {
+        auto value = assignment.find((*it)->getId());
+        values.push_back(value != assignment.end() ? value->second : (*it)->getConcreteValue());
+      }
+
+      return this->evaluate(values);
+    }
+
+  }; /* ast namespace */
+}; /* triton namespace */
@@ -5,8 +5,13 @@
 **  This program is under the terms of the BSD License.
 */
 
+#include <algorithm>
+
 #include <astGarbageCollector.hpp>
+#include <astTraversal.hpp>
+#include <coreUtils.hpp>
 #include <exceptions.hpp>
+#include <symbolicExpression.hpp>
 
 
 
@@ -19,13 +24,18 @@ namespace triton {
       if (modes == nullptr)
         throw triton::exceptions::AstGarbageCollector("AstGarbageCollector::AstGarbageCollector(): The modes API cannot be null.");
 
-      this->backupFlag = isBackup;
-      this->modes      = modes;
+      this->backupFlag  = isBackup;
+      this->epoch       = 0;
+      this->journalFlag = false;
+      this->modes       = modes;
+      this->nurseryFlag = false;
+      std::fill(&this->constantNodes[0][0], &this->constantNodes[0][0] + constantSizes * constantValues, nullptr);
     }
 
 
     AstGarbageCollector::AstGarbageCollector(const AstGarbageCollector& other)
       : triton::ast::AstDictionaries(other) {
+      std::fill(&this->constantNodes[0][0], &this->constantNodes[0][0] + constantSizes * constantValues, nullptr);
       this->copy(other);
     }
 
@@ -44,7 +54,11 @@ namespace triton {
       }
       this->allocatedNodes  = other.allocatedNodes;
       this->backupFlag      = true;
+      this->epoch           = other.epoch;
+      this->generation      = other.generation;
+      this->journalFlag     = false;
       this->modes           = other.modes;
+      this->nurseryFlag     = false;
       this->variableNodes   = other.variableNodes;
     }
 
@@ -52,15 +66,69 @@ namespace triton {
     AstGarbageCollector::~AstGarbageCollector() {
       if (this->backupFlag == false)
         this->freeAllAstNodes();
+
+      /* The constants are owned by this instance, backups included */
+      this->freeConstantNodes();
+    }
+
+
+    void AstGarbageCollector::freeConstantNodes(void) {
+      for (triton::uint32 index = 0; index < constantSizes * constantValues; index++) {
+        triton::ast::AbstractNode*& node = (&this->constantNodes[0][0])[index];
+        if (node == nullptr)
+          continue;
+        for (auto it = node->getChilds().begin(); it != node->getChilds().end(); it++)
+          delete *it;
+        delete node;
+        node = nullptr;
+      }
+    }
+
+
+    /* [private method] */
+    void AstGarbageCollector::unlinkReference(triton::ast::AbstractNode* node) const {
+      if (node->getKind() != triton::ast::REFERENCE_NODE)
+        return;
+
+      /* The AST of a deleted expression may have been freed too */
+      triton::engines::symbolic::SymbolicExpression* expr = reinterpret_cast<triton::ast::ReferenceNode*>(node)->getSymbolicExpression();
+      if (expr != nullptr)
+        expr->getAst()->removeParent(node);
     }
 
 
     void AstGarbageCollector::freeAllAstNodes(void) {
-      for (auto it = this->allocatedNodes.begin(); it != this->allocatedNodes.end(); it++)
+      std::set<triton::ast::AbstractNode*> heapNodes;
+
+      /*
+       * The nodes built by the builders live in the allocator, including nodes
+       * owned by the dictionaries, and releasing the slabs frees them all at once.
+       * Copies made by newInstance() come from the global heap and are deleted
+       * one by one first. The dictionaries must forget their nodes too.
+       */
+      for (auto it = this->allocatedNodes.begin(); it != this->allocatedNodes.end(); it++) {
+        if (!(*it)->isImmortal() && triton::ast::AstNodeAllocator::isOnHeap(*it))
+          heapNodes.insert(*it);
+      }
+
+      for (auto it = this->table.begin(); it != this->table.end(); it++) {
+        if (*it != nullptr && !(*it)->isImmortal() && triton::ast::AstNodeAllocator::isOnHeap(*it))
+          heapNodes.insert(*it);
+      }
+
+      for (auto it = heapNodes.begin(); it != heapNodes.end(); it++)
         delete *it;
 
+      this->clearAstDictionaries();
+      this->allocator.releaseAll();
+
+      /* Frozen nodes have been released with the slabs, the generations of this epoch must not free them again */
+      this->generation.reset();
+      this->epoch++;
+
       this->variableNodes.clear();
       this->allocatedNodes.clear();
+      this->nurseryNodes.clear();
     }
 
 
@@ -72,12 +140,22 @@ namespace triton {
         return;
 
       for (it = nodes.begin(); it != nodes.end(); it++) {
+        /* The constants are shared by every tree */
+        if ((*it)->isImmortal())
+          continue;
+
+        /* Frozen nodes are shared by the snapshots */
+        if ((*it)->isFrozen())
+          continue;
+
         /* Remove the node from the global set */
         this->allocatedNodes.erase(*it);
 
         /* Remove the node from the global variables map */
         if ((*it)->getKind() == triton::ast::VARIABLE_NODE)
-          this->variableNodes.erase(reinterpret_cast<triton::ast::VariableNode*>(*it)->getValue());
+          this->variableNodes.erase(reinterpret_cast<triton::ast::VariableNode*>(*it)->getVariableId());
+
+        this->unlinkReference(*it);
 
         /* Delete the node */
         delete *it;
@@ -87,11 +165,50 @@ namespace triton {
     }
 
 
+    void AstGarbageCollector::releaseAstNode(triton::ast::AbstractNode* node) {
+      std::vector<triton::ast::AbstractNode*> worklist;
+
+      if (node == nullptr || node->decReference() != 0)
+        return;
+
+      /* Do not delete AST nodes if the AST_DICTIONARIES optimization is enabled */
+      if (this->modes->isModeEnabled(triton::modes::AST_DICTIONARIES))
+        return;
+
+      worklist.push_back(node);
+      while (!worklist.empty()) {
+        triton::ast::AbstractNode* current = worklist.back();
+        worklist.pop_back();
+
+        /* The node may have already been freed by someone else */
+        if (this->allocatedNodes.erase(current) == 0)
+          continue;
+
+        /* Remove the node from the global variables map */
+        if (current->getKind() == triton::ast::VARIABLE_NODE) {
+          auto it = this->variableNodes.find(reinterpret_cast<triton::ast::VariableNode*>(current)->getVariableId());
+          if (it != this->variableNodes.end() && it->second == current)
+            this->variableNodes.erase(it);
+        }
+
+        /* Childs lose a holder, free them too if it was the last one */
+        for (auto it = current->getChilds().begin(); it != current->getChilds().end(); it++) {
+          (*it)->removeParent(current);
+          if ((*it)->decReference() == 0)
+            worklist.push_back(*it);
+        }
+
+        this->unlinkReference(current);
+        delete current;
+      }
+    }
+
+
     void AstGarbageCollector::extractUniqueAstNodes(std::set<triton::ast::AbstractNode*>& uniqueNodes, triton::ast::AbstractNode* root) const {
-      std::vector<triton::ast::AbstractNode*>::const_iterator it;
-      uniqueNodes.insert(root);
-      for (it = root->getChilds().begin(); it != root->getChilds().end(); it++)
-        this->extractUniqueAstNodes(uniqueNodes, *it);
+      std::vector<triton::ast::AbstractNode*> nodes;
+
+      triton::ast::nodesExtraction(nodes, root);
+      uniqueNodes.insert(nodes.begin(), nodes.end());
     }
 
 
@@ -105,13 +222,78 @@ namespace triton {
       else {
         /* Record the node */
         this->allocatedNodes.insert(node);
+        if (this->journalFlag)
+          this->journalNodes.push_back(node);
+        if (this->nurseryFlag)
+          this->nurseryNodes.push_back(node);
       }
       return node;
     }
 
 
-    void AstGarbageCollector::recordVariableAstNode(const std::string& name, triton::ast::AbstractNode* node) {
-      this->variableNodes[name] = node;
+    void AstGarbageCollector::recordVariableAstNode(triton::usize symVarId, triton::ast::AbstractNode* node) {
+      if (this->journalFlag)
+        this->journalVariableNodes.push_back(std::make_pair(symVarId, this->getAstVariableNode(symVarId)));
+      this->variableNodes[symVarId] = node;
+    }
+
+
+    triton::ast::AstNodeAllocator* AstGarbageCollector::getAstNodeAllocator(void) {
+      return &this->allocator;
+    }
+
+
+    triton::ast::AbstractNode* AstGarbageCollector::getConstantNode(const triton::uint512& value, triton::uint32 size) {
+      triton::uint32 index = 0;
+
+      switch (size) {
+        case 1:   index = 0; break;
+        case 8:   index = 1; break;
+        case 16:  index = 2; break;
+        case 32:  index = 3; break;
+        case 64:  index = 4; break;
+        case 128: index = 5; break;
+        case 256: index = 6; break;
+        case 512: index = 7; break;
+        default:
+          return nullptr;
+      }
+
+      /* Larger values of a single bit would be printed unmasked */
+      if (value >= (size == 1 ? 2 : constantValues))
+        return nullptr;
+
+      triton::ast::AbstractNode*& node = this->constantNodes[index][value.convert_to<triton::uint32>()];
+      if (node == nullptr) {
+        triton::ast::AbstractNode* valueNode = new triton::ast::DecimalNode(value);
+        triton::ast::AbstractNode* sizeNode  = new triton::ast::DecimalNode(size);
+        valueNode->setImmortal();
+        sizeNode->setImmortal();
+        node = new triton::ast::BvNode(valueNode, sizeNode);
+        node->setImmortal();
+      }
+
+      return node;
+    }
+
+
+    triton::usize AstGarbageCollector::getMemoryUsage(void) const {
+      triton::usize ret   = this->allocator.getReservedBytes();
+      triton::usize nodes = this->allocatedNodes.size() + this->getNumberOfFrozenAstNodes();
+      triton::usize live  = this->allocator.getLiveNodes();
+
+      /* Nodes which do not come from the allocator */
+      if (nodes > live)
+        ret += (nodes - live) * sizeof(triton::ast::AbstractNode);
+
+      ret += this->allocatedNodes.size() * triton::utils::getTreeNodeSize(sizeof(triton::ast::AbstractNode*));
+      ret += this->getNumberOfFrozenAstNodes() * sizeof(triton::ast::AbstractNode*);
+      ret += this->variableNodes.size() * triton::utils::getHashNodeSize(sizeof(std::pair<const triton::usize, triton::ast::AbstractNode*>));
+      ret += this->journalNodes.capacity() * sizeof(triton::ast::AbstractNode*);
+      ret += this->journalVariableNodes.capacity() * sizeof(std::pair<triton::usize, triton::ast::AbstractNode*>);
+      ret += this->nurseryNodes.capacity() * sizeof(triton::ast::AbstractNode*);
+
+      return ret;
     }
 
 
@@ -120,14 +302,15 @@ namespace triton {
     }
 
 
-    const std::map<std::string, triton::ast::AbstractNode*>& AstGarbageCollector::getAstVariableNodes(void) const {
+    const std::unordered_map<triton::usize, triton::ast::AbstractNode*>& AstGarbageCollector::getAstVariableNodes(void) const {
       return this->variableNodes;
     }
 
 
-    triton::ast::AbstractNode* AstGarbageCollector::getAstVariableNode(const std::string& name) const {
-      if (this->variableNodes.find(name) != this->variableNodes.end())
-        return this->variableNodes.at(name);
+    triton::ast::AbstractNode* AstGarbageCollector::getAstVariableNode(triton::usize symVarId) const {
+      auto it = this->variableNodes.find(symVarId);
+      if (it != this->variableNodes.end())
+        return it->second;
       return nullptr;
     }
 
@@ -142,10 +325,178 @@ namespace triton {
     }
 
 
-    void AstGarbageCollector::setAstVariableNodes(const std::map<std::string, triton::ast::AbstractNode*>& nodes) {
+    std::shared_ptr<AstGeneration> AstGarbageCollector::freezeAstNodes(void) {
+      if (this->allocatedNodes.empty())
+        return this->generation;
+
+      std::shared_ptr<AstGeneration> frozen = std::make_shared<AstGeneration>();
+      frozen->nodes.assign(this->allocatedNodes.begin(), this->allocatedNodes.end());
+      frozen->parent = this->generation;
+      frozen->size   = frozen->nodes.size() + (this->generation ? this->generation->size : 0);
+      frozen->epoch  = this->epoch;
+
+      for (auto it = frozen->nodes.begin(); it != frozen->nodes.end(); it++)
+        (*it)->setFrozen();
+
+      /* The journal and the nursery never free frozen nodes, they are not allocated anymore */
+      this->allocatedNodes.clear();
+      this->generation = frozen;
+
+      return frozen;
+    }
+
+
+    const std::shared_ptr<AstGeneration>& AstGarbageCollector::getAstGeneration(void) const {
+      return this->generation;
+    }
+
+
+    triton::usize AstGarbageCollector::getNumberOfFrozenAstNodes(void) const {
+      return this->generation ? this->generation->size : 0;
+    }
+
+
+    void AstGarbageCollector::setAstGeneration(const std::shared_ptr<AstGeneration>& generation) {
+      std::shared_ptr<AstGeneration> previous = this->generation;
+
+      /* The nodes allocated since the last freeze belong to the state replaced */
+      this->setAllocatedAstNodes(std::set<triton::ast::AbstractNode*>());
+
+      /* The nodes of a generation of a previous epoch have been freed with the slabs */
+      if (generation && generation->epoch == this->epoch)
+        this->generation = generation;
+      else
+        this->generation.reset();
+
+      this->releaseAstGeneration(previous);
+    }
+
+
+    void AstGarbageCollector::releaseAstGeneration(std::shared_ptr<AstGeneration>& generation) {
+      std::shared_ptr<AstGeneration> current = std::move(generation);
+
+      /* A generation only held by this pointer is dropped, and then its parent if it was the last holder */
+      while (current && current.use_count() == 1) {
+        if (current->epoch == this->epoch && !this->backupFlag) {
+          for (auto it = current->nodes.begin(); it != current->nodes.end(); it++)
+            delete *it;
+        }
+        std::shared_ptr<AstGeneration> parent = std::move(current->parent);
+        current = std::move(parent);
+      }
+    }
+
+
+    void AstGarbageCollector::setAstVariableNodes(const std::unordered_map<triton::usize, triton::ast::AbstractNode*>& nodes) {
       this->variableNodes = nodes;
     }
 
+
+    void AstGarbageCollector::startJournal(void) {
+      this->journalNodes.clear();
+      this->journalVariableNodes.clear();
+      this->journalFlag = true;
+    }
+
+
+    void AstGarbageCollector::rollbackJournal(void) {
+      if (!this->journalFlag)
+        return;
+
+      this->journalFlag = false;
+
+      /* Restore variable nodes in the reverse order */
+      for (auto it = this->journalVariableNodes.rbegin(); it != this->journalVariableNodes.rend(); it++) {
+        if (it->second == nullptr)
+          this->variableNodes.erase(it->first);
+        else
+          this->variableNodes[it->first] = it->second;
+      }
+
+      /* Free journaled nodes which have not already been freed (e.g. by freeAstNodes) */
+      std::set<triton::ast::AbstractNode*> dead;
+      for (auto it = this->journalNodes.begin(); it != this->journalNodes.end(); it++) {
+        if (this->allocatedNodes.erase(*it))
+          dead.insert(*it);
+      }
+
+      /* Surviving childs must not keep a reference to freed nodes */
+      for (auto it = dead.begin(); it != dead.end(); it++) {
+        for (auto child = (*it)->getChilds().begin(); child != (*it)->getChilds().end(); child++) {
+          if (dead.find(*child) == dead.end()) {
+            (*child)->removeParent(*it);
+            (*child)->decReference();
+          }
+        }
+      }
+
+      for (auto it = dead.begin(); it != dead.end(); it++) {
+        this->unlinkReference(*it);
+        delete *it;
+      }
+
+      this->journalNodes.clear();
+      this->journalVariableNodes.clear();
+    }
+
+
+    void AstGarbageCollector::startNursery(void) {
+      this->nurseryNodes.clear();
+      this->nurseryFlag = true;
+    }
+
+
+    triton::usize AstGarbageCollector::collectNursery(const std::vector<triton::ast::AbstractNode*>& survivors) {
+      std::vector<triton::ast::AbstractNode*> pinned;
+      triton::usize count = 0;
+
+      if (!this->nurseryFlag)
+        return 0;
+
+      this->nurseryFlag = false;
+
+      /* Survivors may have already been freed by someone else (e.g. releaseAstNode) */
+      for (auto it = survivors.begin(); it != survivors.end(); it++) {
+        if (*it != nullptr && this->allocatedNodes.find(*it) != this->allocatedNodes.end()) {
+          (*it)->incReference();
+          pinned.push_back(*it);
+        }
+      }
+
+      /* Childs are built before their parents, so the nursery is swept backward */
+      for (auto it = this->nurseryNodes.rbegin(); it != this->nurseryNodes.rend(); it++) {
+        auto node = this->allocatedNodes.find(*it);
+        if (node == this->allocatedNodes.end() || (*it)->getReferenceCount() != 0)
+          continue;
+
+        this->allocatedNodes.erase(node);
+
+        /* Remove the node from the global variables map */
+        if ((*it)->getKind() == triton::ast::VARIABLE_NODE) {
+          auto var = this->variableNodes.find(reinterpret_cast<triton::ast::VariableNode*>(*it)->getVariableId());
+          if (var != this->variableNodes.end() && var->second == *it)
+            this->variableNodes.erase(var);
+        }
+
+        /* Childs lose a holder, the ones of the nursery are freed when they are visited */
+        for (auto child = (*it)->getChilds().begin(); child != (*it)->getChilds().end(); child++) {
+          (*child)->removeParent(*it);
+          (*child)->decReference();
+        }
+
+        this->unlinkReference(*it);
+        delete *it;
+        count++;
+      }
+
+      for (auto it = pinned.begin(); it != pinned.end(); it++)
+        (*it)->decReference();
+
+      this->nurseryNodes.clear();
+
+      return count;
+    }
+
   }; /* ast namespace */
 }; /*triton namespace */
 
@@ -0,0 +1,198 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#include <new>
+
+#include <ast.hpp>
+#include <astNodeAllocator.hpp>
+#include <hugePageArena.hpp>
+
+
+
+namespace triton {
+  namespace ast {
+
+    AstNodeAllocator::AstNodeAllocator() {
+      this->allocations = 0;
+      this->liveNodes   = 0;
+      this->peakNodes   = 0;
+      this->pools.resize(AstNodeAllocator::maxSizeClasses);
+      for (triton::usize index = 0; index < this->pools.size(); index++) {
+        this->pools[index].freeList = nullptr;
+        this->pools[index].slotSize = sizeof(SlotHeader) + (index * AstNodeAllocator::granularity);
+      }
+    }
+
+
+    AstNodeAllocator::~AstNodeAllocator() {
+      this->releaseAll();
+    }
+
+
+    bool AstNodeAllocator::growPool(Pool& pool) {
+      triton::uint8* slab = static_cast<triton::uint8*>(triton::utils::HugePageArena::allocate(pool.slotSize * AstNodeAllocator::slotsPerSlab));
+
+      if (slab == nullptr)
+        return false;
+
+      /* Thread every slot of the new slab into the free list */
+      for (triton::usize index = AstNodeAllocator::slotsPerSlab; index > 0; index--) {
+        SlotHeader* header = reinterpret_cast<SlotHeader*>(slab + ((index - 1) * pool.slotSize));
+        header->owner = this;
+        header->sizeClass = static_cast<triton::uint32>((pool.slotSize - sizeof(SlotHeader)) / AstNodeAllocator::granularity);
+        header->used = false;
+        *reinterpret_cast<SlotHeader**>(header + 1) = pool.freeList;
+        pool.freeList = header;
+      }
+
+      pool.slabs.push_back(slab);
+      return true;
+    }
+
+
+    void* AstNodeAllocator::allocate(std::size_t size) {
+      triton::usize sizeClass = (size + AstNodeAllocator::granularity - 1) / AstNodeAllocator::granularity;
+
+      if (sizeClass == 0 || sizeClass >= AstNodeAllocator::maxSizeClasses)
+        return AstNodeAllocator::allocateOnHeap(size);
+
+      Pool& pool = this->pools[sizeClass];
+      if (pool.freeList == nullptr && this->growPool(pool) == false)
+        return nullptr;
+
+      SlotHeader* header = pool.freeList;
+      pool.freeList = *reinterpret_cast<SlotHeader**>(header + 1);
+      header->used = true;
+      this->allocations++;
+      if (++this->liveNodes > this->peakNodes)
+        this->peakNodes = this->liveNodes;
+
+      return header + 1;
+    }
+
+
+    void AstNodeAllocator::reserve(std::size_t size, triton::usize count) {
+      triton::usize sizeClass = (size + AstNodeAllocator::granularity - 1) / AstNodeAllocator::granularity;
+      triton::usize freeSlots = 0;
+
+      if (sizeClass == 0 || sizeClass >= AstNodeAllocator::maxSizeClasses)
+        return;
+
+      /* The free list is only walked up to the number of slots needed */
+      Pool& pool = this->pools[sizeClass];
+      for (SlotHeader* header = pool.freeList; header != nullptr && freeSlots < count; header = *reinterpret_cast<SlotHeader**>(header + 1))
+        freeSlots++;
+
+      for (; freeSlots < count; freeSlots += AstNodeAllocator::slotsPerSlab) {
+        if (this->growPool(pool) == false)
+          return;
+      }
+    }
+
+
+    void* AstNodeAllocator::allocateOnHeap(std::size_t size) {
+      SlotHeader* header = static_cast<SlotHeader*>(::operator new(sizeof(SlotHeader) + size, std::nothrow));
+
+      if (header == nullptr)
+        return nullptr;
+
+      header->owner     = nullptr;
+      header->sizeClass = 0;
+      header->used      = true;
+
+      return header + 1;
+    }
+
+
+    void AstNodeAllocator::deallocate(void* ptr) {
+      if (ptr == nullptr)
+        return;
+
+      SlotHeader* header = static_cast<SlotHeader*>(ptr) - 1;
+      if (header->owner == nullptr)
+        ::operator delete(header);
+      else
+        header->owner->release(header);
+    }
+
+
+    bool AstNodeAllocator::isOnHeap(const void* ptr) {
+      return (static_cast<const SlotHeader*>(ptr) - 1)->owner == nullptr;
+    }
+
+
+    void AstNodeAllocator::release(SlotHeader* header) {
+      Pool& pool = this->pools[header->sizeClass];
+
+      header->used = false;
+      *reinterpret_cast<SlotHeader**>(header + 1) = pool.freeList;
+      pool.freeList = header;
+      this->liveNodes--;
+    }
+
+
+    void AstNodeAllocator::releaseAll(void) {
+      for (auto pool = this->pools.begin(); pool != this->pools.end(); pool++) {
+        for (auto slab = pool->slabs.begin(); slab != pool->slabs.end(); slab++) {
+          /* Nodes own heap memory (childs, parents...), so destructors must still be called */
+          for (triton::usize index = 0; index < AstNodeAllocator::slotsPerSlab; index++) {
+            SlotHeader* header = reinterpret_cast<SlotHeader*>(*slab + (index * pool->slotSize));
+            if (header->used)
+              reinterpret_cast<triton::ast::AbstractNode*>(header + 1)->~AbstractNode();
+          }
+          triton::utils::HugePageArena::deallocate(*slab, pool->slotSize * AstNodeAllocator::slotsPerSlab);
+        }
+        pool->slabs.clear();
+        pool->freeList = nullptr;
+      }
+      this->liveNodes = 0;
+    }
+
+
+    triton::usize AstNodeAllocator::getLiveNodes(void) const {
+      return this->liveNodes;
+    }
+
+
+    triton::usize AstNodeAllocator::getReservedBytes(void) const {
+      triton::usize bytes = 0;
+
+      for (auto pool = this->pools.begin(); pool != this->pools.end(); pool++)
+        bytes += pool->slabs.size() * pool->slotSize * AstNodeAllocator::slotsPerSlab;
+
+      return bytes;
+    }
+
+
+    triton::usize AstNodeAllocator::getPeakNodes(void) const {
+      return this->peakNodes;
+    }
+
+
+    triton::usize AstNodeAllocator::getAllocations(void) const {
+      return this->allocations;
+    }
+
+
+    std::vector<triton::usize> AstNodeAllocator::getLiveNodesPerKind(void) const {
+      std::vector<triton::usize> ret(triton::ast::VEQ_NODE + 1, 0);
+
+      for (auto pool = this->pools.begin(); pool != this->pools.end(); pool++) {
+        for (auto slab = pool->slabs.begin(); slab != pool->slabs.end(); slab++) {
+          for (triton::usize index = 0; index < AstNodeAllocator::slotsPerSlab; index++) {
+            const SlotHeader* header = reinterpret_cast<const SlotHeader*>(*slab + (index * pool->slotSize));
+            if (header->used)
+              ret[reinterpret_cast<const triton::ast::AbstractNode*>(header + 1)->getKind()]++;
+          }
+        }
+      }
+
+      return ret;
+    }
+
+  }; /* ast namespace */
+}; /*triton namespace */
@@ -0,0 +1,248 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#include <cctype>
+#include <unordered_map>
+
+#include <api.hpp>
+#include <astPattern.hpp>
+#include <astTraversal.hpp>
+#include <exceptions.hpp>
+
+
+
+namespace triton {
+  namespace ast {
+
+    /* The kinds of nodes by name of their builder */
+    static const std::unordered_map<std::string, triton::uint32> patternKinds = {
+      {"assert_",   ASSERT_NODE},
+      {"bv",        BV_NODE},
+      {"bvadd",     BVADD_NODE},
+      {"bvand",     BVAND_NODE},
+      {"bvashr",    BVASHR_NODE},
+      {"bvdecl",    BVDECL_NODE},
+      {"bvlshr",    BVLSHR_NODE},
+      {"bvmul",     BVMUL_NODE},
+      {"bvnand",    BVNAND_NODE},
+      {"bvneg",     BVNEG_NODE},
+      {"bvnor",     BVNOR_NODE},
+      {"bvnot",     BVNOT_NODE},
+      {"bvor",      BVOR_NODE},
+      {"bvrol",     BVROL_NODE},
+      {"bvror",     BVROR_NODE},
+      {"bvsdiv",    BVSDIV_NODE},
+      {"bvsge",     BVSGE_NODE},
+      {"bvsgt",     BVSGT_NODE},
+      {"bvshl",     BVSHL_NODE},
+      {"bvsle",     BVSLE_NODE},
+      {"bvslt",     BVSLT_NODE},
+      {"bvsmod",    BVSMOD_NODE},
+      {"bvsrem",    BVSREM_NODE},
+      {"bvsub",     BVSUB_NODE},
+      {"bvudiv",    BVUDIV_NODE},
+      {"bvuge",     BVUGE_NODE},
+      {"bvugt",     BVUGT_NODE},
+      {"bvule",     BVULE_NODE},
+      {"bvult",     BVULT_NODE},
+      {"bvurem",    BVUREM_NODE},
+      {"bvxnor",    BVXNOR_NODE},
+      {"bvxor",     BVXOR_NODE},
+      {"compound",  COMPOUND_NODE},
+      {"concat",    CONCAT_NODE},
+      {"decimal",   DECIMAL_NODE},
+      {"distinct",  DISTINCT_NODE},
+      {"equal",     EQUAL_NODE},
+      {"extract",   EXTRACT_NODE},
+      {"ite",       ITE_NODE},
+      {"land",      LAND_NODE},
+      {"let",       LET_NODE},
+      {"lnot",      LNOT_NODE},
+      {"lor",       LOR_NODE},
+      {"reference", REFERENCE_NODE},
+      {"string",    STRING_NODE},
+      {"sx",        SX_NODE},
+      {"vadd",      VADD_NODE},
+      {"variable",  VARIABLE_NODE},
+      {"veq",       VEQ_NODE},
+      {"zx",        ZX_NODE},
+    };
+
+
+    AstPattern::AstPattern(const std::string& pattern) {
+      triton::usize pos = 0;
+
+      this->pattern = pattern;
+      this->root    = this->parseElement(pos);
+
+      this->skipSpaces(pos);
+      if (pos != this->pattern.size())
+        throw triton::exceptions::AstPattern("AstPattern::AstPattern(): Unexpected character at offset " + std::to_string(pos) + " of \"" + pattern + "\".");
+    }
+
+
+    void AstPattern::skipSpaces(triton::usize& pos) const {
+      while (pos < this->pattern.size() && std::isspace(static_cast<unsigned char>(this->pattern[pos])))
+        pos++;
+    }
+
+
+    AstPattern::Element AstPattern::parseElement(triton::usize& pos) const {
+      Element element;
+      triton::usize start = 0;
+
+      element.kind      = UNDEFINED_NODE;
+      element.isInteger = false;
+      element.value     = 0;
+
+      this->skipSpaces(pos);
+      start = pos;
+
+      /* An integer, decimal or hexadecimal */
+      if (pos < this->pattern.size() && std::isdigit(static_cast<unsigned char>(this->pattern[pos]))) {
+        triton::uint32 base = 10;
+
+        if (this->pattern.compare(pos, 2, "0x") == 0) {
+          base = 16;
+          pos += 2;
+        }
+
+        while (pos < this->pattern.size() && std::isxdigit(static_cast<unsigned char>(this->pattern[pos]))) {
+          char c = static_cast<char>(std::tolower(static_cast<unsigned char>(this->pattern[pos])));
+          triton::uint32 digit = std::isdigit(static_cast<unsigned char>(c)) ? (c - '0') : (c - 'a' + 10);
+          if (digit >= base)
+            break;
+          element.value = element.value * base + digit;
+          pos++;
+        }
+
+        if (base == 16 && pos == start + 2)
+          throw triton::exceptions::AstPattern("AstPattern::parseElement(): Invalid integer at offset " + std::to_string(start) + " of \"" + this->pattern + "\".");
+
+        element.isInteger = true;
+        return element;
+      }
+
+      /* An identifier, a wildcard or a kind */
+      while (pos < this->pattern.size() && (std::isalnum(static_cast<unsigned char>(this->pattern[pos])) || this->pattern[pos] == '_'))
+        pos++;
+
+      if (pos == start)
+        throw triton::exceptions::AstPattern("AstPattern::parseElement(): Expects a name or an integer at offset " + std::to_string(start) + " of \"" + this->pattern + "\".");
+
+      std::string name = this->pattern.substr(start, pos - start);
+
+      this->skipSpaces(pos);
+      if (pos >= this->pattern.size() || this->pattern[pos] != '(') {
+        if (name != "_")
+          element.name = name;
+        return element;
+      }
+
+      auto kind = patternKinds.find(name);
+      if (kind == patternKinds.end())
+        throw triton::exceptions::AstPattern("AstPattern::parseElement(): Unknown kind of node \"" + name + "\" in \"" + this->pattern + "\".");
+      element.kind = kind->second;
+
+      /* The children */
+      pos++;
+      this->skipSpaces(pos);
+      if (pos < this->pattern.size() && this->pattern[pos] == ')') {
+        pos++;
+        return element;
+      }
+
+      while (true) {
+        element.childs.push_back(this->parseElement(pos));
+        this->skipSpaces(pos);
+
+        if (pos < this->pattern.size() && this->pattern[pos] == ',') {
+          pos++;
+          continue;
+        }
+
+        if (pos < this->pattern.size() && this->pattern[pos] == ')') {
+          pos++;
+          return element;
+        }
+
+        throw triton::exceptions::AstPattern("AstPattern::parseElement(): Expects ',' or ')' at offset " + std::to_string(pos) + " of \"" + this->pattern + "\".");
+      }
+    }
+
+
+    bool AstPattern::matchElement(const Element& element, AbstractNode* node, std::map<std::string, AbstractNode*>& bindings) const {
+      /* A wildcard or an identifier */
+      if (element.kind == UNDEFINED_NODE && !element.isInteger) {
+        if (element.name.empty())
+          return true;
+
+        auto it = bindings.find(element.name);
+        if (it == bindings.end()) {
+          bindings[element.name] = node;
+          return true;
+        }
+
+        return (it->second == node || it->second->hash(1) == node->hash(1));
+      }
+
+      /* A reference is followed unless the pattern expects a reference */
+      while (node->getKind() == REFERENCE_NODE && element.kind != REFERENCE_NODE)
+        node = reinterpret_cast<ReferenceNode*>(node)->getAst();
+
+      if (element.isInteger) {
+        if (node->getKind() == DECIMAL_NODE)
+          return reinterpret_cast<DecimalNode*>(node)->getValue() == element.value;
+        if (node->getKind() == BV_NODE)
+          return reinterpret_cast<DecimalNode*>(node->getChilds()[0])->getValue() == element.value;
+        return false;
+      }
+
+      if (node->getKind() != element.kind || node->getChilds().size() != element.childs.size())
+        return false;
+
+      for (triton::usize index = 0; index < element.childs.size(); index++) {
+        if (!this->matchElement(element.childs[index], node->getChilds()[index], bindings))
+          return false;
+      }
+
+      return true;
+    }
+
+
+    const std::string& AstPattern::getPattern(void) const {
+      return this->pattern;
+    }
+
+
+    bool AstPattern::match(AbstractNode* node, std::map<std::string, AbstractNode*>& bindings) const {
+      if (node == nullptr)
+        throw triton::exceptions::AstPattern("AstPattern::match(): node cannot be null.");
+
+      bindings.clear();
+      if (this->matchElement(this->root, node, bindings))
+        return true;
+
+      bindings.clear();
+      return false;
+    }
+
+
+    void AstPattern::search(std::vector<AbstractNode*>& output, AbstractNode* root, bool unroll) const {
+      std::map<std::string, AbstractNode*> bindings;
+      std::vector<AbstractNode*> nodes;
+
+      triton::ast::nodesExtraction(nodes, root, unroll, true);
+      for (auto it = nodes.begin(); it != nodes.end(); it++) {
+        if (this->matchElement(this->root, *it, bindings))
+          output.push_back(*it);
+        bindings.clear();
+      }
+    }
+
+  }; /* ast namespace */
+}; /* triton namespace */
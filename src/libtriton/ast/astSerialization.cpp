@@ -0,0 +1,460 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#include <algorithm>
+#include <limits>
+
+#include <api.hpp>
+#include <astSerialization.hpp>
+#include <astTraversal.hpp>
+#include <exceptions.hpp>
+
+
+
+namespace triton {
+  namespace ast {
+
+    /* The magic of a serialized stream */
+    static const char serializationMagic[] = {'T', 'R', 'T', 'N'};
+
+    /* The maximum number of bytes of a varint (512 bits, 7 bits per byte) */
+    static const triton::uint32 maxVarintSize = 74;
+
+
+    AstWriter::AstWriter(std::ostream& stream) : stream(stream) {
+      this->numberOfEntries = 0;
+      this->stream.write(serializationMagic, sizeof(serializationMagic));
+      this->writeUnsigned(serializationVersion);
+    }
+
+
+    /* Writes the node record of a node whose children are in the table already */
+    triton::usize AstWriter::writeEntry(AbstractNode* node) {
+      std::vector<triton::usize> childs;
+
+      switch (node->getKind()) {
+        case ARRAY_NODE:
+          this->writeTag(SERIAL_NODE);
+          this->writeUnsigned(ARRAY_NODE);
+          this->writeUnsigned(reinterpret_cast<ArrayNode*>(node)->getIndexSize());
+          this->writeString(reinterpret_cast<ArrayNode*>(node)->getName());
+          return this->numberOfEntries++;
+
+        case DECIMAL_NODE: {
+          triton::uint512 value = reinterpret_cast<DecimalNode*>(node)->getValue();
+          auto it = this->decimals.find(value);
+          if (it != this->decimals.end())
+            return it->second;
+          this->writeTag(SERIAL_NODE);
+          this->writeUnsigned(DECIMAL_NODE);
+          this->writeUnsigned(value);
+          this->decimals[value] = this->numberOfEntries;
+          return this->numberOfEntries++;
+        }
+
+        case REFERENCE_NODE:
+          this->writeTag(SERIAL_NODE);
+          this->writeUnsigned(REFERENCE_NODE);
+          this->writeUnsigned(reinterpret_cast<ReferenceNode*>(node)->getValue());
+          return this->numberOfEntries++;
+
+        case STRING_NODE:
+          this->writeTag(SERIAL_NODE);
+          this->writeUnsigned(STRING_NODE);
+          this->writeString(reinterpret_cast<StringNode*>(node)->getValue());
+          return this->numberOfEntries++;
+
+        case VARIABLE_NODE:
+          this->writeTag(SERIAL_NODE);
+          this->writeUnsigned(VARIABLE_NODE);
+          this->writeString(reinterpret_cast<VariableNode*>(node)->getValue());
+          return this->numberOfEntries++;
+
+        default:
+          break;
+      }
+
+      for (auto it = node->getChilds().begin(); it != node->getChilds().end(); it++)
+        childs.push_back(this->entries.at(*it));
+
+      if (node->getKind() == BV_NODE) {
+        auto key = std::make_pair(childs[0], childs[1]);
+        auto it  = this->bitvectors.find(key);
+        if (it != this->bitvectors.end())
+          return it->second;
+        this->bitvectors[key] = this->numberOfEntries;
+      }
+
+      /* Children are written as distances, they are small as long as children are close to their parent */
+      this->writeTag(SERIAL_NODE);
+      this->writeUnsigned(node->getKind());
+      this->writeUnsigned(childs.size());
+      for (auto it = childs.begin(); it != childs.end(); it++)
+        this->writeUnsigned(this->numberOfEntries - *it);
+
+      return this->numberOfEntries++;
+    }
+
+
+    triton::usize AstWriter::writeNode(AbstractNode* node) {
+      std::vector<AbstractNode*> order;
+
+      if (node == nullptr)
+        throw triton::exceptions::AstSerialization("AstWriter::writeNode(): The node cannot be null.");
+
+      triton::ast::nodesExtraction(order, node, this->visited);
+      for (auto it = order.begin(); it != order.end(); it++)
+        this->entries[*it] = this->writeEntry(*it);
+
+      return this->entries.at(node);
+    }
+
+
+    void AstWriter::writeRoot(AbstractNode* node) {
+      triton::usize entry = this->writeNode(node);
+      this->writeTag(SERIAL_ROOT);
+      this->writeUnsigned(entry);
+    }
+
+
+    void AstWriter::writeTag(serialization_e tag) {
+      this->stream.put(static_cast<char>(tag));
+    }
+
+
+    void AstWriter::writeUnsigned(triton::uint512 value) {
+      while (value >= 0x80) {
+        this->stream.put(static_cast<char>((value & 0x7f).convert_to<triton::uint32>() | 0x80));
+        value >>= 7;
+      }
+      this->stream.put(static_cast<char>(value.convert_to<triton::uint32>()));
+    }
+
+
+    void AstWriter::writeString(const std::string& value) {
+      this->writeUnsigned(value.size());
+      this->stream.write(value.data(), value.size());
+    }
+
+
+    void AstWriter::writeEnd(void) {
+      this->writeTag(SERIAL_END);
+      if (!this->stream)
+        throw triton::exceptions::AstSerialization("AstWriter::writeEnd(): Cannot write the stream.");
+    }
+
+
+    AstReader::AstReader(std::istream& stream) : stream(stream) {
+      char magic[sizeof(serializationMagic)];
+
+      if (!this->stream.read(magic, sizeof(magic)) || !std::equal(magic, magic + sizeof(magic), serializationMagic))
+        throw triton::exceptions::AstSerialization("AstReader::AstReader(): Invalid magic.");
+
+      if (this->readUnsigned64() != serializationVersion)
+        throw triton::exceptions::AstSerialization("AstReader::AstReader(): Unsupported version.");
+    }
+
+
+    serialization_e AstReader::readTag(void) {
+      triton::uint64 tag = this->readUnsigned64();
+
+      if (tag > SERIAL_PATH_CONSTRAINT)
+        throw triton::exceptions::AstSerialization("AstReader::readTag(): Invalid record.");
+
+      return static_cast<serialization_e>(tag);
+    }
+
+
+    void AstReader::readNode(void) {
+      triton::usize entry = this->nodes.size();
+      triton::uint64 kind = this->readUnsigned64();
+      AbstractNode* node  = nullptr;
+
+      switch (kind) {
+        case ARRAY_NODE: {
+          triton::uint32 indexSize = static_cast<triton::uint32>(this->readUnsigned64());
+          node = triton::ast::array(indexSize, this->readString());
+          break;
+        }
+
+        case DECIMAL_NODE:
+          this->values[entry] = this->readUnsigned();
+          break;
+
+        case REFERENCE_NODE: {
+          triton::usize id = this->readUnsigned64();
+          auto it = this->references.find(id);
+          node = triton::ast::reference(it != this->references.end() ? it->second : id);
+          break;
+        }
+
+        case STRING_NODE:
+          node = triton::ast::string(this->readString());
+          break;
+
+        case VARIABLE_NODE: {
+          std::string name = this->readString();
+          auto it = this->variables.find(name);
+          triton::engines::symbolic::SymbolicVariable* symVar = (it != this->variables.end()) ? it->second : triton::getCurrentApi().getSymbolicVariableFromName(name);
+          if (symVar == nullptr)
+            throw triton::exceptions::AstSerialization("AstReader::readNode(): Unknown symbolic variable " + name + ".");
+          node = triton::ast::variable(*symVar);
+          break;
+        }
+
+        default: {
+          std::vector<triton::usize> childs;
+          triton::uint64 count = this->readUnsigned64();
+
+          for (triton::uint64 index = 0; index < count; index++) {
+            triton::uint64 distance = this->readUnsigned64();
+            if (distance == 0 || distance > entry)
+              throw triton::exceptions::AstSerialization("AstReader::readNode(): Invalid child.");
+            childs.push_back(entry - distance);
+          }
+
+          node = this->buildNode(static_cast<triton::uint32>(kind), childs);
+          break;
+        }
+      }
+
+      this->nodes.push_back(node);
+    }
+
+
+    /* Builds a node with the node builders, decimal operands are given as values */
+    AbstractNode* AstReader::buildNode(triton::uint32 kind, const std::vector<triton::usize>& childs) {
+      std::vector<AbstractNode*> exprs;
+      triton::usize arity = 0;
+
+      switch (kind) {
+        case ASSERT_NODE:
+        case BVDECL_NODE:
+        case BVNEG_NODE:
+        case BVNOT_NODE:
+        case LNOT_NODE:
+          arity = 1;
+          break;
+
+        case EXTRACT_NODE:
+        case ITE_NODE:
+        case LET_NODE:
+        case STORE_NODE:
+        case VADD_NODE:
+        case VEQ_NODE:
+          arity = 3;
+          break;
+
+        case COMPOUND_NODE:
+        case CONCAT_NODE:
+          if (childs.empty())
+            throw triton::exceptions::AstSerialization("AstReader::buildNode(): A node has no children.");
+          for (auto it = childs.begin(); it != childs.end(); it++)
+            exprs.push_back(this->getNode(*it));
+          return (kind == COMPOUND_NODE) ? triton::ast::compound(exprs) : triton::ast::concat(exprs);
+
+        default:
+          arity = 2;
+          break;
+      }
+
+      if (childs.size() != arity)
+        throw triton::exceptions::AstSerialization("AstReader::buildNode(): Invalid number of children.");
+
+      switch (kind) {
+        case ASSERT_NODE:             return triton::ast::assert_(this->getNode(childs[0]));
+        case BVADD_NODE:              return triton::ast::bvadd(this->getNode(childs[0]), this->getNode(childs[1]));
+        case BVAND_NODE:              return triton::ast::bvand(this->getNode(childs[0]), this->getNode(childs[1]));
+        case BVASHR_NODE:             return triton::ast::bvashr(this->getNode(childs[0]), this->getNode(childs[1]));
+        case BVDECL_NODE:             return triton::ast::bvdecl(this->getValue(childs[0]).convert_to<triton::uint32>());
+        case BVLSHR_NODE:             return triton::ast::bvlshr(this->getNode(childs[0]), this->getNode(childs[1]));
+        case BVMUL_NODE:              return triton::ast::bvmul(this->getNode(childs[0]), this->getNode(childs[1]));
+        case BVNAND_NODE:             return triton::ast::bvnand(this->getNode(childs[0]), this->getNode(childs[1]));
+        case BVNEG_NODE:              return triton::ast::bvneg(this->getNode(childs[0]));
+        case BVNOR_NODE:              return triton::ast::bvnor(this->getNode(childs[0]), this->getNode(childs[1]));
+        case BVNOT_NODE:              return triton::ast::bvnot(this->getNode(childs[0]));
+        case BVOR_NODE:               return triton::ast::bvor(this->getNode(childs[0]), this->getNode(childs[1]));
+        case BVROL_NODE:              return triton::ast::bvrol(this->getNode(childs[0]), this->getNode(childs[1]));
+        case BVROR_NODE:              return triton::ast::bvror(this->getNode(childs[0]), this->getNode(childs[1]));
+        case BVSDIV_NODE:             return triton::ast::bvsdiv(this->getNode(childs[0]), this->getNode(childs[1]));
+        case BVSGE_NODE:              return triton::ast::bvsge(this->getNode(childs[0]), this->getNode(childs[1]));
+        case BVSGT_NODE:              return triton::ast::bvsgt(this->getNode(childs[0]), this->getNode(childs[1]));
+        case BVSHL_NODE:              return triton::ast::bvshl(this->getNode(childs[0]), this->getNode(childs[1]));
+        case BVSLE_NODE:              return triton::ast::bvsle(this->getNode(childs[0]), this->getNode(childs[1]));
+        case BVSLT_NODE:              return triton::ast::bvslt(this->getNode(childs[0]), this->getNode(childs[1]));
+        case BVSMOD_NODE:             return triton::ast::bvsmod(this->getNode(childs[0]), this->getNode(childs[1]));
+        case BVSREM_NODE:             return triton::ast::bvsrem(this->getNode(childs[0]), this->getNode(childs[1]));
+        case BVSUB_NODE:              return triton::ast::bvsub(this->getNode(childs[0]), this->getNode(childs[1]));
+        case BVUDIV_NODE:             return triton::ast::bvudiv(this->getNode(childs[0]), this->getNode(childs[1]));
+        case BVUGE_NODE:              return triton::ast::bvuge(this->getNode(childs[0]), this->getNode(childs[1]));
+        case BVUGT_NODE:              return triton::ast::bvugt(this->getNode(childs[0]), this->getNode(childs[1]));
+        case BVULE_NODE:              return triton::ast::bvule(this->getNode(childs[0]), this->getNode(childs[1]));
+        case BVULT_NODE:              return triton::ast::bvult(this->getNode(childs[0]), this->getNode(childs[1]));
+        case BVUREM_NODE:             return triton::ast::bvurem(this->getNode(childs[0]), this->getNode(childs[1]));
+        case BVXNOR_NODE:             return triton::ast::bvxnor(this->getNode(childs[0]), this->getNode(childs[1]));
+        case BVXOR_NODE:              return triton::ast::bvxor(this->getNode(childs[0]), this->getNode(childs[1]));
+        case BV_NODE:                 return triton::ast::bv(this->getValue(childs[0]), this->getValue(childs[1]).convert_to<triton::uint32>());
+        case DECLARE_FUNCTION_NODE:   return triton::ast::declareFunction(this->getString(childs[0]), this->getNode(childs[1]));
+        case DISTINCT_NODE:           return triton::ast::distinct(this->getNode(childs[0]), this->getNode(childs[1]));
+        case EQUAL_NODE:              return triton::ast::equal(this->getNode(childs[0]), this->getNode(childs[1]));
+        case EXTRACT_NODE:            return triton::ast::extract(this->getValue(childs[0]).convert_to<triton::uint32>(), this->getValue(childs[1]).convert_to<triton::uint32>(), this->getNode(childs[2]));
+        case ITE_NODE:                return triton::ast::ite(this->getNode(childs[0]), this->getNode(childs[1]), this->getNode(childs[2]));
+        case LAND_NODE:               return triton::ast::land(this->getNode(childs[0]), this->getNode(childs[1]));
+        case LET_NODE:                return triton::ast::let(this->getString(childs[0]), this->getNode(childs[1]), this->getNode(childs[2]));
+        case LNOT_NODE:               return triton::ast::lnot(this->getNode(childs[0]));
+        case LOR_NODE:                return triton::ast::lor(this->getNode(childs[0]), this->getNode(childs[1]));
+        case SELECT_NODE:             return triton::ast::select(this->getNode(childs[0]), this->getNode(childs[1]));
+        case STORE_NODE:              return triton::ast::store(this->getNode(childs[0]), this->getNode(childs[1]), this->getNode(childs[2]));
+        case SX_NODE:                 return triton::ast::sx(this->getValue(childs[0]).convert_to<triton::uint32>(), this->getNode(childs[1]));
+        case VADD_NODE:               return triton::ast::vadd(this->getValue(childs[0]).convert_to<triton::uint32>(), this->getNode(childs[1]), this->getNode(childs[2]));
+        case VEQ_NODE:                return triton::ast::veq(this->getValue(childs[0]).convert_to<triton::uint32>(), this->getNode(childs[1]), this->getNode(childs[2]));
+        case ZX_NODE:                 return triton::ast::zx(this->getValue(childs[0]).convert_to<triton::uint32>(), this->getNode(childs[1]));
+        default:
+          throw triton::exceptions::AstSerialization("AstReader::buildNode(): Invalid kind node.");
+      }
+    }
+
+
+    void AstReader::readRoot(void) {
+      this->roots.push_back(this->readEntry());
+    }
+
+
+    AbstractNode* AstReader::readEntry(void) {
+      return this->getNode(this->readUnsigned64());
+    }
+
+
+    triton::uint512 AstReader::readUnsigned(void) {
+      triton::uint512 value = 0;
+
+      for (triton::uint32 index = 0; index < maxVarintSize; index++) {
+        int byte = this->stream.get();
+        if (byte == std::char_traits<char>::eof())
+          throw triton::exceptions::AstSerialization("AstReader::readUnsigned(): Unexpected end of stream.");
+        value |= (triton::uint512(byte & 0x7f) << (index * 7));
+        if ((byte & 0x80) == 0)
+          return value;
+      }
+
+      throw triton::exceptions::AstSerialization("AstReader::readUnsigned(): Invalid varint.");
+    }
+
+
+    triton::uint64 AstReader::readUnsigned64(void) {
+      triton::uint512 value = this->readUnsigned();
+
+      if (value > triton::uint512(std::numeric_limits<triton::uint64>::max()))
+        throw triton::exceptions::AstSerialization("AstReader::readUnsigned64(): The value does not fit in 64 bits.");
+
+      return value.convert_to<triton::uint64>();
+    }
+
+
+    std::string AstReader::readString(void) {
+      triton::uint64 size = this->readUnsigned64();
+      std::string value;
+
+      /* Read by chunks, so that a corrupted size does not allocate a huge string */
+      while (size) {
+        char buffer[256];
+        std::streamsize chunk = static_cast<std::streamsize>(std::min<triton::uint64>(size, sizeof(buffer)));
+        if (!this->stream.read(buffer, chunk))
+          throw triton::exceptions::AstSerialization("AstReader::readString(): Unexpected end of stream.");
+        value.append(buffer, static_cast<std::size_t>(chunk));
+        size -= chunk;
+      }
+
+      return value;
+    }
+
+
+    AbstractNode* AstReader::getNode(triton::usize entry) {
+      if (entry >= this->nodes.size())
+        throw triton::exceptions::AstSerialization("AstReader::getNode(): Invalid entry.");
+
+      /* Decimal nodes are only built once they are used as a node */
+      if (this->nodes[entry] == nullptr)
+        this->nodes[entry] = triton::ast::decimal(this->values.at(entry));
+
+      return this->nodes[entry];
+    }
+
+
+    triton::uint512 AstReader::getValue(triton::usize entry) {
+      if (entry >= this->nodes.size())
+        throw triton::exceptions::AstSerialization("AstReader::getValue(): Invalid entry.");
+
+      if (this->nodes[entry] == nullptr)
+        return this->values.at(entry);
+
+      if (this->nodes[entry]->getKind() != DECIMAL_NODE)
+        throw triton::exceptions::AstSerialization("AstReader::getValue(): The entry is not a decimal node.");
+
+      return reinterpret_cast<DecimalNode*>(this->nodes[entry])->getValue();
+    }
+
+
+    std::string AstReader::getString(triton::usize entry) {
+      AbstractNode* node = this->getNode(entry);
+
+      if (node->getKind() != STRING_NODE)
+        throw triton::exceptions::AstSerialization("AstReader::getString(): The entry is not a string node.");
+
+      return reinterpret_cast<StringNode*>(node)->getValue();
+    }
+
+
+    const std::vector<AbstractNode*>& AstReader::getRoots(void) const {
+      return this->roots;
+    }
+
+
+    void AstReader::setVariable(const std::string& name, triton::engines::symbolic::SymbolicVariable* symVar) {
+      this->variables[name] = symVar;
+    }
+
+
+    void AstReader::setReference(triton::usize oldId, triton::usize newId) {
+      this->references[oldId] = newId;
+    }
+
+
+    void serialize(std::ostream& stream, const std::vector<AbstractNode*>& asts) {
+      AstWriter writer(stream);
+
+      for (auto it = asts.begin(); it != asts.end(); it++)
+        writer.writeRoot(*it);
+
+      writer.writeEnd();
+    }
+
+
+    std::vector<AbstractNode*> deserialize(std::istream& stream) {
+      AstReader reader(stream);
+
+      while (true) {
+        switch (reader.readTag()) {
+          case SERIAL_END:
+            return reader.getRoots();
+
+          case SERIAL_NODE:
+            reader.readNode();
+            break;
+
+          case SERIAL_ROOT:
+            reader.readRoot();
+            break;
+
+          default:
+            throw triton::exceptions::AstSerialization("triton::ast::deserialize(): Unexpected record.");
+        }
+      }
+    }
+
+  }; /* ast namespace */
+}; /* triton namespace */
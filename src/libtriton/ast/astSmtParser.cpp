@@ -0,0 +1,607 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#include <algorithm>
+#include <cctype>
+#include <map>
+#include <string>
+
+#include <api.hpp>
+#include <astSmtParser.hpp>
+#include <exceptions.hpp>
+
+
+
+namespace triton {
+  namespace ast {
+
+    /* The operators by name. The ones with more than two arguments are applied from the left. */
+    static const std::map<std::string, triton::ast::kind_e> smtOperators = {
+      {"and",           LAND_NODE},
+      {"bvadd",         BVADD_NODE},
+      {"bvand",         BVAND_NODE},
+      {"bvashr",        BVASHR_NODE},
+      {"bvlshr",        BVLSHR_NODE},
+      {"bvmul",         BVMUL_NODE},
+      {"bvnand",        BVNAND_NODE},
+      {"bvneg",         BVNEG_NODE},
+      {"bvnor",         BVNOR_NODE},
+      {"bvnot",         BVNOT_NODE},
+      {"bvor",          BVOR_NODE},
+      {"bvsdiv",        BVSDIV_NODE},
+      {"bvsge",         BVSGE_NODE},
+      {"bvsgt",         BVSGT_NODE},
+      {"bvshl",         BVSHL_NODE},
+      {"bvsle",         BVSLE_NODE},
+      {"bvslt",         BVSLT_NODE},
+      {"bvsmod",        BVSMOD_NODE},
+      {"bvsrem",        BVSREM_NODE},
+      {"bvsub",         BVSUB_NODE},
+      {"bvudiv",        BVUDIV_NODE},
+      {"bvuge",         BVUGE_NODE},
+      {"bvugt",         BVUGT_NODE},
+      {"bvule",         BVULE_NODE},
+      {"bvult",         BVULT_NODE},
+      {"bvurem",        BVUREM_NODE},
+      {"bvxnor",        BVXNOR_NODE},
+      {"bvxor",         BVXOR_NODE},
+      {"concat",        CONCAT_NODE},
+      {"distinct",      DISTINCT_NODE},
+      {"=",             EQUAL_NODE},
+      {"extract",       EXTRACT_NODE},
+      {"ite",           ITE_NODE},
+      {"not",           LNOT_NODE},
+      {"or",            LOR_NODE},
+      {"rotate_left",   BVROL_NODE},
+      {"rotate_right",  BVROR_NODE},
+      {"select",        SELECT_NODE},
+      {"sign_extend",   SX_NODE},
+      {"store",         STORE_NODE},
+      {"zero_extend",   ZX_NODE},
+    };
+
+
+    /* Returns true if a string is a non empty sequence of digits of a base */
+    static bool isNumeral(const std::string& value, triton::usize start, int base) {
+      if (value.size() <= start)
+        return false;
+
+      for (triton::usize index = start; index < value.size(); index++) {
+        char c = value[index];
+        if (base == 2 && c != '0' && c != '1')
+          return false;
+        if (base == 10 && !std::isdigit(static_cast<unsigned char>(c)))
+          return false;
+        if (base == 16 && !std::isxdigit(static_cast<unsigned char>(c)))
+          return false;
+      }
+
+      return true;
+    }
+
+
+    /* Returns true if a string is a numeral which fits in 32 bits */
+    static bool isIndex(const std::string& value) {
+      return isNumeral(value, 0, 10) && value.size() <= 10 && std::stoull(value) <= 0xffffffff;
+    }
+
+
+    AstSmtParser::AstSmtParser(std::istream& stream) : stream(stream) {
+      this->line = 1;
+    }
+
+
+    std::string AstSmtParser::located(const std::string& message) const {
+      return message + " (line " + std::to_string(this->line) + ")";
+    }
+
+
+    AstSmtParser::Token AstSmtParser::readToken(void) {
+      Token token;
+      int c = 0;
+
+      /* Skips the blanks and the comments */
+      while (true) {
+        c = this->stream.get();
+        if (c == ';') {
+          while (c != std::char_traits<char>::eof() && c != '\n')
+            c = this->stream.get();
+        }
+        if (c == '\n')
+          this->line++;
+        else if (c == std::char_traits<char>::eof() || !std::isspace(c))
+          break;
+      }
+
+      if (c == std::char_traits<char>::eof()) {
+        token.kind = TOKEN_END;
+        return token;
+      }
+
+      if (c == '(' || c == ')') {
+        token.kind = (c == '(') ? TOKEN_OPEN : TOKEN_CLOSE;
+        return token;
+      }
+
+      /* "..." with "" for a quote, |...| for a quoted symbol */
+      if (c == '"' || c == '|') {
+        int quote = c;
+        token.kind = (c == '"') ? TOKEN_STRING : TOKEN_SYMBOL;
+        while (true) {
+          c = this->stream.get();
+          if (c == std::char_traits<char>::eof())
+            throw triton::exceptions::AstParser(this->located("AstSmtParser::readToken(): Unterminated string or quoted symbol."));
+          if (c == '\n')
+            this->line++;
+          if (c == quote) {
+            if (quote == '|' || this->stream.peek() != '"')
+              return token;
+            this->stream.get();
+          }
+          token.value += static_cast<char>(c);
+        }
+      }
+
+      token.kind = TOKEN_SYMBOL;
+      token.value += static_cast<char>(c);
+      while (true) {
+        c = this->stream.peek();
+        if (c == std::char_traits<char>::eof() || std::isspace(c) || c == '(' || c == ')' || c == ';' || c == '"' || c == '|')
+          return token;
+        token.value += static_cast<char>(this->stream.get());
+      }
+    }
+
+
+    std::string AstSmtParser::readSymbol(void) {
+      Token token = this->readToken();
+
+      if (token.kind != TOKEN_SYMBOL)
+        throw triton::exceptions::AstParser(this->located("AstSmtParser::readSymbol(): Expects a symbol."));
+
+      return token.value;
+    }
+
+
+    triton::uint32 AstSmtParser::readIndex(void) {
+      std::string value = this->readSymbol();
+
+      if (!isIndex(value))
+        throw triton::exceptions::AstParser(this->located("AstSmtParser::readIndex(): Invalid numeral " + value + "."));
+
+      return static_cast<triton::uint32>(std::stoull(value));
+    }
+
+
+    void AstSmtParser::readClose(void) {
+      if (this->readToken().kind != TOKEN_CLOSE)
+        throw triton::exceptions::AstParser(this->located("AstSmtParser::readClose(): Expects a closing parenthesis."));
+    }
+
+
+    /* Bool, (_ BitVec size) or (Array (_ BitVec indexSize) (_ BitVec 8)) */
+    AstSmtParser::Sort AstSmtParser::readSort(void) {
+      Token token = this->readToken();
+      Sort sort;
+
+      sort.indexSize = 0;
+      sort.size      = 0;
+
+      if (token.kind == TOKEN_SYMBOL && token.value == "Bool")
+        return sort;
+
+      if (token.kind != TOKEN_OPEN)
+        throw triton::exceptions::AstParser(this->located("AstSmtParser::readSort(): Invalid sort."));
+
+      std::string name = this->readSymbol();
+      if (name == "Array") {
+        Sort index = this->readSort();
+        Sort value = this->readSort();
+        if (index.indexSize != 0 || index.size == 0 || value.indexSize != 0 || value.size != 8)
+          throw triton::exceptions::AstParser(this->located("AstSmtParser::readSort(): Only arrays of bytes indexed by bitvectors are supported."));
+        sort.indexSize = index.size;
+        sort.size      = value.size;
+      }
+      else if (name == "_" && this->readSymbol() == "BitVec") {
+        sort.size = this->readIndex();
+        if (sort.size == 0)
+          throw triton::exceptions::AstParser(this->located("AstSmtParser::readSort(): Invalid bitvector size."));
+      }
+      else
+        throw triton::exceptions::AstParser(this->located("AstSmtParser::readSort(): Invalid sort."));
+
+      this->readClose();
+      return sort;
+    }
+
+
+    /* Reads a term with an explicit stack of the applications being read */
+    AbstractNode* AstSmtParser::readTerm(void) {
+      std::vector<Frame> frames;
+
+      while (true) {
+        AbstractNode* node = nullptr;
+
+        /* (let ((name term) ...) term) */
+        if (!frames.empty() && frames.back().binding) {
+          Frame& frame = frames.back();
+          Token token  = this->readToken();
+
+          /* The bindings are parallel, they are visible once they are all read */
+          if (token.kind == TOKEN_CLOSE) {
+            for (auto it = frame.lets.begin(); it != frame.lets.end(); it++)
+              this->bindings[it->first].push_back(it->second);
+            frame.binding = false;
+            continue;
+          }
+
+          if (token.kind != TOKEN_OPEN)
+            throw triton::exceptions::AstParser(this->located("AstSmtParser::readTerm(): Invalid let binding."));
+
+          frame.lets.push_back(std::make_pair(this->readSymbol(), nullptr));
+        }
+
+        Token token = this->readToken();
+
+        if (token.kind == TOKEN_SYMBOL)
+          node = this->getSymbol(token.value);
+
+        else if (token.kind == TOKEN_OPEN) {
+          Token head = this->readToken();
+          Frame frame;
+
+          frame.binding = false;
+
+          /* ((_ op index ...) term ...) */
+          if (head.kind == TOKEN_OPEN) {
+            if (this->readSymbol() != "_")
+              throw triton::exceptions::AstParser(this->located("AstSmtParser::readTerm(): Invalid indexed operator."));
+            frame.op = this->readSymbol();
+            while ((head = this->readToken()).kind == TOKEN_SYMBOL) {
+              if (!isIndex(head.value))
+                throw triton::exceptions::AstParser(this->located("AstSmtParser::readTerm(): Invalid index " + head.value + "."));
+              frame.indices.push_back(static_cast<triton::uint32>(std::stoull(head.value)));
+            }
+            if (head.kind != TOKEN_CLOSE)
+              throw triton::exceptions::AstParser(this->located("AstSmtParser::readTerm(): Invalid indexed operator."));
+            frames.push_back(frame);
+            continue;
+          }
+
+          if (head.kind != TOKEN_SYMBOL)
+            throw triton::exceptions::AstParser(this->located("AstSmtParser::readTerm(): Expects an operator."));
+
+          /* (_ bvvalue size) */
+          if (head.value == "_") {
+            std::string value   = this->readSymbol();
+            triton::uint32 size = this->readIndex();
+            this->readClose();
+            if (value.compare(0, 2, "bv") != 0 || !isNumeral(value, 2, 10) || size == 0)
+              throw triton::exceptions::AstParser(this->located("AstSmtParser::readTerm(): Invalid bitvector constant " + value + "."));
+            node = triton::ast::bv(triton::uint512(value.substr(2)), size);
+          }
+
+          else {
+            frame.op = head.value;
+            if (frame.op == "let") {
+              if (this->readToken().kind != TOKEN_OPEN)
+                throw triton::exceptions::AstParser(this->located("AstSmtParser::readTerm(): Expects the bindings of a let."));
+              frame.binding = true;
+            }
+            frames.push_back(frame);
+            continue;
+          }
+        }
+
+        else if (token.kind == TOKEN_CLOSE && !frames.empty()) {
+          Frame& frame = frames.back();
+
+          if (frame.op == "let") {
+            if (frame.args.size() != 1)
+              throw triton::exceptions::AstParser(this->located("AstSmtParser::readTerm(): A let has a single term."));
+            node = frame.args[0];
+            for (auto it = frame.lets.begin(); it != frame.lets.end(); it++) {
+              auto binding = this->bindings.find(it->first);
+              binding->second.pop_back();
+              if (binding->second.empty())
+                this->bindings.erase(binding);
+            }
+          }
+          else
+            node = this->buildNode(frame.op, frame.indices, frame.args);
+
+          frames.pop_back();
+        }
+
+        else
+          throw triton::exceptions::AstParser(this->located("AstSmtParser::readTerm(): Expects a term."));
+
+        /* The term is an argument of the enclosing application or the value of a binding */
+        if (frames.empty())
+          return node;
+
+        Frame& parent = frames.back();
+        if (parent.binding) {
+          parent.lets.back().second = node;
+          this->readClose();
+        }
+        else
+          parent.args.push_back(node);
+      }
+    }
+
+
+    void AstSmtParser::skip(void) {
+      triton::usize depth = 1;
+
+      while (depth) {
+        switch (this->readToken().kind) {
+          case TOKEN_END:
+            throw triton::exceptions::AstParser(this->located("AstSmtParser::skip(): Unexpected end of stream."));
+          case TOKEN_OPEN:
+            depth++;
+            break;
+          case TOKEN_CLOSE:
+            depth--;
+            break;
+          default:
+            break;
+        }
+      }
+    }
+
+
+    void AstSmtParser::declare(const std::string& name, const Sort& sort) {
+      if (sort.indexSize) {
+        this->symbols[name] = triton::ast::array(sort.indexSize, name);
+        return;
+      }
+
+      if (sort.size == 0)
+        throw triton::exceptions::AstParser(this->located("AstSmtParser::declare(): Boolean constants are not supported."));
+
+      triton::engines::symbolic::SymbolicVariable* symVar = nullptr;
+      auto it = this->variables.find(name);
+
+      if (it != this->variables.end())
+        symVar = it->second;
+      else
+        symVar = triton::getCurrentApi().getSymbolicVariableFromName(name);
+
+      if (symVar == nullptr)
+        symVar = triton::getCurrentApi().newSymbolicVariable(sort.size, name);
+
+      else if (symVar->getSize() != sort.size)
+        throw triton::exceptions::AstParser(this->located("AstSmtParser::declare(): The size of " + name + " differs from the one of its symbolic variable."));
+
+      this->symbols[name] = triton::ast::variable(*symVar);
+    }
+
+
+    AbstractNode* AstSmtParser::getSymbol(const std::string& name) {
+      auto binding = this->bindings.find(name);
+      if (binding != this->bindings.end())
+        return binding->second.back();
+
+      auto symbol = this->symbols.find(name);
+      if (symbol != this->symbols.end())
+        return symbol->second;
+
+      if (name == "true")
+        return triton::ast::equal(triton::ast::bvtrue(), triton::ast::bvtrue());
+
+      if (name == "false")
+        return triton::ast::equal(triton::ast::bvtrue(), triton::ast::bvfalse());
+
+      /* #xhex */
+      if (name.compare(0, 2, "#x") == 0 && isNumeral(name, 2, 16))
+        return triton::ast::bv(triton::uint512("0x" + name.substr(2)), static_cast<triton::uint32>((name.size() - 2) * 4));
+
+      /* #bbinary */
+      if (name.compare(0, 2, "#b") == 0 && isNumeral(name, 2, 2)) {
+        triton::uint512 value = 0;
+        for (triton::usize index = 2; index < name.size(); index++)
+          value = (value << 1) | (name[index] - '0');
+        return triton::ast::bv(value, static_cast<triton::uint32>(name.size() - 2));
+      }
+
+      /* ref!id */
+      if (name.compare(0, 4, "ref!") == 0 && isNumeral(name, 4, 10))
+        return triton::ast::reference(std::stoull(name.substr(4)));
+
+      throw triton::exceptions::AstParser(this->located("AstSmtParser::getSymbol(): Unknown symbol " + name + "."));
+    }
+
+
+    AbstractNode* AstSmtParser::buildNode(const std::string& op, const std::vector<triton::uint32>& indices, const std::vector<AbstractNode*>& args) {
+      triton::usize arity = 2;
+      triton::usize count = 0;
+
+      /* (=> x y) */
+      if (op == "=>" && indices.empty() && args.size() == 2)
+        return triton::ast::lor(triton::ast::lnot(args[0]), args[1]);
+
+      /* ((_ repeat n) x) */
+      if (op == "repeat" && indices.size() == 1 && indices[0] != 0 && args.size() == 1)
+        return triton::ast::concat(std::vector<AbstractNode*>(indices[0], args[0]));
+
+      auto it = smtOperators.find(op);
+      if (it == smtOperators.end())
+        throw triton::exceptions::AstParser(this->located("AstSmtParser::buildNode(): Unsupported operator " + op + "."));
+
+      switch (it->second) {
+        case BVNEG_NODE:
+        case BVNOT_NODE:
+        case LNOT_NODE:
+          arity = 1;
+          break;
+
+        case BVROL_NODE:
+        case BVROR_NODE:
+        case SX_NODE:
+        case ZX_NODE:
+          arity = 1;
+          count = 1;
+          break;
+
+        case EXTRACT_NODE:
+          arity = 1;
+          count = 2;
+          break;
+
+        case ITE_NODE:
+        case STORE_NODE:
+          arity = 3;
+          break;
+
+        case BVADD_NODE:
+        case BVAND_NODE:
+        case BVMUL_NODE:
+        case BVOR_NODE:
+        case BVXOR_NODE:
+        case CONCAT_NODE:
+        case LAND_NODE:
+        case LOR_NODE:
+          arity = std::max<triton::usize>(args.size(), 2);
+          break;
+
+        default:
+          break;
+      }
+
+      if (args.size() != arity || indices.size() != count)
+        throw triton::exceptions::AstParser(this->located("AstSmtParser::buildNode(): Invalid number of arguments of " + op + "."));
+
+      switch (it->second) {
+        case BVADD_NODE:
+        case BVAND_NODE:
+        case BVMUL_NODE:
+        case BVOR_NODE:
+        case BVXOR_NODE:
+        case LAND_NODE:
+        case LOR_NODE: {
+          AbstractNode* node = args[0];
+          for (auto arg = args.begin() + 1; arg != args.end(); arg++) {
+            switch (it->second) {
+              case BVADD_NODE:  node = triton::ast::bvadd(node, *arg); break;
+              case BVAND_NODE:  node = triton::ast::bvand(node, *arg); break;
+              case BVMUL_NODE:  node = triton::ast::bvmul(node, *arg); break;
+              case BVOR_NODE:   node = triton::ast::bvor(node, *arg); break;
+              case BVXOR_NODE:  node = triton::ast::bvxor(node, *arg); break;
+              case LAND_NODE:   node = triton::ast::land(node, *arg); break;
+              default:          node = triton::ast::lor(node, *arg); break;
+            }
+          }
+          return node;
+        }
+
+        case BVASHR_NODE:             return triton::ast::bvashr(args[0], args[1]);
+        case BVLSHR_NODE:             return triton::ast::bvlshr(args[0], args[1]);
+        case BVNAND_NODE:             return triton::ast::bvnand(args[0], args[1]);
+        case BVNEG_NODE:              return triton::ast::bvneg(args[0]);
+        case BVNOR_NODE:              return triton::ast::bvnor(args[0], args[1]);
+        case BVNOT_NODE:              return triton::ast::bvnot(args[0]);
+        case BVROL_NODE:              return triton::ast::bvrol(indices[0], args[0]);
+        case BVROR_NODE:              return triton::ast::bvror(indices[0], args[0]);
+        case BVSDIV_NODE:             return triton::ast::bvsdiv(args[0], args[1]);
+        case BVSGE_NODE:              return triton::ast::bvsge(args[0], args[1]);
+        case BVSGT_NODE:              return triton::ast::bvsgt(args[0], args[1]);
+        case BVSHL_NODE:              return triton::ast::bvshl(args[0], args[1]);
+        case BVSLE_NODE:              return triton::ast::bvsle(args[0], args[1]);
+        case BVSLT_NODE:              return triton::ast::bvslt(args[0], args[1]);
+        case BVSMOD_NODE:             return triton::ast::bvsmod(args[0], args[1]);
+        case BVSREM_NODE:             return triton::ast::bvsrem(args[0], args[1]);
+        case BVSUB_NODE:              return triton::ast::bvsub(args[0], args[1]);
+        case BVUDIV_NODE:             return triton::ast::bvudiv(args[0], args[1]);
+        case BVUGE_NODE:              return triton::ast::bvuge(args[0], args[1]);
+        case BVUGT_NODE:              return triton::ast::bvugt(args[0], args[1]);
+        case BVULE_NODE:              return triton::ast::bvule(args[0], args[1]);
+        case BVULT_NODE:              return triton::ast::bvult(args[0], args[1]);
+        case BVUREM_NODE:             return triton::ast::bvurem(args[0], args[1]);
+        case BVXNOR_NODE:             return triton::ast::bvxnor(args[0], args[1]);
+        case CONCAT_NODE:             return triton::ast::concat(args);
+        case DISTINCT_NODE:           return triton::ast::distinct(args[0], args[1]);
+        case EQUAL_NODE:              return triton::ast::equal(args[0], args[1]);
+        case EXTRACT_NODE:            return triton::ast::extract(indices[0], indices[1], args[0]);
+        case ITE_NODE:                return triton::ast::ite(args[0], args[1], args[2]);
+        case LNOT_NODE:               return triton::ast::lnot(args[0]);
+        case SELECT_NODE:             return triton::ast::select(args[0], args[1]);
+        case STORE_NODE:              return triton::ast::store(args[0], args[1], args[2]);
+        case SX_NODE:                 return triton::ast::sx(indices[0], args[0]);
+        case ZX_NODE:                 return triton::ast::zx(indices[0], args[0]);
+        default:
+          throw triton::exceptions::AstParser(this->located("AstSmtParser::buildNode(): Unsupported operator " + op + "."));
+      }
+    }
+
+
+    bool AstSmtParser::readCommand(void) {
+      Token token = this->readToken();
+
+      if (token.kind == TOKEN_END)
+        return false;
+
+      if (token.kind != TOKEN_OPEN)
+        throw triton::exceptions::AstParser(this->located("AstSmtParser::readCommand(): Expects a command."));
+
+      std::string command = this->readSymbol();
+
+      /* (assert term) */
+      if (command == "assert") {
+        this->asserts.push_back(this->readTerm());
+        this->readClose();
+      }
+
+      /* (declare-fun name () sort) and (declare-const name sort) */
+      else if (command == "declare-fun" || command == "declare-const") {
+        std::string name = this->readSymbol();
+        if (command == "declare-fun" && (this->readToken().kind != TOKEN_OPEN || this->readToken().kind != TOKEN_CLOSE))
+          throw triton::exceptions::AstParser(this->located("AstSmtParser::readCommand(): Only constants can be declared."));
+        this->declare(name, this->readSort());
+        this->readClose();
+      }
+
+      /* (define-fun name () sort term) */
+      else if (command == "define-fun") {
+        std::string name = this->readSymbol();
+        if (this->readToken().kind != TOKEN_OPEN || this->readToken().kind != TOKEN_CLOSE)
+          throw triton::exceptions::AstParser(this->located("AstSmtParser::readCommand(): Only constants can be defined."));
+        Sort sort = this->readSort();
+        AbstractNode* node = this->readTerm();
+        if (sort.size && sort.indexSize == 0 && node->getBitvectorSize() != sort.size)
+          throw triton::exceptions::AstParser(this->located("AstSmtParser::readCommand(): The size of " + name + " differs from the one of its term."));
+        this->symbols[name] = node;
+        this->readClose();
+      }
+
+      else
+        this->skip();
+
+      return true;
+    }
+
+
+    const std::vector<AbstractNode*>& AstSmtParser::getAsserts(void) const {
+      return this->asserts;
+    }
+
+
+    void AstSmtParser::setVariable(const std::string& name, triton::engines::symbolic::SymbolicVariable* symVar) {
+      this->variables[name] = symVar;
+    }
+
+
+    std::vector<AbstractNode*> parseSmt(std::istream& stream) {
+      AstSmtParser parser(stream);
+
+      while (parser.readCommand());
+
+      return parser.getAsserts();
+    }
+
+  }; /* ast namespace */
+}; /* triton namespace */
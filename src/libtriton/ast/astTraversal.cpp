@@ -0,0 +1,66 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#include <algorithm>
+
+#include <api.hpp>
+#include <astTraversal.hpp>
+
+
+
+namespace triton {
+  namespace ast {
+
+    void nodesExtraction(std::vector<AbstractNode*>& output, AbstractNode* root, std::unordered_set<AbstractNode*>& visited, bool unroll, bool postOrder) {
+      std::vector<std::pair<AbstractNode*, bool>> worklist;
+      triton::usize start = output.size();
+
+      if (root == nullptr)
+        return;
+
+      /* A node is pushed unexpanded, then expanded once its children have been pushed */
+      worklist.push_back(std::make_pair(root, false));
+      while (!worklist.empty()) {
+        AbstractNode* node = worklist.back().first;
+
+        if (worklist.back().second) {
+          worklist.pop_back();
+          output.push_back(node);
+          continue;
+        }
+
+        if (!visited.insert(node).second) {
+          worklist.pop_back();
+          continue;
+        }
+
+        worklist.back().second = true;
+
+        if (unroll && node->getKind() == REFERENCE_NODE)
+          worklist.push_back(std::make_pair(reinterpret_cast<ReferenceNode*>(node)->getAst(), false));
+
+        /* Pushed backward, so that the first child is walked first */
+        const std::vector<AbstractNode*>& childs = node->getChilds();
+        for (auto it = childs.rbegin(); it != childs.rend(); it++) {
+          if (visited.find(*it) == visited.end())
+            worklist.push_back(std::make_pair(*it, false));
+        }
+      }
+
+      /* The reverse of a post-order puts every parent before its children */
+      if (!postOrder)
+        std::reverse(output.begin() + start, output.end());
+    }
+
+
+    void nodesExtraction(std::vector<AbstractNode*>& output, AbstractNode* root, bool unroll, bool postOrder) {
+      std::unordered_set<AbstractNode*> visited;
+      triton::ast::nodesExtraction(output, root, visited, unroll, postOrder);
+    }
+
+  }; /* ast namespace */
+}; /* triton namespace */
@@ -0,0 +1,233 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#include <algorithm>
+#include <bitset>
+#include <mutex>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+
+#include <astVariableSet.hpp>
+
+
+
+namespace triton {
+  namespace ast {
+
+    /* FNV-1a on the base and the words of the bitmap */
+    struct VariableSetHash {
+      std::size_t operator()(const VariableSet* set) const {
+        triton::uint64 h = 0xcbf29ce484222325ULL;
+
+        h = (h ^ set->base) * 0x100000001b3ULL;
+        for (auto it = set->words.begin(); it != set->words.end(); it++)
+          h = (h ^ *it) * 0x100000001b3ULL;
+
+        return static_cast<std::size_t>(h);
+      }
+    };
+
+
+    struct VariableSetEqual {
+      bool operator()(const VariableSet* a, const VariableSet* b) const {
+        return a->base == b->base && a->words == b->words;
+      }
+    };
+
+
+    struct VariableSetPairHash {
+      std::size_t operator()(const std::pair<const VariableSet*, const VariableSet*>& key) const {
+        return std::hash<const VariableSet*>()(key.first) * 31 + std::hash<const VariableSet*>()(key.second);
+      }
+    };
+
+
+    /* The sets and the unions already computed. Unions are forgotten once there are too many of them, sets are kept */
+    static std::mutex variableSetsLock;
+    static std::unordered_set<const VariableSet*, VariableSetHash, VariableSetEqual> variableSets;
+    static std::unordered_map<std::pair<const VariableSet*, const VariableSet*>, const VariableSet*, VariableSetPairHash> variableSetUnions;
+    static const triton::usize maxVariableSetUnions = (1 << 20);
+
+
+    VariableSet::VariableSet(triton::usize base, const std::vector<triton::uint64>& words) {
+      this->base  = base;
+      this->words = words;
+    }
+
+
+    /* [private method] */
+    const VariableSet* VariableSet::intern(triton::usize base, const std::vector<triton::uint64>& words) {
+      triton::usize first = 0;
+      triton::usize last  = words.size();
+
+      while (first < last && words[first] == 0)
+        first++;
+
+      while (last > first && words[last - 1] == 0)
+        last--;
+
+      if (first == last)
+        return nullptr;
+
+      VariableSet key(base + first, std::vector<triton::uint64>(words.begin() + first, words.begin() + last));
+      auto it = variableSets.find(&key);
+      if (it != variableSets.end())
+        return *it;
+
+      const VariableSet* set = new VariableSet(key.base, key.words);
+      variableSets.insert(set);
+      return set;
+    }
+
+
+    bool VariableSet::contains(const VariableSet* set, triton::usize id) {
+      triton::usize word = id / 64;
+
+      if (set == nullptr || word < set->base || word - set->base >= set->words.size())
+        return false;
+
+      return ((set->words[word - set->base] >> (id % 64)) & 1) != 0;
+    }
+
+
+    triton::usize VariableSet::count(const VariableSet* set) {
+      triton::usize ret = 0;
+
+      if (set == nullptr)
+        return 0;
+
+      for (auto it = set->words.begin(); it != set->words.end(); it++)
+        ret += std::bitset<64>(*it).count();
+
+      return ret;
+    }
+
+
+    std::vector<triton::usize> VariableSet::getIds(const VariableSet* set) {
+      std::vector<triton::usize> ret;
+
+      if (set == nullptr)
+        return ret;
+
+      for (triton::usize index = 0; index < set->words.size(); index++) {
+        for (triton::uint32 bit = 0; bit < 64; bit++) {
+          if ((set->words[index] >> bit) & 1)
+            ret.push_back((set->base + index) * 64 + bit);
+        }
+      }
+
+      return ret;
+    }
+
+
+    const VariableSet* VariableSet::singleton(triton::usize id) {
+      std::lock_guard<std::mutex> guard(variableSetsLock);
+      return VariableSet::intern(id / 64, std::vector<triton::uint64>(1, triton::uint64(1) << (id % 64)));
+    }
+
+
+    const VariableSet* VariableSet::fromIds(const std::vector<triton::usize>& ids) {
+      if (ids.empty())
+        return nullptr;
+
+      triton::usize base = *std::min_element(ids.begin(), ids.end()) / 64;
+      triton::usize end  = *std::max_element(ids.begin(), ids.end()) / 64 + 1;
+      std::vector<triton::uint64> words(end - base, 0);
+
+      for (auto it = ids.begin(); it != ids.end(); it++)
+        words[*it / 64 - base] |= (triton::uint64(1) << (*it % 64));
+
+      std::lock_guard<std::mutex> guard(variableSetsLock);
+      return VariableSet::intern(base, words);
+    }
+
+
+    const VariableSet* VariableSet::merge(const VariableSet* a, const VariableSet* b) {
+      /* Most nodes have the variables of one child */
+      if (a == b || b == nullptr)
+        return a;
+
+      if (a == nullptr)
+        return b;
+
+      if (b < a)
+        std::swap(a, b);
+
+      std::lock_guard<std::mutex> guard(variableSetsLock);
+      auto it = variableSetUnions.find(std::make_pair(a, b));
+      if (it != variableSetUnions.end())
+        return it->second;
+
+      triton::usize base = std::min(a->base, b->base);
+      triton::usize end  = std::max(a->base + a->words.size(), b->base + b->words.size());
+      std::vector<triton::uint64> words(end - base, 0);
+
+      for (triton::usize index = 0; index < a->words.size(); index++)
+        words[a->base - base + index] |= a->words[index];
+
+      for (triton::usize index = 0; index < b->words.size(); index++)
+        words[b->base - base + index] |= b->words[index];
+
+      const VariableSet* ret = VariableSet::intern(base, words);
+
+      if (variableSetUnions.size() >= maxVariableSetUnions)
+        variableSetUnions.clear();
+      variableSetUnions[std::make_pair(a, b)] = ret;
+
+      return ret;
+    }
+
+
+    bool VariableSet::isSubset(const VariableSet* a, const VariableSet* b) {
+      if (a == nullptr || a == b)
+        return true;
+
+      if (b == nullptr)
+        return false;
+
+      for (triton::usize index = 0; index < a->words.size(); index++) {
+        triton::usize word  = a->base + index;
+        triton::uint64 bits = 0;
+
+        if (word >= b->base && word - b->base < b->words.size())
+          bits = b->words[word - b->base];
+
+        if ((a->words[index] & ~bits) != 0)
+          return false;
+      }
+
+      return true;
+    }
+
+
+    bool VariableSet::intersects(const VariableSet* a, const VariableSet* b) {
+      if (a == nullptr || b == nullptr)
+        return false;
+
+      if (a == b)
+        return true;
+
+      triton::usize first = std::max(a->base, b->base);
+      triton::usize end   = std::min(a->base + a->words.size(), b->base + b->words.size());
+
+      for (triton::usize word = first; word < end; word++) {
+        if ((a->words[word - a->base] & b->words[word - b->base]) != 0)
+          return true;
+      }
+
+      return false;
+    }
+
+
+    triton::usize VariableSet::getNumberOfSets(void) {
+      std::lock_guard<std::mutex> guard(variableSetsLock);
+      return variableSets.size();
+    }
+
+  }; /* ast namespace */
+}; /* triton namespace */
@@ -25,6 +25,7 @@ namespace triton {
       /* Representation dispatcher from an abstract node */
       std::ostream& AstPythonRepresentation::print(std::ostream& stream, triton::ast::AbstractNode* node) {
         switch (node->getKind()) {
+          case ARRAY_NODE:                return this->print(stream, reinterpret_cast<triton::ast::ArrayNode*>(node)); break;
           case ASSERT_NODE:               return this->print(stream, reinterpret_cast<triton::ast::AssertNode*>(node)); break;
           case BVADD_NODE:                return this->print(stream, reinterpret_cast<triton::ast::BvaddNode*>(node)); break;
           case BVAND_NODE:                return this->print(stream, reinterpret_cast<triton::ast::BvandNode*>(node)); break;
@@ -70,9 +71,13 @@ namespace triton {
           case LNOT_NODE:                 return this->print(stream, reinterpret_cast<triton::ast::LnotNode*>(node)); break;
           case LOR_NODE:                  return this->print(stream, reinterpret_cast<triton::ast::LorNode*>(node)); break;
           case REFERENCE_NODE:            return this->print(stream, reinterpret_cast<triton::ast::ReferenceNode*>(node)); break;
+          case SELECT_NODE:               return this->print(stream, reinterpret_cast<triton::ast::SelectNode*>(node)); break;
+          case STORE_NODE:                return this->print(stream, reinterpret_cast<triton::ast::StoreNode*>(node)); break;
           case STRING_NODE:               return this->print(stream, reinterpret_cast<triton::ast::StringNode*>(node)); break;
           case SX_NODE:                   return this->print(stream, reinterpret_cast<triton::ast::SxNode*>(node)); break;
+          case VADD_NODE:                 return this->print(stream, reinterpret_cast<triton::ast::VaddNode*>(node)); break;
           case VARIABLE_NODE:             return this->print(stream, reinterpret_cast<triton::ast::VariableNode*>(node)); break;
+          case VEQ_NODE:                  return this->print(stream, reinterpret_cast<triton::ast::VeqNode*>(node)); break;
           case ZX_NODE:                   return this->print(stream, reinterpret_cast<triton::ast::ZxNode*>(node)); break;
           default:
             throw triton::exceptions::AstRepresentation("AstPythonRepresentation::print(AbstractNode): Invalid kind node.");
@@ -81,6 +86,13 @@ namespace triton {
       }
 
 
+      /* array representation */
+      std::ostream& AstPythonRepresentation::print(std::ostream& stream, triton::ast::ArrayNode* node) {
+        stream << node->getName();
+        return stream;
+      }
+
+
       /* assert representation */
       std::ostream& AstPythonRepresentation::print(std::ostream& stream, triton::ast::AssertNode* node) {
         stream << "assert(" << node->getChilds()[0] << ")";
@@ -411,6 +423,20 @@ namespace triton {
       }
 
 
+      /* select representation */
+      std::ostream& AstPythonRepresentation::print(std::ostream& stream, triton::ast::SelectNode* node) {
+        stream << node->getChilds()[0] << "[" << node->getChilds()[1] << "]";
+        return stream;
+      }
+
+
+      /* store representation */
+      std::ostream& AstPythonRepresentation::print(std::ostream& stream, triton::ast::StoreNode* node) {
+        stream << "store(" << node->getChilds()[0] << ", " << node->getChilds()[1] << ", " << node->getChilds()[2] << ")";
+        return stream;
+      }
+
+
       /* string representation */
       std::ostream& AstPythonRepresentation::print(std::ostream& stream, triton::ast::StringNode* node) {
         stream << node->getValue();
@@ -431,6 +457,13 @@ namespace triton {
       }
 
 
+      /* vadd representation */
+      std::ostream& AstPythonRepresentation::print(std::ostream& stream, triton::ast::VaddNode* node) {
+        stream << "vadd(" << node->getChilds()[0] << ", " << node->getChilds()[1] << ", " << node->getChilds()[2] << ")";
+        return stream;
+      }
+
+
       /* variable representation */
       std::ostream& AstPythonRepresentation::print(std::ostream& stream, triton::ast::VariableNode* node) {
         stream << node->getValue();
@@ -438,6 +471,13 @@ namespace triton {
       }
 
 
+      /* veq representation */
+      std::ostream& AstPythonRepresentation::print(std::ostream& stream, triton::ast::VeqNode* node) {
+        stream << "veq(" << node->getChilds()[0] << ", " << node->getChilds()[1] << ", " << node->getChilds()[2] << ")";
+        return stream;
+      }
+
+
       /* zx representation */
       std::ostream& AstPythonRepresentation::print(std::ostream& stream, triton::ast::ZxNode* node) {
         stream << node->getChilds()[1];
@@ -5,7 +5,11 @@
 **  This program is under the terms of the BSD License.
 */
 
+#include <string>
+#include <vector>
+
 #include <astSmtRepresentation.hpp>
+#include <astTraversal.hpp>
 #include <exceptions.hpp>
 
 
@@ -14,427 +18,290 @@ namespace triton {
   namespace ast {
     namespace representations {
 
-      AstSmtRepresentation::AstSmtRepresentation() {
-      }
-
-
-      AstSmtRepresentation::~AstSmtRepresentation() {
-      }
-
-
-      /* Representation dispatcher from an abstract node */
-      std::ostream& AstSmtRepresentation::print(std::ostream& stream, triton::ast::AbstractNode* node) {
-        switch (node->getKind()) {
-          case ASSERT_NODE:               return this->print(stream, reinterpret_cast<triton::ast::AssertNode*>(node)); break;
-          case BVADD_NODE:                return this->print(stream, reinterpret_cast<triton::ast::BvaddNode*>(node)); break;
-          case BVAND_NODE:                return this->print(stream, reinterpret_cast<triton::ast::BvandNode*>(node)); break;
-          case BVASHR_NODE:               return this->print(stream, reinterpret_cast<triton::ast::BvashrNode*>(node)); break;
-          case BVDECL_NODE:               return this->print(stream, reinterpret_cast<triton::ast::BvdeclNode*>(node)); break;
-          case BVLSHR_NODE:               return this->print(stream, reinterpret_cast<triton::ast::BvlshrNode*>(node)); break;
-          case BVMUL_NODE:                return this->print(stream, reinterpret_cast<triton::ast::BvmulNode*>(node)); break;
-          case BVNAND_NODE:               return this->print(stream, reinterpret_cast<triton::ast::BvnandNode*>(node)); break;
-          case BVNEG_NODE:                return this->print(stream, reinterpret_cast<triton::ast::BvnegNode*>(node)); break;
-          case BVNOR_NODE:                return this->print(stream, reinterpret_cast<triton::ast::BvnorNode*>(node)); break;
-          case BVNOT_NODE:                return this->print(stream, reinterpret_cast<triton::ast::BvnotNode*>(node)); break;
-          case BVOR_NODE:                 return this->print(stream, reinterpret_cast<triton::ast::BvorNode*>(node)); break;
-          case BVROL_NODE:                return this->print(stream, reinterpret_cast<triton::ast::BvrolNode*>(node)); break;
-          case BVROR_NODE:                return this->print(stream, reinterpret_cast<triton::ast::BvrorNode*>(node)); break;
-          case BVSDIV_NODE:               return this->print(stream, reinterpret_cast<triton::ast::BvsdivNode*>(node)); break;
-          case BVSGE_NODE:                return this->print(stream, reinterpret_cast<triton::ast::BvsgeNode*>(node)); break;
-          case BVSGT_NODE:                return this->print(stream, reinterpret_cast<triton::ast::BvsgtNode*>(node)); break;
-          case BVSHL_NODE:                return this->print(stream, reinterpret_cast<triton::ast::BvshlNode*>(node)); break;
-          case BVSLE_NODE:                return this->print(stream, reinterpret_cast<triton::ast::BvsleNode*>(node)); break;
-          case BVSLT_NODE:                return this->print(stream, reinterpret_cast<triton::ast::BvsltNode*>(node)); break;
-          case BVSMOD_NODE:               return this->print(stream, reinterpret_cast<triton::ast::BvsmodNode*>(node)); break;
-          case BVSREM_NODE:               return this->print(stream, reinterpret_cast<triton::ast::BvsremNode*>(node)); break;
-          case BVSUB_NODE:                return this->print(stream, reinterpret_cast<triton::ast::BvsubNode*>(node)); break;
-          case BVUDIV_NODE:               return this->print(stream, reinterpret_cast<triton::ast::BvudivNode*>(node)); break;
-          case BVUGE_NODE:                return this->print(stream, reinterpret_cast<triton::ast::BvugeNode*>(node)); break;
-          case BVUGT_NODE:                return this->print(stream, reinterpret_cast<triton::ast::BvugtNode*>(node)); break;
-          case BVULE_NODE:                return this->print(stream, reinterpret_cast<triton::ast::BvuleNode*>(node)); break;
-          case BVULT_NODE:                return this->print(stream, reinterpret_cast<triton::ast::BvultNode*>(node)); break;
-          case BVUREM_NODE:               return this->print(stream, reinterpret_cast<triton::ast::BvuremNode*>(node)); break;
-          case BVXNOR_NODE:               return this->print(stream, reinterpret_cast<triton::ast::BvxnorNode*>(node)); break;
-          case BVXOR_NODE:                return this->print(stream, reinterpret_cast<triton::ast::BvxorNode*>(node)); break;
-          case BV_NODE:                   return this->print(stream, reinterpret_cast<triton::ast::BvNode*>(node)); break;
-          case COMPOUND_NODE:             return this->print(stream, reinterpret_cast<triton::ast::CompoundNode*>(node)); break;
-          case CONCAT_NODE:               return this->print(stream, reinterpret_cast<triton::ast::ConcatNode*>(node)); break;
-          case DECIMAL_NODE:              return this->print(stream, reinterpret_cast<triton::ast::DecimalNode*>(node)); break;
-          case DECLARE_FUNCTION_NODE:     return this->print(stream, reinterpret_cast<triton::ast::DeclareFunctionNode*>(node)); break;
-          case DISTINCT_NODE:             return this->print(stream, reinterpret_cast<triton::ast::DistinctNode*>(node)); break;
-          case EQUAL_NODE:                return this->print(stream, reinterpret_cast<triton::ast::EqualNode*>(node)); break;
-          case EXTRACT_NODE:              return this->print(stream, reinterpret_cast<triton::ast::ExtractNode*>(node)); break;
-          case ITE_NODE:                  return this->print(stream, reinterpret_cast<triton::ast::IteNode*>(node)); break;
-          case LAND_NODE:                 return this->print(stream, reinterpret_cast<triton::ast::LandNode*>(node)); break;
-          case LET_NODE:                  return this->print(stream, reinterpret_cast<triton::ast::LetNode*>(node)); break;
-          case LNOT_NODE:                 return this->print(stream, reinterpret_cast<triton::ast::LnotNode*>(node)); break;
-          case LOR_NODE:                  return this->print(stream, reinterpret_cast<triton::ast::LorNode*>(node)); break;
-          case REFERENCE_NODE:            return this->print(stream, reinterpret_cast<triton::ast::ReferenceNode*>(node)); break;
-          case STRING_NODE:               return this->print(stream, reinterpret_cast<triton::ast::StringNode*>(node)); break;
-          case SX_NODE:                   return this->print(stream, reinterpret_cast<triton::ast::SxNode*>(node)); break;
-          case VARIABLE_NODE:             return this->print(stream, reinterpret_cast<triton::ast::VariableNode*>(node)); break;
-          case ZX_NODE:                   return this->print(stream, reinterpret_cast<triton::ast::ZxNode*>(node)); break;
-          default:
-            throw triton::exceptions::AstRepresentation("AstSmtRepresentation::print(AbstractNode): Invalid kind node.");
+      /* Displays the parts of an operator: "(op " before the first child, " " between children and ")" after the last one */
+      static void printOperator(std::ostream& stream, const char* op, triton::usize index, triton::usize size) {
+        if (index == 0)
+          stream << "(" << op << " ";
+        else if (index == size)
+          stream << ")";
+        else
+          stream << " ";
+      }
+
+
+      /*
+       * Displays the lanes of a vector node (vadd or veq), which is not a SMT-LIB operator. The vectors
+       * are bound to `vx!lane` and `vy!lane` by a let around them, so they are displayed once.
+       */
+      static void printLanes(std::ostream& stream, triton::ast::AbstractNode* node) {
+        triton::uint32 lane = reinterpret_cast<triton::ast::DecimalNode*>(node->getChilds()[0])->getValue().convert_to<triton::uint32>();
+        triton::uint32 size = node->getBitvectorSize();
+
+        if (size > lane)
+          stream << "(concat";
+
+        for (triton::uint32 high = size; high > 0; high -= lane) {
+          std::string extract = "((_ extract " + std::to_string(high - 1) + " " + std::to_string(high - lane) + ") ";
+          if (size > lane)
+            stream << " ";
+          if (node->getKind() == VADD_NODE)
+            stream << "(bvadd " << extract << "vx!" << lane << ") " << extract << "vy!" << lane << "))";
+          else
+            stream << "(ite (= " << extract << "vx!" << lane << ") " << extract << "vy!" << lane << ")) (bvnot (_ bv0 " << lane << ")) (_ bv0 " << lane << "))";
         }
-        return stream;
-      }
-
-
-      /* assert representation */
-      std::ostream& AstSmtRepresentation::print(std::ostream& stream, triton::ast::AssertNode* node) {
-        stream << "(assert " << node->getChilds()[0] << ")";
-        return stream;
-      }
-
-
-      /* bvadd representation */
-      std::ostream& AstSmtRepresentation::print(std::ostream& stream, triton::ast::BvaddNode* node) {
-        stream << "(bvadd " << node->getChilds()[0] << " " << node->getChilds()[1] << ")";
-        return stream;
-      }
-
-
-      /* bvand representation */
-      std::ostream& AstSmtRepresentation::print(std::ostream& stream, triton::ast::BvandNode* node) {
-        stream << "(bvand " << node->getChilds()[0] << " " << node->getChilds()[1] << ")";
-        return stream;
-      }
-
-
-      /* bvashr representation */
-      std::ostream& AstSmtRepresentation::print(std::ostream& stream, triton::ast::BvashrNode* node) {
-        stream << "(bvashr " << node->getChilds()[0] << " " << node->getChilds()[1] << ")";
-        return stream;
-      }
-
-
-      /* bvdecl representation */
-      std::ostream& AstSmtRepresentation::print(std::ostream& stream, triton::ast::BvdeclNode* node) {
-        stream << "(_ BitVec " << node->getChilds()[0] << ")";
-        return stream;
-      }
-
-
-      /* bvlshr representation */
-      std::ostream& AstSmtRepresentation::print(std::ostream& stream, triton::ast::BvlshrNode* node) {
-        stream << "(bvlshr " << node->getChilds()[0] << " " << node->getChilds()[1] << ")";
-        return stream;
-      }
-
-
-      /* bvmul representation */
-      std::ostream& AstSmtRepresentation::print(std::ostream& stream, triton::ast::BvmulNode* node) {
-        stream << "(bvmul " << node->getChilds()[0] << " " << node->getChilds()[1] << ")";
-        return stream;
-      }
-
-
-      /* bvnand representation */
-      std::ostream& AstSmtRepresentation::print(std::ostream& stream, triton::ast::BvnandNode* node) {
-        stream << "(bvnand " << node->getChilds()[0] << " " << node->getChilds()[1] << ")";
-        return stream;
-      }
-
-
-      /* bvneg representation */
-      std::ostream& AstSmtRepresentation::print(std::ostream& stream, triton::ast::BvnegNode* node) {
-        stream << "(bvneg " << node->getChilds()[0] << ")";
-        return stream;
-      }
 
-
-      /* bvnor representation */
-      std::ostream& AstSmtRepresentation::print(std::ostream& stream, triton::ast::BvnorNode* node) {
-        stream << "(bvnor " << node->getChilds()[0] << " " << node->getChilds()[1] << ")";
-        return stream;
+        if (size > lane)
+          stream << ")";
       }
 
 
-      /* bvnot representation */
-      std::ostream& AstSmtRepresentation::print(std::ostream& stream, triton::ast::BvnotNode* node) {
-        stream << "(bvnot " << node->getChilds()[0] << ")";
-        return stream;
-      }
-
-
-      /* bvor representation */
-      std::ostream& AstSmtRepresentation::print(std::ostream& stream, triton::ast::BvorNode* node) {
-        stream << "(bvor " << node->getChilds()[0] << " " << node->getChilds()[1] << ")";
-        return stream;
-      }
-
-
-      /* bvrol representation */
-      std::ostream& AstSmtRepresentation::print(std::ostream& stream, triton::ast::BvrolNode* node) {
-        stream << "((_ rotate_left " << node->getChilds()[0] << ") " << node->getChilds()[1] << ")";
-        return stream;
-      }
-
-
-      /* bvror representation */
-      std::ostream& AstSmtRepresentation::print(std::ostream& stream, triton::ast::BvrorNode* node) {
-        stream << "((_ rotate_right " << node->getChilds()[0] << ") " << node->getChilds()[1] << ")";
-        return stream;
-      }
-
-
-      /* bvsdiv representation */
-      std::ostream& AstSmtRepresentation::print(std::ostream& stream, triton::ast::BvsdivNode* node) {
-        stream << "(bvsdiv " << node->getChilds()[0] << " " << node->getChilds()[1] << ")";
-        return stream;
-      }
-
-
-      /* bvsge representation */
-      std::ostream& AstSmtRepresentation::print(std::ostream& stream, triton::ast::BvsgeNode* node) {
-        stream << "(bvsge " << node->getChilds()[0] << " " << node->getChilds()[1] << ")";
-        return stream;
-      }
-
-
-      /* bvsgt representation */
-      std::ostream& AstSmtRepresentation::print(std::ostream& stream, triton::ast::BvsgtNode* node) {
-        stream << "(bvsgt " << node->getChilds()[0] << " " << node->getChilds()[1] << ")";
-        return stream;
-      }
-
-
-      /* bvshl representation */
-      std::ostream& AstSmtRepresentation::print(std::ostream& stream, triton::ast::BvshlNode* node) {
-        stream << "(bvshl " << node->getChilds()[0] << " " << node->getChilds()[1] << ")";
-        return stream;
-      }
-
-
-      /* bvsle representation */
-      std::ostream& AstSmtRepresentation::print(std::ostream& stream, triton::ast::BvsleNode* node) {
-        stream << "(bvsle " << node->getChilds()[0] << " " << node->getChilds()[1] << ")";
-        return stream;
-      }
-
-
-      /* bvslt representation */
-      std::ostream& AstSmtRepresentation::print(std::ostream& stream, triton::ast::BvsltNode* node) {
-        stream << "(bvslt " << node->getChilds()[0] << " " << node->getChilds()[1] << ")";
-        return stream;
-      }
-
-
-      /* bvsmod representation */
-      std::ostream& AstSmtRepresentation::print(std::ostream& stream, triton::ast::BvsmodNode* node) {
-        stream << "(bvsmod " << node->getChilds()[0] << " " << node->getChilds()[1] << ")";
-        return stream;
-      }
-
-
-      /* bvsrem representation */
-      std::ostream& AstSmtRepresentation::print(std::ostream& stream, triton::ast::BvsremNode* node) {
-         stream << "(bvsrem " << node->getChilds()[0] << " " << node->getChilds()[1] << ")";
-        return stream;
-      }
-
-
-      /* bvsub representation */
-      std::ostream& AstSmtRepresentation::print(std::ostream& stream, triton::ast::BvsubNode* node) {
-        stream << "(bvsub " << node->getChilds()[0] << " " << node->getChilds()[1] << ")";
-        return stream;
-      }
-
-
-      /* bvudiv representation */
-      std::ostream& AstSmtRepresentation::print(std::ostream& stream, triton::ast::BvudivNode* node) {
-        stream << "(bvudiv " << node->getChilds()[0] << " " << node->getChilds()[1] << ")";
-        return stream;
-      }
-
-
-      /* bvuge representation */
-      std::ostream& AstSmtRepresentation::print(std::ostream& stream, triton::ast::BvugeNode* node) {
-        stream << "(bvuge " << node->getChilds()[0] << " " << node->getChilds()[1] << ")";
-        return stream;
-      }
-
-
-      /* bvugt representation */
-      std::ostream& AstSmtRepresentation::print(std::ostream& stream, triton::ast::BvugtNode* node) {
-        stream << "(bvugt " << node->getChilds()[0] << " " << node->getChilds()[1] << ")";
-        return stream;
-      }
-
-
-      /* bvule representation */
-      std::ostream& AstSmtRepresentation::print(std::ostream& stream, triton::ast::BvuleNode* node) {
-        stream << "(bvule " << node->getChilds()[0] << " " << node->getChilds()[1] << ")";
-        return stream;
-      }
-
-
-      /* bvult representation */
-      std::ostream& AstSmtRepresentation::print(std::ostream& stream, triton::ast::BvultNode* node) {
-        stream << "(bvult " << node->getChilds()[0] << " " << node->getChilds()[1] << ")";
-        return stream;
-      }
-
-
-      /* bvurem representation */
-      std::ostream& AstSmtRepresentation::print(std::ostream& stream, triton::ast::BvuremNode* node) {
-        stream << "(bvurem " << node->getChilds()[0] << " " << node->getChilds()[1] << ")";
-        return stream;
-      }
-
-
-      /* bvxnor representation */
-      std::ostream& AstSmtRepresentation::print(std::ostream& stream, triton::ast::BvxnorNode* node) {
-        stream << "(bvxnor " << node->getChilds()[0] << " " << node->getChilds()[1] << ")";
-        return stream;
-      }
-
-
-      /* bvxor representation */
-      std::ostream& AstSmtRepresentation::print(std::ostream& stream, triton::ast::BvxorNode* node) {
-        stream << "(bvxor " << node->getChilds()[0] << " " << node->getChilds()[1] << ")";
-        return stream;
-      }
-
-
-      /* bv representation */
-      std::ostream& AstSmtRepresentation::print(std::ostream& stream, triton::ast::BvNode* node) {
-        stream << "(_ bv" << node->getChilds()[0] << " " << node->getChilds()[1] << ")";
-        return stream;
-      }
-
-
-      /* compound representation */
-      std::ostream& AstSmtRepresentation::print(std::ostream& stream, triton::ast::CompoundNode* node) {
-        for (triton::usize index = 0; index < node->getChilds().size(); index++)
-          stream << node->getChilds()[index];
-        return stream;
-      }
-
-
-      /* concat representation */
-      std::ostream& AstSmtRepresentation::print(std::ostream& stream, triton::ast::ConcatNode* node) {
-        std::vector<triton::ast::AbstractNode*> childs = node->getChilds();
-        triton::usize size = childs.size();
-
-        if (size < 2)
-          throw triton::exceptions::AstRepresentation("AstSmtRepresentation::print(ConcatNode): Exprs must contain at least two expressions.");
-
-        stream << "(concat";
-        for (triton::usize index = 0; index < size; index++)
-          stream << " " << childs[index];
-        stream << ")";
-
-        return stream;
-      }
-
-
-      /* decimal representation */
-      std::ostream& AstSmtRepresentation::print(std::ostream& stream, triton::ast::DecimalNode* node) {
-        stream << node->getValue();
-        return stream;
-      }
-
-
-      /* declare representation */
-      std::ostream& AstSmtRepresentation::print(std::ostream& stream, triton::ast::DeclareFunctionNode* node) {
-        stream << "(declare-fun " << node->getChilds()[0] << " () " << node->getChilds()[1] << ")";
-        return stream;
-      }
-
-
-      /* distinct representation */
-      std::ostream& AstSmtRepresentation::print(std::ostream& stream, triton::ast::DistinctNode* node) {
-        stream << "(distinct " << node->getChilds()[0] << " " << node->getChilds()[1] << ")";
-        return stream;
-      }
-
-
-      /* equal representation */
-      std::ostream& AstSmtRepresentation::print(std::ostream& stream, triton::ast::EqualNode* node) {
-        stream << "(= " << node->getChilds()[0] << " " << node->getChilds()[1] << ")";
-        return stream;
-      }
-
-
-      /* extract representation */
-      std::ostream& AstSmtRepresentation::print(std::ostream& stream, triton::ast::ExtractNode* node) {
-        stream << "((_ extract " << node->getChilds()[0] << " " << node->getChilds()[1] << ") " << node->getChilds()[2] << ")";
-        return stream;
+      AstSmtRepresentation::AstSmtRepresentation() {
       }
 
 
-      /* ite representation */
-      std::ostream& AstSmtRepresentation::print(std::ostream& stream, triton::ast::IteNode* node) {
-        stream << "(ite " << node->getChilds()[0] << " " << node->getChilds()[1] << " " << node->getChilds()[2] << ")";
-        return stream;
+      AstSmtRepresentation::~AstSmtRepresentation() {
       }
 
 
-      /* land representation */
-      std::ostream& AstSmtRepresentation::print(std::ostream& stream, triton::ast::LandNode* node) {
-        stream << "(and " << node->getChilds()[0] << " " << node->getChilds()[1] << ")";
+      /* Representation of an abstract node. Nodes are displayed with an explicit stack. */
+      std::ostream& AstSmtRepresentation::print(std::ostream& stream, triton::ast::AbstractNode* node) {
+        this->printTerm(stream, node, std::unordered_map<triton::ast::AbstractNode*, triton::usize>());
         return stream;
       }
 
 
-      /* let representation */
-      std::ostream& AstSmtRepresentation::print(std::ostream& stream, triton::ast::LetNode* node) {
-        stream << "(let ((" << node->getChilds()[0] << " " << node->getChilds()[1] << ")) " << node->getChilds()[2] << ")";
-        return stream;
-      }
+      /* Shared nodes are bound in post-order, so a binding only uses the bindings displayed before it */
+      std::ostream& AstSmtRepresentation::printShared(std::ostream& stream, triton::ast::AbstractNode* node) {
+        std::unordered_map<triton::ast::AbstractNode*, triton::usize> parents;
+        std::unordered_map<triton::ast::AbstractNode*, triton::usize> bindings;
+        std::vector<triton::ast::AbstractNode*> nodes;
 
+        /* Commands are displayed around the bindings of their terms */
+        if (node->getKind() == ASSERT_NODE) {
+          stream << "(assert ";
+          this->printShared(stream, node->getChilds()[0]);
+          return stream << ")";
+        }
 
-      /* lnot representation */
-      std::ostream& AstSmtRepresentation::print(std::ostream& stream, triton::ast::LnotNode* node) {
-        stream << "(not " << node->getChilds()[0] << ")";
-        return stream;
-      }
+        if (node->getKind() == COMPOUND_NODE) {
+          for (auto it = node->getChilds().begin(); it != node->getChilds().end(); it++)
+            this->printShared(stream, *it);
+          return stream;
+        }
 
+        triton::ast::nodesExtraction(nodes, node, false, true);
+        for (auto it = nodes.begin(); it != nodes.end(); it++) {
+          switch ((*it)->getKind()) {
+            case ASSERT_NODE:
+            case BVDECL_NODE:
+            case COMPOUND_NODE:
+            case DECLARE_FUNCTION_NODE:
+            case LET_NODE:
+            case STRING_NODE:
+              return this->print(stream, node);
+            default:
+              break;
+          }
+          for (auto child = (*it)->getChilds().begin(); child != (*it)->getChilds().end(); child++)
+            parents[*child]++;
+        }
 
-      /* lor representation */
-      std::ostream& AstSmtRepresentation::print(std::ostream& stream, triton::ast::LorNode* node) {
-        stream << "(or " << node->getChilds()[0] << " " << node->getChilds()[1] << ")";
-        return stream;
-      }
+        /* Leaves and constants are not worth a binding */
+        for (auto it = nodes.begin(); it != nodes.end(); it++) {
+          switch ((*it)->getKind()) {
+            case ARRAY_NODE:
+            case BV_NODE:
+            case DECIMAL_NODE:
+            case REFERENCE_NODE:
+            case VARIABLE_NODE:
+              continue;
+            default:
+              break;
+          }
+          if (parents[*it] < 2)
+            continue;
+
+          triton::usize id = bindings.size();
+          stream << "(let ((let!" << id << " ";
+          this->printTerm(stream, *it, bindings);
+          stream << ")) ";
+          bindings[*it] = id;
+        }
 
+        this->printTerm(stream, node, bindings);
+        for (triton::usize index = 0; index < bindings.size(); index++)
+          stream << ")";
 
-      /* reference representation */
-      std::ostream& AstSmtRepresentation::print(std::ostream& stream, triton::ast::ReferenceNode* node) {
-        stream << "ref!" << node->getValue();
         return stream;
       }
 
 
-      /* string representation */
-      std::ostream& AstSmtRepresentation::print(std::ostream& stream, triton::ast::StringNode* node) {
-        stream << node->getValue();
-        return stream;
-      }
+      /*
+       * [private method] Nodes are displayed as parts interleaved with their
+       * children: the part `i` is displayed before the child `i` and the last
+       * part after the last child.
+       */
+      void AstSmtRepresentation::printTerm(std::ostream& stream, triton::ast::AbstractNode* node, const std::unordered_map<triton::ast::AbstractNode*, triton::usize>& bindings) {
+        std::vector<std::pair<triton::ast::AbstractNode*, triton::usize>> worklist;
 
+        worklist.push_back(std::make_pair(node, 0));
+        while (!worklist.empty()) {
+          triton::ast::AbstractNode* current = worklist.back().first;
+          triton::usize index = worklist.back().second++;
 
-      /* sx representation */
-      std::ostream& AstSmtRepresentation::print(std::ostream& stream, triton::ast::SxNode* node) {
-        stream << "((_ sign_extend " << node->getChilds()[0] << ") " << node->getChilds()[1] << ")";
-        return stream;
+          this->printPart(stream, current, index);
+          if (index < current->getChilds().size()) {
+            triton::ast::AbstractNode* child = current->getChilds()[index];
+            auto binding = bindings.find(child);
+            if (binding != bindings.end())
+              stream << "let!" << binding->second;
+            else
+              worklist.push_back(std::make_pair(child, 0));
+          }
+          else
+            worklist.pop_back();
+        }
       }
 
 
-      /* variable representation */
-      std::ostream& AstSmtRepresentation::print(std::ostream& stream, triton::ast::VariableNode* node) {
-        stream << node->getValue();
-        return stream;
-      }
+      /* [private method] Representation of the part `index` of a node */
+      void AstSmtRepresentation::printPart(std::ostream& stream, triton::ast::AbstractNode* node, triton::usize index) {
+        triton::usize size = node->getChilds().size();
 
+        switch (node->getKind()) {
+          case ASSERT_NODE:               printOperator(stream, "assert", index, size); break;
+          case BVADD_NODE:                printOperator(stream, "bvadd", index, size); break;
+          case BVAND_NODE:                printOperator(stream, "bvand", index, size); break;
+          case BVASHR_NODE:               printOperator(stream, "bvashr", index, size); break;
+          case BVDECL_NODE:               printOperator(stream, "_ BitVec", index, size); break;
+          case BVLSHR_NODE:               printOperator(stream, "bvlshr", index, size); break;
+          case BVMUL_NODE:                printOperator(stream, "bvmul", index, size); break;
+          case BVNAND_NODE:               printOperator(stream, "bvnand", index, size); break;
+          case BVNEG_NODE:                printOperator(stream, "bvneg", index, size); break;
+          case BVNOR_NODE:                printOperator(stream, "bvnor", index, size); break;
+          case BVNOT_NODE:                printOperator(stream, "bvnot", index, size); break;
+          case BVOR_NODE:                 printOperator(stream, "bvor", index, size); break;
+          case BVSDIV_NODE:               printOperator(stream, "bvsdiv", index, size); break;
+          case BVSGE_NODE:                printOperator(stream, "bvsge", index, size); break;
+          case BVSGT_NODE:                printOperator(stream, "bvsgt", index, size); break;
+          case BVSHL_NODE:                printOperator(stream, "bvshl", index, size); break;
+          case BVSLE_NODE:                printOperator(stream, "bvsle", index, size); break;
+          case BVSLT_NODE:                printOperator(stream, "bvslt", index, size); break;
+          case BVSMOD_NODE:               printOperator(stream, "bvsmod", index, size); break;
+          case BVSREM_NODE:               printOperator(stream, "bvsrem", index, size); break;
+          case BVSUB_NODE:                printOperator(stream, "bvsub", index, size); break;
+          case BVUDIV_NODE:               printOperator(stream, "bvudiv", index, size); break;
+          case BVUGE_NODE:                printOperator(stream, "bvuge", index, size); break;
+          case BVUGT_NODE:                printOperator(stream, "bvugt", index, size); break;
+          case BVULE_NODE:                printOperator(stream, "bvule", index, size); break;
+          case BVULT_NODE:                printOperator(stream, "bvult", index, size); break;
+          case BVUREM_NODE:               printOperator(stream, "bvurem", index, size); break;
+          case BVXNOR_NODE:               printOperator(stream, "bvxnor", index, size); break;
+          case BVXOR_NODE:                printOperator(stream, "bvxor", index, size); break;
+          case DISTINCT_NODE:             printOperator(stream, "distinct", index, size); break;
+          case EQUAL_NODE:                printOperator(stream, "=", index, size); break;
+          case ITE_NODE:                  printOperator(stream, "ite", index, size); break;
+          case LAND_NODE:                 printOperator(stream, "and", index, size); break;
+          case LNOT_NODE:                 printOperator(stream, "not", index, size); break;
+          case LOR_NODE:                  printOperator(stream, "or", index, size); break;
+          case SELECT_NODE:               printOperator(stream, "select", index, size); break;
+          case STORE_NODE:                printOperator(stream, "store", index, size); break;
+
+          /* (_ bvvalue size) */
+          case BV_NODE: {
+            static const char* parts[] = {"(_ bv", " ", ")"};
+            stream << parts[index];
+            break;
+          }
+
+          /* ((_ rotate_left rot) expr) */
+          case BVROL_NODE: {
+            static const char* parts[] = {"((_ rotate_left ", ") ", ")"};
+            stream << parts[index];
+            break;
+          }
+
+          /* ((_ rotate_right rot) expr) */
+          case BVROR_NODE: {
+            static const char* parts[] = {"((_ rotate_right ", ") ", ")"};
+            stream << parts[index];
+            break;
+          }
+
+          /* Children displayed one after the other */
+          case COMPOUND_NODE:
+            break;
+
+          /* (concat expr1 expr2 ...) */
+          case CONCAT_NODE:
+            if (size < 2)
+              throw triton::exceptions::AstRepresentation("AstSmtRepresentation::print(ConcatNode): Exprs must contain at least two expressions.");
+            printOperator(stream, "concat", index, size);
+            break;
+
+          /* (declare-fun name () sort) */
+          case DECLARE_FUNCTION_NODE: {
+            static const char* parts[] = {"(declare-fun ", " () ", ")"};
+            stream << parts[index];
+            break;
+          }
+
+          /* ((_ extract high low) expr) */
+          case EXTRACT_NODE: {
+            static const char* parts[] = {"((_ extract ", " ", ") ", ")"};
+            stream << parts[index];
+            break;
+          }
+
+          /* (let ((symbol expr1)) expr2) */
+          case LET_NODE: {
+            static const char* parts[] = {"(let ((", " ", ")) ", ")"};
+            stream << parts[index];
+            break;
+          }
+
+          /* ((_ sign_extend ext) expr) */
+          case SX_NODE: {
+            static const char* parts[] = {"((_ sign_extend ", ") ", ")"};
+            stream << parts[index];
+            break;
+          }
+
+          /* (let ((vx!lane expr1) (vy!lane expr2)) lanes) */
+          case VADD_NODE:
+          case VEQ_NODE:
+            if (index == 0)
+              stream << "(let ((vx!";
+            else if (index == 1)
+              stream << " ";
+            else if (index == 2)
+              stream << ") (vy!" << reinterpret_cast<triton::ast::DecimalNode*>(node->getChilds()[0])->getValue() << " ";
+            else {
+              stream << ")) ";
+              printLanes(stream, node);
+              stream << ")";
+            }
+            break;
+
+          /* ((_ zero_extend ext) expr) */
+          case ZX_NODE: {
+            static const char* parts[] = {"((_ zero_extend ", ") ", ")"};
+            stream << parts[index];
+            break;
+          }
+
+          /* Leaves */
+          case ARRAY_NODE:                stream << reinterpret_cast<triton::ast::ArrayNode*>(node)->getName(); break;
+          case DECIMAL_NODE:              stream << reinterpret_cast<triton::ast::DecimalNode*>(node)->getValue(); break;
+          case REFERENCE_NODE:            stream << "ref!" << reinterpret_cast<triton::ast::ReferenceNode*>(node)->getValue(); break;
+          case STRING_NODE:               stream << reinterpret_cast<triton::ast::StringNode*>(node)->getValue(); break;
+          case VARIABLE_NODE:             stream << reinterpret_cast<triton::ast::VariableNode*>(node)->getValue(); break;
 
-      /* zx representation */
-      std::ostream& AstSmtRepresentation::print(std::ostream& stream, triton::ast::ZxNode* node) {
-        stream << "((_ zero_extend " << node->getChilds()[0] << ") " << node->getChilds()[1] << ")";
-        return stream;
+          default:
+            throw triton::exceptions::AstRepresentation("AstSmtRepresentation::print(AbstractNode): Invalid kind node.");
+        }
       }
 
     };
   };
 };
-
@@ -6,6 +6,7 @@
 */
 
 #include <cpuSize.hpp>
+#include <astTraversal.hpp>
 #include <exceptions.hpp>
 #include <tritonToZ3Ast.hpp>
 
@@ -19,54 +20,145 @@ namespace triton {
         throw triton::exceptions::AstTranslations("TritonToZ3Ast::TritonToZ3Ast(): The symbolicEngine API cannot be null.");
 
       this->symbolicEngine = symbolicEngine;
-      this->isEval = eval;
+      this->isEval         = eval;
+      this->persistent     = false;
+      this->revision       = 0;
     }
 
 
     TritonToZ3Ast::~TritonToZ3Ast() {
+      this->clearTranslations();
     }
 
 
     Z3Result& TritonToZ3Ast::eval(triton::ast::AbstractNode& e) {
-      e.accept(*this);
+      std::vector<triton::ast::AbstractNode*> nodes;
+
+      /* Children are translated before their parents, referenced ASTs before their references */
+      triton::ast::nodesExtraction(nodes, &e, true);
+
+      /* Bind the symbols of let nodes, they are used by the string nodes of their body */
+      bool hasLet = false;
+      for (auto it = nodes.begin(); it != nodes.end(); it++) {
+        if ((*it)->getKind() == triton::ast::LET_NODE) {
+          std::string symbol    = reinterpret_cast<triton::ast::StringNode*>((*it)->getChilds()[0])->getValue();
+          this->symbols[symbol] = (*it)->getChilds()[1];
+          hasLet = true;
+        }
+      }
+
+      /*
+       * Previous translations are reused unless:
+       *  - variables are concretized (their values change).
+       *  - a symbol may be bound to another expression.
+       *  - the AST of a referenced expression has been replaced.
+       */
+      if (!this->persistent || this->isEval || hasLet || this->revision != triton::engines::symbolic::SymbolicExpression::getRevision())
+        this->clearTranslations();
+      this->revision = triton::engines::symbolic::SymbolicExpression::getRevision();
+
+      for (auto it = nodes.begin(); it != nodes.end(); it++) {
+        if (this->translations.find(*it) == this->translations.end())
+          (*it)->accept(*this);
+      }
+
+      this->result.setExpr(this->getExpr(e));
       return this->result;
     }
 
 
+    z3::context& TritonToZ3Ast::getContext(void) {
+      return this->result.getContext();
+    }
+
+
+    z3::expr& TritonToZ3Ast::getExpr(triton::ast::AbstractNode& e) {
+      auto it = this->translations.find(&e);
+      if (it == this->translations.end())
+        throw triton::exceptions::AstTranslations("TritonToZ3Ast::getExpr(): The node has not been translated.");
+      return it->second;
+    }
+
+
+    void TritonToZ3Ast::setExpr(triton::ast::AbstractNode& e, z3::expr& expr) {
+      /* A persistent translation holds its node, so its address cannot be reused by another node */
+      if (this->translations.insert(std::make_pair(&e, expr)).second && this->persistent)
+        e.incReference();
+    }
+
+
+    void TritonToZ3Ast::setPersistent(bool flag) {
+      if (this->persistent != flag)
+        this->clearTranslations();
+      this->persistent = flag;
+    }
+
+
+    void TritonToZ3Ast::clearTranslations(bool release) {
+      if (this->persistent && release) {
+        for (auto it = this->translations.begin(); it != this->translations.end(); it++)
+          it->first->decReference();
+      }
+      this->translations.clear();
+    }
+
+
+    void TritonToZ3Ast::reset(triton::engines::symbolic::SymbolicEngine* symbolicEngine, bool eval) {
+      if (symbolicEngine == nullptr)
+        throw triton::exceptions::AstTranslations("TritonToZ3Ast::reset(): The symbolicEngine API cannot be null.");
+
+      this->setPersistent(false);
+      this->clearTranslations();
+      this->symbols.clear();
+      this->symbolicEngine = symbolicEngine;
+      this->isEval         = eval;
+      this->revision       = 0;
+    }
+
+
     void TritonToZ3Ast::operator()(triton::ast::AbstractNode& e) {
       e.accept(*this);
     }
 
 
+    void TritonToZ3Ast::operator()(triton::ast::ArrayNode& e) {
+      z3::context& ctx  = this->result.getContext();
+      z3::sort sort     = ctx.array_sort(ctx.bv_sort(e.getIndexSize()), ctx.bv_sort(BYTE_SIZE_BIT));
+      z3::expr newexpr  = ctx.constant(e.getName().c_str(), sort);
+
+      this->setExpr(e, newexpr);
+    }
+
+
     void TritonToZ3Ast::operator()(triton::ast::AssertNode& e) {
       throw triton::exceptions::AstTranslations("TritonToZ3Ast::AssertNode(): Not implemented.");
     }
 
 
     void TritonToZ3Ast::operator()(triton::ast::BvaddNode& e) {
-      Z3Result op1      = this->eval(*e.getChilds()[0]);
-      Z3Result op2      = this->eval(*e.getChilds()[1]);
-      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvadd(this->result.getContext(), op1.getExpr(), op2.getExpr()));
+      z3::expr op1      = this->getExpr(*e.getChilds()[0]);
+      z3::expr op2      = this->getExpr(*e.getChilds()[1]);
+      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvadd(this->result.getContext(), op1, op2));
 
-      this->result.setExpr(newexpr);
+      this->setExpr(e, newexpr);
     }
 
 
     void TritonToZ3Ast::operator()(triton::ast::BvandNode& e) {
-      Z3Result op1      = this->eval(*e.getChilds()[0]);
-      Z3Result op2      = this->eval(*e.getChilds()[1]);
-      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvand(this->result.getContext(), op1.getExpr(), op2.getExpr()));
+      z3::expr op1      = this->getExpr(*e.getChilds()[0]);
+      z3::expr op2      = this->getExpr(*e.getChilds()[1]);
+      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvand(this->result.getContext(), op1, op2));
 
-      this->result.setExpr(newexpr);
+      this->setExpr(e, newexpr);
     }
 
 
     void TritonToZ3Ast::operator()(triton::ast::BvashrNode& e) {
-      Z3Result op1      = this->eval(*e.getChilds()[0]);
-      Z3Result op2      = this->eval(*e.getChilds()[1]);
-      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvashr(this->result.getContext(), op1.getExpr(), op2.getExpr()));
+      z3::expr op1      = this->getExpr(*e.getChilds()[0]);
+      z3::expr op2      = this->getExpr(*e.getChilds()[1]);
+      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvashr(this->result.getContext(), op1, op2));
 
-      this->result.setExpr(newexpr);
+      this->setExpr(e, newexpr);
     }
 
 
@@ -76,246 +168,245 @@ namespace triton {
 
 
     void TritonToZ3Ast::operator()(triton::ast::BvlshrNode& e) {
-      Z3Result op1      = this->eval(*e.getChilds()[0]);
-      Z3Result op2      = this->eval(*e.getChilds()[1]);
-      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvlshr(this->result.getContext(), op1.getExpr(), op2.getExpr()));
+      z3::expr op1      = this->getExpr(*e.getChilds()[0]);
+      z3::expr op2      = this->getExpr(*e.getChilds()[1]);
+      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvlshr(this->result.getContext(), op1, op2));
 
-      this->result.setExpr(newexpr);
+      this->setExpr(e, newexpr);
     }
 
 
     void TritonToZ3Ast::operator()(triton::ast::BvmulNode& e) {
-      Z3Result op1      = this->eval(*e.getChilds()[0]);
-      Z3Result op2      = this->eval(*e.getChilds()[1]);
-      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvmul(this->result.getContext(), op1.getExpr(), op2.getExpr()));
+      z3::expr op1      = this->getExpr(*e.getChilds()[0]);
+      z3::expr op2      = this->getExpr(*e.getChilds()[1]);
+      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvmul(this->result.getContext(), op1, op2));
 
 
-      this->result.setExpr(newexpr);
+      this->setExpr(e, newexpr);
     }
 
 
     void TritonToZ3Ast::operator()(triton::ast::BvsmodNode& e) {
-      Z3Result op1      = this->eval(*e.getChilds()[0]);
-      Z3Result op2      = this->eval(*e.getChilds()[1]);
-      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvsmod(this->result.getContext(), op1.getExpr(), op2.getExpr()));
+      z3::expr op1      = this->getExpr(*e.getChilds()[0]);
+      z3::expr op2      = this->getExpr(*e.getChilds()[1]);
+      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvsmod(this->result.getContext(), op1, op2));
 
-      this->result.setExpr(newexpr);
+      this->setExpr(e, newexpr);
     }
 
 
     void TritonToZ3Ast::operator()(triton::ast::BvnandNode& e) {
-      Z3Result op1      = this->eval(*e.getChilds()[0]);
-      Z3Result op2      = this->eval(*e.getChilds()[1]);
-      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvnand(this->result.getContext(), op1.getExpr(), op2.getExpr()));
+      z3::expr op1      = this->getExpr(*e.getChilds()[0]);
+      z3::expr op2      = this->getExpr(*e.getChilds()[1]);
+      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvnand(this->result.getContext(), op1, op2));
 
-      this->result.setExpr(newexpr);
+      this->setExpr(e, newexpr);
     }
 
 
     void TritonToZ3Ast::operator()(triton::ast::BvnegNode& e) {
-      Z3Result op1      = this->eval(*e.getChilds()[0]);
-      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvneg(this->result.getContext(), op1.getExpr()));
+      z3::expr op1      = this->getExpr(*e.getChilds()[0]);
+      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvneg(this->result.getContext(), op1));
 
-      this->result.setExpr(newexpr);
+      this->setExpr(e, newexpr);
     }
 
 
     void TritonToZ3Ast::operator()(triton::ast::BvnorNode& e) {
-      Z3Result op1      = this->eval(*e.getChilds()[0]);
-      Z3Result op2      = this->eval(*e.getChilds()[1]);
-      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvnor(this->result.getContext(), op1.getExpr(), op2.getExpr()));
+      z3::expr op1      = this->getExpr(*e.getChilds()[0]);
+      z3::expr op2      = this->getExpr(*e.getChilds()[1]);
+      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvnor(this->result.getContext(), op1, op2));
 
-      this->result.setExpr(newexpr);
+      this->setExpr(e, newexpr);
     }
 
 
     void TritonToZ3Ast::operator()(triton::ast::BvnotNode& e) {
-      Z3Result op1      = this->eval(*e.getChilds()[0]);
-      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvnot(this->result.getContext(), op1.getExpr()));
+      z3::expr op1      = this->getExpr(*e.getChilds()[0]);
+      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvnot(this->result.getContext(), op1));
 
-      this->result.setExpr(newexpr);
+      this->setExpr(e, newexpr);
     }
 
 
     void TritonToZ3Ast::operator()(triton::ast::BvorNode& e) {
-      Z3Result op1      = this->eval(*e.getChilds()[0]);
-      Z3Result op2      = this->eval(*e.getChilds()[1]);
-      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvor(this->result.getContext(), op1.getExpr(), op2.getExpr()));
+      z3::expr op1      = this->getExpr(*e.getChilds()[0]);
+      z3::expr op2      = this->getExpr(*e.getChilds()[1]);
+      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvor(this->result.getContext(), op1, op2));
 
-      this->result.setExpr(newexpr);
+      this->setExpr(e, newexpr);
     }
 
 
     void TritonToZ3Ast::operator()(triton::ast::BvrolNode& e) {
       triton::uint32 op1  = reinterpret_cast<triton::ast::DecimalNode*>(e.getChilds()[0])->getValue().convert_to<triton::uint32>();
-      Z3Result op2        = this->eval(*e.getChilds()[1]);
-      z3::expr newexpr    = to_expr(this->result.getContext(), Z3_mk_rotate_left(this->result.getContext(), op1, op2.getExpr()));
+      z3::expr op2        = this->getExpr(*e.getChilds()[1]);
+      z3::expr newexpr    = to_expr(this->result.getContext(), Z3_mk_rotate_left(this->result.getContext(), op1, op2));
 
-      this->result.setExpr(newexpr);
+      this->setExpr(e, newexpr);
     }
 
 
     void TritonToZ3Ast::operator()(triton::ast::BvrorNode& e) {
       triton::uint32 op1  = reinterpret_cast<triton::ast::DecimalNode*>(e.getChilds()[0])->getValue().convert_to<triton::uint32>();
-      Z3Result op2        = this->eval(*e.getChilds()[1]);
-      z3::expr newexpr    = to_expr(this->result.getContext(), Z3_mk_rotate_right(this->result.getContext(), op1, op2.getExpr()));
+      z3::expr op2        = this->getExpr(*e.getChilds()[1]);
+      z3::expr newexpr    = to_expr(this->result.getContext(), Z3_mk_rotate_right(this->result.getContext(), op1, op2));
 
-      this->result.setExpr(newexpr);
+      this->setExpr(e, newexpr);
     }
 
 
     void TritonToZ3Ast::operator()(triton::ast::BvsdivNode& e) {
-      Z3Result op1      = this->eval(*e.getChilds()[0]);
-      Z3Result op2      = this->eval(*e.getChilds()[1]);
-      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvsdiv(this->result.getContext(), op1.getExpr(), op2.getExpr()));
+      z3::expr op1      = this->getExpr(*e.getChilds()[0]);
+      z3::expr op2      = this->getExpr(*e.getChilds()[1]);
+      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvsdiv(this->result.getContext(), op1, op2));
 
-      this->result.setExpr(newexpr);
+      this->setExpr(e, newexpr);
     }
 
 
     void TritonToZ3Ast::operator()(triton::ast::BvsgeNode& e) {
-      Z3Result op1      = this->eval(*e.getChilds()[0]);
-      Z3Result op2      = this->eval(*e.getChilds()[1]);
-      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvsge(this->result.getContext(), op1.getExpr(), op2.getExpr()));
+      z3::expr op1      = this->getExpr(*e.getChilds()[0]);
+      z3::expr op2      = this->getExpr(*e.getChilds()[1]);
+      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvsge(this->result.getContext(), op1, op2));
 
-      this->result.setExpr(newexpr);
+      this->setExpr(e, newexpr);
     }
 
 
     void TritonToZ3Ast::operator()(triton::ast::BvsgtNode& e) {
-      Z3Result op1      = this->eval(*e.getChilds()[0]);
-      Z3Result op2      = this->eval(*e.getChilds()[1]);
-      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvsgt(this->result.getContext(), op1.getExpr(), op2.getExpr()));
+      z3::expr op1      = this->getExpr(*e.getChilds()[0]);
+      z3::expr op2      = this->getExpr(*e.getChilds()[1]);
+      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvsgt(this->result.getContext(), op1, op2));
 
-      this->result.setExpr(newexpr);
+      this->setExpr(e, newexpr);
     }
 
 
     void TritonToZ3Ast::operator()(triton::ast::BvshlNode& e) {
-      Z3Result op1      = this->eval(*e.getChilds()[0]);
-      Z3Result op2      = this->eval(*e.getChilds()[1]);
-      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvshl(this->result.getContext(), op1.getExpr(), op2.getExpr()));
+      z3::expr op1      = this->getExpr(*e.getChilds()[0]);
+      z3::expr op2      = this->getExpr(*e.getChilds()[1]);
+      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvshl(this->result.getContext(), op1, op2));
 
-      this->result.setExpr(newexpr);
+      this->setExpr(e, newexpr);
     }
 
 
     void TritonToZ3Ast::operator()(triton::ast::BvsleNode& e) {
-      Z3Result op1      = this->eval(*e.getChilds()[0]);
-      Z3Result op2      = this->eval(*e.getChilds()[1]);
-      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvsle(this->result.getContext(), op1.getExpr(), op2.getExpr()));
+      z3::expr op1      = this->getExpr(*e.getChilds()[0]);
+      z3::expr op2      = this->getExpr(*e.getChilds()[1]);
+      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvsle(this->result.getContext(), op1, op2));
 
-      this->result.setExpr(newexpr);
+      this->setExpr(e, newexpr);
     }
 
 
     void TritonToZ3Ast::operator()(triton::ast::BvsltNode& e) {
-      Z3Result op1      = this->eval(*e.getChilds()[0]);
-      Z3Result op2      = this->eval(*e.getChilds()[1]);
-      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvslt(this->result.getContext(), op1.getExpr(), op2.getExpr()));
+      z3::expr op1      = this->getExpr(*e.getChilds()[0]);
+      z3::expr op2      = this->getExpr(*e.getChilds()[1]);
+      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvslt(this->result.getContext(), op1, op2));
 
-      this->result.setExpr(newexpr);
+      this->setExpr(e, newexpr);
     }
 
 
     void TritonToZ3Ast::operator()(triton::ast::BvsremNode& e) {
-      Z3Result op1      = this->eval(*e.getChilds()[0]);
-      Z3Result op2      = this->eval(*e.getChilds()[1]);
-      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvsrem(this->result.getContext(), op1.getExpr(), op2.getExpr()));
+      z3::expr op1      = this->getExpr(*e.getChilds()[0]);
+      z3::expr op2      = this->getExpr(*e.getChilds()[1]);
+      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvsrem(this->result.getContext(), op1, op2));
 
-      this->result.setExpr(newexpr);
+      this->setExpr(e, newexpr);
     }
 
 
     void TritonToZ3Ast::operator()(triton::ast::BvsubNode& e) {
-      Z3Result op1      = this->eval(*e.getChilds()[0]);
-      Z3Result op2      = this->eval(*e.getChilds()[1]);
-      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvsub(this->result.getContext(), op1.getExpr(), op2.getExpr()));
+      z3::expr op1      = this->getExpr(*e.getChilds()[0]);
+      z3::expr op2      = this->getExpr(*e.getChilds()[1]);
+      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvsub(this->result.getContext(), op1, op2));
 
-      this->result.setExpr(newexpr);
+      this->setExpr(e, newexpr);
     }
 
 
     void TritonToZ3Ast::operator()(triton::ast::BvudivNode& e) {
-      Z3Result op1      = this->eval(*e.getChilds()[0]);
-      Z3Result op2      = this->eval(*e.getChilds()[1]);
-      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvudiv(this->result.getContext(), op1.getExpr(), op2.getExpr()));
+      z3::expr op1      = this->getExpr(*e.getChilds()[0]);
+      z3::expr op2      = this->getExpr(*e.getChilds()[1]);
+      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvudiv(this->result.getContext(), op1, op2));
 
-      this->result.setExpr(newexpr);
+      this->setExpr(e, newexpr);
     }
 
 
     void TritonToZ3Ast::operator()(triton::ast::BvugeNode& e) {
-      Z3Result op1      = this->eval(*e.getChilds()[0]);
-      Z3Result op2      = this->eval(*e.getChilds()[1]);
-      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvuge(this->result.getContext(), op1.getExpr(), op2.getExpr()));
+      z3::expr op1      = this->getExpr(*e.getChilds()[0]);
+      z3::expr op2      = this->getExpr(*e.getChilds()[1]);
+      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvuge(this->result.getContext(), op1, op2));
 
-      this->result.setExpr(newexpr);
+      this->setExpr(e, newexpr);
     }
 
 
     void TritonToZ3Ast::operator()(triton::ast::BvugtNode& e) {
-      Z3Result op1      = this->eval(*e.getChilds()[0]);
-      Z3Result op2      = this->eval(*e.getChilds()[1]);
-      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvugt(this->result.getContext(), op1.getExpr(), op2.getExpr()));
+      z3::expr op1      = this->getExpr(*e.getChilds()[0]);
+      z3::expr op2      = this->getExpr(*e.getChilds()[1]);
+      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvugt(this->result.getContext(), op1, op2));
 
-      this->result.setExpr(newexpr);
+      this->setExpr(e, newexpr);
     }
 
 
     void TritonToZ3Ast::operator()(triton::ast::BvuleNode& e) {
-      Z3Result op1      = this->eval(*e.getChilds()[0]);
-      Z3Result op2      = this->eval(*e.getChilds()[1]);
-      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvule(this->result.getContext(), op1.getExpr(), op2.getExpr()));
+      z3::expr op1      = this->getExpr(*e.getChilds()[0]);
+      z3::expr op2      = this->getExpr(*e.getChilds()[1]);
+      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvule(this->result.getContext(), op1, op2));
 
-      this->result.setExpr(newexpr);
+      this->setExpr(e, newexpr);
     }
 
 
     void TritonToZ3Ast::operator()(triton::ast::BvultNode& e) {
-      Z3Result op1      = this->eval(*e.getChilds()[0]);
-      Z3Result op2      = this->eval(*e.getChilds()[1]);
-      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvult(this->result.getContext(), op1.getExpr(), op2.getExpr()));
+      z3::expr op1      = this->getExpr(*e.getChilds()[0]);
+      z3::expr op2      = this->getExpr(*e.getChilds()[1]);
+      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvult(this->result.getContext(), op1, op2));
 
-      this->result.setExpr(newexpr);
+      this->setExpr(e, newexpr);
     }
 
 
     void TritonToZ3Ast::operator()(triton::ast::BvuremNode& e) {
-      Z3Result op1      = this->eval(*e.getChilds()[0]);
-      Z3Result op2      = this->eval(*e.getChilds()[1]);
-      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvurem(this->result.getContext(), op1.getExpr(), op2.getExpr()));
+      z3::expr op1      = this->getExpr(*e.getChilds()[0]);
+      z3::expr op2      = this->getExpr(*e.getChilds()[1]);
+      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvurem(this->result.getContext(), op1, op2));
 
-      this->result.setExpr(newexpr);
+      this->setExpr(e, newexpr);
     }
 
 
     void TritonToZ3Ast::operator()(triton::ast::BvxnorNode& e) {
-      Z3Result op1      = this->eval(*e.getChilds()[0]);
-      Z3Result op2      = this->eval(*e.getChilds()[1]);
-      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvxnor(this->result.getContext(), op1.getExpr(), op2.getExpr()));
+      z3::expr op1      = this->getExpr(*e.getChilds()[0]);
+      z3::expr op2      = this->getExpr(*e.getChilds()[1]);
+      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvxnor(this->result.getContext(), op1, op2));
 
-      this->result.setExpr(newexpr);
+      this->setExpr(e, newexpr);
     }
 
 
     void TritonToZ3Ast::operator()(triton::ast::BvxorNode& e) {
-      Z3Result op1      = this->eval(*e.getChilds()[0]);
-      Z3Result op2      = this->eval(*e.getChilds()[1]);
-      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvxor(this->result.getContext(), op1.getExpr(), op2.getExpr()));
+      z3::expr op1      = this->getExpr(*e.getChilds()[0]);
+      z3::expr op2      = this->getExpr(*e.getChilds()[1]);
+      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_bvxor(this->result.getContext(), op1, op2));
 
-      this->result.setExpr(newexpr);
+      this->setExpr(e, newexpr);
     }
 
 
     void TritonToZ3Ast::operator()(triton::ast::BvNode& e) {
-      Z3Result value        = this->eval(*e.getChilds()[0]);
-      Z3Result size         = this->eval(*e.getChilds()[1]);
-      triton::uint32 bvsize = static_cast<triton::uint32>(size.getUintValue());
+      std::string value(reinterpret_cast<triton::ast::DecimalNode*>(e.getChilds()[0])->getValue());
+      triton::uint32 bvsize = reinterpret_cast<triton::ast::DecimalNode*>(e.getChilds()[1])->getValue().convert_to<triton::uint32>();
 
-      z3::expr newexpr = this->result.getContext().bv_val(value.getStringValue().c_str(), bvsize);
+      z3::expr newexpr = this->result.getContext().bv_val(value.c_str(), bvsize);
 
-      this->result.setExpr(newexpr);
+      this->setExpr(e, newexpr);
     }
 
 
@@ -330,22 +421,22 @@ namespace triton {
       triton::uint32 idx;
 
       z3::expr nextValue(this->result.getContext());
-      z3::expr currentValue = eval(*childs[0]).getExpr();
+      z3::expr currentValue = this->getExpr(*childs[0]);
 
       //Child[0] is the LSB
       for (idx = 1; idx < childs.size(); idx++) {
-          nextValue = eval(*childs[idx]).getExpr();
+          nextValue = this->getExpr(*childs[idx]);
           currentValue = to_expr(this->result.getContext(), Z3_mk_concat(this->result.getContext(), currentValue, nextValue));
       }
 
-      this->result.setExpr(currentValue);
+      this->setExpr(e, currentValue);
     }
 
 
     void TritonToZ3Ast::operator()(triton::ast::DecimalNode& e) {
       std::string value(e.getValue());
       z3::expr newexpr = this->result.getContext().int_val(value.c_str());
-      this->result.setExpr(newexpr);
+      this->setExpr(e, newexpr);
     }
 
 
@@ -355,113 +446,157 @@ namespace triton {
 
 
     void TritonToZ3Ast::operator()(triton::ast::DistinctNode& e) {
-      Z3Result op1      = this->eval(*e.getChilds()[0]);
-      Z3Result op2      = this->eval(*e.getChilds()[1]);
-      Z3_ast ops[]      = {op1.getExpr(), op2.getExpr()};
+      z3::expr op1      = this->getExpr(*e.getChilds()[0]);
+      z3::expr op2      = this->getExpr(*e.getChilds()[1]);
+      Z3_ast ops[]      = {op1, op2};
       z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_distinct(this->result.getContext(), 2, ops));
 
-      this->result.setExpr(newexpr);
+      this->setExpr(e, newexpr);
     }
 
 
     void TritonToZ3Ast::operator()(triton::ast::EqualNode& e) {
-      Z3Result op1      = this->eval(*e.getChilds()[0]);
-      Z3Result op2      = this->eval(*e.getChilds()[1]);
-      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_eq(this->result.getContext(), op1.getExpr(), op2.getExpr()));
+      z3::expr op1      = this->getExpr(*e.getChilds()[0]);
+      z3::expr op2      = this->getExpr(*e.getChilds()[1]);
+      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_eq(this->result.getContext(), op1, op2));
 
-      this->result.setExpr(newexpr);
+      this->setExpr(e, newexpr);
     }
 
 
     void TritonToZ3Ast::operator()(triton::ast::ExtractNode& e) {
-      Z3Result high     = this->eval(*e.getChilds()[0]);
-      Z3Result low      = this->eval(*e.getChilds()[1]);
-      Z3Result value    = this->eval(*e.getChilds()[2]);
-      triton::uint32 hv = static_cast<triton::uint32>(high.getUintValue());
-      triton::uint32 lv = static_cast<triton::uint32>(low.getUintValue());
-      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_extract(this->result.getContext(), hv, lv, value.getExpr()));
+      z3::expr value    = this->getExpr(*e.getChilds()[2]);
+      triton::uint32 hv = reinterpret_cast<triton::ast::DecimalNode*>(e.getChilds()[0])->getValue().convert_to<triton::uint32>();
+      triton::uint32 lv = reinterpret_cast<triton::ast::DecimalNode*>(e.getChilds()[1])->getValue().convert_to<triton::uint32>();
+      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_extract(this->result.getContext(), hv, lv, value));
 
-      this->result.setExpr(newexpr);
+      this->setExpr(e, newexpr);
     }
 
 
     void TritonToZ3Ast::operator()(triton::ast::IteNode& e) {
-      Z3Result op1      = this->eval(*e.getChilds()[0]); // condition
-      Z3Result op2      = this->eval(*e.getChilds()[1]); // if true
-      Z3Result op3      = this->eval(*e.getChilds()[2]); // if false
-      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_ite(this->result.getContext(), op1.getExpr(), op2.getExpr(), op3.getExpr()));
+      z3::expr op1      = this->getExpr(*e.getChilds()[0]); // condition
+      z3::expr op2      = this->getExpr(*e.getChilds()[1]); // if true
+      z3::expr op3      = this->getExpr(*e.getChilds()[2]); // if false
+      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_ite(this->result.getContext(), op1, op2, op3));
 
-      this->result.setExpr(newexpr);
+      this->setExpr(e, newexpr);
     }
 
 
     void TritonToZ3Ast::operator()(triton::ast::LandNode& e) {
-      Z3Result op1      = this->eval(*e.getChilds()[0]);
-      Z3Result op2      = this->eval(*e.getChilds()[1]);
-      Z3_ast ops[]      = {op1.getExpr(), op2.getExpr()};
+      z3::expr op1      = this->getExpr(*e.getChilds()[0]);
+      z3::expr op2      = this->getExpr(*e.getChilds()[1]);
+      Z3_ast ops[]      = {op1, op2};
       z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_and(this->result.getContext(), 2, ops));
 
-      this->result.setExpr(newexpr);
+      this->setExpr(e, newexpr);
     }
 
 
     void TritonToZ3Ast::operator()(triton::ast::LetNode& e) {
-      std::string symbol    = reinterpret_cast<triton::ast::StringNode*>(e.getChilds()[0])->getValue();
-      this->symbols[symbol] = e.getChilds()[1];
-      Z3Result op2          = this->eval(*e.getChilds()[2]);
+      /* The symbol has been bound by eval() */
+      z3::expr op2 = this->getExpr(*e.getChilds()[2]);
 
-      this->result.setExpr(op2.getExpr());
+      this->setExpr(e, op2);
     }
 
 
     void TritonToZ3Ast::operator()(triton::ast::LnotNode& e) {
-      Z3Result op1      = this->eval(*e.getChilds()[0]);
-      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_not(this->result.getContext(), op1.getExpr()));
+      z3::expr op1      = this->getExpr(*e.getChilds()[0]);
+      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_not(this->result.getContext(), op1));
 
-      this->result.setExpr(newexpr);
+      this->setExpr(e, newexpr);
     }
 
 
     void TritonToZ3Ast::operator()(triton::ast::LorNode& e) {
-      Z3Result op1      = this->eval(*e.getChilds()[0]);
-      Z3Result op2      = this->eval(*e.getChilds()[1]);
-      Z3_ast ops[]      = {op1.getExpr(), op2.getExpr()};
+      z3::expr op1      = this->getExpr(*e.getChilds()[0]);
+      z3::expr op2      = this->getExpr(*e.getChilds()[1]);
+      Z3_ast ops[]      = {op1, op2};
       z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_or(this->result.getContext(), 2, ops));
 
-      this->result.setExpr(newexpr);
+      this->setExpr(e, newexpr);
     }
 
 
     void TritonToZ3Ast::operator()(triton::ast::ReferenceNode& e) {
-      triton::engines::symbolic::SymbolicExpression* refNode = this->symbolicEngine->getSymbolicExpressionFromId(e.getValue());
+      triton::engines::symbolic::SymbolicExpression* refNode = e.getSymbolicExpression();
       if (refNode == nullptr)
         throw triton::exceptions::AstTranslations("TritonToZ3Ast::ReferenceNode(): Reference node not found.");
-      Z3Result op1 = this->eval(*(refNode->getAst()));
-      this->result.setExpr(op1.getExpr());
+      z3::expr op1 = this->getExpr(*(refNode->getAst()));
+      this->setExpr(e, op1);
+    }
+
+
+    void TritonToZ3Ast::operator()(triton::ast::SelectNode& e) {
+      /* If the conversion is used to evaluate a node, the cells of the arrays are concretized */
+      if (this->isEval) {
+        std::string value(e.evaluate());
+        z3::expr newexpr = this->result.getContext().bv_val(value.c_str(), BYTE_SIZE_BIT);
+        this->setExpr(e, newexpr);
+        return;
+      }
+
+      z3::expr array    = this->getExpr(*e.getChilds()[0]);
+      z3::expr index    = this->getExpr(*e.getChilds()[1]);
+      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_select(this->result.getContext(), array, index));
+
+      this->setExpr(e, newexpr);
+    }
+
+
+    void TritonToZ3Ast::operator()(triton::ast::StoreNode& e) {
+      z3::expr array    = this->getExpr(*e.getChilds()[0]);
+      z3::expr index    = this->getExpr(*e.getChilds()[1]);
+      z3::expr value    = this->getExpr(*e.getChilds()[2]);
+      z3::expr newexpr  = to_expr(this->result.getContext(), Z3_mk_store(this->result.getContext(), array, index, value));
+
+      this->setExpr(e, newexpr);
     }
 
 
     void TritonToZ3Ast::operator()(triton::ast::StringNode& e) {
       if (this->symbols.find(e.getValue()) == this->symbols.end())
         throw triton::exceptions::AstTranslations("TritonToZ3Ast::StringNode(): Symbols not found.");
-      Z3Result op1 = this->eval(*(this->symbols[e.getValue()]));
-      this->result.setExpr(op1.getExpr());
+
+      /* The symbol of a let node is not translated, its expression comes after it */
+      auto it = this->translations.find(this->symbols[e.getValue()]);
+      if (it != this->translations.end())
+        this->setExpr(e, it->second);
     }
 
 
     void TritonToZ3Ast::operator()(triton::ast::SxNode& e) {
-      Z3Result ext        = this->eval(*e.getChilds()[0]);
-      Z3Result value      = this->eval(*e.getChilds()[1]);
-      triton::uint32 extv = static_cast<triton::uint32>(ext.getUintValue());
-      z3::expr newexpr    = to_expr(this->result.getContext(), Z3_mk_sign_ext(this->result.getContext(), extv, value.getExpr()));
+      z3::expr value      = this->getExpr(*e.getChilds()[1]);
+      triton::uint32 extv = reinterpret_cast<triton::ast::DecimalNode*>(e.getChilds()[0])->getValue().convert_to<triton::uint32>();
+      z3::expr newexpr    = to_expr(this->result.getContext(), Z3_mk_sign_ext(this->result.getContext(), extv, value));
+
+      this->setExpr(e, newexpr);
+    }
+
+
+    void TritonToZ3Ast::operator()(triton::ast::VaddNode& e) {
+      z3::context& ctx    = this->result.getContext();
+      z3::expr value1     = this->getExpr(*e.getChilds()[1]);
+      z3::expr value2     = this->getExpr(*e.getChilds()[2]);
+      triton::uint32 lane = reinterpret_cast<triton::ast::DecimalNode*>(e.getChilds()[0])->getValue().convert_to<triton::uint32>();
+      z3::expr newexpr(ctx);
+
+      /* Lowered to the concatenation of the lanes, the most significant one first */
+      for (triton::uint32 high = e.getBitvectorSize(); high > 0; high -= lane) {
+        z3::expr op1   = to_expr(ctx, Z3_mk_extract(ctx, high - 1, high - lane, value1));
+        z3::expr op2   = to_expr(ctx, Z3_mk_extract(ctx, high - 1, high - lane, value2));
+        z3::expr item  = to_expr(ctx, Z3_mk_bvadd(ctx, op1, op2));
+        newexpr = (high == e.getBitvectorSize()) ? item : to_expr(ctx, Z3_mk_concat(ctx, newexpr, item));
+      }
 
-      this->result.setExpr(newexpr);
+      this->setExpr(e, newexpr);
     }
 
 
     void TritonToZ3Ast::operator()(triton::ast::VariableNode& e) {
-      std::string varName = e.getValue();
-      triton::engines::symbolic::SymbolicVariable* symVar = this->symbolicEngine->getSymbolicVariableFromName(varName);
+      triton::engines::symbolic::SymbolicVariable* symVar = this->symbolicEngine->getSymbolicVariableFromId(e.getVariableId());
 
       if (symVar == nullptr)
         throw triton::exceptions::AstTranslations("TritonToZ3Ast::VariableNode(): Can't get the symbolic variable (nullptr).");
@@ -476,13 +611,13 @@ namespace triton {
           triton::uint512 memValue = symVar->getConcreteValue();
           std::string memStrValue(memValue);
           z3::expr newexpr = this->result.getContext().bv_val(memStrValue.c_str(), memSize);
-          this->result.setExpr(newexpr);
+          this->setExpr(e, newexpr);
         }
         else if (symVar->getKind() == triton::engines::symbolic::REG) {
           triton::uint512 regValue = symVar->getConcreteValue();
           std::string regStrValue(regValue);
           z3::expr newexpr = this->result.getContext().bv_val(regStrValue.c_str(), symVar->getSize());
-          this->result.setExpr(newexpr);
+          this->setExpr(e, newexpr);
         }
         else
           throw triton::exceptions::AstTranslations("TritonToZ3Ast::VariableNode(): UNSET.");
@@ -491,18 +626,38 @@ namespace triton {
       else {
         //z3::expr newexpr = to_expr(this->result.getContext(), Z3_mk_const(this->result.getContext(), Z3_mk_string_symbol(this->result.getContext(), symVar->getName().c_str()), Z3_mk_bv_sort(this->result.getContext(), symVar->getSize())));
         z3::expr newexpr = this->result.getContext().bv_const(symVar->getName().c_str(), symVar->getSize());
-        this->result.setExpr(newexpr);
+        this->setExpr(e, newexpr);
       }
     }
 
 
+    void TritonToZ3Ast::operator()(triton::ast::VeqNode& e) {
+      z3::context& ctx    = this->result.getContext();
+      z3::expr value1     = this->getExpr(*e.getChilds()[1]);
+      z3::expr value2     = this->getExpr(*e.getChilds()[2]);
+      triton::uint32 lane = reinterpret_cast<triton::ast::DecimalNode*>(e.getChilds()[0])->getValue().convert_to<triton::uint32>();
+      z3::expr zero       = ctx.bv_val(0, lane);
+      z3::expr ones       = to_expr(ctx, Z3_mk_bvnot(ctx, zero));
+      z3::expr newexpr(ctx);
+
+      /* Lowered to the concatenation of the lanes, the most significant one first */
+      for (triton::uint32 high = e.getBitvectorSize(); high > 0; high -= lane) {
+        z3::expr op1   = to_expr(ctx, Z3_mk_extract(ctx, high - 1, high - lane, value1));
+        z3::expr op2   = to_expr(ctx, Z3_mk_extract(ctx, high - 1, high - lane, value2));
+        z3::expr item  = to_expr(ctx, Z3_mk_ite(ctx, Z3_mk_eq(ctx, op1, op2), ones, zero));
+        newexpr = (high == e.getBitvectorSize()) ? item : to_expr(ctx, Z3_mk_concat(ctx, newexpr, item));
+      }
+
+      this->setExpr(e, newexpr);
+    }
+
+
     void TritonToZ3Ast::operator()(triton::ast::ZxNode& e) {
-      Z3Result ext        = this->eval(*e.getChilds()[0]);
-      Z3Result value      = this->eval(*e.getChilds()[1]);
-      triton::uint32 extv = static_cast<triton::uint32>(ext.getUintValue());
-      z3::expr newexpr    = to_expr(this->result.getContext(), Z3_mk_zero_ext(this->result.getContext(), extv, value.getExpr()));
+      z3::expr value      = this->getExpr(*e.getChilds()[1]);
+      triton::uint32 extv = reinterpret_cast<triton::ast::DecimalNode*>(e.getChilds()[0])->getValue().convert_to<triton::uint32>();
+      z3::expr newexpr    = to_expr(this->result.getContext(), Z3_mk_zero_ext(this->result.getContext(), extv, value));
 
-      this->result.setExpr(newexpr);
+      this->setExpr(e, newexpr);
     }
 
   }; /* ast namespace */
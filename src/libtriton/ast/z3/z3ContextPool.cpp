@@ -0,0 +1,116 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#include <memory>
+#include <new>
+#include <vector>
+
+#include <exceptions.hpp>
+#include <z3ContextPool.hpp>
+
+
+
+namespace triton {
+  namespace ast {
+
+    /* A translator of the pool of a thread */
+    struct Z3PoolSlot {
+      std::unique_ptr<TritonToZ3Ast> translator;
+      triton::usize leases;
+      bool busy;
+    };
+
+
+    /* Z3 contexts are not thread-safe, every thread has its own pool */
+    static std::vector<Z3PoolSlot>& getPool(void) {
+      static thread_local std::vector<Z3PoolSlot> pool;
+      return pool;
+    }
+
+
+    Z3ContextLease::Z3ContextLease(triton::engines::symbolic::SymbolicEngine* symbolicEngine, bool eval) {
+      std::vector<Z3PoolSlot>& pool = getPool();
+
+      this->slot        = -1;
+      this->owned       = nullptr;
+      this->translator  = nullptr;
+      this->invalidated = false;
+
+      for (triton::uint32 index = 0; index < pool.size(); index++) {
+        if (!pool[index].busy) {
+          this->slot = index;
+          break;
+        }
+      }
+
+      if (this->slot == -1 && pool.size() < Z3ContextLease::maxTranslators) {
+        pool.push_back(Z3PoolSlot());
+        pool.back().leases = 0;
+        pool.back().busy   = false;
+        this->slot = static_cast<triton::sint32>(pool.size() - 1);
+      }
+
+      /* Nested uses beyond the pool get their own translator */
+      if (this->slot == -1) {
+        this->owned = new(std::nothrow) TritonToZ3Ast(symbolicEngine, eval);
+        if (this->owned == nullptr)
+          throw triton::exceptions::AstTranslations("Z3ContextLease::Z3ContextLease(): Not enough memory.");
+        this->translator = this->owned;
+        return;
+      }
+
+      Z3PoolSlot& entry = pool[this->slot];
+      if (entry.translator == nullptr || entry.leases >= Z3ContextLease::resetInterval) {
+        entry.translator.reset(new TritonToZ3Ast(symbolicEngine, eval));
+        entry.leases = 0;
+      }
+      else {
+        entry.translator->reset(symbolicEngine, eval);
+      }
+
+      entry.leases++;
+      entry.busy       = true;
+      this->translator = entry.translator.get();
+    }
+
+
+    Z3ContextLease::~Z3ContextLease() {
+      if (this->owned != nullptr) {
+        delete this->owned;
+        return;
+      }
+
+      Z3PoolSlot& entry = getPool()[this->slot];
+      entry.busy = false;
+
+      if (this->invalidated) {
+        entry.translator.reset();
+        return;
+      }
+
+      /* Translations are not kept in the pool, persistent ones hold their nodes */
+      entry.translator->setPersistent(false);
+      entry.translator->clearTranslations();
+    }
+
+
+    TritonToZ3Ast& Z3ContextLease::getTranslator(void) {
+      return *this->translator;
+    }
+
+
+    z3::context& Z3ContextLease::getContext(void) {
+      return this->translator->getContext();
+    }
+
+
+    void Z3ContextLease::invalidate(void) {
+      this->invalidated = true;
+    }
+
+  }; /* ast namespace */
+}; /* triton namespace */
@@ -7,6 +7,7 @@
 
 #include <exceptions.hpp>
 #include <tritonToZ3Ast.hpp>
+#include <z3ContextPool.hpp>
 #include <z3Interface.hpp>
 #include <z3Result.hpp>
 #include <z3ToTritonAst.hpp>
@@ -28,14 +29,15 @@ namespace triton {
 
 
     triton::ast::AbstractNode* Z3Interface::simplify(triton::ast::AbstractNode* node) const {
-      triton::ast::TritonToZ3Ast  z3Ast{this->symbolicEngine, false};
+      triton::ast::Z3ContextLease lease{this->symbolicEngine, false};
       triton::ast::Z3ToTritonAst  tritonAst{this->symbolicEngine};
-      triton::ast::Z3Result       result = z3Ast.eval(*node);
 
-      /* Simplify and convert back to Triton's AST */
-      z3::expr expr = result.getExpr().simplify();
-      tritonAst.setExpr(expr);
-      node = tritonAst.convert();
+      /* Simplify and convert back to Triton's AST, before the context is given back */
+      {
+        z3::expr expr = lease.getTranslator().eval(*node).getExpr().simplify();
+        tritonAst.setExpr(expr);
+        node = tritonAst.convert();
+      }
 
       return node;
     }
@@ -45,11 +47,8 @@ namespace triton {
       if (node == nullptr)
         throw triton::exceptions::AstTranslations("Z3Interface::evaluate(): node cannot be null.");
 
-      triton::ast::TritonToZ3Ast z3ast{this->symbolicEngine};
-      triton::ast::Z3Result result = z3ast.eval(*node);
-      triton::uint512 nbResult{result.getStringValue()};
-
-      return nbResult;
+      triton::ast::Z3ContextLease lease{this->symbolicEngine};
+      return lease.getTranslator().eval(*node).getValue();
     }
 
   }; /* ast namespace */
@@ -65,6 +65,17 @@ namespace triton {
     }
 
 
+    triton::uint512 Z3Result::getValue(void) const {
+      z3::expr sExpr       = this->expr.simplify();
+      triton::uint64 value = 0;
+
+      if (sExpr.is_bv() && sExpr.get_sort().bv_size() <= 64 && Z3_get_numeral_uint64(sExpr.ctx(), sExpr, &value))
+        return value;
+
+      return triton::uint512(Z3_get_numeral_string(sExpr.ctx(), sExpr));
+    }
+
+
     z3::context& Z3Result::getContext(void) {
       return this->context;
     }
@@ -15,8 +15,15 @@
 namespace triton {
   namespace ast {
 
+    /* The context of the expressions which are not set yet. Creating a context per conversion is expensive. */
+    static z3::context& getEmptyContext(void) {
+      static thread_local z3::context context;
+      return context;
+    }
+
+
     Z3ToTritonAst::Z3ToTritonAst(triton::engines::symbolic::SymbolicEngine* symbolicEngine)
-      : context(), expr(this->context) {
+      : expr(getEmptyContext()) {
       if (symbolicEngine == nullptr)
         throw triton::exceptions::AstTranslations("Z3ToTritonAst::Z3ToTritonAst(): The symbolicEngine API cannot be null.");
 
@@ -25,12 +32,11 @@ namespace triton {
 
 
     Z3ToTritonAst::Z3ToTritonAst(triton::engines::symbolic::SymbolicEngine* symbolicEngine, z3::expr& expr)
-      : context(), expr(this->context) {
+      : expr(expr) {
       if (symbolicEngine == nullptr)
         throw triton::exceptions::AstTranslations("Z3ToTritonAst::Z3ToTritonAst(): The symbolicEngine API cannot be null.");
 
       this->symbolicEngine = symbolicEngine;
-      this->expr = expr;
     }
 
 
@@ -50,12 +56,25 @@ namespace triton {
 
 
     AbstractNode* Z3ToTritonAst::convert(void) {
-      return this->visit(this->expr);
+      AbstractNode* node = nullptr;
+
+      /* Ids are only unique while the expression is alive */
+      this->nodes.clear();
+      node = this->visit(this->expr);
+      this->nodes.clear();
+
+      return node;
     }
 
 
     AbstractNode* Z3ToTritonAst::visit(z3::expr const& expr) {
       AbstractNode* node = nullptr;
+      unsigned int id    = Z3_get_ast_id(expr.ctx(), expr);
+
+      /* A shared subterm is converted once */
+      auto it = this->nodes.find(id);
+      if (it != this->nodes.end())
+        return it->second;
 
       /* Currently, only support application node */
       if (expr.is_quantifier())
@@ -120,7 +139,7 @@ namespace triton {
         }
 
         case Z3_OP_BNUM: {
-          std::string stringValue = Z3_get_numeral_string(this->context, expr);
+          std::string stringValue = Z3_get_numeral_string(expr.ctx(), expr);
           triton::uint512 intValue{stringValue};
           node = triton::ast::bv(intValue, expr.get_sort().bv_size());
           break;
@@ -413,12 +432,28 @@ namespace triton {
           break;
         }
 
-        /* Variable or string */
+        case Z3_OP_SELECT: {
+          if (expr.num_args() != 2)
+            throw triton::exceptions::AstTranslations("Z3ToTritonAst::visit(): Z3_OP_SELECT must contain two arguments.");
+          node = triton::ast::select(this->visit(expr.arg(0)), this->visit(expr.arg(1)));
+          break;
+        }
+
+        case Z3_OP_STORE: {
+          if (expr.num_args() != 3)
+            throw triton::exceptions::AstTranslations("Z3ToTritonAst::visit(): Z3_OP_STORE must contain three arguments.");
+          node = triton::ast::store(this->visit(expr.arg(0)), this->visit(expr.arg(1)), this->visit(expr.arg(2)));
+          break;
+        }
+
+        /* Variable, array or string */
         case Z3_OP_UNINTERPRETED: {
           std::string name = function.name().str();
           triton::engines::symbolic::SymbolicVariable* symVar = this->symbolicEngine->getSymbolicVariableFromName(name);
 
-          if (symVar)
+          if (expr.get_sort().is_array())
+            node = triton::ast::array(expr.get_sort().array_domain().bv_size(), name);
+          else if (symVar)
             node = triton::ast::variable(*symVar);
           else
             node = triton::ast::string(name);
@@ -430,6 +465,7 @@ namespace triton {
           throw triton::exceptions::AstTranslations("Z3ToTritonAst::visit(): '" + function.name().str() + "' AST node not supported yet");
       }
 
+      this->nodes[id] = node;
       return node;
     }
 
@@ -10,6 +10,7 @@
 #include <iostream>
 
 #include <pythonBindings.hpp>
+#include <pythonObjects.hpp>
 #include <pythonXFunctions.hpp>
 #include <pythonBindings.hpp>
 
@@ -32,11 +33,27 @@ namespace triton {
       #endif
 
 
+      void clearArchitectureNamespaces(void) {
+        if (!triton::bindings::python::initialized)
+          return;
+
+        PyDict_Clear(triton::bindings::python::cpuSizeDict);
+        PyDict_Clear(triton::bindings::python::opcodesDict);
+        PyDict_Clear(triton::bindings::python::prefixesDict);
+        PyDict_Clear(triton::bindings::python::registersDict);
+        #if defined(__unix__) || defined(__APPLE__)
+        PyDict_Clear(triton::bindings::python::syscallsDict);
+        #endif
+        triton::bindings::python::clearRegisterSingletons();
+      }
+
+
       /* Python entry point */
       PyMODINIT_FUNC inittriton(void) {
 
-        /* Init python */
+        /* Init python and the GIL, released by the long-running calls */
         Py_Initialize();
+        PyEval_InitThreads();
 
         /* Create the triton module ================================================================== */
 
@@ -84,18 +101,23 @@ namespace triton {
         /* Create the CPUSIZE namespace ============================================================== */
 
         triton::bindings::python::cpuSizeDict = xPyDict_New();
-        PyObject* idCpuSizeClass = xPyClass_New(nullptr, triton::bindings::python::cpuSizeDict, xPyString_FromString("CPUSIZE"));
+        PyObject* idCpuSizeClass = PyLazyNamespace("CPUSIZE", triton::bindings::python::cpuSizeDict, [](PyObject*) { initCpuSizeNamespace(); });
 
         /* Create the ELF namespace ================================================================== */
 
         PyObject* elfDict = xPyDict_New();
-        initElfNamespace(elfDict);
-        PyObject* idElfDictClass = xPyClass_New(nullptr, elfDict, xPyString_FromString("ELF"));
+        PyObject* idElfDictClass = PyLazyNamespace("ELF", elfDict, initElfNamespace);
+
+        /* Create the EXPLORATION namespace ========================================================== */
+
+        PyObject* explorationDict = xPyDict_New();
+        initExplorationNamespace(explorationDict);
+        PyObject* idExplorationClass = xPyClass_New(nullptr, explorationDict, xPyString_FromString("EXPLORATION"));
 
         /* Create the OPCODE namespace =============================================================== */
 
         triton::bindings::python::opcodesDict = xPyDict_New();
-        PyObject* idOpcodesClass = xPyClass_New(nullptr, triton::bindings::python::opcodesDict, xPyString_FromString("OPCODE"));
+        PyObject* idOpcodesClass = PyLazyNamespace("OPCODE", triton::bindings::python::opcodesDict, [](PyObject*) { initX86OpcodesNamespace(); });
 
         /* Create the OPERAND namespace ============================================================== */
 
@@ -112,18 +134,29 @@ namespace triton {
         /* Create the PE namespace ================================================================== */
 
         PyObject* peDict = xPyDict_New();
-        initPENamespace(peDict);
-        PyObject* idPeDictClass = xPyClass_New(nullptr, peDict, xPyString_FromString("PE"));
+        PyObject* idPeDictClass = PyLazyNamespace("PE", peDict, initPENamespace);
 
         /* Create the PREFIX namespace =============================================================== */
 
         triton::bindings::python::prefixesDict = xPyDict_New();
-        PyObject* idPrefixesClass = xPyClass_New(nullptr, triton::bindings::python::prefixesDict, xPyString_FromString("PREFIX"));
+        PyObject* idPrefixesClass = PyLazyNamespace("PREFIX", triton::bindings::python::prefixesDict, [](PyObject*) { initX86PrefixesNamespace(); });
+
+        /* Create the PROFILE namespace ============================================================== */
+
+        PyObject* profileDict = xPyDict_New();
+        initProfileNamespace(profileDict);
+        PyObject* idProfileClass = xPyClass_New(nullptr, profileDict, xPyString_FromString("PROFILE"));
 
         /* Create the REG namespace ================================================================== */
 
         triton::bindings::python::registersDict = xPyDict_New();
-        PyObject* idRegClass = xPyClass_New(nullptr, triton::bindings::python::registersDict, xPyString_FromString("REG"));
+        PyObject* idRegClass = PyLazyNamespace("REG", triton::bindings::python::registersDict, [](PyObject*) { initRegNamespace(); });
+
+        /* Create the SOLVER namespace =============================================================== */
+
+        PyObject* solverDict = xPyDict_New();
+        initSolverNamespace(solverDict);
+        PyObject* idSolverClass = xPyClass_New(nullptr, solverDict, xPyString_FromString("SOLVER"));
 
         /* Create the SYMEXPR namespace ============================================================== */
 
@@ -134,7 +167,7 @@ namespace triton {
         /* Create the SYSCALL namespace ============================================================== */
         #if defined(__unix__) || defined(__APPLE__)
         triton::bindings::python::syscallsDict = xPyDict_New();
-        PyObject* idSyscallsClass = xPyClass_New(nullptr, triton::bindings::python::syscallsDict, xPyString_FromString("SYSCALL"));
+        PyObject* idSyscallsClass = PyLazyNamespace("SYSCALL", triton::bindings::python::syscallsDict, [](PyObject*) { initSyscallNamespace(); });
         #endif
 
         /* Create the VERSION namespace ============================================================== */
@@ -146,22 +179,25 @@ namespace triton {
 
         /* Init triton module ======================================================================== */
 
-        /* Add every modules and namespace into the triton module */
+        /* Add every modules and namespace into the triton module. The lazy ones are filled when they are accessed */
         PyModule_AddObject(triton::bindings::python::tritonModule, "ARCH",                idArchDictClass);
         PyModule_AddObject(triton::bindings::python::tritonModule, "AST_NODE",            idAstNodeDictClass);
         PyModule_AddObject(triton::bindings::python::tritonModule, "AST_REPRESENTATION",  idAstRepresentationDictClass);
         PyModule_AddObject(triton::bindings::python::tritonModule, "CALLBACK",            idCallbackDictClass);
-        PyModule_AddObject(triton::bindings::python::tritonModule, "CPUSIZE",             idCpuSizeClass);            /* Empty: filled on the fly */
-        PyModule_AddObject(triton::bindings::python::tritonModule, "ELF",                 idElfDictClass);
+        PyModule_AddObject(triton::bindings::python::tritonModule, "CPUSIZE",             idCpuSizeClass);            /* Lazy: filled on access */
+        PyModule_AddObject(triton::bindings::python::tritonModule, "ELF",                 idElfDictClass);            /* Lazy: filled on access */
+        PyModule_AddObject(triton::bindings::python::tritonModule, "EXPLORATION",         idExplorationClass);
         PyModule_AddObject(triton::bindings::python::tritonModule, "MODE",                idModeClass);
-        PyModule_AddObject(triton::bindings::python::tritonModule, "OPCODE",              idOpcodesClass);            /* Empty: filled on the fly */
+        PyModule_AddObject(triton::bindings::python::tritonModule, "OPCODE",              idOpcodesClass);            /* Lazy: filled on access */
         PyModule_AddObject(triton::bindings::python::tritonModule, "OPERAND",             idOperandClass);
-        PyModule_AddObject(triton::bindings::python::tritonModule, "PE",                  idPeDictClass);
-        PyModule_AddObject(triton::bindings::python::tritonModule, "PREFIX",              idPrefixesClass);           /* Empty: filled on the fly */
-        PyModule_AddObject(triton::bindings::python::tritonModule, "REG",                 idRegClass);                /* Empty: filled on the fly */
+        PyModule_AddObject(triton::bindings::python::tritonModule, "PE",                  idPeDictClass);             /* Lazy: filled on access */
+        PyModule_AddObject(triton::bindings::python::tritonModule, "PREFIX",              idPrefixesClass);           /* Lazy: filled on access */
+        PyModule_AddObject(triton::bindings::python::tritonModule, "PROFILE",             idProfileClass);
+        PyModule_AddObject(triton::bindings::python::tritonModule, "REG",                 idRegClass);                /* Lazy: filled on access */
+        PyModule_AddObject(triton::bindings::python::tritonModule, "SOLVER",              idSolverClass);
         PyModule_AddObject(triton::bindings::python::tritonModule, "SYMEXPR",             idSymExprClass);
         #if defined(__unix__) || defined(__APPLE__)
-        PyModule_AddObject(triton::bindings::python::tritonModule, "SYSCALL",             idSyscallsClass);           /* Empty: filled on the fly */
+        PyModule_AddObject(triton::bindings::python::tritonModule, "SYSCALL",             idSyscallsClass);           /* Lazy: filled on access */
         #endif
         PyModule_AddObject(triton::bindings::python::tritonModule, "VERSION",             idVersionClass);
         PyModule_AddObject(triton::bindings::python::tritonModule, "ast",                 triton::bindings::python::astModule);
@@ -7,11 +7,16 @@
 
 #ifdef TRITON_PYTHON_BINDINGS
 
+#include <unordered_map>
+
 #include <api.hpp>
 #include <ast.hpp>
+#include <astPattern.hpp>
+#include <astTraversal.hpp>
 #include <exceptions.hpp>
 #include <pythonObjects.hpp>
 #include <pythonUtils.hpp>
+#include <pythonXFunctions.hpp>
 
 
 
@@ -238,6 +243,10 @@ a > b             | (bvugt a b)
 \section ast_py_api Python API - Methods of the ast module
 <hr>
 
+- <b>\ref py_AstNode_page array(integer indexSize, string name)</b><br>
+Creates an `array` node, an array of bytes indexed by bitvectors of `indexSize` bits.<br>
+e.g: `name` declared as `(Array (_ BitVec indexSize) (_ BitVec 8))`.
+
 - <b>\ref py_AstNode_page assert_(\ref py_AstNode_page expr1)</b><br>
 Creates an `assert` node.<br>
 e.g: `(assert expr1)`.
@@ -413,10 +422,34 @@ e.g: `(not expr)`.
 Creates a `lor` node (logical OR).<br>
 e.g: `(or expr1 expr2)`.
 
+- <b>dict match(\ref py_AstNode_page node, string pattern)</b><br>
+Matches a node against a pattern natively and returns the nodes bound to the identifiers of the pattern as a dict
+{string name : \ref py_AstNode_page node}, or None if the node does not match. A pattern is written with the names of
+the functions of this module: `name(p1, p2, ...)` matches a node of this kind whose children match `p1`, `p2`, ... in order,
+an identifier matches any node (all its occurrences must match equal nodes), `_` matches any node and an integer matches a
+decimal or bitvector node of this value. References are followed when the pattern expects another kind of node.
+Patterns are parsed once and cached.<br>
+e.g: `match(node, "bvxor(x, x)")`, `match(node, "bvadd(x, bv(0, _))")`.
+
+- <b>\ref py_LazySequence_page nodes(\ref py_AstNode_page node, bool unroll=False, bool postOrder=True)</b><br>
+Walks an AST natively and returns its unique nodes, children before parents if `postOrder` is true. With `unroll`, the
+ASTs of the referenced symbolic expressions are walked as well.
+
 - <b>\ref py_AstNode_page reference(integer exprId)</b><br>
 Creates a reference node (SSA-based).<br>
 e.g: `ref!123`.
 
+- <b>\ref py_LazySequence_page search(\ref py_AstNode_page node, string pattern, bool unroll=False)</b><br>
+Returns the unique nodes of an AST which match a pattern (see match()), children before parents.
+
+- <b>\ref py_AstNode_page select(\ref py_AstNode_page array, \ref py_AstNode_page index)</b><br>
+Creates a `select` node, the byte of an array at an index.<br>
+e.g: `(select array index)`.
+
+- <b>\ref py_AstNode_page store(\ref py_AstNode_page array, \ref py_AstNode_page index, \ref py_AstNode_page value)</b><br>
+Creates a `store` node, an array where the byte at an index is replaced by an 8-bit value.<br>
+e.g: `(store array index value)`.
+
 - <b>\ref py_AstNode_page string(string s)</b><br>
 Creates a `string` node.
 
@@ -424,9 +457,17 @@ Creates a `string` node.
 Creates a `sx` node (sign extend).<br>
 e.g: `((_ sign_extend sizeExt) expr1)`.
 
+- <b>\ref py_AstNode_page vadd(integer lane, \ref py_AstNode_page expr1, \ref py_AstNode_page expr2)</b><br>
+Creates a `vadd` node, the lane-wise addition of two vectors of lanes of `lane` bits.<br>
+e.g: `(vadd lane expr1 expr2)`.
+
 - <b>\ref py_AstNode_page variable(\ref py_SymbolicVariable_page symVar)</b><br>
 Creates a `variable` node.
 
+- <b>\ref py_AstNode_page veq(integer lane, \ref py_AstNode_page expr1, \ref py_AstNode_page expr2)</b><br>
+Creates a `veq` node, the lane-wise comparison of two vectors of lanes of `lane` bits. The equal lanes are all ones, the others zeros.<br>
+e.g: `(veq lane expr1 expr2)`.
+
 - <b>\ref py_AstNode_page zx(integer sizeExt, \ref py_AstNode_page expr1)</b><br>
 Creates a `zx` node (zero extend).<br>
 e.g: `((_ zero_extend sizeExt) expr1)`.
@@ -439,6 +480,46 @@ namespace triton {
   namespace bindings {
     namespace python {
 
+      /* The patterns parsed, by pattern */
+      static std::unordered_map<std::string, triton::ast::AstPattern> astPatterns;
+
+
+      /* Returns the parsed pattern of a string, parsed on its first use */
+      static const triton::ast::AstPattern& getAstPattern(const std::string& pattern) {
+        auto it = astPatterns.find(pattern);
+        if (it != astPatterns.end())
+          return it->second;
+
+        /* Patterns are usually a handful of constants, the cache is bounded anyway */
+        if (astPatterns.size() >= 0x1000)
+          astPatterns.clear();
+
+        return astPatterns.insert(std::make_pair(pattern, triton::ast::AstPattern(pattern))).first->second;
+      }
+
+
+
+      static PyObject* ast_array(PyObject* self, PyObject* args) {
+        PyObject* op1 = nullptr;
+        PyObject* op2 = nullptr;
+
+        /* Extract arguments */
+        PyArgs_Unpack(args, &op1, &op2);
+
+        if (op1 == nullptr || (!PyLong_Check(op1) && !PyInt_Check(op1)))
+          return PyErr_Format(PyExc_TypeError, "array(): expected an integer as first argument");
+
+        if (op2 == nullptr || !PyString_Check(op2))
+          return PyErr_Format(PyExc_TypeError, "array(): expected a string as second argument");
+
+        try {
+          return PyAstNode(triton::ast::array(PyLong_AsUint32(op1), PyString_AsString(op2)));
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
 
       static PyObject* ast_assert(PyObject* self, PyObject* expr) {
         if (!PyAstNode_Check(expr))
@@ -458,7 +539,7 @@ namespace triton {
         PyObject* op2 = nullptr;
 
         /* Extract arguments */
-        PyArg_ParseTuple(args, "|OO", &op1, &op2);
+        PyArgs_Unpack(args, &op1, &op2);
 
         if (op1 == nullptr || (!PyLong_Check(op1) && !PyInt_Check(op1)))
           return PyErr_Format(PyExc_TypeError, "bv(): expected an integer as first argument");
@@ -480,7 +561,7 @@ namespace triton {
         PyObject* op2 = nullptr;
 
         /* Extract arguments */
-        PyArg_ParseTuple(args, "|OO", &op1, &op2);
+        PyArgs_Unpack(args, &op1, &op2);
 
         if (op1 == nullptr || !PyAstNode_Check(op1))
           return PyErr_Format(PyExc_TypeError, "bvadd(): expected a AstNode as first argument");
@@ -502,7 +583,7 @@ namespace triton {
         PyObject* op2 = nullptr;
 
         /* Extract arguments */
-        PyArg_ParseTuple(args, "|OO", &op1, &op2);
+        PyArgs_Unpack(args, &op1, &op2);
 
         if (op1 == nullptr || !PyAstNode_Check(op1))
           return PyErr_Format(PyExc_TypeError, "bvand(): expected a AstNode as first argument");
@@ -524,7 +605,7 @@ namespace triton {
         PyObject* op2 = nullptr;
 
         /* Extract arguments */
-        PyArg_ParseTuple(args, "|OO", &op1, &op2);
+        PyArgs_Unpack(args, &op1, &op2);
 
         if (op1 == nullptr || !PyAstNode_Check(op1))
           return PyErr_Format(PyExc_TypeError, "bvashr(): expected a AstNode as first argument");
@@ -569,7 +650,7 @@ namespace triton {
         PyObject* op2 = nullptr;
 
         /* Extract arguments */
-        PyArg_ParseTuple(args, "|OO", &op1, &op2);
+        PyArgs_Unpack(args, &op1, &op2);
 
         if (op1 == nullptr || !PyAstNode_Check(op1))
           return PyErr_Format(PyExc_TypeError, "bvlshr(): expected a AstNode as first argument");
@@ -591,7 +672,7 @@ namespace triton {
         PyObject* op2 = nullptr;
 
         /* Extract arguments */
-        PyArg_ParseTuple(args, "|OO", &op1, &op2);
+        PyArgs_Unpack(args, &op1, &op2);
 
         if (op1 == nullptr || !PyAstNode_Check(op1))
           return PyErr_Format(PyExc_TypeError, "bvmul(): expected a AstNode as first argument");
@@ -613,7 +694,7 @@ namespace triton {
         PyObject* op2 = nullptr;
 
         /* Extract arguments */
-        PyArg_ParseTuple(args, "|OO", &op1, &op2);
+        PyArgs_Unpack(args, &op1, &op2);
 
         if (op1 == nullptr || !PyAstNode_Check(op1))
           return PyErr_Format(PyExc_TypeError, "bvnand(): expected a AstNode as first argument");
@@ -648,7 +729,7 @@ namespace triton {
         PyObject* op2 = nullptr;
 
         /* Extract arguments */
-        PyArg_ParseTuple(args, "|OO", &op1, &op2);
+        PyArgs_Unpack(args, &op1, &op2);
 
         if (op1 == nullptr || !PyAstNode_Check(op1))
           return PyErr_Format(PyExc_TypeError, "bvnor(): expected a AstNode as first argument");
@@ -683,7 +764,7 @@ namespace triton {
         PyObject* op2 = nullptr;
 
         /* Extract arguments */
-        PyArg_ParseTuple(args, "|OO", &op1, &op2);
+        PyArgs_Unpack(args, &op1, &op2);
 
         if (op1 == nullptr || !PyAstNode_Check(op1))
           return PyErr_Format(PyExc_TypeError, "bvor(): expected a AstNode as first argument");
@@ -705,7 +786,7 @@ namespace triton {
         PyObject* op2 = nullptr;
 
         /* Extract arguments */
-        PyArg_ParseTuple(args, "|OO", &op1, &op2);
+        PyArgs_Unpack(args, &op1, &op2);
 
         if (op1 == nullptr || (!PyLong_Check(op1) && !PyInt_Check(op1)))
           return PyErr_Format(PyExc_TypeError, "bvror(): expected an integer as first argument");
@@ -727,7 +808,7 @@ namespace triton {
         PyObject* op2 = nullptr;
 
         /* Extract arguments */
-        PyArg_ParseTuple(args, "|OO", &op1, &op2);
+        PyArgs_Unpack(args, &op1, &op2);
 
         if (op1 == nullptr || (!PyLong_Check(op1) && !PyInt_Check(op1)))
           return PyErr_Format(PyExc_TypeError, "bvrol(): expected a integer as first argument");
@@ -749,7 +830,7 @@ namespace triton {
         PyObject* op2 = nullptr;
 
         /* Extract arguments */
-        PyArg_ParseTuple(args, "|OO", &op1, &op2);
+        PyArgs_Unpack(args, &op1, &op2);
 
         if (op1 == nullptr || !PyAstNode_Check(op1))
           return PyErr_Format(PyExc_TypeError, "bvsdiv(): expected a AstNode as first argument");
@@ -771,7 +852,7 @@ namespace triton {
         PyObject* op2 = nullptr;
 
         /* Extract arguments */
-        PyArg_ParseTuple(args, "|OO", &op1, &op2);
+        PyArgs_Unpack(args, &op1, &op2);
 
         if (op1 == nullptr || !PyAstNode_Check(op1))
           return PyErr_Format(PyExc_TypeError, "bvsge(): expected a AstNode as first argument");
@@ -793,7 +874,7 @@ namespace triton {
         PyObject* op2 = nullptr;
 
         /* Extract arguments */
-        PyArg_ParseTuple(args, "|OO", &op1, &op2);
+        PyArgs_Unpack(args, &op1, &op2);
 
         if (op1 == nullptr || !PyAstNode_Check(op1))
           return PyErr_Format(PyExc_TypeError, "bvsgt(): expected a AstNode as first argument");
@@ -815,7 +896,7 @@ namespace triton {
         PyObject* op2 = nullptr;
 
         /* Extract arguments */
-        PyArg_ParseTuple(args, "|OO", &op1, &op2);
+        PyArgs_Unpack(args, &op1, &op2);
 
         if (op1 == nullptr || !PyAstNode_Check(op1))
           return PyErr_Format(PyExc_TypeError, "bvshl(): expected a AstNode as first argument");
@@ -837,7 +918,7 @@ namespace triton {
         PyObject* op2 = nullptr;
 
         /* Extract arguments */
-        PyArg_ParseTuple(args, "|OO", &op1, &op2);
+        PyArgs_Unpack(args, &op1, &op2);
 
         if (op1 == nullptr || !PyAstNode_Check(op1))
           return PyErr_Format(PyExc_TypeError, "bvsle(): expected a AstNode as first argument");
@@ -859,7 +940,7 @@ namespace triton {
         PyObject* op2 = nullptr;
 
         /* Extract arguments */
-        PyArg_ParseTuple(args, "|OO", &op1, &op2);
+        PyArgs_Unpack(args, &op1, &op2);
 
         if (op1 == nullptr || !PyAstNode_Check(op1))
           return PyErr_Format(PyExc_TypeError, "bvslt(): expected a AstNode as first argument");
@@ -881,7 +962,7 @@ namespace triton {
         PyObject* op2 = nullptr;
 
         /* Extract arguments */
-        PyArg_ParseTuple(args, "|OO", &op1, &op2);
+        PyArgs_Unpack(args, &op1, &op2);
 
         if (op1 == nullptr || !PyAstNode_Check(op1))
           return PyErr_Format(PyExc_TypeError, "bvsmod(): expected a AstNode as first argument");
@@ -903,7 +984,7 @@ namespace triton {
         PyObject* op2 = nullptr;
 
         /* Extract arguments */
-        PyArg_ParseTuple(args, "|OO", &op1, &op2);
+        PyArgs_Unpack(args, &op1, &op2);
 
         if (op1 == nullptr || !PyAstNode_Check(op1))
           return PyErr_Format(PyExc_TypeError, "bvsrem(): expected a AstNode as first argument");
@@ -925,7 +1006,7 @@ namespace triton {
         PyObject* op2 = nullptr;
 
         /* Extract arguments */
-        PyArg_ParseTuple(args, "|OO", &op1, &op2);
+        PyArgs_Unpack(args, &op1, &op2);
 
         if (op1 == nullptr || !PyAstNode_Check(op1))
           return PyErr_Format(PyExc_TypeError, "bvsub(): expected a AstNode as first argument");
@@ -957,7 +1038,7 @@ namespace triton {
         PyObject* op2 = nullptr;
 
         /* Extract arguments */
-        PyArg_ParseTuple(args, "|OO", &op1, &op2);
+        PyArgs_Unpack(args, &op1, &op2);
 
         if (op1 == nullptr || !PyAstNode_Check(op1))
           return PyErr_Format(PyExc_TypeError, "bvudiv(): expected a AstNode as first argument");
@@ -979,7 +1060,7 @@ namespace triton {
         PyObject* op2 = nullptr;
 
         /* Extract arguments */
-        PyArg_ParseTuple(args, "|OO", &op1, &op2);
+        PyArgs_Unpack(args, &op1, &op2);
 
         if (op1 == nullptr || !PyAstNode_Check(op1))
           return PyErr_Format(PyExc_TypeError, "bvuge(): expected a AstNode as first argument");
@@ -1001,7 +1082,7 @@ namespace triton {
         PyObject* op2 = nullptr;
 
         /* Extract arguments */
-        PyArg_ParseTuple(args, "|OO", &op1, &op2);
+        PyArgs_Unpack(args, &op1, &op2);
 
         if (op1 == nullptr || !PyAstNode_Check(op1))
           return PyErr_Format(PyExc_TypeError, "bvugt(): expected a AstNode as first argument");
@@ -1023,7 +1104,7 @@ namespace triton {
         PyObject* op2 = nullptr;
 
         /* Extract arguments */
-        PyArg_ParseTuple(args, "|OO", &op1, &op2);
+        PyArgs_Unpack(args, &op1, &op2);
 
         if (op1 == nullptr || !PyAstNode_Check(op1))
           return PyErr_Format(PyExc_TypeError, "bvule(): expected a AstNode as first argument");
@@ -1045,7 +1126,7 @@ namespace triton {
         PyObject* op2 = nullptr;
 
         /* Extract arguments */
-        PyArg_ParseTuple(args, "|OO", &op1, &op2);
+        PyArgs_Unpack(args, &op1, &op2);
 
         if (op1 == nullptr || !PyAstNode_Check(op1))
           return PyErr_Format(PyExc_TypeError, "bvult(): expected a AstNode as first argument");
@@ -1067,7 +1148,7 @@ namespace triton {
         PyObject* op2 = nullptr;
 
         /* Extract arguments */
-        PyArg_ParseTuple(args, "|OO", &op1, &op2);
+        PyArgs_Unpack(args, &op1, &op2);
 
         if (op1 == nullptr || !PyAstNode_Check(op1))
           return PyErr_Format(PyExc_TypeError, "bvurem(): expected a AstNode as first argument");
@@ -1089,7 +1170,7 @@ namespace triton {
         PyObject* op2 = nullptr;
 
         /* Extract arguments */
-        PyArg_ParseTuple(args, "|OO", &op1, &op2);
+        PyArgs_Unpack(args, &op1, &op2);
 
         if (op1 == nullptr || !PyAstNode_Check(op1))
           return PyErr_Format(PyExc_TypeError, "bvxnor(): expected a AstNode as first argument");
@@ -1111,7 +1192,7 @@ namespace triton {
         PyObject* op2 = nullptr;
 
         /* Extract arguments */
-        PyArg_ParseTuple(args, "|OO", &op1, &op2);
+        PyArgs_Unpack(args, &op1, &op2);
 
         if (op1 == nullptr || !PyAstNode_Check(op1))
           return PyErr_Format(PyExc_TypeError, "bvxor(): expected a AstNode as first argument");
@@ -1133,7 +1214,7 @@ namespace triton {
         PyObject* op2 = nullptr;
 
         /* Extract arguments */
-        PyArg_ParseTuple(args, "|OO", &op1, &op2);
+        PyArgs_Unpack(args, &op1, &op2);
 
         if (op1 == nullptr || !PyAstNode_Check(op1))
           return PyErr_Format(PyExc_TypeError, "distinct(): expected a AstNode as first argument");
@@ -1218,7 +1299,7 @@ namespace triton {
         PyObject* op2 = nullptr;
 
         /* Extract arguments */
-        PyArg_ParseTuple(args, "|OO", &op1, &op2);
+        PyArgs_Unpack(args, &op1, &op2);
 
         if (op1 == nullptr || !PyAstNode_Check(op1))
           return PyErr_Format(PyExc_TypeError, "equal(): expected a AstNode as first argument");
@@ -1241,7 +1322,7 @@ namespace triton {
         PyObject* op3 = nullptr;
 
         /* Extract arguments */
-        PyArg_ParseTuple(args, "|OOO", &op1, &op2, &op3);
+        PyArgs_Unpack(args, &op1, &op2, &op3);
 
         if (op1 == nullptr || (!PyLong_Check(op1) && !PyInt_Check(op1)))
           return PyErr_Format(PyExc_TypeError, "extract(): expected an integer as first argument");
@@ -1267,7 +1348,7 @@ namespace triton {
         PyObject* op3 = nullptr;
 
         /* Extract arguments */
-        PyArg_ParseTuple(args, "|OOO", &op1, &op2, &op3);
+        PyArgs_Unpack(args, &op1, &op2, &op3);
 
         if (op1 == nullptr || !PyAstNode_Check(op1))
           return PyErr_Format(PyExc_TypeError, "ite(): expected a AstNode as first argument");
@@ -1292,7 +1373,7 @@ namespace triton {
         PyObject* op2 = nullptr;
 
         /* Extract arguments */
-        PyArg_ParseTuple(args, "|OO", &op1, &op2);
+        PyArgs_Unpack(args, &op1, &op2);
 
         if (op1 == nullptr || !PyAstNode_Check(op1))
           return PyErr_Format(PyExc_TypeError, "land(): expected a AstNode as first argument");
@@ -1315,7 +1396,7 @@ namespace triton {
         PyObject* op3 = nullptr;
 
         /* Extract arguments */
-        PyArg_ParseTuple(args, "|OOO", &op1, &op2, &op3);
+        PyArgs_Unpack(args, &op1, &op2, &op3);
 
         if (op1 == nullptr || !PyString_Check(op1))
           return PyErr_Format(PyExc_TypeError, "let(): expected a string as first argument");
@@ -1353,7 +1434,7 @@ namespace triton {
         PyObject* op2 = nullptr;
 
         /* Extract arguments */
-        PyArg_ParseTuple(args, "|OO", &op1, &op2);
+        PyArgs_Unpack(args, &op1, &op2);
 
         if (op1 == nullptr || !PyAstNode_Check(op1))
           return PyErr_Format(PyExc_TypeError, "lor(): expected a AstNode as first argument");
@@ -1370,11 +1451,74 @@ namespace triton {
       }
 
 
+      static PyObject* ast_match(PyObject* self, PyObject* args) {
+        std::map<std::string, triton::ast::AbstractNode*> bindings;
+        PyObject* node    = nullptr;
+        PyObject* pattern = nullptr;
+
+        /* Extract arguments */
+        PyArg_ParseTuple(args, "|OO", &node, &pattern);
+
+        if (node == nullptr || !PyAstNode_Check(node))
+          return PyErr_Format(PyExc_TypeError, "match(): expected a AstNode as first argument");
+
+        if (pattern == nullptr || !PyString_Check(pattern))
+          return PyErr_Format(PyExc_TypeError, "match(): expected a string as second argument");
+
+        try {
+          if (!getAstPattern(PyString_AsString(pattern)).match(PyAstNode_AsAstNode(node), bindings)) {
+            Py_INCREF(Py_None);
+            return Py_None;
+          }
+
+          PyObject* ret = xPyDict_New();
+          for (auto it = bindings.begin(); it != bindings.end(); it++) {
+            PyObject* value = PyAstNode(it->second);
+            PyDict_SetItemString(ret, it->first.c_str(), value);
+            Py_DECREF(value);
+          }
+
+          return ret;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* ast_nodes(PyObject* self, PyObject* args) {
+        std::vector<triton::ast::AbstractNode*> nodes;
+        PyObject* node      = nullptr;
+        PyObject* unroll    = nullptr;
+        PyObject* postOrder = nullptr;
+
+        /* Extract arguments */
+        PyArg_ParseTuple(args, "|OOO", &node, &unroll, &postOrder);
+
+        if (node == nullptr || !PyAstNode_Check(node))
+          return PyErr_Format(PyExc_TypeError, "nodes(): expected a AstNode as first argument");
+
+        if (unroll != nullptr && !PyBool_Check(unroll))
+          return PyErr_Format(PyExc_TypeError, "nodes(): expected a boolean as second argument");
+
+        if (postOrder != nullptr && !PyBool_Check(postOrder))
+          return PyErr_Format(PyExc_TypeError, "nodes(): expected a boolean as third argument");
+
+        try {
+          triton::ast::nodesExtraction(nodes, PyAstNode_AsAstNode(node), unroll == Py_True, postOrder != Py_False);
+          return PyLazySequence(nodes);
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
       static PyObject* ast_reference(PyObject* self, PyObject* exprId) {
         if (!PyInt_Check(exprId) && !PyLong_Check(exprId))
           return PyErr_Format(PyExc_TypeError, "reference(): expected an integer as argument");
 
-        if (!triton::api.isSymbolicExpressionIdExists(PyLong_AsUsize(exprId)))
+        if (!triton::getCurrentApi().isSymbolicExpressionIdExists(PyLong_AsUsize(exprId)))
           return PyErr_Format(PyExc_TypeError, "reference(): symbolic expression id not found");
 
         try {
@@ -1386,6 +1530,82 @@ namespace triton {
       }
 
 
+      static PyObject* ast_search(PyObject* self, PyObject* args) {
+        std::vector<triton::ast::AbstractNode*> nodes;
+        PyObject* node    = nullptr;
+        PyObject* pattern = nullptr;
+        PyObject* unroll  = nullptr;
+
+        /* Extract arguments */
+        PyArg_ParseTuple(args, "|OOO", &node, &pattern, &unroll);
+
+        if (node == nullptr || !PyAstNode_Check(node))
+          return PyErr_Format(PyExc_TypeError, "search(): expected a AstNode as first argument");
+
+        if (pattern == nullptr || !PyString_Check(pattern))
+          return PyErr_Format(PyExc_TypeError, "search(): expected a string as second argument");
+
+        if (unroll != nullptr && !PyBool_Check(unroll))
+          return PyErr_Format(PyExc_TypeError, "search(): expected a boolean as third argument");
+
+        try {
+          getAstPattern(PyString_AsString(pattern)).search(nodes, PyAstNode_AsAstNode(node), unroll == Py_True);
+          return PyLazySequence(nodes);
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* ast_select(PyObject* self, PyObject* args) {
+        PyObject* op1 = nullptr;
+        PyObject* op2 = nullptr;
+
+        /* Extract arguments */
+        PyArgs_Unpack(args, &op1, &op2);
+
+        if (op1 == nullptr || !PyAstNode_Check(op1))
+          return PyErr_Format(PyExc_TypeError, "select(): expected a AstNode as first argument");
+
+        if (op2 == nullptr || !PyAstNode_Check(op2))
+          return PyErr_Format(PyExc_TypeError, "select(): expected a AstNode as second argument");
+
+        try {
+          return PyAstNode(triton::ast::select(PyAstNode_AsAstNode(op1), PyAstNode_AsAstNode(op2)));
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* ast_store(PyObject* self, PyObject* args) {
+        PyObject* op1 = nullptr;
+        PyObject* op2 = nullptr;
+        PyObject* op3 = nullptr;
+
+        /* Extract arguments */
+        PyArgs_Unpack(args, &op1, &op2, &op3);
+
+        if (op1 == nullptr || !PyAstNode_Check(op1))
+          return PyErr_Format(PyExc_TypeError, "store(): expected a AstNode as first argument");
+
+        if (op2 == nullptr || !PyAstNode_Check(op2))
+          return PyErr_Format(PyExc_TypeError, "store(): expected a AstNode as second argument");
+
+        if (op3 == nullptr || !PyAstNode_Check(op3))
+          return PyErr_Format(PyExc_TypeError, "store(): expected a AstNode as third argument");
+
+        try {
+          return PyAstNode(triton::ast::store(PyAstNode_AsAstNode(op1), PyAstNode_AsAstNode(op2), PyAstNode_AsAstNode(op3)));
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
       static PyObject* ast_string(PyObject* self, PyObject* expr) {
         if (!PyString_Check(expr))
           return PyErr_Format(PyExc_TypeError, "string(): expected a string as first argument");
@@ -1404,7 +1624,7 @@ namespace triton {
         PyObject* op2 = nullptr;
 
         /* Extract arguments */
-        PyArg_ParseTuple(args, "|OO", &op1, &op2);
+        PyArgs_Unpack(args, &op1, &op2);
 
         if (op1 == nullptr || (!PyLong_Check(op1) && !PyInt_Check(op1)))
           return PyErr_Format(PyExc_TypeError, "sx(): expected an integer as first argument");
@@ -1421,6 +1641,32 @@ namespace triton {
       }
 
 
+      static PyObject* ast_vadd(PyObject* self, PyObject* args) {
+        PyObject* op1 = nullptr;
+        PyObject* op2 = nullptr;
+        PyObject* op3 = nullptr;
+
+        /* Extract arguments */
+        PyArgs_Unpack(args, &op1, &op2, &op3);
+
+        if (op1 == nullptr || (!PyLong_Check(op1) && !PyInt_Check(op1)))
+          return PyErr_Format(PyExc_TypeError, "vadd(): expected an integer as first argument");
+
+        if (op2 == nullptr || !PyAstNode_Check(op2))
+          return PyErr_Format(PyExc_TypeError, "vadd(): expected a AstNode as second argument");
+
+        if (op3 == nullptr || !PyAstNode_Check(op3))
+          return PyErr_Format(PyExc_TypeError, "vadd(): expected a AstNode as third argument");
+
+        try {
+          return PyAstNode(triton::ast::vadd(PyLong_AsUint32(op1), PyAstNode_AsAstNode(op2), PyAstNode_AsAstNode(op3)));
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
       static PyObject* ast_variable(PyObject* self, PyObject* symVar) {
         if (!PySymbolicVariable_Check(symVar))
           return PyErr_Format(PyExc_TypeError, "variable(): expected a SymbolicVariable as first argument");
@@ -1434,12 +1680,38 @@ namespace triton {
       }
 
 
+      static PyObject* ast_veq(PyObject* self, PyObject* args) {
+        PyObject* op1 = nullptr;
+        PyObject* op2 = nullptr;
+        PyObject* op3 = nullptr;
+
+        /* Extract arguments */
+        PyArgs_Unpack(args, &op1, &op2, &op3);
+
+        if (op1 == nullptr || (!PyLong_Check(op1) && !PyInt_Check(op1)))
+          return PyErr_Format(PyExc_TypeError, "veq(): expected an integer as first argument");
+
+        if (op2 == nullptr || !PyAstNode_Check(op2))
+          return PyErr_Format(PyExc_TypeError, "veq(): expected a AstNode as second argument");
+
+        if (op3 == nullptr || !PyAstNode_Check(op3))
+          return PyErr_Format(PyExc_TypeError, "veq(): expected a AstNode as third argument");
+
+        try {
+          return PyAstNode(triton::ast::veq(PyLong_AsUint32(op1), PyAstNode_AsAstNode(op2), PyAstNode_AsAstNode(op3)));
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
       static PyObject* ast_zx(PyObject* self, PyObject* args) {
         PyObject* op1 = nullptr;
         PyObject* op2 = nullptr;
 
         /* Extract arguments */
-        PyArg_ParseTuple(args, "|OO", &op1, &op2);
+        PyArgs_Unpack(args, &op1, &op2);
 
         if (op1 == nullptr || (!PyLong_Check(op1) && !PyInt_Check(op1)))
           return PyErr_Format(PyExc_TypeError, "zx(): expected an integer as first argument");
@@ -1457,6 +1729,7 @@ namespace triton {
 
 
       PyMethodDef astCallbacks[] = {
+        {"array",       (PyCFunction)ast_array,      METH_VARARGS,     ""},
         {"assert_",     (PyCFunction)ast_assert,     METH_O,           ""},
         {"bv",          (PyCFunction)ast_bv,         METH_VARARGS,     ""},
         {"bvadd",       (PyCFunction)ast_bvadd,      METH_VARARGS,     ""},
@@ -1502,10 +1775,17 @@ namespace triton {
         {"let",         (PyCFunction)ast_let,        METH_VARARGS,     ""},
         {"lnot",        (PyCFunction)ast_lnot,       METH_O,           ""},
         {"lor",         (PyCFunction)ast_lor,        METH_VARARGS,     ""},
+        {"match",       (PyCFunction)ast_match,      METH_VARARGS,     ""},
+        {"nodes",       (PyCFunction)ast_nodes,      METH_VARARGS,     ""},
         {"reference",   (PyCFunction)ast_reference,  METH_O,           ""},
+        {"search",      (PyCFunction)ast_search,     METH_VARARGS,     ""},
+        {"select",      (PyCFunction)ast_select,     METH_VARARGS,     ""},
+        {"store",       (PyCFunction)ast_store,      METH_VARARGS,     ""},
         {"string",      (PyCFunction)ast_string,     METH_O,           ""},
         {"sx",          (PyCFunction)ast_sx,         METH_VARARGS,     ""},
+        {"vadd",        (PyCFunction)ast_vadd,       METH_VARARGS,     ""},
         {"variable",    (PyCFunction)ast_variable,   METH_O,           ""},
+        {"veq",         (PyCFunction)ast_veq,        METH_VARARGS,     ""},
         {"zx",          (PyCFunction)ast_zx,         METH_VARARGS,     ""},
         {nullptr,       nullptr,                     0,                nullptr}
       };
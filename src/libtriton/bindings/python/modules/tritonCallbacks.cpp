@@ -7,10 +7,15 @@
 
 #ifdef TRITON_PYTHON_BINDINGS
 
+#include <set>
+#include <sstream>
+
 #include <api.hpp>
 #include <exceptions.hpp>
 #include <bitsVector.hpp>
+#include <coverageDriver.hpp>
 #include <cpuSize.hpp>
+#include <explorer.hpp>
 #include <immediate.hpp>
 #include <memoryAccess.hpp>
 #include <pythonBindings.hpp>
@@ -18,6 +23,7 @@
 #include <pythonUtils.hpp>
 #include <pythonXFunctions.hpp>
 #include <register.hpp>
+#include <x86Specifications.hpp>
 
 
 
@@ -43,6 +49,11 @@ By default, the libTriton contains Python bindings and can be loaded with a clas
 
 If you want to use the libTriton without Python bindings, recompile the project with the `cmake` flag `-DTRITON_PYTHON_BINDINGS=no`.
 
+The long-running calls (evaluateAstViaZ3(), getModel(), getModels(), processing() and simplify()) release the GIL when
+no Python callback is defined, so other Python threads run meanwhile. Those threads must not call the triton module
+until the call returns: the API is used by one thread at a time. The triton module uses the API bound to the calling
+thread, which is `triton::api` unless the thread is bound to another one (e.g. by the pintool, cf: analyzeAllThreads()).
+
 \subsection triton_py_api_classes Classes
 
 - \ref py_AstNode_page
@@ -56,6 +67,7 @@ If you want to use the libTriton without Python bindings, recompile the project
 - \ref py_ElfSymbolTable_page
 - \ref py_Immediate_page
 - \ref py_Instruction_page
+- \ref py_LazySequence_page
 - \ref py_MemoryAccess_page
 - \ref py_PathConstraint_page
 - \ref py_Pe_page
@@ -78,9 +90,35 @@ If you want to use the libTriton without Python bindings, recompile the project
 
 \subsection triton_py_api_methods Methods
 
+- <b>void addBatchedCallback(function cb, \ref py_CALLBACK_page kind, integer size)</b><br>
+Adds a batched callback. Events of `kind` are recorded natively and delivered to `cb` as a single list once
+`size` events are pending, at the end of each basic block (after the processing of a control flow instruction) or
+on flushCallbacks(). Memory events are `(address, size)` tuples and register events are \ref py_Register_page.
+Batched callbacks only observe events: `GET_CONCRETE_*` callbacks which must provide values, and `SYMBOLIC_SIMPLIFICATION`
+callbacks, must be added with addCallback(). They are removed with removeCallback().
+
 - <b>void addCallback(function cb, \ref py_CALLBACK_page kind)</b><br>
 Adds a callback at specific internal points. Your callback will be called each time the point is reached.
 
+- <b>integer addFunctionSummaries(\ref py_Elf_page or \ref py_Pe_page binary)</b><br>
+Summarizes the routines (`memcpy`, `memmove`, `memset`, `strcmp` and `strlen`) defined or imported by a binary. run() applies the
+effect of a summarized routine natively and returns to its caller instead of emulating it. An imported routine is summarized at a stub
+address which is written into the slot of its relocation. Returns the number of routines summarized. Only the System V x86-64
+calling convention is supported.
+
+- <b>void addFunctionSummary(integer addr, string name)</b><br>
+Summarizes the routine `name` (e.g. `strlen`) at `addr`. See addFunctionSummaries().
+
+- <b>void addLearnedFunctionSummary(integer addr, integer argc)</b><br>
+Learns the summaries of the pure function at `addr`, which takes `argc` (at most 6) register arguments. run() executes its first call
+with its arguments and the values it loads replaced by symbolic variables, and records its return value and its path constraints over
+them. The next calls which follow a learned path return the instance of its return value over their arguments instead of being executed.
+A call which writes outside of its frame, makes a syscall or reaches a hook is not learned and the function is executed from then on.
+
+- <b>void addSymbolicRegion(integer start, integer end)</b><br>
+Adds the addresses `[start:end)` to the symbolic regions. Once a region is defined, only the instructions inside the regions are
+executed symbolically, the other ones read the registers and the memory as constants and concretize what they write.
+
 - <b>void assignSymbolicExpressionToMemory(\ref py_SymbolicExpression_page symExpr, \ref py_MemoryAccess_page mem)</b><br>
 Assigns a \ref py_SymbolicExpression_page to a \ref py_MemoryAccess_page area. **Be careful**, use this function only if you know what you are doing.
 The symbolic expression (`symExpr`) must be aligned to the memory access.
@@ -103,9 +141,39 @@ Builds a symbolic memory cell from a \ref py_MemoryAccess_page with the SSA form
 - <b>\ref py_AstNode_page buildSymbolicRegister(\ref py_REG_page reg)</b><br>
 Builds a symbolic register from a \ref py_REG_page with the SSA form.
 
+- <b>integer checkpoint(void)</b><br>
+Starts a step of the undo journal and returns its id. The state is rewound to the checkpoint with rewindTo(). Raises an
+exception if the undo journal is disabled. See enableUndoJournal().
+
+- <b>void clearExpressionProfile(void)</b><br>
+Clears the profiles of the expressions. See getExpressionProfile().
+
+- <b>void clearOpcodeProfile(void)</b><br>
+Clears the profiles of the opcodes. See getOpcodeProfile().
+
 - <b>void clearPathConstraints(void)</b><br>
 Clears the logical conjunction vector of path constraints.
 
+- <b>void clearPerfCounters(void)</b><br>
+Resets the hardware counters accumulated with `MODE.PERF_COUNTERS`.
+
+- <b>void clearPointerPolicies(void)</b><br>
+Removes the pointer policies of the instruction addresses and the solver bounds cached for `SYMEXPR.POINTER_SOLVER`. The default policy
+is kept. See setPointerPolicy().
+
+- <b>void clearQueryCache(void)</b><br>
+Clears the query cache of the solver, its recent models and their statistics.
+
+- <b>void clearSymbolicRegions(void)</b><br>
+Removes every symbolic region, every instruction is executed symbolically again.
+
+- <b>void clearTraceEvents(void)</b><br>
+Removes the spans recorded with `MODE.TRACE_EVENTS`.
+
+- <b>void collectUnreachableExpressions(void)</b><br>
+Removes the symbolic expressions which are not reachable anymore from registers, memory, path constraints or pinned expressions, and
+frees their AST nodes. With `MODE.ONLY_LIVE_EXPRESSIONS`, this is done automatically during the processing.
+
 - <b>void concretizeAllMemory(void)</b><br>
 Concretizes all symbolic memory references.
 
@@ -124,6 +192,11 @@ Concretizes a specific symbolic register reference.
 - <b>\ref py_SymbolicVariable_page convertExpressionToSymbolicVariable(integer symExprId, integer symVarSize, string comment="")</b><br>
 Converts a symbolic expression to a symbolic variable. `symVarSize` must be in bits. This function returns the new symbolic variable created.
 
+- <b>[\ref py_SymbolicVariable_page, ...] convertMemoryAreaToSymbolicVariables(integer baseAddr, integer size, string comment="", integer wordSize=1)</b><br>
+Converts each word of `wordSize` bytes of a memory area to a symbolic variable, in a single call. `size` must be a multiple of
+`wordSize`, which is a power of two up to 64 bytes. The AST nodes of the variables are reserved at once and their names are only
+built when they are asked. This function returns the list of the new symbolic variables, one per word.
+
 - <b>\ref py_SymbolicVariable_page convertMemoryToSymbolicVariable(\ref py_MemoryAccess_page mem, string comment="")</b><br>
 Converts a symbolic memory expression to a symbolic variable. This function returns the new symbolic variable created.
 
@@ -148,23 +221,109 @@ Returns the new symbolic register expression and links this expression to the in
 - <b>\ref py_SymbolicExpression_page createSymbolicVolatileExpression (\ref py_Instruction_page inst, \ref py_AstNode_page node, string comment="")</b><br>
 Returns the new symbolic volatile expression and links this expression to the instruction.
 
+- <b>[\ref py_AstNode_page, ...] deserializeAsts(bytes data)</b><br>
+Reads ASTs written by serializeAsts().
+
+- <b>void deserializeSymbolicState(bytes data)</b><br>
+Reads a symbolic state written by serializeSymbolicState() and adds it to the current one. Symbolic variables and expressions
+get new ids.
+
 - <b>void disassembly(\ref py_Instruction_page inst)</b><br>
 Disassembles the instruction and setup operands. You must define an architecture before.
 
+- <b>string dumpExpressionProfile(integer count=0, bool json=False)</b><br>
+Returns the profiles of the `count` instruction addresses (all of them if 0) which allocated the most AST nodes, as CSV, or as JSON
+if `json` is True. It can be called at any time during a run. See getExpressionProfile().
+
+- <b>string dumpOpcodeProfile(bool json=False)</b><br>
+Returns the profiles of the opcodes as CSV (`opcode,mnemonic,calls,cycles,nodes,expressions`), or as a JSON list if `json` is true,
+the most expensive opcodes first. See getOpcodeProfile().
+
+- <b>string dumpTraceEvents(void)</b><br>
+Returns the spans recorded with `MODE.TRACE_EVENTS` as a Chrome trace-event JSON document, which can be loaded by
+chrome://tracing or Perfetto.
+
+- <b>integer emulate(integer start, [integer, ...] stopAddresses=[], integer maxInsns=0)</b><br>
+Emulates the code from `start`, following the concrete program counter. Instructions are fetched from the concrete memory.
+The emulation stops when the program counter is 0 or one of `stopAddresses`, after a `hlt`, or once `maxInsns` instructions
+are processed if `maxInsns` is not 0. Returns the number of instructions processed.
+
 - <b>void enableMode(\ref py_MODE_page mode, bool flag)</b><br>
 Enables or disables a specific mode.
 
 - <b>void enableSymbolicEngine(bool flag)</b><br>
 Enables or disables the symbolic execution engine.
 
+- <b>void enableSyscallEmulation(bool flag)</b><br>
+Enables or disables the emulation of the Linux x86-64 syscalls by `run()`. Files are read from and written to a virtual
+file system (see `setVirtualFile()`), `/dev/stdin`, `/dev/stdout` and `/dev/stderr` being the descriptors 0, 1 and 2.
+The bytes returned by `read` are symbolized. An `exit` stops the emulation. Implemented: read, write, open, openat, close,
+lseek, mmap, munmap, brk, exit and exit_group, the other syscalls return `-ENOSYS`.
+
 - <b>void enableTaintEngine(bool flag)</b><br>
 Enables or disables the taint engine.
 
+- <b>void enableUndoJournal(bool flag)</b><br>
+Enables or disables the undo journal. While enabled, every instruction processed records the previous values of what it
+writes (concrete registers and memory, symbolic references, taint) so it can be reverted by stepBack(). The garbage collection
+of the symbolic expressions is suspended while the journal records. Disabling the journal drops the steps recorded, as does
+restore(). resetEngines() disables the journal.
+
+- <b>integer evaluateAst(\ref py_AstNode_page node, dict assignment={})</b><br>
+Evaluates an AST without Z3, with the values of `assignment` (symbolic variable id -> integer or \ref py_SolverModel_page,
+as returned by getModel()). Other symbolic variables keep their concrete value. The AST is compiled into native instructions,
+ASTs with let bindings are not supported.
+
+- <b>[integer, ...] evaluateAst(\ref py_AstNode_page node, [dict, ...] assignments)</b><br>
+Evaluates an AST under every assignment of the list and returns the list of the values. The AST is compiled once and, if
+every node fits in 64 bits, the assignments are evaluated by batches with native words (see `AstEvaluator`), which suits the
+brute-forcing of a formula over many inputs far better than a call per input.
+
 - <b>integer evaluateAstViaZ3(\ref py_AstNode_page node)</b><br>
 Evaluates an AST via Z3 and returns the symbolic value.
 
+- <b>[dict, ...] explore(integer entry, \ref py_EXPLORATION_page strategy=EXPLORATION.DFS, dict hooks={}, integer maxStates=0, integer maxInsns=0)</b><br>
+Explores the paths of the code from `entry`. Every state is emulated with run() (using `hooks` and `maxInsns`) from the current
+state, then the symbolic branches of its path not reached yet are solved and spawn new states. The states are taken according to
+`strategy`, until there is no state left or once `maxStates` states are explored if `maxStates` is not 0. The current state is
+restored at the end. Returns the inputs of the states explored as dicts of symbolic variable id to integer.
+
+- <b>[dict, ...] exploreCoordinator(string address, integer entry, \ref py_EXPLORATION_page strategy=EXPLORATION.DFS, integer maxStates=0)</b><br>
+Coordinates an exploration distributed to the workers which connect to `address` (`unix:<path>` or `<host>:<port>`), see \ref exploreWorker.
+The coordinator holds the states to explore, taken according to `strategy`, and merges the branches reached, the coverage and the paths
+explored by the workers. It returns, like \ref explore, the inputs of the states explored once there is no state left and no worker is busy,
+or once `maxStates` states are explored if `maxStates` is not 0.
+
+- <b>integer exploreWorker(string address, integer entry, dict hooks={}, integer maxInsns=0)</b><br>
+Explores the states handed by the coordinator at `address` (see \ref exploreCoordinator) until it releases the worker. The worker must
+be set up with the same code and initial state as the other workers. Every state is emulated with run() from `entry` like with
+\ref explore, and the branches reached and the states spawned are sent back to the coordinator. Returns the number of states explored.
+
+- <b>void exportDependencies(string path, bool csv=False)</b><br>
+Streams the dependency graph of the symbolic expressions built from now on to the file `path`. Each expression is written once its
+instruction is processed, with its id, its kind, its origin register id or memory address, the size of its memory access, the address
+of its instruction and the ids of the expressions it references. Records are buffered and written by a background thread, in a
+compact binary format or in CSV if `csv` is true. It replaces the previous export. See stopDependencyExport().
+
+- <b>[integer, ...] filterAssignments(\ref py_AstNode_page node, [dict, ...] assignments)</b><br>
+Returns the indexes of the assignments (dicts of symbolic variable id -> integer or \ref py_SolverModel_page) under which
+`node` is not zero. The AST is evaluated by batches like evaluateAst(), so a constraint can cheaply filter thousands of
+candidate inputs before the solver is called.
+
+- <b>void flushCallbacks(void)</b><br>
+Delivers the pending events of all batched callbacks. See addBatchedCallback().
+
+- <b>[string, ...] generateInputs(integer entry, integer address, integer size, [string, ...] seeds, string corpus="", string sharedMap="", dict hooks={}, integer maxRuns=0, integer maxInsns=0)</b><br>
+Generates the inputs of the code at `entry` which reach new edges. An input is `size` bytes at `address`, symbolized byte by byte, and
+every input (starting with the `seeds`) is emulated with run() (using `hooks` and `maxInsns`) from the current state into an AFL-style
+edge coverage map. The branches of its path not tried yet are flipped by the asynchronous solver queries, the inputs of their models being
+scheduled by the novelty of their parent. The inputs which reach new edges are written to the `corpus` directory, if any, whose files are
+also taken as inputs. Several processes share their coverage map through the POSIX shared memory `sharedMap` (e.g. `/triton-coverage`)
+and their corpus directory. The generation stops when there is no input left, or once `maxRuns` inputs are emulated if `maxRuns` is not 0.
+The current state is restored at the end. Returns the inputs which have reached new edges.
+
 - <b>[\ref py_Register_page, ...] getAllRegisters(void)</b><br>
-Returns the list of all registers. Each item of this list is a \ref py_Register_page.
+Returns the list of all registers. Each item of this list is an immutable \ref py_Register_page shared by the calls.
 
 - <b>\ref py_ARCH_page getArchitecture(void)</b><br>
 Returns the current architecture used.
@@ -178,6 +337,9 @@ Returns the partial AST from a symbolic expression id.
 - <b>\ref py_AST_REPRESENTATION_page getAstRepresentationMode(void)</b><br>
 Returns the current AST representation mode.
 
+- <b>dict getAsyncModel(integer id)</b><br>
+Waits for the asynchronous query `id` (see getModelAsync()), forgets it and returns its model as a dictionary of {integer symVarId : \ref py_SolverModel_page model}.
+
 - <b>bytes getConcreteMemoryAreaValue(integer baseAddr, integer size)</b><br>
 Returns the concrete value of a memory area.
 
@@ -187,23 +349,99 @@ Returns the concrete value of a memory cell.
 - <b>integer getConcreteMemoryValue(\ref py_MemoryAccess_page mem)</b><br>
 Returns the concrete value of memory cells.
 
+- <b>dict getConcreteRegisterContext(void)</b><br>
+Returns the concrete values of the GPRs, the program counter, the flags, the segments and the XMM registers at once as a
+dictionary of {\ref py_REG_page reg : integer}. Only available on the x86 and x86-64 architectures.
+
 - <b>integer getConcreteRegisterValue(\ref py_REG_page reg)</b><br>
 Returns the concrete value of a register.
 
+- <b>\ref py_PROFILE_page getEngineProfile(void)</b><br>
+Returns the profile of the engines created by `setArchitecture()`.
+
+- <b>integer getExitStatus(void)</b><br>
+Returns the exit status of the program emulated by `run()`, or None if it has not exited.
+
+- <b>dict getExpressionProfile(void)</b><br>
+Returns the profiles of the expressions as a dictionary of {integer address : dict profile}. While `MODE.EXPRESSION_PROFILING` is enabled,
+the symbolic engine accumulates for each instruction address the number of instructions built (`instructions`), the AST nodes allocated by
+their semantics (`nodes`), the symbolic expressions emitted (`expressions`), their maximum unrolled size (`maxSize`) and depth (`maxDepth`),
+the solver queries which reference these expressions without following the references (`queries`) and the time spent in them (`solverTime`,
+in nanoseconds).
+
 - <b>\ref py_AstNode_page getFullAst(\ref py_AstNode_page node)</b><br>
-Returns the full AST without SSA form from a given root node.
+Returns the full AST without SSA form from a given root node. The given node is not modified.
 
 - <b>\ref py_AstNode_page getFullAstFromId(integer symExprId)</b><br>
 Returns the full AST without SSA form from a symbolic expression id.
 
-- <b>dict getModel(\ref py_AstNode_page node)</b><br>
+- <b>integer getInlineReferenceSize(void)</b><br>
+Returns the maximum number of nodes of the ASTs used instead of a reference with `MODE.INLINE_REFERENCES`.
+
+- <b>integer getInstructionWindow(void)</b><br>
+Returns the maximum number of instructions whose symbolic references are kept. 0 if unlimited.
+
+- <b>\ref py_SOLVER_page getLastSolverStatus(void)</b><br>
+Returns the status of the last solver query. A query which returns no model is either `SOLVER.UNSAT` or `SOLVER.UNKNOWN`.
+
+- <b>integer getMaxPathConstraintsPerBranch(void)</b><br>
+Returns the maximum number of path constraints recorded by branch instruction. 0 if unlimited.
+
+- <b>\ref py_AstNode_page getMemoryArray(void)</b><br>
+Returns the AST of the memory array used by the `MODE.MEMORY_ARRAY` mode: a reference to the last store recorded, or the base array.
+
+- <b>[integer, ...] getMemoryLabels(integer addr, integer size=1)</b><br>
+Returns the list of the taint labels of the memory area `[addr:size]`.
+
+- <b>dict getMemoryUsage(void)</b><br>
+Returns the estimated number of bytes used by each engine as a dictionary of {string name : integer bytes}. Keys are `ast.dictionaries`,
+`ast.nodes`, `cpu`, `pathManager`, `symbolic`, `taint` and `total`. Sizes are estimated from the number of entries of the containers.
+
+- <b>dict getModel(\ref py_AstNode_page node, integer timeout=0)</b><br>
 Computes and returns a model as a dictionary of {integer symVarId : \ref py_SolverModel_page model} from a symbolic constraint.
+The `timeout` is in milliseconds, 0 uses the timeout set by setSolverTimeout().
 
-- <b>[dict, ...] getModels(\ref py_AstNode_page node)</b><br>
-Computes and returns several models from a symbolic constraint. The `limit` is the number of models returned.
+- <b>integer getModelAsync(\ref py_AstNode_page node, integer timeout=0)</b><br>
+Submits a symbolic constraint to a background thread and returns the id of the query. The query owns a copy of the formula,
+so the execution can go on while it is solved.
+
+- <b>[dict, ...] getModels(\ref py_AstNode_page node, integer limit, integer threads=1)</b><br>
+Computes and returns several models from a symbolic constraint. The `limit` is the number of models returned. With more than one `threads`,
+parts of the model space are enumerated in parallel.
+
+- <b>[dict, ...] getModelsForBranches([\ref py_AstNode_page, ...] pathConstraints)</b><br>
+Computes the models which flip every branch of a path, e.g. `[pc.getTakenPathConstraintAst() for pc in getPathConstraints()]`.
+The dict `i` is a model of the constraints before `i` and of the negation of the constraint `i`, empty if there is none. The path
+is translated once into a single solver and each branch is an incremental check under assumptions.
+
+- <b>(tuple, [tuple, ...]) getModelValues(\ref py_AstNode_page node, integer limit, integer threads=1)</b><br>
+Computes several models like getModels() and returns them as arrays, without a \ref py_SolverModel_page per value. The first tuple
+holds the ids of the symbolic variables, in increasing order, and each model is a tuple of their values (None if a variable is not in the model).
+e.g. `((0, 1), [(1, 2), (3, None)])`.
+
+- <b>integer getNodeBudget(void)</b><br>
+Returns the maximum number of AST nodes before the oldest symbolic references are concretized. 0 if unlimited.
+
+- <b>integer getNumberOfFrozenAstNodes(void)</b><br>
+Returns the number of AST nodes frozen by snapshot() and shared read-only by the snapshots and the current state. They are
+never freed by the garbage collector until the snapshots which hold them are removed.
+
+- <b>integer getNumberOfMergedBranches(void)</b><br>
+Returns the number of symbolic branches merged by `run()` with `MODE.STATE_MERGING` since the engines have been initialized.
+
+- <b>dict getOpcodeProfile(void)</b><br>
+Returns the profiles of the opcodes as a dictionary of {\ref py_OPCODE_page opcode : dict profile}. While `MODE.OPCODE_PROFILING` is enabled,
+the IR builder accumulates for each opcode the number of instructions built (`calls`), the cycles spent building their semantics (`cycles`,
+read from the time stamp counter), the AST nodes allocated (`nodes`) and the symbolic expressions emitted (`expressions`). The `mnemonic`
+is the one of the first instruction profiled.
 
 - <b>[\ref py_Register_page, ...] getParentRegisters(void)</b><br>
-Returns the list of parent registers. Each item of this list is a \ref py_Register_page.
+Returns the list of parent registers. Each item of this list is an immutable \ref py_Register_page shared by the calls.
+
+- <b>dict getPartialModel(\ref py_AstNode_page node, [\ref py_SymbolicVariable_page, ...] freeVariables, integer timeout=0)</b><br>
+Computes and returns a model as a dictionary of {integer symVarId : \ref py_SolverModel_page model} from a symbolic constraint where the
+symbolic variables which are not in `freeVariables` are replaced by their concrete value. The subterms which do not depend on a free
+variable anymore are folded into constants before the query is solved, which makes targeted queries (e.g. flipping an input byte) smaller.
 
 - <b>[\ref py_PathConstraint_page, ...] getPathConstraints(void)</b><br>
 Returns the logical conjunction vector of path constraints as list of \ref py_PathConstraint_page.
@@ -211,6 +449,49 @@ Returns the logical conjunction vector of path constraints as list of \ref py_Pa
 - <b>\ref py_AstNode_page getPathConstraintsAst(void)</b><br>
 Returns the logical conjunction AST of path constraints.
 
+- <b>[integer, ...] getPathConstraintsSlice(integer index)</b><br>
+Returns the indexes of the path constraints before the path constraint `index` which share symbolic variables with it,
+transitively. These are the only constraints of the prefix needed to flip its branch. The path constraints are indexed by
+symbolic variable, so the time is proportional to the size of the slice.
+
+- <b>\ref py_AstNode_page getPathConstraintsSliceAst(integer index)</b><br>
+Returns the logical conjunction AST of the taken branches of the path constraints returned by getPathConstraintsSlice().
+
+- <b>dict getPointerPolicy(integer addr)</b><br>
+Returns the pointer policy of an instruction address as a dictionary of {"policy": \ref py_SYMEXPR_page policy, "range": integer}. The
+instructions without their own policy get the default one. See setPointerPolicy().
+
+- <b>integer getQueryCacheHits(void)</b><br>
+Returns the number of queries answered by the query cache of the solver.
+
+- <b>integer getQueryCacheMisses(void)</b><br>
+Returns the number of queries which were not in the query cache of the solver.
+
+- <b>[integer, ...] getRegisterLabels(\ref py_REG_page reg)</b><br>
+Returns the list of the taint labels of a register.
+
+- <b>string getRemoteSolver(void)</b><br>
+Returns the address of the remote solver daemon set by \ref setRemoteSolver, an empty string if the queries are solved locally.
+
+- <b>dict getSessionModel([\ref py_AstNode_page, ...] prefix, \ref py_AstNode_page node)</b><br>
+Computes and returns a model as a dictionary of {integer symVarId : \ref py_SolverModel_page model} from the solver session. The `prefix` constraints
+are kept asserted between calls, so queries sharing a prefix only assert their new constraints. Returns an empty dictionary if `node` is unsat.
+
+- <b>\ref py_SOLVER_page getSolverBackend(void)</b><br>
+Returns the backend which answers the single model queries.
+
+- <b>integer getStateMergingLimit(void)</b><br>
+Returns the maximum number of instructions of each side of the branches merged by `run()` with `MODE.STATE_MERGING`.
+
+- <b>dict getStatistics(void)</b><br>
+Returns the statistics of the engines as a dictionary of {string name : integer value}: the live and peak AST nodes (also per kind),
+the hits of the AST dictionaries, the symbolic expressions and variables, the tainted bytes and registers, the CPU memory pages,
+the solver queries by status and the time spent in the disassembly, the semantics and the post IR collection (in nanoseconds).
+With `MODE.DECODE_AHEAD`, `disassembly.decodedAhead` counts the instructions decoded ahead by `run()` and `emulate()`.
+With `MODE.PERF_COUNTERS`, the cycles, instructions, cache misses and branch misses of the disassembly, the semantics, the post IR
+collection and the solver queries are added as `perf.<stage>.<counter>` (`disassembly`, `semantics`, `gc` and `solver`).
+With `MODE.HUGE_PAGES`, the chunks of the huge page arena by backing, and its reserved and used bytes, are added as `hugePages.*`.
+
 - <b>\ref py_SymbolicExpression_page getSymbolicExpressionFromId(intger symExprId)</b><br>
 Returns the symbolic expression corresponding to an id.
 
@@ -218,10 +499,25 @@ Returns the symbolic expression corresponding to an id.
 Returns all symbolic expressions as a dictionary of {integer SymExprId : \ref py_SymbolicExpression_page expr}.
 
 - <b>dict getSymbolicMemory(void)</b><br>
-Returns the map of symbolic memory as {integer address : \ref py_SymbolicExpression_page expr}.
+Returns the map of symbolic memory as {integer address : \ref py_SymbolicExpression_page expr}. A store is one expression
+shared by all its addresses, each address being a byte of it (little endian).
+
+- <b>dict getSymbolicMemory(integer start, integer end)</b><br>
+Returns the map of symbolic memory in [start, end) as {integer address : \ref py_SymbolicExpression_page expr}. Only the
+memory of the range is visited, so checking the symbolic bytes of a buffer does not depend on the rest of the memory.
+
+- <b>bytearray getSymbolicMemoryBuffer(void)</b><br>
+Returns the symbolic memory as a buffer of native 64-bit integers, the address and the symbolic expression id of every
+symbolic byte in ascending order of address. e.g: `numpy.frombuffer(getSymbolicMemoryBuffer(), dtype=numpy.uint64).reshape(-1, 2)`.
+No Python object is created per address.
 
 - <b>integer getSymbolicMemoryId(intger addr)</b><br>
-Returns the symbolic expression id corresponding to a memory address.
+Returns the symbolic expression id corresponding to a memory address. The expression may hold several bytes, use
+getSymbolicMemoryValue() or buildSymbolicMemory() to get the value of the address itself.
+
+- <b>bytearray getSymbolicMemoryRanges(void)</b><br>
+Returns the ranges of symbolic memory as a buffer of native 64-bit integers, the address and the size of every range
+of contiguous symbolic bytes in ascending order of address.
 
 - <b>integer getSymbolicMemoryValue(intger addr)</b><br>
 Returns the symbolic memory value.
@@ -229,6 +525,9 @@ Returns the symbolic memory value.
 - <b>integer getSymbolicMemoryValue(\ref py_MemoryAccess_page mem)</b><br>
 Returns the symbolic memory value.
 
+- <b>list getSymbolicRegions(void)</b><br>
+Returns the symbolic regions as a list of (integer start, integer end) with the end excluded. See addSymbolicRegion().
+
 - <b>dict getSymbolicRegisters(void)</b><br>
 Returns the map of symbolic register as {\ref py_REG_page reg : \ref py_SymbolicExpression_page expr}.
 
@@ -250,15 +549,35 @@ Returns all symbolic variable as a dictionary of {integer SymVarId : \ref py_Sym
 - <b>[intger, ...] getTaintedMemory(void)</b><br>
 Returns the list of all tainted addresses.
 
+- <b>bytearray getTaintedMemoryBuffer(void)</b><br>
+Returns the tainted addresses as a buffer of native 64-bit integers in ascending order. e.g:
+`numpy.frombuffer(getTaintedMemoryBuffer(), dtype=numpy.uint64)`. No Python object is created per address.
+
+- <b>bytearray getTaintedMemoryRanges(void)</b><br>
+Returns the ranges of tainted memory as a buffer of native 64-bit integers, the address and the size of every range in
+ascending order of address. Large tainted areas are exported without enumerating their bytes.
+
 - <b>[\ref py_Register_page, ...] getTaintedRegisters(void)</b><br>
 Returns the list of all tainted registers.
 
-- <b>[\ref py_SymbolicExpression_page, ...] getTaintedSymbolicExpressions(void)</b><br>
-Returns the list of all tainted symbolic expressions.
+- <b>[\ref py_SymbolicExpression_page, ...] getTaintedSymbolicExpressions(integer fromId=0)</b><br>
+Returns the list of the tainted symbolic expressions whose id is greater than or equal to `fromId`. The tainted expressions
+are indexed incrementally, so a script may pass the id following the last tainted expression it has seen to get only the
+expressions tainted since its previous checkpoint.
+
+- <b>bytes getVirtualFile(string path)</b><br>
+Returns the content of a file of the virtual file system of the syscall emulation (e.g. `/dev/stdout`), empty if it does not exist.
+
+- <b>void initMemoryArrayArea(integer baseAddr, integer size)</b><br>
+Copies the values of the memory area `[baseAddr:size]` into the memory array used by the `MODE.MEMORY_ARRAY` mode, so that the
+symbolic loads in this area (e.g. a lookup table) are constrained by them.
 
 - <b>bool isArchitectureValid(void)</b><br>
 Returns true if the architecture is valid.
 
+- <b>bool isAsyncModelReady(integer id)</b><br>
+Returns true if the asynchronous query `id` is solved.
+
 - <b>bool isMemoryMapped(integer baseAddr, integer size=1)</b><br>
 Returns true if the range `[baseAddr:size]` is mapped into the internal memory representation.
 
@@ -283,21 +602,68 @@ Returns true if the register expression contains a symbolic variable.
 - <b>bool isRegisterTainted(\ref py_REG_page reg)</b><br>
 Returns true if the register is tainted.
 
+- <b>bool isSolverSessionStarted(void)</b><br>
+Returns true if a solver session is started.
+
 - <b>bool isSymbolicEngineEnabled(void)</b><br>
 Returns true if the symbolic execution engine is enabled.
 
 - <b>bool isSymbolicExpressionIdExists(integer symExprId)</b><br>
 Returns true if the symbolic expression id exists.
 
+- <b>bool isSyscallEmulationEnabled(void)</b><br>
+Returns true if the syscalls are emulated by `run()`.
+
 - <b>bool isTaintEngineEnabled(void)</b><br>
 Returns true if the taint engine is enabled.
 
+- <b>bool isUndoJournalEnabled(void)</b><br>
+Returns true if the undo journal is enabled.
+
+- <b>bool labelMemory(integer addr, integer label)</b><br>
+Taints an address and adds `label` to its taint labels. The labels follow the taint spreading: an assignment copies them, a union merges them.
+
+- <b>bool labelRegister(\ref py_REG_page reg, integer label)</b><br>
+Taints a register and adds `label` to its taint labels.
+
+- <b>void loadBinary(\ref py_Elf_page or \ref py_Pe_page binary)</b><br>
+Maps all memory areas of a binary into the concrete memory. Bytes of loadable segments which are not in the file (e.g. the `.bss`) are mapped as zero.
+
+- <b>void loadCheckpoint(string path)</b><br>
+Replaces the concrete, symbolic and taint states by the ones of a checkpoint file written by `saveCheckpoint()`. The memory pages
+are read from the mapped file until they are written. The current symbolic references and path constraints are dropped and the
+symbolic expressions read get new ids.
+
+- <b>integer loadCoreDump(string path)</b><br>
+Maps the memory of an ELF core file (its loadable segments) or of a minidump (its memory lists) into the concrete memory and returns
+the number of areas mapped. The dump is not copied, a page is read from the mapped file on its first access.
+
+- <b>integer loadDecodeCache(string directory, \ref py_Elf_page or \ref py_Pe_page binary)</b><br>
+Reads the decode cache of the executable segments or sections of a binary from the file of `directory` written by `saveDecodeCache()`.
+Returns the number of instructions read, 0 if there is no file for this binary.
+
 - <b>\ref py_SymbolicExpression_page newSymbolicExpression(\ref py_AstNode_page node, string comment="")</b><br>
 Returns a new symbolic expression. Note that if there are simplification passes recorded, simplifications will be applied.
 
 - <b>\ref py_SymbolicVariable_page newSymbolicVariable(intger varSize, string comment="")</b><br>
 Returns a new symbolic variable.
 
+- <b>[\ref py_AstNode_page, ...] parseSmt(string script)</b><br>
+Reads an SMT-LIB2 script (QF_BV or QF_ABV) and returns its asserted terms. The terms are built directly as Triton ASTs, without a solver.
+Declared bitvector constants are the symbolic variables of the same name (e.g. `SymVar_0`) or new symbolic variables commented with their name.
+
+- <b>void pinSymbolicExpression(integer symExprId)</b><br>
+Pins a symbolic expression. Pinned expressions, and the ones they reference, are never collected. Pin the expressions you keep
+if `MODE.ONLY_LIVE_EXPRESSIONS` is enabled.
+
+- <b>integer predecode(\ref py_Elf_page or \ref py_Pe_page binary, integer threads=0)</b><br>
+Decodes the executable segments or sections of a binary into the decode cache of the CPU, on `threads` threads (0 for one per core).
+Later disassemblies at these addresses reuse the decoding. Returns the number of instructions cached.
+
+- <b>integer processBlock(integer addr, bytes opcodes, integer count=0)</b><br>
+Processes the instructions of `opcodes` one after another, the first one being at `addr`. Processes at most `count` instructions,
+or the whole buffer if `count` is 0. Returns the number of instructions processed.
+
 - <b>bool processing(\ref py_Instruction_page inst)</b><br>
 Processes an instruction and updates engines according to the instruction semantics. Returns true if the instruction is supported. You must define an architecture before.
 
@@ -307,11 +673,57 @@ Removes all recorded callbacks.
 - <b>void removeCallback(function cb, \ref py_CALLBACK_page kind)</b><br>
 Removes a recorded callback.
 
+- <b>void removeFunctionSummary(integer addr)</b><br>
+Removes the function summary of an address.
+
+- <b>void removeSymbolicRegion(integer start, integer end)</b><br>
+Removes the addresses `[start:end)` from the symbolic regions.
+
+- <b>void removeSnapshot(integer id)</b><br>
+Removes a snapshot taken by snapshot().
+
+- <b>integer replayTrace(string path, integer maxInsns=0, integer start=0)</b><br>
+Replays an execution trace recorded by the pintool (see `recordTrace()` in the \ref pintool_py_api). Before each
+instruction is processed, the concrete registers and the concrete memory read by the instruction are synchronized with
+the values of the trace. Replays at most `maxInsns` instructions, or the whole trace if `maxInsns` is 0. The replay starts
+at the instruction number `start`, which is reached through the index of the chunks of the trace without processing the
+previous instructions. Returns the number of instructions processed.
+
 - <b>void resetEngines(void)</b><br>
 Resets everything.
 
-- <b>void setArchitecture(\ref py_ARCH_page arch)</b><br>
-Initializes an architecture. This function must be called before any call to the rest of the API.
+- <b>void restore(integer id)</b><br>
+Restores a snapshot taken by snapshot(). The snapshot is kept, so it may be restored again. AST nodes created since the
+snapshot are freed, unless another snapshot holds them.
+
+- <b>void rewindTo(integer id)</b><br>
+Reverts every change made since checkpoint() returned `id`, including the instructions processed since. Raises an exception
+if the checkpoint has been reverted already.
+
+- <b>integer run(integer entry, dict hooks={}, integer maxInsns=0)</b><br>
+Emulates the code from `entry`, following the concrete program counter. `hooks` maps addresses to functions called with the
+address reached, before the instruction at this address is processed. A hook may redirect the execution by setting the program
+counter (e.g. to simulate a routine) and stops the emulation by returning `False`. The emulation also stops when the program
+counter is 0, after a `hlt`, or once `maxInsns` instructions are processed if `maxInsns` is not 0. Returns the number of
+instructions processed.
+
+- <b>void saveCheckpoint(string path)</b><br>
+Writes the concrete registers and memory, the symbolic state and the taint (labels included) to a checkpoint file.
+
+- <b>integer saveDecodeCache(string directory, \ref py_Elf_page or \ref py_Pe_page binary)</b><br>
+Writes the decode cache of the executable segments or sections of a binary to a file of `directory`, named after a hash of their
+addresses and content. Returns the number of instructions written. See also `predecode()`.
+
+- <b>bytes serializeAsts([\ref py_AstNode_page, ...])</b><br>
+Returns ASTs in a compact binary format. Nodes shared by the ASTs are written once.
+
+- <b>bytes serializeSymbolicState(void)</b><br>
+Returns the symbolic variables, the symbolic expressions, the symbolic references of registers and memory cells and the
+path constraints in the binary format of serializeAsts().
+
+- <b>void setArchitecture(\ref py_ARCH_page arch, \ref py_PROFILE_page profile=PROFILE.FULL)</b><br>
+Initializes an architecture. This function must be called before any call to the rest of the API. The `profile` selects
+the engines created, e.g. `PROFILE.DISASSEMBLY` for a tool which only disassembles instructions.
 
 - <b>void setAstRepresentationMode(\ref py_AST_REPRESENTATION_page mode)</b><br>
 Sets the AST representation mode.
@@ -320,8 +732,9 @@ Sets the AST representation mode.
 Sets the concrete value of a memory area. Note that by setting a concrete value will probably imply a desynchronization with
 the symbolic state (if it exists). You should probably use the concretize functions after this.
 
-- <b>void setConcreteMemoryAreaValue(integer baseAddr, bytes opcodes)</b><br>
-Sets the concrete value of a memory area. Note that by setting a concrete value will probably imply a desynchronization with
+- <b>void setConcreteMemoryAreaValue(integer baseAddr, buffer values)</b><br>
+Sets the concrete value of a memory area from any object supporting the buffer protocol (bytes, bytearray, memoryview, mmap,
+contiguous numpy arrays, ...), read in place. Note that by setting a concrete value will probably imply a desynchronization with
 the symbolic state (if it exists). You should probably use the concretize functions after this.
 
 - <b>void setConcreteMemoryValue(integer addr, integer value)</b><br>
@@ -332,16 +745,95 @@ the symbolic state (if it exists). You should probably use the concretize functi
 Sets the concrete value of memory cells. Note that by setting a concrete value will probably imply a desynchronization with
 the symbolic state (if it exists). You should probably use the concretize functions after this.
 
+- <b>void setConcreteRegisterContext(dict context)</b><br>
+Sets the concrete values of the registers of a dictionary of {\ref py_REG_page reg : integer} (cf. getConcreteRegisterContext())
+at once. The registers which are not in the dictionary keep their value. Only the registers of getConcreteRegisterContext() are
+accepted. As setConcreteRegisterValue(), the symbolic state is not updated.
+
 - <b>void setConcreteRegisterValue(\ref py_REG_page reg)</b><br>
 Sets the concrete value of a register. Note that by setting a concrete value will probably imply a desynchronization with
 the symbolic state (if it exists). You should probably use the concretize functions after this.
 
+- <b>void setDefaultPointerPolicy(\ref py_SYMEXPR_page policy, integer range=16)</b><br>
+Sets the pointer policy of the instructions without their own, `SYMEXPR.POINTER_CONCRETE` by default. See setPointerPolicy().
+
+- <b>void setExpressionLimits(integer depth, integer size)</b><br>
+Sets the maximum depth and unrolled size of the symbolic expressions, 0 if unlimited (the default). After every instruction, the expressions
+which exceed a limit are passed to the \ref py_CALLBACK_page `EXPRESSION_LIMIT` callbacks and, with `MODE.CONCRETIZE_LARGE_EXPRESSIONS`,
+their destination (register or memory) is concretized. See the `getDepth()` and `getUnrolledSize()` methods of \ref py_SymbolicExpression_page.
+
+- <b>void setInlineReferenceSize(integer size)</b><br>
+Sets the maximum number of nodes of the ASTs used instead of a reference with `MODE.INLINE_REFERENCES`, 8 by default. The nodes
+are counted up to the references, which are not followed.
+
+- <b>void setInstructionWindow(integer size)</b><br>
+Sets the maximum number of instructions whose symbolic references are kept, 0 if unlimited (the default). Once an instruction is
+older than the last `size` ones, the registers and memory cells it assigned, and which have not been assigned again, are concretized.
+Every `size` instructions, the path constraints recorded before the window are dropped and the unreachable expressions are freed,
+so a long running analysis only keeps the dependencies of its recent instructions. The AST nodes can be bounded with setNodeBudget().
+
+- <b>void setMaxPathConstraintsPerBranch(integer limit)</b><br>
+Sets the maximum number of path constraints recorded by branch instruction. Once a branch has reached this number, its next
+path constraints are not recorded, so the path predicate of a loop does not grow with its number of iterations but models may
+not follow the whole path anymore. 0 if unlimited, which is the default.
+
+- <b>void setMemoryLimits(integer soft, integer hard)</b><br>
+Sets the soft and hard memory limits in bytes (0 if unlimited), checked against the `total` of getMemoryUsage() after every instruction
+processed. The \ref py_CALLBACK_page `MEMORY_LIMIT` callbacks are called once when the soft limit is exceeded. When the hard limit is exceeded,
+they are called and, if it is still exceeded, every register and memory cell is concretized and the unreachable expressions are collected.
+
+- <b>void setNodeBudget(integer budget)</b><br>
+Sets the maximum number of AST nodes, 0 if unlimited (the default). Once the budget is exceeded after an instruction, the oldest half of the
+symbolic register and memory references (the ones which have not been written for the longest time) are concretized and the expressions
+which are not reachable anymore are freed, so long analyses lose precision instead of running out of memory.
+
+- <b>void setPointerPolicy(integer addr, \ref py_SYMEXPR_page policy, integer range=16)</b><br>
+Sets how the instruction at `addr` accesses the memory when the address of the access is symbolized (without `MODE.MEMORY_ARRAY`).
+With `SYMEXPR.POINTER_CONCRETE`, only the concrete address is accessed. With `SYMEXPR.POINTER_RANGE`, a load reads an ite table over
+the addresses of the window of `range` bytes on each side of the concrete address which the address may take (from the abstract
+interval of its AST), and a store updates each of them if the address is equal to it. `SYMEXPR.POINTER_SOLVER` narrows the window to
+the lowest and highest values of the address given by the solver, which are cached by address AST.
+
+- <b>void setRemoteSolver(string address)</b><br>
+Sends the solver queries to a `triton-solverd` daemon, at `unix:<path>` for a Unix socket or `<host>:<port>` for TCP. The single
+model queries and the asynchronous queries are solved by the daemon, which caches the results of all its clients. The enumeration
+of models and the solver session stay local. An empty address solves the queries locally again.
+
+- <b>void setSolverBackend(\ref py_SOLVER_page backend)</b><br>
+Sets the backend which answers the single model queries (\ref getModel). The enumeration of models, the asynchronous
+queries and the solver session stay on Z3. Raises an exception if Triton has not been built with the backend.
+
+- <b>void setSolverLocalSearchBudget(integer budget)</b><br>
+Sets the number of mutations of the concrete values of the symbolic variables evaluated before a query is sent to the solver.
+0 disables this local search. The models of the last 16 sat queries are evaluated before, whatever the budget: branch flips are
+often satisfied by one of them (see the `solver.modelHits` statistic).
+
+- <b>void setSolverMemoryLimit(integer limit)</b><br>
+Sets the maximum amount of memory used by the solver in megabytes. 0 if unlimited.
+
+- <b>void setSolverPortfolioSize(integer size)</b><br>
+Sets the number of solvers racing on a query when the backend is `SOLVER.PORTFOLIO`: Z3 with different tactics and seeds,
+and Boolector if Triton has been built with it. 0, the default, starts one solver per core.
+
+- <b>void setSolverResourceLimit(integer limit)</b><br>
+Sets the resource limit (rlimit) of the solver queries. 0 if unlimited.
+
+- <b>void setSolverTimeout(integer timeout)</b><br>
+Sets the timeout of the solver queries in milliseconds. 0 if unlimited.
+
+- <b>void setStateMergingLimit(integer limit)</b><br>
+Sets the maximum number of instructions of each side of the branches merged by `run()` with `MODE.STATE_MERGING`. Both sides are
+executed speculatively before a merge, so the limit bounds the cost of a branch which is not merged. 32 by default.
+
 - <b>bool setTaintMemory(\ref py_MemoryAccess_page mem, bool flag)</b><br>
 Sets the targeted memory as tainted or not. Returns true if the memory is still tainted.
 
 - <b>bool setTaintRegister(\ref py_REG_page reg, bool flag)</b><br>
 Sets the targeted register as tainted or not. Returns true if the register is still tainted.
 
+- <b>void setVirtualFile(string path, bytes content)</b><br>
+Creates or replaces a file of the virtual file system of the syscall emulation (e.g. `/dev/stdin`).
+
 - <b>\ref py_AstNode_page simplify(\ref py_AstNode_page node, bool z3=False)</b><br>
 Calls all simplification callbacks recorded and returns a new simplified node. If the `z3` flag is
 set to True, Triton will use z3 to simplify the given `node` before to call its recorded callbacks.
@@ -349,6 +841,28 @@ set to True, Triton will use z3 to simplify the given `node` before to call its
 - <b>dict sliceExpressions(\ref py_SymbolicExpression_page expr)</b><br>
 Slices expressions from a given one (backward slicing) and returns all symbolic expressions as a dictionary of {integer SymExprId : \ref py_SymbolicExpression_page expr}.
 
+- <b>integer snapshot(void)</b><br>
+Takes a snapshot of the CPU, the symbolic engine, the taint engine and the AST nodes, and returns its id. The concrete memory
+and the symbolic expressions are shared with the snapshot until they are written or removed, so a snapshot is cheap to take.
+The AST nodes are not copied, they are frozen and shared read-only (cf. getNumberOfFrozenAstNodes()).
+Exploring two paths from a state is done by taking a snapshot, exploring the first path and restoring the snapshot.
+
+- <b>void startSolverSession(void)</b><br>
+Starts an incremental solver session used by getSessionModel().
+
+- <b>integer stepBack(integer count=1)</b><br>
+Reverts the last `count` instructions processed while the undo journal is enabled, and the changes made since. Returns the
+number of instructions reverted, fewer than `count` if the journal does not hold them.
+
+- <b>void stopDependencyExport(void)</b><br>
+Stops streaming the dependency graph. The pending records are written and the file is closed.
+
+- <b>void stopSolverSession(void)</b><br>
+Stops the solver session and releases its constraints.
+
+- <b>bool taintAssignmentMemoryArea(integer dst, integer src, integer size)</b><br>
+Spreads the taint of a copy of `size` bytes from `src` to `dst` (e.g. a `memcpy` hook). The areas may overlap. Returns true if the destination is tainted.
+
 - <b>bool taintAssignmentMemoryImmediate(\ref py_MemoryAccess_page memDst)</b><br>
 Taints `memDst` with an assignment - `memDst` is untained. Returns true if the `memDst` is still tainted.
 
@@ -377,9 +891,15 @@ Taints an address. Returns true if the address is tainted.
 - <b>bool taintMemory(\ref py_MemoryAccess_page mem)</b><br>
 Taints a memory. Returns true if the memory is tainted.
 
+- <b>bool taintMemoryArea(integer baseAddr, integer size=1)</b><br>
+Taints the range `[baseAddr:size]`. Returns true if the range is tainted.
+
 - <b>bool taintRegister(\ref py_REG_page reg)</b><br>
 Taints a register. Returns true if the register is tainted.
 
+- <b>bool taintUnionMemoryArea(integer dst, integer src, integer size)</b><br>
+Spreads the taint of a union of `size` bytes from `src` into `dst`. Returns true if the destination is tainted.
+
 - <b>bool taintUnionMemoryImmediate(\ref py_MemoryAccess_page memDst)</b><br>
 Taints `memDst` with an union - `memDst` does not changes. Returns true if `memDst` is tainted.
 
@@ -405,12 +925,18 @@ tainted. Returns true if `regDst` is tainted.
 - <b>void unmapMemory(integer baseAddr, integer size=1)</b><br>
 Removes the range `[baseAddr:size]` from the internal memory representation.
 
+- <b>void unpinSymbolicExpression(integer symExprId)</b><br>
+Unpins a symbolic expression.
+
 - <b>bool untaintMemory(intger addr)</b><br>
 Untaints an address. Returns true if the address is still tainted.
 
 - <b>bool untaintMemory(\ref py_MemoryAccess_page mem)</b><br>
 Untaints a memory. Returns true if the memory is still tainted.
 
+- <b>bool untaintMemoryArea(integer baseAddr, integer size=1)</b><br>
+Untaints the range `[baseAddr:size]`. Returns true if the range is still tainted.
+
 - <b>bool untaintRegister(\ref py_REG_page reg)</b><br>
 Untaints a register. Returns true if the register is still tainted.
 
@@ -423,11 +949,14 @@ Untaints a register. Returns true if the register is still tainted.
 - \ref py_CALLBACK_page
 - \ref py_CPUSIZE_page
 - \ref py_ELF_page
+- \ref py_EXPLORATION_page
 - \ref py_MODE_page
 - \ref py_OPCODE_page
 - \ref py_OPERAND_page
 - \ref py_PE_page
+- \ref py_PROFILE_page
 - \ref py_REG_page
+- \ref py_SOLVER_page
 - \ref py_SYMEXPR_page
 - \ref py_SYSCALL_page
 - \ref py_VERSION_page
@@ -453,6 +982,14 @@ Your script must contains the pintool and triton imports.
 
 \subsection pintool_py_api_methods Methods
 
+- <b>void analyzeAllThreads(void)</b><br>
+Analyzes the instructions of all threads instead of only the thread which has started the analysis. Each thread has
+its own API, bound to it: the thread which is analyzed first keeps the default one and the states set up by the script,
+the other ones start with an API set up like it (architecture, engines and modes) whose concrete, symbolic and taint
+states are empty. The memory states are thus not shared between threads. Without instruction callbacks nor snapshot,
+the threads are analyzed in parallel. The Python callbacks are still never executed concurrently and, in a callback,
+the triton module uses the API of the thread which executes it.
+
 - <b>bool checkReadAccess(integer addr)</b><br>
 Checks whether the memory page which contains this address has a read access protection.
 
@@ -468,6 +1005,17 @@ Disables the snapshot engine. When you have done with the `tracer::pintool::Snap
 you may use this function to improve performance. Then, the snapshot engine will be enable at the next
 `tracer::pintool::Snapshot::takeSnapshot()` call.
 
+- <b>void dumpFlightRecorder(void)</b><br>
+Dumps the last instructions executed by each thread, kept by the flight recorder (see the `-flight-recorder` option of
+the pintool). The dump is written into the standard error or appended to the file given by `-flight-recorder-file`.
+
+- <b>void enableAsyncCallbacks(void)</b><br>
+Calls the `AFTER` \ref py_INSERT_POINT_page callback from an analysis thread instead of the instrumented one. The instructions
+are queued and the instrumented thread goes on without waiting for the callback, which is thus called once the instruction
+and possibly the next ones are executed. The callback must only read the instruction: the current context and the
+functions which modify the execution (e.g. `setCurrentRegisterValue()`) are not meaningful there. The other callbacks are
+still called from the instrumented thread. Must be called before `runProgram()`.
+
 - <b>integer getCurrentMemoryValue(\ref py_MemoryAccess_page mem)</b><br>
 Returns the memory value from a \ref py_MemoryAccess_page.
 
@@ -505,6 +1053,13 @@ instrumentation.
 - <b>bool isSnapshotEnabled(void)</b><br>
 Returns true if the snapshot engine is enabled.
 
+- <b>void recordTrace(string path)</b><br>
+Records the execution into a trace file instead of analyzing it. The address, the opcodes, the registers which changed
+and the memory read by each instruction of the analyzed thread are written, and the engines of Triton are not used during
+the execution, so the program runs much faster. The trace is cut into indexed chunks, each one starting with all the registers
+of the threads, so it may be replayed later from any instruction with `replayTrace()`. This function must be called before
+`runProgram()`.
+
 - <b>void restoreSnapshot(void)</b><br>
 Restores the last snpahost taken. Check the `tracer::pintool::Snapshot::takeSnapshot()` function. Note that this function
 have to execute a new context registers, so `RIP` will be modified and your callback stopped
@@ -571,6 +1126,137 @@ namespace triton {
   namespace bindings {
     namespace python {
 
+      /* Releases the GIL during its scope, unless a python callback may be called. No python object may be used in the scope. */
+      class GilRelease {
+        private:
+          PyThreadState* state;
+
+        public:
+          GilRelease() {
+            this->state = triton::getCurrentApi().isPythonCallbackDefined() ? nullptr : PyEval_SaveThread();
+          }
+
+          ~GilRelease() {
+            if (this->state)
+              PyEval_RestoreThread(this->state);
+          }
+      };
+
+
+      /* Converts a dict of symbolic variable id -> integer or SolverModel. Returns false with the python error of `name` set on failure. */
+      static bool PyAssignment_Convert(const char* name, PyObject* dict, std::map<triton::usize, triton::uint512>& values) {
+        PyObject* key   = nullptr;
+        PyObject* value = nullptr;
+        Py_ssize_t pos  = 0;
+
+        while (PyDict_Next(dict, &pos, &key, &value)) {
+          if (!PyLong_Check(key) && !PyInt_Check(key)) {
+            PyErr_Format(PyExc_TypeError, "%s(): Expects symbolic variable ids as keys.", name);
+            return false;
+          }
+
+          if (PySolverModel_Check(value))
+            values[PyLong_AsUsize(key)] = PySolverModel_AsSolverModel(value)->getValue();
+          else if (PyLong_Check(value) || PyInt_Check(value))
+            values[PyLong_AsUsize(key)] = PyLong_AsUint512(value);
+          else {
+            PyErr_Format(PyExc_TypeError, "%s(): Expects integers or SolverModel as values.", name);
+            return false;
+          }
+        }
+
+        return true;
+      }
+
+
+      /* Converts a dict of address -> python hook. The dict keeps the functions alive. Returns false with the python error of `name` set on failure. */
+      static bool PyAddressHooks_Convert(const char* name, PyObject* dict, std::map<triton::uint64, triton::callbacks::addressHookCallback>& hooks) {
+        PyObject* key   = nullptr;
+        PyObject* value = nullptr;
+        Py_ssize_t pos  = 0;
+        std::string error = std::string(name) + "(): Fail to call the python hook.";
+
+        while (PyDict_Next(dict, &pos, &key, &value)) {
+          if (!PyLong_Check(key) && !PyInt_Check(key)) {
+            PyErr_Format(PyExc_TypeError, "%s(): Expects addresses as keys.", name);
+            return false;
+          }
+
+          if (!PyCallable_Check(value)) {
+            PyErr_Format(PyExc_TypeError, "%s(): Expects functions as values.", name);
+            return false;
+          }
+
+          hooks[PyLong_AsUint64(key)] = [value, error](triton::uint64 address) {
+            PyObject* hookArgs = xPyTuple_New(1);
+            PyTuple_SetItem(hookArgs, 0, PyLong_FromUint64(address));
+
+            PyObject* ret = PyObject_CallObject(value, hookArgs);
+            Py_DECREF(hookArgs);
+
+            if (ret == nullptr) {
+              PyErr_Print();
+              throw triton::exceptions::Callbacks(error);
+            }
+
+            bool goOn = (ret != Py_False);
+            Py_DECREF(ret);
+            return goOn;
+          };
+        }
+
+        return true;
+      }
+
+
+      /* Returns the register ids of the GPRs of a RegisterContext for the current architecture, and their number */
+      static const triton::uint32* PyRegisterContext_Gprs(triton::uint32& count) {
+        static const triton::uint32 x86Gprs[] = {
+          triton::arch::x86::ID_REG_EAX, triton::arch::x86::ID_REG_EBX, triton::arch::x86::ID_REG_ECX, triton::arch::x86::ID_REG_EDX,
+          triton::arch::x86::ID_REG_EDI, triton::arch::x86::ID_REG_ESI, triton::arch::x86::ID_REG_EBP, triton::arch::x86::ID_REG_ESP,
+        };
+        static const triton::uint32 x8664Gprs[] = {
+          triton::arch::x86::ID_REG_RAX, triton::arch::x86::ID_REG_RBX, triton::arch::x86::ID_REG_RCX, triton::arch::x86::ID_REG_RDX,
+          triton::arch::x86::ID_REG_RDI, triton::arch::x86::ID_REG_RSI, triton::arch::x86::ID_REG_RBP, triton::arch::x86::ID_REG_RSP,
+          triton::arch::x86::ID_REG_R8,  triton::arch::x86::ID_REG_R9,  triton::arch::x86::ID_REG_R10, triton::arch::x86::ID_REG_R11,
+          triton::arch::x86::ID_REG_R12, triton::arch::x86::ID_REG_R13, triton::arch::x86::ID_REG_R14, triton::arch::x86::ID_REG_R15,
+        };
+
+        if (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_X86_64) {
+          count = 16;
+          return x8664Gprs;
+        }
+
+        count = 8;
+        return x86Gprs;
+      }
+
+
+      /* Returns the register ids of the segments of a RegisterContext */
+      static const triton::uint32* PyRegisterContext_Segments(void) {
+        static const triton::uint32 segments[] = {
+          triton::arch::x86::ID_REG_CS, triton::arch::x86::ID_REG_DS, triton::arch::x86::ID_REG_ES,
+          triton::arch::x86::ID_REG_FS, triton::arch::x86::ID_REG_GS, triton::arch::x86::ID_REG_SS,
+        };
+        return segments;
+      }
+
+
+      /* Returns the inputs of the states explored as a list of dicts of symbolic variable id -> integer */
+      static PyObject* PyExplorationInputs_FromVector(const std::vector<triton::engines::exploration::ExplorationInputs>& explored) {
+        PyObject* ret = xPyList_New(explored.size());
+
+        for (triton::usize i = 0; i < explored.size(); i++) {
+          PyObject* inputs = xPyDict_New();
+          for (const auto& input : explored[i])
+            PyDict_SetItem(inputs, PyLong_FromUsize(input.first), PyLong_FromUint512(input.second));
+          PyList_SetItem(ret, i, inputs);
+        }
+
+        return ret;
+      }
+
+
       static PyObject* triton_Bitvector(PyObject* self, PyObject* args) {
         PyObject* high = nullptr;
         PyObject* low  = nullptr;
@@ -753,6 +1439,39 @@ namespace triton {
       }
 
 
+      static PyObject* triton_addBatchedCallback(PyObject* self, PyObject* args) {
+        PyObject* function = nullptr;
+        PyObject* mode     = nullptr;
+        PyObject* size     = nullptr;
+
+        /* Extract arguments */
+        PyArg_ParseTuple(args, "|OOO", &function, &mode, &size);
+
+        /* Check if the architecture is definied */
+        if (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "addBatchedCallback(): Architecture is not defined.");
+
+        if (function == nullptr || !PyCallable_Check(function))
+          return PyErr_Format(PyExc_TypeError, "addBatchedCallback(): Expects a function as first argument.");
+
+        if (mode == nullptr || (!PyLong_Check(mode) && !PyInt_Check(mode)))
+          return PyErr_Format(PyExc_TypeError, "addBatchedCallback(): Expects a CALLBACK as second argument.");
+
+        if (size == nullptr || (!PyLong_Check(size) && !PyInt_Check(size)))
+          return PyErr_Format(PyExc_TypeError, "addBatchedCallback(): Expects an integer as third argument.");
+
+        try {
+          triton::getCurrentApi().addBatchedCallback(function, static_cast<triton::callbacks::callback_e>(PyLong_AsUint32(mode)), PyLong_AsUsize(size));
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
       static PyObject* triton_addCallback(PyObject* self, PyObject* args) {
         PyObject* function = nullptr;
         PyObject* mode     = nullptr;
@@ -761,7 +1480,7 @@ namespace triton {
         PyArg_ParseTuple(args, "|OO", &function, &mode);
 
         /* Check if the architecture is definied */
-        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+        if (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_INVALID)
           return PyErr_Format(PyExc_TypeError, "addCallback(): Architecture is not defined.");
 
         if (function == nullptr || !PyCallable_Check(function))
@@ -771,7 +1490,113 @@ namespace triton {
           return PyErr_Format(PyExc_TypeError, "addCallback(): Expects a CALLBACK as second argument.");
 
         try {
-          triton::api.addCallback(function, static_cast<triton::callbacks::callback_e>(PyLong_AsUint32(mode)));
+          triton::getCurrentApi().addCallback(function, static_cast<triton::callbacks::callback_e>(PyLong_AsUint32(mode)));
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
+      static PyObject* triton_addFunctionSummaries(PyObject* self, PyObject* binary) {
+        /* Check if the architecture is definied */
+        if (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "addFunctionSummaries(): Architecture is not defined.");
+
+        if (!PyElf_Check(binary) && !PyPe_Check(binary))
+          return PyErr_Format(PyExc_TypeError, "addFunctionSummaries(): Expects an Elf or a Pe as argument.");
+
+        try {
+          if (PyElf_Check(binary))
+            return PyLong_FromUsize(triton::getCurrentApi().addFunctionSummaries(*PyElf_AsElf(binary)));
+          return PyLong_FromUsize(triton::getCurrentApi().addFunctionSummaries(*PyPe_AsPe(binary)));
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* triton_addFunctionSummary(PyObject* self, PyObject* args) {
+        PyObject* addr = nullptr;
+        PyObject* name = nullptr;
+
+        /* Extract arguments */
+        PyArg_ParseTuple(args, "|OO", &addr, &name);
+
+        /* Check if the architecture is definied */
+        if (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "addFunctionSummary(): Architecture is not defined.");
+
+        if (addr == nullptr || (!PyLong_Check(addr) && !PyInt_Check(addr)))
+          return PyErr_Format(PyExc_TypeError, "addFunctionSummary(): Expects an integer as first argument.");
+
+        if (name == nullptr || !PyString_Check(name))
+          return PyErr_Format(PyExc_TypeError, "addFunctionSummary(): Expects a string as second argument.");
+
+        try {
+          triton::getCurrentApi().addFunctionSummary(PyLong_AsUint64(addr), PyString_AsString(name));
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
+      static PyObject* triton_addLearnedFunctionSummary(PyObject* self, PyObject* args) {
+        PyObject* addr = nullptr;
+        PyObject* argc = nullptr;
+
+        /* Extract arguments */
+        PyArg_ParseTuple(args, "|OO", &addr, &argc);
+
+        /* Check if the architecture is definied */
+        if (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "addLearnedFunctionSummary(): Architecture is not defined.");
+
+        if (addr == nullptr || (!PyLong_Check(addr) && !PyInt_Check(addr)))
+          return PyErr_Format(PyExc_TypeError, "addLearnedFunctionSummary(): Expects an integer as first argument.");
+
+        if (argc == nullptr || (!PyLong_Check(argc) && !PyInt_Check(argc)))
+          return PyErr_Format(PyExc_TypeError, "addLearnedFunctionSummary(): Expects an integer as second argument.");
+
+        try {
+          triton::getCurrentApi().addLearnedFunctionSummary(PyLong_AsUint64(addr), PyLong_AsUint32(argc));
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
+      static PyObject* triton_addSymbolicRegion(PyObject* self, PyObject* args) {
+        PyObject* start = nullptr;
+        PyObject* end   = nullptr;
+
+        /* Extract arguments */
+        PyArg_ParseTuple(args, "|OO", &start, &end);
+
+        /* Check if the architecture is definied */
+        if (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "addSymbolicRegion(): Architecture is not defined.");
+
+        if (start == nullptr || (!PyLong_Check(start) && !PyInt_Check(start)))
+          return PyErr_Format(PyExc_TypeError, "addSymbolicRegion(): Expects an integer as first argument.");
+
+        if (end == nullptr || (!PyLong_Check(end) && !PyInt_Check(end)))
+          return PyErr_Format(PyExc_TypeError, "addSymbolicRegion(): Expects an integer as second argument.");
+
+        try {
+          triton::getCurrentApi().addSymbolicRegion(PyLong_AsUint64(start), PyLong_AsUint64(end));
         }
         catch (const triton::exceptions::Exception& e) {
           return PyErr_Format(PyExc_TypeError, "%s", e.what());
@@ -790,7 +1615,7 @@ namespace triton {
         PyArg_ParseTuple(args, "|OO", &se, &mem);
 
         /* Check if the architecture is definied */
-        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+        if (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_INVALID)
           return PyErr_Format(PyExc_TypeError, "assignSymbolicExpressionToMemory(): Architecture is not defined.");
 
         if (se == nullptr || (!PySymbolicExpression_Check(se)))
@@ -803,7 +1628,7 @@ namespace triton {
         triton::arch::MemoryAccess arg2 = *PyMemoryAccess_AsMemoryAccess(mem);
 
         try {
-          triton::api.assignSymbolicExpressionToMemory(arg1, arg2);
+          triton::getCurrentApi().assignSymbolicExpressionToMemory(arg1, arg2);
         }
         catch (const triton::exceptions::Exception& e) {
           return PyErr_Format(PyExc_TypeError, "%s", e.what());
@@ -822,7 +1647,7 @@ namespace triton {
         PyArg_ParseTuple(args, "|OO", &se, &reg);
 
         /* Check if the architecture is definied */
-        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+        if (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_INVALID)
           return PyErr_Format(PyExc_TypeError, "assignSymbolicExpressionToRegister(): Architecture is not defined.");
 
         if (se == nullptr || (!PySymbolicExpression_Check(se)))
@@ -835,7 +1660,7 @@ namespace triton {
         triton::arch::Register arg2 = *PyRegister_AsRegister(reg);
 
         try {
-          triton::api.assignSymbolicExpressionToRegister(arg1, arg2);
+          triton::getCurrentApi().assignSymbolicExpressionToRegister(arg1, arg2);
         }
         catch (const triton::exceptions::Exception& e) {
           return PyErr_Format(PyExc_TypeError, "%s", e.what());
@@ -848,14 +1673,14 @@ namespace triton {
 
       static PyObject* triton_buildSemantics(PyObject* self, PyObject* inst) {
         /* Check if the architecture is definied */
-        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+        if (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_INVALID)
           return PyErr_Format(PyExc_TypeError, "buildSemantics(): Architecture is not defined.");
 
         if (!PyInstruction_Check(inst))
           return PyErr_Format(PyExc_TypeError, "buildSemantics(): Expects an Instruction as argument.");
 
         try {
-          if (triton::api.buildSemantics(*PyInstruction_AsInstruction(inst)))
+          if (triton::getCurrentApi().buildSemantics(*PyInstruction_AsInstruction(inst)))
             Py_RETURN_TRUE;
           Py_RETURN_FALSE;
         }
@@ -867,14 +1692,14 @@ namespace triton {
 
       static PyObject* triton_buildSymbolicImmediate(PyObject* self, PyObject* imm) {
         /* Check if the architecture is definied */
-        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+        if (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_INVALID)
           return PyErr_Format(PyExc_TypeError, "buildSymbolicImmediate(): Architecture is not defined.");
 
         if (!PyImmediate_Check(imm))
           return PyErr_Format(PyExc_TypeError, "buildSymbolicImmediate(): Expects an Immediate as argument.");
 
         try {
-          return PyAstNode(triton::api.buildSymbolicImmediate(*PyImmediate_AsImmediate(imm)));
+          return PyAstNode(triton::getCurrentApi().buildSymbolicImmediate(*PyImmediate_AsImmediate(imm)));
         }
         catch (const triton::exceptions::Exception& e) {
           return PyErr_Format(PyExc_TypeError, "%s", e.what());
@@ -884,14 +1709,14 @@ namespace triton {
 
       static PyObject* triton_buildSymbolicMemory(PyObject* self, PyObject* mem) {
         /* Check if the architecture is definied */
-        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+        if (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_INVALID)
           return PyErr_Format(PyExc_TypeError, "buildSymbolicMemory(): Architecture is not defined.");
 
         if (!PyMemoryAccess_Check(mem))
           return PyErr_Format(PyExc_TypeError, "buildSymbolicMemory(): Expects an MemoryAccess as argument.");
 
         try {
-          return PyAstNode(triton::api.buildSymbolicMemory(*PyMemoryAccess_AsMemoryAccess(mem)));
+          return PyAstNode(triton::getCurrentApi().buildSymbolicMemory(*PyMemoryAccess_AsMemoryAccess(mem)));
         }
         catch (const triton::exceptions::Exception& e) {
           return PyErr_Format(PyExc_TypeError, "%s", e.what());
@@ -901,14 +1726,14 @@ namespace triton {
 
       static PyObject* triton_buildSymbolicRegister(PyObject* self, PyObject* reg) {
         /* Check if the architecture is definied */
-        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+        if (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_INVALID)
           return PyErr_Format(PyExc_TypeError, "buildSymbolicRegister(): Architecture is not defined.");
 
         if (!PyRegister_Check(reg))
           return PyErr_Format(PyExc_TypeError, "buildSymbolicRegister(): Expects an Register as argument.");
 
         try {
-          return PyAstNode(triton::api.buildSymbolicRegister(*PyRegister_AsRegister(reg)));
+          return PyAstNode(triton::getCurrentApi().buildSymbolicRegister(*PyRegister_AsRegister(reg)));
         }
         catch (const triton::exceptions::Exception& e) {
           return PyErr_Format(PyExc_TypeError, "%s", e.what());
@@ -916,21 +1741,151 @@ namespace triton {
       }
 
 
-      static PyObject* triton_clearPathConstraints(PyObject* self, PyObject* noarg) {
+      static PyObject* triton_checkpoint(PyObject* self, PyObject* noarg) {
         /* Check if the architecture is definied */
-        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
-          return PyErr_Format(PyExc_TypeError, "clearPathConstraints(): Architecture is not defined.");
-        triton::api.clearPathConstraints();
-        Py_INCREF(Py_None);
-        return Py_None;
-      }
+        if (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "checkpoint(): Architecture is not defined.");
 
-
-      static PyObject* triton_concretizeAllMemory(PyObject* self, PyObject* noarg) {
-        /* Check if the architecture is definied */
-        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
-          return PyErr_Format(PyExc_TypeError, "concretizeAllMemory(): Architecture is not defined.");
-        triton::api.concretizeAllMemory();
+        try {
+          return PyLong_FromUsize(triton::getCurrentApi().checkpoint());
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* triton_clearExpressionProfile(PyObject* self, PyObject* noarg) {
+        /* Check if the architecture is definied */
+        if (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "clearExpressionProfile(): Architecture is not defined.");
+
+        try {
+          triton::getCurrentApi().clearExpressionProfile();
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
+      static PyObject* triton_clearOpcodeProfile(PyObject* self, PyObject* noarg) {
+        /* Check if the architecture is definied */
+        if (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "clearOpcodeProfile(): Architecture is not defined.");
+
+        try {
+          triton::getCurrentApi().clearOpcodeProfile();
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
+      static PyObject* triton_clearPathConstraints(PyObject* self, PyObject* noarg) {
+        /* Check if the architecture is definied */
+        if (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "clearPathConstraints(): Architecture is not defined.");
+        triton::getCurrentApi().clearPathConstraints();
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
+      static PyObject* triton_clearPerfCounters(PyObject* self, PyObject* noarg) {
+        triton::getCurrentApi().clearPerfCounters();
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
+      static PyObject* triton_clearPointerPolicies(PyObject* self, PyObject* noarg) {
+        /* Check if the architecture is definied */
+        if (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "clearPointerPolicies(): Architecture is not defined.");
+
+        try {
+          triton::getCurrentApi().clearPointerPolicies();
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
+      static PyObject* triton_clearQueryCache(PyObject* self, PyObject* noarg) {
+        /* Check if the architecture is definied */
+        if (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "clearQueryCache(): Architecture is not defined.");
+
+        try {
+          triton::getCurrentApi().clearQueryCache();
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
+      static PyObject* triton_clearSymbolicRegions(PyObject* self, PyObject* noarg) {
+        /* Check if the architecture is definied */
+        if (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "clearSymbolicRegions(): Architecture is not defined.");
+
+        try {
+          triton::getCurrentApi().clearSymbolicRegions();
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
+      static PyObject* triton_clearTraceEvents(PyObject* self, PyObject* noarg) {
+        triton::getCurrentApi().clearTraceEvents();
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
+      static PyObject* triton_collectUnreachableExpressions(PyObject* self, PyObject* noarg) {
+        /* Check if the architecture is definied */
+        if (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "collectUnreachableExpressions(): Architecture is not defined.");
+
+        try {
+          triton::getCurrentApi().collectUnreachableExpressions();
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
+      static PyObject* triton_concretizeAllMemory(PyObject* self, PyObject* noarg) {
+        /* Check if the architecture is definied */
+        if (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "concretizeAllMemory(): Architecture is not defined.");
+        triton::getCurrentApi().concretizeAllMemory();
         Py_INCREF(Py_None);
         return Py_None;
       }
@@ -938,9 +1893,9 @@ namespace triton {
 
       static PyObject* triton_concretizeAllRegister(PyObject* self, PyObject* noarg) {
         /* Check if the architecture is definied */
-        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+        if (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_INVALID)
           return PyErr_Format(PyExc_TypeError, "concretizeAllRegister(): Architecture is not defined.");
-        triton::api.concretizeAllRegister();
+        triton::getCurrentApi().concretizeAllRegister();
         Py_INCREF(Py_None);
         return Py_None;
       }
@@ -948,13 +1903,13 @@ namespace triton {
 
       static PyObject* triton_concretizeMemory(PyObject* self, PyObject* mem) {
         /* Check if the architecture is definied */
-        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+        if (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_INVALID)
           return PyErr_Format(PyExc_TypeError, "concretizeMemory(): Architecture is not defined.");
 
         /* If mem is an address */
         if (PyLong_Check(mem) || PyInt_Check(mem)) {
           try {
-            triton::api.concretizeMemory(PyLong_AsUint64(mem));
+            triton::getCurrentApi().concretizeMemory(PyLong_AsUint64(mem));
           }
           catch (const triton::exceptions::Exception& e) {
             return PyErr_Format(PyExc_TypeError, "%s", e.what());
@@ -964,7 +1919,7 @@ namespace triton {
         /* If mem is a MemoryAccess */
         else if (PyMemoryAccess_Check(mem)) {
           try {
-            triton::api.concretizeMemory(*PyMemoryAccess_AsMemoryAccess(mem));
+            triton::getCurrentApi().concretizeMemory(*PyMemoryAccess_AsMemoryAccess(mem));
           }
           catch (const triton::exceptions::Exception& e) {
             return PyErr_Format(PyExc_TypeError, "%s", e.what());
@@ -982,14 +1937,14 @@ namespace triton {
 
       static PyObject* triton_concretizeRegister(PyObject* self, PyObject* reg) {
         /* Check if the architecture is definied */
-        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+        if (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_INVALID)
           return PyErr_Format(PyExc_TypeError, "concretizeRegister(): Architecture is not defined.");
 
         if (!PyRegister_Check(reg))
           return PyErr_Format(PyExc_TypeError, "concretizeRegister(): Expects a REG as argument.");
 
         try {
-          triton::api.concretizeRegister(*PyRegister_AsRegister(reg));
+          triton::getCurrentApi().concretizeRegister(*PyRegister_AsRegister(reg));
         }
         catch (const triton::exceptions::Exception& e) {
           return PyErr_Format(PyExc_TypeError, "%s", e.what());
@@ -1010,7 +1965,7 @@ namespace triton {
         PyArg_ParseTuple(args, "|OOO", &exprId, &symVarSize, &comment);
 
         /* Check if the architecture is definied */
-        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+        if (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_INVALID)
           return PyErr_Format(PyExc_TypeError, "convertExpressionToSymbolicVariable(): Architecture is not defined.");
 
         if (exprId == nullptr || (!PyLong_Check(exprId) && !PyInt_Check(exprId)))
@@ -1026,7 +1981,56 @@ namespace triton {
           ccomment = PyString_AsString(comment);
 
         try {
-          return PySymbolicVariable(triton::api.convertExpressionToSymbolicVariable(PyLong_AsUsize(exprId), PyLong_AsUint32(symVarSize), ccomment));
+          return PySymbolicVariable(triton::getCurrentApi().convertExpressionToSymbolicVariable(PyLong_AsUsize(exprId), PyLong_AsUint32(symVarSize), ccomment));
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* triton_convertMemoryAreaToSymbolicVariables(PyObject* self, PyObject* args) {
+        PyObject* baseAddr      = nullptr;
+        PyObject* size          = nullptr;
+        PyObject* comment       = nullptr;
+        PyObject* wordSize      = nullptr;
+        PyObject* ret           = nullptr;
+        std::string ccomment    = "";
+        triton::uint32 cwordSize = BYTE_SIZE;
+
+        /* Extract arguments */
+        PyArg_ParseTuple(args, "|OOOO", &baseAddr, &size, &comment, &wordSize);
+
+        /* Check if the architecture is definied */
+        if (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "convertMemoryAreaToSymbolicVariables(): Architecture is not defined.");
+
+        if (baseAddr == nullptr || (!PyLong_Check(baseAddr) && !PyInt_Check(baseAddr)))
+          return PyErr_Format(PyExc_TypeError, "convertMemoryAreaToSymbolicVariables(): Expects a base address (integer) as first argument.");
+
+        if (size == nullptr || (!PyLong_Check(size) && !PyInt_Check(size)))
+          return PyErr_Format(PyExc_TypeError, "convertMemoryAreaToSymbolicVariables(): Expects a size (integer) as second argument.");
+
+        if (comment != nullptr && !PyString_Check(comment))
+          return PyErr_Format(PyExc_TypeError, "convertMemoryAreaToSymbolicVariables(): Expects a sting as third argument.");
+
+        if (wordSize != nullptr && (!PyLong_Check(wordSize) && !PyInt_Check(wordSize)))
+          return PyErr_Format(PyExc_TypeError, "convertMemoryAreaToSymbolicVariables(): Expects a word size (integer) as fourth argument.");
+
+        if (comment != nullptr)
+          ccomment = PyString_AsString(comment);
+
+        if (wordSize != nullptr)
+          cwordSize = PyLong_AsUint32(wordSize);
+
+        try {
+          std::vector<triton::engines::symbolic::SymbolicVariable*> symVars = triton::getCurrentApi().convertMemoryAreaToSymbolicVariables(PyLong_AsUint64(baseAddr), PyLong_AsUsize(size), ccomment, cwordSize);
+
+          ret = xPyList_New(symVars.size());
+          for (triton::usize index = 0; index < symVars.size(); index++)
+            PyList_SetItem(ret, index, PySymbolicVariable(symVars[index]));
+
+          return ret;
         }
         catch (const triton::exceptions::Exception& e) {
           return PyErr_Format(PyExc_TypeError, "%s", e.what());
@@ -1043,7 +2047,7 @@ namespace triton {
         PyArg_ParseTuple(args, "|OO", &mem, &comment);
 
         /* Check if the architecture is definied */
-        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+        if (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_INVALID)
           return PyErr_Format(PyExc_TypeError, "convertMemoryToSymbolicVariable(): Architecture is not defined.");
 
         if (mem == nullptr || (!PyMemoryAccess_Check(mem)))
@@ -1056,7 +2060,7 @@ namespace triton {
           ccomment = PyString_AsString(comment);
 
         try {
-          return PySymbolicVariable(triton::api.convertMemoryToSymbolicVariable(*PyMemoryAccess_AsMemoryAccess(mem), ccomment));
+          return PySymbolicVariable(triton::getCurrentApi().convertMemoryToSymbolicVariable(*PyMemoryAccess_AsMemoryAccess(mem), ccomment));
         }
         catch (const triton::exceptions::Exception& e) {
           return PyErr_Format(PyExc_TypeError, "%s", e.what());
@@ -1073,7 +2077,7 @@ namespace triton {
         PyArg_ParseTuple(args, "|OO", &reg, &comment);
 
         /* Check if the architecture is definied */
-        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+        if (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_INVALID)
           return PyErr_Format(PyExc_TypeError, "convertRegisterToSymbolicVariable(): Architecture is not defined.");
 
         if (reg == nullptr || (!PyRegister_Check(reg)))
@@ -1086,7 +2090,7 @@ namespace triton {
           ccomment = PyString_AsString(comment);
 
         try {
-          return PySymbolicVariable(triton::api.convertRegisterToSymbolicVariable(*PyRegister_AsRegister(reg), ccomment));
+          return PySymbolicVariable(triton::getCurrentApi().convertRegisterToSymbolicVariable(*PyRegister_AsRegister(reg), ccomment));
         }
         catch (const triton::exceptions::Exception& e) {
           return PyErr_Format(PyExc_TypeError, "%s", e.what());
@@ -1095,12 +2099,12 @@ namespace triton {
 
 
       static PyObject* triton_cpuRegisterBitSize(PyObject* self, PyObject* noarg) {
-        return PyLong_FromUint32(triton::api.cpuRegisterBitSize());
+        return PyLong_FromUint32(triton::getCurrentApi().cpuRegisterBitSize());
       }
 
 
       static PyObject* triton_cpuRegisterSize(PyObject* self, PyObject* noarg) {
-        return PyLong_FromUint32(triton::api.cpuRegisterSize());
+        return PyLong_FromUint32(triton::getCurrentApi().cpuRegisterSize());
       }
 
 
@@ -1115,7 +2119,7 @@ namespace triton {
         PyArg_ParseTuple(args, "|OOOO", &inst, &node, &flag, &comment);
 
         /* Check if the architecture is definied */
-        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+        if (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_INVALID)
           return PyErr_Format(PyExc_TypeError, "createSymbolicFlagExpression(): Architecture is not defined.");
 
         if (inst == nullptr || (!PyInstance_Check(inst)))
@@ -1138,7 +2142,7 @@ namespace triton {
         triton::arch::Register arg3 = *PyRegister_AsRegister(flag);
 
         try {
-          return PySymbolicExpression(triton::api.createSymbolicFlagExpression(arg1, arg2, arg3, ccomment));
+          return PySymbolicExpression(triton::getCurrentApi().createSymbolicFlagExpression(arg1, arg2, arg3, ccomment));
         }
         catch (const triton::exceptions::Exception& e) {
           return PyErr_Format(PyExc_TypeError, "%s", e.what());
@@ -1157,7 +2161,7 @@ namespace triton {
         PyArg_ParseTuple(args, "|OOOO", &inst, &node, &mem, &comment);
 
         /* Check if the architecture is definied */
-        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+        if (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_INVALID)
           return PyErr_Format(PyExc_TypeError, "createSymbolicMemoryExpression(): Architecture is not defined.");
 
         if (inst == nullptr || (!PyInstance_Check(inst)))
@@ -1180,7 +2184,7 @@ namespace triton {
         triton::arch::MemoryAccess arg3 = *PyMemoryAccess_AsMemoryAccess(mem);
 
         try {
-          return PySymbolicExpression(triton::api.createSymbolicMemoryExpression(arg1, arg2, arg3, ccomment));
+          return PySymbolicExpression(triton::getCurrentApi().createSymbolicMemoryExpression(arg1, arg2, arg3, ccomment));
         }
         catch (const triton::exceptions::Exception& e) {
           return PyErr_Format(PyExc_TypeError, "%s", e.what());
@@ -1199,7 +2203,7 @@ namespace triton {
         PyArg_ParseTuple(args, "|OOOO", &inst, &node, &reg, &comment);
 
         /* Check if the architecture is definied */
-        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+        if (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_INVALID)
           return PyErr_Format(PyExc_TypeError, "createSymbolicRegisterExpression(): Architecture is not defined.");
 
         if (inst == nullptr || (!PyInstance_Check(inst)))
@@ -1222,7 +2226,7 @@ namespace triton {
         triton::arch::Register arg3 = *PyRegister_AsRegister(reg);
 
         try {
-          return PySymbolicExpression(triton::api.createSymbolicRegisterExpression(arg1, arg2, arg3, ccomment));
+          return PySymbolicExpression(triton::getCurrentApi().createSymbolicRegisterExpression(arg1, arg2, arg3, ccomment));
         }
         catch (const triton::exceptions::Exception& e) {
           return PyErr_Format(PyExc_TypeError, "%s", e.what());
@@ -1240,7 +2244,7 @@ namespace triton {
         PyArg_ParseTuple(args, "|OOO", &inst, &node, &comment);
 
         /* Check if the architecture is definied */
-        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+        if (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_INVALID)
           return PyErr_Format(PyExc_TypeError, "createSymbolicVolatileExpression(): Architecture is not defined.");
 
         if (inst == nullptr || (!PyInstance_Check(inst)))
@@ -1259,7 +2263,7 @@ namespace triton {
         triton::ast::AbstractNode *arg2 = PyAstNode_AsAstNode(node);
 
         try {
-          return PySymbolicExpression(triton::api.createSymbolicVolatileExpression(arg1, arg2, ccomment));
+          return PySymbolicExpression(triton::getCurrentApi().createSymbolicVolatileExpression(arg1, arg2, ccomment));
         }
         catch (const triton::exceptions::Exception& e) {
           return PyErr_Format(PyExc_TypeError, "%s", e.what());
@@ -1267,45 +2271,44 @@ namespace triton {
       }
 
 
-      static PyObject* triton_disassembly(PyObject* self, PyObject* inst) {
+      static PyObject* triton_deserializeAsts(PyObject* self, PyObject* data) {
+        std::vector<triton::ast::AbstractNode*> asts;
+        PyObject* ret = nullptr;
+
         /* Check if the architecture is definied */
-        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
-          return PyErr_Format(PyExc_TypeError, "disassembly(): Architecture is not defined.");
+        if (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "deserializeAsts(): Architecture is not defined.");
 
-        if (!PyInstruction_Check(inst))
-          return PyErr_Format(PyExc_TypeError, "disassembly(): Expects an Instruction as argument.");
+        if (!PyBytes_Check(data))
+          return PyErr_Format(PyExc_TypeError, "deserializeAsts(): Expects bytes as argument.");
 
         try {
-          triton::api.disassembly(*PyInstruction_AsInstruction(inst));
+          std::istringstream stream(std::string(PyBytes_AsString(data), PyBytes_Size(data)));
+          asts = triton::getCurrentApi().deserializeAsts(stream);
         }
         catch (const triton::exceptions::Exception& e) {
           return PyErr_Format(PyExc_TypeError, "%s", e.what());
         }
 
-        Py_INCREF(Py_None);
-        return Py_None;
-      }
-
+        ret = xPyList_New(asts.size());
+        for (triton::usize index = 0; index < asts.size(); index++)
+          PyList_SetItem(ret, index, PyAstNode(asts[index]));
 
-      static PyObject* triton_enableMode(PyObject* self, PyObject* args) {
-        PyObject* mode = nullptr;
-        PyObject* flag = nullptr;
+        return ret;
+      }
 
-        /* Extract arguments */
-        PyArg_ParseTuple(args, "|OO", &mode, &flag);
 
+      static PyObject* triton_deserializeSymbolicState(PyObject* self, PyObject* data) {
         /* Check if the architecture is definied */
-        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
-          return PyErr_Format(PyExc_TypeError, "enableMode(): Architecture is not defined.");
-
-        if (mode == nullptr || (!PyLong_Check(mode) && !PyInt_Check(mode)))
-          return PyErr_Format(PyExc_TypeError, "enableMode(): Expects a MODE as argument.");
+        if (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "deserializeSymbolicState(): Architecture is not defined.");
 
-        if (flag == nullptr || !PyBool_Check(flag))
-          return PyErr_Format(PyExc_TypeError, "enableMode(): Expects an boolean flag as second argument.");
+        if (!PyBytes_Check(data))
+          return PyErr_Format(PyExc_TypeError, "deserializeSymbolicState(): Expects bytes as argument.");
 
         try {
-          triton::api.enableMode(static_cast<enum triton::modes::mode_e>(PyLong_AsUint32(mode)), PyLong_AsBool(flag));
+          std::istringstream stream(std::string(PyBytes_AsString(data), PyBytes_Size(data)));
+          triton::getCurrentApi().deserializeSymbolicState(stream);
         }
         catch (const triton::exceptions::Exception& e) {
           return PyErr_Format(PyExc_TypeError, "%s", e.what());
@@ -1316,16 +2319,16 @@ namespace triton {
       }
 
 
-      static PyObject* triton_enableSymbolicEngine(PyObject* self, PyObject* flag) {
+      static PyObject* triton_disassembly(PyObject* self, PyObject* inst) {
         /* Check if the architecture is definied */
-        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
-          return PyErr_Format(PyExc_TypeError, "enableSymbolicEngine(): Architecture is not defined.");
+        if (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "disassembly(): Architecture is not defined.");
 
-        if (!PyBool_Check(flag))
-          return PyErr_Format(PyExc_TypeError, "enableSymbolicEngine(): Expects an boolean as argument.");
+        if (!PyInstruction_Check(inst))
+          return PyErr_Format(PyExc_TypeError, "disassembly(): Expects an Instruction as argument.");
 
         try {
-          triton::api.enableSymbolicEngine(PyLong_AsBool(flag));
+          triton::getCurrentApi().disassembly(*PyInstruction_AsInstruction(inst));
         }
         catch (const triton::exceptions::Exception& e) {
           return PyErr_Format(PyExc_TypeError, "%s", e.what());
@@ -1336,109 +2339,109 @@ namespace triton {
       }
 
 
-      static PyObject* triton_enableTaintEngine(PyObject* self, PyObject* flag) {
+      static PyObject* triton_dumpExpressionProfile(PyObject* self, PyObject* args) {
+        PyObject* count = nullptr;
+        PyObject* json  = nullptr;
+        std::ostringstream stream;
+
+        /* Extract arguments */
+        PyArg_ParseTuple(args, "|OO", &count, &json);
+
         /* Check if the architecture is definied */
-        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
-          return PyErr_Format(PyExc_TypeError, "enableTaintEngine(): Architecture is not defined.");
+        if (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "dumpExpressionProfile(): Architecture is not defined.");
 
-        if (!PyBool_Check(flag))
-          return PyErr_Format(PyExc_TypeError, "enableTaintEngine(): Expects an boolean as argument.");
+        if (count != nullptr && !PyLong_Check(count) && !PyInt_Check(count))
+          return PyErr_Format(PyExc_TypeError, "dumpExpressionProfile(): Expects an integer as first argument.");
+
+        if (json != nullptr && !PyBool_Check(json))
+          return PyErr_Format(PyExc_TypeError, "dumpExpressionProfile(): Expects a boolean as second argument.");
 
         try {
-          triton::api.enableTaintEngine(PyLong_AsBool(flag));
+          triton::getCurrentApi().dumpExpressionProfile(stream, (count != nullptr ? PyLong_AsUsize(count) : 0), json != nullptr && PyLong_AsBool(json));
         }
         catch (const triton::exceptions::Exception& e) {
           return PyErr_Format(PyExc_TypeError, "%s", e.what());
         }
 
-        Py_INCREF(Py_None);
-        return Py_None;
+        return PyString_FromString(stream.str().c_str());
       }
 
 
-      static PyObject* triton_evaluateAstViaZ3(PyObject* self, PyObject* node) {
+      static PyObject* triton_dumpOpcodeProfile(PyObject* self, PyObject* args) {
+        PyObject* json = nullptr;
+        std::ostringstream stream;
+
+        /* Extract arguments */
+        PyArg_ParseTuple(args, "|O", &json);
+
         /* Check if the architecture is definied */
-        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
-          return PyErr_Format(PyExc_TypeError, "evaluateAstViaZ3(): Architecture is not defined.");
+        if (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "dumpOpcodeProfile(): Architecture is not defined.");
 
-        if (!PyAstNode_Check(node))
-          return PyErr_Format(PyExc_TypeError, "evaluateAstViaZ3(): Expects a AstNode as argument.");
+        if (json != nullptr && !PyBool_Check(json))
+          return PyErr_Format(PyExc_TypeError, "dumpOpcodeProfile(): Expects a boolean as argument.");
 
         try {
-          return PyLong_FromUint512(triton::api.evaluateAstViaZ3(PyAstNode_AsAstNode(node)));
+          triton::getCurrentApi().dumpOpcodeProfile(stream, json != nullptr && PyLong_AsBool(json));
         }
         catch (const triton::exceptions::Exception& e) {
           return PyErr_Format(PyExc_TypeError, "%s", e.what());
         }
-        catch (const z3::exception& e) {
-          return PyErr_Format(PyExc_TypeError, "%s", e.msg());
-        }
 
-        Py_INCREF(Py_None);
-        return Py_None;
+        return PyString_FromString(stream.str().c_str());
       }
 
 
-      static PyObject* triton_getAllRegisters(PyObject* self, PyObject* noarg) {
-        PyObject* ret = nullptr;
-
-        /* Check if the architecture is definied */
-        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
-          return PyErr_Format(PyExc_TypeError, "getAllRegisters(): Architecture is not defined.");
+      static PyObject* triton_dumpTraceEvents(PyObject* self, PyObject* noarg) {
+        std::ostringstream stream;
 
         try {
-          triton::uint32 index = 0;
-          std::set<triton::arch::Register*> reg = triton::api.getAllRegisters();
-
-          ret = xPyList_New(reg.size());
-          for (auto it = reg.begin(); it != reg.end(); it++)
-            PyList_SetItem(ret, index++, PyRegister(**it));
+          triton::getCurrentApi().dumpTraceEvents(stream);
         }
         catch (const triton::exceptions::Exception& e) {
           return PyErr_Format(PyExc_TypeError, "%s", e.what());
         }
 
-        return ret;
+        return PyString_FromString(stream.str().c_str());
       }
 
 
-      static PyObject* triton_getArchitecture(PyObject* self, PyObject* noarg) {
-        return PyLong_FromUint32(triton::api.getArchitecture());
-      }
+      static PyObject* triton_emulate(PyObject* self, PyObject* args) {
+        std::set<triton::uint64> stopAddresses;
+        PyObject* start    = nullptr;
+        PyObject* stops    = nullptr;
+        PyObject* maxInsns = nullptr;
 
-
-      static PyObject* triton_getAstDictionariesStats(PyObject* self, PyObject* noarg) {
-        PyObject* ret = nullptr;
+        /* Extract arguments */
+        PyArg_ParseTuple(args, "|OOO", &start, &stops, &maxInsns);
 
         /* Check if the architecture is definied */
-        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
-          return PyErr_Format(PyExc_TypeError, "getAstDictionariesStats(): Architecture is not defined.");
+        if (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "emulate(): Architecture is not defined.");
 
-        try {
-          std::map<std::string, triton::usize> stats = triton::api.getAstDictionariesStats();
+        if (start == nullptr || (!PyLong_Check(start) && !PyInt_Check(start)))
+          return PyErr_Format(PyExc_TypeError, "emulate(): Expects an integer as first argument.");
 
-          ret = xPyDict_New();
-          for (auto it = stats.begin(); it != stats.end(); it++)
-            PyDict_SetItem(ret, PyString_FromString(it->first.c_str()), PyLong_FromUsize(it->second));
-        }
-        catch (const triton::exceptions::Exception& e) {
-          return PyErr_Format(PyExc_TypeError, "%s", e.what());
-        }
+        if (stops != nullptr && !PyList_Check(stops))
+          return PyErr_Format(PyExc_TypeError, "emulate(): Expects a list of integers as second argument.");
 
-        return ret;
-      }
+        if (maxInsns != nullptr && (!PyLong_Check(maxInsns) && !PyInt_Check(maxInsns)))
+          return PyErr_Format(PyExc_TypeError, "emulate(): Expects an integer as third argument.");
 
+        if (stops != nullptr) {
+          for (Py_ssize_t i = 0; i < PyList_Size(stops); i++) {
+            PyObject* item = PyList_GetItem(stops, i);
 
-      static PyObject* triton_getAstFromId(PyObject* self, PyObject* symExprId) {
-        /* Check if the architecture is definied */
-        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
-          return PyErr_Format(PyExc_TypeError, "getAstFromId(): Architecture is not defined.");
+            if (!PyLong_Check(item) && !PyInt_Check(item))
+              return PyErr_Format(PyExc_TypeError, "emulate(): Each item of the list must be an integer.");
 
-        if (!PyLong_Check(symExprId) && !PyInt_Check(symExprId))
-          return PyErr_Format(PyExc_TypeError, "getAstFromId(): Expects an integer as argument.");
+            stopAddresses.insert(PyLong_AsUint64(item));
+          }
+        }
 
         try {
-          return PyAstNode(triton::api.getAstFromId(PyLong_AsUsize(symExprId)));
+          return PyLong_FromUsize(triton::getCurrentApi().emulate(PyLong_AsUint64(start), stopAddresses, maxInsns != nullptr ? PyLong_AsUsize(maxInsns) : 0));
         }
         catch (const triton::exceptions::Exception& e) {
           return PyErr_Format(PyExc_TypeError, "%s", e.what());
@@ -1446,237 +2449,281 @@ namespace triton {
       }
 
 
-      static PyObject* triton_getAstRepresentationMode(PyObject* self, PyObject* noarg) {
-        /* Check if the architecture is definied */
-        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
-          return PyErr_Format(PyExc_TypeError, "getAstRepresentationMode(): Architecture is not defined.");
-        return PyLong_FromUint32(triton::api.getAstRepresentationMode());
-      }
-
-
-      static PyObject* triton_getConcreteMemoryAreaValue(PyObject* self, PyObject* args) {
-        triton::uint8*  area = nullptr;
-        PyObject*       ret  = nullptr;
-        PyObject*       addr = nullptr;
-        PyObject*       size = nullptr;
+      static PyObject* triton_enableMode(PyObject* self, PyObject* args) {
+        PyObject* mode = nullptr;
+        PyObject* flag = nullptr;
 
         /* Extract arguments */
-        PyArg_ParseTuple(args, "|OO", &addr, &size);
+        PyArg_ParseTuple(args, "|OO", &mode, &flag);
 
         /* Check if the architecture is definied */
-        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
-          return PyErr_Format(PyExc_TypeError, "getConcreteMemoryAreaValue(): Architecture is not defined.");
-
-        try {
-          std::vector<triton::uint8> vv = triton::api.getConcreteMemoryAreaValue(PyLong_AsUint64(addr), PyLong_AsUsize(size));
-          area = new triton::uint8[vv.size()];
+        if (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "enableMode(): Architecture is not defined.");
 
-          for (triton::usize index = 0; index < vv.size(); index++)
-            area[index] = vv[index];
+        if (mode == nullptr || (!PyLong_Check(mode) && !PyInt_Check(mode)))
+          return PyErr_Format(PyExc_TypeError, "enableMode(): Expects a MODE as argument.");
 
-          ret = PyBytes_FromStringAndSize(reinterpret_cast<const char*>(area), vv.size());
-          delete[] area;
-          return ret;
+        if (flag == nullptr || !PyBool_Check(flag))
+          return PyErr_Format(PyExc_TypeError, "enableMode(): Expects an boolean flag as second argument.");
 
+        try {
+          triton::getCurrentApi().enableMode(static_cast<enum triton::modes::mode_e>(PyLong_AsUint32(mode)), PyLong_AsBool(flag));
         }
         catch (const triton::exceptions::Exception& e) {
           return PyErr_Format(PyExc_TypeError, "%s", e.what());
         }
 
-        return ret;
+        Py_INCREF(Py_None);
+        return Py_None;
       }
 
 
-      static PyObject* triton_getConcreteMemoryValue(PyObject* self, PyObject* mem) {
+      static PyObject* triton_enableSymbolicEngine(PyObject* self, PyObject* flag) {
         /* Check if the architecture is definied */
-        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
-          return PyErr_Format(PyExc_TypeError, "getConcreteMemoryValue(): Architecture is not defined.");
+        if (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "enableSymbolicEngine(): Architecture is not defined.");
+
+        if (!PyBool_Check(flag))
+          return PyErr_Format(PyExc_TypeError, "enableSymbolicEngine(): Expects an boolean as argument.");
 
         try {
-          if (PyLong_Check(mem) || PyInt_Check(mem))
-              return PyLong_FromUint512(triton::api.getConcreteMemoryValue(PyLong_AsUint64(mem)));
-          else if (PyMemoryAccess_Check(mem))
-              return PyLong_FromUint512(triton::api.getConcreteMemoryValue(*PyMemoryAccess_AsMemoryAccess(mem)));
-          else
-            return PyErr_Format(PyExc_TypeError, "getConcreteMemoryValue(): Expects a MemoryAccess or an integer as argument.");
+          triton::getCurrentApi().enableSymbolicEngine(PyLong_AsBool(flag));
         }
         catch (const triton::exceptions::Exception& e) {
           return PyErr_Format(PyExc_TypeError, "%s", e.what());
         }
-      }
-
-
-      static PyObject* triton_getConcreteRegisterValue(PyObject* self, PyObject* reg) {
-        /* Check if the architecture is definied */
-        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
-          return PyErr_Format(PyExc_TypeError, "getConcreteRegisterValue(): Architecture is not defined.");
-
-        if (!PyRegister_Check(reg))
-          return PyErr_Format(PyExc_TypeError, "getConcreteRegisterValue(): Expects a REG as argument.");
 
-        try {
-          return PyLong_FromUint512(triton::api.getConcreteRegisterValue(*PyRegister_AsRegister(reg)));
-        }
-        catch (const triton::exceptions::Exception& e) {
-          return PyErr_Format(PyExc_TypeError, "%s", e.what());
-        }
+        Py_INCREF(Py_None);
+        return Py_None;
       }
 
 
-      static PyObject* triton_getFullAst(PyObject* self, PyObject* node) {
+      static PyObject* triton_enableSyscallEmulation(PyObject* self, PyObject* flag) {
         /* Check if the architecture is definied */
-        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
-          return PyErr_Format(PyExc_TypeError, "getFullAst(): Architecture is not defined.");
+        if (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "enableSyscallEmulation(): Architecture is not defined.");
 
-        if (!PyAstNode_Check(node))
-          return PyErr_Format(PyExc_TypeError, "getFullAst(): Expects a AstNode as argument.");
+        if (!PyBool_Check(flag))
+          return PyErr_Format(PyExc_TypeError, "enableSyscallEmulation(): Expects an boolean as argument.");
 
         try {
-          return PyAstNode(triton::api.getFullAst(PyAstNode_AsAstNode(node)));
+          triton::getCurrentApi().enableSyscallEmulation(PyLong_AsBool(flag));
         }
         catch (const triton::exceptions::Exception& e) {
           return PyErr_Format(PyExc_TypeError, "%s", e.what());
         }
+
+        Py_INCREF(Py_None);
+        return Py_None;
       }
 
 
-      static PyObject* triton_getFullAstFromId(PyObject* self, PyObject* symExprId) {
+      static PyObject* triton_enableTaintEngine(PyObject* self, PyObject* flag) {
         /* Check if the architecture is definied */
-        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
-          return PyErr_Format(PyExc_TypeError, "getFullAstFromId(): Architecture is not defined.");
+        if (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "enableTaintEngine(): Architecture is not defined.");
 
-        if (!PyLong_Check(symExprId) && !PyInt_Check(symExprId))
-          return PyErr_Format(PyExc_TypeError, "getFullAstFromId(): Expects an integer as argument.");
+        if (!PyBool_Check(flag))
+          return PyErr_Format(PyExc_TypeError, "enableTaintEngine(): Expects an boolean as argument.");
 
         try {
-          return PyAstNode(triton::api.getFullAstFromId(PyLong_AsUsize(symExprId)));
+          triton::getCurrentApi().enableTaintEngine(PyLong_AsBool(flag));
         }
         catch (const triton::exceptions::Exception& e) {
           return PyErr_Format(PyExc_TypeError, "%s", e.what());
         }
-      }
 
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
 
-      static PyObject* triton_getModel(PyObject* self, PyObject* node) {
-        PyObject* ret = nullptr;
 
+      static PyObject* triton_enableUndoJournal(PyObject* self, PyObject* flag) {
         /* Check if the architecture is definied */
-        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
-          return PyErr_Format(PyExc_TypeError, "getModel(): Architecture is not defined.");
+        if (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "enableUndoJournal(): Architecture is not defined.");
 
-        if (!PyAstNode_Check(node))
-          return PyErr_Format(PyExc_TypeError, "getModel(): Expects a AstNode as argument.");
+        if (!PyBool_Check(flag))
+          return PyErr_Format(PyExc_TypeError, "enableUndoJournal(): Expects an boolean as argument.");
 
         try {
-          ret = xPyDict_New();
-          auto model = triton::api.getModel(PyAstNode_AsAstNode(node));
-          for (auto it = model.begin(); it != model.end(); it++) {
-            PyDict_SetItem(ret, PyLong_FromUint32(it->first), PySolverModel(it->second));
-          }
+          triton::getCurrentApi().enableUndoJournal(PyLong_AsBool(flag));
         }
         catch (const triton::exceptions::Exception& e) {
           return PyErr_Format(PyExc_TypeError, "%s", e.what());
         }
 
-        return ret;
+        Py_INCREF(Py_None);
+        return Py_None;
       }
 
 
-      static PyObject* triton_getModels(PyObject* self, PyObject* args) {
-        PyObject* ret   = nullptr;
-        PyObject* node  = nullptr;
-        PyObject* limit = nullptr;
+      static PyObject* triton_evaluateAst(PyObject* self, PyObject* args) {
+        std::map<triton::usize, triton::uint512> values;
+        PyObject* assignment = nullptr;
+        PyObject* node       = nullptr;
+        PyObject* ret        = nullptr;
 
         /* Extract arguments */
-        PyArg_ParseTuple(args, "|OO", &node, &limit);
+        PyArg_ParseTuple(args, "|OO", &node, &assignment);
 
         /* Check if the architecture is definied */
-        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
-          return PyErr_Format(PyExc_TypeError, "getModels(): Architecture is not defined.");
+        if (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "evaluateAst(): Architecture is not defined.");
 
         if (node == nullptr || !PyAstNode_Check(node))
-          return PyErr_Format(PyExc_TypeError, "getModels(): Expects a AstNode as first argument.");
+          return PyErr_Format(PyExc_TypeError, "evaluateAst(): Expects a AstNode as first argument.");
 
-        if (limit == nullptr || (!PyLong_Check(limit) && !PyInt_Check(limit)))
-          return PyErr_Format(PyExc_TypeError, "getModels(): Expects an integer as second argument.");
+        if (assignment != nullptr && !PyDict_Check(assignment) && !PyList_Check(assignment))
+          return PyErr_Format(PyExc_TypeError, "evaluateAst(): Expects a dict or a list of dicts as second argument.");
 
-        try {
-          auto models = triton::api.getModels(PyAstNode_AsAstNode(node), PyLong_AsUint32(limit));
-          triton::uint32 index = 0;
+        /* A list of assignments is evaluated by a single compilation */
+        if (assignment != nullptr && PyList_Check(assignment)) {
+          std::vector<std::map<triton::usize, triton::uint512>> assignments(PyList_Size(assignment));
 
-          ret = xPyList_New(models.size());
-          for (auto it = models.begin(); it != models.end(); it++) {
-            PyObject* mdict = xPyDict_New();
-            auto model = *it;
+          for (Py_ssize_t index = 0; index < PyList_Size(assignment); index++) {
+            PyObject* item = PyList_GetItem(assignment, index);
+            if (!PyDict_Check(item))
+              return PyErr_Format(PyExc_TypeError, "evaluateAst(): Expects a dict or a list of dicts as second argument.");
+            if (!PyAssignment_Convert("evaluateAst", item, assignments[index]))
+              return nullptr;
+          }
 
-            for (auto it2 = model.begin(); it2 != model.end(); it2++) {
-              PyDict_SetItem(mdict, PyLong_FromUint32(it2->first), PySolverModel(it2->second));
+          try {
+            triton::ast::AbstractNode* ast = PyAstNode_AsAstNode(node);
+            std::vector<triton::uint512> results;
+            {
+              GilRelease release;
+              results = triton::getCurrentApi().evaluateAst(ast, assignments);
             }
-            if (model.size() > 0)
-              PyList_SetItem(ret, index++, mdict);
+
+            ret = xPyList_New(results.size());
+            for (triton::usize index = 0; index < results.size(); index++)
+              PyList_SetItem(ret, index, PyLong_FromUint512(results[index]));
+            return ret;
+          }
+          catch (const triton::exceptions::Exception& e) {
+            return PyErr_Format(PyExc_TypeError, "%s", e.what());
           }
         }
+
+        if (assignment != nullptr && !PyAssignment_Convert("evaluateAst", assignment, values))
+          return nullptr;
+
+        try {
+          return PyLong_FromUint512(triton::getCurrentApi().evaluateAst(PyAstNode_AsAstNode(node), values));
+        }
         catch (const triton::exceptions::Exception& e) {
           return PyErr_Format(PyExc_TypeError, "%s", e.what());
         }
-
-        return ret;
       }
 
 
-      static PyObject* triton_getParentRegisters(PyObject* self, PyObject* noarg) {
-        PyObject* ret = nullptr;
-
+      static PyObject* triton_evaluateAstViaZ3(PyObject* self, PyObject* node) {
         /* Check if the architecture is definied */
-        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
-          return PyErr_Format(PyExc_TypeError, "getParentRegisters(): Architecture is not defined.");
+        if (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "evaluateAstViaZ3(): Architecture is not defined.");
 
-        try {
-          triton::uint32 index = 0;
-          std::set<triton::arch::Register*> reg = triton::api.getParentRegisters();
-          ret = xPyList_New(reg.size());
+        if (!PyAstNode_Check(node))
+          return PyErr_Format(PyExc_TypeError, "evaluateAstViaZ3(): Expects a AstNode as argument.");
 
-          for (auto it = reg.begin(); it != reg.end(); it++)
-            PyList_SetItem(ret, index++, PyRegister(**it));
+        try {
+          triton::ast::AbstractNode* ast = PyAstNode_AsAstNode(node);
+          triton::uint512 value = 0;
+          {
+            GilRelease release;
+            value = triton::getCurrentApi().evaluateAstViaZ3(ast);
+          }
+          return PyLong_FromUint512(value);
         }
         catch (const triton::exceptions::Exception& e) {
           return PyErr_Format(PyExc_TypeError, "%s", e.what());
         }
+        catch (const z3::exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.msg());
+        }
 
-        return ret;
+        Py_INCREF(Py_None);
+        return Py_None;
       }
 
 
-      static PyObject* triton_getPathConstraints(PyObject* self, PyObject* noarg) {
-        PyObject* ret = nullptr;
+      static PyObject* triton_explore(PyObject* self, PyObject* args) {
+        std::map<triton::uint64, triton::callbacks::addressHookCallback> addressHooks;
+        PyObject* entry     = nullptr;
+        PyObject* strategy  = nullptr;
+        PyObject* hooks     = nullptr;
+        PyObject* maxStates = nullptr;
+        PyObject* maxInsns  = nullptr;
+
+        /* Extract arguments */
+        PyArg_ParseTuple(args, "|OOOOO", &entry, &strategy, &hooks, &maxStates, &maxInsns);
 
         /* Check if the architecture is definied */
-        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
-          return PyErr_Format(PyExc_TypeError, "getPathConstraintsAst(): Architecture is not defined.");
+        if (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "explore(): Architecture is not defined.");
 
-        try {
-          triton::uint32 index = 0;
-          const std::vector<triton::engines::symbolic::PathConstraint>& pc = triton::api.getPathConstraints();
-          ret = xPyList_New(pc.size());
+        if (entry == nullptr || (!PyLong_Check(entry) && !PyInt_Check(entry)))
+          return PyErr_Format(PyExc_TypeError, "explore(): Expects an integer as first argument.");
 
-          for (auto it = pc.begin(); it != pc.end(); it++)
-            PyList_SetItem(ret, index++, PyPathConstraint(*it));
+        if (strategy != nullptr && (!PyLong_Check(strategy) && !PyInt_Check(strategy)))
+          return PyErr_Format(PyExc_TypeError, "explore(): Expects an EXPLORATION as second argument.");
 
-          return ret;
+        if (hooks != nullptr && !PyDict_Check(hooks))
+          return PyErr_Format(PyExc_TypeError, "explore(): Expects a dict as third argument.");
+
+        if (maxStates != nullptr && (!PyLong_Check(maxStates) && !PyInt_Check(maxStates)))
+          return PyErr_Format(PyExc_TypeError, "explore(): Expects an integer as fourth argument.");
+
+        if (maxInsns != nullptr && (!PyLong_Check(maxInsns) && !PyInt_Check(maxInsns)))
+          return PyErr_Format(PyExc_TypeError, "explore(): Expects an integer as fifth argument.");
+
+        if (hooks != nullptr && !PyAddressHooks_Convert("explore", hooks, addressHooks))
+          return nullptr;
+
+        try {
+          triton::engines::exploration::Explorer explorer(&triton::getCurrentApi(), strategy != nullptr ? PyLong_AsUint32(strategy) : static_cast<triton::uint32>(triton::engines::exploration::DFS));
+          explorer.explore(PyLong_AsUint64(entry), addressHooks, maxStates != nullptr ? PyLong_AsUsize(maxStates) : 0, maxInsns != nullptr ? PyLong_AsUsize(maxInsns) : 0);
+          return PyExplorationInputs_FromVector(explorer.getExploredInputs());
         }
         catch (const triton::exceptions::Exception& e) {
           return PyErr_Format(PyExc_TypeError, "%s", e.what());
         }
+        catch (const z3::exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.msg());
+        }
       }
 
 
-      static PyObject* triton_getPathConstraintsAst(PyObject* self, PyObject* noarg) {
+      static PyObject* triton_exploreCoordinator(PyObject* self, PyObject* args) {
+        PyObject* address   = nullptr;
+        PyObject* entry     = nullptr;
+        PyObject* strategy  = nullptr;
+        PyObject* maxStates = nullptr;
+
+        /* Extract arguments */
+        PyArg_ParseTuple(args, "|OOOO", &address, &entry, &strategy, &maxStates);
+
         /* Check if the architecture is definied */
-        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
-          return PyErr_Format(PyExc_TypeError, "getPathConstraintsAst(): Architecture is not defined.");
+        if (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "exploreCoordinator(): Architecture is not defined.");
+
+        if (address == nullptr || !PyString_Check(address))
+          return PyErr_Format(PyExc_TypeError, "exploreCoordinator(): Expects a string as first argument.");
+
+        if (entry == nullptr || (!PyLong_Check(entry) && !PyInt_Check(entry)))
+          return PyErr_Format(PyExc_TypeError, "exploreCoordinator(): Expects an integer as second argument.");
+
+        if (strategy != nullptr && (!PyLong_Check(strategy) && !PyInt_Check(strategy)))
+          return PyErr_Format(PyExc_TypeError, "exploreCoordinator(): Expects an EXPLORATION as third argument.");
+
+        if (maxStates != nullptr && (!PyLong_Check(maxStates) && !PyInt_Check(maxStates)))
+          return PyErr_Format(PyExc_TypeError, "exploreCoordinator(): Expects an integer as fourth argument.");
 
         try {
-          return PyAstNode(triton::api.getPathConstraintsAst());
+          triton::engines::exploration::Explorer explorer(&triton::getCurrentApi(), strategy != nullptr ? PyLong_AsUint32(strategy) : static_cast<triton::uint32>(triton::engines::exploration::DFS));
+          explorer.coordinate(PyString_AsString(address), PyLong_AsUint64(entry), maxStates != nullptr ? PyLong_AsUsize(maxStates) : 0);
+          return PyExplorationInputs_FromVector(explorer.getExploredInputs());
         }
         catch (const triton::exceptions::Exception& e) {
           return PyErr_Format(PyExc_TypeError, "%s", e.what());
@@ -1684,59 +2731,115 @@ namespace triton {
       }
 
 
-      static PyObject* triton_getSymbolicExpressionFromId(PyObject* self, PyObject* symExprId) {
+      static PyObject* triton_exploreWorker(PyObject* self, PyObject* args) {
+        std::map<triton::uint64, triton::callbacks::addressHookCallback> addressHooks;
+        PyObject* address   = nullptr;
+        PyObject* entry     = nullptr;
+        PyObject* hooks     = nullptr;
+        PyObject* maxInsns  = nullptr;
+
+        /* Extract arguments */
+        PyArg_ParseTuple(args, "|OOOO", &address, &entry, &hooks, &maxInsns);
+
         /* Check if the architecture is definied */
-        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
-          return PyErr_Format(PyExc_TypeError, "getSymbolicExpressionFromId(): Architecture is not defined.");
+        if (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "exploreWorker(): Architecture is not defined.");
 
-        if (!PyLong_Check(symExprId) && !PyInt_Check(symExprId))
-          return PyErr_Format(PyExc_TypeError, "getSymbolicExpressionFromId(): Expects an integer as argument.");
+        if (address == nullptr || !PyString_Check(address))
+          return PyErr_Format(PyExc_TypeError, "exploreWorker(): Expects a string as first argument.");
+
+        if (entry == nullptr || (!PyLong_Check(entry) && !PyInt_Check(entry)))
+          return PyErr_Format(PyExc_TypeError, "exploreWorker(): Expects an integer as second argument.");
+
+        if (hooks != nullptr && !PyDict_Check(hooks))
+          return PyErr_Format(PyExc_TypeError, "exploreWorker(): Expects a dict as third argument.");
+
+        if (maxInsns != nullptr && (!PyLong_Check(maxInsns) && !PyInt_Check(maxInsns)))
+          return PyErr_Format(PyExc_TypeError, "exploreWorker(): Expects an integer as fourth argument.");
+
+        if (hooks != nullptr && !PyAddressHooks_Convert("exploreWorker", hooks, addressHooks))
+          return nullptr;
 
         try {
-          return PySymbolicExpression(triton::api.getSymbolicExpressionFromId(PyLong_AsUsize(symExprId)));
+          triton::engines::exploration::Explorer explorer(&triton::getCurrentApi());
+          return PyLong_FromUsize(explorer.work(PyString_AsString(address), PyLong_AsUint64(entry), addressHooks, maxInsns != nullptr ? PyLong_AsUsize(maxInsns) : 0));
         }
         catch (const triton::exceptions::Exception& e) {
           return PyErr_Format(PyExc_TypeError, "%s", e.what());
         }
+        catch (const z3::exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.msg());
+        }
       }
 
 
-      static PyObject* triton_getSymbolicExpressions(PyObject* self, PyObject* noarg) {
-        PyObject* ret = nullptr;
+      static PyObject* triton_exportDependencies(PyObject* self, PyObject* args) {
+        PyObject* path = nullptr;
+        PyObject* csv  = nullptr;
+
+        /* Extract arguments */
+        PyArg_ParseTuple(args, "|OO", &path, &csv);
 
         /* Check if the architecture is definied */
-        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
-          return PyErr_Format(PyExc_TypeError, "getTaintedSymbolicExpressions(): Architecture is not defined.");
+        if (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "exportDependencies(): Architecture is not defined.");
 
-        try {
-          const auto& expressions = triton::api.getSymbolicExpressions();
+        if (path == nullptr || !PyString_Check(path))
+          return PyErr_Format(PyExc_TypeError, "exportDependencies(): Expects a string as first argument.");
 
-          ret = xPyDict_New();
-          for (auto it = expressions.begin(); it != expressions.end(); it++)
-            PyDict_SetItem(ret, PyLong_FromUsize(it->first), PySymbolicExpression(it->second));
+        if (csv != nullptr && !PyBool_Check(csv))
+          return PyErr_Format(PyExc_TypeError, "exportDependencies(): Expects a boolean as second argument.");
+
+        try {
+          triton::getCurrentApi().exportDependencies(PyString_AsString(path), csv != nullptr ? PyLong_AsBool(csv) : false);
         }
         catch (const triton::exceptions::Exception& e) {
           return PyErr_Format(PyExc_TypeError, "%s", e.what());
         }
 
-        return ret;
+        Py_INCREF(Py_None);
+        return Py_None;
       }
 
 
-      static PyObject* triton_getSymbolicMemory(PyObject* self, PyObject* noarg) {
-        PyObject* ret = nullptr;
+      static PyObject* triton_filterAssignments(PyObject* self, PyObject* args) {
+        PyObject* assignments = nullptr;
+        PyObject* node        = nullptr;
+        PyObject* ret         = nullptr;
+
+        /* Extract arguments */
+        PyArg_ParseTuple(args, "|OO", &node, &assignments);
 
         /* Check if the architecture is definied */
-        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
-          return PyErr_Format(PyExc_TypeError, "getSymbolicMemory(): Architecture is not defined.");
+        if (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "filterAssignments(): Architecture is not defined.");
 
-        try {
-          auto regs = triton::api.getSymbolicMemory();
+        if (node == nullptr || !PyAstNode_Check(node))
+          return PyErr_Format(PyExc_TypeError, "filterAssignments(): Expects a AstNode as first argument.");
 
-          ret = xPyDict_New();
-          for (auto it = regs.begin(); it != regs.end(); it++) {
-            PyDict_SetItem(ret, PyLong_FromUint64(it->first), PySymbolicExpression(it->second));
+        if (assignments == nullptr || !PyList_Check(assignments))
+          return PyErr_Format(PyExc_TypeError, "filterAssignments(): Expects a list of dicts as second argument.");
+
+        std::vector<std::map<triton::usize, triton::uint512>> values(PyList_Size(assignments));
+        for (Py_ssize_t index = 0; index < PyList_Size(assignments); index++) {
+          PyObject* item = PyList_GetItem(assignments, index);
+          if (!PyDict_Check(item))
+            return PyErr_Format(PyExc_TypeError, "filterAssignments(): Expects a list of dicts as second argument.");
+          if (!PyAssignment_Convert("filterAssignments", item, values[index]))
+            return nullptr;
+        }
+
+        try {
+          triton::ast::AbstractNode* ast = PyAstNode_AsAstNode(node);
+          std::vector<triton::usize> indexes;
+          {
+            GilRelease release;
+            indexes = triton::getCurrentApi().filterAssignments(ast, values);
           }
+
+          ret = xPyList_New(indexes.size());
+          for (triton::usize index = 0; index < indexes.size(); index++)
+            PyList_SetItem(ret, index, PyLong_FromUsize(indexes[index]));
         }
         catch (const triton::exceptions::Exception& e) {
           return PyErr_Format(PyExc_TypeError, "%s", e.what());
@@ -1746,57 +2849,129 @@ namespace triton {
       }
 
 
-      static PyObject* triton_getSymbolicMemoryId(PyObject* self, PyObject* addr) {
+      static PyObject* triton_flushCallbacks(PyObject* self, PyObject* noarg) {
         /* Check if the architecture is definied */
-        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
-          return PyErr_Format(PyExc_TypeError, "getSymbolicMemoryId(): Architecture is not defined.");
-
-        if (!PyLong_Check(addr) && !PyInt_Check(addr))
-          return PyErr_Format(PyExc_TypeError, "getSymbolicMemoryId(): Expects an integer as argument.");
+        if (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "flushCallbacks(): Architecture is not defined.");
 
         try {
-          return PyLong_FromUsize(triton::api.getSymbolicMemoryId(PyLong_AsUint64(addr)));
+          triton::getCurrentApi().flushCallbacks();
         }
         catch (const triton::exceptions::Exception& e) {
           return PyErr_Format(PyExc_TypeError, "%s", e.what());
         }
+
+        Py_INCREF(Py_None);
+        return Py_None;
       }
 
 
-      static PyObject* triton_getSymbolicMemoryValue(PyObject* self, PyObject* mem) {
+      static PyObject* triton_generateInputs(PyObject* self, PyObject* args) {
+        std::map<triton::uint64, triton::callbacks::addressHookCallback> addressHooks;
+        PyObject* entry     = nullptr;
+        PyObject* address   = nullptr;
+        PyObject* size      = nullptr;
+        PyObject* seeds     = nullptr;
+        PyObject* corpus    = nullptr;
+        PyObject* sharedMap = nullptr;
+        PyObject* hooks     = nullptr;
+        PyObject* maxRuns   = nullptr;
+        PyObject* maxInsns  = nullptr;
+
+        /* Extract arguments */
+        PyArg_ParseTuple(args, "|OOOOOOOOO", &entry, &address, &size, &seeds, &corpus, &sharedMap, &hooks, &maxRuns, &maxInsns);
+
         /* Check if the architecture is definied */
-        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
-          return PyErr_Format(PyExc_TypeError, "getSymbolicMemoryValue(): Architecture is not defined.");
+        if (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "generateInputs(): Architecture is not defined.");
 
-        if (!PyLong_Check(mem) && !PyInt_Check(mem) && !PyMemoryAccess_Check(mem))
-          return PyErr_Format(PyExc_TypeError, "getSymbolicMemoryValue(): Expects an integer or a MemoryAccess as argument.");
+        if (entry == nullptr || (!PyLong_Check(entry) && !PyInt_Check(entry)))
+          return PyErr_Format(PyExc_TypeError, "generateInputs(): Expects an integer as first argument.");
+
+        if (address == nullptr || (!PyLong_Check(address) && !PyInt_Check(address)))
+          return PyErr_Format(PyExc_TypeError, "generateInputs(): Expects an integer as second argument.");
+
+        if (size == nullptr || (!PyLong_Check(size) && !PyInt_Check(size)))
+          return PyErr_Format(PyExc_TypeError, "generateInputs(): Expects an integer as third argument.");
+
+        if (seeds == nullptr || !PyList_Check(seeds))
+          return PyErr_Format(PyExc_TypeError, "generateInputs(): Expects a list of buffers as fourth argument.");
+
+        if (corpus != nullptr && !PyString_Check(corpus))
+          return PyErr_Format(PyExc_TypeError, "generateInputs(): Expects a string as fifth argument.");
+
+        if (sharedMap != nullptr && !PyString_Check(sharedMap))
+          return PyErr_Format(PyExc_TypeError, "generateInputs(): Expects a string as sixth argument.");
+
+        if (hooks != nullptr && !PyDict_Check(hooks))
+          return PyErr_Format(PyExc_TypeError, "generateInputs(): Expects a dict as seventh argument.");
+
+        if (maxRuns != nullptr && (!PyLong_Check(maxRuns) && !PyInt_Check(maxRuns)))
+          return PyErr_Format(PyExc_TypeError, "generateInputs(): Expects an integer as eighth argument.");
+
+        if (maxInsns != nullptr && (!PyLong_Check(maxInsns) && !PyInt_Check(maxInsns)))
+          return PyErr_Format(PyExc_TypeError, "generateInputs(): Expects an integer as ninth argument.");
+
+        if (hooks != nullptr && !PyAddressHooks_Convert("generateInputs", hooks, addressHooks))
+          return nullptr;
 
         try {
-          if (PyLong_Check(mem) || PyInt_Check(mem))
-            return PyLong_FromUint512(triton::api.getSymbolicMemoryValue(PyLong_AsUint64(mem)));
-          return PyLong_FromUint512(triton::api.getSymbolicMemoryValue(*PyMemoryAccess_AsMemoryAccess(mem)));
+          triton::engines::exploration::CoverageDriver driver(&triton::getCurrentApi(), PyLong_AsUint64(address), PyLong_AsUsize(size));
+
+          for (Py_ssize_t index = 0; index < PyList_Size(seeds); index++) {
+            PyObject* seed = PyList_GetItem(seeds, index);
+            Py_buffer view;
+
+            if (!PyObject_CheckBuffer(seed))
+              return PyErr_Format(PyExc_TypeError, "generateInputs(): Expects a list of buffers as fourth argument.");
+
+            if (PyObject_GetBuffer(seed, &view, PyBUF_SIMPLE) != 0)
+              return nullptr;
+
+            const triton::uint8* data = reinterpret_cast<const triton::uint8*>(view.buf);
+            std::vector<triton::uint8> bytes(data, data + view.len);
+            PyBuffer_Release(&view);
+            driver.addSeed(bytes);
+          }
+
+          if (corpus != nullptr && PyString_Size(corpus) > 0)
+            driver.setCorpus(PyString_AsString(corpus));
+
+          if (sharedMap != nullptr && PyString_Size(sharedMap) > 0)
+            driver.setSharedMap(PyString_AsString(sharedMap));
+
+          driver.run(PyLong_AsUint64(entry), addressHooks, maxRuns != nullptr ? PyLong_AsUsize(maxRuns) : 0, maxInsns != nullptr ? PyLong_AsUsize(maxInsns) : 0);
+
+          const std::vector<std::vector<triton::uint8>>& found = driver.getCorpus();
+          PyObject* ret = xPyList_New(found.size());
+          for (triton::usize index = 0; index < found.size(); index++)
+            PyList_SetItem(ret, index, PyString_FromStringAndSize(reinterpret_cast<const char*>(found[index].data()), found[index].size()));
+
+          return ret;
         }
         catch (const triton::exceptions::Exception& e) {
           return PyErr_Format(PyExc_TypeError, "%s", e.what());
         }
+        catch (const z3::exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.msg());
+        }
       }
 
 
-      static PyObject* triton_getSymbolicRegisters(PyObject* self, PyObject* noarg) {
+      static PyObject* triton_getAllRegisters(PyObject* self, PyObject* noarg) {
         PyObject* ret = nullptr;
 
         /* Check if the architecture is definied */
-        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
-          return PyErr_Format(PyExc_TypeError, "getSymbolicRegisters(): Architecture is not defined.");
+        if (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "getAllRegisters(): Architecture is not defined.");
 
         try {
-          auto regs = triton::api.getSymbolicRegisters();
+          triton::uint32 index = 0;
+          std::set<triton::arch::Register*> reg = triton::getCurrentApi().getAllRegisters();
 
-          ret = xPyDict_New();
-          for (auto it = regs.begin(); it != regs.end(); it++) {
-            triton::arch::Register reg(it->first);
-            PyDict_SetItem(ret, PyRegister(reg), PySymbolicExpression(it->second));
-          }
+          ret = xPyList_New(reg.size());
+          for (auto it = reg.begin(); it != reg.end(); it++)
+            PyList_SetItem(ret, index++, PyRegisterSingleton((*it)->getId()));
         }
         catch (const triton::exceptions::Exception& e) {
           return PyErr_Format(PyExc_TypeError, "%s", e.what());
@@ -1806,33 +2981,43 @@ namespace triton {
       }
 
 
-      static PyObject* triton_getSymbolicRegisterId(PyObject* self, PyObject* reg) {
-        /* Check if the architecture is definied */
-        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
-          return PyErr_Format(PyExc_TypeError, "getSymbolicRegisterId(): Architecture is not defined.");
+      static PyObject* triton_getArchitecture(PyObject* self, PyObject* noarg) {
+        return PyLong_FromUint32(triton::getCurrentApi().getArchitecture());
+      }
 
-        if (!PyRegister_Check(reg))
-          return PyErr_Format(PyExc_TypeError, "getSymbolicRegisterId(): Expects a REG as argument.");
+
+      static PyObject* triton_getAstDictionariesStats(PyObject* self, PyObject* noarg) {
+        PyObject* ret = nullptr;
+
+        /* Check if the architecture is definied */
+        if (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "getAstDictionariesStats(): Architecture is not defined.");
 
         try {
-          return PyLong_FromUsize(triton::api.getSymbolicRegisterId(*PyRegister_AsRegister(reg)));
+          std::map<std::string, triton::usize> stats = triton::getCurrentApi().getAstDictionariesStats();
+
+          ret = xPyDict_New();
+          for (auto it = stats.begin(); it != stats.end(); it++)
+            PyDict_SetItem(ret, PyString_FromString(it->first.c_str()), PyLong_FromUsize(it->second));
         }
         catch (const triton::exceptions::Exception& e) {
           return PyErr_Format(PyExc_TypeError, "%s", e.what());
         }
+
+        return ret;
       }
 
 
-      static PyObject* triton_getSymbolicRegisterValue(PyObject* self, PyObject* reg) {
+      static PyObject* triton_getAstFromId(PyObject* self, PyObject* symExprId) {
         /* Check if the architecture is definied */
-        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
-          return PyErr_Format(PyExc_TypeError, "getSymbolicRegisterValue(): Architecture is not defined.");
+        if (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "getAstFromId(): Architecture is not defined.");
 
-        if (!PyRegister_Check(reg))
-          return PyErr_Format(PyExc_TypeError, "getSymbolicRegisterValue(): Expects a REG as argument.");
+        if (!PyLong_Check(symExprId) && !PyInt_Check(symExprId))
+          return PyErr_Format(PyExc_TypeError, "getAstFromId(): Expects an integer as argument.");
 
         try {
-          return PyLong_FromUint512(triton::api.getSymbolicRegisterValue(*PyRegister_AsRegister(reg)));
+          return PyAstNode(triton::getCurrentApi().getAstFromId(PyLong_AsUsize(symExprId)));
         }
         catch (const triton::exceptions::Exception& e) {
           return PyErr_Format(PyExc_TypeError, "%s", e.what());
@@ -1840,34 +3025,92 @@ namespace triton {
       }
 
 
-      static PyObject* triton_getSymbolicVariableFromId(PyObject* self, PyObject* symVarId) {
+      static PyObject* triton_getAstRepresentationMode(PyObject* self, PyObject* noarg) {
         /* Check if the architecture is definied */
-        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
-          return PyErr_Format(PyExc_TypeError, "getSymbolicVariableFromId(): Architecture is not defined.");
+        if (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "getAstRepresentationMode(): Architecture is not defined.");
+        return PyLong_FromUint32(triton::getCurrentApi().getAstRepresentationMode());
+      }
 
-        if (!PyLong_Check(symVarId) && !PyInt_Check(symVarId))
-          return PyErr_Format(PyExc_TypeError, "getSymbolicVariableFromId(): Expects an integer as argument.");
 
+      static PyObject* triton_getAsyncModel(PyObject* self, PyObject* id) {
+        PyObject* ret = nullptr;
+
+        /* Check if the architecture is definied */
+        if (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "getAsyncModel(): Architecture is not defined.");
+
+        if (!PyLong_Check(id) && !PyInt_Check(id))
+          return PyErr_Format(PyExc_TypeError, "getAsyncModel(): Expects an integer as argument.");
+
+        std::map<triton::uint32, triton::engines::solver::SolverModel> model;
+        triton::usize query = PyLong_AsUsize(id);
+
+        /* The other Python threads can run while waiting for the solver */
+        Py_BEGIN_ALLOW_THREADS
         try {
-          return PySymbolicVariable(triton::api.getSymbolicVariableFromId(PyLong_AsUsize(symVarId)));
+          model = triton::getCurrentApi().getAsyncModel(query);
         }
         catch (const triton::exceptions::Exception& e) {
+          Py_BLOCK_THREADS
           return PyErr_Format(PyExc_TypeError, "%s", e.what());
         }
+        Py_END_ALLOW_THREADS
+
+        ret = xPyDict_New();
+        for (auto it = model.begin(); it != model.end(); it++) {
+          PyDict_SetItem(ret, PyLong_FromUint32(it->first), PySolverModel(it->second));
+        }
+
+        return ret;
       }
 
 
-      static PyObject* triton_getSymbolicVariableFromName(PyObject* self, PyObject* symVarName) {
+      static PyObject* triton_getConcreteMemoryAreaValue(PyObject* self, PyObject* args) {
+        PyObject* ret  = nullptr;
+        PyObject* addr = nullptr;
+        PyObject* size = nullptr;
+
+        /* Extract arguments */
+        PyArg_ParseTuple(args, "|OO", &addr, &size);
+
         /* Check if the architecture is definied */
-        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
-          return PyErr_Format(PyExc_TypeError, "getSymbolicVariableFromName(): Architecture is not defined.");
+        if (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "getConcreteMemoryAreaValue(): Architecture is not defined.");
 
-        if (!PyString_Check(symVarName))
-          return PyErr_Format(PyExc_TypeError, "getSymbolicVariableFromName(): Expects a string as argument.");
+        try {
+          triton::uint64 baseAddr = PyLong_AsUint64(addr);
+          triton::usize  count    = PyLong_AsUsize(size);
+
+          /* The memory is copied straight into the bytes object */
+          ret = PyBytes_FromStringAndSize(nullptr, count);
+          if (ret == nullptr)
+            return nullptr;
+
+          triton::getCurrentApi().getConcreteMemoryAreaValue(baseAddr, reinterpret_cast<triton::uint8*>(PyBytes_AsString(ret)), count);
+          return ret;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          Py_XDECREF(ret);
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        return ret;
+      }
+
+
+      static PyObject* triton_getConcreteMemoryValue(PyObject* self, PyObject* mem) {
+        /* Check if the architecture is definied */
+        if (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "getConcreteMemoryValue(): Architecture is not defined.");
 
         try {
-          std::string arg = PyString_AsString(symVarName);
-          return PySymbolicVariable(triton::api.getSymbolicVariableFromName(arg));
+          if (PyLong_Check(mem) || PyInt_Check(mem))
+              return PyLong_FromUint512(triton::getCurrentApi().getConcreteMemoryValue(PyLong_AsUint64(mem)));
+          else if (PyMemoryAccess_Check(mem))
+              return PyLong_FromUint512(triton::getCurrentApi().getConcreteMemoryValue(*PyMemoryAccess_AsMemoryAccess(mem)));
+          else
+            return PyErr_Format(PyExc_TypeError, "getConcreteMemoryValue(): Expects a MemoryAccess or an integer as argument.");
         }
         catch (const triton::exceptions::Exception& e) {
           return PyErr_Format(PyExc_TypeError, "%s", e.what());
@@ -1875,19 +3118,111 @@ namespace triton {
       }
 
 
-      static PyObject* triton_getSymbolicVariables(PyObject* self, PyObject* noarg) {
+      static PyObject* triton_getConcreteRegisterContext(PyObject* self, PyObject* noarg) {
+        /* Check if the architecture is definied */
+        if (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "getConcreteRegisterContext(): Architecture is not defined.");
+
+        try {
+          triton::arch::x86::RegisterContext context = triton::getCurrentApi().getConcreteRegisterContext();
+          triton::uint32 count             = 0;
+          const triton::uint32* gprs       = PyRegisterContext_Gprs(count);
+          const triton::uint32* segments   = PyRegisterContext_Segments();
+          triton::uint32 pc                = (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_X86_64) ? triton::arch::x86::ID_REG_RIP : triton::arch::x86::ID_REG_EIP;
+          PyObject* ret                    = xPyDict_New();
+
+          for (triton::uint32 index = 0; index < count; index++)
+            PyDict_SetItem(ret, PyRegisterSingleton(gprs[index]), PyLong_FromUint64(context.gprs[index]));
+
+          PyDict_SetItem(ret, PyRegisterSingleton(pc), PyLong_FromUint64(context.pc));
+          PyDict_SetItem(ret, PyRegisterSingleton(triton::arch::x86::ID_REG_EFLAGS), PyLong_FromUint64(context.flags));
+
+          for (triton::uint32 index = 0; index < 6; index++)
+            PyDict_SetItem(ret, PyRegisterSingleton(segments[index]), PyLong_FromUint64(context.segments[index]));
+
+          /* The CPUs have as many XMM registers as GPRs */
+          for (triton::uint32 index = 0; index < count; index++) {
+            triton::uint128 value = 0;
+            for (triton::sint32 byte = DQWORD_SIZE - 1; byte >= 0; byte--)
+              value = (value << 8) | context.xmms[index][byte];
+            PyDict_SetItem(ret, PyRegisterSingleton(triton::arch::x86::ID_REG_XMM0 + index), PyLong_FromUint128(value));
+          }
+
+          return ret;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* triton_getConcreteRegisterValue(PyObject* self, PyObject* reg) {
+        /* Check if the architecture is definied */
+        if (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "getConcreteRegisterValue(): Architecture is not defined.");
+
+        if (!PyRegister_Check(reg))
+          return PyErr_Format(PyExc_TypeError, "getConcreteRegisterValue(): Expects a REG as argument.");
+
+        try {
+          return PyLong_FromUint512(triton::getCurrentApi().getConcreteRegisterValue(*PyRegister_AsRegister(reg)));
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* triton_getEngineProfile(PyObject* self, PyObject* noarg) {
+        /* Check if the architecture is definied */
+        if (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "getEngineProfile(): Architecture is not defined.");
+
+        return PyLong_FromUint32(triton::getCurrentApi().getEngineProfile());
+      }
+
+
+      static PyObject* triton_getExitStatus(PyObject* self, PyObject* noarg) {
+        /* Check if the architecture is definied */
+        if (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "getExitStatus(): Architecture is not defined.");
+
+        try {
+          triton::os::unix::SyscallEmulator* syscalls = triton::getCurrentApi().getSyscallEmulator();
+          if (syscalls->hasExited())
+            return PyLong_FromUint64(syscalls->getExitStatus());
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
+      static PyObject* triton_getExpressionProfile(PyObject* self, PyObject* noarg) {
         PyObject* ret = nullptr;
 
         /* Check if the architecture is definied */
-        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
-          return PyErr_Format(PyExc_TypeError, "getTaintedSymbolicVariables(): Architecture is not defined.");
+        if (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "getExpressionProfile(): Architecture is not defined.");
 
         try {
-          const auto& variables = triton::api.getSymbolicVariables();
+          const std::map<triton::uint64, triton::engines::symbolic::ExpressionProfile>& profiles = triton::getCurrentApi().getExpressionProfile();
 
           ret = xPyDict_New();
-          for (auto it = variables.begin(); it != variables.end(); it++)
-            PyDict_SetItem(ret, PyLong_FromUsize(it->first), PySymbolicVariable(it->second));
+          for (auto it = profiles.begin(); it != profiles.end(); it++) {
+            PyObject* profile = xPyDict_New();
+            PyDict_SetItemString(profile, "instructions", PyLong_FromUsize(it->second.instructions));
+            PyDict_SetItemString(profile, "nodes",        PyLong_FromUsize(it->second.nodes));
+            PyDict_SetItemString(profile, "expressions",  PyLong_FromUsize(it->second.expressions));
+            PyDict_SetItemString(profile, "maxSize",      PyLong_FromUint64(it->second.maxSize));
+            PyDict_SetItemString(profile, "maxDepth",     PyLong_FromUint32(it->second.maxDepth));
+            PyDict_SetItemString(profile, "queries",      PyLong_FromUsize(it->second.queries));
+            PyDict_SetItemString(profile, "solverTime",   PyLong_FromUint64(it->second.solverTime));
+            PyDict_SetItem(ret, PyLong_FromUint64(it->first), profile);
+          }
         }
         catch (const triton::exceptions::Exception& e) {
           return PyErr_Format(PyExc_TypeError, "%s", e.what());
@@ -1897,21 +3232,139 @@ namespace triton {
       }
 
 
-      static PyObject* triton_getTaintedMemory(PyObject* self, PyObject* noarg) {
-        PyObject* ret = nullptr;
-        triton::usize size = 0, index = 0;
+      static PyObject* triton_getFullAst(PyObject* self, PyObject* node) {
+        /* Check if the architecture is definied */
+        if (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "getFullAst(): Architecture is not defined.");
+
+        if (!PyAstNode_Check(node))
+          return PyErr_Format(PyExc_TypeError, "getFullAst(): Expects a AstNode as argument.");
+
+        try {
+          return PyAstNode(triton::getCurrentApi().getFullAst(PyAstNode_AsAstNode(node)));
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
 
+
+      static PyObject* triton_getFullAstFromId(PyObject* self, PyObject* symExprId) {
         /* Check if the architecture is definied */
-        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
-          return PyErr_Format(PyExc_TypeError, "getTaintedMemory(): Architecture is not defined.");
+        if (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "getFullAstFromId(): Architecture is not defined.");
+
+        if (!PyLong_Check(symExprId) && !PyInt_Check(symExprId))
+          return PyErr_Format(PyExc_TypeError, "getFullAstFromId(): Expects an integer as argument.");
 
         try {
-          std::set<triton::uint64> addresses = triton::api.getTaintedMemory();
+          return PyAstNode(triton::getCurrentApi().getFullAstFromId(PyLong_AsUsize(symExprId)));
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
 
-          size = addresses.size();
-          ret = xPyList_New(size);
-          for (auto it = addresses.begin(); it != addresses.end(); it++) {
-            PyList_SetItem(ret, index, PyLong_FromUint64(*it));
+
+      static PyObject* triton_getInlineReferenceSize(PyObject* self, PyObject* noarg) {
+        /* Check if the architecture is definied */
+        if (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "getInlineReferenceSize(): Architecture is not defined.");
+
+        try {
+          return PyLong_FromUsize(triton::getCurrentApi().getInlineReferenceSize());
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* triton_getInstructionWindow(PyObject* self, PyObject* noarg) {
+        /* Check if the architecture is definied */
+        if (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "getInstructionWindow(): Architecture is not defined.");
+
+        try {
+          return PyLong_FromUsize(triton::getCurrentApi().getInstructionWindow());
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* triton_getLastSolverStatus(PyObject* self, PyObject* noarg) {
+        /* Check if the architecture is definied */
+        if (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "getLastSolverStatus(): Architecture is not defined.");
+
+        try {
+          return PyLong_FromUint32(triton::getCurrentApi().getLastSolverStatus());
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* triton_getMaxPathConstraintsPerBranch(PyObject* self, PyObject* noarg) {
+        /* Check if the architecture is definied */
+        if (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "getMaxPathConstraintsPerBranch(): Architecture is not defined.");
+
+        try {
+          return PyLong_FromUsize(triton::getCurrentApi().getMaxPathConstraintsPerBranch());
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* triton_getMemoryArray(PyObject* self, PyObject* noarg) {
+        /* Check if the architecture is definied */
+        if (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "getMemoryArray(): Architecture is not defined.");
+
+        try {
+          return PyAstNode(triton::getCurrentApi().getMemoryArray());
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* triton_getMemoryLabels(PyObject* self, PyObject* args) {
+        PyObject* addr        = nullptr;
+        PyObject* size        = nullptr;
+        PyObject* ret         = nullptr;
+        triton::usize c_size  = 1;
+        triton::usize index   = 0;
+
+        /* Extract arguments */
+        PyArg_ParseTuple(args, "|OO", &addr, &size);
+
+        /* Check if the architecture is definied */
+        if (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "getMemoryLabels(): Architecture is not defined.");
+
+        if (addr == nullptr || (!PyLong_Check(addr) && !PyInt_Check(addr)))
+          return PyErr_Format(PyExc_TypeError, "getMemoryLabels(): Expects an address (integer) as first argument.");
+
+        if (size != nullptr && !PyLong_Check(size) && !PyInt_Check(size))
+          return PyErr_Format(PyExc_TypeError, "getMemoryLabels(): Expects a size (integer) as second argument.");
+
+        try {
+          if (size != nullptr)
+            c_size = PyLong_AsUsize(size);
+
+          std::set<triton::uint32> labels = triton::getCurrentApi().getMemoryLabels(PyLong_AsUint64(addr), c_size);
+
+          ret = xPyList_New(labels.size());
+          for (auto it = labels.begin(); it != labels.end(); it++) {
+            PyList_SetItem(ret, index, PyLong_FromUint32(*it));
             index++;
           }
         }
@@ -1923,298 +3376,2486 @@ namespace triton {
       }
 
 
-      static PyObject* triton_getTaintedRegisters(PyObject* self, PyObject* noarg) {
+      static PyObject* triton_getMemoryUsage(PyObject* self, PyObject* noarg) {
         PyObject* ret = nullptr;
-        triton::usize size = 0, index = 0;
 
         /* Check if the architecture is definied */
-        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
-          return PyErr_Format(PyExc_TypeError, "getTaintedRegisters(): Architecture is not defined.");
+        if (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "getMemoryUsage(): Architecture is not defined.");
 
         try {
-          std::set<triton::arch::Register> registers = triton::api.getTaintedRegisters();
+          std::map<std::string, triton::usize> usage = triton::getCurrentApi().getMemoryUsage();
 
-          size = registers.size();
-          ret = xPyList_New(size);
-          for (auto it = registers.begin(); it != registers.end(); it++) {
-            PyList_SetItem(ret, index, PyRegister(*it));
-            index++;
+          ret = xPyDict_New();
+          for (auto it = usage.begin(); it != usage.end(); it++)
+            PyDict_SetItem(ret, PyString_FromString(it->first.c_str()), PyLong_FromUsize(it->second));
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        return ret;
+      }
+
+
+      static PyObject* triton_getModel(PyObject* self, PyObject* args) {
+        PyObject* ret     = nullptr;
+        PyObject* node    = nullptr;
+        PyObject* timeout = nullptr;
+
+        /* Extract arguments */
+        PyArg_ParseTuple(args, "|OO", &node, &timeout);
+
+        /* Check if the architecture is definied */
+        if (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "getModel(): Architecture is not defined.");
+
+        if (node == nullptr || !PyAstNode_Check(node))
+          return PyErr_Format(PyExc_TypeError, "getModel(): Expects a AstNode as first argument.");
+
+        if (timeout != nullptr && !PyLong_Check(timeout) && !PyInt_Check(timeout))
+          return PyErr_Format(PyExc_TypeError, "getModel(): Expects an integer as second argument.");
+
+        try {
+          triton::ast::AbstractNode* ast = PyAstNode_AsAstNode(node);
+          triton::uint32 ms = (timeout == nullptr ? 0 : PyLong_AsUint32(timeout));
+          std::map<triton::uint32, triton::engines::solver::SolverModel> model;
+          {
+            GilRelease release;
+            model = triton::getCurrentApi().getModel(ast, ms);
+          }
+
+          ret = xPyDict_New();
+          for (auto it = model.begin(); it != model.end(); it++) {
+            PyDict_SetItem(ret, PyLong_FromUint32(it->first), PySolverModel(it->second));
+          }
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        return ret;
+      }
+
+
+      static PyObject* triton_getModelAsync(PyObject* self, PyObject* args) {
+        PyObject* node    = nullptr;
+        PyObject* timeout = nullptr;
+
+        /* Extract arguments */
+        PyArg_ParseTuple(args, "|OO", &node, &timeout);
+
+        /* Check if the architecture is definied */
+        if (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "getModelAsync(): Architecture is not defined.");
+
+        if (node == nullptr || !PyAstNode_Check(node))
+          return PyErr_Format(PyExc_TypeError, "getModelAsync(): Expects a AstNode as first argument.");
+
+        if (timeout != nullptr && !PyLong_Check(timeout) && !PyInt_Check(timeout))
+          return PyErr_Format(PyExc_TypeError, "getModelAsync(): Expects an integer as second argument.");
+
+        try {
+          return PyLong_FromUsize(triton::getCurrentApi().getModelAsync(PyAstNode_AsAstNode(node), timeout == nullptr ? 0 : PyLong_AsUint32(timeout)));
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* triton_getModels(PyObject* self, PyObject* args) {
+        PyObject* ret     = nullptr;
+        PyObject* node    = nullptr;
+        PyObject* limit   = nullptr;
+        PyObject* threads = nullptr;
+
+        /* Extract arguments */
+        PyArg_ParseTuple(args, "|OOO", &node, &limit, &threads);
+
+        /* Check if the architecture is definied */
+        if (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "getModels(): Architecture is not defined.");
+
+        if (node == nullptr || !PyAstNode_Check(node))
+          return PyErr_Format(PyExc_TypeError, "getModels(): Expects a AstNode as first argument.");
+
+        if (limit == nullptr || (!PyLong_Check(limit) && !PyInt_Check(limit)))
+          return PyErr_Format(PyExc_TypeError, "getModels(): Expects an integer as second argument.");
+
+        if (threads != nullptr && !PyLong_Check(threads) && !PyInt_Check(threads))
+          return PyErr_Format(PyExc_TypeError, "getModels(): Expects an integer as third argument.");
+
+        try {
+          triton::ast::AbstractNode* ast = PyAstNode_AsAstNode(node);
+          triton::uint32 count = PyLong_AsUint32(limit);
+          triton::uint32 workers = (threads == nullptr ? 1 : PyLong_AsUint32(threads));
+          std::list<std::map<triton::uint32, triton::engines::solver::SolverModel>> models;
+          triton::uint32 index = 0;
+          {
+            GilRelease release;
+            models = triton::getCurrentApi().getModels(ast, count, workers);
+          }
+
+          ret = xPyList_New(models.size());
+          for (auto it = models.begin(); it != models.end(); it++) {
+            PyObject* mdict = xPyDict_New();
+            auto model = *it;
+
+            for (auto it2 = model.begin(); it2 != model.end(); it2++) {
+              PyDict_SetItem(mdict, PyLong_FromUint32(it2->first), PySolverModel(it2->second));
+            }
+            if (model.size() > 0)
+              PyList_SetItem(ret, index++, mdict);
+          }
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        return ret;
+      }
+
+
+      static PyObject* triton_getModelValues(PyObject* self, PyObject* args) {
+        PyObject* ret     = nullptr;
+        PyObject* node    = nullptr;
+        PyObject* limit   = nullptr;
+        PyObject* threads = nullptr;
+
+        /* Extract arguments */
+        PyArg_ParseTuple(args, "|OOO", &node, &limit, &threads);
+
+        /* Check if the architecture is definied */
+        if (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "getModelValues(): Architecture is not defined.");
+
+        if (node == nullptr || !PyAstNode_Check(node))
+          return PyErr_Format(PyExc_TypeError, "getModelValues(): Expects a AstNode as first argument.");
+
+        if (limit == nullptr || (!PyLong_Check(limit) && !PyInt_Check(limit)))
+          return PyErr_Format(PyExc_TypeError, "getModelValues(): Expects an integer as second argument.");
+
+        if (threads != nullptr && !PyLong_Check(threads) && !PyInt_Check(threads))
+          return PyErr_Format(PyExc_TypeError, "getModelValues(): Expects an integer as third argument.");
+
+        try {
+          triton::ast::AbstractNode* ast = PyAstNode_AsAstNode(node);
+          triton::uint32 count = PyLong_AsUint32(limit);
+          triton::uint32 workers = (threads == nullptr ? 1 : PyLong_AsUint32(threads));
+          std::list<std::map<triton::uint32, triton::engines::solver::SolverModel>> models;
+          std::set<triton::uint32> ids;
+          {
+            GilRelease release;
+            models = triton::getCurrentApi().getModels(ast, count, workers);
+            for (auto it = models.begin(); it != models.end(); it++) {
+              for (auto it2 = it->begin(); it2 != it->end(); it2++)
+                ids.insert(it2->first);
+            }
+          }
+
+          PyObject* vars = xPyTuple_New(ids.size());
+          triton::uint32 index = 0;
+          for (auto it = ids.begin(); it != ids.end(); it++)
+            PyTuple_SetItem(vars, index++, PyLong_FromUint32(*it));
+
+          PyObject* values = xPyList_New(0);
+          for (auto it = models.begin(); it != models.end(); it++) {
+            if (it->empty())
+              continue;
+
+            PyObject* row = xPyTuple_New(ids.size());
+            index = 0;
+            for (auto it2 = ids.begin(); it2 != ids.end(); it2++) {
+              auto model = it->find(*it2);
+              if (model == it->end()) {
+                Py_INCREF(Py_None);
+                PyTuple_SetItem(row, index++, Py_None);
+              }
+              else
+                PyTuple_SetItem(row, index++, PyLong_FromUint512(model->second.getValue()));
+            }
+
+            PyList_Append(values, row);
+            Py_DECREF(row);
+          }
+
+          ret = xPyTuple_New(2);
+          PyTuple_SetItem(ret, 0, vars);
+          PyTuple_SetItem(ret, 1, values);
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        return ret;
+      }
+
+
+      static PyObject* triton_getModelsForBranches(PyObject* self, PyObject* pathConstraints) {
+        std::vector<triton::ast::AbstractNode*> constraints;
+        PyObject* ret = nullptr;
+
+        /* Check if the architecture is definied */
+        if (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "getModelsForBranches(): Architecture is not defined.");
+
+        if (!PyList_Check(pathConstraints))
+          return PyErr_Format(PyExc_TypeError, "getModelsForBranches(): Expects a list of AstNode as argument.");
+
+        for (Py_ssize_t i = 0; i < PyList_Size(pathConstraints); i++) {
+          PyObject* item = PyList_GetItem(pathConstraints, i);
+          if (!PyAstNode_Check(item))
+            return PyErr_Format(PyExc_TypeError, "getModelsForBranches(): Each element must be a AstNode.");
+          constraints.push_back(PyAstNode_AsAstNode(item));
+        }
+
+        try {
+          std::vector<std::map<triton::uint32, triton::engines::solver::SolverModel>> models;
+          {
+            GilRelease release;
+            models = triton::getCurrentApi().getModelsForBranches(constraints);
+          }
+
+          ret = xPyList_New(models.size());
+          for (triton::usize index = 0; index < models.size(); index++) {
+            PyObject* mdict = xPyDict_New();
+            for (auto it = models[index].begin(); it != models[index].end(); it++)
+              PyDict_SetItem(mdict, PyLong_FromUint32(it->first), PySolverModel(it->second));
+            PyList_SetItem(ret, index, mdict);
+          }
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        return ret;
+      }
+
+
+      static PyObject* triton_getNodeBudget(PyObject* self, PyObject* noarg) {
+        /* Check if the architecture is definied */
+        if (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "getNodeBudget(): Architecture is not defined.");
+
+        try {
+          return PyLong_FromUsize(triton::getCurrentApi().getNodeBudget());
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* triton_getNumberOfFrozenAstNodes(PyObject* self, PyObject* noarg) {
+        /* Check if the architecture is definied */
+        if (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "getNumberOfFrozenAstNodes(): Architecture is not defined.");
+
+        try {
+          return PyLong_FromUsize(triton::getCurrentApi().getNumberOfFrozenAstNodes());
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* triton_getNumberOfMergedBranches(PyObject* self, PyObject* noarg) {
+        /* Check if the architecture is definied */
+        if (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "getNumberOfMergedBranches(): Architecture is not defined.");
+
+        try {
+          return PyLong_FromUsize(triton::getCurrentApi().getNumberOfMergedBranches());
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* triton_getOpcodeProfile(PyObject* self, PyObject* noarg) {
+        PyObject* ret = nullptr;
+
+        /* Check if the architecture is definied */
+        if (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "getOpcodeProfile(): Architecture is not defined.");
+
+        try {
+          const std::map<triton::uint32, triton::arch::OpcodeProfile>& profiles = triton::getCurrentApi().getOpcodeProfile();
+
+          ret = xPyDict_New();
+          for (auto it = profiles.begin(); it != profiles.end(); it++) {
+            PyObject* profile = xPyDict_New();
+            PyDict_SetItemString(profile, "mnemonic",    PyString_FromString(it->second.mnemonic.c_str()));
+            PyDict_SetItemString(profile, "calls",       PyLong_FromUsize(it->second.calls));
+            PyDict_SetItemString(profile, "cycles",      PyLong_FromUint64(it->second.cycles));
+            PyDict_SetItemString(profile, "nodes",       PyLong_FromUsize(it->second.nodes));
+            PyDict_SetItemString(profile, "expressions", PyLong_FromUsize(it->second.expressions));
+            PyDict_SetItem(ret, PyLong_FromUint32(it->first), profile);
+          }
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        return ret;
+      }
+
+
+      static PyObject* triton_getParentRegisters(PyObject* self, PyObject* noarg) {
+        PyObject* ret = nullptr;
+
+        /* Check if the architecture is definied */
+        if (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "getParentRegisters(): Architecture is not defined.");
+
+        try {
+          triton::uint32 index = 0;
+          std::set<triton::arch::Register*> reg = triton::getCurrentApi().getParentRegisters();
+          ret = xPyList_New(reg.size());
+
+          for (auto it = reg.begin(); it != reg.end(); it++)
+            PyList_SetItem(ret, index++, PyRegisterSingleton((*it)->getId()));
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        return ret;
+      }
+
+
+      static PyObject* triton_getPartialModel(PyObject* self, PyObject* args) {
+        std::vector<triton::engines::symbolic::SymbolicVariable*> freeVariables;
+        PyObject* ret     = nullptr;
+        PyObject* node    = nullptr;
+        PyObject* vars    = nullptr;
+        PyObject* timeout = nullptr;
+
+        /* Extract arguments */
+        PyArg_ParseTuple(args, "|OOO", &node, &vars, &timeout);
+
+        /* Check if the architecture is definied */
+        if (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "getPartialModel(): Architecture is not defined.");
+
+        if (node == nullptr || !PyAstNode_Check(node))
+          return PyErr_Format(PyExc_TypeError, "getPartialModel(): Expects a AstNode as first argument.");
+
+        if (vars == nullptr || !PyList_Check(vars))
+          return PyErr_Format(PyExc_TypeError, "getPartialModel(): Expects a list of SymbolicVariable as second argument.");
+
+        if (timeout != nullptr && !PyLong_Check(timeout) && !PyInt_Check(timeout))
+          return PyErr_Format(PyExc_TypeError, "getPartialModel(): Expects an integer as third argument.");
+
+        for (Py_ssize_t i = 0; i < PyList_Size(vars); i++) {
+          PyObject* item = PyList_GetItem(vars, i);
+          if (!PySymbolicVariable_Check(item))
+            return PyErr_Format(PyExc_TypeError, "getPartialModel(): Each element of the list must be a SymbolicVariable.");
+          freeVariables.push_back(PySymbolicVariable_AsSymbolicVariable(item));
+        }
+
+        try {
+          triton::ast::AbstractNode* ast = PyAstNode_AsAstNode(node);
+          triton::uint32 ms = (timeout == nullptr ? 0 : PyLong_AsUint32(timeout));
+          std::map<triton::uint32, triton::engines::solver::SolverModel> model;
+          {
+            GilRelease release;
+            model = triton::getCurrentApi().getPartialModel(ast, freeVariables, ms);
+          }
+
+          ret = xPyDict_New();
+          for (auto it = model.begin(); it != model.end(); it++) {
+            PyDict_SetItem(ret, PyLong_FromUint32(it->first), PySolverModel(it->second));
+          }
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        return ret;
+      }
+
+
+      static PyObject* triton_getPathConstraints(PyObject* self, PyObject* noarg) {
+        PyObject* ret = nullptr;
+
+        /* Check if the architecture is definied */
+        if (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "getPathConstraintsAst(): Architecture is not defined.");
+
+        try {
+          triton::uint32 index = 0;
+          const std::vector<triton::engines::symbolic::PathConstraint>& pc = triton::getCurrentApi().getPathConstraints();
+          ret = xPyList_New(pc.size());
+
+          for (auto it = pc.begin(); it != pc.end(); it++)
+            PyList_SetItem(ret, index++, PyPathConstraint(*it));
+
+          return ret;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* triton_getPathConstraintsAst(PyObject* self, PyObject* noarg) {
+        /* Check if the architecture is definied */
+        if (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "getPathConstraintsAst(): Architecture is not defined.");
+
+        try {
+          return PyAstNode(triton::getCurrentApi().getPathConstraintsAst());
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* triton_getPathConstraintsSlice(PyObject* self, PyObject* index) {
+        PyObject* ret = nullptr;
+
+        /* Check if the architecture is definied */
+        if (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "getPathConstraintsSlice(): Architecture is not defined.");
+
+        if (!PyLong_Check(index) && !PyInt_Check(index))
+          return PyErr_Format(PyExc_TypeError, "getPathConstraintsSlice(): Expects an integer as argument.");
+
+        try {
+          std::vector<triton::usize> slice = triton::getCurrentApi().getPathConstraintsSlice(PyLong_AsUsize(index));
+
+          ret = xPyList_New(slice.size());
+          for (triton::usize i = 0; i < slice.size(); i++)
+            PyList_SetItem(ret, i, PyLong_FromUsize(slice[i]));
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        return ret;
+      }
+
+
+      static PyObject* triton_getPathConstraintsSliceAst(PyObject* self, PyObject* index) {
+        /* Check if the architecture is definied */
+        if (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "getPathConstraintsSliceAst(): Architecture is not defined.");
+
+        if (!PyLong_Check(index) && !PyInt_Check(index))
+          return PyErr_Format(PyExc_TypeError, "getPathConstraintsSliceAst(): Expects an integer as argument.");
+
+        try {
+          return PyAstNode(triton::getCurrentApi().getPathConstraintsSliceAst(PyLong_AsUsize(index)));
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* triton_getPointerPolicy(PyObject* self, PyObject* addr) {
+        /* Check if the architecture is definied */
+        if (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "getPointerPolicy(): Architecture is not defined.");
+
+        if (!PyLong_Check(addr) && !PyInt_Check(addr))
+          return PyErr_Format(PyExc_TypeError, "getPointerPolicy(): Expects an integer as argument.");
+
+        try {
+          const triton::engines::symbolic::PointerPolicy& policy = triton::getCurrentApi().getPointerPolicy(PyLong_AsUint64(addr));
+          PyObject* ret = xPyDict_New();
+          PyDict_SetItemString(ret, "policy", PyLong_FromUint32(policy.kind));
+          PyDict_SetItemString(ret, "range",  PyLong_FromUint32(policy.range));
+          return ret;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* triton_getQueryCacheHits(PyObject* self, PyObject* noarg) {
+        /* Check if the architecture is definied */
+        if (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "getQueryCacheHits(): Architecture is not defined.");
+
+        try {
+          return PyLong_FromUsize(triton::getCurrentApi().getQueryCacheHits());
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* triton_getQueryCacheMisses(PyObject* self, PyObject* noarg) {
+        /* Check if the architecture is definied */
+        if (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "getQueryCacheMisses(): Architecture is not defined.");
+
+        try {
+          return PyLong_FromUsize(triton::getCurrentApi().getQueryCacheMisses());
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* triton_getRegisterLabels(PyObject* self, PyObject* reg) {
+        PyObject* ret       = nullptr;
+        triton::usize index = 0;
+
+        /* Check if the architecture is definied */
+        if (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "getRegisterLabels(): Architecture is not defined.");
+
+        if (!PyRegister_Check(reg))
+          return PyErr_Format(PyExc_TypeError, "getRegisterLabels(): Expects a REG as argument.");
+
+        try {
+          std::set<triton::uint32> labels = triton::getCurrentApi().getRegisterLabels(*PyRegister_AsRegister(reg));
+
+          ret = xPyList_New(labels.size());
+          for (auto it = labels.begin(); it != labels.end(); it++) {
+            PyList_SetItem(ret, index, PyLong_FromUint32(*it));
+            index++;
+          }
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        return ret;
+      }
+
+
+      static PyObject* triton_getRemoteSolver(PyObject* self, PyObject* noarg) {
+        /* Check if the architecture is definied */
+        if (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "getRemoteSolver(): Architecture is not defined.");
+
+        try {
+          return PyString_FromString(triton::getCurrentApi().getRemoteSolver().c_str());
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* triton_getSessionModel(PyObject* self, PyObject* args) {
+        std::vector<triton::ast::AbstractNode*> prefix;
+        PyObject* ret      = nullptr;
+        PyObject* pyPrefix = nullptr;
+        PyObject* node     = nullptr;
+
+        /* Extract arguments */
+        PyArg_ParseTuple(args, "|OO", &pyPrefix, &node);
+
+        /* Check if the architecture is definied */
+        if (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "getSessionModel(): Architecture is not defined.");
+
+        if (pyPrefix == nullptr || !PyList_Check(pyPrefix))
+          return PyErr_Format(PyExc_TypeError, "getSessionModel(): Expects a list of AstNode as first argument.");
+
+        if (node == nullptr || !PyAstNode_Check(node))
+          return PyErr_Format(PyExc_TypeError, "getSessionModel(): Expects a AstNode as second argument.");
+
+        for (Py_ssize_t i = 0; i < PyList_Size(pyPrefix); i++) {
+          PyObject* item = PyList_GetItem(pyPrefix, i);
+          if (!PyAstNode_Check(item))
+            return PyErr_Format(PyExc_TypeError, "getSessionModel(): Each element of the prefix must be a AstNode.");
+          prefix.push_back(PyAstNode_AsAstNode(item));
+        }
+
+        try {
+          ret = xPyDict_New();
+          auto model = triton::getCurrentApi().getSessionModel(prefix, PyAstNode_AsAstNode(node));
+          for (auto it = model.begin(); it != model.end(); it++) {
+            PyDict_SetItem(ret, PyLong_FromUint32(it->first), PySolverModel(it->second));
+          }
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        return ret;
+      }
+
+
+      static PyObject* triton_getSolverBackend(PyObject* self, PyObject* noarg) {
+        /* Check if the architecture is definied */
+        if (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "getSolverBackend(): Architecture is not defined.");
+
+        try {
+          return PyLong_FromUint32(triton::getCurrentApi().getSolverBackend());
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* triton_getStateMergingLimit(PyObject* self, PyObject* noarg) {
+        /* Check if the architecture is definied */
+        if (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "getStateMergingLimit(): Architecture is not defined.");
+
+        try {
+          return PyLong_FromUsize(triton::getCurrentApi().getStateMergingLimit());
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* triton_getStatistics(PyObject* self, PyObject* noarg) {
+        PyObject* ret = nullptr;
+
+        /* Check if the architecture is definied */
+        if (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "getStatistics(): Architecture is not defined.");
+
+        try {
+          std::map<std::string, triton::usize> stats = triton::getCurrentApi().getStatistics();
+
+          ret = xPyDict_New();
+          for (auto it = stats.begin(); it != stats.end(); it++)
+            PyDict_SetItem(ret, PyString_FromString(it->first.c_str()), PyLong_FromUsize(it->second));
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        return ret;
+      }
+
+
+      static PyObject* triton_getSymbolicExpressionFromId(PyObject* self, PyObject* symExprId) {
+        /* Check if the architecture is definied */
+        if (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "getSymbolicExpressionFromId(): Architecture is not defined.");
+
+        if (!PyLong_Check(symExprId) && !PyInt_Check(symExprId))
+          return PyErr_Format(PyExc_TypeError, "getSymbolicExpressionFromId(): Expects an integer as argument.");
+
+        try {
+          return PySymbolicExpression(triton::getCurrentApi().getSymbolicExpressionFromId(PyLong_AsUsize(symExprId)));
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* triton_getSymbolicExpressions(PyObject* self, PyObject* noarg) {
+        PyObject* ret = nullptr;
+
+        /* Check if the architecture is definied */
+        if (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "getTaintedSymbolicExpressions(): Architecture is not defined.");
+
+        try {
+          const auto& expressions = triton::getCurrentApi().getSymbolicExpressions();
+
+          ret = xPyDict_New();
+          for (auto it = expressions.begin(); it != expressions.end(); it++)
+            PyDict_SetItem(ret, PyLong_FromUsize(it->first), PySymbolicExpression(it->second));
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        return ret;
+      }
+
+
+      static PyObject* triton_getSymbolicMemory(PyObject* self, PyObject* args) {
+        PyObject* ret   = nullptr;
+        PyObject* start = nullptr;
+        PyObject* end   = nullptr;
+
+        /* Extract arguments */
+        PyArg_ParseTuple(args, "|OO", &start, &end);
+
+        /* Check if the architecture is definied */
+        if (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "getSymbolicMemory(): Architecture is not defined.");
+
+        if ((start == nullptr) != (end == nullptr))
+          return PyErr_Format(PyExc_TypeError, "getSymbolicMemory(): Expects no argument or two integers.");
+
+        if (start != nullptr && ((!PyLong_Check(start) && !PyInt_Check(start)) || (!PyLong_Check(end) && !PyInt_Check(end))))
+          return PyErr_Format(PyExc_TypeError, "getSymbolicMemory(): Expects two integers as arguments.");
+
+        try {
+          std::map<triton::uint64, triton::engines::symbolic::SymbolicExpression*> regs;
+          if (start == nullptr)
+            regs = triton::getCurrentApi().getSymbolicMemory();
+          else
+            regs = triton::getCurrentApi().getSymbolicMemory(PyLong_AsUint64(start), PyLong_AsUint64(end));
+
+          ret = xPyDict_New();
+          for (auto it = regs.begin(); it != regs.end(); it++) {
+            PyDict_SetItem(ret, PyLong_FromUint64(it->first), PySymbolicExpression(it->second));
+          }
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        return ret;
+      }
+
+
+      static PyObject* triton_getSymbolicMemoryBuffer(PyObject* self, PyObject* noarg) {
+        std::vector<triton::uint64> values;
+
+        /* Check if the architecture is definied */
+        if (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "getSymbolicMemoryBuffer(): Architecture is not defined.");
+
+        try {
+          triton::getCurrentApi().forEachSymbolicMemoryId([&values](triton::uint64 addr, triton::usize id) {
+            values.push_back(addr);
+            values.push_back(id);
+          });
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        return PyByteArray_FromStringAndSize(reinterpret_cast<const char*>(values.data()), values.size() * sizeof(triton::uint64));
+      }
+
+
+      static PyObject* triton_getSymbolicMemoryId(PyObject* self, PyObject* addr) {
+        /* Check if the architecture is definied */
+        if (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "getSymbolicMemoryId(): Architecture is not defined.");
+
+        if (!PyLong_Check(addr) && !PyInt_Check(addr))
+          return PyErr_Format(PyExc_TypeError, "getSymbolicMemoryId(): Expects an integer as argument.");
+
+        try {
+          return PyLong_FromUsize(triton::getCurrentApi().getSymbolicMemoryId(PyLong_AsUint64(addr)));
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* triton_getSymbolicMemoryRanges(PyObject* self, PyObject* noarg) {
+        std::vector<triton::uint64> values;
+
+        /* Check if the architecture is definied */
+        if (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "getSymbolicMemoryRanges(): Architecture is not defined.");
+
+        try {
+          triton::getCurrentApi().forEachSymbolicMemoryId([&values](triton::uint64 addr, triton::usize id) {
+            /* Extends the last range if the address follows it */
+            if (!values.empty() && values[values.size() - 2] + values.back() == addr)
+              values.back()++;
+            else {
+              values.push_back(addr);
+              values.push_back(1);
+            }
+          });
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        return PyByteArray_FromStringAndSize(reinterpret_cast<const char*>(values.data()), values.size() * sizeof(triton::uint64));
+      }
+
+
+      static PyObject* triton_getSymbolicMemoryValue(PyObject* self, PyObject* mem) {
+        /* Check if the architecture is definied */
+        if (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "getSymbolicMemoryValue(): Architecture is not defined.");
+
+        if (!PyLong_Check(mem) && !PyInt_Check(mem) && !PyMemoryAccess_Check(mem))
+          return PyErr_Format(PyExc_TypeError, "getSymbolicMemoryValue(): Expects an integer or a MemoryAccess as argument.");
+
+        try {
+          if (PyLong_Check(mem) || PyInt_Check(mem))
+            return PyLong_FromUint512(triton::getCurrentApi().getSymbolicMemoryValue(PyLong_AsUint64(mem)));
+          return PyLong_FromUint512(triton::getCurrentApi().getSymbolicMemoryValue(*PyMemoryAccess_AsMemoryAccess(mem)));
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* triton_getSymbolicRegions(PyObject* self, PyObject* noarg) {
+        PyObject* ret = nullptr;
+
+        /* Check if the architecture is definied */
+        if (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "getSymbolicRegions(): Architecture is not defined.");
+
+        try {
+          const auto& regions = triton::getCurrentApi().getSymbolicRegions();
+          triton::uint32 index = 0;
+
+          ret = xPyList_New(regions.size());
+          for (auto it = regions.begin(); it != regions.end(); it++) {
+            PyObject* region = xPyTuple_New(2);
+            PyTuple_SetItem(region, 0, PyLong_FromUint64(it->first));
+            PyTuple_SetItem(region, 1, PyLong_FromUint64(it->second));
+            PyList_SetItem(ret, index++, region);
+          }
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        return ret;
+      }
+
+
+      static PyObject* triton_getSymbolicRegisters(PyObject* self, PyObject* noarg) {
+        PyObject* ret = nullptr;
+
+        /* Check if the architecture is definied */
+        if (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "getSymbolicRegisters(): Architecture is not defined.");
+
+        try {
+          auto regs = triton::getCurrentApi().getSymbolicRegisters();
+
+          ret = xPyDict_New();
+          for (auto it = regs.begin(); it != regs.end(); it++) {
+            triton::arch::Register reg(it->first);
+            PyDict_SetItem(ret, PyRegister(reg), PySymbolicExpression(it->second));
+          }
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        return ret;
+      }
+
+
+      static PyObject* triton_getSymbolicRegisterId(PyObject* self, PyObject* reg) {
+        /* Check if the architecture is definied */
+        if (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "getSymbolicRegisterId(): Architecture is not defined.");
+
+        if (!PyRegister_Check(reg))
+          return PyErr_Format(PyExc_TypeError, "getSymbolicRegisterId(): Expects a REG as argument.");
+
+        try {
+          return PyLong_FromUsize(triton::getCurrentApi().getSymbolicRegisterId(*PyRegister_AsRegister(reg)));
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* triton_getSymbolicRegisterValue(PyObject* self, PyObject* reg) {
+        /* Check if the architecture is definied */
+        if (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "getSymbolicRegisterValue(): Architecture is not defined.");
+
+        if (!PyRegister_Check(reg))
+          return PyErr_Format(PyExc_TypeError, "getSymbolicRegisterValue(): Expects a REG as argument.");
+
+        try {
+          return PyLong_FromUint512(triton::getCurrentApi().getSymbolicRegisterValue(*PyRegister_AsRegister(reg)));
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* triton_getSymbolicVariableFromId(PyObject* self, PyObject* symVarId) {
+        /* Check if the architecture is definied */
+        if (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "getSymbolicVariableFromId(): Architecture is not defined.");
+
+        if (!PyLong_Check(symVarId) && !PyInt_Check(symVarId))
+          return PyErr_Format(PyExc_TypeError, "getSymbolicVariableFromId(): Expects an integer as argument.");
+
+        try {
+          return PySymbolicVariable(triton::getCurrentApi().getSymbolicVariableFromId(PyLong_AsUsize(symVarId)));
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* triton_getSymbolicVariableFromName(PyObject* self, PyObject* symVarName) {
+        /* Check if the architecture is definied */
+        if (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "getSymbolicVariableFromName(): Architecture is not defined.");
+
+        if (!PyString_Check(symVarName))
+          return PyErr_Format(PyExc_TypeError, "getSymbolicVariableFromName(): Expects a string as argument.");
+
+        try {
+          std::string arg = PyString_AsString(symVarName);
+          return PySymbolicVariable(triton::getCurrentApi().getSymbolicVariableFromName(arg));
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* triton_getSymbolicVariables(PyObject* self, PyObject* noarg) {
+        PyObject* ret = nullptr;
+
+        /* Check if the architecture is definied */
+        if (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "getTaintedSymbolicVariables(): Architecture is not defined.");
+
+        try {
+          const auto& variables = triton::getCurrentApi().getSymbolicVariables();
+
+          ret = xPyDict_New();
+          for (auto it = variables.begin(); it != variables.end(); it++)
+            PyDict_SetItem(ret, PyLong_FromUsize(it->first), PySymbolicVariable(it->second));
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        return ret;
+      }
+
+
+      static PyObject* triton_getTaintedMemory(PyObject* self, PyObject* noarg) {
+        PyObject* ret = nullptr;
+        triton::usize size = 0, index = 0;
+
+        /* Check if the architecture is definied */
+        if (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "getTaintedMemory(): Architecture is not defined.");
+
+        try {
+          std::set<triton::uint64> addresses = triton::getCurrentApi().getTaintedMemory();
+
+          size = addresses.size();
+          ret = xPyList_New(size);
+          for (auto it = addresses.begin(); it != addresses.end(); it++) {
+            PyList_SetItem(ret, index, PyLong_FromUint64(*it));
+            index++;
+          }
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        return ret;
+      }
+
+
+      static PyObject* triton_getTaintedMemoryBuffer(PyObject* self, PyObject* noarg) {
+        std::vector<triton::uint64> values;
+
+        /* Check if the architecture is definied */
+        if (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "getTaintedMemoryBuffer(): Architecture is not defined.");
+
+        try {
+          triton::getCurrentApi().forEachTaintedMemoryRange([&values](triton::uint64 addr, triton::usize size) {
+            for (triton::usize index = 0; index < size; index++)
+              values.push_back(addr + index);
+          });
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        return PyByteArray_FromStringAndSize(reinterpret_cast<const char*>(values.data()), values.size() * sizeof(triton::uint64));
+      }
+
+
+      static PyObject* triton_getTaintedMemoryRanges(PyObject* self, PyObject* noarg) {
+        std::vector<triton::uint64> values;
+
+        /* Check if the architecture is definied */
+        if (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "getTaintedMemoryRanges(): Architecture is not defined.");
+
+        try {
+          triton::getCurrentApi().forEachTaintedMemoryRange([&values](triton::uint64 addr, triton::usize size) {
+            values.push_back(addr);
+            values.push_back(size);
+          });
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        return PyByteArray_FromStringAndSize(reinterpret_cast<const char*>(values.data()), values.size() * sizeof(triton::uint64));
+      }
+
+
+      static PyObject* triton_getTaintedRegisters(PyObject* self, PyObject* noarg) {
+        PyObject* ret = nullptr;
+        triton::usize size = 0, index = 0;
+
+        /* Check if the architecture is definied */
+        if (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "getTaintedRegisters(): Architecture is not defined.");
+
+        try {
+          std::set<triton::arch::Register> registers = triton::getCurrentApi().getTaintedRegisters();
+
+          size = registers.size();
+          ret = xPyList_New(size);
+          for (auto it = registers.begin(); it != registers.end(); it++) {
+            PyList_SetItem(ret, index, PyRegister(*it));
+            index++;
+          }
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        return ret;
+      }
+
+
+      static PyObject* triton_getTaintedSymbolicExpressions(PyObject* self, PyObject* args) {
+        PyObject* ret = nullptr;
+        PyObject* fromId = nullptr;
+        triton::usize size = 0, index = 0;
+
+        /* Extract arguments */
+        PyArg_ParseTuple(args, "|O", &fromId);
+
+        /* Check if the architecture is definied */
+        if (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "getTaintedSymbolicExpressions(): Architecture is not defined.");
+
+        if (fromId != nullptr && !PyLong_Check(fromId) && !PyInt_Check(fromId))
+          return PyErr_Format(PyExc_TypeError, "getTaintedSymbolicExpressions(): Expects an integer as first argument.");
+
+        try {
+          auto expressions = triton::getCurrentApi().getTaintedSymbolicExpressions(fromId == nullptr ? 0 : PyLong_AsUsize(fromId));
+
+          size = expressions.size();
+          ret = xPyList_New(size);
+          for (auto it = expressions.begin(); it != expressions.end(); it++) {
+            PyList_SetItem(ret, index, PySymbolicExpression(*it));
+            index++;
+          }
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        return ret;
+      }
+
+
+      static PyObject* triton_getVirtualFile(PyObject* self, PyObject* path) {
+        /* Check if the architecture is definied */
+        if (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "getVirtualFile(): Architecture is not defined.");
+
+        if (!PyString_Check(path))
+          return PyErr_Format(PyExc_TypeError, "getVirtualFile(): Expects a string as argument.");
+
+        try {
+          std::vector<triton::uint8> content = triton::getCurrentApi().getSyscallEmulator()->getFile(PyString_AsString(path));
+          return PyBytes_FromStringAndSize(reinterpret_cast<const char*>(content.data()), content.size());
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* triton_initMemoryArrayArea(PyObject* self, PyObject* args) {
+        PyObject* baseAddr = nullptr;
+        PyObject* size     = nullptr;
+
+        /* Extract arguments */
+        PyArg_ParseTuple(args, "|OO", &baseAddr, &size);
+
+        /* Check if the architecture is definied */
+        if (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "initMemoryArrayArea(): Architecture is not defined.");
+
+        if (baseAddr == nullptr || (!PyLong_Check(baseAddr) && !PyInt_Check(baseAddr)))
+          return PyErr_Format(PyExc_TypeError, "initMemoryArrayArea(): Expects an integer as first argument.");
+
+        if (size == nullptr || (!PyLong_Check(size) && !PyInt_Check(size)))
+          return PyErr_Format(PyExc_TypeError, "initMemoryArrayArea(): Expects an integer as second argument.");
+
+        try {
+          triton::getCurrentApi().initMemoryArrayArea(PyLong_AsUint64(baseAddr), PyLong_AsUsize(size));
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
+      static PyObject* triton_isArchitectureValid(PyObject* self, PyObject* noarg) {
+        if (triton::getCurrentApi().isArchitectureValid() == true)
+          Py_RETURN_TRUE;
+        Py_RETURN_FALSE;
+      }
+
+
+      static PyObject* triton_isAsyncModelReady(PyObject* self, PyObject* id) {
+        /* Check if the architecture is definied */
+        if (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "isAsyncModelReady(): Architecture is not defined.");
+
+        if (!PyLong_Check(id) && !PyInt_Check(id))
+          return PyErr_Format(PyExc_TypeError, "isAsyncModelReady(): Expects an integer as argument.");
+
+        try {
+          if (triton::getCurrentApi().isAsyncModelReady(PyLong_AsUsize(id)) == true)
+            Py_RETURN_TRUE;
+          Py_RETURN_FALSE;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* triton_isMemoryMapped(PyObject* self, PyObject* args) {
+        PyObject* baseAddr        = nullptr;
+        PyObject* size            = nullptr;
+        triton::uint64 c_baseAddr = 0;
+        triton::usize c_size      = 1;
+
+        /* Extract arguments */
+        PyArg_ParseTuple(args, "|OO", &baseAddr, &size);
+
+        /* Check if the architecture is definied */
+        if (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "isMemoryMapped(): Architecture is not defined.");
+
+        if (baseAddr == nullptr || (!PyLong_Check(baseAddr) && !PyInt_Check(baseAddr)))
+          return PyErr_Format(PyExc_TypeError, "isMemoryMapped(): Expects a base address (integer) as first argument.");
+
+        if (size != nullptr && !PyLong_Check(size) && !PyInt_Check(size))
+          return PyErr_Format(PyExc_TypeError, "isMemoryMapped(): Expects a size (integer) as second argument.");
+
+        try {
+          c_baseAddr = PyLong_AsUint64(baseAddr);
+          if (size != nullptr)
+            c_size = PyLong_AsUsize(size);
+          if (triton::getCurrentApi().isMemoryMapped(c_baseAddr, c_size) == true)
+            Py_RETURN_TRUE;
+          Py_RETURN_FALSE;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* triton_isMemorySymbolized(PyObject* self, PyObject* mem) {
+        /* Check if the architecture is definied */
+        if (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "isMemorySymbolized(): Architecture is not defined.");
+
+        if (PyMemoryAccess_Check(mem)) {
+          if (triton::getCurrentApi().isMemorySymbolized(*PyMemoryAccess_AsMemoryAccess(mem)) == true)
+            Py_RETURN_TRUE;
+        }
+
+        else if (PyLong_Check(mem) || PyInt_Check(mem)) {
+          if (triton::getCurrentApi().isMemorySymbolized(PyLong_AsUint64(mem)) == true)
+            Py_RETURN_TRUE;
+        }
+
+        else
+          return PyErr_Format(PyExc_TypeError, "isMemorySymbolized(): Expects a MemoryAccess or an integer as argument.");
+
+        Py_RETURN_FALSE;
+      }
+
+
+      static PyObject* triton_isMemoryTainted(PyObject* self, PyObject* mem) {
+        /* Check if the architecture is definied */
+        if (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "isMemoryTainted(): Architecture is not defined.");
+
+        if (PyMemoryAccess_Check(mem)) {
+          if (triton::getCurrentApi().isMemoryTainted(*PyMemoryAccess_AsMemoryAccess(mem)) == true)
+            Py_RETURN_TRUE;
+        }
+
+        else if (PyLong_Check(mem) || PyInt_Check(mem)) {
+          if (triton::getCurrentApi().isMemoryTainted(PyLong_AsUint64(mem)) == true)
+            Py_RETURN_TRUE;
+        }
+
+        else
+          return PyErr_Format(PyExc_TypeError, "isMemoryTainted(): Expects a MemoryAccess or an integer as argument.");
+
+        Py_RETURN_FALSE;
+      }
+
+
+      static PyObject* triton_isRegisterSymbolized(PyObject* self, PyObject* reg) {
+        /* Check if the architecture is definied */
+        if (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "isRegisterSymbolized(): Architecture is not defined.");
+
+        if (!PyRegister_Check(reg))
+          return PyErr_Format(PyExc_TypeError, "isRegisterSymbolized(): Expects a REG as argument.");
+
+        if (triton::getCurrentApi().isRegisterSymbolized(*PyRegister_AsRegister(reg)) == true)
+          Py_RETURN_TRUE;
+        Py_RETURN_FALSE;
+      }
+
+
+      static PyObject* triton_isRegisterTainted(PyObject* self, PyObject* reg) {
+        /* Check if the architecture is definied */
+        if (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "isRegisterTainted(): Architecture is not defined.");
+
+        if (!PyRegister_Check(reg))
+          return PyErr_Format(PyExc_TypeError, "isRegisterTainted(): Expects a REG as argument.");
+
+        if (triton::getCurrentApi().isRegisterTainted(*PyRegister_AsRegister(reg)) == true)
+          Py_RETURN_TRUE;
+        Py_RETURN_FALSE;
+      }
+
+
+      static PyObject* triton_isSolverSessionStarted(PyObject* self, PyObject* noarg) {
+        if (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "isSolverSessionStarted(): Architecture is not defined.");
+
+        if (triton::getCurrentApi().isSolverSessionStarted() == true)
+          Py_RETURN_TRUE;
+        Py_RETURN_FALSE;
+      }
+
+
+      static PyObject* triton_isSymbolicEngineEnabled(PyObject* self, PyObject* noarg) {
+        if (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "isSymbolicEngineEnabled(): Architecture is not defined.");
+
+        if (triton::getCurrentApi().isSymbolicEngineEnabled() == true)
+          Py_RETURN_TRUE;
+        Py_RETURN_FALSE;
+      }
+
+
+      static PyObject* triton_isSymbolicExpressionIdExists(PyObject* self, PyObject* symExprId) {
+        if (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "isSymbolicExpressionIdExists(): Architecture is not defined.");
+
+        if (!PyInt_Check(symExprId) && !PyLong_Check(symExprId))
+          return PyErr_Format(PyExc_TypeError, "isSymbolicExpressionIdExists(): Expects an integer as argument.");
+
+        if (triton::getCurrentApi().isSymbolicExpressionIdExists(PyLong_AsUsize(symExprId)) == true)
+          Py_RETURN_TRUE;
+        Py_RETURN_FALSE;
+      }
+
+
+      static PyObject* triton_isModeEnabled(PyObject* self, PyObject* mode) {
+        if (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "isModeEnabled(): Architecture is not defined.");
+
+        if (!PyInt_Check(mode) && !PyLong_Check(mode))
+          return PyErr_Format(PyExc_TypeError, "isModeEnabled(): Expects a MODE as argument.");
+
+        if (triton::getCurrentApi().isModeEnabled(static_cast<enum triton::modes::mode_e>(PyLong_AsUint32(mode))) == true)
+          Py_RETURN_TRUE;
+        Py_RETURN_FALSE;
+      }
+
+
+      static PyObject* triton_isSyscallEmulationEnabled(PyObject* self, PyObject* noarg) {
+        /* Check if the architecture is definied */
+        if (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "isSyscallEmulationEnabled(): Architecture is not defined.");
+
+        try {
+          if (triton::getCurrentApi().isSyscallEmulationEnabled() == true)
+            Py_RETURN_TRUE;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_RETURN_FALSE;
+      }
+
+
+      static PyObject* triton_isTaintEngineEnabled(PyObject* self, PyObject* noarg) {
+        if (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "isTaintEngineEnabled(): Architecture is not defined.");
+
+        if (triton::getCurrentApi().isTaintEngineEnabled() == true)
+          Py_RETURN_TRUE;
+        Py_RETURN_FALSE;
+      }
+
+
+      static PyObject* triton_isUndoJournalEnabled(PyObject* self, PyObject* noarg) {
+        if (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "isUndoJournalEnabled(): Architecture is not defined.");
+
+        if (triton::getCurrentApi().isUndoJournalEnabled() == true)
+          Py_RETURN_TRUE;
+        Py_RETURN_FALSE;
+      }
+
+
+      static PyObject* triton_labelMemory(PyObject* self, PyObject* args) {
+        PyObject* addr  = nullptr;
+        PyObject* label = nullptr;
+
+        /* Extract arguments */
+        PyArg_ParseTuple(args, "|OO", &addr, &label);
+
+        /* Check if the architecture is definied */
+        if (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "labelMemory(): Architecture is not defined.");
+
+        if (addr == nullptr || (!PyLong_Check(addr) && !PyInt_Check(addr)))
+          return PyErr_Format(PyExc_TypeError, "labelMemory(): Expects an address (integer) as first argument.");
+
+        if (label == nullptr || (!PyLong_Check(label) && !PyInt_Check(label)))
+          return PyErr_Format(PyExc_TypeError, "labelMemory(): Expects a label (integer) as second argument.");
+
+        try {
+          if (triton::getCurrentApi().labelMemory(PyLong_AsUint64(addr), PyLong_AsUint32(label)) == true)
+            Py_RETURN_TRUE;
+          Py_RETURN_FALSE;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* triton_labelRegister(PyObject* self, PyObject* args) {
+        PyObject* reg   = nullptr;
+        PyObject* label = nullptr;
+
+        /* Extract arguments */
+        PyArg_ParseTuple(args, "|OO", &reg, &label);
+
+        /* Check if the architecture is definied */
+        if (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "labelRegister(): Architecture is not defined.");
+
+        if (reg == nullptr || !PyRegister_Check(reg))
+          return PyErr_Format(PyExc_TypeError, "labelRegister(): Expects a REG as first argument.");
+
+        if (label == nullptr || (!PyLong_Check(label) && !PyInt_Check(label)))
+          return PyErr_Format(PyExc_TypeError, "labelRegister(): Expects a label (integer) as second argument.");
+
+        try {
+          if (triton::getCurrentApi().labelRegister(*PyRegister_AsRegister(reg), PyLong_AsUint32(label)) == true)
+            Py_RETURN_TRUE;
+          Py_RETURN_FALSE;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* triton_loadBinary(PyObject* self, PyObject* binary) {
+        if (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "loadBinary(): Architecture is not defined.");
+
+        if (!PyElf_Check(binary) && !PyPe_Check(binary))
+          return PyErr_Format(PyExc_TypeError, "loadBinary(): Expects an Elf or a Pe as argument.");
+
+        try {
+          if (PyElf_Check(binary))
+            triton::getCurrentApi().loadBinary(*PyElf_AsElf(binary));
+          else
+            triton::getCurrentApi().loadBinary(*PyPe_AsPe(binary));
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
+      static PyObject* triton_loadCheckpoint(PyObject* self, PyObject* path) {
+        /* Check if the architecture is definied */
+        if (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "loadCheckpoint(): Architecture is not defined.");
+
+        if (!PyString_Check(path))
+          return PyErr_Format(PyExc_TypeError, "loadCheckpoint(): Expects a string as argument.");
+
+        try {
+          triton::getCurrentApi().loadCheckpoint(PyString_AsString(path));
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
+      static PyObject* triton_loadCoreDump(PyObject* self, PyObject* path) {
+        /* Check if the architecture is definied */
+        if (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "loadCoreDump(): Architecture is not defined.");
+
+        if (!PyString_Check(path))
+          return PyErr_Format(PyExc_TypeError, "loadCoreDump(): Expects a string as argument.");
+
+        try {
+          return PyLong_FromUsize(triton::getCurrentApi().loadCoreDump(PyString_AsString(path)));
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* triton_loadDecodeCache(PyObject* self, PyObject* args) {
+        PyObject* directory = nullptr;
+        PyObject* binary    = nullptr;
+        triton::usize ret   = 0;
+
+        /* Extract arguments */
+        PyArg_ParseTuple(args, "|OO", &directory, &binary);
+
+        /* Check if the architecture is definied */
+        if (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "loadDecodeCache(): Architecture is not defined.");
+
+        if (directory == nullptr || !PyString_Check(directory))
+          return PyErr_Format(PyExc_TypeError, "loadDecodeCache(): Expects a string as first argument.");
+
+        if (binary == nullptr || (!PyElf_Check(binary) && !PyPe_Check(binary)))
+          return PyErr_Format(PyExc_TypeError, "loadDecodeCache(): Expects an Elf or a Pe as second argument.");
+
+        try {
+          if (PyElf_Check(binary))
+            ret = triton::getCurrentApi().loadDecodeCache(PyString_AsString(directory), *PyElf_AsElf(binary));
+          else
+            ret = triton::getCurrentApi().loadDecodeCache(PyString_AsString(directory), *PyPe_AsPe(binary));
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        return PyLong_FromUsize(ret);
+      }
+
+
+      static PyObject* triton_newSymbolicExpression(PyObject* self, PyObject* args) {
+        PyObject* node          = nullptr;
+        PyObject* comment       = nullptr;
+        std::string ccomment    = "";
+
+        /* Extract arguments */
+        PyArg_ParseTuple(args, "|OO", &node, &comment);
+
+        /* Check if the architecture is definied */
+        if (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "newSymbolicExpression(): Architecture is not defined.");
+
+        if (node == nullptr || (!PyAstNode_Check(node)))
+          return PyErr_Format(PyExc_TypeError, "newSymbolicExpression(): Expects a AstNode as first argument.");
+
+        if (comment != nullptr && !PyString_Check(comment))
+          return PyErr_Format(PyExc_TypeError, "newSymbolicExpression(): Expects a sting as second argument.");
+
+        if (comment != nullptr)
+          ccomment = PyString_AsString(comment);
+
+        try {
+          return PySymbolicExpression(triton::getCurrentApi().newSymbolicExpression(PyAstNode_AsAstNode(node), ccomment));
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* triton_newSymbolicVariable(PyObject* self, PyObject* args) {
+        PyObject* size        = nullptr;
+        PyObject* comment     = nullptr;
+        std::string ccomment  = "";
+
+        /* Extract arguments */
+        PyArg_ParseTuple(args, "|OO", &size, &comment);
+
+        /* Check if the architecture is definied */
+        if (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "newSymbolicVariable(): Architecture is not defined.");
+
+        if (size == nullptr || (!PyLong_Check(size) && !PyInt_Check(size)))
+          return PyErr_Format(PyExc_TypeError, "newSymbolicVariable(): Expects an integer as first argument.");
+
+        if (comment != nullptr && !PyString_Check(comment))
+          return PyErr_Format(PyExc_TypeError, "newSymbolicVariable(): Expects a sting as second  argument.");
+
+        if (comment != nullptr)
+          ccomment = PyString_AsString(comment);
+
+        try {
+          return PySymbolicVariable(triton::getCurrentApi().newSymbolicVariable(PyLong_AsUint32(size), ccomment));
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* triton_parseSmt(PyObject* self, PyObject* script) {
+        std::vector<triton::ast::AbstractNode*> asts;
+        PyObject* ret = nullptr;
+
+        /* Check if the architecture is definied */
+        if (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "parseSmt(): Architecture is not defined.");
+
+        if (!PyString_Check(script))
+          return PyErr_Format(PyExc_TypeError, "parseSmt(): Expects a string as argument.");
+
+        try {
+          std::istringstream stream(std::string(PyString_AsString(script), PyString_Size(script)));
+          asts = triton::getCurrentApi().parseSmt(stream);
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        ret = xPyList_New(asts.size());
+        for (triton::usize index = 0; index < asts.size(); index++)
+          PyList_SetItem(ret, index, PyAstNode(asts[index]));
+
+        return ret;
+      }
+
+
+      static PyObject* triton_pinSymbolicExpression(PyObject* self, PyObject* symExprId) {
+        if (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "pinSymbolicExpression(): Architecture is not defined.");
+
+        if (!PyInt_Check(symExprId) && !PyLong_Check(symExprId))
+          return PyErr_Format(PyExc_TypeError, "pinSymbolicExpression(): Expects an integer as argument.");
+
+        try {
+          triton::getCurrentApi().pinSymbolicExpression(PyLong_AsUsize(symExprId));
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
+      static PyObject* triton_predecode(PyObject* self, PyObject* args) {
+        PyObject* binary  = nullptr;
+        PyObject* threads = nullptr;
+        triton::usize ret = 0;
+
+        /* Extract arguments */
+        PyArg_ParseTuple(args, "|OO", &binary, &threads);
+
+        /* Check if the architecture is definied */
+        if (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "predecode(): Architecture is not defined.");
+
+        if (binary == nullptr || (!PyElf_Check(binary) && !PyPe_Check(binary)))
+          return PyErr_Format(PyExc_TypeError, "predecode(): Expects an Elf or a Pe as first argument.");
+
+        if (threads != nullptr && !PyLong_Check(threads) && !PyInt_Check(threads))
+          return PyErr_Format(PyExc_TypeError, "predecode(): Expects an integer as second argument.");
+
+        try {
+          triton::uint32 count = (threads != nullptr ? PyLong_AsUint32(threads) : 0);
+          const triton::format::BinaryInterface* format = nullptr;
+          if (PyElf_Check(binary))
+            format = PyElf_AsElf(binary);
+          else
+            format = PyPe_AsPe(binary);
+
+          /* The binary is only read by the decoders */
+          GilRelease release;
+          ret = triton::getCurrentApi().predecode(*format, count);
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        return PyLong_FromUsize(ret);
+      }
+
+
+      static PyObject* triton_processBlock(PyObject* self, PyObject* args) {
+        PyObject* addr    = nullptr;
+        PyObject* opcodes = nullptr;
+        PyObject* count   = nullptr;
+
+        /* Extract arguments */
+        PyArg_ParseTuple(args, "|OOO", &addr, &opcodes, &count);
+
+        /* Check if the architecture is definied */
+        if (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "processBlock(): Architecture is not defined.");
+
+        if (addr == nullptr || (!PyLong_Check(addr) && !PyInt_Check(addr)))
+          return PyErr_Format(PyExc_TypeError, "processBlock(): Expects an integer as first argument.");
+
+        if (opcodes == nullptr || !PyBytes_Check(opcodes))
+          return PyErr_Format(PyExc_TypeError, "processBlock(): Expects bytes as second argument.");
+
+        if (count != nullptr && (!PyLong_Check(count) && !PyInt_Check(count)))
+          return PyErr_Format(PyExc_TypeError, "processBlock(): Expects an integer as third argument.");
+
+        try {
+          triton::uint8* area = reinterpret_cast<triton::uint8*>(PyBytes_AsString(opcodes));
+          triton::usize  size = static_cast<triton::usize>(PyBytes_Size(opcodes));
+          return PyLong_FromUsize(triton::getCurrentApi().processBlock(PyLong_AsUint64(addr), area, size, count != nullptr ? PyLong_AsUsize(count) : 0));
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* triton_processing(PyObject* self, PyObject* inst) {
+        /* Check if the architecture is definied */
+        if (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "processing(): Architecture is not defined.");
+
+        if (!PyInstruction_Check(inst))
+          return PyErr_Format(PyExc_TypeError, "processing(): Expects an Instruction as argument.");
+
+        try {
+          triton::arch::Instruction* instruction = PyInstruction_AsInstruction(inst);
+          bool ret = false;
+          {
+            GilRelease release;
+            ret = triton::getCurrentApi().processing(*instruction);
+          }
+          if (ret)
+            Py_RETURN_TRUE;
+          Py_RETURN_FALSE;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* triton_removeAllCallbacks(PyObject* self, PyObject* noarg) {
+        try {
+          triton::getCurrentApi().removeAllCallbacks();
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
+      static PyObject* triton_removeCallback(PyObject* self, PyObject* args) {
+        PyObject* function = nullptr;
+        PyObject* mode     = nullptr;
+
+        /* Extract arguments */
+        PyArg_ParseTuple(args, "|OO", &function, &mode);
+
+        /* Check if the architecture is definied */
+        if (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "removeCallback(): Architecture is not defined.");
+
+        if (function == nullptr || !PyCallable_Check(function))
+          return PyErr_Format(PyExc_TypeError, "removeCallback(): Expects a function as first argument.");
+
+        if (mode == nullptr || (!PyLong_Check(mode) && !PyInt_Check(mode)))
+          return PyErr_Format(PyExc_TypeError, "removeCallback(): Expects a CALLBACK as second argument.");
+
+        try {
+          triton::getCurrentApi().removeCallback(function, static_cast<triton::callbacks::callback_e>(PyLong_AsUint32(mode)));
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
+      static PyObject* triton_removeFunctionSummary(PyObject* self, PyObject* addr) {
+        /* Check if the architecture is definied */
+        if (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "removeFunctionSummary(): Architecture is not defined.");
+
+        if (!PyLong_Check(addr) && !PyInt_Check(addr))
+          return PyErr_Format(PyExc_TypeError, "removeFunctionSummary(): Expects an integer as argument.");
+
+        try {
+          triton::getCurrentApi().removeFunctionSummary(PyLong_AsUint64(addr));
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
+      static PyObject* triton_removeSymbolicRegion(PyObject* self, PyObject* args) {
+        PyObject* start = nullptr;
+        PyObject* end   = nullptr;
+
+        /* Extract arguments */
+        PyArg_ParseTuple(args, "|OO", &start, &end);
+
+        /* Check if the architecture is definied */
+        if (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "removeSymbolicRegion(): Architecture is not defined.");
+
+        if (start == nullptr || (!PyLong_Check(start) && !PyInt_Check(start)))
+          return PyErr_Format(PyExc_TypeError, "removeSymbolicRegion(): Expects an integer as first argument.");
+
+        if (end == nullptr || (!PyLong_Check(end) && !PyInt_Check(end)))
+          return PyErr_Format(PyExc_TypeError, "removeSymbolicRegion(): Expects an integer as second argument.");
+
+        try {
+          triton::getCurrentApi().removeSymbolicRegion(PyLong_AsUint64(start), PyLong_AsUint64(end));
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
+      static PyObject* triton_removeSnapshot(PyObject* self, PyObject* id) {
+        /* Check if the architecture is definied */
+        if (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "removeSnapshot(): Architecture is not defined.");
+
+        if (!PyLong_Check(id) && !PyInt_Check(id))
+          return PyErr_Format(PyExc_TypeError, "removeSnapshot(): Expects an integer as argument.");
+
+        try {
+          triton::getCurrentApi().removeSnapshot(PyLong_AsUsize(id));
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
+      static PyObject* triton_replayTrace(PyObject* self, PyObject* args) {
+        PyObject* path     = nullptr;
+        PyObject* maxInsns = nullptr;
+        PyObject* start    = nullptr;
+
+        /* Extract arguments */
+        PyArg_ParseTuple(args, "|OOO", &path, &maxInsns, &start);
+
+        /* Check if the architecture is definied */
+        if (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "replayTrace(): Architecture is not defined.");
+
+        if (path == nullptr || !PyString_Check(path))
+          return PyErr_Format(PyExc_TypeError, "replayTrace(): Expects a string as first argument.");
+
+        if (maxInsns != nullptr && (!PyLong_Check(maxInsns) && !PyInt_Check(maxInsns)))
+          return PyErr_Format(PyExc_TypeError, "replayTrace(): Expects an integer as second argument.");
+
+        if (start != nullptr && (!PyLong_Check(start) && !PyInt_Check(start)))
+          return PyErr_Format(PyExc_TypeError, "replayTrace(): Expects an integer as third argument.");
+
+        try {
+          return PyLong_FromUsize(triton::getCurrentApi().replayTrace(PyString_AsString(path), maxInsns != nullptr ? PyLong_AsUsize(maxInsns) : 0, start != nullptr ? PyLong_AsUint64(start) : 0));
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* triton_resetEngines(PyObject* self, PyObject* noarg) {
+        /* Check if the architecture is definied */
+        if (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "resetEngines(): Architecture is not defined.");
+
+        try {
+          triton::getCurrentApi().resetEngines();
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
+      static PyObject* triton_restore(PyObject* self, PyObject* id) {
+        /* Check if the architecture is definied */
+        if (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "restore(): Architecture is not defined.");
+
+        if (!PyLong_Check(id) && !PyInt_Check(id))
+          return PyErr_Format(PyExc_TypeError, "restore(): Expects an integer as argument.");
+
+        try {
+          triton::getCurrentApi().restore(PyLong_AsUsize(id));
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
+      static PyObject* triton_rewindTo(PyObject* self, PyObject* id) {
+        /* Check if the architecture is definied */
+        if (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "rewindTo(): Architecture is not defined.");
+
+        if (!PyLong_Check(id) && !PyInt_Check(id))
+          return PyErr_Format(PyExc_TypeError, "rewindTo(): Expects an integer as argument.");
+
+        try {
+          triton::getCurrentApi().rewindTo(PyLong_AsUsize(id));
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
+      static PyObject* triton_run(PyObject* self, PyObject* args) {
+        std::map<triton::uint64, triton::callbacks::addressHookCallback> addressHooks;
+        PyObject* entry    = nullptr;
+        PyObject* hooks    = nullptr;
+        PyObject* maxInsns = nullptr;
+        PyObject* key      = nullptr;
+        PyObject* value    = nullptr;
+        Py_ssize_t pos     = 0;
+
+        /* Extract arguments */
+        PyArg_ParseTuple(args, "|OOO", &entry, &hooks, &maxInsns);
+
+        /* Check if the architecture is definied */
+        if (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "run(): Architecture is not defined.");
+
+        if (entry == nullptr || (!PyLong_Check(entry) && !PyInt_Check(entry)))
+          return PyErr_Format(PyExc_TypeError, "run(): Expects an integer as first argument.");
+
+        if (hooks != nullptr && !PyDict_Check(hooks))
+          return PyErr_Format(PyExc_TypeError, "run(): Expects a dict as second argument.");
+
+        if (maxInsns != nullptr && (!PyLong_Check(maxInsns) && !PyInt_Check(maxInsns)))
+          return PyErr_Format(PyExc_TypeError, "run(): Expects an integer as third argument.");
+
+        while (hooks != nullptr && PyDict_Next(hooks, &pos, &key, &value)) {
+          if (!PyLong_Check(key) && !PyInt_Check(key))
+            return PyErr_Format(PyExc_TypeError, "run(): Expects addresses as keys.");
+
+          if (!PyCallable_Check(value))
+            return PyErr_Format(PyExc_TypeError, "run(): Expects functions as values.");
+
+          /* The dict keeps the functions alive during the emulation */
+          addressHooks[PyLong_AsUint64(key)] = [value](triton::uint64 address) {
+            PyObject* hookArgs = xPyTuple_New(1);
+            PyTuple_SetItem(hookArgs, 0, PyLong_FromUint64(address));
+
+            PyObject* ret = PyObject_CallObject(value, hookArgs);
+            Py_DECREF(hookArgs);
+
+            if (ret == nullptr) {
+              PyErr_Print();
+              throw triton::exceptions::Callbacks("run(): Fail to call the python hook.");
+            }
+
+            bool goOn = (ret != Py_False);
+            Py_DECREF(ret);
+            return goOn;
+          };
+        }
+
+        try {
+          return PyLong_FromUsize(triton::getCurrentApi().run(PyLong_AsUint64(entry), addressHooks, maxInsns != nullptr ? PyLong_AsUsize(maxInsns) : 0));
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* triton_saveCheckpoint(PyObject* self, PyObject* path) {
+        /* Check if the architecture is definied */
+        if (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "saveCheckpoint(): Architecture is not defined.");
+
+        if (!PyString_Check(path))
+          return PyErr_Format(PyExc_TypeError, "saveCheckpoint(): Expects a string as argument.");
+
+        try {
+          triton::getCurrentApi().saveCheckpoint(PyString_AsString(path));
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
+      static PyObject* triton_saveDecodeCache(PyObject* self, PyObject* args) {
+        PyObject* directory = nullptr;
+        PyObject* binary    = nullptr;
+        triton::usize ret   = 0;
+
+        /* Extract arguments */
+        PyArg_ParseTuple(args, "|OO", &directory, &binary);
+
+        /* Check if the architecture is definied */
+        if (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "saveDecodeCache(): Architecture is not defined.");
+
+        if (directory == nullptr || !PyString_Check(directory))
+          return PyErr_Format(PyExc_TypeError, "saveDecodeCache(): Expects a string as first argument.");
+
+        if (binary == nullptr || (!PyElf_Check(binary) && !PyPe_Check(binary)))
+          return PyErr_Format(PyExc_TypeError, "saveDecodeCache(): Expects an Elf or a Pe as second argument.");
+
+        try {
+          if (PyElf_Check(binary))
+            ret = triton::getCurrentApi().saveDecodeCache(PyString_AsString(directory), *PyElf_AsElf(binary));
+          else
+            ret = triton::getCurrentApi().saveDecodeCache(PyString_AsString(directory), *PyPe_AsPe(binary));
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        return PyLong_FromUsize(ret);
+      }
+
+
+      static PyObject* triton_serializeAsts(PyObject* self, PyObject* nodes) {
+        std::vector<triton::ast::AbstractNode*> asts;
+        std::ostringstream stream;
+
+        /* Check if the architecture is definied */
+        if (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "serializeAsts(): Architecture is not defined.");
+
+        if (!PyList_Check(nodes))
+          return PyErr_Format(PyExc_TypeError, "serializeAsts(): Expects a list of AstNode as argument.");
+
+        for (Py_ssize_t i = 0; i < PyList_Size(nodes); i++) {
+          PyObject* item = PyList_GetItem(nodes, i);
+          if (!PyAstNode_Check(item))
+            return PyErr_Format(PyExc_TypeError, "serializeAsts(): Each element of the list must be a AstNode.");
+          asts.push_back(PyAstNode_AsAstNode(item));
+        }
+
+        try {
+          triton::getCurrentApi().serializeAsts(stream, asts);
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        std::string data = stream.str();
+        return PyBytes_FromStringAndSize(data.data(), data.size());
+      }
+
+
+      static PyObject* triton_serializeSymbolicState(PyObject* self, PyObject* noarg) {
+        std::ostringstream stream;
+
+        /* Check if the architecture is definied */
+        if (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "serializeSymbolicState(): Architecture is not defined.");
+
+        try {
+          triton::getCurrentApi().serializeSymbolicState(stream);
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        std::string data = stream.str();
+        return PyBytes_FromStringAndSize(data.data(), data.size());
+      }
+
+
+      static PyObject* triton_setArchitecture(PyObject* self, PyObject* args) {
+        PyObject* arch    = nullptr;
+        PyObject* profile = nullptr;
+
+        /* Extract arguments */
+        PyArg_ParseTuple(args, "|OO", &arch, &profile);
+
+        if (arch == nullptr || (!PyLong_Check(arch) && !PyInt_Check(arch)))
+          return PyErr_Format(PyExc_TypeError, "setArchitecture(): Expects an ARCH as first argument.");
+
+        if (profile != nullptr && !PyLong_Check(profile) && !PyInt_Check(profile))
+          return PyErr_Format(PyExc_TypeError, "setArchitecture(): Expects a PROFILE as second argument.");
+
+        try {
+          triton::getCurrentApi().setArchitecture(PyLong_AsUint32(arch), profile != nullptr ? PyLong_AsUint32(profile) : static_cast<triton::uint32>(triton::profiles::FULL));
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
+      static PyObject* triton_setAstRepresentationMode(PyObject* self, PyObject* arg) {
+        if (!PyLong_Check(arg) && !PyInt_Check(arg))
+          return PyErr_Format(PyExc_TypeError, "setArcsetAstRepresentationMode(): Expects an AST_REPRESENTATION as argument.");
+
+        try {
+          triton::getCurrentApi().setAstRepresentationMode(PyLong_AsUint32(arg));
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
+      static PyObject* triton_setConcreteMemoryAreaValue(PyObject* self, PyObject* args) {
+        std::vector<triton::uint8> vv;
+        PyObject* baseAddr  = nullptr;
+        PyObject* values    = nullptr;
+
+        /* Extract arguments */
+        PyArg_ParseTuple(args, "|OO", &baseAddr, &values);
+
+        /* Check if the architecture is definied */
+        if (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "setConcreteMemoryAreaValue(): Architecture is not defined.");
+
+        if (baseAddr == nullptr || (!PyLong_Check(baseAddr) && !PyInt_Check(baseAddr)))
+          return PyErr_Format(PyExc_TypeError, "setConcreteMemoryAreaValue(): Expects an integer as first argument.");
+
+        if (values == nullptr)
+          return PyErr_Format(PyExc_TypeError, "setConcreteMemoryAreaValue(): Expects a list or a buffer as second argument.");
+
+        // Python object: List
+        if (PyList_Check(values)) {
+          for (Py_ssize_t i = 0; i < PyList_Size(values); i++) {
+            PyObject* item = PyList_GetItem(values, i);
+
+            if ((!PyLong_Check(item) && !PyInt_Check(item)) || PyLong_AsUint32(item) > 0xff)
+              return PyErr_Format(PyExc_TypeError, "setConcreteMemoryAreaValue(): Each item of the list must be a 8-bits integer.");
+
+            vv.push_back(static_cast<triton::uint8>(PyLong_AsUint32(item) & 0xff));
+          }
+
+          try {
+            triton::getCurrentApi().setConcreteMemoryAreaValue(PyLong_AsUint64(baseAddr), vv);
+          }
+          catch (const triton::exceptions::Exception& e) {
+            return PyErr_Format(PyExc_TypeError, "%s", e.what());
+          }
+        }
+
+        // Python object: Buffer (bytes, bytearray, memoryview, numpy arrays, ...)
+        else if (PyObject_CheckBuffer(values)) {
+          Py_buffer view;
+
+          if (PyObject_GetBuffer(values, &view, PyBUF_SIMPLE) != 0)
+            return nullptr;
+
+          try {
+            triton::getCurrentApi().setConcreteMemoryAreaValue(PyLong_AsUint64(baseAddr), reinterpret_cast<const triton::uint8*>(view.buf), static_cast<triton::usize>(view.len));
+          }
+          catch (const triton::exceptions::Exception& e) {
+            PyBuffer_Release(&view);
+            return PyErr_Format(PyExc_TypeError, "%s", e.what());
+          }
+
+          PyBuffer_Release(&view);
+        }
+
+        // Python object: Read buffer (mmap, buffer, ...)
+        else if (PyObject_CheckReadBuffer(values)) {
+          const void* area = nullptr;
+          Py_ssize_t  size = 0;
+
+          if (PyObject_AsReadBuffer(values, &area, &size) != 0)
+            return nullptr;
+
+          try {
+            triton::getCurrentApi().setConcreteMemoryAreaValue(PyLong_AsUint64(baseAddr), reinterpret_cast<const triton::uint8*>(area), static_cast<triton::usize>(size));
+          }
+          catch (const triton::exceptions::Exception& e) {
+            return PyErr_Format(PyExc_TypeError, "%s", e.what());
+          }
+        }
+
+        // Invalid Python object
+        else
+          return PyErr_Format(PyExc_TypeError, "setConcreteMemoryAreaValue(): Expects a list or a buffer as second argument.");
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
+      static PyObject* triton_setConcreteMemoryValue(PyObject* self, PyObject* args) {
+        PyObject* mem    = nullptr;
+        PyObject* value  = nullptr;
+
+        /* Extract arguments */
+        PyArgs_Unpack(args, &mem, &value);
+
+        /* Check if the architecture is definied */
+        if (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "setConcreteMemoryValue(): Architecture is not defined.");
+
+        /* setConcreteMemoryValue(integer, integer) */
+        if (mem != nullptr && (PyLong_Check(mem) || PyInt_Check(mem))) {
+          if (value == nullptr || (!PyLong_Check(value) && !PyInt_Check(value)))
+            return PyErr_Format(PyExc_TypeError, "setConcreteMemoryValue(): Expects a value as second argument.");
+
+          triton::uint64 addr   = PyLong_AsUint64(mem);
+          triton::uint32 cvalue = PyLong_AsUint32(value);
+
+          if (cvalue > 0xff)
+            return PyErr_Format(PyExc_TypeError, "setConcreteMemoryValue(): Value must be on 8 bits.");
+
+          try {
+            triton::getCurrentApi().setConcreteMemoryValue(addr, static_cast<triton::uint8>(cvalue & 0xff));
+          }
+          catch (const triton::exceptions::Exception& e) {
+            return PyErr_Format(PyExc_TypeError, "%s", e.what());
+          }
+
+        }
+
+        /* setConcreteMemoryValue(MemoryAccess) */
+        else if (mem != nullptr && PyMemoryAccess_Check(mem)) {
+          if (value != nullptr)
+            return PyErr_Format(PyExc_TypeError, "setConcreteMemoryValue(): Expects no second argument.");
+          try {
+            triton::getCurrentApi().setConcreteMemoryValue(*PyMemoryAccess_AsMemoryAccess(mem));
+          }
+          catch (const triton::exceptions::Exception& e) {
+            return PyErr_Format(PyExc_TypeError, "%s", e.what());
+          }
+        }
+
+        /* Invalid */
+        else
+          return PyErr_Format(PyExc_TypeError, "setConcreteMemoryValue(): Expects a MemoryAccess or an integer as first argument.");
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
+      static PyObject* triton_setConcreteRegisterContext(PyObject* self, PyObject* dict) {
+        PyObject* key   = nullptr;
+        PyObject* value = nullptr;
+        Py_ssize_t pos  = 0;
+
+        /* Check if the architecture is definied */
+        if (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "setConcreteRegisterContext(): Architecture is not defined.");
+
+        if (dict == nullptr || !PyDict_Check(dict))
+          return PyErr_Format(PyExc_TypeError, "setConcreteRegisterContext(): Expects a dict as argument.");
+
+        try {
+          /* The registers which are not in the dict keep their value */
+          triton::arch::x86::RegisterContext context = triton::getCurrentApi().getConcreteRegisterContext();
+          triton::uint32 count             = 0;
+          const triton::uint32* gprs       = PyRegisterContext_Gprs(count);
+          const triton::uint32* segments   = PyRegisterContext_Segments();
+          triton::uint32 pc                = (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_X86_64) ? triton::arch::x86::ID_REG_RIP : triton::arch::x86::ID_REG_EIP;
+
+          while (PyDict_Next(dict, &pos, &key, &value)) {
+            if (!PyRegister_Check(key) || (!PyLong_Check(value) && !PyInt_Check(value)))
+              return PyErr_Format(PyExc_TypeError, "setConcreteRegisterContext(): Expects a dict of {REG : integer}.");
+
+            triton::uint32 id = PyRegister_AsRegister(key)->getId();
+            triton::uint64* field = nullptr;
+
+            if (id == pc)
+              field = &context.pc;
+            else if (id == triton::arch::x86::ID_REG_EFLAGS)
+              field = &context.flags;
+
+            for (triton::uint32 index = 0; field == nullptr && index < count; index++) {
+              if (gprs[index] == id)
+                field = &context.gprs[index];
+            }
+
+            for (triton::uint32 index = 0; field == nullptr && index < 6; index++) {
+              if (segments[index] == id)
+                field = &context.segments[index];
+            }
+
+            if (field != nullptr) {
+              *field = PyLong_AsUint64(value);
+              continue;
+            }
+
+            if (id < triton::arch::x86::ID_REG_XMM0 || id >= triton::arch::x86::ID_REG_XMM0 + count)
+              return PyErr_Format(PyExc_TypeError, "setConcreteRegisterContext(): Invalid register (%s).", PyRegister_AsRegister(key)->getName().c_str());
+
+            triton::uint128 xmm = PyLong_AsUint128(value);
+            for (triton::uint32 byte = 0; byte < DQWORD_SIZE; byte++) {
+              context.xmms[id - triton::arch::x86::ID_REG_XMM0][byte] = static_cast<triton::uint8>(xmm & 0xff);
+              xmm >>= 8;
+            }
           }
+
+          triton::getCurrentApi().setConcreteRegisterContext(context);
         }
         catch (const triton::exceptions::Exception& e) {
           return PyErr_Format(PyExc_TypeError, "%s", e.what());
         }
 
-        return ret;
+        Py_INCREF(Py_None);
+        return Py_None;
       }
 
 
-      static PyObject* triton_getTaintedSymbolicExpressions(PyObject* self, PyObject* noarg) {
-        PyObject* ret = nullptr;
-        triton::usize size = 0, index = 0;
-
+      static PyObject* triton_setConcreteRegisterValue(PyObject* self, PyObject* reg) {
         /* Check if the architecture is definied */
-        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
-          return PyErr_Format(PyExc_TypeError, "getTaintedSymbolicExpressions(): Architecture is not defined.");
+        if (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "setConcreteRegisterValue(): Architecture is not defined.");
 
-        try {
-          auto expressions = triton::api.getTaintedSymbolicExpressions();
+        if (!PyRegister_Check(reg))
+          return PyErr_Format(PyExc_TypeError, "setConcreteRegisterValue(): Expects a REG as first argument.");
 
-          size = expressions.size();
-          ret = xPyList_New(size);
-          for (auto it = expressions.begin(); it != expressions.end(); it++) {
-            PyList_SetItem(ret, index, PySymbolicExpression(*it));
-            index++;
-          }
+        try {
+          triton::getCurrentApi().setConcreteRegisterValue(*PyRegister_AsRegister(reg));
         }
         catch (const triton::exceptions::Exception& e) {
           return PyErr_Format(PyExc_TypeError, "%s", e.what());
         }
 
-        return ret;
-      }
-
-
-      static PyObject* triton_isArchitectureValid(PyObject* self, PyObject* noarg) {
-        if (triton::api.isArchitectureValid() == true)
-          Py_RETURN_TRUE;
-        Py_RETURN_FALSE;
+        Py_INCREF(Py_None);
+        return Py_None;
       }
 
 
-      static PyObject* triton_isMemoryMapped(PyObject* self, PyObject* args) {
-        PyObject* baseAddr        = nullptr;
-        PyObject* size            = nullptr;
-        triton::uint64 c_baseAddr = 0;
-        triton::usize c_size      = 1;
+      static PyObject* triton_setDefaultPointerPolicy(PyObject* self, PyObject* args) {
+        PyObject* policy = nullptr;
+        PyObject* range  = nullptr;
 
         /* Extract arguments */
-        PyArg_ParseTuple(args, "|OO", &baseAddr, &size);
+        PyArg_ParseTuple(args, "|OO", &policy, &range);
 
         /* Check if the architecture is definied */
-        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
-          return PyErr_Format(PyExc_TypeError, "isMemoryMapped(): Architecture is not defined.");
+        if (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "setDefaultPointerPolicy(): Architecture is not defined.");
 
-        if (baseAddr == nullptr || (!PyLong_Check(baseAddr) && !PyInt_Check(baseAddr)))
-          return PyErr_Format(PyExc_TypeError, "isMemoryMapped(): Expects a base address (integer) as first argument.");
+        if (policy == nullptr || (!PyLong_Check(policy) && !PyInt_Check(policy)))
+          return PyErr_Format(PyExc_TypeError, "setDefaultPointerPolicy(): Expects a SYMEXPR policy as first argument.");
 
-        if (size != nullptr && !PyLong_Check(size) && !PyInt_Check(size))
-          return PyErr_Format(PyExc_TypeError, "isMemoryMapped(): Expects a size (integer) as second argument.");
+        if (range != nullptr && !PyLong_Check(range) && !PyInt_Check(range))
+          return PyErr_Format(PyExc_TypeError, "setDefaultPointerPolicy(): Expects a range (integer) as second argument.");
 
         try {
-          c_baseAddr = PyLong_AsUint64(baseAddr);
-          if (size != nullptr)
-            c_size = PyLong_AsUsize(size);
-          if (triton::api.isMemoryMapped(c_baseAddr, c_size) == true)
-            Py_RETURN_TRUE;
-          Py_RETURN_FALSE;
+          triton::getCurrentApi().setDefaultPointerPolicy(static_cast<triton::engines::symbolic::pointer_policy_e>(PyLong_AsUint32(policy)),
+                                              (range != nullptr ? PyLong_AsUint32(range) : triton::engines::symbolic::SymbolicEngine::defaultPointerRange));
         }
         catch (const triton::exceptions::Exception& e) {
           return PyErr_Format(PyExc_TypeError, "%s", e.what());
         }
-      }
 
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
 
-      static PyObject* triton_isMemorySymbolized(PyObject* self, PyObject* mem) {
-        /* Check if the architecture is definied */
-        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
-          return PyErr_Format(PyExc_TypeError, "isMemorySymbolized(): Architecture is not defined.");
-
-        if (PyMemoryAccess_Check(mem)) {
-          if (triton::api.isMemorySymbolized(*PyMemoryAccess_AsMemoryAccess(mem)) == true)
-            Py_RETURN_TRUE;
-        }
 
-        else if (PyLong_Check(mem) || PyInt_Check(mem)) {
-          if (triton::api.isMemorySymbolized(PyLong_AsUint64(mem)) == true)
-            Py_RETURN_TRUE;
-        }
+      static PyObject* triton_setExpressionLimits(PyObject* self, PyObject* args) {
+        PyObject* depth = nullptr;
+        PyObject* size  = nullptr;
 
-        else
-          return PyErr_Format(PyExc_TypeError, "isMemorySymbolized(): Expects a MemoryAccess or an integer as argument.");
+        /* Extract arguments */
+        PyArg_ParseTuple(args, "|OO", &depth, &size);
 
-        Py_RETURN_FALSE;
-      }
+        /* Check if the architecture is definied */
+        if (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "setExpressionLimits(): Architecture is not defined.");
 
+        if (depth == nullptr || (!PyLong_Check(depth) && !PyInt_Check(depth)))
+          return PyErr_Format(PyExc_TypeError, "setExpressionLimits(): Expects a depth (integer) as first argument.");
 
-      static PyObject* triton_isMemoryTainted(PyObject* self, PyObject* mem) {
-        /* Check if the architecture is definied */
-        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
-          return PyErr_Format(PyExc_TypeError, "isMemoryTainted(): Architecture is not defined.");
+        if (size == nullptr || (!PyLong_Check(size) && !PyInt_Check(size)))
+          return PyErr_Format(PyExc_TypeError, "setExpressionLimits(): Expects a size (integer) as second argument.");
 
-        if (PyMemoryAccess_Check(mem)) {
-          if (triton::api.isMemoryTainted(*PyMemoryAccess_AsMemoryAccess(mem)) == true)
-            Py_RETURN_TRUE;
+        try {
+          triton::getCurrentApi().setExpressionLimits(PyLong_AsUint32(depth), PyLong_AsUint64(size));
         }
-
-        else if (PyLong_Check(mem) || PyInt_Check(mem)) {
-          if (triton::api.isMemoryTainted(PyLong_AsUint64(mem)) == true)
-            Py_RETURN_TRUE;
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
         }
 
-        else
-          return PyErr_Format(PyExc_TypeError, "isMemoryTainted(): Expects a MemoryAccess or an integer as argument.");
-
-        Py_RETURN_FALSE;
-      }
-
-
-      static PyObject* triton_isRegisterSymbolized(PyObject* self, PyObject* reg) {
-        /* Check if the architecture is definied */
-        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
-          return PyErr_Format(PyExc_TypeError, "isRegisterSymbolized(): Architecture is not defined.");
-
-        if (!PyRegister_Check(reg))
-          return PyErr_Format(PyExc_TypeError, "isRegisterSymbolized(): Expects a REG as argument.");
-
-        if (triton::api.isRegisterSymbolized(*PyRegister_AsRegister(reg)) == true)
-          Py_RETURN_TRUE;
-        Py_RETURN_FALSE;
+        Py_INCREF(Py_None);
+        return Py_None;
       }
 
 
-      static PyObject* triton_isRegisterTainted(PyObject* self, PyObject* reg) {
+      static PyObject* triton_setInlineReferenceSize(PyObject* self, PyObject* value) {
         /* Check if the architecture is definied */
-        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
-          return PyErr_Format(PyExc_TypeError, "isRegisterTainted(): Architecture is not defined.");
-
-        if (!PyRegister_Check(reg))
-          return PyErr_Format(PyExc_TypeError, "isRegisterTainted(): Expects a REG as argument.");
-
-        if (triton::api.isRegisterTainted(*PyRegister_AsRegister(reg)) == true)
-          Py_RETURN_TRUE;
-        Py_RETURN_FALSE;
-      }
-
-
-      static PyObject* triton_isSymbolicEngineEnabled(PyObject* self, PyObject* noarg) {
-        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
-          return PyErr_Format(PyExc_TypeError, "isSymbolicEngineEnabled(): Architecture is not defined.");
-
-        if (triton::api.isSymbolicEngineEnabled() == true)
-          Py_RETURN_TRUE;
-        Py_RETURN_FALSE;
-      }
-
+        if (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "setInlineReferenceSize(): Architecture is not defined.");
 
-      static PyObject* triton_isSymbolicExpressionIdExists(PyObject* self, PyObject* symExprId) {
-        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
-          return PyErr_Format(PyExc_TypeError, "isSymbolicExpressionIdExists(): Architecture is not defined.");
+        if (!PyLong_Check(value) && !PyInt_Check(value))
+          return PyErr_Format(PyExc_TypeError, "setInlineReferenceSize(): Expects an integer as argument.");
 
-        if (!PyInt_Check(symExprId) && !PyLong_Check(symExprId))
-          return PyErr_Format(PyExc_TypeError, "isSymbolicExpressionIdExists(): Expects an integer as argument.");
+        try {
+          triton::getCurrentApi().setInlineReferenceSize(PyLong_AsUsize(value));
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
 
-        if (triton::api.isSymbolicExpressionIdExists(PyLong_AsUsize(symExprId)) == true)
-          Py_RETURN_TRUE;
-        Py_RETURN_FALSE;
+        Py_INCREF(Py_None);
+        return Py_None;
       }
 
 
-      static PyObject* triton_isModeEnabled(PyObject* self, PyObject* mode) {
-        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
-          return PyErr_Format(PyExc_TypeError, "isModeEnabled(): Architecture is not defined.");
-
-        if (!PyInt_Check(mode) && !PyLong_Check(mode))
-          return PyErr_Format(PyExc_TypeError, "isModeEnabled(): Expects a MODE as argument.");
-
-        if (triton::api.isModeEnabled(static_cast<enum triton::modes::mode_e>(PyLong_AsUint32(mode))) == true)
-          Py_RETURN_TRUE;
-        Py_RETURN_FALSE;
-      }
+      static PyObject* triton_setInstructionWindow(PyObject* self, PyObject* value) {
+        /* Check if the architecture is definied */
+        if (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "setInstructionWindow(): Architecture is not defined.");
 
+        if (!PyLong_Check(value) && !PyInt_Check(value))
+          return PyErr_Format(PyExc_TypeError, "setInstructionWindow(): Expects an integer as argument.");
 
-      static PyObject* triton_isTaintEngineEnabled(PyObject* self, PyObject* noarg) {
-        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
-          return PyErr_Format(PyExc_TypeError, "isTaintEngineEnabled(): Architecture is not defined.");
+        try {
+          triton::getCurrentApi().setInstructionWindow(PyLong_AsUsize(value));
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
 
-        if (triton::api.isTaintEngineEnabled() == true)
-          Py_RETURN_TRUE;
-        Py_RETURN_FALSE;
+        Py_INCREF(Py_None);
+        return Py_None;
       }
 
 
-      static PyObject* triton_newSymbolicExpression(PyObject* self, PyObject* args) {
-        PyObject* node          = nullptr;
-        PyObject* comment       = nullptr;
-        std::string ccomment    = "";
-
-        /* Extract arguments */
-        PyArg_ParseTuple(args, "|OO", &node, &comment);
-
+      static PyObject* triton_setMaxPathConstraintsPerBranch(PyObject* self, PyObject* value) {
         /* Check if the architecture is definied */
-        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
-          return PyErr_Format(PyExc_TypeError, "newSymbolicExpression(): Architecture is not defined.");
-
-        if (node == nullptr || (!PyAstNode_Check(node)))
-          return PyErr_Format(PyExc_TypeError, "newSymbolicExpression(): Expects a AstNode as first argument.");
+        if (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "setMaxPathConstraintsPerBranch(): Architecture is not defined.");
 
-        if (comment != nullptr && !PyString_Check(comment))
-          return PyErr_Format(PyExc_TypeError, "newSymbolicExpression(): Expects a sting as second argument.");
-
-        if (comment != nullptr)
-          ccomment = PyString_AsString(comment);
+        if (!PyLong_Check(value) && !PyInt_Check(value))
+          return PyErr_Format(PyExc_TypeError, "setMaxPathConstraintsPerBranch(): Expects an integer as argument.");
 
         try {
-          return PySymbolicExpression(triton::api.newSymbolicExpression(PyAstNode_AsAstNode(node), ccomment));
+          triton::getCurrentApi().setMaxPathConstraintsPerBranch(PyLong_AsUsize(value));
         }
         catch (const triton::exceptions::Exception& e) {
           return PyErr_Format(PyExc_TypeError, "%s", e.what());
         }
+
+        Py_INCREF(Py_None);
+        return Py_None;
       }
 
 
-      static PyObject* triton_newSymbolicVariable(PyObject* self, PyObject* args) {
-        PyObject* size        = nullptr;
-        PyObject* comment     = nullptr;
-        std::string ccomment  = "";
+      static PyObject* triton_setMemoryLimits(PyObject* self, PyObject* args) {
+        PyObject* soft = nullptr;
+        PyObject* hard = nullptr;
 
         /* Extract arguments */
-        PyArg_ParseTuple(args, "|OO", &size, &comment);
+        PyArg_ParseTuple(args, "|OO", &soft, &hard);
 
         /* Check if the architecture is definied */
-        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
-          return PyErr_Format(PyExc_TypeError, "newSymbolicVariable(): Architecture is not defined.");
-
-        if (size == nullptr || (!PyLong_Check(size) && !PyInt_Check(size)))
-          return PyErr_Format(PyExc_TypeError, "newSymbolicVariable(): Expects an integer as first argument.");
+        if (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "setMemoryLimits(): Architecture is not defined.");
 
-        if (comment != nullptr && !PyString_Check(comment))
-          return PyErr_Format(PyExc_TypeError, "newSymbolicVariable(): Expects a sting as second  argument.");
+        if (soft == nullptr || (!PyLong_Check(soft) && !PyInt_Check(soft)))
+          return PyErr_Format(PyExc_TypeError, "setMemoryLimits(): Expects a soft limit (integer) as first argument.");
 
-        if (comment != nullptr)
-          ccomment = PyString_AsString(comment);
+        if (hard == nullptr || (!PyLong_Check(hard) && !PyInt_Check(hard)))
+          return PyErr_Format(PyExc_TypeError, "setMemoryLimits(): Expects a hard limit (integer) as second argument.");
 
         try {
-          return PySymbolicVariable(triton::api.newSymbolicVariable(PyLong_AsUint32(size), ccomment));
+          triton::getCurrentApi().setMemoryLimits(PyLong_AsUsize(soft), PyLong_AsUsize(hard));
         }
         catch (const triton::exceptions::Exception& e) {
           return PyErr_Format(PyExc_TypeError, "%s", e.what());
         }
+
+        Py_INCREF(Py_None);
+        return Py_None;
       }
 
 
-      static PyObject* triton_processing(PyObject* self, PyObject* inst) {
+      static PyObject* triton_setNodeBudget(PyObject* self, PyObject* value) {
         /* Check if the architecture is definied */
-        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
-          return PyErr_Format(PyExc_TypeError, "processing(): Architecture is not defined.");
-
-        if (!PyInstruction_Check(inst))
-          return PyErr_Format(PyExc_TypeError, "processing(): Expects an Instruction as argument.");
-
-        try {
-          if (triton::api.processing(*PyInstruction_AsInstruction(inst)))
-            Py_RETURN_TRUE;
-          Py_RETURN_FALSE;
-        }
-        catch (const triton::exceptions::Exception& e) {
-          return PyErr_Format(PyExc_TypeError, "%s", e.what());
-        }
-      }
+        if (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "setNodeBudget(): Architecture is not defined.");
 
+        if (!PyLong_Check(value) && !PyInt_Check(value))
+          return PyErr_Format(PyExc_TypeError, "setNodeBudget(): Expects an integer as argument.");
 
-      static PyObject* triton_removeAllCallbacks(PyObject* self, PyObject* noarg) {
         try {
-          triton::api.removeAllCallbacks();
+          triton::getCurrentApi().setNodeBudget(PyLong_AsUsize(value));
         }
         catch (const triton::exceptions::Exception& e) {
           return PyErr_Format(PyExc_TypeError, "%s", e.what());
@@ -2225,25 +5866,31 @@ namespace triton {
       }
 
 
-      static PyObject* triton_removeCallback(PyObject* self, PyObject* args) {
-        PyObject* function = nullptr;
-        PyObject* mode     = nullptr;
+      static PyObject* triton_setPointerPolicy(PyObject* self, PyObject* args) {
+        PyObject* addr   = nullptr;
+        PyObject* policy = nullptr;
+        PyObject* range  = nullptr;
 
         /* Extract arguments */
-        PyArg_ParseTuple(args, "|OO", &function, &mode);
+        PyArg_ParseTuple(args, "|OOO", &addr, &policy, &range);
 
         /* Check if the architecture is definied */
-        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
-          return PyErr_Format(PyExc_TypeError, "removeCallback(): Architecture is not defined.");
+        if (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "setPointerPolicy(): Architecture is not defined.");
 
-        if (function == nullptr || !PyCallable_Check(function))
-          return PyErr_Format(PyExc_TypeError, "removeCallback(): Expects a function as first argument.");
+        if (addr == nullptr || (!PyLong_Check(addr) && !PyInt_Check(addr)))
+          return PyErr_Format(PyExc_TypeError, "setPointerPolicy(): Expects an address (integer) as first argument.");
 
-        if (mode == nullptr || (!PyLong_Check(mode) && !PyInt_Check(mode)))
-          return PyErr_Format(PyExc_TypeError, "removeCallback(): Expects a CALLBACK as second argument.");
+        if (policy == nullptr || (!PyLong_Check(policy) && !PyInt_Check(policy)))
+          return PyErr_Format(PyExc_TypeError, "setPointerPolicy(): Expects a SYMEXPR policy as second argument.");
+
+        if (range != nullptr && !PyLong_Check(range) && !PyInt_Check(range))
+          return PyErr_Format(PyExc_TypeError, "setPointerPolicy(): Expects a range (integer) as third argument.");
 
         try {
-          triton::api.removeCallback(function, static_cast<triton::callbacks::callback_e>(PyLong_AsUint32(mode)));
+          triton::getCurrentApi().setPointerPolicy(PyLong_AsUint64(addr),
+                                       static_cast<triton::engines::symbolic::pointer_policy_e>(PyLong_AsUint32(policy)),
+                                       (range != nullptr ? PyLong_AsUint32(range) : triton::engines::symbolic::SymbolicEngine::defaultPointerRange));
         }
         catch (const triton::exceptions::Exception& e) {
           return PyErr_Format(PyExc_TypeError, "%s", e.what());
@@ -2254,13 +5901,16 @@ namespace triton {
       }
 
 
-      static PyObject* triton_resetEngines(PyObject* self, PyObject* noarg) {
+      static PyObject* triton_setRemoteSolver(PyObject* self, PyObject* address) {
         /* Check if the architecture is definied */
-        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
-          return PyErr_Format(PyExc_TypeError, "resetEngines(): Architecture is not defined.");
+        if (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "setRemoteSolver(): Architecture is not defined.");
+
+        if (!PyString_Check(address))
+          return PyErr_Format(PyExc_TypeError, "setRemoteSolver(): Expects a string as argument.");
 
         try {
-          triton::api.resetEngines();
+          triton::getCurrentApi().setRemoteSolver(PyString_AsString(address));
         }
         catch (const triton::exceptions::Exception& e) {
           return PyErr_Format(PyExc_TypeError, "%s", e.what());
@@ -2271,12 +5921,16 @@ namespace triton {
       }
 
 
-      static PyObject* triton_setArchitecture(PyObject* self, PyObject* arg) {
-        if (!PyLong_Check(arg) && !PyInt_Check(arg))
-          return PyErr_Format(PyExc_TypeError, "setArchitecture(): Expects an ARCH as argument.");
+      static PyObject* triton_setSolverBackend(PyObject* self, PyObject* value) {
+        /* Check if the architecture is definied */
+        if (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "setSolverBackend(): Architecture is not defined.");
+
+        if (!PyLong_Check(value) && !PyInt_Check(value))
+          return PyErr_Format(PyExc_TypeError, "setSolverBackend(): Expects a SOLVER backend as argument.");
 
         try {
-          triton::api.setArchitecture(PyLong_AsUint32(arg));
+          triton::getCurrentApi().setSolverBackend(static_cast<triton::engines::solver::solver_e>(PyLong_AsUint32(value)));
         }
         catch (const triton::exceptions::Exception& e) {
           return PyErr_Format(PyExc_TypeError, "%s", e.what());
@@ -2287,12 +5941,16 @@ namespace triton {
       }
 
 
-      static PyObject* triton_setAstRepresentationMode(PyObject* self, PyObject* arg) {
-        if (!PyLong_Check(arg) && !PyInt_Check(arg))
-          return PyErr_Format(PyExc_TypeError, "setArcsetAstRepresentationMode(): Expects an AST_REPRESENTATION as argument.");
+      static PyObject* triton_setSolverLocalSearchBudget(PyObject* self, PyObject* value) {
+        /* Check if the architecture is definied */
+        if (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "setSolverLocalSearchBudget(): Architecture is not defined.");
+
+        if (!PyLong_Check(value) && !PyInt_Check(value))
+          return PyErr_Format(PyExc_TypeError, "setSolverLocalSearchBudget(): Expects an integer as argument.");
 
         try {
-          triton::api.setAstRepresentationMode(PyLong_AsUint32(arg));
+          triton::getCurrentApi().setSolverLocalSearchBudget(PyLong_AsUint32(value));
         }
         catch (const triton::exceptions::Exception& e) {
           return PyErr_Format(PyExc_TypeError, "%s", e.what());
@@ -2303,140 +5961,96 @@ namespace triton {
       }
 
 
-      static PyObject* triton_setConcreteMemoryAreaValue(PyObject* self, PyObject* args) {
-        std::vector<triton::uint8> vv;
-        PyObject* baseAddr  = nullptr;
-        PyObject* values    = nullptr;
-
-        /* Extract arguments */
-        PyArg_ParseTuple(args, "|OO", &baseAddr, &values);
-
+      static PyObject* triton_setSolverMemoryLimit(PyObject* self, PyObject* value) {
         /* Check if the architecture is definied */
-        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
-          return PyErr_Format(PyExc_TypeError, "setConcreteMemoryAreaValue(): Architecture is not defined.");
-
-        if (baseAddr == nullptr || (!PyLong_Check(baseAddr) && !PyInt_Check(baseAddr)))
-          return PyErr_Format(PyExc_TypeError, "setConcreteMemoryAreaValue(): Expects an integer as first argument.");
+        if (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "setSolverMemoryLimit(): Architecture is not defined.");
 
-        if (values == nullptr)
-          return PyErr_Format(PyExc_TypeError, "setConcreteMemoryAreaValue(): Expects a list or a bytes array as second argument.");
+        if (!PyLong_Check(value) && !PyInt_Check(value))
+          return PyErr_Format(PyExc_TypeError, "setSolverMemoryLimit(): Expects an integer as argument.");
 
-        // Python object: List
-        if (PyList_Check(values)) {
-          for (Py_ssize_t i = 0; i < PyList_Size(values); i++) {
-            PyObject* item = PyList_GetItem(values, i);
+        try {
+          triton::getCurrentApi().setSolverMemoryLimit(PyLong_AsUint32(value));
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
 
-            if ((!PyLong_Check(item) && !PyInt_Check(item)) || PyLong_AsUint32(item) > 0xff)
-              return PyErr_Format(PyExc_TypeError, "setConcreteMemoryAreaValue(): Each item of the list must be a 8-bits integer.");
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
 
-            vv.push_back(static_cast<triton::uint8>(PyLong_AsUint32(item) & 0xff));
-          }
 
-          try {
-            triton::api.setConcreteMemoryAreaValue(PyLong_AsUint64(baseAddr), vv);
-          }
-          catch (const triton::exceptions::Exception& e) {
-            return PyErr_Format(PyExc_TypeError, "%s", e.what());
-          }
-        }
+      static PyObject* triton_setSolverPortfolioSize(PyObject* self, PyObject* value) {
+        /* Check if the architecture is definied */
+        if (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "setSolverPortfolioSize(): Architecture is not defined.");
 
-        // Python object: Bytes
-        else if (PyBytes_Check(values)) {
-          triton::uint8* area = reinterpret_cast<triton::uint8*>(PyBytes_AsString(values));
-          triton::usize  size = static_cast<triton::usize>(PyBytes_Size(values));
+        if (!PyLong_Check(value) && !PyInt_Check(value))
+          return PyErr_Format(PyExc_TypeError, "setSolverPortfolioSize(): Expects an integer as argument.");
 
-          try {
-            triton::api.setConcreteMemoryAreaValue(PyLong_AsUint64(baseAddr), area, size);
-          }
-          catch (const triton::exceptions::Exception& e) {
-            return PyErr_Format(PyExc_TypeError, "%s", e.what());
-          }
+        try {
+          triton::getCurrentApi().setSolverPortfolioSize(PyLong_AsUint32(value));
         }
-
-        // Python object: ByteArray
-        else if (PyByteArray_Check(values)) {
-          triton::uint8* area = reinterpret_cast<triton::uint8*>(PyByteArray_AsString(values));
-          triton::usize  size = static_cast<triton::usize>(PyByteArray_Size(values));
-
-          try {
-            triton::api.setConcreteMemoryAreaValue(PyLong_AsUint64(baseAddr), area, size);
-          }
-          catch (const triton::exceptions::Exception& e) {
-            return PyErr_Format(PyExc_TypeError, "%s", e.what());
-          }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
         }
 
-        // Invalid Python object
-        else
-          return PyErr_Format(PyExc_TypeError, "setConcreteMemoryAreaValue(): Expects a list or a bytes array as second argument.");
-
         Py_INCREF(Py_None);
         return Py_None;
       }
 
 
-      static PyObject* triton_setConcreteMemoryValue(PyObject* self, PyObject* args) {
-        PyObject* mem    = nullptr;
-        PyObject* value  = nullptr;
+      static PyObject* triton_setSolverResourceLimit(PyObject* self, PyObject* value) {
+        /* Check if the architecture is definied */
+        if (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "setSolverResourceLimit(): Architecture is not defined.");
 
-        /* Extract arguments */
-        PyArg_ParseTuple(args, "|OO", &mem, &value);
+        if (!PyLong_Check(value) && !PyInt_Check(value))
+          return PyErr_Format(PyExc_TypeError, "setSolverResourceLimit(): Expects an integer as argument.");
 
-        /* Check if the architecture is definied */
-        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
-          return PyErr_Format(PyExc_TypeError, "setConcreteMemoryValue(): Architecture is not defined.");
+        try {
+          triton::getCurrentApi().setSolverResourceLimit(PyLong_AsUint32(value));
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
 
-        /* setConcreteMemoryValue(integer, integer) */
-        if (mem != nullptr && (PyLong_Check(mem) || PyInt_Check(mem))) {
-          if (value == nullptr || (!PyLong_Check(value) && !PyInt_Check(value)))
-            return PyErr_Format(PyExc_TypeError, "setConcreteMemoryValue(): Expects a value as second argument.");
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
 
-          triton::uint64 addr   = PyLong_AsUint64(mem);
-          triton::uint32 cvalue = PyLong_AsUint32(value);
 
-          if (cvalue > 0xff)
-            return PyErr_Format(PyExc_TypeError, "setConcreteMemoryValue(): Value must be on 8 bits.");
+      static PyObject* triton_setSolverTimeout(PyObject* self, PyObject* value) {
+        /* Check if the architecture is definied */
+        if (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "setSolverTimeout(): Architecture is not defined.");
 
-          try {
-            triton::api.setConcreteMemoryValue(addr, static_cast<triton::uint8>(cvalue & 0xff));
-          }
-          catch (const triton::exceptions::Exception& e) {
-            return PyErr_Format(PyExc_TypeError, "%s", e.what());
-          }
+        if (!PyLong_Check(value) && !PyInt_Check(value))
+          return PyErr_Format(PyExc_TypeError, "setSolverTimeout(): Expects an integer as argument.");
 
+        try {
+          triton::getCurrentApi().setSolverTimeout(PyLong_AsUint32(value));
         }
-
-        /* setConcreteMemoryValue(MemoryAccess) */
-        else if (mem != nullptr && PyMemoryAccess_Check(mem)) {
-          if (value != nullptr)
-            return PyErr_Format(PyExc_TypeError, "setConcreteMemoryValue(): Expects no second argument.");
-          try {
-            triton::api.setConcreteMemoryValue(*PyMemoryAccess_AsMemoryAccess(mem));
-          }
-          catch (const triton::exceptions::Exception& e) {
-            return PyErr_Format(PyExc_TypeError, "%s", e.what());
-          }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
         }
 
-        /* Invalid */
-        else
-          return PyErr_Format(PyExc_TypeError, "setConcreteMemoryValue(): Expects a MemoryAccess or an integer as first argument.");
-
         Py_INCREF(Py_None);
         return Py_None;
       }
 
 
-      static PyObject* triton_setConcreteRegisterValue(PyObject* self, PyObject* reg) {
+      static PyObject* triton_setStateMergingLimit(PyObject* self, PyObject* value) {
         /* Check if the architecture is definied */
-        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
-          return PyErr_Format(PyExc_TypeError, "setConcreteRegisterValue(): Architecture is not defined.");
+        if (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "setStateMergingLimit(): Architecture is not defined.");
 
-        if (!PyRegister_Check(reg))
-          return PyErr_Format(PyExc_TypeError, "setConcreteRegisterValue(): Expects a REG as first argument.");
+        if (!PyLong_Check(value) && !PyInt_Check(value))
+          return PyErr_Format(PyExc_TypeError, "setStateMergingLimit(): Expects an integer as argument.");
 
         try {
-          triton::api.setConcreteRegisterValue(*PyRegister_AsRegister(reg));
+          triton::getCurrentApi().setStateMergingLimit(PyLong_AsUsize(value));
         }
         catch (const triton::exceptions::Exception& e) {
           return PyErr_Format(PyExc_TypeError, "%s", e.what());
@@ -2455,7 +6069,7 @@ namespace triton {
         PyArg_ParseTuple(args, "|OO", &mem, &flag);
 
         /* Check if the architecture is definied */
-        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+        if (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_INVALID)
           return PyErr_Format(PyExc_TypeError, "setTaintMemory(): Architecture is not defined.");
 
         if (mem == nullptr || !PyMemoryAccess_Check(mem))
@@ -2465,7 +6079,7 @@ namespace triton {
           return PyErr_Format(PyExc_TypeError, "setTaintMemory(): Expects a boolean as second argument.");
 
         try {
-          if (triton::api.setTaintMemory(*PyMemoryAccess_AsMemoryAccess(mem), PyLong_AsBool(flag)) == true)
+          if (triton::getCurrentApi().setTaintMemory(*PyMemoryAccess_AsMemoryAccess(mem), PyLong_AsBool(flag)) == true)
             Py_RETURN_TRUE;
           Py_RETURN_FALSE;
         }
@@ -2483,7 +6097,7 @@ namespace triton {
         PyArg_ParseTuple(args, "|OO", &reg, &flag);
 
         /* Check if the architecture is definied */
-        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+        if (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_INVALID)
           return PyErr_Format(PyExc_TypeError, "setTaintRegister(): Architecture is not defined.");
 
         if (reg == nullptr || !PyRegister_Check(reg))
@@ -2493,7 +6107,7 @@ namespace triton {
           return PyErr_Format(PyExc_TypeError, "setTaintRegister(): Expects a boolean as second argument.");
 
         try {
-          if (triton::api.setTaintRegister(*PyRegister_AsRegister(reg), PyLong_AsBool(flag)) == true)
+          if (triton::getCurrentApi().setTaintRegister(*PyRegister_AsRegister(reg), PyLong_AsBool(flag)) == true)
             Py_RETURN_TRUE;
           Py_RETURN_FALSE;
         }
@@ -2503,6 +6117,36 @@ namespace triton {
       }
 
 
+      static PyObject* triton_setVirtualFile(PyObject* self, PyObject* args) {
+        PyObject* path    = nullptr;
+        PyObject* content = nullptr;
+
+        /* Extract arguments */
+        PyArg_ParseTuple(args, "|OO", &path, &content);
+
+        /* Check if the architecture is definied */
+        if (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "setVirtualFile(): Architecture is not defined.");
+
+        if (path == nullptr || !PyString_Check(path))
+          return PyErr_Format(PyExc_TypeError, "setVirtualFile(): Expects a string as first argument.");
+
+        if (content == nullptr || !PyBytes_Check(content))
+          return PyErr_Format(PyExc_TypeError, "setVirtualFile(): Expects bytes as second argument.");
+
+        try {
+          const triton::uint8* data = reinterpret_cast<const triton::uint8*>(PyBytes_AsString(content));
+          triton::getCurrentApi().getSyscallEmulator()->setFile(PyString_AsString(path), std::vector<triton::uint8>(data, data + PyBytes_Size(content)));
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
       static PyObject* triton_simplify(PyObject* self, PyObject* args) {
         PyObject* node        = nullptr;
         PyObject* z3Flag      = nullptr;
@@ -2511,7 +6155,7 @@ namespace triton {
         PyArg_ParseTuple(args, "|OO", &node, &z3Flag);
 
         /* Check if the architecture is definied */
-        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+        if (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_INVALID)
           return PyErr_Format(PyExc_TypeError, "simplify(): Architecture is not defined.");
 
         if (node == nullptr || !PyAstNode_Check(node))
@@ -2524,7 +6168,13 @@ namespace triton {
           z3Flag = PyLong_FromUint32(false);
 
         try {
-          return PyAstNode(triton::api.processSimplification(PyAstNode_AsAstNode(node), PyLong_AsBool(z3Flag)));
+          triton::ast::AbstractNode* ast = PyAstNode_AsAstNode(node);
+          bool z3 = PyLong_AsBool(z3Flag);
+          {
+            GilRelease release;
+            ast = triton::getCurrentApi().processSimplification(ast, z3);
+          }
+          return PyAstNode(ast);
         }
         catch (const triton::exceptions::Exception& e) {
           return PyErr_Format(PyExc_TypeError, "%s", e.what());
@@ -2536,14 +6186,14 @@ namespace triton {
         PyObject* ret = nullptr;
 
         /* Check if the architecture is definied */
-        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+        if (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_INVALID)
           return PyErr_Format(PyExc_TypeError, "sliceExpressions(): Architecture is not defined.");
 
         if (!PySymbolicExpression_Check(expr))
           return PyErr_Format(PyExc_TypeError, "sliceExpressions(): Expects a SymbolicExpression as argument.");
 
         try {
-          auto exprs = triton::api.sliceExpressions(PySymbolicExpression_AsSymbolicExpression(expr));
+          auto exprs = triton::getCurrentApi().sliceExpressions(PySymbolicExpression_AsSymbolicExpression(expr));
 
           ret = xPyDict_New();
           for (auto it = exprs.begin(); it != exprs.end(); it++)
@@ -2557,16 +6207,136 @@ namespace triton {
       }
 
 
+      static PyObject* triton_snapshot(PyObject* self, PyObject* noarg) {
+        /* Check if the architecture is definied */
+        if (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "snapshot(): Architecture is not defined.");
+
+        try {
+          return PyLong_FromUsize(triton::getCurrentApi().snapshot());
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* triton_startSolverSession(PyObject* self, PyObject* noarg) {
+        /* Check if the architecture is definied */
+        if (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "startSolverSession(): Architecture is not defined.");
+
+        try {
+          triton::getCurrentApi().startSolverSession();
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
+      static PyObject* triton_stepBack(PyObject* self, PyObject* args) {
+        PyObject* count = nullptr;
+
+        /* Extract arguments */
+        PyArg_ParseTuple(args, "|O", &count);
+
+        /* Check if the architecture is definied */
+        if (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "stepBack(): Architecture is not defined.");
+
+        if (count != nullptr && (!PyLong_Check(count) && !PyInt_Check(count)))
+          return PyErr_Format(PyExc_TypeError, "stepBack(): Expects an integer as argument.");
+
+        try {
+          return PyLong_FromUsize(triton::getCurrentApi().stepBack(count != nullptr ? PyLong_AsUsize(count) : 1));
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* triton_stopDependencyExport(PyObject* self, PyObject* noarg) {
+        /* Check if the architecture is definied */
+        if (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "stopDependencyExport(): Architecture is not defined.");
+
+        try {
+          triton::getCurrentApi().stopDependencyExport();
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
+      static PyObject* triton_stopSolverSession(PyObject* self, PyObject* noarg) {
+        /* Check if the architecture is definied */
+        if (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "stopSolverSession(): Architecture is not defined.");
+
+        try {
+          triton::getCurrentApi().stopSolverSession();
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
+      static PyObject* triton_taintAssignmentMemoryArea(PyObject* self, PyObject* args) {
+        PyObject* dst  = nullptr;
+        PyObject* src  = nullptr;
+        PyObject* size = nullptr;
+
+        /* Extract arguments */
+        PyArg_ParseTuple(args, "|OOO", &dst, &src, &size);
+
+        /* Check if the architecture is definied */
+        if (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "taintAssignmentMemoryArea(): Architecture is not defined.");
+
+        if (dst == nullptr || (!PyLong_Check(dst) && !PyInt_Check(dst)))
+          return PyErr_Format(PyExc_TypeError, "taintAssignmentMemoryArea(): Expects a destination address (integer) as first argument.");
+
+        if (src == nullptr || (!PyLong_Check(src) && !PyInt_Check(src)))
+          return PyErr_Format(PyExc_TypeError, "taintAssignmentMemoryArea(): Expects a source address (integer) as second argument.");
+
+        if (size == nullptr || (!PyLong_Check(size) && !PyInt_Check(size)))
+          return PyErr_Format(PyExc_TypeError, "taintAssignmentMemoryArea(): Expects a size (integer) as third argument.");
+
+        try {
+          if (triton::getCurrentApi().taintAssignmentMemoryArea(PyLong_AsUint64(dst), PyLong_AsUint64(src), PyLong_AsUsize(size)) == true)
+            Py_RETURN_TRUE;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_RETURN_FALSE;
+      }
+
+
       static PyObject* triton_taintAssignmentMemoryImmediate(PyObject* self, PyObject* mem) {
         /* Check if the architecture is definied */
-        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+        if (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_INVALID)
           return PyErr_Format(PyExc_TypeError, "taintAssignmentMemoryImmediate(): Architecture is not defined.");
 
         if (!PyMemoryAccess_Check(mem))
           return PyErr_Format(PyExc_TypeError, "taintAssignmentMemoryImmediate(): Expects a MemoryAccess as argument.");
 
         try {
-          if (triton::api.taintAssignmentMemoryImmediate(*PyMemoryAccess_AsMemoryAccess(mem)) == true)
+          if (triton::getCurrentApi().taintAssignmentMemoryImmediate(*PyMemoryAccess_AsMemoryAccess(mem)) == true)
             Py_RETURN_TRUE;
           Py_RETURN_FALSE;
         }
@@ -2584,7 +6354,7 @@ namespace triton {
         PyArg_ParseTuple(args, "|OO", &mem1, &mem2);
 
         /* Check if the architecture is definied */
-        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+        if (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_INVALID)
           return PyErr_Format(PyExc_TypeError, "taintAssignmentMemoryMemory(): Architecture is not defined.");
 
         if (mem1 == nullptr || !PyMemoryAccess_Check(mem1))
@@ -2594,7 +6364,7 @@ namespace triton {
           return PyErr_Format(PyExc_TypeError, "taintAssignmentMemoryMemory(): Expects a MemoryAccess as second argument.");
 
         try {
-          if (triton::api.taintAssignmentMemoryMemory(*PyMemoryAccess_AsMemoryAccess(mem1), *PyMemoryAccess_AsMemoryAccess(mem2)) == true)
+          if (triton::getCurrentApi().taintAssignmentMemoryMemory(*PyMemoryAccess_AsMemoryAccess(mem1), *PyMemoryAccess_AsMemoryAccess(mem2)) == true)
             Py_RETURN_TRUE;
           Py_RETURN_FALSE;
         }
@@ -2612,7 +6382,7 @@ namespace triton {
         PyArg_ParseTuple(args, "|OO", &mem, &reg);
 
         /* Check if the architecture is definied */
-        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+        if (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_INVALID)
           return PyErr_Format(PyExc_TypeError, "taintAssignmentMemoryRegister(): Architecture is not defined.");
 
         if (mem == nullptr || !PyMemoryAccess_Check(mem))
@@ -2622,7 +6392,7 @@ namespace triton {
           return PyErr_Format(PyExc_TypeError, "taintAssignmentMemoryRegister(): Expects a REG as second argument.");
 
         try {
-          if (triton::api.taintAssignmentMemoryRegister(*PyMemoryAccess_AsMemoryAccess(mem), *PyRegister_AsRegister(reg)) == true)
+          if (triton::getCurrentApi().taintAssignmentMemoryRegister(*PyMemoryAccess_AsMemoryAccess(mem), *PyRegister_AsRegister(reg)) == true)
             Py_RETURN_TRUE;
           Py_RETURN_FALSE;
         }
@@ -2634,14 +6404,14 @@ namespace triton {
 
       static PyObject* triton_taintAssignmentRegisterImmediate(PyObject* self, PyObject* reg) {
         /* Check if the architecture is definied */
-        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+        if (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_INVALID)
           return PyErr_Format(PyExc_TypeError, "taintAssignmentRegisterImmediate(): Architecture is not defined.");
 
         if (!PyRegister_Check(reg))
           return PyErr_Format(PyExc_TypeError, "taintAssignmentRegisterImmediate(): Expects a REG as argument.");
 
         try {
-          if (triton::api.taintAssignmentRegisterImmediate(*PyRegister_AsRegister(reg)) == true)
+          if (triton::getCurrentApi().taintAssignmentRegisterImmediate(*PyRegister_AsRegister(reg)) == true)
             Py_RETURN_TRUE;
           Py_RETURN_FALSE;
         }
@@ -2659,7 +6429,7 @@ namespace triton {
         PyArg_ParseTuple(args, "|OO", &reg, &mem);
 
         /* Check if the architecture is definied */
-        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+        if (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_INVALID)
           return PyErr_Format(PyExc_TypeError, "taintAssignmentRegisterMemory(): Architecture is not defined.");
 
         if (reg == nullptr || !PyRegister_Check(reg))
@@ -2669,7 +6439,7 @@ namespace triton {
           return PyErr_Format(PyExc_TypeError, "taintAssignmentRegisterMemory(): Expects a MemoryAccess as second argument.");
 
         try {
-          if (triton::api.taintAssignmentRegisterMemory(*PyRegister_AsRegister(reg), *PyMemoryAccess_AsMemoryAccess(mem)) == true)
+          if (triton::getCurrentApi().taintAssignmentRegisterMemory(*PyRegister_AsRegister(reg), *PyMemoryAccess_AsMemoryAccess(mem)) == true)
             Py_RETURN_TRUE;
           Py_RETURN_FALSE;
         }
@@ -2687,7 +6457,7 @@ namespace triton {
         PyArg_ParseTuple(args, "|OO", &reg1, &reg2);
 
         /* Check if the architecture is definied */
-        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+        if (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_INVALID)
           return PyErr_Format(PyExc_TypeError, "taintAssignmentRegisterRegister(): Architecture is not defined.");
 
         if (reg1 == nullptr || !PyRegister_Check(reg1))
@@ -2697,7 +6467,7 @@ namespace triton {
           return PyErr_Format(PyExc_TypeError, "taintAssignmentRegisterRegister(): Expects a REG as second argument.");
 
         try {
-          if (triton::api.taintAssignmentRegisterRegister(*PyRegister_AsRegister(reg1), *PyRegister_AsRegister(reg2)) == true)
+          if (triton::getCurrentApi().taintAssignmentRegisterRegister(*PyRegister_AsRegister(reg1), *PyRegister_AsRegister(reg2)) == true)
             Py_RETURN_TRUE;
           Py_RETURN_FALSE;
         }
@@ -2709,17 +6479,17 @@ namespace triton {
 
       static PyObject* triton_taintMemory(PyObject* self, PyObject* mem) {
         /* Check if the architecture is definied */
-        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+        if (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_INVALID)
           return PyErr_Format(PyExc_TypeError, "taintMemory(): Architecture is not defined.");
 
         try {
           if (PyMemoryAccess_Check(mem)) {
-            if (triton::api.taintMemory(*PyMemoryAccess_AsMemoryAccess(mem)) == true)
+            if (triton::getCurrentApi().taintMemory(*PyMemoryAccess_AsMemoryAccess(mem)) == true)
               Py_RETURN_TRUE;
           }
 
           else if (PyLong_Check(mem) || PyInt_Check(mem)) {
-            if (triton::api.taintMemory(PyLong_AsUint64(mem)) == true)
+            if (triton::getCurrentApi().taintMemory(PyLong_AsUint64(mem)) == true)
               Py_RETURN_TRUE;
           }
 
@@ -2733,16 +6503,50 @@ namespace triton {
       }
 
 
+      static PyObject* triton_taintMemoryArea(PyObject* self, PyObject* args) {
+        PyObject* baseAddr        = nullptr;
+        PyObject* size            = nullptr;
+        triton::uint64 c_baseAddr = 0;
+        triton::usize c_size      = 1;
+
+        /* Extract arguments */
+        PyArg_ParseTuple(args, "|OO", &baseAddr, &size);
+
+        /* Check if the architecture is definied */
+        if (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "taintMemoryArea(): Architecture is not defined.");
+
+        if (baseAddr == nullptr || (!PyLong_Check(baseAddr) && !PyInt_Check(baseAddr)))
+          return PyErr_Format(PyExc_TypeError, "taintMemoryArea(): Expects a base address (integer) as first argument.");
+
+        if (size != nullptr && !PyLong_Check(size) && !PyInt_Check(size))
+          return PyErr_Format(PyExc_TypeError, "taintMemoryArea(): Expects a size (integer) as second argument.");
+
+        try {
+          c_baseAddr = PyLong_AsUint64(baseAddr);
+          if (size != nullptr)
+            c_size = PyLong_AsUsize(size);
+          if (triton::getCurrentApi().taintMemoryArea(c_baseAddr, c_size) == true)
+            Py_RETURN_TRUE;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_RETURN_FALSE;
+      }
+
+
       static PyObject* triton_taintRegister(PyObject* self, PyObject* reg) {
         /* Check if the architecture is definied */
-        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+        if (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_INVALID)
           return PyErr_Format(PyExc_TypeError, "taintRegister(): Architecture is not defined.");
 
         if (!PyRegister_Check(reg))
           return PyErr_Format(PyExc_TypeError, "taintRegister(): Expects a MemoryAccess as argument.");
 
         try {
-          if (triton::api.taintRegister(*PyRegister_AsRegister(reg)) == true)
+          if (triton::getCurrentApi().taintRegister(*PyRegister_AsRegister(reg)) == true)
             Py_RETURN_TRUE;
           Py_RETURN_FALSE;
         }
@@ -2752,16 +6556,49 @@ namespace triton {
       }
 
 
+      static PyObject* triton_taintUnionMemoryArea(PyObject* self, PyObject* args) {
+        PyObject* dst  = nullptr;
+        PyObject* src  = nullptr;
+        PyObject* size = nullptr;
+
+        /* Extract arguments */
+        PyArg_ParseTuple(args, "|OOO", &dst, &src, &size);
+
+        /* Check if the architecture is definied */
+        if (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "taintUnionMemoryArea(): Architecture is not defined.");
+
+        if (dst == nullptr || (!PyLong_Check(dst) && !PyInt_Check(dst)))
+          return PyErr_Format(PyExc_TypeError, "taintUnionMemoryArea(): Expects a destination address (integer) as first argument.");
+
+        if (src == nullptr || (!PyLong_Check(src) && !PyInt_Check(src)))
+          return PyErr_Format(PyExc_TypeError, "taintUnionMemoryArea(): Expects a source address (integer) as second argument.");
+
+        if (size == nullptr || (!PyLong_Check(size) && !PyInt_Check(size)))
+          return PyErr_Format(PyExc_TypeError, "taintUnionMemoryArea(): Expects a size (integer) as third argument.");
+
+        try {
+          if (triton::getCurrentApi().taintUnionMemoryArea(PyLong_AsUint64(dst), PyLong_AsUint64(src), PyLong_AsUsize(size)) == true)
+            Py_RETURN_TRUE;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_RETURN_FALSE;
+      }
+
+
       static PyObject* triton_taintUnionMemoryImmediate(PyObject* self, PyObject* mem) {
         /* Check if the architecture is definied */
-        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+        if (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_INVALID)
           return PyErr_Format(PyExc_TypeError, "taintUnionMemoryImmediate(): Architecture is not defined.");
 
         if (!PyMemoryAccess_Check(mem))
           return PyErr_Format(PyExc_TypeError, "taintUnionMemoryImmediate(): Expects a MemoryAccess as argument.");
 
         try {
-          if (triton::api.taintUnionMemoryImmediate(*PyMemoryAccess_AsMemoryAccess(mem)) == true)
+          if (triton::getCurrentApi().taintUnionMemoryImmediate(*PyMemoryAccess_AsMemoryAccess(mem)) == true)
             Py_RETURN_TRUE;
           Py_RETURN_FALSE;
         }
@@ -2779,7 +6616,7 @@ namespace triton {
         PyArg_ParseTuple(args, "|OO", &mem1, &mem2);
 
         /* Check if the architecture is definied */
-        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+        if (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_INVALID)
           return PyErr_Format(PyExc_TypeError, "taintUnionMemoryMemory(): Architecture is not defined.");
 
         if (mem1 == nullptr || !PyMemoryAccess_Check(mem1))
@@ -2789,7 +6626,7 @@ namespace triton {
           return PyErr_Format(PyExc_TypeError, "taintUnionMemoryMemory(): Expects a MemoryAccess as second argument.");
 
         try {
-          if (triton::api.taintUnionMemoryMemory(*PyMemoryAccess_AsMemoryAccess(mem1), *PyMemoryAccess_AsMemoryAccess(mem2)) == true)
+          if (triton::getCurrentApi().taintUnionMemoryMemory(*PyMemoryAccess_AsMemoryAccess(mem1), *PyMemoryAccess_AsMemoryAccess(mem2)) == true)
             Py_RETURN_TRUE;
           Py_RETURN_FALSE;
         }
@@ -2807,7 +6644,7 @@ namespace triton {
         PyArg_ParseTuple(args, "|OO", &mem, &reg);
 
         /* Check if the architecture is definied */
-        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+        if (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_INVALID)
           return PyErr_Format(PyExc_TypeError, "taintUnionMemoryRegister(): Architecture is not defined.");
 
         if (mem == nullptr || !PyMemoryAccess_Check(mem))
@@ -2817,7 +6654,7 @@ namespace triton {
           return PyErr_Format(PyExc_TypeError, "taintUnionMemoryRegister(): Expects a REG as second argument.");
 
         try {
-          if (triton::api.taintUnionMemoryRegister(*PyMemoryAccess_AsMemoryAccess(mem), *PyRegister_AsRegister(reg)) == true)
+          if (triton::getCurrentApi().taintUnionMemoryRegister(*PyMemoryAccess_AsMemoryAccess(mem), *PyRegister_AsRegister(reg)) == true)
             Py_RETURN_TRUE;
           Py_RETURN_FALSE;
         }
@@ -2829,14 +6666,14 @@ namespace triton {
 
       static PyObject* triton_taintUnionRegisterImmediate(PyObject* self, PyObject* reg) {
         /* Check if the architecture is definied */
-        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+        if (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_INVALID)
           return PyErr_Format(PyExc_TypeError, "taintUnionRegisterImmediate(): Architecture is not defined.");
 
         if (!PyRegister_Check(reg))
           return PyErr_Format(PyExc_TypeError, "taintUnionRegisterImmediate(): Expects a REG as argument.");
 
         try {
-          if (triton::api.taintUnionRegisterImmediate(*PyRegister_AsRegister(reg)) == true)
+          if (triton::getCurrentApi().taintUnionRegisterImmediate(*PyRegister_AsRegister(reg)) == true)
             Py_RETURN_TRUE;
           Py_RETURN_FALSE;
         }
@@ -2854,7 +6691,7 @@ namespace triton {
         PyArg_ParseTuple(args, "|OO", &reg, &mem);
 
         /* Check if the architecture is definied */
-        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+        if (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_INVALID)
           return PyErr_Format(PyExc_TypeError, "taintUnionRegisterMemory(): Architecture is not defined.");
 
         if (reg == nullptr || !PyRegister_Check(reg))
@@ -2864,7 +6701,7 @@ namespace triton {
           return PyErr_Format(PyExc_TypeError, "taintUnionRegisterMemory(): Expects a MemoryAccess as second argument.");
 
         try {
-          if (triton::api.taintUnionRegisterMemory(*PyRegister_AsRegister(reg), *PyMemoryAccess_AsMemoryAccess(mem)) == true)
+          if (triton::getCurrentApi().taintUnionRegisterMemory(*PyRegister_AsRegister(reg), *PyMemoryAccess_AsMemoryAccess(mem)) == true)
             Py_RETURN_TRUE;
           Py_RETURN_FALSE;
         }
@@ -2882,7 +6719,7 @@ namespace triton {
         PyArg_ParseTuple(args, "|OO", &reg1, &reg2);
 
         /* Check if the architecture is definied */
-        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+        if (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_INVALID)
           return PyErr_Format(PyExc_TypeError, "taintUnionRegisterRegister(): Architecture is not defined.");
 
         if (reg1 == nullptr || !PyRegister_Check(reg1))
@@ -2892,7 +6729,7 @@ namespace triton {
           return PyErr_Format(PyExc_TypeError, "taintUnionRegisterRegister(): Expects a REG as second argument.");
 
         try {
-          if (triton::api.taintUnionRegisterRegister(*PyRegister_AsRegister(reg1), *PyRegister_AsRegister(reg2)) == true)
+          if (triton::getCurrentApi().taintUnionRegisterRegister(*PyRegister_AsRegister(reg1), *PyRegister_AsRegister(reg2)) == true)
             Py_RETURN_TRUE;
           Py_RETURN_FALSE;
         }
@@ -2912,7 +6749,7 @@ namespace triton {
         PyArg_ParseTuple(args, "|OO", &baseAddr, &size);
 
         /* Check if the architecture is definied */
-        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+        if (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_INVALID)
           return PyErr_Format(PyExc_TypeError, "unmapMemory(): Architecture is not defined.");
 
         if (baseAddr == nullptr || (!PyLong_Check(baseAddr) && !PyInt_Check(baseAddr)))
@@ -2925,7 +6762,7 @@ namespace triton {
           c_baseAddr = PyLong_AsUint64(baseAddr);
           if (size != nullptr)
             c_size = PyLong_AsUsize(size);
-          triton::api.unmapMemory(c_baseAddr, c_size);
+          triton::getCurrentApi().unmapMemory(c_baseAddr, c_size);
         }
         catch (const triton::exceptions::Exception& e) {
           return PyErr_Format(PyExc_TypeError, "%s", e.what());
@@ -2936,19 +6773,33 @@ namespace triton {
       }
 
 
+      static PyObject* triton_unpinSymbolicExpression(PyObject* self, PyObject* symExprId) {
+        if (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "unpinSymbolicExpression(): Architecture is not defined.");
+
+        if (!PyInt_Check(symExprId) && !PyLong_Check(symExprId))
+          return PyErr_Format(PyExc_TypeError, "unpinSymbolicExpression(): Expects an integer as argument.");
+
+        triton::getCurrentApi().unpinSymbolicExpression(PyLong_AsUsize(symExprId));
+
+        Py_INCREF(Py_None);
+        return Py_None;
+      }
+
+
       static PyObject* triton_untaintMemory(PyObject* self, PyObject* mem) {
         /* Check if the architecture is definied */
-        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+        if (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_INVALID)
           return PyErr_Format(PyExc_TypeError, "untaintMemory(): Architecture is not defined.");
 
         try {
           if (PyMemoryAccess_Check(mem)) {
-            if (triton::api.untaintMemory(*PyMemoryAccess_AsMemoryAccess(mem)) == true)
+            if (triton::getCurrentApi().untaintMemory(*PyMemoryAccess_AsMemoryAccess(mem)) == true)
               Py_RETURN_TRUE;
           }
 
           else if (PyLong_Check(mem) || PyInt_Check(mem)) {
-            if (triton::api.untaintMemory(PyLong_AsUint64(mem)) == true)
+            if (triton::getCurrentApi().untaintMemory(PyLong_AsUint64(mem)) == true)
               Py_RETURN_TRUE;
           }
 
@@ -2962,16 +6813,50 @@ namespace triton {
       }
 
 
+      static PyObject* triton_untaintMemoryArea(PyObject* self, PyObject* args) {
+        PyObject* baseAddr        = nullptr;
+        PyObject* size            = nullptr;
+        triton::uint64 c_baseAddr = 0;
+        triton::usize c_size      = 1;
+
+        /* Extract arguments */
+        PyArg_ParseTuple(args, "|OO", &baseAddr, &size);
+
+        /* Check if the architecture is definied */
+        if (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_INVALID)
+          return PyErr_Format(PyExc_TypeError, "untaintMemoryArea(): Architecture is not defined.");
+
+        if (baseAddr == nullptr || (!PyLong_Check(baseAddr) && !PyInt_Check(baseAddr)))
+          return PyErr_Format(PyExc_TypeError, "untaintMemoryArea(): Expects a base address (integer) as first argument.");
+
+        if (size != nullptr && !PyLong_Check(size) && !PyInt_Check(size))
+          return PyErr_Format(PyExc_TypeError, "untaintMemoryArea(): Expects a size (integer) as second argument.");
+
+        try {
+          c_baseAddr = PyLong_AsUint64(baseAddr);
+          if (size != nullptr)
+            c_size = PyLong_AsUsize(size);
+          if (triton::getCurrentApi().untaintMemoryArea(c_baseAddr, c_size) == true)
+            Py_RETURN_TRUE;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+
+        Py_RETURN_FALSE;
+      }
+
+
       static PyObject* triton_untaintRegister(PyObject* self, PyObject* reg) {
         /* Check if the architecture is definied */
-        if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
+        if (triton::getCurrentApi().getArchitecture() == triton::arch::ARCH_INVALID)
           return PyErr_Format(PyExc_TypeError, "untaintRegister(): Architecture is not defined.");
 
         if (!PyRegister_Check(reg))
           return PyErr_Format(PyExc_TypeError, "untaintRegister(): Expects a MemoryAccess as argument.");
 
         try {
-          if (triton::api.untaintRegister(*PyRegister_AsRegister(reg)) == true)
+          if (triton::getCurrentApi().untaintRegister(*PyRegister_AsRegister(reg)) == true)
             Py_RETURN_TRUE;
           Py_RETURN_FALSE;
         }
@@ -2989,19 +6874,34 @@ namespace triton {
         {"MemoryAccess",                        (PyCFunction)triton_MemoryAccess,                           METH_VARARGS,       ""},
         {"Pe",                                  (PyCFunction)triton_Pe,                                     METH_O,             ""},
         {"Register",                            (PyCFunction)triton_Register,                               METH_VARARGS,       ""},
+        {"addBatchedCallback",                  (PyCFunction)triton_addBatchedCallback,                     METH_VARARGS,       ""},
         {"addCallback",                         (PyCFunction)triton_addCallback,                            METH_VARARGS,       ""},
+        {"addFunctionSummaries",                (PyCFunction)triton_addFunctionSummaries,                   METH_O,             ""},
+        {"addFunctionSummary",                  (PyCFunction)triton_addFunctionSummary,                     METH_VARARGS,       ""},
+        {"addLearnedFunctionSummary",           (PyCFunction)triton_addLearnedFunctionSummary,              METH_VARARGS,       ""},
+        {"addSymbolicRegion",                   (PyCFunction)triton_addSymbolicRegion,                      METH_VARARGS,       ""},
         {"assignSymbolicExpressionToMemory",    (PyCFunction)triton_assignSymbolicExpressionToMemory,       METH_VARARGS,       ""},
         {"assignSymbolicExpressionToRegister",  (PyCFunction)triton_assignSymbolicExpressionToRegister,     METH_VARARGS,       ""},
         {"buildSemantics",                      (PyCFunction)triton_buildSemantics,                         METH_O,             ""},
         {"buildSymbolicImmediate",              (PyCFunction)triton_buildSymbolicImmediate,                 METH_O,             ""},
         {"buildSymbolicMemory",                 (PyCFunction)triton_buildSymbolicMemory,                    METH_O,             ""},
         {"buildSymbolicRegister",               (PyCFunction)triton_buildSymbolicRegister,                  METH_O,             ""},
+        {"checkpoint",                          (PyCFunction)triton_checkpoint,                             METH_NOARGS,        ""},
+        {"clearExpressionProfile",              (PyCFunction)triton_clearExpressionProfile,                 METH_NOARGS,        ""},
+        {"clearOpcodeProfile",                  (PyCFunction)triton_clearOpcodeProfile,                     METH_NOARGS,        ""},
         {"clearPathConstraints",                (PyCFunction)triton_clearPathConstraints,                   METH_NOARGS,        ""},
+        {"clearPerfCounters",                   (PyCFunction)triton_clearPerfCounters,                      METH_NOARGS,        ""},
+        {"clearPointerPolicies",                (PyCFunction)triton_clearPointerPolicies,                   METH_NOARGS,        ""},
+        {"clearQueryCache",                     (PyCFunction)triton_clearQueryCache,                        METH_NOARGS,        ""},
+        {"clearSymbolicRegions",                (PyCFunction)triton_clearSymbolicRegions,                   METH_NOARGS,        ""},
+        {"clearTraceEvents",                    (PyCFunction)triton_clearTraceEvents,                       METH_NOARGS,        ""},
+        {"collectUnreachableExpressions",       (PyCFunction)triton_collectUnreachableExpressions,          METH_NOARGS,        ""},
         {"concretizeAllMemory",                 (PyCFunction)triton_concretizeAllMemory,                    METH_NOARGS,        ""},
         {"concretizeAllRegister",               (PyCFunction)triton_concretizeAllRegister,                  METH_NOARGS,        ""},
         {"concretizeMemory",                    (PyCFunction)triton_concretizeMemory,                       METH_O,             ""},
         {"concretizeRegister",                  (PyCFunction)triton_concretizeRegister,                     METH_O,             ""},
         {"convertExpressionToSymbolicVariable", (PyCFunction)triton_convertExpressionToSymbolicVariable,    METH_VARARGS,       ""},
+        {"convertMemoryAreaToSymbolicVariables", (PyCFunction)triton_convertMemoryAreaToSymbolicVariables,  METH_VARARGS,       ""},
         {"convertMemoryToSymbolicVariable",     (PyCFunction)triton_convertMemoryToSymbolicVariable,        METH_VARARGS,       ""},
         {"convertRegisterToSymbolicVariable",   (PyCFunction)triton_convertRegisterToSymbolicVariable,      METH_VARARGS,       ""},
         {"cpuRegisterBitSize",                  (PyCFunction)triton_cpuRegisterBitSize,                     METH_NOARGS,        ""},
@@ -3010,65 +6910,168 @@ namespace triton {
         {"createSymbolicMemoryExpression",      (PyCFunction)triton_createSymbolicMemoryExpression,         METH_VARARGS,       ""},
         {"createSymbolicRegisterExpression",    (PyCFunction)triton_createSymbolicRegisterExpression,       METH_VARARGS,       ""},
         {"createSymbolicVolatileExpression",    (PyCFunction)triton_createSymbolicVolatileExpression,       METH_VARARGS,       ""},
+        {"deserializeAsts",                     (PyCFunction)triton_deserializeAsts,                        METH_O,             ""},
+        {"deserializeSymbolicState",            (PyCFunction)triton_deserializeSymbolicState,               METH_O,             ""},
         {"disassembly",                         (PyCFunction)triton_disassembly,                            METH_O,             ""},
+        {"dumpExpressionProfile",               (PyCFunction)triton_dumpExpressionProfile,                  METH_VARARGS,       ""},
+        {"dumpOpcodeProfile",                   (PyCFunction)triton_dumpOpcodeProfile,                      METH_VARARGS,       ""},
+        {"dumpTraceEvents",                     (PyCFunction)triton_dumpTraceEvents,                        METH_NOARGS,        ""},
+        {"emulate",                             (PyCFunction)triton_emulate,                                METH_VARARGS,       ""},
         {"enableMode",                          (PyCFunction)triton_enableMode,                             METH_VARARGS,       ""},
         {"enableSymbolicEngine",                (PyCFunction)triton_enableSymbolicEngine,                   METH_O,             ""},
+        {"enableSyscallEmulation",              (PyCFunction)triton_enableSyscallEmulation,                 METH_O,             ""},
         {"enableTaintEngine",                   (PyCFunction)triton_enableTaintEngine,                      METH_O,             ""},
+        {"enableUndoJournal",                   (PyCFunction)triton_enableUndoJournal,                      METH_O,             ""},
+        {"evaluateAst",                         (PyCFunction)triton_evaluateAst,                            METH_VARARGS,       ""},
         {"evaluateAstViaZ3",                    (PyCFunction)triton_evaluateAstViaZ3,                       METH_O,             ""},
+        {"explore",                             (PyCFunction)triton_explore,                                METH_VARARGS,       ""},
+        {"exploreCoordinator",                  (PyCFunction)triton_exploreCoordinator,                     METH_VARARGS,       ""},
+        {"exploreWorker",                       (PyCFunction)triton_exploreWorker,                          METH_VARARGS,       ""},
+        {"exportDependencies",                  (PyCFunction)triton_exportDependencies,                     METH_VARARGS,       ""},
+        {"filterAssignments",                   (PyCFunction)triton_filterAssignments,                      METH_VARARGS,       ""},
+        {"flushCallbacks",                      (PyCFunction)triton_flushCallbacks,                         METH_NOARGS,        ""},
+        {"generateInputs",                      (PyCFunction)triton_generateInputs,                         METH_VARARGS,       ""},
         {"getAllRegisters",                     (PyCFunction)triton_getAllRegisters,                        METH_NOARGS,        ""},
         {"getArchitecture",                     (PyCFunction)triton_getArchitecture,                        METH_NOARGS,        ""},
         {"getAstDictionariesStats",             (PyCFunction)triton_getAstDictionariesStats,                METH_NOARGS,        ""},
         {"getAstFromId",                        (PyCFunction)triton_getAstFromId,                           METH_O,             ""},
         {"getAstRepresentationMode",            (PyCFunction)triton_getAstRepresentationMode,               METH_NOARGS,        ""},
+        {"getAsyncModel",                       (PyCFunction)triton_getAsyncModel,                          METH_O,             ""},
         {"getConcreteMemoryAreaValue",          (PyCFunction)triton_getConcreteMemoryAreaValue,             METH_VARARGS,       ""},
         {"getConcreteMemoryValue",              (PyCFunction)triton_getConcreteMemoryValue,                 METH_O,             ""},
+        {"getConcreteRegisterContext",          (PyCFunction)triton_getConcreteRegisterContext,             METH_NOARGS,        ""},
         {"getConcreteRegisterValue",            (PyCFunction)triton_getConcreteRegisterValue,               METH_O,             ""},
+        {"getEngineProfile",                    (PyCFunction)triton_getEngineProfile,                       METH_NOARGS,        ""},
+        {"getExitStatus",                       (PyCFunction)triton_getExitStatus,                          METH_NOARGS,        ""},
+        {"getExpressionProfile",                (PyCFunction)triton_getExpressionProfile,                   METH_NOARGS,        ""},
         {"getFullAst",                          (PyCFunction)triton_getFullAst,                             METH_O,             ""},
         {"getFullAstFromId",                    (PyCFunction)triton_getFullAstFromId,                       METH_O,             ""},
-        {"getModel",                            (PyCFunction)triton_getModel,                               METH_O,             ""},
+        {"getInlineReferenceSize",              (PyCFunction)triton_getInlineReferenceSize,                 METH_NOARGS,        ""},
+        {"getInstructionWindow",                (PyCFunction)triton_getInstructionWindow,                   METH_NOARGS,        ""},
+        {"getLastSolverStatus",                 (PyCFunction)triton_getLastSolverStatus,                    METH_NOARGS,        ""},
+        {"getMaxPathConstraintsPerBranch",      (PyCFunction)triton_getMaxPathConstraintsPerBranch,         METH_NOARGS,        ""},
+        {"getMemoryArray",                      (PyCFunction)triton_getMemoryArray,                         METH_NOARGS,        ""},
+        {"getMemoryLabels",                     (PyCFunction)triton_getMemoryLabels,                        METH_VARARGS,       ""},
+        {"getMemoryUsage",                      (PyCFunction)triton_getMemoryUsage,                         METH_NOARGS,        ""},
+        {"getModel",                            (PyCFunction)triton_getModel,                               METH_VARARGS,       ""},
+        {"getModelAsync",                       (PyCFunction)triton_getModelAsync,                          METH_VARARGS,       ""},
         {"getModels",                           (PyCFunction)triton_getModels,                              METH_VARARGS,       ""},
+        {"getModelsForBranches",                (PyCFunction)triton_getModelsForBranches,                   METH_O,             ""},
+        {"getModelValues",                      (PyCFunction)triton_getModelValues,                         METH_VARARGS,       ""},
+        {"getNodeBudget",                       (PyCFunction)triton_getNodeBudget,                          METH_NOARGS,        ""},
+        {"getNumberOfFrozenAstNodes",           (PyCFunction)triton_getNumberOfFrozenAstNodes,              METH_NOARGS,        ""},
+        {"getNumberOfMergedBranches",           (PyCFunction)triton_getNumberOfMergedBranches,              METH_NOARGS,        ""},
+        {"getOpcodeProfile",                    (PyCFunction)triton_getOpcodeProfile,                       METH_NOARGS,        ""},
         {"getParentRegisters",                  (PyCFunction)triton_getParentRegisters,                     METH_NOARGS,        ""},
+        {"getPartialModel",                     (PyCFunction)triton_getPartialModel,                        METH_VARARGS,       ""},
         {"getPathConstraints",                  (PyCFunction)triton_getPathConstraints,                     METH_NOARGS,        ""},
         {"getPathConstraintsAst",               (PyCFunction)triton_getPathConstraintsAst,                  METH_NOARGS,        ""},
+        {"getPathConstraintsSlice",             (PyCFunction)triton_getPathConstraintsSlice,                METH_O,             ""},
+        {"getPathConstraintsSliceAst",          (PyCFunction)triton_getPathConstraintsSliceAst,             METH_O,             ""},
+        {"getPointerPolicy",                    (PyCFunction)triton_getPointerPolicy,                       METH_O,             ""},
+        {"getQueryCacheHits",                   (PyCFunction)triton_getQueryCacheHits,                      METH_NOARGS,        ""},
+        {"getQueryCacheMisses",                 (PyCFunction)triton_getQueryCacheMisses,                    METH_NOARGS,        ""},
+        {"getRegisterLabels",                   (PyCFunction)triton_getRegisterLabels,                      METH_O,             ""},
+        {"getRemoteSolver",                     (PyCFunction)triton_getRemoteSolver,                        METH_NOARGS,        ""},
+        {"getSessionModel",                     (PyCFunction)triton_getSessionModel,                        METH_VARARGS,       ""},
+        {"getSolverBackend",                    (PyCFunction)triton_getSolverBackend,                       METH_NOARGS,        ""},
+        {"getStateMergingLimit",                (PyCFunction)triton_getStateMergingLimit,                   METH_NOARGS,        ""},
+        {"getStatistics",                       (PyCFunction)triton_getStatistics,                          METH_NOARGS,        ""},
         {"getSymbolicExpressionFromId",         (PyCFunction)triton_getSymbolicExpressionFromId,            METH_O,             ""},
         {"getSymbolicExpressions",              (PyCFunction)triton_getSymbolicExpressions,                 METH_NOARGS,        ""},
-        {"getSymbolicMemory",                   (PyCFunction)triton_getSymbolicMemory,                      METH_NOARGS,        ""},
+        {"getSymbolicMemory",                   (PyCFunction)triton_getSymbolicMemory,                      METH_VARARGS,       ""},
+        {"getSymbolicMemoryBuffer",             (PyCFunction)triton_getSymbolicMemoryBuffer,                METH_NOARGS,        ""},
         {"getSymbolicMemoryId",                 (PyCFunction)triton_getSymbolicMemoryId,                    METH_O,             ""},
+        {"getSymbolicMemoryRanges",             (PyCFunction)triton_getSymbolicMemoryRanges,                METH_NOARGS,        ""},
         {"getSymbolicMemoryValue",              (PyCFunction)triton_getSymbolicMemoryValue,                 METH_O,             ""},
         {"getSymbolicRegisterId",               (PyCFunction)triton_getSymbolicRegisterId,                  METH_O,             ""},
         {"getSymbolicRegisterValue",            (PyCFunction)triton_getSymbolicRegisterValue,               METH_O,             ""},
+        {"getSymbolicRegions",                  (PyCFunction)triton_getSymbolicRegions,                     METH_NOARGS,        ""},
         {"getSymbolicRegisters",                (PyCFunction)triton_getSymbolicRegisters,                   METH_NOARGS,        ""},
         {"getSymbolicVariableFromId",           (PyCFunction)triton_getSymbolicVariableFromId,              METH_O,             ""},
         {"getSymbolicVariableFromName",         (PyCFunction)triton_getSymbolicVariableFromName,            METH_O,             ""},
         {"getSymbolicVariables",                (PyCFunction)triton_getSymbolicVariables,                   METH_NOARGS,        ""},
         {"getTaintedMemory",                    (PyCFunction)triton_getTaintedMemory,                       METH_NOARGS,        ""},
+        {"getTaintedMemoryBuffer",              (PyCFunction)triton_getTaintedMemoryBuffer,                 METH_NOARGS,        ""},
+        {"getTaintedMemoryRanges",              (PyCFunction)triton_getTaintedMemoryRanges,                 METH_NOARGS,        ""},
         {"getTaintedRegisters",                 (PyCFunction)triton_getTaintedRegisters,                    METH_NOARGS,        ""},
-        {"getTaintedSymbolicExpressions",       (PyCFunction)triton_getTaintedSymbolicExpressions,          METH_NOARGS,        ""},
+        {"getTaintedSymbolicExpressions",       (PyCFunction)triton_getTaintedSymbolicExpressions,          METH_VARARGS,       ""},
+        {"getVirtualFile",                      (PyCFunction)triton_getVirtualFile,                         METH_O,             ""},
+        {"initMemoryArrayArea",                 (PyCFunction)triton_initMemoryArrayArea,                    METH_VARARGS,       ""},
         {"isArchitectureValid",                 (PyCFunction)triton_isArchitectureValid,                    METH_NOARGS,        ""},
+        {"isAsyncModelReady",                   (PyCFunction)triton_isAsyncModelReady,                      METH_O,             ""},
         {"isMemoryMapped",                      (PyCFunction)triton_isMemoryMapped,                         METH_VARARGS,       ""},
         {"isMemorySymbolized",                  (PyCFunction)triton_isMemorySymbolized,                     METH_O,             ""},
         {"isMemoryTainted",                     (PyCFunction)triton_isMemoryTainted,                        METH_O,             ""},
         {"isModeEnabled",                       (PyCFunction)triton_isModeEnabled,                          METH_O,             ""},
         {"isRegisterSymbolized",                (PyCFunction)triton_isRegisterSymbolized,                   METH_O,             ""},
         {"isRegisterTainted",                   (PyCFunction)triton_isRegisterTainted,                      METH_O,             ""},
+        {"isSolverSessionStarted",              (PyCFunction)triton_isSolverSessionStarted,                 METH_NOARGS,        ""},
         {"isSymbolicEngineEnabled",             (PyCFunction)triton_isSymbolicEngineEnabled,                METH_NOARGS,        ""},
         {"isSymbolicExpressionIdExists",        (PyCFunction)triton_isSymbolicExpressionIdExists,           METH_O,             ""},
+        {"isSyscallEmulationEnabled",           (PyCFunction)triton_isSyscallEmulationEnabled,              METH_NOARGS,        ""},
         {"isTaintEngineEnabled",                (PyCFunction)triton_isTaintEngineEnabled,                   METH_NOARGS,        ""},
+        {"isUndoJournalEnabled",                (PyCFunction)triton_isUndoJournalEnabled,                   METH_NOARGS,        ""},
+        {"labelMemory",                         (PyCFunction)triton_labelMemory,                            METH_VARARGS,       ""},
+        {"labelRegister",                       (PyCFunction)triton_labelRegister,                          METH_VARARGS,       ""},
+        {"loadBinary",                          (PyCFunction)triton_loadBinary,                             METH_O,             ""},
+        {"loadCheckpoint",                      (PyCFunction)triton_loadCheckpoint,                         METH_O,             ""},
+        {"loadCoreDump",                        (PyCFunction)triton_loadCoreDump,                           METH_O,             ""},
+        {"loadDecodeCache",                     (PyCFunction)triton_loadDecodeCache,                        METH_VARARGS,       ""},
         {"newSymbolicExpression",               (PyCFunction)triton_newSymbolicExpression,                  METH_VARARGS,       ""},
         {"newSymbolicVariable",                 (PyCFunction)triton_newSymbolicVariable,                    METH_VARARGS,       ""},
+        {"parseSmt",                            (PyCFunction)triton_parseSmt,                               METH_O,             ""},
+        {"pinSymbolicExpression",               (PyCFunction)triton_pinSymbolicExpression,                  METH_O,             ""},
+        {"predecode",                           (PyCFunction)triton_predecode,                              METH_VARARGS,       ""},
+        {"processBlock",                        (PyCFunction)triton_processBlock,                           METH_VARARGS,       ""},
         {"processing",                          (PyCFunction)triton_processing,                             METH_O,             ""},
         {"removeAllCallbacks",                  (PyCFunction)triton_removeAllCallbacks,                     METH_NOARGS,        ""},
         {"removeCallback",                      (PyCFunction)triton_removeCallback,                         METH_VARARGS,       ""},
+        {"removeFunctionSummary",               (PyCFunction)triton_removeFunctionSummary,                  METH_O,             ""},
+        {"removeSymbolicRegion",                (PyCFunction)triton_removeSymbolicRegion,                   METH_VARARGS,       ""},
+        {"removeSnapshot",                      (PyCFunction)triton_removeSnapshot,                         METH_O,             ""},
+        {"replayTrace",                         (PyCFunction)triton_replayTrace,                            METH_VARARGS,       ""},
         {"resetEngines",                        (PyCFunction)triton_resetEngines,                           METH_NOARGS,        ""},
-        {"setArchitecture",                     (PyCFunction)triton_setArchitecture,                        METH_O,             ""},
+        {"restore",                             (PyCFunction)triton_restore,                                METH_O,             ""},
+        {"rewindTo",                            (PyCFunction)triton_rewindTo,                               METH_O,             ""},
+        {"run",                                 (PyCFunction)triton_run,                                    METH_VARARGS,       ""},
+        {"saveCheckpoint",                      (PyCFunction)triton_saveCheckpoint,                         METH_O,             ""},
+        {"saveDecodeCache",                     (PyCFunction)triton_saveDecodeCache,                        METH_VARARGS,       ""},
+        {"serializeAsts",                       (PyCFunction)triton_serializeAsts,                          METH_O,             ""},
+        {"serializeSymbolicState",              (PyCFunction)triton_serializeSymbolicState,                 METH_NOARGS,        ""},
+        {"setArchitecture",                     (PyCFunction)triton_setArchitecture,                        METH_VARARGS,       ""},
         {"setAstRepresentationMode",            (PyCFunction)triton_setAstRepresentationMode,               METH_O,             ""},
         {"setConcreteMemoryAreaValue",          (PyCFunction)triton_setConcreteMemoryAreaValue,             METH_VARARGS,       ""},
         {"setConcreteMemoryValue",              (PyCFunction)triton_setConcreteMemoryValue,                 METH_VARARGS,       ""},
+        {"setConcreteRegisterContext",          (PyCFunction)triton_setConcreteRegisterContext,             METH_O,             ""},
         {"setConcreteRegisterValue",            (PyCFunction)triton_setConcreteRegisterValue,               METH_O,             ""},
+        {"setDefaultPointerPolicy",             (PyCFunction)triton_setDefaultPointerPolicy,                METH_VARARGS,       ""},
+        {"setExpressionLimits",                 (PyCFunction)triton_setExpressionLimits,                    METH_VARARGS,       ""},
+        {"setInlineReferenceSize",              (PyCFunction)triton_setInlineReferenceSize,                 METH_O,             ""},
+        {"setInstructionWindow",                (PyCFunction)triton_setInstructionWindow,                   METH_O,             ""},
+        {"setMaxPathConstraintsPerBranch",      (PyCFunction)triton_setMaxPathConstraintsPerBranch,         METH_O,             ""},
+        {"setMemoryLimits",                     (PyCFunction)triton_setMemoryLimits,                        METH_VARARGS,       ""},
+        {"setNodeBudget",                       (PyCFunction)triton_setNodeBudget,                          METH_O,             ""},
+        {"setPointerPolicy",                    (PyCFunction)triton_setPointerPolicy,                       METH_VARARGS,       ""},
+        {"setRemoteSolver",                     (PyCFunction)triton_setRemoteSolver,                        METH_O,             ""},
+        {"setSolverBackend",                    (PyCFunction)triton_setSolverBackend,                       METH_O,             ""},
+        {"setSolverLocalSearchBudget",          (PyCFunction)triton_setSolverLocalSearchBudget,             METH_O,             ""},
+        {"setSolverMemoryLimit",                (PyCFunction)triton_setSolverMemoryLimit,                   METH_O,             ""},
+        {"setSolverPortfolioSize",              (PyCFunction)triton_setSolverPortfolioSize,                 METH_O,             ""},
+        {"setSolverResourceLimit",              (PyCFunction)triton_setSolverResourceLimit,                 METH_O,             ""},
+        {"setSolverTimeout",                    (PyCFunction)triton_setSolverTimeout,                       METH_O,             ""},
+        {"setStateMergingLimit",                (PyCFunction)triton_setStateMergingLimit,                   METH_O,             ""},
         {"setTaintMemory",                      (PyCFunction)triton_setTaintMemory,                         METH_VARARGS,       ""},
         {"setTaintRegister",                    (PyCFunction)triton_setTaintRegister,                       METH_VARARGS,       ""},
+        {"setVirtualFile",                      (PyCFunction)triton_setVirtualFile,                         METH_VARARGS,       ""},
         {"simplify",                            (PyCFunction)triton_simplify,                               METH_VARARGS,       ""},
         {"sliceExpressions",                    (PyCFunction)triton_sliceExpressions,                       METH_O,             ""},
+        {"snapshot",                            (PyCFunction)triton_snapshot,                               METH_NOARGS,        ""},
+        {"startSolverSession",                  (PyCFunction)triton_startSolverSession,                     METH_NOARGS,        ""},
+        {"stepBack",                            (PyCFunction)triton_stepBack,                               METH_VARARGS,       ""},
+        {"stopDependencyExport",                (PyCFunction)triton_stopDependencyExport,                   METH_NOARGS,        ""},
+        {"stopSolverSession",                   (PyCFunction)triton_stopSolverSession,                      METH_NOARGS,        ""},
+        {"taintAssignmentMemoryArea",           (PyCFunction)triton_taintAssignmentMemoryArea,              METH_VARARGS,       ""},
         {"taintAssignmentMemoryImmediate",      (PyCFunction)triton_taintAssignmentMemoryImmediate,         METH_O,             ""},
         {"taintAssignmentMemoryMemory",         (PyCFunction)triton_taintAssignmentMemoryMemory,            METH_VARARGS,       ""},
         {"taintAssignmentMemoryRegister",       (PyCFunction)triton_taintAssignmentMemoryRegister,          METH_VARARGS,       ""},
@@ -3076,7 +7079,9 @@ namespace triton {
         {"taintAssignmentRegisterMemory",       (PyCFunction)triton_taintAssignmentRegisterMemory,          METH_VARARGS,       ""},
         {"taintAssignmentRegisterRegister",     (PyCFunction)triton_taintAssignmentRegisterRegister,        METH_VARARGS,       ""},
         {"taintMemory",                         (PyCFunction)triton_taintMemory,                            METH_O,             ""},
+        {"taintMemoryArea",                     (PyCFunction)triton_taintMemoryArea,                        METH_VARARGS,       ""},
         {"taintRegister",                       (PyCFunction)triton_taintRegister,                          METH_O,             ""},
+        {"taintUnionMemoryArea",                (PyCFunction)triton_taintUnionMemoryArea,                   METH_VARARGS,       ""},
         {"taintUnionMemoryImmediate",           (PyCFunction)triton_taintUnionMemoryImmediate,              METH_O,             ""},
         {"taintUnionMemoryMemory",              (PyCFunction)triton_taintUnionMemoryMemory,                 METH_VARARGS,       ""},
         {"taintUnionMemoryRegister",            (PyCFunction)triton_taintUnionMemoryRegister,               METH_VARARGS,       ""},
@@ -3084,7 +7089,9 @@ namespace triton {
         {"taintUnionRegisterMemory",            (PyCFunction)triton_taintUnionRegisterMemory,               METH_VARARGS,       ""},
         {"taintUnionRegisterRegister",          (PyCFunction)triton_taintUnionRegisterRegister,             METH_VARARGS,       ""},
         {"unmapMemory",                         (PyCFunction)triton_unmapMemory,                            METH_VARARGS,       ""},
+        {"unpinSymbolicExpression",             (PyCFunction)triton_unpinSymbolicExpression,                METH_O,             ""},
         {"untaintMemory",                       (PyCFunction)triton_untaintMemory,                          METH_O,             ""},
+        {"untaintMemoryArea",                   (PyCFunction)triton_untaintMemoryArea,                      METH_VARARGS,       ""},
         {"untaintRegister",                     (PyCFunction)triton_untaintRegister,                        METH_O,             ""},
         {nullptr,                               nullptr,                                                    0,                  nullptr}
 
@@ -32,14 +32,35 @@ The CALLBACK namespace contains all kinds of callbacks.
 \section CALLBACK_py_api Python API - Items of the CALLBACK namespace
 <hr>
 
+- **CALLBACK.EXPRESSION_LIMIT**<br>
+The callback takes as unique argument a \ref py_SymbolicExpression_page just built whose depth or unrolled size exceeds
+a limit set by `setExpressionLimits()`. Callbacks will be called after the instruction has been processed, before the
+`MODE.CONCRETIZE_LARGE_EXPRESSIONS` mode concretizes its destination. The callback must return nothing.
+
 - **CALLBACK.GET_CONCRETE_MEMORY_VALUE**<br>
 The callback takes as unique argument a \ref py_MemoryAccess_page. Callbacks will be called each time that the
 Triton library will need a concrete memory value. The callback must return nothing.
 
+- **CALLBACK.GET_CONCRETE_MEMORY_AREA_VALUE**<br>
+The callback takes as arguments the base address and the size of a memory area. Callbacks will be called once each
+time that the Triton library will need the concrete value of a memory area (instead of once per byte with
+`GET_CONCRETE_MEMORY_VALUE`). The callback must return nothing.
+
 - **CALLBACK.GET_CONCRETE_REGISTER_VALUE**<br>
 The callback takes as unique argument a \ref py_Register_page. Callbacks will be called each time that the
 Triton library will need a concrete register value. The callback must return nothing.
 
+- **CALLBACK.MEMORY_LIMIT**<br>
+The callback takes as arguments the estimated number of bytes used by the engines and a boolean which is true if
+the hard limit is exceeded (false if only the soft limit is). Callbacks will be called after an instruction has been
+processed once a limit set by `setMemoryLimits()` is exceeded. The callback may free memory and must return nothing.
+
+- **CALLBACK.MEMORY_MISS**<br>
+The callback takes as arguments the address and the size of a page of memory which is not allocated. Callbacks will
+be called once per page, the first time that the Triton library needs a concrete memory value inside it. The callback
+must return the content of the page as a string (completed with zeros if it is shorter), or None to leave it unmapped.
+The next reads of a page supplied are served by the concrete memory without calling the callback again.
+
 - **CALLBACK.SYMBOLIC_SIMPLIFICATION**<br>
 Defines a callback which be called before all symbolic assignments. The callback takes as uniq argument
 an \ref py_AstNode_page and must return a valid \ref py_AstNode_page. The returned node is used as assignment.
@@ -54,9 +75,13 @@ namespace triton {
     namespace python {
 
       void initCallbackNamespace(PyObject* callbackDict) {
-        PyDict_SetItemString(callbackDict, "GET_CONCRETE_MEMORY_VALUE",   PyLong_FromUint32(triton::callbacks::GET_CONCRETE_MEMORY_VALUE));
-        PyDict_SetItemString(callbackDict, "GET_CONCRETE_REGISTER_VALUE", PyLong_FromUint32(triton::callbacks::GET_CONCRETE_REGISTER_VALUE));
-        PyDict_SetItemString(callbackDict, "SYMBOLIC_SIMPLIFICATION",     PyLong_FromUint32(triton::callbacks::SYMBOLIC_SIMPLIFICATION));
+        PyDict_SetItemString(callbackDict, "EXPRESSION_LIMIT",                PyLong_FromUint32(triton::callbacks::EXPRESSION_LIMIT));
+        PyDict_SetItemString(callbackDict, "GET_CONCRETE_MEMORY_AREA_VALUE",  PyLong_FromUint32(triton::callbacks::GET_CONCRETE_MEMORY_AREA_VALUE));
+        PyDict_SetItemString(callbackDict, "GET_CONCRETE_MEMORY_VALUE",       PyLong_FromUint32(triton::callbacks::GET_CONCRETE_MEMORY_VALUE));
+        PyDict_SetItemString(callbackDict, "GET_CONCRETE_REGISTER_VALUE",     PyLong_FromUint32(triton::callbacks::GET_CONCRETE_REGISTER_VALUE));
+        PyDict_SetItemString(callbackDict, "MEMORY_LIMIT",                    PyLong_FromUint32(triton::callbacks::MEMORY_LIMIT));
+        PyDict_SetItemString(callbackDict, "MEMORY_MISS",                     PyLong_FromUint32(triton::callbacks::MEMORY_MISS));
+        PyDict_SetItemString(callbackDict, "SYMBOLIC_SIMPLIFICATION",         PyLong_FromUint32(triton::callbacks::SYMBOLIC_SIMPLIFICATION));
       }
 
     }; /* python namespace */
@@ -0,0 +1,56 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#ifdef TRITON_PYTHON_BINDINGS
+
+#include <explorer.hpp>
+#include <pythonBindings.hpp>
+#include <pythonUtils.hpp>
+
+
+
+/*! \page py_EXPLORATION_page EXPLORATION
+    \brief [**python api**] All information about the EXPLORATION python namespace.
+
+\tableofcontents
+
+\section EXPLORATION_py_description Description
+<hr>
+
+The EXPLORATION namespace contains all search strategies of the path explorer (see explore()).
+
+\section EXPLORATION_py_api Python API - Items of the EXPLORATION namespace
+<hr>
+
+- **EXPLORATION.BFS**<br>
+Explores the first state spawned first.
+
+- **EXPLORATION.COVERAGE**<br>
+Explores first a state which reaches an address not reached yet, otherwise the first state spawned.
+
+- **EXPLORATION.DFS**<br>
+Explores the last state spawned first.
+
+*/
+
+
+
+namespace triton {
+  namespace bindings {
+    namespace python {
+
+      void initExplorationNamespace(PyObject* explorationDict) {
+        PyDict_SetItemString(explorationDict, "BFS",      PyLong_FromUint32(triton::engines::exploration::BFS));
+        PyDict_SetItemString(explorationDict, "COVERAGE", PyLong_FromUint32(triton::engines::exploration::COVERAGE));
+        PyDict_SetItemString(explorationDict, "DFS",      PyLong_FromUint32(triton::engines::exploration::DFS));
+      }
+
+    }; /* python namespace */
+  }; /* bindings namespace */
+}; /* triton namespace */
+
+#endif /* TRITON_PYTHON_BINDINGS */
@@ -38,15 +38,131 @@ Enabled, Triton will keep a map of aligned memory to reduce the symbolic memory
 - **MODE.AST_DICTIONARIES**<br>
 Enabled, Triton will record all AST nodes into several dictionaries and try to return node already allocated instead of allocate twice the same node.
 
+- **MODE.AST_REWRITING**<br>
+Enabled, Triton will rewrite AST nodes with its built-in rules (constant folding, `x ^ x -> 0`, extractions of concatenations,
+nested extensions, neutral constants, ...) when they are built. See \ref SMT_simplification_page.
+
+- **MODE.CONCRETE_FOLDING**<br>
+Enabled, Triton will replace every bitvector node which is not symbolized, references included, by a constant node of its
+concrete value when it is built. Concrete parts of the state do not inflate the symbolic expressions anymore, but a
+reference folded this way does not follow the conversion of its expression into a symbolic variable.
+
+- **MODE.CONCRETIZE_LARGE_EXPRESSIONS**<br>
+Enabled, Triton will concretize the destination (register or memory) of the symbolic expressions which exceed the limits set
+by `setExpressionLimits()`, after the `CALLBACK.EXPRESSION_LIMIT` callbacks are called. The next instructions read a
+concrete value instead of building on the expression, which stops the blowup of hash or crypto loops.
+
+- **MODE.DECODE_AHEAD**<br>
+Enabled, `run()` and `emulate()` decode the code which follows each control flow instruction on a helper thread, with its own
+Capstone handle, while the main thread processes the current instructions. The decodings go into the decode cache, so the
+instructions seen for the first time in straight-line code do not wait for Capstone. The number of instructions decoded ahead
+is returned by getStatistics() as `disassembly.decodedAhead`.
+
+- **MODE.EXPRESSION_PROFILING**<br>
+Enabled, the symbolic engine will accumulate for each instruction address the number of instructions built, the AST nodes allocated
+by their semantics, the symbolic expressions emitted, their maximum unrolled size and depth, and the solver queries which reference
+these expressions with the time spent in them. See getExpressionProfile() and dumpExpressionProfile(), which give the addresses
+to concretize or to summarize.
+
+- **MODE.HUGE_PAGES**<br>
+Enabled, the pages of the CPU memory, of the taint shadow and of the symbolic memory references, and the slabs of the AST nodes,
+are allocated from chunks of 2 MiB backed by explicit huge pages if some are reserved (`/proc/sys/vm/nr_hugepages`), otherwise
+advised as transparent huge pages, so large working sets cause fewer TLB misses. The blocks come from the global heap if no
+chunk can be mapped. The chunks are shared by the whole process and never unmapped, their usage is returned by getStatistics()
+as `hugePages.*`. Linux only.
+
+- **MODE.INLINE_REFERENCES**<br>
+Enabled, Triton will use the AST of a symbolic expression instead of building a reference to it when the AST has at most
+`getInlineReferenceSize()` nodes (references not followed). Chains of references to tiny ASTs (a flag, an extraction, a copied
+register) are shortened, so unrolling an AST takes fewer hops and fewer expressions stay reachable. An inlined AST does not
+follow a later change of its expression.
+
+- **MODE.LAZY_FLAGS**<br>
+Enabled, Triton will build the flag expressions of arithmetic instructions only when the flags are read. Flags which are
+overwritten before being read never get an expression. Deferred flag expressions are not linked to their instruction.
+
+- **MODE.LEA_ASTS**<br>
+Enabled, the IR builder will build the LEA AST of every memory operand. Otherwise, the address of an operand whose base and
+index registers are not symbolized is computed natively and its `getLeaAst()` is None.
+
+- **MODE.LOOP_SUMMARIES**<br>
+Enabled, the IR builder will build all the iterations of a `rep movs` or a `rep stos` as a single ranged operation when the counter
+and DF are concrete (and, for `movs`, the areas do not overlap), instead of building one iteration per processing. The bytes copied
+keep the symbolic expressions and the taint of their source without creating any node, the counter and the program counter are
+concrete after the instruction, and a symbolized index gets a single expression of its final value. The whole mode with `MODE.MEMORY_ARRAY`
+is processed as usual for these instructions. In `run()` and `emulate()`, a loop whose body only moves full registers by constants or
+by registers it does not write (`add`, `sub`, `inc`, `dec`, `lea reg, [reg + disp]`), and ends with a `cmp reg, imm`, a `test reg, reg`
+or the update of its counter and the conditional branch back, gets all its iterations but the last one at once when the counter is
+concrete: each register gets its value after these iterations, and a symbolized one a single expression of its closed form. The last
+iteration is processed as usual. The other loops are processed as usual.
+
+- **MODE.MBA_SIMPLIFICATION**<br>
+Enabled, Triton will simplify the linear mixed boolean-arithmetic expressions of at most 64 bits and 6 atoms (e.g.
+`(x ^ y) + 2 * (x & y) -> x + y`) before the assignment of a symbolic expression and in `simplify()`, before the Z3
+simplification and the simplification callbacks. See \ref SMT_simplification_page.
+
+- **MODE.MEMORY_ARRAY**<br>
+Enabled, Triton will also record every store into an array of bytes indexed by addresses, and build the loads whose LEA is
+symbolized as `select` nodes on this array instead of concretizing their address. Formulas use the theory of arrays (QF_ABV).
+The cells which have never been stored are unconstrained, use `initMemoryArrayArea()` to copy a concrete area (e.g. a lookup
+table) into the array. The mode must be enabled before processing the instructions.
+
+- **MODE.NATIVE_SEMANTICS**<br>
+Enabled, the IR builder will execute natively the common instructions (`mov`, `lea`, the arithmetic and logic instructions, `push`,
+`pop` and the jumps, calls and returns) whose operands, address registers and flags read are neither symbolized nor tainted. The
+concrete state is updated with native arithmetic and the registers, memory and flags written are concretized and untainted, without
+building any AST or symbolic expression. A branch is only executed natively if the path constraints are not recorded (symbolic engine
+disabled or `MODE.PC_TRACKING_SYMBOLIC` enabled), and the whole mode is ignored with `MODE.MEMORY_ARRAY`. While no symbolic
+variable exists, the other instructions are built with constant leaves and their expressions are removed, as outside the symbolic
+regions (see `addSymbolicRegion()`).
+
+- **MODE.ONLY_LIVE_EXPRESSIONS**<br>
+Enabled, Triton will free the symbolic expressions, and their AST nodes, which are not reachable anymore from registers, memory,
+path constraints or pinned expressions. Instructions processed before a collection must not be inspected afterwards, and the
+expressions you keep must be pinned with `pinSymbolicExpression()`.
+
 - **MODE.ONLY_ON_SYMBOLIZED**<br>
 Enabled, Triton will perform symbolic execution only on symbolized expressions.
 
 - **MODE.ONLY_ON_TAINTED**<br>
 Enabled, Triton will perform symbolic execution only on tainted instructions.
 
+- **MODE.OPCODE_PROFILING**<br>
+Enabled, the IR builder will accumulate for each opcode the number of instructions built, the cycles spent building their semantics,
+the AST nodes allocated and the symbolic expressions emitted. See getOpcodeProfile() and dumpOpcodeProfile().
+
+- **MODE.PERF_COUNTERS**<br>
+Enabled, Triton will sample the hardware performance counters (cycles, instructions, cache misses and branch misses) around the
+disassembly, the semantics, the post IR collection and the solver queries, in user space. They are returned by getStatistics()
+as `perf.<stage>.<counter>` and reset by clearPerfCounters(). Linux only, a counter which cannot be opened (see `perf_event_paranoid`)
+remains 0. The counters are shared by every thread of the process.
+
+- **MODE.PC_DEDUPLICATION**<br>
+Enabled, Triton will not record a path constraint if the same constraint, on the same taken address, is already in the path predicate.
+This keeps the path predicate of loops which check the same condition at each iteration small.
+
 - **MODE.PC_TRACKING_SYMBOLIC**<br>
 Enabled, Triton will track path constraints only if they are symbolized. This mode is enabled by default.
 
+- **MODE.STATE_MERGING**<br>
+Enabled, `run()` merges the two sides of a symbolic conditional branch where they join (e.g. after an if/else diamond), instead of
+following the taken side only. Both sides are first executed speculatively, under the undo journal, for at most `getStateMergingLimit()`
+instructions each. If the other side reaches an address of the taken side within this limit, the taken side goes on until this address,
+where the registers and the bytes stored by either side get an `ite` expression selecting between the two values, and their taint is
+merged. The path constraints recorded since the branch are replaced by the disjunction of the conditions of both sides, each one with
+the symbolized path constraints of its side. This disjunction is not recorded if no side has any. The concrete state remains the one of the taken side. The sides stop at the hooks, the summaries,
+`syscall` and `hlt`, and no branch is merged while a function summary is learned or with `MODE.ONLY_LIVE_EXPRESSIONS`.
+
+- **MODE.TAINT_SUMMARIES**<br>
+Enabled and with the symbolic engine disabled, Triton will only spread the taint of the instructions which have a taint summary
+(moves, arithmetic and logic instructions, comparisons, ...) instead of building their semantics. No AST node is allocated for them,
+but their concrete effects are not computed either: the concrete state must be provided by the caller, e.g. a tracer. The other
+instructions are processed as usual.
+
+- **MODE.TRACE_EVENTS**<br>
+Enabled, Triton will record the spans of the disassembly, the semantics, the post IR processing, the callbacks and the solver
+queries in the Chrome trace-event format. See dumpTraceEvents(). The recorder is shared by every thread of the process.
+
 */
 
 
@@ -56,11 +172,31 @@ namespace triton {
     namespace python {
 
       void initModeNamespace(PyObject* modeDict) {
-        PyDict_SetItemString(modeDict, "ALIGNED_MEMORY",         PyLong_FromUint32(triton::modes::ALIGNED_MEMORY));
-        PyDict_SetItemString(modeDict, "AST_DICTIONARIES",       PyLong_FromUint32(triton::modes::AST_DICTIONARIES));
-        PyDict_SetItemString(modeDict, "ONLY_ON_SYMBOLIZED",     PyLong_FromUint32(triton::modes::ONLY_ON_SYMBOLIZED));
-        PyDict_SetItemString(modeDict, "ONLY_ON_TAINTED",        PyLong_FromUint32(triton::modes::ONLY_ON_TAINTED));
-        PyDict_SetItemString(modeDict, "PC_TRACKING_SYMBOLIC",   PyLong_FromUint32(triton::modes::PC_TRACKING_SYMBOLIC));
+        PyDict_SetItemString(modeDict, "ALIGNED_MEMORY",               PyLong_FromUint32(triton::modes::ALIGNED_MEMORY));
+        PyDict_SetItemString(modeDict, "AST_DICTIONARIES",             PyLong_FromUint32(triton::modes::AST_DICTIONARIES));
+        PyDict_SetItemString(modeDict, "AST_REWRITING",                PyLong_FromUint32(triton::modes::AST_REWRITING));
+        PyDict_SetItemString(modeDict, "CONCRETE_FOLDING",             PyLong_FromUint32(triton::modes::CONCRETE_FOLDING));
+        PyDict_SetItemString(modeDict, "CONCRETIZE_LARGE_EXPRESSIONS", PyLong_FromUint32(triton::modes::CONCRETIZE_LARGE_EXPRESSIONS));
+        PyDict_SetItemString(modeDict, "DECODE_AHEAD",                 PyLong_FromUint32(triton::modes::DECODE_AHEAD));
+        PyDict_SetItemString(modeDict, "EXPRESSION_PROFILING",         PyLong_FromUint32(triton::modes::EXPRESSION_PROFILING));
+        PyDict_SetItemString(modeDict, "HUGE_PAGES",                   PyLong_FromUint32(triton::modes::HUGE_PAGES));
+        PyDict_SetItemString(modeDict, "INLINE_REFERENCES",            PyLong_FromUint32(triton::modes::INLINE_REFERENCES));
+        PyDict_SetItemString(modeDict, "LAZY_FLAGS",                   PyLong_FromUint32(triton::modes::LAZY_FLAGS));
+        PyDict_SetItemString(modeDict, "LEA_ASTS",                     PyLong_FromUint32(triton::modes::LEA_ASTS));
+        PyDict_SetItemString(modeDict, "LOOP_SUMMARIES",               PyLong_FromUint32(triton::modes::LOOP_SUMMARIES));
+        PyDict_SetItemString(modeDict, "MBA_SIMPLIFICATION",           PyLong_FromUint32(triton::modes::MBA_SIMPLIFICATION));
+        PyDict_SetItemString(modeDict, "MEMORY_ARRAY",                 PyLong_FromUint32(triton::modes::MEMORY_ARRAY));
+        PyDict_SetItemString(modeDict, "NATIVE_SEMANTICS",             PyLong_FromUint32(triton::modes::NATIVE_SEMANTICS));
+        PyDict_SetItemString(modeDict, "ONLY_LIVE_EXPRESSIONS",        PyLong_FromUint32(triton::modes::ONLY_LIVE_EXPRESSIONS));
+        PyDict_SetItemString(modeDict, "ONLY_ON_SYMBOLIZED",           PyLong_FromUint32(triton::modes::ONLY_ON_SYMBOLIZED));
+        PyDict_SetItemString(modeDict, "ONLY_ON_TAINTED",              PyLong_FromUint32(triton::modes::ONLY_ON_TAINTED));
+        PyDict_SetItemString(modeDict, "OPCODE_PROFILING",             PyLong_FromUint32(triton::modes::OPCODE_PROFILING));
+        PyDict_SetItemString(modeDict, "PERF_COUNTERS",                PyLong_FromUint32(triton::modes::PERF_COUNTERS));
+        PyDict_SetItemString(modeDict, "PC_DEDUPLICATION",             PyLong_FromUint32(triton::modes::PC_DEDUPLICATION));
+        PyDict_SetItemString(modeDict, "PC_TRACKING_SYMBOLIC",         PyLong_FromUint32(triton::modes::PC_TRACKING_SYMBOLIC));
+        PyDict_SetItemString(modeDict, "STATE_MERGING",                PyLong_FromUint32(triton::modes::STATE_MERGING));
+        PyDict_SetItemString(modeDict, "TAINT_SUMMARIES",              PyLong_FromUint32(triton::modes::TAINT_SUMMARIES));
+        PyDict_SetItemString(modeDict, "TRACE_EVENTS",                 PyLong_FromUint32(triton::modes::TRACE_EVENTS));
       }
 
     }; /* python namespace */
@@ -0,0 +1,57 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#ifdef TRITON_PYTHON_BINDINGS
+
+#include <api.hpp>
+#include <pythonBindings.hpp>
+#include <pythonUtils.hpp>
+
+
+
+/*! \page py_PROFILE_page PROFILE
+    \brief [**python api**] All information about the PROFILE python namespace.
+
+\tableofcontents
+
+\section PROFILE_py_description Description
+<hr>
+
+The PROFILE namespace contains all sets of engines which may be created by setArchitecture(). The API of an
+engine which is not created raises an exception.
+
+\section PROFILE_py_api Python API - Items of the PROFILE namespace
+<hr>
+
+- **PROFILE.DISASSEMBLY**<br>
+Only the modes are created, instructions can be disassembled with `disassembly()` but not processed.
+
+- **PROFILE.EMULATION**<br>
+The engines needed to process instructions, without the solver and the Z3 interface. The symbolic and taint engines start disabled.
+
+- **PROFILE.FULL**<br>
+Every engine.
+
+*/
+
+
+
+namespace triton {
+  namespace bindings {
+    namespace python {
+
+      void initProfileNamespace(PyObject* profileDict) {
+        PyDict_SetItemString(profileDict, "DISASSEMBLY", PyLong_FromUint32(triton::profiles::DISASSEMBLY));
+        PyDict_SetItemString(profileDict, "EMULATION",   PyLong_FromUint32(triton::profiles::EMULATION));
+        PyDict_SetItemString(profileDict, "FULL",        PyLong_FromUint32(triton::profiles::FULL));
+      }
+
+    }; /* python namespace */
+  }; /* bindings namespace */
+}; /* triton namespace */
+
+#endif /* TRITON_PYTHON_BINDINGS */
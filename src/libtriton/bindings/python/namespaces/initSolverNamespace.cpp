@@ -0,0 +1,58 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#ifdef TRITON_PYTHON_BINDINGS
+
+#include <pythonBindings.hpp>
+#include <pythonUtils.hpp>
+#include <solverEnums.hpp>
+
+
+
+/*! \page py_SOLVER_page SOLVER
+    \brief [**python api**] All information about the SOLVER python namespace.
+
+\tableofcontents
+
+\section SOLVER_py_description Description
+<hr>
+
+The SOLVER namespace contains all status of a solver query and the solver backends.
+
+\section SOLVER_py_api Python API - Items of the SOLVER namespace
+<hr>
+
+- **SOLVER.SAT**
+- **SOLVER.UNSAT**
+- **SOLVER.UNKNOWN**
+- **SOLVER.Z3**
+- **SOLVER.BOOLECTOR**
+- **SOLVER.PORTFOLIO**
+
+*/
+
+
+
+namespace triton {
+  namespace bindings {
+    namespace python {
+
+      void initSolverNamespace(PyObject* solverDict) {
+        PyDict_SetItemString(solverDict, "SAT",       PyLong_FromUint32(triton::engines::solver::SAT));
+        PyDict_SetItemString(solverDict, "UNSAT",     PyLong_FromUint32(triton::engines::solver::UNSAT));
+        PyDict_SetItemString(solverDict, "UNKNOWN",   PyLong_FromUint32(triton::engines::solver::UNKNOWN));
+
+        PyDict_SetItemString(solverDict, "Z3",        PyLong_FromUint32(triton::engines::solver::Z3));
+        PyDict_SetItemString(solverDict, "BOOLECTOR", PyLong_FromUint32(triton::engines::solver::BOOLECTOR));
+        PyDict_SetItemString(solverDict, "PORTFOLIO", PyLong_FromUint32(triton::engines::solver::PORTFOLIO));
+      }
+
+    }; /* python namespace */
+  }; /* bindings namespace */
+}; /* triton namespace */
+
+#endif /* TRITON_PYTHON_BINDINGS */
@@ -21,7 +21,8 @@
 \section SYMEXPR_py_description Description
 <hr>
 
-The SYMEXPR namespace contains all kinds and states of a symbolic expression.
+The SYMEXPR namespace contains all kinds and states of a symbolic expression, and the pointer policies of the memory accesses
+whose address is symbolized (see setPointerPolicy()).
 
 \section SYMEXPR_py_api Python API - Items of the SYMEXPR namespace
 <hr>
@@ -30,6 +31,9 @@ The SYMEXPR namespace contains all kinds and states of a symbolic expression.
 - **SYMEXPR.UNDEF**
 - **SYMEXPR.MEM**
 - **SYMEXPR.REG**
+- **SYMEXPR.POINTER_CONCRETE**
+- **SYMEXPR.POINTER_RANGE**
+- **SYMEXPR.POINTER_SOLVER**
 
 */
 
@@ -44,6 +48,9 @@ namespace triton {
         PyDict_SetItemString(symExprDict, "UNDEF",  PyLong_FromUint32(triton::engines::symbolic::UNDEF));
         PyDict_SetItemString(symExprDict, "MEM",    PyLong_FromUint32(triton::engines::symbolic::MEM));
         PyDict_SetItemString(symExprDict, "REG",    PyLong_FromUint32(triton::engines::symbolic::REG));
+        PyDict_SetItemString(symExprDict, "POINTER_CONCRETE", PyLong_FromUint32(triton::engines::symbolic::POINTER_CONCRETE));
+        PyDict_SetItemString(symExprDict, "POINTER_RANGE",    PyLong_FromUint32(triton::engines::symbolic::POINTER_RANGE));
+        PyDict_SetItemString(symExprDict, "POINTER_SOLVER",   PyLong_FromUint32(triton::engines::symbolic::POINTER_SOLVER));
       }
 
     }; /* python namespace */
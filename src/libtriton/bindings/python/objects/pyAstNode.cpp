@@ -7,6 +7,8 @@
 
 #ifdef TRITON_PYTHON_BINDINGS
 
+#include <unordered_map>
+
 #include <ast.hpp>
 #include <exceptions.hpp>
 #include <pythonObjects.hpp>
@@ -55,8 +57,11 @@ e.g: `0xffffffff`
 - <b>integer getBitvectorSize(void)</b><br>
 Returns the node vector size.
 
-- <b>[\ref py_AstNode_page, ...] getChilds(void)</b><br>
-Returns the list of child nodes.
+- <b>\ref py_LazySequence_page getChilds(void)</b><br>
+Returns the sequence of child nodes.
+
+- <b>integer getDepth(void)</b><br>
+Returns the depth of the tree, references unrolled. A leaf has a depth of 1.
 
 - <b>integer getHash(void)</b><br>
 Returns the hash (signature) of the AST .
@@ -65,12 +70,37 @@ Returns the hash (signature) of the AST .
 Returns the kind of the node.<br>
 e.g: `AST_NODE.BVADD`
 
-- <b>[\ref py_AstNode_page, ...] getParents(void)</b><br>
-Returns the parents list nodes. The list is empty if there is still no parent defined.
+- <b>integer getKnownOnes(void)</b><br>
+Returns the bits known to be 1 whatever the values of the symbolic variables. The known bits and the interval of the
+values of a node are computed from the ones of its children while the tree is built, so they are free to read. Nodes
+wider than 64 bits know nothing.
+
+- <b>integer getKnownZeros(void)</b><br>
+Returns the bits known to be 0 whatever the values of the symbolic variables.
+
+- <b>integer getMaximum(void)</b><br>
+Returns the highest unsigned value the tree can take.
+
+- <b>integer getMinimum(void)</b><br>
+Returns the lowest unsigned value the tree can take.
+
+- <b>\ref py_LazySequence_page getParents(void)</b><br>
+Returns the sequence of parent nodes. The sequence is empty if there is still no parent defined.
+
+- <b>integer getUnrolledSize(void)</b><br>
+Returns the number of nodes of the tree once unrolled as by `getFullAst()`, a subtree being counted each time
+it is used. It is maintained while the tree is built, so it is free to read even if the unrolled tree would be huge.
 
 - <b>integer/string getValue(void)</b><br>
 Returns the node value (metadata) as integer or string (it depends of the kind). For example if the kind of node is `decimal`, the value is an integer.
 
+- <b>[integer, ...] getVariables(void)</b><br>
+Returns the ids of the symbolic variables the tree depends on, references unrolled. They are summarized on each node
+while the tree is built, so it is free to read.
+
+- <b>bool isKnown(void)</b><br>
+Returns true if every bit of the node is known, the tree then has the same value whatever the values of the symbolic variables.
+
 - <b>bool isSigned(void)</b><br>
 According to the size of the expression, returns true if the MSB is 1.
 
@@ -114,10 +144,15 @@ namespace triton {
   namespace bindings {
     namespace python {
 
+      /* The living AstNode objects by node. A node is wrapped by one python object at a time */
+      static std::unordered_map<triton::ast::AbstractNode*, PyObject*> astNodeObjects;
+
+
       //! AstNode destructor.
       void AstNode_dealloc(PyObject* self) {
         std::cout << std::flush;
-        Py_DECREF(self);
+        astNodeObjects.erase(PyAstNode_AsAstNode(self));
+        PyObject_Del(self);
       }
 
 
@@ -153,15 +188,17 @@ namespace triton {
 
       static PyObject* AstNode_getChilds(PyObject* self, PyObject* noarg) {
         try {
-          PyObject* childs;
-          triton::ast::AbstractNode* node = PyAstNode_AsAstNode(self);
+          return PyLazySequence(PyAstNode_AsAstNode(self)->getChilds());
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
 
-          triton::usize size = node->getChilds().size();
-          childs = xPyList_New(size);
-          for (triton::usize index = 0; index < size; index++)
-            PyList_SetItem(childs, index, PyAstNode(node->getChilds()[index]));
 
-          return childs;
+      static PyObject* AstNode_getDepth(PyObject* self, PyObject* noarg) {
+        try {
+          return PyLong_FromUint32(PyAstNode_AsAstNode(self)->getDepth());
         }
         catch (const triton::exceptions::Exception& e) {
           return PyErr_Format(PyExc_TypeError, "%s", e.what());
@@ -189,16 +226,60 @@ namespace triton {
       }
 
 
+      static PyObject* AstNode_getKnownOnes(PyObject* self, PyObject* noarg) {
+        try {
+          return PyLong_FromUint64(PyAstNode_AsAstNode(self)->getKnownOnes());
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* AstNode_getKnownZeros(PyObject* self, PyObject* noarg) {
+        try {
+          return PyLong_FromUint64(PyAstNode_AsAstNode(self)->getKnownZeros());
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* AstNode_getMaximum(PyObject* self, PyObject* noarg) {
+        try {
+          return PyLong_FromUint64(PyAstNode_AsAstNode(self)->getMaximum());
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* AstNode_getMinimum(PyObject* self, PyObject* noarg) {
+        try {
+          return PyLong_FromUint64(PyAstNode_AsAstNode(self)->getMinimum());
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
       static PyObject* AstNode_getParents(PyObject* self, PyObject* noarg) {
         try {
-          PyObject* ret = nullptr;
-          std::set<triton::ast::AbstractNode*>& parents = PyAstNode_AsAstNode(self)->getParents();
-          ret = xPyList_New(parents.size());
-          triton::uint32 index = 0;
-          for (std::set<triton::ast::AbstractNode*>::iterator it = parents.begin(); it != parents.end(); it++)
-            PyList_SetItem(ret, index++, PyAstNode(*it));
-          return ret;
-          }
+          return PyLazySequence(PyAstNode_AsAstNode(self)->getParents());
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* AstNode_getUnrolledSize(PyObject* self, PyObject* noarg) {
+        try {
+          return PyLong_FromUint64(PyAstNode_AsAstNode(self)->getUnrolledSize());
+        }
         catch (const triton::exceptions::Exception& e) {
           return PyErr_Format(PyExc_TypeError, "%s", e.what());
         }
@@ -229,6 +310,22 @@ namespace triton {
       }
 
 
+      static PyObject* AstNode_getVariables(PyObject* self, PyObject* noarg) {
+        try {
+          std::vector<triton::usize> ids = triton::ast::VariableSet::getIds(PyAstNode_AsAstNode(self)->getVariables());
+          PyObject* ret = xPyList_New(ids.size());
+
+          for (triton::usize index = 0; index < ids.size(); index++)
+            PyList_SetItem(ret, index, PyLong_FromUsize(ids[index]));
+
+          return ret;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
       static PyObject* AstNode_isSigned(PyObject* self, PyObject* noarg) {
         try {
           if (PyAstNode_AsAstNode(self)->isSigned())
@@ -241,6 +338,18 @@ namespace triton {
       }
 
 
+      static PyObject* AstNode_isKnown(PyObject* self, PyObject* noarg) {
+        try {
+          if (PyAstNode_AsAstNode(self)->isKnown())
+            Py_RETURN_TRUE;
+          Py_RETURN_FALSE;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
       static PyObject* AstNode_isSymbolized(PyObject* self, PyObject* noarg) {
         try {
           if (PyAstNode_AsAstNode(self)->isSymbolized())
@@ -531,10 +640,18 @@ namespace triton {
         {"getBitvectorMask",  AstNode_getBitvectorMask,  METH_NOARGS,     ""},
         {"getBitvectorSize",  AstNode_getBitvectorSize,  METH_NOARGS,     ""},
         {"getChilds",         AstNode_getChilds,         METH_NOARGS,     ""},
+        {"getDepth",          AstNode_getDepth,          METH_NOARGS,     ""},
         {"getHash",           AstNode_getHash,           METH_NOARGS,     ""},
         {"getKind",           AstNode_getKind,           METH_NOARGS,     ""},
+        {"getKnownOnes",      AstNode_getKnownOnes,      METH_NOARGS,     ""},
+        {"getKnownZeros",     AstNode_getKnownZeros,     METH_NOARGS,     ""},
+        {"getMaximum",        AstNode_getMaximum,        METH_NOARGS,     ""},
+        {"getMinimum",        AstNode_getMinimum,        METH_NOARGS,     ""},
         {"getParents",        AstNode_getParents,        METH_NOARGS,     ""},
+        {"getUnrolledSize",   AstNode_getUnrolledSize,   METH_NOARGS,     ""},
         {"getValue",          AstNode_getValue,          METH_NOARGS,     ""},
+        {"getVariables",      AstNode_getVariables,      METH_NOARGS,     ""},
+        {"isKnown",           AstNode_isKnown,           METH_NOARGS,     ""},
         {"isSigned",          AstNode_isSigned,          METH_NOARGS,     ""},
         {"isSymbolized",      AstNode_isSymbolized,      METH_NOARGS,     ""},
         {"setChild",          AstNode_setChild,          METH_VARARGS,    ""},
@@ -646,10 +763,19 @@ namespace triton {
           return Py_None;
         }
 
+        /* The living object of the node is shared */
+        auto it = astNodeObjects.find(node);
+        if (it != astNodeObjects.end()) {
+          Py_INCREF(it->second);
+          return it->second;
+        }
+
         PyType_Ready(&AstNode_Type);
         object = PyObject_NEW(AstNode_Object, &AstNode_Type);
-        if (object != NULL)
+        if (object != NULL) {
           object->node = node;
+          astNodeObjects[node] = (PyObject*)object;
+        }
 
         return (PyObject*)object;
       }
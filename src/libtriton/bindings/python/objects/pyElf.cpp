@@ -101,6 +101,9 @@ Returns the list of program headers.
 - <b>bytes getRaw(void)</b><br>
 Returns the raw binary.
 
+- <b>integer getRelocationAddress(string name)</b><br>
+Returns the address patched by the loader to import the symbol `name` (e.g. its GOT slot). Raises an exception if there is none.
+
 - <b>[\ref py_ElfRelocationTable_page, ...] getRelocationTable(void)</b><br>
 Returns the list of relocations table entries.
 
@@ -114,9 +117,18 @@ e.g: `["libc.so.6", "libncurses.so.5"]`
 - <b>integer getSize(void)</b><br>
 Returns the binary size.
 
+- <b>integer getSymbolAddress(string name)</b><br>
+Returns the address of the symbol `name`. Raises an exception if it is not defined.
+
+- <b>string getSymbolName(integer addr)</b><br>
+Returns the name of the symbol containing the address `addr`, or an empty string if there is none. The lookup is in O(log n).
+
 - <b>[\ref py_ElfSymbolTable_page, ...] getSymbolsTable(void)</b><br>
 Returns the list of symbols table entries.
 
+- <b>bool isSymbolDefined(string name)</b><br>
+Returns true if the symbol `name` is defined.
+
 */
 
 
@@ -219,6 +231,19 @@ namespace triton {
       }
 
 
+      static PyObject* Elf_getRelocationAddress(PyObject* self, PyObject* name) {
+        if (!PyString_Check(name))
+          return PyErr_Format(PyExc_TypeError, "Elf::getRelocationAddress(): Expects a string as argument.");
+
+        try {
+          return PyLong_FromUint64(PyElf_AsElf(self)->getSymbolIndex().getRelocationAddress(PyString_AsString(name)));
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
       static PyObject* Elf_getSectionHeaders(PyObject* self, PyObject* noarg) {
         PyObject* ret = nullptr;
 
@@ -265,6 +290,33 @@ namespace triton {
       }
 
 
+      static PyObject* Elf_getSymbolAddress(PyObject* self, PyObject* name) {
+        if (!PyString_Check(name))
+          return PyErr_Format(PyExc_TypeError, "Elf::getSymbolAddress(): Expects a string as argument.");
+
+        try {
+          return PyLong_FromUint64(PyElf_AsElf(self)->getSymbolIndex().getSymbolAddress(PyString_AsString(name)));
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* Elf_getSymbolName(PyObject* self, PyObject* addr) {
+        if (!PyLong_Check(addr) && !PyInt_Check(addr))
+          return PyErr_Format(PyExc_TypeError, "Elf::getSymbolName(): Expects an integer as argument.");
+
+        try {
+          std::string name = PyElf_AsElf(self)->getSymbolIndex().getSymbolName(PyLong_AsUint64(addr));
+          return xPyString_FromString(name.c_str());
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
       static PyObject* Elf_getSymbolsTable(PyObject* self, PyObject* noarg) {
         PyObject* ret = nullptr;
 
@@ -283,6 +335,21 @@ namespace triton {
       }
 
 
+      static PyObject* Elf_isSymbolDefined(PyObject* self, PyObject* name) {
+        if (!PyString_Check(name))
+          return PyErr_Format(PyExc_TypeError, "Elf::isSymbolDefined(): Expects a string as argument.");
+
+        try {
+          if (PyElf_AsElf(self)->getSymbolIndex().isSymbolDefined(PyString_AsString(name)) == true)
+            Py_RETURN_TRUE;
+          Py_RETURN_FALSE;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
       //! Elf methods.
       PyMethodDef Elf_callbacks[] = {
         {"getDynamicTable",       Elf_getDynamicTable,      METH_NOARGS,     ""},
@@ -290,11 +357,15 @@ namespace triton {
         {"getPath",               Elf_getPath,              METH_NOARGS,     ""},
         {"getProgramHeaders",     Elf_getProgramHeaders,    METH_NOARGS,     ""},
         {"getRaw",                Elf_getRaw,               METH_NOARGS,     ""},
+        {"getRelocationAddress",  Elf_getRelocationAddress, METH_O,          ""},
         {"getRelocationTable",    Elf_getRelocationTable,   METH_NOARGS,     ""},
         {"getSectionHeaders",     Elf_getSectionHeaders,    METH_NOARGS,     ""},
         {"getSharedLibraries",    Elf_getSharedLibraries,   METH_NOARGS,     ""},
         {"getSize",               Elf_getSize,              METH_NOARGS,     ""},
+        {"getSymbolAddress",      Elf_getSymbolAddress,     METH_O,          ""},
+        {"getSymbolName",         Elf_getSymbolName,        METH_O,          ""},
         {"getSymbolsTable",       Elf_getSymbolsTable,      METH_NOARGS,     ""},
+        {"isSymbolDefined",       Elf_isSymbolDefined,      METH_O,          ""},
         {nullptr,                 nullptr,                  0,               nullptr}
       };
 
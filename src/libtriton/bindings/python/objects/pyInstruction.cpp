@@ -138,8 +138,8 @@ Returns the list of all implicit and explicit STORE access as list of tuple <\re
 - <b>\ref py_Immediate_page / \ref py_MemoryAccess_page / \ref py_Register_page getThirdOperand(void)</b><br>
 Returns the third operand of the instruction. The return may be an immediate, a memory or a register.
 
-- <b>[\ref py_SymbolicExpression_page, ...] getSymbolicExpressions(void)</b><br>
-Returns the list of symbolic expressions of the instruction.
+- <b>\ref py_LazySequence_page getSymbolicExpressions(void)</b><br>
+Returns the sequence of symbolic expressions of the instruction.
 
 - <b>integer getThreadId(void)</b><br>
 Returns the thread id of the instruction.
@@ -470,21 +470,7 @@ namespace triton {
 
       static PyObject* Instruction_getSymbolicExpressions(PyObject* self, PyObject* noarg) {
         try {
-          triton::arch::Instruction*  inst;
-          triton::usize               exprSize;
-          PyObject*                   symExprs;
-
-          inst     = PyInstruction_AsInstruction(self);
-          exprSize = inst->symbolicExpressions.size();
-          symExprs = xPyList_New(exprSize);
-
-          for (triton::usize index = 0; index < exprSize; index++) {
-            PyObject* obj = nullptr;
-            obj = PySymbolicExpression(inst->symbolicExpressions[index]);
-            PyList_SetItem(symExprs, index, obj);
-          }
-
-          return symExprs;
+          return PyLazySequence(PyInstruction_AsInstruction(self)->symbolicExpressions);
         }
         catch (const triton::exceptions::Exception& e) {
           return PyErr_Format(PyExc_TypeError, "%s", e.what());
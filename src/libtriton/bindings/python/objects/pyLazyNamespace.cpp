@@ -0,0 +1,174 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#ifdef TRITON_PYTHON_BINDINGS
+
+#include <string>
+
+#include <pythonObjects.hpp>
+#include <pythonXFunctions.hpp>
+
+
+
+/*! \page py_LazyNamespace_page LazyNamespace
+    \brief [**python api**] All information about the LazyNamespace python object.
+
+\tableofcontents
+
+\section py_LazyNamespace_description Description
+<hr>
+
+This object holds the large namespaces of the triton module (`CPUSIZE`, `ELF`, `OPCODE`, `PE`, `PREFIX`, `REG` and `SYSCALL`).
+Their attributes are created the first time one of them is accessed rather than when the module is imported. The
+namespaces which depend on the architecture are emptied by \ref py_triton_page.setArchitecture() and filled again for
+the new architecture on their next access.
+
+~~~~~~~~~~~~~{.py}
+>>> from triton import *
+>>> setArchitecture(ARCH.X86_64)
+>>> print REG
+<LazyNamespace REG>
+
+>>> print REG.RAX
+rax:64 bv[63..0]
+
+>>> 'RAX' in dir(REG)
+True
+~~~~~~~~~~~~~
+
+*/
+
+
+
+namespace triton {
+  namespace bindings {
+    namespace python {
+
+      //! LazyNamespace destructor.
+      void LazyNamespace_dealloc(PyObject* self) {
+        std::cout << std::flush;
+        Py_XDECREF(reinterpret_cast<LazyNamespace_Object*>(self)->name);
+        Py_XDECREF(reinterpret_cast<LazyNamespace_Object*>(self)->dict);
+        PyObject_Del(self);
+      }
+
+
+      /* Fills the attributes if they are not there yet */
+      static void LazyNamespace_populate(LazyNamespace_Object* object) {
+        if (PyDict_Size(object->dict) == 0)
+          object->populate(object->dict);
+      }
+
+
+      static PyObject* LazyNamespace_getattro(PyObject* self, PyObject* name) {
+        LazyNamespace_Object* object = reinterpret_cast<LazyNamespace_Object*>(self);
+
+        LazyNamespace_populate(object);
+
+        PyObject* ret = PyDict_GetItem(object->dict, name);
+        if (ret == nullptr && PyString_Check(name) && std::string(PyString_AsString(name)) == "__dict__")
+          ret = object->dict;
+
+        if (ret != nullptr) {
+          Py_INCREF(ret);
+          return ret;
+        }
+
+        return PyObject_GenericGetAttr(self, name);
+      }
+
+
+      static int LazyNamespace_setattro(PyObject* self, PyObject* name, PyObject* value) {
+        LazyNamespace_Object* object = reinterpret_cast<LazyNamespace_Object*>(self);
+
+        LazyNamespace_populate(object);
+
+        if (value == nullptr)
+          return PyDict_DelItem(object->dict, name);
+
+        return PyDict_SetItem(object->dict, name, value);
+      }
+
+
+      static PyObject* LazyNamespace_str(PyObject* self) {
+        LazyNamespace_Object* object = reinterpret_cast<LazyNamespace_Object*>(self);
+        return PyString_FromFormat("<LazyNamespace %s>", PyString_AsString(object->name));
+      }
+
+
+      PyTypeObject LazyNamespace_Type = {
+        PyObject_HEAD_INIT(&PyType_Type)
+        0,                                          /* ob_size */
+        "LazyNamespace",                            /* tp_name */
+        sizeof(LazyNamespace_Object),               /* tp_basicsize */
+        0,                                          /* tp_itemsize */
+        (destructor)LazyNamespace_dealloc,          /* tp_dealloc */
+        0,                                          /* tp_print */
+        0,                                          /* tp_getattr */
+        0,                                          /* tp_setattr */
+        0,                                          /* tp_compare */
+        (reprfunc)LazyNamespace_str,                /* tp_repr */
+        0,                                          /* tp_as_number */
+        0,                                          /* tp_as_sequence */
+        0,                                          /* tp_as_mapping */
+        0,                                          /* tp_hash */
+        0,                                          /* tp_call */
+        (reprfunc)LazyNamespace_str,                /* tp_str */
+        (getattrofunc)LazyNamespace_getattro,       /* tp_getattro */
+        (setattrofunc)LazyNamespace_setattro,       /* tp_setattro */
+        0,                                          /* tp_as_buffer */
+        Py_TPFLAGS_DEFAULT,                         /* tp_flags */
+        "LazyNamespace objects",                    /* tp_doc */
+        0,                                          /* tp_traverse */
+        0,                                          /* tp_clear */
+        0,                                          /* tp_richcompare */
+        0,                                          /* tp_weaklistoffset */
+        0,                                          /* tp_iter */
+        0,                                          /* tp_iternext */
+        0,                                          /* tp_methods */
+        0,                                          /* tp_members */
+        0,                                          /* tp_getset */
+        0,                                          /* tp_base */
+        0,                                          /* tp_dict */
+        0,                                          /* tp_descr_get */
+        0,                                          /* tp_descr_set */
+        0,                                          /* tp_dictoffset */
+        0,                                          /* tp_init */
+        0,                                          /* tp_alloc */
+        0,                                          /* tp_new */
+        0,                                          /* tp_free */
+        0,                                          /* tp_is_gc */
+        0,                                          /* tp_bases */
+        0,                                          /* tp_mro */
+        0,                                          /* tp_cache */
+        0,                                          /* tp_subclasses */
+        0,                                          /* tp_weaklist */
+        0,                                          /* tp_del */
+        0                                           /* tp_version_tag */
+      };
+
+
+      PyObject* PyLazyNamespace(const char* name, PyObject* dict, void (*populate)(PyObject* dict)) {
+        LazyNamespace_Object* object;
+
+        PyType_Ready(&LazyNamespace_Type);
+        object = PyObject_NEW(LazyNamespace_Object, &LazyNamespace_Type);
+        if (object != NULL) {
+          Py_INCREF(dict);
+          object->name     = xPyString_FromString(name);
+          object->dict     = dict;
+          object->populate = populate;
+        }
+
+        return (PyObject*)object;
+      }
+
+    }; /* python namespace */
+  }; /* bindings namespace */
+}; /* triton namespace */
+
+#endif /* TRITON_PYTHON_BINDINGS */
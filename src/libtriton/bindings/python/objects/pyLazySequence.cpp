@@ -0,0 +1,220 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#ifdef TRITON_PYTHON_BINDINGS
+
+#include <algorithm>
+
+#include <exceptions.hpp>
+#include <pythonObjects.hpp>
+#include <pythonUtils.hpp>
+#include <pythonXFunctions.hpp>
+
+
+
+/*! \page py_LazySequence_page LazySequence
+    \brief [**python api**] All information about the LazySequence python object.
+
+\tableofcontents
+
+\section py_LazySequence_description Description
+<hr>
+
+This object is a read-only sequence returned by \ref py_AstNode_page.getChilds(), \ref py_AstNode_page.getParents() and
+\ref py_Instruction_page.getSymbolicExpressions(). Its items are wrapped into python objects only when they are
+accessed, so walking a large AST does not allocate the python objects of the nodes which are not visited.
+The sequence holds the items as they were when it was returned.
+
+~~~~~~~~~~~~~{.py}
+>>> node = bvadd(bv(1, 8), bvxor(bv(10, 8), bv(20, 8)))
+>>> childs = node.getChilds()
+>>> print len(childs)
+2
+
+>>> print childs[1]
+(bvxor (_ bv10 8) (_ bv20 8))
+
+>>> for child in childs:
+...     print child
+...
+(_ bv1 8)
+(bvxor (_ bv10 8) (_ bv20 8))
+~~~~~~~~~~~~~
+
+\section LazySequence_py_api Python API - Operators of the LazySequence class
+<hr>
+
+- <b>len(sequence)</b><br>
+Returns the number of items.
+
+- <b>sequence[index]</b><br>
+Returns an item. Negative indexes count from the end.
+
+- <b>sequence[start:end]</b><br>
+Returns a list of the items of the range.
+
+- <b>iter(sequence)</b><br>
+Iterates over the items.
+
+*/
+
+
+
+namespace triton {
+  namespace bindings {
+    namespace python {
+
+      //! LazySequence destructor.
+      void LazySequence_dealloc(PyObject* self) {
+        std::cout << std::flush;
+        delete reinterpret_cast<LazySequence_Object*>(self)->getItem;
+        PyObject_Del(self);
+      }
+
+
+      static Py_ssize_t LazySequence_length(PyObject* self) {
+        return static_cast<Py_ssize_t>(reinterpret_cast<LazySequence_Object*>(self)->size);
+      }
+
+
+      static PyObject* LazySequence_item(PyObject* self, Py_ssize_t index) {
+        LazySequence_Object* object = reinterpret_cast<LazySequence_Object*>(self);
+
+        if (index < 0 || static_cast<triton::usize>(index) >= object->size)
+          return PyErr_Format(PyExc_IndexError, "LazySequence index out of range");
+
+        try {
+          return (*object->getItem)(static_cast<triton::usize>(index));
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* LazySequence_slice(PyObject* self, Py_ssize_t low, Py_ssize_t high) {
+        LazySequence_Object* object = reinterpret_cast<LazySequence_Object*>(self);
+        Py_ssize_t size = static_cast<Py_ssize_t>(object->size);
+
+        /* The bounds are clipped like the ones of a list */
+        low  = std::max<Py_ssize_t>(0, std::min(low, size));
+        high = std::max(low, std::min(high, size));
+
+        try {
+          PyObject* ret = xPyList_New(high - low);
+          for (Py_ssize_t index = low; index < high; index++)
+            PyList_SetItem(ret, index - low, (*object->getItem)(static_cast<triton::usize>(index)));
+          return ret;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* LazySequence_str(PyObject* self) {
+        LazySequence_Object* object = reinterpret_cast<LazySequence_Object*>(self);
+        return PyString_FromFormat("<LazySequence of %zd items>", static_cast<Py_ssize_t>(object->size));
+      }
+
+
+      //! LazySequence sequence methods.
+      PySequenceMethods LazySequence_SequenceMethods = {
+        LazySequence_length,                        /* sq_length */
+        0,                                          /* sq_concat */
+        0,                                          /* sq_repeat */
+        LazySequence_item,                          /* sq_item */
+        LazySequence_slice,                         /* sq_slice */
+        0,                                          /* sq_ass_item */
+        0,                                          /* sq_ass_slice */
+        0,                                          /* sq_contains */
+        0,                                          /* sq_inplace_concat */
+        0,                                          /* sq_inplace_repeat */
+      };
+
+
+      PyTypeObject LazySequence_Type = {
+        PyObject_HEAD_INIT(&PyType_Type)
+        0,                                          /* ob_size */
+        "LazySequence",                             /* tp_name */
+        sizeof(LazySequence_Object),                /* tp_basicsize */
+        0,                                          /* tp_itemsize */
+        (destructor)LazySequence_dealloc,           /* tp_dealloc */
+        0,                                          /* tp_print */
+        0,                                          /* tp_getattr */
+        0,                                          /* tp_setattr */
+        0,                                          /* tp_compare */
+        (reprfunc)LazySequence_str,                 /* tp_repr */
+        0,                                          /* tp_as_number */
+        &LazySequence_SequenceMethods,              /* tp_as_sequence */
+        0,                                          /* tp_as_mapping */
+        0,                                          /* tp_hash */
+        0,                                          /* tp_call */
+        (reprfunc)LazySequence_str,                 /* tp_str */
+        0,                                          /* tp_getattro */
+        0,                                          /* tp_setattro */
+        0,                                          /* tp_as_buffer */
+        Py_TPFLAGS_DEFAULT,                         /* tp_flags */
+        "LazySequence objects",                     /* tp_doc */
+        0,                                          /* tp_traverse */
+        0,                                          /* tp_clear */
+        0,                                          /* tp_richcompare */
+        0,                                          /* tp_weaklistoffset */
+        0,                                          /* tp_iter */
+        0,                                          /* tp_iternext */
+        0,                                          /* tp_methods */
+        0,                                          /* tp_members */
+        0,                                          /* tp_getset */
+        0,                                          /* tp_base */
+        0,                                          /* tp_dict */
+        0,                                          /* tp_descr_get */
+        0,                                          /* tp_descr_set */
+        0,                                          /* tp_dictoffset */
+        0,                                          /* tp_init */
+        0,                                          /* tp_alloc */
+        0,                                          /* tp_new */
+        0,                                          /* tp_free */
+        0,                                          /* tp_is_gc */
+        0,                                          /* tp_bases */
+        0,                                          /* tp_mro */
+        0,                                          /* tp_cache */
+        0,                                          /* tp_subclasses */
+        0,                                          /* tp_weaklist */
+        0,                                          /* tp_del */
+        0                                           /* tp_version_tag */
+      };
+
+
+      /* Creates a sequence of `size` items, wrapped by `getItem` when they are accessed */
+      static PyObject* PyLazySequence(triton::usize size, const std::function<PyObject*(triton::usize)>& getItem) {
+        LazySequence_Object* object;
+
+        PyType_Ready(&LazySequence_Type);
+        object = PyObject_NEW(LazySequence_Object, &LazySequence_Type);
+        if (object != NULL) {
+          object->size    = size;
+          object->getItem = new std::function<PyObject*(triton::usize)>(getItem);
+        }
+
+        return (PyObject*)object;
+      }
+
+
+      PyObject* PyLazySequence(const std::vector<triton::ast::AbstractNode*>& nodes) {
+        return PyLazySequence(nodes.size(), [nodes](triton::usize index) { return PyAstNode(nodes[index]); });
+      }
+
+
+      PyObject* PyLazySequence(const std::vector<triton::engines::symbolic::SymbolicExpression*>& exprs) {
+        return PyLazySequence(exprs.size(), [exprs](triton::usize index) { return PySymbolicExpression(exprs[index]); });
+      }
+
+    }; /* python namespace */
+  }; /* bindings namespace */
+}; /* triton namespace */
+
+#endif /* TRITON_PYTHON_BINDINGS */
@@ -28,6 +28,7 @@ This object is used to represent a memory access.
 \subsection py_MemoryAccess_example Example
 
 ~~~~~~~~~~~~~{.py}
+>>> enableMode(MODE.LEA_ASTS, True)
 >>> processing(inst)
 >>> print inst
 40000: mov ah, byte ptr [rdx + rcx*2 + 0x100]
@@ -107,7 +108,8 @@ Returns the displacement (if exists) of the memory access.
 Returns the index register (if exists) of the memory access.<br>
 
 - <b>\ref py_AstNode_page getLeaAst(void)</b><br>
-Returns the AST of the memory access (LEA).
+Returns the AST of the memory access (LEA). None if its base and index registers are not symbolized, unless `MODE.LEA_ASTS`
+is enabled.
 
 - <b>\ref py_Immediate_page getScale(void)</b><br>
 Returns the scale (if exists) of the  memory access.
@@ -100,6 +100,9 @@ e.g: `C:/Windows/System32/notepad.exe`
 - <b>bytes getRaw(void)</b><br>
 Returns the raw binary.
 
+- <b>integer getRelocationAddress(string name)</b><br>
+Returns the address (RVA) of the import address table entry of the imported function `name`. Raises an exception if there is none.
+
 - <b>[\ref py_PeSectionHeader_page, ...] getSectionHeaders(void)</b><br>
 Returns the list of section headers.
 
@@ -110,6 +113,15 @@ e.g: `["ADVAPI32.dll", "KERNEL32.dll", "GDI32.dll", ...]`
 - <b>integer getSize(void)</b><br>
 Returns the binary size.
 
+- <b>integer getSymbolAddress(string name)</b><br>
+Returns the address (RVA) of the exported function `name`. Raises an exception if it is not exported.
+
+- <b>string getSymbolName(integer addr)</b><br>
+Returns the name of the exported function at the address (RVA) `addr`, or an empty string if there is none. The lookup is in O(log n).
+
+- <b>bool isSymbolDefined(string name)</b><br>
+Returns true if the function `name` is exported.
+
 */
 
 
@@ -232,6 +244,61 @@ namespace triton {
       }
 
 
+      static PyObject* Pe_getRelocationAddress(PyObject* self, PyObject* name) {
+        if (!PyString_Check(name))
+          return PyErr_Format(PyExc_TypeError, "Pe::getRelocationAddress(): Expects a string as argument.");
+
+        try {
+          return PyLong_FromUint64(PyPe_AsPe(self)->getSymbolIndex().getRelocationAddress(PyString_AsString(name)));
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* Pe_getSymbolAddress(PyObject* self, PyObject* name) {
+        if (!PyString_Check(name))
+          return PyErr_Format(PyExc_TypeError, "Pe::getSymbolAddress(): Expects a string as argument.");
+
+        try {
+          return PyLong_FromUint64(PyPe_AsPe(self)->getSymbolIndex().getSymbolAddress(PyString_AsString(name)));
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* Pe_getSymbolName(PyObject* self, PyObject* addr) {
+        if (!PyLong_Check(addr) && !PyInt_Check(addr))
+          return PyErr_Format(PyExc_TypeError, "Pe::getSymbolName(): Expects an integer as argument.");
+
+        try {
+          std::string name = PyPe_AsPe(self)->getSymbolIndex().getSymbolName(PyLong_AsUint64(addr));
+          return xPyString_FromString(name.c_str());
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
+      static PyObject* Pe_isSymbolDefined(PyObject* self, PyObject* name) {
+        if (!PyString_Check(name))
+          return PyErr_Format(PyExc_TypeError, "Pe::isSymbolDefined(): Expects a string as argument.");
+
+        try {
+          if (PyPe_AsPe(self)->getSymbolIndex().isSymbolDefined(PyString_AsString(name)) == true)
+            Py_RETURN_TRUE;
+          Py_RETURN_FALSE;
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
       //! Pe methods.
       PyMethodDef Pe_callbacks[] = {
         {"getExportTable",        Pe_getExportTable,       METH_NOARGS,     ""},
@@ -239,9 +306,13 @@ namespace triton {
         {"getImportTable",        Pe_getImportTable,       METH_NOARGS,     ""},
         {"getPath",               Pe_getPath,              METH_NOARGS,     ""},
         {"getRaw",                Pe_getRaw,               METH_NOARGS,     ""},
+        {"getRelocationAddress",  Pe_getRelocationAddress, METH_O,          ""},
         {"getSectionHeaders",     Pe_getSectionHeaders,    METH_NOARGS,     ""},
         {"getSharedLibraries",    Pe_getSharedLibraries,   METH_NOARGS,     ""},
         {"getSize",               Pe_getSize,              METH_NOARGS,     ""},
+        {"getSymbolAddress",      Pe_getSymbolAddress,     METH_O,          ""},
+        {"getSymbolName",         Pe_getSymbolName,        METH_O,          ""},
+        {"isSymbolDefined",       Pe_isSymbolDefined,      METH_O,          ""},
         {nullptr,                 nullptr,                  0,              nullptr}
       };
 
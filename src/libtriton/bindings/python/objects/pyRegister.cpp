@@ -7,6 +7,8 @@
 
 #ifdef TRITON_PYTHON_BINDINGS
 
+#include <map>
+
 #include <exceptions.hpp>
 #include <pythonObjects.hpp>
 #include <pythonUtils.hpp>
@@ -85,7 +87,7 @@ Returns the name of the register.<br>
 e.g: `rbx`
 
 - <b>\ref py_Register_page getParent(void)</b><br>
-Returns the parent register.
+Returns the parent register. The register returned is immutable and shared by the calls.
 
 - <b>integer getSize(void)</b><br>
 Returns the size (in bytes) of the register.<br>
@@ -167,8 +169,7 @@ namespace triton {
 
       static PyObject* Register_getParent(PyObject* self, PyObject* noarg) {
         try {
-          triton::arch::Register parent = PyRegister_AsRegister(self)->getParent();
-          return PyRegister(parent);
+          return PyRegisterSingleton(PyRegister_AsRegister(self)->getParent().getId());
         }
         catch (const triton::exceptions::Exception& e) {
           return PyErr_Format(PyExc_TypeError, "%s", e.what());
@@ -430,6 +431,33 @@ namespace triton {
         return (PyObject*)object;
       }
 
+
+      /* The immutable registers returned by the bindings, by id */
+      static std::map<triton::uint32, PyObject*> registerSingletons;
+
+
+      PyObject* PyRegisterSingleton(triton::uint32 regId) {
+        PyObject*& object = registerSingletons[regId];
+
+        if (object == nullptr) {
+          object = PyRegister(triton::arch::Register(regId), 0, triton::arch::IMMUTABLE_REGISTER);
+          if (object == nullptr) {
+            registerSingletons.erase(regId);
+            return nullptr;
+          }
+        }
+
+        Py_INCREF(object);
+        return object;
+      }
+
+
+      void clearRegisterSingletons(void) {
+        for (auto it = registerSingletons.begin(); it != registerSingletons.end(); it++)
+          Py_DECREF(it->second);
+        registerSingletons.clear();
+      }
+
     }; /* python namespace */
   }; /* bindings namespace */
 }; /* triton namespace */
@@ -7,6 +7,8 @@
 
 #ifdef TRITON_PYTHON_BINDINGS
 
+#include <unordered_map>
+
 #include <exceptions.hpp>
 #include <pythonObjects.hpp>
 #include <pythonUtils.hpp>
@@ -88,6 +90,9 @@ Returns the AST root node of the symbolic expression.
 - <b>string getComment(void)</b><br>
 Returns the comment (if exists) of the symbolic expression.
 
+- <b>integer getDepth(void)</b><br>
+Returns the depth of the expression, references unrolled.
+
 - <b>integer getId(void)</b><br>
 Returns the if of the symbolic expression. This id is always unique.<br>
 e.g: `2387`
@@ -105,6 +110,9 @@ Returns the origin memory access if `isMemory()` is equal to `True`, invalid mem
 - <b>\ref py_Register_page getOriginRegister(void)</b><br>
 Returns the origin register if `isRegister()` is equal `True`, `REG.INVALID` otherwise. This register represents the target assignment.
 
+- <b>integer getUnrolledSize(void)</b><br>
+Returns the number of nodes of the expression once unrolled. It is maintained while the expression is built, so it is free to read.
+
 - <b>bool isMemory(void)</b><br>
 Returns true if the expression is assigned to a memory.
 
@@ -131,10 +139,15 @@ namespace triton {
   namespace bindings {
     namespace python {
 
+      /* The living SymbolicExpression objects by expression. An expression is wrapped by one python object at a time */
+      static std::unordered_map<triton::engines::symbolic::SymbolicExpression*, PyObject*> symbolicExpressionObjects;
+
+
       //! SymbolicExpression destructor.
       void SymbolicExpression_dealloc(PyObject* self) {
         std::cout << std::flush;
-        Py_DECREF(self);
+        symbolicExpressionObjects.erase(PySymbolicExpression_AsSymbolicExpression(self));
+        PyObject_Del(self);
       }
 
 
@@ -158,6 +171,16 @@ namespace triton {
       }
 
 
+      static PyObject* SymbolicExpression_getDepth(PyObject* self, PyObject* noarg) {
+        try {
+          return PyLong_FromUint32(PySymbolicExpression_AsSymbolicExpression(self)->getDepth());
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
       static PyObject* SymbolicExpression_getId(PyObject* self, PyObject* noarg) {
         try {
           return PyLong_FromUsize(PySymbolicExpression_AsSymbolicExpression(self)->getId());
@@ -208,6 +231,16 @@ namespace triton {
       }
 
 
+      static PyObject* SymbolicExpression_getUnrolledSize(PyObject* self, PyObject* noarg) {
+        try {
+          return PyLong_FromUint64(PySymbolicExpression_AsSymbolicExpression(self)->getUnrolledSize());
+        }
+        catch (const triton::exceptions::Exception& e) {
+          return PyErr_Format(PyExc_TypeError, "%s", e.what());
+        }
+      }
+
+
       static PyObject* SymbolicExpression_isMemory(PyObject* self, PyObject* noarg) {
         try {
           if (PySymbolicExpression_AsSymbolicExpression(self)->isMemory() == true)
@@ -306,11 +339,13 @@ namespace triton {
       PyMethodDef SymbolicExpression_callbacks[] = {
         {"getAst",            SymbolicExpression_getAst,            METH_NOARGS,    ""},
         {"getComment",        SymbolicExpression_getComment,        METH_NOARGS,    ""},
+        {"getDepth",          SymbolicExpression_getDepth,          METH_NOARGS,    ""},
         {"getId",             SymbolicExpression_getId,             METH_NOARGS,    ""},
         {"getKind",           SymbolicExpression_getKind,           METH_NOARGS,    ""},
         {"getNewAst",         SymbolicExpression_getNewAst,         METH_NOARGS,    ""},
         {"getOriginMemory",   SymbolicExpression_getOriginMemory,   METH_NOARGS,    ""},
         {"getOriginRegister", SymbolicExpression_getOriginRegister, METH_NOARGS,    ""},
+        {"getUnrolledSize",   SymbolicExpression_getUnrolledSize,   METH_NOARGS,    ""},
         {"isMemory",          SymbolicExpression_isMemory,          METH_NOARGS,    ""},
         {"isRegister",        SymbolicExpression_isRegister,        METH_NOARGS,    ""},
         {"isSymbolized",      SymbolicExpression_isSymbolized,      METH_NOARGS,    ""},
@@ -381,10 +416,19 @@ namespace triton {
           return Py_None;
         }
 
+        /* The living object of the expression is shared */
+        auto it = symbolicExpressionObjects.find(symExpr);
+        if (it != symbolicExpressionObjects.end()) {
+          Py_INCREF(it->second);
+          return it->second;
+        }
+
         PyType_Ready(&SymbolicExpression_Type);
         object = PyObject_NEW(SymbolicExpression_Object, &SymbolicExpression_Type);
-        if (object != NULL)
+        if (object != NULL) {
           object->symExpr = symExpr;
+          symbolicExpressionObjects[symExpr] = (PyObject*)object;
+        }
 
         return (PyObject*)object;
       }
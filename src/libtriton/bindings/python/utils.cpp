@@ -407,6 +407,19 @@ namespace triton {
         return (PyObject*)v;
       }
 
+
+      void PyArgs_Unpack(PyObject* args, PyObject** op1, PyObject** op2, PyObject** op3) {
+        PyObject** ops[] = {op1, op2, op3};
+        Py_ssize_t count = (op3 != nullptr ? 3 : 2);
+        Py_ssize_t size  = PyTuple_GET_SIZE(args);
+
+        if (size > count)
+          return;
+
+        for (Py_ssize_t index = 0; index < size; index++)
+          *ops[index] = PyTuple_GET_ITEM(args, index);
+      }
+
     }; /* python namespace */
   }; /* bindings namespace */
 }; /* triton namespace */
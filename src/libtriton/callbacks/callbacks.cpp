@@ -5,8 +5,12 @@
 **  This program is under the terms of the BSD License.
 */
 
+#include <algorithm>
+#include <cstring>
+
 #include <callbacks.hpp>
 #include <exceptions.hpp>
+#include <traceEvents.hpp>
 
 #ifdef TRITON_PYTHON_BINDINGS
   #include <pythonObjects.hpp>
@@ -21,19 +25,32 @@ namespace triton {
 
     Callbacks::Callbacks() {
       this->isDefined = false;
+      this->revision  = 0;
+      this->kinds     = 0;
     }
 
 
     Callbacks::Callbacks(const Callbacks& copy) {
       #ifdef TRITON_PYTHON_BINDINGS
-      this->pyGetConcreteMemoryValueCallbacks   = copy.pyGetConcreteMemoryValueCallbacks;
-      this->pyGetConcreteRegisterValueCallbacks = copy.pyGetConcreteRegisterValueCallbacks;
-      this->pySymbolicSimplificationCallbacks   = copy.pySymbolicSimplificationCallbacks;
+      this->pyGetConcreteMemoryValueCallbacks      = copy.pyGetConcreteMemoryValueCallbacks;
+      this->pyGetConcreteMemoryAreaValueCallbacks  = copy.pyGetConcreteMemoryAreaValueCallbacks;
+      this->pyGetConcreteRegisterValueCallbacks    = copy.pyGetConcreteRegisterValueCallbacks;
+      this->pySymbolicSimplificationCallbacks      = copy.pySymbolicSimplificationCallbacks;
+      this->pyMemoryLimitCallbacks                 = copy.pyMemoryLimitCallbacks;
+      this->pyExpressionLimitCallbacks             = copy.pyExpressionLimitCallbacks;
+      this->pyMemoryMissCallbacks                  = copy.pyMemoryMissCallbacks;
+      this->pyBatchedCallbacks                     = copy.pyBatchedCallbacks;
       #endif
-      this->getConcreteMemoryValueCallbacks     = copy.getConcreteMemoryValueCallbacks;
-      this->getConcreteRegisterValueCallbacks   = copy.getConcreteRegisterValueCallbacks;
-      this->symbolicSimplificationCallbacks     = copy.symbolicSimplificationCallbacks;
-      this->isDefined                           = copy.isDefined;
+      this->getConcreteMemoryValueCallbacks        = copy.getConcreteMemoryValueCallbacks;
+      this->getConcreteMemoryAreaValueCallbacks    = copy.getConcreteMemoryAreaValueCallbacks;
+      this->getConcreteRegisterValueCallbacks      = copy.getConcreteRegisterValueCallbacks;
+      this->symbolicSimplificationCallbacks        = copy.symbolicSimplificationCallbacks;
+      this->memoryLimitCallbacks                   = copy.memoryLimitCallbacks;
+      this->expressionLimitCallbacks               = copy.expressionLimitCallbacks;
+      this->memoryMissCallbacks                    = copy.memoryMissCallbacks;
+      this->isDefined                              = copy.isDefined;
+      this->revision                               = copy.revision;
+      this->kinds                                  = copy.kinds;
     }
 
 
@@ -43,32 +60,74 @@ namespace triton {
 
     void Callbacks::operator=(const Callbacks& copy) {
       #ifdef TRITON_PYTHON_BINDINGS
-      this->pyGetConcreteMemoryValueCallbacks   = copy.pyGetConcreteMemoryValueCallbacks;
-      this->pyGetConcreteRegisterValueCallbacks = copy.pyGetConcreteRegisterValueCallbacks;
-      this->pySymbolicSimplificationCallbacks   = copy.pySymbolicSimplificationCallbacks;
+      this->pyGetConcreteMemoryValueCallbacks      = copy.pyGetConcreteMemoryValueCallbacks;
+      this->pyGetConcreteMemoryAreaValueCallbacks  = copy.pyGetConcreteMemoryAreaValueCallbacks;
+      this->pyGetConcreteRegisterValueCallbacks    = copy.pyGetConcreteRegisterValueCallbacks;
+      this->pySymbolicSimplificationCallbacks      = copy.pySymbolicSimplificationCallbacks;
+      this->pyMemoryLimitCallbacks                 = copy.pyMemoryLimitCallbacks;
+      this->pyExpressionLimitCallbacks             = copy.pyExpressionLimitCallbacks;
+      this->pyMemoryMissCallbacks                  = copy.pyMemoryMissCallbacks;
+      this->pyBatchedCallbacks                     = copy.pyBatchedCallbacks;
       #endif
-      this->getConcreteMemoryValueCallbacks     = copy.getConcreteMemoryValueCallbacks;
-      this->getConcreteRegisterValueCallbacks   = copy.getConcreteRegisterValueCallbacks;
-      this->symbolicSimplificationCallbacks     = copy.symbolicSimplificationCallbacks;
-      this->isDefined                           = copy.isDefined;
+      this->getConcreteMemoryValueCallbacks        = copy.getConcreteMemoryValueCallbacks;
+      this->getConcreteMemoryAreaValueCallbacks    = copy.getConcreteMemoryAreaValueCallbacks;
+      this->getConcreteRegisterValueCallbacks      = copy.getConcreteRegisterValueCallbacks;
+      this->symbolicSimplificationCallbacks        = copy.symbolicSimplificationCallbacks;
+      this->memoryLimitCallbacks                   = copy.memoryLimitCallbacks;
+      this->expressionLimitCallbacks               = copy.expressionLimitCallbacks;
+      this->memoryMissCallbacks                    = copy.memoryMissCallbacks;
+      this->isDefined                              = copy.isDefined;
+      this->revision                               = copy.revision;
+      this->kinds                                  = copy.kinds;
     }
 
 
     void Callbacks::addCallback(triton::callbacks::getConcreteMemoryValueCallback cb) {
       this->getConcreteMemoryValueCallbacks.push_back(cb);
-      this->isDefined = true;
+      this->updateKinds();
+      this->revision++;
+    }
+
+
+    void Callbacks::addCallback(triton::callbacks::getConcreteMemoryAreaValueCallback cb) {
+      this->getConcreteMemoryAreaValueCallbacks.push_back(cb);
+      this->updateKinds();
+      this->revision++;
     }
 
 
     void Callbacks::addCallback(triton::callbacks::getConcreteRegisterValueCallback cb) {
       this->getConcreteRegisterValueCallbacks.push_back(cb);
-      this->isDefined = true;
+      this->updateKinds();
+      this->revision++;
     }
 
 
     void Callbacks::addCallback(triton::callbacks::symbolicSimplificationCallback cb) {
       this->symbolicSimplificationCallbacks.push_back(cb);
-      this->isDefined = true;
+      this->updateKinds();
+      this->revision++;
+    }
+
+
+    void Callbacks::addCallback(triton::callbacks::memoryLimitCallback cb) {
+      this->memoryLimitCallbacks.push_back(cb);
+      this->updateKinds();
+      this->revision++;
+    }
+
+
+    void Callbacks::addCallback(triton::callbacks::expressionLimitCallback cb) {
+      this->expressionLimitCallbacks.push_back(cb);
+      this->updateKinds();
+      this->revision++;
+    }
+
+
+    void Callbacks::addCallback(triton::callbacks::memoryMissCallback cb) {
+      this->memoryMissCallbacks.push_back(cb);
+      this->updateKinds();
+      this->revision++;
     }
 
 
@@ -78,78 +137,312 @@ namespace triton {
         case GET_CONCRETE_MEMORY_VALUE:
           this->pyGetConcreteMemoryValueCallbacks.push_back(function);
           break;
+        case GET_CONCRETE_MEMORY_AREA_VALUE:
+          this->pyGetConcreteMemoryAreaValueCallbacks.push_back(function);
+          break;
         case GET_CONCRETE_REGISTER_VALUE:
           this->pyGetConcreteRegisterValueCallbacks.push_back(function);
           break;
         case SYMBOLIC_SIMPLIFICATION:
           this->pySymbolicSimplificationCallbacks.push_back(function);
           break;
+        case MEMORY_LIMIT:
+          this->pyMemoryLimitCallbacks.push_back(function);
+          break;
+        case EXPRESSION_LIMIT:
+          this->pyExpressionLimitCallbacks.push_back(function);
+          break;
+        case MEMORY_MISS:
+          this->pyMemoryMissCallbacks.push_back(function);
+          break;
         default:
           throw triton::exceptions::Callbacks("Callbacks::addCallback(): Invalid kind of callback.");
       };
-      this->isDefined = true;
+      this->updateKinds();
+      this->revision++;
+    }
+
+
+    void Callbacks::addBatchedCallback(PyObject* function, triton::callbacks::callback_e kind, triton::usize size) {
+      triton::callbacks::PyBatchedCallback cb;
+
+      switch (kind) {
+        case GET_CONCRETE_MEMORY_VALUE:
+        case GET_CONCRETE_MEMORY_AREA_VALUE:
+        case GET_CONCRETE_REGISTER_VALUE:
+          break;
+        case SYMBOLIC_SIMPLIFICATION:
+          throw triton::exceptions::Callbacks("Callbacks::addBatchedCallback(): SYMBOLIC_SIMPLIFICATION callbacks must return a node and cannot be batched.");
+        case MEMORY_LIMIT:
+          throw triton::exceptions::Callbacks("Callbacks::addBatchedCallback(): MEMORY_LIMIT callbacks must free memory at once and cannot be batched.");
+        case EXPRESSION_LIMIT:
+          throw triton::exceptions::Callbacks("Callbacks::addBatchedCallback(): EXPRESSION_LIMIT callbacks must act before the next instruction and cannot be batched.");
+        case MEMORY_MISS:
+          throw triton::exceptions::Callbacks("Callbacks::addBatchedCallback(): MEMORY_MISS callbacks must return the page and cannot be batched.");
+        default:
+          throw triton::exceptions::Callbacks("Callbacks::addBatchedCallback(): Invalid kind of callback.");
+      };
+
+      if (size == 0)
+        throw triton::exceptions::Callbacks("Callbacks::addBatchedCallback(): The size of a batch cannot be null.");
+
+      cb.function = function;
+      cb.kind     = kind;
+      cb.size     = size;
+      this->pyBatchedCallbacks.push_back(cb);
+
+      this->updateKinds();
+      this->revision++;
+    }
+
+
+    void Callbacks::flushBatchedCallback(triton::callbacks::PyBatchedCallback& cb) const {
+      if (cb.events.empty())
+        return;
+
+      /* Build the list of events, the buffer keeps its capacity for the next batch */
+      PyObject* events = triton::bindings::python::xPyList_New(cb.events.size());
+      for (triton::usize index = 0; index < cb.events.size(); index++) {
+        if (cb.kind == triton::callbacks::GET_CONCRETE_REGISTER_VALUE) {
+          PyList_SetItem(events, index, triton::bindings::python::PyRegister(triton::arch::Register(static_cast<triton::uint32>(cb.events[index].first))));
+        }
+        else {
+          PyObject* event = triton::bindings::python::xPyTuple_New(2);
+          PyTuple_SetItem(event, 0, triton::bindings::python::PyLong_FromUint64(cb.events[index].first));
+          PyTuple_SetItem(event, 1, triton::bindings::python::PyLong_FromUint64(cb.events[index].second));
+          PyList_SetItem(events, index, event);
+        }
+      }
+      cb.events.clear();
+
+      /* Create function args */
+      PyObject* args = triton::bindings::python::xPyTuple_New(1);
+      PyTuple_SetItem(args, 0, events);
+
+      /* Call the callback */
+      PyObject* ret = PyObject_CallObject(cb.function, args);
+
+      /* Check the call */
+      if (ret == nullptr) {
+        PyErr_Print();
+        throw triton::exceptions::Callbacks("Callbacks::flushBatchedCallback(): Fail to call the python callback.");
+      }
+
+      Py_DECREF(ret);
+      Py_DECREF(args);
+    }
+
+
+    void Callbacks::recordBatchedEvent(triton::callbacks::callback_e kind, triton::uint64 first, triton::uint64 second) const {
+      for (auto it = this->pyBatchedCallbacks.begin(); it != this->pyBatchedCallbacks.end(); it++) {
+        if (it->kind != kind)
+          continue;
+        it->events.push_back(std::make_pair(first, second));
+        if (it->events.size() >= it->size)
+          this->flushBatchedCallback(*it);
+      }
+    }
+
+
+    void Callbacks::flushCallbacks(void) const {
+      for (auto it = this->pyBatchedCallbacks.begin(); it != this->pyBatchedCallbacks.end(); it++)
+        this->flushBatchedCallback(*it);
+    }
+
+
+    bool Callbacks::isBatchedCallbackDefined(void) const {
+      return !this->pyBatchedCallbacks.empty();
+    }
+
+
+    bool Callbacks::isPythonCallbackDefined(void) const {
+      return !this->pyBatchedCallbacks.empty() ||
+             !this->pyGetConcreteMemoryValueCallbacks.empty() ||
+             !this->pyGetConcreteMemoryAreaValueCallbacks.empty() ||
+             !this->pyGetConcreteRegisterValueCallbacks.empty() ||
+             !this->pySymbolicSimplificationCallbacks.empty() ||
+             !this->pyMemoryLimitCallbacks.empty() ||
+             !this->pyExpressionLimitCallbacks.empty() ||
+             !this->pyMemoryMissCallbacks.empty();
     }
     #endif
 
 
     void Callbacks::removeAllCallbacks(void) {
       this->getConcreteMemoryValueCallbacks.clear();
+      this->getConcreteMemoryAreaValueCallbacks.clear();
       this->getConcreteRegisterValueCallbacks.clear();
       this->symbolicSimplificationCallbacks.clear();
+      this->memoryLimitCallbacks.clear();
+      this->expressionLimitCallbacks.clear();
+      this->memoryMissCallbacks.clear();
       #ifdef TRITON_PYTHON_BINDINGS
       this->pyGetConcreteMemoryValueCallbacks.clear();
+      this->pyGetConcreteMemoryAreaValueCallbacks.clear();
       this->pyGetConcreteRegisterValueCallbacks.clear();
       this->pySymbolicSimplificationCallbacks.clear();
+      this->pyMemoryLimitCallbacks.clear();
+      this->pyExpressionLimitCallbacks.clear();
+      this->pyMemoryMissCallbacks.clear();
+      this->pyBatchedCallbacks.clear();
       #endif
+      this->updateKinds();
+      this->revision++;
     }
 
 
     void Callbacks::removeCallback(triton::callbacks::getConcreteMemoryValueCallback cb) {
       this->getConcreteMemoryValueCallbacks.remove(cb);
-      if (this->countCallbacks() == 0)
-        this->isDefined = false;
+      this->updateKinds();
+      this->revision++;
+    }
+
+
+    void Callbacks::removeCallback(triton::callbacks::getConcreteMemoryAreaValueCallback cb) {
+      this->getConcreteMemoryAreaValueCallbacks.remove(cb);
+      this->updateKinds();
+      this->revision++;
     }
 
 
     void Callbacks::removeCallback(triton::callbacks::getConcreteRegisterValueCallback cb) {
       this->getConcreteRegisterValueCallbacks.remove(cb);
-      if (this->countCallbacks() == 0)
-        this->isDefined = false;
+      this->updateKinds();
+      this->revision++;
     }
 
 
     void Callbacks::removeCallback(triton::callbacks::symbolicSimplificationCallback cb) {
       this->symbolicSimplificationCallbacks.remove(cb);
-      if (this->countCallbacks() == 0)
-        this->isDefined = false;
+      this->updateKinds();
+      this->revision++;
+    }
+
+
+    void Callbacks::removeCallback(triton::callbacks::memoryLimitCallback cb) {
+      this->memoryLimitCallbacks.remove(cb);
+      this->updateKinds();
+      this->revision++;
+    }
+
+
+    void Callbacks::removeCallback(triton::callbacks::expressionLimitCallback cb) {
+      this->expressionLimitCallbacks.remove(cb);
+      this->updateKinds();
+      this->revision++;
+    }
+
+
+    void Callbacks::removeCallback(triton::callbacks::memoryMissCallback cb) {
+      this->memoryMissCallbacks.remove(cb);
+      this->updateKinds();
+      this->revision++;
     }
 
 
     #ifdef TRITON_PYTHON_BINDINGS
     void Callbacks::removeCallback(PyObject* function, triton::callbacks::callback_e kind) {
+      for (auto it = this->pyBatchedCallbacks.begin(); it != this->pyBatchedCallbacks.end();) {
+        if (it->function == function && it->kind == kind) {
+          this->flushBatchedCallback(*it);
+          it = this->pyBatchedCallbacks.erase(it);
+        }
+        else
+          it++;
+      }
+
       switch (kind) {
         case GET_CONCRETE_MEMORY_VALUE:
           this->pyGetConcreteMemoryValueCallbacks.remove(function);
           break;
+        case GET_CONCRETE_MEMORY_AREA_VALUE:
+          this->pyGetConcreteMemoryAreaValueCallbacks.remove(function);
+          break;
         case GET_CONCRETE_REGISTER_VALUE:
           this->pyGetConcreteRegisterValueCallbacks.remove(function);
           break;
         case SYMBOLIC_SIMPLIFICATION:
           this->pySymbolicSimplificationCallbacks.remove(function);
           break;
+        case MEMORY_LIMIT:
+          this->pyMemoryLimitCallbacks.remove(function);
+          break;
+        case EXPRESSION_LIMIT:
+          this->pyExpressionLimitCallbacks.remove(function);
+          break;
+        case MEMORY_MISS:
+          this->pyMemoryMissCallbacks.remove(function);
+          break;
         default:
           throw triton::exceptions::Callbacks("Callbacks::removeCallback(): Invalid kind of callback.");
       };
 
-      if (this->countCallbacks() == 0)
-        this->isDefined = false;
+      this->updateKinds();
+      this->revision++;
     }
     #endif
 
 
+    triton::usize Callbacks::getRevision(void) const {
+      return this->revision;
+    }
+
+
+    bool Callbacks::isSymbolicSimplificationDefined(void) const {
+      return this->isCallbackDefined(triton::callbacks::SYMBOLIC_SIMPLIFICATION);
+    }
+
+
+    void Callbacks::updateKinds(void) {
+      bool memory     = !this->getConcreteMemoryValueCallbacks.empty();
+      bool memoryArea = !this->getConcreteMemoryAreaValueCallbacks.empty();
+      bool reg        = !this->getConcreteRegisterValueCallbacks.empty();
+      bool simplify   = !this->symbolicSimplificationCallbacks.empty();
+      bool limit      = !this->memoryLimitCallbacks.empty();
+      bool exprLimit  = !this->expressionLimitCallbacks.empty();
+      bool miss       = !this->memoryMissCallbacks.empty();
+
+      #ifdef TRITON_PYTHON_BINDINGS
+      memory     = memory     || !this->pyGetConcreteMemoryValueCallbacks.empty();
+      memoryArea = memoryArea || !this->pyGetConcreteMemoryAreaValueCallbacks.empty();
+      reg        = reg        || !this->pyGetConcreteRegisterValueCallbacks.empty();
+      simplify   = simplify   || !this->pySymbolicSimplificationCallbacks.empty();
+      limit      = limit      || !this->pyMemoryLimitCallbacks.empty();
+      exprLimit  = exprLimit  || !this->pyExpressionLimitCallbacks.empty();
+      miss       = miss       || !this->pyMemoryMissCallbacks.empty();
+
+      for (auto it = this->pyBatchedCallbacks.begin(); it != this->pyBatchedCallbacks.end(); it++) {
+        memory     = memory     || (it->kind == triton::callbacks::GET_CONCRETE_MEMORY_VALUE);
+        memoryArea = memoryArea || (it->kind == triton::callbacks::GET_CONCRETE_MEMORY_AREA_VALUE);
+        reg        = reg        || (it->kind == triton::callbacks::GET_CONCRETE_REGISTER_VALUE);
+      }
+      #endif
+
+      this->kinds = 0;
+      if (memory)
+        this->kinds |= (1 << triton::callbacks::GET_CONCRETE_MEMORY_VALUE);
+      if (memoryArea)
+        this->kinds |= (1 << triton::callbacks::GET_CONCRETE_MEMORY_AREA_VALUE);
+      if (reg)
+        this->kinds |= (1 << triton::callbacks::GET_CONCRETE_REGISTER_VALUE);
+      if (simplify)
+        this->kinds |= (1 << triton::callbacks::SYMBOLIC_SIMPLIFICATION);
+      if (limit)
+        this->kinds |= (1 << triton::callbacks::MEMORY_LIMIT);
+      if (exprLimit)
+        this->kinds |= (1 << triton::callbacks::EXPRESSION_LIMIT);
+      if (miss)
+        this->kinds |= (1 << triton::callbacks::MEMORY_MISS);
+
+      this->isDefined = (this->kinds != 0);
+    }
+
+
     triton::ast::AbstractNode* Callbacks::processCallbacks(triton::callbacks::callback_e kind, triton::ast::AbstractNode* node) const {
       switch (kind) {
         case triton::callbacks::SYMBOLIC_SIMPLIFICATION: {
+          triton::utils::TraceSpan span("SYMBOLIC_SIMPLIFICATION", "callbacks");
+
           // C++ callbacks
           std::list<triton::callbacks::symbolicSimplificationCallback>::const_iterator it1;
           for (it1 = this->symbolicSimplificationCallbacks.begin(); it1 != this->symbolicSimplificationCallbacks.end(); it1++) {
@@ -198,6 +491,8 @@ namespace triton {
     void Callbacks::processCallbacks(triton::callbacks::callback_e kind, const triton::arch::MemoryAccess& mem) const {
       switch (kind) {
         case triton::callbacks::GET_CONCRETE_MEMORY_VALUE: {
+          triton::utils::TraceSpan span("GET_CONCRETE_MEMORY_VALUE", "callbacks");
+
           // C++ callbacks
           std::list<triton::callbacks::getConcreteMemoryValueCallback>::const_iterator it1;
           for (it1 = this->getConcreteMemoryValueCallbacks.begin(); it1 != this->getConcreteMemoryValueCallbacks.end(); it1++)
@@ -223,6 +518,9 @@ namespace triton {
 
             Py_DECREF(args);
           }
+
+          // Batched python callbacks
+          this->recordBatchedEvent(kind, mem.getAddress(), mem.getSize());
           #endif
           break;
         }
@@ -236,6 +534,8 @@ namespace triton {
     void Callbacks::processCallbacks(triton::callbacks::callback_e kind, const triton::arch::Register& reg) const {
       switch (kind) {
         case triton::callbacks::GET_CONCRETE_REGISTER_VALUE: {
+          triton::utils::TraceSpan span("GET_CONCRETE_REGISTER_VALUE", "callbacks");
+
           // C++ callbacks
           std::list<triton::callbacks::getConcreteRegisterValueCallback>::const_iterator it1;
           for (it1 = this->getConcreteRegisterValueCallbacks.begin(); it1 != this->getConcreteRegisterValueCallbacks.end(); it1++)
@@ -261,6 +561,9 @@ namespace triton {
 
             Py_DECREF(args);
           }
+
+          // Batched python callbacks
+          this->recordBatchedEvent(kind, reg.getId(), 0);
           #endif
           break;
         }
@@ -271,19 +574,187 @@ namespace triton {
     }
 
 
-    triton::usize Callbacks::countCallbacks(void) const {
-      triton::usize count = 0;
+    void Callbacks::processCallbacks(triton::callbacks::callback_e kind, triton::uint64 baseAddr, triton::usize size) const {
+      switch (kind) {
+        case triton::callbacks::GET_CONCRETE_MEMORY_AREA_VALUE: {
+          triton::utils::TraceSpan span("GET_CONCRETE_MEMORY_AREA_VALUE", "callbacks");
 
-      count += this->getConcreteMemoryValueCallbacks.size();
-      count += this->getConcreteRegisterValueCallbacks.size();
-      count += this->symbolicSimplificationCallbacks.size();
-      #ifdef TRITON_PYTHON_BINDINGS
-      count += this->pyGetConcreteMemoryValueCallbacks.size();
-      count += this->pyGetConcreteRegisterValueCallbacks.size();
-      count += this->pySymbolicSimplificationCallbacks.size();
-      #endif
+          // C++ callbacks
+          std::list<triton::callbacks::getConcreteMemoryAreaValueCallback>::const_iterator it1;
+          for (it1 = this->getConcreteMemoryAreaValueCallbacks.begin(); it1 != this->getConcreteMemoryAreaValueCallbacks.end(); it1++)
+            (*it1)(baseAddr, size);
+
+          #ifdef TRITON_PYTHON_BINDINGS
+          // Python callbacks
+          std::list<PyObject*>::const_iterator it2;
+          for (it2 = this->pyGetConcreteMemoryAreaValueCallbacks.begin(); it2 != this->pyGetConcreteMemoryAreaValueCallbacks.end(); it2++) {
+
+            /* Create function args */
+            PyObject* args = triton::bindings::python::xPyTuple_New(2);
+            PyTuple_SetItem(args, 0, triton::bindings::python::PyLong_FromUint64(baseAddr));
+            PyTuple_SetItem(args, 1, triton::bindings::python::PyLong_FromUsize(size));
+
+            /* Call the callback */
+            PyObject* ret = PyObject_CallObject(*it2, args);
+
+            /* Check the call */
+            if (ret == nullptr) {
+              PyErr_Print();
+              throw triton::exceptions::Callbacks("Callbacks::processCallbacks(GET_CONCRETE_MEMORY_AREA_VALUE): Fail to call the python callback.");
+            }
+
+            Py_DECREF(args);
+          }
+
+          // Batched python callbacks
+          this->recordBatchedEvent(kind, baseAddr, size);
+          #endif
+          break;
+        }
+
+        default:
+          throw triton::exceptions::Callbacks("Callbacks::processCallbacks(): Invalid kind of callback for this C++ polymorphism.");
+      };
+    }
+
+
+    void Callbacks::processCallbacks(triton::callbacks::callback_e kind, bool hard, triton::usize usage) const {
+      switch (kind) {
+        case triton::callbacks::MEMORY_LIMIT: {
+          triton::utils::TraceSpan span("MEMORY_LIMIT", "callbacks");
+
+          // C++ callbacks
+          std::list<triton::callbacks::memoryLimitCallback>::const_iterator it1;
+          for (it1 = this->memoryLimitCallbacks.begin(); it1 != this->memoryLimitCallbacks.end(); it1++)
+            (*it1)(usage, hard);
+
+          #ifdef TRITON_PYTHON_BINDINGS
+          // Python callbacks
+          std::list<PyObject*>::const_iterator it2;
+          for (it2 = this->pyMemoryLimitCallbacks.begin(); it2 != this->pyMemoryLimitCallbacks.end(); it2++) {
+
+            /* Create function args */
+            PyObject* args = triton::bindings::python::xPyTuple_New(2);
+            PyTuple_SetItem(args, 0, triton::bindings::python::PyLong_FromUsize(usage));
+            PyTuple_SetItem(args, 1, PyBool_FromLong(hard));
+
+            /* Call the callback */
+            PyObject* ret = PyObject_CallObject(*it2, args);
+
+            /* Check the call */
+            if (ret == nullptr) {
+              PyErr_Print();
+              throw triton::exceptions::Callbacks("Callbacks::processCallbacks(MEMORY_LIMIT): Fail to call the python callback.");
+            }
+
+            Py_DECREF(args);
+          }
+          #endif
+          break;
+        }
+
+        default:
+          throw triton::exceptions::Callbacks("Callbacks::processCallbacks(): Invalid kind of callback for this C++ polymorphism.");
+      };
+    }
+
+    void Callbacks::processCallbacks(triton::callbacks::callback_e kind, triton::engines::symbolic::SymbolicExpression* expr) const {
+      switch (kind) {
+        case triton::callbacks::EXPRESSION_LIMIT: {
+          triton::utils::TraceSpan span("EXPRESSION_LIMIT", "callbacks");
+
+          // C++ callbacks
+          std::list<triton::callbacks::expressionLimitCallback>::const_iterator it1;
+          for (it1 = this->expressionLimitCallbacks.begin(); it1 != this->expressionLimitCallbacks.end(); it1++)
+            (*it1)(expr);
+
+          #ifdef TRITON_PYTHON_BINDINGS
+          // Python callbacks
+          std::list<PyObject*>::const_iterator it2;
+          for (it2 = this->pyExpressionLimitCallbacks.begin(); it2 != this->pyExpressionLimitCallbacks.end(); it2++) {
+
+            /* Create function args */
+            PyObject* args = triton::bindings::python::xPyTuple_New(1);
+            PyTuple_SetItem(args, 0, triton::bindings::python::PySymbolicExpression(expr));
+
+            /* Call the callback */
+            PyObject* ret = PyObject_CallObject(*it2, args);
+
+            /* Check the call */
+            if (ret == nullptr) {
+              PyErr_Print();
+              throw triton::exceptions::Callbacks("Callbacks::processCallbacks(EXPRESSION_LIMIT): Fail to call the python callback.");
+            }
+
+            Py_DECREF(args);
+          }
+          #endif
+          break;
+        }
+
+        default:
+          throw triton::exceptions::Callbacks("Callbacks::processCallbacks(): Invalid kind of callback for this C++ polymorphism.");
+      };
+    }
+
+
+
+    bool Callbacks::processCallbacks(triton::callbacks::callback_e kind, triton::uint64 pageAddr, triton::uint8* page, triton::usize size) const {
+      switch (kind) {
+        case triton::callbacks::MEMORY_MISS: {
+          triton::utils::TraceSpan span("MEMORY_MISS", "callbacks");
+
+          // C++ callbacks
+          std::list<triton::callbacks::memoryMissCallback>::const_iterator it1;
+          for (it1 = this->memoryMissCallbacks.begin(); it1 != this->memoryMissCallbacks.end(); it1++) {
+            if ((*it1)(pageAddr, page, size))
+              return true;
+          }
 
-      return count;
+          #ifdef TRITON_PYTHON_BINDINGS
+          // Python callbacks, the page is returned as a string (None if the callback does not provide it)
+          std::list<PyObject*>::const_iterator it2;
+          for (it2 = this->pyMemoryMissCallbacks.begin(); it2 != this->pyMemoryMissCallbacks.end(); it2++) {
+
+            /* Create function args */
+            PyObject* args = triton::bindings::python::xPyTuple_New(2);
+            PyTuple_SetItem(args, 0, triton::bindings::python::PyLong_FromUint64(pageAddr));
+            PyTuple_SetItem(args, 1, triton::bindings::python::PyLong_FromUsize(size));
+
+            /* Call the callback */
+            PyObject* ret = PyObject_CallObject(*it2, args);
+
+            /* Check the call */
+            if (ret == nullptr) {
+              PyErr_Print();
+              throw triton::exceptions::Callbacks("Callbacks::processCallbacks(MEMORY_MISS): Fail to call the python callback.");
+            }
+
+            Py_DECREF(args);
+
+            if (ret == Py_None) {
+              Py_DECREF(ret);
+              continue;
+            }
+
+            if (!PyString_Check(ret)) {
+              Py_DECREF(ret);
+              throw triton::exceptions::Callbacks("Callbacks::processCallbacks(MEMORY_MISS): You must return a string or None.");
+            }
+
+            /* A shorter page is completed with zeros */
+            triton::usize length = std::min<triton::usize>(static_cast<triton::usize>(PyString_Size(ret)), size);
+            std::memcpy(page, PyString_AsString(ret), length);
+            Py_DECREF(ret);
+            return true;
+          }
+          #endif
+          return false;
+        }
+
+        default:
+          throw triton::exceptions::Callbacks("Callbacks::processCallbacks(): Invalid kind of callback for this C++ polymorphism.");
+      };
     }
 
   }; /* callbacks namespace */
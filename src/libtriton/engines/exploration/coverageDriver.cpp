@@ -0,0 +1,335 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#include <algorithm>
+#include <atomic>
+#include <fstream>
+#include <iterator>
+
+#if defined(__unix__) || defined(__APPLE__)
+  #include <dirent.h>
+  #include <fcntl.h>
+  #include <sys/mman.h>
+  #include <unistd.h>
+#endif
+
+#include <api.hpp>
+#include <coverageDriver.hpp>
+#include <cpuSize.hpp>
+#include <exceptions.hpp>
+
+
+
+namespace triton {
+  namespace engines {
+    namespace exploration {
+
+      /* The number of inputs emulated between two reads of the corpus directory */
+      static const triton::usize corpusSyncPeriod = 16;
+
+      /* Numbers the files written by the drivers of this process */
+      static std::atomic<triton::usize> corpusFiles(0);
+
+
+      /* Sets bits of a byte of the maps, which may be shared with other processes. Returns the previous byte. */
+      static inline triton::uint8 fetchOr(triton::uint8* byte, triton::uint8 bits) {
+        #if defined(__GNUC__) || defined(__clang__)
+        return __atomic_fetch_or(byte, bits, __ATOMIC_RELAXED);
+        #else
+        triton::uint8 old = *byte;
+        *byte |= bits;
+        return old;
+        #endif
+      }
+
+
+      /* The AFL buckets of the hit counts: 1, 2, 3, 4-7, 8-15, 16-31, 32-127, 128+ */
+      static inline triton::uint8 classifyCount(triton::uint8 count) {
+        if (count <= 2)   return count;
+        if (count == 3)   return 0x04;
+        if (count <= 7)   return 0x08;
+        if (count <= 15)  return 0x10;
+        if (count <= 31)  return 0x20;
+        if (count <= 127) return 0x40;
+        return 0x80;
+      }
+
+
+      CoverageDriver::CoverageDriver(triton::API* api, triton::uint64 inputAddress, triton::usize inputSize) {
+        if (api == nullptr)
+          throw triton::exceptions::Engines("CoverageDriver::CoverageDriver(): The API cannot be null.");
+
+        if (inputSize == 0)
+          throw triton::exceptions::Engines("CoverageDriver::CoverageDriver(): The input cannot be empty.");
+
+        this->api          = api;
+        this->inputAddress = inputAddress;
+        this->inputSize    = inputSize;
+        this->privateMaps.resize(EDGE_MAP_SIZE * 2, 0);
+        this->maps         = this->privateMaps.data();
+      }
+
+
+      CoverageDriver::~CoverageDriver() {
+        #if defined(__unix__) || defined(__APPLE__)
+        if (!this->sharedName.empty())
+          ::munmap(this->maps, EDGE_MAP_SIZE * 2);
+        #endif
+      }
+
+
+      void CoverageDriver::setCorpus(const std::string& directory) {
+        this->directory = directory;
+        this->files.clear();
+      }
+
+
+      void CoverageDriver::setSharedMap(const std::string& name) {
+        #if defined(__unix__) || defined(__APPLE__)
+        int fd = ::shm_open(name.c_str(), O_CREAT | O_RDWR, 0600);
+        if (fd < 0)
+          throw triton::exceptions::Engines("CoverageDriver::setSharedMap(): Cannot open the shared memory " + name + ".");
+
+        /* A new shared memory is filled with zeros, an existing one keeps the coverage of the other drivers */
+        if (::ftruncate(fd, EDGE_MAP_SIZE * 2) != 0) {
+          ::close(fd);
+          throw triton::exceptions::Engines("CoverageDriver::setSharedMap(): Cannot size the shared memory " + name + ".");
+        }
+
+        void* area = ::mmap(nullptr, EDGE_MAP_SIZE * 2, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        ::close(fd);
+
+        if (area == MAP_FAILED)
+          throw triton::exceptions::Engines("CoverageDriver::setSharedMap(): Cannot map the shared memory " + name + ".");
+
+        if (!this->sharedName.empty())
+          ::munmap(this->maps, EDGE_MAP_SIZE * 2);
+
+        this->maps       = static_cast<triton::uint8*>(area);
+        this->sharedName = name;
+        #else
+        throw triton::exceptions::Engines("CoverageDriver::setSharedMap(): The shared map is only available on Unix.");
+        #endif
+      }
+
+
+      void CoverageDriver::addSeed(const std::vector<triton::uint8>& data) {
+        this->pushSeed(data, 0, false);
+      }
+
+
+      /* [private method] */
+      void CoverageDriver::pushSeed(std::vector<triton::uint8> data, triton::usize novelty, bool written) {
+        data.resize(this->inputSize, 0);
+
+        if (!this->seen.insert(data).second)
+          return;
+
+        Seed seed;
+        seed.data    = data;
+        seed.novelty = novelty;
+        seed.written = written;
+
+        this->queue.insert(std::make_pair(novelty, seed));
+      }
+
+
+      /* [private method] */
+      triton::usize CoverageDriver::syncCorpus(void) {
+        triton::usize count = 0;
+
+        #if defined(__unix__) || defined(__APPLE__)
+        DIR* dir = ::opendir(this->directory.c_str());
+        if (dir == nullptr)
+          return 0;
+
+        while (struct dirent* entry = ::readdir(dir)) {
+          std::string name = entry->d_name;
+          if (name.empty() || name[0] == '.' || !this->files.insert(name).second)
+            continue;
+
+          std::ifstream file(this->directory + "/" + name, std::ios::binary);
+          if (!file)
+            continue;
+
+          this->pushSeed(std::vector<triton::uint8>(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>()), 0, true);
+          count++;
+        }
+
+        ::closedir(dir);
+        #endif
+
+        return count;
+      }
+
+
+      /* [private method] */
+      void CoverageDriver::writeCorpus(const std::vector<triton::uint8>& data) {
+        std::string name = "id-";
+
+        #if defined(__unix__) || defined(__APPLE__)
+        name += std::to_string(::getpid()) + "-";
+        #endif
+        name += std::to_string(corpusFiles++);
+
+        std::ofstream file(this->directory + "/" + name, std::ios::binary);
+        if (!file)
+          throw triton::exceptions::Engines("CoverageDriver::run(): Cannot write into the corpus directory " + this->directory + ".");
+
+        file.write(reinterpret_cast<const char*>(data.data()), data.size());
+        this->files.insert(name);
+      }
+
+
+      /* [private method] */
+      triton::usize CoverageDriver::mergeCoverage(std::vector<triton::uint8>& trace) {
+        triton::usize count = 0;
+
+        for (triton::usize index = 0; index < EDGE_MAP_SIZE; index++) {
+          if (trace[index] == 0)
+            continue;
+
+          triton::uint8 bucket = classifyCount(trace[index]);
+          if ((fetchOr(&this->maps[index], bucket) & bucket) == 0)
+            count++;
+        }
+
+        return count;
+      }
+
+
+      /* [private method] */
+      bool CoverageDriver::tryBranch(triton::uint64 src, triton::uint64 dst) {
+        triton::uint64 hash = (src * 0x9e3779b97f4a7c15) ^ (dst * 0xc2b2ae3d27d4eb4f);
+        triton::uint64 bit  = (hash >> 32) & (EDGE_MAP_SIZE * 8 - 1);
+        triton::uint8 mask  = static_cast<triton::uint8>(1 << (bit & 7));
+
+        return (fetchOr(&this->maps[EDGE_MAP_SIZE + bit / 8], mask) & mask) == 0;
+      }
+
+
+      /* [private method] */
+      void CoverageDriver::flipBranches(const std::vector<triton::uint8>& data, const std::map<triton::usize, triton::usize>& offsets, triton::usize base, triton::usize novelty) {
+        const std::vector<triton::engines::symbolic::PathConstraint>& constraints = this->api->getPathConstraints();
+        std::vector<triton::usize> queries;
+
+        /* The path predicate is T (top) plus the branches taken before the input is emulated */
+        triton::ast::AbstractNode* predicate = triton::ast::equal(triton::ast::bvtrue(), triton::ast::bvtrue());
+        for (triton::usize i = 0; i < base && i < constraints.size(); i++)
+          predicate = triton::ast::land(predicate, constraints[i].getTakenPathConstraintAst());
+
+        for (triton::usize i = base; i < constraints.size(); i++) {
+          const triton::engines::symbolic::PathConstraint& pc = constraints[i];
+
+          for (const auto& branch : pc.getBranchConstraints()) {
+            if (std::get<0>(branch)) {
+              this->tryBranch(std::get<1>(branch), std::get<2>(branch));
+              continue;
+            }
+
+            if (!pc.isMultipleBranches() || !this->tryBranch(std::get<1>(branch), std::get<2>(branch)))
+              continue;
+
+            /* The queries are solved meanwhile by the solver threads */
+            queries.push_back(this->api->getModelAsync(triton::ast::land(predicate, std::get<3>(branch))));
+          }
+
+          predicate = triton::ast::land(predicate, pc.getTakenPathConstraintAst());
+        }
+
+        for (triton::usize id : queries) {
+          std::map<triton::uint32, triton::engines::solver::SolverModel> model = this->api->getAsyncModel(id);
+          if (model.empty())
+            continue;
+
+          std::vector<triton::uint8> child = data;
+          for (const auto& m : model) {
+            auto offset = offsets.find(m.first);
+            if (offset != offsets.end())
+              child[offset->second] = m.second.getValue().convert_to<triton::uint8>();
+          }
+
+          this->pushSeed(child, novelty, false);
+        }
+      }
+
+
+      triton::usize CoverageDriver::run(triton::uint64 entry, const std::map<triton::uint64, triton::callbacks::addressHookCallback>& hooks, triton::usize maxRuns, triton::usize maxInsns) {
+        triton::API* previous = this->api->bind();
+        triton::usize initial = this->api->snapshot();
+        triton::usize count = 0;
+        std::vector<triton::uint8> trace(EDGE_MAP_SIZE);
+
+        try {
+          while (maxRuns == 0 || count < maxRuns) {
+            /* The inputs found by the other drivers */
+            if (!this->directory.empty() && (this->queue.empty() || count % corpusSyncPeriod == 0))
+              this->syncCorpus();
+
+            if (this->queue.empty())
+              break;
+
+            Seed seed = this->queue.begin()->second;
+            this->queue.erase(this->queue.begin());
+
+            /* Every byte of the input is a symbolic variable */
+            std::map<triton::usize, triton::usize> offsets;
+            this->api->restore(initial);
+            this->api->setConcreteMemoryAreaValue(this->inputAddress, seed.data);
+            for (triton::usize index = 0; index < this->inputSize; index++)
+              offsets[this->api->convertMemoryToSymbolicVariable(triton::arch::MemoryAccess(this->inputAddress + index, BYTE_SIZE))->getId()] = index;
+
+            triton::usize base = this->api->getPathConstraints().size();
+            std::fill(trace.begin(), trace.end(), 0);
+            this->api->run(entry, hooks, maxInsns, trace.data());
+            count++;
+
+            /* The children of an input which reaches nothing new come last */
+            triton::usize novelty = this->mergeCoverage(trace);
+            if (novelty > 0) {
+              this->corpus.push_back(seed.data);
+              if (!this->directory.empty() && !seed.written)
+                this->writeCorpus(seed.data);
+            }
+
+            this->flipBranches(seed.data, offsets, base, novelty);
+          }
+        }
+        catch (...) {
+          this->api->restore(initial);
+          this->api->removeSnapshot(initial);
+          previous->bind();
+          throw;
+        }
+
+        this->api->restore(initial);
+        this->api->removeSnapshot(initial);
+        previous->bind();
+
+        return count;
+      }
+
+
+      const std::vector<std::vector<triton::uint8>>& CoverageDriver::getCorpus(void) const {
+        return this->corpus;
+      }
+
+
+      triton::usize CoverageDriver::getCoveredEdges(void) const {
+        triton::usize count = 0;
+
+        for (triton::usize index = 0; index < EDGE_MAP_SIZE; index++) {
+          if (this->maps[index] != 0)
+            count++;
+        }
+
+        return count;
+      }
+
+    }; /* exploration namespace */
+  }; /* engines namespace */
+}; /* triton namespace */
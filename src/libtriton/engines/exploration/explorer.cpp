@@ -0,0 +1,439 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#include <sstream>
+
+#include <api.hpp>
+#include <exceptions.hpp>
+#include <explorer.hpp>
+#include <networkUtils.hpp>
+
+
+
+namespace triton {
+  namespace engines {
+    namespace exploration {
+
+      Explorer::Explorer(triton::API* api, triton::uint32 strategy) {
+        if (api == nullptr)
+          throw triton::exceptions::Engines("Explorer::Explorer(): The API cannot be null.");
+
+        if (strategy != DFS && strategy != BFS && strategy != COVERAGE)
+          throw triton::exceptions::Engines("Explorer::Explorer(): Invalid strategy.");
+
+        this->api      = api;
+        this->strategy = strategy;
+      }
+
+
+      /* The messages of the distributed exploration */
+      enum message_e {
+        MSG_DONE = 0,   /* coordinator -> worker: the exploration is over */
+        MSG_STATE,      /* coordinator -> worker: a state to explore */
+        MSG_READY,      /* worker -> coordinator: the worker waits for a state */
+        MSG_RESULT      /* worker -> coordinator: the result of the last state, the worker waits for another one */
+      };
+
+
+      /* Appends a state to a message */
+      static void writeState(std::string& buffer, const ExplorationState& state) {
+        triton::utils::writeVarint(buffer, state.inputs.size());
+        for (const auto& input : state.inputs) {
+          std::ostringstream value;
+          value << input.second;
+          triton::utils::writeVarint(buffer, input.first);
+          triton::utils::writeString(buffer, value.str());
+        }
+        triton::utils::writeVarint(buffer, state.bound);
+        triton::utils::writeVarint(buffer, state.target.first);
+        triton::utils::writeVarint(buffer, state.target.second);
+      }
+
+
+      /* Reads a state of a message */
+      static ExplorationState readState(const std::string& buffer, triton::usize& offset) {
+        ExplorationState state;
+
+        triton::uint64 count = triton::utils::readVarint(buffer, offset);
+        for (triton::uint64 index = 0; index < count; index++) {
+          triton::usize id = triton::utils::readVarint(buffer, offset);
+          state.inputs[id] = triton::uint512(triton::utils::readString(buffer, offset));
+        }
+        state.bound         = triton::utils::readVarint(buffer, offset);
+        state.target.first  = triton::utils::readVarint(buffer, offset);
+        state.target.second = triton::utils::readVarint(buffer, offset);
+
+        return state;
+      }
+
+
+      ExplorationState Explorer::popState(void) {
+        auto it = this->worklist.begin();
+
+        switch (this->strategy) {
+          case DFS:
+            it = this->worklist.end() - 1;
+            break;
+
+          case COVERAGE:
+            /* The first state leading to a destination not reached yet, if any */
+            for (auto candidate = this->worklist.begin(); candidate != this->worklist.end(); candidate++) {
+              if (this->covered.find(candidate->target.second) == this->covered.end()) {
+                it = candidate;
+                break;
+              }
+            }
+            break;
+
+          default:
+            break;
+        }
+
+        ExplorationState state = *it;
+        this->worklist.erase(it);
+        return state;
+      }
+
+
+      void Explorer::applyInputs(const ExplorationInputs& inputs) {
+        std::map<triton::usize, triton::engines::symbolic::SymbolicVariable*> variables = this->api->getSymbolicVariables();
+
+        for (const auto& input : inputs) {
+          auto it = variables.find(input.first);
+          if (it == variables.end())
+            continue;
+
+          triton::engines::symbolic::SymbolicVariable* variable = it->second;
+          variable->setConcreteValue(input.second);
+
+          switch (variable->getKind()) {
+            case triton::engines::symbolic::REG:
+              this->api->setConcreteRegisterValue(triton::arch::Register(static_cast<triton::uint32>(variable->getKindValue()), input.second));
+              break;
+
+            case triton::engines::symbolic::MEM:
+              this->api->setConcreteMemoryValue(triton::arch::MemoryAccess(variable->getKindValue(), variable->getSize() / BYTE_SIZE_BIT, input.second));
+              break;
+
+            default:
+              break;
+          }
+        }
+      }
+
+
+      void Explorer::spawnStates(const ExplorationState& state, triton::usize base, std::vector<std::pair<triton::uint64, triton::uint64>>& reached) {
+        const std::vector<triton::engines::symbolic::PathConstraint>& constraints = this->api->getPathConstraints();
+
+        /* The path predicate is T (top) plus the branches taken before the exploration */
+        triton::ast::AbstractNode* predicate = triton::ast::equal(triton::ast::bvtrue(), triton::ast::bvtrue());
+        for (triton::usize i = 0; i < base && i < constraints.size(); i++)
+          predicate = triton::ast::land(predicate, constraints[i].getTakenPathConstraintAst());
+
+        for (triton::usize i = base; i < constraints.size(); i++) {
+          const triton::engines::symbolic::PathConstraint& pc = constraints[i];
+
+          for (const auto& branch : pc.getBranchConstraints()) {
+            std::pair<triton::uint64, triton::uint64> edge(std::get<1>(branch), std::get<2>(branch));
+
+            if (std::get<0>(branch)) {
+              reached.push_back(edge);
+              this->branches.insert(edge);
+              this->covered.insert(edge.second);
+              continue;
+            }
+
+            /* The branches leading to the one this state is spawned for are fixed */
+            if (!pc.isMultipleBranches() || i - base < state.bound)
+              continue;
+
+            if (this->branches.find(edge) != this->branches.end())
+              continue;
+
+            /* Asserted, the query is split into conjuncts, whose known unsat cores prune it */
+            auto model = this->api->getModel(triton::ast::assert_(triton::ast::land(predicate, std::get<3>(branch))));
+            if (model.empty())
+              continue;
+
+            ExplorationState child;
+            child.inputs = state.inputs;
+            for (const auto& m : model)
+              child.inputs[m.first] = m.second.getValue();
+            child.bound  = (i - base) + 1;
+            child.target = edge;
+
+            this->branches.insert(edge);
+            this->worklist.push_back(child);
+          }
+
+          predicate = triton::ast::land(predicate, pc.getTakenPathConstraintAst());
+        }
+      }
+
+
+      triton::uint64 Explorer::exploreState(const ExplorationState& state, triton::usize initial, triton::uint64 entry, const std::map<triton::uint64, triton::callbacks::addressHookCallback>& hooks, triton::usize maxInsns, std::vector<std::pair<triton::uint64, triton::uint64>>& reached) {
+        /* FNV-1a over the branches taken */
+        triton::uint64 hash = 0xcbf29ce484222325;
+
+        this->api->restore(initial);
+        this->applyInputs(state.inputs);
+
+        triton::usize base = this->api->getPathConstraints().size();
+        this->api->run(entry, hooks, maxInsns);
+
+        this->explored.push_back(state.inputs);
+        this->spawnStates(state, base, reached);
+
+        for (const auto& edge : reached) {
+          for (triton::uint64 value : {edge.first, edge.second}) {
+            for (triton::uint32 index = 0; index < 8; index++) {
+              hash ^= (value >> (index * 8)) & 0xff;
+              hash *= 0x100000001b3;
+            }
+          }
+        }
+
+        this->paths.insert(hash);
+        return hash;
+      }
+
+
+      triton::usize Explorer::explore(triton::uint64 entry, const std::map<triton::uint64, triton::callbacks::addressHookCallback>& hooks, triton::usize maxStates, triton::usize maxInsns) {
+        triton::API* previous = this->api->bind();
+        triton::usize count = 0;
+        triton::usize initial = this->api->snapshot();
+        ExplorationState root;
+
+        root.bound  = 0;
+        root.target = std::make_pair(0, entry);
+
+        this->worklist.clear();
+        this->worklist.push_back(root);
+
+        try {
+          while (!this->worklist.empty() && (maxStates == 0 || count < maxStates)) {
+            std::vector<std::pair<triton::uint64, triton::uint64>> reached;
+            this->exploreState(this->popState(), initial, entry, hooks, maxInsns, reached);
+            count++;
+          }
+        }
+        catch (...) {
+          this->api->restore(initial);
+          this->api->removeSnapshot(initial);
+          previous->bind();
+          throw;
+        }
+
+        this->api->restore(initial);
+        this->api->removeSnapshot(initial);
+        previous->bind();
+
+        return count;
+      }
+
+
+      triton::usize Explorer::coordinate(const std::string& address, triton::uint64 entry, triton::usize maxStates) {
+        /* The workers by socket, with the state they explore if they are busy */
+        std::map<int, std::pair<bool, ExplorationState>> workers;
+        std::set<int> ready;
+        triton::usize dispatched = 0;
+        triton::usize count = 0;
+        ExplorationState root;
+
+        root.bound  = 0;
+        root.target = std::make_pair(0, entry);
+
+        this->worklist.clear();
+        this->worklist.push_back(root);
+
+        int listener = triton::utils::openSocket(address, true);
+
+        try {
+          while (true) {
+            triton::usize busy = workers.size() - ready.size();
+
+            /* Hand the states to the workers waiting for one */
+            while (!ready.empty() && !this->worklist.empty() && (maxStates == 0 || dispatched < maxStates)) {
+              int worker = *ready.begin();
+              std::string message;
+
+              ready.erase(ready.begin());
+              workers[worker] = std::make_pair(true, this->popState());
+              triton::utils::writeVarint(message, MSG_STATE);
+              writeState(message, workers[worker].second);
+              triton::utils::sendFrame(worker, message);
+              dispatched++;
+              busy++;
+            }
+
+            /* Nothing left to explore and nobody to wait for */
+            if (busy == 0 && (this->worklist.empty() || (maxStates != 0 && dispatched >= maxStates)))
+              break;
+
+            std::vector<int> sockets(1, listener);
+            for (const auto& worker : workers)
+              sockets.push_back(worker.first);
+
+            for (int socket : triton::utils::waitReadable(sockets, -1)) {
+              if (socket == listener) {
+                int worker = triton::utils::acceptSocket(listener);
+                if (worker >= 0)
+                  workers[worker] = std::make_pair(false, ExplorationState());
+                continue;
+              }
+
+              std::pair<bool, ExplorationState>& worker = workers[socket];
+              std::string message;
+              triton::usize offset = 0;
+              bool alive = false;
+
+              try {
+                alive = triton::utils::recvFrame(socket, message);
+                if (alive && triton::utils::readVarint(message, offset) == MSG_RESULT && worker.first) {
+                  this->explored.push_back(worker.second.inputs);
+                  this->paths.insert(triton::utils::readVarint(message, offset));
+
+                  triton::uint64 edges = triton::utils::readVarint(message, offset);
+                  for (triton::uint64 index = 0; index < edges; index++) {
+                    std::pair<triton::uint64, triton::uint64> edge;
+                    edge.first  = triton::utils::readVarint(message, offset);
+                    edge.second = triton::utils::readVarint(message, offset);
+                    this->branches.insert(edge);
+                    this->covered.insert(edge.second);
+                  }
+
+                  /* Another worker may have reached or spawned the branch meanwhile */
+                  triton::uint64 spawned = triton::utils::readVarint(message, offset);
+                  for (triton::uint64 index = 0; index < spawned; index++) {
+                    ExplorationState child = readState(message, offset);
+                    if (this->branches.insert(child.target).second)
+                      this->worklist.push_back(child);
+                  }
+
+                  worker.first = false;
+                  count++;
+                }
+              }
+              catch (const triton::exceptions::Exception&) {
+                alive = false;
+              }
+
+              if (alive) {
+                ready.insert(socket);
+                continue;
+              }
+
+              /* The state of a lost worker is handed to another one */
+              if (worker.first) {
+                this->worklist.push_back(worker.second);
+                dispatched--;
+              }
+              triton::utils::closeSocket(socket);
+              workers.erase(socket);
+              ready.erase(socket);
+            }
+          }
+        }
+        catch (...) {
+          for (const auto& worker : workers)
+            triton::utils::closeSocket(worker.first);
+          triton::utils::closeSocket(listener);
+          triton::utils::unlinkSocket(address);
+          throw;
+        }
+
+        /* Release the workers */
+        std::string done;
+        triton::utils::writeVarint(done, MSG_DONE);
+        for (const auto& worker : workers) {
+          triton::utils::sendFrame(worker.first, done);
+          triton::utils::closeSocket(worker.first);
+        }
+
+        triton::utils::closeSocket(listener);
+        triton::utils::unlinkSocket(address);
+
+        return count;
+      }
+
+
+      triton::usize Explorer::work(const std::string& address, triton::uint64 entry, const std::map<triton::uint64, triton::callbacks::addressHookCallback>& hooks, triton::usize maxInsns) {
+        int coordinator = triton::utils::openSocket(address, false);
+        triton::API* previous = this->api->bind();
+        triton::usize count = 0;
+        triton::usize initial = this->api->snapshot();
+        std::string message;
+
+        triton::utils::writeVarint(message, MSG_READY);
+
+        try {
+          while (triton::utils::sendFrame(coordinator, message) && triton::utils::recvFrame(coordinator, message)) {
+            triton::usize offset = 0;
+            if (triton::utils::readVarint(message, offset) != MSG_STATE)
+              break;
+
+            std::vector<std::pair<triton::uint64, triton::uint64>> reached;
+            ExplorationState state = readState(message, offset);
+
+            /* The spawned states go to the coordinator, not to the local worklist */
+            this->worklist.clear();
+            triton::uint64 hash = this->exploreState(state, initial, entry, hooks, maxInsns, reached);
+            count++;
+
+            message.clear();
+            triton::utils::writeVarint(message, MSG_RESULT);
+            triton::utils::writeVarint(message, hash);
+            triton::utils::writeVarint(message, reached.size());
+            for (const auto& edge : reached) {
+              triton::utils::writeVarint(message, edge.first);
+              triton::utils::writeVarint(message, edge.second);
+            }
+            triton::utils::writeVarint(message, this->worklist.size());
+            for (const auto& child : this->worklist)
+              writeState(message, child);
+            this->worklist.clear();
+          }
+        }
+        catch (...) {
+          this->api->restore(initial);
+          this->api->removeSnapshot(initial);
+          previous->bind();
+          triton::utils::closeSocket(coordinator);
+          throw;
+        }
+
+        this->api->restore(initial);
+        this->api->removeSnapshot(initial);
+        previous->bind();
+        triton::utils::closeSocket(coordinator);
+
+        return count;
+      }
+
+
+      const std::vector<ExplorationInputs>& Explorer::getExploredInputs(void) const {
+        return this->explored;
+      }
+
+
+      const std::set<std::pair<triton::uint64, triton::uint64>>& Explorer::getBranches(void) const {
+        return this->branches;
+      }
+
+
+      const std::set<triton::uint64>& Explorer::getCoverage(void) const {
+        return this->covered;
+      }
+
+
+      const std::set<triton::uint64>& Explorer::getPaths(void) const {
+        return this->paths;
+      }
+
+    }; /* exploration namespace */
+  }; /* engines namespace */
+}; /* triton namespace */
@@ -0,0 +1,290 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#ifdef TRITON_BOOLECTOR
+
+#include <unordered_set>
+
+#include <astTraversal.hpp>
+#include <boolectorBackend.hpp>
+#include <coreUtils.hpp>
+#include <cpuSize.hpp>
+#include <exceptions.hpp>
+
+
+
+namespace triton {
+  namespace engines {
+    namespace solver {
+
+      /* Returns the value of a decimal node as a 32-bit integer */
+      static triton::uint32 getDecimal(triton::ast::AbstractNode* node) {
+        return reinterpret_cast<triton::ast::DecimalNode*>(node)->getValue().convert_to<triton::uint32>();
+      }
+
+
+      BoolectorBackend::BoolectorBackend(triton::engines::symbolic::SymbolicEngine* symbolicEngine) {
+        if (symbolicEngine == nullptr)
+          throw triton::exceptions::SolverEngine("BoolectorBackend::BoolectorBackend(): The symbolicEngine API cannot be null.");
+
+        this->symbolicEngine = symbolicEngine;
+        this->interrupted    = false;
+        this->deadline       = 0;
+      }
+
+
+      std::string BoolectorBackend::getName(void) const {
+        return "boolector";
+      }
+
+
+      int32_t BoolectorBackend::terminate(void* state) {
+        BoolectorBackend* self = reinterpret_cast<BoolectorBackend*>(state);
+
+        if (self->interrupted)
+          return 1;
+
+        return (self->deadline != 0 && triton::utils::getMonotonicTime() >= self->deadline);
+      }
+
+
+      /* [private method] Returns the translation of a node */
+      BoolectorNode* BoolectorBackend::getNode(triton::ast::AbstractNode* node) const {
+        /* The symbol of a let node stands for its expression */
+        if (node->getKind() == triton::ast::STRING_NODE) {
+          auto symbol = this->symbols.find(reinterpret_cast<triton::ast::StringNode*>(node)->getValue());
+          if (symbol == this->symbols.end())
+            throw triton::exceptions::SolverEngine("BoolectorBackend::getNode(): Symbols not found.");
+          node = symbol->second;
+        }
+
+        auto it = this->nodes.find(node);
+        if (it == this->nodes.end())
+          throw triton::exceptions::SolverEngine("BoolectorBackend::getNode(): The node has not been translated.");
+
+        return it->second;
+      }
+
+
+      /* [private method] Translates a node whose children are translated */
+      BoolectorNode* BoolectorBackend::translate(Btor* btor, triton::ast::AbstractNode* node) {
+        const std::vector<triton::ast::AbstractNode*>& childs = node->getChilds();
+        BoolectorNode* (*binary)(Btor*, BoolectorNode*, BoolectorNode*) = nullptr;
+
+        switch (node->getKind()) {
+          case triton::ast::BVADD_NODE:     binary = boolector_add;  break;
+          case triton::ast::BVAND_NODE:     binary = boolector_and;  break;
+          case triton::ast::BVASHR_NODE:    binary = boolector_sra;  break;
+          case triton::ast::BVLSHR_NODE:    binary = boolector_srl;  break;
+          case triton::ast::BVMUL_NODE:     binary = boolector_mul;  break;
+          case triton::ast::BVNAND_NODE:    binary = boolector_nand; break;
+          case triton::ast::BVNOR_NODE:     binary = boolector_nor;  break;
+          case triton::ast::BVOR_NODE:      binary = boolector_or;   break;
+          case triton::ast::BVSDIV_NODE:    binary = boolector_sdiv; break;
+          case triton::ast::BVSGE_NODE:     binary = boolector_sgte; break;
+          case triton::ast::BVSGT_NODE:     binary = boolector_sgt;  break;
+          case triton::ast::BVSHL_NODE:     binary = boolector_sll;  break;
+          case triton::ast::BVSLE_NODE:     binary = boolector_slte; break;
+          case triton::ast::BVSLT_NODE:     binary = boolector_slt;  break;
+          case triton::ast::BVSMOD_NODE:    binary = boolector_smod; break;
+          case triton::ast::BVSREM_NODE:    binary = boolector_srem; break;
+          case triton::ast::BVSUB_NODE:     binary = boolector_sub;  break;
+          case triton::ast::BVUDIV_NODE:    binary = boolector_udiv; break;
+          case triton::ast::BVUGE_NODE:     binary = boolector_ugte; break;
+          case triton::ast::BVUGT_NODE:     binary = boolector_ugt;  break;
+          case triton::ast::BVULE_NODE:     binary = boolector_ulte; break;
+          case triton::ast::BVULT_NODE:     binary = boolector_ult;  break;
+          case triton::ast::BVUREM_NODE:    binary = boolector_urem; break;
+          case triton::ast::BVXNOR_NODE:    binary = boolector_xnor; break;
+          case triton::ast::BVXOR_NODE:     binary = boolector_xor;  break;
+          case triton::ast::DISTINCT_NODE:  binary = boolector_ne;   break;
+          case triton::ast::EQUAL_NODE:     binary = boolector_eq;   break;
+          case triton::ast::LAND_NODE:      binary = boolector_and;  break;
+          case triton::ast::LOR_NODE:       binary = boolector_or;   break;
+
+          case triton::ast::BVNEG_NODE:
+            return boolector_neg(btor, this->getNode(childs[0]));
+
+          case triton::ast::BVNOT_NODE:
+          case triton::ast::LNOT_NODE:
+            return boolector_not(btor, this->getNode(childs[0]));
+
+          case triton::ast::BVROL_NODE:
+            return boolector_roli(btor, this->getNode(childs[1]), getDecimal(childs[0]) % node->getBitvectorSize());
+
+          case triton::ast::BVROR_NODE:
+            return boolector_rori(btor, this->getNode(childs[1]), getDecimal(childs[0]) % node->getBitvectorSize());
+
+          case triton::ast::BV_NODE: {
+            std::string value(reinterpret_cast<triton::ast::DecimalNode*>(childs[0])->getValue());
+            BoolectorSort sort = boolector_bitvec_sort(btor, getDecimal(childs[1]));
+            return boolector_constd(btor, sort, value.c_str());
+          }
+
+          /* The first child holds the most significant bits */
+          case triton::ast::CONCAT_NODE: {
+            BoolectorNode* ret = this->getNode(childs[0]);
+            for (triton::usize index = 1; index < childs.size(); index++)
+              ret = boolector_concat(btor, ret, this->getNode(childs[index]));
+            return ret;
+          }
+
+          case triton::ast::EXTRACT_NODE:
+            return boolector_slice(btor, this->getNode(childs[2]), getDecimal(childs[0]), getDecimal(childs[1]));
+
+          case triton::ast::ITE_NODE:
+            return boolector_cond(btor, this->getNode(childs[0]), this->getNode(childs[1]), this->getNode(childs[2]));
+
+          case triton::ast::LET_NODE:
+            return this->getNode(childs[2]);
+
+          case triton::ast::REFERENCE_NODE: {
+            triton::engines::symbolic::SymbolicExpression* expr = reinterpret_cast<triton::ast::ReferenceNode*>(node)->getSymbolicExpression();
+            if (expr == nullptr)
+              throw triton::exceptions::SolverEngine("BoolectorBackend::translate(): Reference node not found.");
+            return this->getNode(expr->getAst());
+          }
+
+          case triton::ast::SX_NODE:
+            return boolector_sext(btor, this->getNode(childs[1]), getDecimal(childs[0]));
+
+          case triton::ast::ZX_NODE:
+            return boolector_uext(btor, this->getNode(childs[1]), getDecimal(childs[0]));
+
+          /* Vectors are lowered to the concatenation of their lanes, the most significant one first */
+          case triton::ast::VADD_NODE:
+          case triton::ast::VEQ_NODE: {
+            triton::uint32 lane = getDecimal(childs[0]);
+            BoolectorSort sort  = boolector_bitvec_sort(btor, lane);
+            BoolectorNode* ret  = nullptr;
+            for (triton::uint32 high = node->getBitvectorSize(); high > 0; high -= lane) {
+              BoolectorNode* op1  = boolector_slice(btor, this->getNode(childs[1]), high - 1, high - lane);
+              BoolectorNode* op2  = boolector_slice(btor, this->getNode(childs[2]), high - 1, high - lane);
+              BoolectorNode* item = nullptr;
+              if (node->getKind() == triton::ast::VADD_NODE)
+                item = boolector_add(btor, op1, op2);
+              else
+                item = boolector_cond(btor, boolector_eq(btor, op1, op2), boolector_ones(btor, sort), boolector_zero(btor, sort));
+              ret = (ret == nullptr) ? item : boolector_concat(btor, ret, item);
+            }
+            return ret;
+          }
+
+          case triton::ast::VARIABLE_NODE: {
+            std::string name   = reinterpret_cast<triton::ast::VariableNode*>(node)->getValue();
+            BoolectorSort sort = boolector_bitvec_sort(btor, node->getBitvectorSize());
+            BoolectorNode* ret = boolector_var(btor, sort, name.c_str());
+            this->variables[name] = ret;
+            return ret;
+          }
+
+          case triton::ast::ARRAY_NODE: {
+            triton::ast::ArrayNode* array = reinterpret_cast<triton::ast::ArrayNode*>(node);
+            BoolectorSort index = boolector_bitvec_sort(btor, array->getIndexSize());
+            BoolectorSort value = boolector_bitvec_sort(btor, BYTE_SIZE_BIT);
+            return boolector_array(btor, boolector_array_sort(btor, index, value), array->getName().c_str());
+          }
+
+          case triton::ast::SELECT_NODE:
+            return boolector_read(btor, this->getNode(childs[0]), this->getNode(childs[1]));
+
+          case triton::ast::STORE_NODE:
+            return boolector_write(btor, this->getNode(childs[0]), this->getNode(childs[1]), this->getNode(childs[2]));
+
+          default:
+            throw triton::exceptions::SolverEngine("BoolectorBackend::translate(): Unsupported node.");
+        }
+
+        /* Binary nodes, (and) and (or) may have more children */
+        BoolectorNode* ret = binary(btor, this->getNode(childs[0]), this->getNode(childs[1]));
+        for (triton::usize index = 2; index < childs.size(); index++)
+          ret = binary(btor, ret, this->getNode(childs[index]));
+
+        return ret;
+      }
+
+
+      triton::engines::solver::status_e BoolectorBackend::solve(const std::vector<triton::ast::AbstractNode*>& constraints, triton::uint32 timeout, triton::uint32 resourceLimit, std::map<triton::uint32, SolverModel>& model) {
+        triton::engines::solver::status_e status = triton::engines::solver::UNKNOWN;
+        std::unordered_set<triton::ast::AbstractNode*> visited;
+        std::vector<triton::ast::AbstractNode*> nodes;
+        Btor* btor = boolector_new();
+
+        boolector_set_opt(btor, BTOR_OPT_MODEL_GEN, 1);
+        boolector_set_opt(btor, BTOR_OPT_AUTO_CLEANUP, 1);
+        boolector_set_term(btor, BoolectorBackend::terminate, this);
+        this->deadline = (timeout ? triton::utils::getMonotonicTime() + static_cast<triton::uint64>(timeout) * 1000000 : 0);
+
+        this->nodes.clear();
+        this->symbols.clear();
+        this->variables.clear();
+
+        try {
+          /* Children come before their parents, referenced ASTs before their references */
+          for (auto it = constraints.begin(); it != constraints.end(); it++)
+            triton::ast::nodesExtraction(nodes, *it, visited, true);
+
+          for (auto it = nodes.begin(); it != nodes.end(); it++) {
+            if ((*it)->getKind() == triton::ast::LET_NODE)
+              this->symbols[reinterpret_cast<triton::ast::StringNode*>((*it)->getChilds()[0])->getValue()] = (*it)->getChilds()[1];
+          }
+
+          /* Decimal and string nodes are parameters of their parents */
+          for (auto it = nodes.begin(); it != nodes.end(); it++) {
+            if ((*it)->getKind() != triton::ast::DECIMAL_NODE && (*it)->getKind() != triton::ast::STRING_NODE)
+              this->nodes[*it] = this->translate(btor, *it);
+          }
+
+          for (auto it = constraints.begin(); it != constraints.end(); it++)
+            boolector_assert(btor, this->getNode(*it));
+
+          switch (this->interrupted ? BOOLECTOR_UNKNOWN : boolector_sat(btor)) {
+            case BOOLECTOR_SAT:   status = triton::engines::solver::SAT;   break;
+            case BOOLECTOR_UNSAT: status = triton::engines::solver::UNSAT; break;
+            default:              status = triton::engines::solver::UNKNOWN;
+          }
+
+          if (status == triton::engines::solver::SAT) {
+            model.clear();
+            for (auto it = this->variables.begin(); it != this->variables.end(); it++) {
+              const char* bits = boolector_bv_assignment(btor, it->second);
+              triton::uint512 value = 0;
+
+              /* Bits which do not matter ('x') are 0 */
+              for (const char* bit = bits; *bit; bit++)
+                value = ((value << 1) | (*bit == '1' ? 1 : 0));
+
+              boolector_free_bv_assignment(btor, bits);
+
+              SolverModel tritonModel = SolverModel(it->first, value);
+              model[tritonModel.getId()] = tritonModel;
+            }
+          }
+        }
+        catch (const triton::exceptions::Exception& e) {
+          this->nodes.clear();
+          boolector_delete(btor);
+          throw;
+        }
+
+        this->nodes.clear();
+        this->variables.clear();
+        boolector_delete(btor);
+
+        return status;
+      }
+
+
+      void BoolectorBackend::interrupt(void) {
+        this->interrupted = true;
+      }
+
+    };
+  };
+};
+
+#endif /* TRITON_BOOLECTOR */
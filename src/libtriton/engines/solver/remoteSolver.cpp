@@ -0,0 +1,260 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#include <sstream>
+
+#include <exceptions.hpp>
+#include <networkUtils.hpp>
+#include <remoteSolver.hpp>
+#include <solverEngine.hpp>
+
+
+
+namespace triton {
+  namespace engines {
+    namespace solver {
+
+      RemoteSolverClient::RemoteSolverClient(const std::string& address) {
+        this->nextId = 0;
+        this->socket = triton::utils::openSocket(address, false);
+      }
+
+
+      RemoteSolverClient::~RemoteSolverClient() {
+        triton::utils::closeSocket(this->socket);
+      }
+
+
+      triton::usize RemoteSolverClient::submit(const std::string& formula, triton::uint32 timeout, triton::uint32 resourceLimit) {
+        std::string payload;
+        triton::usize id = this->nextId++;
+
+        triton::utils::writeVarint(payload, id);
+        triton::utils::writeVarint(payload, timeout);
+        triton::utils::writeVarint(payload, resourceLimit);
+        triton::utils::writeString(payload, formula);
+
+        if (!triton::utils::sendFrame(this->socket, payload))
+          throw triton::exceptions::SolverEngine("RemoteSolverClient::submit(): The connection to the solver daemon is lost.");
+
+        return id;
+      }
+
+
+      /* [private method] */
+      void RemoteSolverClient::readResponse(void) {
+        std::string payload;
+        triton::usize offset = 0;
+        RemoteResult result;
+
+        if (!triton::utils::recvFrame(this->socket, payload))
+          throw triton::exceptions::SolverEngine("RemoteSolverClient::wait(): The connection to the solver daemon is lost.");
+
+        triton::usize id      = triton::utils::readVarint(payload, offset);
+        triton::uint64 status = triton::utils::readVarint(payload, offset);
+        triton::uint64 count  = triton::utils::readVarint(payload, offset);
+
+        if (status > triton::engines::solver::UNKNOWN)
+          throw triton::exceptions::SolverEngine("RemoteSolverClient::wait(): Invalid status.");
+
+        result.first = static_cast<triton::engines::solver::status_e>(status);
+        for (triton::uint64 index = 0; index < count; index++) {
+          std::string name  = triton::utils::readString(payload, offset);
+          std::string value = triton::utils::readString(payload, offset);
+          SolverModel model(name, triton::uint512(value));
+          result.second[model.getId()] = model;
+        }
+
+        this->results[id] = result;
+      }
+
+
+      bool RemoteSolverClient::isReady(triton::usize id) {
+        if (this->results.find(id) != this->results.end())
+          return true;
+
+        /* Reads the responses already received, without blocking */
+        while (!triton::utils::waitReadable(std::vector<int>(1, this->socket), 0).empty()) {
+          this->readResponse();
+          if (this->results.find(id) != this->results.end())
+            return true;
+        }
+
+        return false;
+      }
+
+
+      RemoteResult RemoteSolverClient::wait(triton::usize id) {
+        if (id >= this->nextId)
+          throw triton::exceptions::SolverEngine("RemoteSolverClient::wait(): Unknown request.");
+
+        while (this->results.find(id) == this->results.end())
+          this->readResponse();
+
+        RemoteResult ret = this->results[id];
+        this->results.erase(id);
+
+        return ret;
+      }
+
+
+      RemoteSolverServer::Connection::Connection(int socket) {
+        this->socket = socket;
+      }
+
+
+      RemoteSolverServer::Connection::~Connection() {
+        triton::utils::closeSocket(this->socket);
+      }
+
+
+      RemoteSolverServer::RemoteSolverServer(const std::string& address, triton::uint32 threads, triton::usize cacheSize)
+        : pool(threads) {
+        this->cacheHits = 0;
+        this->cacheSize = cacheSize;
+        this->requests  = 0;
+        this->stopping  = false;
+        this->address   = address;
+        this->listener  = triton::utils::openSocket(address, true);
+      }
+
+
+      RemoteSolverServer::~RemoteSolverServer() {
+        this->stop();
+
+        /* The readers stop once their client is shut down */
+        {
+          std::lock_guard<std::mutex> lock(this->mutex);
+          for (auto it = this->connections.begin(); it != this->connections.end(); it++) {
+            std::shared_ptr<Connection> connection = it->lock();
+            if (connection != nullptr)
+              triton::utils::shutdownSocket(connection->socket);
+          }
+        }
+
+        for (auto it = this->readers.begin(); it != this->readers.end(); it++)
+          it->join();
+
+        triton::utils::closeSocket(this->listener);
+        triton::utils::unlinkSocket(this->address);
+      }
+
+
+      void RemoteSolverServer::run(void) {
+        while (!this->stopping.load()) {
+          int fd = triton::utils::acceptSocket(this->listener);
+          if (fd < 0) {
+            if (this->stopping.load())
+              break;
+            continue;
+          }
+
+          std::shared_ptr<Connection> connection = std::make_shared<Connection>(fd);
+          std::lock_guard<std::mutex> lock(this->mutex);
+          this->connections.push_back(connection);
+          this->readers.push_back(std::thread(&RemoteSolverServer::serve, this, connection));
+        }
+      }
+
+
+      void RemoteSolverServer::stop(void) {
+        if (this->stopping.exchange(true))
+          return;
+        triton::utils::shutdownSocket(this->listener);
+      }
+
+
+      std::map<std::string, triton::usize> RemoteSolverServer::getStatistics(void) {
+        std::map<std::string, triton::usize> stats;
+        std::lock_guard<std::mutex> lock(this->mutex);
+
+        stats["requests"]  = this->requests;
+        stats["cacheHits"] = this->cacheHits;
+
+        return stats;
+      }
+
+
+      /* [private method] */
+      void RemoteSolverServer::serve(std::shared_ptr<Connection> connection) {
+        std::string payload;
+
+        try {
+          while (triton::utils::recvFrame(connection->socket, payload)) {
+            triton::usize offset         = 0;
+            triton::usize id             = triton::utils::readVarint(payload, offset);
+            triton::uint32 timeout       = static_cast<triton::uint32>(triton::utils::readVarint(payload, offset));
+            triton::uint32 resourceLimit = static_cast<triton::uint32>(triton::utils::readVarint(payload, offset));
+            std::string formula          = triton::utils::readString(payload, offset);
+
+            /* The job holds the connection, the socket stays open until the last response is sent */
+            this->pool.submit([this, connection, id, formula, timeout, resourceLimit]() {
+              this->answer(connection, id, formula, timeout, resourceLimit);
+            });
+          }
+        }
+        catch (const triton::exceptions::Exception&) {
+          /* A malformed request ends the connection */
+          triton::utils::shutdownSocket(connection->socket);
+        }
+      }
+
+
+      /* [private method] */
+      void RemoteSolverServer::answer(std::shared_ptr<Connection> connection, triton::usize id, const std::string& formula, triton::uint32 timeout, triton::uint32 resourceLimit) {
+        RemoteResult result(triton::engines::solver::UNKNOWN, std::map<triton::uint32, SolverModel>());
+        bool cached = false;
+        std::string payload;
+
+        {
+          std::lock_guard<std::mutex> lock(this->mutex);
+          this->requests++;
+          auto it = this->cache.find(formula);
+          if (it != this->cache.end()) {
+            result = it->second;
+            cached = true;
+            this->cacheHits++;
+          }
+        }
+
+        if (!cached) {
+          try {
+            result.first = SolverEngine::solveSmt2Formula(formula, timeout, resourceLimit, result.second);
+          }
+          catch (const z3::exception&) {
+            result.first = triton::engines::solver::UNKNOWN;
+          }
+          catch (const triton::exceptions::Exception&) {
+            result.first = triton::engines::solver::UNKNOWN;
+          }
+
+          /* Undecided queries may succeed with other limits */
+          if (result.first != triton::engines::solver::UNKNOWN && this->cacheSize > 0) {
+            std::lock_guard<std::mutex> lock(this->mutex);
+            if (this->cache.size() >= this->cacheSize)
+              this->cache.clear();
+            this->cache[formula] = result;
+          }
+        }
+
+        triton::utils::writeVarint(payload, id);
+        triton::utils::writeVarint(payload, result.first);
+        triton::utils::writeVarint(payload, result.second.size());
+        for (auto it = result.second.begin(); it != result.second.end(); it++) {
+          std::ostringstream value;
+          value << it->second.getValue();
+          triton::utils::writeString(payload, it->second.getName());
+          triton::utils::writeString(payload, value.str());
+        }
+
+        std::lock_guard<std::mutex> lock(connection->mutex);
+        triton::utils::sendFrame(connection->socket, payload);
+      }
+
+    };
+  };
+};
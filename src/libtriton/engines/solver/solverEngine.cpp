@@ -5,11 +5,30 @@
 **  This program is under the terms of the BSD License.
 */
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <limits>
+#include <memory>
+#include <random>
+#include <set>
+#include <string>
+#include <thread>
+
+#include <api.hpp>
 #include <ast.hpp>
-#include <astRepresentation.hpp>
+#include <boolectorBackend.hpp>
+#include <coreUtils.hpp>
+#include <astEvaluator.hpp>
+#include <astSmtRepresentation.hpp>
+#include <astTraversal.hpp>
 #include <exceptions.hpp>
 #include <solverEngine.hpp>
+#include <perfCounters.hpp>
+#include <traceEvents.hpp>
 #include <tritonToZ3Ast.hpp>
+#include <z3Backend.hpp>
+#include <z3ContextPool.hpp>
 #include <z3Result.hpp>
 
 
@@ -87,6 +106,19 @@ For example, if there are two symbolic variables in your constraint, the triton:
   }
 ~~~~~~~~~~~~~
 
+\section solver_interface_backends Solver backends
+<hr>
+
+Queries are solved by Z3 by default. When Triton is built with `-DBOOLECTOR=ON`, triton::API::setSolverBackend() selects Boolector
+(triton::engines::solver::BOOLECTOR) for the single model queries of triton::API::getModel(). Their ASTs are then translated directly to
+Boolector's nodes (triton::engines::solver::BoolectorBackend), without SMT2 text.
+
+With triton::engines::solver::PORTFOLIO, which does not need Boolector, the query is solved on one thread per core (see
+triton::API::setSolverPortfolioSize()) by Z3 with different tactics (the default solver, `qfbv` and `smt`) and random seeds, and by Boolector
+if it is built. The first answer is taken and the other solvers are interrupted, so the latency of a query is the one of its fastest
+configuration. A configuration which fails (e.g. a tactic which does not support arrays) is ignored. The enumeration of several models,
+the asynchronous queries and the solver session always use Z3. New backends implement the triton::engines::solver::SolverBackend interface.
+
 */
 
 
@@ -105,48 +137,89 @@ namespace triton {
       }
 
 
-      SolverEngine::SolverEngine(triton::engines::symbolic::SymbolicEngine* symbolicEngine) {
-        if (symbolicEngine == nullptr)
-          throw triton::exceptions::SolverEngine("SolverEngine::SolverEngine(): The symbolicEngine API cannot be null.");
-        this->symbolicEngine = symbolicEngine;
-      }
+      /* A part of the model space: the `bits` high bits of `variable` are equal to `value` */
+      struct ModelSpacePart {
+        std::string variable;
+        triton::uint32 size;
+        triton::uint32 bits;
+        triton::uint32 value;
+      };
 
 
-      SolverEngine::~SolverEngine() {
+      /* Takes one model from the shared limit, returns false if the limit is reached */
+      static bool takeModel(std::atomic<triton::uint32>& remaining) {
+        triton::uint32 current = remaining.load();
+
+        while (current > 0) {
+          if (remaining.compare_exchange_weak(current, current - 1))
+            return true;
+        }
+
+        return false;
       }
 
 
-      std::list<std::map<triton::uint32, SolverModel>> SolverEngine::getModels(triton::ast::AbstractNode* node, triton::uint32 limit) const {
-        std::list<std::map<triton::uint32, SolverModel>> ret;
-        std::ostringstream formula;
-        z3::context ctx;
-        z3::solver solver(ctx);
-        triton::uint32 representationMode = triton::ast::representations::astRepresentation.getMode();
+      /* Sets the limits of a solver, 0 if unlimited */
+      static void setLimits(z3::context& ctx, z3::solver& solver, triton::uint32 timeout, triton::uint32 resourceLimit) {
+        z3::params params(ctx);
 
-        if (node == nullptr)
-          throw triton::exceptions::SolverEngine("SolverEngine::getModels(): node cannot be null.");
+        if (timeout)
+          params.set("timeout", timeout);
 
-        /* Switch into the SMT mode */
-        triton::ast::representations::astRepresentation.setMode(triton::ast::representations::SMT_REPRESENTATION);
+        if (resourceLimit)
+          params.set("rlimit", resourceLimit);
 
-        /* First, set the QF_AUFBV flag  */
-        formula << "(set-logic QF_BV)";
+        solver.set(params);
+      }
+
+
+      /* Converts a Z3 result */
+      static triton::engines::solver::status_e getStatus(z3::check_result result) {
+        switch (result) {
+          case z3::sat:   return triton::engines::solver::SAT;
+          case z3::unsat: return triton::engines::solver::UNSAT;
+          default:        return triton::engines::solver::UNKNOWN;
+        }
+      }
 
-        /* Then, delcare all symbolic variables */
-        formula << this->symbolicEngine->getVariablesDeclaration();
 
-        /* And concat the user expression */
-        formula << this->symbolicEngine->getFullAst(node);
+      /* Enumerates the models of an SMT2 formula, on its own Z3 context, until `remaining` models have been taken. Returns the status of the first check. */
+      static triton::engines::solver::status_e enumerateModels(const std::string& formula, const ModelSpacePart* part, bool keepEmpty, triton::uint32 timeout, triton::uint32 resourceLimit, std::atomic<triton::uint32>& remaining, std::list<std::map<triton::uint32, SolverModel>>& models) {
+        triton::engines::solver::status_e status = triton::engines::solver::UNKNOWN;
+        bool first = true;
+        z3::context ctx;
+        z3::solver solver(ctx);
+
+        setLimits(ctx, solver, timeout, resourceLimit);
 
         /* Create the context and AST */
-        Z3_ast ast = Z3_parse_smtlib2_string(ctx, formula.str().c_str(), 0, 0, 0, 0, 0, 0);
+        Z3_ast ast = Z3_parse_smtlib2_string(ctx, formula.c_str(), 0, 0, 0, 0, 0, 0);
         z3::expr eq(ctx, ast);
 
         /* Create a solver and add the expression */
         solver.add(eq);
 
+        /* Restrict the solver to its part of the model space */
+        if (part != nullptr && part->bits > 0) {
+          z3::expr var = ctx.bv_const(part->variable.c_str(), part->size);
+          solver.add(var.extract(part->size - 1, part->size - part->bits) == ctx.bv_val(part->value, part->bits));
+        }
+
         /* Check if it is sat */
-        while (solver.check() == z3::sat && limit >= 1) {
+        while (remaining.load() > 0) {
+          z3::check_result result = solver.check();
+
+          if (first) {
+            status = getStatus(result);
+            first  = false;
+          }
+
+          if (result != z3::sat)
+            break;
+
+          /* Other parts may have reached the limit meanwhile */
+          if (!takeModel(remaining))
+            break;
 
           /* Get model */
           z3::model m = solver.get_model();
@@ -158,59 +231,1546 @@ namespace triton {
 
             /* Get the z3 variable */
             z3::func_decl z3Variable = m[i];
+            triton::uint32 id = 0;
 
-            /* Get the name as std::string from a z3 variable */
-            std::string varName = z3Variable.name().str();
+            /* Only the symbolic variables are read, by their id (e.g. arrays are not) */
+            if (!Z3Backend::getVariableId(z3Variable, id))
+              continue;
 
             /* Get z3 expr */
             z3::expr exp = m.get_const_interp(z3Variable);
 
-            /* Get the size of a z3 expr */
-            triton::uint32 bvSize = exp.get_sort().bv_size();
+            /* Map the result, values up to 64 bits do not go through a string */
+            smodel[id] = SolverModel(id, Z3Backend::getValue(exp));
+
+            /* Uniq result, the numeral of the model is reused */
+            args.push_back(z3Variable() != exp);
+
+          }
+
+          /* If there is model available */
+          if (smodel.size() > 0 || keepEmpty)
+            models.push_back(smodel);
+
+          /* There is no other model to escape to */
+          if (args.size() == 0)
+            break;
+
+          /* Escape last models */
+          solver.add(triton::engines::solver::mk_or(args));
+        }
+
+        return status;
+      }
+
+
+      SolverEngine::SolverEngine(triton::engines::symbolic::SymbolicEngine* symbolicEngine) {
+        if (symbolicEngine == nullptr)
+          throw triton::exceptions::SolverEngine("SolverEngine::SolverEngine(): The symbolicEngine API cannot be null.");
+        this->symbolicEngine    = symbolicEngine;
+        this->sessionTranslator = nullptr;
+        this->session           = nullptr;
+        this->queryCacheHits    = 0;
+        this->decidedQueries    = 0;
+        this->prunedQueries     = 0;
+        this->narrowedNodes     = 0;
+        this->queryCacheMisses  = 0;
+        this->modelCacheHits    = 0;
+        this->queries           = 0;
+        this->queriesTime       = 0;
+        this->timeout           = 0;
+        this->resourceLimit     = 0;
+        this->localSearchBudget = 64;
+        this->backend           = triton::engines::solver::Z3;
+        this->portfolioSize     = 0;
+        this->status            = triton::engines::solver::UNKNOWN;
+        this->workerPool        = nullptr;
+        this->nextAsyncQuery    = 0;
+        this->remote            = nullptr;
+
+        for (triton::uint32 index = 0; index <= triton::engines::solver::UNKNOWN; index++)
+          this->queriesByStatus[index] = 0;
+      }
+
+
+      SolverEngine::~SolverEngine() {
+        this->stopSession();
+
+        /* Queries which have not started are dropped */
+        delete this->workerPool;
+        this->asyncQueries.clear();
+
+        delete this->remote;
+      }
+
+
+      triton::engines::solver::status_e SolverEngine::solveSmt2Formula(const std::string& formula, triton::uint32 timeout, triton::uint32 resourceLimit, std::map<triton::uint32, SolverModel>& model) {
+        std::list<std::map<triton::uint32, SolverModel>> models;
+        std::atomic<triton::uint32> remaining(1);
 
-            /* Get the value of a z3 expr */
-            std::string svalue = Z3_get_numeral_string(ctx, exp);
+        triton::engines::solver::status_e status = enumerateModels(formula, nullptr, false, timeout, resourceLimit, remaining, models);
+        if (models.size() > 0)
+          model = models.front();
 
-            /* Convert a string value to a integer value */
-            triton::uint512 value = triton::uint512(svalue);
+        return status;
+      }
 
-            /* Create a triton model */
-            SolverModel trionModel = SolverModel(varName, value);
 
-            /* Map the result */
-            smodel[trionModel.getId()] = trionModel;
+      /* Splits a conjunction into its conjuncts */
+      static void splitConjunction(triton::ast::AbstractNode* node, std::vector<triton::ast::AbstractNode*>& conjuncts) {
+        std::vector<triton::ast::AbstractNode*> worklist;
 
-            /* Uniq result */
-            if (exp.get_sort().is_bv())
-              args.push_back(ctx.bv_const(varName.c_str(), bvSize) != ctx.bv_val(svalue.c_str(), bvSize));
+        worklist.push_back(node);
+        while (!worklist.empty()) {
+          triton::ast::AbstractNode* current = worklist.back();
+          worklist.pop_back();
 
+          if (current->getKind() != triton::ast::LAND_NODE) {
+            conjuncts.push_back(current);
+            continue;
           }
 
-          /* Escape last models */
-          solver.add(triton::engines::solver::mk_or(args));
+          /* Keep the conjuncts in their order */
+          for (auto it = current->getChilds().rbegin(); it != current->getChilds().rend(); it++)
+            worklist.push_back(*it);
+        }
+      }
+
+
+      /* Returns the root of a conjunct in the union-find forest */
+      static triton::usize findCluster(std::vector<triton::usize>& parents, triton::usize index) {
+        while (parents[index] != index) {
+          parents[index] = parents[parents[index]];
+          index = parents[index];
+        }
+        return index;
+      }
+
+
+      /* Partitions conjuncts into clusters which do not share symbolic variables. Conjuncts without variable are returned apart. */
+      static std::vector<std::vector<triton::ast::AbstractNode*>> getIndependentClusters(const std::vector<triton::ast::AbstractNode*>& conjuncts, std::vector<triton::ast::AbstractNode*>& constants) {
+        std::vector<std::vector<triton::ast::AbstractNode*>> clusters;
+        std::map<std::string, triton::usize> owners;
+        std::map<triton::usize, triton::usize> indexes;
+        std::vector<triton::usize> parents;
+        std::vector<bool> hasVariables;
+
+        for (triton::usize index = 0; index < conjuncts.size(); index++) {
+          std::vector<triton::ast::AbstractNode*> nodes;
+
+          parents.push_back(index);
+          hasVariables.push_back(false);
+
+          triton::ast::nodesExtraction(nodes, conjuncts[index]);
+          for (auto it = nodes.begin(); it != nodes.end(); it++) {
+            std::string name;
+
+            /* The cells of an array are unknowns shared by the conjuncts which use the array */
+            if ((*it)->getKind() == triton::ast::VARIABLE_NODE)
+              name = reinterpret_cast<triton::ast::VariableNode*>(*it)->getValue();
+            else if ((*it)->getKind() == triton::ast::ARRAY_NODE)
+              name = "array!" + reinterpret_cast<triton::ast::ArrayNode*>(*it)->getName();
+            else
+              continue;
+
+            hasVariables[index] = true;
+
+            /* The first conjunct using a variable owns it, the next ones are merged with it */
+            auto owner = owners.find(name);
+            if (owner == owners.end())
+              owners[name] = index;
+            else
+              parents[findCluster(parents, index)] = findCluster(parents, owner->second);
+          }
+        }
+
+        for (triton::usize index = 0; index < conjuncts.size(); index++) {
+          if (!hasVariables[index]) {
+            constants.push_back(conjuncts[index]);
+            continue;
+          }
+
+          triton::usize root = findCluster(parents, index);
+          if (indexes.find(root) == indexes.end()) {
+            indexes[root] = clusters.size();
+            clusters.push_back(std::vector<triton::ast::AbstractNode*>());
+          }
+          clusters[indexes[root]].push_back(conjuncts[index]);
+        }
+
+        return clusters;
+      }
+
+
+      /* Returns the mask of a bitvector of `size` bits */
+      static triton::uint512 bitvectorMask(triton::uint32 size) {
+        triton::uint512 mask = -1;
+        return (mask >> (512 - size));
+      }
+
+
+      /* Returns a random value of `size` bits */
+      static triton::uint512 randomValue(std::mt19937_64& generator, triton::uint32 size) {
+        triton::uint512 value = 0;
+
+        for (triton::uint32 bits = 0; bits < size; bits += 64)
+          value = ((value << 64) | generator());
+
+        return (value & bitvectorMask(size));
+      }
+
+
+      /* Mutates a value of `size` bits: a bit flip, a small increment or decrement, or a random value */
+      static triton::uint512 mutateValue(std::mt19937_64& generator, const triton::uint512& value, triton::uint32 size) {
+        triton::uint512 one = 1;
+
+        switch (generator() % 4) {
+          case 0:
+          case 1:
+            return (value ^ (one << static_cast<triton::uint32>(generator() % size)));
+          case 2:
+            if (generator() % 2)
+              return ((value + (generator() % 16) + 1) & bitvectorMask(size));
+            return ((value - (generator() % 16) - 1) & bitvectorMask(size));
+          default:
+            return randomValue(generator, size);
+        }
+      }
+
+
+      /* Returns the key of a constraint in the database of unsat cores, the SMT2 representation of its full AST */
+      static std::string getConstraintKey(triton::ast::AbstractNode* node) {
+        triton::ast::representations::AstSmtRepresentation smt;
+        std::ostringstream stream;
+
+        smt.printShared(stream, node);
+        return stream.str();
+      }
+
+
+      /* Returns true if two entries of models give the same value to the same variable */
+      static bool sameModelValue(const std::pair<const triton::uint32, SolverModel>& a, const std::pair<const triton::uint32, SolverModel>& b) {
+        return (a.first == b.first && a.second.getValue() == b.second.getValue());
+      }
+
+
+      std::list<std::map<triton::uint32, SolverModel>> SolverEngine::getModels(triton::ast::AbstractNode* node, triton::uint32 limit, triton::uint32 threads) const {
+        triton::uint64 start = triton::utils::getMonotonicTime();
+        triton::utils::PerfScope perf(triton::utils::PERF_SOLVER);
+        std::list<std::map<triton::uint32, SolverModel>> ret = this->computeModels(node, limit, threads);
+        this->recordQuery(start, node);
+        return ret;
+      }
+
+
+      /* [private method] Enumerates models, in parallel if asked, see getModels() */
+      std::list<std::map<triton::uint32, SolverModel>> SolverEngine::computeModels(triton::ast::AbstractNode* node, triton::uint32 limit, triton::uint32 threads) const {
+        triton::engines::symbolic::SymbolicVariable* variable = nullptr;
+
+        if (node == nullptr)
+          throw triton::exceptions::SolverEngine("SolverEngine::computeModels(): node cannot be null.");
+
+        if (this->isDecidedUnsat(node)) {
+          this->status = triton::engines::solver::UNSAT;
+          return std::list<std::map<triton::uint32, SolverModel>>();
+        }
+
+        triton::ast::AbstractNode* fullAst = this->narrowBitvectors(this->symbolicEngine->getFullAst(node));
+        std::string assertion = this->getAssertion(fullAst);
+
+        if (threads <= 1 || limit <= 1)
+          return this->solveFormula(assertion, limit);
+
+        /* The model space is split on the largest variable of the constraint */
+        std::vector<triton::ast::AbstractNode*> nodes;
+        triton::ast::nodesExtraction(nodes, fullAst);
+        for (auto it = nodes.begin(); it != nodes.end(); it++) {
+          if ((*it)->getKind() != triton::ast::VARIABLE_NODE)
+            continue;
+          triton::engines::symbolic::SymbolicVariable* symVar = this->symbolicEngine->getSymbolicVariableFromId(reinterpret_cast<triton::ast::VariableNode*>(*it)->getVariableId());
+          if (symVar != nullptr && (variable == nullptr || symVar->getSize() > variable->getSize()))
+            variable = symVar;
+        }
+
+        if (variable == nullptr)
+          return this->solveFormula(assertion, limit);
+
+        return this->enumerateInParallel(assertion, limit, *variable, threads);
+      }
 
-          /* If there is model available */
-          if (smodel.size() > 0)
-            ret.push_back(smodel);
 
-          /* Decrement the limit */
-          limit--;
+      /* [private method] Returns the SMT2 assertion of a full AST, shared nodes are bound once */
+      std::string SolverEngine::getAssertion(triton::ast::AbstractNode* fullAst) const {
+        triton::ast::representations::AstSmtRepresentation smt;
+        std::vector<triton::ast::AbstractNode*> nodes;
+        std::set<std::string> arrays;
+        std::ostringstream assertion;
+
+        /* Arrays are not symbolic variables, the assertion declares them */
+        triton::ast::nodesExtraction(nodes, fullAst);
+        for (auto it = nodes.begin(); it != nodes.end(); it++) {
+          if ((*it)->getKind() != triton::ast::ARRAY_NODE)
+            continue;
+          triton::ast::ArrayNode* array = reinterpret_cast<triton::ast::ArrayNode*>(*it);
+          if (arrays.insert(array->getName()).second)
+            assertion << "(declare-fun " << array->getName() << " () (Array (_ BitVec " << array->getIndexSize() << ") (_ BitVec 8)))";
         }
 
-        /* Restore the representation mode */
-        triton::ast::representations::astRepresentation.setMode(representationMode);
+        smt.printShared(assertion, fullAst);
+
+        return assertion.str();
+      }
+
+
+      /* [private method] Solves an SMT2 assertion over the declared symbolic variables, single model queries go through the cache */
+      std::list<std::map<triton::uint32, SolverModel>> SolverEngine::solveFormula(const std::string& assertion, triton::uint32 limit, bool keepEmpty, triton::uint32 timeout, const std::vector<triton::ast::AbstractNode*>* conjuncts) const {
+        std::map<triton::uint32, SolverModel> model;
+        std::list<std::map<triton::uint32, SolverModel>> ret;
+
+        if (limit != 1)
+          return this->checkFormula(assertion, limit, keepEmpty, timeout);
+
+        /* The assertion is the canonical form of the query, it is hashed by the map and compared on collisions */
+        auto it = this->queryCache.find(assertion);
+        if (it != this->queryCache.end()) {
+          this->queryCacheHits++;
+          ret = it->second;
+          this->status = (ret.size() > 0 ? triton::engines::solver::SAT : triton::engines::solver::UNSAT);
+        }
+        else {
+          this->queryCacheMisses++;
+
+          /* A model found by the local search does not need the solver */
+          if (conjuncts != nullptr && this->searchModel(*conjuncts, model)) {
+            ret.push_back(model);
+            this->status = triton::engines::solver::SAT;
+          }
+
+          /* Asserted conjunctions go to the selected backend */
+          else if (conjuncts != nullptr && this->backend != triton::engines::solver::Z3)
+            ret = this->checkWithBackend(*conjuncts, timeout);
+
+          /* Empty models are kept, they tell sat from unsat */
+          else
+            ret = this->checkFormula(assertion, limit, true, timeout);
+
+          if (ret.size() > 0 && ret.front().size() > 0)
+            this->recordModel(ret.front());
+
+          /* Undecided queries may succeed with other limits */
+          if (this->status != triton::engines::solver::UNKNOWN) {
+            if (this->queryCache.size() >= SolverEngine::maxQueryCacheEntries)
+              this->queryCache.clear();
+            this->queryCache[assertion] = ret;
+          }
+        }
+
+        if (!keepEmpty && ret.size() > 0 && ret.front().size() == 0)
+          ret.clear();
+
+        return ret;
+      }
+
+
+      /* [private method] Looks for a model of a conjunction by mutating the concrete values of its symbolic variables */
+      bool SolverEngine::searchModel(const std::vector<triton::ast::AbstractNode*>& conjuncts, std::map<triton::uint32, SolverModel>& model) const {
+        std::vector<triton::uint512> seed;
+        std::mt19937_64 generator;
+
+        if ((this->localSearchBudget == 0 && this->recentModels.empty()) || conjuncts.empty())
+          return false;
+
+        try {
+          triton::ast::AstEvaluator evaluator(conjuncts);
+          const std::vector<triton::engines::symbolic::SymbolicVariable*>& variables = evaluator.getVariables();
+
+          if (variables.empty())
+            return false;
+
+          for (auto it = variables.begin(); it != variables.end(); it++)
+            seed.push_back((*it)->getConcreteValue() & bitvectorMask((*it)->getSize()));
+
+          /* Branch flips are often satisfied by a model of a previous query, the variables it does not define keep their concrete value */
+          for (auto recent = this->recentModels.begin(); recent != this->recentModels.end(); recent++) {
+            std::vector<triton::uint512> candidate = seed;
+            bool defined = false;
+            bool sat = true;
+
+            for (triton::usize index = 0; index < variables.size(); index++) {
+              auto value = recent->find(static_cast<triton::uint32>(variables[index]->getId()));
+              if (value != recent->end()) {
+                candidate[index] = value->second.getValue() & bitvectorMask(variables[index]->getSize());
+                defined = true;
+              }
+            }
+
+            if (!defined)
+              continue;
+
+            evaluator.execute(candidate);
+            for (triton::usize index = 0; index < conjuncts.size() && sat; index++)
+              sat = (evaluator.getValue(index) != 0);
+
+            if (sat) {
+              model.clear();
+              for (triton::usize index = 0; index < variables.size(); index++)
+                model[static_cast<triton::uint32>(variables[index]->getId())] = SolverModel(static_cast<triton::uint32>(variables[index]->getId()), candidate[index]);
+              this->recentModels.splice(this->recentModels.begin(), this->recentModels, recent);
+              this->modelCacheHits++;
+              return true;
+            }
+          }
+
+          /* The first candidate is the current concrete state, the next ones are mutations of it */
+          for (triton::uint32 iteration = 0; iteration < this->localSearchBudget; iteration++) {
+            std::vector<triton::uint512> candidate = seed;
+            bool sat = true;
+
+            if (iteration > 0) {
+              triton::uint32 mutations = static_cast<triton::uint32>(generator() % 3) + 1;
+              for (triton::uint32 index = 0; index < mutations; index++) {
+                triton::usize variable = static_cast<triton::usize>(generator() % variables.size());
+                candidate[variable] = mutateValue(generator, candidate[variable], variables[variable]->getSize());
+              }
+            }
+
+            evaluator.execute(candidate);
+            for (triton::usize index = 0; index < conjuncts.size() && sat; index++)
+              sat = (evaluator.getValue(index) != 0);
+
+            if (sat) {
+              model.clear();
+              for (triton::usize index = 0; index < variables.size(); index++)
+                model[static_cast<triton::uint32>(variables[index]->getId())] = SolverModel(static_cast<triton::uint32>(variables[index]->getId()), candidate[index]);
+              return true;
+            }
+          }
+        }
+        /* ASTs which cannot be compiled (e.g. let bindings) are left to the solver */
+        catch (const triton::exceptions::Ast& e) {
+          return false;
+        }
+
+        return false;
+      }
+
+
+      /* [private method] The model cache is a short MRU list, a model found again is moved to its front */
+      void SolverEngine::recordModel(const std::map<triton::uint32, SolverModel>& model) const {
+        for (auto it = this->recentModels.begin(); it != this->recentModels.end(); it++) {
+          if (it->size() == model.size() && std::equal(it->begin(), it->end(), model.begin(), sameModelValue)) {
+            this->recentModels.splice(this->recentModels.begin(), this->recentModels, it);
+            return;
+          }
+        }
+
+        this->recentModels.push_front(model);
+        if (this->recentModels.size() > SolverEngine::maxRecentModels)
+          this->recentModels.pop_back();
+      }
+
+
+      /* [private method] Returns the SMT2 formula of an assertion over the declared symbolic variables */
+      std::string SolverEngine::getFormula(const std::string& assertion) const {
+        std::ostringstream formula;
+
+        /* First, set the logic, QF_ABV if the assertion declares arrays */
+        formula << (assertion.find("(Array ") != std::string::npos ? "(set-logic QF_ABV)" : "(set-logic QF_BV)");
+
+        /* Then, delcare all symbolic variables */
+        formula << this->symbolicEngine->getVariablesDeclaration();
+
+        /* And concat the assertion */
+        formula << assertion;
+
+        return formula.str();
+      }
+
+
+      /* [private method] Sends an SMT2 assertion to the solver */
+      std::list<std::map<triton::uint32, SolverModel>> SolverEngine::checkFormula(const std::string& assertion, triton::uint32 limit, bool keepEmpty, triton::uint32 timeout) const {
+        std::list<std::map<triton::uint32, SolverModel>> ret;
+        std::atomic<triton::uint32> remaining(limit);
+
+        /* A single model is asked to the daemon, the enumeration stays local */
+        if (this->remote != nullptr && limit == 1) {
+          RemoteResult result = this->remote->wait(this->remote->submit(this->getFormula(assertion), (timeout ? timeout : this->timeout), this->resourceLimit));
+          this->status = result.first;
+          if (result.first == triton::engines::solver::SAT && (result.second.size() > 0 || keepEmpty))
+            ret.push_back(result.second);
+          return ret;
+        }
+
+        this->status = enumerateModels(this->getFormula(assertion), nullptr, keepEmpty, (timeout ? timeout : this->timeout), this->resourceLimit, remaining, ret);
+
+        return ret;
+      }
+
+
+      /* Solves a conjunction with every backend, each one on its own thread, and keeps the first decided answer */
+      static triton::engines::solver::status_e raceBackends(const std::vector<SolverBackend*>& backends, const std::vector<triton::ast::AbstractNode*>& conjuncts, triton::uint32 timeout, triton::uint32 resourceLimit, std::map<triton::uint32, SolverModel>& model) {
+        std::vector<triton::engines::solver::status_e> status(backends.size(), triton::engines::solver::UNKNOWN);
+        std::vector<std::map<triton::uint32, SolverModel>> models(backends.size());
+        std::vector<std::string> errors(backends.size());
+        std::vector<std::thread> workers;
+        std::atomic<triton::sint32> winner(-1);
+
+        /* The references of the ASTs are unrolled through the API of the caller */
+        triton::API* api = &triton::getCurrentApi();
+
+        for (triton::uint32 index = 0; index < backends.size(); index++) {
+          workers.push_back(std::thread([&, index]() {
+            api->bind();
+            try {
+              status[index] = backends[index]->solve(conjuncts, timeout, resourceLimit, models[index]);
+            }
+            catch (const triton::exceptions::Exception& e) {
+              errors[index] = backends[index]->getName() + ": " + e.what();
+            }
+            catch (const z3::exception& e) {
+              errors[index] = backends[index]->getName() + ": " + e.msg();
+            }
+
+            /* The first backend which decides stops the other ones */
+            triton::sint32 none = -1;
+            if (status[index] != triton::engines::solver::UNKNOWN && winner.compare_exchange_strong(none, index)) {
+              for (triton::uint32 other = 0; other < backends.size(); other++) {
+                if (other != index)
+                  backends[other]->interrupt();
+              }
+            }
+          }));
+        }
+
+        for (auto it = workers.begin(); it != workers.end(); it++)
+          it->join();
+
+        if (winner.load() >= 0) {
+          model = models[winner.load()];
+          return status[winner.load()];
+        }
+
+        /* A backend failed and no other one has decided */
+        for (auto it = errors.begin(); it != errors.end(); it++) {
+          if (!it->empty())
+            throw triton::exceptions::SolverEngine("SolverEngine::checkWithBackend(): " + *it);
+        }
+
+        return triton::engines::solver::UNKNOWN;
+      }
+
+
+      /* The Z3 tactics of the portfolio: the default solver, bit-blasting and the SMT core */
+      static const char* portfolioTactics[] = {"", "qfbv", "smt"};
+
+
+      /* [private method] Solves a conjunction with the selected backend, see setBackend() */
+      std::list<std::map<triton::uint32, SolverModel>> SolverEngine::checkWithBackend(const std::vector<triton::ast::AbstractNode*>& conjuncts, triton::uint32 timeout) const {
+        std::list<std::map<triton::uint32, SolverModel>> ret;
+        std::map<triton::uint32, SolverModel> model;
+
+        if (timeout == 0)
+          timeout = this->timeout;
+
+        if (this->backend == triton::engines::solver::BOOLECTOR) {
+          #ifdef TRITON_BOOLECTOR
+          BoolectorBackend boolector(this->symbolicEngine);
+          this->status = boolector.solve(conjuncts, timeout, this->resourceLimit, model);
+          #else
+          throw triton::exceptions::SolverEngine("SolverEngine::checkWithBackend(): Triton has been built without Boolector.");
+          #endif
+        }
+
+        else {
+          std::vector<std::unique_ptr<SolverBackend>> portfolio;
+          std::vector<SolverBackend*> backends;
+          triton::uint32 size = this->portfolioSize;
+
+          if (size == 0)
+            size = std::thread::hardware_concurrency();
+
+          #ifdef TRITON_BOOLECTOR
+          portfolio.push_back(std::unique_ptr<SolverBackend>(new BoolectorBackend(this->symbolicEngine)));
+          #endif
+
+          /* The other threads run Z3 with a tactic and a seed which differ from the previous ones */
+          const triton::uint32 tactics = sizeof(portfolioTactics) / sizeof(portfolioTactics[0]);
+          for (triton::uint32 index = 0; portfolio.size() < std::max<triton::uint32>(size, 2); index++)
+            portfolio.push_back(std::unique_ptr<SolverBackend>(new Z3Backend(this->symbolicEngine, portfolioTactics[index % tactics], index / tactics)));
+
+          for (auto it = portfolio.begin(); it != portfolio.end(); it++)
+            backends.push_back(it->get());
+
+          this->status = raceBackends(backends, conjuncts, timeout, this->resourceLimit, model);
+        }
+
+        if (this->status == triton::engines::solver::SAT)
+          ret.push_back(model);
+
+        return ret;
+      }
+
+
+      /* [private method] Enumerates models on parts of the model space, one thread and one Z3 context per part */
+      std::list<std::map<triton::uint32, SolverModel>> SolverEngine::enumerateInParallel(const std::string& assertion, triton::uint32 limit, const triton::engines::symbolic::SymbolicVariable& variable, triton::uint32 threads) const {
+        std::list<std::map<triton::uint32, SolverModel>> ret;
+        std::atomic<triton::uint32> remaining(limit);
+        triton::uint32 bits = 0;
+
+        /* The formula is built once, AST nodes cannot be created by the workers */
+        std::string formula = this->getFormula(assertion);
+
+        /* The model space is split on the high bits of the variable */
+        while ((2U << bits) <= threads && bits < variable.getSize() && bits < 16)
+          bits++;
+
+        std::vector<ModelSpacePart> parts(1U << bits);
+        std::vector<std::list<std::map<triton::uint32, SolverModel>>> models(parts.size());
+        std::vector<triton::engines::solver::status_e> status(parts.size(), triton::engines::solver::UNKNOWN);
+        std::vector<std::string> errors(parts.size());
+        std::vector<std::thread> workers;
+
+        for (triton::uint32 index = 0; index < parts.size(); index++) {
+          parts[index].variable = variable.getName();
+          parts[index].size     = variable.getSize();
+          parts[index].bits     = bits;
+          parts[index].value    = index;
+          workers.push_back(std::thread([&, index]() {
+            try {
+              status[index] = enumerateModels(formula, &parts[index], false, this->timeout, this->resourceLimit, remaining, models[index]);
+            }
+            catch (const z3::exception& e) {
+              errors[index] = e.msg();
+            }
+          }));
+        }
+
+        for (auto it = workers.begin(); it != workers.end(); it++)
+          it->join();
+
+        /* The constraint is sat if a part is, unsat if every part is */
+        this->status = triton::engines::solver::UNSAT;
+        for (triton::uint32 index = 0; index < parts.size(); index++) {
+          if (!errors[index].empty())
+            throw triton::exceptions::SolverEngine("SolverEngine::enumerateInParallel(): " + errors[index]);
+          if (status[index] == triton::engines::solver::SAT || (status[index] == triton::engines::solver::UNKNOWN && this->status == triton::engines::solver::UNSAT))
+            this->status = status[index];
+          ret.splice(ret.end(), models[index]);
+        }
 
         return ret;
       }
 
 
-      std::map<triton::uint32, SolverModel> SolverEngine::getModel(triton::ast::AbstractNode* node) const {
+      std::map<triton::uint32, SolverModel> SolverEngine::getModel(triton::ast::AbstractNode* node, triton::uint32 timeout) const {
+        triton::uint64 start = triton::utils::getMonotonicTime();
+        triton::utils::PerfScope perf(triton::utils::PERF_SOLVER);
+        std::map<triton::uint32, SolverModel> ret = this->computeModel(node, timeout);
+        this->recordQuery(start, node);
+        return ret;
+      }
+
+
+      std::map<triton::uint32, SolverModel> SolverEngine::getPartialModel(triton::ast::AbstractNode* node, const std::vector<triton::engines::symbolic::SymbolicVariable*>& freeVariables, triton::uint32 timeout) const {
+        triton::uint64 start = triton::utils::getMonotonicTime();
+        triton::utils::PerfScope perf(triton::utils::PERF_SOLVER);
+        std::set<triton::usize> ids;
+
+        if (node == nullptr)
+          throw triton::exceptions::SolverEngine("SolverEngine::getPartialModel(): node cannot be null.");
+
+        for (auto it = freeVariables.begin(); it != freeVariables.end(); it++) {
+          if (*it == nullptr)
+            throw triton::exceptions::SolverEngine("SolverEngine::getPartialModel(): A free variable cannot be null.");
+          ids.insert((*it)->getId());
+        }
+
+        std::map<triton::uint32, SolverModel> ret = this->computeModel(this->concretizeVariables(node, ids), timeout);
+        this->recordQuery(start, node);
+        return ret;
+      }
+
+
+      /* [private method] Concretizes the variables which are not free, see getPartialModel() */
+      triton::ast::AbstractNode* SolverEngine::concretizeVariables(triton::ast::AbstractNode* node, const std::set<triton::usize>& freeVariables) const {
+        std::unordered_map<triton::ast::AbstractNode*, triton::ast::AbstractNode*> concretized;
+        std::vector<triton::ast::AbstractNode*> nodes;
+        triton::ast::AbstractNode* fullAst = this->symbolicEngine->getFullAst(node);
+        const triton::ast::VariableSet* free = triton::ast::VariableSet::fromIds(std::vector<triton::usize>(freeVariables.begin(), freeVariables.end()));
+
+        /* The full AST has no reference, children come before their parents */
+        triton::ast::nodesExtraction(nodes, fullAst);
+
+        for (auto it = nodes.begin(); it != nodes.end(); it++) {
+          triton::ast::AbstractNode* current = *it;
+          triton::ast::AbstractNode* result  = current;
+
+          if (current->getKind() == triton::ast::VARIABLE_NODE) {
+            const triton::engines::symbolic::SymbolicVariable* var = this->symbolicEngine->getSymbolicVariableFromId(reinterpret_cast<triton::ast::VariableNode*>(current)->getVariableId());
+            if (var != nullptr && freeVariables.find(var->getId()) == freeVariables.end())
+              result = triton::ast::bv(var->getConcreteValue(), current->getBitvectorSize());
+          }
+
+          /* A tree which only depends on free variables is kept */
+          else if (!triton::ast::VariableSet::isSubset(current->getVariables(), free)) {
+            std::vector<triton::ast::AbstractNode*> childs;
+            bool changed = false;
+
+            for (auto child = current->getChilds().begin(); child != current->getChilds().end(); child++) {
+              auto found = concretized.find(*child);
+              childs.push_back(found == concretized.end() ? *child : found->second);
+              changed |= (childs.back() != *child);
+            }
+
+            /* An ite on a constant condition is its taken branch, the other one is not sent to the solver */
+            if (changed && current->getKind() == triton::ast::ITE_NODE && !childs[0]->isSymbolized())
+              result = (childs[0]->evaluate() ? childs[1] : childs[2]);
+
+            else if (changed)
+              result = this->symbolicEngine->foldConcreteNode(triton::ast::newInstance(current, childs));
+          }
+
+          if (result != current)
+            concretized[current] = result;
+        }
+
+        auto root = concretized.find(fullAst);
+        return (root == concretized.end() ? fullAst : root->second);
+      }
+
+
+      /* Returns true if the low bits of a node only depend on the low bits of its operands */
+      static bool isNarrowable(enum triton::ast::kind_e kind) {
+        switch (kind) {
+          case triton::ast::BVADD_NODE:
+          case triton::ast::BVAND_NODE:
+          case triton::ast::BVMUL_NODE:
+          case triton::ast::BVNAND_NODE:
+          case triton::ast::BVNEG_NODE:
+          case triton::ast::BVNOR_NODE:
+          case triton::ast::BVNOT_NODE:
+          case triton::ast::BVOR_NODE:
+          case triton::ast::BVSUB_NODE:
+          case triton::ast::BVXNOR_NODE:
+          case triton::ast::BVXOR_NODE:
+          case triton::ast::BV_NODE:
+          case triton::ast::CONCAT_NODE:
+          case triton::ast::EXTRACT_NODE:
+          case triton::ast::ITE_NODE:
+          case triton::ast::SX_NODE:
+          case triton::ast::ZX_NODE:
+            return true;
+          default:
+            return false;
+        }
+      }
+
+
+      /* Returns the number of low bits of each child needed to compute the `demand` low bits of a node, 0 if none */
+      static std::vector<triton::uint32> getChildDemands(triton::ast::AbstractNode* node, triton::uint32 demand) {
+        std::vector<triton::ast::AbstractNode*>& childs = node->getChilds();
+        std::vector<triton::uint32> demands(childs.size(), 0);
+
+        switch (node->getKind()) {
+          case triton::ast::BV_NODE:
+            break;
+
+          case triton::ast::CONCAT_NODE:
+            /* The last child holds the low bits */
+            for (triton::usize index = childs.size(); index > 0 && demand > 0; index--) {
+              demands[index - 1] = std::min(demand, childs[index - 1]->getBitvectorSize());
+              demand -= demands[index - 1];
+            }
+            break;
+
+          case triton::ast::EXTRACT_NODE:
+            demands[2] = reinterpret_cast<triton::ast::DecimalNode*>(childs[1])->getValue().convert_to<triton::uint32>() + demand;
+            break;
+
+          case triton::ast::ITE_NODE:
+            demands[0] = childs[0]->getBitvectorSize();
+            demands[1] = demand;
+            demands[2] = demand;
+            break;
+
+          case triton::ast::SX_NODE:
+          case triton::ast::ZX_NODE:
+            demands[1] = std::min(demand, childs[1]->getBitvectorSize());
+            break;
+
+          default:
+            for (triton::usize index = 0; index < childs.size(); index++)
+              demands[index] = (isNarrowable(node->getKind()) ? demand : childs[index]->getBitvectorSize());
+            break;
+        }
+
+        return demands;
+      }
+
+
+      /* [private method] Narrows the operations of a full AST to the low bits which reach its root (e.g. the 64-bit bvadd of `((_ extract 7 0) (bvadd x y))` becomes an 8-bit bvadd) */
+      triton::ast::AbstractNode* SolverEngine::narrowBitvectors(triton::ast::AbstractNode* fullAst) const {
+        std::unordered_map<triton::ast::AbstractNode*, triton::uint32> demands;
+        std::unordered_map<triton::ast::AbstractNode*, triton::ast::AbstractNode*> narrowed;
+        std::vector<triton::ast::AbstractNode*> nodes;
+
+        /* The full AST has no reference, children come before their parents */
+        triton::ast::nodesExtraction(nodes, fullAst);
+        demands[fullAst] = fullAst->getBitvectorSize();
+
+        /* The demand of a node is the largest demand of its parents, parents are visited first */
+        for (auto it = nodes.rbegin(); it != nodes.rend(); it++) {
+          triton::ast::AbstractNode* current = *it;
+          triton::uint32& demand = demands[current];
+
+          if (demand == 0)
+            continue;
+
+          if (!isNarrowable(current->getKind()))
+            demand = current->getBitvectorSize();
+
+          std::vector<triton::uint32> childDemands = getChildDemands(current, demand);
+          for (triton::usize index = 0; index < childDemands.size(); index++) {
+            triton::uint32& childDemand = demands[current->getChilds()[index]];
+            childDemand = std::max(childDemand, childDemands[index]);
+          }
+        }
+
+        /* Returns the `size` low bits of the narrowed child */
+        auto getLowBits = [&narrowed](triton::ast::AbstractNode* child, triton::uint32 size) {
+          auto found = narrowed.find(child);
+          if (found != narrowed.end())
+            child = found->second;
+          return (child->getBitvectorSize() == size ? child : triton::ast::extract(size - 1, 0, child));
+        };
+
+        for (auto it = nodes.begin(); it != nodes.end(); it++) {
+          triton::ast::AbstractNode* current = *it;
+          triton::ast::AbstractNode* result  = current;
+          std::vector<triton::ast::AbstractNode*>& childs = current->getChilds();
+          triton::uint32 demand = demands[current];
+
+          if (demand == 0)
+            continue;
+
+          std::vector<triton::uint32> childDemands = getChildDemands(current, demand);
+
+          if (demand < current->getBitvectorSize()) {
+            switch (current->getKind()) {
+              case triton::ast::BV_NODE:
+                result = triton::ast::bv(current->evaluate() & ((triton::uint512(1) << demand) - 1), demand);
+                break;
+
+              case triton::ast::CONCAT_NODE: {
+                std::vector<triton::ast::AbstractNode*> parts;
+                for (triton::usize index = 0; index < childs.size(); index++) {
+                  if (childDemands[index] != 0)
+                    parts.push_back(getLowBits(childs[index], childDemands[index]));
+                }
+                result = (parts.size() == 1 ? parts[0] : triton::ast::concat(parts));
+                break;
+              }
+
+              case triton::ast::EXTRACT_NODE: {
+                triton::uint32 low = reinterpret_cast<triton::ast::DecimalNode*>(childs[1])->getValue().convert_to<triton::uint32>();
+                result = getLowBits(childs[2], childDemands[2]);
+                if (low != 0)
+                  result = triton::ast::extract(low + demand - 1, low, result);
+                break;
+              }
+
+              case triton::ast::SX_NODE:
+              case triton::ast::ZX_NODE:
+                result = getLowBits(childs[1], childDemands[1]);
+                if (demand > childDemands[1])
+                  result = (current->getKind() == triton::ast::SX_NODE ? triton::ast::sx(demand - childDemands[1], result) : triton::ast::zx(demand - childDemands[1], result));
+                break;
+
+              default: {
+                std::vector<triton::ast::AbstractNode*> newChilds;
+                for (triton::usize index = 0; index < childs.size(); index++)
+                  newChilds.push_back(getLowBits(childs[index], childDemands[index]));
+                result = triton::ast::newInstance(current, newChilds);
+                break;
+              }
+            }
+            this->narrowedNodes++;
+          }
+
+          else {
+            std::vector<triton::ast::AbstractNode*> newChilds;
+            bool changed = false;
+
+            for (triton::usize index = 0; index < childs.size(); index++) {
+              newChilds.push_back(childDemands[index] == 0 ? childs[index] : getLowBits(childs[index], childDemands[index]));
+              changed |= (newChilds.back() != childs[index]);
+            }
+
+            if (changed)
+              result = triton::ast::newInstance(current, newChilds);
+          }
+
+          if (result != current)
+            narrowed[current] = result;
+        }
+
+        auto root = narrowed.find(fullAst);
+        return (root == narrowed.end() ? fullAst : root->second);
+      }
+
+
+      /* [private method] The abstract values of the nodes are maintained by init(), so this is free */
+      bool SolverEngine::isDecidedUnsat(triton::ast::AbstractNode* node) const {
+        if (node->getKind() == triton::ast::ASSERT_NODE)
+          node = node->getChilds()[0];
+
+        if (node->getBitvectorSize() != 1 || (node->getKnownZeros() & 1) == 0)
+          return false;
+
+        this->decidedQueries++;
+        return true;
+      }
+
+
+      /* [private method] A core is included if all its constraints are, only the cores of the constraints given are checked */
+      bool SolverEngine::containsUnsatCore(const std::vector<std::string>& keys) const {
+        std::set<triton::usize> ids;
+
+        for (auto it = keys.begin(); it != keys.end(); it++) {
+          auto id = this->coreConstraints.find(*it);
+          if (id != this->coreConstraints.end())
+            ids.insert(id->second);
+        }
+
+        for (triton::usize id : ids) {
+          for (triton::usize core : this->coresByConstraint.at(id)) {
+            const std::vector<triton::usize>& constraints = this->unsatCores[core];
+            if (std::includes(ids.begin(), ids.end(), constraints.begin(), constraints.end())) {
+              this->prunedQueries++;
+              return true;
+            }
+          }
+        }
+
+        return false;
+      }
+
+
+      /* [private method] */
+      void SolverEngine::recordUnsatCore(const std::vector<std::string>& keys) const {
+        std::vector<triton::usize> core;
+
+        if (keys.empty())
+          return;
+
+        if (this->unsatCores.size() >= SolverEngine::maxUnsatCores) {
+          this->coreConstraints.clear();
+          this->unsatCores.clear();
+          this->coresByConstraint.clear();
+        }
+
+        for (auto it = keys.begin(); it != keys.end(); it++)
+          core.push_back(this->coreConstraints.emplace(*it, this->coreConstraints.size()).first->second);
+
+        std::sort(core.begin(), core.end());
+        core.erase(std::unique(core.begin(), core.end()), core.end());
+
+        for (triton::usize id : core)
+          this->coresByConstraint[id].push_back(this->unsatCores.size());
+        this->unsatCores.push_back(core);
+      }
+
+
+      /* [private method] Each conjunct is guarded by a literal, the core is the set of literals assumed by the refutation */
+      void SolverEngine::learnUnsatCore(const std::vector<triton::ast::AbstractNode*>& conjuncts) const {
+        std::vector<z3::expr> literals;
+        std::vector<std::string> keys;
+
+        try {
+          triton::ast::Z3ContextLease lease(this->symbolicEngine, false);
+          triton::ast::TritonToZ3Ast& translator = lease.getTranslator();
+          translator.setPersistent(true);
+
+          z3::context& ctx = translator.getContext();
+          z3::solver solver(ctx);
+          setLimits(ctx, solver, this->timeout, this->resourceLimit);
+
+          for (triton::usize index = 0; index < conjuncts.size(); index++) {
+            z3::expr literal = ctx.bool_const(("core_" + std::to_string(index)).c_str());
+            solver.add(z3::implies(literal, translator.eval(*conjuncts[index]).getExpr()));
+            literals.push_back(literal);
+          }
+
+          if (solver.check(static_cast<unsigned>(literals.size()), literals.data()) != z3::unsat)
+            return;
+
+          z3::expr_vector core = solver.unsat_core();
+          for (unsigned index = 0; index < core.size(); index++)
+            keys.push_back(getConstraintKey(conjuncts[std::stoul(core[index].decl().name().str().substr(5))]));
+        }
+        /* The cores only save queries, a failure is not an error */
+        catch (const z3::exception& e) {
+          return;
+        }
+
+        this->recordUnsatCore(keys);
+      }
+
+
+      /* [private method] Computes a model, cluster by cluster, see getModel() */
+      std::map<triton::uint32, SolverModel> SolverEngine::computeModel(triton::ast::AbstractNode* node, triton::uint32 timeout) const {
         std::map<triton::uint32, SolverModel> ret;
         std::list<std::map<triton::uint32, SolverModel>> allModels;
+        std::vector<std::vector<triton::ast::AbstractNode*>> clusters;
+        std::vector<triton::ast::AbstractNode*> conjuncts;
+        std::vector<triton::ast::AbstractNode*> constants;
+
+        if (node == nullptr)
+          throw triton::exceptions::SolverEngine("SolverEngine::computeModel(): node cannot be null.");
+
+        if (this->isDecidedUnsat(node)) {
+          this->status = triton::engines::solver::UNSAT;
+          return ret;
+        }
+
+        triton::ast::AbstractNode* fullAst = this->narrowBitvectors(this->symbolicEngine->getFullAst(node));
+
+        /* Only asserted conjunctions are split */
+        if (fullAst->getKind() == triton::ast::ASSERT_NODE) {
+          splitConjunction(fullAst->getChilds()[0], conjuncts);
+          clusters = getIndependentClusters(conjuncts, constants);
+        }
+
+        /* A conjunction which includes a known unsat core does not need the solver */
+        if (conjuncts.size() > 0 && !this->unsatCores.empty()) {
+          std::vector<std::string> keys;
+          for (auto it = conjuncts.begin(); it != conjuncts.end(); it++)
+            keys.push_back(getConstraintKey(*it));
+          if (this->containsUnsatCore(keys)) {
+            this->status = triton::engines::solver::UNSAT;
+            return ret;
+          }
+        }
+
+        if (clusters.size() <= 1) {
+          triton::usize hits = this->queryCacheHits;
+          allModels = this->solveFormula(this->getAssertion(fullAst), 1, false, timeout, (conjuncts.size() > 0 ? &conjuncts : nullptr));
+          if (allModels.size() > 0)
+            ret = allModels.front();
+          else if (conjuncts.size() > 0 && this->status == triton::engines::solver::UNSAT && hits == this->queryCacheHits)
+            this->learnUnsatCore(conjuncts);
+          return ret;
+        }
+
+        /* Conjuncts without variable do not need the solver */
+        for (auto it = constants.begin(); it != constants.end(); it++) {
+          if ((*it)->evaluate() == 0) {
+            this->status = triton::engines::solver::UNSAT;
+            return ret;
+          }
+        }
+
+        /* The formula is sat if every cluster is sat, their models do not overlap */
+        for (auto cluster = clusters.begin(); cluster != clusters.end(); cluster++) {
+          triton::ast::representations::AstSmtRepresentation smt;
+          std::ostringstream assertion;
+
+          assertion << "(assert (and";
+          for (auto it = cluster->begin(); it != cluster->end(); it++)
+            smt.printShared(assertion << " ", *it);
+          assertion << " true))";
+
+          /* A sat cluster may have an empty model (e.g. a tautology) */
+          triton::usize hits = this->queryCacheHits;
+          allModels = this->solveFormula(assertion.str(), 1, true, timeout, &(*cluster));
+          if (allModels.size() == 0) {
+            if (this->status == triton::engines::solver::UNSAT && hits == this->queryCacheHits)
+              this->learnUnsatCore(*cluster);
+            ret.clear();
+            break;
+          }
+
+          ret.insert(allModels.front().begin(), allModels.front().end());
+        }
+
+        return ret;
+      }
+
+
+      bool SolverEngine::getUnsignedBounds(triton::ast::AbstractNode* node, triton::uint64& min, triton::uint64& max, triton::uint32 timeout) const {
+        if (node == nullptr)
+          throw triton::exceptions::SolverEngine("SolverEngine::getUnsignedBounds(): node cannot be null.");
+
+        triton::uint32 size = node->getBitvectorSize();
+        if (size == 0 || size > QWORD_SIZE_BIT)
+          throw triton::exceptions::SolverEngine("SolverEngine::getUnsignedBounds(): The node must be a bitvector of 64 bits at most.");
+
+        /* Returns 1 if the constraint is sat, 0 if it is unsat and -1 if it is undecided */
+        auto check = [&](triton::ast::AbstractNode* constraint) -> triton::sint32 {
+          std::map<triton::uint32, SolverModel> model = this->getModel(constraint, timeout);
+          if (model.size() > 0 || this->status == triton::engines::solver::SAT)
+            return 1;
+          return (this->status == triton::engines::solver::UNSAT ? 0 : -1);
+        };
+
+        /* The concrete value is reachable */
+        triton::uint64 value = static_cast<triton::uint64>(node->evaluate());
+        triton::uint64 low   = std::min(node->getMinimum(), value);
+        triton::uint64 high  = value;
+
+        /* The lowest value v such as node <= v is sat */
+        while (low < high) {
+          triton::uint64 middle = low + (high - low) / 2;
+          triton::sint32 sat = check(triton::ast::bvule(node, triton::ast::bv(middle, size)));
+          if (sat < 0)
+            return false;
+          if (sat)
+            high = middle;
+          else
+            low = middle + 1;
+        }
+        min = low;
+
+        /* The highest value v such as node >= v is sat */
+        low  = value;
+        high = std::max(node->getMaximum(), value);
+        while (low < high) {
+          triton::uint64 middle = high - (high - low) / 2;
+          triton::sint32 sat = check(triton::ast::bvuge(node, triton::ast::bv(middle, size)));
+          if (sat < 0)
+            return false;
+          if (sat)
+            low = middle;
+          else
+            high = middle - 1;
+        }
+        max = low;
+
+        return true;
+      }
+
+
+      triton::usize SolverEngine::getModelAsync(triton::ast::AbstractNode* node, triton::uint32 timeout) {
+        typedef std::pair<triton::engines::solver::status_e, std::map<triton::uint32, SolverModel>> result_t;
+
+        if (node == nullptr)
+          throw triton::exceptions::SolverEngine("SolverEngine::getModelAsync(): node cannot be null.");
+
+        /* The result of a query decided without the solver is ready */
+        if (this->isDecidedUnsat(node)) {
+          std::promise<result_t> decided;
+          decided.set_value(result_t(triton::engines::solver::UNSAT, std::map<triton::uint32, SolverModel>()));
+          triton::usize id = this->nextAsyncQuery++;
+          this->asyncQueries[id] = decided.get_future();
+          return id;
+        }
+
+        /* The job only gets the SMT2 text, the AST is not used from the workers */
+        std::string formula   = this->getFormula(this->getAssertion(this->symbolicEngine->getFullAst(node)));
+        triton::uint32 limit  = (timeout ? timeout : this->timeout);
+        triton::uint32 rlimit = this->resourceLimit;
+
+        if (this->remote != nullptr) {
+          triton::usize id = this->nextAsyncQuery++;
+          this->remoteQueries[id] = this->remote->submit(formula, limit, rlimit);
+          return id;
+        }
+
+        if (this->workerPool == nullptr) {
+          triton::uint32 threads = std::thread::hardware_concurrency();
+          this->workerPool = new(std::nothrow) SolverWorkerPool(threads ? threads : 1);
+          if (this->workerPool == nullptr)
+            throw triton::exceptions::SolverEngine("SolverEngine::getModelAsync(): Not enough memory.");
+        }
+
+        std::shared_ptr<std::packaged_task<result_t(void)>> job = std::make_shared<std::packaged_task<result_t(void)>>([formula, limit, rlimit]() {
+          result_t ret;
+          ret.first = SolverEngine::solveSmt2Formula(formula, limit, rlimit, ret.second);
+          return ret;
+        });
+
+        triton::usize id = this->nextAsyncQuery++;
+        this->asyncQueries[id] = job->get_future();
+        this->workerPool->submit([job]() { (*job)(); });
+
+        return id;
+      }
+
+
+      bool SolverEngine::isAsyncModelReady(triton::usize id) const {
+        auto request = this->remoteQueries.find(id);
+        if (request != this->remoteQueries.end())
+          return this->remote->isReady(request->second);
+
+        auto it = this->asyncQueries.find(id);
+
+        if (it == this->asyncQueries.end())
+          throw triton::exceptions::SolverEngine("SolverEngine::isAsyncModelReady(): Unknown asynchronous query.");
+
+        return (it->second.wait_for(std::chrono::seconds(0)) == std::future_status::ready);
+      }
+
+
+      std::map<triton::uint32, SolverModel> SolverEngine::getAsyncModel(triton::usize id) {
+        std::pair<triton::engines::solver::status_e, std::map<triton::uint32, SolverModel>> ret;
+        triton::uint64 start = triton::utils::getMonotonicTime();
+        triton::utils::PerfScope perf(triton::utils::PERF_SOLVER);
 
-        allModels = this->getModels(node, 1);
-        if (allModels.size() > 0)
-          ret = allModels.front();
+        auto request = this->remoteQueries.find(id);
+        if (request != this->remoteQueries.end()) {
+          triton::usize requestId = request->second;
+          this->remoteQueries.erase(request);
+          ret = this->remote->wait(requestId);
+          this->status = ret.first;
+          this->recordQuery(start);
+          return ret.second;
+        }
+
+        auto it = this->asyncQueries.find(id);
+        if (it == this->asyncQueries.end())
+          throw triton::exceptions::SolverEngine("SolverEngine::getAsyncModel(): Unknown asynchronous query.");
+
+        /* The query is forgotten even if the solver failed */
+        std::future<std::pair<triton::engines::solver::status_e, std::map<triton::uint32, SolverModel>>> result = std::move(it->second);
+        this->asyncQueries.erase(it);
+
+        try {
+          ret = result.get();
+        }
+        catch (const z3::exception& e) {
+          throw triton::exceptions::SolverEngine("SolverEngine::getAsyncModel(): " + std::string(e.msg()));
+        }
+
+        this->status = ret.first;
+        this->recordQuery(start);
+
+        return ret.second;
+      }
+
+
+      void SolverEngine::setTimeout(triton::uint32 timeout) {
+        this->timeout = timeout;
+      }
+
+
+      void SolverEngine::setMemoryLimit(triton::uint32 limit) {
+        /* The memory limit of Z3 is a global parameter */
+        z3::set_param("memory_max_size", static_cast<int>(limit ? limit : std::numeric_limits<int>::max()));
+      }
+
+
+      void SolverEngine::setBackend(triton::engines::solver::solver_e backend) {
+        switch (backend) {
+          case triton::engines::solver::Z3:
+          case triton::engines::solver::PORTFOLIO:
+            break;
+
+          case triton::engines::solver::BOOLECTOR:
+            #ifndef TRITON_BOOLECTOR
+            throw triton::exceptions::SolverEngine("SolverEngine::setBackend(): Triton has been built without Boolector.");
+            #endif
+            break;
+
+          default:
+            throw triton::exceptions::SolverEngine("SolverEngine::setBackend(): Invalid solver backend.");
+        }
+
+        this->backend = backend;
+      }
+
+
+      triton::engines::solver::solver_e SolverEngine::getBackend(void) const {
+        return this->backend;
+      }
+
+
+      void SolverEngine::setPortfolioSize(triton::uint32 size) {
+        this->portfolioSize = size;
+      }
+
+
+      void SolverEngine::setResourceLimit(triton::uint32 limit) {
+        this->resourceLimit = limit;
+      }
+
+
+      void SolverEngine::setLocalSearchBudget(triton::uint32 budget) {
+        this->localSearchBudget = budget;
+      }
+
+
+      void SolverEngine::setRemoteSolver(const std::string& address) {
+        /* The pending remote queries are lost with their connection */
+        delete this->remote;
+        this->remote = nullptr;
+        this->remoteAddress.clear();
+        this->remoteQueries.clear();
+
+        if (address.empty())
+          return;
+
+        this->remote = new RemoteSolverClient(address);
+        this->remoteAddress = address;
+      }
+
+
+      const std::string& SolverEngine::getRemoteSolver(void) const {
+        return this->remoteAddress;
+      }
+
+
+      triton::engines::solver::status_e SolverEngine::getLastStatus(void) const {
+        return this->status;
+      }
+
+
+      triton::usize SolverEngine::getQueryCacheHits(void) const {
+        return this->queryCacheHits;
+      }
+
+
+      triton::usize SolverEngine::getQueryCacheMisses(void) const {
+        return this->queryCacheMisses;
+      }
+
+
+      /* [private method] Counts a query and the time spent since `start` */
+      void SolverEngine::recordQuery(triton::uint64 start, triton::ast::AbstractNode* node) const {
+        triton::uint64 end = triton::utils::getMonotonicTime();
+
+        this->queries++;
+        this->queriesByStatus[this->status]++;
+        this->queriesTime += end - start;
+
+        if (node != nullptr && this->symbolicEngine != nullptr)
+          this->symbolicEngine->profileQuery(node, end - start);
+
+        if (triton::utils::TraceEvents::isEnabled())
+          triton::utils::TraceEvents::record("solver", "solver", start, end);
+      }
+
+
+      std::map<std::string, triton::usize> SolverEngine::getStatistics(void) const {
+        std::map<std::string, triton::usize> stats;
+
+        stats["queries"]      = this->queries;
+        stats["sat"]          = this->queriesByStatus[triton::engines::solver::SAT];
+        stats["unsat"]        = this->queriesByStatus[triton::engines::solver::UNSAT];
+        stats["unknown"]      = this->queriesByStatus[triton::engines::solver::UNKNOWN];
+        stats["time"]         = this->queriesTime;
+        stats["cacheHits"]    = this->queryCacheHits;
+        stats["cacheMisses"]  = this->queryCacheMisses;
+        stats["modelHits"]    = this->modelCacheHits;
+        stats["decided"]      = this->decidedQueries;
+        stats["pruned"]       = this->prunedQueries;
+        stats["cores"]        = this->unsatCores.size();
+        stats["narrowed"]     = this->narrowedNodes;
+
+        return stats;
+      }
+
+
+      void SolverEngine::clearQueryCache(void) {
+        this->queryCache.clear();
+        this->recentModels.clear();
+        this->coreConstraints.clear();
+        this->unsatCores.clear();
+        this->coresByConstraint.clear();
+        this->prunedQueries    = 0;
+        this->queryCacheHits   = 0;
+        this->queryCacheMisses = 0;
+        this->modelCacheHits   = 0;
+      }
+
+
+      void SolverEngine::startSession(void) {
+        if (this->session != nullptr)
+          return;
+
+        /* The session works on the context of its translator, translated expressions must belong to it */
+        this->sessionTranslator = new(std::nothrow) triton::ast::TritonToZ3Ast(this->symbolicEngine, false);
+        if (this->sessionTranslator == nullptr)
+          throw triton::exceptions::SolverEngine("SolverEngine::startSession(): Not enough memory.");
+
+        this->session = new(std::nothrow) z3::solver(this->sessionTranslator->getContext());
+        if (this->session == nullptr) {
+          delete this->sessionTranslator;
+          this->sessionTranslator = nullptr;
+          throw triton::exceptions::SolverEngine("SolverEngine::startSession(): Not enough memory.");
+        }
+
+        /* Sub-ASTs shared between queries are translated once for the whole session */
+        this->sessionTranslator->setPersistent(true);
+      }
+
+
+      void SolverEngine::stopSession(void) {
+        if (this->session == nullptr)
+          return;
+
+        this->popSessionConstraints(0);
+
+        delete this->session;
+        delete this->sessionTranslator;
+        this->session           = nullptr;
+        this->sessionTranslator = nullptr;
+      }
+
+
+      bool SolverEngine::isSessionStarted(void) const {
+        return (this->session != nullptr);
+      }
+
+
+      void SolverEngine::releaseSessionNodes(void) {
+        if (this->session == nullptr)
+          return;
+
+        if (!this->sessionConstraints.empty())
+          this->session->pop(static_cast<triton::uint32>(this->sessionConstraints.size()));
+        this->sessionConstraints.clear();
+        this->sessionTranslator->clearTranslations(false);
+      }
+
+
+      /* [private method] Pops the constraints of the session until only `depth` constraints are asserted */
+      void SolverEngine::popSessionConstraints(triton::usize depth) {
+        if (this->sessionConstraints.size() <= depth)
+          return;
+
+        this->session->pop(static_cast<triton::uint32>(this->sessionConstraints.size() - depth));
+        for (triton::usize index = depth; index < this->sessionConstraints.size(); index++)
+          this->sessionConstraints[index]->decReference();
+        this->sessionConstraints.resize(depth);
+      }
+
+
+      std::map<triton::uint32, SolverModel> SolverEngine::getSessionModel(const std::vector<triton::ast::AbstractNode*>& prefix, triton::ast::AbstractNode* node) {
+        std::map<triton::uint32, SolverModel> ret;
+        triton::uint64 start = triton::utils::getMonotonicTime();
+        triton::utils::PerfScope perf(triton::utils::PERF_SOLVER);
+        triton::usize common = 0;
+
+        if (this->session == nullptr)
+          throw triton::exceptions::SolverEngine("SolverEngine::getSessionModel(): The solver session is not started.");
+
+        if (node == nullptr)
+          throw triton::exceptions::SolverEngine("SolverEngine::getSessionModel(): node cannot be null.");
+
+        /* Keep the constraints shared with the previous query */
+        while (common < prefix.size() && common < this->sessionConstraints.size() && prefix[common] == this->sessionConstraints[common])
+          common++;
+        this->popSessionConstraints(common);
+
+        /* Assert the new ones, each one on its own backtracking point */
+        for (triton::usize index = common; index < prefix.size(); index++) {
+          z3::expr constraint = this->sessionTranslator->eval(*prefix[index]).getExpr();
+          this->session->push();
+          this->session->add(constraint);
+          prefix[index]->incReference();
+          this->sessionConstraints.push_back(prefix[index]);
+        }
+
+        /* The query is popped once solved */
+        z3::expr query = this->sessionTranslator->eval(*node).getExpr();
+        this->session->push();
+        this->session->add(query);
+
+        setLimits(this->sessionTranslator->getContext(), *this->session, this->timeout, this->resourceLimit);
+        this->status = getStatus(this->session->check());
+        if (this->status == triton::engines::solver::SAT) {
+          z3::model m = this->session->get_model();
+          ret = Z3Backend::convertModel(m);
+        }
+
+        this->session->pop();
+        this->recordQuery(start, node);
+
+        return ret;
+      }
+
+
+      std::vector<std::map<triton::uint32, SolverModel>> SolverEngine::getModelsForBranches(const std::vector<triton::ast::AbstractNode*>& pathConstraints) const {
+        std::vector<std::map<triton::uint32, SolverModel>> ret(pathConstraints.size());
+        std::vector<std::string> keys(pathConstraints.size());
+        std::vector<std::string> query;
+        std::vector<z3::expr> assumptions;
+
+        /* The keys of the constraints taken are computed once, the flipped ones are their negation */
+        auto getKey = [&](triton::usize index, bool flipped) {
+          if (keys[index].empty())
+            keys[index] = getConstraintKey(this->symbolicEngine->getFullAst(pathConstraints[index]));
+          return (flipped ? "(not " + keys[index] + ")" : keys[index]);
+        };
+
+        for (auto it = pathConstraints.begin(); it != pathConstraints.end(); it++) {
+          if (*it == nullptr)
+            throw triton::exceptions::SolverEngine("SolverEngine::getModelsForBranches(): A constraint cannot be null.");
+        }
+
+        /* Sub-ASTs shared by the constraints are translated once */
+        triton::ast::Z3ContextLease lease(this->symbolicEngine, false);
+        triton::ast::TritonToZ3Ast& translator = lease.getTranslator();
+        translator.setPersistent(true);
+
+        z3::context& ctx = translator.getContext();
+        z3::solver solver(ctx);
+        setLimits(ctx, solver, this->timeout, this->resourceLimit);
+
+        try {
+          for (triton::usize index = 0; index < pathConstraints.size(); index++) {
+            triton::uint64 start = triton::utils::getMonotonicTime();
+            triton::utils::PerfScope perf(triton::utils::PERF_SOLVER);
+            z3::expr constraint  = translator.eval(*pathConstraints[index]).getExpr();
+            z3::expr taken       = ctx.bool_const(("taken_" + std::to_string(index)).c_str());
+            z3::expr flipped     = ctx.bool_const(("flipped_" + std::to_string(index)).c_str());
+
+            solver.add(z3::implies(taken, constraint));
+            solver.add(z3::implies(flipped, !constraint));
+
+            /* The prefix is assumed taken and the branch flipped, then the branch is assumed taken for the next ones */
+            assumptions.push_back(flipped);
+
+            /* The keys of the query are only needed once a core is known */
+            bool pruned = false;
+            if (!this->unsatCores.empty()) {
+              while (query.size() < index)
+                query.push_back(getKey(query.size(), false));
+              query.push_back(getKey(index, true));
+              pruned = this->containsUnsatCore(query);
+              query.back() = getKey(index, false);
+            }
+
+            if (pruned)
+              this->status = triton::engines::solver::UNSAT;
+            else
+              this->status = getStatus(solver.check(static_cast<unsigned>(assumptions.size()), assumptions.data()));
+
+            if (this->status == triton::engines::solver::SAT) {
+              z3::model m = solver.get_model();
+              ret[index] = Z3Backend::convertModel(m);
+            }
+
+            /* The core is made of the literals of the refutation, taken_i or flipped_i */
+            else if (this->status == triton::engines::solver::UNSAT && !pruned) {
+              z3::expr_vector core = solver.unsat_core();
+              std::vector<std::string> coreKeys;
+              for (unsigned literal = 0; literal < core.size(); literal++) {
+                std::string name = core[literal].decl().name().str();
+                bool negated     = (name.compare(0, 8, "flipped_") == 0);
+                coreKeys.push_back(getKey(std::stoul(name.substr(negated ? 8 : 6)), negated));
+              }
+              this->recordUnsatCore(coreKeys);
+            }
+
+            assumptions.back() = taken;
+
+            this->recordQuery(start, pathConstraints[index]);
+          }
+        }
+        catch (const z3::exception& e) {
+          throw triton::exceptions::SolverEngine("SolverEngine::getModelsForBranches(): " + std::string(e.msg()));
+        }
 
         return ret;
       }
@@ -18,14 +18,18 @@ namespace triton {
 
       SolverModel::SolverModel() {
         this->id    = static_cast<triton::uint32>(-1);
-        this->name  = "";
         this->value = 0;
       }
 
 
       SolverModel::SolverModel(const std::string& name, triton::uint512 value) {
         this->id    = std::atoi(name.c_str() + TRITON_SYMVAR_NAME_SIZE);
-        this->name  = name;
+        this->value = value;
+      }
+
+
+      SolverModel::SolverModel(triton::uint32 id, triton::uint512 value) {
+        this->id    = id;
         this->value = value;
       }
 
@@ -37,7 +41,6 @@ namespace triton {
 
       void SolverModel::copy(const SolverModel& other) {
         this->id    = other.id;
-        this->name  = other.name;
         this->value = other.value;
       }
 
@@ -46,8 +49,10 @@ namespace triton {
       }
 
 
-      const std::string& SolverModel::getName(void) const {
-        return this->name;
+      std::string SolverModel::getName(void) const {
+        if (this->id == static_cast<triton::uint32>(-1))
+          return "";
+        return TRITON_SYMVAR_NAME + std::to_string(this->id);
       }
 
 
@@ -0,0 +1,71 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#include <exceptions.hpp>
+#include <solverWorkerPool.hpp>
+
+
+
+namespace triton {
+  namespace engines {
+    namespace solver {
+
+      SolverWorkerPool::SolverWorkerPool(triton::uint32 threads) {
+        if (threads == 0)
+          throw triton::exceptions::SolverEngine("SolverWorkerPool::SolverWorkerPool(): The pool needs at least one thread.");
+
+        this->stopping = false;
+        for (triton::uint32 index = 0; index < threads; index++)
+          this->workers.push_back(std::thread(&SolverWorkerPool::work, this));
+      }
+
+
+      SolverWorkerPool::~SolverWorkerPool() {
+        {
+          std::lock_guard<std::mutex> lock(this->mutex);
+          this->stopping = true;
+          this->jobs.clear();
+        }
+
+        this->wakeup.notify_all();
+        for (auto it = this->workers.begin(); it != this->workers.end(); it++)
+          it->join();
+      }
+
+
+      void SolverWorkerPool::submit(const std::function<void(void)>& job) {
+        {
+          std::lock_guard<std::mutex> lock(this->mutex);
+          this->jobs.push_back(job);
+        }
+
+        this->wakeup.notify_one();
+      }
+
+
+      void SolverWorkerPool::work(void) {
+        while (true) {
+          std::function<void(void)> job;
+
+          {
+            std::unique_lock<std::mutex> lock(this->mutex);
+            this->wakeup.wait(lock, [this]() { return this->stopping || !this->jobs.empty(); });
+
+            if (this->stopping)
+              return;
+
+            job = this->jobs.front();
+            this->jobs.pop_front();
+          }
+
+          job();
+        }
+      }
+
+    };
+  };
+};
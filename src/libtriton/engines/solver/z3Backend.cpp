@@ -0,0 +1,154 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#include <cstdlib>
+#include <cstring>
+
+#include <exceptions.hpp>
+#include <symbolicEnums.hpp>
+#include <tritonToZ3Ast.hpp>
+#include <z3Backend.hpp>
+#include <z3ContextPool.hpp>
+
+
+
+namespace triton {
+  namespace engines {
+    namespace solver {
+
+      Z3Backend::Z3Backend(triton::engines::symbolic::SymbolicEngine* symbolicEngine, const std::string& tactic, triton::uint32 seed) {
+        if (symbolicEngine == nullptr)
+          throw triton::exceptions::SolverEngine("Z3Backend::Z3Backend(): The symbolicEngine API cannot be null.");
+
+        this->symbolicEngine = symbolicEngine;
+        this->interrupted    = false;
+        this->context        = nullptr;
+        this->tactic         = tactic;
+        this->seed           = seed;
+      }
+
+
+      std::string Z3Backend::getName(void) const {
+        if (this->tactic.empty() && this->seed == 0)
+          return "z3";
+        return "z3(" + (this->tactic.empty() ? std::string("default") : this->tactic) + ", seed " + std::to_string(this->seed) + ")";
+      }
+
+
+      triton::engines::solver::status_e Z3Backend::solve(const std::vector<triton::ast::AbstractNode*>& constraints, triton::uint32 timeout, triton::uint32 resourceLimit, std::map<triton::uint32, SolverModel>& model) {
+        triton::engines::solver::status_e status = triton::engines::solver::UNKNOWN;
+        triton::ast::Z3ContextLease lease{this->symbolicEngine, false};
+        triton::ast::TritonToZ3Ast& translator = lease.getTranslator();
+        z3::context& ctx = translator.getContext();
+        z3::solver solver = (this->tactic.empty() ? z3::solver(ctx) : z3::tactic(ctx, this->tactic.c_str()).mk_solver());
+        z3::params params(ctx);
+
+        for (auto it = constraints.begin(); it != constraints.end(); it++)
+          solver.add(translator.eval(**it).getExpr());
+
+        if (timeout)
+          params.set("timeout", timeout);
+
+        if (resourceLimit)
+          params.set("rlimit", resourceLimit);
+
+        if (this->seed)
+          params.set("random_seed", this->seed);
+
+        solver.set(params);
+
+        /* An interruption before the check is seen under the lock */
+        {
+          std::lock_guard<std::mutex> guard(this->lock);
+          if (this->interrupted)
+            return triton::engines::solver::UNKNOWN;
+          this->context = &ctx;
+        }
+
+        z3::check_result result = solver.check();
+
+        /* An interrupted context is not given back to the pool */
+        {
+          std::lock_guard<std::mutex> guard(this->lock);
+          this->context = nullptr;
+          if (this->interrupted)
+            lease.invalidate();
+        }
+
+        switch (result) {
+          case z3::sat:   status = triton::engines::solver::SAT;   break;
+          case z3::unsat: status = triton::engines::solver::UNSAT; break;
+          default:        return triton::engines::solver::UNKNOWN;
+        }
+
+        if (status == triton::engines::solver::SAT) {
+          z3::model m = solver.get_model();
+          model = Z3Backend::convertModel(m);
+        }
+
+        return status;
+      }
+
+
+      void Z3Backend::interrupt(void) {
+        std::lock_guard<std::mutex> guard(this->lock);
+
+        this->interrupted = true;
+        if (this->context != nullptr)
+          this->context->interrupt();
+      }
+
+
+      bool Z3Backend::getVariableId(const z3::func_decl& decl, triton::uint32& id) {
+        /* Only bitvectors are symbolic variables (e.g. arrays are not) */
+        if (decl.arity() != 0 || !decl.range().is_bv())
+          return false;
+
+        Z3_symbol symbol = Z3_get_decl_name(decl.ctx(), decl);
+        if (Z3_get_symbol_kind(decl.ctx(), symbol) != Z3_STRING_SYMBOL)
+          return false;
+
+        const char* name = Z3_get_symbol_string(decl.ctx(), symbol);
+        if (std::strncmp(name, TRITON_SYMVAR_NAME, TRITON_SYMVAR_NAME_SIZE) != 0)
+          return false;
+
+        char* end = nullptr;
+        id = static_cast<triton::uint32>(std::strtoul(name + TRITON_SYMVAR_NAME_SIZE, &end, 10));
+
+        return end != name + TRITON_SYMVAR_NAME_SIZE && *end == '\0';
+      }
+
+
+      triton::uint512 Z3Backend::getValue(const z3::expr& numeral) {
+        triton::uint64 value = 0;
+
+        if (numeral.get_sort().bv_size() <= 64 && Z3_get_numeral_uint64(numeral.ctx(), numeral, &value))
+          return value;
+
+        return triton::uint512(Z3_get_numeral_string(numeral.ctx(), numeral));
+      }
+
+
+      std::map<triton::uint32, SolverModel> Z3Backend::convertModel(const z3::model& m) {
+        std::map<triton::uint32, SolverModel> smodel;
+        triton::uint32 id = 0;
+
+        for (triton::uint32 i = 0; i < m.size(); i++) {
+          z3::func_decl z3Variable = m[i];
+
+          if (!Z3Backend::getVariableId(z3Variable, id))
+            continue;
+
+          smodel[id] = SolverModel(id, Z3Backend::getValue(m.get_const_interp(z3Variable)));
+        }
+
+        return smodel;
+      }
+
+    };
+  };
+};
@@ -0,0 +1,195 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#include <algorithm>
+
+#include <alignedMemoryMap.hpp>
+#include <coreUtils.hpp>
+#include <exceptions.hpp>
+
+
+
+namespace triton {
+  namespace engines {
+    namespace symbolic {
+
+      /* Returns true if the entry [start, start + length) overlaps [address, address + size) */
+      static inline bool isOverlapping(triton::uint64 start, triton::uint32 length, triton::uint64 address, triton::uint64 size) {
+        if (start >= address)
+          return (start - address) < size;
+        return (address - start) < length;
+      }
+
+
+      AlignedMemoryMap::AlignedMemoryMap() {
+        this->count   = 0;
+        this->maxSize = 0;
+      }
+
+
+      triton::ast::AbstractNode* AlignedMemoryMap::get(triton::uint64 address, triton::uint32 size) const {
+        auto it = this->slots.find(address);
+
+        if (it == this->slots.end())
+          return nullptr;
+
+        for (triton::uint32 index = 0; index < AlignedMemoryMap::slotSize; index++) {
+          if (it->second.sizes[index] == size)
+            return it->second.nodes[index];
+        }
+
+        return nullptr;
+      }
+
+
+      triton::ast::AbstractNode* AlignedMemoryMap::set(triton::uint64 address, triton::uint32 size, triton::ast::AbstractNode* node) {
+        triton::ast::AbstractNode* old = nullptr;
+
+        if (size == 0 || size > 0xff)
+          throw triton::exceptions::SymbolicEngine("AlignedMemoryMap::set(): Invalid size.");
+
+        auto it = this->slots.find(address);
+
+        /* Removing a missing entry must not allocate a slot */
+        if (it == this->slots.end()) {
+          if (node == nullptr)
+            return nullptr;
+          Slot slot;
+          std::fill(slot.sizes, slot.sizes + AlignedMemoryMap::slotSize, 0);
+          std::fill(slot.nodes, slot.nodes + AlignedMemoryMap::slotSize, nullptr);
+          it = this->slots.insert(std::make_pair(address, slot)).first;
+        }
+
+        Slot& slot = it->second;
+        triton::uint32 free = AlignedMemoryMap::slotSize;
+
+        for (triton::uint32 index = 0; index < AlignedMemoryMap::slotSize; index++) {
+          if (slot.sizes[index] == size) {
+            old = slot.nodes[index];
+            if (node != nullptr) {
+              slot.nodes[index] = node;
+              return old;
+            }
+            slot.sizes[index] = 0;
+            slot.nodes[index] = nullptr;
+            this->count--;
+            break;
+          }
+          if (slot.sizes[index] == 0 && free == AlignedMemoryMap::slotSize)
+            free = index;
+        }
+
+        if (node == nullptr) {
+          if (this->count == 0)
+            this->maxSize = 0;
+          /* Release empty slots */
+          if (std::all_of(slot.sizes, slot.sizes + AlignedMemoryMap::slotSize, [](triton::uint8 s) { return s == 0; }))
+            this->slots.erase(it);
+          return old;
+        }
+
+        if (free == AlignedMemoryMap::slotSize)
+          throw triton::exceptions::SymbolicEngine("AlignedMemoryMap::set(): Too many sizes at the same address.");
+
+        slot.sizes[free] = static_cast<triton::uint8>(size);
+        slot.nodes[free] = node;
+        this->count++;
+        this->maxSize = std::max(this->maxSize, size);
+
+        return nullptr;
+      }
+
+
+      void AlignedMemoryMap::getOverlaps(triton::uint64 address, triton::uint64 size, std::vector<std::pair<triton::uint64, triton::uint32>>& entries) const {
+        if (this->count == 0 || size == 0)
+          return;
+
+        /* The entries starting before the area are at most maxSize - 1 bytes before it */
+        triton::uint64 back = std::min<triton::uint64>(address, this->maxSize - 1);
+
+        /* Large areas visit the entries instead of the addresses */
+        if (size + back > this->slots.size()) {
+          for (auto it = this->slots.begin(); it != this->slots.end(); it++) {
+            for (triton::uint32 index = 0; index < AlignedMemoryMap::slotSize; index++) {
+              if (it->second.sizes[index] != 0 && isOverlapping(it->first, it->second.sizes[index], address, size))
+                entries.push_back(std::make_pair(it->first, it->second.sizes[index]));
+            }
+          }
+          return;
+        }
+
+        for (triton::uint64 start = address - back; start - (address - back) < size + back; start++) {
+          auto it = this->slots.find(start);
+          if (it == this->slots.end())
+            continue;
+
+          for (triton::uint32 index = 0; index < AlignedMemoryMap::slotSize; index++) {
+            if (it->second.sizes[index] != 0 && isOverlapping(start, it->second.sizes[index], address, size))
+              entries.push_back(std::make_pair(start, it->second.sizes[index]));
+          }
+        }
+      }
+
+
+      triton::ast::AbstractNode* AlignedMemoryMap::extract(void) {
+        if (this->slots.empty())
+          return nullptr;
+
+        auto it = this->slots.begin();
+        for (triton::uint32 index = 0; index < AlignedMemoryMap::slotSize; index++) {
+          if (it->second.sizes[index] != 0)
+            return this->set(it->first, it->second.sizes[index], nullptr);
+        }
+
+        /* Slots are released once empty, this is not reached */
+        this->slots.erase(it);
+        return nullptr;
+      }
+
+
+      void AlignedMemoryMap::forEach(const std::function<void(triton::uint64, triton::uint32, triton::ast::AbstractNode*)>& callback) const {
+        for (auto it = this->slots.begin(); it != this->slots.end(); it++) {
+          for (triton::uint32 index = 0; index < AlignedMemoryMap::slotSize; index++) {
+            if (it->second.sizes[index] != 0)
+              callback(it->first, it->second.sizes[index], it->second.nodes[index]);
+          }
+        }
+      }
+
+
+      void AlignedMemoryMap::clear(void) {
+        this->slots.clear();
+        this->count   = 0;
+        this->maxSize = 0;
+      }
+
+
+      void AlignedMemoryMap::swap(AlignedMemoryMap& other) {
+        std::swap(this->slots, other.slots);
+        std::swap(this->count, other.count);
+        std::swap(this->maxSize, other.maxSize);
+      }
+
+
+      bool AlignedMemoryMap::empty(void) const {
+        return this->count == 0;
+      }
+
+
+      triton::usize AlignedMemoryMap::size(void) const {
+        return this->count;
+      }
+
+
+      triton::usize AlignedMemoryMap::getMemoryUsage(void) const {
+        return this->slots.size() * triton::utils::getHashNodeSize(sizeof(std::pair<const triton::uint64, Slot>)) +
+               this->slots.bucket_count() * sizeof(void*);
+      }
+
+    }; /* symbolic namespace */
+  }; /* engines namespace */
+}; /*triton namespace */
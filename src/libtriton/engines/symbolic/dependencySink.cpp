@@ -0,0 +1,163 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#include <exceptions.hpp>
+#include <dependencySink.hpp>
+
+
+
+namespace triton {
+  namespace engines {
+    namespace symbolic {
+
+      DependencyFileSink::DependencyFileSink(const std::string& path, bool csv) {
+        this->file.open(path, std::ios::out | std::ios::binary | std::ios::trunc);
+        if (!this->file.is_open())
+          throw triton::exceptions::SymbolicEngine("DependencyFileSink::DependencyFileSink(): Cannot open the file.");
+
+        this->csv      = csv;
+        this->stopping = false;
+        this->writing  = false;
+        this->buffer.reserve(DependencyFileSink::bufferSize + 64);
+
+        if (this->csv)
+          this->buffer.append("id,kind,origin,size,address,references\n");
+        else {
+          this->buffer.append("TRDG");
+          this->writeUnsigned(triton::engines::symbolic::dependencyVersion);
+        }
+
+        this->writer = std::thread(&DependencyFileSink::work, this);
+      }
+
+
+      DependencyFileSink::~DependencyFileSink() {
+        this->submit();
+
+        {
+          std::lock_guard<std::mutex> lock(this->mutex);
+          this->stopping = true;
+        }
+
+        /* The writer empties the pending buffers before leaving */
+        this->wakeup.notify_all();
+        this->writer.join();
+        this->file.close();
+      }
+
+
+      void DependencyFileSink::writeUnsigned(triton::uint64 value) {
+        do {
+          triton::uint8 byte = (value & 0x7f);
+          value >>= 7;
+          this->buffer.push_back(static_cast<char>(value ? (byte | 0x80) : byte));
+        } while (value);
+      }
+
+
+      void DependencyFileSink::write(const SymbolicExpression& expr, triton::uint64 address) {
+        const std::vector<triton::usize>& references = expr.getReferences();
+        triton::uint64 origin = 0;
+        triton::uint64 size   = 0;
+
+        if (expr.isRegister())
+          origin = expr.getOriginRegister().getId();
+
+        else if (expr.isMemory()) {
+          triton::arch::MemoryAccess mem = expr.getOriginMemory();
+          origin = mem.getAddress();
+          size   = mem.getSize();
+        }
+
+        if (this->csv) {
+          this->buffer.append(std::to_string(expr.getId()));
+          this->buffer.append(expr.isRegister() ? ",REG," : (expr.isMemory() ? ",MEM," : ",UNDEF,"));
+          this->buffer.append(std::to_string(origin));
+          this->buffer.push_back(',');
+          this->buffer.append(std::to_string(size));
+          this->buffer.push_back(',');
+          this->buffer.append(std::to_string(address));
+          this->buffer.push_back(',');
+          for (auto it = references.begin(); it != references.end(); it++) {
+            if (it != references.begin())
+              this->buffer.push_back(' ');
+            this->buffer.append(std::to_string(*it));
+          }
+          this->buffer.push_back('\n');
+        }
+
+        else {
+          this->writeUnsigned(expr.getId());
+          this->writeUnsigned(expr.getKind());
+          this->writeUnsigned(origin);
+          this->writeUnsigned(size);
+          this->writeUnsigned(address);
+          this->writeUnsigned(references.size());
+          for (auto it = references.begin(); it != references.end(); it++)
+            this->writeUnsigned(*it);
+        }
+
+        if (this->buffer.size() >= DependencyFileSink::bufferSize)
+          this->submit();
+      }
+
+
+      void DependencyFileSink::submit(void) {
+        if (this->buffer.empty())
+          return;
+
+        {
+          std::lock_guard<std::mutex> lock(this->mutex);
+          this->pending.push_back(std::string());
+          this->pending.back().swap(this->buffer);
+        }
+
+        this->buffer.reserve(DependencyFileSink::bufferSize + 64);
+        this->wakeup.notify_all();
+      }
+
+
+      void DependencyFileSink::flush(void) {
+        this->submit();
+
+        std::unique_lock<std::mutex> lock(this->mutex);
+        this->wakeup.wait(lock, [this]() { return this->pending.empty() && !this->writing; });
+      }
+
+
+      void DependencyFileSink::work(void) {
+        while (true) {
+          std::string chunk;
+
+          {
+            std::unique_lock<std::mutex> lock(this->mutex);
+            this->wakeup.wait(lock, [this]() { return this->stopping || !this->pending.empty(); });
+
+            if (this->pending.empty())
+              return;
+
+            chunk.swap(this->pending.front());
+            this->pending.pop_front();
+            this->writing = true;
+          }
+
+          this->file.write(chunk.data(), chunk.size());
+
+          {
+            std::lock_guard<std::mutex> lock(this->mutex);
+            if (this->pending.empty())
+              this->file.flush();
+            this->writing = false;
+          }
+
+          this->wakeup.notify_all();
+        }
+      }
+
+    };
+  };
+};
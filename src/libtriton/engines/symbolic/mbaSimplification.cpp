@@ -0,0 +1,559 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#include <map>
+#include <utility>
+#include <vector>
+
+#include <exceptions.hpp>
+#include <mbaSimplification.hpp>
+#include <symbolicExpression.hpp>
+
+
+
+namespace triton {
+  namespace engines {
+    namespace symbolic {
+
+      /* The operations of a linear MBA expression */
+      enum mbaOperation_e {
+        MBA_ATOM,
+        MBA_CONST,
+        MBA_ADD,
+        MBA_SUB,
+        MBA_MUL,
+        MBA_NEG,
+        MBA_NOT,
+        MBA_AND,
+        MBA_OR,
+        MBA_XOR,
+        MBA_NAND,
+        MBA_NOR,
+        MBA_XNOR,
+      };
+
+
+      /* An operation on previous operations. The atoms and the constant factors of MBA_MUL are in value. */
+      struct MbaOperation {
+        enum mbaOperation_e kind;
+        triton::uint32 op1;
+        triton::uint32 op2;
+        triton::uint64 value;
+      };
+
+
+      /* Collects the operations and the atoms of an expression of at most 64 bits */
+      class MbaCollector {
+        public:
+          triton::uint32 size;
+          triton::uint64 mask;
+          bool failed;
+
+          /* The operations, children before their parents */
+          std::vector<MbaOperation> operations;
+
+          /* The nodes of the atoms */
+          std::vector<triton::ast::AbstractNode*> atoms;
+
+          /* The operations of the atoms by (variable, constant or node, key) */
+          std::map<std::pair<triton::uint32, triton::uint64>, triton::uint32> atomOperations;
+
+          /* The operations of the nodes by (node, bitwise context) */
+          std::map<std::pair<triton::ast::AbstractNode*, bool>, triton::uint32> visited;
+
+          MbaCollector(triton::uint32 size) {
+            this->size   = size;
+            this->mask   = (size == 64) ? ~0ULL : ((1ULL << size) - 1);
+            this->failed = false;
+          }
+
+
+          triton::uint32 push(enum mbaOperation_e kind, triton::uint32 op1=0, triton::uint32 op2=0, triton::uint64 value=0) {
+            MbaOperation operation;
+
+            if (this->operations.size() >= MbaSimplification::maxOperations) {
+              this->failed = true;
+              return 0;
+            }
+
+            operation.kind  = kind;
+            operation.op1   = op1;
+            operation.op2   = op2;
+            operation.value = value;
+            this->operations.push_back(operation);
+
+            return static_cast<triton::uint32>(this->operations.size() - 1);
+          }
+
+
+          triton::uint32 atom(triton::ast::AbstractNode* outer, const std::pair<triton::uint32, triton::uint64>& key) {
+            auto it = this->atomOperations.find(key);
+            if (it != this->atomOperations.end())
+              return it->second;
+
+            if (this->atoms.size() >= MbaSimplification::maxAtoms) {
+              this->failed = true;
+              return 0;
+            }
+
+            triton::uint32 index = this->push(MBA_ATOM, 0, 0, this->atoms.size());
+            this->atoms.push_back(outer);
+            this->atomOperations[key] = index;
+
+            return index;
+          }
+
+
+          /* Returns the operation of the lowest bits of a node. Only ADD, SUB, NEG and MUL are linear outside of a bitwise operation. */
+          triton::uint32 collect(triton::ast::AbstractNode* node, bool bitwise, triton::uint32 depth=0) {
+            triton::ast::AbstractNode* outer = node;
+            triton::uint32 index = 0;
+
+            if (this->failed)
+              return 0;
+
+            if (depth > MbaSimplification::maxOperations) {
+              this->failed = true;
+              return 0;
+            }
+
+            /* The lowest bits of a node are computed from the lowest bits of its operands */
+            while (true) {
+              if (node->getKind() == triton::ast::REFERENCE_NODE)
+                node = reinterpret_cast<triton::ast::ReferenceNode*>(node)->getSymbolicExpression()->getAst();
+              else if (node->getKind() == triton::ast::EXTRACT_NODE && reinterpret_cast<triton::ast::DecimalNode*>(node->getChilds()[1])->getValue() == 0)
+                node = node->getChilds()[2];
+              else
+                break;
+            }
+
+            auto key = std::make_pair(node, bitwise);
+            auto it  = this->visited.find(key);
+            if (it != this->visited.end())
+              return it->second;
+
+            std::vector<triton::ast::AbstractNode*>& childs = node->getChilds();
+            enum mbaOperation_e kind = MBA_ATOM;
+
+            switch (node->getKind()) {
+              case triton::ast::BVADD_NODE: kind = MBA_ADD;  break;
+              case triton::ast::BVSUB_NODE: kind = MBA_SUB;  break;
+              case triton::ast::BVNEG_NODE: kind = MBA_NEG;  break;
+              case triton::ast::BVMUL_NODE: kind = MBA_MUL;  break;
+              case triton::ast::BVSHL_NODE: kind = MBA_MUL;  break;
+              case triton::ast::BVNOT_NODE: kind = MBA_NOT;  break;
+              case triton::ast::BVAND_NODE: kind = MBA_AND;  break;
+              case triton::ast::BVOR_NODE:  kind = MBA_OR;   break;
+              case triton::ast::BVXOR_NODE: kind = MBA_XOR;  break;
+              case triton::ast::BVNAND_NODE: kind = MBA_NAND; break;
+              case triton::ast::BVNOR_NODE: kind = MBA_NOR;  break;
+              case triton::ast::BVXNOR_NODE: kind = MBA_XNOR; break;
+              default: break;
+            }
+
+            /* Constants, and the nodes which are not symbolized, are only uniform in a bitwise context if all their bits are the same */
+            if (node->getKind() == triton::ast::BV_NODE || (!node->isSymbolized() && node->getBitvectorSize())) {
+              triton::uint64 value = (node->evaluate() & this->mask).convert_to<triton::uint64>();
+              if (!bitwise || value == 0 || value == this->mask)
+                index = this->push(MBA_CONST, 0, 0, value);
+              else
+                index = this->atom(outer, std::make_pair(1, value));
+            }
+
+            /* Arithmetic operations are atoms in a bitwise context */
+            else if (kind == MBA_ATOM || (bitwise && (kind == MBA_ADD || kind == MBA_SUB || kind == MBA_NEG || kind == MBA_MUL))) {
+              if (node->getKind() == triton::ast::VARIABLE_NODE)
+                index = this->atom(outer, std::make_pair(0, reinterpret_cast<triton::ast::VariableNode*>(node)->getVariableId()));
+              else
+                index = this->atom(outer, std::make_pair(2, reinterpret_cast<triton::uint64>(node)));
+            }
+
+            else if (kind == MBA_MUL) {
+              triton::ast::AbstractNode* factor = nullptr;
+              triton::ast::AbstractNode* term   = nullptr;
+
+              if (node->getKind() == triton::ast::BVSHL_NODE) {
+                if (childs[1]->getKind() == triton::ast::BV_NODE) {
+                  term = childs[0];
+                  if (childs[1]->evaluate() < this->size)
+                    index = this->push(MBA_MUL, this->collect(term, false, depth+1), 0, (1ULL << childs[1]->evaluate().convert_to<triton::uint32>()) & this->mask);
+                  else
+                    index = this->push(MBA_CONST, 0, 0, 0);
+                }
+              }
+              else if (childs[0]->getKind() == triton::ast::BV_NODE) {
+                factor = childs[0];
+                term   = childs[1];
+              }
+              else if (childs[1]->getKind() == triton::ast::BV_NODE) {
+                factor = childs[1];
+                term   = childs[0];
+              }
+
+              if (factor != nullptr)
+                index = this->push(MBA_MUL, this->collect(term, false, depth+1), 0, (factor->evaluate() & this->mask).convert_to<triton::uint64>());
+              else if (term == nullptr)
+                index = this->atom(outer, std::make_pair(2, reinterpret_cast<triton::uint64>(node)));
+            }
+
+            else if (kind == MBA_NEG || kind == MBA_NOT) {
+              index = this->push(kind, this->collect(childs[0], bitwise, depth+1));
+            }
+
+            else {
+              /* The operands of a bitwise operation are in a bitwise context */
+              bool context = (kind != MBA_ADD && kind != MBA_SUB);
+              triton::uint32 op1 = this->collect(childs[0], context, depth+1);
+              triton::uint32 op2 = this->collect(childs[1], context, depth+1);
+              index = this->push(kind, op1, op2);
+            }
+
+            this->visited[key] = index;
+            return index;
+          }
+
+
+          /* Returns the value of the expression when the atoms are 0 or 1 (bit i of assignment is the value of the atom i) */
+          triton::uint64 evaluate(triton::uint32 assignment, std::vector<triton::uint64>& values) const {
+            for (triton::uint32 index = 0; index < this->operations.size(); index++) {
+              const MbaOperation& op = this->operations[index];
+              triton::uint64 v1 = values[op.op1];
+              triton::uint64 v2 = values[op.op2];
+              triton::uint64 value = 0;
+
+              switch (op.kind) {
+                case MBA_ATOM:  value = (assignment >> op.value) & 1; break;
+                case MBA_CONST: value = op.value;                     break;
+                case MBA_ADD:   value = v1 + v2;                      break;
+                case MBA_SUB:   value = v1 - v2;                      break;
+                case MBA_MUL:   value = v1 * op.value;                break;
+                case MBA_NEG:   value = 0 - v1;                       break;
+                case MBA_NOT:   value = ~v1;                          break;
+                case MBA_AND:   value = v1 & v2;                      break;
+                case MBA_OR:    value = v1 | v2;                      break;
+                case MBA_XOR:   value = v1 ^ v2;                      break;
+                case MBA_NAND:  value = ~(v1 & v2);                   break;
+                case MBA_NOR:   value = ~(v1 | v2);                   break;
+                case MBA_XNOR:  value = ~(v1 ^ v2);                   break;
+              }
+
+              values[index] = value & this->mask;
+            }
+
+            return values.back();
+          }
+      };
+
+
+      /* Builds the nodes of a candidate, or only counts them */
+      class MbaBuilder {
+        public:
+          const MbaCollector& collector;
+          triton::usize cost;
+          bool build;
+
+          MbaBuilder(const MbaCollector& collector, bool build) : collector(collector) {
+            this->cost  = 0;
+            this->build = build;
+          }
+
+
+          triton::ast::AbstractNode* atom(triton::uint32 index) {
+            triton::ast::AbstractNode* node = this->collector.atoms[index];
+
+            this->cost++;
+            if (!this->build)
+              return nullptr;
+
+            if (node->getBitvectorSize() > this->collector.size)
+              return triton::ast::extract(this->collector.size - 1, 0, node);
+
+            return node;
+          }
+
+
+          triton::ast::AbstractNode* constant(triton::uint64 value) {
+            this->cost++;
+            return this->build ? triton::ast::bv(value, this->collector.size) : nullptr;
+          }
+
+
+          triton::ast::AbstractNode* operation(enum mbaOperation_e kind, triton::ast::AbstractNode* op1, triton::ast::AbstractNode* op2=nullptr) {
+            this->cost++;
+            if (!this->build)
+              return nullptr;
+
+            switch (kind) {
+              case MBA_ADD: return triton::ast::bvadd(op1, op2);
+              case MBA_SUB: return triton::ast::bvsub(op1, op2);
+              case MBA_MUL: return triton::ast::bvmul(op1, op2);
+              case MBA_NEG: return triton::ast::bvneg(op1);
+              case MBA_NOT: return triton::ast::bvnot(op1);
+              case MBA_AND: return triton::ast::bvand(op1, op2);
+              case MBA_OR:  return triton::ast::bvor(op1, op2);
+              case MBA_XOR: return triton::ast::bvxor(op1, op2);
+              default:
+                throw triton::exceptions::SymbolicSimplification("MbaBuilder::operation(): Invalid operation.");
+            }
+          }
+
+
+          /* Returns the conjunction of the atoms of a set */
+          triton::ast::AbstractNode* conjunction(triton::uint32 set) {
+            triton::ast::AbstractNode* node = nullptr;
+            bool first = true;
+
+            for (triton::uint32 index = 0; index < this->collector.atoms.size(); index++) {
+              if ((set >> index) & 1) {
+                node  = first ? this->atom(index) : this->operation(MBA_AND, node, this->atom(index));
+                first = false;
+              }
+            }
+
+            return node;
+          }
+
+
+          /* Adds coefficient * term to a sum. Coefficients of the upper half are subtracted. */
+          triton::ast::AbstractNode* addTerm(triton::ast::AbstractNode* sum, bool& empty, triton::ast::AbstractNode* term, triton::uint64 coefficient) {
+            bool negative = (coefficient > (this->collector.mask >> 1));
+
+            if (negative)
+              coefficient = (0 - coefficient) & this->collector.mask;
+
+            if (coefficient != 1)
+              term = this->operation(MBA_MUL, term, this->constant(coefficient));
+
+            if (empty) {
+              empty = false;
+              return negative ? this->operation(MBA_NEG, term) : term;
+            }
+
+            return this->operation(negative ? MBA_SUB : MBA_ADD, sum, term);
+          }
+
+
+          /* Adds a constant to a sum */
+          triton::ast::AbstractNode* addConstant(triton::ast::AbstractNode* sum, bool empty, triton::uint64 value) {
+            if (empty)
+              return this->constant(value);
+
+            if (value == 0)
+              return sum;
+
+            if (value > (this->collector.mask >> 1))
+              return this->operation(MBA_SUB, sum, this->constant((0 - value) & this->collector.mask));
+
+            return this->operation(MBA_ADD, sum, this->constant(value));
+          }
+
+
+          /* Returns the bitwise expression of a truth table (bit i of an index is the value of the atom i) */
+          triton::ast::AbstractNode* bitwise(const std::vector<bool>& table) {
+            std::vector<triton::uint32> atoms;
+            std::vector<bool> reduced;
+
+            /* The atoms the table depends on */
+            for (triton::uint32 index = 0; index < this->collector.atoms.size(); index++) {
+              for (triton::uint32 assignment = 0; assignment < table.size(); assignment++) {
+                if (table[assignment] != table[assignment ^ (1 << index)]) {
+                  atoms.push_back(index);
+                  break;
+                }
+              }
+            }
+
+            for (triton::uint32 assignment = 0; assignment < (1U << atoms.size()); assignment++) {
+              triton::uint32 full = 0;
+              for (triton::uint32 index = 0; index < atoms.size(); index++)
+                full |= ((assignment >> index) & 1) << atoms[index];
+              reduced.push_back(table[full]);
+            }
+
+            if (atoms.size() == 0)
+              return this->constant(reduced[0] ? this->collector.mask : 0);
+
+            if (atoms.size() == 1)
+              return reduced[0] ? this->operation(MBA_NOT, this->atom(atoms[0])) : this->atom(atoms[0]);
+
+            if (atoms.size() == 2) {
+              triton::uint32 function = reduced[0] | (reduced[1] << 1) | (reduced[2] << 2) | (reduced[3] << 3);
+              switch (function) {
+                case 1:  return this->operation(MBA_NOT, this->operation(MBA_OR,  this->atom(atoms[0]), this->atom(atoms[1])));
+                case 2:  return this->operation(MBA_AND, this->atom(atoms[0]), this->operation(MBA_NOT, this->atom(atoms[1])));
+                case 4:  return this->operation(MBA_AND, this->operation(MBA_NOT, this->atom(atoms[0])), this->atom(atoms[1]));
+                case 6:  return this->operation(MBA_XOR, this->atom(atoms[0]), this->atom(atoms[1]));
+                case 7:  return this->operation(MBA_NOT, this->operation(MBA_AND, this->atom(atoms[0]), this->atom(atoms[1])));
+                case 8:  return this->operation(MBA_AND, this->atom(atoms[0]), this->atom(atoms[1]));
+                case 9:  return this->operation(MBA_NOT, this->operation(MBA_XOR, this->atom(atoms[0]), this->atom(atoms[1])));
+                case 11: return this->operation(MBA_OR,  this->atom(atoms[0]), this->operation(MBA_NOT, this->atom(atoms[1])));
+                case 13: return this->operation(MBA_OR,  this->operation(MBA_NOT, this->atom(atoms[0])), this->atom(atoms[1]));
+                case 14: return this->operation(MBA_OR,  this->atom(atoms[0]), this->atom(atoms[1]));
+                default: break;
+              }
+            }
+
+            /* Algebraic normal form: the xor of the conjunctions of its monomials */
+            for (triton::uint32 index = 0; index < atoms.size(); index++) {
+              for (triton::uint32 assignment = 0; assignment < reduced.size(); assignment++) {
+                if ((assignment >> index) & 1)
+                  reduced[assignment] = reduced[assignment] != reduced[assignment ^ (1 << index)];
+              }
+            }
+
+            triton::ast::AbstractNode* node = nullptr;
+            bool first = true;
+            for (triton::uint32 monomial = 1; monomial < reduced.size(); monomial++) {
+              if (!reduced[monomial])
+                continue;
+              triton::uint32 set = 0;
+              for (triton::uint32 index = 0; index < atoms.size(); index++)
+                set |= ((monomial >> index) & 1) << atoms[index];
+              node  = first ? this->conjunction(set) : this->operation(MBA_XOR, node, this->conjunction(set));
+              first = false;
+            }
+
+            return reduced[0] ? this->operation(MBA_NOT, node) : node;
+          }
+      };
+
+
+      /* Returns the sum of the conjunctions of atoms multiplied by their coefficients */
+      static triton::ast::AbstractNode* linearCandidate(MbaBuilder& builder, const std::vector<triton::uint64>& coefficients) {
+        triton::ast::AbstractNode* sum = nullptr;
+        bool empty = true;
+
+        for (triton::uint32 set = 1; set < coefficients.size(); set++) {
+          if (coefficients[set] != 0)
+            sum = builder.addTerm(sum, empty, builder.conjunction(set), coefficients[set]);
+        }
+
+        /* The empty conjunction is all ones (-1) */
+        return builder.addConstant(sum, empty, (0 - coefficients[0]) & builder.collector.mask);
+      }
+
+
+      /* Returns coefficient * bitwise(table) - value */
+      static triton::ast::AbstractNode* bitwiseCandidate(MbaBuilder& builder, const std::vector<bool>& table, triton::uint64 coefficient, triton::uint64 value) {
+        bool empty = true;
+        triton::ast::AbstractNode* sum = builder.addTerm(nullptr, empty, builder.bitwise(table), coefficient);
+        return builder.addConstant(sum, empty, (0 - value) & builder.collector.mask);
+      }
+
+
+      triton::ast::AbstractNode* MbaSimplification::simplify(triton::ast::AbstractNode* node) const {
+        triton::ast::AbstractNode* simplified = nullptr;
+
+        switch (node->getKind()) {
+          /* The extended bits are kept */
+          case triton::ast::SX_NODE:
+          case triton::ast::ZX_NODE: {
+            triton::uint32 sizeExt = reinterpret_cast<triton::ast::DecimalNode*>(node->getChilds()[0])->getValue().convert_to<triton::uint32>();
+            simplified = this->simplify(node->getChilds()[1]);
+            if (simplified == node->getChilds()[1])
+              return node;
+            if (node->getKind() == triton::ast::SX_NODE)
+              return triton::ast::sx(sizeExt, simplified);
+            return triton::ast::zx(sizeExt, simplified);
+          }
+
+          default:
+            break;
+        }
+
+        if (node->getBitvectorSize() == 0 || node->getBitvectorSize() > 64 || !node->isSymbolized())
+          return node;
+
+        simplified = this->reduce(node, node->getBitvectorSize());
+        return (simplified != nullptr) ? simplified : node;
+      }
+
+
+      triton::ast::AbstractNode* MbaSimplification::reduce(triton::ast::AbstractNode* node, triton::uint32 size) const {
+        MbaCollector collector(size);
+
+        collector.collect(node, false);
+        if (collector.failed || collector.operations.back().kind == MBA_ATOM || collector.operations.back().kind == MBA_CONST)
+          return nullptr;
+
+        /* The signature vector. The value of a bitwise expression for the assignment b is t(b) - 2 * t(0), where t is its truth table. */
+        triton::uint32 count = 1 << collector.atoms.size();
+        std::vector<triton::uint64> signature(count);
+        std::vector<triton::uint64> values(collector.operations.size());
+
+        for (triton::uint32 assignment = 0; assignment < count; assignment++)
+          signature[assignment] = collector.evaluate(assignment, values);
+
+        triton::uint64 zero = signature[0];
+        for (triton::uint32 assignment = 0; assignment < count; assignment++)
+          signature[assignment] = (signature[assignment] - 2 * zero) & collector.mask;
+
+        /* The coefficients of the conjunctions (Moebius transform) */
+        std::vector<triton::uint64> coefficients(signature);
+        for (triton::uint32 index = 0; index < collector.atoms.size(); index++) {
+          for (triton::uint32 assignment = 0; assignment < count; assignment++) {
+            if ((assignment >> index) & 1)
+              coefficients[assignment] = (coefficients[assignment] - coefficients[assignment ^ (1 << index)]) & collector.mask;
+          }
+        }
+
+        /* A signature of two values u and v is (v - u) * t + u, and the expression is (v - u) * bitwise(t) - u */
+        triton::uint64 first  = signature[0];
+        triton::uint64 second = first;
+        bool twoValued = true;
+        for (triton::uint32 assignment = 0; assignment < count; assignment++) {
+          if (signature[assignment] == first)
+            continue;
+          if (second == first)
+            second = signature[assignment];
+          else if (signature[assignment] != second)
+            twoValued = false;
+        }
+
+        MbaBuilder counter(collector, false);
+        linearCandidate(counter, coefficients);
+        triton::usize best = counter.cost;
+        triton::uint32 choice = 0;
+
+        std::vector<bool> table(count);
+        if (twoValued && second != first) {
+          for (triton::uint32 assignment = 0; assignment < count; assignment++)
+            table[assignment] = (signature[assignment] == second);
+
+          MbaBuilder direct(collector, false);
+          bitwiseCandidate(direct, table, (second - first) & collector.mask, first);
+          if (direct.cost < best) {
+            best   = direct.cost;
+            choice = 1;
+          }
+
+          table.flip();
+          MbaBuilder inverse(collector, false);
+          bitwiseCandidate(inverse, table, (first - second) & collector.mask, second);
+          if (inverse.cost < best) {
+            best   = inverse.cost;
+            choice = 2;
+          }
+
+          if (choice != 2)
+            table.flip();
+        }
+
+        if (best >= collector.operations.size())
+          return nullptr;
+
+        MbaBuilder builder(collector, true);
+        switch (choice) {
+          case 1:  return bitwiseCandidate(builder, table, (second - first) & collector.mask, first);
+          case 2:  return bitwiseCandidate(builder, table, (first - second) & collector.mask, second);
+          default: return linearCandidate(builder, coefficients);
+        }
+      }
+
+    }; /* symbolic namespace */
+  }; /* engines namespace */
+}; /*triton namespace */
@@ -15,11 +15,15 @@ namespace triton {
     namespace symbolic {
 
       PathConstraint::PathConstraint() {
+        this->pcAst  = nullptr;
+        this->pcSize = 0;
       }
 
 
       PathConstraint::PathConstraint(const PathConstraint &copy) {
         this->branches = copy.branches;
+        this->pcAst    = copy.pcAst;
+        this->pcSize   = copy.pcSize;
       }
 
 
@@ -30,15 +34,61 @@ namespace triton {
       void PathConstraint::addBranchConstraint(bool taken, triton::uint64 srcAddr, triton::uint64 dstAddr, triton::ast::AbstractNode* pc) {
         if (pc == nullptr)
           throw triton::exceptions::PathConstraint("PathConstraint::addBranchConstraint(): The PC node cannot be null.");
+        pc->incReference();
         this->branches.push_back(std::make_tuple(taken, srcAddr, dstAddr, pc));
       }
 
 
+      void PathConstraint::addBranchConstraint(bool taken, triton::uint64 srcAddr, triton::uint64 dstAddr) {
+        this->branches.push_back(std::make_tuple(taken, srcAddr, dstAddr, static_cast<triton::ast::AbstractNode*>(nullptr)));
+      }
+
+
+      void PathConstraint::setPcAst(triton::ast::AbstractNode* pc, triton::uint32 size) {
+        if (pc == nullptr)
+          throw triton::exceptions::PathConstraint("PathConstraint::setPcAst(): The PC node cannot be null.");
+        pc->incReference();
+        this->pcAst  = pc;
+        this->pcSize = size;
+      }
+
+
+      /* [private method] Builds the constraints of lazy branches, they share the equality with the taken address */
+      void PathConstraint::buildBranchConstraints(void) const {
+        triton::ast::AbstractNode* taken = nullptr;
+
+        for (auto it = this->branches.begin(); it != this->branches.end(); it++) {
+          if (std::get<3>(*it) != nullptr)
+            continue;
+
+          if (this->pcAst == nullptr)
+            throw triton::exceptions::PathConstraint("PathConstraint::buildBranchConstraints(): The PC node is not defined.");
+
+          if (taken == nullptr)
+            taken = triton::ast::equal(this->pcAst, triton::ast::bv(this->getTakenAddress(), this->pcSize));
+
+          std::get<3>(*it) = (std::get<0>(*it) ? taken : triton::ast::lnot(taken));
+          std::get<3>(*it)->incReference();
+        }
+      }
+
+
       const std::vector<std::tuple<bool, triton::uint64, triton::uint64, triton::ast::AbstractNode*>>& PathConstraint::getBranchConstraints(void) const {
+        this->buildBranchConstraints();
         return this->branches;
       }
 
 
+      triton::ast::AbstractNode* PathConstraint::getPcAst(void) const {
+        return this->pcAst;
+      }
+
+
+      triton::uint32 PathConstraint::getPcSize(void) const {
+        return this->pcSize;
+      }
+
+
       triton::uint64 PathConstraint::getTakenAddress(void) const {
         for (auto it = this->branches.begin(); it != this->branches.end(); it++) {
           if (std::get<0>(*it) == true)
@@ -49,6 +99,7 @@ namespace triton {
 
 
       triton::ast::AbstractNode* PathConstraint::getTakenPathConstraintAst(void) const {
+        this->buildBranchConstraints();
         for (auto it = this->branches.begin(); it != this->branches.end(); it++) {
           if (std::get<0>(*it) == true)
             return std::get<3>(*it);
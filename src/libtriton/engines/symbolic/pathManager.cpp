@@ -5,6 +5,11 @@
 **  This program is under the terms of the BSD License.
 */
 
+#include <algorithm>
+#include <unordered_set>
+
+#include <api.hpp>
+#include <coreUtils.hpp>
 #include <exceptions.hpp>
 #include <pathManager.hpp>
 #include <symbolicEnums.hpp>
@@ -15,10 +20,24 @@ namespace triton {
   namespace engines {
     namespace symbolic {
 
+      /* FNV-1a parameters on 128 bits */
+      static const triton::uint128 hashOffset = (triton::uint128(0x6c62272e07bb0142ULL) << 64) | triton::uint128(0x62b821756295c58dULL);
+      static const triton::uint128 hashPrime  = (triton::uint128(0x0000000001000000ULL) << 64) | triton::uint128(0x000000000000013bULL);
+
+
+      static inline triton::uint128 hashMix(const triton::uint128& h, const triton::uint128& value) {
+        return (h ^ value) * hashPrime;
+      }
+
+
       PathManager::PathManager(triton::modes::Modes* modes) {
         if (modes == nullptr)
           throw triton::exceptions::PathManager("PathManager::PathManager(): The modes API cannot be null.");
-        this->modes = modes;
+        this->modes                       = modes;
+        this->conjunction                 = nullptr;
+        this->conjunctionSize             = 0;
+        this->maxPathConstraintsPerBranch = 0;
+        this->expressionHashesRevision    = 0;
       }
 
 
@@ -32,8 +51,136 @@ namespace triton {
 
 
       void PathManager::copy(const PathManager& other) {
-        this->modes           = other.modes;
-        this->pathConstraints = other.pathConstraints;
+        this->modes                       = other.modes;
+        this->pathConstraints             = other.pathConstraints;
+        this->conjunction                 = other.conjunction;
+        this->conjunctionSize             = other.conjunctionSize;
+        this->pathConstraintKeys          = other.pathConstraintKeys;
+        this->keys                        = other.keys;
+        this->branchCounts                = other.branchCounts;
+        this->maxPathConstraintsPerBranch = other.maxPathConstraintsPerBranch;
+        this->expressionHashes            = other.expressionHashes;
+        this->expressionHashesRevision    = other.expressionHashesRevision;
+        this->pathConstraintVariables     = other.pathConstraintVariables;
+        this->variableConstraints         = other.variableConstraints;
+      }
+
+
+      /* Post-order walk, iterative as references may be chained on long traces */
+      triton::uint128 PathManager::hashAst(triton::ast::AbstractNode* node) {
+        std::map<triton::ast::AbstractNode*, triton::uint128> hashes;
+        std::vector<std::pair<triton::ast::AbstractNode*, bool>> worklist;
+
+        /* Hashes of expressions are flushed if an expression has been replaced */
+        if (this->expressionHashesRevision != SymbolicExpression::getRevision()) {
+          this->expressionHashes.clear();
+          this->expressionHashesRevision = SymbolicExpression::getRevision();
+        }
+
+        worklist.push_back(std::make_pair(node, false));
+        while (!worklist.empty()) {
+          triton::ast::AbstractNode* current = worklist.back().first;
+          bool expanded                      = worklist.back().second;
+
+          if (hashes.find(current) != hashes.end()) {
+            worklist.pop_back();
+            continue;
+          }
+
+          /* A reference has the hash of the AST it points to */
+          if (current->getKind() == triton::ast::REFERENCE_NODE) {
+            triton::usize id = reinterpret_cast<triton::ast::ReferenceNode*>(current)->getValue();
+            triton::ast::AbstractNode* target = nullptr;
+
+            auto memo = this->expressionHashes.find(id);
+            if (memo != this->expressionHashes.end()) {
+              hashes[current] = memo->second;
+              worklist.pop_back();
+              continue;
+            }
+
+            triton::engines::symbolic::SymbolicExpression* expr = reinterpret_cast<triton::ast::ReferenceNode*>(current)->getSymbolicExpression();
+            if (expr != nullptr)
+              target = expr->getAst();
+
+            if (target == nullptr) {
+              hashes[current] = hashMix(hashMix(hashOffset, current->getKind()), id);
+              worklist.pop_back();
+            }
+            else if (!expanded) {
+              worklist.back().second = true;
+              worklist.push_back(std::make_pair(target, false));
+            }
+            else {
+              hashes[current] = hashes[target];
+              this->expressionHashes[id] = hashes[current];
+              worklist.pop_back();
+            }
+            continue;
+          }
+
+          if (!expanded) {
+            worklist.back().second = true;
+            for (auto it = current->getChilds().begin(); it != current->getChilds().end(); it++)
+              worklist.push_back(std::make_pair(*it, false));
+            continue;
+          }
+
+          triton::uint128 h = hashMix(hashMix(hashOffset, current->getKind()), current->getBitvectorSize());
+
+          switch (current->getKind()) {
+            case triton::ast::DECIMAL_NODE: {
+              triton::uint512 value = reinterpret_cast<triton::ast::DecimalNode*>(current)->getValue();
+              for (triton::uint32 index = 0; index < 4; index++) {
+                h = hashMix(h, (value & ((triton::uint512(1) << 128) - 1)).convert_to<triton::uint128>());
+                value >>= 128;
+              }
+              break;
+            }
+
+            case triton::ast::STRING_NODE: {
+              std::string value = reinterpret_cast<triton::ast::StringNode*>(current)->getValue();
+              for (auto it = value.begin(); it != value.end(); it++)
+                h = hashMix(h, static_cast<triton::uint8>(*it));
+              break;
+            }
+
+            case triton::ast::VARIABLE_NODE:
+              h = hashMix(h, reinterpret_cast<triton::ast::VariableNode*>(current)->getVariableId());
+              break;
+
+            default:
+              break;
+          }
+
+          for (auto it = current->getChilds().begin(); it != current->getChilds().end(); it++)
+            h = hashMix(h, hashes[*it]);
+
+          hashes[current] = h;
+          worklist.pop_back();
+        }
+
+        return hashes[node];
+      }
+
+
+      /* The variables of the AST are summarized on its root node */
+      void PathManager::indexPathConstraint(triton::ast::AbstractNode* node) {
+        std::vector<triton::usize> variables = triton::ast::VariableSet::getIds(node->getVariables());
+        triton::usize index = this->pathConstraintVariables.size();
+
+        for (auto it = variables.begin(); it != variables.end(); it++)
+          this->variableConstraints[*it].push_back(index);
+
+        this->pathConstraintVariables.push_back(node->getVariables());
+      }
+
+
+      void PathManager::recordPathConstraint(triton::uint64 srcAddr, const triton::uint128& key) {
+        this->pathConstraintKeys.push_back(std::make_pair(srcAddr, key));
+        this->branchCounts[srcAddr]++;
+        if (key != 0)
+          this->keys[key]++;
       }
 
 
@@ -45,21 +192,23 @@ namespace triton {
 
       /* Returns the logical conjunction AST of path constraint */
       triton::ast::AbstractNode* PathManager::getPathConstraintsAst(void) const {
-        std::vector<triton::engines::symbolic::PathConstraint>::const_iterator it;
-        triton::ast::AbstractNode* node = nullptr;
-
         /* by default PC is T (top) */
-        node = triton::ast::equal(
-                 triton::ast::bvtrue(),
-                 triton::ast::bvtrue()
-               );
-
-        /* Then, we create a conjunction of pc */
-        for (it = this->pathConstraints.begin(); it != this->pathConstraints.end(); it++) {
-          node = triton::ast::land(node, it->getTakenPathConstraintAst());
+        if (this->conjunction == nullptr) {
+          this->conjunction = triton::ast::equal(
+                                triton::ast::bvtrue(),
+                                triton::ast::bvtrue()
+                              );
+          this->conjunction->incReference();
+          this->conjunctionSize = 0;
+        }
+
+        /* Then, we extend the conjunction with the new pc. The conjunction holds a reference, as the path constraints do. */
+        for (; this->conjunctionSize < this->pathConstraints.size(); this->conjunctionSize++) {
+          this->conjunction = triton::ast::land(this->conjunction, this->pathConstraints[this->conjunctionSize].getTakenPathConstraintAst());
+          this->conjunction->incReference();
         }
 
-        return node;
+        return this->conjunction;
       }
 
 
@@ -68,6 +217,69 @@ namespace triton {
       }
 
 
+      std::vector<triton::usize> PathManager::getPathConstraintsSlice(triton::usize index) const {
+        std::unordered_set<triton::usize> constraints;
+        std::unordered_set<triton::usize> visited;
+        std::vector<triton::usize> worklist;
+        std::vector<triton::usize> slice;
+
+        if (index >= this->pathConstraints.size())
+          throw triton::exceptions::PathManager("PathManager::getPathConstraintsSlice(): Invalid path constraint index.");
+
+        std::vector<triton::usize> variables = triton::ast::VariableSet::getIds(this->pathConstraintVariables[index]);
+        for (auto it = variables.begin(); it != variables.end(); it++) {
+          visited.insert(*it);
+          worklist.push_back(*it);
+        }
+
+        /* Every constraint of the prefix which depends on a variable of the slice is in the slice */
+        while (!worklist.empty()) {
+          const std::vector<triton::usize>& indexes = this->variableConstraints.at(worklist.back());
+          worklist.pop_back();
+
+          for (auto it = indexes.begin(); it != indexes.end() && *it < index; it++) {
+            if (!constraints.insert(*it).second)
+              continue;
+            slice.push_back(*it);
+            variables = triton::ast::VariableSet::getIds(this->pathConstraintVariables[*it]);
+            for (auto var = variables.begin(); var != variables.end(); var++) {
+              if (visited.insert(*var).second)
+                worklist.push_back(*var);
+            }
+          }
+        }
+
+        std::sort(slice.begin(), slice.end());
+        return slice;
+      }
+
+
+      triton::ast::AbstractNode* PathManager::getPathConstraintsSliceAst(triton::usize index) const {
+        triton::ast::AbstractNode* ret = triton::ast::equal(triton::ast::bvtrue(), triton::ast::bvtrue());
+        std::vector<triton::usize> slice = this->getPathConstraintsSlice(index);
+
+        for (auto it = slice.begin(); it != slice.end(); it++)
+          ret = triton::ast::land(ret, this->pathConstraints[*it].getTakenPathConstraintAst());
+
+        return ret;
+      }
+
+
+      triton::usize PathManager::getPathManagerMemoryUsage(void) const {
+        /* Most path constraints are made of a taken and a not taken branch */
+        triton::usize branches = 2 * sizeof(std::tuple<bool, triton::uint64, triton::uint64, triton::ast::AbstractNode*>);
+
+        return this->pathConstraints.capacity() * sizeof(triton::engines::symbolic::PathConstraint) +
+               this->pathConstraints.size() * branches +
+               this->pathConstraintKeys.capacity() * sizeof(std::pair<triton::uint64, triton::uint128>) +
+               this->keys.size() * triton::utils::getTreeNodeSize(sizeof(std::pair<const triton::uint128, triton::usize>)) +
+               this->branchCounts.size() * triton::utils::getTreeNodeSize(sizeof(std::pair<const triton::uint64, triton::usize>)) +
+               this->expressionHashes.size() * triton::utils::getTreeNodeSize(sizeof(std::pair<const triton::usize, triton::uint128>)) +
+               this->pathConstraintVariables.capacity() * sizeof(const triton::ast::VariableSet*) +
+               this->variableConstraints.size() * sizeof(std::pair<const triton::usize, std::vector<triton::usize>>);
+      }
+
+
       /* Add a path constraint */
       void PathManager::addPathConstraint(const triton::arch::Instruction& inst, triton::engines::symbolic::SymbolicExpression* expr) {
         triton::engines::symbolic::PathConstraint pco;
@@ -75,6 +287,7 @@ namespace triton {
         triton::uint64 srcAddr        = 0;
         triton::uint64 dstAddr        = 0;
         triton::uint32 size           = 0;
+        triton::uint128 key           = 0;
 
         pc = expr->getAst();
         if (pc == nullptr)
@@ -96,37 +309,146 @@ namespace triton {
         if (size == 0)
           throw triton::exceptions::PathManager("PathManager::addPathConstraint(): The PC node size cannot be zero.");
 
+        /* Once a branch has reached its maximum number of path constraints, it is not tracked anymore */
+        if (this->maxPathConstraintsPerBranch) {
+          auto count = this->branchCounts.find(srcAddr);
+          if (count != this->branchCounts.end() && count->second >= this->maxPathConstraintsPerBranch)
+            return;
+        }
+
         if (pc->getKind() == triton::ast::ZX_NODE)
           pc = pc->getChilds()[1];
 
+        /* If PC_DEDUPLICATION is enabled, a path constraint already in the conjunction is not recorded (A and A = A). */
+        if (this->modes->isModeEnabled(triton::modes::PC_DEDUPLICATION)) {
+          key = hashMix(hashMix(this->hashAst(pc), size), dstAddr);
+          if (key == 0)
+            key = 1;
+          if (this->keys.find(key) != this->keys.end())
+            return;
+        }
+
         /* Multiple branches */
         if (pc->getKind() == triton::ast::ITE_NODE) {
           triton::uint64 bb1 = pc->getChilds()[1]->evaluate().convert_to<triton::uint64>();
           triton::uint64 bb2 = pc->getChilds()[2]->evaluate().convert_to<triton::uint64>();
 
-          triton::ast::AbstractNode* bb1pc = (bb1 == dstAddr) ? triton::ast::equal(pc, triton::ast::bv(dstAddr, size)) :
-                                                                triton::ast::lnot(triton::ast::equal(pc, triton::ast::bv(dstAddr, size)));
-
-          triton::ast::AbstractNode* bb2pc = (bb2 == dstAddr) ? triton::ast::equal(pc, triton::ast::bv(dstAddr, size)) :
-                                                                triton::ast::lnot(triton::ast::equal(pc, triton::ast::bv(dstAddr, size)));
-
-          pco.addBranchConstraint(bb1 == dstAddr, srcAddr, bb1, bb1pc);
-          pco.addBranchConstraint(bb2 == dstAddr, srcAddr, bb2, bb2pc);
-
-          this->pathConstraints.push_back(pco);
+          pco.addBranchConstraint(bb1 == dstAddr, srcAddr, bb1);
+          pco.addBranchConstraint(bb2 == dstAddr, srcAddr, bb2);
         }
 
         /* Direct branch */
         else {
-          pco.addBranchConstraint(true, srcAddr, dstAddr, triton::ast::equal(pc, triton::ast::bv(dstAddr, size)));
-          this->pathConstraints.push_back(pco);
+          pco.addBranchConstraint(true, srcAddr, dstAddr);
         }
 
+        /* The constraints of the branches are built on demand */
+        pco.setPcAst(pc, size);
+        this->pathConstraints.push_back(pco);
+        this->recordPathConstraint(srcAddr, key);
+        this->indexPathConstraint(pc);
+      }
+
+
+      void PathManager::addPathConstraint(const triton::engines::symbolic::PathConstraint& pco) {
+        triton::uint128 key = 0;
+
+        if (pco.getBranchConstraints().empty())
+          throw triton::exceptions::PathManager("PathManager::addPathConstraint(): The path constraint is empty.");
+
+        /* Keyed like the constraints of instructions, so that they are not added again (PC_DEDUPLICATION) */
+        if (this->modes->isModeEnabled(triton::modes::PC_DEDUPLICATION) && pco.getPcAst() != nullptr) {
+          key = hashMix(hashMix(this->hashAst(pco.getPcAst()), pco.getPcSize()), pco.getTakenAddress());
+          if (key == 0)
+            key = 1;
+        }
+
+        this->pathConstraints.push_back(pco);
+        this->recordPathConstraint(std::get<1>(pco.getBranchConstraints().front()), key);
+        this->indexPathConstraint(pco.getPcAst() != nullptr ? pco.getPcAst() : pco.getTakenPathConstraintAst());
       }
 
 
       void PathManager::clearPathConstraints(void) {
         this->pathConstraints.clear();
+        this->pathConstraintKeys.clear();
+        this->keys.clear();
+        this->branchCounts.clear();
+        this->pathConstraintVariables.clear();
+        this->variableConstraints.clear();
+        this->conjunction     = nullptr;
+        this->conjunctionSize = 0;
+      }
+
+
+      void PathManager::truncatePathConstraints(triton::usize size) {
+        /* Ids of the symbolic expressions may be given again after a rollback */
+        this->expressionHashes.clear();
+
+        if (size >= this->pathConstraints.size())
+          return;
+
+        /* The indexes of the removed constraints are the last ones of their variables */
+        for (auto it = this->pathConstraintVariables.begin() + size; it != this->pathConstraintVariables.end(); it++) {
+          std::vector<triton::usize> variables = triton::ast::VariableSet::getIds(*it);
+          for (auto var = variables.begin(); var != variables.end(); var++) {
+            std::vector<triton::usize>& indexes = this->variableConstraints[*var];
+            indexes.pop_back();
+            if (indexes.empty())
+              this->variableConstraints.erase(*var);
+          }
+        }
+        this->pathConstraintVariables.erase(this->pathConstraintVariables.begin() + size, this->pathConstraintVariables.end());
+
+        for (auto it = this->pathConstraintKeys.begin() + size; it != this->pathConstraintKeys.end(); it++) {
+          if (--this->branchCounts[it->first] == 0)
+            this->branchCounts.erase(it->first);
+          if (it->second != 0 && --this->keys[it->second] == 0)
+            this->keys.erase(it->second);
+        }
+
+        this->pathConstraints.erase(this->pathConstraints.begin() + size, this->pathConstraints.end());
+        this->pathConstraintKeys.erase(this->pathConstraintKeys.begin() + size, this->pathConstraintKeys.end());
+
+        /* The conjunction is built again from the remaining constraints */
+        if (this->conjunctionSize > size) {
+          this->conjunction     = nullptr;
+          this->conjunctionSize = 0;
+        }
+      }
+
+
+      /* The indexes of the remaining constraints are shifted, so they are recorded and indexed again */
+      void PathManager::dropOldestPathConstraints(triton::usize count) {
+        count = std::min(count, this->pathConstraints.size());
+        if (count == 0)
+          return;
+
+        std::vector<triton::engines::symbolic::PathConstraint> constraints(this->pathConstraints.begin() + count, this->pathConstraints.end());
+        std::vector<std::pair<triton::uint64, triton::uint128>> keys(this->pathConstraintKeys.begin() + count, this->pathConstraintKeys.end());
+        std::vector<const triton::ast::VariableSet*> variables(this->pathConstraintVariables.begin() + count, this->pathConstraintVariables.end());
+
+        this->clearPathConstraints();
+
+        for (triton::usize index = 0; index < constraints.size(); index++) {
+          std::vector<triton::usize> ids = triton::ast::VariableSet::getIds(variables[index]);
+          for (auto it = ids.begin(); it != ids.end(); it++)
+            this->variableConstraints[*it].push_back(index);
+
+          this->pathConstraints.push_back(constraints[index]);
+          this->pathConstraintVariables.push_back(variables[index]);
+          this->recordPathConstraint(keys[index].first, keys[index].second);
+        }
+      }
+
+
+      triton::usize PathManager::getMaxPathConstraintsPerBranch(void) const {
+        return this->maxPathConstraintsPerBranch;
+      }
+
+
+      void PathManager::setMaxPathConstraintsPerBranch(triton::usize limit) {
+        this->maxPathConstraintsPerBranch = limit;
       }
 
 
@@ -5,10 +5,15 @@
 **  This program is under the terms of the BSD License.
 */
 
+#include <algorithm>
 #include <cstring>
+#include <iterator>
+#include <limits>
 #include <new>
 
 #include <exceptions.hpp>
+#include <astSerialization.hpp>
+#include <astTraversal.hpp>
 #include <coreUtils.hpp>
 #include <symbolicEngine.hpp>
 
@@ -92,12 +97,30 @@ namespace triton {
         for (triton::uint32 i = 0; i < this->numberOfRegisters; i++)
           this->symbolicReg[i] = triton::engines::symbolic::UNSET;
 
-        this->callbacks       = callbacks;
-        this->backupFlag      = isBackup;
-        this->enableFlag      = true;
-        this->modes           = modes;
-        this->uniqueSymExprId = 0;
-        this->uniqueSymVarId  = 0;
+        this->callbacks              = callbacks;
+        this->collectThreshold       = SymbolicEngine::minCollectThreshold;
+        this->concreteOnly           = false;
+        this->dependencySink         = nullptr;
+        this->enableFlag             = true;
+        this->fullAstsRevision       = SymbolicExpression::getRevision();
+        this->inlineReferenceSize    = SymbolicEngine::defaultInlineReferenceSize;
+        this->instructionWindow      = 0;
+        this->journalFlag            = false;
+        this->maxExpressionDepth     = 0;
+        this->maxExpressionSize      = 0;
+        this->memoryArrayGeneration  = 0;
+        this->memoryArrayId          = triton::engines::symbolic::UNSET;
+        this->modes                  = modes;
+        this->nodeBudget             = 0;
+        this->nodeBudgetThreshold    = 0;
+        this->taintedIndexId         = 0;
+        this->uniqueSymExprId        = 0;
+        this->uniqueSymVarId         = 0;
+        this->windowArrayGeneration  = triton::engines::symbolic::UNSET;
+        this->windowSlides           = 0;
+
+        this->defaultPointerPolicy.kind  = triton::engines::symbolic::POINTER_CONCRETE;
+        this->defaultPointerPolicy.range = SymbolicEngine::defaultPointerRange;
       }
 
 
@@ -108,27 +131,60 @@ namespace triton {
         for (triton::uint32 i = 0; i < this->numberOfRegisters; i++)
           this->symbolicReg[i] = other.symbolicReg[i];
 
-        /*
-         * The backup flag cannot be spread. once a class is tagged as
-         * backup, it always be a backup class.
-         */
+        /* Expressions and variables are shared, the tables only copy their pointers */
         this->alignedMemoryReference      = other.alignedMemoryReference;
         this->architecture                = other.architecture;
-        this->backupFlag                  = true;
         this->callbacks                   = other.callbacks;
+        this->collectThreshold            = other.collectThreshold;
+        this->dependencyPending.clear();
+        this->concreteOnly                = false;
+        this->defaultPointerPolicy        = other.defaultPointerPolicy;
         this->enableFlag                  = other.enableFlag;
+        this->fullAstsRevision            = SymbolicExpression::getRevision();
+        this->inlineReferenceSize         = other.inlineReferenceSize;
+        this->instructionWindow           = other.instructionWindow;
+        this->journalFlag                 = false;
+        this->journalMarks.clear();
+        this->journalRegisters.clear();
+        this->journalMemory.clear();
+        this->journalAlignedMemory.clear();
+        this->lazyFlags                   = other.lazyFlags;
+        this->maxExpressionDepth          = other.maxExpressionDepth;
+        this->maxExpressionSize           = other.maxExpressionSize;
+        this->memoryArrayGeneration       = other.memoryArrayGeneration;
+        this->memoryArrayId               = other.memoryArrayId;
         this->memoryReference             = other.memoryReference;
         this->modes                       = other.modes;
+        this->nodeBudget                  = other.nodeBudget;
+        this->nodeBudgetThreshold         = other.nodeBudgetThreshold;
+        this->pinnedExpressions           = other.pinnedExpressions;
+        this->pointerBounds               = other.pointerBounds;
+        this->pointerBoundsSolver         = other.pointerBoundsSolver;
+        this->pointerPolicies             = other.pointerPolicies;
+        this->symbolicRegions             = other.symbolicRegions;
         this->symbolicExpressions         = other.symbolicExpressions;
         this->symbolicVariables           = other.symbolicVariables;
+        this->taintedExpressions          = other.taintedExpressions;
+        this->taintedIndexId              = other.taintedIndexId;
         this->uniqueSymExprId             = other.uniqueSymExprId;
         this->uniqueSymVarId              = other.uniqueSymVarId;
+        this->windowArrayGeneration       = other.windowArrayGeneration;
+        this->windowSlides                = other.windowSlides;
+        this->windowSlots                 = other.windowSlots;
+
+        /* Each copy holds the nodes of its deferred flags */
+        for (auto it = this->lazyFlags.begin(); it != this->lazyFlags.end(); it++) {
+          for (auto node = it->second.nodes.begin(); node != it->second.nodes.end(); node++)
+            (*node)->incReference();
+        }
       }
 
 
       SymbolicEngine::SymbolicEngine(const SymbolicEngine& copy)
         : triton::engines::symbolic::SymbolicSimplification(copy),
           triton::engines::symbolic::PathManager(copy) {
+        /* The dependency graph is only streamed by the engine which builds it */
+        this->dependencySink = nullptr;
         this->copy(copy);
       }
 
@@ -137,19 +193,13 @@ namespace triton {
         triton::engines::symbolic::SymbolicSimplification::operator=(other);
         triton::engines::symbolic::PathManager::operator=(other);
 
-        /* Delete unused expressions */
-        std::map<triton::usize, SymbolicExpression*>::iterator it1;
-        for (it1 = this->symbolicExpressions.begin(); it1 != this->symbolicExpressions.end(); it1++) {
-          if (other.symbolicExpressions.find(it1->first) == other.symbolicExpressions.end())
-            delete this->symbolicExpressions[it1->first];
-        }
+        /* Release the nodes of deferred flags */
+        while (!this->lazyFlags.empty())
+          this->dropLazyFlag(this->lazyFlags.begin());
 
-        /* Delete unused variables */
-        std::map<triton::usize, SymbolicVariable*>::iterator it2;
-        for (it2 = this->symbolicVariables.begin(); it2 != this->symbolicVariables.end(); it2++) {
-          if (other.symbolicVariables.find(it2->first) == other.symbolicVariables.end())
-            delete this->symbolicVariables[it2->first];
-        }
+        this->clearFullAsts();
+        this->clearSimplifications();
+        this->releaseRetiredAlignedMemory(std::numeric_limits<triton::usize>::max());
 
         delete[] this->symbolicReg;
         this->copy(other);
@@ -157,24 +207,18 @@ namespace triton {
 
 
       SymbolicEngine::~SymbolicEngine() {
-        std::map<triton::usize, SymbolicExpression*>::iterator it1 = this->symbolicExpressions.begin();
-        std::map<triton::usize, SymbolicVariable*>::iterator it2 = this->symbolicVariables.begin();
-
         /*
-         * Don't delete symbolic expressions and symbolic variables
-         * if this class is used as backup engine. Otherwise that may
-         * result in a double-free bug if the original symbolic engine
-         * is deleted too (cf: #385).
+         * Symbolic expressions and variables are shared with the copies of
+         * this engine, their tables delete them with their last holder (cf: #385).
          */
-        if (this->backupFlag == false) {
-          /* Delete all symbolic expressions */
-          for (; it1 != this->symbolicExpressions.end(); ++it1)
-            delete it1->second;
 
-          /* Delete all symbolic variables */
-          for (; it2 != this->symbolicVariables.end(); ++it2)
-            delete it2->second;
-        }
+        /* Release the nodes of deferred flags */
+        while (!this->lazyFlags.empty())
+          this->dropLazyFlag(this->lazyFlags.begin());
+
+        this->clearFullAsts();
+        this->clearSimplifications();
+        this->releaseRetiredAlignedMemory(std::numeric_limits<triton::usize>::max());
 
         /* Delete all symbolic register */
         delete[] this->symbolicReg;
@@ -187,19 +231,28 @@ namespace triton {
        * processing.
        */
       void SymbolicEngine::concretizeRegister(const triton::arch::Register& reg) {
-        triton::uint32 parentId = reg.getParent().getId();
+        triton::uint32 parentId = reg.getParentId();
 
         if (!this->architecture->isRegisterValid(parentId))
           return;
 
-        this->symbolicReg[parentId] = triton::engines::symbolic::UNSET;
+        /* The concrete value of a deferred flag is only known once it is built */
+        this->materializeLazyFlag(reg);
+        this->setRegisterReference(parentId, triton::engines::symbolic::UNSET);
       }
 
 
       /* Same as concretizeRegister but with all registers */
       void SymbolicEngine::concretizeAllRegister(void) {
+        this->materializeLazyFlags();
+
+        if (!this->journalFlag) {
+          std::fill(this->symbolicReg, this->symbolicReg + this->numberOfRegisters, triton::engines::symbolic::UNSET);
+          return;
+        }
+
         for (triton::uint32 i = 0; i < this->numberOfRegisters; i++)
-          this->symbolicReg[i] = triton::engines::symbolic::UNSET;
+          this->setRegisterReference(i, triton::engines::symbolic::UNSET);
       }
 
 
@@ -223,114 +276,168 @@ namespace triton {
        * before symbolic processing.
        */
       void SymbolicEngine::concretizeMemory(triton::uint64 addr) {
-        this->memoryReference.erase(addr);
+        this->setMemoryReference(addr, triton::engines::symbolic::UNSET);
         if (this->modes->isModeEnabled(triton::modes::ALIGNED_MEMORY))
           this->removeAlignedMemory(addr, BYTE_SIZE);
       }
 
 
-      /* Same as concretizeMemory but with all address memory */
+      /* Same as concretizeMemory but the aligned memory is removed once for the whole area */
+      void SymbolicEngine::concretizeMemoryArea(triton::uint64 baseAddr, triton::usize size) {
+        for (triton::usize index = 0; index < size; index++)
+          this->setMemoryReference(baseAddr + index, triton::engines::symbolic::UNSET);
+
+        if (this->modes->isModeEnabled(triton::modes::ALIGNED_MEMORY)) {
+          for (triton::usize index = 0; index < size; index += 0x80000000)
+            this->removeAlignedMemory(baseAddr + index, static_cast<triton::uint32>(std::min<triton::usize>(size - index, 0x80000000)));
+        }
+      }
+
+
+      /* The references of the source are read before the destination is written, so the areas may overlap */
+      void SymbolicEngine::copyMemoryReferences(triton::uint64 dst, triton::uint64 src, triton::usize size) {
+        std::vector<std::pair<triton::usize, triton::uint32>> references(size);
+
+        for (triton::usize index = 0; index < size; index++)
+          references[index].first = this->memoryReference.get(src + index, references[index].second);
+
+        this->concretizeMemoryArea(dst, size);
+
+        for (triton::usize index = 0; index < size; index++) {
+          if (references[index].first != triton::engines::symbolic::UNSET)
+            this->setMemoryReference(dst + index, references[index].first, references[index].second);
+        }
+      }
+
+
+      /*
+       * Same as concretizeMemory but with all address memory. Out of the journal, this is
+       * constant time: the references are retired as a whole generation and released later.
+       */
       void SymbolicEngine::concretizeAllMemory(void) {
+        if (this->journalFlag) {
+          std::map<triton::uint64, triton::usize> entries = this->memoryReference.toMap();
+          for (auto it = entries.begin(); it != entries.end(); it++) {
+            triton::uint32 offset = 0;
+            this->memoryReference.get(it->first, offset);
+            this->journalMemory.push_back(std::make_tuple(it->first, it->second, offset));
+          }
+          this->alignedMemoryReference.forEach([this](triton::uint64 address, triton::uint32 size, triton::ast::AbstractNode* node) {
+            this->journalAlignedMemory.push_back(std::make_pair(std::make_pair(address, size), node));
+          });
+        }
+        if (!this->alignedMemoryReference.empty()) {
+          this->retiredAlignedMemory.push_back(triton::engines::symbolic::AlignedMemoryMap());
+          this->retiredAlignedMemory.back().swap(this->alignedMemoryReference);
+        }
         this->memoryReference.clear();
-        this->alignedMemoryReference.clear();
+        this->resetMemoryArray();
       }
 
 
       /* Gets an aligned entry. */
       triton::ast::AbstractNode* SymbolicEngine::getAlignedMemory(triton::uint64 address, triton::uint32 size) {
-        if (this->isAlignedMemory(address, size))
-          return this->alignedMemoryReference[std::make_pair(address, size)];
-        return nullptr;
+        return this->alignedMemoryReference.get(address, size);
       }
 
 
       /* Checks if the aligned memory is recored. */
       bool SymbolicEngine::isAlignedMemory(triton::uint64 address, triton::uint32 size) {
-        if (this->alignedMemoryReference.find(std::make_pair(address, size)) != this->alignedMemoryReference.end())
-          return true;
-        return false;
+        return this->alignedMemoryReference.get(address, size) != nullptr;
       }
 
 
       /* Adds an aligned memory */
       void SymbolicEngine::addAlignedMemory(triton::uint64 address, triton::uint32 size, triton::ast::AbstractNode* node) {
         this->removeAlignedMemory(address, size);
-        this->alignedMemoryReference[std::make_pair(address, size)] = node;
+        this->setAlignedMemoryReference(address, size, node);
       }
 
 
-      /* Removes an aligned memory */
+      /* Removes the aligned entries overlapping an area */
       void SymbolicEngine::removeAlignedMemory(triton::uint64 address, triton::uint32 size) {
-        /* Remove overloaded positive ranges */
-        for (triton::uint32 index = 0; index < size; index++) {
-          this->alignedMemoryReference.erase(std::make_pair(address+index, BYTE_SIZE));
-          this->alignedMemoryReference.erase(std::make_pair(address+index, WORD_SIZE));
-          this->alignedMemoryReference.erase(std::make_pair(address+index, DWORD_SIZE));
-          this->alignedMemoryReference.erase(std::make_pair(address+index, QWORD_SIZE));
-          this->alignedMemoryReference.erase(std::make_pair(address+index, DQWORD_SIZE));
-          this->alignedMemoryReference.erase(std::make_pair(address+index, QQWORD_SIZE));
-          this->alignedMemoryReference.erase(std::make_pair(address+index, DQQWORD_SIZE));
-        }
-
-        /* Remove overloaded negative ranges */
-        for (triton::uint32 index = 1; index < DQQWORD_SIZE; index++) {
-          if (index < WORD_SIZE)
-            this->alignedMemoryReference.erase(std::make_pair(address-index, WORD_SIZE));
-          if (index < DWORD_SIZE)
-            this->alignedMemoryReference.erase(std::make_pair(address-index, DWORD_SIZE));
-          if (index < QWORD_SIZE)
-            this->alignedMemoryReference.erase(std::make_pair(address-index, QWORD_SIZE));
-          if (index < DQWORD_SIZE)
-            this->alignedMemoryReference.erase(std::make_pair(address-index, DQWORD_SIZE));
-          if (index < QQWORD_SIZE)
-            this->alignedMemoryReference.erase(std::make_pair(address-index, QQWORD_SIZE));
-          if (index < DQQWORD_SIZE)
-            this->alignedMemoryReference.erase(std::make_pair(address-index, DQQWORD_SIZE));
-        }
+        std::vector<std::pair<triton::uint64, triton::uint32>> entries;
+
+        this->alignedMemoryReference.getOverlaps(address, size, entries);
+        for (auto it = entries.begin(); it != entries.end(); it++)
+          this->setAlignedMemoryReference(it->first, it->second, nullptr);
       }
 
 
       /* Returns the reference memory if it's referenced otherwise returns UNSET */
       triton::usize SymbolicEngine::getSymbolicMemoryId(triton::uint64 addr) const {
-        std::map<triton::uint64, triton::usize>::const_iterator it;
+        return this->memoryReference.get(addr);
+      }
 
-        if ((it = this->memoryReference.find(addr)) != this->memoryReference.end())
-          return it->second;
 
-        return triton::engines::symbolic::UNSET;
+      triton::usize SymbolicEngine::getSymbolicMemoryId(triton::uint64 addr, triton::uint32& offset) const {
+        return this->memoryReference.get(addr, offset);
       }
 
 
       /* Returns the symbolic variable otherwise returns nullptr */
       SymbolicVariable* SymbolicEngine::getSymbolicVariableFromId(triton::usize symVarId) const {
-        if (this->symbolicVariables.find(symVarId) == this->symbolicVariables.end())
-          return nullptr;
-        return this->symbolicVariables.at(symVarId);
+        return this->symbolicVariables.get(symVarId);
       }
 
 
       /* Returns the symbolic variable otherwise returns nullptr */
       SymbolicVariable* SymbolicEngine::getSymbolicVariableFromName(const std::string& symVarName) const {
-        std::map<triton::usize, SymbolicVariable*>::const_iterator it;
+        triton::usize id = 0;
+
+        /* Names are TRITON_SYMVAR_NAME followed by the id, so the name gives the entry */
+        if (symVarName.size() <= TRITON_SYMVAR_NAME_SIZE || symVarName.compare(0, TRITON_SYMVAR_NAME_SIZE, TRITON_SYMVAR_NAME) != 0)
+          return nullptr;
 
-        for (it = this->symbolicVariables.begin(); it != this->symbolicVariables.end(); it++) {
-          if (it->second->getName() == symVarName)
-            return it->second;
+        for (auto it = symVarName.begin() + TRITON_SYMVAR_NAME_SIZE; it != symVarName.end(); it++) {
+          if (*it < '0' || *it > '9')
+            return nullptr;
+          id = id * 10 + (*it - '0');
         }
 
-        return nullptr;
+        SymbolicVariable* symVar = this->symbolicVariables.get(id);
+        if (symVar == nullptr || symVar->getName() != symVarName)
+          return nullptr;
+
+        return symVar;
       }
 
 
       /* Returns all symbolic variables */
-      const std::map<triton::usize, SymbolicVariable*>& SymbolicEngine::getSymbolicVariables(void) const {
-        return this->symbolicVariables;
+      std::map<triton::usize, SymbolicVariable*> SymbolicEngine::getSymbolicVariables(void) const {
+        return this->symbolicVariables.toMap();
+      }
+
+
+      triton::usize SymbolicEngine::getNumberOfSymbolicVariables(void) const {
+        return this->symbolicVariables.size();
+      }
+
+
+      triton::usize SymbolicEngine::getMemoryUsage(void) const {
+        triton::usize ret = 0;
+
+        ret += this->symbolicExpressions.getMemoryUsage();
+        ret += this->symbolicVariables.getMemoryUsage();
+        ret += this->memoryReference.getMemoryUsage();
+        ret += this->numberOfRegisters * sizeof(triton::usize);
+        ret += this->alignedMemoryReference.getMemoryUsage();
+        for (auto it = this->retiredAlignedMemory.begin(); it != this->retiredAlignedMemory.end(); it++)
+          ret += it->getMemoryUsage();
+        ret += this->lazyFlags.size() * triton::utils::getTreeNodeSize(sizeof(std::pair<const triton::uint32, LazyFlag>));
+        ret += this->pinnedExpressions.size() * triton::utils::getTreeNodeSize(sizeof(triton::usize));
+        ret += this->fullAsts.size() * triton::utils::getTreeNodeSize(sizeof(std::pair<const triton::usize, triton::ast::AbstractNode*>));
+        ret += this->journalRegisters.capacity() * sizeof(std::pair<triton::uint32, triton::usize>);
+        ret += this->journalMemory.capacity() * sizeof(std::tuple<triton::uint64, triton::usize, triton::uint32>);
+        ret += this->journalAlignedMemory.capacity() * sizeof(std::pair<std::pair<triton::uint64, triton::uint32>, triton::ast::AbstractNode*>);
+
+        return ret;
       }
 
 
       /* Returns the reg reference or UNSET */
       triton::usize SymbolicEngine::getSymbolicRegisterId(const triton::arch::Register& reg) const {
-        triton::uint32 parentId = reg.getParent().getId();
+        triton::uint32 parentId = reg.getParentId();
 
         if (!this->architecture->isRegisterValid(parentId))
           return triton::engines::symbolic::UNSET;
@@ -365,9 +472,17 @@ namespace triton {
 
 
       /* Returns the symbolic register value */
+      /* Reads the evaluation of the register expression, no node is built */
       triton::uint512 SymbolicEngine::getSymbolicRegisterValue(const triton::arch::Register& reg) {
-        triton::ast::AbstractNode* node = this->buildSymbolicRegister(reg);
-        return node->evaluate();
+        /* A deferred flag is built when it is read */
+        this->materializeLazyFlag(reg);
+
+        triton::usize symReg = this->getSymbolicRegisterId(reg);
+        if (this->concreteOnly || symReg == triton::engines::symbolic::UNSET)
+          return this->architecture->getConcreteRegisterValue(reg);
+
+        triton::ast::AbstractNode* node = this->getSymbolicExpressionFromId(symReg)->getAst();
+        return (node->evaluate() >> reg.getLow()) & reg.getMaxValue();
       }
 
 
@@ -387,169 +502,1231 @@ namespace triton {
       }
 
 
+      triton::usize SymbolicEngine::getNextSymbolicExpressionId(void) const {
+        return this->uniqueSymExprId;
+      }
+
+
       /* Creates a new symbolic expression with comment */
       SymbolicExpression* SymbolicEngine::newSymbolicExpression(triton::ast::AbstractNode* node, triton::engines::symbolic::symkind_e kind, const std::string& comment) {
         triton::usize id = this->getUniqueSymExprId();
-        node = this->processSimplification(node);
+        node = this->processSimplification(node, false, this->modes->isModeEnabled(triton::modes::MBA_SIMPLIFICATION));
         SymbolicExpression* expr = new(std::nothrow) SymbolicExpression(node, id, kind, comment);
         if (expr == nullptr)
           throw triton::exceptions::SymbolicEngine("SymbolicEngine::newSymbolicExpression(): not enough memory");
-        this->symbolicExpressions[id] = expr;
+        this->symbolicExpressions.set(id, expr);
+        if (this->dependencySink != nullptr)
+          this->dependencyPending.push_back(id);
         return expr;
       }
 
 
       /* Removes the symbolic expression corresponding to the id */
       void SymbolicEngine::removeSymbolicExpression(triton::usize symExprId) {
-        std::map<triton::uint64, triton::usize>::iterator it;
+        if (this->symbolicExpressions.contains(symExprId)) {
+          /* Build the deferred flags which are computed from this expression */
+          for (auto it = this->lazyFlags.begin(); it != this->lazyFlags.end();) {
+            auto lazy = it++;
+            if (lazy->second.parent == symExprId)
+              this->materializeLazyFlag(lazy);
+          }
 
-        if (this->symbolicExpressions.find(symExprId) != this->symbolicExpressions.end()) {
           /* Delete and remove the pointer */
-          delete this->symbolicExpressions[symExprId];
           this->symbolicExpressions.erase(symExprId);
+          this->pinnedExpressions.erase(symExprId);
+          this->expressionAddresses.erase(symExprId);
+          this->dropFullAst(symExprId);
 
           /* Concretize the register if it exists */
           for (triton::uint32 i = 0; i < this->numberOfRegisters; i++) {
             if (this->symbolicReg[i] == symExprId) {
-              this->symbolicReg[i] = triton::engines::symbolic::UNSET;
+              this->setRegisterReference(i, triton::engines::symbolic::UNSET);
               return;
             }
           }
 
-          /* Concretize the memory if it exists */
-          for (it = this->memoryReference.begin(); it != memoryReference.end(); it++) {
-            if (it->second == symExprId) {
-              this->concretizeMemory(it->first);
-              return;
+          /* Concretize the memory cells if they exist, an expression holds at most DQQWORD_SIZE contiguous cells */
+          triton::uint64 addr = 0;
+          while (this->memoryReference.find(symExprId, addr)) {
+            for (triton::uint32 offset = 0; offset < DQQWORD_SIZE; offset++) {
+              if (this->memoryReference.get(addr + offset) == symExprId)
+                this->concretizeMemory(addr + offset);
+            }
+          }
+        }
+
+      }
+
+
+      void SymbolicEngine::pinSymbolicExpression(triton::usize symExprId) {
+        if (!this->symbolicExpressions.contains(symExprId))
+          throw triton::exceptions::SymbolicEngine("SymbolicEngine::pinSymbolicExpression(): symbolic expression id not found");
+        this->pinnedExpressions.insert(symExprId);
+      }
+
+
+      void SymbolicEngine::unpinSymbolicExpression(triton::usize symExprId) {
+        this->pinnedExpressions.erase(symExprId);
+      }
+
+
+      bool SymbolicEngine::isCollectionNeeded(void) const {
+        if (!this->enableFlag || !this->modes->isModeEnabled(triton::modes::ONLY_LIVE_EXPRESSIONS))
+          return false;
+        return (this->symbolicExpressions.size() >= this->collectThreshold);
+      }
+
+
+      void SymbolicEngine::setNodeBudget(triton::usize budget) {
+        this->nodeBudget          = budget;
+        this->nodeBudgetThreshold = budget;
+      }
+
+
+      triton::usize SymbolicEngine::getNodeBudget(void) const {
+        return this->nodeBudget;
+      }
+
+
+      bool SymbolicEngine::isNodeBudgetExceeded(triton::usize nodes) const {
+        if (!this->enableFlag || this->nodeBudget == 0)
+          return false;
+        return (nodes > this->nodeBudgetThreshold);
+      }
+
+
+      void SymbolicEngine::updateNodeBudgetThreshold(triton::usize nodes) {
+        /* Relieve again once the nodes still held have doubled */
+        this->nodeBudgetThreshold = std::max(this->nodeBudget, 2 * nodes);
+      }
+
+
+      /* The id of an expression tells when it has been assigned, the smallest ones are the oldest */
+      triton::usize SymbolicEngine::concretizeOldestReferences(void) {
+        std::vector<triton::usize> ids;
+        triton::usize count = 0;
+
+        for (triton::uint32 i = 0; i < this->numberOfRegisters; i++) {
+          if (this->symbolicReg[i] != triton::engines::symbolic::UNSET)
+            ids.push_back(this->symbolicReg[i]);
+        }
+        this->memoryReference.getIds(ids);
+
+        if (ids.empty())
+          return 0;
+
+        /* The median id splits the references into the oldest and the newest half */
+        auto median = ids.begin() + (ids.size() - 1) / 2;
+        std::nth_element(ids.begin(), median, ids.end());
+        triton::usize limit = *median;
+
+        for (triton::uint32 i = 0; i < this->numberOfRegisters; i++) {
+          if (this->symbolicReg[i] != triton::engines::symbolic::UNSET && this->symbolicReg[i] <= limit) {
+            this->concretizeRegister(triton::arch::Register(i));
+            count++;
+          }
+        }
+
+        std::map<triton::uint64, triton::usize> entries = this->memoryReference.toMap();
+        for (auto it = entries.begin(); it != entries.end(); it++) {
+          if (it->second <= limit) {
+            this->concretizeMemory(it->first);
+            count++;
+          }
+        }
+
+        /* The stores of the memory array are only reachable from the last one */
+        if (this->memoryArrayId != triton::engines::symbolic::UNSET) {
+          this->resetMemoryArray();
+          count++;
+        }
+
+        return count;
+      }
+
+
+      void SymbolicEngine::setInstructionWindow(triton::usize size) {
+        this->instructionWindow     = size;
+        this->windowArrayGeneration = triton::engines::symbolic::UNSET;
+        this->windowSlides          = 0;
+        this->windowSlots.clear();
+
+        if (size)
+          this->windowSlots.push_back(WindowSlot{this->getNumberOfPathConstraints(), {}, {}});
+      }
+
+
+      triton::usize SymbolicEngine::getInstructionWindow(void) const {
+        return this->instructionWindow;
+      }
+
+
+      void SymbolicEngine::setDependencySink(DependencySink* sink) {
+        if (this->dependencySink != nullptr) {
+          this->writeDependencies(0);
+          this->dependencySink->flush();
+        }
+
+        this->dependencySink = sink;
+        this->dependencyPending.clear();
+      }
+
+
+      DependencySink* SymbolicEngine::getDependencySink(void) const {
+        return this->dependencySink;
+      }
+
+
+      void SymbolicEngine::setPointerPolicy(triton::uint64 address, triton::engines::symbolic::pointer_policy_e policy, triton::uint32 range) {
+        PointerPolicy& entry = this->pointerPolicies[address];
+        entry.kind  = policy;
+        entry.range = range;
+      }
+
+
+      void SymbolicEngine::setDefaultPointerPolicy(triton::engines::symbolic::pointer_policy_e policy, triton::uint32 range) {
+        this->defaultPointerPolicy.kind  = policy;
+        this->defaultPointerPolicy.range = range;
+      }
+
+
+      const PointerPolicy& SymbolicEngine::getPointerPolicy(triton::uint64 address) const {
+        auto it = this->pointerPolicies.find(address);
+        if (it != this->pointerPolicies.end())
+          return it->second;
+        return this->defaultPointerPolicy;
+      }
+
+
+      void SymbolicEngine::clearPointerPolicies(void) {
+        this->pointerPolicies.clear();
+        this->pointerBounds.clear();
+      }
+
+
+      void SymbolicEngine::setPointerBoundsSolver(const std::function<bool(triton::ast::AbstractNode*, triton::uint64&, triton::uint64&)>& solver) {
+        this->pointerBoundsSolver = solver;
+        this->pointerBounds.clear();
+      }
+
+
+      /* Returns the window of addresses an access may target, within the bounds of its address expression */
+      bool SymbolicEngine::getPointerWindow(const triton::arch::Instruction& inst, const triton::arch::MemoryAccess& mem, triton::uint64& low, triton::uint64& high) {
+        triton::ast::AbstractNode* lea = mem.getLeaAst();
+
+        if (lea == nullptr || !lea->isSymbolized() || this->modes->isModeEnabled(triton::modes::MEMORY_ARRAY))
+          return false;
+
+        const PointerPolicy& policy = this->getPointerPolicy(inst.getAddress());
+        if (policy.kind == triton::engines::symbolic::POINTER_CONCRETE || policy.range == 0 || lea->getBitvectorSize() > QWORD_SIZE_BIT)
+          return false;
+
+        /* The concrete address must be the one of the address expression */
+        triton::uint64 address = mem.getAddress();
+        if (static_cast<triton::uint64>(lea->evaluate()) != address)
+          return false;
+
+        /* The abstract interval is free, the solver refines it once per address expression */
+        triton::uint64 min = lea->getMinimum();
+        triton::uint64 max = lea->getMaximum();
+
+        if (policy.kind == triton::engines::symbolic::POINTER_SOLVER && this->pointerBoundsSolver) {
+          triton::uint512 hash = lea->hash(1);
+          auto it = this->pointerBounds.find(hash);
+          if (it == this->pointerBounds.end()) {
+            triton::uint64 smin = 0;
+            triton::uint64 smax = 0;
+            if (this->pointerBoundsSolver(lea, smin, smax))
+              it = this->pointerBounds.insert(std::make_pair(hash, std::make_pair(smin, smax))).first;
+          }
+          if (it != this->pointerBounds.end()) {
+            min = std::max(min, it->second.first);
+            max = std::min(max, it->second.second);
+          }
+        }
+
+        /* The window does not wrap around the address space */
+        low  = (address - min > policy.range) ? address - policy.range : min;
+        high = (max - address > policy.range) ? address + policy.range : max;
+
+        return (low != high);
+      }
+
+
+      /* The ids given again by a rolled back journal are not built anymore and are skipped */
+      void SymbolicEngine::writeDependencies(triton::uint64 address) {
+        for (auto it = this->dependencyPending.begin(); it != this->dependencyPending.end(); it++) {
+          SymbolicExpression* expr = this->symbolicExpressions.get(*it);
+          if (expr != nullptr)
+            this->dependencySink->write(*expr, address);
+        }
+        this->dependencyPending.clear();
+      }
+
+
+      /* A reference assigned again since the slot points to a newer expression and is kept */
+      triton::usize SymbolicEngine::expireWindowSlot(const WindowSlot& slot) {
+        triton::usize count = 0;
+
+        for (auto it = slot.registers.begin(); it != slot.registers.end(); it++) {
+          if (this->symbolicReg[it->first] == it->second) {
+            this->concretizeRegister(triton::arch::Register(it->first));
+            count++;
+          }
+        }
+
+        for (auto it = slot.memory.begin(); it != slot.memory.end(); it++) {
+          triton::uint32 offset = 0;
+          if (this->memoryReference.get(it->first, offset) == it->second) {
+            this->concretizeMemory(it->first);
+            count++;
+          }
+        }
+
+        return count;
+      }
+
+
+      bool SymbolicEngine::slideInstructionWindow(void) {
+        if (!this->enableFlag || this->instructionWindow == 0)
+          return false;
+
+        /* The open slot and the slots of the last instructions are kept */
+        this->windowSlots.push_back(WindowSlot{this->getNumberOfPathConstraints(), {}, {}});
+        while (this->windowSlots.size() > this->instructionWindow + 1) {
+          WindowSlot slot = std::move(this->windowSlots.front());
+          this->windowSlots.pop_front();
+          this->expireWindowSlot(slot);
+        }
+
+        if (++this->windowSlides < this->instructionWindow)
+          return false;
+        this->windowSlides = 0;
+
+        /* The path constraints recorded before the oldest slot have left the window */
+        triton::usize dropped = std::min(this->windowSlots.front().pathConstraints, this->getNumberOfPathConstraints());
+        if (dropped) {
+          this->dropOldestPathConstraints(dropped);
+          for (auto it = this->windowSlots.begin(); it != this->windowSlots.end(); it++)
+            it->pathConstraints -= std::min(it->pathConstraints, dropped);
+        }
+
+        /* The stores of the memory array are only reachable from the last one, it is started again once it spans a whole window */
+        if (this->memoryArrayId != triton::engines::symbolic::UNSET && this->memoryArrayGeneration == this->windowArrayGeneration)
+          this->resetMemoryArray();
+        this->windowArrayGeneration = (this->memoryArrayId != triton::engines::symbolic::UNSET) ? this->memoryArrayGeneration : triton::engines::symbolic::UNSET;
+
+        return true;
+      }
+
+
+      void SymbolicEngine::setExpressionLimits(triton::uint32 depth, triton::uint64 size) {
+        this->maxExpressionDepth = depth;
+        this->maxExpressionSize  = size;
+      }
+
+
+      triton::uint32 SymbolicEngine::getMaxExpressionDepth(void) const {
+        return this->maxExpressionDepth;
+      }
+
+
+      triton::uint64 SymbolicEngine::getMaxExpressionSize(void) const {
+        return this->maxExpressionSize;
+      }
+
+
+      void SymbolicEngine::setInlineReferenceSize(triton::usize size) {
+        this->inlineReferenceSize = size;
+      }
+
+
+      triton::usize SymbolicEngine::getInlineReferenceSize(void) const {
+        return this->inlineReferenceSize;
+      }
+
+
+      triton::ast::AbstractNode* SymbolicEngine::inlineReference(triton::ast::AbstractNode* node) const {
+        std::vector<triton::ast::AbstractNode*> worklist;
+        triton::usize size = 0;
+
+        if (node->getKind() != triton::ast::REFERENCE_NODE)
+          return node;
+
+        SymbolicExpression* expr = reinterpret_cast<triton::ast::ReferenceNode*>(node)->getSymbolicExpression();
+        if (expr == nullptr)
+          return node;
+
+        /* The memory array is only reached by reference */
+        triton::ast::AbstractNode* ast = expr->getAst();
+        if (ast->getKind() == triton::ast::ARRAY_NODE || ast->getKind() == triton::ast::STORE_NODE)
+          return node;
+
+        /* Count the nodes up to the references, shared nodes are counted as many times as they are reached */
+        worklist.push_back(ast);
+        while (!worklist.empty()) {
+          triton::ast::AbstractNode* current = worklist.back();
+          worklist.pop_back();
+
+          if (++size > this->inlineReferenceSize)
+            return node;
+
+          worklist.insert(worklist.end(), current->getChilds().begin(), current->getChilds().end());
+        }
+
+        return ast;
+      }
+
+
+      void SymbolicEngine::addSymbolicRegion(triton::uint64 start, triton::uint64 end) {
+        if (start >= end)
+          throw triton::exceptions::SymbolicEngine("SymbolicEngine::addSymbolicRegion(): The region cannot be empty.");
+
+        /* The regions which overlap or touch the new one are merged into it */
+        auto it = this->symbolicRegions.upper_bound(start);
+        if (it != this->symbolicRegions.begin() && std::prev(it)->second >= start)
+          it--;
+
+        while (it != this->symbolicRegions.end() && it->first <= end) {
+          start = std::min(start, it->first);
+          end   = std::max(end, it->second);
+          it    = this->symbolicRegions.erase(it);
+        }
+
+        this->symbolicRegions[start] = end;
+      }
+
+
+      void SymbolicEngine::removeSymbolicRegion(triton::uint64 start, triton::uint64 end) {
+        auto it = this->symbolicRegions.upper_bound(start);
+        if (it != this->symbolicRegions.begin())
+          it--;
+
+        /* The parts of the regions outside [start:end) are kept */
+        while (it != this->symbolicRegions.end() && it->first < end) {
+          triton::uint64 first = it->first;
+          triton::uint64 last  = it->second;
+
+          if (last <= start) {
+            it++;
+            continue;
+          }
+
+          it = this->symbolicRegions.erase(it);
+          if (first < start)
+            this->symbolicRegions[first] = start;
+          if (last > end)
+            this->symbolicRegions[end] = last;
+        }
+      }
+
+
+      void SymbolicEngine::clearSymbolicRegions(void) {
+        this->symbolicRegions.clear();
+      }
+
+
+      const std::map<triton::uint64, triton::uint64>& SymbolicEngine::getSymbolicRegions(void) const {
+        return this->symbolicRegions;
+      }
+
+
+      bool SymbolicEngine::isSymbolicRegion(triton::uint64 addr) const {
+        if (this->symbolicRegions.empty())
+          return true;
+
+        auto it = this->symbolicRegions.upper_bound(addr);
+        if (it == this->symbolicRegions.begin())
+          return false;
+
+        return addr < std::prev(it)->second;
+      }
+
+
+      void SymbolicEngine::setConcreteOnly(bool flag) {
+        this->concreteOnly = flag;
+      }
+
+
+      bool SymbolicEngine::isConcreteOnly(void) const {
+        return this->concreteOnly;
+      }
+
+
+      /* The expressions are new, so their destination is their only reference */
+      void SymbolicEngine::removeConcreteExpressions(const std::vector<SymbolicExpression*>& exprs) {
+        for (auto it = exprs.begin(); it != exprs.end(); it++) {
+          SymbolicExpression* expr = *it;
+          triton::usize id         = expr->getId();
+
+          /* The stores into the memory array and the volatile expressions are kept */
+          if (expr->isRegister()) {
+            triton::uint32 regId = expr->getOriginRegister().getParentId();
+            if (this->symbolicReg[regId] == id)
+              this->setRegisterReference(regId, triton::engines::symbolic::UNSET);
+          }
+
+          else if (expr->isMemory()) {
+            triton::arch::MemoryAccess mem = expr->getOriginMemory();
+            for (triton::uint32 offset = 0; offset < mem.getSize(); offset++) {
+              if (this->memoryReference.get(mem.getAddress() + offset) == id)
+                this->concretizeMemory(mem.getAddress() + offset);
             }
           }
+
+          else
+            continue;
+
+          this->symbolicExpressions.erase(id);
+          this->pinnedExpressions.erase(id);
+          this->dropFullAst(id);
+        }
+      }
+
+
+      bool SymbolicEngine::isExpressionLimitSet(void) const {
+        return (this->maxExpressionDepth != 0 || this->maxExpressionSize != 0);
+      }
+
+
+      bool SymbolicEngine::isExpressionLimitExceeded(const SymbolicExpression* expr) const {
+        if (this->maxExpressionDepth != 0 && expr->getDepth() > this->maxExpressionDepth)
+          return true;
+        if (this->maxExpressionSize != 0 && expr->getUnrolledSize() > this->maxExpressionSize)
+          return true;
+        return false;
+      }
+
+
+      void SymbolicEngine::profileExpressions(const triton::arch::Instruction& inst, triton::usize nodes) {
+        ExpressionProfile& profile = this->expressionProfile[inst.getAddress()];
+
+        profile.instructions++;
+        profile.nodes       += nodes;
+        profile.expressions += inst.symbolicExpressions.size();
+
+        for (auto it = inst.symbolicExpressions.begin(); it != inst.symbolicExpressions.end(); it++) {
+          const SymbolicExpression* expr = *it;
+          profile.maxSize  = std::max(profile.maxSize, expr->getUnrolledSize());
+          profile.maxDepth = std::max(profile.maxDepth, expr->getDepth());
+          this->expressionAddresses[expr->getId()] = inst.getAddress();
+        }
+      }
+
+
+      void SymbolicEngine::profileQuery(triton::ast::AbstractNode* node, triton::uint64 time) {
+        std::vector<triton::ast::AbstractNode*> worklist;
+        std::set<triton::ast::AbstractNode*> visited;
+        std::set<triton::uint64> addresses;
+
+        if (node == nullptr || this->expressionAddresses.empty() || !this->modes->isModeEnabled(triton::modes::EXPRESSION_PROFILING))
+          return;
+
+        worklist.push_back(node);
+        while (!worklist.empty()) {
+          triton::ast::AbstractNode* current = worklist.back();
+          worklist.pop_back();
+
+          if (!visited.insert(current).second)
+            continue;
+
+          /* The references are not followed */
+          if (current->getKind() == triton::ast::REFERENCE_NODE) {
+            auto it = this->expressionAddresses.find(reinterpret_cast<triton::ast::ReferenceNode*>(current)->getValue());
+            if (it != this->expressionAddresses.end())
+              addresses.insert(it->second);
+            continue;
+          }
+
+          const std::vector<triton::ast::AbstractNode*>& childs = current->getChilds();
+          worklist.insert(worklist.end(), childs.begin(), childs.end());
+        }
+
+        for (auto it = addresses.begin(); it != addresses.end(); it++) {
+          ExpressionProfile& profile = this->expressionProfile[*it];
+          profile.queries++;
+          profile.solverTime += time;
+        }
+      }
+
+
+      const std::map<triton::uint64, ExpressionProfile>& SymbolicEngine::getExpressionProfile(void) const {
+        return this->expressionProfile;
+      }
+
+
+      void SymbolicEngine::clearExpressionProfile(void) {
+        this->expressionProfile.clear();
+        this->expressionAddresses.clear();
+      }
+
+
+      void SymbolicEngine::dumpExpressionProfile(std::ostream& stream, triton::usize count, bool json) const {
+        std::vector<std::pair<triton::uint64, const ExpressionProfile*>> sorted;
+
+        for (auto it = this->expressionProfile.begin(); it != this->expressionProfile.end(); it++)
+          sorted.push_back(std::make_pair(it->first, &it->second));
+
+        /* The heaviest addresses first, the solver time breaks the ties */
+        std::stable_sort(sorted.begin(), sorted.end(), [](const std::pair<triton::uint64, const ExpressionProfile*>& a, const std::pair<triton::uint64, const ExpressionProfile*>& b) {
+          if (a.second->nodes != b.second->nodes)
+            return a.second->nodes > b.second->nodes;
+          return a.second->solverTime > b.second->solverTime;
+        });
+
+        if (count != 0 && sorted.size() > count)
+          sorted.resize(count);
+
+        if (json)
+          stream << "[";
+        else
+          stream << "address,instructions,nodes,expressions,maxSize,maxDepth,queries,solverTime" << std::endl;
+
+        for (auto it = sorted.begin(); it != sorted.end(); it++) {
+          const ExpressionProfile& profile = *it->second;
+          if (json) {
+            stream << (it == sorted.begin() ? "" : ",") << std::endl;
+            stream << "  {\"address\": "        << it->first
+                   << ", \"instructions\": "    << profile.instructions
+                   << ", \"nodes\": "           << profile.nodes
+                   << ", \"expressions\": "     << profile.expressions
+                   << ", \"maxSize\": "         << profile.maxSize
+                   << ", \"maxDepth\": "        << profile.maxDepth
+                   << ", \"queries\": "         << profile.queries
+                   << ", \"solverTime\": "      << profile.solverTime << "}";
+          }
+          else {
+            stream << "0x" << std::hex << it->first << std::dec << "," << profile.instructions << "," << profile.nodes << ","
+                   << profile.expressions << "," << profile.maxSize << "," << profile.maxDepth << "," << profile.queries << ","
+                   << profile.solverTime << std::endl;
+          }
         }
 
+        if (json)
+          stream << std::endl << "]" << std::endl;
+      }
+
+
+      triton::usize SymbolicEngine::checkExpressionLimits(const std::vector<SymbolicExpression*>& exprs) {
+        triton::usize count = 0;
+
+        for (auto it = exprs.begin(); it != exprs.end(); it++) {
+          SymbolicExpression* expr = *it;
+
+          if (!this->isExpressionLimitExceeded(expr))
+            continue;
+          count++;
+
+          if (this->callbacks && this->callbacks->isCallbackDefined(triton::callbacks::EXPRESSION_LIMIT))
+            this->callbacks->processCallbacks(triton::callbacks::EXPRESSION_LIMIT, expr);
+
+          if (!this->modes->isModeEnabled(triton::modes::CONCRETIZE_LARGE_EXPRESSIONS))
+            continue;
+
+          /* Only drop the reference if a later expression of the instruction has not replaced it */
+          if (expr->isRegister()) {
+            if (this->getSymbolicRegisterId(expr->getOriginRegister()) == expr->getId())
+              this->concretizeRegister(expr->getOriginRegister());
+          }
+          else if (expr->isMemory()) {
+            const triton::arch::MemoryAccess& mem = expr->getOriginMemory();
+            for (triton::uint32 offset = 0; offset < mem.getSize(); offset++) {
+              if (this->getSymbolicMemoryId(mem.getAddress() + offset) == expr->getId())
+                this->concretizeMemory(mem.getAddress() + offset);
+            }
+          }
+        }
+
+        return count;
+      }
+
+
+      /* Mark and sweep of symbolic expressions, reference nodes are the edges */
+      void SymbolicEngine::collectUnreachableExpressions(const std::vector<SymbolicExpression*>& roots, std::vector<triton::ast::AbstractNode*>& asts) {
+        /* A journal may restore references to the unreachable expressions */
+        if (this->journalFlag)
+          return;
+
+        std::vector<bool> marked(this->uniqueSymExprId, false);
+        std::vector<triton::usize> ids;
+        std::vector<triton::ast::AbstractNode*> worklist;
+        std::unordered_set<triton::ast::AbstractNode*> visited;
+
+        /* Registers, memory, pinned expressions and the memory array */
+        for (triton::uint32 i = 0; i < this->numberOfRegisters; i++)
+          ids.push_back(this->symbolicReg[i]);
+        this->memoryReference.getIds(ids);
+        ids.insert(ids.end(), this->pinnedExpressions.begin(), this->pinnedExpressions.end());
+        ids.push_back(this->memoryArrayId);
+        for (auto it = roots.begin(); it != roots.end(); it++)
+          ids.push_back((*it)->getId());
+
+        /* Deferred flags */
+        for (auto it = this->lazyFlags.begin(); it != this->lazyFlags.end(); it++) {
+          ids.push_back(it->second.parent);
+          worklist.insert(worklist.end(), it->second.nodes.begin(), it->second.nodes.end());
+        }
+
+        /* Aligned memory and path constraints */
+        this->alignedMemoryReference.forEach([&worklist](triton::uint64, triton::uint32, triton::ast::AbstractNode* node) {
+          worklist.push_back(node);
+        });
+
+        for (auto it = this->pathConstraints.begin(); it != this->pathConstraints.end(); it++) {
+          /* Lazy constraints are built from the AST of the program counter, they are not built here */
+          if (it->getPcAst() != nullptr) {
+            worklist.push_back(it->getPcAst());
+            continue;
+          }
+          const auto& branches = it->getBranchConstraints();
+          for (auto branch = branches.begin(); branch != branches.end(); branch++)
+            worklist.push_back(std::get<3>(*branch));
+        }
+
+        /* Mark */
+        while (!ids.empty() || !worklist.empty()) {
+          while (!ids.empty()) {
+            triton::usize id = ids.back();
+            ids.pop_back();
+            if (id >= marked.size() || marked[id])
+              continue;
+            SymbolicExpression* expr = this->symbolicExpressions.get(id);
+            if (expr == nullptr)
+              continue;
+            marked[id] = true;
+            worklist.push_back(expr->getAst());
+          }
+
+          while (!worklist.empty()) {
+            std::vector<triton::ast::AbstractNode*> nodes;
+            triton::ast::nodesExtraction(nodes, worklist.back(), visited);
+            worklist.pop_back();
+            for (auto it = nodes.begin(); it != nodes.end(); it++) {
+              if ((*it)->getKind() == triton::ast::REFERENCE_NODE)
+                ids.push_back(reinterpret_cast<triton::ast::ReferenceNode*>(*it)->getValue());
+            }
+          }
+        }
+
+        /* Sweep */
+        ids = this->symbolicExpressions.getIds();
+        for (auto it = ids.begin(); it != ids.end(); it++) {
+          if (*it < marked.size() && marked[*it])
+            continue;
+          std::shared_ptr<SymbolicExpression> expr = this->symbolicExpressions.erase(*it);
+          triton::ast::AbstractNode* ast = expr->getAst();
+          ast->incReference();
+          asts.push_back(ast);
+          expr.reset();
+
+          /* The hold of the unrolled AST is given to the caller */
+          auto full = this->fullAsts.find(*it);
+          if (full != this->fullAsts.end()) {
+            asts.push_back(full->second);
+            this->fullAsts.erase(full);
+          }
+        }
+
+        /* Collect again once the number of expressions has doubled */
+        this->collectThreshold = 2 * this->symbolicExpressions.size();
+        if (this->collectThreshold < SymbolicEngine::minCollectThreshold)
+          this->collectThreshold = SymbolicEngine::minCollectThreshold;
       }
 
 
       /* Gets the symbolic expression pointer from a symbolic id */
       SymbolicExpression* SymbolicEngine::getSymbolicExpressionFromId(triton::usize symExprId) const {
-        if (this->symbolicExpressions.find(symExprId) == this->symbolicExpressions.end())
+        SymbolicExpression* expr = this->symbolicExpressions.get(symExprId);
+        if (expr == nullptr)
           throw triton::exceptions::SymbolicEngine("SymbolicEngine::getSymbolicExpressionFromId(): symbolic expression id not found");
-        return this->symbolicExpressions.at(symExprId);
+        return expr;
       }
 
 
       /* Returns all symbolic expressions */
-      const std::map<triton::usize, SymbolicExpression*>& SymbolicEngine::getSymbolicExpressions(void) const {
-        return this->symbolicExpressions;
+      std::map<triton::usize, SymbolicExpression*> SymbolicEngine::getSymbolicExpressions(void) const {
+        return this->symbolicExpressions.toMap();
       }
 
 
-      /* Returns the full symbolic expression backtracked. */
-      triton::ast::AbstractNode* SymbolicEngine::getFullAst(triton::ast::AbstractNode* node, std::set<triton::usize>& processed) {
-        std::vector<triton::ast::AbstractNode*>& childs = node->getChilds();
+      /* Returns the number of symbolic expressions */
+      triton::usize SymbolicEngine::getNumberOfSymbolicExpressions(void) const {
+        return this->symbolicExpressions.size();
+      }
 
-        for (triton::uint32 index = 0; index < childs.size(); index++) {
-          if (childs[index]->getKind() == triton::ast::REFERENCE_NODE) {
-            triton::usize id = reinterpret_cast<triton::ast::ReferenceNode*>(childs[index])->getValue();
-            triton::ast::AbstractNode* ref = this->getSymbolicExpressionFromId(id)->getAst();
-            childs[index] = ref;
-            if (processed.find(id) != processed.end())
-              continue;
-            processed.insert(id);
+
+      /*
+       * Returns the full symbolic expression backtracked. The node is not modified:
+       * nodes which reach a reference are duplicated with their unrolled children,
+       * the other ones are shared with the original AST. The unrolled AST of each
+       * referenced expression is cached, so it is built only once and shared by
+       * every full AST which references it.
+       */
+      triton::ast::AbstractNode* SymbolicEngine::getFullAst(triton::ast::AbstractNode* node) {
+        std::map<triton::ast::AbstractNode*, triton::ast::AbstractNode*> unrolled;
+        std::vector<triton::ast::AbstractNode*> rootNodes;
+        std::vector<triton::ast::AbstractNode*> nodes;
+        std::vector<triton::usize> worklist;
+
+        /* An expression has been assigned to another AST, cached ASTs may be outdated */
+        if (this->fullAstsRevision != SymbolicExpression::getRevision()) {
+          this->clearFullAsts();
+          this->fullAstsRevision = SymbolicExpression::getRevision();
+        }
+
+        /* Unroll the referenced expressions first, an expression waits for the ones it references */
+        triton::ast::nodesExtraction(rootNodes, node);
+        this->getUncachedReferences(rootNodes, worklist);
+        while (!worklist.empty()) {
+          triton::usize id = worklist.back();
+
+          if (this->fullAsts.find(id) != this->fullAsts.end()) {
+            worklist.pop_back();
+            continue;
           }
-          this->getFullAst(childs[index], processed);
+
+          nodes.clear();
+          triton::ast::nodesExtraction(nodes, this->getSymbolicExpressionFromId(id)->getAst());
+          if (this->getUncachedReferences(nodes, worklist))
+            continue;
+
+          triton::ast::AbstractNode* full = this->unrollNodes(nodes, unrolled);
+          full->incReference();
+          this->fullAsts[id] = full;
+          worklist.pop_back();
         }
 
-        return node;
+        return this->unrollNodes(rootNodes, unrolled);
       }
 
 
-      /* Returns the full symbolic expression backtracked. */
-      triton::ast::AbstractNode* SymbolicEngine::getFullAst(triton::ast::AbstractNode* node) {
-        std::set<triton::usize> processed;
-        return this->getFullAst(node, processed);
+      /* [private method] Pushes the ids of the references which are not unrolled yet, returns true if there is any */
+      bool SymbolicEngine::getUncachedReferences(const std::vector<triton::ast::AbstractNode*>& nodes, std::vector<triton::usize>& ids) const {
+        bool found = false;
+
+        for (auto it = nodes.begin(); it != nodes.end(); it++) {
+          if ((*it)->getKind() != triton::ast::REFERENCE_NODE)
+            continue;
+          triton::usize id = reinterpret_cast<triton::ast::ReferenceNode*>(*it)->getValue();
+          if (this->fullAsts.find(id) == this->fullAsts.end()) {
+            ids.push_back(id);
+            found = true;
+          }
+        }
+
+        return found;
       }
 
 
-      /* [private method] Slices all expressions from a given node */
-      void SymbolicEngine::sliceExpressions(triton::ast::AbstractNode* node, std::map<triton::usize, SymbolicExpression*>& exprs) {
-        std::vector<triton::ast::AbstractNode*>& childs = node->getChilds();
-
-        for (triton::uint32 index = 0; index < childs.size(); index++) {
-          if (childs[index]->getKind() == triton::ast::REFERENCE_NODE) {
-            triton::usize id = reinterpret_cast<triton::ast::ReferenceNode*>(childs[index])->getValue();
-            if (exprs.find(id) == exprs.end()) {
-              SymbolicExpression* expr = this->getSymbolicExpressionFromId(id);
-              exprs[id] = expr;
-              this->sliceExpressions(expr->getAst(), exprs);
-            }
+      /* [private method] Unrolls nodes given in post-order, the referenced expressions must be unrolled already */
+      triton::ast::AbstractNode* SymbolicEngine::unrollNodes(const std::vector<triton::ast::AbstractNode*>& nodes, std::map<triton::ast::AbstractNode*, triton::ast::AbstractNode*>& unrolled) {
+        for (auto it = nodes.begin(); it != nodes.end(); it++) {
+          triton::ast::AbstractNode* current = *it;
+
+          if (unrolled.find(current) != unrolled.end())
+            continue;
+
+          if (current->getKind() == triton::ast::REFERENCE_NODE) {
+            unrolled[current] = this->fullAsts.at(reinterpret_cast<triton::ast::ReferenceNode*>(current)->getValue());
+            continue;
           }
-          this->sliceExpressions(childs[index], exprs);
+
+          const std::vector<triton::ast::AbstractNode*>& childs = current->getChilds();
+          std::vector<triton::ast::AbstractNode*> newChilds;
+          bool changed = false;
+
+          for (auto child = childs.begin(); child != childs.end(); child++) {
+            triton::ast::AbstractNode* newChild = unrolled[*child];
+            changed = changed || (newChild != *child);
+            newChilds.push_back(newChild);
+          }
+
+          unrolled[current] = (changed ? triton::ast::newInstance(current, newChilds) : current);
+        }
+
+        return unrolled[nodes.back()];
+      }
+
+
+      /* Releases the cached unrolled ASTs */
+      void SymbolicEngine::clearFullAsts(void) {
+        for (auto it = this->fullAsts.begin(); it != this->fullAsts.end(); it++)
+          it->second->decReference();
+        this->fullAsts.clear();
+      }
+
+
+      /* [private method] Releases the unrolled AST of a symbolic expression */
+      void SymbolicEngine::dropFullAst(triton::usize symExprId) {
+        auto it = this->fullAsts.find(symExprId);
+        if (it != this->fullAsts.end()) {
+          it->second->decReference();
+          this->fullAsts.erase(it);
         }
       }
 
 
-      /* Slices all expressions from a given one */
+      /* [private method] Slices all expressions from a given node */
+      /*
+       * Slices all expressions from a given one. The slice is a breadth-first walk of the ids
+       * referenced by the expressions, the ASTs are not walked again.
+       */
       std::map<triton::usize, SymbolicExpression*> SymbolicEngine::sliceExpressions(SymbolicExpression* expr) {
         std::map<triton::usize, SymbolicExpression*> exprs;
+        std::vector<SymbolicExpression*> reached;
 
         if (expr == nullptr)
           throw triton::exceptions::SymbolicEngine("SymbolicEngine::sliceExpressions(): expr cannot be null.");
 
-        exprs[expr->getId()] = expr;
-        this->sliceExpressions(expr->getAst(), exprs);
+        if (this->sliceMarks.size() <= expr->getId())
+          this->sliceMarks.resize(expr->getId() + 1);
+
+        this->sliceMarks[expr->getId()] = true;
+        reached.push_back(expr);
+
+        for (triton::usize index = 0; index < reached.size(); index++) {
+          const std::vector<triton::usize>& references = reached[index]->getReferences();
+          for (auto it = references.begin(); it != references.end(); it++) {
+            if (this->sliceMarks.size() <= *it)
+              this->sliceMarks.resize(*it + 1);
+
+            if (this->sliceMarks[*it])
+              continue;
+
+            SymbolicExpression* reference = this->symbolicExpressions.get(*it);
+            if (reference == nullptr) {
+              for (auto r = reached.begin(); r != reached.end(); r++)
+                this->sliceMarks[(*r)->getId()] = false;
+              throw triton::exceptions::SymbolicEngine("SymbolicEngine::sliceExpressions(): symbolic expression id not found");
+            }
+
+            this->sliceMarks[*it] = true;
+            reached.push_back(reference);
+          }
+        }
+
+        /* Inserted in order, each insertion is done at the end of the map */
+        std::sort(reached.begin(), reached.end(), [](SymbolicExpression* a, SymbolicExpression* b) { return a->getId() < b->getId(); });
+        for (auto it = reached.begin(); it != reached.end(); it++) {
+          this->sliceMarks[(*it)->getId()] = false;
+          exprs.emplace_hint(exprs.end(), (*it)->getId(), *it);
+        }
 
         return exprs;
       }
 
 
-      /* Returns a list which contains all tainted expressions */
-      std::list<SymbolicExpression*> SymbolicEngine::getTaintedSymbolicExpressions(void) const {
-        std::map<triton::usize, SymbolicExpression*>::const_iterator it;
+      /* Returns a list which contains the tainted expressions from an id */
+      std::list<SymbolicExpression*> SymbolicEngine::getTaintedSymbolicExpressions(triton::usize fromId) const {
         std::list<SymbolicExpression*> taintedExprs;
 
-        for (it = this->symbolicExpressions.begin(); it != this->symbolicExpressions.end(); it++) {
-          if (it->second->isTainted == true)
-            taintedExprs.push_back(it->second);
+        /*
+         * The taint of an expression is set by the semantics right after its creation, so the
+         * index is extended on query with the expressions created since the previous one.
+         */
+        for (; this->taintedIndexId < this->uniqueSymExprId; this->taintedIndexId++) {
+          SymbolicExpression* expr = this->symbolicExpressions.get(this->taintedIndexId);
+          if (expr != nullptr && expr->isTainted == true)
+            this->taintedExpressions.push_back(this->taintedIndexId);
         }
+
+        auto it = std::lower_bound(this->taintedExpressions.begin(), this->taintedExpressions.end(), fromId);
+        for (; it != this->taintedExpressions.end(); it++) {
+          SymbolicExpression* expr = this->symbolicExpressions.get(*it);
+          if (expr != nullptr)
+            taintedExprs.push_back(expr);
+        }
+
         return taintedExprs;
       }
 
 
-      /* Returns the list of the symbolic variables declared in the trace */
-      std::string SymbolicEngine::getVariablesDeclaration(void) const {
-        std::map<triton::usize, SymbolicVariable*>::const_iterator it;
-        std::stringstream stream;
+      /* Returns the list of the symbolic variables declared in the trace */
+      std::string SymbolicEngine::getVariablesDeclaration(void) const {
+        std::stringstream stream;
+
+        for (triton::usize id = 0; id < this->symbolicVariables.getUpperBound(); id++) {
+          SymbolicVariable* symVar = this->symbolicVariables.get(id);
+          if (symVar != nullptr)
+            stream << triton::ast::declareFunction(symVar->getName(), triton::ast::bvdecl(symVar->getSize()));
+        }
+
+        return stream.str();
+      }
+
+
+      /* Writes the symbolic state in the binary serialization format */
+      void SymbolicEngine::serializeState(std::ostream& stream) {
+        triton::ast::AstWriter writer(stream);
+
+        /* Deferred flags are part of the state */
+        this->materializeLazyFlags();
+
+        std::vector<triton::usize> variables = this->symbolicVariables.getIds();
+        for (auto it = variables.begin(); it != variables.end(); it++) {
+          SymbolicVariable* symVar = this->symbolicVariables.get(*it);
+          writer.writeTag(triton::ast::SERIAL_VARIABLE);
+          writer.writeString(symVar->getName());
+          writer.writeUnsigned(symVar->getKind());
+          writer.writeUnsigned(symVar->getKindValue());
+          writer.writeUnsigned(symVar->getSize());
+          writer.writeUnsigned(symVar->getConcreteValue());
+          writer.writeString(symVar->getComment());
+        }
+
+        /* Expressions are written by id, so that the expressions referenced by an AST are read before it */
+        std::vector<triton::usize> expressions = this->symbolicExpressions.getIds();
+        for (auto it = expressions.begin(); it != expressions.end(); it++) {
+          SymbolicExpression* expr = this->symbolicExpressions.get(*it);
+          triton::usize root = writer.writeNode(expr->getAst());
+
+          writer.writeTag(triton::ast::SERIAL_EXPRESSION);
+          writer.writeUnsigned(expr->getId());
+          writer.writeUnsigned(root);
+          writer.writeUnsigned(expr->getKind());
+          if (expr->isRegister())
+            writer.writeUnsigned(expr->getOriginRegister().getId());
+          else if (expr->isMemory()) {
+            triton::arch::MemoryAccess mem = expr->getOriginMemory();
+            writer.writeUnsigned(mem.getAddress());
+            writer.writeUnsigned(mem.getSize());
+            writer.writeUnsigned(mem.getConcreteValue());
+          }
+          writer.writeUnsigned(expr->isTainted);
+          writer.writeString(expr->getComment());
+        }
+
+        for (triton::uint32 regId = 0; regId < this->numberOfRegisters; regId++) {
+          if (this->symbolicReg[regId] != triton::engines::symbolic::UNSET) {
+            writer.writeTag(triton::ast::SERIAL_REGISTER);
+            writer.writeUnsigned(regId);
+            writer.writeUnsigned(this->symbolicReg[regId]);
+          }
+        }
+
+        std::map<triton::uint64, triton::usize> memory = this->memoryReference.toMap();
+        for (auto it = memory.begin(); it != memory.end(); it++) {
+          triton::uint32 offset = 0;
+          this->memoryReference.get(it->first, offset);
+          writer.writeTag(triton::ast::SERIAL_MEMORY);
+          writer.writeUnsigned(it->first);
+          writer.writeUnsigned(it->second);
+          writer.writeUnsigned(offset);
+        }
+
+        /* The PC AST is written too (0 if there is none, entry + 1 otherwise), so that the constraint stays deduplicable */
+        for (auto pco = this->pathConstraints.begin(); pco != this->pathConstraints.end(); pco++) {
+          const auto& branches = pco->getBranchConstraints();
+          std::vector<triton::usize> entries;
+          triton::usize pc = 0;
+
+          if (pco->getPcAst() != nullptr)
+            pc = writer.writeNode(pco->getPcAst()) + 1;
+
+          for (auto it = branches.begin(); it != branches.end(); it++)
+            entries.push_back(writer.writeNode(std::get<3>(*it)));
+
+          writer.writeTag(triton::ast::SERIAL_PATH_CONSTRAINT);
+          writer.writeUnsigned(pc);
+          writer.writeUnsigned(pco->getPcSize());
+          writer.writeUnsigned(branches.size());
+          for (triton::usize index = 0; index < branches.size(); index++) {
+            writer.writeUnsigned(std::get<0>(branches[index]));
+            writer.writeUnsigned(std::get<1>(branches[index]));
+            writer.writeUnsigned(std::get<2>(branches[index]));
+            writer.writeUnsigned(entries[index]);
+          }
+        }
+
+        writer.writeEnd();
+      }
+
+
+      /* Reads a symbolic state written by serializeState() */
+      void SymbolicEngine::deserializeState(std::istream& stream) {
+        triton::ast::AstReader reader(stream);
+        std::map<triton::usize, triton::usize> ids;
+        bool flushAlignedMemory = true;
+
+        while (true) {
+          switch (reader.readTag()) {
+            case triton::ast::SERIAL_END:
+              return;
+
+            case triton::ast::SERIAL_NODE:
+              reader.readNode();
+              break;
+
+            case triton::ast::SERIAL_VARIABLE: {
+              std::string name          = reader.readString();
+              triton::uint64 kind       = reader.readUnsigned64();
+              triton::uint64 kindValue  = reader.readUnsigned64();
+              triton::uint64 size       = reader.readUnsigned64();
+              triton::uint512 value     = reader.readUnsigned();
+              std::string comment       = reader.readString();
+
+              if (kind > triton::engines::symbolic::MEM || size == 0 || size > MAX_BITS_SUPPORTED)
+                throw triton::exceptions::SymbolicEngine("SymbolicEngine::deserializeState(): Invalid symbolic variable.");
+
+              SymbolicVariable* symVar = this->newSymbolicVariable(static_cast<symkind_e>(kind), kindValue, static_cast<triton::uint32>(size), comment);
+              symVar->setConcreteValue(value);
+              reader.setVariable(name, symVar);
+              break;
+            }
+
+            case triton::ast::SERIAL_EXPRESSION: {
+              triton::usize id                = reader.readUnsigned64();
+              triton::ast::AbstractNode* node = reader.readEntry();
+              triton::uint64 kind             = reader.readUnsigned64();
+
+              if (kind > triton::engines::symbolic::MEM)
+                throw triton::exceptions::SymbolicEngine("SymbolicEngine::deserializeState(): Invalid symbolic expression.");
+
+              SymbolicExpression* expr = new(std::nothrow) SymbolicExpression(node, this->getUniqueSymExprId(), static_cast<symkind_e>(kind));
+              if (expr == nullptr)
+                throw triton::exceptions::SymbolicEngine("SymbolicEngine::deserializeState(): not enough memory");
+              this->symbolicExpressions.set(expr->getId(), expr);
+
+              if (expr->isRegister()) {
+                triton::uint64 regId = reader.readUnsigned64();
+                if (!this->architecture->isRegisterValid(static_cast<triton::uint32>(regId)))
+                  throw triton::exceptions::SymbolicEngine("SymbolicEngine::deserializeState(): Invalid register.");
+                expr->setOriginRegister(triton::arch::Register(static_cast<triton::uint32>(regId)));
+              }
+              else if (expr->isMemory()) {
+                triton::uint64 address = reader.readUnsigned64();
+                triton::uint64 size    = reader.readUnsigned64();
+                triton::uint512 value  = reader.readUnsigned();
+                expr->setOriginMemory(triton::arch::MemoryAccess(address, static_cast<triton::uint32>(size), value));
+              }
+
+              expr->isTainted = (reader.readUnsigned64() != 0);
+              expr->setComment(reader.readString());
+
+              ids[id] = expr->getId();
+              reader.setReference(id, expr->getId());
+              break;
+            }
+
+            case triton::ast::SERIAL_REGISTER: {
+              triton::uint64 regId = reader.readUnsigned64();
+              auto id = ids.find(reader.readUnsigned64());
+
+              if (regId >= this->numberOfRegisters || id == ids.end())
+                throw triton::exceptions::SymbolicEngine("SymbolicEngine::deserializeState(): Invalid register reference.");
+
+              /* A deferred flag is overwritten by the expression read */
+              auto lazy = this->lazyFlags.find(static_cast<triton::uint32>(regId));
+              if (lazy != this->lazyFlags.end())
+                this->dropLazyFlag(lazy);
+
+              this->setRegisterReference(static_cast<triton::uint32>(regId), id->second);
+              break;
+            }
+
+            case triton::ast::SERIAL_MEMORY: {
+              triton::uint64 address = reader.readUnsigned64();
+              auto id = ids.find(reader.readUnsigned64());
+              triton::uint64 offset  = reader.readUnsigned64();
+
+              if (id == ids.end() || offset >= DQQWORD_SIZE)
+                throw triton::exceptions::SymbolicEngine("SymbolicEngine::deserializeState(): Invalid memory reference.");
+
+              /* Aligned entries may overlap the memory cells read */
+              if (flushAlignedMemory) {
+                std::vector<std::pair<triton::uint64, triton::uint32>> entries;
+                this->alignedMemoryReference.forEach([&entries](triton::uint64 addr, triton::uint32 size, triton::ast::AbstractNode*) {
+                  entries.push_back(std::make_pair(addr, size));
+                });
+                for (auto entry = entries.begin(); entry != entries.end(); entry++)
+                  this->setAlignedMemoryReference(entry->first, entry->second, nullptr);
+                flushAlignedMemory = false;
+              }
+
+              this->setMemoryReference(address, id->second, static_cast<triton::uint32>(offset));
+              break;
+            }
+
+            case triton::ast::SERIAL_PATH_CONSTRAINT: {
+              triton::engines::symbolic::PathConstraint pco;
+              triton::uint64 pc     = reader.readUnsigned64();
+              triton::uint64 pcSize = reader.readUnsigned64();
+              triton::uint64 count  = reader.readUnsigned64();
+
+              for (triton::uint64 index = 0; index < count; index++) {
+                bool taken             = (reader.readUnsigned64() != 0);
+                triton::uint64 srcAddr = reader.readUnsigned64();
+                triton::uint64 dstAddr = reader.readUnsigned64();
+                pco.addBranchConstraint(taken, srcAddr, dstAddr, reader.readEntry());
+              }
+
+              if (pc != 0)
+                pco.setPcAst(reader.getNode(pc - 1), static_cast<triton::uint32>(pcSize));
+
+              this->addPathConstraint(pco);
+              break;
+            }
+
+            default:
+              throw triton::exceptions::SymbolicEngine("SymbolicEngine::deserializeState(): Unexpected record.");
+          }
+        }
+      }
+
+
+      /* Returns the map of symbolic registers defined */
+      std::map<triton::arch::Register, SymbolicExpression*> SymbolicEngine::getSymbolicRegisters(void) const {
+        std::map<triton::arch::Register, SymbolicExpression*> ret;
+
+        this->forEachSymbolicRegister([&ret](const triton::arch::Register& reg, SymbolicExpression* expr) {
+          ret[reg] = expr;
+        });
+
+        return ret;
+      }
+
+
+      /* Returns the map of symbolic memory defined */
+      std::map<triton::uint64, SymbolicExpression*> SymbolicEngine::getSymbolicMemory(void) const {
+        std::map<triton::uint64, SymbolicExpression*> ret;
+
+        this->memoryReference.forEach([this, &ret](triton::uint64 addr, triton::usize id) {
+          ret.insert(ret.end(), std::make_pair(addr, this->getSymbolicExpressionFromId(id)));
+        });
+
+        return ret;
+      }
+
+
+      /* Returns the map of symbolic memory defined in [start, end) */
+      std::map<triton::uint64, SymbolicExpression*> SymbolicEngine::getSymbolicMemory(triton::uint64 start, triton::uint64 end) const {
+        std::map<triton::uint64, SymbolicExpression*> ret;
 
-        for(it = this->symbolicVariables.begin(); it != this->symbolicVariables.end(); it++)
-          stream << triton::ast::declareFunction(it->second->getName(), triton::ast::bvdecl(it->second->getSize()));
+        this->forEachSymbolicMemory(start, end, [&ret](triton::uint64 addr, SymbolicExpression* expr) {
+          ret.insert(ret.end(), std::make_pair(addr, expr));
+        });
 
-        return stream.str();
+        return ret;
       }
 
 
-      /* Returns the map of symbolic registers defined */
-      std::map<triton::arch::Register, SymbolicExpression*> SymbolicEngine::getSymbolicRegisters(void) const {
-        std::map<triton::arch::Register, SymbolicExpression*> ret;
-
+      void SymbolicEngine::forEachSymbolicRegister(const std::function<void(const triton::arch::Register&, SymbolicExpression*)>& callback) const {
         for (triton::uint32 it = 0; it < this->numberOfRegisters; it++) {
-          if (this->symbolicReg[it] != triton::engines::symbolic::UNSET) {
-            triton::arch::Register reg(it);
-            ret[reg] = this->getSymbolicExpressionFromId(this->symbolicReg[it]);
-          }
+          if (this->symbolicReg[it] != triton::engines::symbolic::UNSET)
+            callback(triton::arch::Register(it), this->getSymbolicExpressionFromId(this->symbolicReg[it]));
         }
-
-        return ret;
       }
 
 
-      /* Returns the map of symbolic memory defined */
-      std::map<triton::uint64, SymbolicExpression*> SymbolicEngine::getSymbolicMemory(void) const {
-        std::map<triton::uint64, SymbolicExpression*> ret;
-        std::map<triton::uint64, triton::usize>::const_iterator it;
+      void SymbolicEngine::forEachSymbolicMemory(triton::uint64 start, triton::uint64 end, const std::function<void(triton::uint64, SymbolicExpression*)>& callback) const {
+        this->memoryReference.forEach(start, end, [this, &callback](triton::uint64 addr, triton::usize id) {
+          callback(addr, this->getSymbolicExpressionFromId(id));
+        });
+      }
 
-        for (it = this->memoryReference.begin(); it != this->memoryReference.end(); it++)
-          ret[it->first] = this->getSymbolicExpressionFromId(it->second);
 
-        return ret;
+      void SymbolicEngine::forEachSymbolicMemoryId(const std::function<void(triton::uint64, triton::usize)>& callback) const {
+        this->memoryReference.forEach(callback);
       }
 
 
@@ -580,16 +1757,14 @@ namespace triton {
 
       /* The memory size is used to define the symbolic variable's size. */
       SymbolicVariable* SymbolicEngine::convertMemoryToSymbolicVariable(const triton::arch::MemoryAccess& mem, const std::string& symVarComment) {
-        triton::ast::AbstractNode* tmp  = nullptr;
         SymbolicExpression* se          = nullptr;
         SymbolicVariable* symVar        = nullptr;
         triton::usize memSymId          = triton::engines::symbolic::UNSET;
+        triton::uint32 offset           = 0;
         triton::uint64 memAddr          = mem.getAddress();
         triton::uint32 symVarSize       = mem.getSize();
         triton::uint512 cv              = mem.hasConcreteValue() ? mem.getConcreteValue() : this->architecture->getConcreteMemoryValue(mem);
 
-        memSymId = this->getSymbolicMemoryId(memAddr);
-
         /* First we create a symbolic variable */
         symVar = this->newSymbolicVariable(triton::engines::symbolic::MEM, memAddr, symVarSize * BYTE_SIZE_BIT, symVarComment);
         /* Setup the concrete value to the symbolic variable */
@@ -597,43 +1772,74 @@ namespace triton {
         /* Create the AST node */
         triton::ast::AbstractNode* symVarNode = triton::ast::variable(*symVar);
 
-        /*  Split expression in bytes */
-        for (triton::sint32 index = symVarSize-1; index >= 0; index--) {
-
-          /* Isolate the good part of the symbolic variable */
-          tmp = triton::ast::extract(((BYTE_SIZE_BIT * (index+1)) - 1), ((BYTE_SIZE_BIT * (index+1)) - BYTE_SIZE_BIT), symVarNode);
-
-          /* Check if the memory address is already defined */
-          memSymId = this->getSymbolicMemoryId(memAddr+index);
-          if (memSymId == triton::engines::symbolic::UNSET) {
-            se = this->newSymbolicExpression(tmp, triton::engines::symbolic::MEM, "Byte reference");
-            se->setOriginMemory(triton::arch::MemoryAccess(memAddr+index, BYTE_SIZE, tmp->evaluate()));
-          }
-          else {
-            se = this->getSymbolicExpressionFromId(memSymId);
-            tmp->setParent(se->getAst()->getParents());
-            se->setAst(tmp);
-            tmp->init();
-            se->setOriginMemory(triton::arch::MemoryAccess(memAddr+index, BYTE_SIZE, tmp->evaluate()));
+        /* If the cells are exactly one expression, it becomes the variable, otherwise a new expression holds it */
+        memSymId = this->getSymbolicMemoryId(memAddr, offset);
+        if (memSymId != triton::engines::symbolic::UNSET && offset == 0 && this->getSymbolicExpressionFromId(memSymId)->getAst()->getBitvectorSize() == symVarSize * BYTE_SIZE_BIT) {
+          for (triton::uint32 index = 1; index < symVarSize && memSymId != triton::engines::symbolic::UNSET; index++) {
+            if (this->getSymbolicMemoryId(memAddr + index, offset) != memSymId || offset != index)
+              memSymId = triton::engines::symbolic::UNSET;
           }
+        }
+        else
+          memSymId = triton::engines::symbolic::UNSET;
 
-          /* Add the new memory reference */
-          this->addMemoryReference(memAddr+index, se->getId());
-          if (this->modes->isModeEnabled(triton::modes::ALIGNED_MEMORY))
-            removeAlignedMemory(memAddr+index, BYTE_SIZE);
+        if (memSymId != triton::engines::symbolic::UNSET) {
+          se = this->getSymbolicExpressionFromId(memSymId);
+          symVarNode->setParent(se->getAst()->getParents());
+          se->setAst(symVarNode);
+          symVarNode->init();
         }
+        else
+          se = this->newSymbolicExpression(symVarNode, triton::engines::symbolic::MEM, "Memory reference");
+        se->setOriginMemory(triton::arch::MemoryAccess(memAddr, symVarSize, symVarNode->evaluate()));
+
+        /* Add the new memory references */
+        for (triton::uint32 index = 0; index < symVarSize; index++)
+          this->addMemoryReference(memAddr + index, se->getId(), index);
+
+        if (this->modes->isModeEnabled(triton::modes::ALIGNED_MEMORY))
+          this->removeAlignedMemory(memAddr, symVarSize);
 
         return symVar;
       }
 
 
+      std::vector<SymbolicVariable*> SymbolicEngine::convertMemoryAreaToSymbolicVariables(triton::uint64 baseAddr, triton::usize size, const std::string& symVarComment, triton::uint32 wordSize) {
+        std::vector<SymbolicVariable*> symVars;
+
+        if (wordSize == 0 || wordSize > DQQWORD_SIZE || (wordSize & (wordSize - 1)) != 0)
+          throw triton::exceptions::SymbolicEngine("SymbolicEngine::convertMemoryAreaToSymbolicVariables(): The word size must be a power of two up to 64 bytes.");
+
+        if (size % wordSize != 0)
+          throw triton::exceptions::SymbolicEngine("SymbolicEngine::convertMemoryAreaToSymbolicVariables(): The size must be a multiple of the word size.");
+
+        symVars.reserve(size / wordSize);
+
+        /* The words are read with the endianness of the architecture */
+        if (wordSize != BYTE_SIZE) {
+          for (triton::usize index = 0; index < size; index += wordSize)
+            symVars.push_back(this->convertMemoryToSymbolicVariable(triton::arch::MemoryAccess(baseAddr + index, wordSize), symVarComment));
+          return symVars;
+        }
+
+        std::vector<triton::uint8> values = this->architecture->getConcreteMemoryAreaValue(baseAddr, size);
+        for (triton::usize index = 0; index < size; index++)
+          symVars.push_back(this->convertMemoryToSymbolicVariable(triton::arch::MemoryAccess(baseAddr + index, BYTE_SIZE, values[index]), symVarComment));
+
+        return symVars;
+      }
+
+
       SymbolicVariable* SymbolicEngine::convertRegisterToSymbolicVariable(const triton::arch::Register& reg, const std::string& symVarComment) {
         SymbolicVariable* symVar        = nullptr;
         SymbolicExpression* expression  = nullptr;
         triton::usize regSymId          = triton::engines::symbolic::UNSET;
-        triton::uint32 parentId         = reg.getParent().getId();
+        triton::uint32 parentId         = reg.getParentId();
         triton::uint32 symVarSize       = reg.getBitSize();
-        triton::uint512 cv              = !reg.isImmutable() && reg.hasConcreteValue() ? reg.getConcreteValue() : this->architecture->getConcreteRegisterValue(reg);
+        triton::uint512 cv              = 0;
+
+        this->materializeLazyFlag(reg);
+        cv = !reg.isImmutable() && reg.hasConcreteValue() ? reg.getConcreteValue() : this->architecture->getConcreteRegisterValue(reg);
 
         if (!this->architecture->isRegisterValid(parentId))
           throw triton::exceptions::SymbolicEngine("SymbolicEngine::convertRegisterToSymbolicVariable(): Invalid register id");
@@ -649,7 +1855,7 @@ namespace triton {
           /* Create the symbolic expression */
           SymbolicExpression* se = this->newSymbolicExpression(tmp, triton::engines::symbolic::REG);
           se->setOriginRegister(reg);
-          this->symbolicReg[parentId] = se->getId();
+          this->setRegisterReference(parentId, se->getId());
         }
 
         else {
@@ -679,7 +1885,7 @@ namespace triton {
         if (symVar == nullptr)
           throw triton::exceptions::SymbolicEngine("SymbolicEngine::newSymbolicVariable(): Cannot allocate a new symbolic variable");
 
-        this->symbolicVariables[uniqueId] = symVar;
+        this->symbolicVariables.set(uniqueId, symVar);
         return symVar;
       }
 
@@ -736,51 +1942,99 @@ namespace triton {
 
         triton::utils::fromUintToBuffer(value, concreteValue);
 
+        /* Outside the symbolic regions, the memory is a constant */
+        if (this->concreteOnly)
+          return triton::ast::bv(value, mem.getBitSize());
+
         /*
          * Symbolic optimization
          * If the memory access is aligned, don't split the memory.
          */
-        if (this->modes->isModeEnabled(triton::modes::ALIGNED_MEMORY) && this->isAlignedMemory(address, size))
-          return this->getAlignedMemory(address, size);
+        if (this->modes->isModeEnabled(triton::modes::ALIGNED_MEMORY)) {
+          triton::ast::AbstractNode* aligned = this->getAlignedMemory(address, size);
+          if (aligned != nullptr)
+            return aligned;
+        }
 
-        /* Iterate on every memory cells to use their symbolic or concrete values */
+        /*
+         * Iterate on every memory cells, from the most significant one. Contiguous
+         * concrete cells are one bitvector and contiguous cells of the same
+         * expression are one extraction of it (store-to-load forwarding).
+         */
         while (size) {
-          symMem = this->getSymbolicMemoryId(address + size - 1);
-          /* Check if the memory cell is already symbolic */
-          if (symMem != triton::engines::symbolic::UNSET) {
-            tmp = triton::ast::reference(symMem);
-            opVec.push_back(triton::ast::extract((BYTE_SIZE_BIT - 1), 0, tmp));
+          triton::uint32 count  = 1;
+          triton::uint32 offset = 0;
+
+          symMem = this->getSymbolicMemoryId(address + size - 1, offset);
+
+          /* Use the concrete values */
+          if (symMem == triton::engines::symbolic::UNSET) {
+            triton::uint512 cells = concreteValue[size - 1];
+            while (count < size && this->getSymbolicMemoryId(address + size - 1 - count) == triton::engines::symbolic::UNSET) {
+              cells = (cells << BYTE_SIZE_BIT) | concreteValue[size - 1 - count];
+              count++;
+            }
+            opVec.push_back(triton::ast::bv(cells, count * BYTE_SIZE_BIT));
           }
-          /* Otherwise, use the concerte value */
+
+          /* Otherwise, use the expression of the cells */
           else {
-            tmp = triton::ast::bv(concreteValue[size - 1], BYTE_SIZE_BIT);
-            opVec.push_back(triton::ast::extract((BYTE_SIZE_BIT - 1), 0, tmp));
+            triton::uint32 nextOffset = 0;
+            while (count <= offset && count < size) {
+              if (this->getSymbolicMemoryId(address + size - 1 - count, nextOffset) != symMem || nextOffset + count != offset)
+                break;
+              count++;
+            }
+            tmp = triton::ast::reference(symMem);
+            triton::uint32 high = ((offset + 1) * BYTE_SIZE_BIT) - 1;
+            triton::uint32 low  = (offset + 1 - count) * BYTE_SIZE_BIT;
+            if (low == 0 && high == tmp->getBitvectorSize() - 1)
+              opVec.push_back(tmp);
+            else
+              opVec.push_back(triton::ast::extract(high, low, tmp));
           }
-          size--;
-        }
 
-        /* Concatenate all memory cell to create a bit vector with the appropriate memory access */
-        switch (opVec.size()) {
-          case DQQWORD_SIZE:
-          case QQWORD_SIZE:
-          case DQWORD_SIZE:
-          case QWORD_SIZE:
-          case DWORD_SIZE:
-          case WORD_SIZE:
-            tmp = triton::ast::concat(opVec);
-            break;
-          case BYTE_SIZE:
-            tmp = opVec.front();
-            break;
+          size -= count;
         }
 
-        return tmp;
+        /* Concatenate all pieces to create a bit vector with the appropriate memory access */
+        if (opVec.size() == 1)
+          return opVec.front();
+
+        return triton::ast::concat(opVec);
       }
 
 
       /* Returns a symbolic memory and defines the memory as input of the instruction */
       triton::ast::AbstractNode* SymbolicEngine::buildSymbolicMemory(triton::arch::Instruction& inst, triton::arch::MemoryAccess& mem) {
-        triton::ast::AbstractNode* node = this->buildSymbolicMemory(mem);
+        triton::ast::AbstractNode* node = nullptr;
+
+        triton::uint64 low  = 0;
+        triton::uint64 high = 0;
+
+        /* A load whose address is symbolized reads the memory array */
+        if (this->modes->isModeEnabled(triton::modes::MEMORY_ARRAY) && mem.getLeaAst() != nullptr && mem.getLeaAst()->isSymbolized())
+          node = this->loadMemoryArray(mem);
+
+        /* Or an ite table over the window of its pointer policy, the concrete address being the last case */
+        else if (this->getPointerWindow(inst, mem, low, high)) {
+          triton::ast::AbstractNode* lea = mem.getLeaAst();
+          triton::uint64 address         = mem.getAddress();
+
+          node = this->buildSymbolicMemory(mem);
+          for (triton::uint64 target = low; ; target++) {
+            if (target != address) {
+              triton::arch::MemoryAccess cell(target, mem.getSize());
+              node = triton::ast::ite(triton::ast::equal(lea, triton::ast::bv(target, lea->getBitvectorSize())), this->buildSymbolicMemory(cell), node);
+            }
+            if (target == high)
+              break;
+          }
+        }
+
+        else
+          node = this->buildSymbolicMemory(mem);
+
         mem.setConcreteValue(node->evaluate());
         inst.setLoadAccess(mem, node);
         return node;
@@ -790,11 +2044,20 @@ namespace triton {
       /* Returns a symbolic register */
       triton::ast::AbstractNode* SymbolicEngine::buildSymbolicRegister(const triton::arch::Register& reg) {
         triton::ast::AbstractNode* op = nullptr;
-        triton::usize symReg          = this->getSymbolicRegisterId(reg);
+        triton::usize symReg          = triton::engines::symbolic::UNSET;
         triton::uint32 bvSize         = reg.getBitSize();
         triton::uint32 high           = reg.getHigh();
         triton::uint32 low            = reg.getLow();
 
+        /* A deferred flag is built when it is read */
+        this->materializeLazyFlag(reg);
+
+        /* Outside the symbolic regions, the register is a constant */
+        if (this->concreteOnly)
+          return triton::ast::bv(this->architecture->getConcreteRegisterValue(reg), bvSize);
+
+        symReg = this->getSymbolicRegisterId(reg);
+
         /* Check if the register is already symbolic */
         if (symReg != triton::engines::symbolic::UNSET)
           op = triton::ast::extract(high, low, triton::ast::reference(symReg));
@@ -830,59 +2093,70 @@ namespace triton {
 
       /* Returns the new symbolic memory expression */
       SymbolicExpression* SymbolicEngine::createSymbolicMemoryExpression(triton::arch::Instruction& inst, triton::ast::AbstractNode* node, triton::arch::MemoryAccess& mem, const std::string& comment) {
-        triton::ast::AbstractNode* tmp = nullptr;
-        std::list<triton::ast::AbstractNode*> ret;
-
         SymbolicExpression* se   = nullptr;
         triton::uint64 address   = mem.getAddress();
         triton::uint32 writeSize = mem.getSize();
 
+        /* The bytes stored are the least significant ones of the node */
+        if (node->getBitvectorSize() < mem.getBitSize())
+          throw triton::exceptions::SymbolicEngine("SymbolicEngine::createSymbolicMemoryExpression(): The node is smaller than the memory access.");
+
+        if (node->getBitvectorSize() > mem.getBitSize())
+          node = triton::ast::extract(mem.getBitSize() - 1, 0, node);
+
+        /* With a pointer policy, each address of the window is only stored if the address expression is equal to it */
+        triton::uint64 low  = 0;
+        triton::uint64 high = 0;
+        if (this->getPointerWindow(inst, mem, low, high)) {
+          triton::ast::AbstractNode* lea = mem.getLeaAst();
+
+          for (triton::uint64 target = low; ; target++) {
+            if (target != address) {
+              triton::arch::MemoryAccess cell(target, writeSize);
+              triton::ast::AbstractNode* value = triton::ast::ite(triton::ast::equal(lea, triton::ast::bv(target, lea->getBitvectorSize())), node, this->buildSymbolicMemory(cell));
+
+              if (this->modes->isModeEnabled(triton::modes::ALIGNED_MEMORY))
+                this->addAlignedMemory(target, writeSize, value);
+
+              SymbolicExpression* cellExpr = this->newSymbolicExpression(value, triton::engines::symbolic::MEM, comment);
+              cellExpr->setOriginMemory(triton::arch::MemoryAccess(target, writeSize, cellExpr->getAst()->evaluate()));
+              for (triton::uint32 offset = 0; offset < writeSize; offset++)
+                this->addMemoryReference(target + offset, cellExpr->getId(), offset);
+              inst.addSymbolicExpression(cellExpr);
+            }
+            if (target == high)
+              break;
+          }
+
+          node = triton::ast::ite(triton::ast::equal(lea, triton::ast::bv(address, lea->getBitvectorSize())), node, this->buildSymbolicMemory(mem));
+        }
+
         /* Record the aligned memory for a symbolic optimization */
         if (this->modes->isModeEnabled(triton::modes::ALIGNED_MEMORY))
           this->addAlignedMemory(address, writeSize, node);
 
+        /* Record the store into the memory array */
+        if (this->modes->isModeEnabled(triton::modes::MEMORY_ARRAY))
+          inst.addSymbolicExpression(this->storeMemoryArray(mem, node, comment));
+
         /*
          * As the x86's memory can be accessed without alignment, each byte of the
-         * memory must be assigned to an unique reference.
+         * memory is assigned to the expression with its offset in it (little endian).
+         * A load reads back any range of the bytes as one extraction.
          */
-        while (writeSize) {
-          /* Extract each byte of the memory */
-          tmp = triton::ast::extract(((writeSize * BYTE_SIZE_BIT) - 1), ((writeSize * BYTE_SIZE_BIT) - BYTE_SIZE_BIT), node);
-          se = this->newSymbolicExpression(tmp, triton::engines::symbolic::MEM, "Byte reference - " + comment);
-          se->setOriginMemory(triton::arch::MemoryAccess(((address + writeSize) - 1), BYTE_SIZE, tmp->evaluate()));
-          ret.push_back(tmp);
-          inst.addSymbolicExpression(se);
-          /* Assign memory with little endian */
-          this->addMemoryReference((address + writeSize) - 1, se->getId());
-          /* continue */
-          writeSize--;
-        }
-
-        /* If there is only one reference, we return the symbolic expression */
-        if (ret.size() == 1) {
-          /* Synchronize the memory operand */
-          mem.setConcreteValue(tmp->evaluate());
-          /* Synchronize the concrete state */
-          this->architecture->setConcreteMemoryValue(mem);
-          /* Define the memory store */
-          inst.setStoreAccess(mem, tmp);
-          return se;
-        }
-
-        /* Otherwise, we return the concatenation of all symbolic expressions */
-        tmp = triton::ast::concat(ret);
+        se = this->newSymbolicExpression(node, triton::engines::symbolic::MEM, comment);
+        se->setOriginMemory(triton::arch::MemoryAccess(address, writeSize, se->getAst()->evaluate()));
+        for (triton::uint32 offset = 0; offset < writeSize; offset++)
+          this->addMemoryReference(address + offset, se->getId(), offset);
 
         /* Synchronize the memory operand */
-        mem.setConcreteValue(tmp->evaluate());
+        mem.setConcreteValue(se->getAst()->evaluate());
 
         /* Synchronize the concrete state */
         this->architecture->setConcreteMemoryValue(mem);
 
-        se  = this->newSymbolicExpression(tmp, triton::engines::symbolic::UNDEF, "Temporary concatenation reference - " + comment);
-        se->setOriginMemory(triton::arch::MemoryAccess(address, mem.getSize(), tmp->evaluate()));
-
         /* Define the memory store */
-        inst.setStoreAccess(mem, tmp);
+        inst.setStoreAccess(mem, se->getAst());
         inst.addSymbolicExpression(se);
         return se;
       }
@@ -959,6 +2233,106 @@ namespace triton {
       }
 
 
+      /* Returns the new symbolic flag expression or nullptr if it is deferred */
+      SymbolicExpression* SymbolicEngine::createLazySymbolicFlagExpression(triton::arch::Instruction& inst,
+                                                                           triton::arch::Register& flag,
+                                                                           SymbolicExpression* parent,
+                                                                           const std::vector<triton::ast::AbstractNode*>& nodes,
+                                                                           const std::function<triton::ast::AbstractNode*(void)>& builder,
+                                                                           bool isTainted,
+                                                                           const std::string& comment) {
+
+        if (!this->architecture->isFlag(flag))
+          throw triton::exceptions::SymbolicEngine("SymbolicEngine::createLazySymbolicFlagExpression(): The register must be a flag.");
+
+        /*
+         * Expressions of instructions may be removed right after the semantics
+         * with ONLY_ON_SYMBOLIZED, ONLY_ON_TAINTED or outside the symbolic regions,
+         * so flags are built now.
+         */
+        if (!this->enableFlag ||
+            this->concreteOnly ||
+            !this->modes->isModeEnabled(triton::modes::LAZY_FLAGS) ||
+            this->modes->isModeEnabled(triton::modes::ONLY_ON_SYMBOLIZED) ||
+            this->modes->isModeEnabled(triton::modes::ONLY_ON_TAINTED)) {
+          SymbolicExpression* se = this->createSymbolicFlagExpression(inst, builder(), flag, comment);
+          se->isTainted = isTainted;
+          return se;
+        }
+
+        triton::uint32 id = flag.getParentId();
+        auto it = this->lazyFlags.find(id);
+        if (it != this->lazyFlags.end())
+          this->dropLazyFlag(it);
+
+        LazyFlag& lazy = this->lazyFlags[id];
+        lazy.builder   = builder;
+        lazy.nodes     = nodes;
+        lazy.parent    = parent->getId();
+        lazy.isTainted = isTainted;
+        lazy.comment   = comment;
+
+        for (auto node = lazy.nodes.begin(); node != lazy.nodes.end(); node++)
+          (*node)->incReference();
+
+        /* The previous expression of the flag is not reachable anymore */
+        this->setRegisterReference(id, triton::engines::symbolic::UNSET);
+
+        return nullptr;
+      }
+
+
+      void SymbolicEngine::materializeLazyFlag(const triton::arch::Register& flag) {
+        if (this->lazyFlags.empty())
+          return;
+
+        auto it = this->lazyFlags.find(flag.getParentId());
+        if (it != this->lazyFlags.end())
+          this->materializeLazyFlag(it);
+      }
+
+
+      void SymbolicEngine::materializeLazyFlags(void) {
+        while (!this->lazyFlags.empty())
+          this->materializeLazyFlag(this->lazyFlags.begin());
+      }
+
+
+      void SymbolicEngine::dropLazyFlag(const triton::arch::Register& flag) {
+        if (this->lazyFlags.empty())
+          return;
+
+        auto it = this->lazyFlags.find(flag.getParentId());
+        if (it != this->lazyFlags.end())
+          this->dropLazyFlag(it);
+      }
+
+
+      bool SymbolicEngine::isLazyFlag(const triton::arch::Register& flag) const {
+        return (this->lazyFlags.find(flag.getParentId()) != this->lazyFlags.end());
+      }
+
+
+      void SymbolicEngine::materializeLazyFlag(std::map<triton::uint32, LazyFlag>::iterator it) {
+        triton::arch::Register flag(it->first);
+        triton::ast::AbstractNode* node = it->second.builder();
+        SymbolicExpression* se          = this->newSymbolicExpression(node, triton::engines::symbolic::REG, it->second.comment);
+
+        se->isTainted = it->second.isTainted;
+        flag.setConcreteValue(se->getAst()->evaluate());
+
+        /* Drops the deferred flag and synchronizes the concrete state */
+        this->assignSymbolicExpressionToRegister(se, flag);
+      }
+
+
+      void SymbolicEngine::dropLazyFlag(std::map<triton::uint32, LazyFlag>::iterator it) {
+        for (auto node = it->second.nodes.begin(); node != it->second.nodes.end(); node++)
+          (*node)->decReference();
+        this->lazyFlags.erase(it);
+      }
+
+
       /* Returns the new symbolic volatile expression */
       SymbolicExpression* SymbolicEngine::createSymbolicVolatileExpression(triton::arch::Instruction& inst, triton::ast::AbstractNode* node, const std::string& comment) {
         triton::engines::symbolic::SymbolicExpression* se = this->newSymbolicExpression(node, triton::engines::symbolic::UNDEF, comment);
@@ -968,8 +2342,8 @@ namespace triton {
 
 
       /* Adds and assign a new memory reference */
-      void SymbolicEngine::addMemoryReference(triton::uint64 mem, triton::usize id) {
-        this->memoryReference[mem] = id;
+      void SymbolicEngine::addMemoryReference(triton::uint64 mem, triton::usize id, triton::uint32 offset) {
+        this->setMemoryReference(mem, id, offset);
       }
 
 
@@ -987,9 +2361,16 @@ namespace triton {
         if (node->getBitvectorSize() != reg.getBitSize())
           throw triton::exceptions::SymbolicEngine("SymbolicEngine::assignSymbolicExpressionToRegister(): The size of the symbolic expression is not equal to the target register.");
 
+        /* A deferred flag overwritten before being read is never built */
+        if (!this->lazyFlags.empty()) {
+          auto it = this->lazyFlags.find(id);
+          if (it != this->lazyFlags.end())
+            this->dropLazyFlag(it);
+        }
+
         se->setKind(triton::engines::symbolic::REG);
         se->setOriginRegister(reg);
-        this->symbolicReg[id] = se->getId();
+        this->setRegisterReference(id, se->getId());
 
         /* Synchronize the concrete state */
         this->architecture->setConcreteRegisterValue(reg);
@@ -1010,19 +2391,272 @@ namespace triton {
         if (this->modes->isModeEnabled(triton::modes::ALIGNED_MEMORY))
           this->addAlignedMemory(address, writeSize, node);
 
-        /*
-         * As the x86's memory can be accessed without alignment, each byte of the
-         * memory must be assigned to an unique reference.
-         */
-        while (writeSize) {
-          /* Extract each byte of the memory */
-          triton::ast::AbstractNode* tmp = triton::ast::extract(((writeSize * BYTE_SIZE_BIT) - 1), ((writeSize * BYTE_SIZE_BIT) - BYTE_SIZE_BIT), node);
-          SymbolicExpression* byteRef = this->newSymbolicExpression(tmp, triton::engines::symbolic::MEM, "Byte reference");
-          byteRef->setOriginMemory(triton::arch::MemoryAccess(((address + writeSize) - 1), BYTE_SIZE, tmp->evaluate()));
-          /* Assign memory with little endian */
-          this->addMemoryReference((address + writeSize) - 1, byteRef->getId());
-          writeSize--;
+        /* Record the store into the memory array */
+        if (this->modes->isModeEnabled(triton::modes::MEMORY_ARRAY))
+          this->storeMemoryArray(mem, node, se->getComment());
+
+        /* Each byte of the memory is assigned to the expression with its offset in it (little endian) */
+        for (triton::uint32 offset = 0; offset < writeSize; offset++)
+          this->addMemoryReference(address + offset, se->getId(), offset);
+      }
+
+
+      /* Sets a register reference and journals the previous one */
+      void SymbolicEngine::setRegisterReference(triton::uint32 regId, triton::usize symExprId) {
+        if (this->journalFlag)
+          this->journalRegisters.push_back(std::make_pair(regId, this->symbolicReg[regId]));
+        this->symbolicReg[regId] = symExprId;
+
+        if (this->instructionWindow && symExprId != triton::engines::symbolic::UNSET)
+          this->windowSlots.back().registers.push_back(std::make_pair(regId, symExprId));
+      }
+
+
+      /* Sets a memory reference and journals the previous one */
+      void SymbolicEngine::setMemoryReference(triton::uint64 addr, triton::usize symExprId, triton::uint32 offset) {
+        triton::uint32 oldOffset = 0;
+
+        if (this->journalFlag)
+          this->memoryReference.get(addr, oldOffset);
+
+        triton::usize old = this->memoryReference.set(addr, symExprId, offset);
+
+        if (this->journalFlag)
+          this->journalMemory.push_back(std::make_tuple(addr, old, oldOffset));
+
+        if (this->instructionWindow && symExprId != triton::engines::symbolic::UNSET)
+          this->windowSlots.back().memory.push_back(std::make_pair(addr, symExprId));
+      }
+
+
+      /* Sets an aligned memory entry and journals the previous one */
+      void SymbolicEngine::setAlignedMemoryReference(triton::uint64 address, triton::uint32 size, triton::ast::AbstractNode* node) {
+        triton::ast::AbstractNode* old = this->alignedMemoryReference.get(address, size);
+
+        /* Nothing to do when removing a missing entry */
+        if (node == nullptr && old == nullptr)
+          return;
+
+        if (this->journalFlag)
+          this->journalAlignedMemory.push_back(std::make_pair(std::make_pair(address, size), old));
+
+        this->alignedMemoryReference.set(address, size, node);
+
+        /* Aligned entries hold their node */
+        if (node != nullptr)
+          node->incReference();
+
+        if (old != nullptr)
+          old->decReference();
+        else
+          this->releaseRetiredAlignedMemory(SymbolicEngine::releasedAlignedEntries);
+      }
+
+
+      /* Releases the oldest retired aligned entries first */
+      void SymbolicEngine::releaseRetiredAlignedMemory(triton::usize count) {
+        while (count > 0 && !this->retiredAlignedMemory.empty()) {
+          auto& generation = this->retiredAlignedMemory.front();
+          if (!generation.empty()) {
+            generation.extract()->decReference();
+            count--;
+          }
+          if (generation.empty())
+            this->retiredAlignedMemory.pop_front();
+        }
+      }
+
+
+      triton::ast::AbstractNode* SymbolicEngine::getMemoryArray(void) {
+        if (this->memoryArrayId != triton::engines::symbolic::UNSET)
+          return triton::ast::reference(this->memoryArrayId);
+        return triton::ast::array(this->architecture->registerBitSize(), "memory!" + std::to_string(this->memoryArrayGeneration));
+      }
+
+
+      triton::usize SymbolicEngine::getMemoryArrayId(void) const {
+        return this->memoryArrayId;
+      }
+
+
+      void SymbolicEngine::resetMemoryArray(void) {
+        this->memoryArrayId = triton::engines::symbolic::UNSET;
+        this->memoryArrayGeneration++;
+      }
+
+
+      /* The index is the LEA if it is symbolized and matches the concrete address, otherwise the concrete address */
+      triton::ast::AbstractNode* SymbolicEngine::getMemoryArrayIndex(const triton::arch::MemoryAccess& mem, triton::uint32 offset) {
+        triton::ast::AbstractNode* lea = mem.getLeaAst();
+        triton::uint32 indexSize       = this->architecture->registerBitSize();
+
+        if (lea == nullptr || !lea->isSymbolized() || lea->evaluate() != mem.getAddress())
+          return triton::ast::bv(mem.getAddress() + offset, indexSize);
+
+        if (lea->getBitvectorSize() < indexSize)
+          lea = triton::ast::zx(indexSize - lea->getBitvectorSize(), lea);
+        else if (lea->getBitvectorSize() > indexSize)
+          lea = triton::ast::extract(indexSize - 1, 0, lea);
+
+        if (offset == 0)
+          return lea;
+
+        return triton::ast::bvadd(lea, triton::ast::bv(offset, indexSize));
+      }
+
+
+      /* The bytes are stored in little endian */
+      SymbolicExpression* SymbolicEngine::storeMemoryArray(const triton::arch::MemoryAccess& mem, triton::ast::AbstractNode* node, const std::string& comment) {
+        triton::ast::AbstractNode* array = this->getMemoryArray();
+
+        for (triton::uint32 offset = 0; offset < mem.getSize(); offset++) {
+          triton::ast::AbstractNode* byte = triton::ast::extract((offset * BYTE_SIZE_BIT) + (BYTE_SIZE_BIT - 1), offset * BYTE_SIZE_BIT, node);
+          array = triton::ast::store(array, this->getMemoryArrayIndex(mem, offset), byte);
+        }
+
+        SymbolicExpression* se = this->newSymbolicExpression(array, triton::engines::symbolic::UNDEF, "Memory array - " + comment);
+        this->memoryArrayId = se->getId();
+
+        return se;
+      }
+
+
+      triton::ast::AbstractNode* SymbolicEngine::loadMemoryArray(const triton::arch::MemoryAccess& mem) {
+        std::list<triton::ast::AbstractNode*> bytes;
+        triton::ast::AbstractNode* array = this->getMemoryArray();
+
+        /* The most significant byte is the last one */
+        for (triton::uint32 offset = mem.getSize(); offset > 0; offset--)
+          bytes.push_back(triton::ast::select(array, this->getMemoryArrayIndex(mem, offset - 1)));
+
+        if (bytes.size() == 1)
+          return bytes.front();
+
+        return triton::ast::concat(bytes);
+      }
+
+
+      void SymbolicEngine::initMemoryArrayArea(triton::uint64 baseAddr, triton::usize size) {
+        triton::ast::AbstractNode* array = this->getMemoryArray();
+
+        if (size == 0)
+          return;
+
+        /* Symbolic cells keep their expression */
+        for (triton::usize offset = 0; offset < size; offset++) {
+          triton::arch::MemoryAccess mem(baseAddr + offset, BYTE_SIZE);
+          array = triton::ast::store(array, triton::ast::bv(baseAddr + offset, this->architecture->registerBitSize()), this->buildSymbolicMemory(mem));
+        }
+
+        SymbolicExpression* se = this->newSymbolicExpression(array, triton::engines::symbolic::UNDEF, "Memory array - area");
+        this->memoryArrayId = se->getId();
+      }
+
+
+      /* Starts recording changes into the journal, the deferred flags are not journaled */
+      void SymbolicEngine::startJournal(void) {
+        this->materializeLazyFlags();
+
+        if (this->journalMarks.empty()) {
+          this->journalRegisters.clear();
+          this->journalMemory.clear();
+          this->journalAlignedMemory.clear();
+        }
+
+        JournalMark mark;
+        mark.symExprId       = this->uniqueSymExprId;
+        mark.symVarId        = this->uniqueSymVarId;
+        mark.pathConstraints = this->pathConstraints.size();
+        mark.memoryArrayId   = this->memoryArrayId;
+        mark.registers       = this->journalRegisters.size();
+        mark.memory          = this->journalMemory.size();
+        mark.alignedMemory   = this->journalAlignedMemory.size();
+
+        this->journalMarks.push_back(mark);
+        this->journalFlag = true;
+      }
+
+
+      /* Reverts every change recorded into the innermost journal */
+      void SymbolicEngine::rollbackJournal(std::vector<triton::ast::AbstractNode*>* asts) {
+        if (this->journalMarks.empty())
+          return;
+
+        JournalMark mark = this->journalMarks.back();
+        this->journalMarks.pop_back();
+
+        /* Stop recording before restoring, restorations must not be journaled */
+        this->journalFlag = false;
+
+        /* Restore references in the reverse order */
+        for (triton::usize index = this->journalRegisters.size(); index > mark.registers; index--)
+          this->symbolicReg[this->journalRegisters[index - 1].first] = this->journalRegisters[index - 1].second;
+
+        for (triton::usize index = this->journalMemory.size(); index > mark.memory; index--) {
+          const auto& entry = this->journalMemory[index - 1];
+          this->setMemoryReference(std::get<0>(entry), std::get<1>(entry), std::get<2>(entry));
+        }
+
+        for (triton::usize index = this->journalAlignedMemory.size(); index > mark.alignedMemory; index--) {
+          const auto& entry = this->journalAlignedMemory[index - 1];
+          this->setAlignedMemoryReference(entry.first.first, entry.first.second, entry.second);
+        }
+
+        this->memoryArrayId = mark.memoryArrayId;
+
+        /* The deferred flags have been built when the journal has been started */
+        while (!this->lazyFlags.empty())
+          this->dropLazyFlag(this->lazyFlags.begin());
+
+        /* Delete expressions and variables created since the journal has been started */
+        for (triton::usize id = mark.symExprId; id < this->uniqueSymExprId; id++) {
+          SymbolicExpression* expr = this->symbolicExpressions.get(id);
+          if (expr != nullptr && asts != nullptr) {
+            expr->getAst()->incReference();
+            asts->push_back(expr->getAst());
+          }
+          this->symbolicExpressions.erase(id);
+          this->dropFullAst(id);
+        }
+
+        for (triton::usize id = mark.symVarId; id < this->uniqueSymVarId; id++)
+          this->symbolicVariables.erase(id);
+
+        /* Drop path constraints added since the journal has been started */
+        this->truncatePathConstraints(mark.pathConstraints);
+
+        /* Cached simplifications may hold journaled nodes and ids are given again */
+        this->clearSimplifications();
+
+        /* The ids given again are indexed again */
+        if (this->taintedIndexId > mark.symExprId) {
+          auto it = std::lower_bound(this->taintedExpressions.begin(), this->taintedExpressions.end(), mark.symExprId);
+          this->taintedExpressions.erase(it, this->taintedExpressions.end());
+          this->taintedIndexId = mark.symExprId;
         }
+
+        this->uniqueSymExprId = mark.symExprId;
+        this->uniqueSymVarId  = mark.symVarId;
+
+        this->journalRegisters.resize(mark.registers);
+        this->journalMemory.resize(mark.memory);
+        this->journalAlignedMemory.resize(mark.alignedMemory);
+        this->journalFlag = !this->journalMarks.empty();
+      }
+
+
+      void SymbolicEngine::clearJournal(void) {
+        this->journalMarks.clear();
+        this->journalRegisters.clear();
+        this->journalMemory.clear();
+        this->journalAlignedMemory.clear();
+        this->journalFlag = false;
+      }
+
+
+      /* Returns true if changes are recorded into the journal */
+      bool SymbolicEngine::isJournalStarted(void) const {
+        return this->journalFlag;
       }
 
 
@@ -1034,9 +2668,7 @@ namespace triton {
 
       /* Returns true if the symbolic expression ID exists */
       bool SymbolicEngine::isSymbolicExpressionIdExists(triton::usize symExprId) const {
-        if (this->symbolicExpressions.find(symExprId) != this->symbolicExpressions.end())
-          return true;
-        return false;
+        return this->symbolicExpressions.contains(symExprId);
       }
 
 
@@ -1051,15 +2683,30 @@ namespace triton {
 
       /* Returns true if memory cell expressions contain symbolic variables. */
       bool SymbolicEngine::isMemorySymbolized(triton::uint64 addr, triton::uint32 size) const {
-        for (triton::uint32 i = 0; i < size; i++) {
-          triton::usize symId = this->getSymbolicMemoryId(addr+i);
+        triton::uint64 remaining = size;
 
-          if (symId == triton::engines::symbolic::UNSET)
-            continue;
+        if (!this->isSymbolized())
+          return false;
+
+        /* Scan the access page by page */
+        while (remaining) {
+          triton::uint64 length = 0;
+          const triton::usize* slots = this->memoryReference.getSlots(addr, length);
 
-          triton::engines::symbolic::SymbolicExpression* symExp = this->getSymbolicExpressionFromId(symId);
-          if (symExp->isSymbolized())
-            return true;
+          if (length > remaining)
+            length = remaining;
+
+          for (triton::uint64 i = 0; slots != nullptr && i < length; i++) {
+            if (slots[i] == triton::engines::symbolic::UNSET)
+              continue;
+
+            triton::engines::symbolic::SymbolicExpression* symExp = this->getSymbolicExpressionFromId(slots[i]);
+            if (symExp->isSymbolized())
+              return true;
+          }
+
+          addr      += length;
+          remaining -= length;
         }
 
         return false;
@@ -1070,7 +2717,7 @@ namespace triton {
       bool SymbolicEngine::isRegisterSymbolized(const triton::arch::Register& reg) const {
         triton::usize symId = this->getSymbolicRegisterId(reg);
 
-        if (symId == triton::engines::symbolic::UNSET)
+        if (symId == triton::engines::symbolic::UNSET || !this->isSymbolized())
           return false;
 
         triton::engines::symbolic::SymbolicExpression* symExp = this->getSymbolicExpressionFromId(symId);
@@ -1078,8 +2725,17 @@ namespace triton {
       }
 
 
+      /* Returns false if no expression can be symbolized */
+      bool SymbolicEngine::isSymbolized(void) const {
+        return (this->symbolicVariables.size() != 0 || this->modes->isModeEnabled(triton::modes::MEMORY_ARRAY));
+      }
+
+
       /* Enables or disables the symbolic engine */
       void SymbolicEngine::enable(bool flag) {
+        /* Once disabled, the symbolic state is journaled per instruction */
+        if (!flag)
+          this->materializeLazyFlags();
         this->enableFlag = flag;
       }
 
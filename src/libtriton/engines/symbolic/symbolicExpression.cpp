@@ -5,8 +5,14 @@
 **  This program is under the terms of the BSD License.
 */
 
+#include <algorithm>
+#include <deque>
+#include <mutex>
+#include <unordered_map>
+
 #include <exceptions.hpp>
 #include <astRepresentation.hpp>
+#include <astTraversal.hpp>
 #include <symbolicExpression.hpp>
 
 
@@ -15,16 +21,40 @@ namespace triton {
   namespace engines {
     namespace symbolic {
 
-      SymbolicExpression::SymbolicExpression(triton::ast::AbstractNode* node, triton::usize id, symkind_e kind, const std::string& comment) : originRegister() {
-        this->comment       = comment;
+      std::atomic<triton::usize> SymbolicExpression::revision(0);
+      std::atomic<triton::usize> SymbolicExpression::deletions(0);
+
+
+      /* The comments of all expressions, a few distinct strings shared by many expressions. The deque keeps them in place */
+      static std::mutex commentsLock;
+      static std::deque<std::string> comments(1);
+      static std::unordered_map<std::string, triton::uint32> commentIds;
+
+
+      SymbolicExpression::SymbolicExpression(triton::ast::AbstractNode* node, triton::usize id, symkind_e kind, const std::string& comment) {
         this->ast           = node;
+        this->commentId     = SymbolicExpression::internComment(comment);
         this->id            = id;
         this->isTainted     = false;
         this->kind          = kind;
+        this->origin        = 0;
+        this->originKind    = triton::engines::symbolic::UNDEF;
+        this->originSize    = 0;
+
+        if (this->ast) {
+          this->ast->incReference();
+          this->indexReferences();
+        }
       }
 
 
       SymbolicExpression::~SymbolicExpression() {
+        /* The AST is freed by the garbage collector once it has no holder anymore */
+        if (this->ast)
+          this->ast->decReference();
+
+        /* The reference nodes which kept this expression must look it up again */
+        SymbolicExpression::deletions++;
       }
 
 
@@ -42,8 +72,27 @@ namespace triton {
       }
 
 
+      /* [private method] */
+      triton::uint32 SymbolicExpression::internComment(const std::string& comment) {
+        if (comment.empty())
+          return 0;
+
+        std::lock_guard<std::mutex> guard(commentsLock);
+        auto it = commentIds.find(comment);
+        if (it != commentIds.end())
+          return it->second;
+
+        triton::uint32 commentId = static_cast<triton::uint32>(comments.size());
+        comments.push_back(comment);
+        commentIds[comment] = commentId;
+
+        return commentId;
+      }
+
+
       const std::string& SymbolicExpression::getComment(void) const {
-        return this->comment;
+        std::lock_guard<std::mutex> guard(commentsLock);
+        return comments[this->commentId];
       }
 
 
@@ -84,25 +133,70 @@ namespace triton {
       }
 
 
-      const triton::arch::MemoryAccess& SymbolicExpression::getOriginMemory(void) const {
-        return this->originMemory;
+      const std::vector<triton::usize>& SymbolicExpression::getReferences(void) const {
+        return this->references;
+      }
+
+
+      /* [private method] The walk stops at the reference nodes, so only the nodes of this expression are visited */
+      void SymbolicExpression::indexReferences(void) {
+        std::vector<triton::ast::AbstractNode*> nodes;
+
+        this->references.clear();
+        triton::ast::nodesExtraction(nodes, this->ast);
+        for (auto it = nodes.begin(); it != nodes.end(); it++) {
+          if ((*it)->getKind() == triton::ast::REFERENCE_NODE)
+            this->references.push_back(reinterpret_cast<triton::ast::ReferenceNode*>(*it)->getValue());
+        }
+
+        std::sort(this->references.begin(), this->references.end());
+        this->references.erase(std::unique(this->references.begin(), this->references.end()), this->references.end());
+        this->references.shrink_to_fit();
+      }
+
+
+      triton::arch::MemoryAccess SymbolicExpression::getOriginMemory(void) const {
+        if (this->originKind != triton::engines::symbolic::MEM || this->originSize == 0)
+          return triton::arch::MemoryAccess();
+
+        triton::arch::MemoryAccess mem(this->origin, this->originSize);
+        if (this->ast && this->ast->getBitvectorSize() == mem.getBitSize())
+          mem.setConcreteValue(this->ast->evaluate());
+
+        return mem;
       }
 
 
-      const triton::arch::Register& SymbolicExpression::getOriginRegister(void) const {
-        return this->originRegister;
+      triton::arch::Register SymbolicExpression::getOriginRegister(void) const {
+        if (this->originKind != triton::engines::symbolic::REG)
+          return triton::arch::Register();
+        return triton::arch::Register(static_cast<triton::uint32>(this->origin));
       }
 
 
       void SymbolicExpression::setAst(triton::ast::AbstractNode* node) {
         node->setParent(this->ast->getParents());
+        node->incReference();
+        this->ast->decReference();
         this->ast = node;
         this->ast->init();
+        this->indexReferences();
+        SymbolicExpression::revision++;
+      }
+
+
+      triton::usize SymbolicExpression::getRevision(void) {
+        return SymbolicExpression::revision;
+      }
+
+
+      triton::usize SymbolicExpression::getDeletions(void) {
+        return SymbolicExpression::deletions;
       }
 
 
       void SymbolicExpression::setComment(const std::string& comment) {
-        this->comment = comment;
+        this->commentId = SymbolicExpression::internComment(comment);
       }
 
 
@@ -112,12 +206,16 @@ namespace triton {
 
 
       void SymbolicExpression::setOriginMemory(const triton::arch::MemoryAccess& mem) {
-        this->originMemory = mem;
+        this->origin     = mem.getAddress();
+        this->originKind = triton::engines::symbolic::MEM;
+        this->originSize = mem.getSize();
       }
 
 
       void SymbolicExpression::setOriginRegister(const triton::arch::Register& reg) {
-        this->originRegister = reg;
+        this->origin     = reg.getId();
+        this->originKind = triton::engines::symbolic::REG;
+        this->originSize = 0;
       }
 
 
@@ -138,6 +236,20 @@ namespace triton {
       }
 
 
+      triton::uint32 SymbolicExpression::getDepth(void) const {
+        if (this->ast == nullptr)
+          return 0;
+        return this->ast->getDepth();
+      }
+
+
+      triton::uint64 SymbolicExpression::getUnrolledSize(void) const {
+        if (this->ast == nullptr)
+          return 0;
+        return this->ast->getUnrolledSize();
+      }
+
+
       std::ostream& operator<<(std::ostream& stream, const SymbolicExpression& symExpr) {
         stream << symExpr.getFormattedId() << " = " << symExpr.getAst();
         if (!symExpr.getComment().empty())
@@ -0,0 +1,269 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#include <coreUtils.hpp>
+#include <symbolicEnums.hpp>
+#include <symbolicMemoryMap.hpp>
+
+
+
+namespace triton {
+  namespace engines {
+    namespace symbolic {
+
+      SymbolicMemoryMap::SymbolicMemoryMap() {
+        this->count          = 0;
+        this->cachedNumber   = 0;
+        this->cachedPage     = nullptr;
+        this->cachedWritable = false;
+      }
+
+
+      SymbolicMemoryMap::SymbolicMemoryMap(const SymbolicMemoryMap& other) {
+        this->count          = other.count;
+        this->pages          = other.pages;
+        this->cachedNumber   = 0;
+        this->cachedPage     = nullptr;
+        this->cachedWritable = false;
+        /* Pages of the other map are shared now */
+        other.cachedWritable = false;
+      }
+
+
+      void SymbolicMemoryMap::operator=(const SymbolicMemoryMap& other) {
+        this->count          = other.count;
+        this->pages          = other.pages;
+        this->cachedNumber   = 0;
+        this->cachedPage     = nullptr;
+        this->cachedWritable = false;
+        /* Pages of the other map are shared now */
+        other.cachedWritable = false;
+      }
+
+
+      const SymbolicMemoryMap::Page* SymbolicMemoryMap::findPage(triton::uint64 addr) const {
+        triton::uint64 number = (addr >> SymbolicMemoryMap::pageBits);
+
+        if (this->cachedPage != nullptr && this->cachedNumber == number)
+          return this->cachedPage;
+
+        auto it = this->pages.find(number);
+        if (it == this->pages.end())
+          return nullptr;
+
+        /* Pages are owned by the map, the pointer stays valid until the page is erased or duplicated */
+        this->cachedNumber   = number;
+        this->cachedPage     = it->second.get();
+        this->cachedWritable = it->second.unique();
+
+        return this->cachedPage;
+      }
+
+
+      SymbolicMemoryMap::Page* SymbolicMemoryMap::findWritablePage(triton::uint64 addr, bool create) {
+        triton::uint64 number = (addr >> SymbolicMemoryMap::pageBits);
+
+        if (this->cachedPage != nullptr && this->cachedNumber == number && this->cachedWritable)
+          return this->cachedPage;
+
+        auto it = this->pages.find(number);
+        if (it == this->pages.end()) {
+          if (!create)
+            return nullptr;
+          this->releaseRetired(SymbolicMemoryMap::releasedPages);
+          it = this->pages.insert(std::make_pair(number, std::allocate_shared<Page>(triton::utils::HugePageAllocator<Page>()))).first;
+          it->second->slots.resize(SymbolicMemoryMap::pageSize, triton::engines::symbolic::UNSET);
+          it->second->offsets.resize(SymbolicMemoryMap::pageSize, 0);
+          it->second->count = 0;
+        }
+
+        /* Copy-on-write, the shared page stays with the other maps */
+        else if (!it->second.unique())
+          it->second = std::allocate_shared<Page>(triton::utils::HugePageAllocator<Page>(), *it->second);
+
+        this->cachedNumber   = number;
+        this->cachedPage     = it->second.get();
+        this->cachedWritable = true;
+
+        return this->cachedPage;
+      }
+
+
+      void SymbolicMemoryMap::releaseRetired(triton::usize count) {
+        while (count > 0 && !this->retired.empty()) {
+          std::map<triton::uint64, std::shared_ptr<Page>>& generation = this->retired.front();
+          if (!generation.empty()) {
+            generation.erase(generation.begin());
+            count--;
+          }
+          if (generation.empty())
+            this->retired.pop_front();
+        }
+      }
+
+
+      triton::usize SymbolicMemoryMap::get(triton::uint64 addr) const {
+        const Page* page = this->findPage(addr);
+
+        if (page == nullptr)
+          return triton::engines::symbolic::UNSET;
+
+        return page->slots[addr & (SymbolicMemoryMap::pageSize - 1)];
+      }
+
+
+      triton::usize SymbolicMemoryMap::get(triton::uint64 addr, triton::uint32& offset) const {
+        const Page* page = this->findPage(addr);
+
+        offset = 0;
+        if (page == nullptr)
+          return triton::engines::symbolic::UNSET;
+
+        offset = page->offsets[addr & (SymbolicMemoryMap::pageSize - 1)];
+        return page->slots[addr & (SymbolicMemoryMap::pageSize - 1)];
+      }
+
+
+      triton::usize SymbolicMemoryMap::set(triton::uint64 addr, triton::usize symExprId, triton::uint32 offset) {
+        /* Removing an unset entry must not allocate or duplicate a page */
+        if (symExprId == triton::engines::symbolic::UNSET && this->get(addr) == triton::engines::symbolic::UNSET)
+          return triton::engines::symbolic::UNSET;
+
+        Page* page = this->findWritablePage(addr, true);
+
+        triton::usize& slot = page->slots[addr & (SymbolicMemoryMap::pageSize - 1)];
+        triton::usize old   = slot;
+
+        if (old == triton::engines::symbolic::UNSET && symExprId != triton::engines::symbolic::UNSET) {
+          page->count++;
+          this->count++;
+        }
+        else if (old != triton::engines::symbolic::UNSET && symExprId == triton::engines::symbolic::UNSET) {
+          page->count--;
+          this->count--;
+        }
+
+        slot = symExprId;
+        page->offsets[addr & (SymbolicMemoryMap::pageSize - 1)] = static_cast<triton::uint8>(offset);
+
+        /* Release empty pages */
+        if (page->count == 0) {
+          this->pages.erase(addr >> SymbolicMemoryMap::pageBits);
+          this->cachedPage = nullptr;
+        }
+
+        return old;
+      }
+
+
+      const triton::usize* SymbolicMemoryMap::getSlots(triton::uint64 addr, triton::uint64& length) const {
+        triton::uint64 offset = (addr & (SymbolicMemoryMap::pageSize - 1));
+        const Page* page = this->findPage(addr);
+
+        length = SymbolicMemoryMap::pageSize - offset;
+        if (page == nullptr)
+          return nullptr;
+
+        return page->slots.data() + offset;
+      }
+
+
+      bool SymbolicMemoryMap::find(triton::usize symExprId, triton::uint64& addr) const {
+        for (auto it = this->pages.begin(); it != this->pages.end(); it++) {
+          const SlotVector& slots = it->second->slots;
+          for (triton::uint64 offset = 0; offset < SymbolicMemoryMap::pageSize; offset++) {
+            if (slots[offset] == symExprId) {
+              addr = (it->first << SymbolicMemoryMap::pageBits) | offset;
+              return true;
+            }
+          }
+        }
+        return false;
+      }
+
+
+      void SymbolicMemoryMap::clear(void) {
+        /* The pages are moved aside, not destroyed */
+        if (!this->pages.empty()) {
+          this->retired.push_back(std::map<triton::uint64, std::shared_ptr<Page>>());
+          this->retired.back().swap(this->pages);
+        }
+        this->count      = 0;
+        this->cachedPage = nullptr;
+      }
+
+
+      triton::usize SymbolicMemoryMap::size(void) const {
+        return this->count;
+      }
+
+
+      triton::usize SymbolicMemoryMap::getMemoryUsage(void) const {
+        triton::usize node  = triton::utils::getTreeNodeSize(sizeof(std::pair<const triton::uint64, std::shared_ptr<Page>>));
+        triton::usize count = this->pages.size();
+
+        for (auto it = this->retired.begin(); it != this->retired.end(); it++)
+          count += it->size();
+
+        return count * (node + sizeof(Page) + pageSize * (sizeof(triton::usize) + sizeof(triton::uint8)));
+      }
+
+
+      void SymbolicMemoryMap::getIds(std::vector<triton::usize>& ids) const {
+        for (auto it = this->pages.begin(); it != this->pages.end(); it++) {
+          const SlotVector& slots = it->second->slots;
+          for (triton::uint64 offset = 0; offset < SymbolicMemoryMap::pageSize; offset++) {
+            if (slots[offset] != triton::engines::symbolic::UNSET)
+              ids.push_back(slots[offset]);
+          }
+        }
+      }
+
+
+      void SymbolicMemoryMap::forEach(const std::function<void(triton::uint64, triton::usize)>& callback) const {
+        for (auto it = this->pages.begin(); it != this->pages.end(); it++) {
+          const SlotVector& slots = it->second->slots;
+          for (triton::uint64 offset = 0; offset < SymbolicMemoryMap::pageSize; offset++) {
+            if (slots[offset] != triton::engines::symbolic::UNSET)
+              callback((it->first << SymbolicMemoryMap::pageBits) | offset, slots[offset]);
+          }
+        }
+      }
+
+
+      void SymbolicMemoryMap::forEach(triton::uint64 start, triton::uint64 end, const std::function<void(triton::uint64, triton::usize)>& callback) const {
+        for (auto it = this->pages.lower_bound(start >> SymbolicMemoryMap::pageBits); it != this->pages.end(); it++) {
+          triton::uint64 base = (it->first << SymbolicMemoryMap::pageBits);
+          if (base >= end)
+            break;
+
+          /* Bounds of the range in the page, the last one excluded */
+          triton::uint64 first = (base < start ? start - base : 0);
+          triton::uint64 last  = (end - base < SymbolicMemoryMap::pageSize ? end - base : SymbolicMemoryMap::pageSize);
+
+          const SlotVector& slots = it->second->slots;
+          for (triton::uint64 offset = first; offset < last; offset++) {
+            if (slots[offset] != triton::engines::symbolic::UNSET)
+              callback(base | offset, slots[offset]);
+          }
+        }
+      }
+
+
+      std::map<triton::uint64, triton::usize> SymbolicMemoryMap::toMap(void) const {
+        std::map<triton::uint64, triton::usize> ret;
+
+        this->forEach([&ret](triton::uint64 addr, triton::usize id) {
+          ret.insert(ret.end(), std::make_pair(addr, id));
+        });
+
+        return ret;
+      }
+
+    }; /* symbolic namespace */
+  }; /* engines namespace */
+}; /*triton namespace */
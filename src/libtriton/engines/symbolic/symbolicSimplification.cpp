@@ -5,7 +5,12 @@
 **  This program is under the terms of the BSD License.
 */
 
+#include <set>
+
+#include <api.hpp>
+#include <astTraversal.hpp>
 #include <exceptions.hpp>
+#include <symbolicExpression.hpp>
 #include <symbolicSimplification.hpp>
 
 
@@ -107,6 +112,61 @@ if __name__ == "__main__":
     print 'Simp: ', c
 ~~~~~~~~~~~~~
 
+\subsection SMT_simplification_rules Built-in rewriting rules
+<hr>
+
+Triton also comes with a table of rewriting rules which are applied when a node is built if the `AST_REWRITING`
+mode is enabled. As children are built before their parents, a node is rewritten once its children are already
+rewritten and the ASTs stay small before they reach the solver or the representations. The rules are:
+
+- Constant folding of bitvector nodes whose children are constants (divisions by zero are kept).
+- \f$ A \oplus A \rightarrow 0 \f$, \f$ A - A \rightarrow 0 \f$, \f$ A \land A \rightarrow A \f$, \f$ A \lor A \rightarrow A \f$.
+- Neutral and absorbing constants: \f$ A + 0 \f$, \f$ A - 0 \f$, \f$ A \lor 0 \f$, \f$ A \oplus 0 \f$, \f$ A \times 1 \f$,
+  \f$ A / 1 \f$, shifts and rotations by 0, `bvand` with an all-ones mask, `bvand` with 0, `bvor` with an all-ones mask, \f$ A \times 0 \f$.
+- Double negations: `bvnot`, `bvneg` and `not`.
+- Extractions of the whole node, of an extraction, of a part of a concatenation and of the original bits of a `zx` or `sx`.
+- `zx` and `sx` by 0 and nested extensions.
+- `ite` whose branches are the same node.
+- Nodes whose bits are all known whatever the values of the variables (see the known bits and the interval of
+  the nodes), `bvand` with a mask which keeps every bit which may be 1, `bvor` with bits which are already known
+  and `zx` of the lowest bits of a node whose other bits are known to be 0.
+
+~~~~~~~~~~~~~{.py}
+>>> enableMode(MODE.AST_REWRITING, True)
+>>> a = variable(newSymbolicVariable(8))
+>>> print extract(7, 0, zx(24, (a ^ a) ^ a))
+SymVar_0
+~~~~~~~~~~~~~
+
+\subsection SMT_simplification_mba Simplification of linear MBA expressions
+<hr>
+
+If the `MBA_SIMPLIFICATION` mode is enabled, the linear mixed boolean-arithmetic (MBA) expressions are simplified before
+the Z3 simplification and the callbacks. A linear MBA expression is a sum of bitwise expressions multiplied by constants,
+whose atoms are the subterms which are neither arithmetic (`bvadd`, `bvsub`, `bvneg` and `bvmul` or `bvshl` by a constant)
+nor bitwise. Such an expression is defined by its values when each atom is 0 or 1 (its signature vector), from which the
+smallest sum of conjunctions of atoms, or the smallest single bitwise expression multiplied by a constant plus a constant,
+is built. Expressions of more than 64 bits or 6 atoms are left as they are.
+
+~~~~~~~~~~~~~{.py}
+>>> enableMode(MODE.MBA_SIMPLIFICATION, True)
+>>> x = variable(newSymbolicVariable(64))
+>>> y = variable(newSymbolicVariable(64))
+>>> print simplify((x ^ y) + bv(2, 64) * (x & y))
+(bvadd SymVar_0 SymVar_1)
+>>> print simplify((x | y) - (x & y) - (x ^ y))
+(_ bv0 64)
+~~~~~~~~~~~~~
+
+\subsection SMT_simplification_cache Cache of simplifications
+<hr>
+
+The results of the simplification callbacks, and of the MBA and Z3 simplifications, are cached by structure of the
+original node. A node which has the same structure as a node already simplified (same kinds, sizes, values,
+variables and references) is not simplified again, so recurring patterns are simplified once. Callbacks must
+therefore only depend on the node they are given. The cache is flushed when callbacks are added or removed,
+when a symbolic expression is assigned to another AST and when AST nodes are freed.
+
 \subsection SMT_simplification_z3 Simplification via Z3
 <hr>
 
@@ -159,9 +219,431 @@ namespace triton {
   namespace engines {
     namespace symbolic {
 
+      /* Kinds of the bitvector nodes which are computed from their children */
+      static const enum triton::ast::kind_e foldableKinds[] = {
+        triton::ast::BVADD_NODE,  triton::ast::BVAND_NODE,  triton::ast::BVASHR_NODE, triton::ast::BVLSHR_NODE,
+        triton::ast::BVMUL_NODE,  triton::ast::BVNAND_NODE, triton::ast::BVNEG_NODE,  triton::ast::BVNOR_NODE,
+        triton::ast::BVNOT_NODE,  triton::ast::BVOR_NODE,   triton::ast::BVROL_NODE,  triton::ast::BVROR_NODE,
+        triton::ast::BVSDIV_NODE, triton::ast::BVSHL_NODE,  triton::ast::BVSMOD_NODE, triton::ast::BVSREM_NODE,
+        triton::ast::BVSUB_NODE,  triton::ast::BVUDIV_NODE, triton::ast::BVUREM_NODE, triton::ast::BVXNOR_NODE,
+        triton::ast::BVXOR_NODE,  triton::ast::CONCAT_NODE, triton::ast::EXTRACT_NODE, triton::ast::SX_NODE,
+        triton::ast::VADD_NODE,   triton::ast::VEQ_NODE,    triton::ast::ZX_NODE,
+      };
+
+
+      /* Returns true if the node is a bitvector computed from its children */
+      static bool isFoldable(triton::ast::AbstractNode* node) {
+        if (node->getKind() == triton::ast::ITE_NODE)
+          return true;
+
+        for (auto kind : foldableKinds) {
+          if (node->getKind() == kind)
+            return true;
+        }
+
+        return false;
+      }
+
+
+      /* FNV-1a parameters on 128 bits */
+      static const triton::uint128 hashOffset = (triton::uint128(0x6c62272e07bb0142ULL) << 64) | triton::uint128(0x62b821756295c58dULL);
+      static const triton::uint128 hashPrime  = (triton::uint128(0x0000000001000000ULL) << 64) | triton::uint128(0x000000000000013bULL);
+
+
+      static inline triton::uint128 hashMix(const triton::uint128& h, const triton::uint128& value) {
+        return (h ^ value) * hashPrime;
+      }
+
+
+      /* Returns true if both ASTs have the same structure. References are compared by id. */
+      static bool isSameAst(triton::ast::AbstractNode* node1, triton::ast::AbstractNode* node2) {
+        std::set<std::pair<triton::ast::AbstractNode*, triton::ast::AbstractNode*>> visited;
+        std::vector<std::pair<triton::ast::AbstractNode*, triton::ast::AbstractNode*>> worklist;
+
+        worklist.push_back(std::make_pair(node1, node2));
+        while (!worklist.empty()) {
+          triton::ast::AbstractNode* a = worklist.back().first;
+          triton::ast::AbstractNode* b = worklist.back().second;
+          worklist.pop_back();
+
+          if (a == b || !visited.insert(std::make_pair(a, b)).second)
+            continue;
+
+          if (a->getKind() != b->getKind() || a->getBitvectorSize() != b->getBitvectorSize() || a->getChilds().size() != b->getChilds().size())
+            return false;
+
+          switch (a->getKind()) {
+            case triton::ast::DECIMAL_NODE:
+              if (reinterpret_cast<triton::ast::DecimalNode*>(a)->getValue() != reinterpret_cast<triton::ast::DecimalNode*>(b)->getValue())
+                return false;
+              break;
+
+            case triton::ast::REFERENCE_NODE:
+              if (reinterpret_cast<triton::ast::ReferenceNode*>(a)->getValue() != reinterpret_cast<triton::ast::ReferenceNode*>(b)->getValue())
+                return false;
+              break;
+
+            case triton::ast::STRING_NODE:
+              if (reinterpret_cast<triton::ast::StringNode*>(a)->getValue() != reinterpret_cast<triton::ast::StringNode*>(b)->getValue())
+                return false;
+              break;
+
+            case triton::ast::VARIABLE_NODE:
+              if (reinterpret_cast<triton::ast::VariableNode*>(a)->getVariableId() != reinterpret_cast<triton::ast::VariableNode*>(b)->getVariableId())
+                return false;
+              break;
+
+            default:
+              break;
+          }
+
+          for (triton::uint32 index = 0; index < a->getChilds().size(); index++)
+            worklist.push_back(std::make_pair(a->getChilds()[index], b->getChilds()[index]));
+        }
+
+        return true;
+      }
+
+
+      /* Returns the mask of a bitvector */
+      static triton::uint512 rewritingMask(triton::uint32 size) {
+        return (triton::uint512(1) << size) - 1;
+      }
+
+
+      /* Returns the value of a decimal node */
+      static triton::uint512 decimalValue(triton::ast::AbstractNode* node) {
+        if (node->getKind() != triton::ast::DECIMAL_NODE)
+          throw triton::exceptions::SymbolicSimplification("SymbolicSimplification::decimalValue(): The node must be a decimal.");
+        return reinterpret_cast<triton::ast::DecimalNode*>(node)->getValue();
+      }
+
+
+      static bool isConstant(triton::ast::AbstractNode* node) {
+        return node->getKind() == triton::ast::BV_NODE;
+      }
+
+
+      static bool isZero(triton::ast::AbstractNode* node) {
+        return isConstant(node) && node->evaluate() == 0;
+      }
+
+
+      static bool isOne(triton::ast::AbstractNode* node) {
+        return isConstant(node) && node->evaluate() == 1;
+      }
+
+
+      static bool isAllOnes(triton::ast::AbstractNode* node) {
+        return isConstant(node) && node->evaluate() == rewritingMask(node->getBitvectorSize());
+      }
+
+
+      /* Returns true if both nodes are the same, structurally up to a depth */
+      static bool isSameNode(triton::ast::AbstractNode* node1, triton::ast::AbstractNode* node2, triton::uint32 depth=4) {
+        if (node1 == node2)
+          return true;
+
+        if (node1->getKind() != node2->getKind() || node1->getBitvectorSize() != node2->getBitvectorSize())
+          return false;
+
+        switch (node1->getKind()) {
+          case triton::ast::DECIMAL_NODE:
+            return decimalValue(node1) == decimalValue(node2);
+
+          case triton::ast::REFERENCE_NODE:
+            return reinterpret_cast<triton::ast::ReferenceNode*>(node1)->getValue() == reinterpret_cast<triton::ast::ReferenceNode*>(node2)->getValue();
+
+          case triton::ast::VARIABLE_NODE:
+            return reinterpret_cast<triton::ast::VariableNode*>(node1)->getVariableId() == reinterpret_cast<triton::ast::VariableNode*>(node2)->getVariableId();
+
+          case triton::ast::STRING_NODE:
+            return reinterpret_cast<triton::ast::StringNode*>(node1)->getValue() == reinterpret_cast<triton::ast::StringNode*>(node2)->getValue();
+
+          default:
+            break;
+        }
+
+        if (depth == 0 || node1->getChilds().size() != node2->getChilds().size() || node1->getChilds().empty())
+          return false;
+
+        for (triton::uint32 index = 0; index < node1->getChilds().size(); index++) {
+          if (!isSameNode(node1->getChilds()[index], node2->getChilds()[index], depth-1))
+            return false;
+        }
+
+        return true;
+      }
+
+
+      /* Rule: (op c1 c2 ...) -> (_ bvx size) if every child is a constant */
+      static triton::ast::AbstractNode* foldConstants(triton::ast::AbstractNode* node) {
+        std::vector<triton::ast::AbstractNode*>& childs = node->getChilds();
+
+        for (auto it = childs.begin(); it != childs.end(); it++) {
+          if (!isConstant(*it) && (*it)->getKind() != triton::ast::DECIMAL_NODE)
+            return nullptr;
+        }
+
+        /* The semantics of a division by zero are left to the solver */
+        switch (node->getKind()) {
+          case triton::ast::BVSDIV_NODE:
+          case triton::ast::BVSMOD_NODE:
+          case triton::ast::BVSREM_NODE:
+          case triton::ast::BVUDIV_NODE:
+          case triton::ast::BVUREM_NODE:
+            if (isZero(childs[1]))
+              return nullptr;
+            break;
+          default:
+            break;
+        }
+
+        return triton::ast::bv(node->evaluate(), node->getBitvectorSize());
+      }
+
+
+      /* Rule: (op A A) -> A or 0 */
+      static triton::ast::AbstractNode* sameOperands(triton::ast::AbstractNode* node) {
+        std::vector<triton::ast::AbstractNode*>& childs = node->getChilds();
+
+        if (!isSameNode(childs[0], childs[1]))
+          return nullptr;
+
+        switch (node->getKind()) {
+          case triton::ast::BVAND_NODE:
+          case triton::ast::BVOR_NODE:
+            return childs[0];
+          case triton::ast::BVSUB_NODE:
+          case triton::ast::BVXOR_NODE:
+            return triton::ast::bv(0, node->getBitvectorSize());
+          case triton::ast::BVXNOR_NODE:
+            return triton::ast::bv(rewritingMask(node->getBitvectorSize()), node->getBitvectorSize());
+          default:
+            return nullptr;
+        }
+      }
+
+
+      /* Rule: neutral and absorbing constants */
+      static triton::ast::AbstractNode* neutralOperands(triton::ast::AbstractNode* node) {
+        std::vector<triton::ast::AbstractNode*>& childs = node->getChilds();
+        triton::ast::AbstractNode* a = childs[0];
+        triton::ast::AbstractNode* b = childs[1];
+
+        switch (node->getKind()) {
+          case triton::ast::BVADD_NODE:
+          case triton::ast::BVXOR_NODE:
+            if (isZero(a)) return b;
+            if (isZero(b)) return a;
+            break;
+
+          case triton::ast::BVOR_NODE:
+            if (isZero(a)) return b;
+            if (isZero(b)) return a;
+            if (isAllOnes(a)) return a;
+            if (isAllOnes(b)) return b;
+            break;
+
+          case triton::ast::BVAND_NODE:
+            if (isAllOnes(a)) return b;
+            if (isAllOnes(b)) return a;
+            if (isZero(a)) return a;
+            if (isZero(b)) return b;
+            break;
+
+          case triton::ast::BVMUL_NODE:
+            if (isOne(a)) return b;
+            if (isOne(b)) return a;
+            if (isZero(a)) return a;
+            if (isZero(b)) return b;
+            break;
+
+          case triton::ast::BVSUB_NODE:
+          case triton::ast::BVSHL_NODE:
+          case triton::ast::BVLSHR_NODE:
+          case triton::ast::BVASHR_NODE:
+            if (isZero(b)) return a;
+            break;
+
+          case triton::ast::BVSDIV_NODE:
+          case triton::ast::BVUDIV_NODE:
+            if (isOne(b)) return a;
+            break;
+
+          default:
+            break;
+        }
+
+        return nullptr;
+      }
+
+
+      /* Rule: ((_ rotate_x 0) A) -> A */
+      static triton::ast::AbstractNode* nullRotation(triton::ast::AbstractNode* node) {
+        std::vector<triton::ast::AbstractNode*>& childs = node->getChilds();
+
+        if (childs[0]->getKind() == triton::ast::DECIMAL_NODE && (decimalValue(childs[0]) % childs[1]->getBitvectorSize()) == 0)
+          return childs[1];
+
+        return nullptr;
+      }
+
+
+      /* Rule: (op (op A)) -> A */
+      static triton::ast::AbstractNode* doubleNegation(triton::ast::AbstractNode* node) {
+        triton::ast::AbstractNode* child = node->getChilds()[0];
+
+        if (child->getKind() == node->getKind())
+          return child->getChilds()[0];
+
+        return nullptr;
+      }
+
+
+      /* Rule: ((_ extract h l) A) -> A or a narrower extraction */
+      static triton::ast::AbstractNode* extractElimination(triton::ast::AbstractNode* node) {
+        std::vector<triton::ast::AbstractNode*>& childs = node->getChilds();
+        triton::uint32 high                             = decimalValue(childs[0]).convert_to<triton::uint32>();
+        triton::uint32 low                              = decimalValue(childs[1]).convert_to<triton::uint32>();
+        triton::ast::AbstractNode* expr                 = childs[2];
+
+        /* The whole node */
+        if (low == 0 && high + 1 == expr->getBitvectorSize())
+          return expr;
+
+        switch (expr->getKind()) {
+          /* ((_ extract h l) ((_ extract h' l') A)) -> ((_ extract h+l' l+l') A) */
+          case triton::ast::EXTRACT_NODE: {
+            triton::uint32 inner = decimalValue(expr->getChilds()[1]).convert_to<triton::uint32>();
+            return triton::ast::extract(high + inner, low + inner, expr->getChilds()[2]);
+          }
+
+          /* The extraction of a single part of a concatenation */
+          case triton::ast::CONCAT_NODE: {
+            std::vector<triton::ast::AbstractNode*>& parts = expr->getChilds();
+            triton::uint32 partLow = expr->getBitvectorSize();
+            for (auto it = parts.begin(); it != parts.end(); it++) {
+              partLow -= (*it)->getBitvectorSize();
+              if (low >= partLow && high < partLow + (*it)->getBitvectorSize())
+                return triton::ast::extract(high - partLow, low - partLow, *it);
+            }
+            break;
+          }
+
+          /* The original bits of an extension */
+          case triton::ast::SX_NODE:
+          case triton::ast::ZX_NODE: {
+            triton::ast::AbstractNode* inner = expr->getChilds()[1];
+            if (high < inner->getBitvectorSize())
+              return triton::ast::extract(high, low, inner);
+            if (expr->getKind() == triton::ast::ZX_NODE && low >= inner->getBitvectorSize())
+              return triton::ast::bv(0, high - low + 1);
+            break;
+          }
+
+          default:
+            break;
+        }
+
+        return nullptr;
+      }
+
+
+      /* Rule: ((_ zero_extend 0) A) -> A and nested extensions */
+      static triton::ast::AbstractNode* extendElimination(triton::ast::AbstractNode* node) {
+        std::vector<triton::ast::AbstractNode*>& childs = node->getChilds();
+        triton::uint32 sizeExt                          = decimalValue(childs[0]).convert_to<triton::uint32>();
+        triton::ast::AbstractNode* expr                 = childs[1];
+
+        if (sizeExt == 0)
+          return expr;
+
+        if (expr->getKind() == triton::ast::ZX_NODE) {
+          triton::uint32 inner = decimalValue(expr->getChilds()[0]).convert_to<triton::uint32>();
+          /* (zx a (zx b A)) -> (zx a+b A) and (sx a (zx b A)) -> (zx a+b A) if b > 0 */
+          if (node->getKind() == triton::ast::ZX_NODE || inner > 0)
+            return triton::ast::zx(sizeExt + inner, expr->getChilds()[1]);
+        }
+
+        /* (sx a (sx b A)) -> (sx a+b A) */
+        if (expr->getKind() == triton::ast::SX_NODE && node->getKind() == triton::ast::SX_NODE) {
+          triton::uint32 inner = decimalValue(expr->getChilds()[0]).convert_to<triton::uint32>();
+          return triton::ast::sx(sizeExt + inner, expr->getChilds()[1]);
+        }
+
+        return nullptr;
+      }
+
+
+      /* Rule: A -> (_ bvx size) if every bit of A is known whatever the values of the variables */
+      static triton::ast::AbstractNode* knownBits(triton::ast::AbstractNode* node) {
+        if (node->isSymbolized() && node->isKnown())
+          return triton::ast::bv(node->getKnownOnes(), node->getBitvectorSize());
+        return nullptr;
+      }
+
+
+      /* Rule: (bvand A c) -> A if c keeps every bit of A which may be 1, (bvor A c) -> A if the bits of c are known in A */
+      static triton::ast::AbstractNode* knownMask(triton::ast::AbstractNode* node) {
+        std::vector<triton::ast::AbstractNode*>& childs = node->getChilds();
+
+        for (triton::uint32 index = 0; index < 2; index++) {
+          triton::ast::AbstractNode* a = childs[1 - index];
+          triton::ast::AbstractNode* c = childs[index];
+
+          if (!isConstant(c) || c->getBitvectorSize() > 64)
+            continue;
+
+          if (node->getKind() == triton::ast::BVAND_NODE && (~a->getKnownZeros() & ~c->evaluate64() & a->getBitvectorMask64()) == 0)
+            return a;
+
+          if (node->getKind() == triton::ast::BVOR_NODE && (c->evaluate64() & ~a->getKnownOnes()) == 0)
+            return a;
+        }
+
+        return nullptr;
+      }
+
+
+      /* Rule: ((_ zero_extend e) ((_ extract h 0) A)) -> A if the bits of A above h are known to be 0 */
+      static triton::ast::AbstractNode* knownExtension(triton::ast::AbstractNode* node) {
+        std::vector<triton::ast::AbstractNode*>& childs = node->getChilds();
+        triton::ast::AbstractNode* expr                 = childs[1];
+
+        if (expr->getKind() != triton::ast::EXTRACT_NODE || decimalValue(expr->getChilds()[1]) != 0)
+          return nullptr;
+
+        triton::ast::AbstractNode* inner = expr->getChilds()[2];
+        if (inner->getBitvectorSize() != node->getBitvectorSize() || inner->getBitvectorSize() > 64)
+          return nullptr;
+
+        triton::uint64 high = inner->getBitvectorMask64() & ~expr->getBitvectorMask64();
+        if ((inner->getKnownZeros() & high) == high)
+          return inner;
+
+        return nullptr;
+      }
+
+
+      /* Rule: (ite C A A) -> A */
+      static triton::ast::AbstractNode* sameBranches(triton::ast::AbstractNode* node) {
+        std::vector<triton::ast::AbstractNode*>& childs = node->getChilds();
+
+        if (isSameNode(childs[1], childs[2]))
+          return childs[1];
+
+        return nullptr;
+      }
+
+
 
       SymbolicSimplification::SymbolicSimplification(triton::callbacks::Callbacks* callbacks) {
-        this->callbacks = callbacks;
+        this->callbacks               = callbacks;
+        this->numberOfSimplifications = 0;
+        this->callbacksRevision       = 0;
+        this->expressionsRevision     = 0;
+        this->initRewritingRules();
       }
 
 
@@ -174,18 +656,214 @@ namespace triton {
       }
 
 
+      /* Cached simplifications hold their nodes, they are not shared with the copy */
       void SymbolicSimplification::copy(const SymbolicSimplification& other) {
-        this->callbacks = other.callbacks;
+        this->callbacks               = other.callbacks;
+        this->rules                   = other.rules;
+        this->numberOfSimplifications = 0;
+        this->callbacksRevision       = 0;
+        this->expressionsRevision     = 0;
+        this->simplifications.clear();
+      }
+
+
+      void SymbolicSimplification::initRewritingRules(void) {
+        /* Constant folding comes first */
+        for (auto kind : foldableKinds)
+          this->rules[kind].push_back(foldConstants);
+
+        this->rules[triton::ast::BVAND_NODE].push_back(sameOperands);
+        this->rules[triton::ast::BVOR_NODE].push_back(sameOperands);
+        this->rules[triton::ast::BVSUB_NODE].push_back(sameOperands);
+        this->rules[triton::ast::BVXNOR_NODE].push_back(sameOperands);
+        this->rules[triton::ast::BVXOR_NODE].push_back(sameOperands);
+
+        this->rules[triton::ast::BVADD_NODE].push_back(neutralOperands);
+        this->rules[triton::ast::BVAND_NODE].push_back(neutralOperands);
+        this->rules[triton::ast::BVASHR_NODE].push_back(neutralOperands);
+        this->rules[triton::ast::BVLSHR_NODE].push_back(neutralOperands);
+        this->rules[triton::ast::BVMUL_NODE].push_back(neutralOperands);
+        this->rules[triton::ast::BVOR_NODE].push_back(neutralOperands);
+        this->rules[triton::ast::BVSDIV_NODE].push_back(neutralOperands);
+        this->rules[triton::ast::BVSHL_NODE].push_back(neutralOperands);
+        this->rules[triton::ast::BVSUB_NODE].push_back(neutralOperands);
+        this->rules[triton::ast::BVUDIV_NODE].push_back(neutralOperands);
+        this->rules[triton::ast::BVXOR_NODE].push_back(neutralOperands);
+
+        this->rules[triton::ast::BVROL_NODE].push_back(nullRotation);
+        this->rules[triton::ast::BVROR_NODE].push_back(nullRotation);
+
+        this->rules[triton::ast::BVNEG_NODE].push_back(doubleNegation);
+        this->rules[triton::ast::BVNOT_NODE].push_back(doubleNegation);
+        this->rules[triton::ast::LNOT_NODE].push_back(doubleNegation);
+
+        this->rules[triton::ast::EXTRACT_NODE].push_back(extractElimination);
+        this->rules[triton::ast::SX_NODE].push_back(extendElimination);
+        this->rules[triton::ast::ZX_NODE].push_back(extendElimination);
+        this->rules[triton::ast::ITE_NODE].push_back(sameBranches);
+
+        /* The abstract values of the nodes (see triton::ast::AbstractNode::getKnownZeros()) */
+        this->rules[triton::ast::BVAND_NODE].push_back(knownMask);
+        this->rules[triton::ast::BVOR_NODE].push_back(knownMask);
+        this->rules[triton::ast::ZX_NODE].push_back(knownExtension);
+        for (auto kind : foldableKinds)
+          this->rules[kind].push_back(knownBits);
+        this->rules[triton::ast::ITE_NODE].push_back(knownBits);
       }
 
 
-      triton::ast::AbstractNode* SymbolicSimplification::processSimplification(triton::ast::AbstractNode* node) const {
+      triton::ast::AbstractNode* SymbolicSimplification::processSimplification(triton::ast::AbstractNode* node, bool z3, bool mba) const {
         if (node == nullptr)
           throw triton::exceptions::SymbolicSimplification("SymbolicSimplification::processSimplification(): node cannot be null.");
 
+        /* Nothing to simplify */
+        if (!z3 && !mba && (this->callbacks == nullptr || !this->callbacks->isSymbolicSimplificationDefined()))
+          return node;
+
+        /* Cached simplifications are outdated if callbacks or symbolic expressions have changed */
+        if ((this->callbacks && this->callbacks->getRevision() != this->callbacksRevision) || SymbolicExpression::getRevision() != this->expressionsRevision) {
+          this->clearSimplifications();
+          this->callbacksRevision   = this->callbacks ? this->callbacks->getRevision() : 0;
+          this->expressionsRevision = SymbolicExpression::getRevision();
+        }
+
+        triton::uint128 key = hashMix(this->hashNode(node), z3 | (mba << 1));
+        auto& bucket = this->simplifications[key];
+        for (auto it = bucket.begin(); it != bucket.end(); it++) {
+          if (isSameAst(it->first, node))
+            return it->second;
+        }
+
+        triton::ast::AbstractNode* simplified = node;
+
+        if (mba)
+          simplified = this->mba.simplify(simplified);
+
+        if (z3)
+          simplified = triton::getCurrentApi().processZ3Simplification(simplified);
+
         /* process recorded callback about symbolic simplifications */
         if (this->callbacks)
-          node = this->callbacks->processCallbacks(triton::callbacks::SYMBOLIC_SIMPLIFICATION, node);
+          simplified = this->callbacks->processCallbacks(triton::callbacks::SYMBOLIC_SIMPLIFICATION, simplified);
+
+        if (this->numberOfSimplifications >= SymbolicSimplification::maxSimplifications)
+          this->clearSimplifications();
+
+        /* The cache holds both nodes */
+        node->incReference();
+        simplified->incReference();
+        this->simplifications[key].push_back(std::make_pair(node, simplified));
+        this->numberOfSimplifications++;
+
+        return simplified;
+      }
+
+
+      void SymbolicSimplification::clearSimplifications(void) const {
+        for (auto bucket = this->simplifications.begin(); bucket != this->simplifications.end(); bucket++) {
+          for (auto it = bucket->second.begin(); it != bucket->second.end(); it++) {
+            it->first->decReference();
+            it->second->decReference();
+          }
+        }
+        this->simplifications.clear();
+        this->numberOfSimplifications = 0;
+      }
+
+
+      triton::uint128 SymbolicSimplification::hashNode(triton::ast::AbstractNode* node) const {
+        std::map<triton::ast::AbstractNode*, triton::uint128> hashes;
+        std::vector<triton::ast::AbstractNode*> nodes;
+
+        /* Children come before their parents */
+        triton::ast::nodesExtraction(nodes, node, false, true);
+
+        for (auto it = nodes.begin(); it != nodes.end(); it++) {
+          triton::ast::AbstractNode* current = *it;
+          triton::uint128 h = hashMix(hashMix(hashOffset, current->getKind()), current->getBitvectorSize());
+
+          switch (current->getKind()) {
+            case triton::ast::DECIMAL_NODE: {
+              triton::uint512 value = reinterpret_cast<triton::ast::DecimalNode*>(current)->getValue();
+              for (triton::uint32 index = 0; index < 4; index++) {
+                h = hashMix(h, (value & ((triton::uint512(1) << 128) - 1)).convert_to<triton::uint128>());
+                value >>= 128;
+              }
+              break;
+            }
+
+            case triton::ast::REFERENCE_NODE:
+              h = hashMix(h, reinterpret_cast<triton::ast::ReferenceNode*>(current)->getValue());
+              break;
+
+            case triton::ast::STRING_NODE: {
+              std::string value = reinterpret_cast<triton::ast::StringNode*>(current)->getValue();
+              for (auto c = value.begin(); c != value.end(); c++)
+                h = hashMix(h, static_cast<triton::uint8>(*c));
+              break;
+            }
+
+            case triton::ast::VARIABLE_NODE:
+              h = hashMix(h, reinterpret_cast<triton::ast::VariableNode*>(current)->getVariableId());
+              break;
+
+            default:
+              break;
+          }
+
+          for (auto child = current->getChilds().begin(); child != current->getChilds().end(); child++)
+            h = hashMix(h, hashes[*child]);
+
+          hashes[current] = h;
+        }
+
+        return hashes[node];
+      }
+
+
+      triton::ast::AbstractNode* SymbolicSimplification::rewriteNode(triton::ast::AbstractNode* node) const {
+        if (node == nullptr)
+          throw triton::exceptions::SymbolicSimplification("SymbolicSimplification::rewriteNode(): node cannot be null.");
+
+        /* Every rule makes the node smaller, the rules of the new node are applied until none applies */
+        auto rules = this->rules.find(node->getKind());
+        while (rules != this->rules.end()) {
+          triton::ast::AbstractNode* rewritten = nullptr;
+
+          for (auto rule = rules->second.begin(); rule != rules->second.end() && rewritten == nullptr; rule++)
+            rewritten = (*rule)(node);
+
+          if (rewritten == nullptr || rewritten == node)
+            break;
+
+          node  = rewritten;
+          rules = this->rules.find(node->getKind());
+        }
+
+        return node;
+      }
+
+
+      triton::ast::AbstractNode* SymbolicSimplification::foldConcreteNode(triton::ast::AbstractNode* node) const {
+        triton::ast::AbstractNode* target = node;
+
+        if (node == nullptr)
+          throw triton::exceptions::SymbolicSimplification("SymbolicSimplification::foldConcreteNode(): node cannot be null.");
+
+        if (node->isSymbolized())
+          return node;
+
+        /* A reference is folded if it points to a bitvector */
+        while (target != nullptr && target->getKind() == triton::ast::REFERENCE_NODE) {
+          triton::engines::symbolic::SymbolicExpression* expr = reinterpret_cast<triton::ast::ReferenceNode*>(target)->getSymbolicExpression();
+          target = (expr != nullptr ? expr->getAst() : nullptr);
+        }
+
+        if (target == nullptr)
+          return node;
+
+        if (isFoldable(target) || (target != node && target->getKind() == triton::ast::BV_NODE))
+          return triton::ast::bv(node->evaluate(), node->getBitvectorSize());
 
         return node;
       }
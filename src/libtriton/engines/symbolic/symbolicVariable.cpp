@@ -26,7 +26,6 @@ namespace triton {
         this->id              = id;
         this->kind            = kind;
         this->kindValue       = kindValue;
-        this->name            = TRITON_SYMVAR_NAME + std::to_string(id);
         this->size            = size;
         this->concreteValue   = concreteValue;
 
@@ -41,7 +40,6 @@ namespace triton {
         this->id              = copy.id;
         this->kind            = copy.kind;
         this->kindValue       = copy.kindValue;
-        this->name            = copy.name;
         this->size            = copy.size;
       }
 
@@ -56,6 +54,10 @@ namespace triton {
 
 
       const std::string& SymbolicVariable::getName(void) const {
+        /* The name is given by the id, it may be asked by the threads of the solver */
+        std::call_once(this->nameBuilt, [this]() {
+          this->name = TRITON_SYMVAR_NAME + std::to_string(this->id);
+        });
         return this->name;
       }
 
@@ -91,7 +93,7 @@ namespace triton {
 
 
       void SymbolicVariable::setConcreteValue(triton::uint512 value) {
-        triton::ast::AbstractNode* node = triton::api.getAstVariableNode(this->getName());
+        triton::ast::AbstractNode* node = triton::getCurrentApi().getAstVariableNode(this->getId());
 
         this->concreteValue = value;
         if (node)
@@ -5,6 +5,9 @@
 **  This program is under the terms of the BSD License.
 */
 
+#include <algorithm>
+
+#include <coreUtils.hpp>
 #include <exceptions.hpp>
 #include <taintEngine.hpp>
 
@@ -95,6 +98,7 @@ namespace triton {
 
         this->symbolicEngine = symbolicEngine;
         this->enableFlag     = true;
+        this->labelsUsed     = false;
       }
 
 
@@ -103,6 +107,10 @@ namespace triton {
         this->symbolicEngine   = other.symbolicEngine;
         this->taintedMemory    = other.taintedMemory;
         this->taintedRegisters = other.taintedRegisters;
+        this->labels           = other.labels;
+        this->memoryLabels     = other.memoryLabels;
+        this->registerLabels   = other.registerLabels;
+        this->labelsUsed       = other.labelsUsed;
       }
 
 
@@ -131,26 +139,55 @@ namespace triton {
 
 
       /* Returns the tainted addresses */
-      const std::set<triton::uint64>& TaintEngine::getTaintedMemory(void) const {
-        return this->taintedMemory;
+      std::set<triton::uint64> TaintEngine::getTaintedMemory(void) const {
+        return this->taintedMemory.toSet();
+      }
+
+
+      void TaintEngine::forEachTaintedMemoryRange(const std::function<void(triton::uint64, triton::usize)>& callback) const {
+        this->taintedMemory.forEachRange(callback);
       }
 
 
       /* Returns the tainted registers */
-      const std::set<triton::arch::Register>& TaintEngine::getTaintedRegisters(void) const {
-        return this->taintedRegisters;
+      std::set<triton::arch::Register> TaintEngine::getTaintedRegisters(void) const {
+        std::set<triton::arch::Register> ret;
+
+        for (triton::uint32 regId = 0; regId < this->taintedRegisters.size(); regId++) {
+          if (this->taintedRegisters[regId])
+            ret.insert(triton::arch::Register(regId));
+        }
+
+        return ret;
+      }
+
+
+      /* Returns the number of tainted bytes */
+      triton::usize TaintEngine::getNumberOfTaintedBytes(void) const {
+        return this->taintedMemory.size();
+      }
+
+
+      /* Returns the number of tainted registers */
+      triton::usize TaintEngine::getNumberOfTaintedRegisters(void) const {
+        return std::count(this->taintedRegisters.begin(), this->taintedRegisters.end(), true);
+      }
+
+
+      /* Returns the estimated number of bytes used by the taint engine */
+      triton::usize TaintEngine::getMemoryUsage(void) const {
+        return this->taintedMemory.getMemoryUsage() +
+               this->taintedRegisters.capacity() / 8 +
+               this->labels.getMemoryUsage() +
+               this->memoryLabels.size() * triton::utils::getHashNodeSize(sizeof(std::pair<const triton::uint64, triton::uint32>)) +
+               this->registerLabels.capacity() * sizeof(triton::uint32);
       }
 
 
       /* Returns true of false if the memory address is currently tainted */
       bool TaintEngine::isMemoryTainted(const triton::arch::MemoryAccess& mem) const {
-        triton::uint64 addr = mem.getAddress();
-        triton::uint32 size = mem.getSize();
-
-        for (triton::uint32 index = 0; index < size; index++) {
-          if (this->taintedMemory.find(addr+index) != this->taintedMemory.end())
-            return TAINTED;
-        }
+        if (this->taintedMemory.isTainted(mem.getAddress(), mem.getSize()))
+          return TAINTED;
 
         return !TAINTED;
       }
@@ -158,10 +195,8 @@ namespace triton {
 
       /* Returns true of false if the address is currently tainted */
       bool TaintEngine::isMemoryTainted(triton::uint64 addr, triton::uint32 size) const {
-        for (triton::uint32 index = 0; index < size; index++) {
-          if (this->taintedMemory.find(addr+index) != this->taintedMemory.end())
-            return TAINTED;
-        }
+        if (this->taintedMemory.isTainted(addr, size))
+          return TAINTED;
 
         return !TAINTED;
       }
@@ -169,9 +204,9 @@ namespace triton {
 
       /* Returns true of false if the register is currently tainted */
       bool TaintEngine::isRegisterTainted(const triton::arch::Register& reg) const {
-        triton::arch::Register parent = reg.getParent();
+        triton::uint32 parent = reg.getParentId();
 
-        if (this->taintedRegisters.find(parent) != this->taintedRegisters.end())
+        if (parent < this->taintedRegisters.size() && this->taintedRegisters[parent])
           return TAINTED;
 
         return !TAINTED;
@@ -192,11 +227,12 @@ namespace triton {
 
       /* Taint the register */
       bool TaintEngine::taintRegister(const triton::arch::Register& reg) {
-        triton::arch::Register parent = reg.getParent();
+        triton::uint32 parent = reg.getParentId();
 
         if (!this->isEnabled())
-          return this->isRegisterTainted(parent);
-        this->taintedRegisters.insert(parent);
+          return this->isRegisterTainted(reg);
+
+        this->setRegisterTaint(parent, TAINTED);
 
         return TAINTED;
       }
@@ -204,16 +240,273 @@ namespace triton {
 
       /* Untaint the register */
       bool TaintEngine::untaintRegister(const triton::arch::Register& reg) {
-        triton::arch::Register parent = reg.getParent();
+        triton::uint32 parent = reg.getParentId();
 
         if (!this->isEnabled())
-          return this->isRegisterTainted(parent);
-        this->taintedRegisters.erase(parent);
+          return this->isRegisterTainted(reg);
+
+        this->setRegisterTaint(parent, !TAINTED);
+
+        if (this->labelsUsed)
+          this->setRegisterLabelSet(reg, NO_LABEL);
 
         return !TAINTED;
       }
 
 
+      /* Returns the set of labels of a memory area */
+      triton::uint32 TaintEngine::getMemoryLabelSet(triton::uint64 addr, triton::usize size) const {
+        triton::uint32 set = NO_LABEL;
+
+        for (triton::usize index = 0; index < size; index++) {
+          auto it = this->memoryLabels.find(addr + index);
+          if (it != this->memoryLabels.end())
+            set = this->labels.merge(set, it->second);
+        }
+
+        return set;
+      }
+
+
+      /* Sets the set of labels of a memory area */
+      void TaintEngine::setMemoryLabelSet(triton::uint64 addr, triton::usize size, triton::uint32 set) {
+        for (triton::usize index = 0; index < size; index++) {
+          if (!this->journalMarks.empty())
+            this->journalMemoryLabels.push_back(std::make_pair(addr + index, this->getMemoryLabelSet(addr + index, 1)));
+
+          if (set == NO_LABEL)
+            this->memoryLabels.erase(addr + index);
+          else
+            this->memoryLabels[addr + index] = set;
+        }
+      }
+
+
+      /* Returns the set of labels of a register */
+      triton::uint32 TaintEngine::getRegisterLabelSet(const triton::arch::Register& reg) const {
+        triton::uint32 parent = reg.getParentId();
+
+        if (parent < this->registerLabels.size())
+          return this->registerLabels[parent];
+
+        return NO_LABEL;
+      }
+
+
+      /* Sets the set of labels of a register */
+      void TaintEngine::setRegisterLabelSet(const triton::arch::Register& reg, triton::uint32 set) {
+        triton::uint32 parent = reg.getParentId();
+
+        if (parent >= this->registerLabels.size()) {
+          if (set == NO_LABEL)
+            return;
+          this->registerLabels.resize(parent + 1, NO_LABEL);
+        }
+
+        if (!this->journalMarks.empty())
+          this->journalRegisterLabels.push_back(std::make_pair(parent, this->registerLabels[parent]));
+
+        this->registerLabels[parent] = set;
+      }
+
+
+      void TaintEngine::setRegisterTaint(triton::uint32 parent, bool flag) {
+        if (parent >= this->taintedRegisters.size()) {
+          if (!flag)
+            return;
+          this->taintedRegisters.resize(parent + 1, false);
+        }
+
+        if (!this->journalMarks.empty())
+          this->journalRegisters.push_back(std::make_pair(parent, static_cast<bool>(this->taintedRegisters[parent])));
+
+        this->taintedRegisters[parent] = flag;
+      }
+
+
+      void TaintEngine::startJournal(void) {
+        if (this->journalMarks.empty()) {
+          this->journalRegisters.clear();
+          this->journalRegisterLabels.clear();
+          this->journalMemoryLabels.clear();
+        }
+
+        this->journalMarks.push_back(JournalMark{this->journalRegisters.size(), this->journalRegisterLabels.size(), this->journalMemoryLabels.size()});
+        this->taintedMemory.startJournal();
+      }
+
+
+      void TaintEngine::rollbackJournal(void) {
+        if (this->journalMarks.empty())
+          return;
+
+        JournalMark mark = this->journalMarks.back();
+        this->journalMarks.pop_back();
+
+        /* Restore in the reverse order, the restorations are not journaled as the mark is popped */
+        for (triton::usize index = this->journalRegisters.size(); index > mark.registers; index--)
+          this->taintedRegisters[this->journalRegisters[index - 1].first] = this->journalRegisters[index - 1].second;
+
+        for (triton::usize index = this->journalRegisterLabels.size(); index > mark.registerLabels; index--)
+          this->registerLabels[this->journalRegisterLabels[index - 1].first] = this->journalRegisterLabels[index - 1].second;
+
+        for (triton::usize index = this->journalMemoryLabels.size(); index > mark.memoryLabels; index--) {
+          const auto& entry = this->journalMemoryLabels[index - 1];
+          if (entry.second == NO_LABEL)
+            this->memoryLabels.erase(entry.first);
+          else
+            this->memoryLabels[entry.first] = entry.second;
+        }
+
+        this->journalRegisters.resize(mark.registers);
+        this->journalRegisterLabels.resize(mark.registerLabels);
+        this->journalMemoryLabels.resize(mark.memoryLabels);
+        this->taintedMemory.rollbackJournal();
+      }
+
+
+      void TaintEngine::clearJournal(void) {
+        this->journalMarks.clear();
+        this->journalRegisters.clear();
+        this->journalRegisterLabels.clear();
+        this->journalMemoryLabels.clear();
+        this->taintedMemory.clearJournal();
+      }
+
+
+      void TaintEngine::serializeState(std::ostream& stream) const {
+        auto write = [&stream](const void* value, triton::usize size) {
+          stream.write(reinterpret_cast<const char*>(value), size);
+        };
+
+        /* Labels are written as lists, the ids of their sets are local to the engine */
+        auto writeLabels = [this, &write](triton::uint32 set) {
+          const std::vector<triton::uint32>& labels = this->labels.getLabels(set);
+          triton::uint32 count = static_cast<triton::uint32>(labels.size());
+          write(&count, sizeof(count));
+          if (count)
+            write(labels.data(), count * sizeof(triton::uint32));
+        };
+
+        triton::uint8 flags = this->labelsUsed;
+        write(&flags, sizeof(flags));
+
+        triton::uint64 registers = this->taintedRegisters.size();
+        write(&registers, sizeof(registers));
+        for (auto it = this->taintedRegisters.begin(); it != this->taintedRegisters.end(); it++) {
+          triton::uint8 tainted = *it;
+          write(&tainted, sizeof(tainted));
+        }
+
+        this->taintedMemory.save(stream);
+
+        triton::uint64 registerLabels = this->registerLabels.size();
+        write(&registerLabels, sizeof(registerLabels));
+        for (auto it = this->registerLabels.begin(); it != this->registerLabels.end(); it++)
+          writeLabels(*it);
+
+        triton::uint64 memoryLabels = this->memoryLabels.size();
+        write(&memoryLabels, sizeof(memoryLabels));
+        for (auto it = this->memoryLabels.begin(); it != this->memoryLabels.end(); it++) {
+          write(&it->first, sizeof(it->first));
+          writeLabels(it->second);
+        }
+      }
+
+
+      void TaintEngine::deserializeState(std::istream& stream) {
+        auto read = [&stream](void* value, triton::usize size) {
+          if (!stream.read(reinterpret_cast<char*>(value), size))
+            throw triton::exceptions::TaintEngine("TaintEngine::deserializeState(): The taint is truncated.");
+        };
+
+        auto readLabels = [this, &read](void) {
+          triton::uint32 count = 0;
+          triton::uint32 set   = NO_LABEL;
+          read(&count, sizeof(count));
+          for (triton::uint32 index = 0; index < count; index++) {
+            triton::uint32 label = 0;
+            read(&label, sizeof(label));
+            set = this->labels.merge(set, this->labels.single(label));
+          }
+          return set;
+        };
+
+        this->clearJournal();
+        this->labels.clear();
+        this->memoryLabels.clear();
+        this->registerLabels.clear();
+        this->taintedRegisters.clear();
+
+        triton::uint8 flags = 0;
+        read(&flags, sizeof(flags));
+        this->labelsUsed = (flags != 0);
+
+        triton::uint64 registers = 0;
+        read(&registers, sizeof(registers));
+        for (triton::uint64 index = 0; index < registers; index++) {
+          triton::uint8 tainted = 0;
+          read(&tainted, sizeof(tainted));
+          this->taintedRegisters.push_back(tainted != 0);
+        }
+
+        this->taintedMemory.load(stream);
+
+        triton::uint64 registerLabels = 0;
+        read(&registerLabels, sizeof(registerLabels));
+        for (triton::uint64 index = 0; index < registerLabels; index++)
+          this->registerLabels.push_back(readLabels());
+
+        triton::uint64 memoryLabels = 0;
+        read(&memoryLabels, sizeof(memoryLabels));
+        for (triton::uint64 index = 0; index < memoryLabels; index++) {
+          triton::uint64 addr = 0;
+          read(&addr, sizeof(addr));
+          this->memoryLabels[addr] = readLabels();
+        }
+      }
+
+
+      /* Taint the address with a label */
+      bool TaintEngine::labelMemory(triton::uint64 addr, triton::uint32 label) {
+        if (!this->isEnabled())
+          return this->isMemoryTainted(addr);
+
+        this->labelsUsed = true;
+        this->taintMemory(addr);
+        this->setMemoryLabelSet(addr, 1, this->labels.merge(this->getMemoryLabelSet(addr, 1), this->labels.single(label)));
+
+        return TAINTED;
+      }
+
+
+      /* Taint the register with a label */
+      bool TaintEngine::labelRegister(const triton::arch::Register& reg, triton::uint32 label) {
+        if (!this->isEnabled())
+          return this->isRegisterTainted(reg);
+
+        this->labelsUsed = true;
+        this->taintRegister(reg);
+        this->setRegisterLabelSet(reg, this->labels.merge(this->getRegisterLabelSet(reg), this->labels.single(label)));
+
+        return TAINTED;
+      }
+
+
+      /* Returns the labels of a memory area */
+      std::set<triton::uint32> TaintEngine::getMemoryLabels(triton::uint64 addr, triton::usize size) const {
+        const std::vector<triton::uint32>& labels = this->labels.getLabels(this->getMemoryLabelSet(addr, size));
+        return std::set<triton::uint32>(labels.begin(), labels.end());
+      }
+
+
+      /* Returns the labels of a register */
+      std::set<triton::uint32> TaintEngine::getRegisterLabels(const triton::arch::Register& reg) const {
+        const std::vector<triton::uint32>& labels = this->labels.getLabels(this->getRegisterLabelSet(reg));
+        return std::set<triton::uint32>(labels.begin(), labels.end());
+      }
+
+
       /* Sets the flag (taint or untaint) to an abstract operand (Register or Memory). */
       bool TaintEngine::setTaint(const triton::arch::OperandWrapper& op, bool flag) {
         switch (op.getType()) {
@@ -243,16 +536,14 @@ namespace triton {
 
       /* Sets the flag (taint or untaint) to a register. */
       bool TaintEngine::setTaintRegister(const triton::arch::Register& reg, bool flag) {
-        triton::arch::Register parent = reg.getParent();
-
         if (!this->isEnabled())
-          return this->isRegisterTainted(parent);
+          return this->isRegisterTainted(reg);
 
         if (flag == TAINTED)
-          this->taintRegister(parent);
+          this->taintRegister(reg);
 
         else if (flag == !TAINTED)
-          this->untaintRegister(parent);
+          this->untaintRegister(reg);
 
         return flag;
       }
@@ -266,8 +557,7 @@ namespace triton {
         if (!this->isEnabled())
           return this->isMemoryTainted(mem);
 
-        for (triton::uint32 index = 0; index < size; index++)
-          this->taintedMemory.insert(addr+index);
+        this->taintedMemory.taint(addr, size);
 
         return TAINTED;
       }
@@ -277,11 +567,60 @@ namespace triton {
       bool TaintEngine::taintMemory(triton::uint64 addr) {
         if (!this->isEnabled())
           return this->isMemoryTainted(addr);
-        this->taintedMemory.insert(addr);
+        this->taintedMemory.taint(addr);
         return TAINTED;
       }
 
 
+      /* Taint the memory area */
+      bool TaintEngine::taintMemoryArea(triton::uint64 baseAddr, triton::usize size) {
+        if (!this->isEnabled())
+          return this->taintedMemory.isTainted(baseAddr, size);
+        this->taintedMemory.taint(baseAddr, size);
+        return TAINTED;
+      }
+
+
+      /* Spread the taint of a copy of a memory area */
+      bool TaintEngine::taintAssignmentMemoryArea(triton::uint64 dst, triton::uint64 src, triton::usize size) {
+        if (!this->isEnabled())
+          return this->taintedMemory.isTainted(dst, size);
+
+        /* The labels are read before being overwritten if the areas overlap */
+        if (this->labelsUsed) {
+          std::vector<triton::uint32> sets(size);
+          for (triton::usize index = 0; index < size; index++)
+            sets[index] = this->getMemoryLabelSet(src + index, 1);
+          for (triton::usize index = 0; index < size; index++)
+            this->setMemoryLabelSet(dst + index, 1, sets[index]);
+        }
+
+        this->taintedMemory.copy(dst, src, size);
+
+        return this->taintedMemory.isTainted(dst, size);
+      }
+
+
+      /* Spread the taint of a union of memory areas */
+      bool TaintEngine::taintUnionMemoryArea(triton::uint64 dst, triton::uint64 src, triton::usize size) {
+        if (!this->isEnabled())
+          return this->taintedMemory.isTainted(dst, size);
+
+        /* The labels are read before being overwritten if the areas overlap */
+        if (this->labelsUsed) {
+          std::vector<triton::uint32> sets(size);
+          for (triton::usize index = 0; index < size; index++)
+            sets[index] = this->getMemoryLabelSet(src + index, 1);
+          for (triton::usize index = 0; index < size; index++)
+            this->setMemoryLabelSet(dst + index, 1, this->labels.merge(this->getMemoryLabelSet(dst + index, 1), sets[index]));
+        }
+
+        this->taintedMemory.merge(dst, src, size);
+
+        return this->taintedMemory.isTainted(dst, size);
+      }
+
+
       /* Untaint the memory */
       bool TaintEngine::untaintMemory(const triton::arch::MemoryAccess& mem) {
         triton::uint64 addr = mem.getAddress();
@@ -290,8 +629,10 @@ namespace triton {
         if (!this->isEnabled())
           return this->isMemoryTainted(mem);
 
-        for (triton::uint32 index = 0; index < size; index++)
-          this->taintedMemory.erase(addr+index);
+        this->taintedMemory.untaint(addr, size);
+
+        if (this->labelsUsed)
+          this->setMemoryLabelSet(addr, size, NO_LABEL);
 
         return !TAINTED;
       }
@@ -301,7 +642,20 @@ namespace triton {
       bool TaintEngine::untaintMemory(triton::uint64 addr) {
         if (!this->isEnabled())
           return this->isMemoryTainted(addr);
-        this->taintedMemory.erase(addr);
+        this->taintedMemory.untaint(addr);
+        if (this->labelsUsed)
+          this->setMemoryLabelSet(addr, 1, NO_LABEL);
+        return !TAINTED;
+      }
+
+
+      /* Untaint the memory area */
+      bool TaintEngine::untaintMemoryArea(triton::uint64 baseAddr, triton::usize size) {
+        if (!this->isEnabled())
+          return this->taintedMemory.isTainted(baseAddr, size);
+        this->taintedMemory.untaint(baseAddr, size);
+        if (this->labelsUsed)
+          this->setMemoryLabelSet(baseAddr, size, NO_LABEL);
         return !TAINTED;
       }
 
@@ -360,6 +714,97 @@ namespace triton {
       }
 
 
+      bool TaintEngine::runPlan(const TaintPlan& plan, const std::vector<triton::arch::OperandWrapper>& operands, bool& tainted) {
+        if (!this->isEnabled() || this->labelsUsed)
+          return false;
+
+        /* The taint of a register by parent id */
+        auto getRegister = [this](triton::uint32 parent) {
+          return (parent < this->taintedRegisters.size() && this->taintedRegisters[parent]);
+        };
+
+        auto setRegister = [this](triton::uint32 parent, bool flag) {
+          this->setRegisterTaint(parent, flag);
+        };
+
+        /* The taint of a location, the memory operands are read on `size` bytes (their own size if 0) */
+        auto isTainted = [&](const TaintLocation& location, triton::uint32 size) {
+          switch (location.kind) {
+            case LOCATION_REGISTER:
+              return getRegister(location.index);
+            case LOCATION_MEMORY: {
+              const triton::arch::MemoryAccess& mem = operands[location.index].getConstMemory();
+              return this->taintedMemory.isTainted(mem.getAddress(), (size ? size : mem.getSize()));
+            }
+            default:
+              return !TAINTED;
+          }
+        };
+
+        tainted = !TAINTED;
+
+        for (auto it = plan.steps.begin(); it != plan.steps.end(); it++) {
+          const TaintStep& step = *it;
+          const triton::arch::MemoryAccess* dst = (step.dst.kind == LOCATION_MEMORY ? &operands[step.dst.index].getConstMemory() : nullptr);
+          const triton::arch::MemoryAccess* src = (step.src.kind == LOCATION_MEMORY ? &operands[step.src.index].getConstMemory() : nullptr);
+          bool flag = !TAINTED;
+
+          switch (step.op) {
+            /* As the assignment*() methods, a memory source only spreads its tainted bytes to a memory destination */
+            case PLAN_ASSIGN:
+              flag = isTainted(step.src, 0);
+              if (dst == nullptr)
+                setRegister(step.dst.index, flag);
+              else if (src != nullptr) {
+                if (flag)
+                  this->taintedMemory.merge(dst->getAddress(), src->getAddress(), src->getSize());
+              }
+              else if (flag)
+                this->taintedMemory.taint(dst->getAddress(), dst->getSize());
+              else
+                this->taintedMemory.untaint(dst->getAddress(), dst->getSize());
+              tainted = flag;
+              break;
+
+            /* As the union*() methods, a memory source is read on the size of a memory destination */
+            case PLAN_UNION:
+              flag = isTainted(step.src, (dst != nullptr ? dst->getSize() : 0));
+              if (dst == nullptr) {
+                if (flag)
+                  setRegister(step.dst.index, TAINTED);
+                flag = getRegister(step.dst.index);
+              }
+              else {
+                if (flag && src != nullptr)
+                  this->taintedMemory.merge(dst->getAddress(), src->getAddress(), dst->getSize());
+                else if (flag)
+                  this->taintedMemory.taint(dst->getAddress(), dst->getSize());
+                flag = flag || this->taintedMemory.isTainted(dst->getAddress(), dst->getSize());
+              }
+              tainted = flag;
+              break;
+
+            case PLAN_TEST:
+              tainted = tainted || isTainted(step.dst, 0);
+              break;
+
+            case PLAN_SET:
+              setRegister(step.dst.index, tainted);
+              break;
+
+            case PLAN_CLEAR:
+              setRegister(step.dst.index, !TAINTED);
+              break;
+
+            default:
+              throw triton::exceptions::TaintEngine("TaintEngine::runPlan(): Invalid step.");
+          }
+        }
+
+        return true;
+      }
+
+
       bool TaintEngine::taintUnionMemoryImmediate(const triton::arch::MemoryAccess& memDst) {
         bool flag = triton::engines::taint::UNTAINTED;
         triton::uint64 memAddrDst = memDst.getAddress();
@@ -519,6 +964,8 @@ namespace triton {
 
         if (this->isRegisterTainted(regSrc)) {
           this->taintRegister(regDst);
+          if (this->labelsUsed)
+            this->setRegisterLabelSet(regDst, this->getRegisterLabelSet(regSrc));
           return TAINTED;
         }
 
@@ -543,6 +990,8 @@ namespace triton {
 
         if (this->isMemoryTainted(memSrc)) {
           this->taintRegister(regDst);
+          if (this->labelsUsed)
+            this->setRegisterLabelSet(regDst, this->getMemoryLabelSet(memSrc.getAddress(), memSrc.getSize()));
           return TAINTED;
         }
 
@@ -561,13 +1010,19 @@ namespace triton {
         if (!this->isEnabled())
           return this->isMemoryTainted(memDst);
 
-        for (triton::uint32 offset = 0; offset < readSize; offset++) {
-          if (this->isMemoryTainted(addrSrc+offset)) {
-            this->taintMemory(addrDst+offset);
-            isTainted = TAINTED;
+        /* The tainted bytes of the source are spread, the others are left as they are */
+        if (this->labelsUsed) {
+          for (triton::uint32 offset = 0; offset < readSize; offset++) {
+            if (this->isMemoryTainted(addrSrc+offset))
+              this->setMemoryLabelSet(addrDst+offset, 1, this->getMemoryLabelSet(addrSrc+offset, 1));
           }
         }
 
+        if (this->isMemoryTainted(addrSrc, readSize)) {
+          this->taintedMemory.merge(addrDst, addrSrc, readSize);
+          isTainted = TAINTED;
+        }
+
         return isTainted;
       }
 
@@ -589,6 +1044,8 @@ namespace triton {
         /* Check source */
         if (this->isRegisterTainted(regSrc)) {
           this->taintMemory(memDst);
+          if (this->labelsUsed)
+            this->setMemoryLabelSet(memDst.getAddress(), memDst.getSize(), this->getRegisterLabelSet(regSrc));
           return TAINTED;
         }
 
@@ -613,6 +1070,8 @@ namespace triton {
 
         if (this->isRegisterTainted(regSrc)) {
           this->taintRegister(regDst);
+          if (this->labelsUsed)
+            this->setRegisterLabelSet(regDst, this->labels.merge(this->getRegisterLabelSet(regDst), this->getRegisterLabelSet(regSrc)));
           return TAINTED;
         }
 
@@ -631,13 +1090,18 @@ namespace triton {
           return this->isMemoryTainted(memDst);
 
         /* Check source */
-        for (triton::uint32 offset = 0; offset < writeSize; offset++) {
-          if (this->isMemoryTainted(addrSrc+offset)) {
-            this->taintMemory(addrDst+offset);
-            tainted = TAINTED;
+        if (this->labelsUsed) {
+          for (triton::uint32 offset = 0; offset < writeSize; offset++) {
+            if (this->isMemoryTainted(addrSrc+offset))
+              this->setMemoryLabelSet(addrDst+offset, 1, this->labels.merge(this->getMemoryLabelSet(addrDst+offset, 1), this->getMemoryLabelSet(addrSrc+offset, 1)));
           }
         }
 
+        if (this->isMemoryTainted(addrSrc, writeSize)) {
+          this->taintedMemory.merge(addrDst, addrSrc, writeSize);
+          tainted = TAINTED;
+        }
+
         /* Check destination */
         if (this->isMemoryTainted(memDst)) {
           return TAINTED;
@@ -654,6 +1118,8 @@ namespace triton {
 
         if (this->isMemoryTainted(memSrc)) {
           this->taintRegister(regDst);
+          if (this->labelsUsed)
+            this->setRegisterLabelSet(regDst, this->labels.merge(this->getRegisterLabelSet(regDst), this->getMemoryLabelSet(memSrc.getAddress(), memSrc.getSize())));
           return TAINTED;
         }
 
@@ -681,6 +1147,11 @@ namespace triton {
 
         if (this->isRegisterTainted(regSrc)) {
           this->taintMemory(memDst);
+          if (this->labelsUsed) {
+            triton::uint32 set = this->getRegisterLabelSet(regSrc);
+            for (triton::uint32 offset = 0; offset < memDst.getSize(); offset++)
+              this->setMemoryLabelSet(memDst.getAddress()+offset, 1, this->labels.merge(this->getMemoryLabelSet(memDst.getAddress()+offset, 1), set));
+          }
           return TAINTED;
         }
 
@@ -0,0 +1,109 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#include <algorithm>
+#include <iterator>
+
+#include <coreUtils.hpp>
+#include <exceptions.hpp>
+#include <taintLabels.hpp>
+
+
+
+namespace triton {
+  namespace engines {
+    namespace taint {
+
+      TaintLabels::TaintLabels() {
+        this->clear();
+      }
+
+
+      triton::uint32 TaintLabels::intern(const std::vector<triton::uint32>& labels) {
+        auto it = this->ids.find(labels);
+        if (it != this->ids.end())
+          return it->second;
+
+        triton::uint32 id = static_cast<triton::uint32>(this->sets.size());
+        this->sets.push_back(labels);
+        this->ids[labels] = id;
+
+        return id;
+      }
+
+
+      triton::uint32 TaintLabels::single(triton::uint32 label) {
+        return this->intern(std::vector<triton::uint32>(1, label));
+      }
+
+
+      triton::uint32 TaintLabels::merge(triton::uint32 set1, triton::uint32 set2) {
+        if (set1 == set2 || set2 == NO_LABEL)
+          return set1;
+
+        if (set1 == NO_LABEL)
+          return set2;
+
+        if (set1 > set2)
+          std::swap(set1, set2);
+
+        triton::uint64 key = (static_cast<triton::uint64>(set1) << 32) | set2;
+        auto it = this->unions.find(key);
+        if (it != this->unions.end())
+          return it->second;
+
+        const std::vector<triton::uint32>& labels1 = this->getLabels(set1);
+        const std::vector<triton::uint32>& labels2 = this->getLabels(set2);
+        std::vector<triton::uint32> labels;
+
+        labels.reserve(labels1.size() + labels2.size());
+        std::set_union(labels1.begin(), labels1.end(), labels2.begin(), labels2.end(), std::back_inserter(labels));
+
+        triton::uint32 id = this->intern(labels);
+        this->unions[key] = id;
+
+        return id;
+      }
+
+
+      const std::vector<triton::uint32>& TaintLabels::getLabels(triton::uint32 set) const {
+        if (set >= this->sets.size())
+          throw triton::exceptions::TaintEngine("TaintLabels::getLabels(): Invalid set of labels.");
+        return this->sets[set];
+      }
+
+
+      triton::usize TaintLabels::size(void) const {
+        return this->sets.size();
+      }
+
+
+      triton::usize TaintLabels::getMemoryUsage(void) const {
+        triton::usize ret = this->unions.size() * triton::utils::getHashNodeSize(sizeof(std::pair<const triton::uint64, triton::uint32>));
+
+        /* Every set is stored twice, by id and as a key of its id */
+        for (auto it = this->sets.begin(); it != this->sets.end(); it++) {
+          ret += 2 * (sizeof(*it) + it->capacity() * sizeof(triton::uint32));
+          ret += triton::utils::getTreeNodeSize(sizeof(triton::uint32));
+        }
+
+        return ret;
+      }
+
+
+      void TaintLabels::clear(void) {
+        this->sets.clear();
+        this->ids.clear();
+        this->unions.clear();
+
+        /* The empty set is always the set 0 */
+        this->intern(std::vector<triton::uint32>());
+      }
+
+    }; /* taint namespace */
+  }; /* engines namespace */
+}; /* triton namespace */
@@ -0,0 +1,719 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#include <algorithm>
+#include <cstring>
+
+#include <coreUtils.hpp>
+#include <exceptions.hpp>
+#include <taintMemoryMap.hpp>
+
+#if defined(__AVX2__)
+  #include <immintrin.h>
+#elif defined(__SSE2__)
+  #include <emmintrin.h>
+#endif
+
+
+
+namespace triton {
+  namespace engines {
+    namespace taint {
+
+      /* Returns the number of bits set in a word */
+      static triton::uint32 countBits(triton::uint64 word) {
+        word = word - ((word >> 1) & 0x5555555555555555ULL);
+        word = (word & 0x3333333333333333ULL) + ((word >> 2) & 0x3333333333333333ULL);
+        word = (word + (word >> 4)) & 0x0f0f0f0f0f0f0f0fULL;
+        return static_cast<triton::uint32>((word * 0x0101010101010101ULL) >> 56);
+      }
+
+
+      /* Returns the mask of `count` bits starting at `bit` */
+      static triton::uint64 bitMask(triton::uint32 bit, triton::uint32 count) {
+        if (count >= 64)
+          return ~0ULL;
+        return ((1ULL << count) - 1) << bit;
+      }
+
+
+      /* Copies or merges (OR) `count` words of shadow bits, from the first to the last one */
+      static void transferWordsKernel(triton::uint64* dst, const triton::uint64* src, triton::usize count, bool merge) {
+        triton::usize index = 0;
+
+        #if defined(__AVX2__)
+        for (; index + 4 <= count; index += 4) {
+          __m256i value = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + index));
+          if (merge)
+            value = _mm256_or_si256(value, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(dst + index)));
+          _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + index), value);
+        }
+        #elif defined(__SSE2__)
+        for (; index + 2 <= count; index += 2) {
+          __m128i value = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + index));
+          if (merge)
+            value = _mm_or_si128(value, _mm_loadu_si128(reinterpret_cast<const __m128i*>(dst + index)));
+          _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + index), value);
+        }
+        #endif
+
+        /* Scalar fallback and remaining words */
+        for (; index < count; index++)
+          dst[index] = (merge ? (dst[index] | src[index]) : src[index]);
+      }
+
+
+      /* Returns the number of bits set in `count` words */
+      static triton::uint32 countWords(const triton::uint64* words, triton::usize count) {
+        triton::uint32 ret = 0;
+
+        for (triton::usize index = 0; index < count; index++)
+          ret += countBits(words[index]);
+
+        return ret;
+      }
+
+
+      /* Returns true if one of the `count` bits starting at `bit` is set */
+      static bool hasBits(const triton::uint64* words, triton::uint32 bit, triton::uint32 count) {
+        while (count) {
+          triton::uint32 shift = (bit & 63);
+          triton::uint32 n     = std::min<triton::uint32>(64 - shift, count);
+          if (words[bit >> 6] & bitMask(shift, n))
+            return true;
+          bit   += n;
+          count -= n;
+        }
+        return false;
+      }
+
+
+      TaintMemoryMap::TaintMemoryMap() {
+        this->count        = 0;
+        this->cachedNumber = 0;
+        this->cachedPage   = nullptr;
+      }
+
+
+      TaintMemoryMap::TaintMemoryMap(const TaintMemoryMap& other) {
+        this->count        = other.count;
+        this->pages        = other.pages;
+        this->runs         = other.runs;
+        this->cachedNumber = 0;
+        this->cachedPage   = nullptr;
+      }
+
+
+      void TaintMemoryMap::operator=(const TaintMemoryMap& other) {
+        this->count        = other.count;
+        this->pages        = other.pages;
+        this->runs         = other.runs;
+        this->cachedNumber = 0;
+        this->cachedPage   = nullptr;
+      }
+
+
+      const TaintMemoryMap::Page* TaintMemoryMap::getFullPage(void) {
+        static const Page full = []() {
+          Page page;
+          std::memset(page.words, 0xff, sizeof(page.words));
+          page.count = TaintMemoryMap::pageSize;
+          return page;
+        }();
+
+        return &full;
+      }
+
+
+      std::map<triton::uint64, triton::uint64>::const_iterator TaintMemoryMap::findRun(triton::uint64 number) const {
+        auto it = this->runs.upper_bound(number);
+
+        if (it == this->runs.begin())
+          return this->runs.end();
+
+        it--;
+        return (number < it->second ? it : this->runs.end());
+      }
+
+
+      const TaintMemoryMap::Page* TaintMemoryMap::findPage(triton::uint64 addr) const {
+        triton::uint64 number = (addr >> TaintMemoryMap::pageBits);
+
+        if (this->cachedPage != nullptr && this->cachedNumber == number)
+          return this->cachedPage;
+
+        auto it = this->pages.find(number);
+        if (it == this->pages.end())
+          return (this->findRun(number) != this->runs.end() ? TaintMemoryMap::getFullPage() : nullptr);
+
+        /* Pages are never moved by the map, the pointer stays valid until the page is erased */
+        this->cachedNumber = number;
+        this->cachedPage   = const_cast<Page*>(&it->second);
+
+        return this->cachedPage;
+      }
+
+
+      TaintMemoryMap::Page* TaintMemoryMap::getPage(triton::uint64 addr) {
+        triton::uint64 number = (addr >> TaintMemoryMap::pageBits);
+        const Page* found     = this->findPage(addr);
+
+        if (found != TaintMemoryMap::getFullPage())
+          return const_cast<Page*>(found);
+
+        /* The run is split around the page, which becomes a bitmap */
+        auto run             = this->findRun(number);
+        triton::uint64 first = run->first;
+        triton::uint64 end   = run->second;
+
+        this->runs.erase(run);
+        if (first < number)
+          this->runs[first] = number;
+        if (number + 1 < end)
+          this->runs[number + 1] = end;
+
+        Page* page = &this->pages[number];
+        *page = *TaintMemoryMap::getFullPage();
+        this->cachedNumber = number;
+        this->cachedPage   = page;
+
+        return page;
+      }
+
+
+      TaintMemoryMap::Page* TaintMemoryMap::getOrCreatePage(triton::uint64 addr) {
+        Page* page = this->getPage(addr);
+
+        if (page == nullptr) {
+          triton::uint64 number = (addr >> TaintMemoryMap::pageBits);
+          page = &this->pages[number];
+          std::memset(page->words, 0x00, sizeof(page->words));
+          page->count = 0;
+          this->cachedNumber = number;
+          this->cachedPage   = page;
+        }
+
+        return page;
+      }
+
+
+      void TaintMemoryMap::releasePage(triton::uint64 addr) {
+        this->pages.erase(addr >> TaintMemoryMap::pageBits);
+        this->cachedPage = nullptr;
+      }
+
+
+      void TaintMemoryMap::addRun(triton::uint64 first, triton::uint64 end) {
+        this->count += ((end - first) << TaintMemoryMap::pageBits);
+
+        /* The pages of the run have no bitmap */
+        for (auto it = this->pages.lower_bound(first); it != this->pages.end() && it->first < end;) {
+          this->count -= it->second.count;
+          it = this->pages.erase(it);
+        }
+
+        /* The runs which overlap or touch the new one are merged into it */
+        auto it = this->runs.upper_bound(first);
+        if (it != this->runs.begin() && std::prev(it)->second >= first)
+          it--;
+
+        while (it != this->runs.end() && it->first <= end) {
+          triton::uint64 low  = std::max(it->first, first);
+          triton::uint64 high = std::min(it->second, end);
+          if (high > low)
+            this->count -= ((high - low) << TaintMemoryMap::pageBits);
+          first = std::min(first, it->first);
+          end   = std::max(end, it->second);
+          it    = this->runs.erase(it);
+        }
+
+        this->runs[first] = end;
+        this->cachedPage  = nullptr;
+      }
+
+
+      void TaintMemoryMap::removePages(triton::uint64 first, triton::uint64 end) {
+        for (auto it = this->pages.lower_bound(first); it != this->pages.end() && it->first < end;) {
+          this->count -= it->second.count;
+          it = this->pages.erase(it);
+        }
+
+        /* The runs which overlap the pages keep their parts out of them */
+        auto it = this->runs.upper_bound(first);
+        if (it != this->runs.begin() && std::prev(it)->second > first)
+          it--;
+
+        while (it != this->runs.end() && it->first < end) {
+          triton::uint64 runFirst = it->first;
+          triton::uint64 runEnd   = it->second;
+
+          this->count -= ((std::min(runEnd, end) - std::max(runFirst, first)) << TaintMemoryMap::pageBits);
+          it = this->runs.erase(it);
+
+          if (runFirst < first)
+            this->runs[runFirst] = first;
+          if (runEnd > end)
+            this->runs[end] = runEnd;
+        }
+
+        this->cachedPage = nullptr;
+      }
+
+
+      bool TaintMemoryMap::isTainted(triton::uint64 addr, triton::usize size) const {
+        if (size == 0)
+          return false;
+
+        /* A range which wraps around the address space is checked in two parts */
+        if (addr + (size - 1) < addr) {
+          triton::usize head = static_cast<triton::usize>(0 - addr);
+          return this->isTainted(addr, head) || this->isTainted(0, size - head);
+        }
+
+        triton::uint64 first  = (addr >> TaintMemoryMap::pageBits);
+        triton::uint64 last   = ((addr + (size - 1)) >> TaintMemoryMap::pageBits);
+        triton::uint32 offset = static_cast<triton::uint32>(addr & (TaintMemoryMap::pageSize - 1));
+        triton::uint32 limit  = static_cast<triton::uint32>((addr + (size - 1)) & (TaintMemoryMap::pageSize - 1)) + 1;
+
+        if (first == last) {
+          const Page* page = this->findPage(addr);
+          return (page != nullptr && hasBits(page->words, offset, limit - offset));
+        }
+
+        /* The last run starting before the end of the range */
+        auto run = this->runs.upper_bound(last);
+        if (run != this->runs.begin() && std::prev(run)->second > first)
+          return true;
+
+        /* Only the allocated pages of the range are visited */
+        for (auto it = this->pages.lower_bound(first); it != this->pages.end() && it->first <= last; it++) {
+          triton::uint32 bit = (it->first == first ? offset : 0);
+          triton::uint32 end = (it->first == last ? limit : static_cast<triton::uint32>(TaintMemoryMap::pageSize));
+          if (hasBits(it->second.words, bit, end - bit))
+            return true;
+        }
+
+        return false;
+      }
+
+
+      void TaintMemoryMap::setBits(triton::uint64 addr, triton::uint32 size, bool flag) {
+        triton::uint32 bit = static_cast<triton::uint32>(addr & (TaintMemoryMap::pageSize - 1));
+        Page* page         = (flag ? this->getOrCreatePage(addr) : this->getPage(addr));
+
+        if (page == nullptr)
+          return;
+
+        while (size) {
+          triton::uint32 shift   = (bit & 63);
+          triton::uint32 n       = std::min<triton::uint32>(64 - shift, size);
+          triton::uint64 mask    = bitMask(shift, n);
+          triton::uint64& word   = page->words[bit >> 6];
+          triton::uint32 changed = countBits(flag ? (mask & ~word) : (mask & word));
+
+          if (flag) {
+            word        |= mask;
+            page->count += changed;
+            this->count += changed;
+          }
+          else {
+            word        &= ~mask;
+            page->count -= changed;
+            this->count -= changed;
+          }
+
+          bit  += n;
+          size -= n;
+        }
+
+        /* Release untainted pages */
+        if (page->count == 0)
+          this->releasePage(addr);
+      }
+
+
+      void TaintMemoryMap::setRange(triton::uint64 addr, triton::usize size, bool flag) {
+        while (size) {
+          triton::uint32 offset = static_cast<triton::uint32>(addr & (TaintMemoryMap::pageSize - 1));
+          triton::usize length  = std::min<triton::usize>(TaintMemoryMap::pageSize - offset, size);
+
+          /* The whole pages are set at once, whatever their number */
+          if (offset == 0 && size >= TaintMemoryMap::pageSize) {
+            triton::uint64 first = (addr >> TaintMemoryMap::pageBits);
+            triton::uint64 end   = first + (size >> TaintMemoryMap::pageBits);
+            if (flag)
+              this->addRun(first, end);
+            else
+              this->removePages(first, end);
+            length = ((end - first) << TaintMemoryMap::pageBits);
+          }
+          else {
+            this->setBits(addr, static_cast<triton::uint32>(length), flag);
+          }
+
+          addr += length;
+          size -= length;
+        }
+      }
+
+
+      void TaintMemoryMap::taint(triton::uint64 addr, triton::usize size) {
+        this->record(addr, size);
+        this->setRange(addr, size, true);
+      }
+
+
+      void TaintMemoryMap::untaint(triton::uint64 addr, triton::usize size) {
+        this->record(addr, size);
+        this->setRange(addr, size, false);
+      }
+
+
+      void TaintMemoryMap::transferBits(triton::uint64 dst, triton::uint64 src, triton::uint32 size, bool merge) {
+        triton::uint32 srcBit = static_cast<triton::uint32>(src & (TaintMemoryMap::pageSize - 1));
+        triton::uint32 dstBit = static_cast<triton::uint32>(dst & (TaintMemoryMap::pageSize - 1));
+        triton::uint32 shift  = (dstBit & 63);
+        triton::uint64 mask   = bitMask(shift, size);
+        triton::uint64 value  = 0;
+        const Page* srcPage   = this->findPage(src);
+
+        if (srcPage != nullptr)
+          value = ((srcPage->words[srcBit >> 6] >> (srcBit & 63)) & bitMask(0, size)) << shift;
+
+        /* Nothing to merge, or nothing to clear */
+        if (value == 0 && (merge || this->findPage(dst) == nullptr))
+          return;
+
+        Page* dstPage         = this->getOrCreatePage(dst);
+        triton::uint64& word  = dstPage->words[dstBit >> 6];
+        triton::uint64 result = (merge ? (word | value) : ((word & ~mask) | value));
+        triton::uint32 before = countBits(word);
+        triton::uint32 after  = countBits(result);
+
+        word            = result;
+        dstPage->count += after - before;
+        this->count    += after;
+        this->count    -= before;
+
+        /* Release untainted pages */
+        if (dstPage->count == 0)
+          this->releasePage(dst);
+      }
+
+
+      triton::usize TaintMemoryMap::transferWords(triton::uint64 dst, triton::uint64 src, triton::usize size, bool merge) {
+        triton::uint32 srcWord = static_cast<triton::uint32>((src & (TaintMemoryMap::pageSize - 1)) >> 6);
+        triton::uint32 dstWord = static_cast<triton::uint32>((dst & (TaintMemoryMap::pageSize - 1)) >> 6);
+        triton::usize words    = std::min<triton::usize>(size >> 6, std::min(TaintMemoryMap::wordsPerPage - srcWord, TaintMemoryMap::wordsPerPage - dstWord));
+        const Page* srcPage    = this->findPage(src);
+        Page* dstPage          = nullptr;
+
+        /* A whole page of a run is copied as a run, a whole untainted page is copied by releasing the destination */
+        if (words == TaintMemoryMap::wordsPerPage) {
+          triton::uint64 number = (dst >> TaintMemoryMap::pageBits);
+          if (srcPage == TaintMemoryMap::getFullPage()) {
+            this->addRun(number, number + 1);
+            return TaintMemoryMap::pageSize;
+          }
+          if (srcPage == nullptr && !merge) {
+            this->removePages(number, number + 1);
+            return TaintMemoryMap::pageSize;
+          }
+        }
+
+        if (srcPage == nullptr) {
+          /* Nothing to merge */
+          if (merge || (dstPage = this->getPage(dst)) == nullptr)
+            return (words << 6);
+
+          /* Copies untainted bytes */
+          triton::uint32 removed = countWords(dstPage->words + dstWord, words);
+          std::memset(dstPage->words + dstWord, 0x00, words * sizeof(triton::uint64));
+          dstPage->count -= removed;
+          this->count    -= removed;
+        }
+        else {
+          /* Pages are never moved by the map, srcPage stays valid */
+          dstPage = this->getOrCreatePage(dst);
+          triton::uint32 before = countWords(dstPage->words + dstWord, words);
+          transferWordsKernel(dstPage->words + dstWord, srcPage->words + srcWord, words, merge);
+          triton::uint32 after = countWords(dstPage->words + dstWord, words);
+          dstPage->count += after - before;
+          this->count    += after;
+          this->count    -= before;
+        }
+
+        /* Release untainted pages */
+        if (dstPage->count == 0)
+          this->releasePage(dst);
+
+        return (words << 6);
+      }
+
+
+      void TaintMemoryMap::transfer(triton::uint64 dst, triton::uint64 src, triton::usize size, bool merge) {
+        if (dst == src)
+          return;
+
+        /*
+         * If the destination overlaps the end of the source, the source is transferred
+         * from its end by chunks which do not overlap, so that every byte is read before
+         * being overwritten.
+         */
+        if (dst > src && dst - src < size) {
+          triton::usize step = dst - src;
+          while (size) {
+            triton::usize length = std::min(step, size);
+            size -= length;
+            this->transfer(dst + size, src + size, length, merge);
+          }
+          return;
+        }
+
+        while (size) {
+          triton::uint32 srcShift = static_cast<triton::uint32>(src & 63);
+          triton::uint32 dstShift = static_cast<triton::uint32>(dst & 63);
+          triton::usize length    = 0;
+
+          /* Whole words when both ranges are aligned, otherwise what fits in a word of each range */
+          if (srcShift == 0 && dstShift == 0 && size >= 64) {
+            length = this->transferWords(dst, src, size, merge);
+          }
+          else {
+            length = std::min<triton::usize>(std::min(64 - srcShift, 64 - dstShift), size);
+            this->transferBits(dst, src, static_cast<triton::uint32>(length), merge);
+          }
+
+          dst  += length;
+          src  += length;
+          size -= length;
+        }
+      }
+
+
+      void TaintMemoryMap::copy(triton::uint64 dst, triton::uint64 src, triton::usize size) {
+        this->record(dst, size);
+        this->transfer(dst, src, size, false);
+      }
+
+
+      void TaintMemoryMap::merge(triton::uint64 dst, triton::uint64 src, triton::usize size) {
+        this->record(dst, size);
+        this->transfer(dst, src, size, true);
+      }
+
+
+      void TaintMemoryMap::clear(void) {
+        this->pages.clear();
+        this->runs.clear();
+        this->count      = 0;
+        this->cachedPage = nullptr;
+      }
+
+
+      /* The whole pages, tainted or not, are recorded as one extent and the consecutive extents of the same taint are merged */
+      void TaintMemoryMap::record(triton::uint64 addr, triton::usize size) {
+        if (this->journalMarks.empty())
+          return;
+
+        auto append = [this](triton::uint64 first, triton::usize count, bool tainted) {
+          if (this->journal.size() > this->journalMarks.back()) {
+            Extent& last = this->journal.back();
+            if (last.tainted == tainted && last.addr + last.size == first) {
+              last.size += count;
+              return;
+            }
+          }
+          this->journal.push_back(Extent{first, count, tainted});
+        };
+
+        for (triton::usize done = 0; done < size;) {
+          triton::uint64 current = addr + done;
+          triton::usize chunk    = std::min<triton::usize>(size - done, TaintMemoryMap::pageSize - (current & (TaintMemoryMap::pageSize - 1)));
+          const Page* page       = this->findPage(current);
+
+          if (page == nullptr || page->count == TaintMemoryMap::pageSize)
+            append(current, chunk, page != nullptr);
+
+          else {
+            for (triton::usize index = 0; index < chunk; index++) {
+              triton::uint32 bit = static_cast<triton::uint32>((current + index) & (TaintMemoryMap::pageSize - 1));
+              append(current + index, 1, ((page->words[bit >> 6] >> (bit & 63)) & 1) != 0);
+            }
+          }
+
+          done += chunk;
+        }
+      }
+
+
+      void TaintMemoryMap::startJournal(void) {
+        if (this->journalMarks.empty())
+          this->journal.clear();
+        this->journalMarks.push_back(this->journal.size());
+      }
+
+
+      void TaintMemoryMap::rollbackJournal(void) {
+        if (this->journalMarks.empty())
+          return;
+
+        triton::usize mark = this->journalMarks.back();
+        this->journalMarks.pop_back();
+
+        /* Restore the extents in the reverse order */
+        for (triton::usize index = this->journal.size(); index > mark; index--) {
+          const Extent& extent = this->journal[index - 1];
+          this->setRange(extent.addr, extent.size, extent.tainted);
+        }
+
+        this->journal.resize(mark);
+      }
+
+
+      void TaintMemoryMap::clearJournal(void) {
+        this->journal.clear();
+        this->journalMarks.clear();
+      }
+
+
+      triton::usize TaintMemoryMap::size(void) const {
+        return this->count;
+      }
+
+
+      triton::usize TaintMemoryMap::getMemoryUsage(void) const {
+        return this->pages.size() * triton::utils::getTreeNodeSize(sizeof(std::pair<const triton::uint64, Page>)) +
+               this->runs.size() * triton::utils::getTreeNodeSize(sizeof(std::pair<const triton::uint64, triton::uint64>));
+      }
+
+
+      std::set<triton::uint64> TaintMemoryMap::toSet(void) const {
+        std::set<triton::uint64> ret;
+
+        for (auto it = this->runs.begin(); it != this->runs.end(); it++) {
+          for (triton::uint64 addr = (it->first << TaintMemoryMap::pageBits); addr != (it->second << TaintMemoryMap::pageBits); addr++)
+            ret.insert(ret.end(), addr);
+        }
+
+        for (auto it = this->pages.begin(); it != this->pages.end(); it++) {
+          triton::uint64 base = (it->first << TaintMemoryMap::pageBits);
+          for (triton::uint32 index = 0; index < TaintMemoryMap::wordsPerPage; index++) {
+            triton::uint64 word = it->second.words[index];
+            for (triton::uint32 bit = 0; word != 0; bit++, word >>= 1) {
+              if (word & 1)
+                ret.insert(ret.end(), base + (index * 64) + bit);
+            }
+          }
+        }
+
+        return ret;
+      }
+
+
+      void TaintMemoryMap::forEachRange(const std::function<void(triton::uint64, triton::usize)>& callback) const {
+        auto run  = this->runs.begin();
+        auto page = this->pages.begin();
+        triton::uint64 start = 0;
+        triton::usize size   = 0;
+
+        /* Extends the pending range or flushes it */
+        auto add = [&](triton::uint64 addr, triton::usize length) {
+          if (size && start + size == addr) {
+            size += length;
+            return;
+          }
+          if (size)
+            callback(start, size);
+          start = addr;
+          size  = length;
+        };
+
+        /* Runs and pages never share a page number, they are merged by page number */
+        while (run != this->runs.end() || page != this->pages.end()) {
+          if (page == this->pages.end() || (run != this->runs.end() && run->first < page->first)) {
+            add(run->first << TaintMemoryMap::pageBits, static_cast<triton::usize>((run->second - run->first) << TaintMemoryMap::pageBits));
+            run++;
+            continue;
+          }
+
+          triton::uint64 base = (page->first << TaintMemoryMap::pageBits);
+          for (triton::uint32 index = 0; index < TaintMemoryMap::wordsPerPage; index++) {
+            triton::uint64 word = page->second.words[index];
+            if (word == 0)
+              continue;
+            if (word == ~static_cast<triton::uint64>(0)) {
+              add(base + (index * 64), 64);
+              continue;
+            }
+            for (triton::uint32 bit = 0; word != 0; bit++, word >>= 1) {
+              if (word & 1)
+                add(base + (index * 64) + bit, 1);
+            }
+          }
+          page++;
+        }
+
+        if (size)
+          callback(start, size);
+      }
+
+
+      void TaintMemoryMap::save(std::ostream& stream) const {
+        triton::uint64 runs  = this->runs.size();
+        triton::uint64 pages = this->pages.size();
+
+        stream.write(reinterpret_cast<const char*>(&runs), sizeof(runs));
+        for (auto it = this->runs.begin(); it != this->runs.end(); it++) {
+          stream.write(reinterpret_cast<const char*>(&it->first), sizeof(it->first));
+          stream.write(reinterpret_cast<const char*>(&it->second), sizeof(it->second));
+        }
+
+        stream.write(reinterpret_cast<const char*>(&pages), sizeof(pages));
+        for (auto it = this->pages.begin(); it != this->pages.end(); it++) {
+          stream.write(reinterpret_cast<const char*>(&it->first), sizeof(it->first));
+          stream.write(reinterpret_cast<const char*>(it->second.words), sizeof(it->second.words));
+        }
+      }
+
+
+      void TaintMemoryMap::load(std::istream& stream) {
+        triton::uint64 runs  = 0;
+        triton::uint64 pages = 0;
+
+        auto read = [&stream](void* value, triton::usize size) {
+          if (!stream.read(reinterpret_cast<char*>(value), size))
+            throw triton::exceptions::TaintEngine("TaintMemoryMap::load(): The taint is truncated.");
+        };
+
+        this->clear();
+
+        read(&runs, sizeof(runs));
+        for (triton::uint64 index = 0; index < runs; index++) {
+          triton::uint64 first = 0;
+          triton::uint64 end   = 0;
+          read(&first, sizeof(first));
+          read(&end, sizeof(end));
+          this->runs.emplace_hint(this->runs.end(), first, end);
+          this->count += static_cast<triton::usize>((end - first) << TaintMemoryMap::pageBits);
+        }
+
+        /* The number of tainted bytes of a page is recomputed from its bits */
+        read(&pages, sizeof(pages));
+        for (triton::uint64 index = 0; index < pages; index++) {
+          triton::uint64 number = 0;
+          read(&number, sizeof(number));
+          Page& page = this->pages.emplace_hint(this->pages.end(), number, Page())->second;
+          read(page.words, sizeof(page.words));
+          page.count   = countWords(page.words, TaintMemoryMap::wordsPerPage);
+          this->count += page.count;
+        }
+      }
+
+    }; /* taint namespace */
+  }; /* engines namespace */
+}; /* triton namespace */
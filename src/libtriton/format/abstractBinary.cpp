@@ -143,5 +143,12 @@ namespace triton {
       return this->binary->getMemoryMapping();
     }
 
+
+    const triton::format::SymbolIndex& AbstractBinary::getSymbolIndex(void) const {
+      if (!this->binary)
+        throw triton::exceptions::Format("AbstractBinary::getSymbolIndex(): You must load the binary before.");
+      return this->binary->getSymbolIndex();
+    }
+
   }; /* format namespace */
 }; /* triton namespace */
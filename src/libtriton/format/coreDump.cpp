@@ -0,0 +1,171 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#include <cstring>
+
+#include <coreDump.hpp>
+#include <elfEnums.hpp>
+#include <elfHeader.hpp>
+#include <elfProgramHeader.hpp>
+#include <exceptions.hpp>
+
+
+
+namespace triton {
+  namespace format {
+
+    /* Minidump stream types of the memory lists */
+    static const triton::uint32 MINIDUMP_MEMORY_LIST   = 5;
+    static const triton::uint32 MINIDUMP_MEMORY64_LIST = 9;
+
+
+    CoreDump::CoreDump(const std::string& path) {
+      this->path = path;
+      this->file = std::make_shared<triton::format::MappedFile>();
+      this->file->open(path);
+
+      if (this->isInside(0, 4) && std::memcmp(this->file->getData(), "\x7f" "ELF", 4) == 0)
+        this->parseElf();
+
+      else if (this->isInside(0, 4) && std::memcmp(this->file->getData(), "MDMP", 4) == 0)
+        this->parseMinidump();
+
+      else
+        throw triton::exceptions::Format("CoreDump::CoreDump(): The file is neither an ELF core file nor a minidump.");
+    }
+
+
+    bool CoreDump::isInside(triton::uint64 offset, triton::uint64 size) const {
+      return (offset <= this->file->getSize() && size <= this->file->getSize() - offset);
+    }
+
+
+    void CoreDump::addArea(triton::uint64 offset, triton::uint64 size, triton::uint64 address) {
+      triton::format::MemoryMapping area(this->file->getData());
+
+      if (!this->isInside(offset, size))
+        throw triton::exceptions::Format("CoreDump::addArea(): A memory area is outside of the file.");
+
+      area.setOffset(offset);
+      area.setSize(size);
+      area.setVirtualAddress(address);
+      area.setVirtualSize(size);
+
+      this->memoryMapping.push_back(area);
+    }
+
+
+    void CoreDump::parseElf(void) {
+      triton::format::elf::ElfHeader header;
+
+      if (!this->isInside(0, header.getMaxHeaderSize()))
+        throw triton::exceptions::Format("CoreDump::parseElf(): The ELF Header of the dump is truncated.");
+
+      header.parse(this->file->getData());
+
+      triton::uint64 phOffset = header.getPhoff();
+      triton::uint16 phNum    = header.getPhnum();
+      triton::uint16 phSize   = header.getPhentsize();
+
+      if (!this->isInside(phOffset, phNum * phSize))
+        throw triton::exceptions::Format("CoreDump::parseElf(): The ELF Program Headers of the dump are truncated.");
+
+      /* The bytes of a segment which are not in the file have not been dumped */
+      for (triton::uint16 entry = 0; entry < phNum; entry++) {
+        triton::format::elf::ElfProgramHeader phdr;
+        phdr.parse(this->file->getData() + phOffset + (entry * phSize), header.getEIClass());
+        if (phdr.getType() == triton::format::elf::PT_LOAD && phdr.getFilesz() != 0)
+          this->addArea(phdr.getOffset(), phdr.getFilesz(), phdr.getVaddr());
+      }
+    }
+
+
+    void CoreDump::parseMinidump(void) {
+      const triton::uint8* data = this->file->getData();
+      triton::uint32 streams    = 0;
+      triton::uint32 directory  = 0;
+
+      /* The header: signature, version, number of streams and offset of the stream directory */
+      if (!this->isInside(0, 32))
+        throw triton::exceptions::Format("CoreDump::parseMinidump(): The header of the dump is truncated.");
+
+      std::memcpy(&streams, data + 8, sizeof(streams));
+      std::memcpy(&directory, data + 12, sizeof(directory));
+
+      if (!this->isInside(directory, static_cast<triton::uint64>(streams) * 12))
+        throw triton::exceptions::Format("CoreDump::parseMinidump(): The stream directory of the dump is truncated.");
+
+      for (triton::uint32 index = 0; index < streams; index++) {
+        triton::uint32 type   = 0;
+        triton::uint32 size   = 0;
+        triton::uint32 offset = 0;
+
+        std::memcpy(&type, data + directory + (index * 12), sizeof(type));
+        std::memcpy(&size, data + directory + (index * 12) + 4, sizeof(size));
+        std::memcpy(&offset, data + directory + (index * 12) + 8, sizeof(offset));
+
+        if (!this->isInside(offset, size))
+          throw triton::exceptions::Format("CoreDump::parseMinidump(): A stream of the dump is truncated.");
+
+        /* The descriptors give the address, the size and the offset of every range */
+        if (type == MINIDUMP_MEMORY_LIST && size >= 4) {
+          triton::uint32 count = 0;
+          std::memcpy(&count, data + offset, sizeof(count));
+
+          if (count > (size - 4) / 16)
+            throw triton::exceptions::Format("CoreDump::parseMinidump(): The memory list of the dump is truncated.");
+
+          for (triton::uint32 range = 0; range < count; range++) {
+            triton::uint64 address = 0;
+            triton::uint32 length  = 0;
+            triton::uint32 rva     = 0;
+            std::memcpy(&address, data + offset + 4 + (range * 16), sizeof(address));
+            std::memcpy(&length, data + offset + 4 + (range * 16) + 8, sizeof(length));
+            std::memcpy(&rva, data + offset + 4 + (range * 16) + 12, sizeof(rva));
+            this->addArea(rva, length, address);
+          }
+        }
+
+        /* The descriptors give the address and the size of every range, the ranges follow each other from the base offset */
+        else if (type == MINIDUMP_MEMORY64_LIST && size >= 16) {
+          triton::uint64 count = 0;
+          triton::uint64 rva   = 0;
+          std::memcpy(&count, data + offset, sizeof(count));
+          std::memcpy(&rva, data + offset + 8, sizeof(rva));
+
+          if (count > (size - 16) / 16)
+            throw triton::exceptions::Format("CoreDump::parseMinidump(): The memory list of the dump is truncated.");
+
+          for (triton::uint64 range = 0; range < count; range++) {
+            triton::uint64 address = 0;
+            triton::uint64 length  = 0;
+            std::memcpy(&address, data + offset + 16 + (range * 16), sizeof(address));
+            std::memcpy(&length, data + offset + 16 + (range * 16) + 8, sizeof(length));
+            this->addArea(rva, length, address);
+            rva += length;
+          }
+        }
+      }
+    }
+
+
+    const std::string& CoreDump::getPath(void) const {
+      return this->path;
+    }
+
+
+    const std::shared_ptr<triton::format::MappedFile>& CoreDump::getFile(void) const {
+      return this->file;
+    }
+
+
+    const std::list<triton::format::MemoryMapping>& CoreDump::getMemoryMapping(void) const {
+      return this->memoryMapping;
+    }
+
+  }; /* format namespace */
+}; /* triton namespace */
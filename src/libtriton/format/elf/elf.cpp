@@ -5,9 +5,9 @@
 **  This program is under the terms of the BSD License.
 */
 
-#include <cstdio>
-#include <new>
+#include <cstring>
 
+#include <coreUtils.hpp>
 #include <elf.hpp>
 #include <exceptions.hpp>
 
@@ -18,51 +18,69 @@ namespace triton {
     namespace elf {
 
       Elf::Elf(const std::string& path) {
-        this->path      = path;
-        this->raw       = nullptr;
-        this->totalSize = 0;
+        this->path                   = path;
+        this->raw                    = nullptr;
+        this->totalSize              = 0;
+        this->symbolsTableParsed     = false;
+        this->relocationsTableParsed = false;
+        this->symbolIndexBuilt       = false;
 
         this->open();
         this->parse();
         this->initMemoryMapping();
         this->initDynamicTable();
         this->initSharedLibraries();
-        this->initSymbolsTableViaProgramHeaders();  // .dyntab
-        this->initSymbolsTableViaSectionHeaders();  // .symtab
-        this->initRelTable();                       // DT_REL
-        this->initRelaTable();                      // DT_RELA
-        this->initJmprelTable();                    // DT_JMPREL
       }
 
 
       Elf::~Elf() {
-        delete[] this->raw;
       }
 
 
       void Elf::open(void) {
-        FILE* fd = nullptr;
-
-        // Open the file
-        fd = fopen(this->path.c_str(), "rb");
-        if (fd == nullptr)
+        try {
+          this->file.open(this->path);
+        }
+        catch (const triton::exceptions::Format&) {
           throw triton::exceptions::Elf("Elf::open(): Cannot open the binary file.");
+        }
+
+        this->raw       = this->file.getData();
+        this->totalSize = this->file.getSize();
+      }
+
+
+      bool Elf::isInside(triton::uint64 offset, triton::uint64 size) const {
+        return (offset <= this->totalSize && size <= this->totalSize - offset);
+      }
+
+
+      std::string Elf::getString(triton::uint64 offset) const {
+        const void* end = nullptr;
+
+        if (offset >= this->totalSize)
+          return "";
+
+        end = std::memchr(this->raw + offset, 0, this->totalSize - offset);
+        if (end == nullptr)
+          return std::string(reinterpret_cast<const char*>(this->raw + offset), this->totalSize - offset);
+
+        return std::string(reinterpret_cast<const char*>(this->raw + offset));
+      }
+
 
-        // Get the binary size
-        fseek(fd, 0, SEEK_END);
-        this->totalSize = ftell(fd);
-        rewind(fd);
+      std::shared_ptr<const std::string> Elf::getStringTable(triton::uint64 offset, triton::uint64 size) const {
+        if (!this->isInside(offset, size))
+          return nullptr;
 
-        this->raw = new(std::nothrow) triton::uint8[this->totalSize];
-        if(!this->raw)
-          throw triton::exceptions::Elf("Elf::open(): Not enough memory.");
+        auto it = this->stringTables.find(std::make_pair(offset, size));
+        if (it != this->stringTables.end())
+          return it->second;
 
-        // Read only the magic number
-        if (fread(this->raw, 1, this->totalSize, fd) != this->totalSize)
-          throw triton::exceptions::Elf("Elf::open(): Cannot read the file binary.");
+        std::shared_ptr<const std::string> table = std::make_shared<const std::string>(reinterpret_cast<const char*>(this->raw + offset), size);
+        this->stringTables[std::make_pair(offset, size)] = table;
 
-        // Close the file
-        fclose(fd);
+        return table;
       }
 
 
@@ -78,7 +96,7 @@ namespace triton {
         triton::uint64 strtable = 0;
 
         // Parse the ELF Header
-        if (this->totalSize < this->header.getMaxHeaderSize())
+        if (this->raw == nullptr || this->totalSize < this->header.getMaxHeaderSize())
           throw triton::exceptions::Elf("Elf::parse(): The ELF Header of the binary file is corrupted.");
 
         this->header.parse(this->raw);
@@ -89,7 +107,7 @@ namespace triton {
         phNum    = this->header.getPhnum();
         phSize   = this->header.getPhentsize();
 
-        if (this->totalSize < (phOffset + (phNum * phSize))) {
+        if (!this->isInside(phOffset, phNum * phSize)) {
           std::cerr << "Warning Elf::parse(): Some ELF Program Headers of the binary file are corrupted." << std::endl;
           return false;
         }
@@ -108,7 +126,7 @@ namespace triton {
         if (!shOffset)
           return false;
 
-        if (this->totalSize < (shOffset + (shNum * shSize))) {
+        if (!this->isInside(shOffset, shNum * shSize)) {
           std::cerr << "Warning Elf::parse(): Some ELF Section Headers of the binary file are corrupted." << std::endl;
           return false;
         }
@@ -129,7 +147,7 @@ namespace triton {
 
           strtable = this->sectionHeaders[shstrndx].getOffset();
           for (auto it = this->sectionHeaders.begin(); it != this->sectionHeaders.end(); it++) {
-            it->setName(this->raw + strtable + it->getIdxname());
+            it->setName(this->getString(strtable + it->getIdxname()));
           }
         }
 
@@ -141,7 +159,7 @@ namespace triton {
         for (auto it = this->programHeaders.begin(); it != this->programHeaders.end(); it++) {
           triton::format::MemoryMapping area(this->raw);
 
-          if (this->totalSize < (it->getOffset() + it->getFilesz())) {
+          if (!this->isInside(it->getOffset(), it->getFilesz())) {
             std::cerr << "Warning Elf::initMemoryMapping(): Some ELF Program Headers of the binary file are corrupted." << std::endl;
             continue;
           }
@@ -150,6 +168,15 @@ namespace triton {
           area.setSize(it->getFilesz());
           area.setVirtualAddress(it->getVaddr());
 
+          /* Only loadable segments are zero-filled up to their memory size */
+          if (it->getType() == triton::format::elf::PT_LOAD)
+            area.setVirtualSize(it->getMemsz());
+          else
+            area.setVirtualSize(it->getFilesz());
+
+          /* The other segments overlap the loadable ones */
+          area.setExecutable(it->getType() == triton::format::elf::PT_LOAD && (it->getFlags() & triton::format::elf::PF_X) != 0);
+
           this->memoryMapping.push_back(area);
         }
       }
@@ -158,6 +185,7 @@ namespace triton {
       void Elf::initDynamicTable(void) {
         triton::uint64 dynOffset = 0;
         triton::uint64 dynSize   = 0;
+        triton::uint64 entrySize = 0;
 
         // Get the Dynamic Table offset.
         for (auto it = this->programHeaders.begin(); it != this->programHeaders.end(); it++) {
@@ -167,13 +195,15 @@ namespace triton {
           }
         }
 
-        if (!dynOffset || this->totalSize < dynOffset + dynSize) {
+        if (!dynOffset || !this->isInside(dynOffset, dynSize)) {
           std::cerr << "Warning Elf::initDynamicTable(): The Dynamic Table offset of the binary file is corrupted." << std::endl;
           return;
         }
 
+        entrySize = (this->header.getEIClass() == triton::format::elf::ELFCLASS32) ? sizeof(triton::format::elf::Elf32_Dyn_t) : sizeof(triton::format::elf::Elf64_Dyn_t);
+
         // Parse Dynamic Table.
-        for (triton::uint32 read = 0; read < dynSize;) {
+        for (triton::uint64 read = 0; read + entrySize <= dynSize;) {
           triton::format::elf::ElfDynamicTable dyn;
           read += dyn.parse(this->raw + dynOffset + read, this->header.getEIClass());
           this->dynamicTable.push_back(dyn);
@@ -192,16 +222,17 @@ namespace triton {
 
         for (auto it = this->dynamicTable.begin(); it != this->dynamicTable.end(); it++) {
           if (it->getTag() == triton::format::elf::DT_NEEDED) {
-            this->sharedLibraries.push_back(reinterpret_cast<char*>(this->raw + strTabOffset + it->getValue()));
+            this->sharedLibraries.push_back(this->getString(strTabOffset + it->getValue()));
           }
         }
       }
 
 
-      void Elf::initSymbolsTableViaProgramHeaders(void) {
+      void Elf::initSymbolsTableViaProgramHeaders(void) const {
         triton::uint64 strTabOffset = 0;
         triton::uint64 strTabSize   = 0;
         triton::uint64 symTabOffset = 0;
+        triton::uint64 entrySize    = 0;
         triton::uint64 read         = 0;
 
         strTabOffset = this->getOffsetFromDTValue(triton::format::elf::DT_STRTAB);
@@ -211,7 +242,7 @@ namespace triton {
         }
 
         strTabSize = this->getDTValue(triton::format::elf::DT_STRSZ);
-        if (!strTabSize || this->totalSize < strTabOffset + strTabSize) {
+        if (!strTabSize || !this->isInside(strTabOffset, strTabSize)) {
           std::cerr << "Warning Elf::initSymbolsTableViaProgramHeaders(): The String Table offset of the binary file is corrupted." << std::endl;
           return;
         }
@@ -222,7 +253,11 @@ namespace triton {
           return;
         }
 
-        while (true) {
+        entrySize = (this->header.getEIClass() == triton::format::elf::ELFCLASS32) ? sizeof(triton::format::elf::Elf32_Sym_t) : sizeof(triton::format::elf::Elf64_Sym_t);
+        std::shared_ptr<const std::string> strTab = this->getStringTable(strTabOffset, strTabSize);
+
+        /* The number of dynamic symbols is not given, the table ends at the first invalid entry */
+        while (this->isInside(symTabOffset + read, entrySize)) {
           triton::format::elf::ElfSymbolTable sym;
           read += sym.parse(this->raw + symTabOffset + read, this->header.getEIClass());
 
@@ -232,19 +267,18 @@ namespace triton {
           if (sym.getIdxname() > strTabSize)
             break;
 
-          if (this->totalSize < read)
-            break;
-
-          sym.setName(this->raw + strTabOffset + sym.getIdxname());
+          sym.setStringTable(strTab);
           this->symbolsTable.push_back(sym);
         }
       }
 
 
-      void Elf::initSymbolsTableViaSectionHeaders(void) {
+      void Elf::initSymbolsTableViaSectionHeaders(void) const {
         triton::uint64 strTabOffset = 0;
+        triton::uint64 strTabSize   = 0;
         triton::uint64 symTabOffset = 0;
         triton::uint64 symTabSize   = 0;
+        triton::uint64 entrySize    = 0;
 
         // Get sections.
         for (auto it = this->sectionHeaders.begin(); it != this->sectionHeaders.end(); it++) {
@@ -254,35 +288,48 @@ namespace triton {
             symTabSize   = it->getSize();
           }
 
-          // Get the String Table offset.
+          // Get the String Table offset and size.
           if (it->getName() == ".strtab" && it->getType() == triton::format::elf::SHT_STRTAB) {
             strTabOffset = it->getOffset();
+            strTabSize   = it->getSize();
           }
         }
 
         if (!symTabOffset || !strTabOffset)
           return;
 
-        if (this->totalSize < symTabOffset + symTabSize)
+        if (!this->isInside(symTabOffset, symTabSize))
           return;
 
-        // Parse Symbol Table.
-        for (triton::uint32 read = 0; read < symTabSize;) {
-          triton::format::elf::ElfSymbolTable sym;
+        std::shared_ptr<const std::string> strTab = this->getStringTable(strTabOffset, strTabSize);
+        if (strTab == nullptr)
+          return;
 
-          read += sym.parse(this->raw + symTabOffset + read, this->header.getEIClass());
-          if (this->totalSize < strTabOffset + sym.getIdxname())
+        entrySize = (this->header.getEIClass() == triton::format::elf::ELFCLASS32) ? sizeof(triton::format::elf::Elf32_Sym_t) : sizeof(triton::format::elf::Elf64_Sym_t);
+
+        // Parse Symbol Table, the entries have a fixed size.
+        std::vector<triton::format::elf::ElfSymbolTable> symbols(symTabSize / entrySize);
+        triton::utils::parallelFor(symbols.size(), Elf::entriesPerTask, [&](triton::usize begin, triton::usize end) {
+          for (triton::usize index = begin; index < end; index++)
+            symbols[index].parse(this->raw + symTabOffset + (index * entrySize), this->header.getEIClass());
+        });
+
+        /* The string table is shared once the threads have returned, its counter is not contended */
+        this->symbolsTable.reserve(this->symbolsTable.size() + symbols.size());
+        for (auto it = symbols.begin(); it != symbols.end(); it++) {
+          if (it->getIdxname() >= strTab->size())
             continue;
 
-          sym.setName(this->raw + strTabOffset + sym.getIdxname());
-          this->symbolsTable.push_back(sym);
+          it->setStringTable(strTab);
+          this->symbolsTable.push_back(*it);
         }
       }
 
 
-      void Elf::initRelTable(void) {
+      void Elf::initRelTable(void) const {
         triton::uint64 relTabOffset = 0;
         triton::uint64 relTabSize   = 0;
+        triton::uint64 entrySize    = 0;
 
         // Parse DT_REL table.
         relTabOffset = this->getOffsetFromDTValue(triton::format::elf::DT_REL);
@@ -290,20 +337,24 @@ namespace triton {
           return;
 
         relTabSize = this->getDTValue(triton::format::elf::DT_RELSZ);
-        if (!relTabSize || this->totalSize < relTabOffset + relTabSize)
+        if (!relTabSize || !this->isInside(relTabOffset, relTabSize))
           return;
 
-        for (triton::uint32 read = 0; read < relTabSize;) {
-          triton::format::elf::ElfRelocationTable rel;
-          read += rel.parseRel(this->raw + relTabOffset + read, this->header.getEIClass());
-          this->relocationsTable.push_back(rel);
-        }
+        entrySize = (this->header.getEIClass() == triton::format::elf::ELFCLASS32) ? sizeof(triton::format::elf::Elf32_Rel_t) : sizeof(triton::format::elf::Elf64_Rel_t);
+
+        triton::usize first = this->relocationsTable.size();
+        this->relocationsTable.resize(first + (relTabSize / entrySize));
+        triton::utils::parallelFor(relTabSize / entrySize, Elf::entriesPerTask, [&](triton::usize begin, triton::usize end) {
+          for (triton::usize index = begin; index < end; index++)
+            this->relocationsTable[first + index].parseRel(this->raw + relTabOffset + (index * entrySize), this->header.getEIClass());
+        });
       }
 
 
-      void Elf::initRelaTable(void) {
+      void Elf::initRelaTable(void) const {
         triton::uint64 relaTabOffset = 0;
         triton::uint64 relaTabSize   = 0;
+        triton::uint64 entrySize     = 0;
 
         // Parse DT_RELA table.
         relaTabOffset = this->getOffsetFromDTValue(triton::format::elf::DT_RELA);
@@ -311,20 +362,24 @@ namespace triton {
           return;
 
         relaTabSize = this->getDTValue(triton::format::elf::DT_RELASZ);
-        if (!relaTabSize || this->totalSize < relaTabOffset + relaTabSize)
+        if (!relaTabSize || !this->isInside(relaTabOffset, relaTabSize))
           return;
 
-        for (triton::uint32 read = 0; read < relaTabSize;) {
-          triton::format::elf::ElfRelocationTable rela;
-          read += rela.parseRela(this->raw + relaTabOffset + read, this->header.getEIClass());
-          this->relocationsTable.push_back(rela);
-        }
+        entrySize = (this->header.getEIClass() == triton::format::elf::ELFCLASS32) ? sizeof(triton::format::elf::Elf32_Rela_t) : sizeof(triton::format::elf::Elf64_Rela_t);
+
+        triton::usize first = this->relocationsTable.size();
+        this->relocationsTable.resize(first + (relaTabSize / entrySize));
+        triton::utils::parallelFor(relaTabSize / entrySize, Elf::entriesPerTask, [&](triton::usize begin, triton::usize end) {
+          for (triton::usize index = begin; index < end; index++)
+            this->relocationsTable[first + index].parseRela(this->raw + relaTabOffset + (index * entrySize), this->header.getEIClass());
+        });
       }
 
 
-      void Elf::initJmprelTable(void) {
+      void Elf::initJmprelTable(void) const {
         triton::uint64 jmprelTabOffset = 0;
         triton::uint64 jmprelTabSize   = 0;
+        triton::uint64 entrySize       = 0;
 
         // Parse DT_JMPREL table.
         jmprelTabOffset = this->getOffsetFromDTValue(triton::format::elf::DT_JMPREL);
@@ -332,19 +387,24 @@ namespace triton {
           return;
 
         jmprelTabSize = this->getDTValue(triton::format::elf::DT_PLTRELSZ);
-        if (!jmprelTabSize || this->totalSize < jmprelTabOffset + jmprelTabSize)
+        if (!jmprelTabSize || !this->isInside(jmprelTabOffset, jmprelTabSize))
           return;
 
-        for (triton::uint32 read = 0; read < jmprelTabSize;) {
-          triton::format::elf::ElfRelocationTable jmprel;
-          if (this->header.getEIClass() == triton::format::elf::ELFCLASS32)
-            read += jmprel.parseRel(this->raw + jmprelTabOffset + read, this->header.getEIClass());
-          else if (this->header.getEIClass() == triton::format::elf::ELFCLASS64)
-            read += jmprel.parseRela(this->raw + jmprelTabOffset + read, this->header.getEIClass());
-          else
-            throw triton::exceptions::Elf("Elf::initJmprelTable(): Invalid EI_CLASS.");
-          this->relocationsTable.push_back(jmprel);
-        }
+        entrySize = (this->header.getEIClass() == triton::format::elf::ELFCLASS32) ? sizeof(triton::format::elf::Elf32_Rel_t) : sizeof(triton::format::elf::Elf64_Rela_t);
+
+        if (this->header.getEIClass() != triton::format::elf::ELFCLASS32 && this->header.getEIClass() != triton::format::elf::ELFCLASS64)
+          throw triton::exceptions::Elf("Elf::initJmprelTable(): Invalid EI_CLASS.");
+
+        triton::usize first = this->relocationsTable.size();
+        this->relocationsTable.resize(first + (jmprelTabSize / entrySize));
+        triton::utils::parallelFor(jmprelTabSize / entrySize, Elf::entriesPerTask, [&](triton::usize begin, triton::usize end) {
+          for (triton::usize index = begin; index < end; index++) {
+            if (this->header.getEIClass() == triton::format::elf::ELFCLASS32)
+              this->relocationsTable[first + index].parseRel(this->raw + jmprelTabOffset + (index * entrySize), this->header.getEIClass());
+            else
+              this->relocationsTable[first + index].parseRela(this->raw + jmprelTabOffset + (index * entrySize), this->header.getEIClass());
+          }
+        });
       }
 
 
@@ -421,15 +481,52 @@ namespace triton {
 
 
       const std::vector<triton::format::elf::ElfSymbolTable>& Elf::getSymbolsTable(void) const {
+        if (!this->symbolsTableParsed) {
+          this->symbolsTableParsed = true;
+          this->initSymbolsTableViaProgramHeaders();  // .dyntab
+          this->initSymbolsTableViaSectionHeaders();  // .symtab
+        }
         return this->symbolsTable;
       }
 
 
       const std::vector<triton::format::elf::ElfRelocationTable>& Elf::getRelocationTable(void) const {
+        if (!this->relocationsTableParsed) {
+          this->relocationsTableParsed = true;
+          this->initRelTable();                       // DT_REL
+          this->initRelaTable();                      // DT_RELA
+          this->initJmprelTable();                    // DT_JMPREL
+        }
         return this->relocationsTable;
       }
 
 
+      const triton::format::SymbolIndex& Elf::getSymbolIndex(void) const {
+        if (this->symbolIndexBuilt)
+          return this->symbolIndex;
+
+        const std::vector<triton::format::elf::ElfSymbolTable>& symbols = this->getSymbolsTable();
+        const std::vector<triton::format::elf::ElfRelocationTable>& relocations = this->getRelocationTable();
+
+        this->symbolIndexBuilt = true;
+
+        for (auto it = symbols.begin(); it != symbols.end(); it++) {
+          if (it->getShndx() != triton::format::elf::SHN_UNDEF)
+            this->symbolIndex.addSymbol(it->getName(), it->getValue(), it->getSize());
+        }
+
+        /* Relocations index the dynamic symbols, which are the first ones of the symbols table */
+        for (auto it = relocations.begin(); it != relocations.end(); it++) {
+          if (it->getSymidx() && it->getSymidx() < symbols.size())
+            this->symbolIndex.addRelocation(symbols[it->getSymidx()].getName(), it->getOffset());
+        }
+
+        this->symbolIndex.build();
+
+        return this->symbolIndex;
+      }
+
+
       const std::vector<std::string>& Elf::getSharedLibraries(void) const {
         return this->sharedLibraries;
       }
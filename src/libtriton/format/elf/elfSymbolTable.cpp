@@ -27,13 +27,14 @@ namespace triton {
 
 
       ElfSymbolTable::ElfSymbolTable(const ElfSymbolTable& copy) {
-        this->idxname = copy.idxname;
-        this->name    = copy.name;
-        this->info    = copy.info;
-        this->other   = copy.other;
-        this->shndx   = copy.shndx;
-        this->value   = copy.value;
-        this->size    = copy.size;
+        this->idxname     = copy.idxname;
+        this->name        = copy.name;
+        this->stringTable = copy.stringTable;
+        this->info        = copy.info;
+        this->other       = copy.other;
+        this->shndx       = copy.shndx;
+        this->value       = copy.value;
+        this->size        = copy.size;
       }
 
 
@@ -42,13 +43,14 @@ namespace triton {
 
 
       void ElfSymbolTable::operator=(const ElfSymbolTable& copy) {
-        this->idxname = copy.idxname;
-        this->name    = copy.name;
-        this->info    = copy.info;
-        this->other   = copy.other;
-        this->shndx   = copy.shndx;
-        this->value   = copy.value;
-        this->size    = copy.size;
+        this->idxname     = copy.idxname;
+        this->name        = copy.name;
+        this->stringTable = copy.stringTable;
+        this->info        = copy.info;
+        this->other       = copy.other;
+        this->shndx       = copy.shndx;
+        this->value       = copy.value;
+        this->size        = copy.size;
       }
 
 
@@ -89,8 +91,15 @@ namespace triton {
       }
 
 
-      const std::string& ElfSymbolTable::getName(void) const {
-        return this->name;
+      std::string ElfSymbolTable::getName(void) const {
+        if (this->stringTable == nullptr)
+          return this->name;
+
+        /* The table is NUL-terminated by its std::string */
+        if (this->idxname >= this->stringTable->size())
+          return "";
+
+        return std::string(this->stringTable->c_str() + this->idxname);
       }
 
 
@@ -101,6 +110,13 @@ namespace triton {
 
       void ElfSymbolTable::setName(const std::string& name) {
         this->name = name;
+        this->stringTable.reset();
+      }
+
+
+      void ElfSymbolTable::setStringTable(const std::shared_ptr<const std::string>& table) {
+        this->stringTable = table;
+        this->name.clear();
       }
 
 
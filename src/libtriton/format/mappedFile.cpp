@@ -0,0 +1,140 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#if defined(_WIN32)
+  #include <windows.h>
+#else
+  #include <fcntl.h>
+  #include <sys/mman.h>
+  #include <sys/stat.h>
+  #include <unistd.h>
+#endif
+
+#include <exceptions.hpp>
+#include <mappedFile.hpp>
+
+
+
+namespace triton {
+  namespace format {
+
+    MappedFile::MappedFile() {
+      this->data = nullptr;
+      this->size = 0;
+      #if defined(_WIN32)
+      this->mapping = nullptr;
+      #endif
+    }
+
+
+    MappedFile::~MappedFile() {
+      this->close();
+    }
+
+
+    #if defined(_WIN32)
+    void MappedFile::open(const std::string& path) {
+      LARGE_INTEGER fileSize;
+      HANDLE file = INVALID_HANDLE_VALUE;
+
+      this->close();
+
+      file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+      if (file == INVALID_HANDLE_VALUE)
+        throw triton::exceptions::Format("MappedFile::open(): Cannot open the binary file.");
+
+      if (!GetFileSizeEx(file, &fileSize)) {
+        CloseHandle(file);
+        throw triton::exceptions::Format("MappedFile::open(): Cannot get the size of the binary file.");
+      }
+
+      /* An empty file cannot be mapped */
+      this->size = static_cast<triton::usize>(fileSize.QuadPart);
+      if (this->size == 0) {
+        CloseHandle(file);
+        return;
+      }
+
+      this->mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+      CloseHandle(file);
+      if (this->mapping == nullptr) {
+        this->size = 0;
+        throw triton::exceptions::Format("MappedFile::open(): Cannot map the binary file.");
+      }
+
+      this->data = reinterpret_cast<const triton::uint8*>(MapViewOfFile(this->mapping, FILE_MAP_READ, 0, 0, 0));
+      if (this->data == nullptr) {
+        this->close();
+        throw triton::exceptions::Format("MappedFile::open(): Cannot map the binary file.");
+      }
+    }
+
+
+    void MappedFile::close(void) {
+      if (this->data != nullptr)
+        UnmapViewOfFile(this->data);
+      if (this->mapping != nullptr)
+        CloseHandle(this->mapping);
+      this->data    = nullptr;
+      this->mapping = nullptr;
+      this->size    = 0;
+    }
+
+    #else
+    void MappedFile::open(const std::string& path) {
+      struct stat st;
+      void* area = nullptr;
+      int fd     = -1;
+
+      this->close();
+
+      fd = ::open(path.c_str(), O_RDONLY);
+      if (fd < 0)
+        throw triton::exceptions::Format("MappedFile::open(): Cannot open the binary file.");
+
+      if (fstat(fd, &st) != 0) {
+        ::close(fd);
+        throw triton::exceptions::Format("MappedFile::open(): Cannot get the size of the binary file.");
+      }
+
+      /* An empty file cannot be mapped */
+      if (st.st_size == 0) {
+        ::close(fd);
+        return;
+      }
+
+      /* The mapping stays valid once the descriptor is closed */
+      area = mmap(nullptr, static_cast<size_t>(st.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+      ::close(fd);
+      if (area == MAP_FAILED)
+        throw triton::exceptions::Format("MappedFile::open(): Cannot map the binary file.");
+
+      this->data = reinterpret_cast<const triton::uint8*>(area);
+      this->size = static_cast<triton::usize>(st.st_size);
+    }
+
+
+    void MappedFile::close(void) {
+      if (this->data != nullptr)
+        munmap(const_cast<triton::uint8*>(this->data), this->size);
+      this->data = nullptr;
+      this->size = 0;
+    }
+    #endif
+
+
+    const triton::uint8* MappedFile::getData(void) const {
+      return this->data;
+    }
+
+
+    triton::usize MappedFile::getSize(void) const {
+      return this->size;
+    }
+
+  }; /* format namespace */
+}; /* triton namespace */
@@ -18,6 +18,8 @@ namespace triton {
       this->offset          = 0;
       this->virtualAddress  = 0;
       this->size            = 0;
+      this->virtualSize     = 0;
+      this->executable      = false;
 
       if (!this->binary)
         throw triton::exceptions::Format("MemoryMapping::MemoryMapping(): The binary pointer cannot be null");
@@ -29,6 +31,8 @@ namespace triton {
       this->offset          = copy.offset;
       this->virtualAddress  = copy.virtualAddress;
       this->size            = copy.size;
+      this->virtualSize     = copy.virtualSize;
+      this->executable      = copy.executable;
     }
 
 
@@ -41,6 +45,8 @@ namespace triton {
       this->offset          = copy.offset;
       this->virtualAddress  = copy.virtualAddress;
       this->size            = copy.size;
+      this->virtualSize     = copy.virtualSize;
+      this->executable      = copy.executable;
     }
 
 
@@ -59,6 +65,11 @@ namespace triton {
     }
 
 
+    triton::uint64 MemoryMapping::getVirtualSize(void) const {
+      return this->virtualSize;
+    }
+
+
     const triton::uint8* MemoryMapping::getMemoryArea(void) const {
       return (this->binary + this->offset);
     }
@@ -69,6 +80,11 @@ namespace triton {
     }
 
 
+    bool MemoryMapping::isExecutable(void) const {
+      return this->executable;
+    }
+
+
     void MemoryMapping::setOffset(triton::uint64 offset) {
       this->offset = offset;
     }
@@ -83,5 +99,15 @@ namespace triton {
       this->size = size;
     }
 
+
+    void MemoryMapping::setVirtualSize(triton::uint64 virtualSize) {
+      this->virtualSize = virtualSize;
+    }
+
+
+    void MemoryMapping::setExecutable(bool flag) {
+      this->executable = flag;
+    }
+
   }; /* format namespace */
 }; /* triton namespace */
@@ -5,9 +5,9 @@
 **  This program is under the terms of the BSD License.
 */
 
-#include <cstdio>
-#include <new>
+#include <tuple>
 
+#include <coreUtils.hpp>
 #include <exceptions.hpp>
 #include <pe.hpp>
 
@@ -18,9 +18,10 @@ namespace triton {
     namespace pe {
 
       Pe::Pe(const std::string& path) {
-        this->path      = path;
-        this->raw       = nullptr;
-        this->totalSize = 0;
+        this->path             = path;
+        this->raw              = nullptr;
+        this->totalSize        = 0;
+        this->symbolIndexBuilt = false;
 
         this->open();
         this->parse();
@@ -31,37 +32,26 @@ namespace triton {
 
 
       Pe::~Pe() {
-        delete[] this->raw;
       }
 
 
       void Pe::open(void) {
-        FILE* fd = nullptr;
-
-        // Open the file
-        fd = fopen(this->path.c_str(), "rb");
-        if (fd == nullptr)
+        try {
+          this->file.open(this->path);
+        }
+        catch (const triton::exceptions::Format&) {
           throw triton::exceptions::Pe("Pe::open(): Cannot open the binary file.");
+        }
 
-        // Get the binary size
-        fseek(fd, 0, SEEK_END);
-        this->totalSize = ftell(fd);
-        rewind(fd);
-
-        this->raw = new(std::nothrow) triton::uint8[this->totalSize];
-        if(!this->raw)
-          throw triton::exceptions::Pe("Pe::open(): Not enough memory.");
-
-        // Read the file contents
-        if (fread(this->raw, 1, this->totalSize, fd) != this->totalSize)
-          throw triton::exceptions::Pe("Pe::open(): Cannot read the binary file.");
-
-        // Close the file
-        fclose(fd);
+        this->raw       = this->file.getData();
+        this->totalSize = this->file.getSize();
       }
 
 
       bool Pe::parse(void) {
+        if (this->raw == nullptr)
+          throw triton::exceptions::Pe("Pe::parse(): The binary file is empty.");
+
         this->header.parse(this->raw, this->totalSize);
         return true;
       }
@@ -81,6 +71,8 @@ namespace triton {
           area.setOffset(rawAddr);
           area.setSize(rawSize);
           area.setVirtualAddress(virtAddr);
+          area.setVirtualSize(section.getVirtualSize());
+          area.setExecutable((section.getCharacteristics() & triton::format::pe::IMAGE_SCN_MEM_EXECUTE) != 0);
 
           this->memoryMapping.push_back(area);
         }
@@ -120,22 +112,24 @@ namespace triton {
         if (addrTableStart + (this->exportTable.getAddressTableEntries() * sizeof(triton::uint32)) >= totalSize)
           throw triton::exceptions::Pe("Pe::initExportTable(): export address table runs past end of file");
 
-        std::vector<PeExportEntry> entries;
-        for (triton::usize i = 0; i < this->exportTable.getAddressTableEntries(); ++i) {
-          PeExportEntry entry;
-          triton::uint32 exportRVA;
-          std::memcpy(&exportRVA, raw + addrTableStart + (sizeof(exportRVA) * i), sizeof(exportRVA));
-          if (exportRVA >= exportStart && exportRVA < exportStart + exportSize) {
-            entry.isForward     = true;
-            entry.forwarderRVA  = exportRVA;
-            entry.forwarderName = std::string(reinterpret_cast<const char*>(raw + this->getOffsetFromAddress(exportRVA)));
-          }
-          else {
-            entry.isForward = false;
-            entry.exportRVA = exportRVA;
+        /* The entries have a fixed size, they are decoded by chunks */
+        std::vector<PeExportEntry> entries(this->exportTable.getAddressTableEntries());
+        triton::utils::parallelFor(entries.size(), Pe::entriesPerTask, [&](triton::usize begin, triton::usize end) {
+          for (triton::usize i = begin; i < end; ++i) {
+            PeExportEntry& entry = entries[i];
+            triton::uint32 exportRVA;
+            std::memcpy(&exportRVA, raw + addrTableStart + (sizeof(exportRVA) * i), sizeof(exportRVA));
+            if (exportRVA >= exportStart && exportRVA < exportStart + exportSize) {
+              entry.isForward     = true;
+              entry.forwarderRVA  = exportRVA;
+              entry.forwarderName = std::string(reinterpret_cast<const char*>(raw + this->getOffsetFromAddress(exportRVA)));
+            }
+            else {
+              entry.isForward = false;
+              entry.exportRVA = exportRVA;
+            }
           }
-          entries.push_back(std::move(entry));
-        }
+        });
 
         triton::uint64 nameTableStart = this->getOffsetFromAddress(this->exportTable.getNamePointerRVA());
         if (nameTableStart + (this->exportTable.getNumberOfNamePointers() * sizeof(triton::uint32)) >= totalSize)
@@ -145,16 +139,26 @@ namespace triton {
         if (ordTableStart + (this->exportTable.getNumberOfNamePointers() * sizeof(triton::uint16)) >= totalSize)
           throw triton::exceptions::Pe("Pe::initExportTable(): export ordinal table runs past end of file");
 
-        for (triton::usize i = 0; i < this->exportTable.getNumberOfNamePointers(); ++i) {
-          triton::uint16 ordinal;
-          triton::uint32 nameRVA;
+        /* The names are decoded by chunks, then given to their entries in order since two names may share an ordinal */
+        std::vector<std::tuple<triton::uint16, triton::uint32, std::string>> names(this->exportTable.getNumberOfNamePointers());
+        triton::utils::parallelFor(names.size(), Pe::entriesPerTask, [&](triton::usize begin, triton::usize end) {
+          for (triton::usize i = begin; i < end; ++i) {
+            triton::uint16 ordinal;
+            triton::uint32 nameRVA;
+
+            std::memcpy(&ordinal, raw + (ordTableStart + sizeof(ordinal) * i), sizeof(ordinal));
+            std::memcpy(&nameRVA, raw + (nameTableStart + sizeof(nameRVA) * i), sizeof(nameRVA));
 
-          std::memcpy(&ordinal, raw + (ordTableStart + sizeof(ordinal) * i), sizeof(ordinal));
-          std::memcpy(&nameRVA, raw + (nameTableStart + sizeof(nameRVA) * i), sizeof(nameRVA));
+            names[i] = std::make_tuple(ordinal, nameRVA, std::string(reinterpret_cast<const char *>(raw + this->getOffsetFromAddress(nameRVA))));
+          }
+        });
+
+        for (auto&& name : names) {
+          triton::uint16 ordinal = std::get<0>(name);
 
           entries[ordinal].ordinal        = ordinal;
-          entries[ordinal].exportNameRVA  = nameRVA;
-          entries[ordinal].exportName     = std::string(reinterpret_cast<const char *>(raw + this->getOffsetFromAddress(nameRVA)));
+          entries[ordinal].exportNameRVA  = std::get<1>(name);
+          entries[ordinal].exportName     = std::move(std::get<2>(name));
         }
 
         for (const PeExportEntry& entry : entries)
@@ -173,7 +177,9 @@ namespace triton {
         triton::uint64 byNameMask   = (format == PE_FORMAT_PE32PLUS ? 0x8000000000000000 : 0x80000000);
         triton::uint32 entrySize    = (format == PE_FORMAT_PE32PLUS ? sizeof(triton::uint64) : sizeof(triton::uint32));
         triton::uint64 pos          = importOffset;
+        std::vector<PeImportDirectory> directories;
 
+        /* The directory table ends at the first null entry */
         while (true) {
           PeImportDirectory impdt;
 
@@ -181,31 +187,41 @@ namespace triton {
             break;
 
           impdt.setName(std::string(reinterpret_cast<const char*>(raw + this->getOffsetFromAddress(impdt.getNameRVA()))));
-          triton::uint64 impLookupTable = this->getOffsetFromAddress(impdt.getImportLookupTableRVA());
-          triton::uint64 importEntry = 0;
-          std::memcpy(&importEntry, raw + impLookupTable, entrySize);
-
-          while (importEntry > 0) {
-            PeImportLookup entry;
-            entry.importByName = !(importEntry & byNameMask);
-
-            if (entry.importByName) {
-              triton::uint64 hintNameStart = this->getOffsetFromAddress(importEntry & ((1u << 31) - 1));
-              std::memcpy(&entry.ordinalNumber, raw + hintNameStart, sizeof(entry.ordinalNumber));
-              entry.name = std::string(reinterpret_cast<const char*>(raw + hintNameStart + 2));
-            }
-            else {
-              entry.ordinalNumber = importEntry & ((1 << 16) - 1);
-            }
+          directories.push_back(impdt);
+          pos += 20;
+        }
 
-            impdt.addEntry(entry);
-            impLookupTable += entrySize;
+        /* The lookup tables of the libraries are independent, each of them is decoded by a task */
+        triton::utils::parallelFor(directories.size(), 1, [&](triton::usize begin, triton::usize end) {
+          for (triton::usize index = begin; index < end; index++) {
+            PeImportDirectory& impdt = directories[index];
+            triton::uint64 impLookupTable = this->getOffsetFromAddress(impdt.getImportLookupTableRVA());
+            triton::uint64 importEntry = 0;
             std::memcpy(&importEntry, raw + impLookupTable, entrySize);
+
+            while (importEntry > 0) {
+              PeImportLookup entry;
+              entry.importByName = !(importEntry & byNameMask);
+
+              if (entry.importByName) {
+                triton::uint64 hintNameStart = this->getOffsetFromAddress(importEntry & ((1u << 31) - 1));
+                std::memcpy(&entry.ordinalNumber, raw + hintNameStart, sizeof(entry.ordinalNumber));
+                entry.name = std::string(reinterpret_cast<const char*>(raw + hintNameStart + 2));
+              }
+              else {
+                entry.ordinalNumber = importEntry & ((1 << 16) - 1);
+              }
+
+              impdt.addEntry(entry);
+              impLookupTable += entrySize;
+              std::memcpy(&importEntry, raw + impLookupTable, entrySize);
+            }
           }
+        });
 
+        for (auto&& impdt : directories) {
           importTable.push_back(impdt);
           dlls.push_back(impdt.getName());
-          pos += 20;
         }
       }
 
@@ -240,6 +256,33 @@ namespace triton {
       }
 
 
+      const triton::format::SymbolIndex& Pe::getSymbolIndex(void) const {
+        if (this->symbolIndexBuilt)
+          return this->symbolIndex;
+
+        this->symbolIndexBuilt = true;
+
+        for (auto&& entry : this->exportTable.getEntries()) {
+          if (!entry.isForward)
+            this->symbolIndex.addSymbol(entry.exportName, entry.exportRVA, 0);
+        }
+
+        /* Imports by name are resolved in the import address table */
+        triton::uint32 entrySize = (this->header.getOptionalHeader().getMagic() == PE_FORMAT_PE32PLUS ? sizeof(triton::uint64) : sizeof(triton::uint32));
+        for (auto&& impdt : this->importTable) {
+          const std::vector<PeImportLookup>& entries = impdt.getEntries();
+          for (triton::usize i = 0; i < entries.size(); i++) {
+            if (entries[i].importByName)
+              this->symbolIndex.addRelocation(entries[i].name, impdt.getImportAddressTableRVA() + (i * entrySize));
+          }
+        }
+
+        this->symbolIndex.build();
+
+        return this->symbolIndex;
+      }
+
+
       const std::vector<std::string>& Pe::getSharedLibraries(void) const {
         return this->dlls;
       }
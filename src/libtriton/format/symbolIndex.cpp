@@ -0,0 +1,99 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#include <algorithm>
+#include <utility>
+
+#include <exceptions.hpp>
+#include <symbolIndex.hpp>
+
+
+
+namespace triton {
+  namespace format {
+
+    bool SymbolIndex::Symbol::operator<(const Symbol& other) const {
+      if (this->address != other.address)
+        return (this->address < other.address);
+      return (this->size < other.size);
+    }
+
+
+    void SymbolIndex::addSymbol(const std::string& name, triton::uint64 address, triton::uint64 size) {
+      Symbol symbol;
+
+      if (name.empty())
+        return;
+
+      /* The first definition of a name wins */
+      if (!this->addresses.insert(std::make_pair(name, address)).second)
+        return;
+
+      symbol.address = address;
+      symbol.size    = size;
+      symbol.name    = name;
+      this->symbols.push_back(symbol);
+    }
+
+
+    void SymbolIndex::addRelocation(const std::string& name, triton::uint64 address) {
+      if (name.empty())
+        return;
+      this->relocations.insert(std::make_pair(name, address));
+    }
+
+
+    void SymbolIndex::build(void) {
+      std::stable_sort(this->symbols.begin(), this->symbols.end());
+    }
+
+
+    bool SymbolIndex::isSymbolDefined(const std::string& name) const {
+      return (this->addresses.find(name) != this->addresses.end());
+    }
+
+
+    triton::uint64 SymbolIndex::getSymbolAddress(const std::string& name) const {
+      auto it = this->addresses.find(name);
+      if (it == this->addresses.end())
+        throw triton::exceptions::Format("SymbolIndex::getSymbolAddress(): Symbol not found.");
+      return it->second;
+    }
+
+
+    std::string SymbolIndex::getSymbolName(triton::uint64 address) const {
+      Symbol key;
+
+      /* The last symbol starting at or before the address (the largest one among equal addresses) */
+      key.address = address;
+      key.size    = static_cast<triton::uint64>(-1);
+      auto it = std::upper_bound(this->symbols.begin(), this->symbols.end(), key);
+      if (it == this->symbols.begin())
+        return "";
+      --it;
+
+      if (address - it->address < it->size || address == it->address)
+        return it->name;
+
+      return "";
+    }
+
+
+    bool SymbolIndex::isRelocationDefined(const std::string& name) const {
+      return (this->relocations.find(name) != this->relocations.end());
+    }
+
+
+    triton::uint64 SymbolIndex::getRelocationAddress(const std::string& name) const {
+      auto it = this->relocations.find(name);
+      if (it == this->relocations.end())
+        throw triton::exceptions::Format("SymbolIndex::getRelocationAddress(): Relocation not found.");
+      return it->second;
+    }
+
+  }; /* format namespace */
+}; /* triton namespace */
@@ -0,0 +1,458 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#include <algorithm>
+#include <cstring>
+
+#include <exceptions.hpp>
+#include <traceFile.hpp>
+
+
+
+namespace triton {
+  namespace format {
+
+    /* The magic number and the version of the trace files. The first version has no chunks */
+    static const triton::uint8 traceMagic[8] = {'T', 'R', 'I', 'T', 'O', 'N', 'T', 'R'};
+    static const triton::uint8 traceVersion  = 2;
+
+    /* The footer of an indexed trace: the offset of the index (64 bits, little endian) and a magic number */
+    static const triton::uint8 indexMagic[8] = {'T', 'R', 'I', 'T', 'O', 'N', 'I', 'X'};
+    static const triton::usize footerSize    = 16;
+
+    /* The largest register (zmm) */
+    static const triton::uint32 maxRegisterSize = 64;
+
+
+    TraceWriter::TraceWriter() {
+      this->chunkSize         = defaultChunkSize;
+      this->count             = 0;
+      this->lastMemoryAddress = 0;
+      this->nextAddress       = 0;
+      this->offset            = 0;
+    }
+
+
+    void TraceWriter::writeVarint(triton::uint64 value) {
+      triton::uint8 buffer[10];
+      triton::usize size = 0;
+
+      do {
+        buffer[size] = static_cast<triton::uint8>(value & 0x7f);
+        value >>= 7;
+        if (value)
+          buffer[size] |= 0x80;
+        size++;
+      } while (value);
+
+      this->writeBytes(buffer, size);
+    }
+
+
+    void TraceWriter::writeSignedVarint(triton::sint64 value) {
+      /* Zigzag encoding, so small negative deltas stay small */
+      this->writeVarint((static_cast<triton::uint64>(value) << 1) ^ static_cast<triton::uint64>(value >> 63));
+    }
+
+
+    void TraceWriter::writeBytes(const triton::uint8* data, triton::usize size) {
+      this->stream.write(reinterpret_cast<const char*>(data), size);
+      this->offset += size;
+    }
+
+
+    void TraceWriter::writeIndex(void) {
+      triton::uint64 index = this->offset;
+      triton::uint8 footer[8];
+
+      this->writeVarint(this->chunks.size());
+      for (const auto& chunk : this->chunks) {
+        this->writeVarint(chunk.offset);
+        this->writeVarint(chunk.firstInstruction);
+        this->writeVarint(chunk.nextAddress);
+        this->writeVarint(chunk.lastMemoryAddress);
+      }
+      this->writeVarint(this->count);
+
+      for (triton::uint32 i = 0; i < sizeof(footer); i++)
+        footer[i] = static_cast<triton::uint8>(index >> (i * 8));
+      this->writeBytes(footer, sizeof(footer));
+      this->writeBytes(indexMagic, sizeof(indexMagic));
+    }
+
+
+    void TraceWriter::open(const std::string& path, triton::uint32 architecture, triton::usize chunkSize) {
+      this->close();
+
+      if (chunkSize == 0)
+        throw triton::exceptions::Format("TraceWriter::open(): Invalid size of chunk.");
+      this->chunkSize = chunkSize;
+
+      this->stream.open(path.c_str(), std::ios::out | std::ios::binary | std::ios::trunc);
+      if (!this->stream.is_open())
+        throw triton::exceptions::Format("TraceWriter::open(): Cannot create the trace file.");
+
+      this->writeBytes(traceMagic, sizeof(traceMagic));
+      this->writeBytes(&traceVersion, 1);
+      this->writeVarint(architecture);
+    }
+
+
+    bool TraceWriter::isOpen(void) const {
+      return this->stream.is_open();
+    }
+
+
+    void TraceWriter::write(const TraceInstruction& inst) {
+      std::vector<std::pair<triton::uint32, triton::uint512>> changed;
+
+      if (!this->stream.is_open())
+        throw triton::exceptions::Format("TraceWriter::write(): No trace file is open.");
+
+      if (inst.opcodes.size() > 0xff)
+        throw triton::exceptions::Format("TraceWriter::write(): Invalid size of opcodes.");
+
+      /* A new chunk, the registers of each thread are written again */
+      if (this->count % this->chunkSize == 0) {
+        TraceChunk chunk;
+        chunk.offset            = this->offset;
+        chunk.firstInstruction  = this->count;
+        chunk.nextAddress       = this->nextAddress;
+        chunk.lastMemoryAddress = this->lastMemoryAddress;
+        this->chunks.push_back(chunk);
+        this->registers.clear();
+      }
+      this->count++;
+
+      std::map<triton::uint32, triton::uint512>& last = this->registers[inst.threadId];
+      for (const auto& reg : inst.registers) {
+        auto it = last.find(reg.first);
+        if (it == last.end() || it->second != reg.second) {
+          last[reg.first] = reg.second;
+          changed.push_back(reg);
+        }
+      }
+
+      /* Instruction */
+      this->writeVarint(inst.threadId);
+      this->writeSignedVarint(static_cast<triton::sint64>(inst.address - this->nextAddress));
+      this->writeVarint(inst.opcodes.size());
+      this->writeBytes(inst.opcodes.data(), inst.opcodes.size());
+      this->nextAddress = inst.address + inst.opcodes.size();
+
+      /* Registers, without their leading zero bytes */
+      this->writeVarint(changed.size());
+      for (const auto& reg : changed) {
+        triton::uint8 buffer[maxRegisterSize];
+        triton::uint512 value = reg.second;
+        triton::uint8 size    = 0;
+
+        while (value != 0 && size < maxRegisterSize) {
+          buffer[size++] = static_cast<triton::uint8>((value & 0xff).convert_to<triton::uint32>());
+          value >>= 8;
+        }
+
+        this->writeVarint(reg.first);
+        this->writeBytes(&size, 1);
+        this->writeBytes(buffer, size);
+      }
+
+      /* Memory reads */
+      this->writeVarint(inst.memoryReads.size());
+      for (const auto& mem : inst.memoryReads) {
+        this->writeSignedVarint(static_cast<triton::sint64>(mem.first - this->lastMemoryAddress));
+        this->writeVarint(mem.second.size());
+        this->writeBytes(mem.second.data(), mem.second.size());
+        this->lastMemoryAddress = mem.first;
+      }
+    }
+
+
+    void TraceWriter::close(void) {
+      if (this->stream.is_open()) {
+        this->writeIndex();
+        this->stream.close();
+      }
+      this->count             = 0;
+      this->lastMemoryAddress = 0;
+      this->nextAddress       = 0;
+      this->offset            = 0;
+      this->chunks.clear();
+      this->registers.clear();
+    }
+
+
+    TraceReader::TraceReader() {
+      this->architecture      = 0;
+      this->count             = 0;
+      this->end               = 0;
+      this->indexed           = false;
+      this->lastMemoryAddress = 0;
+      this->nextAddress       = 0;
+      this->offset            = 0;
+      this->position          = 0;
+    }
+
+
+    triton::uint64 TraceReader::readVarint(void) {
+      triton::uint64 value = 0;
+      triton::uint32 shift = 0;
+
+      while (true) {
+        triton::uint8 byte = *this->readBytes(1);
+        if (shift >= 64)
+          throw triton::exceptions::Format("TraceReader::readVarint(): Invalid integer.");
+        value |= static_cast<triton::uint64>(byte & 0x7f) << shift;
+        if ((byte & 0x80) == 0)
+          break;
+        shift += 7;
+      }
+
+      return value;
+    }
+
+
+    triton::sint64 TraceReader::readSignedVarint(void) {
+      triton::uint64 value = this->readVarint();
+      return static_cast<triton::sint64>((value >> 1) ^ (~(value & 1) + 1));
+    }
+
+
+    const triton::uint8* TraceReader::readBytes(triton::usize size) {
+      const triton::uint8* data = this->file.getData() + this->offset;
+
+      if (this->offset > this->end || size > this->end - this->offset)
+        throw triton::exceptions::Format("TraceReader::readBytes(): The trace file is truncated.");
+
+      this->offset += size;
+      return data;
+    }
+
+
+    void TraceReader::readIndex(triton::usize header) {
+      triton::usize size = this->file.getSize();
+      triton::uint64 index = 0;
+
+      this->chunks.clear();
+      this->count   = 0;
+      this->end     = size;
+      this->indexed = false;
+
+      if (size >= header + footerSize && std::memcmp(this->file.getData() + size - sizeof(indexMagic), indexMagic, sizeof(indexMagic)) == 0) {
+        const triton::uint8* footer = this->file.getData() + size - footerSize;
+        for (triton::uint32 i = 0; i < 8; i++)
+          index |= static_cast<triton::uint64>(footer[i]) << (i * 8);
+
+        if (index < header || index > size - footerSize)
+          throw triton::exceptions::Format("TraceReader::readIndex(): Invalid index.");
+
+        this->offset = static_cast<triton::usize>(index);
+        this->end    = size - footerSize;
+
+        triton::uint64 chunks = this->readVarint();
+        for (triton::uint64 i = 0; i < chunks; i++) {
+          TraceChunk chunk;
+          chunk.offset            = this->readVarint();
+          chunk.firstInstruction  = this->readVarint();
+          chunk.nextAddress       = this->readVarint();
+          chunk.lastMemoryAddress = this->readVarint();
+
+          if (chunk.offset < header || chunk.offset > index || (!this->chunks.empty() && chunk.firstInstruction <= this->chunks.back().firstInstruction))
+            throw triton::exceptions::Format("TraceReader::readIndex(): Invalid chunk.");
+
+          this->chunks.push_back(chunk);
+        }
+        this->count   = this->readVarint();
+        this->end     = static_cast<triton::usize>(index);
+        this->indexed = true;
+      }
+
+      /* The records of a trace without index are a single chunk */
+      if (this->chunks.empty() || this->chunks.front().firstInstruction != 0) {
+        this->chunks.insert(this->chunks.begin(), TraceChunk());
+        this->chunks.front().offset = header;
+      }
+
+      this->offset = header;
+    }
+
+
+    void TraceReader::open(const std::string& path) {
+      triton::uint8 version = 0;
+
+      this->file.open(path);
+      this->end               = this->file.getSize();
+      this->lastMemoryAddress = 0;
+      this->nextAddress       = 0;
+      this->offset            = 0;
+      this->position          = 0;
+      this->skipped.clear();
+
+      if (this->file.getSize() < sizeof(traceMagic) + 1 || std::memcmp(this->file.getData(), traceMagic, sizeof(traceMagic)) != 0)
+        throw triton::exceptions::Format("TraceReader::open(): Not a trace file.");
+      this->offset = sizeof(traceMagic);
+
+      version = *this->readBytes(1);
+      if (version != 1 && version != traceVersion)
+        throw triton::exceptions::Format("TraceReader::open(): Unsupported version of trace file.");
+
+      this->architecture = static_cast<triton::uint32>(this->readVarint());
+
+      /* The first version has no index */
+      if (version == 1) {
+        this->chunks.assign(1, TraceChunk());
+        this->chunks.front().offset = this->offset;
+        this->count   = 0;
+        this->indexed = false;
+        return;
+      }
+
+      this->readIndex(this->offset);
+    }
+
+
+    triton::uint32 TraceReader::getArchitecture(void) const {
+      return this->architecture;
+    }
+
+
+    bool TraceReader::next(TraceInstruction& inst) {
+      if (!this->decode(inst))
+        return false;
+
+      /* The registers of the instructions skipped by seek() */
+      auto it = this->skipped.find(inst.threadId);
+      if (it != this->skipped.end()) {
+        for (const auto& reg : inst.registers)
+          it->second[reg.first] = reg.second;
+        inst.registers.assign(it->second.begin(), it->second.end());
+        this->skipped.erase(it);
+      }
+
+      return true;
+    }
+
+
+    bool TraceReader::decode(TraceInstruction& inst) {
+      triton::usize count = 0;
+
+      if (this->offset >= this->end)
+        return false;
+
+      inst.opcodes.clear();
+      inst.registers.clear();
+      inst.memoryReads.clear();
+
+      /* Instruction */
+      inst.threadId = static_cast<triton::uint32>(this->readVarint());
+      inst.address  = this->nextAddress + static_cast<triton::uint64>(this->readSignedVarint());
+      count         = static_cast<triton::usize>(this->readVarint());
+      const triton::uint8* opcodes = this->readBytes(count);
+      inst.opcodes.assign(opcodes, opcodes + count);
+      this->nextAddress = inst.address + count;
+
+      /* Registers */
+      count = static_cast<triton::usize>(this->readVarint());
+      for (triton::usize i = 0; i < count; i++) {
+        triton::uint32 regId  = static_cast<triton::uint32>(this->readVarint());
+        triton::uint8 size    = *this->readBytes(1);
+        triton::uint512 value = 0;
+
+        if (size > maxRegisterSize)
+          throw triton::exceptions::Format("TraceReader::next(): Invalid size of register.");
+
+        const triton::uint8* data = this->readBytes(size);
+
+        for (triton::uint8 j = size; j > 0; j--)
+          value = (value << 8) | data[j - 1];
+
+        inst.registers.push_back(std::make_pair(regId, value));
+      }
+
+      /* Memory reads */
+      count = static_cast<triton::usize>(this->readVarint());
+      for (triton::usize i = 0; i < count; i++) {
+        triton::uint64 address = this->lastMemoryAddress + static_cast<triton::uint64>(this->readSignedVarint());
+        triton::usize size     = static_cast<triton::usize>(this->readVarint());
+        const triton::uint8* data = this->readBytes(size);
+
+        inst.memoryReads.push_back(std::make_pair(address, std::vector<triton::uint8>(data, data + size)));
+        this->lastMemoryAddress = address;
+      }
+
+      this->position++;
+      return true;
+    }
+
+
+    bool TraceReader::isIndexed(void) const {
+      return this->indexed;
+    }
+
+
+    triton::uint64 TraceReader::getInstructionCount(void) {
+      if (this->indexed)
+        return this->count;
+
+      /* Counts the records, then goes back to the current instruction */
+      std::map<triton::uint32, std::map<triton::uint32, triton::uint512>> skipped = this->skipped;
+      triton::uint64 lastMemoryAddress = this->lastMemoryAddress;
+      triton::uint64 nextAddress       = this->nextAddress;
+      triton::uint64 position          = this->position;
+      triton::usize offset             = this->offset;
+      TraceInstruction record;
+
+      while (this->decode(record));
+      triton::uint64 count = this->position;
+
+      this->skipped           = skipped;
+      this->lastMemoryAddress = lastMemoryAddress;
+      this->nextAddress       = nextAddress;
+      this->position          = position;
+      this->offset            = offset;
+
+      return count;
+    }
+
+
+    const std::vector<TraceChunk>& TraceReader::getChunks(void) const {
+      return this->chunks;
+    }
+
+
+    triton::uint64 TraceReader::getPosition(void) const {
+      return this->position;
+    }
+
+
+    bool TraceReader::seek(triton::uint64 instruction) {
+      TraceInstruction record;
+
+      /* The last chunk starting at or before the instruction */
+      auto chunk = std::upper_bound(this->chunks.begin(), this->chunks.end(), instruction,
+        [](triton::uint64 value, const TraceChunk& item) { return value < item.firstInstruction; });
+      chunk--;
+
+      this->offset            = static_cast<triton::usize>(chunk->offset);
+      this->position          = chunk->firstInstruction;
+      this->nextAddress       = chunk->nextAddress;
+      this->lastMemoryAddress = chunk->lastMemoryAddress;
+      this->skipped.clear();
+
+      while (this->position < instruction) {
+        if (!this->decode(record))
+          return false;
+        std::map<triton::uint32, triton::uint512>& registers = this->skipped[record.threadId];
+        for (const auto& reg : record.registers)
+          registers[reg.first] = reg.second;
+      }
+
+      return true;
+    }
+
+  }; /* format namespace */
+}; /* triton namespace */
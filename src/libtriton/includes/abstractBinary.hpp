@@ -93,6 +93,9 @@ namespace triton {
 
         //! Returns all memory areas which may be mapped.
         const std::list<triton::format::MemoryMapping>& getMemoryMapping(void) const;
+
+        //! Returns the indexes of the symbols and relocations. They are built on the first call.
+        const triton::format::SymbolIndex& getSymbolIndex(void) const;
     };
 
   /*! @} End of format namespace */
@@ -0,0 +1,119 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#ifndef TRITON_ALIGNEDMEMORYMAP_H
+#define TRITON_ALIGNEDMEMORYMAP_H
+
+#include <functional>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "ast.hpp"
+#include "tritonTypes.hpp"
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The Engines namespace
+  namespace engines {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup engines
+   *  @{
+   */
+
+    //! The Symbolic Execution namespace
+    namespace symbolic {
+    /*!
+     *  \ingroup engines
+     *  \addtogroup symbolic
+     *  @{
+     */
+
+      //! \class AlignedMemoryMap
+      /*! \brief The aligned memory map class (ALIGNED_MEMORY mode).
+       *
+       * \description
+       * Maps <address:size> entries to the AST of the memory access. The entries are hashed by
+       * address, each address holding a small array of sizes, so that an entry is found with a
+       * single lookup. The entries overlapping an area are found by looking up the addresses
+       * of the area and the ones before it up to the largest size stored.
+       */
+      class AlignedMemoryMap {
+        public:
+          //! Maximum number of sizes stored at the same address.
+          static const triton::uint32 slotSize = 8;
+
+        private:
+          //! The entries starting at an address.
+          struct Slot {
+            //! The sizes of the entries, 0 if the entry is unused.
+            triton::uint8 sizes[slotSize];
+
+            //! The nodes of the entries.
+            triton::ast::AbstractNode* nodes[slotSize];
+          };
+
+          //! Slots indexed by address.
+          std::unordered_map<triton::uint64, Slot> slots;
+
+          //! Number of entries.
+          triton::usize count;
+
+          //! The largest size stored since the map is empty, it bounds the overlapping entries before an address.
+          triton::uint32 maxSize;
+
+        public:
+          //! Constructor.
+          AlignedMemoryMap();
+
+          //! Returns the node of an entry or nullptr if there is none.
+          triton::ast::AbstractNode* get(triton::uint64 address, triton::uint32 size) const;
+
+          //! Sets the node of an entry, nullptr removes it. Returns the previous node or nullptr.
+          triton::ast::AbstractNode* set(triton::uint64 address, triton::uint32 size, triton::ast::AbstractNode* node);
+
+          //! Appends the <address:size> of the entries overlapping [address, address + size) to `entries`.
+          void getOverlaps(triton::uint64 address, triton::uint64 size, std::vector<std::pair<triton::uint64, triton::uint32>>& entries) const;
+
+          //! Removes any entry and returns its node, or nullptr if the map is empty.
+          triton::ast::AbstractNode* extract(void);
+
+          //! Calls `callback` with the address, the size and the node of every entry, in no particular order.
+          void forEach(const std::function<void(triton::uint64, triton::uint32, triton::ast::AbstractNode*)>& callback) const;
+
+          //! Removes every entry.
+          void clear(void);
+
+          //! Swaps the entries of two maps.
+          void swap(AlignedMemoryMap& other);
+
+          //! Returns true if the map has no entry.
+          bool empty(void) const;
+
+          //! Returns the number of entries.
+          triton::usize size(void) const;
+
+          //! Returns the estimated number of bytes used by the map.
+          triton::usize getMemoryUsage(void) const;
+      };
+
+    /*! @} End of symbolic namespace */
+    };
+  /*! @} End of engines namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_ALIGNEDMEMORYMAP_H */
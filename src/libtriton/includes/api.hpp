@@ -8,11 +8,14 @@
 #ifndef TRITON_API_H
 #define TRITON_API_H
 
+#include "abstractBinary.hpp"
 #include "architecture.hpp"
 #include "ast.hpp"
 #include "astGarbageCollector.hpp"
 #include "astRepresentation.hpp"
 #include "callbacks.hpp"
+#include "coreDump.hpp"
+#include "functionSummaries.hpp"
 #include "immediate.hpp"
 #include "instruction.hpp"
 #include "irBuilder.hpp"
@@ -23,8 +26,10 @@
 #include "registerSpecification.hpp"
 #include "solverEngine.hpp"
 #include "symbolicEngine.hpp"
+#include "syscallEmulator.hpp"
 #include "taintEngine.hpp"
 #include "tritonTypes.hpp"
+#include "x86Specifications.hpp"
 #include "z3Interface.hpp"
 
 #ifdef TRITON_PYTHON_BINDINGS
@@ -40,6 +45,24 @@ namespace triton {
  *  @{
  */
 
+    //! The Profiles namespace
+    namespace profiles {
+    /*!
+     *  \ingroup triton
+     *  \addtogroup profiles
+     *  @{
+     */
+
+      //! Enumerates the sets of engines created by triton::API::setArchitecture().
+      enum profile_e {
+        FULL = 0,   //!< Every engine.
+        EMULATION,  //!< The engines needed to process instructions, without the solver and the Z3 interface. The symbolic and taint engines start disabled.
+        DISASSEMBLY //!< Only the modes, instructions can be disassembled but not processed.
+      };
+
+    /*! @} End of profiles namespace */
+    };
+
     /*! \class API
      *  \brief This is used as C++ API. */
     class API {
@@ -72,16 +95,178 @@ namespace triton {
         //! The Z3 interface between Triton and Z3
         triton::ast::Z3Interface* z3Interface;
 
+        //! The syscall emulator of run().
+        triton::os::unix::SyscallEmulator* syscalls;
+
+        //! The function summaries of run().
+        triton::os::unix::FunctionSummaries* summaries;
+
+        //! The file the dependency graph is streamed to. nullptr if it is not exported. \sa exportDependencies().
+        triton::engines::symbolic::DependencyFileSink* dependencyExport;
+
+        //! A snapshot of the engines. \sa snapshot().
+        struct Snapshot {
+          //! The CPU state.
+          triton::arch::CpuInterface* cpu;
+
+          //! The symbolic engine state, its expressions are shared with the engine.
+          triton::engines::symbolic::SymbolicEngine* symbolic;
+
+          //! The taint engine state.
+          triton::engines::taint::TaintEngine* taint;
+
+          //! The AST nodes allocated when the snapshot has been taken, frozen and shared with the states restored from it.
+          std::shared_ptr<triton::ast::AstGeneration> generation;
+
+          //! The AST variable nodes recorded when the snapshot has been taken.
+          std::unordered_map<triton::usize, triton::ast::AbstractNode*> variables;
+        };
+
+        //! The snapshots by id.
+        std::map<triton::usize, Snapshot> snapshots;
+
+        //! The next snapshot id.
+        triton::usize uniqueSnapshotId;
+
+        //! Number of instructions disassembled since the engines have been initialized.
+        mutable triton::usize disassembledInstructions;
+
+        //! Time spent disassembling, in nanoseconds.
+        mutable triton::uint64 disassemblyTime;
+
+        //! Number of instructions decoded ahead by run() (DECODE_AHEAD mode) since the engines have been initialized.
+        triton::usize decodedAhead;
+
+        //! The soft memory limit in bytes. 0 if unlimited.
+        triton::usize memorySoftLimit;
+
+        //! The hard memory limit in bytes. 0 if unlimited.
+        triton::usize memoryHardLimit;
+
+        //! True once the soft limit has been reported, until the usage falls below it again.
+        bool memorySoftLimitReported;
+
+        //! Returns the estimated number of bytes used by the engines, as the `total` of getMemoryUsage().
+        triton::usize getTotalMemoryUsage(void) const;
+
+        //! Checks the memory limits after an instruction has been processed. \sa setMemoryLimits().
+        void checkMemoryLimits(void);
+
+        //! Deletes the states of a snapshot.
+        void deleteSnapshot(Snapshot& snap);
+
+        //! The engines created by initEngines(). \sa triton::profiles::profile_e.
+        triton::uint32 profile;
+
+        //! True if the changes of the engines are recorded into the undo journal. \sa enableUndoJournal().
+        bool undoFlag;
+
+        //! The steps of the undo journal, the last one is the current step. True if the step has been started by an instruction.
+        std::vector<bool> undoSteps;
+
+        //! Starts a step of the undo journal in the CPU, the symbolic engine and the taint engine.
+        void startUndoStep(bool instruction);
+
+        //! Reverts the last step of the undo journal.
+        void rollbackUndoStep(void);
+
+        //! Drops every step of the undo journal, the changes are kept.
+        void clearUndoJournal(void);
+
+        //! The maximum number of instructions of each side of a merged branch (STATE_MERGING mode). \sa setStateMergingLimit().
+        triton::usize stateMergingLimit;
+
+        //! Number of branches merged by run() since the engines have been initialized.
+        triton::usize mergedBranches;
+
+        //! A value of the other side of a merged branch.
+        struct MergedValue {
+          //! The AST of the value, held until the merge.
+          triton::ast::AbstractNode* node;
+
+          //! True if the value is tainted.
+          bool tainted;
+
+          //! True if the byte has been stored by the other side. Always true for a register.
+          bool stored;
+        };
+
+        //! A symbolic branch of run() whose sides are merged where they join (STATE_MERGING mode).
+        struct MergedBranch {
+          //! The address of the branch.
+          triton::uint64 address;
+
+          //! The address where the sides join, 0 if no merge is pending.
+          triton::uint64 join;
+
+          //! The number of instructions left to the taken side before the join.
+          triton::usize remaining;
+
+          //! The condition of the taken side, held until the merge.
+          triton::ast::AbstractNode* condition;
+
+          //! The number of path constraints before the branch.
+          triton::usize pathConstraints;
+
+          //! The id of the first symbolic expression created by the sides.
+          triton::usize firstExprId;
+
+          //! The parent registers after the branch, as their expression id and their concrete value.
+          std::map<triton::uint32, std::pair<triton::usize, triton::uint512>> initial;
+
+          //! The registers changed by the other side.
+          std::map<triton::uint32, MergedValue> registers;
+
+          //! The bytes stored by either side, with their value on the other side.
+          std::map<triton::uint64, MergedValue> memory;
+
+          //! The bytes stored by the taken side since the branch.
+          std::set<triton::uint64> stores;
+
+          //! The symbolized path constraints of the other side, held until the merge.
+          std::vector<triton::ast::AbstractNode*> otherConstraints;
+        };
+
+        //! Executes a side of a branch from `pc` until an address of `joins` (true is returned), a hook, `syscall`, `hlt` or `limit` instructions. Records the addresses reached and the bytes stored.
+        bool speculate(triton::uint64 pc, const std::map<triton::uint64, triton::callbacks::addressHookCallback>& hooks, triton::usize limit, const std::set<triton::uint64>* joins, std::vector<triton::uint64>& trace, std::set<triton::uint64>& stores);
+
+        //! Applies at once the iterations but the last one of the counted loop from `head` to `branch`, taken by run(). Returns false if it is not such a loop.
+        bool summarizeLoop(triton::uint64 head, const triton::arch::Instruction& branch, const std::map<triton::uint64, triton::callbacks::addressHookCallback>& hooks);
+
+        //! Executes both sides of the symbolic branch `inst` processed by run() and records the other side at their join. Returns false if they do not join.
+        bool prepareMerge(const triton::arch::Instruction& inst, const std::map<triton::uint64, triton::callbacks::addressHookCallback>& hooks, MergedBranch& merge);
+
+        //! Merges the other side of a branch into the state of the taken side, which has reached the join.
+        void mergeStates(MergedBranch& merge);
+
+        //! Releases the values held by a merge and cancels it.
+        void releaseMerge(MergedBranch& merge);
+
 
       public:
         //! Constructor of the API.
         API();
 
-        //! Destructor of the API.
+        //! Destructor of the API. Threads bound to the API are bound to triton::api again.
         virtual ~API();
 
 
 
+        /* Context API =================================================================================== */
+
+        /*!
+         * \brief [**context api**] - Binds the API to the calling thread. Returns the API bound before.
+         *
+         * \description Registers, memory accesses, AST nodes and the symbolic helpers reach their API through
+         * triton::getCurrentApi(), so a thread must be bound to an API before it uses it. Every thread is bound to
+         * triton::api until it calls bind(). Several APIs may be used at the same time by different threads, but an
+         * API and the objects it creates (AST nodes, symbolic expressions and variables) must only be used by one
+         * thread at a time, the one bound to it. An API must not be deleted while another thread is bound to it.
+         */
+        triton::API* bind(void);
+
+
+
         /* Architecture API ============================================================================== */
 
         //! [**Architecture api**] - Returns true if the architecture is valid.
@@ -96,8 +281,17 @@ namespace triton {
         //! [**architecture api**] - Returns the CPU instance.
         triton::arch::CpuInterface* getCpu(void);
 
-        //! [**architecture api**] - Setup an architecture. \sa triton::arch::architectures_e.
-        void setArchitecture(triton::uint32 arch);
+        /*!
+         * \brief [**architecture api**] - Setup an architecture. \sa triton::arch::architectures_e.
+         *
+         * \description The `profile` selects the engines created (see triton::profiles::profile_e). A tool which only
+         * disassembles instructions uses triton::profiles::DISASSEMBLY, a concrete emulator triton::profiles::EMULATION.
+         * The API of an engine which is not created raises an exception.
+         */
+        void setArchitecture(triton::uint32 arch, triton::uint32 profile=triton::profiles::FULL);
+
+        //! [**architecture api**] - Returns the profile of the engines as triton::profiles::profile_e.
+        triton::uint32 getEngineProfile(void) const;
 
         //! [**architecture api**] - Clears the architecture states (registers and memory).
         void clearArchitecture(void);
@@ -123,6 +317,9 @@ namespace triton {
         //! [**architecture api**] - Returns all information about the register.
         triton::arch::RegisterSpecification getRegisterSpecification(triton::uint32 regId) const;
 
+        //! [**architecture api**] - Returns the row of the constant specification table of the register, without allocation.
+        const triton::arch::RegisterSpecificationEntry& getRegisterSpecificationEntry(triton::uint32 regId) const;
+
         //! [**architecture api**] - Returns all registers. \sa triton::arch::x86::registers_e.
         std::set<triton::arch::Register*> getAllRegisters(void) const;
 
@@ -138,9 +335,15 @@ namespace triton {
         //! [**architecture api**] - Returns the concrete value of a memory area.
         std::vector<triton::uint8> getConcreteMemoryAreaValue(triton::uint64 baseAddr, triton::usize size, bool execCallbacks=true) const;
 
+        //! [**architecture api**] - Reads the concrete value of a memory area into `area`, which holds at least `size` bytes.
+        void getConcreteMemoryAreaValue(triton::uint64 baseAddr, triton::uint8* area, triton::usize size, bool execCallbacks=true) const;
+
         //! [**architecture api**] - Returns the concrete value of a register.
         triton::uint512 getConcreteRegisterValue(const triton::arch::Register& reg, bool execCallbacks=true) const;
 
+        //! [**architecture api**] - Returns the concrete values of the main registers at once, without building any Register. Callbacks are not executed.
+        triton::arch::x86::RegisterContext getConcreteRegisterContext(void);
+
         /*!
          * \brief [**architecture api**] - Sets the concrete value of a memory cell.
          *
@@ -181,12 +384,92 @@ namespace triton {
          */
         void setConcreteRegisterValue(const triton::arch::Register& reg);
 
+        /*!
+         * \brief [**architecture api**] - Sets the concrete values of the main registers at once, without building any Register.
+         *
+         * \description The GPRs, the program counter, the flags, the segments and the XMM registers of the context are
+         * copied into the CPU (cf. triton::arch::x86::RegisterContext). As setConcreteRegisterValue(), the symbolic state
+         * is not updated.
+         */
+        void setConcreteRegisterContext(const triton::arch::x86::RegisterContext& context);
+
         //! [**architecture api**] - Returns true if the range `[baseAddr:size]` is mapped into the internal memory representation. \sa getConcreteMemoryValue() and getConcreteMemoryAreaValue().
         bool isMemoryMapped(triton::uint64 baseAddr, triton::usize size=1);
 
         //! [**architecture api**] - Removes the range `[baseAddr:size]` from the internal memory representation. \sa isMemoryMapped().
         void unmapMemory(triton::uint64 baseAddr, triton::usize size=1);
 
+        /*!
+         * \brief [**architecture api**] - Maps memory areas into the concrete memory.
+         *
+         * \description Areas are copied page by page and the bytes between the size of an area and its
+         * virtual size (e.g. the `.bss` of a `PT_LOAD` segment) are mapped as zero. Areas are zero-filled
+         * before any content is copied, so a zero-filled range never overwrites the content of another area.
+         */
+        void loadBinary(const std::list<triton::format::MemoryMapping>& areas);
+
+        //! [**architecture api**] - Maps all memory areas of a binary into the concrete memory. \sa triton::format::MemoryMapping.
+        void loadBinary(const triton::format::AbstractBinary& binary);
+
+        //! [**architecture api**] - Maps all memory areas of a binary into the concrete memory. \sa triton::format::MemoryMapping.
+        void loadBinary(const triton::format::BinaryInterface& binary);
+
+        /*!
+         * \brief [**architecture api**] - Maps the memory areas of a crash dump into the concrete memory, lazily. Returns the number of areas.
+         *
+         * \description The dump is not copied: a page is read from the mapped dump on its first access, so loading
+         * a dump costs about the mapping of its file whatever its size. \sa triton::arch::PagedMemory::mapLazy().
+         */
+        triton::usize loadCoreDump(const triton::format::CoreDump& dump);
+
+        //! [**architecture api**] - Maps the memory areas of an ELF core file or of a minidump into the concrete memory, lazily. Returns the number of areas.
+        triton::usize loadCoreDump(const std::string& path);
+
+        /*!
+         * \brief [**architecture api**] - Decodes the executable areas into the decode cache of the CPU, on `threads` threads (0 for one per core).
+         *
+         * \description The areas are swept linearly by chunks, each thread with its own decoder, and a byte which is not
+         * an instruction is skipped. Later calls to disassembly() at these addresses reuse the decoding instead of calling
+         * Capstone. The cache is not flushed: decoding stops once it holds triton::arch::DecodeCache::maxEntries
+         * instructions. Returns the number of instructions cached. \sa triton::format::MemoryMapping::isExecutable().
+         */
+        triton::usize predecode(const std::list<triton::format::MemoryMapping>& areas, triton::uint32 threads=0);
+
+        //! [**architecture api**] - Decodes the executable areas of a binary into the decode cache of the CPU. \sa predecode().
+        triton::usize predecode(const triton::format::AbstractBinary& binary, triton::uint32 threads=0);
+
+        //! [**architecture api**] - Decodes the executable areas of a binary into the decode cache of the CPU. \sa predecode().
+        triton::usize predecode(const triton::format::BinaryInterface& binary, triton::uint32 threads=0);
+
+        /*!
+         * \brief [**architecture api**] - Writes the decode cache of the executable areas to a file of `directory`. Returns the number of instructions written.
+         *
+         * \description The file is named after the key of the areas: a hash of the architecture and of the address,
+         * the size and the content of every executable area. So the same code loaded at the same addresses finds its
+         * file again, while a rebuilt or relocated binary gets a new one. \sa loadDecodeCache() and predecode().
+         */
+        triton::usize saveDecodeCache(const std::string& directory, const std::list<triton::format::MemoryMapping>& areas);
+
+        //! [**architecture api**] - Writes the decode cache of the executable areas of a binary to a file of `directory`. \sa saveDecodeCache().
+        triton::usize saveDecodeCache(const std::string& directory, const triton::format::AbstractBinary& binary);
+
+        //! [**architecture api**] - Writes the decode cache of the executable areas of a binary to a file of `directory`. \sa saveDecodeCache().
+        triton::usize saveDecodeCache(const std::string& directory, const triton::format::BinaryInterface& binary);
+
+        /*!
+         * \brief [**architecture api**] - Reads the decode cache of the executable areas from the file of `directory` written by saveDecodeCache(). Returns the number of instructions read.
+         *
+         * \description The file is mapped into memory. Returns 0 if there is no file for these areas. The disassemblies
+         * of the instructions read do not call Capstone anymore.
+         */
+        triton::usize loadDecodeCache(const std::string& directory, const std::list<triton::format::MemoryMapping>& areas);
+
+        //! [**architecture api**] - Reads the decode cache of the executable areas of a binary from a file of `directory`. \sa loadDecodeCache().
+        triton::usize loadDecodeCache(const std::string& directory, const triton::format::AbstractBinary& binary);
+
+        //! [**architecture api**] - Reads the decode cache of the executable areas of a binary from a file of `directory`. \sa loadDecodeCache().
+        triton::usize loadDecodeCache(const std::string& directory, const triton::format::BinaryInterface& binary);
+
         //! [**architecture api**] - Disassembles the instruction and setup operands. You must define an architecture before. \sa processing().
         void disassembly(triton::arch::Instruction& inst) const;
 
@@ -197,6 +480,70 @@ namespace triton {
         //! [**proccesing api**] - Processes an instruction and updates engines according to the instruction semantics. Returns true if the instruction is supported.
         bool processing(triton::arch::Instruction& inst);
 
+        /*!
+         * \brief [**proccesing api**] - Processes the instructions of a buffer one after another, the first one being at `addr`.
+         *
+         * \description Processes at most `count` instructions, or the whole buffer if `count` is 0. The instructions
+         * are processed in the order of the buffer, whatever their control flow. Returns the number of instructions processed.
+         */
+        triton::usize processBlock(triton::uint64 addr, const triton::uint8* area, triton::usize size, triton::usize count=0);
+
+        /*!
+         * \brief [**proccesing api**] - Emulates the code from `start`, following the concrete program counter.
+         *
+         * \description Instructions are fetched from the concrete memory. The emulation stops when the program counter
+         * is 0 or one of `stopAddresses`, after a `hlt`, or once `maxInsns` instructions are processed if `maxInsns` is
+         * not 0. Returns the number of instructions processed.
+         */
+        triton::usize emulate(triton::uint64 start, const std::set<triton::uint64>& stopAddresses, triton::usize maxInsns=0);
+
+        /*!
+         * \brief [**proccesing api**] - Emulates the code from `entry`, following the concrete program counter and calling the hooks of the addresses reached.
+         *
+         * \description The program counter is set to `entry` and instructions are fetched from the concrete memory. The hook of
+         * an address is called before the instruction at this address is processed. If the hook redirects the program counter,
+         * the emulation goes on from there, otherwise the instruction is processed. An address without hook which has a function
+         * summary is summarized instead of being emulated. If the syscall emulation is enabled, a `syscall` is emulated after it is processed. The emulation stops when a hook returns false, when the program exits, when the
+         * program counter is 0, after a `hlt`, or once `maxInsns` instructions are processed if `maxInsns` is not 0.
+         * If `edgeMap` is not null, the edges taken by the control flow instructions and the redirections of the hooks are
+         * counted into it, AFL-style: triton::engines::exploration::EDGE_MAP_SIZE saturated counters indexed by the hash
+         * of the destination xored with the hash of the previous destination shifted by one. With the triton::modes::STATE_MERGING
+         * mode, the two sides of a symbolic branch which join within getStateMergingLimit() instructions are merged at the join.
+         * With the triton::modes::DECODE_AHEAD mode, the blocks which follow the control flow instructions are decoded by a helper
+         * thread into the decode cache while the current ones are processed. The helper is joined before returning and the
+         * blocks it has decoded are kept for the next runs.
+         * With the triton::modes::LOOP_SUMMARIES mode, the iterations but the last one of a loop whose body only moves induction
+         * variables are applied at once when its branch back is taken, see triton::arch::x86::x86Semantics::buildInductionLoopSemantics().
+         * Returns the number of instructions processed.
+         * \sa triton::callbacks::addressHookCallback.
+         */
+        triton::usize run(triton::uint64 entry, const std::map<triton::uint64, triton::callbacks::addressHookCallback>& hooks, triton::usize maxInsns=0, triton::uint8* edgeMap=nullptr);
+
+        /*!
+         * \brief [**proccesing api**] - Sets the maximum number of instructions of each side of the branches merged by run() (STATE_MERGING mode). 32 by default.
+         *
+         * \description Both sides are executed speculatively before a merge, so the limit bounds the cost of a branch which is
+         * not merged. A larger limit merges larger diamonds, at the price of the `ite` expressions of every value they change.
+         */
+        void setStateMergingLimit(triton::usize limit);
+
+        //! [**proccesing api**] - Returns the maximum number of instructions of each side of the branches merged by run().
+        triton::usize getStateMergingLimit(void) const;
+
+        //! [**proccesing api**] - Returns the number of branches merged by run() since the engines have been initialized.
+        triton::usize getNumberOfMergedBranches(void) const;
+
+        /*!
+         * \brief [**proccesing api**] - Replays an execution trace recorded by the pintool (see triton::format::TraceWriter).
+         *
+         * \description Before each instruction is processed, the concrete registers and the concrete memory read by
+         * the instruction are synchronized with the values of the trace. Replays at most `maxInsns` instructions, or the
+         * whole trace if `maxInsns` is 0. The replay starts at the instruction number `start`, reached through the index of the
+         * trace, with the registers of each thread known at this point. The architecture must be the one of the trace. Returns
+         * the number of instructions processed.
+         */
+        triton::usize replayTrace(const std::string& path, triton::usize maxInsns=0, triton::uint64 start=0);
+
         //! [**proccesing api**] - Initialize everything.
         void initEngines(void);
 
@@ -206,6 +553,112 @@ namespace triton {
         //! [**proccesing api**] - Reset everything.
         void resetEngines(void);
 
+        /*!
+         * \brief [**proccesing api**] - Returns the statistics of the engines.
+         *
+         * \description The counters are kept up to date while processing, only the per kind counts of live AST nodes
+         * (`ast.live.<kind>`) are computed on demand. Times are in nanoseconds. `disassembly.decodedAhead` counts the instructions
+         * decoded ahead by run() (DECODE_AHEAD mode). Keys are prefixed by the component
+         * they come from: `ast.`, `cpu.`, `disassembly.`, `semantics.`, `solver.`, `symbolic.` and `taint.`. With the
+         * PERF_COUNTERS mode, the hardware counters of each stage are added as `perf.<stage>.<counter>`. With the HUGE_PAGES
+         * mode, the usage of the huge page arena is added as `hugePages.*`.
+         */
+        std::map<std::string, triton::usize> getStatistics(void) const;
+
+        /*!
+         * \brief [**proccesing api**] - Returns the estimated number of bytes used by each engine.
+         *
+         * \description Keys are `ast.dictionaries`, `ast.nodes`, `cpu`, `pathManager`, `symbolic`, `taint` and `total`.
+         * Sizes are estimated from the number of entries of the containers, the buffers owned by nodes and expressions
+         * (e.g. comments, childs) are not counted. It is cheap enough to be called after every instruction.
+         */
+        std::map<std::string, triton::usize> getMemoryUsage(void) const;
+
+        /*!
+         * \brief [**proccesing api**] - Sets the soft and hard memory limits, in bytes (0 if unlimited).
+         *
+         * \description The usage is checked after every instruction processed. MEMORY_LIMIT callbacks are called once when
+         * the soft limit is exceeded, and again once the usage has fallen below it. When the hard limit is exceeded, the
+         * callbacks are called and, if the usage is still above it, every register and memory cell is concretized and the
+         * unreachable expressions are collected. A triton::exceptions::API is raised if it is still not enough.
+         */
+        void setMemoryLimits(triton::usize soft, triton::usize hard);
+
+
+
+        /* Snapshot API ================================================================================== */
+
+        /*!
+         * \brief [**snapshot api**] - Takes a snapshot of the CPU, the symbolic engine, the taint engine and the AST nodes. Returns the id of the snapshot.
+         *
+         * \description The concrete memory pages and the symbolic expressions are shared with the snapshot and only duplicated
+         * when they are written or removed, so taking a snapshot does not copy the memory. A snapshot may be restored many times.
+         * As there is one live state, forking a path is done by taking a snapshot and restoring it once the other path is explored.
+         * The AST nodes are not copied either, they are frozen and shared read-only (cf. AstGarbageCollector::freezeAstNodes()).
+         */
+        triton::usize snapshot(void);
+
+        /*!
+         * \brief [**snapshot api**] - Restores a snapshot taken by snapshot(). The snapshot is kept.
+         *
+         * \description AST nodes created since the snapshot are freed, unless another snapshot holds them (frozen by a later snapshot).
+         * Raises an exception if the snapshot does not exist.
+         */
+        void restore(triton::usize id);
+
+        //! [**snapshot api**] - Removes a snapshot. Raises an exception if the snapshot does not exist.
+        void removeSnapshot(triton::usize id);
+
+        //! [**snapshot api**] - Returns the ids of the snapshots.
+        std::vector<triton::usize> getSnapshots(void) const;
+
+        /*!
+         * \brief [**snapshot api**] - Writes the CPU, the symbolic engine and the taint engine to a checkpoint file.
+         *
+         * \description The file holds the concrete registers, the taint and its labels, the symbolic state (see
+         * serializeSymbolicState()) and the concrete memory pages. The pages are written last, aligned in the file,
+         * so loadCheckpoint() maps them in place instead of reading them.
+         */
+        void saveCheckpoint(const std::string& path);
+
+        /*!
+         * \brief [**snapshot api**] - Replaces the current state by the one of a checkpoint file written by saveCheckpoint().
+         *
+         * \description The memory pages are read from the mapped file until they are written, so restoring
+         * a checkpoint costs about the mapping of its file and the rebuilding of its symbolic state. The current
+         * symbolic references and path constraints are dropped and the symbolic expressions read get new ids.
+         * The snapshots are kept and the undo journal is cleared. Raises a triton::exceptions::API if the file is
+         * not a checkpoint of this architecture.
+         */
+        void loadCheckpoint(const std::string& path);
+
+
+
+        /* Undo API ====================================================================================== */
+
+        /*!
+         * \brief [**undo api**] - Enables or disables the undo journal. Disabling it drops the steps recorded.
+         *
+         * \description Every instruction processed starts a step of the journal, which records the previous values of
+         * the registers and the bytes written, the previous symbolic references, the path constraints and the previous taint
+         * and labels written. The expressions and variables created by a step are removed when it is reverted, so moving
+         * backward costs what the instructions changed, without a snapshot of the whole state. The deferred flags are built
+         * when a step is started, and the unreachable expressions are not collected while the journal records.
+         */
+        void enableUndoJournal(bool flag);
+
+        //! [**undo api**] - Returns true if the undo journal is enabled.
+        bool isUndoJournalEnabled(void) const;
+
+        //! [**undo api**] - Starts a step of the undo journal and returns its id, the state can be rewound to it with rewindTo(). Raises an exception if the journal is disabled.
+        triton::usize checkpoint(void);
+
+        //! [**undo api**] - Reverts the last `count` instructions processed and the changes made since. Returns the number of instructions reverted, fewer if the journal does not hold them.
+        triton::usize stepBack(triton::usize count=1);
+
+        //! [**undo api**] - Reverts every change made since checkpoint() returned `id`. Raises an exception if the step has been reverted already.
+        void rewindTo(triton::usize id);
+
 
 
         /* IR API ======================================================================================== */
@@ -216,6 +669,24 @@ namespace triton {
         //! [**IR builder api**] - Builds the instruction semantics. Returns true if the instruction is supported. You must define an architecture before. \sa processing().
         bool buildSemantics(triton::arch::Instruction& inst);
 
+        //! [**IR builder api**] - Returns the profiles of the opcodes, indexed by instruction type. Opcodes are profiled while the triton::modes::OPCODE_PROFILING mode is enabled.
+        const std::map<triton::uint32, triton::arch::OpcodeProfile>& getOpcodeProfile(void) const;
+
+        //! [**IR builder api**] - Clears the profiles of the opcodes.
+        void clearOpcodeProfile(void);
+
+        //! [**IR builder api**] - Writes the profiles of the opcodes as CSV, or as JSON if `json` is true, the most expensive ones first.
+        void dumpOpcodeProfile(std::ostream& stream, bool json=false) const;
+
+        //! [**IR builder api**] - Writes the spans recorded with the TRACE_EVENTS mode as a Chrome trace-event JSON document. \sa triton::utils::TraceEvents.
+        void dumpTraceEvents(std::ostream& stream) const;
+
+        //! [**IR builder api**] - Removes the spans recorded with the TRACE_EVENTS mode.
+        void clearTraceEvents(void);
+
+        //! [**IR builder api**] - Resets the hardware counters accumulated with the PERF_COUNTERS mode. \sa triton::utils::PerfCounters.
+        void clearPerfCounters(void);
+
 
 
         /* AST Garbage Collector API ===================================================================== */
@@ -232,11 +703,17 @@ namespace triton {
         //! [**AST garbage collector api**] - Extracts all unique nodes from a partial AST into the uniqueNodes set.
         void extractUniqueAstNodes(std::set<triton::ast::AbstractNode*>& uniqueNodes, triton::ast::AbstractNode* root) const;
 
-        //! [**AST garbage collector api**] - Records the allocated node or returns the same node if it already exists inside the dictionaries.
+        //! [**AST garbage collector api**] - Records the allocated node or returns the same node if it already exists inside the dictionaries. Returns the rewritten node with AST_REWRITING.
         triton::ast::AbstractNode* recordAstNode(triton::ast::AbstractNode* node);
 
         //! [**AST garbage collector api**] - Records a variable AST node.
-        void recordVariableAstNode(const std::string& name, triton::ast::AbstractNode* node);
+        void recordVariableAstNode(triton::usize symVarId, triton::ast::AbstractNode* node);
+
+        //! [**AST garbage collector api**] - Returns the allocator used to build nodes.
+        triton::ast::AstNodeAllocator* getAstNodeAllocator(void);
+
+        //! [**AST garbage collector api**] - Returns the shared immortal node of a small constant, or nullptr if the constant is not shared.
+        triton::ast::AbstractNode* getConstantAstNode(const triton::uint512& value, triton::uint32 size);
 
         //! [**AST garbage collector api**] - Returns all allocated nodes.
         const std::set<triton::ast::AbstractNode*>& getAllocatedAstNodes(void) const;
@@ -245,16 +722,28 @@ namespace triton {
         std::map<std::string, triton::usize> getAstDictionariesStats(void) const;
 
         //! [**AST garbage collector api**] - Returns all variable nodes recorded.
-        const std::map<std::string, triton::ast::AbstractNode*>& getAstVariableNodes(void) const;
+        const std::unordered_map<triton::usize, triton::ast::AbstractNode*>& getAstVariableNodes(void) const;
 
         //! [**AST garbage collector api**] - Returns the node of a recorded variable.
-        triton::ast::AbstractNode* getAstVariableNode(const std::string& name) const;
+        triton::ast::AbstractNode* getAstVariableNode(triton::usize symVarId) const;
 
         //! [**AST garbage collector api**] - Sets all allocated nodes.
         void setAllocatedAstNodes(const std::set<triton::ast::AbstractNode*>& nodes);
 
+        //! [**AST garbage collector api**] - Freezes every allocated node into a new generation shared read-only with the snapshots, and returns it.
+        std::shared_ptr<triton::ast::AstGeneration> freezeAstNodes(void);
+
+        //! [**AST garbage collector api**] - Restores a generation returned by freezeAstNodes(). The nodes allocated since the last freeze are freed.
+        void setAstGeneration(const std::shared_ptr<triton::ast::AstGeneration>& generation);
+
+        //! [**AST garbage collector api**] - Drops a generation and frees the nodes of the generations which are not held anymore.
+        void releaseAstGeneration(std::shared_ptr<triton::ast::AstGeneration>& generation);
+
+        //! [**AST garbage collector api**] - Returns the number of frozen nodes shared with the snapshots.
+        triton::usize getNumberOfFrozenAstNodes(void) const;
+
         //! [**AST garbage collector api**] - Sets all variable nodes recorded.
-        void setAstVariableNodes(const std::map<std::string, triton::ast::AbstractNode*>& nodes);
+        void setAstVariableNodes(const std::unordered_map<triton::usize, triton::ast::AbstractNode*>& nodes);
 
 
 
@@ -266,6 +755,15 @@ namespace triton {
         //! [**AST representation api**] - Sets the AST representation mode.
         void setAstRepresentationMode(triton::uint32 mode);
 
+        //! [**AST representation api**] - Writes ASTs in the binary serialization format. \sa triton::ast::AstWriter
+        void serializeAsts(std::ostream& stream, const std::vector<triton::ast::AbstractNode*>& asts) const;
+
+        //! [**AST representation api**] - Reads ASTs written by serializeAsts().
+        std::vector<triton::ast::AbstractNode*> deserializeAsts(std::istream& stream) const;
+
+        //! [**AST representation api**] - Reads an SMT-LIB2 script and returns its asserted terms. \sa triton::ast::AstSmtParser
+        std::vector<triton::ast::AbstractNode*> parseSmt(std::istream& stream) const;
+
 
 
         /* Callbacks API ================================================================================= */
@@ -273,15 +771,36 @@ namespace triton {
         //! [**callbacks api**] - Adds a GET_CONCRETE_MEMORY_VALUE callback.
         void addCallback(triton::callbacks::getConcreteMemoryValueCallback cb);
 
+        //! [**callbacks api**] - Adds a GET_CONCRETE_MEMORY_AREA_VALUE callback.
+        void addCallback(triton::callbacks::getConcreteMemoryAreaValueCallback cb);
+
         //! [**callbacks api**] - Adds a GET_CONCRETE_REGISTER_VALUE callback.
         void addCallback(triton::callbacks::getConcreteRegisterValueCallback cb);
 
         //! [**callbacks api**] - Adds a SYMBOLIC_SIMPLIFICATION callback.
         void addCallback(triton::callbacks::symbolicSimplificationCallback cb);
 
+        //! [**callbacks api**] - Adds a MEMORY_LIMIT callback.
+        void addCallback(triton::callbacks::memoryLimitCallback cb);
+
+        //! [**callbacks api**] - Adds an EXPRESSION_LIMIT callback.
+        void addCallback(triton::callbacks::expressionLimitCallback cb);
+
+        //! [**callbacks api**] - Adds a MEMORY_MISS callback.
+        void addCallback(triton::callbacks::memoryMissCallback cb);
+
         #ifdef TRITON_PYTHON_BINDINGS
         //! [**callbacks api**] - Adds a python callback.
         void addCallback(PyObject* function, triton::callbacks::callback_e kind);
+
+        //! [**callbacks api**] - Adds a batched python callback. \sa triton::callbacks::PyBatchedCallback.
+        void addBatchedCallback(PyObject* function, triton::callbacks::callback_e kind, triton::usize size);
+
+        //! [**callbacks api**] - Delivers the pending events of all batched python callbacks.
+        void flushCallbacks(void) const;
+
+        //! [**callbacks api**] - Returns true if there is at least one python callback, batched or not.
+        bool isPythonCallbackDefined(void) const;
         #endif
 
         //! [**callbacks api**] - Removes all recorded callbacks.
@@ -290,12 +809,24 @@ namespace triton {
         //! [**callbacks api**] - Deletes a GET_CONCRETE_MEMORY_VALUE callback.
         void removeCallback(triton::callbacks::getConcreteMemoryValueCallback cb);
 
+        //! [**callbacks api**] - Deletes a GET_CONCRETE_MEMORY_AREA_VALUE callback.
+        void removeCallback(triton::callbacks::getConcreteMemoryAreaValueCallback cb);
+
         //! [**callbacks api**] - Deletes a GET_CONCRETE_REGISTER_VALUE callback.
         void removeCallback(triton::callbacks::getConcreteRegisterValueCallback cb);
 
         //! [**callbacks api**] - Deletes a SYMBOLIC_SIMPLIFICATION callback.
         void removeCallback(triton::callbacks::symbolicSimplificationCallback cb);
 
+        //! [**callbacks api**] - Deletes a MEMORY_LIMIT callback.
+        void removeCallback(triton::callbacks::memoryLimitCallback cb);
+
+        //! [**callbacks api**] - Deletes an EXPRESSION_LIMIT callback.
+        void removeCallback(triton::callbacks::expressionLimitCallback cb);
+
+        //! [**callbacks api**] - Deletes a MEMORY_MISS callback.
+        void removeCallback(triton::callbacks::memoryMissCallback cb);
+
         #ifdef TRITON_PYTHON_BINDINGS
         //! [**callbacks api**] - Deletes a python callback according to its kind.
         void removeCallback(PyObject* function, triton::callbacks::callback_e kind);
@@ -310,6 +841,15 @@ namespace triton {
         //! [**callbacks api**] - Processes callbacks according to the kind and the C++ polymorphism.
         void processCallbacks(triton::callbacks::callback_e kind, const triton::arch::Register& reg) const;
 
+        //! [**callbacks api**] - Processes callbacks according to the kind and the C++ polymorphism.
+        void processCallbacks(triton::callbacks::callback_e kind, triton::uint64 baseAddr, triton::usize size) const;
+
+        //! [**callbacks api**] - Processes callbacks according to the kind and the C++ polymorphism.
+        void processCallbacks(triton::callbacks::callback_e kind, bool hard, triton::usize usage) const;
+
+        //! [**callbacks api**] - Processes callbacks according to the kind and the C++ polymorphism.
+        void processCallbacks(triton::callbacks::callback_e kind, triton::engines::symbolic::SymbolicExpression* expr) const;
+
 
 
         /* Modes API====================================================================================== */
@@ -339,9 +879,24 @@ namespace triton {
         //! [**symbolic api**] - Returns the map (<Addr : SymExpr>) of symbolic memory defined.
         std::map<triton::uint64, triton::engines::symbolic::SymbolicExpression*> getSymbolicMemory(void) const;
 
-        //! [**symbolic api**] - Returns the symbolic expression id corresponding to the memory address.
+        //! [**symbolic api**] - Returns the map (<Addr : SymExpr>) of symbolic memory defined in [start, end). Only the memory of the range is visited.
+        std::map<triton::uint64, triton::engines::symbolic::SymbolicExpression*> getSymbolicMemory(triton::uint64 start, triton::uint64 end) const;
+
+        //! [**symbolic api**] - Calls `callback` with every symbolic register and its expression without building a map.
+        void forEachSymbolicRegister(const std::function<void(const triton::arch::Register&, triton::engines::symbolic::SymbolicExpression*)>& callback) const;
+
+        //! [**symbolic api**] - Calls `callback` with every address of [start, end) which has a symbolic expression, in ascending order, without building a map.
+        void forEachSymbolicMemory(triton::uint64 start, triton::uint64 end, const std::function<void(triton::uint64, triton::engines::symbolic::SymbolicExpression*)>& callback) const;
+
+        //! [**symbolic api**] - Calls `callback` with every address which has a symbolic expression and the id of the expression, in ascending order of address, without building a map.
+        void forEachSymbolicMemoryId(const std::function<void(triton::uint64, triton::usize)>& callback) const;
+
+        //! [**symbolic api**] - Returns the symbolic expression id corresponding to the memory address. The expression may hold several bytes.
         triton::usize getSymbolicMemoryId(triton::uint64 addr) const;
 
+        //! [**symbolic api**] - Returns the symbolic expression id corresponding to the memory address, and the offset (in bytes) of the memory cell in the expression.
+        triton::usize getSymbolicMemoryId(triton::uint64 addr, triton::uint32& offset) const;
+
         //! [**symbolic api**] - Returns the symbolic expression id corresponding to the register.
         triton::usize getSymbolicRegisterId(const triton::arch::Register& reg) const;
 
@@ -357,12 +912,26 @@ namespace triton {
         //! [**symbolic api**] - Returns the symbolic register value.
         triton::uint512 getSymbolicRegisterValue(const triton::arch::Register& reg);
 
+        //! [**symbolic api**] - Returns the AST of the memory array (MEMORY_ARRAY mode). \sa triton::engines::symbolic::SymbolicEngine::getMemoryArray().
+        triton::ast::AbstractNode* getMemoryArray(void);
+
+        //! [**symbolic api**] - Copies the values of a memory area into the memory array, so that symbolic loads in this area are constrained by them.
+        void initMemoryArrayArea(triton::uint64 baseAddr, triton::usize size);
+
         //! [**symbolic api**] - Converts a symbolic expression to a symbolic variable. `symVarSize` must be in bits.
         triton::engines::symbolic::SymbolicVariable* convertExpressionToSymbolicVariable(triton::usize exprId, triton::uint32 symVarSize, const std::string& symVarComment="");
 
         //! [**symbolic api**] - Converts a symbolic memory expression to a symbolic variable.
         triton::engines::symbolic::SymbolicVariable* convertMemoryToSymbolicVariable(const triton::arch::MemoryAccess& mem, const std::string& symVarComment="");
 
+        /*!
+         * \brief [**symbolic api**] - Converts each word of `wordSize` bytes of a memory area to a symbolic variable.
+         *
+         * \description The AST nodes of the variables are reserved at once, so that they are carved out of the same
+         * slabs. `size` must be a multiple of `wordSize`, which is a power of two up to 64 bytes.
+         */
+        std::vector<triton::engines::symbolic::SymbolicVariable*> convertMemoryAreaToSymbolicVariables(triton::uint64 baseAddr, triton::usize size, const std::string& symVarComment="", triton::uint32 wordSize=BYTE_SIZE);
+
         //! [**symbolic api**] - Converts a symbolic register expression to a symbolic variable.
         triton::engines::symbolic::SymbolicVariable* convertRegisterToSymbolicVariable(const triton::arch::Register& reg, const std::string& symVarComment="");
 
@@ -399,6 +968,78 @@ namespace triton {
         //! [**symbolic api**] - Removes the symbolic expression corresponding to the id.
         void removeSymbolicExpression(triton::usize symExprId);
 
+        //! [**symbolic api**] - Pins a symbolic expression. Pinned expressions, and the ones they reference, are never collected.
+        void pinSymbolicExpression(triton::usize symExprId);
+
+        //! [**symbolic api**] - Unpins a symbolic expression.
+        void unpinSymbolicExpression(triton::usize symExprId);
+
+        //! [**symbolic api**] - Removes the symbolic expressions which are not reachable anymore and frees their AST nodes.
+        void collectUnreachableExpressions(void);
+
+        //! [**symbolic api**] - Sets the maximum number of AST nodes before the oldest symbolic references are concretized. 0 if unlimited. \sa triton::engines::symbolic::SymbolicEngine::setNodeBudget().
+        void setNodeBudget(triton::usize budget);
+
+        //! [**symbolic api**] - Returns the maximum number of AST nodes before the oldest symbolic references are concretized. 0 if unlimited.
+        triton::usize getNodeBudget(void) const;
+
+        //! [**symbolic api**] - Sets the maximum number of instructions whose references are kept symbolic. 0 if unlimited. \sa triton::engines::symbolic::SymbolicEngine::setInstructionWindow().
+        void setInstructionWindow(triton::usize size);
+
+        //! [**symbolic api**] - Returns the maximum number of instructions whose references are kept symbolic. 0 if unlimited.
+        triton::usize getInstructionWindow(void) const;
+
+        //! [**symbolic api**] - Streams the dependency graph of the expressions built from now on to `path`, in binary or in CSV. It replaces the previous sink. \sa triton::engines::symbolic::DependencyFileSink.
+        void exportDependencies(const std::string& path, bool csv=false);
+
+        //! [**symbolic api**] - Stops streaming the dependency graph. The pending records are written and the file is closed.
+        void stopDependencyExport(void);
+
+        //! [**symbolic api**] - Attaches a receiver of the dependency graph, not owned (nullptr detaches it). It replaces the previous sink. \sa triton::engines::symbolic::SymbolicEngine::setDependencySink().
+        void setDependencySink(triton::engines::symbolic::DependencySink* sink);
+
+        //! [**symbolic api**] - Sets the policy of the memory accesses whose address is symbolized, for an instruction address. \sa triton::engines::symbolic::SymbolicEngine::setPointerPolicy().
+        void setPointerPolicy(triton::uint64 address, triton::engines::symbolic::pointer_policy_e policy, triton::uint32 range=triton::engines::symbolic::SymbolicEngine::defaultPointerRange);
+
+        //! [**symbolic api**] - Sets the pointer policy of the instructions without their own. \sa triton::engines::symbolic::SymbolicEngine::setDefaultPointerPolicy().
+        void setDefaultPointerPolicy(triton::engines::symbolic::pointer_policy_e policy, triton::uint32 range=triton::engines::symbolic::SymbolicEngine::defaultPointerRange);
+
+        //! [**symbolic api**] - Returns the pointer policy of an instruction address.
+        const triton::engines::symbolic::PointerPolicy& getPointerPolicy(triton::uint64 address) const;
+
+        //! [**symbolic api**] - Removes the pointer policies of the instruction addresses and the cached bounds. The default policy is kept.
+        void clearPointerPolicies(void);
+
+        //! [**symbolic api**] - Adds the addresses `[start:end)` to the symbolic regions. \sa triton::engines::symbolic::SymbolicEngine::addSymbolicRegion().
+        void addSymbolicRegion(triton::uint64 start, triton::uint64 end);
+
+        //! [**symbolic api**] - Removes the addresses `[start:end)` from the symbolic regions.
+        void removeSymbolicRegion(triton::uint64 start, triton::uint64 end);
+
+        //! [**symbolic api**] - Removes every symbolic region, every address is symbolic again.
+        void clearSymbolicRegions(void);
+
+        //! [**symbolic api**] - Returns the symbolic regions, the first address of each region mapped to its end (excluded).
+        const std::map<triton::uint64, triton::uint64>& getSymbolicRegions(void) const;
+
+        //! [**symbolic api**] - Sets the maximum depth and unrolled size of the symbolic expressions. 0 if unlimited. \sa triton::engines::symbolic::SymbolicEngine::setExpressionLimits().
+        void setExpressionLimits(triton::uint32 depth, triton::uint64 size);
+
+        //! [**symbolic api**] - Sets the maximum number of nodes of the ASTs used instead of a reference (INLINE_REFERENCES mode). \sa triton::engines::symbolic::SymbolicEngine::setInlineReferenceSize().
+        void setInlineReferenceSize(triton::usize size);
+
+        //! [**symbolic api**] - Returns the maximum number of nodes of the ASTs used instead of a reference (INLINE_REFERENCES mode).
+        triton::usize getInlineReferenceSize(void) const;
+
+        //! [**symbolic api**] - Returns the profiles of the expressions by instruction address (EXPRESSION_PROFILING mode). \sa triton::engines::symbolic::SymbolicEngine::profileExpressions().
+        const std::map<triton::uint64, triton::engines::symbolic::ExpressionProfile>& getExpressionProfile(void) const;
+
+        //! [**symbolic api**] - Clears the profiles of the expressions.
+        void clearExpressionProfile(void);
+
+        //! [**symbolic api**] - Writes the profiles of the `count` addresses (0 for all) which allocated the most nodes, as CSV, or as JSON if `json` is true.
+        void dumpExpressionProfile(std::ostream& stream, triton::usize count=0, bool json=false) const;
+
         //! [**symbolic api**] - Returns the new symbolic abstract expression and links this expression to the instruction.
         triton::engines::symbolic::SymbolicExpression* createSymbolicExpression(triton::arch::Instruction& inst, triton::ast::AbstractNode* node, triton::arch::OperandWrapper& dst, const std::string& comment="");
 
@@ -438,12 +1079,30 @@ namespace triton {
         //! [**symbolic api**] - Returns the logical conjunction AST of path constraints.
         triton::ast::AbstractNode* getPathConstraintsAst(void);
 
+        //! [**symbolic api**] - Returns the indexes of the path constraints before `index` which share symbolic variables with it, transitively. \sa triton::engines::symbolic::PathManager::getPathConstraintsSlice().
+        std::vector<triton::usize> getPathConstraintsSlice(triton::usize index) const;
+
+        //! [**symbolic api**] - Returns the logical conjunction AST of the path constraints of the slice of the path constraint `index`.
+        triton::ast::AbstractNode* getPathConstraintsSliceAst(triton::usize index) const;
+
         //! [**symbolic api**] - Adds a path constraint.
         void addPathConstraint(const triton::arch::Instruction& inst, triton::engines::symbolic::SymbolicExpression* expr);
 
         //! [**symbolic api**] - Clears the logical conjunction vector of path constraints.
         void clearPathConstraints(void);
 
+        //! [**symbolic api**] - Returns the maximum number of path constraints recorded by branch instruction. 0 if unlimited.
+        triton::usize getMaxPathConstraintsPerBranch(void) const;
+
+        //! [**symbolic api**] - Sets the maximum number of path constraints recorded by branch instruction. 0 if unlimited.
+        void setMaxPathConstraintsPerBranch(triton::usize limit);
+
+        //! [**symbolic api**] - Writes the symbolic variables, expressions, references and path constraints in the binary serialization format.
+        void serializeSymbolicState(std::ostream& stream);
+
+        //! [**symbolic api**] - Reads a symbolic state written by serializeSymbolicState() and adds it to the current one. Variables and expressions get new ids.
+        void deserializeSymbolicState(std::istream& stream);
+
         //! [**symbolic api**] - Enables or disables the symbolic execution engine.
         void enableSymbolicEngine(bool flag);
 
@@ -480,6 +1139,15 @@ namespace triton {
         //! [**symbolic api**] - Returns the partial AST from a symbolic expression id.
         triton::ast::AbstractNode* getAstFromId(triton::usize symExprId);
 
+        //! [**symbolic api**] - Evaluates an AST with the values of `assignment` (symbolic variable id -> value). Other variables keep their concrete value.
+        triton::uint512 evaluateAst(triton::ast::AbstractNode* node, const std::map<triton::usize, triton::uint512>& assignment) const;
+
+        //! [**symbolic api**] - Evaluates an AST under several assignments. The AST is compiled once and evaluated by batches with native words if every node fits in 64 bits.
+        std::vector<triton::uint512> evaluateAst(triton::ast::AbstractNode* node, const std::vector<std::map<triton::usize, triton::uint512>>& assignments) const;
+
+        //! [**symbolic api**] - Returns the indexes of the assignments under which an AST (e.g. a constraint) is not zero. See evaluateAst().
+        std::vector<triton::usize> filterAssignments(triton::ast::AbstractNode* node, const std::vector<std::map<triton::usize, triton::uint512>>& assignments) const;
+
         //! [**symbolic api**] - Returns the full AST of a root node.
         triton::ast::AbstractNode* getFullAst(triton::ast::AbstractNode* node);
 
@@ -489,14 +1157,14 @@ namespace triton {
         //! [**symbolic api**] - Slices all expressions from a given one.
         std::map<triton::usize, triton::engines::symbolic::SymbolicExpression*> sliceExpressions(triton::engines::symbolic::SymbolicExpression* expr);
 
-        //! [**symbolic api**] - Returns the list of the tainted symbolic expressions.
-        std::list<triton::engines::symbolic::SymbolicExpression*> getTaintedSymbolicExpressions(void) const;
+        //! [**symbolic api**] - Returns the list of the tainted symbolic expressions whose id is greater than or equal to `fromId`.
+        std::list<triton::engines::symbolic::SymbolicExpression*> getTaintedSymbolicExpressions(triton::usize fromId=0) const;
 
         //! [**symbolic api**] - Returns all symbolic expressions as a map of <SymExprId : SymExpr>
-        const std::map<triton::usize, triton::engines::symbolic::SymbolicExpression*>& getSymbolicExpressions(void) const;
+        std::map<triton::usize, triton::engines::symbolic::SymbolicExpression*> getSymbolicExpressions(void) const;
 
         //! [**symbolic api**] - Returns all symbolic variables as a map of <SymVarId : SymVar>
-        const std::map<triton::usize, triton::engines::symbolic::SymbolicVariable*>& getSymbolicVariables(void) const;
+        std::map<triton::usize, triton::engines::symbolic::SymbolicVariable*> getSymbolicVariables(void) const;
 
 
 
@@ -509,19 +1177,135 @@ namespace triton {
          * \brief [**solver api**] - Computes and returns a model from a symbolic constraint.
          *
          * \description
+         * A `timeout` (in milliseconds) of 0 uses the timeout of the solver engine.
          * **item1**: symbolic variable id<br>
          * **item2**: model
          */
-        std::map<triton::uint32, triton::engines::solver::SolverModel> getModel(triton::ast::AbstractNode* node) const;
+        std::map<triton::uint32, triton::engines::solver::SolverModel> getModel(triton::ast::AbstractNode* node, triton::uint32 timeout=0) const;
+
+        //! [**solver api**] - Computes and returns a model of a symbolic constraint once the symbolic variables which are not free have been concretized. \sa triton::engines::solver::SolverEngine::getPartialModel().
+        std::map<triton::uint32, triton::engines::solver::SolverModel> getPartialModel(triton::ast::AbstractNode* node, const std::vector<triton::engines::symbolic::SymbolicVariable*>& freeVariables, triton::uint32 timeout=0) const;
 
         /*!
          * \brief [**solver api**] - Computes and returns several models from a symbolic constraint. The `limit` is the number of models returned.
          *
          * \description
+         * With more than one `threads`, parts of the model space are enumerated in parallel.
          * **item1**: symbolic variable id<br>
          * **item2**: model
          */
-        std::list<std::map<triton::uint32, triton::engines::solver::SolverModel>> getModels(triton::ast::AbstractNode* node, triton::uint32 limit) const;
+        std::list<std::map<triton::uint32, triton::engines::solver::SolverModel>> getModels(triton::ast::AbstractNode* node, triton::uint32 limit, triton::uint32 threads=1) const;
+
+        //! [**solver api**] - Submits a symbolic constraint to a background thread and returns the id of the query. The query owns a copy of the formula.
+        triton::usize getModelAsync(triton::ast::AbstractNode* node, triton::uint32 timeout=0);
+
+        //! [**solver api**] - Returns true if an asynchronous query is solved.
+        bool isAsyncModelReady(triton::usize id) const;
+
+        //! [**solver api**] - Waits for an asynchronous query, forgets it and returns its model.
+        std::map<triton::uint32, triton::engines::solver::SolverModel> getAsyncModel(triton::usize id);
+
+        //! [**solver api**] - Sets the timeout of the solver queries in milliseconds. 0 if unlimited.
+        void setSolverTimeout(triton::uint32 timeout);
+
+        //! [**solver api**] - Sets the number of concrete evaluations tried before a query is sent to the solver. 0 disables the local search.
+        void setSolverLocalSearchBudget(triton::uint32 budget);
+
+        //! [**solver api**] - Sets the maximum amount of memory used by the solver in megabytes. 0 if unlimited.
+        void setSolverMemoryLimit(triton::uint32 limit);
+
+        //! [**solver api**] - Sets the resource limit (rlimit) of the solver queries. 0 if unlimited.
+        void setSolverResourceLimit(triton::uint32 limit);
+
+        //! [**solver api**] - Sets the backend of the single model queries (see triton::engines::solver::solver_e). Raises an exception if Triton has been built without it.
+        void setSolverBackend(triton::engines::solver::solver_e backend);
+
+        //! [**solver api**] - Returns the backend of the single model queries.
+        triton::engines::solver::solver_e getSolverBackend(void) const;
+
+        //! [**solver api**] - Sets the number of solvers racing on a query in the PORTFOLIO mode. 0 for one per core.
+        void setSolverPortfolioSize(triton::uint32 size);
+
+        //! [**solver api**] - Sends the solver queries to a remote solver daemon (`triton-solverd`). An empty address solves them locally.
+        void setRemoteSolver(const std::string& address);
+
+        //! [**solver api**] - Returns the address of the remote solver daemon, empty if the queries are solved locally.
+        const std::string& getRemoteSolver(void) const;
+
+        //! [**solver api**] - Returns the status of the last solver query.
+        triton::engines::solver::status_e getLastSolverStatus(void) const;
+
+        //! [**solver api**] - Returns the number of queries answered by the query cache of the solver.
+        triton::usize getQueryCacheHits(void) const;
+
+        //! [**solver api**] - Returns the number of queries which were not in the query cache of the solver.
+        triton::usize getQueryCacheMisses(void) const;
+
+        //! [**solver api**] - Clears the query cache of the solver and its statistics.
+        void clearQueryCache(void);
+
+        //! [**solver api**] - Starts a solver session. The Z3 context and the asserted constraints are kept between queries.
+        void startSolverSession(void);
+
+        //! [**solver api**] - Stops the solver session.
+        void stopSolverSession(void);
+
+        //! [**solver api**] - Returns true if a solver session is started.
+        bool isSolverSessionStarted(void) const;
+
+        /*!
+         * \brief [**solver api**] - Computes and returns a model from a symbolic constraint, under the constraints of `prefix`, inside the solver session.
+         *
+         * \description
+         * Constraints shared with the prefix of the previous query stay asserted.
+         * **item1**: symbolic variable id<br>
+         * **item2**: model
+         */
+        std::map<triton::uint32, triton::engines::solver::SolverModel> getSessionModel(const std::vector<triton::ast::AbstractNode*>& prefix, triton::ast::AbstractNode* node);
+
+        //! [**solver api**] - Computes the models which flip every branch of a path: the model `i` satisfies `pathConstraints[0..i)` and not `pathConstraints[i]`, empty if unsat. The path is translated once into a single solver.
+        std::vector<std::map<triton::uint32, triton::engines::solver::SolverModel>> getModelsForBranches(const std::vector<triton::ast::AbstractNode*>& pathConstraints) const;
+
+
+
+        /* Syscall emulation API ========================================================================= */
+
+        //! [**syscall api**] - Raises an exception if the syscall emulator is not initialized.
+        void checkSyscallEmulator(void) const;
+
+        //! [**syscall api**] - Returns the instance of the syscall emulator (its virtual file system, its heap, the exit status).
+        triton::os::unix::SyscallEmulator* getSyscallEmulator(void);
+
+        //! [**syscall api**] - Enables or disables the emulation of the Linux x86-64 syscalls by run(). \sa triton::os::unix::SyscallEmulator.
+        void enableSyscallEmulation(bool flag);
+
+        //! [**syscall api**] - Returns true if the syscalls are emulated by run().
+        bool isSyscallEmulationEnabled(void) const;
+
+
+
+        /* Function summaries API ======================================================================== */
+
+        //! [**summaries api**] - Raises an exception if the function summaries are not initialized.
+        void checkFunctionSummaries(void) const;
+
+        //! [**summaries api**] - Returns the instance of the function summaries. \sa triton::os::unix::FunctionSummaries.
+        triton::os::unix::FunctionSummaries* getFunctionSummaries(void);
+
+        //! [**summaries api**] - Summarizes the routine `name` (e.g. `strlen`) at `addr` when it is reached by run().
+        void addFunctionSummary(triton::uint64 addr, const std::string& name);
+
+        //! [**summaries api**] - Summarizes the routines of a binary defined or imported by it. Returns the number of routines summarized.
+        triton::usize addFunctionSummaries(const triton::format::AbstractBinary& binary);
+
+        //! [**summaries api**] - Summarizes the routines of a binary defined or imported by it. Returns the number of routines summarized.
+        triton::usize addFunctionSummaries(const triton::format::BinaryInterface& binary);
+
+        //! [**summaries api**] - Learns the summaries of the pure function at `addr`, which takes `argc` register arguments, when it is reached by run(). \sa triton::os::unix::FunctionSummaries.
+        void addLearnedFunctionSummary(triton::uint64 addr, triton::uint32 argc);
+
+        //! [**summaries api**] - Removes the function summary of an address.
+        void removeFunctionSummary(triton::uint64 addr);
 
 
 
@@ -547,10 +1331,13 @@ namespace triton {
         triton::engines::taint::TaintEngine* getTaintEngine(void);
 
         //! [**taint api**] - Returns the tainted addresses.
-        const std::set<triton::uint64>& getTaintedMemory(void) const;
+        std::set<triton::uint64> getTaintedMemory(void) const;
+
+        //! [**taint api**] - Calls `callback` with the address and the size of every range of tainted memory, in ascending order, without building a set.
+        void forEachTaintedMemoryRange(const std::function<void(triton::uint64, triton::usize)>& callback) const;
 
         //! [**taint api**] - Returns the tainted registers.
-        const std::set<triton::arch::Register>& getTaintedRegisters(void) const;
+        std::set<triton::arch::Register> getTaintedRegisters(void) const;
 
         //! [**taint api**] - Enables or disables the taint engine.
         void enableTaintEngine(bool flag);
@@ -585,18 +1372,42 @@ namespace triton {
         //! [**taint api**] - Taints a memory. Returns TAINTED if the memory has been tainted correctly. Otherwise it returns the last defined state.
         bool taintMemory(const triton::arch::MemoryAccess& mem);
 
+        //! [**taint api**] - Taints a memory area. Returns TAINTED if the area has been tainted correctly. Otherwise it returns the last defined state.
+        bool taintMemoryArea(triton::uint64 baseAddr, triton::usize size);
+
         //! [**taint api**] - Taints a register. Returns TAINTED if the register has been tainted correctly. Otherwise it returns the last defined state.
         bool taintRegister(const triton::arch::Register& reg);
 
+        //! [**taint api**] - Spreads the taint of a copy of `size` bytes from `src` to `dst` (e.g. memcpy). Returns TAINTED if the destination is tainted.
+        bool taintAssignmentMemoryArea(triton::uint64 dst, triton::uint64 src, triton::usize size);
+
+        //! [**taint api**] - Spreads the taint of a union of `size` bytes from `src` into `dst`. Returns TAINTED if the destination is tainted.
+        bool taintUnionMemoryArea(triton::uint64 dst, triton::uint64 src, triton::usize size);
+
         //! [**taint api**] - Untaints an address. Returns !TAINTED if the address has been untainted correctly. Otherwise it returns the last defined state.
         bool untaintMemory(triton::uint64 addr);
 
         //! [**taint api**] - Untaints a memory. Returns !TAINTED if the memory has been untainted correctly. Otherwise it returns the last defined state.
         bool untaintMemory(const triton::arch::MemoryAccess& mem);
 
+        //! [**taint api**] - Untaints a memory area. Returns !TAINTED if the area has been untainted correctly. Otherwise it returns the last defined state.
+        bool untaintMemoryArea(triton::uint64 baseAddr, triton::usize size);
+
         //! [**taint api**] - Untaints a register. Returns !TAINTED if the register has been untainted correctly. Otherwise it returns the last defined state.
         bool untaintRegister(const triton::arch::Register& reg);
 
+        //! [**taint api**] - Taints an address with a label added to its labels. Returns TAINTED if the address has been tainted correctly. Otherwise it returns the last defined state.
+        bool labelMemory(triton::uint64 addr, triton::uint32 label);
+
+        //! [**taint api**] - Taints a register with a label added to its labels. Returns TAINTED if the register has been tainted correctly. Otherwise it returns the last defined state.
+        bool labelRegister(const triton::arch::Register& reg, triton::uint32 label);
+
+        //! [**taint api**] - Returns the labels of a memory area.
+        std::set<triton::uint32> getMemoryLabels(triton::uint64 addr, triton::usize size=1) const;
+
+        //! [**taint api**] - Returns the labels of a register.
+        std::set<triton::uint32> getRegisterLabels(const triton::arch::Register& reg) const;
+
         //! [**taint api**] - Abstract union tainting.
         bool taintUnion(const triton::arch::OperandWrapper& op1, const triton::arch::OperandWrapper& op2);
 
@@ -640,9 +1451,12 @@ namespace triton {
         bool taintAssignmentRegisterRegister(const triton::arch::Register& regDst, const triton::arch::Register& regSrc);
     };
 
-    //! The API can be accessed everywhere (WIP: will be removed).
+    //! The default API, bound to every thread until it calls triton::API::bind(). The Python bindings and the Pin tool use the API bound to the calling thread.
     extern triton::API api;
 
+    //! Returns the API bound to the calling thread. \sa triton::API::bind().
+    triton::API& getCurrentApi(void);
+
 /*! @} End of triton namespace */
 };
 
@@ -9,6 +9,7 @@
 #define TRITON_ARCHITECTURE_H
 
 #include <set>
+#include <tuple>
 #include <vector>
 
 #include "callbacks.hpp"
@@ -51,6 +52,21 @@ namespace triton {
         //! Callbacks API
         triton::callbacks::Callbacks* callbacks;
 
+        //! Previous values of the parent registers written since the journals have been started.
+        std::vector<triton::arch::Register> journalRegisters;
+
+        //! Previous values of the bytes written (address, value, true if the byte was mapped).
+        std::vector<std::tuple<triton::uint64, triton::uint8, bool>> journalMemory;
+
+        //! The number of entries of `journalRegisters` and `journalMemory` when each journal has been started, the innermost last.
+        std::vector<std::pair<triton::usize, triton::usize>> journalMarks;
+
+        //! Records the value of the parent of a register into the journal before it is written.
+        void recordRegister(const triton::arch::Register& reg);
+
+        //! Records the values of a range of bytes into the journal before they are written.
+        void recordMemory(triton::uint64 addr, triton::usize size);
+
       protected:
         //! The kind of architecture.
         triton::uint32 arch;
@@ -110,6 +126,9 @@ namespace triton {
         //! Returns all information about the register.
         triton::arch::RegisterSpecification getRegisterSpecification(triton::uint32 regId) const;
 
+        //! Returns the row of the constant specification table of the register, without allocation.
+        const triton::arch::RegisterSpecificationEntry& getRegisterSpecificationEntry(triton::uint32 regId) const;
+
         //! Returns all registers.
         std::set<triton::arch::Register*> getAllRegisters(void) const;
 
@@ -131,6 +150,9 @@ namespace triton {
         //! Returns the concrete value of a memory area.
         std::vector<triton::uint8> getConcreteMemoryAreaValue(triton::uint64 baseAddr, triton::usize size, bool execCallbacks=true) const;
 
+        //! Reads the concrete value of a memory area into `area`, which holds at least `size` bytes.
+        void getConcreteMemoryAreaValue(triton::uint64 baseAddr, triton::uint8* area, triton::usize size, bool execCallbacks=true) const;
+
         //! Returns the concrete value of a register.
         triton::uint512 getConcreteRegisterValue(const triton::arch::Register& reg, bool execCallbacks=true) const;
 
@@ -174,11 +196,26 @@ namespace triton {
          */
         void setConcreteRegisterValue(const triton::arch::Register& reg);
 
+        //! Starts recording the previous values of the registers and the bytes written into a journal. Journals are nested.
+        void startJournal(void);
+
+        //! Restores the registers and the bytes written since the innermost journal has been started and stops it. The bytes which were not mapped are unmapped.
+        void rollbackJournal(void);
+
+        //! Stops every journal and keeps the changes they recorded.
+        void clearJournal(void);
+
         //! Returns true if the range `[baseAddr:size]` is mapped into the internal memory representation. \sa getConcreteMemoryValue() and getConcreteMemoryAreaValue().
         bool isMemoryMapped(triton::uint64 baseAddr, triton::usize size=1);
 
         //! Removes the range `[baseAddr:size]` from the internal memory representation. \sa isMemoryMapped().
         void unmapMemory(triton::uint64 baseAddr, triton::usize size=1);
+
+        //! Returns the number of pages allocated by the internal memory representation.
+        triton::usize getNumberOfMemoryPages(void) const;
+
+        //! Returns the estimated number of bytes used by the concrete state (registers and memory).
+        triton::usize getMemoryUsage(void) const;
     };
 
   /*! @} End of arch namespace */
@@ -8,8 +8,10 @@
 #ifndef TRITON_AST_H
 #define TRITON_AST_H
 
+#include <atomic>
 #include <list>
 #include <map>
+#include <new>
 #include <ostream>
 #include <set>
 #include <stdexcept>
@@ -17,6 +19,8 @@
 #include <vector>
 
 #include "astEnums.hpp"
+#include "astNodeAllocator.hpp"
+#include "astVariableSet.hpp"
 #include "astVisitor.hpp"
 #include "symbolicVariable.hpp"
 #include "tritonTypes.hpp"
@@ -30,6 +34,12 @@ namespace triton {
  *  @{
  */
 
+  namespace engines {
+    namespace symbolic {
+      class SymbolicExpression;
+    };
+  };
+
   //! The AST namespace
   namespace ast {
   /*!
@@ -47,18 +57,69 @@ namespace triton {
         //! The childs of the node.
         std::vector<AbstractNode*> childs;
 
-        //! The parents of the node. Empty if there is still no parent.
-        std::set<AbstractNode*> parents;
+        //! The parents of the node, kept sorted and unique. Empty if there is still no parent.
+        std::vector<AbstractNode*> parents;
 
         //! The size of the node.
         triton::uint32 size;
 
-        //! The value of the tree from this root node.
-        triton::uint512 eval;
+        //! The value of the tree from this root node if its size is lesser than or equal to 64 bits.
+        triton::uint64 eval;
+
+        //! The value of the tree from this root node if its size is greater than 64 bits, nullptr otherwise.
+        triton::uint512* wideEval;
+
+        //! Sets the value of the tree according to the size of the node. The size must be set before.
+        void setEvaluation(const triton::uint512& value);
+
+        //! Sets the value of the tree of a node lesser than or equal to 64 bits.
+        void setEvaluation64(triton::uint64 value);
 
         //! This value is set to true if the tree contains a symbolic variable.
         bool symbolized;
 
+        //! True if the node is shared by every tree and never freed. It keeps no parent and no reference count.
+        bool immortal;
+
+        //! True if the node belongs to a frozen generation of the garbage collector (cf. AstGarbageCollector::freezeAstNodes()).
+        bool frozen;
+
+        //! The symbolic variables of the tree from this root node, references unrolled. nullptr if there is none.
+        const VariableSet* variables;
+
+        //! The structural hash of the node computed by the AST dictionaries. 0 if the node is not recorded.
+        triton::uint64 structuralHash;
+
+        //! The number of holders (parents, symbolic expressions, aligned memory) of the node. Atomic, frozen nodes are shared by the states.
+        std::atomic<triton::uint32> referenceCount;
+
+        //! The depth of the tree from this root node, references unrolled. 1 for a leaf.
+        triton::uint32 depth;
+
+        //! The number of nodes of the tree from this root node once unrolled (shared subtrees counted once per use), saturated.
+        triton::uint64 unrolledSize;
+
+        //! The bits known to be 0 whatever the values of the variables. Only tracked for nodes lesser than or equal to 64 bits.
+        triton::uint64 knownZeros;
+
+        //! The bits known to be 1 whatever the values of the variables. Only tracked for nodes lesser than or equal to 64 bits.
+        triton::uint64 knownOnes;
+
+        //! The lowest unsigned value the tree can take.
+        triton::uint64 minimum;
+
+        //! The highest unsigned value the tree can take.
+        triton::uint64 maximum;
+
+        //! Sets the depth, the unrolled size, the variables and the abstract value from the childs. The childs must be initialized before.
+        void initMetrics(void);
+
+        //! Sets the known bits and the interval from the childs, the size, the evaluation and the symbolized flag. The childs must be initialized before.
+        void initDomain(void);
+
+        //! Sets the known bits and the interval, which refine each other. The size must be set before.
+        void setDomain(triton::uint64 zeros, triton::uint64 ones, triton::uint64 minimum, triton::uint64 maximum);
+
       public:
         //! Constructor.
         AbstractNode(enum kind_e kind);
@@ -72,24 +133,120 @@ namespace triton {
         //! Destructor.
         virtual ~AbstractNode();
 
+        //! Allocates a node on the global heap.
+        static void* operator new(std::size_t size);
+
+        //! Allocates a node on the global heap. Returns nullptr if there is not enough memory.
+        static void* operator new(std::size_t size, const std::nothrow_t&) throw();
+
+        //! Allocates a node from an AST node allocator. Returns nullptr if there is not enough memory.
+        static void* operator new(std::size_t size, AstNodeAllocator* allocator) throw();
+
+        //! Releases a node whatever its allocator.
+        static void operator delete(void* ptr);
+
+        //! Releases a node if its constructor throws.
+        static void operator delete(void* ptr, const std::nothrow_t&) throw();
+
+        //! Releases a node if its constructor throws.
+        static void operator delete(void* ptr, AstNodeAllocator* allocator) throw();
+
         //! Returns the kind of the node.
         enum kind_e getKind(void) const;
 
+        //! Returns the structural hash of the node (kind, size, childs and payload). 0 if the node is not recorded into the AST dictionaries.
+        triton::uint64 getStructuralHash(void) const;
+
+        //! Sets the structural hash of the node.
+        void setStructuralHash(triton::uint64 hash);
+
+        //! Returns the number of holders of the node.
+        triton::uint32 getReferenceCount(void) const;
+
+        //! Increments the number of holders of the node.
+        void incReference(void);
+
+        //! Decrements the number of holders of the node and returns the new count. The node is not freed.
+        triton::uint32 decReference(void);
+
+        //! Returns true if the node is shared by every tree and never freed (cf. AstGarbageCollector::getConstantNode()).
+        bool isImmortal(void) const;
+
+        //! Makes the node immortal. Its childs must be immortal too.
+        void setImmortal(void);
+
+        //! Returns true if the node belongs to a frozen generation, shared read-only by the snapshots and never freed by the garbage collector.
+        bool isFrozen(void) const;
+
+        /*!
+         * \brief Freezes the node. Its childs must be frozen or immortal too.
+         *
+         * \description
+         * A frozen node cannot be modified and keeps no new parent, so the nodes built over it do not write into
+         * it. As a consequence, replacing the AST of an expression whose AST is frozen does not update the
+         * references to the expression which have been built since the freeze.
+         */
+        void setFrozen(void);
+
         //! Returns the size of the node.
         triton::uint32 getBitvectorSize(void) const;
 
         //! Returns the vector mask according the size of the node.
         triton::uint512 getBitvectorMask(void) const;
 
+        //! Returns the vector mask according the size of the node. Only valid for nodes lesser than or equal to 64 bits.
+        triton::uint64 getBitvectorMask64(void) const;
+
         //! According to the size of the expression, returns true if the MSB is 1.
         bool isSigned(void) const;
 
         //! Returns true if the tree contains a symbolic variable.
         bool isSymbolized(void) const;
 
+        /*!
+         * \brief Returns the symbolic variables of the tree, references unrolled. nullptr if there is none.
+         *
+         * \description
+         * The set is computed from the sets of the childs by init(), so it is free to read. Sets are hash-consed,
+         * two trees depend on the same variables if their sets are the same pointer. An array is symbolized
+         * but it is not a variable, so a symbolized tree may have no variable.
+         */
+        const VariableSet* getVariables(void) const;
+
+        //! Returns the depth of the tree from this root node, references unrolled. Maintained by init(), so it is free to read.
+        triton::uint32 getDepth(void) const;
+
+        //! Returns the number of nodes of the tree once unrolled as by getFullAst(), saturated. Maintained by init(), so it is free to read.
+        triton::uint64 getUnrolledSize(void) const;
+
+        /*!
+         * \brief Returns the bits known to be 0 whatever the values of the variables.
+         *
+         * \description
+         * Every node carries an abstract value, the bits known to be 0 or 1 and an unsigned interval of its
+         * values, computed from the abstract values of the childs by init(), so it is free to read. The value
+         * of a tree without symbolic variable is known. Nodes wider than 64 bits and arrays know nothing.
+         */
+        triton::uint64 getKnownZeros(void) const;
+
+        //! Returns the bits known to be 1 whatever the values of the variables. \sa getKnownZeros()
+        triton::uint64 getKnownOnes(void) const;
+
+        //! Returns the lowest unsigned value the tree can take. \sa getKnownZeros()
+        triton::uint64 getMinimum(void) const;
+
+        //! Returns the highest unsigned value the tree can take. \sa getKnownZeros()
+        triton::uint64 getMaximum(void) const;
+
+        //! Returns true if every bit of the node is known, the tree then has the same value whatever the values of the variables.
+        bool isKnown(void) const;
+
         //! Evaluates the tree.
         triton::uint512 evaluate(void) const;
 
+        //! Evaluates the tree without multiprecision arithmetic. Returns the 64 lowest bits for wider nodes.
+        triton::uint64 evaluate64(void) const;
+
         //! Returns the childs of the node.
         std::vector<AbstractNode*>& getChilds(void);
 
@@ -99,16 +256,19 @@ namespace triton {
          * Note that if there is the `AST_DICTIONARIES` optimization enabled, this feature will
          * probably not represent the real tree of your expression.
          */
-        std::set<AbstractNode*>& getParents(void);
+        const std::vector<AbstractNode*>& getParents(void) const;
 
         //! Removes a parent node.
         void removeParent(AbstractNode* p);
 
+        //! Removes all the parent nodes.
+        void clearParents(void);
+
         //! Sets a parent node.
         void setParent(AbstractNode* p);
 
         //! Sets the parent nodes.
-        void setParent(std::set<AbstractNode*>& p);
+        void setParent(const std::vector<AbstractNode*>& p);
 
         //! Sets the size of the node.
         void setBitvectorSize(triton::uint32 size);
@@ -130,6 +290,25 @@ namespace triton {
     };
 
 
+    //! Array node, an array of bytes indexed by bitvectors of `indexSize` bits
+    class ArrayNode : public AbstractNode {
+      protected:
+        triton::uint32 indexSize;
+        std::string name;
+
+      public:
+        ArrayNode(triton::uint32 indexSize, std::string name);
+        ArrayNode(const ArrayNode& copy);
+        virtual ~ArrayNode();
+        virtual void init(void);
+        virtual void accept(AstVisitor& v);
+        virtual triton::uint512 hash(triton::uint32 deep);
+
+        triton::uint32 getIndexSize(void);
+        std::string getName(void);
+    };
+
+
     //! `(assert <expr1>)` node
     class AssertNode : public AbstractNode {
       public:
@@ -508,6 +687,7 @@ namespace triton {
     class BvNode : public AbstractNode {
       public:
         BvNode(triton::uint512 value, triton::uint32 size);
+        BvNode(AbstractNode* value, AbstractNode* size);
         BvNode(const BvNode& copy);
         virtual ~BvNode();
         virtual void init(void);
@@ -672,6 +852,12 @@ namespace triton {
       protected:
         triton::usize value;
 
+        //! The expression of the reference, nullptr if it has not been found.
+        triton::engines::symbolic::SymbolicExpression* expr;
+
+        //! The number of deleted expressions when `expr` has been looked up (cf. SymbolicExpression::getDeletions()).
+        triton::usize deletions;
+
       public:
         ReferenceNode(triton::usize value);
         ReferenceNode(const ReferenceNode& copy);
@@ -681,6 +867,42 @@ namespace triton {
         virtual triton::uint512 hash(triton::uint32 deep);
 
         triton::usize getValue(void);
+
+        /*!
+         * \brief Returns the expression of the reference, nullptr if it does not exist.
+         *
+         * \description
+         * The expression is kept by the node, it is only looked up by id again once an expression has been
+         * deleted, so that dereferencing a reference does not cost a lookup in the table of expressions.
+         */
+        triton::engines::symbolic::SymbolicExpression* getSymbolicExpression(void);
+
+        //! Returns the AST of the expression of the reference. Throws an exception if the expression does not exist.
+        AbstractNode* getAst(void);
+    };
+
+
+    //! `(select <array> <index>)` node
+    class SelectNode : public AbstractNode {
+      public:
+        SelectNode(AbstractNode* array, AbstractNode* index);
+        SelectNode(const SelectNode& copy);
+        virtual ~SelectNode();
+        virtual void init(void);
+        virtual void accept(AstVisitor& v);
+        virtual triton::uint512 hash(triton::uint32 deep);
+    };
+
+
+    //! `(store <array> <index> <value>)` node
+    class StoreNode : public AbstractNode {
+      public:
+        StoreNode(AbstractNode* array, AbstractNode* index, AbstractNode* value);
+        StoreNode(const StoreNode& copy);
+        virtual ~StoreNode();
+        virtual void init(void);
+        virtual void accept(AstVisitor& v);
+        virtual triton::uint512 hash(triton::uint32 deep);
     };
 
 
@@ -697,7 +919,11 @@ namespace triton {
         virtual void accept(AstVisitor& v);
         virtual triton::uint512 hash(triton::uint32 deep);
 
+        //! Returns the name of the symbolic variable.
         std::string getValue(void);
+
+        //! Returns the id of the symbolic variable.
+        triton::usize getVariableId(void) const;
     };
 
 
@@ -713,10 +939,23 @@ namespace triton {
     };
 
 
+    //! `(vadd lane <expr1> <expr2>)` node, the lane-wise addition of two vectors of lanes of `lane` bits
+    class VaddNode : public AbstractNode {
+      public:
+        VaddNode(triton::uint32 lane, AbstractNode* expr1, AbstractNode* expr2);
+        VaddNode(const VaddNode& copy);
+        virtual ~VaddNode();
+        virtual void init(void);
+        virtual void accept(AstVisitor& v);
+        virtual triton::uint512 hash(triton::uint32 deep);
+    };
+
+
     //! Variable node
     class VariableNode : public AbstractNode {
       protected:
-        std::string value;
+        //! The id of the symbolic variable. The name is built from it.
+        triton::usize id;
 
       public:
         VariableNode(triton::engines::symbolic::SymbolicVariable& symVar);
@@ -726,7 +965,23 @@ namespace triton {
         virtual void accept(AstVisitor& v);
         virtual triton::uint512 hash(triton::uint32 deep);
 
+        //! Returns the name of the symbolic variable.
         std::string getValue(void);
+
+        //! Returns the id of the symbolic variable.
+        triton::usize getVariableId(void) const;
+    };
+
+
+    //! `(veq lane <expr1> <expr2>)` node, the lane-wise comparison of two vectors. Equal lanes are all ones, the others zeros.
+    class VeqNode : public AbstractNode {
+      public:
+        VeqNode(triton::uint32 lane, AbstractNode* expr1, AbstractNode* expr2);
+        VeqNode(const VeqNode& copy);
+        virtual ~VeqNode();
+        virtual void init(void);
+        virtual void accept(AstVisitor& v);
+        virtual triton::uint512 hash(triton::uint32 deep);
     };
 
 
@@ -750,6 +1005,9 @@ namespace triton {
     bool operator==(AbstractNode& node1, AbstractNode& node2);
 
 
+    //! AST C++ API - array node builder
+    AbstractNode* array(triton::uint32 indexSize, std::string name);
+
     //! AST C++ API - bv node builder
     AbstractNode* bv(triton::uint512 value, triton::uint32 size);
 
@@ -903,21 +1161,36 @@ namespace triton {
     //! AST C++ API - assert node builder
     AbstractNode* assert_(AbstractNode* expr);
 
+    //! AST C++ API - select node builder
+    AbstractNode* select(AbstractNode* array, AbstractNode* index);
+
+    //! AST C++ API - store node builder
+    AbstractNode* store(AbstractNode* array, AbstractNode* index, AbstractNode* value);
+
     //! AST C++ API - string node builder
     AbstractNode* string(std::string value);
 
     //! AST C++ API - sx node builder
     AbstractNode* sx(triton::uint32 sizeExt, AbstractNode* expr);
 
+    //! AST C++ API - vadd node builder
+    AbstractNode* vadd(triton::uint32 lane, AbstractNode* expr1, AbstractNode* expr2);
+
     //! AST C++ API - variable node builder
     AbstractNode* variable(triton::engines::symbolic::SymbolicVariable& symVar);
 
+    //! AST C++ API - veq node builder
+    AbstractNode* veq(triton::uint32 lane, AbstractNode* expr1, AbstractNode* expr2);
+
     //! AST C++ API - zx node builder
     AbstractNode* zx(triton::uint32 sizeExt, AbstractNode* expr);
 
     //! AST C++ API - Duplicates the AST
     AbstractNode* newInstance(AbstractNode* node);
 
+    //! AST C++ API - Duplicates a node (not its children) and gives it other children. The new node has no parent.
+    AbstractNode* newInstance(AbstractNode* node, const std::vector<AbstractNode*>& childs);
+
     //! Custom pow function for hash routine.
     triton::uint512 pow(triton::uint512 hash, triton::uint32 n);
 
@@ -927,6 +1200,12 @@ namespace triton {
     //! Custom modular sign extend for bitwise operation.
     triton::sint512 modularSignExtend(AbstractNode* node);
 
+    //! Returns the array (ARRAY_NODE or STORE_NODE) of a node, references followed. Returns nullptr if the node is not an array.
+    AbstractNode* getArray(AbstractNode* node);
+
+    //! Returns the size of the indexes of an array. The node must be an array, see getArray().
+    triton::uint32 getArrayIndexSize(AbstractNode* array);
+
   /*! @} End of ast namespace */
   };
 /*! @} End of triton namespace */
@@ -8,7 +8,8 @@
 #ifndef TRITON_ASTDICTIONARIES_H
 #define TRITON_ASTDICTIONARIES_H
 
-#include <set>
+#include <map>
+#include <string>
 #include <vector>
 
 #include "ast.hpp"
@@ -38,162 +39,38 @@ namespace triton {
         //! Defines if this instance is used as a backup.
         bool backupFlag;
 
-      protected:
-        //! Total of allocated nodes.
-        triton::usize allocatedNodes;
-
-        //! Total of allocated dictionaries.
-        std::set<triton::ast::AbstractNode*> allocatedDictionaries;
-
-        //! Assert Dictionary
-        std::map<std::vector<triton::ast::AbstractNode*>, triton::ast::AbstractNode*> assertDictionary;
-
-        //! Bvadd Dictionary
-        std::map<std::vector<triton::ast::AbstractNode*>, triton::ast::AbstractNode*> bvaddDictionary;
-
-        //! Bvand Dictionary
-        std::map<std::vector<triton::ast::AbstractNode*>, triton::ast::AbstractNode*> bvandDictionary;
-
-        //! Bvashr Dictionary
-        std::map<std::vector<triton::ast::AbstractNode*>, triton::ast::AbstractNode*> bvashrDictionary;
-
-        //! Bvdecl Dictionary
-        std::map<std::vector<triton::ast::AbstractNode*>, triton::ast::AbstractNode*> bvdeclDictionary;
-
-        //! Bvlshr Dictionary
-        std::map<std::vector<triton::ast::AbstractNode*>, triton::ast::AbstractNode*> bvlshrDictionary;
-
-        //! Bvmul Dictionary
-        std::map<std::vector<triton::ast::AbstractNode*>, triton::ast::AbstractNode*> bvmulDictionary;
-
-        //! Bvnand Dictionary
-        std::map<std::vector<triton::ast::AbstractNode*>, triton::ast::AbstractNode*> bvnandDictionary;
-
-        //! Bvneg Dictionary
-        std::map<std::vector<triton::ast::AbstractNode*>, triton::ast::AbstractNode*> bvnegDictionary;
-
-        //! Bvnor Dictionary
-        std::map<std::vector<triton::ast::AbstractNode*>, triton::ast::AbstractNode*> bvnorDictionary;
-
-        //! Bvnot Dictionary
-        std::map<std::vector<triton::ast::AbstractNode*>, triton::ast::AbstractNode*> bvnotDictionary;
-
-        //! Bvor Dictionary
-        std::map<std::vector<triton::ast::AbstractNode*>, triton::ast::AbstractNode*> bvorDictionary;
-
-        //! Bvrol Dictionary
-        std::map<std::vector<triton::ast::AbstractNode*>, triton::ast::AbstractNode*> bvrolDictionary;
-
-        //! Bvror Dictionary
-        std::map<std::vector<triton::ast::AbstractNode*>, triton::ast::AbstractNode*> bvrorDictionary;
-
-        //! Bvsdiv Dictionary
-        std::map<std::vector<triton::ast::AbstractNode*>, triton::ast::AbstractNode*> bvsdivDictionary;
-
-        //! Bvsge Dictionary
-        std::map<std::vector<triton::ast::AbstractNode*>, triton::ast::AbstractNode*> bvsgeDictionary;
-
-        //! Bvsgt Dictionary
-        std::map<std::vector<triton::ast::AbstractNode*>, triton::ast::AbstractNode*> bvsgtDictionary;
-
-        //! Bvshl Dictionary
-        std::map<std::vector<triton::ast::AbstractNode*>, triton::ast::AbstractNode*> bvshlDictionary;
-
-        //! Bvsle Dictionary
-        std::map<std::vector<triton::ast::AbstractNode*>, triton::ast::AbstractNode*> bvsleDictionary;
-
-        //! Bvslt Dictionary
-        std::map<std::vector<triton::ast::AbstractNode*>, triton::ast::AbstractNode*> bvsltDictionary;
-
-        //! Bvsmod Dictionary
-        std::map<std::vector<triton::ast::AbstractNode*>, triton::ast::AbstractNode*> bvsmodDictionary;
-
-        //! Bvsrem Dictionary
-        std::map<std::vector<triton::ast::AbstractNode*>, triton::ast::AbstractNode*> bvsremDictionary;
+        //! Initial number of slots of the table. Must be a power of two.
+        static const triton::usize initialCapacity = 1024;
 
-        //! Bvsub Dictionary
-        std::map<std::vector<triton::ast::AbstractNode*>, triton::ast::AbstractNode*> bvsubDictionary;
+        //! Computes the structural hash of a node (kind, size, childs and literal payload).
+        static triton::uint64 computeStructuralHash(triton::ast::AbstractNode* node);
 
-        //! Bvudiv Dictionary
-        std::map<std::vector<triton::ast::AbstractNode*>, triton::ast::AbstractNode*> bvudivDictionary;
+        //! Returns true if both nodes are structurally equal.
+        static bool isStructurallyEqual(triton::ast::AbstractNode* node1, triton::ast::AbstractNode* node2);
 
-        //! Bvuge Dictionary
-        std::map<std::vector<triton::ast::AbstractNode*>, triton::ast::AbstractNode*> bvugeDictionary;
+        //! Doubles the capacity of the table.
+        void growTable(void);
 
-        //! Bvugt Dictionary
-        std::map<std::vector<triton::ast::AbstractNode*>, triton::ast::AbstractNode*> bvugtDictionary;
-
-        //! Bvule Dictionary
-        std::map<std::vector<triton::ast::AbstractNode*>, triton::ast::AbstractNode*> bvuleDictionary;
-
-        //! Bvult Dictionary
-        std::map<std::vector<triton::ast::AbstractNode*>, triton::ast::AbstractNode*> bvultDictionary;
-
-        //! Bvurem Dictionary
-        std::map<std::vector<triton::ast::AbstractNode*>, triton::ast::AbstractNode*> bvuremDictionary;
-
-        //! Bvxnor Dictionary
-        std::map<std::vector<triton::ast::AbstractNode*>, triton::ast::AbstractNode*> bvxnorDictionary;
-
-        //! Bvxor Dictionary
-        std::map<std::vector<triton::ast::AbstractNode*>, triton::ast::AbstractNode*> bvxorDictionary;
-
-        //! Bv Dictionary
-        std::map<std::vector<triton::ast::AbstractNode*>, triton::ast::AbstractNode*> bvDictionary;
-
-        //! Compound Dictionary
-        std::map<std::vector<triton::ast::AbstractNode*>, triton::ast::AbstractNode*> compoundDictionary;
-
-        //! Concat Dictionary
-        std::map<std::vector<triton::ast::AbstractNode*>, triton::ast::AbstractNode*> concatDictionary;
-
-        //! Decimal Dictionary
-        std::map<triton::uint512, triton::ast::AbstractNode*> decimalDictionary;
-
-        //! Declare Dictionary
-        std::map<std::vector<triton::ast::AbstractNode*>, triton::ast::AbstractNode*> declareFunctionDictionary;
-
-        //! Distinct Dictionary
-        std::map<std::vector<triton::ast::AbstractNode*>, triton::ast::AbstractNode*> distinctDictionary;
-
-        //! Equal Dictionary
-        std::map<std::vector<triton::ast::AbstractNode*>, triton::ast::AbstractNode*> equalDictionary;
-
-        //! Extract Dictionary
-        std::map<std::vector<triton::ast::AbstractNode*>, triton::ast::AbstractNode*> extractDictionary;
-
-        //! Ite Dictionary
-        std::map<std::vector<triton::ast::AbstractNode*>, triton::ast::AbstractNode*> iteDictionary;
-
-        //! Land Dictionary
-        std::map<std::vector<triton::ast::AbstractNode*>, triton::ast::AbstractNode*> landDictionary;
-
-        //! Let Dictionary
-        std::map<std::vector<triton::ast::AbstractNode*>, triton::ast::AbstractNode*> letDictionary;
-
-        //! Lnot Dictionary
-        std::map<std::vector<triton::ast::AbstractNode*>, triton::ast::AbstractNode*> lnotDictionary;
-
-        //! Lor Dictionary
-        std::map<std::vector<triton::ast::AbstractNode*>, triton::ast::AbstractNode*> lorDictionary;
-
-        //! Reference Dictionary
-        std::map<triton::usize, triton::ast::AbstractNode*> referenceDictionary;
-
-        //! String Dictionary
-        std::map<std::string, triton::ast::AbstractNode*> stringDictionary;
+      protected:
+        //! Total of allocated nodes.
+        triton::usize allocatedNodes;
 
-        //! Sx Dictionary
-        std::map<std::vector<triton::ast::AbstractNode*>, triton::ast::AbstractNode*> sxDictionary;
+        //! Number of nodes found into the dictionaries.
+        triton::usize hits;
 
-        //! Variable Dictionary
-        std::map<std::string, triton::ast::AbstractNode*> variableDictionary;
+        /*! \brief The open-addressing table of unique nodes.
+         *
+         * \description
+         * Slots are indexed by the structural hash of nodes, collisions are solved with a linear probing.
+         * An empty slot is a nullptr.
+         */
+        std::vector<triton::ast::AbstractNode*> table;
 
-        //! Zx Dictionary
-        std::map<std::vector<triton::ast::AbstractNode*>, triton::ast::AbstractNode*> zxDictionary;
+        //! Number of nodes recorded into the table.
+        triton::usize tableSize;
 
-        //! Dictionaries
-        std::map<triton::uint32, void*> dictionaries;
+        //! Number of nodes recorded per kind.
+        std::vector<triton::usize> kindSize;
 
     public:
         //! Constructor.
@@ -211,14 +88,20 @@ namespace triton {
         //! Copies an AstDictionaries.
         void copy(const AstDictionaries& other);
 
-        //! Links all sub dictionaries to the root one.
-        void linkDictionaries(void);
+        //! Forgets every node recorded into the dictionaries without deleting them.
+        void clearAstDictionaries(void);
 
         //! Browses into dictionaries.
         triton::ast::AbstractNode* browseAstDictionaries(triton::ast::AbstractNode* node);
 
         //! Returns stats about dictionaries.
         std::map<std::string, triton::usize> getAstDictionariesStats(void) const;
+
+        //! Returns the estimated number of bytes used by the dictionaries. The nodes are not counted.
+        triton::usize getAstDictionariesMemoryUsage(void) const;
+
+        //! Names counters indexed by kind of node, as getAstDictionariesStats() does.
+        static std::map<std::string, triton::usize> getStatsByKind(const std::vector<triton::usize>& counters);
     };
 
   /*! @} End of ast namespace */
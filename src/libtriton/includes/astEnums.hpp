@@ -78,7 +78,12 @@ namespace triton {
       STRING_NODE = 227,              /*!< String node */
       SX_NODE = 229,                  /*!< ((_ sign_extend x) y) */
       VARIABLE_NODE = 233,            /*!< Variable node */
-      ZX_NODE = 239                   /*!< ((_ zero_extend x) y) */
+      ZX_NODE = 239,                  /*!< ((_ zero_extend x) y) */
+      ARRAY_NODE = 241,               /*!< Array node, (Array (_ BitVec x) (_ BitVec 8)) */
+      SELECT_NODE = 251,              /*!< (select x y) */
+      STORE_NODE = 257,               /*!< (store x y z) */
+      VADD_NODE = 263,                /*!< (vadd lane x y) */
+      VEQ_NODE = 269                  /*!< (veq lane x y) */
     };
 
   /*! @} End of ast namespace */
@@ -0,0 +1,156 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#ifndef TRITON_ASTEVALUATOR_H
+#define TRITON_ASTEVALUATOR_H
+
+#include <map>
+#include <utility>
+#include <vector>
+
+#include "ast.hpp"
+#include "astEnums.hpp"
+#include "symbolicVariable.hpp"
+#include "tritonTypes.hpp"
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The AST namespace
+  namespace ast {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup ast
+   *  @{
+   */
+
+    //! \class AstEvaluator
+    /*! \brief Evaluates an AST under assignments of its symbolic variables.
+     *
+     * \description
+     * The AST is compiled once into an array of instructions in post-order. Every node gets a register,
+     * nodes without symbolic variable are folded into constant registers and every other node becomes an
+     * instruction which computes its register from the registers of its children, with the semantics of
+     * the init() of the node. An evaluation is then a single pass over the array which does not touch the
+     * AST. If every node fits in 64 bits, registers are native words. Let bindings are not supported.
+     *
+     * Many assignments are evaluated by batches of `batchSize`: every register has one lane per assignment
+     * and every instruction is applied to all the lanes before the next one, so its dispatch is paid once
+     * per batch and its work is a loop of native operations the compiler may vectorize.
+     */
+    class AstEvaluator {
+      private:
+        //! An instruction of the program.
+        struct Instruction {
+          //! The kind of the compiled node.
+          enum kind_e kind;
+
+          //! The register written by the instruction.
+          triton::uint32 output;
+
+          //! The index of the first operand in `operands`.
+          triton::uint32 first;
+
+          //! The number of operands.
+          triton::uint32 count;
+
+          //! The constant operand of the node (the low bit of an extraction, the rotation of a rotate).
+          triton::uint32 immediate;
+        };
+
+        //! The program, in post-order.
+        std::vector<Instruction> program;
+
+        //! Operand registers of the instructions.
+        std::vector<triton::uint32> operands;
+
+        //! Size in bits of every register.
+        std::vector<triton::uint32> sizes;
+
+        //! Registers used if a node does not fit in 64 bits.
+        std::vector<triton::uint512> registers;
+
+        //! Registers used if every node fits in 64 bits.
+        std::vector<triton::uint64> registers64;
+
+        //! True if a node does not fit in 64 bits.
+        bool wide;
+
+        //! Registers of the batches, `batchSize` lanes per register. Allocated by the first batch.
+        std::vector<triton::uint64> lanes64;
+
+        //! The symbolic variables of the AST.
+        std::vector<triton::engines::symbolic::SymbolicVariable*> variables;
+
+        //! Registers of variable nodes and the index of their variable in `variables`.
+        std::vector<std::pair<triton::uint32, triton::usize>> inputs;
+
+        //! Registers of the roots.
+        std::vector<triton::uint32> roots;
+
+        //! Compiles the ASTs.
+        void compile(const std::vector<triton::ast::AbstractNode*>& asts);
+
+        //! Runs the program on the first `lanes` lanes of registers of type T. The lane i of the register r is regs[r * stride + i].
+        template <typename T> void run(T* regs, triton::usize stride, triton::usize lanes) const;
+
+      public:
+        //! The number of assignments evaluated by a pass over the program.
+        static const triton::usize batchSize = 64;
+
+        //! Constructor. Compiles an AST.
+        AstEvaluator(triton::ast::AbstractNode* root);
+
+        //! Constructor. Compiles several ASTs sharing their nodes, see getValue().
+        AstEvaluator(const std::vector<triton::ast::AbstractNode*>& asts);
+
+        //! Returns the symbolic variables of the ASTs, in the order of the values given to execute().
+        const std::vector<triton::engines::symbolic::SymbolicVariable*>& getVariables(void) const;
+
+        //! Returns the number of instructions of the program.
+        triton::usize getNumberOfInstructions(void) const;
+
+        //! Evaluates the ASTs. There is one value per symbolic variable, in the order of getVariables().
+        void execute(const std::vector<triton::uint512>& values);
+
+        /*!
+         * \brief Evaluates a root under `count` assignments with native words.
+         *
+         * \description
+         * `values` holds `count` rows of one value per symbolic variable, in the order of getVariables(), and
+         * `results` receives the value of the root for every row. Raises an exception if isWide().
+         */
+        void execute(const triton::uint64* values, triton::usize count, triton::uint64* results, triton::usize root=0);
+
+        //! Returns the indexes of the rows of `values` (see execute()) under which a root is not zero. Raises an exception if isWide().
+        std::vector<triton::usize> filter(const triton::uint64* values, triton::usize count, triton::usize root=0);
+
+        //! Returns true if a node does not fit in 64 bits. Such ASTs are not evaluated by batches.
+        bool isWide(void) const;
+
+        //! Returns the value of a root after the last execute().
+        triton::uint512 getValue(triton::usize root=0) const;
+
+        //! Evaluates the first AST. There is one value per symbolic variable, in the order of getVariables().
+        triton::uint512 evaluate(const std::vector<triton::uint512>& values);
+
+        //! Evaluates the first AST with the values of `assignment` (symbolic variable id -> value). Other variables keep their concrete value.
+        triton::uint512 evaluate(const std::map<triton::usize, triton::uint512>& assignment);
+    };
+
+  /*! @} End of ast namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_ASTEVALUATOR_H */
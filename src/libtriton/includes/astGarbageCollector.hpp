@@ -8,11 +8,16 @@
 #ifndef TRITON_ASTGARBAGECOLLECTOR_H
 #define TRITON_ASTGARBAGECOLLECTOR_H
 
+#include <memory>
 #include <set>
 #include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
 #include "ast.hpp"
 #include "astDictionaries.hpp"
+#include "astNodeAllocator.hpp"
 #include "modes.hpp"
 #include "tritonTypes.hpp"
 
@@ -33,6 +38,27 @@ namespace triton {
    *  @{
    */
 
+    /*! \brief A frozen generation of AST nodes.
+     *
+     * \description
+     * The nodes allocated between two freezes, shared read-only by the snapshots and the states restored from them.
+     * A generation holds its parent, so a snapshot keeps every node frozen before it alive.
+     */
+    struct AstGeneration {
+      //! The nodes frozen by this generation.
+      std::vector<triton::ast::AbstractNode*> nodes;
+
+      //! The previous generation, nullptr if this one is the first.
+      std::shared_ptr<AstGeneration> parent;
+
+      //! The number of nodes of this generation and of its parents.
+      triton::usize size;
+
+      //! The epoch of the garbage collector when the generation has been frozen.
+      triton::usize epoch;
+    };
+
+
     //! \class AstGarbageCollector
     /*! \brief The AST garbage collector class */
     class AstGarbageCollector : public triton::ast::AstDictionaries {
@@ -43,12 +69,51 @@ namespace triton {
         //! Defines if this instance is used as a backup.
         bool backupFlag;
 
+        //! The allocator of nodes built by this instance. It is never copied, backups share the nodes of their owner.
+        triton::ast::AstNodeAllocator allocator;
+
+        //! The number of values shared per size by getConstantNode().
+        static const triton::uint32 constantValues = 64;
+
+        //! The number of sizes shared by getConstantNode(): 1, 8, 16, ..., 512 bits.
+        static const triton::uint32 constantSizes = 8;
+
+        //! The immortal constant nodes by size and value, nullptr until built. They are owned by this instance and never copied.
+        triton::ast::AbstractNode* constantNodes[constantSizes][constantValues];
+
+        //! Frees the immortal constant nodes.
+        void freeConstantNodes(void);
+
+        //! The last frozen generation, nullptr if no node has been frozen.
+        std::shared_ptr<AstGeneration> generation;
+
+        //! Incremented by freeAllAstNodes(), the nodes of the generations of a previous epoch have been freed with the slabs.
+        triton::usize epoch;
+
+        //! Removes a reference node which is freed from the parents of the AST it points to, so that the AST does not init it anymore.
+        void unlinkReference(triton::ast::AbstractNode* node) const;
+
       protected:
         //! This container contains all allocated nodes.
         std::set<triton::ast::AbstractNode*> allocatedNodes;
 
-        //! This map maintains a link between symbolic variables and their nodes.
-        std::map<std::string, triton::ast::AbstractNode*> variableNodes;
+        //! This map maintains a link between symbolic variable ids and their nodes.
+        std::unordered_map<triton::usize, triton::ast::AbstractNode*> variableNodes;
+
+        //! Defines if recorded nodes are journaled.
+        bool journalFlag;
+
+        //! Nodes recorded since the journal has been started.
+        std::vector<triton::ast::AbstractNode*> journalNodes;
+
+        //! Previous variable nodes overwritten since the journal has been started (nullptr if there was none).
+        std::vector<std::pair<triton::usize, triton::ast::AbstractNode*>> journalVariableNodes;
+
+        //! Defines if recorded nodes are kept in the nursery.
+        bool nurseryFlag;
+
+        //! Nodes recorded since the nursery has been started, in their creation order.
+        std::vector<triton::ast::AbstractNode*> nurseryNodes;
 
       public:
         //! Constructor.
@@ -66,12 +131,15 @@ namespace triton {
         //! Copies an AstGarbageCollectors..
         void copy(const AstGarbageCollector& other);
 
-        //! Go through every allocated nodes and free them.
+        //! Frees every allocated node, the copies on the global heap one by one and the others at once by releasing the allocator slabs.
         void freeAllAstNodes(void);
 
         //! Frees a set of nodes and removes them from the global container.
         void freeAstNodes(std::set<triton::ast::AbstractNode*>& nodes);
 
+        //! Drops a reference to a node and frees it, and then its childs, as soon as they have no holder anymore.
+        void releaseAstNode(triton::ast::AbstractNode* node);
+
         //! Extracts all unique nodes from a partial AST into the uniqueNodes set.
         void extractUniqueAstNodes(std::set<triton::ast::AbstractNode*>& uniqueNodes, triton::ast::AbstractNode* root) const;
 
@@ -79,22 +147,102 @@ namespace triton {
         triton::ast::AbstractNode* recordAstNode(triton::ast::AbstractNode* node);
 
         //! Records a variable AST node.
-        void recordVariableAstNode(const std::string& name, triton::ast::AbstractNode* node);
-
-        //! Returns all allocated nodes.
+        void recordVariableAstNode(triton::usize symVarId, triton::ast::AbstractNode* node);
+
+        //! Returns the allocator used to build nodes.
+        triton::ast::AstNodeAllocator* getAstNodeAllocator(void);
+
+        /*!
+         * \brief Returns the shared immortal node of a constant, or nullptr if the constant is not shared.
+         *
+         * \description
+         * The constants lesser than 64 (0 and 1 for a single bit) of 1, 8, 16, 32, 64, 128, 256 and 512 bits are
+         * built once on the heap and shared by every tree. They are neither recorded nor journaled, nor in the
+         * dictionaries, and the garbage collector never frees them, so building them costs neither allocation nor
+         * hashing. They keep no parent and cannot be modified.
+         */
+        triton::ast::AbstractNode* getConstantNode(const triton::uint512& value, triton::uint32 size);
+
+        /*!
+         * \brief Returns the estimated number of bytes used by the nodes and their containers.
+         *
+         * \description
+         * Nodes of the allocator are counted by slab, nodes on the global heap by their base size. The buffers
+         * owned by nodes (childs, parents) and the dictionaries are not counted.
+         */
+        triton::usize getMemoryUsage(void) const;
+
+        //! Returns all allocated nodes, but the frozen ones.
         const std::set<triton::ast::AbstractNode*>& getAllocatedAstNodes(void) const;
 
         //! Returns all variable nodes recorded.
-        const std::map<std::string, triton::ast::AbstractNode*>& getAstVariableNodes(void) const;
+        const std::unordered_map<triton::usize, triton::ast::AbstractNode*>& getAstVariableNodes(void) const;
 
         //! Returns the node of a recorded variable.
-        triton::ast::AbstractNode* getAstVariableNode(const std::string& name) const;
+        triton::ast::AbstractNode* getAstVariableNode(triton::usize symVarId) const;
 
-        //! Sets all allocated nodes.
+        //! Sets all allocated nodes, but the frozen ones.
         void setAllocatedAstNodes(const std::set<triton::ast::AbstractNode*>& nodes);
 
+        /*!
+         * \brief Freezes every allocated node into a new generation and returns it.
+         *
+         * \description
+         * Instead of copying the allocated nodes, a snapshot freezes them: they move into a generation shared
+         * read-only by the snapshot and the current state, and the allocated nodes start empty again. The garbage
+         * collector never frees a frozen node, so every state keeps its own nodes only, and the memory of a
+         * snapshot is proportional to the nodes allocated since the previous one. Returns the current generation
+         * if no node has been allocated since.
+         */
+        std::shared_ptr<AstGeneration> freezeAstNodes(void);
+
+        //! Returns the last frozen generation, nullptr if there is none.
+        const std::shared_ptr<AstGeneration>& getAstGeneration(void) const;
+
+        //! Returns the number of frozen nodes of the current state.
+        triton::usize getNumberOfFrozenAstNodes(void) const;
+
+        /*!
+         * \brief Restores a generation returned by freezeAstNodes().
+         *
+         * \description
+         * The allocated nodes, which have been built since the last freeze, are freed. So are the nodes of the
+         * generations which are not held anymore (by a snapshot or by a generation held).
+         */
+        void setAstGeneration(const std::shared_ptr<AstGeneration>& generation);
+
+        //! Drops a generation and frees the nodes of the generations which are not held anymore.
+        void releaseAstGeneration(std::shared_ptr<AstGeneration>& generation);
+
         //! Sets all variable nodes recorded.
-        void setAstVariableNodes(const std::map<std::string, triton::ast::AbstractNode*>& nodes);
+        void setAstVariableNodes(const std::unordered_map<triton::usize, triton::ast::AbstractNode*>& nodes);
+
+        //! Starts journaling every recorded node.
+        void startJournal(void);
+
+        //! Frees every node recorded since the journal has been started and stops journaling.
+        void rollbackJournal(void);
+
+        /*!
+         * \brief Starts keeping every recorded node in the nursery.
+         *
+         * \description
+         * The nursery holds the nodes built while an instruction is processed. Most of them are temporaries
+         * (e.g. operands which have been folded or rewritten) that nothing holds, collectNursery() frees them
+         * at the end of the instruction instead of leaving them until freeAllAstNodes().
+         */
+        void startNursery(void);
+
+        /*!
+         * \brief Frees the nodes of the nursery which have no holder, stops the nursery and returns the number of freed nodes.
+         *
+         * \description
+         * A node survives if it is referenced (by a parent, a symbolic expression, a path constraint...) or
+         * reachable from `survivors`, the roots only held by raw pointers (e.g. the ASTs of the instruction
+         * operands). The nursery is swept in the reverse creation order, so that a freed parent drops its
+         * references before its childs are visited. Nodes older than the nursery are never freed.
+         */
+        triton::usize collectNursery(const std::vector<triton::ast::AbstractNode*>& survivors);
     };
 
   /*! @} End of ast namespace */
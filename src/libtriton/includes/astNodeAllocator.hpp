@@ -0,0 +1,149 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#ifndef TRITON_ASTNODEALLOCATOR_H
+#define TRITON_ASTNODEALLOCATOR_H
+
+#include <cstddef>
+#include <vector>
+
+#include "tritonTypes.hpp"
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The AST namespace
+  namespace ast {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup ast
+   *  @{
+   */
+
+    class AbstractNode;
+
+    //! \class AstNodeAllocator
+    /*! \brief The AST node allocator class.
+     *
+     * Nodes are carved out of large slabs, one pool per size class (so one pool per node kind in practice).
+     * Every slot starts with a small header which records its owner, so a node can always be released with
+     * a plain `delete` whatever the allocator it comes from. Nodes which are too large for the pools, or which
+     * are allocated without allocator, fall back to the global heap.
+     */
+    class AstNodeAllocator {
+      private:
+        //! The header stored in front of every allocated node.
+        struct SlotHeader {
+          //! The owner of the slot. nullptr if the slot comes from the global heap.
+          AstNodeAllocator* owner;
+
+          //! The size class of the slot.
+          triton::uint32 sizeClass;
+
+          //! True if the slot contains a live node.
+          bool used;
+        };
+
+        //! A pool of slots of the same size class.
+        struct Pool {
+          //! Slabs of the pool.
+          std::vector<triton::uint8*> slabs;
+
+          //! Head of the intrusive free list.
+          SlotHeader* freeList;
+
+          //! Size of a slot (header included).
+          triton::usize slotSize;
+        };
+
+        //! Granularity of size classes.
+        static const triton::usize granularity = 16;
+
+        //! Number of size classes. Bigger nodes are allocated on the global heap.
+        static const triton::usize maxSizeClasses = 64;
+
+        //! Number of slots per slab.
+        static const triton::usize slotsPerSlab = 256;
+
+        //! Pools indexed by size class.
+        std::vector<Pool> pools;
+
+        //! Number of live nodes inside the pools.
+        triton::usize liveNodes;
+
+        //! Highest number of live nodes inside the pools.
+        triton::usize peakNodes;
+
+        //! Number of nodes allocated inside the pools since the allocator has been created.
+        triton::usize allocations;
+
+        //! Allocates a new slab for a pool.
+        bool growPool(Pool& pool);
+
+        //! Returns a slot to its pool.
+        void release(SlotHeader* header);
+
+      public:
+        //! Constructor.
+        AstNodeAllocator();
+
+        //! Destructor. Destroys all live nodes and releases slabs.
+        ~AstNodeAllocator();
+
+        //! Allocates memory for a node. Returns nullptr if there is not enough memory.
+        void* allocate(std::size_t size);
+
+        //! Grows the pool of the nodes of `size` bytes until it holds at least `count` free slots, so that they are carved out of the same slabs.
+        void reserve(std::size_t size, triton::usize count);
+
+        //! Allocates memory for a node on the global heap. Returns nullptr if there is not enough memory.
+        static void* allocateOnHeap(std::size_t size);
+
+        //! Releases the memory of a node whatever its owner.
+        static void deallocate(void* ptr);
+
+        //! Returns true if the memory of a node comes from the global heap rather than from an allocator.
+        static bool isOnHeap(const void* ptr);
+
+        //! Destroys all live nodes and releases every slab at once.
+        void releaseAll(void);
+
+        //! Returns the number of live nodes.
+        triton::usize getLiveNodes(void) const;
+
+        //! Returns the number of bytes reserved by slabs.
+        triton::usize getReservedBytes(void) const;
+
+        //! Returns the highest number of live nodes since the allocator has been created.
+        triton::usize getPeakNodes(void) const;
+
+        //! Returns the number of nodes allocated inside the pools since the allocator has been created.
+        triton::usize getAllocations(void) const;
+
+        //! Returns the number of live nodes inside the pools, indexed by kind of node. Walks every slot, so it is not meant for hot paths.
+        std::vector<triton::usize> getLiveNodesPerKind(void) const;
+
+      private:
+        //! Disallows copies. Slabs belong to one allocator only.
+        AstNodeAllocator(const AstNodeAllocator& other);
+
+        //! Disallows copies. Slabs belong to one allocator only.
+        void operator=(const AstNodeAllocator& other);
+    };
+
+  /*! @} End of ast namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_ASTNODEALLOCATOR_H */
@@ -0,0 +1,102 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#ifndef TRITON_ASTPATTERN_H
+#define TRITON_ASTPATTERN_H
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include "ast.hpp"
+#include "tritonTypes.hpp"
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The AST namespace
+  namespace ast {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup ast
+   *  @{
+   */
+
+    /*! \class AstPattern
+     *  \brief A pattern of AST nodes, parsed once and matched natively.
+     *
+     * \description
+     * A pattern is written with the names of the AST builders, e.g. `bvxor(x, x)` or `bvadd(x, bv(0, _))`:
+     * - `name(p1, p2, ...)` matches a node of this kind whose children match `p1`, `p2`, ... in order.
+     * - An identifier (`x`, `y`, ...) matches any node and binds it. All the occurrences of an identifier must match equal nodes (same hash).
+     * - `_` matches any node without binding it.
+     * - An integer (`12`, `0xff`) matches a decimal node or a bitvector node of this value.
+     *
+     * A reference node is followed to the AST of its symbolic expression when the pattern expects another kind of node.
+     * Raises a triton::exceptions::AstPattern if the pattern is invalid.
+     */
+    class AstPattern {
+      private:
+        //! An element of the pattern.
+        struct Element {
+          //! The kind of node matched as triton::ast::kind_e, UNDEFINED_NODE for an identifier, a wildcard or an integer.
+          triton::uint32 kind;
+
+          //! The name of an identifier, empty for a wildcard.
+          std::string name;
+
+          //! True if the element is an integer.
+          bool isInteger;
+
+          //! The value of an integer.
+          triton::uint512 value;
+
+          //! The patterns of the children.
+          std::vector<Element> childs;
+        };
+
+        //! The pattern as written.
+        std::string pattern;
+
+        //! The root of the parsed pattern.
+        Element root;
+
+        //! Skips the spaces from `pos`.
+        void skipSpaces(triton::usize& pos) const;
+
+        //! Parses an element from `pos`.
+        Element parseElement(triton::usize& pos) const;
+
+        //! Matches an element against a node and records the identifiers bound.
+        bool matchElement(const Element& element, AbstractNode* node, std::map<std::string, AbstractNode*>& bindings) const;
+
+      public:
+        //! Constructor. Parses the pattern.
+        AstPattern(const std::string& pattern);
+
+        //! Returns the pattern as written.
+        const std::string& getPattern(void) const;
+
+        //! Returns true if the node matches the pattern. `bindings` receives the nodes bound to the identifiers.
+        bool match(AbstractNode* node, std::map<std::string, AbstractNode*>& bindings) const;
+
+        //! Appends the unique nodes of an AST which match the pattern to `output`, children before parents. \sa triton::ast::nodesExtraction()
+        void search(std::vector<AbstractNode*>& output, AbstractNode* root, bool unroll=false) const;
+    };
+
+  /*! @} End of ast namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_ASTPATTERN_H */
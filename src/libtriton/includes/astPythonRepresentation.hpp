@@ -49,6 +49,9 @@ namespace triton {
           //! Displays the node according to the representation mode.
           std::ostream& print(std::ostream& stream, triton::ast::AbstractNode* node);
 
+          //! Displays the node according to the representation mode.
+          std::ostream& print(std::ostream& stream, triton::ast::ArrayNode* node);
+
           //! Displays the node according to the representation mode.
           std::ostream& print(std::ostream& stream, triton::ast::AssertNode* node);
 
@@ -184,15 +187,27 @@ namespace triton {
           //! Displays the node according to the representation mode.
           std::ostream& print(std::ostream& stream, triton::ast::ReferenceNode* node);
 
+          //! Displays the node according to the representation mode.
+          std::ostream& print(std::ostream& stream, triton::ast::SelectNode* node);
+
+          //! Displays the node according to the representation mode.
+          std::ostream& print(std::ostream& stream, triton::ast::StoreNode* node);
+
           //! Displays the node according to the representation mode.
           std::ostream& print(std::ostream& stream, triton::ast::StringNode* node);
 
           //! Displays the node according to the representation mode.
           std::ostream& print(std::ostream& stream, triton::ast::SxNode* node);
 
+          //! Displays the node according to the representation mode.
+          std::ostream& print(std::ostream& stream, triton::ast::VaddNode* node);
+
           //! Displays the node according to the representation mode.
           std::ostream& print(std::ostream& stream, triton::ast::VariableNode* node);
 
+          //! Displays the node according to the representation mode.
+          std::ostream& print(std::ostream& stream, triton::ast::VeqNode* node);
+
           //! Displays the node according to the representation mode.
           std::ostream& print(std::ostream& stream, triton::ast::ZxNode* node);
       };
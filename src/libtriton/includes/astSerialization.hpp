@@ -0,0 +1,203 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#ifndef TRITON_ASTSERIALIZATION_H
+#define TRITON_ASTSERIALIZATION_H
+
+#include <istream>
+#include <map>
+#include <ostream>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include "ast.hpp"
+#include "symbolicVariable.hpp"
+#include "tritonTypes.hpp"
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The AST namespace
+  namespace ast {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup ast
+   *  @{
+   */
+
+    //! The version of the binary serialization format.
+    const triton::uint32 serializationVersion = 2;
+
+    //! Tags of the records of a serialized stream.
+    enum serialization_e {
+      SERIAL_END = 0,               /*!< End of the stream */
+      SERIAL_NODE,                  /*!< A node of the node table */
+      SERIAL_ROOT,                  /*!< The root of a serialized AST */
+      SERIAL_VARIABLE,              /*!< A symbolic variable */
+      SERIAL_EXPRESSION,            /*!< A symbolic expression */
+      SERIAL_REGISTER,              /*!< The symbolic expression assigned to a register */
+      SERIAL_MEMORY,                /*!< The symbolic expression assigned to a memory cell and the offset of the cell in it */
+      SERIAL_PATH_CONSTRAINT        /*!< A path constraint */
+    };
+
+
+    //! \class AstWriter
+    /*! \brief Writes ASTs in the binary serialization format.
+     *
+     * \description
+     * A stream starts with the magic `TRTN` and the version of the format, followed by records. Every record
+     * starts with its tag (see triton::ast::serialization_e) and every integer is an unsigned LEB128 varint.
+     * Nodes are written once, in topological order (children first), into a table shared by all the records
+     * of the stream. A node record holds the kind of the node and its payload for leaves (the value of a
+     * decimal node, the name of a variable node, the id targeted by a reference node, the value of a string
+     * node), or the number of its children followed by the distance (in the table) from the node to each child.
+     * Decimal nodes with the same value and bitvector nodes with the same value and size share an entry.
+     */
+    class AstWriter {
+      private:
+        //! The output stream.
+        std::ostream& stream;
+
+        //! Nodes already walked.
+        std::unordered_set<AbstractNode*> visited;
+
+        //! Entries of the nodes in the table.
+        std::unordered_map<AbstractNode*, triton::usize> entries;
+
+        //! Entries of the decimal nodes by value.
+        std::map<triton::uint512, triton::usize> decimals;
+
+        //! Entries of the bitvector nodes by entries of their value and size.
+        std::map<std::pair<triton::usize, triton::usize>, triton::usize> bitvectors;
+
+        //! The number of entries of the table.
+        triton::usize numberOfEntries;
+
+        //! Writes a node whose children are in the table already and returns its entry.
+        triton::usize writeEntry(AbstractNode* node);
+
+      public:
+        //! Constructor. Writes the header of the stream.
+        AstWriter(std::ostream& stream);
+
+        //! Writes the nodes of an AST which are not in the table yet and returns the entry of the root.
+        triton::usize writeNode(AbstractNode* node);
+
+        //! Writes an AST and a root record pointing to it.
+        void writeRoot(AbstractNode* node);
+
+        //! Writes the tag of a record.
+        void writeTag(serialization_e tag);
+
+        //! Writes an unsigned varint.
+        void writeUnsigned(triton::uint512 value);
+
+        //! Writes a string (its length followed by its bytes).
+        void writeString(const std::string& value);
+
+        //! Writes the end of the stream.
+        void writeEnd(void);
+    };
+
+
+    //! \class AstReader
+    /*! \brief Reads ASTs written by triton::ast::AstWriter.
+     *
+     * \description
+     * Nodes are rebuilt with the node builders. Variable nodes are resolved by name, reference nodes keep
+     * their id, unless they have been mapped to other ones with setVariable() and setReference(). Decimal
+     * nodes only used as immediate operands (e.g. the bounds of an extraction) are never built.
+     */
+    class AstReader {
+      private:
+        //! The input stream.
+        std::istream& stream;
+
+        //! The table of nodes. nullptr for decimal nodes not built yet.
+        std::vector<AbstractNode*> nodes;
+
+        //! The values of the decimal entries of the table.
+        std::map<triton::usize, triton::uint512> values;
+
+        //! The roots read.
+        std::vector<AbstractNode*> roots;
+
+        //! Variables by name in the stream.
+        std::map<std::string, triton::engines::symbolic::SymbolicVariable*> variables;
+
+        //! Symbolic expression ids in the stream -> ids to reference.
+        std::map<triton::usize, triton::usize> references;
+
+        //! Builds a node from the entries of its children.
+        AbstractNode* buildNode(triton::uint32 kind, const std::vector<triton::usize>& childs);
+
+        //! Returns the value of a decimal entry.
+        triton::uint512 getValue(triton::usize entry);
+
+        //! Returns the value of a string entry.
+        std::string getString(triton::usize entry);
+
+      public:
+        //! Constructor. Reads and checks the header of the stream.
+        AstReader(std::istream& stream);
+
+        //! Reads the tag of the next record.
+        serialization_e readTag(void);
+
+        //! Reads a node record (after its tag) and adds the node to the table.
+        void readNode(void);
+
+        //! Reads a root record (after its tag).
+        void readRoot(void);
+
+        //! Reads an entry of the table and returns its node.
+        AbstractNode* readEntry(void);
+
+        //! Reads an unsigned varint.
+        triton::uint512 readUnsigned(void);
+
+        //! Reads an unsigned varint which must fit in 64 bits.
+        triton::uint64 readUnsigned64(void);
+
+        //! Reads a string.
+        std::string readString(void);
+
+        //! Returns the node of an entry of the table.
+        AbstractNode* getNode(triton::usize entry);
+
+        //! Returns the roots read.
+        const std::vector<AbstractNode*>& getRoots(void) const;
+
+        //! Resolves the variable nodes named `name` in the stream to `symVar`.
+        void setVariable(const std::string& name, triton::engines::symbolic::SymbolicVariable* symVar);
+
+        //! Resolves the reference nodes to `oldId` in the stream to `newId`.
+        void setReference(triton::usize oldId, triton::usize newId);
+    };
+
+
+    //! Writes ASTs in the binary serialization format. Nodes shared by the ASTs are written once.
+    void serialize(std::ostream& stream, const std::vector<AbstractNode*>& asts);
+
+    //! Reads ASTs written by triton::ast::serialize().
+    std::vector<AbstractNode*> deserialize(std::istream& stream);
+
+  /*! @} End of ast namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_ASTSERIALIZATION_H */
@@ -0,0 +1,173 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#ifndef TRITON_ASTSMTPARSER_H
+#define TRITON_ASTSMTPARSER_H
+
+#include <istream>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "ast.hpp"
+#include "symbolicVariable.hpp"
+#include "tritonTypes.hpp"
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The AST namespace
+  namespace ast {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup ast
+   *  @{
+   */
+
+    //! \class AstSmtParser
+    /*! \brief Reads SMT-LIB2 scripts (QF_BV and QF_ABV) into Triton ASTs.
+     *
+     * \description
+     * The script is read command by command from a stream and the terms are built with the node builders, so
+     * that they are shared with the ASTs already built when the AST_DICTIONARIES mode is enabled. Terms are
+     * read with an explicit stack, deep terms do not overflow the native one.
+     *
+     * The bitvector constants declared with `declare-fun` or `declare-const` are resolved to the symbolic
+     * variables mapped with setVariable(), then to the symbolic variables of the same name (e.g. `SymVar_0`)
+     * and are otherwise declared as new symbolic variables, commented with their name. Constant arrays are
+     * array nodes, `define-fun` with no argument binds a name to a term and `ref!<id>` is a reference node.
+     * The commands which do not build a term (e.g. `set-logic`, `check-sat`) are ignored.
+     */
+    class AstSmtParser {
+      private:
+        //! The kinds of tokens.
+        enum token_e {
+          TOKEN_END = 0,    /*!< End of the stream */
+          TOKEN_OPEN,       /*!< ( */
+          TOKEN_CLOSE,      /*!< ) */
+          TOKEN_SYMBOL,     /*!< A symbol, a keyword or a literal */
+          TOKEN_STRING      /*!< A string literal */
+        };
+
+        //! A token.
+        struct Token {
+          //! The kind of the token.
+          token_e kind;
+
+          //! The value of a symbol or a string.
+          std::string value;
+        };
+
+        //! A sort. The size is 0 for Bool, the index size is not 0 for arrays.
+        struct Sort {
+          //! The size of the bitvector indexes of an array.
+          triton::uint32 indexSize;
+
+          //! The size of a bitvector or of the values of an array.
+          triton::uint32 size;
+        };
+
+        //! A term being read.
+        struct Frame {
+          //! The operator, `let` for a let.
+          std::string op;
+
+          //! The indices of an indexed operator.
+          std::vector<triton::uint32> indices;
+
+          //! The arguments read.
+          std::vector<AbstractNode*> args;
+
+          //! The bindings of a let.
+          std::vector<std::pair<std::string, AbstractNode*>> lets;
+
+          //! True while the bindings of a let are read.
+          bool binding;
+        };
+
+        //! The input stream.
+        std::istream& stream;
+
+        //! The current line, for the error messages.
+        triton::usize line;
+
+        //! The asserted terms.
+        std::vector<AbstractNode*> asserts;
+
+        //! The declared and defined names.
+        std::map<std::string, AbstractNode*> symbols;
+
+        //! The names bound by the enclosing lets, the innermost binding last.
+        std::map<std::string, std::vector<AbstractNode*>> bindings;
+
+        //! Variables by name in the script.
+        std::map<std::string, triton::engines::symbolic::SymbolicVariable*> variables;
+
+        //! Returns an error message followed by the current line.
+        std::string located(const std::string& message) const;
+
+        //! Reads a token.
+        Token readToken(void);
+
+        //! Reads a symbol.
+        std::string readSymbol(void);
+
+        //! Reads a numeral which must fit in 32 bits.
+        triton::uint32 readIndex(void);
+
+        //! Reads a closing parenthesis.
+        void readClose(void);
+
+        //! Reads a sort.
+        Sort readSort(void);
+
+        //! Reads a term.
+        AbstractNode* readTerm(void);
+
+        //! Skips the end of the current S-expression.
+        void skip(void);
+
+        //! Declares a constant.
+        void declare(const std::string& name, const Sort& sort);
+
+        //! Returns the node of a symbol used as a term.
+        AbstractNode* getSymbol(const std::string& name);
+
+        //! Builds the application of an operator.
+        AbstractNode* buildNode(const std::string& op, const std::vector<triton::uint32>& indices, const std::vector<AbstractNode*>& args);
+
+      public:
+        //! Constructor.
+        AstSmtParser(std::istream& stream);
+
+        //! Reads a command. Returns false at the end of the stream.
+        bool readCommand(void);
+
+        //! Returns the asserted terms read.
+        const std::vector<AbstractNode*>& getAsserts(void) const;
+
+        //! Resolves the constants named `name` in the script to `symVar`.
+        void setVariable(const std::string& name, triton::engines::symbolic::SymbolicVariable* symVar);
+    };
+
+
+    //! Reads an SMT-LIB2 script and returns its asserted terms.
+    std::vector<AbstractNode*> parseSmt(std::istream& stream);
+
+  /*! @} End of ast namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_ASTSMTPARSER_H */
@@ -9,8 +9,11 @@
 #define TRITON_ASTSMTREPRESENTATION_HPP
 
 #include <iostream>
+#include <unordered_map>
+
 #include "astRepresentationInterface.hpp"
 #include "ast.hpp"
+#include "tritonTypes.hpp"
 
 
 
@@ -39,6 +42,13 @@ namespace triton {
 
       //! SMT representation.
       class AstSmtRepresentation : public AstRepresentationInterface {
+        private:
+          //! Displays the part of a node which precedes its child `index`, or which follows its last child if `index` is the number of children.
+          void printPart(std::ostream& stream, triton::ast::AbstractNode* node, triton::usize index);
+
+          //! Displays a node, its descendants which are in `bindings` are displayed by the name of their binding.
+          void printTerm(std::ostream& stream, triton::ast::AbstractNode* node, const std::unordered_map<triton::ast::AbstractNode*, triton::usize>& bindings);
+
         public:
           //! Constructor.
           AstSmtRepresentation();
@@ -49,152 +59,16 @@ namespace triton {
           //! Displays the node according to the representation mode.
           std::ostream& print(std::ostream& stream, triton::ast::AbstractNode* node);
 
-          //! Displays the node according to the representation mode.
-          std::ostream& print(std::ostream& stream, triton::ast::AssertNode* node);
-
-          //! Displays the node according to the representation mode.
-          std::ostream& print(std::ostream& stream, triton::ast::BvNode* node);
-
-          //! Displays the node according to the representation mode.
-          std::ostream& print(std::ostream& stream, triton::ast::BvaddNode* node);
-
-          //! Displays the node according to the representation mode.
-          std::ostream& print(std::ostream& stream, triton::ast::BvandNode* node);
-
-          //! Displays the node according to the representation mode.
-          std::ostream& print(std::ostream& stream, triton::ast::BvashrNode* node);
-
-          //! Displays the node according to the representation mode.
-          std::ostream& print(std::ostream& stream, triton::ast::BvdeclNode* node);
-
-          //! Displays the node according to the representation mode.
-          std::ostream& print(std::ostream& stream, triton::ast::BvlshrNode* node);
-
-          //! Displays the node according to the representation mode.
-          std::ostream& print(std::ostream& stream, triton::ast::BvmulNode* node);
-
-          //! Displays the node according to the representation mode.
-          std::ostream& print(std::ostream& stream, triton::ast::BvnandNode* node);
-
-          //! Displays the node according to the representation mode.
-          std::ostream& print(std::ostream& stream, triton::ast::BvnegNode* node);
-
-          //! Displays the node according to the representation mode.
-          std::ostream& print(std::ostream& stream, triton::ast::BvnorNode* node);
-
-          //! Displays the node according to the representation mode.
-          std::ostream& print(std::ostream& stream, triton::ast::BvnotNode* node);
-
-          //! Displays the node according to the representation mode.
-          std::ostream& print(std::ostream& stream, triton::ast::BvorNode* node);
-
-          //! Displays the node according to the representation mode.
-          std::ostream& print(std::ostream& stream, triton::ast::BvrolNode* node);
-
-          //! Displays the node according to the representation mode.
-          std::ostream& print(std::ostream& stream, triton::ast::BvrorNode* node);
-
-          //! Displays the node according to the representation mode.
-          std::ostream& print(std::ostream& stream, triton::ast::BvsdivNode* node);
-
-          //! Displays the node according to the representation mode.
-          std::ostream& print(std::ostream& stream, triton::ast::BvsgeNode* node);
-
-          //! Displays the node according to the representation mode.
-          std::ostream& print(std::ostream& stream, triton::ast::BvsgtNode* node);
-
-          //! Displays the node according to the representation mode.
-          std::ostream& print(std::ostream& stream, triton::ast::BvshlNode* node);
-
-          //! Displays the node according to the representation mode.
-          std::ostream& print(std::ostream& stream, triton::ast::BvsleNode* node);
-
-          //! Displays the node according to the representation mode.
-          std::ostream& print(std::ostream& stream, triton::ast::BvsltNode* node);
-
-          //! Displays the node according to the representation mode.
-          std::ostream& print(std::ostream& stream, triton::ast::BvsmodNode* node);
-
-          //! Displays the node according to the representation mode.
-          std::ostream& print(std::ostream& stream, triton::ast::BvsremNode* node);
-
-          //! Displays the node according to the representation mode.
-          std::ostream& print(std::ostream& stream, triton::ast::BvsubNode* node);
-
-          //! Displays the node according to the representation mode.
-          std::ostream& print(std::ostream& stream, triton::ast::BvudivNode* node);
-
-          //! Displays the node according to the representation mode.
-          std::ostream& print(std::ostream& stream, triton::ast::BvugeNode* node);
-
-          //! Displays the node according to the representation mode.
-          std::ostream& print(std::ostream& stream, triton::ast::BvugtNode* node);
-
-          //! Displays the node according to the representation mode.
-          std::ostream& print(std::ostream& stream, triton::ast::BvuleNode* node);
-
-          //! Displays the node according to the representation mode.
-          std::ostream& print(std::ostream& stream, triton::ast::BvultNode* node);
-
-          //! Displays the node according to the representation mode.
-          std::ostream& print(std::ostream& stream, triton::ast::BvuremNode* node);
-
-          //! Displays the node according to the representation mode.
-          std::ostream& print(std::ostream& stream, triton::ast::BvxnorNode* node);
-
-          //! Displays the node according to the representation mode.
-          std::ostream& print(std::ostream& stream, triton::ast::BvxorNode* node);
-
-          //! Displays the node according to the representation mode.
-          std::ostream& print(std::ostream& stream, triton::ast::CompoundNode* node);
-
-          //! Displays the node according to the representation mode.
-          std::ostream& print(std::ostream& stream, triton::ast::ConcatNode* node);
-
-          //! Displays the node according to the representation mode.
-          std::ostream& print(std::ostream& stream, triton::ast::DecimalNode* node);
-
-          //! Displays the node according to the representation mode.
-          std::ostream& print(std::ostream& stream, triton::ast::DeclareFunctionNode* node);
-
-          //! Displays the node according to the representation mode.
-          std::ostream& print(std::ostream& stream, triton::ast::DistinctNode* node);
-
-          //! Displays the node according to the representation mode.
-          std::ostream& print(std::ostream& stream, triton::ast::EqualNode* node);
-
-          //! Displays the node according to the representation mode.
-          std::ostream& print(std::ostream& stream, triton::ast::ExtractNode* node);
-
-          //! Displays the node according to the representation mode.
-          std::ostream& print(std::ostream& stream, triton::ast::IteNode* node);
-
-          //! Displays the node according to the representation mode.
-          std::ostream& print(std::ostream& stream, triton::ast::LandNode* node);
-
-          //! Displays the node according to the representation mode.
-          std::ostream& print(std::ostream& stream, triton::ast::LetNode* node);
-
-          //! Displays the node according to the representation mode.
-          std::ostream& print(std::ostream& stream, triton::ast::LnotNode* node);
-
-          //! Displays the node according to the representation mode.
-          std::ostream& print(std::ostream& stream, triton::ast::LorNode* node);
-
-          //! Displays the node according to the representation mode.
-          std::ostream& print(std::ostream& stream, triton::ast::ReferenceNode* node);
-
-          //! Displays the node according to the representation mode.
-          std::ostream& print(std::ostream& stream, triton::ast::StringNode* node);
-
-          //! Displays the node according to the representation mode.
-          std::ostream& print(std::ostream& stream, triton::ast::SxNode* node);
-
-          //! Displays the node according to the representation mode.
-          std::ostream& print(std::ostream& stream, triton::ast::VariableNode* node);
-
-          //! Displays the node according to the representation mode.
-          std::ostream& print(std::ostream& stream, triton::ast::ZxNode* node);
+          /*!
+           * \brief Displays the node as a DAG.
+           *
+           * \description
+           * The nodes which have several parents, other than leaves and constants, are displayed once in a `let`
+           * binding and then by the name of their binding, so the output is linear in the number of unique nodes.
+           * The bindings of an assertion are displayed inside it. ASTs with let, function or declaration nodes
+           * are displayed as with print().
+           */
+          std::ostream& printShared(std::ostream& stream, triton::ast::AbstractNode* node);
       };
 
     /*! @} End of representations namespace */
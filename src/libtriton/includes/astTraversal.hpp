@@ -0,0 +1,53 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#ifndef TRITON_ASTTRAVERSAL_H
+#define TRITON_ASTTRAVERSAL_H
+
+#include <unordered_set>
+#include <vector>
+
+#include "ast.hpp"
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The AST namespace
+  namespace ast {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup ast
+   *  @{
+   */
+
+    /*!
+     * \brief Appends the unique nodes of an AST to `output`.
+     *
+     * \description
+     * The walk uses an explicit stack, so deep ASTs do not overflow the native stack. With `postOrder`,
+     * children come before their parents (children are walked from the first one), otherwise parents
+     * come before their children. With `unroll`, the AST of the symbolic expression targeted by a
+     * reference node is walked as a child of the reference node. Nodes already in `visited` are skipped,
+     * new ones are added to it, so that a set may be shared between several walks.
+     */
+    void nodesExtraction(std::vector<AbstractNode*>& output, AbstractNode* root, std::unordered_set<AbstractNode*>& visited, bool unroll=false, bool postOrder=true);
+
+    //! Appends the unique nodes of an AST to `output`. \sa triton::ast::nodesExtraction()
+    void nodesExtraction(std::vector<AbstractNode*>& output, AbstractNode* root, bool unroll=false, bool postOrder=true);
+
+  /*! @} End of ast namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_ASTTRAVERSAL_H */
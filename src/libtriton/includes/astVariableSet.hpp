@@ -0,0 +1,96 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#ifndef TRITON_ASTVARIABLESET_H
+#define TRITON_ASTVARIABLESET_H
+
+#include <vector>
+
+#include "tritonTypes.hpp"
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The AST namespace
+  namespace ast {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup ast
+   *  @{
+   */
+
+    /*! \class VariableSet
+     *  \brief An immutable set of symbolic variable ids, hash-consed.
+     *
+     * \description
+     * The ids are stored as a bitmap which starts at the word of the lowest id, so the sets of the inputs read
+     * one after the other stay small. Equal sets are the same object: sets are compared by pointer and the union
+     * of two sets is computed once. `nullptr` is the empty set. Sets are shared by every API and kept until the
+     * end of the process. Each AST node holds the set of the variables its tree depends on, see
+     * triton::ast::AbstractNode::getVariables().
+     */
+    class VariableSet {
+      private:
+        //! The index of the first word of the bitmap (id / 64).
+        triton::usize base;
+
+        //! The bitmap, the bit `id % 64` of the word `id / 64 - base` is set if `id` is in the set.
+        std::vector<triton::uint64> words;
+
+        //! Constructor. The first and the last words are not null.
+        VariableSet(triton::usize base, const std::vector<triton::uint64>& words);
+
+        //! Returns the set of a bitmap, an existing one if it is already known. Leading and trailing null words are ignored. The sets must be locked.
+        static const VariableSet* intern(triton::usize base, const std::vector<triton::uint64>& words);
+
+        //! Hashes the bitmap of a set.
+        friend struct VariableSetHash;
+
+        //! Compares the bitmaps of two sets.
+        friend struct VariableSetEqual;
+
+      public:
+        //! Returns true if the variable `id` is in the set.
+        static bool contains(const VariableSet* set, triton::usize id);
+
+        //! Returns the number of variables in the set.
+        static triton::usize count(const VariableSet* set);
+
+        //! Returns the variable ids of the set, sorted.
+        static std::vector<triton::usize> getIds(const VariableSet* set);
+
+        //! Returns the set of one variable.
+        static const VariableSet* singleton(triton::usize id);
+
+        //! Returns the set of the variables `ids`. nullptr if `ids` is empty.
+        static const VariableSet* fromIds(const std::vector<triton::usize>& ids);
+
+        //! Returns the union of two sets.
+        static const VariableSet* merge(const VariableSet* a, const VariableSet* b);
+
+        //! Returns true if every variable of `a` is in `b`.
+        static bool isSubset(const VariableSet* a, const VariableSet* b);
+
+        //! Returns true if `a` and `b` have a variable in common.
+        static bool intersects(const VariableSet* a, const VariableSet* b);
+
+        //! Returns the number of sets created.
+        static triton::usize getNumberOfSets(void);
+    };
+
+  /*! @} End of ast namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_ASTVARIABLESET_H */
@@ -25,6 +25,7 @@ namespace triton {
    *  @{
    */
 
+    class ArrayNode;
     class AssertNode;
     class BvaddNode;
     class BvandNode;
@@ -70,9 +71,13 @@ namespace triton {
     class LnotNode;
     class LorNode;
     class ReferenceNode;
+    class SelectNode;
+    class StoreNode;
     class StringNode;
     class SxNode;
+    class VaddNode;
     class VariableNode;
+    class VeqNode;
     class ZxNode;
 
     //! \interface AstVisitor
@@ -82,6 +87,7 @@ namespace triton {
         AstVisitor(){};
         virtual ~AstVisitor(){};
 
+        virtual void operator()(ArrayNode& e) = 0;
         virtual void operator()(AssertNode& e) = 0;
         virtual void operator()(BvaddNode& e) = 0;
         virtual void operator()(BvandNode& e) = 0;
@@ -127,9 +133,13 @@ namespace triton {
         virtual void operator()(LnotNode& e) = 0;
         virtual void operator()(LorNode& e) = 0;
         virtual void operator()(ReferenceNode& e) = 0;
+        virtual void operator()(SelectNode& e) = 0;
+        virtual void operator()(StoreNode& e) = 0;
         virtual void operator()(StringNode& e) = 0;
         virtual void operator()(SxNode& e) = 0;
+        virtual void operator()(VaddNode& e) = 0;
         virtual void operator()(VariableNode& e) = 0;
+        virtual void operator()(VeqNode& e) = 0;
         virtual void operator()(ZxNode& e) = 0;
     }; /* AstVisitor class */
 
@@ -0,0 +1,105 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#ifndef TRITON_ASTWORD_H
+#define TRITON_ASTWORD_H
+
+#include "tritonTypes.hpp"
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The AST namespace
+  namespace ast {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup ast
+   *  @{
+   */
+
+    /*! \brief The operations on the values of the nodes which depend on their type.
+     *
+     * \description
+     * The values of the nodes up to 64 bits are computed on `triton::uint64`, the wider ones on
+     * `triton::uint512`. The evaluations written once for a type `T` use these operations.
+     */
+    template <typename T> struct Word;
+
+
+    //! The operations on the values up to 64 bits.
+    template <> struct Word<triton::uint64> {
+      //! The signed type.
+      typedef triton::sint64 Signed;
+
+      //! Returns the mask of `size` bits.
+      static triton::uint64 mask(triton::uint32 size) {
+        return (size >= 64) ? 0xffffffffffffffffULL : ((1ULL << size) - 1);
+      }
+
+      //! Returns the signed value of a value of `size` bits.
+      static Signed toSigned(triton::uint64 value, triton::uint32 size) {
+        if (size < 64 && ((value >> (size - 1)) & 1))
+          value |= ~Word::mask(size);
+        return static_cast<Signed>(value);
+      }
+
+      //! Returns the unsigned value of a signed value, not masked.
+      static triton::uint64 fromSigned(Signed value) {
+        return static_cast<triton::uint64>(value);
+      }
+
+      //! Returns the 32 low bits of a value.
+      static triton::uint32 toUint32(triton::uint64 value) {
+        return static_cast<triton::uint32>(value);
+      }
+    };
+
+
+    //! The operations on the values up to 512 bits.
+    template <> struct Word<triton::uint512> {
+      //! The signed type.
+      typedef triton::sint512 Signed;
+
+      //! Returns the mask of `size` bits.
+      static triton::uint512 mask(triton::uint32 size) {
+        triton::uint512 mask = -1;
+        return (mask >> (512 - size));
+      }
+
+      //! Returns the signed value of a value of `size` bits. See triton::ast::modularSignExtend().
+      static Signed toSigned(const triton::uint512& value, triton::uint32 size) {
+        Signed ret = value;
+        if ((value >> (size - 1)) & 1) {
+          ret = -1;
+          ret = ((ret << size) | value);
+        }
+        return ret;
+      }
+
+      //! Returns the unsigned value of a signed value, not masked.
+      static triton::uint512 fromSigned(const Signed& value) {
+        return value.convert_to<triton::uint512>();
+      }
+
+      //! Returns the 32 low bits of a value.
+      static triton::uint32 toUint32(const triton::uint512& value) {
+        return value.convert_to<triton::uint32>();
+      }
+    };
+
+  /*! @} End of ast namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_ASTWORD_H */
@@ -11,6 +11,7 @@
 #include <list>
 
 #include "memoryMapping.hpp"
+#include "symbolIndex.hpp"
 #include "tritonTypes.hpp"
 
 
@@ -42,6 +43,9 @@ namespace triton {
 
         //! Returns all memory areas which may be mapped.
         virtual const std::list<triton::format::MemoryMapping>& getMemoryMapping(void) const = 0;
+
+        //! Returns the indexes of the symbols and relocations. They are built on the first call.
+        virtual const triton::format::SymbolIndex& getSymbolIndex(void) const = 0;
     };
 
   /*! @} End of format namespace */
@@ -0,0 +1,107 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#ifndef TRITON_BOOLECTORBACKEND_H
+#define TRITON_BOOLECTORBACKEND_H
+
+#ifdef TRITON_BOOLECTOR
+
+#include <atomic>
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <boolector/boolector.h>
+
+#include "ast.hpp"
+#include "solverBackend.hpp"
+#include "symbolicEngine.hpp"
+#include "tritonTypes.hpp"
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+  //! The Engines namespace
+  namespace engines {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup engines
+   *  @{
+   */
+    //! The Solver namespace
+    namespace solver {
+    /*!
+     *  \ingroup engines
+     *  \addtogroup solver
+     *  @{
+     */
+
+      //! \class BoolectorBackend
+      /*! \brief The Boolector solver backend.
+       *
+       * \description
+       * Triton's ASTs are translated to Boolector's nodes without going through SMT2. Boolean nodes are
+       * bitvectors of one bit. Boolector has no resource limit, only the timeout is applied.
+       */
+      class BoolectorBackend : public SolverBackend {
+        private:
+          //! Symbolic Engine API
+          triton::engines::symbolic::SymbolicEngine* symbolicEngine;
+
+          //! True once the backend has been interrupted.
+          std::atomic<bool> interrupted;
+
+          //! The end of the query being solved (see triton::utils::getMonotonicTime()). 0 if unlimited.
+          triton::uint64 deadline;
+
+          //! The translated nodes.
+          std::unordered_map<triton::ast::AbstractNode*, BoolectorNode*> nodes;
+
+          //! The symbols of the let nodes.
+          std::map<std::string, triton::ast::AbstractNode*> symbols;
+
+          //! The variables of the query, by name.
+          std::map<std::string, BoolectorNode*> variables;
+
+          //! Returns the translation of a node. String nodes are resolved through the let symbols.
+          BoolectorNode* getNode(triton::ast::AbstractNode* node) const;
+
+          //! Translates a node whose children are translated.
+          BoolectorNode* translate(Btor* btor, triton::ast::AbstractNode* node);
+
+          //! Polled by Boolector, returns 1 to stop the query.
+          static int32_t terminate(void* state);
+
+        public:
+          //! Constructor.
+          BoolectorBackend(triton::engines::symbolic::SymbolicEngine* symbolicEngine);
+
+          //! Returns the name of the backend.
+          std::string getName(void) const;
+
+          //! Solves a conjunction of constraints, see triton::engines::solver::SolverBackend::solve().
+          triton::engines::solver::status_e solve(const std::vector<triton::ast::AbstractNode*>& constraints, triton::uint32 timeout, triton::uint32 resourceLimit, std::map<triton::uint32, SolverModel>& model);
+
+          //! Stops the query being solved, or the next one.
+          void interrupt(void);
+      };
+
+    /*! @} End of solver namespace */
+    };
+  /*! @} End of engines namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_BOOLECTOR */
+#endif /* TRITON_BOOLECTORBACKEND_H */
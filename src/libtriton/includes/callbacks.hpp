@@ -8,11 +8,15 @@
 #ifndef TRITON_CALLBACKS_H
 #define TRITON_CALLBACKS_H
 
+#include <functional>
 #include <list>
+#include <utility>
+#include <vector>
 
 #include "ast.hpp"
 #include "register.hpp"
 #include "memoryAccess.hpp"
+#include "symbolicExpression.hpp"
 #include "tritonTypes.hpp"
 
 #ifdef TRITON_PYTHON_BINDINGS
@@ -38,9 +42,13 @@ namespace triton {
 
     /*! Enumerates all kinds callbacks. */
     enum callback_e {
-      GET_CONCRETE_MEMORY_VALUE,    /*!< Get concrete memory value callback */
-      GET_CONCRETE_REGISTER_VALUE,  /*!< Get concrete register value callback */
-      SYMBOLIC_SIMPLIFICATION,      /*!< Symbolic simplification callback */
+      GET_CONCRETE_MEMORY_VALUE,      /*!< Get concrete memory value callback */
+      GET_CONCRETE_REGISTER_VALUE,    /*!< Get concrete register value callback */
+      SYMBOLIC_SIMPLIFICATION,        /*!< Symbolic simplification callback */
+      GET_CONCRETE_MEMORY_AREA_VALUE, /*!< Get concrete memory area value callback */
+      MEMORY_LIMIT,                   /*!< Memory limit callback */
+      EXPRESSION_LIMIT,               /*!< Expression limit callback */
+      MEMORY_MISS,                    /*!< Memory miss callback */
     };
 
     /*! \brief The prototype of a GET_CONCRETE_MEMORY_VALUE callback.
@@ -50,6 +58,14 @@ namespace triton {
      */
     typedef void (*getConcreteMemoryValueCallback)(triton::arch::MemoryAccess& mem);
 
+    /*! \brief The prototype of a GET_CONCRETE_MEMORY_AREA_VALUE callback.
+     *
+     * \description The callback takes as arguments the base address and the size of a memory area. Callbacks
+     * will be called once each time that the Triton library will need the concrete value of a memory area, instead
+     * of once per byte like GET_CONCRETE_MEMORY_VALUE callbacks.
+     */
+    typedef void (*getConcreteMemoryAreaValueCallback)(triton::uint64 baseAddr, triton::usize size);
+
     /*! \brief The prototype of a GET_CONCRETE_REGISTER_VALUE callback.
      *
      * \description The callback takes as unique argument a register. Callbacks will be
@@ -64,32 +80,127 @@ namespace triton {
      */
     typedef triton::ast::AbstractNode* (*symbolicSimplificationCallback)(triton::ast::AbstractNode* node);
 
+    /*! \brief The prototype of a MEMORY_LIMIT callback.
+     *
+     * \description The callback takes as arguments the estimated number of bytes used by the engines and a flag which
+     * is true if the hard limit is exceeded, false if only the soft limit is. Callbacks may free memory (e.g. concretize
+     * or collect expressions). See triton::API::setMemoryLimits().
+     */
+    typedef void (*memoryLimitCallback)(triton::usize usage, bool hard);
+
+    /*! \brief The prototype of an EXPRESSION_LIMIT callback.
+     *
+     * \description The callback takes as unique argument a symbolic expression just built whose depth or unrolled size
+     * exceeds the limits. Callbacks may concretize its destination, before the CONCRETIZE_LARGE_EXPRESSIONS mode does.
+     * See triton::API::setExpressionLimits().
+     */
+    typedef void (*expressionLimitCallback)(triton::engines::symbolic::SymbolicExpression* expr);
+
+    /*! \brief The prototype of a MEMORY_MISS callback.
+     *
+     * \description The callback takes as arguments the address of a page of the concrete memory, a buffer of `size` bytes
+     * set to zero and `size` (the size of a page). Callbacks will be called once per page, the first time the Triton library
+     * needs the concrete value of a page which is not mapped. Returns true if the callback filled the buffer, which is
+     * then mapped as the page, so the next reads of the page are served without callback. Returns false to leave the page
+     * unmapped.
+     */
+    typedef bool (*memoryMissCallback)(triton::uint64 pageAddr, triton::uint8* page, triton::usize size);
+
+    /*! \brief The prototype of an address hook of the emulation loop.
+     *
+     * \description The hook takes as unique argument the address reached by the program counter and is called before
+     * the instruction at this address is processed. It may redirect the execution by setting the program counter
+     * (e.g. to simulate a routine). Returns false to stop the emulation. See triton::API::run().
+     */
+    typedef std::function<bool(triton::uint64 address)> addressHookCallback;
+
+    #ifdef TRITON_PYTHON_BINDINGS
+    /*! \brief A batched python callback.
+     *
+     * \description Events are recorded in a native buffer and delivered to the function as a single list
+     * once `size` events are pending, at the end of each basic block or on Callbacks::flushCallbacks().
+     * A batched callback observes events after the fact, so it cannot provide concrete values.
+     */
+    struct PyBatchedCallback {
+      //! The python function.
+      PyObject* function;
+
+      //! The kind of events recorded.
+      triton::callbacks::callback_e kind;
+
+      //! The number of events delivered at once.
+      triton::usize size;
+
+      //! The pending events: (address, size) for memory kinds, (register id, 0) for GET_CONCRETE_REGISTER_VALUE.
+      std::vector<std::pair<triton::uint64, triton::uint64>> events;
+    };
+    #endif
+
     //! \class Callbacks
     /*! \brief The callbacks class */
     class Callbacks {
       protected:
         #ifdef TRITON_PYTHON_BINDINGS
+        //! [python] Batched callbacks.
+        mutable std::list<triton::callbacks::PyBatchedCallback> pyBatchedCallbacks;
+
+        //! [python] Records an event for the batched callbacks of a kind.
+        void recordBatchedEvent(triton::callbacks::callback_e kind, triton::uint64 first, triton::uint64 second) const;
+
+        //! [python] Delivers the pending events of a batched callback.
+        void flushBatchedCallback(triton::callbacks::PyBatchedCallback& cb) const;
+
         //! [python] Callbacks for all concrete memory needs.
         std::list<PyObject*> pyGetConcreteMemoryValueCallbacks;
 
+        //! [python] Callbacks for all concrete memory area needs.
+        std::list<PyObject*> pyGetConcreteMemoryAreaValueCallbacks;
+
         //! [python] Callbacks for all concrete register needs.
         std::list<PyObject*> pyGetConcreteRegisterValueCallbacks;
 
         //! [python] Callbacks for all symbolic simplifications.
         std::list<PyObject*> pySymbolicSimplificationCallbacks;
+
+        //! [python] Callbacks for all memory limits.
+        std::list<PyObject*> pyMemoryLimitCallbacks;
+
+        //! [python] Callbacks for all expression limits.
+        std::list<PyObject*> pyExpressionLimitCallbacks;
+
+        //! [python] Callbacks for all memory misses.
+        std::list<PyObject*> pyMemoryMissCallbacks;
         #endif
 
         //! [c++] Callbacks for all concrete memory needs.
         std::list<triton::callbacks::getConcreteMemoryValueCallback> getConcreteMemoryValueCallbacks;
 
+        //! [c++] Callbacks for all concrete memory area needs.
+        std::list<triton::callbacks::getConcreteMemoryAreaValueCallback> getConcreteMemoryAreaValueCallbacks;
+
         //! [c++] Callbacks for all concrete register needs.
         std::list<triton::callbacks::getConcreteRegisterValueCallback> getConcreteRegisterValueCallbacks;
 
         //! [c++] Callbacks for all symbolic simplifications.
         std::list<triton::callbacks::symbolicSimplificationCallback> symbolicSimplificationCallbacks;
 
-        //! Returns the number of callbacks recorded.
-        triton::usize countCallbacks(void) const;
+        //! [c++] Callbacks for all memory limits.
+        std::list<triton::callbacks::memoryLimitCallback> memoryLimitCallbacks;
+
+        //! [c++] Callbacks for all expression limits.
+        std::list<triton::callbacks::expressionLimitCallback> expressionLimitCallbacks;
+
+        //! [c++] Callbacks for all memory misses.
+        std::list<triton::callbacks::memoryMissCallback> memoryMissCallbacks;
+
+        //! The number of changes of the recorded callbacks.
+        triton::usize revision;
+
+        //! The bitmask of the kinds of callbacks recorded (bit `1 << kind`).
+        triton::uint32 kinds;
+
+        //! Updates the bitmask of the kinds of callbacks recorded and `isDefined`.
+        void updateKinds(void);
 
       public:
         //! True if there is at least one callback defined.
@@ -110,15 +221,39 @@ namespace triton {
         //! Adds a GET_CONCRETE_MEMORY_VALUE callback.
         void addCallback(triton::callbacks::getConcreteMemoryValueCallback cb);
 
+        //! Adds a GET_CONCRETE_MEMORY_AREA_VALUE callback.
+        void addCallback(triton::callbacks::getConcreteMemoryAreaValueCallback cb);
+
         //! Adds a GET_CONCRETE_REGISTER_VALUE callback.
         void addCallback(triton::callbacks::getConcreteRegisterValueCallback cb);
 
         //! Adds a SYMBOLIC_SIMPLIFICATION callback.
         void addCallback(triton::callbacks::symbolicSimplificationCallback cb);
 
+        //! Adds a MEMORY_LIMIT callback.
+        void addCallback(triton::callbacks::memoryLimitCallback cb);
+
+        //! Adds an EXPRESSION_LIMIT callback.
+        void addCallback(triton::callbacks::expressionLimitCallback cb);
+
+        //! Adds a MEMORY_MISS callback.
+        void addCallback(triton::callbacks::memoryMissCallback cb);
+
         #ifdef TRITON_PYTHON_BINDINGS
         //! Adds a python callback.
         void addCallback(PyObject* function, triton::callbacks::callback_e kind);
+
+        //! Adds a batched python callback receiving lists of at most `size` events. \sa triton::callbacks::PyBatchedCallback.
+        void addBatchedCallback(PyObject* function, triton::callbacks::callback_e kind, triton::usize size);
+
+        //! Delivers the pending events of all batched python callbacks.
+        void flushCallbacks(void) const;
+
+        //! Returns true if there is at least one batched python callback.
+        bool isBatchedCallbackDefined(void) const;
+
+        //! Returns true if there is at least one python callback, batched or not.
+        bool isPythonCallbackDefined(void) const;
         #endif
 
         //! Removes all recorded callbacks.
@@ -127,17 +262,40 @@ namespace triton {
         //! Deletes a GET_CONCRETE_MEMORY_VALUE callback.
         void removeCallback(triton::callbacks::getConcreteMemoryValueCallback cb);
 
+        //! Deletes a GET_CONCRETE_MEMORY_AREA_VALUE callback.
+        void removeCallback(triton::callbacks::getConcreteMemoryAreaValueCallback cb);
+
         //! Deletes a GET_CONCRETE_REGISTER_VALUE callback.
         void removeCallback(triton::callbacks::getConcreteRegisterValueCallback cb);
 
         //! Deletes a SYMBOLIC_SIMPLIFICATION callback.
         void removeCallback(triton::callbacks::symbolicSimplificationCallback cb);
 
+        //! Deletes a MEMORY_LIMIT callback.
+        void removeCallback(triton::callbacks::memoryLimitCallback cb);
+
+        //! Deletes an EXPRESSION_LIMIT callback.
+        void removeCallback(triton::callbacks::expressionLimitCallback cb);
+
+        //! Deletes a MEMORY_MISS callback.
+        void removeCallback(triton::callbacks::memoryMissCallback cb);
+
         #ifdef TRITON_PYTHON_BINDINGS
-        //! Deletes a python callback according to its kind.
+        //! Deletes a python callback according to its kind. Pending events of a batched callback are delivered first.
         void removeCallback(PyObject* function, triton::callbacks::callback_e kind);
         #endif
 
+        //! Returns the number of changes of the recorded callbacks. Results of callbacks may be cached as long as it does not change.
+        triton::usize getRevision(void) const;
+
+        //! Returns true if there is at least one callback of a kind. Cheap enough to guard every dispatch of a hot path.
+        bool isCallbackDefined(triton::callbacks::callback_e kind) const {
+          return ((this->kinds >> kind) & 1) != 0;
+        }
+
+        //! Returns true if there is at least one SYMBOLIC_SIMPLIFICATION callback.
+        bool isSymbolicSimplificationDefined(void) const;
+
         //! Processes callbacks according to the kind and the C++ polymorphism.
         triton::ast::AbstractNode* processCallbacks(triton::callbacks::callback_e kind, triton::ast::AbstractNode* node) const;
 
@@ -146,6 +304,18 @@ namespace triton {
 
         //! Processes callbacks according to the kind and the C++ polymorphism.
         void processCallbacks(triton::callbacks::callback_e kind, const triton::arch::Register& reg) const;
+
+        //! Processes callbacks according to the kind and the C++ polymorphism.
+        void processCallbacks(triton::callbacks::callback_e kind, triton::uint64 baseAddr, triton::usize size) const;
+
+        //! Processes callbacks according to the kind and the C++ polymorphism.
+        void processCallbacks(triton::callbacks::callback_e kind, bool hard, triton::usize usage) const;
+
+        //! Processes callbacks according to the kind and the C++ polymorphism.
+        void processCallbacks(triton::callbacks::callback_e kind, triton::engines::symbolic::SymbolicExpression* expr) const;
+
+        //! Processes callbacks according to the kind and the C++ polymorphism. Returns true once a callback has filled the page, the next ones are not called.
+        bool processCallbacks(triton::callbacks::callback_e kind, triton::uint64 pageAddr, triton::uint8* page, triton::usize size) const;
     };
 
   /*! @} End of callbacks namespace */
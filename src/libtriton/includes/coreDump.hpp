@@ -0,0 +1,86 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#ifndef TRITON_COREDUMP_H
+#define TRITON_COREDUMP_H
+
+#include <list>
+#include <memory>
+#include <string>
+
+#include "mappedFile.hpp"
+#include "memoryMapping.hpp"
+#include "tritonTypes.hpp"
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The Format namespace
+  namespace format {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup format
+   *  @{
+   */
+
+    /*! \class CoreDump
+     *  \brief The memory of a process saved by a crash dump.
+     *
+     * \description
+     * Reads the memory areas of an ELF core file (its loadable segments) or of a minidump (its memory lists).
+     * The file is mapped and shared with the memories where its areas are mapped, so the dump is never copied.
+     * \sa triton::API::loadCoreDump()
+     */
+    class CoreDump {
+      private:
+        //! Path of the dump.
+        std::string path;
+
+        //! The dump mapped into memory.
+        std::shared_ptr<triton::format::MappedFile> file;
+
+        //! The memory areas of the dump.
+        std::list<triton::format::MemoryMapping> memoryMapping;
+
+        //! Returns true if `size` bytes at `offset` are in the file.
+        bool isInside(triton::uint64 offset, triton::uint64 size) const;
+
+        //! Adds a memory area of the dump.
+        void addArea(triton::uint64 offset, triton::uint64 size, triton::uint64 address);
+
+        //! Reads the loadable segments of an ELF core file.
+        void parseElf(void);
+
+        //! Reads the memory lists of a minidump.
+        void parseMinidump(void);
+
+      public:
+        //! Constructor. Raises a triton::exceptions::Format if the file cannot be mapped or is not a dump.
+        CoreDump(const std::string& path);
+
+        //! Returns the path of the dump.
+        const std::string& getPath(void) const;
+
+        //! Returns the mapped dump.
+        const std::shared_ptr<triton::format::MappedFile>& getFile(void) const;
+
+        //! Returns the memory areas of the dump. Their bytes are views of the mapped file.
+        const std::list<triton::format::MemoryMapping>& getMemoryMapping(void) const;
+    };
+
+  /*! @} End of format namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_COREDUMP_H */
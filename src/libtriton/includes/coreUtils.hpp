@@ -8,6 +8,8 @@
 #ifndef TRITON_CORE_UTIL_H
 #define TRITON_CORE_UTIL_H
 
+#include <functional>
+
 #include "tritonTypes.hpp"
 
 
@@ -39,6 +41,26 @@ namespace triton {
     //! Returns the value located into the buffer.
     template <typename T> T fromBufferToUint(const triton::uint8* buffer);
 
+    //! Returns a monotonic time in nanoseconds, used to measure durations.
+    triton::uint64 getMonotonicTime(void);
+
+    //! Returns the time stamp counter of the CPU, or getMonotonicTime() on hosts without one.
+    triton::uint64 getCycles(void);
+
+    //! Returns the estimated number of bytes used by a node of an ordered container (std::map, std::set) holding `valueSize` bytes.
+    triton::usize getTreeNodeSize(triton::usize valueSize);
+
+    //! Returns the estimated number of bytes used by a node of an unordered container (std::unordered_map) holding `valueSize` bytes.
+    triton::usize getHashNodeSize(triton::usize valueSize);
+
+    /*!
+     * \brief Calls `body(begin, end)` on the chunks of `grain` items of `[0, count)`, on the hardware threads.
+     *
+     * \description The chunks are shared by the threads in order. A single chunk runs on the calling thread. The
+     * first exception raised by a chunk is raised again once every thread has returned.
+     */
+    void parallelFor(triton::usize count, triton::usize grain, const std::function<void(triton::usize, triton::usize)>& body);
+
   /*! @} End of triton namespace */
   };
 /*! @} End of triton namespace */
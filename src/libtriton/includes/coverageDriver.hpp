@@ -0,0 +1,171 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#ifndef TRITON_COVERAGEDRIVER_H
+#define TRITON_COVERAGEDRIVER_H
+
+#include <functional>
+#include <map>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "callbacks.hpp"
+#include "tritonTypes.hpp"
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  class API;
+
+  //! The Engines namespace
+  namespace engines {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup engines
+   *  @{
+   */
+
+    //! The Exploration namespace
+    namespace exploration {
+    /*!
+     *  \ingroup engines
+     *  \addtogroup exploration
+     *  @{
+     */
+
+      //! The size of an edge coverage map, see triton::API::run().
+      const triton::usize EDGE_MAP_SIZE = 0x10000;
+
+
+      /*! \class CoverageDriver
+       *  \brief Generates the inputs of a code which reach new edges.
+       *
+       * \description
+       * An input is a buffer of bytes written at a fixed address and symbolized byte by byte. Every input is emulated
+       * with triton::API::run() from the snapshot of the initial state, which records its edges into an AFL-style
+       * coverage map: hit counts per hashed edge, classified into buckets. An input which reaches new buckets is
+       * written to the corpus. Then every branch of its path which no input has taken nor tried yet is flipped:
+       * the queries are solved asynchronously (see triton::API::getModelAsync()) and each model gives a new input.
+       * The inputs are scheduled by the novelty of the input which spawned them, the highest first.
+       *
+       * Several drivers, possibly in several processes, cooperate by sharing their coverage map in shared memory
+       * (see setSharedMap()) and their corpus directory (see setCorpus()): the branches tried by a driver are not
+       * flipped again by another one, and the inputs written by a driver are picked up by the other ones.
+       */
+      class CoverageDriver {
+        private:
+          //! An input waiting to be emulated.
+          struct Seed {
+            //! The bytes of the input.
+            std::vector<triton::uint8> data;
+
+            //! The novelty of the input which has spawned it.
+            triton::usize novelty;
+
+            //! True if the input comes from the corpus directory.
+            bool written;
+          };
+
+          //! The API emulated.
+          triton::API* api;
+
+          //! The address of the input.
+          triton::uint64 inputAddress;
+
+          //! The size of the input in bytes.
+          triton::usize inputSize;
+
+          //! The inputs waiting to be emulated, by novelty (the highest first) then in order.
+          std::multimap<triton::usize, Seed, std::greater<triton::usize>> queue;
+
+          //! The inputs queued or emulated.
+          std::set<std::vector<triton::uint8>> seen;
+
+          //! The inputs which have reached new edges, in order.
+          std::vector<std::vector<triton::uint8>> corpus;
+
+          //! The corpus directory, empty if none.
+          std::string directory;
+
+          //! The files of the corpus directory already read.
+          std::set<std::string> files;
+
+          //! The name of the shared memory, empty if the maps are private.
+          std::string sharedName;
+
+          //! The edge coverage map (EDGE_MAP_SIZE bytes) followed by the bitmap of the branches tried (EDGE_MAP_SIZE bytes).
+          triton::uint8* maps;
+
+          //! The storage of the maps when they are private.
+          std::vector<triton::uint8> privateMaps;
+
+          //! Queues an input which has not been seen yet. `written` is true if it comes from the corpus directory.
+          void pushSeed(std::vector<triton::uint8> data, triton::usize novelty, bool written);
+
+          //! Reads the files of the corpus directory not read yet and queues them. Returns the number of files read.
+          triton::usize syncCorpus(void);
+
+          //! Writes an input to the corpus directory.
+          void writeCorpus(const std::vector<triton::uint8>& data);
+
+          //! Merges the coverage of a run into the coverage map. Returns the number of new buckets reached.
+          triton::usize mergeCoverage(std::vector<triton::uint8>& trace);
+
+          //! Marks a branch (source, destination) as tried. Returns true if it was not tried yet.
+          bool tryBranch(triton::uint64 src, triton::uint64 dst);
+
+          //! Flips the branches of the last path not tried yet and queues the inputs of their models.
+          void flipBranches(const std::vector<triton::uint8>& data, const std::map<triton::usize, triton::usize>& offsets, triton::usize base, triton::usize novelty);
+
+        public:
+          //! Constructor. The inputs are `inputSize` bytes at `inputAddress`. Raises an exception if the api is null or the size is 0.
+          CoverageDriver(triton::API* api, triton::uint64 inputAddress, triton::usize inputSize);
+
+          //! Destructor.
+          ~CoverageDriver();
+
+          //! Sets the corpus directory. The inputs found are written there, and the files there are taken as inputs.
+          void setCorpus(const std::string& directory);
+
+          //! Shares the coverage map through the POSIX shared memory `name` (e.g. `/triton-coverage`), created if needed. Unix only.
+          void setSharedMap(const std::string& name);
+
+          //! Queues an input. It is padded with zeros or truncated to the size of the input.
+          void addSeed(const std::vector<triton::uint8>& data);
+
+          /*!
+           * \brief Emulates the inputs from `entry` until there is none left. Returns the number of inputs emulated.
+           *
+           * \description Every input runs with triton::API::run() using `hooks` and `maxInsns`. The generation stops when
+           * there is no input left, or once `maxRuns` inputs are emulated if `maxRuns` is not 0. The state of the API is
+           * restored at the end and the API is bound to the calling thread meanwhile.
+           */
+          triton::usize run(triton::uint64 entry, const std::map<triton::uint64, triton::callbacks::addressHookCallback>& hooks, triton::usize maxRuns=0, triton::usize maxInsns=0);
+
+          //! Returns the inputs which have reached new edges, in the order they were found.
+          const std::vector<std::vector<triton::uint8>>& getCorpus(void) const;
+
+          //! Returns the number of edges of the coverage map reached, by all the drivers if it is shared.
+          triton::usize getCoveredEdges(void) const;
+      };
+
+    /*! @} End of exploration namespace */
+    };
+  /*! @} End of engines namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_COVERAGEDRIVER_H */
@@ -11,8 +11,10 @@
 #include <set>
 #include <vector>
 
+#include "decodeCache.hpp"
 #include "instruction.hpp"
 #include "memoryAccess.hpp"
+#include "pagedMemory.hpp"
 #include "register.hpp"
 #include "registerSpecification.hpp"
 #include "tritonTypes.hpp"
@@ -68,6 +70,9 @@ namespace triton {
         //! Returns all information about a register id.
         virtual triton::arch::RegisterSpecification getRegisterSpecification(triton::uint32 regId) const = 0;
 
+        //! Returns the row of the constant specification table of a register id, without allocation.
+        virtual const triton::arch::RegisterSpecificationEntry& getRegisterSpecificationEntry(triton::uint32 regId) const = 0;
+
         //! Returns all registers.
         virtual std::set<triton::arch::Register*> getAllRegisters(void) const = 0;
 
@@ -77,6 +82,23 @@ namespace triton {
         //! Disassembles the instruction according to the architecture.
         virtual void disassembly(triton::arch::Instruction& inst) const = 0;
 
+        //! Opens a decoder (a Capstone handle) for decode(). It must be closed with closeDecoder().
+        virtual triton::usize openDecoder(void) const = 0;
+
+        //! Closes a decoder opened by openDecoder().
+        virtual void closeDecoder(triton::usize handle) const = 0;
+
+        /*!
+         * \brief Decodes the instruction at `addr` from at most `size` bytes of `opcodes`. Returns false if the bytes are not an instruction.
+         *
+         * \description Several threads may decode at the same time, each one with its own decoder.
+         * Registers and memory accesses are built through the API bound to the calling thread.
+         */
+        virtual bool decode(triton::usize handle, const triton::uint8* opcodes, triton::usize size, triton::uint64 addr, triton::arch::DecodedInstruction& decoded) const = 0;
+
+        //! Returns the cache of the instructions decoded by disassembly().
+        virtual triton::arch::DecodeCache& getDecodeCache(void) = 0;
+
         //! Returns the concrete value of a memory cell.
         virtual triton::uint8 getConcreteMemoryValue(triton::uint64 addr) const = 0;
 
@@ -86,6 +108,9 @@ namespace triton {
         //! Returns the concrete value of a memory area.
         virtual std::vector<triton::uint8> getConcreteMemoryAreaValue(triton::uint64 baseAddr, triton::usize size, bool execCallbacks=true) const = 0;
 
+        //! Reads the concrete value of a memory area into `area`, which holds at least `size` bytes.
+        virtual void getConcreteMemoryAreaValue(triton::uint64 baseAddr, triton::uint8* area, triton::usize size, bool execCallbacks=true) const = 0;
+
         //! Returns the concrete value of a register.
         virtual triton::uint512 getConcreteRegisterValue(const triton::arch::Register& reg, bool execCallbacks=true) const = 0;
 
@@ -134,6 +159,15 @@ namespace triton {
 
         //! Removes the range `[baseAddr:size]` from the internal memory representation. \sa isMemoryMapped().
         virtual void unmapMemory(triton::uint64 baseAddr, triton::usize size=1) = 0;
+
+        //! Returns the number of pages allocated by the internal memory representation.
+        virtual triton::usize getNumberOfMemoryPages(void) const = 0;
+
+        //! Returns the estimated number of bytes used by the concrete state (registers and memory).
+        virtual triton::usize getMemoryUsage(void) const = 0;
+
+        //! Returns the internal memory representation.
+        virtual triton::arch::PagedMemory& getPagedMemory(void) = 0;
     };
 
   /*! @} End of arch namespace */
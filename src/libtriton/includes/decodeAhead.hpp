@@ -0,0 +1,134 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#ifndef TRITON_DECODEAHEAD_H
+#define TRITON_DECODEAHEAD_H
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "cpuInterface.hpp"
+#include "decodeCache.hpp"
+#include "tritonTypes.hpp"
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The Architecture namespace
+  namespace arch {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup arch
+   *  @{
+   */
+
+    /*! \class DecodeAhead
+     *  \brief Decodes the next basic blocks of an emulation on a helper thread.
+     *
+     * \description
+     * The emulation asks for the code at an address with a copy of the bytes which follow it, and goes on processing.
+     * The helper thread decodes these bytes with its own decoder, up to `maxBlocks` control flow instructions, while the
+     * current instructions are lifted. The decodings are only put into the decode cache by the emulation thread, when it
+     * calls drain(), so the cache is never shared. A decoding is only reused if the opcodes fetched then still match.
+     * If the decoder of the helper cannot be opened, nothing is decoded ahead.
+     */
+    class DecodeAhead {
+      public:
+        //! The number of bytes copied after an address asked for.
+        static const triton::usize window = 256;
+
+        //! The number of control flow instructions decoded after an address asked for.
+        static const triton::usize maxBlocks = 4;
+
+        //! The number of addresses waiting for the helper. The oldest one is dropped, the emulation has gone past it.
+        static const triton::usize maxPending = 8;
+
+      private:
+        //! An address asked for and the bytes which follow it.
+        struct Request {
+          //! The address.
+          triton::uint64 addr;
+
+          //! The bytes from the address.
+          std::vector<triton::uint8> bytes;
+        };
+
+        //! The CPU which decodes.
+        const triton::arch::CpuInterface* cpu;
+
+        //! Called first by the helper thread, e.g. to bind it to an API.
+        std::function<void(void)> init;
+
+        //! Guards the requests, the decodings and the stop flags.
+        std::mutex lock;
+
+        //! Wakes the helper thread up.
+        std::condition_variable wakeup;
+
+        //! The addresses waiting for the helper.
+        std::deque<Request> requests;
+
+        //! The decodings waiting for drain().
+        std::vector<std::pair<triton::uint64, triton::arch::DecodedInstruction>> decoded;
+
+        //! True if `decoded` is not empty, drain() does not lock otherwise.
+        std::atomic<bool> ready;
+
+        //! True once the helper thread must return when no address is waiting.
+        bool finishing;
+
+        //! True once the helper thread must return.
+        bool stopping;
+
+        //! The helper thread.
+        std::thread helper;
+
+        //! The loop of the helper thread.
+        void work(void);
+
+      public:
+        //! Constructor. Starts the helper thread.
+        DecodeAhead(const triton::arch::CpuInterface* cpu, const std::function<void(void)>& init);
+
+        //! Destructor. Stops the helper thread if finish() has not been called, the decodings not drained are lost.
+        ~DecodeAhead();
+
+        //! Waits for the helper thread to decode the addresses asked for, then stops it. A last drain() gets its decodings.
+        void finish(void);
+
+        //! Asks for the code at `addr`, `bytes` being the bytes from `addr`.
+        void request(triton::uint64 addr, std::vector<triton::uint8>&& bytes);
+
+        //! Puts the decodings of the helper into the cache, without flushing it. Returns the number of instructions put.
+        triton::usize drain(triton::arch::DecodeCache& cache);
+
+      private:
+        //! Disallows copies. The helper thread belongs to one instance.
+        DecodeAhead(const DecodeAhead& other);
+
+        //! Disallows copies. The helper thread belongs to one instance.
+        void operator=(const DecodeAhead& other);
+    };
+
+  /*! @} End of arch namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_DECODEAHEAD_H */
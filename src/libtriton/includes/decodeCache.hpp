@@ -0,0 +1,135 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#ifndef TRITON_DECODECACHE_H
+#define TRITON_DECODECACHE_H
+
+#include <map>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "instruction.hpp"
+#include "operandWrapper.hpp"
+#include "tritonTypes.hpp"
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The Architecture namespace
+  namespace arch {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup arch
+   *  @{
+   */
+
+    //! The version of the format of the files written by DecodeCache::save().
+    const triton::uint32 decodeCacheVersion = 1;
+
+
+    //! The decoded form of an instruction, ready to be applied on other instances of the same instruction.
+    struct DecodedInstruction {
+      //! The opcodes of the instruction (refined size).
+      std::vector<triton::uint8> opcodes;
+
+      //! The disassembly of the instruction, shared with the instructions the entry is applied on.
+      std::shared_ptr<const std::string> disassembly;
+
+      //! The type of the instruction.
+      triton::uint32 type;
+
+      //! The prefix of the instruction.
+      triton::uint32 prefix;
+
+      //! True if the instruction is a branch.
+      bool branch;
+
+      //! True if the instruction changes the control flow.
+      bool controlFlow;
+
+      //! Operand templates. Registers are resolved against the register state of the instruction when applied.
+      std::vector<triton::arch::OperandWrapper> operands;
+    };
+
+
+    //! \class DecodeCache
+    /*! \brief The decode cache class.
+     *
+     * \description
+     * Keeps the decoded form of instructions by address. An entry is only reused if the opcodes
+     * of the instruction start with the opcodes which have been decoded, so self-modifying code
+     * is decoded again. The cache is flushed once it reaches `maxEntries`.
+     */
+    class DecodeCache {
+      private:
+        //! Decoded instructions by address.
+        std::map<triton::uint64, DecodedInstruction> entries;
+
+        //! Appends an unsigned LEB128 varint to a buffer.
+        static void writeUnsigned(std::string& buffer, triton::uint64 value);
+
+        //! Reads an unsigned LEB128 varint at `offset` and moves it after the varint.
+        static triton::uint64 readUnsigned(const triton::uint8* data, triton::usize size, triton::usize& offset);
+
+      public:
+        //! Maximum number of entries.
+        static const triton::usize maxEntries = 0x10000;
+
+        //! Returns the decoded form of an instruction or nullptr if it is not cached.
+        const DecodedInstruction* find(const triton::arch::Instruction& inst) const;
+
+        //! Returns true if the instruction at an address is cached, whatever its opcodes.
+        bool contains(triton::uint64 addr) const;
+
+        //! Records the decoded form of the instruction at an address.
+        void insert(triton::uint64 addr, const DecodedInstruction& decoded);
+
+        //! Applies a decoded form on an instruction.
+        void apply(const DecodedInstruction& decoded, triton::arch::Instruction& inst) const;
+
+        //! Removes every entry.
+        void clear(void);
+
+        //! Returns the number of entries.
+        triton::usize size(void) const;
+
+        //! Returns true if the next insert() of a new address flushes the cache.
+        bool isFull(void) const;
+
+        /*!
+         * \brief Writes the entries whose address is in one of the `[begin, end)` ranges to a file. Returns the number of entries written.
+         *
+         * \description The file starts with the magic `TRDC`, the version of the format and the `key` of the code
+         * it caches, then every integer is an unsigned LEB128 varint. An entry holds the address, the opcodes, the
+         * disassembly, the type, the prefix, the branch and control flow flags and the operand templates.
+         */
+        triton::usize save(const std::string& path, triton::uint64 key, const std::vector<std::pair<triton::uint64, triton::uint64>>& ranges) const;
+
+        /*!
+         * \brief Reads the entries of a file written by save(). Returns the number of entries read.
+         *
+         * \description The file is mapped into memory. Nothing is read if the file does not exist or if it was
+         * written for another `key` or another version of the format. The cache is not flushed, the reading stops
+         * once it is full. Raises an exception if the file is truncated.
+         */
+        triton::usize load(const std::string& path, triton::uint64 key);
+    };
+
+  /*! @} End of arch namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_DECODECACHE_H */
@@ -0,0 +1,152 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#ifndef TRITON_DEPENDENCYSINK_H
+#define TRITON_DEPENDENCYSINK_H
+
+#include <condition_variable>
+#include <deque>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <thread>
+
+#include "symbolicExpression.hpp"
+#include "tritonTypes.hpp"
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The Engines namespace
+  namespace engines {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup engines
+   *  @{
+   */
+
+    //! The Symbolic Execution namespace
+    namespace symbolic {
+    /*!
+     *  \ingroup engines
+     *  \addtogroup symbolic
+     *  @{
+     */
+
+      //! The version of the binary format of the dependency graph.
+      const triton::uint32 dependencyVersion = 1;
+
+      /*! \class DependencySink
+       *  \brief The interface of the receivers of the dependency graph of the symbolic expressions.
+       *
+       * \description
+       * A sink attached to the symbolic engine receives every symbolic expression once its instruction has been
+       * processed, with the address of the instruction (0 for the expressions built outside an instruction).
+       * The edges of the graph are the ids returned by SymbolicExpression::getReferences().
+       * \sa triton::engines::symbolic::SymbolicEngine::setDependencySink()
+       */
+      class DependencySink {
+        public:
+          //! Receives a symbolic expression built at `address`.
+          virtual void write(const SymbolicExpression& expr, triton::uint64 address) = 0;
+
+          //! Makes the expressions received so far visible to the readers of the sink.
+          virtual void flush(void) = 0;
+
+          //! Destructor.
+          virtual ~DependencySink() {}
+      };
+
+
+      /*! \class DependencyFileSink
+       *  \brief Streams the dependency graph of the symbolic expressions to a file.
+       *
+       * \description
+       * Records are encoded into a buffer which is handed over to a background thread once full, so the file is
+       * written while the instructions are processed. In CSV, a record is a line `id,kind,origin,size,address,references`
+       * where `kind` is `REG`, `MEM` or `UNDEF`, `origin` the register id or the memory address, `size` the size of
+       * the memory access and `references` the ids referenced, separated by spaces. In binary, the file starts with
+       * the magic `TRDG` and the version of the format, then every integer of a record is an unsigned LEB128 varint:
+       * the id, the kind (see triton::engines::symbolic::symkind_e), the origin, the size, the address, the number
+       * of references and the sorted ids referenced.
+       */
+      class DependencyFileSink : public DependencySink {
+        private:
+          //! The output file.
+          std::ofstream file;
+
+          //! True if the records are written in CSV.
+          bool csv;
+
+          //! The buffer filled by write().
+          std::string buffer;
+
+          //! The buffers waiting for the writer.
+          std::deque<std::string> pending;
+
+          //! True while the writer writes a buffer.
+          bool writing;
+
+          //! True if the sink is being destroyed.
+          bool stopping;
+
+          //! Protects the pending buffers and the flags.
+          std::mutex mutex;
+
+          //! Wakes up the writer when a buffer is pending or when the sink is destroyed, and flush() when the writer is done.
+          std::condition_variable wakeup;
+
+          //! The background writer.
+          std::thread writer;
+
+          //! Appends an unsigned LEB128 varint to the buffer.
+          void writeUnsigned(triton::uint64 value);
+
+          //! Hands the buffer over to the writer.
+          void submit(void);
+
+          //! The loop of the writer.
+          void work(void);
+
+        public:
+          //! Size of the buffer handed over to the writer.
+          static const triton::usize bufferSize = (1 << 20);
+
+          //! Constructor. Opens (truncates) the file. Raises an exception if it cannot be opened.
+          DependencyFileSink(const std::string& path, bool csv=false);
+
+          //! Destructor. Writes the pending records and closes the file.
+          ~DependencyFileSink();
+
+          //! Encodes a symbolic expression.
+          void write(const SymbolicExpression& expr, triton::uint64 address);
+
+          //! Waits until every record is written to the file.
+          void flush(void);
+
+        private:
+          //! Disallows copies. The file is owned by the sink.
+          DependencyFileSink(const DependencyFileSink& other);
+
+          //! Disallows copies. The file is owned by the sink.
+          void operator=(const DependencyFileSink& other);
+      };
+
+    /*! @} End of symbolic namespace */
+    };
+  /*! @} End of engines namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_DEPENDENCYSINK_H */
@@ -9,6 +9,9 @@
 #define TRITON_ELF_H
 
 #include <iostream>
+#include <map>
+#include <memory>
+#include <string>
 #include <vector>
 
 #include "binaryInterface.hpp"
@@ -19,6 +22,7 @@
 #include "elfRelocationTable.hpp"
 #include "elfSectionHeader.hpp"
 #include "elfSymbolTable.hpp"
+#include "mappedFile.hpp"
 #include "memoryMapping.hpp"
 #include "tritonTypes.hpp"
 
@@ -48,17 +52,29 @@ namespace triton {
      */
 
       /*! \class Elf
-       *  \brief The ELF format class. */
+       *  \brief The ELF format class.
+       *
+       * \description
+       * The binary file is mapped into memory instead of being read, so headers and memory areas are views of the
+       * file. The symbols and relocations tables, which are the largest parts of binaries with debug symbols, are
+       * only decoded when they are accessed.
+       */
       class Elf : public BinaryInterface {
         protected:
+          //! The number of entries of a table decoded by a task, the tables are decoded in parallel by chunks of entries.
+          static const triton::usize entriesPerTask = 16384;
+
           //! Path file of the binary.
           std::string path;
 
           //! Total size of the binary file.
           triton::usize totalSize;
 
-          //! The raw binary.
-          triton::uint8* raw;
+          //! The binary file mapped into memory.
+          triton::format::MappedFile file;
+
+          //! The raw binary (the data of `file`).
+          const triton::uint8* raw;
 
           //! The ELF Header
           triton::format::elf::ElfHeader header;
@@ -72,11 +88,26 @@ namespace triton {
           //! The dynamic table.
           std::vector<triton::format::elf::ElfDynamicTable> dynamicTable;
 
-          //! The symbols table.
-          std::vector<triton::format::elf::ElfSymbolTable> symbolsTable;
+          //! The symbols table. Decoded on the first access.
+          mutable std::vector<triton::format::elf::ElfSymbolTable> symbolsTable;
+
+          //! The relocations table. Decoded on the first access.
+          mutable std::vector<triton::format::elf::ElfRelocationTable> relocationsTable;
+
+          //! True if the symbols table has been decoded.
+          mutable bool symbolsTableParsed;
+
+          //! True if the relocations table has been decoded.
+          mutable bool relocationsTableParsed;
+
+          //! The indexes of the symbols and relocations. Built on the first access.
+          mutable triton::format::SymbolIndex symbolIndex;
 
-          //! The relocations table.
-          std::vector<triton::format::elf::ElfRelocationTable> relocationsTable;
+          //! True if the indexes of the symbols and relocations have been built.
+          mutable bool symbolIndexBuilt;
+
+          //! The string tables shared by the symbols, by offset and size in the binary file. Copied once on the first access.
+          mutable std::map<std::pair<triton::uint64, triton::uint64>, std::shared_ptr<const std::string>> stringTables;
 
           //! The shared libraries dependency.
           std::vector<std::string> sharedLibraries;
@@ -103,19 +134,28 @@ namespace triton {
           void initSharedLibraries(void);
 
           //! Init the symbols table via the program headers.
-          void initSymbolsTableViaProgramHeaders(void);
+          void initSymbolsTableViaProgramHeaders(void) const;
 
           //! Init the symbols table via the section headers.
-          void initSymbolsTableViaSectionHeaders(void);
+          void initSymbolsTableViaSectionHeaders(void) const;
 
           //! Init the relocations table (DT_REL).
-          void initRelTable(void);
+          void initRelTable(void) const;
 
           //! Init the relocations table (DT_RELA).
-          void initRelaTable(void);
+          void initRelaTable(void) const;
 
           //! Init the relocations table (DT_JMPREL).
-          void initJmprelTable(void);
+          void initJmprelTable(void) const;
+
+          //! Returns true if `size` bytes from `offset` are inside the binary file.
+          bool isInside(triton::uint64 offset, triton::uint64 size) const;
+
+          //! Returns the string at an offset of the binary file. It is truncated at the end of the file.
+          std::string getString(triton::uint64 offset) const;
+
+          //! Returns the string table of `size` bytes at `offset` of the binary file. nullptr if it is not inside the file.
+          std::shared_ptr<const std::string> getStringTable(triton::uint64 offset, triton::uint64 size) const;
 
           //! Returns the offset in the file corresponding to the virtual address.
           triton::uint64 getOffsetFromAddress(triton::uint64 vaddr) const;
@@ -154,12 +194,15 @@ namespace triton {
           //! Returns Dynamic Table.
           const std::vector<triton::format::elf::ElfDynamicTable>& getDynamicTable(void) const;
 
-          //! Returns Symbols Table.
+          //! Returns Symbols Table. It is decoded on the first call.
           const std::vector<triton::format::elf::ElfSymbolTable>& getSymbolsTable(void) const;
 
-          //! Returns Relocations Table.
+          //! Returns Relocations Table. It is decoded on the first call.
           const std::vector<triton::format::elf::ElfRelocationTable>& getRelocationTable(void) const;
 
+          //! Returns the indexes of the defined symbols and of the relocations by symbol name. They are built on the first call.
+          const triton::format::SymbolIndex& getSymbolIndex(void) const;
+
           //! Returns the list of shared libraries dependency.
           const std::vector<std::string>& getSharedLibraries(void) const;
 
@@ -8,6 +8,9 @@
 #ifndef TRITON_ELFSYMBOLTABLE_H
 #define TRITON_ELFSYMBOLTABLE_H
 
+#include <memory>
+#include <string>
+
 #include "elfEnums.hpp"
 #include "tritonTypes.hpp"
 
@@ -69,10 +72,17 @@ namespace triton {
         triton::uint32 idxname;
 
         /*!
-         * \description This member specifies the name of the symbol as string based on the ElfSymbolTable::idxname.
+         * \description This member specifies the name of the symbol as string based on the ElfSymbolTable::idxname,
+         * if it has been set by setName().
          */
         std::string name;
 
+        /*!
+         * \description The string table of the symbol, shared by every symbol of the table. The name is read from it at
+         * ElfSymbolTable::idxname, so it is not copied into each symbol. nullptr if the name has been set by setName().
+         */
+        std::shared_ptr<const std::string> stringTable;
+
         /*!
          * \description This member specifies the symbol's type and binding attributes. A list of the values
          * and meanings appears below.
@@ -125,11 +135,14 @@ namespace triton {
           triton::uint32 getIdxname(void) const;
 
           //! Returns the symbol name.
-          const std::string& getName(void) const;
+          std::string getName(void) const;
 
           //! Sets the name as string of the symbol.
           void setName(const std::string& name);
 
+          //! Sets the string table the name is read from, at the symbol index name.
+          void setStringTable(const std::shared_ptr<const std::string>& table);
+
           //! Sets the name as string of the symbol.
           void setName(const triton::uint8 *str);
 
@@ -347,6 +347,30 @@ namespace triton {
     };
 
 
+    /*! \class AstParser
+     *  \brief The exception class used by the SMT-LIB2 parser. */
+    class AstParser : public triton::exceptions::Ast {
+      public:
+        //! Constructor.
+        AstParser(const char* message) : triton::exceptions::Ast(message) {};
+
+        //! Constructor.
+        AstParser(const std::string& message) : triton::exceptions::Ast(message) {};
+    };
+
+
+    /*! \class AstSerialization
+     *  \brief The exception class used by the binary serialization of ASTs. */
+    class AstSerialization : public triton::exceptions::Ast {
+      public:
+        //! Constructor.
+        AstSerialization(const char* message) : triton::exceptions::Ast(message) {};
+
+        //! Constructor.
+        AstSerialization(const std::string& message) : triton::exceptions::Ast(message) {};
+    };
+
+
     /*! \class AstTranslations
      *  \brief The exception class used by all AST translations (`z3 <-> triton`). */
     class AstTranslations : public triton::exceptions::Ast {
@@ -371,6 +395,18 @@ namespace triton {
     };
 
 
+    /*! \class AstPattern
+     *  \brief The exception class used by the AST patterns. */
+    class AstPattern : public triton::exceptions::Ast {
+      public:
+        //! Constructor.
+        AstPattern(const char* message) : triton::exceptions::Ast(message) {};
+
+        //! Constructor.
+        AstPattern(const std::string& message) : triton::exceptions::Ast(message) {};
+    };
+
+
     /*! \class Bindings
      *  \brief The exception class used by bindings. */
     class Bindings : public triton::exceptions::Exception {
@@ -430,6 +466,18 @@ namespace triton {
         Callbacks(const std::string& message) : triton::exceptions::Exception(message) {};
     };
 
+
+    /*! \class Network
+     *  \brief The exception class used by the sockets and the messages of the remote services. */
+    class Network : public triton::exceptions::Exception {
+      public:
+        //! Constructor.
+        Network(const char* message) : triton::exceptions::Exception(message) {};
+
+        //! Constructor.
+        Network(const std::string& message) : triton::exceptions::Exception(message) {};
+    };
+
   /*! @} End of exceptions namespace */
   };
 /*! @} End of exceptions namespace */
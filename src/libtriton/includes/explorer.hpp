@@ -0,0 +1,179 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#ifndef TRITON_EXPLORER_H
+#define TRITON_EXPLORER_H
+
+#include <deque>
+#include <map>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "callbacks.hpp"
+#include "tritonTypes.hpp"
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  class API;
+
+  //! The Engines namespace
+  namespace engines {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup engines
+   *  @{
+   */
+
+    //! The Exploration namespace
+    namespace exploration {
+    /*!
+     *  \ingroup engines
+     *  \addtogroup exploration
+     *  @{
+     */
+
+      //! Enumerates the search strategies of the explorer.
+      enum strategy_e {
+        DFS = 0,  //!< Explores the last state spawned first.
+        BFS,      //!< Explores the first state spawned first.
+        COVERAGE  //!< Explores first a state which reaches an address not reached yet, otherwise the first state spawned.
+      };
+
+
+      //! The concrete values of symbolic variables (symbolic variable id, value).
+      typedef std::map<triton::usize, triton::uint512> ExplorationInputs;
+
+
+      //! A state waiting to be explored.
+      struct ExplorationState {
+        //! The concrete values of the symbolic variables.
+        ExplorationInputs inputs;
+
+        //! The number of path constraints of the path which are fixed (they lead to the branch the state is spawned for).
+        triton::usize bound;
+
+        //! The branch (source, destination) the state is spawned for.
+        std::pair<triton::uint64, triton::uint64> target;
+      };
+
+
+      /*! \class Explorer
+       *  \brief Explores the paths of a code by negating its symbolic branches.
+       *
+       * \description
+       * A state is a set of concrete values given to the symbolic variables of the initial state. Every state
+       * is emulated from the snapshot of the initial state with triton::API::run(). Then, for every symbolic branch
+       * of its path beyond the branch it has been spawned for, a branch not reached yet is solved with the path
+       * predicate leading to it, and a model spawns a new state. Only the variables which exist in the initial
+       * state are given new values. The explorer runs on the live state of the API, which is restored at the end.
+       *
+       * The exploration may also be distributed: a coordinator (coordinate()) holds the worklist, the branches,
+       * the coverage and the hashes of the paths explored, and hands the states to workers (work()), processes
+       * set up with the same code and initial state, possibly on other nodes. A worker explores a state and
+       * sends back the branches its path reaches, the hash of the path and the states it spawns, which the
+       * coordinator merges, dropping the states spawned for a branch already reached or spawned by another
+       * worker. The states of a worker which disconnects are handed to another one. The messages use the
+       * framing of networkUtils.hpp.
+       */
+      class Explorer {
+        private:
+          //! The API explored.
+          triton::API* api;
+
+          //! The search strategy as triton::engines::exploration::strategy_e.
+          triton::uint32 strategy;
+
+          //! The states waiting to be explored.
+          std::deque<ExplorationState> worklist;
+
+          //! The branches (source, destination) reached or spawned.
+          std::set<std::pair<triton::uint64, triton::uint64>> branches;
+
+          //! The destinations of the branches reached.
+          std::set<triton::uint64> covered;
+
+          //! The inputs of the states explored.
+          std::vector<ExplorationInputs> explored;
+
+          //! The hashes of the paths explored.
+          std::set<triton::uint64> paths;
+
+          //! Takes the next state to explore according to the strategy.
+          ExplorationState popState(void);
+
+          //! Gives the inputs of a state to the symbolic variables and to the registers and memory cells they come from.
+          void applyInputs(const ExplorationInputs& inputs);
+
+          /*!
+           * \brief Spawns the states of the branches of the path not reached yet. `base` is the number of path constraints of the initial state.
+           *
+           * \description The branches taken by the path are appended to `reached`.
+           */
+          void spawnStates(const ExplorationState& state, triton::usize base, std::vector<std::pair<triton::uint64, triton::uint64>>& reached);
+
+          //! Explores a state from the snapshot `initial`: the spawned states are pushed to the worklist. Returns the hash of the path.
+          triton::uint64 exploreState(const ExplorationState& state, triton::usize initial, triton::uint64 entry, const std::map<triton::uint64, triton::callbacks::addressHookCallback>& hooks, triton::usize maxInsns, std::vector<std::pair<triton::uint64, triton::uint64>>& reached);
+
+        public:
+          //! Constructor. Raises an exception if the api is null or the strategy is invalid.
+          Explorer(triton::API* api, triton::uint32 strategy=DFS);
+
+          /*!
+           * \brief Explores the paths from `entry`. Returns the number of states explored.
+           *
+           * \description Every state runs with triton::API::run() using `hooks` and `maxInsns`. The exploration stops when
+           * there is no state left or once `maxStates` states are explored if `maxStates` is not 0. The API is bound to the calling thread during the exploration.
+           */
+          triton::usize explore(triton::uint64 entry, const std::map<triton::uint64, triton::callbacks::addressHookCallback>& hooks, triton::usize maxStates=0, triton::usize maxInsns=0);
+
+          /*!
+           * \brief Coordinates a distributed exploration from `entry` on `address` (see networkUtils.hpp). Returns the number of states explored.
+           *
+           * \description The coordinator does not emulate anything: it hands the states to the workers connected, merges their results and
+           * waits for workers as long as there are states to explore. The exploration stops when there is no state left and no worker is busy,
+           * or once `maxStates` states are explored if `maxStates` is not 0. The workers are then released.
+           */
+          triton::usize coordinate(const std::string& address, triton::uint64 entry, triton::usize maxStates=0);
+
+          /*!
+           * \brief Explores the states handed by the coordinator at `address` until it releases the worker. Returns the number of states explored.
+           *
+           * \description Every state runs with triton::API::run() from `entry` using `hooks` and `maxInsns`, like with explore(). The API is bound
+           * to the calling thread and its state is restored at the end.
+           */
+          triton::usize work(const std::string& address, triton::uint64 entry, const std::map<triton::uint64, triton::callbacks::addressHookCallback>& hooks, triton::usize maxInsns=0);
+
+          //! Returns the inputs of the states explored, in the order of exploration.
+          const std::vector<ExplorationInputs>& getExploredInputs(void) const;
+
+          //! Returns the branches (source, destination) reached or spawned.
+          const std::set<std::pair<triton::uint64, triton::uint64>>& getBranches(void) const;
+
+          //! Returns the destinations of the branches reached.
+          const std::set<triton::uint64>& getCoverage(void) const;
+
+          //! Returns the hashes of the paths explored, a hash summarizes the sequence of the branches taken by a path.
+          const std::set<triton::uint64>& getPaths(void) const;
+      };
+
+    /*! @} End of exploration namespace */
+    };
+  /*! @} End of engines namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_EXPLORER_H */
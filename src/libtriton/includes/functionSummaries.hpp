@@ -0,0 +1,327 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#ifndef TRITON_FUNCTIONSUMMARIES_H
+#define TRITON_FUNCTIONSUMMARIES_H
+
+#include <map>
+#include <set>
+#include <string>
+#include <tuple>
+#include <unordered_map>
+#include <vector>
+
+#include "ast.hpp"
+#include "callbacks.hpp"
+#include "instruction.hpp"
+#include "pathConstraint.hpp"
+#include "register.hpp"
+#include "symbolIndex.hpp"
+#include "symbolicExpression.hpp"
+#include "tritonTypes.hpp"
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  class API;
+
+  //! The Operating System namespace
+  namespace os {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup os
+   *  @{
+   */
+
+    //! The Unix namespace
+    namespace unix {
+    /*!
+     *  \ingroup os
+     *  \addtogroup unix
+     *  @{
+     */
+
+      //! A load of a learned path outside the frame of the function.
+      struct LearnedLoad {
+        //! The symbolic variable which replaces the loaded value.
+        triton::usize variable;
+
+        //! The size of the load in bytes.
+        triton::uint32 size;
+
+        //! The template of the address of the load.
+        triton::ast::AbstractNode* address;
+      };
+
+
+      //! A branch of a path constraint of a learned path, see triton::engines::symbolic::PathConstraint.
+      struct LearnedBranch {
+        //! True if the branch is taken.
+        bool taken;
+
+        //! The address of the branch instruction.
+        triton::uint64 srcAddr;
+
+        //! The destination of the branch.
+        triton::uint64 dstAddr;
+
+        //! The template of the constraint of the branch.
+        triton::ast::AbstractNode* constraint;
+      };
+
+
+      //! A path of a learned function: its result and its path constraints as templates over its inputs and its loads.
+      struct LearnedPath {
+        //! The symbolic variables of the arguments, then of the stack pointer.
+        std::vector<triton::usize> inputs;
+
+        //! The loads outside the frame, in their order.
+        std::vector<LearnedLoad> loads;
+
+        //! The path constraints added by the path.
+        std::vector<std::vector<LearnedBranch>> constraints;
+
+        //! The template of the return value, nullptr if the function does not write the return register.
+        triton::ast::AbstractNode* result;
+      };
+
+
+      //! A function whose summaries are learned.
+      struct LearnedFunction {
+        //! The number of arguments of the function.
+        triton::uint32 argc;
+
+        //! True if the function cannot be learned, it is executed from then on.
+        bool disabled;
+
+        //! The paths learned.
+        std::vector<LearnedPath> paths;
+      };
+
+
+      //! A call of a learned function being learned.
+      struct LearnedCall {
+        //! The address of the function, 0 if no call is being learned.
+        triton::uint64 function;
+
+        //! The return address of the call.
+        triton::uint64 returnAddress;
+
+        //! The stack pointer at the entry of the function.
+        triton::uint64 entrySp;
+
+        //! The stack pointer before the current instruction.
+        triton::uint64 sp;
+
+        //! The id of the first symbolic expression of the call.
+        triton::usize firstExprId;
+
+        //! The id of the first symbolic variable of the call.
+        triton::usize firstVarId;
+
+        //! The number of path constraints at the entry.
+        triton::usize pathConstraints;
+
+        //! The id of the symbolic expression of the return register at the entry.
+        triton::usize resultId;
+
+        //! The number of instructions executed.
+        triton::usize instructions;
+
+        //! The path being learned. The addresses of its loads are their LEAs until the call returns.
+        LearnedPath path;
+
+        //! The values replaced by the symbolic variables of the path, the inputs then the loads.
+        std::vector<triton::ast::AbstractNode*> originals;
+
+        //! The loads replaced for the current instruction: their address, their size, their original value and true if the memory had expressions.
+        std::vector<std::tuple<triton::uint64, triton::uint32, triton::ast::AbstractNode*, bool>> pending;
+
+        //! The stores into the frame.
+        std::set<std::pair<triton::uint64, triton::uint32>> frameStores;
+      };
+
+
+      /*! \class FunctionSummaries
+       *  \brief Native summaries of the hot libc routines for triton::API::run().
+       *
+       * \description
+       * A summary replaces the emulation of a routine (`memcpy`, `memmove`, `memset`, `strcmp` and `strlen`) by its effect,
+       * following the System V x86-64 calling convention, then returns to the caller. The memory copied keeps its symbolic
+       * expressions and its taint without creating any node, and the results of `strlen` and `strcmp` are compact models
+       * over the symbolic bytes they read. The models are bounded by the concrete execution: `strlen` considers the bytes up to
+       * the concrete terminator and `strcmp` the bytes up to the first concrete difference or terminator.
+       *
+       * The summaries of other functions (hashes, checksums, decoders) are learned by run(). The first call of a learned
+       * function is executed with its register arguments and its stack pointer replaced by symbolic variables, and so
+       * are the values it loads outside of its frame. When it returns, its return value (`rax`) and its path constraints,
+       * unrolled into templates over these variables, are the summary of the path taken. The next calls which follow a
+       * learned path (its path constraints hold on the concrete values) instantiate its templates with their arguments
+       * and the memory they load instead of being executed. The function must be pure: a call which writes outside of its
+       * frame, makes a syscall or reaches a hook is not learned, its variables are constrained to the values they replaced
+       * and the function is executed from then on. The other registers are clobbered as the calling convention allows.
+       */
+      class FunctionSummaries {
+        private:
+          //! The API the summaries are applied to.
+          triton::API* api;
+
+          //! The summaries attached, by address.
+          std::map<triton::uint64, triton::callbacks::addressHookCallback> hooks;
+
+          //! The address of the next stub written into the relocation of an import.
+          triton::uint64 nextStub;
+
+          //! Returns the concrete value of an argument of the call.
+          triton::uint64 getArgument(triton::uint32 index) const;
+
+          //! Sets the result of the call. `node` is its symbolic model, nullptr if it is concrete.
+          void setResult(triton::uint64 value, triton::ast::AbstractNode* node, const std::string& comment);
+
+          //! Returns to the caller.
+          void returnToCaller(void);
+
+          //! Copies `size` bytes with their symbolic references and their taint. The areas may overlap.
+          void copyMemory(triton::uint64 dst, triton::uint64 src, triton::usize size);
+
+          //! Summary of memcpy and memmove.
+          bool memcpy(void);
+
+          //! Summary of memset.
+          bool memset(void);
+
+          //! Summary of strcmp.
+          bool strcmp(void);
+
+          //! Summary of strlen.
+          bool strlen(void);
+
+          //! The functions whose summaries are learned, by address.
+          std::map<triton::uint64, LearnedFunction> learned;
+
+          //! The call being learned.
+          LearnedCall learning;
+
+          //! Summary of a learned function: instantiates a learned path or learns a new one.
+          bool learnedSummary(triton::uint64 address);
+
+          //! Starts to learn a call of a function.
+          void startLearning(triton::uint64 address, const LearnedFunction& function);
+
+          //! Ends the learning of the call which has returned.
+          void finishLearning(void);
+
+          //! Forgets the call being learned.
+          void releaseLearning(void);
+
+          //! Releases the templates of a path.
+          void releasePath(LearnedPath& path) const;
+
+          //! Returns a symbolic expression of a new symbolic variable of the call being learned, which replaces `original`.
+          triton::engines::symbolic::SymbolicExpression* newLearnedVariable(triton::ast::AbstractNode* original, const triton::uint512& value, triton::uint32 size, const std::string& comment, triton::usize& id);
+
+          //! Returns true if the memory access is in the frame of the call being learned.
+          bool isInLearnedFrame(triton::uint64 addr, triton::uint32 size) const;
+
+          //! Returns true if an AST depends on the symbolic variables of the call being learned.
+          bool isLearnedValue(triton::ast::AbstractNode* node) const;
+
+          //! Returns the template of an AST: the expressions of the call being learned are unrolled. nullptr if it depends on older ones.
+          triton::ast::AbstractNode* buildTemplate(triton::ast::AbstractNode* node, std::unordered_map<triton::ast::AbstractNode*, triton::ast::AbstractNode*>& templates) const;
+
+          //! Returns a template whose symbolic variables are substituted by `values`.
+          triton::ast::AbstractNode* instantiate(triton::ast::AbstractNode* node, const std::unordered_map<triton::usize, triton::ast::AbstractNode*>& values) const;
+
+          /*!
+           * \brief Instantiates a learned path with the values of its inputs. Returns false if the path is not followed.
+           *
+           * \description `result` is the return value (nullptr if the register is not written), `constraints` are the
+           * symbolized path constraints and `tainted` is true if an input or a load is tainted.
+           */
+          bool instantiate(const LearnedPath& path, const std::vector<triton::ast::AbstractNode*>& inputs, triton::ast::AbstractNode*& result, std::vector<triton::engines::symbolic::PathConstraint>& constraints, bool& tainted);
+
+          //! Applies an instance of a learned path, see instantiate().
+          void applyInstance(triton::ast::AbstractNode* result, const std::vector<triton::engines::symbolic::PathConstraint>& constraints, bool tainted);
+
+        public:
+          //! Maximum number of arguments of a learned function.
+          static const triton::uint32 maxLearnedArguments = 6;
+
+          //! Maximum number of paths learned by function.
+          static const triton::usize maxLearnedPaths = 16;
+
+          //! Maximum number of instructions of a call being learned.
+          static const triton::usize maxLearnedInstructions = 100000;
+
+          //! Size of the red zone under the stack pointer, which belongs to the frame.
+          static const triton::uint64 redZoneSize = 128;
+
+          //! Constructor.
+          FunctionSummaries(triton::API* api);
+
+          //! Returns the names of the routines summarized.
+          static std::vector<std::string> getNames(void);
+
+          //! Returns the summary of a routine. Raises an exception if it is not summarized.
+          triton::callbacks::addressHookCallback getSummary(const std::string& name);
+
+          //! Attaches the summary of a routine to an address.
+          void attach(triton::uint64 address, const std::string& name);
+
+          /*!
+           * \brief Attaches the summaries to the routines of a binary. Returns the number of summaries attached.
+           *
+           * \description A routine defined by the binary is summarized at its address. A routine imported through
+           * a relocation is summarized at a stub address, which is written into the slot of the relocation.
+           */
+          triton::usize attach(const triton::format::SymbolIndex& symbols);
+
+          //! Detaches the summary of an address.
+          void detach(triton::uint64 address);
+
+          //! Learns the summaries of the function at `address`, which takes `argc` register arguments.
+          void learn(triton::uint64 address, triton::uint32 argc);
+
+          //! Returns true if the summaries of the function at `address` are learned.
+          bool isLearned(triton::uint64 address) const;
+
+          //! Returns the number of paths learned of the function at `address`.
+          triton::usize getNumberOfLearnedPaths(triton::uint64 address) const;
+
+          //! Returns true if a call is being learned.
+          bool isLearning(void) const;
+
+          //! Replaces the loads outside of the frame of the call being learned by symbolic variables. Called by run() before an instruction is processed.
+          void prepareInstruction(const triton::arch::Instruction& inst);
+
+          //! Checks an instruction of the call being learned and learns the call once it returns. Called by run() after an instruction is processed.
+          void observeInstruction(const triton::arch::Instruction& inst);
+
+          //! Gives up the call being learned, its symbolic variables are constrained to the values they replaced.
+          void abortLearning(void);
+
+          //! Returns the summary attached to an address, nullptr if there is none.
+          const triton::callbacks::addressHookCallback* getHook(triton::uint64 address) const;
+
+          //! Sets the address of the next stub of an import.
+          void setStubBase(triton::uint64 address);
+      };
+
+    /*! @} End of unix namespace */
+    };
+  /*! @} End of os namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_FUNCTIONSUMMARIES_H */
@@ -0,0 +1,128 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#ifndef TRITON_HUGEPAGEARENA_H
+#define TRITON_HUGEPAGEARENA_H
+
+#include <atomic>
+#include <cstddef>
+#include <map>
+#include <new>
+#include <string>
+
+#include "tritonTypes.hpp"
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The Utils namespace
+  namespace utils {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup utils
+   *  @{
+   */
+
+    /*! \class HugePageArena
+     *  \brief The arena of the pages of the CPU memory, of the taint shadow, of the symbolic memory references and of the AST slabs.
+     *
+     * \description
+     * While the HUGE_PAGES mode is enabled, the blocks are carved out of chunks of 2 MiB aligned on 2 MiB, so a large working
+     * set needs far fewer TLB entries. A chunk is first mapped with explicit huge pages (`MAP_HUGETLB`, which needs pages
+     * reserved in `/proc/sys/vm/nr_hugepages`), otherwise with anonymous pages advised as transparent huge pages
+     * (`MADV_HUGEPAGE`), otherwise the block comes from the global heap. The arena is shared by the whole process, its
+     * blocks are recycled by size class and its chunks are never unmapped. A block released while the mode is disabled
+     * still goes back to where it comes from. While the mode is disabled, the blocks come from the global heap.
+     */
+    class HugePageArena {
+      public:
+        //! Size (and alignment) of a chunk.
+        static const triton::usize chunkSize = (1 << 21);
+
+        //! Granularity of the size classes, blocks are aligned on it.
+        static const triton::usize granularity = 64;
+
+        //! Largest block carved out of a chunk. Bigger blocks come from the global heap.
+        static const triton::usize maxBlockSize = (chunkSize / 4);
+
+      private:
+        //! True while the blocks are carved out of the chunks.
+        static std::atomic<bool> enabled;
+
+      public:
+        //! Returns true while the blocks are carved out of the chunks.
+        static bool isEnabled(void) {
+          return enabled.load(std::memory_order_relaxed);
+        }
+
+        //! Enables or disables the arena. The chunks already mapped are kept.
+        static void enable(bool flag);
+
+        //! Allocates `size` bytes. Returns nullptr if there is not enough memory.
+        static void* allocate(std::size_t size);
+
+        //! Releases a block of `size` bytes whatever its origin.
+        static void deallocate(void* ptr, std::size_t size);
+
+        //! Returns the number of chunks by backing (`explicitChunks`, `transparentChunks`), `reservedBytes` and `usedBytes`.
+        static std::map<std::string, triton::usize> getStatistics(void);
+    };
+
+
+    //! \class HugePageAllocator
+    /*! \brief An allocator of the standard containers which allocates from the triton::utils::HugePageArena. */
+    template <typename T>
+    class HugePageAllocator {
+      public:
+        //! The type of the elements.
+        typedef T value_type;
+
+        //! Constructor.
+        HugePageAllocator() {}
+
+        //! Constructor by copy of an allocator of another type.
+        template <typename U>
+        HugePageAllocator(const HugePageAllocator<U>&) {}
+
+        //! Allocates `count` elements. Raises std::bad_alloc if there is not enough memory.
+        T* allocate(std::size_t count) {
+          void* ptr = HugePageArena::allocate(count * sizeof(T));
+          if (ptr == nullptr)
+            throw std::bad_alloc();
+          return static_cast<T*>(ptr);
+        }
+
+        //! Releases `count` elements.
+        void deallocate(T* ptr, std::size_t count) {
+          HugePageArena::deallocate(ptr, count * sizeof(T));
+        }
+
+        //! All the allocators are equal, they share the arena.
+        template <typename U>
+        bool operator==(const HugePageAllocator<U>&) const {
+          return true;
+        }
+
+        //! All the allocators are equal, they share the arena.
+        template <typename U>
+        bool operator!=(const HugePageAllocator<U>&) const {
+          return false;
+        }
+    };
+
+  /*! @} End of utils namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_HUGEPAGEARENA_H */
@@ -8,15 +8,15 @@
 #ifndef TRITON_INSTRUCTION_H
 #define TRITON_INSTRUCTION_H
 
-#include <list>
-#include <map>
+#include <memory>
 #include <ostream>
-#include <sstream>
+#include <string>
 #include <utility>
 #include <vector>
 
 #include "ast.hpp"
 #include "memoryAccess.hpp"
+#include "operandHandles.hpp"
 #include "operandWrapper.hpp"
 #include "register.hpp"
 #include "symbolicExpression.hpp"
@@ -51,8 +51,8 @@ namespace triton {
         //! The address of the instruction.
         triton::uint64 address;
 
-        //! The disassembly of the instruction. This field is set at the disassembly level.
-        std::stringstream disassembly;
+        //! The disassembly of the instruction, shared with the decode cache. nullptr until it is set at the disassembly level.
+        std::shared_ptr<const std::string> disassembly;
 
         //! The opcodes of the instruction.
         triton::uint8 opcodes[32];
@@ -67,19 +67,19 @@ namespace triton {
         triton::uint32 prefix;
 
         //! Implicit and explicit load access (read). This field is set at the semantics level.
-        std::set<std::pair<triton::arch::MemoryAccess, triton::ast::AbstractNode*>> loadAccess;
+        std::vector<std::pair<triton::arch::MemoryHandle, triton::ast::AbstractNode*>> loadAccess;
 
         //! Implicit and explicit store access (write). This field is set at the semantics level.
-        std::set<std::pair<triton::arch::MemoryAccess, triton::ast::AbstractNode*>> storeAccess;
+        std::vector<std::pair<triton::arch::MemoryHandle, triton::ast::AbstractNode*>> storeAccess;
 
         //! Implicit and explicit register inputs (read). This field is set at the semantics level.
-        std::set<std::pair<triton::arch::Register, triton::ast::AbstractNode*>> readRegisters;
+        std::vector<std::pair<triton::arch::RegisterHandle, triton::ast::AbstractNode*>> readRegisters;
 
         //! Implicit and explicit register outputs (write). This field is set at the semantics level.
-        std::set<std::pair<triton::arch::Register, triton::ast::AbstractNode*>> writtenRegisters;
+        std::vector<std::pair<triton::arch::RegisterHandle, triton::ast::AbstractNode*>> writtenRegisters;
 
         //! Implicit and explicit immediate inputs (read). This field is set at the semantics level.
-        std::set<std::pair<triton::arch::Immediate, triton::ast::AbstractNode*>> readImmediates;
+        std::vector<std::pair<triton::arch::Immediate, triton::ast::AbstractNode*>> readImmediates;
 
         //! True if this instruction is a branch. This field is set at the disassembly level.
         bool branch;
@@ -93,18 +93,24 @@ namespace triton {
         //! True if this instruction is tainted. This field is set at the semantics level.
         bool tainted;
 
+        //! The position of the state of each register id into `registerState`. An entry is checked against `registerState` before being used.
+        std::vector<triton::uint32> registerStateIndex;
+
+        //! Returns the position of the state of a register into `registerState`, or its size if the register has no state.
+        triton::usize findRegisterState(triton::uint32 regId) const;
+
         //! Copies an Instruction
         void copy(const Instruction& other);
 
       public:
         //! The memory access list
-        std::list<triton::arch::MemoryAccess> memoryAccess;
+        std::vector<triton::arch::MemoryAccess> memoryAccess;
 
         //! A registers state
         /*!
-          \brief a map of <regId, regClass>
+          \brief a list of registers, at most one per register id
         */
-        std::map<triton::uint32, triton::arch::Register> registerState;
+        std::vector<triton::arch::Register> registerState;
 
         //! A list of operands
         std::vector<triton::arch::OperandWrapper> operands;
@@ -154,20 +160,32 @@ namespace triton {
         //! Returns the prefix of the instruction.
         triton::uint32 getPrefix(void) const;
 
-        //! Returns the list of all implicit and explicit load access
-        const std::set<std::pair<triton::arch::MemoryAccess, triton::ast::AbstractNode*>>& getLoadAccess(void) const;
+        //! Returns the list of all implicit and explicit load access. The accesses are built on each call, their concrete value is the one of their AST.
+        std::vector<std::pair<triton::arch::MemoryAccess, triton::ast::AbstractNode*>> getLoadAccess(void) const;
+
+        //! Returns the list of all implicit and explicit store access. The accesses are built on each call, their concrete value is the one of their AST.
+        std::vector<std::pair<triton::arch::MemoryAccess, triton::ast::AbstractNode*>> getStoreAccess(void) const;
+
+        //! Returns the list of all implicit and explicit register (flags includes) inputs (read). The registers are built on each call, their concrete value is the one of their AST.
+        std::vector<std::pair<triton::arch::Register, triton::ast::AbstractNode*>> getReadRegisters(void) const;
 
-        //! Returns the list of all implicit and explicit store access
-        const std::set<std::pair<triton::arch::MemoryAccess, triton::ast::AbstractNode*>>& getStoreAccess(void) const;
+        //! Returns the list of all implicit and explicit register (flags includes) outputs (write). The registers are built on each call, their concrete value is the one of their AST.
+        std::vector<std::pair<triton::arch::Register, triton::ast::AbstractNode*>> getWrittenRegisters(void) const;
 
-        //! Returns the list of all implicit and explicit register (flags includes) inputs (read)
-        const std::set<std::pair<triton::arch::Register, triton::ast::AbstractNode*>>& getReadRegisters(void) const;
+        //! Returns the handles of the load accesses, without building the rich objects.
+        const std::vector<std::pair<triton::arch::MemoryHandle, triton::ast::AbstractNode*>>& getLoadAccessHandles(void) const;
 
-        //! Returns the list of all implicit and explicit register (flags includes) outputs (write)
-        const std::set<std::pair<triton::arch::Register, triton::ast::AbstractNode*>>& getWrittenRegisters(void) const;
+        //! Returns the handles of the store accesses, without building the rich objects.
+        const std::vector<std::pair<triton::arch::MemoryHandle, triton::ast::AbstractNode*>>& getStoreAccessHandles(void) const;
+
+        //! Returns the handles of the read registers, without building the rich objects.
+        const std::vector<std::pair<triton::arch::RegisterHandle, triton::ast::AbstractNode*>>& getReadRegisterHandles(void) const;
+
+        //! Returns the handles of the written registers, without building the rich objects.
+        const std::vector<std::pair<triton::arch::RegisterHandle, triton::ast::AbstractNode*>>& getWrittenRegisterHandles(void) const;
 
         //! Returns the list of all implicit and explicit immediate inputs (read)
-        const std::set<std::pair<triton::arch::Immediate, triton::ast::AbstractNode*>>& getReadImmediates(void) const;
+        const std::vector<std::pair<triton::arch::Immediate, triton::ast::AbstractNode*>>& getReadImmediates(void) const;
 
         //! Returns the register state which has been recorded.
         triton::arch::Register getRegisterState(triton::uint32 regId);
@@ -220,6 +238,9 @@ namespace triton {
         //! Sets the disassembly of the instruction.
         void setDisassembly(const std::string& str);
 
+        //! Sets the disassembly of the instruction without copying it (e.g. the text of an entry of the decode cache).
+        void setDisassembly(const std::shared_ptr<const std::string>& str);
+
         //! Sets the taint of the instruction.
         void setTaint(bool state);
 
@@ -274,10 +295,10 @@ namespace triton {
         //! Sets flag to define if the condition is taken or not.
         void setConditionTaken(bool flag);
 
-        //! Resets all instruction information.
+        //! Resets all instruction information. The containers keep their capacity, so a reused instruction stops allocating once warmed up.
         void reset(void);
 
-        //! Resets partially instruction information. All except memory and register states.
+        //! Resets partially instruction information. All except memory and register states. The containers keep their capacity.
         void partialReset(void);
     };
 
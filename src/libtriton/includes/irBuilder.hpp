@@ -8,6 +8,10 @@
 #ifndef TRITON_IRBUILDER_H
 #define TRITON_IRBUILDER_H
 
+#include <map>
+#include <ostream>
+#include <string>
+
 #include "architecture.hpp"
 #include "astGarbageCollector.hpp"
 #include "instruction.hpp"
@@ -33,6 +37,25 @@ namespace triton {
    *  @{
    */
 
+    //! The profile of the semantics of an opcode. \sa triton::modes::OPCODE_PROFILING.
+    struct OpcodeProfile {
+      //! The mnemonic of the first instruction profiled.
+      std::string mnemonic;
+
+      //! Number of instructions built.
+      triton::usize calls;
+
+      //! Cycles spent building their semantics (see triton::utils::getCycles()).
+      triton::uint64 cycles;
+
+      //! Number of AST nodes allocated while building their semantics.
+      triton::usize nodes;
+
+      //! Number of symbolic expressions emitted.
+      triton::usize expressions;
+    };
+
+
     /*! \class IrBuilder
      *  \brief The IR builder. */
     class IrBuilder {
@@ -43,23 +66,59 @@ namespace triton {
         //! AST garbage collector API
         triton::ast::AstGarbageCollector* astGarbageCollector;
 
-        //! Backup AST garbage collector
-        triton::ast::AstGarbageCollector* backupAstGarbageCollector;
-
         //! Modes API
         triton::modes::Modes* modes;
 
         //! Symbolic engine API
         triton::engines::symbolic::SymbolicEngine* symbolicEngine;
 
-        //! Backup symbolic engine
-        triton::engines::symbolic::SymbolicEngine* backupSymbolicEngine;
-
         //! Taint engine API
         triton::engines::taint::TaintEngine* taintEngine;
 
-        //! Removes all symbolic expressions of an instruction.
-        void removeSymbolicExpressions(triton::arch::Instruction& inst, std::set<triton::ast::AbstractNode*>& uniqueNodes);
+        //! Number of instructions built.
+        triton::usize instructions;
+
+        //! Number of instructions built by their taint summary only.
+        triton::usize summarizedInstructions;
+
+        //! Number of repeated instructions built as a single ranged operation.
+        triton::usize summarizedLoops;
+
+        //! Number of instructions built with constant leaves, outside the symbolic regions or while nothing is symbolized.
+        triton::usize concreteInstructions;
+
+        //! Number of instructions executed natively.
+        triton::usize nativeInstructions;
+
+        //! Time spent in the semantics, in nanoseconds.
+        triton::uint64 semanticsTime;
+
+        //! Time spent in postIrInit() (collection of expressions and nodes), in nanoseconds.
+        triton::uint64 postIrTime;
+
+        //! Number of temporary nodes freed at the end of the instructions (cf. AstGarbageCollector::collectNursery()).
+        triton::usize collectedNodes;
+
+        //! The profiles of the opcodes, indexed by instruction type.
+        std::map<triton::uint32, OpcodeProfile> opcodeProfile;
+
+        //! Returns the ASTs of an instruction which are only held by raw pointers, they survive the nursery.
+        void getInstructionAsts(const triton::arch::Instruction& inst, std::vector<triton::ast::AbstractNode*>& asts) const;
+
+        //! Takes a reference to a node which must be released at the end of postIrInit().
+        void pinAstRoot(std::vector<triton::ast::AbstractNode*>& roots, triton::ast::AbstractNode* node);
+
+        //! Removes all symbolic expressions of an instruction and pins their AST.
+        void removeSymbolicExpressions(triton::arch::Instruction& inst, std::vector<triton::ast::AbstractNode*>& roots);
+
+        //! Spreads only the taint of a summarized instruction. Returns false if the instruction has no taint summary.
+        bool buildTaintSemantics(triton::arch::Instruction& inst);
+
+        //! Builds all the iterations of a repeated instruction as a single ranged operation. Returns false if the loop cannot be summarized.
+        bool buildLoopSemantics(triton::arch::Instruction& inst);
+
+        //! Executes natively an instruction whose operands are concrete. Returns false if the instruction cannot be executed natively.
+        bool buildNativeSemantics(triton::arch::Instruction& inst);
 
       protected:
         //! x86 ISA builder.
@@ -79,11 +138,26 @@ namespace triton {
         //! Builds the semantics of the instruction. Returns true if the instruction is supported.
         bool buildSemantics(triton::arch::Instruction& inst);
 
+        //! Applies at once the iterations but the last one of a counted loop whose body is `body`, its branch back included. Returns false if it is not such a loop.
+        bool buildInductionLoopSemantics(const std::vector<triton::arch::Instruction>& body);
+
         //! Everything which must be done before buiding the semantics
         void preIrInit(triton::arch::Instruction& inst);
 
         //! Everything which must be done after building the semantics.
         void postIrInit(triton::arch::Instruction& inst);
+
+        //! Returns the number of instructions built and the time spent in each stage, in nanoseconds.
+        std::map<std::string, triton::usize> getStatistics(void) const;
+
+        //! Returns the profiles of the opcodes, indexed by instruction type. \sa triton::modes::OPCODE_PROFILING.
+        const std::map<triton::uint32, OpcodeProfile>& getOpcodeProfile(void) const;
+
+        //! Clears the profiles of the opcodes.
+        void clearOpcodeProfile(void);
+
+        //! Writes the profiles of the opcodes as CSV, or as JSON if `json` is true, the most expensive ones first.
+        void dumpOpcodeProfile(std::ostream& stream, bool json=false) const;
     };
 
   /*! @} End of arch namespace */
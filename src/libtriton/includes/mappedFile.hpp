@@ -0,0 +1,83 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#ifndef TRITON_MAPPEDFILE_H
+#define TRITON_MAPPEDFILE_H
+
+#include <string>
+
+#include "tritonTypes.hpp"
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The Format namespace
+  namespace format {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup format
+   *  @{
+   */
+
+    /*! \class MappedFile
+     *  \brief A read-only view of a file mapped into memory.
+     *
+     * \description
+     * The file is mapped privately, so its pages are only read from the disk when they are touched and are
+     * shared with the page cache instead of being copied into a heap buffer.
+     */
+    class MappedFile {
+      private:
+        //! The data of the file. nullptr if the file is empty or not mapped.
+        const triton::uint8* data;
+
+        //! The size of the file.
+        triton::usize size;
+
+        #if defined(_WIN32)
+        //! The handle of the file mapping.
+        void* mapping;
+        #endif
+
+        //! Not copyable.
+        MappedFile(const MappedFile& other);
+
+        //! Not copyable.
+        void operator=(const MappedFile& other);
+
+      public:
+        //! Constructor.
+        MappedFile();
+
+        //! Destructor.
+        virtual ~MappedFile();
+
+        //! Maps a file. The previous one is unmapped.
+        void open(const std::string& path);
+
+        //! Unmaps the file.
+        void close(void);
+
+        //! Returns the data of the file.
+        const triton::uint8* getData(void) const;
+
+        //! Returns the size of the file.
+        triton::usize getSize(void) const;
+    };
+
+  /*! @} End of format namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_MAPPEDFILE_H */
@@ -0,0 +1,76 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#ifndef TRITON_MBASIMPLIFICATION_H
+#define TRITON_MBASIMPLIFICATION_H
+
+#include "ast.hpp"
+#include "tritonTypes.hpp"
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The Engines namespace
+  namespace engines {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup engines
+   *  @{
+   */
+
+    //! The Symbolic Execution namespace
+    namespace symbolic {
+    /*!
+     *  \ingroup engines
+     *  \addtogroup symbolic
+     *  @{
+     */
+
+      //! \class MbaSimplification
+      /*! \brief The simplification of linear mixed boolean-arithmetic (MBA) expressions.
+       *
+       * \description
+       * A linear MBA expression is a sum of bitwise expressions multiplied by constants, e.g.
+       * `(x ^ y) + 2 * (x & y)`. The subterms which are neither arithmetic (`bvadd`, `bvsub`, `bvneg`,
+       * `bvmul` and `bvshl` by a constant) nor bitwise are the atoms of the expression. References are
+       * followed and the extractions of the lowest bits are distributed over the operations.
+       *
+       * Such an expression is defined by its signature vector, its values when each atom is 0 or 1.
+       * The signature vector gives the coefficients of the conjunctions of atoms, from which the
+       * smallest of the linear combination of conjunctions and of a single bitwise expression
+       * (multiplied by a constant, plus a constant) is built. It replaces the expression if it is smaller.
+       */
+      class MbaSimplification {
+        public:
+          //! Maximum number of atoms of an expression. The signature vector has 2^maxAtoms values.
+          static const triton::uint32 maxAtoms = 6;
+
+          //! Maximum number of operations of an expression.
+          static const triton::usize maxOperations = 512;
+
+          //! Returns the simplified node, or the node itself if it is not a smaller linear MBA expression of at most 64 bits.
+          triton::ast::AbstractNode* simplify(triton::ast::AbstractNode* node) const;
+
+        private:
+          //! Reduces an expression of `size` bits which is not an extension. Returns nullptr if it is not reduced.
+          triton::ast::AbstractNode* reduce(triton::ast::AbstractNode* node, triton::uint32 size) const;
+      };
+
+    /*! @} End of symbolic namespace */
+    };
+  /*! @} End of engines namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_MBASIMPLIFICATION_H */
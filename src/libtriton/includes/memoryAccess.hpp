@@ -72,6 +72,9 @@ namespace triton {
         //! Copy a MemoryAccess.
         void copy(const MemoryAccess& other);
 
+        //! Move a MemoryAccess.
+        void move(MemoryAccess& other);
+
       private:
         //! LEA - Returns the segment register value.
         triton::uint64 getSegmentValue(void);
@@ -88,6 +91,9 @@ namespace triton {
         //! LEA - Returns the size of the memory access.
         triton::uint32 getAccessSize(void);
 
+        //! LEA - Returns true if the base or the index register is symbolized.
+        bool isLeaSymbolized(void);
+
       public:
         //! Constructor.
         MemoryAccess();
@@ -101,13 +107,25 @@ namespace triton {
         //! Constructor by copy.
         MemoryAccess(const MemoryAccess& other);
 
+        //! Constructor by move. The registers of the access are moved instead of copied.
+        MemoryAccess(MemoryAccess&& other);
+
         //! Destructor.
         virtual ~MemoryAccess();
 
-        //! Initialize the address of the memory.
-        void initAddress(bool force=false);
+        /*!
+         * \brief Initialize the address of the memory.
+         *
+         * \description
+         * The LEA AST (6 to 10 nodes) is only built if the base or the index register is symbolized, if `lea` is true or
+         * if the LEA_ASTS mode is enabled. Otherwise, the address is computed natively and the LEA AST is nullptr.
+         */
+        void initAddress(bool force=false, bool lea=false);
 
-        //! Returns the AST of the memory access (LEA).
+        //! Initialize the address of the memory from the concrete values of its registers, without building the LEA AST.
+        void initConcreteAddress(bool force=false);
+
+        //! Returns the AST of the memory access (LEA), nullptr if it has not been built. \sa initAddress()
         triton::ast::AbstractNode* getLeaAst(void) const;
 
         //! Returns the address of the memory.
@@ -199,6 +217,9 @@ namespace triton {
 
         //! Copies a MemoryAccess.
         void operator=(const MemoryAccess& other);
+
+        //! Moves a MemoryAccess.
+        void operator=(MemoryAccess&& other);
    };
 
     //! Displays an MemoryAccess.
@@ -43,6 +43,12 @@ namespace triton {
         //! The size of the area.
         triton::uint64 size;
 
+        //! The size of the area in memory. The bytes after `size` are zero-filled when the area is mapped.
+        triton::uint64 virtualSize;
+
+        //! True if the area holds code.
+        bool executable;
+
       public:
         //! Constructor.
         MemoryMapping(const triton::uint8* binary);
@@ -65,12 +71,18 @@ namespace triton {
         //! Returns the virtual address.
         triton::uint64 getVirtualAddress(void) const;
 
+        //! Returns the size of the area in memory.
+        triton::uint64 getVirtualSize(void) const;
+
         //! Returns the memory area into the binary file.
         const triton::uint8* getMemoryArea(void) const;
 
         //! Returns the size.
         triton::uint64 getSize(void) const;
 
+        //! Returns true if the area holds code.
+        bool isExecutable(void) const;
+
         //! Sets the offset.
         void setOffset(triton::uint64 offset);
 
@@ -79,6 +91,12 @@ namespace triton {
 
         //! Sets the size.
         void setSize(triton::uint64 size);
+
+        //! Sets the size of the area in memory.
+        void setVirtualSize(triton::uint64 virtualSize);
+
+        //! Sets whether the area holds code.
+        void setExecutable(bool flag);
     };
 
   /*! @} End of format namespace */
@@ -30,13 +30,43 @@ namespace triton {
     //! Enumerates all kinds of mode.
     enum mode_e {
       /* AST */
-      AST_DICTIONARIES,      //!< [ast mode] Abstract Syntax Tree dictionaries.
+      AST_DICTIONARIES,             //!< [ast mode] Abstract Syntax Tree dictionaries.
+      AST_REWRITING,                //!< [ast mode] Rewrite nodes with the built-in rules of the symbolic simplification when they are built.
+      CONCRETE_FOLDING,             //!< [ast mode] Collapse the bitvector nodes which are not symbolized into constants when they are built.
+      MBA_SIMPLIFICATION,           //!< [ast mode] Simplify the linear mixed boolean-arithmetic expressions before the simplification callbacks.
 
       /* Symbolic */
-      ALIGNED_MEMORY,        //!< [symbolic mode] Keep a map of aligned memory.
-      ONLY_ON_SYMBOLIZED,    //!< [symbolic mode] Perform symbolic execution only on symbolized expressions.
-      ONLY_ON_TAINTED,       //!< [symbolic mode] Perform symbolic execution only on tainted instructions.
-      PC_TRACKING_SYMBOLIC,  //!< [symbolic mode] Track path constraints only if they are symbolized.
+      ALIGNED_MEMORY,               //!< [symbolic mode] Keep a map of aligned memory.
+      CONCRETIZE_LARGE_EXPRESSIONS, //!< [symbolic mode] Concretize the destination of the expressions which exceed the expression limits. \sa triton::API::setExpressionLimits().
+      EXPRESSION_PROFILING,         //!< [symbolic mode] Profile the expressions of each instruction address (AST nodes, sizes, depths and solver time). \sa triton::engines::symbolic::SymbolicEngine::getExpressionProfile().
+      INLINE_REFERENCES,            //!< [symbolic mode] Use the AST of a small expression instead of a reference to it. \sa triton::API::setInlineReferenceSize().
+      LAZY_FLAGS,                   //!< [symbolic mode] Build the flag expressions of arithmetic instructions only when the flags are read.
+      MEMORY_ARRAY,                 //!< [symbolic mode] Record the stores into an array of bytes and build the loads with a symbolized LEA as selects on it (QF_ABV). \sa triton::engines::symbolic::SymbolicEngine::getMemoryArray().
+      ONLY_LIVE_EXPRESSIONS,        //!< [symbolic mode] Free symbolic expressions which are not reachable anymore.
+      ONLY_ON_SYMBOLIZED,           //!< [symbolic mode] Perform symbolic execution only on symbolized expressions.
+      ONLY_ON_TAINTED,              //!< [symbolic mode] Perform symbolic execution only on tainted instructions.
+      PC_DEDUPLICATION,             //!< [symbolic mode] Do not record path constraints which are already in the path predicate.
+      PC_TRACKING_SYMBOLIC,         //!< [symbolic mode] Track path constraints only if they are symbolized.
+      STATE_MERGING,                //!< [symbolic mode] Merge the two sides of the symbolic branches of run() where they join. \sa triton::API::setStateMergingLimit().
+
+      /* Taint */
+      TAINT_SUMMARIES,              //!< [taint mode] Without symbolic engine, only spread the taint of the summarized instructions. No AST is built and the concrete state is not updated.
+
+      /* IR */
+      LEA_ASTS,                     //!< [ir mode] Build the LEA AST of every memory operand, even if its base and index registers are not symbolized.
+      LOOP_SUMMARIES,               //!< [ir mode] Build the iterations of `rep movs` and `rep stos` as a single ranged operation when their counter is concrete, and apply at once the iterations of the counted loops of run().
+      NATIVE_SEMANTICS,             //!< [ir mode] Execute natively, without building any AST, the common instructions whose operands and flags read are neither symbolized nor tainted.
+      OPCODE_PROFILING,             //!< [ir mode] Profile the semantics of each opcode (calls, cycles, AST nodes and symbolic expressions). \sa triton::API::getOpcodeProfile().
+
+      /* Emulation */
+      DECODE_AHEAD,                 //!< [emulation mode] Decode the next basic blocks of run() on a helper thread while the current ones are processed. \sa triton::arch::DecodeAhead.
+
+      /* Memory */
+      HUGE_PAGES,                   //!< [memory mode] Allocate the pages of the CPU memory, of the taint shadow and of the symbolic memory references, and the AST slabs, from chunks backed by huge pages. \sa triton::utils::HugePageArena.
+
+      /* Tracing */
+      PERF_COUNTERS,                //!< [tracing mode] Sample the hardware performance counters around the disassembly, the semantics, the post IR collection and the solver queries. \sa triton::utils::PerfCounters.
+      TRACE_EVENTS,                 //!< [tracing mode] Record the spans of the pipeline, the callbacks and the solver queries in the Chrome trace-event format. \sa triton::API::dumpTraceEvents().
     };
 
 
@@ -0,0 +1,81 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#ifndef TRITON_NETWORKUTILS_H
+#define TRITON_NETWORKUTILS_H
+
+#include <string>
+#include <vector>
+
+#include "tritonTypes.hpp"
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The Utils namespace
+  namespace utils {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup utils
+   *  @{
+   */
+
+    /*
+     * The remote services (the solver daemon, the distributed exploration) share their wire format. An address
+     * is either `unix:<path>` for a Unix socket or `<host>:<port>` for TCP. Every message is a frame, a 32-bit
+     * little-endian length followed by unsigned LEB128 varints and strings (a varint length followed by the bytes).
+     * Raises triton::exceptions::Network on errors. The sockets are only available on Unix.
+     */
+
+    //! Appends an unsigned LEB128 varint to a message.
+    void writeVarint(std::string& buffer, triton::uint64 value);
+
+    //! Appends a string to a message.
+    void writeString(std::string& buffer, const std::string& value);
+
+    //! Reads an unsigned LEB128 varint at `offset` and moves `offset` after it.
+    triton::uint64 readVarint(const std::string& buffer, triton::usize& offset);
+
+    //! Reads a string at `offset` and moves `offset` after it.
+    std::string readString(const std::string& buffer, triton::usize& offset);
+
+    //! Returns a socket connected to `address`, or listening on it if `listen` is true.
+    int openSocket(const std::string& address, bool listen);
+
+    //! Accepts a client of a listening socket. Returns -1 if there is none (e.g. the socket is shut down).
+    int acceptSocket(int listener);
+
+    //! Returns the sockets which can be read (or are closed) within `timeout` milliseconds, -1 waits forever.
+    std::vector<int> waitReadable(const std::vector<int>& sockets, triton::sint32 timeout);
+
+    //! Sends a frame. Returns false if the peer has disconnected.
+    bool sendFrame(int socket, const std::string& payload);
+
+    //! Receives a frame. Returns false if the peer has disconnected.
+    bool recvFrame(int socket, std::string& payload);
+
+    //! Shuts a socket down, which wakes up the threads blocked on it.
+    void shutdownSocket(int socket);
+
+    //! Closes a socket.
+    void closeSocket(int socket);
+
+    //! Removes the file of a Unix socket address. Does nothing for TCP.
+    void unlinkSocket(const std::string& address);
+
+  /*! @} End of utils namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_NETWORKUTILS_H */
@@ -0,0 +1,115 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#ifndef TRITON_OPERANDHANDLES_H
+#define TRITON_OPERANDHANDLES_H
+
+#include "memoryAccess.hpp"
+#include "register.hpp"
+#include "tritonTypes.hpp"
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The Triton namespace
+  namespace arch {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup arch
+   *  @{
+   */
+
+    /*! \class RegisterHandle
+     *  \brief A lightweight handle on a register: its id, its parent and its bits.
+     *
+     * \description
+     * It is what the semantics record per access. Unlike triton::arch::Register, it holds no name and no
+     * concrete value, so it is copied and compared for free. The rich object is built back at the API boundary.
+     */
+    class RegisterHandle {
+      public:
+        //! The register id.
+        triton::uint32 id;
+
+        //! The parent register id.
+        triton::uint32 parent;
+
+        //! The highest bit of the register in its parent.
+        triton::uint16 high;
+
+        //! The lowest bit of the register in its parent.
+        triton::uint16 low;
+
+        //! Constructor.
+        RegisterHandle();
+
+        //! Constructor from a register.
+        RegisterHandle(const triton::arch::Register& reg);
+
+        //! Returns the size (in bits) of the register.
+        triton::uint32 getBitSize(void) const;
+
+        //! Returns true if `other` and `self` overlap.
+        bool isOverlapWith(const RegisterHandle& other) const;
+
+        //! Returns the register, without concrete value.
+        triton::arch::Register getRegister(void) const;
+    };
+
+    //! Compares two register handles by id.
+    bool operator==(const RegisterHandle& reg1, const RegisterHandle& reg2);
+
+    //! Compares two register handles by id.
+    bool operator<(const RegisterHandle& reg1, const RegisterHandle& reg2);
+
+
+    /*! \class MemoryHandle
+     *  \brief A lightweight handle on a memory access: its address and its size.
+     *
+     * \description
+     * It is what the semantics record per access. Unlike triton::arch::MemoryAccess, it holds no operand
+     * registers, no immediates and no concrete value. The rich object is built back at the API boundary.
+     */
+    class MemoryHandle {
+      public:
+        //! The address of the access.
+        triton::uint64 address;
+
+        //! The size (in bytes) of the access.
+        triton::uint32 size;
+
+        //! Constructor.
+        MemoryHandle();
+
+        //! Constructor from a memory access.
+        MemoryHandle(const triton::arch::MemoryAccess& mem);
+
+        //! Returns true if `other` and `self` overlap.
+        bool isOverlapWith(const MemoryHandle& other) const;
+
+        //! Returns the memory access, without concrete value.
+        triton::arch::MemoryAccess getMemoryAccess(void) const;
+    };
+
+    //! Compares two memory handles by address and size.
+    bool operator==(const MemoryHandle& mem1, const MemoryHandle& mem2);
+
+    //! Compares two memory handles by address and size.
+    bool operator<(const MemoryHandle& mem1, const MemoryHandle& mem2);
+
+  /*! @} End of arch namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_OPERANDHANDLES_H */
@@ -57,6 +57,12 @@ namespace triton {
         //! Register constructor.
         OperandWrapper(const triton::arch::Register& reg);
 
+        //! Memory constructor. The memory access is moved into the wrapper.
+        OperandWrapper(triton::arch::MemoryAccess&& mem);
+
+        //! Register constructor. The register is moved into the wrapper.
+        OperandWrapper(triton::arch::Register&& reg);
+
         //! Destructor.
         virtual ~OperandWrapper();
 
@@ -0,0 +1,208 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#ifndef TRITON_PAGEDMEMORY_H
+#define TRITON_PAGEDMEMORY_H
+
+#include <functional>
+#include <map>
+#include <memory>
+#include <ostream>
+#include <set>
+#include <vector>
+
+#include "mappedFile.hpp"
+#include "tritonTypes.hpp"
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The Architecture namespace
+  namespace arch {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup arch
+   *  @{
+   */
+
+    //! \class PagedMemory
+    /*! \brief The concrete memory of a CPU.
+     *
+     * \description
+     * Memory is split into 4 KiB pages allocated on demand. Every page keeps its bytes and a bitmap
+     * of mapped bytes (a byte is mapped once it has been written), and is released when none of its
+     * bytes is mapped anymore. Unmapped bytes read as zero. The last page used is cached, so
+     * consecutive accesses do a single page lookup, and areas are copied page by page. Copies of a
+     * memory share their pages, a shared page is duplicated on its first write (copy-on-write), so
+     * copying a memory costs one reference per page.
+     *
+     * The pages written by save() are aligned in the stream, so load() uses them in place from a mapped
+     * file. The file is held as a shared backing of the memory, which keeps its pages shared: they are
+     * duplicated on their first write like the pages of a copy and the mapping is never written.
+     *
+     * Areas of a mapped file (e.g. the segments of a core dump) may also be mapped lazily: a page
+     * covered by a lazy area is only allocated and filled from the file on its first access, so mapping
+     * a large dump costs one entry per area.
+     */
+    class PagedMemory {
+      public:
+        //! Number of bits of an address used to index a page.
+        static const triton::uint32 pageBits = 12;
+
+        //! Number of bytes per page.
+        static const triton::uint64 pageSize = (1 << pageBits);
+
+        //! Alignment of the pages written by save(), from the start of the stream.
+        static const triton::uint64 pageAlignment = 64;
+
+      private:
+        //! A page of memory.
+        struct Page {
+          //! The concrete bytes.
+          triton::uint8 bytes[pageSize];
+
+          //! The bitmap of mapped bytes.
+          triton::uint64 mapped[pageSize / 64];
+
+          //! Number of mapped bytes.
+          triton::uint32 count;
+        };
+
+        //! An area of a mapped file whose pages are filled on their first access.
+        struct LazyArea {
+          //! The mapped file.
+          std::shared_ptr<triton::format::MappedFile> file;
+
+          //! The bytes of the area in the mapping.
+          const triton::uint8* data;
+
+          //! The size of the area.
+          triton::uint64 size;
+        };
+
+        //! Pages indexed by their page number. A page may be shared with copies of this memory. Mutable as pages of the lazy areas are filled when they are read.
+        mutable std::map<triton::uint64, std::shared_ptr<Page>> pages;
+
+        //! The lazy areas by base address. \sa mapLazy().
+        std::map<triton::uint64, LazyArea> lazyAreas;
+
+        //! The page numbers already filled from the lazy areas. They are not filled again once they have been unmapped.
+        mutable std::set<triton::uint64> faultedPages;
+
+        //! The page numbers already given to a miss handler. \sa resolveMisses().
+        mutable std::set<triton::uint64> missedPages;
+
+        //! Page number of the cached page.
+        mutable triton::uint64 cachedNumber;
+
+        //! The cached page. nullptr if there is no page cached.
+        mutable Page* cachedPage;
+
+        //! True if the cached page is not shared and may be written.
+        mutable bool cachedWritable;
+
+        //! The mapped files holding pages of this memory. \sa load().
+        std::vector<std::shared_ptr<triton::format::MappedFile>> backings;
+
+        //! Allocates a page from the lazy areas covering it, the first time it is accessed. Returns nullptr if there is none.
+        Page* faultPage(triton::uint64 number) const;
+
+        //! Maps `length` bytes of a page from `offset`.
+        static void mapBytes(Page* page, triton::uint32 offset, triton::uint32 length);
+
+        //! Returns the page of an address or nullptr if it is not allocated.
+        const Page* findPage(triton::uint64 addr) const;
+
+        //! Returns the page of an address, not shared with another memory. Allocates it if `create` is true, otherwise returns nullptr if it is not allocated.
+        Page* findWritablePage(triton::uint64 addr, bool create);
+
+      public:
+        //! Constructor.
+        PagedMemory();
+
+        //! Constructor by copy.
+        PagedMemory(const PagedMemory& other);
+
+        //! Copies a PagedMemory.
+        void operator=(const PagedMemory& other);
+
+        //! Returns the byte at an address (0 if it is not mapped).
+        triton::uint8 read(triton::uint64 addr) const;
+
+        //! Reads `size` bytes from `baseAddr` into `area`. Unmapped bytes read as zero.
+        void read(triton::uint64 baseAddr, triton::uint8* area, triton::usize size) const;
+
+        //! Writes and maps the byte at an address.
+        void write(triton::uint64 addr, triton::uint8 value);
+
+        //! Writes and maps `size` bytes from `area` at `baseAddr`.
+        void write(triton::uint64 baseAddr, const triton::uint8* area, triton::usize size);
+
+        //! Returns true if every byte of the range is mapped.
+        bool isMapped(triton::uint64 baseAddr, triton::usize size=1) const;
+
+        //! Unmaps a range. Bytes of the range read as zero afterwards.
+        void unmap(triton::uint64 baseAddr, triton::usize size=1);
+
+        //! Unmaps every byte and drops the lazy areas.
+        void clear(void);
+
+        /*!
+         * \brief Gives every page of a range which is not allocated to `handler`, once per page. Returns the number of pages filled.
+         *
+         * \description The handler takes the address of the page and a buffer of `pageSize` bytes set to zero. If it
+         * returns true, the buffer is mapped as the page. A page given to the handler is not given again, even if it has
+         * been left unmapped.
+         */
+        triton::usize resolveMisses(triton::uint64 baseAddr, triton::usize size, const std::function<bool(triton::uint64, triton::uint8*)>& handler) const;
+
+        /*!
+         * \brief Maps `size` bytes at `offset` of a mapped file to `baseAddr`, lazily.
+         *
+         * \description The pages of the range are filled from the file on their first access, the pages already
+         * allocated are written now. Lazy areas must not overlap. Raises a triton::exceptions::Architecture if the
+         * bytes are not in the file.
+         */
+        void mapLazy(triton::uint64 baseAddr, const std::shared_ptr<triton::format::MappedFile>& file, triton::usize offset, triton::usize size);
+
+        //! Returns the number of allocated pages, shared ones included.
+        triton::usize getNumberOfPages(void) const;
+
+        //! Returns the estimated number of bytes used by the pages. Shared pages are counted by every memory holding them.
+        triton::usize getMemoryUsage(void) const;
+
+        /*!
+         * \brief Writes the pages to a stream.
+         *
+         * \description The size of a page and the number of pages are followed by the page numbers and by the
+         * raw pages, each one aligned on `pageAlignment` bytes from the start of the stream. The pages of the lazy
+         * areas which have not been accessed yet are filled first.
+         */
+        void save(std::ostream& stream) const;
+
+        /*!
+         * \brief Replaces the pages by the ones written by save() at `offset` of a mapped file. Returns the offset following them.
+         *
+         * \description The pages are not copied, they are read from the mapping until they are written. The lazy areas
+         * are dropped. Raises
+         * a triton::exceptions::Architecture if the pages are truncated or have been written by another build.
+         */
+        triton::usize load(const std::shared_ptr<triton::format::MappedFile>& file, triton::usize offset);
+    };
+
+  /*! @} End of arch namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_PAGEDMEMORY_H */
@@ -40,7 +40,13 @@ namespace triton {
      */
 
       /*! \class PathConstraint
-          \brief The path constraint class. */
+          \brief The path constraint class.
+
+          \description
+          Branches added with the AST of the program counter only record their addresses, their constraints
+          (`pc == taken address` or its negation) are built on the first access. The path constraints hold
+          a reference to their ASTs, so that they survive the temporary nodes of the instruction which added them.
+      */
       class PathConstraint {
         protected:
           /*!
@@ -48,9 +54,18 @@ namespace triton {
            * \description Vector of `<flag, source addr, dst addr, pc>`, `flag` is set to true if the branch is taken according the pc.
            * The source address is the location of the branch instruction and the destination address is the destination of the jump.
            * E.g: `"0x11223344: jne 0x55667788"`, 0x11223344 is the source address and 0x55667788 is the destination if and only if the
-           * branch is taken, otherwise the destination is the next instruction address.
+           * branch is taken, otherwise the destination is the next instruction address. The constraint is nullptr until it is built.
            */
-          std::vector<std::tuple<bool, triton::uint64, triton::uint64, triton::ast::AbstractNode*>> branches;
+          mutable std::vector<std::tuple<bool, triton::uint64, triton::uint64, triton::ast::AbstractNode*>> branches;
+
+          //! The AST of the program counter the constraints of lazy branches are built from. nullptr if there is no lazy branch.
+          triton::ast::AbstractNode* pcAst;
+
+          //! The size of the taken address in the constraints of lazy branches.
+          triton::uint32 pcSize;
+
+          //! Builds the constraints of lazy branches.
+          void buildBranchConstraints(void) const;
 
 
         public:
@@ -66,9 +81,21 @@ namespace triton {
           //! Adds a branch to the path constraint.
           void addBranchConstraint(bool taken, triton::uint64 srdAddr, triton::uint64 dstAddr, triton::ast::AbstractNode* pc);
 
+          //! Adds a branch whose constraint is built from the AST of the program counter on demand, see setPcAst().
+          void addBranchConstraint(bool taken, triton::uint64 srdAddr, triton::uint64 dstAddr);
+
+          //! Sets the AST of the program counter and the size of the taken address, used by the branches without constraint.
+          void setPcAst(triton::ast::AbstractNode* pc, triton::uint32 size);
+
           //! Returns the branch constraints.
           const std::vector<std::tuple<bool, triton::uint64, triton::uint64, triton::ast::AbstractNode*>>& getBranchConstraints(void) const;
 
+          //! Returns the AST of the program counter used by lazy branches. nullptr if there is no lazy branch.
+          triton::ast::AbstractNode* getPcAst(void) const;
+
+          //! Returns the size of the taken address in the constraints of lazy branches.
+          triton::uint32 getPcSize(void) const;
+
           //! Returns the address of the taken branch.
           triton::uint64 getTakenAddress(void) const;
 
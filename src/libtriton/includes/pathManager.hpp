@@ -8,8 +8,12 @@
 #ifndef TRITON_PATHMANAGER_H
 #define TRITON_PATHMANAGER_H
 
+#include <map>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
+#include "ast.hpp"
 #include "instruction.hpp"
 #include "modes.hpp"
 #include "pathConstraint.hpp"
@@ -42,16 +46,65 @@ namespace triton {
      */
 
       /*! \class PathManager
-          \brief The path manager class. */
+          \brief The path manager class.
+
+          \description
+          With the `PC_DEDUPLICATION` mode, a path constraint is not recorded if the same constraint (the same program
+          counter AST, references followed, and the same taken address) is already in the conjunction. If a maximum
+          number of path constraints per branch is set, the branches of an instruction are not recorded anymore once
+          it has reached this number, the later constraints of a loop are then not part of the path predicate.
+
+          The path constraints are indexed by the symbolic variables they depend on, so that the constraints which share
+          variables (transitively) with a branch are found without walking the other ones, see getPathConstraintsSlice().
+      */
       class PathManager {
         private:
           //! Modes API.
           triton::modes::Modes* modes;
 
+          //! The source address and the key (0 if not deduplicated) of every path constraint.
+          std::vector<std::pair<triton::uint64, triton::uint128>> pathConstraintKeys;
+
+          //! The keys of the deduplicated path constraints and their number of occurrences.
+          std::map<triton::uint128, triton::usize> keys;
+
+          //! The number of path constraints by source address.
+          std::map<triton::uint64, triton::usize> branchCounts;
+
+          //! The maximum number of path constraints by source address. 0 if unlimited.
+          triton::usize maxPathConstraintsPerBranch;
+
+          //! The structural hashes of the symbolic expressions by id.
+          std::map<triton::usize, triton::uint128> expressionHashes;
+
+          //! The revision of the symbolic expressions `expressionHashes` is valid for.
+          triton::usize expressionHashesRevision;
+
+          //! The symbolic variables of every path constraint.
+          std::vector<const triton::ast::VariableSet*> pathConstraintVariables;
+
+          //! The indexes (ascending) of the path constraints by symbolic variable id.
+          std::unordered_map<triton::usize, std::vector<triton::usize>> variableConstraints;
+
+          //! Returns the structural hash of an AST. References are followed.
+          triton::uint128 hashAst(triton::ast::AbstractNode* node);
+
+          //! Indexes the last path constraint by the symbolic variables of its AST.
+          void indexPathConstraint(triton::ast::AbstractNode* node);
+
+          //! Records the key of the last path constraint.
+          void recordPathConstraint(triton::uint64 srcAddr, const triton::uint128& key);
+
         protected:
           //! \brief The logical conjunction vector of path constraints.
           std::vector<triton::engines::symbolic::PathConstraint> pathConstraints;
 
+          //! The conjunction of the first `conjunctionSize` path constraints. nullptr until getPathConstraintsAst() is called.
+          mutable triton::ast::AbstractNode* conjunction;
+
+          //! The number of path constraints in `conjunction`.
+          mutable triton::usize conjunctionSize;
+
         public:
           //! Constructor.
           PathManager(triton::modes::Modes* modes);
@@ -68,18 +121,48 @@ namespace triton {
           //! Returns the logical conjunction vector of path constraints.
           const std::vector<triton::engines::symbolic::PathConstraint>& getPathConstraints(void) const;
 
-          //! Returns the logical conjunction AST of path constraints.
+          //! Returns the logical conjunction AST of path constraints. The conjunction is extended with the constraints added since the last call.
           triton::ast::AbstractNode* getPathConstraintsAst(void) const;
 
           //! Returns the number of constraints.
           triton::usize getNumberOfPathConstraints(void) const;
 
+          /*!
+           * \brief Returns the indexes (ascending) of the path constraints before `index` which share symbolic variables with it, transitively.
+           *
+           * \description
+           * These are the only constraints of the prefix needed to flip the branch of the path constraint `index`.
+           * The time is proportional to the size of the slice, not to the number of path constraints.
+           */
+          std::vector<triton::usize> getPathConstraintsSlice(triton::usize index) const;
+
+          //! Returns the logical conjunction AST of the taken branches of the slice of the path constraint `index`, see getPathConstraintsSlice().
+          triton::ast::AbstractNode* getPathConstraintsSliceAst(triton::usize index) const;
+
+          //! Returns the estimated number of bytes used by the path constraints and their keys. The ASTs are not counted.
+          triton::usize getPathManagerMemoryUsage(void) const;
+
           //! Adds a path constraint.
           void addPathConstraint(const triton::arch::Instruction& inst, triton::engines::symbolic::SymbolicExpression* expr);
 
+          //! Adds a path constraint built already (e.g. a deserialized one). It is recorded even if it is a duplicate.
+          void addPathConstraint(const triton::engines::symbolic::PathConstraint& pco);
+
           //! Clears the logical conjunction vector of path constraints.
           void clearPathConstraints(void);
 
+          //! Removes the path constraints added after the first `size` ones.
+          void truncatePathConstraints(triton::usize size);
+
+          //! Removes the first `count` path constraints, the oldest ones.
+          void dropOldestPathConstraints(triton::usize count);
+
+          //! Returns the maximum number of path constraints by source address. 0 if unlimited.
+          triton::usize getMaxPathConstraintsPerBranch(void) const;
+
+          //! Sets the maximum number of path constraints by source address. 0 if unlimited.
+          void setMaxPathConstraintsPerBranch(triton::usize limit);
+
           //! Copies a PathManager.
           void operator=(const PathManager& other);
       };
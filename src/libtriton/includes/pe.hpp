@@ -12,6 +12,7 @@
 #include <vector>
 
 #include "binaryInterface.hpp"
+#include "mappedFile.hpp"
 #include "memoryMapping.hpp"
 #include "peExportDirectory.hpp"
 #include "peHeader.hpp"
@@ -47,14 +48,20 @@ namespace triton {
        *  \brief The PE format class. */
       class Pe : public BinaryInterface {
         protected:
+          //! The number of entries of a table decoded by a task, the tables are decoded in parallel by chunks of entries.
+          static const triton::usize entriesPerTask = 4096;
+
           //! Path file of the binary.
           std::string path;
 
           //! Total size of the binary file.
           triton::usize totalSize;
 
-          //! The raw binary.
-          triton::uint8* raw;
+          //! The binary file mapped into memory.
+          triton::format::MappedFile file;
+
+          //! The raw binary (the data of `file`).
+          const triton::uint8* raw;
 
           //! The PE Header.
           triton::format::pe::PeHeader header;
@@ -71,6 +78,12 @@ namespace triton {
           //! Export table.
           PeExportDirectory exportTable;
 
+          //! The indexes of the exports and imports. Built on the first access.
+          mutable triton::format::SymbolIndex symbolIndex;
+
+          //! True if the indexes of the exports and imports have been built.
+          mutable bool symbolIndexBuilt;
+
           //! Open the binary.
           void open(void);
 
@@ -114,6 +127,9 @@ namespace triton {
           //! Returns the import table.
           const std::vector<PeImportDirectory>& getImportTable(void) const;
 
+          //! Returns the indexes of the exported symbols and of the IAT entries by imported name. They are built on the first call.
+          const triton::format::SymbolIndex& getSymbolIndex(void) const;
+
           //! Returns the names of the imported DLLS.
           const std::vector<std::string>& getSharedLibraries(void) const;
 
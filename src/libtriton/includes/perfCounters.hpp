@@ -0,0 +1,147 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#ifndef TRITON_PERFCOUNTERS_H
+#define TRITON_PERFCOUNTERS_H
+
+#include <atomic>
+#include <map>
+#include <string>
+
+#include "tritonTypes.hpp"
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The Utils namespace
+  namespace utils {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup utils
+   *  @{
+   */
+
+    //! The stages of the pipeline around which the counters are sampled.
+    enum perf_stage_e {
+      PERF_DISASSEMBLY = 0,         //!< The disassembly of the instructions.
+      PERF_SEMANTICS,               //!< The semantics of the instructions.
+      PERF_GC,                      //!< The post IR collection of the expressions and the nodes.
+      PERF_SOLVER,                  //!< The solver queries.
+      PERF_NUMBER_OF_STAGES,        //!< Must be the last item.
+    };
+
+    //! The hardware counters sampled.
+    enum perf_counter_e {
+      PERF_CYCLES = 0,              //!< CPU cycles.
+      PERF_INSTRUCTIONS,            //!< Retired instructions.
+      PERF_CACHE_MISSES,            //!< Last level cache misses.
+      PERF_BRANCH_MISSES,           //!< Mispredicted branches.
+      PERF_NUMBER_OF_COUNTERS,      //!< Must be the last item.
+    };
+
+    //! The values of the counters of a thread at a given time.
+    struct PerfSample {
+      //! The values, indexed by triton::utils::perf_counter_e.
+      triton::uint64 values[PERF_NUMBER_OF_COUNTERS];
+    };
+
+
+    /*! \class PerfCounters
+     *  \brief Accumulates the hardware performance counters of the stages of the pipeline.
+     *
+     * \description
+     * The counters are opened with `perf_event_open` (Linux only) by each thread the first time it samples them,
+     * and only count in user space. The differences between the samples taken around a stage are added to totals
+     * shared by the whole process, whichever thread samples them. The accumulator is enabled by the
+     * PERF_COUNTERS mode. While it is disabled, a stage only costs the test of a flag. A counter which cannot be
+     * opened (e.g. unsupported by the host, or denied by `perf_event_paranoid`) remains 0.
+     */
+    class PerfCounters {
+      private:
+        //! True while the stages are sampled.
+        static std::atomic<bool> enabled;
+
+      public:
+        //! Returns true while the stages are sampled.
+        static bool isEnabled(void) {
+          return enabled.load(std::memory_order_relaxed);
+        }
+
+        //! Enables or disables the sampling. Totals already accumulated are kept.
+        static void enable(bool flag);
+
+        //! Returns true if at least one counter can be opened by the calling thread.
+        static bool isSupported(void);
+
+        //! Reads the counters of the calling thread. Returns false if none of them can be opened.
+        static bool sample(PerfSample& sample);
+
+        //! Adds the counters of the calling thread since `start` to the totals of a stage.
+        static void record(perf_stage_e stage, const PerfSample& start);
+
+        //! Returns the totals as `<stage>.<counter>` and the number of samples as `<stage>.samples`.
+        static std::map<std::string, triton::usize> getStatistics(void);
+
+        //! Resets the totals.
+        static void clear(void);
+    };
+
+
+    /*! \class PerfScope
+     *  \brief Samples a stage from its construction to its destruction (or to stop()) while the counters are enabled.
+     */
+    class PerfScope {
+      private:
+        //! The stage sampled.
+        perf_stage_e stage;
+
+        //! The counters at the construction.
+        PerfSample start;
+
+        //! True until the stage is recorded. False if the counters are disabled.
+        bool active;
+
+      public:
+        //! Constructor.
+        PerfScope(perf_stage_e stage) {
+          this->stage  = stage;
+          this->active = (PerfCounters::isEnabled() && PerfCounters::sample(this->start));
+        }
+
+        //! Destructor. Records the stage if stop() has not been called.
+        ~PerfScope() {
+          this->stop();
+        }
+
+        //! Records the stage now.
+        void stop(void) {
+          if (this->active) {
+            PerfCounters::record(this->stage, this->start);
+            this->active = false;
+          }
+        }
+
+      private:
+        //! Disallows copies. A stage is recorded once.
+        PerfScope(const PerfScope& other);
+
+        //! Disallows copies. A stage is recorded once.
+        void operator=(const PerfScope& other);
+    };
+
+  /*! @} End of utils namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_PERFCOUNTERS_H */
@@ -77,6 +77,9 @@ namespace triton {
       //! ast python methods.
       extern PyMethodDef astCallbacks[];
 
+      //! Clears the python namespaces which depend on the architecture. They are filled again when they are accessed.
+      void clearArchitectureNamespaces(void);
+
       //! Initializes the ARCH python namespace.
       void initArchNamespace(PyObject* archDict);
 
@@ -95,6 +98,9 @@ namespace triton {
       //! Initializes the ELF python namespace.
       void initElfNamespace(PyObject* elfDict);
 
+      //! Initializes the EXPLORATION python namespace.
+      void initExplorationNamespace(PyObject* explorationDict);
+
       //! Initializes the PE python namespace.
       void initPENamespace(PyObject* peDict);
 
@@ -107,12 +113,18 @@ namespace triton {
       //! Initializes the OPERAND python namespace.
       void initOperandNamespace(PyObject* operandDict);
 
+      //! Initializes the PROFILE python namespace.
+      void initProfileNamespace(PyObject* profileDict);
+
       //! Initializes the REG python namespace.
       void initRegNamespace(void);
 
       //! Initializes the MODE python namespace.
       void initModeNamespace(PyObject* modeDict);
 
+      //! Initializes the SOLVER python namespace.
+      void initSolverNamespace(PyObject* solverDict);
+
       //! Initializes the SYMEXPR python namespace.
       void initSymExprNamespace(PyObject* symExprDict);
 
@@ -11,6 +11,9 @@
 #ifndef TRITON_PYOBJECT_H
 #define TRITON_PYOBJECT_H
 
+#include <functional>
+#include <vector>
+
 #include "ast.hpp"
 #include "bitsVector.hpp"
 #include "elf.hpp"
@@ -126,6 +129,15 @@ namespace triton {
       //! Creates the Instruction python class.
       PyObject* PyInstruction(const triton::uint8* opcodes, triton::uint32 opSize);
 
+      //! Creates a LazyNamespace python class named `name` over `dict`. `populate` fills `dict` when it is accessed empty.
+      PyObject* PyLazyNamespace(const char* name, PyObject* dict, void (*populate)(PyObject* dict));
+
+      //! Creates a LazySequence python class over AST nodes.
+      PyObject* PyLazySequence(const std::vector<triton::ast::AbstractNode*>& nodes);
+
+      //! Creates a LazySequence python class over symbolic expressions.
+      PyObject* PyLazySequence(const std::vector<triton::engines::symbolic::SymbolicExpression*>& exprs);
+
       //! Creates the Memory python class.
       PyObject* PyMemoryAccess(const triton::arch::MemoryAccess& mem);
 
@@ -141,6 +153,12 @@ namespace triton {
       //! Creates the Register python class.
       PyObject* PyRegister(const triton::arch::Register& reg, triton::uint512 concreteValue, bool isImmutable);
 
+      //! Returns a new reference to the immutable Register python class of `regId`, created once per architecture.
+      PyObject* PyRegisterSingleton(triton::uint32 regId);
+
+      //! Drops the immutable Register python classes. They depend on the architecture.
+      void clearRegisterSingletons(void);
+
       //! Creates the SolverModel python class.
       PyObject* PySolverModel(const triton::engines::solver::SolverModel& model);
 
@@ -349,6 +367,31 @@ namespace triton {
       //! pyInstruction type.
       extern PyTypeObject Instruction_Type;
 
+      /* LazyNamespace ================================================== */
+
+      //! pyLazyNamespace object.
+      typedef struct {
+        PyObject_HEAD
+        PyObject* name;
+        PyObject* dict;
+        void (*populate)(PyObject* dict);
+      } LazyNamespace_Object;
+
+      //! pyLazyNamespace type.
+      extern PyTypeObject LazyNamespace_Type;
+
+      /* LazySequence =================================================== */
+
+      //! pyLazySequence object.
+      typedef struct {
+        PyObject_HEAD
+        triton::usize size;
+        std::function<PyObject*(triton::usize)>* getItem;
+      } LazySequence_Object;
+
+      //! pyLazySequence type.
+      extern PyTypeObject LazySequence_Type;
+
       /* MemoryAccess =================================================== */
 
       //! pyMemory object.
@@ -531,6 +574,12 @@ namespace triton {
 /*! Returns the triton::arch::Instruction. */
 #define PyInstruction_AsInstruction(v) (((triton::bindings::python::Instruction_Object*)(v))->inst)
 
+/*! Checks if the pyObject is a LazyNamespace. */
+#define PyLazyNamespace_Check(v) ((v)->ob_type == &triton::bindings::python::LazyNamespace_Type)
+
+/*! Checks if the pyObject is a LazySequence. */
+#define PyLazySequence_Check(v) ((v)->ob_type == &triton::bindings::python::LazySequence_Type)
+
 /*! Checks if the pyObject is a triton::arch::MemoryAccess. */
 #define PyMemoryAccess_Check(v) ((v)->ob_type == &triton::bindings::python::MemoryAccess_Type)
 
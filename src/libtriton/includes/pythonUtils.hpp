@@ -83,6 +83,14 @@ namespace triton {
       //! Returns a pyObject from a triton::uint512.
       PyObject* PyLong_FromUint512(triton::uint512 value);
 
+      /*!
+       * \brief Unpacks the arguments of a METH_VARARGS call like `PyArg_ParseTuple(args, "|OOO", ...)` without parsing a format.
+       *
+       * \description The missing arguments are left to nullptr. All of them are left to nullptr if there are too many.
+       * Borrowed references.
+       */
+      void PyArgs_Unpack(PyObject* args, PyObject** op1, PyObject** op2, PyObject** op3=nullptr);
+
     /*! @} End of python namespace */
     };
   /*! @} End of bindings namespace */
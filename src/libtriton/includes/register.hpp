@@ -39,8 +39,8 @@ namespace triton {
     class Register : public BitsVector, public OperandInterface {
 
       protected:
-        //! The name of the register.
-        std::string name;
+        //! The name of the register, from the constant specification table of the architecture.
+        const char* name;
 
         //! The id of the register.
         triton::uint32 id;
@@ -60,6 +60,9 @@ namespace triton {
         //! Copies a Register.
         void copy(const Register& other);
 
+        //! Moves a Register.
+        void move(Register& other);
+
         //! Setup everything.
         void setup(triton::uint32 regId);
 
@@ -82,15 +85,24 @@ namespace triton {
         //! Constructor by copy.
         Register(const Register& other);
 
+        //! Constructor by move.
+        Register(Register&& other);
+
         //! Copies a Register.
         void operator=(const Register& other);
 
+        //! Moves a Register.
+        void operator=(Register&& other);
+
         //! Destructor.
         virtual ~Register();
 
-        //! Returns the parent id of the register.
+        //! Returns the parent register.
         Register getParent(void) const;
 
+        //! Returns the parent id of the register.
+        triton::uint32 getParentId(void) const;
+
         //! Returns true if the register is valid.
         bool isValid(void) const;
 
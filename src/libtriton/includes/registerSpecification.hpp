@@ -28,6 +28,24 @@ namespace triton {
    *  @{
    */
 
+    /*! \struct RegisterSpecificationEntry
+     *  \brief A row of a constant table of register specifications, indexed by register id.
+     */
+    struct RegisterSpecificationEntry {
+      //! The name of the register.
+      const char* name;
+
+      //! The highest bit position.
+      triton::uint32 high;
+
+      //! The lower bit position.
+      triton::uint32 low;
+
+      //! The parent id of the register.
+      triton::uint32 parentId;
+    };
+
+
     /*! \class RegisterSpecification
      *  \brief This class is used to describe the specification of a register.
      */
@@ -52,6 +70,9 @@ namespace triton {
         //! Constructor.
         RegisterSpecification(std::string& name, triton::uint32 high, triton::uint32 low, triton::uint32 parentId);
 
+        //! Constructor from a row of a specification table.
+        RegisterSpecification(const RegisterSpecificationEntry& entry);
+
         //! Constructor by copy.
         RegisterSpecification(const RegisterSpecification& other);
 
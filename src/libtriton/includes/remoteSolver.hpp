@@ -0,0 +1,180 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#ifndef TRITON_REMOTESOLVER_H
+#define TRITON_REMOTESOLVER_H
+
+#include <atomic>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "solverEnums.hpp"
+#include "solverModel.hpp"
+#include "solverWorkerPool.hpp"
+#include "tritonTypes.hpp"
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+  //! The Engines namespace
+  namespace engines {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup engines
+   *  @{
+   */
+    //! The Solver namespace
+    namespace solver {
+    /*!
+     *  \ingroup engines
+     *  \addtogroup solver
+     *  @{
+     */
+
+      //! The result of a remote query: its status and its model if it is sat.
+      typedef std::pair<triton::engines::solver::status_e, std::map<triton::uint32, SolverModel>> RemoteResult;
+
+      /*! \class RemoteSolverClient
+       *  \brief The client of a remote solver daemon (`triton-solverd`).
+       *
+       * \description
+       * The address and the framing of the messages are the ones of networkUtils.hpp. A request holds its id, its
+       * timeout, its resource limit and the SMT2 formula of the query. A response holds the id of its request, the
+       * status and the model as (name, decimal value) pairs. Requests are pipelined: several may be submitted before
+       * their responses are read, and the daemon answers them in the order they are solved.
+       */
+      class RemoteSolverClient {
+        private:
+          //! The socket connected to the daemon.
+          int socket;
+
+          //! The id of the next request.
+          triton::usize nextId;
+
+          //! Responses read but not taken yet, by request id.
+          std::map<triton::usize, RemoteResult> results;
+
+          //! Reads a response and keeps it in `results`.
+          void readResponse(void);
+
+        public:
+          //! Constructor. Connects to the daemon at `address`.
+          RemoteSolverClient(const std::string& address);
+
+          //! Destructor. Closes the connection.
+          ~RemoteSolverClient();
+
+          //! Sends a query and returns the id of its request.
+          triton::usize submit(const std::string& formula, triton::uint32 timeout, triton::uint32 resourceLimit);
+
+          //! Returns true if the response of a request has been received. Does not block.
+          bool isReady(triton::usize id);
+
+          //! Waits for the response of a request and forgets it.
+          RemoteResult wait(triton::usize id);
+      };
+
+      /*! \class RemoteSolverServer
+       *  \brief The server of `triton-solverd`, which solves the queries of remote clients.
+       *
+       * \description
+       * Every client is read by a thread of its own which submits the requests to a pool of solver threads, so the
+       * requests of a client are solved concurrently and answered as soon as they are solved. The results of the
+       * decided queries are cached by formula and the cache is shared by all the clients. See RemoteSolverClient
+       * for the protocol.
+       */
+      class RemoteSolverServer {
+        private:
+          //! A connected client, shared by its reader and the jobs answering it.
+          struct Connection {
+            //! The socket of the client.
+            int socket;
+
+            //! Serializes the responses.
+            std::mutex mutex;
+
+            //! Constructor.
+            Connection(int socket);
+
+            //! Destructor. Closes the socket.
+            ~Connection();
+          };
+
+          //! The listening socket.
+          int listener;
+
+          //! The address listened on.
+          std::string address;
+
+          //! True once stop() has been called.
+          std::atomic<bool> stopping;
+
+          //! The solver threads.
+          SolverWorkerPool pool;
+
+          //! The readers of the clients.
+          std::vector<std::thread> readers;
+
+          //! The clients, shut down when the server is stopped.
+          std::vector<std::weak_ptr<Connection>> connections;
+
+          //! Protects the connections, the cache and the statistics.
+          std::mutex mutex;
+
+          //! Results of the decided queries by formula.
+          std::map<std::string, RemoteResult> cache;
+
+          //! Maximum number of results cached.
+          triton::usize cacheSize;
+
+          //! Number of requests received.
+          triton::usize requests;
+
+          //! Number of requests answered by the cache.
+          triton::usize cacheHits;
+
+          //! Reads the requests of a client until it disconnects.
+          void serve(std::shared_ptr<Connection> connection);
+
+          //! Solves a request and sends its response.
+          void answer(std::shared_ptr<Connection> connection, triton::usize id, const std::string& formula, triton::uint32 timeout, triton::uint32 resourceLimit);
+
+        public:
+          //! Constructor. Listens on `address` (see RemoteSolverClient) with `threads` solver threads and a cache of `cacheSize` results.
+          RemoteSolverServer(const std::string& address, triton::uint32 threads, triton::usize cacheSize);
+
+          //! Destructor. Stops the server and waits for the clients.
+          ~RemoteSolverServer();
+
+          //! Accepts and serves clients until stop() is called.
+          void run(void);
+
+          //! Stops accepting clients. May be called from another thread.
+          void stop(void);
+
+          //! Returns the number of requests received and of requests answered by the cache.
+          std::map<std::string, triton::usize> getStatistics(void);
+      };
+
+    /*! @} End of solver namespace */
+    };
+  /*! @} End of engines namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_REMOTESOLVER_H */
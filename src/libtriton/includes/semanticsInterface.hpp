@@ -8,6 +8,8 @@
 #ifndef TRITON_SEMANTICSINTERFACE_HPP
 #define TRITON_SEMANTICSINTERFACE_HPP
 
+#include <vector>
+
 #include "instruction.hpp"
 
 
@@ -36,6 +38,18 @@ namespace triton {
 
         //! Builds the semantics of the instruction. Returns true if the instruction is supported.
         virtual bool buildSemantics(triton::arch::Instruction& inst) = 0;
+
+        //! Spreads only the taint of the instruction, without building its semantics. Returns false if the instruction has no taint summary.
+        virtual bool buildTaintSemantics(triton::arch::Instruction& inst) = 0;
+
+        //! Builds all the iterations of a repeated instruction as a single ranged operation. Returns false if the loop cannot be summarized.
+        virtual bool buildLoopSemantics(triton::arch::Instruction& inst) = 0;
+
+        //! Applies at once the iterations but the last one of a counted loop, its branch back included. Returns false if it is not such a loop.
+        virtual bool buildInductionLoopSemantics(const std::vector<triton::arch::Instruction>& body, triton::usize& iterations) = 0;
+
+        //! Executes natively an instruction whose operands are concrete, without building any AST. Returns false if the instruction cannot be executed natively.
+        virtual bool buildNativeSemantics(triton::arch::Instruction& inst) = 0;
     };
 
   /*! @} End of arch namespace */
@@ -0,0 +1,78 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#ifndef TRITON_SOLVERBACKEND_H
+#define TRITON_SOLVERBACKEND_H
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include "ast.hpp"
+#include "solverEnums.hpp"
+#include "solverModel.hpp"
+#include "tritonTypes.hpp"
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+  //! The Engines namespace
+  namespace engines {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup engines
+   *  @{
+   */
+    //! The Solver namespace
+    namespace solver {
+    /*!
+     *  \ingroup engines
+     *  \addtogroup solver
+     *  @{
+     */
+
+      //! \class SolverBackend
+      /*! \brief The interface of a solver backend.
+       *
+       * \description
+       * A backend translates Triton's ASTs directly to its own terms and answers single model queries. The
+       * translation only reads the ASTs, so several backends may solve the same query from different threads.
+       */
+      class SolverBackend {
+        public:
+          //! Destructor.
+          virtual ~SolverBackend() {}
+
+          //! Returns the name of the backend.
+          virtual std::string getName(void) const = 0;
+
+          /*!
+           * \brief Solves a conjunction of constraints and sets the model if it is satisfiable.
+           *
+           * \description
+           * A `timeout` (in milliseconds) or a `resourceLimit` of 0 is unlimited. A backend which has
+           * no resource limit ignores it.
+           */
+          virtual triton::engines::solver::status_e solve(const std::vector<triton::ast::AbstractNode*>& constraints, triton::uint32 timeout, triton::uint32 resourceLimit, std::map<triton::uint32, SolverModel>& model) = 0;
+
+          //! Stops the query being solved, or the next one, which returns UNKNOWN. May be called from another thread.
+          virtual void interrupt(void) = 0;
+      };
+
+    /*! @} End of solver namespace */
+    };
+  /*! @} End of engines namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_SOLVERBACKEND_H */
@@ -9,15 +9,25 @@
 #define TRITON_SOLVERENGINE_H
 
 #include <cstdlib>
+#include <future>
 #include <list>
 #include <map>
+#include <set>
 #include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
 #include <z3++.h>
 
 #include "ast.hpp"
+#include "remoteSolver.hpp"
+#include "solverBackend.hpp"
+#include "solverEnums.hpp"
 #include "solverModel.hpp"
+#include "solverWorkerPool.hpp"
 #include "symbolicEngine.hpp"
+#include "tritonToZ3Ast.hpp"
 #include "tritonTypes.hpp"
 
 
@@ -50,6 +60,162 @@ namespace triton {
           //! Symbolic Engine API
           triton::engines::symbolic::SymbolicEngine* symbolicEngine;
 
+          //! The translator of the solver session, it owns the Z3 context of the session. nullptr if there is no session.
+          triton::ast::TritonToZ3Ast* sessionTranslator;
+
+          //! The solver of the session. nullptr if there is no session.
+          z3::solver* session;
+
+          //! Constraints asserted in the session, one backtracking point per constraint.
+          std::vector<triton::ast::AbstractNode*> sessionConstraints;
+
+          //! Timeout of the queries in milliseconds. 0 if unlimited.
+          triton::uint32 timeout;
+
+          //! Resource limit (rlimit) of the queries. 0 if unlimited.
+          triton::uint32 resourceLimit;
+
+          //! Number of concrete evaluations tried by the local search before a query is sent to the solver. 0 if disabled.
+          triton::uint32 localSearchBudget;
+
+          //! The backend of the single model queries (see triton::engines::solver::solver_e).
+          triton::engines::solver::solver_e backend;
+
+          //! Number of solvers racing on a query in the PORTFOLIO mode. 0 for one per core.
+          triton::uint32 portfolioSize;
+
+          //! Status of the last query.
+          mutable triton::engines::solver::status_e status;
+
+          //! The pool solving asynchronous queries. nullptr until the first asynchronous query.
+          SolverWorkerPool* workerPool;
+
+          //! Asynchronous queries by id.
+          std::map<triton::usize, std::future<std::pair<triton::engines::solver::status_e, std::map<triton::uint32, SolverModel>>>> asyncQueries;
+
+          //! The id of the next asynchronous query.
+          triton::usize nextAsyncQuery;
+
+          //! The client of the remote solver daemon. nullptr if the queries are solved locally.
+          RemoteSolverClient* remote;
+
+          //! The address of the remote solver daemon, empty if there is none.
+          std::string remoteAddress;
+
+          //! Asynchronous queries sent to the remote solver: the id of their request by query id.
+          std::map<triton::usize, triton::usize> remoteQueries;
+
+          //! Maximum number of queries cached.
+          static const triton::usize maxQueryCacheEntries = 0x1000;
+
+          //! Results of single model queries by SMT2 assertion. An unsat query has no model.
+          mutable std::unordered_map<std::string, std::list<std::map<triton::uint32, SolverModel>>> queryCache;
+
+          //! Number of queries answered by the cache.
+          mutable triton::usize queryCacheHits;
+
+          //! Number of queries sent to the solver while the cache was used.
+          mutable triton::usize queryCacheMisses;
+
+          //! Maximum number of recent models kept by the model cache.
+          static const triton::usize maxRecentModels = 16;
+
+          //! The last models of the single model queries, the most recent first.
+          mutable std::list<std::map<triton::uint32, SolverModel>> recentModels;
+
+          //! Number of queries satisfied by a recent model.
+          mutable triton::usize modelCacheHits;
+
+          //! Number of queries proven unsat by the abstract value of their AST, without the solver.
+          mutable triton::usize decidedQueries;
+
+          //! Maximum number of unsat cores kept.
+          static const triton::usize maxUnsatCores = 0x400;
+
+          //! Ids of the constraints of the unsat cores, by SMT2 representation of their full AST.
+          mutable std::unordered_map<std::string, triton::usize> coreConstraints;
+
+          //! The unsat cores, as sorted ids of constraints.
+          mutable std::vector<std::vector<triton::usize>> unsatCores;
+
+          //! Indexes of the unsat cores which contain a constraint, by id of constraint.
+          mutable std::unordered_map<triton::usize, std::vector<triton::usize>> coresByConstraint;
+
+          //! Number of queries proven unsat by a known unsat core, without the solver.
+          mutable triton::usize prunedQueries;
+
+          //! Number of nodes narrowed before being sent to the solver (see narrowBitvectors()).
+          mutable triton::usize narrowedNodes;
+
+          //! Number of queries sent through getModel(), getModels(), getAsyncModel(), getSessionModel() and getModelsForBranches().
+          mutable triton::usize queries;
+
+          //! Number of queries by status.
+          mutable triton::usize queriesByStatus[triton::engines::solver::UNKNOWN + 1];
+
+          //! Time spent in queries, in nanoseconds.
+          mutable triton::uint64 queriesTime;
+
+          /*!
+           * \brief Solves an SMT2 assertion over the declared symbolic variables and returns up to `limit` models.
+           *
+           * \description
+           * Empty models are only returned if `keepEmpty` is true. A `timeout` of 0 uses the timeout of the engine.
+           * If the `conjuncts` of the assertion are given, a single model query tries searchModel() before the solver.
+           */
+          std::list<std::map<triton::uint32, SolverModel>> solveFormula(const std::string& assertion, triton::uint32 limit, bool keepEmpty=false, triton::uint32 timeout=0, const std::vector<triton::ast::AbstractNode*>* conjuncts=nullptr) const;
+
+          //! Looks for a model of a conjunction among the recent models, then by mutating the concrete values of its symbolic variables. Returns false if none is found within the budget.
+          bool searchModel(const std::vector<triton::ast::AbstractNode*>& conjuncts, std::map<triton::uint32, SolverModel>& model) const;
+
+          //! Records the model of a sat query as the most recent one.
+          void recordModel(const std::map<triton::uint32, SolverModel>& model) const;
+
+          //! Returns the SMT2 assertion of a full AST.
+          std::string getAssertion(triton::ast::AbstractNode* fullAst) const;
+
+          //! Returns the SMT2 formula of an assertion over the declared symbolic variables.
+          std::string getFormula(const std::string& assertion) const;
+
+          //! Sends an SMT2 assertion to the solver, see solveFormula().
+          std::list<std::map<triton::uint32, SolverModel>> checkFormula(const std::string& assertion, triton::uint32 limit, bool keepEmpty, triton::uint32 timeout) const;
+
+          //! Solves a conjunction with the backend which is not Z3, or races the backends of the portfolio. Returns a model (maybe empty) if sat.
+          std::list<std::map<triton::uint32, SolverModel>> checkWithBackend(const std::vector<triton::ast::AbstractNode*>& conjuncts, triton::uint32 timeout) const;
+
+          //! Enumerates up to `limit` models of an SMT2 assertion with up to `threads` solvers, each one working on a part of the high bits of `variable`.
+          std::list<std::map<triton::uint32, SolverModel>> enumerateInParallel(const std::string& assertion, triton::uint32 limit, const triton::engines::symbolic::SymbolicVariable& variable, triton::uint32 threads) const;
+
+          //! Replaces the symbolic variables which are not free by their concrete value in the full AST of `node` and folds the nodes which become constant.
+          triton::ast::AbstractNode* concretizeVariables(triton::ast::AbstractNode* node, const std::set<triton::usize>& freeVariables) const;
+
+          //! Narrows the operations of a full AST to the low bits which reach its root.
+          triton::ast::AbstractNode* narrowBitvectors(triton::ast::AbstractNode* fullAst) const;
+
+          //! Computes a model, see getModel().
+          std::map<triton::uint32, SolverModel> computeModel(triton::ast::AbstractNode* node, triton::uint32 timeout) const;
+
+          //! Computes several models, see getModels().
+          std::list<std::map<triton::uint32, SolverModel>> computeModels(triton::ast::AbstractNode* node, triton::uint32 limit, triton::uint32 threads) const;
+
+          //! Returns true if the abstract value of a formula proves it unsat (see triton::ast::AbstractNode::getKnownZeros()).
+          bool isDecidedUnsat(triton::ast::AbstractNode* node) const;
+
+          //! Returns true if the constraints of `keys` (see getConstraintKey()) include a known unsat core.
+          bool containsUnsatCore(const std::vector<std::string>& keys) const;
+
+          //! Records the unsat core made of the constraints of `keys`.
+          void recordUnsatCore(const std::vector<std::string>& keys) const;
+
+          //! Extracts an unsat core of an unsat conjunction with assumption literals and records it.
+          void learnUnsatCore(const std::vector<triton::ast::AbstractNode*>& conjuncts) const;
+
+          //! Counts the last query, which started at `start` (see triton::utils::getMonotonicTime()), and profiles the expressions of `node` if it is not nullptr.
+          void recordQuery(triton::uint64 start, triton::ast::AbstractNode* node=nullptr) const;
+
+          //! Pops the constraints of the session until only `depth` constraints are asserted.
+          void popSessionConstraints(triton::usize depth);
+
         public:
           //! Constructor.
           SolverEngine(triton::engines::symbolic::SymbolicEngine* symbolicEngine);
@@ -57,23 +223,163 @@ namespace triton {
           //! Destructor.
           virtual ~SolverEngine();
 
+          //! Solves an SMT2 formula on its own Z3 context and returns its status. Used by the solver threads, local or remote.
+          static triton::engines::solver::status_e solveSmt2Formula(const std::string& formula, triton::uint32 timeout, triton::uint32 resourceLimit, std::map<triton::uint32, SolverModel>& model);
+
           //! Computes and returns a model from a symbolic constraint.
           /*! \brief map of symbolic variable id -> model
            *
            * \description
+           * The conjuncts of an asserted conjunction are split into clusters which do not share symbolic variables.
+           * Each cluster is solved on its own and their models are merged. The results of identical queries (or clusters)
+           * are cached. Before a query is sent to the solver, it is evaluated under the models of the last queries, then
+           * under mutations of the concrete values of its symbolic variables, see setLocalSearchBudget(). The unsat core of
+           * an unsat conjunction is extracted and recorded, a later conjunction which includes a recorded core is unsat
+           * without the solver. A `timeout` (in milliseconds) of 0 uses the timeout of the engine.<br>
            * **item1**: symbolic variable id<br>
            * **item2**: model
            */
-          std::map<triton::uint32, SolverModel> getModel(triton::ast::AbstractNode* node) const;
+          std::map<triton::uint32, SolverModel> getModel(triton::ast::AbstractNode* node, triton::uint32 timeout=0) const;
+
+          /*!
+           * \brief Computes and returns a model of a symbolic constraint on some of its symbolic variables.
+           *
+           * \description
+           * The symbolic variables which are not in `freeVariables` are replaced by their concrete value, then the nodes
+           * which do not depend on a free variable anymore are folded into constants and an ite on a constant condition
+           * is replaced by its taken branch. The smaller query is then solved as by getModel(), so the model only
+           * contains free variables.
+           */
+          std::map<triton::uint32, SolverModel> getPartialModel(triton::ast::AbstractNode* node, const std::vector<triton::engines::symbolic::SymbolicVariable*>& freeVariables, triton::uint32 timeout=0) const;
+
+          /*!
+           * \brief Computes the lowest and the highest unsigned values of a node (64 bits at most).
+           *
+           * \description
+           * Each bound is searched by bisection between the concrete value of the node and the bound of its abstract
+           * interval (cf. triton::ast::AbstractNode::getMinimum()), one query per step. The path constraints are not
+           * asserted, so the bounds hold on every path. Returns false if a query could not be decided.
+           */
+          bool getUnsignedBounds(triton::ast::AbstractNode* node, triton::uint64& min, triton::uint64& max, triton::uint32 timeout=0) const;
 
           //! Computes and returns several models from a symbolic constraint. The `limit` is the number of models returned.
           /*! \brief list of map of symbolic variable id -> model
            *
            * \description
+           * If `threads` is greater than 1, the model space is split on the high bits of the largest symbolic variable
+           * of the constraint and each part is enumerated by its own thread and Z3 context.<br>
            * **item1**: symbolic variable id<br>
            * **item2**: model
            */
-          std::list<std::map<triton::uint32, SolverModel>> getModels(triton::ast::AbstractNode* node, triton::uint32 limit) const;
+          std::list<std::map<triton::uint32, SolverModel>> getModels(triton::ast::AbstractNode* node, triton::uint32 limit, triton::uint32 threads=1) const;
+
+          /*!
+           * \brief Submits a symbolic constraint to a background thread and returns the id of the query.
+           *
+           * \description
+           * The query owns a copy of the formula and its own Z3 context, the AST may change meanwhile.
+           * A `timeout` (in milliseconds) of 0 uses the timeout of the engine.
+           */
+          triton::usize getModelAsync(triton::ast::AbstractNode* node, triton::uint32 timeout=0);
+
+          //! Returns true if an asynchronous query is solved.
+          bool isAsyncModelReady(triton::usize id) const;
+
+          //! Waits for an asynchronous query, forgets it and returns its model. Sets the status of the last query.
+          std::map<triton::uint32, SolverModel> getAsyncModel(triton::usize id);
+
+          //! Sets the timeout of the queries in milliseconds. 0 if unlimited.
+          void setTimeout(triton::uint32 timeout);
+
+          //! Sets the maximum amount of memory used by the solver in megabytes. 0 if unlimited. This limit is global to Z3.
+          void setMemoryLimit(triton::uint32 limit);
+
+          //! Sets the resource limit (rlimit) of the queries. 0 if unlimited. Unlike a timeout, it is deterministic.
+          void setResourceLimit(triton::uint32 limit);
+
+          //! Sets the number of concrete evaluations tried by the local search before a query is sent to the solver. 0 disables the local search.
+          void setLocalSearchBudget(triton::uint32 budget);
+
+          /*!
+           * \brief Sets the backend of the single model queries (see triton::engines::solver::solver_e).
+           *
+           * \description
+           * Asserted conjunctions are translated directly to the backend. Other queries, the enumeration of
+           * several models, asynchronous queries and the solver session always use Z3. With PORTFOLIO, Z3
+           * with different tactics and seeds, and Boolector if it is built, solve each query on their own
+           * thread and the first one which decides is taken.
+           * Raises an exception if Triton has been built without the backend.
+           */
+          void setBackend(triton::engines::solver::solver_e backend);
+
+          //! Returns the backend of the single model queries.
+          triton::engines::solver::solver_e getBackend(void) const;
+
+          //! Sets the number of solvers racing on a query in the PORTFOLIO mode (at least 2). 0 for one per core.
+          void setPortfolioSize(triton::uint32 size);
+
+          /*!
+           * \brief Sends the queries to a remote solver daemon (`triton-solverd`), see RemoteSolverClient for the address.
+           *
+           * \description
+           * The single model queries which reach the solver and the asynchronous queries are sent to the daemon, the
+           * other backends, the enumeration of several models and the solver session stay local. An empty address
+           * solves the queries locally again. Raises an exception if the daemon cannot be reached.
+           */
+          void setRemoteSolver(const std::string& address);
+
+          //! Returns the address of the remote solver daemon, empty if the queries are solved locally.
+          const std::string& getRemoteSolver(void) const;
+
+          //! Returns the status of the last query. A query which returns no model is either UNSAT or UNKNOWN.
+          triton::engines::solver::status_e getLastStatus(void) const;
+
+          //! Returns the number of queries answered by the query cache.
+          triton::usize getQueryCacheHits(void) const;
+
+          //! Returns the number of queries which were not in the query cache.
+          triton::usize getQueryCacheMisses(void) const;
+
+          //! Returns the number of queries, by status, the time spent in them (in nanoseconds), the hits of the query cache, the queries decided without the solver, the unsat cores and the nodes narrowed.
+          std::map<std::string, triton::usize> getStatistics(void) const;
+
+          //! Clears the query cache, the recent models, the unsat cores and their statistics.
+          void clearQueryCache(void);
+
+          //! Starts a solver session. The Z3 context and the asserted constraints are kept between queries.
+          void startSession(void);
+
+          //! Stops the solver session.
+          void stopSession(void);
+
+          //! Returns true if a solver session is started.
+          bool isSessionStarted(void) const;
+
+          //! Forgets the AST nodes held by the solver session without dereferencing them. Used before they are freed.
+          void releaseSessionNodes(void);
+
+          /*!
+           * \brief Computes and returns a model from a symbolic constraint, under the constraints of `prefix`, inside the solver session.
+           *
+           * \description
+           * The constraints of the previous query which start `prefix` stay asserted, only the other ones are popped
+           * and the new ones pushed. Flipping the branches of a path therefore asserts each path constraint once.
+           * **item1**: symbolic variable id<br>
+           * **item2**: model
+           */
+          std::map<triton::uint32, SolverModel> getSessionModel(const std::vector<triton::ast::AbstractNode*>& prefix, triton::ast::AbstractNode* node);
+
+          /*!
+           * \brief Computes the models which flip every branch of a path.
+           *
+           * \description
+           * The model of the index `i` satisfies `pathConstraints[0..i)` and the negation of `pathConstraints[i]`, it is empty
+           * if there is none. The constraints are translated once into a single Z3 solver, each one guarded by two literals (taken
+           * and flipped), and every query is a check under the assumptions of its literals. The whole path costs one translation
+           * and one incremental check per branch. The unsat core of a branch which cannot be flipped is recorded, and the
+           * branches whose query includes a recorded core are not checked.
+           */
+          std::vector<std::map<triton::uint32, SolverModel>> getModelsForBranches(const std::vector<triton::ast::AbstractNode*>& pathConstraints) const;
       };
 
     /*! @} End of solver namespace */
@@ -0,0 +1,59 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#ifndef TRITON_SOLVERENUMS_H
+#define TRITON_SOLVERENUMS_H
+
+#include "tritonTypes.hpp"
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The Engines namespace
+  namespace engines {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup engines
+   *  @{
+   */
+
+    //! The Solver namespace
+    namespace solver {
+    /*!
+     *  \ingroup engines
+     *  \addtogroup solver
+     *  @{
+     */
+
+      //! Enumerates all status of a solver query.
+      enum status_e {
+        UNSAT = 0, //!< The constraint is unsatisfiable.
+        SAT,       //!< The constraint is satisfiable.
+        UNKNOWN    //!< The solver could not decide (e.g. a timeout or a resource limit has been reached).
+      };
+
+      //! Enumerates all solver backends.
+      enum solver_e {
+        Z3 = 0,    //!< Z3, the default backend.
+        BOOLECTOR, //!< Boolector, if Triton has been built with it.
+        PORTFOLIO  //!< Z3 and Boolector race on each query, the first answer is taken.
+      };
+
+    /*! @} End of solver namespace */
+    };
+  /*! @} End of engines namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_SOLVERENUMS_H */
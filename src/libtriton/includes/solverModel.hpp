@@ -39,18 +39,15 @@ namespace triton {
       class SolverModel
       {
         protected:
-          //! The name of the variable. Names are always something like this: SymVar_X.
-          std::string name;
-
-          //! The id of the variable.
+          //! The id of the variable. The name is built from it.
           triton::uint32 id;
 
           //! The value of the model.
           triton::uint512 value;
 
         public:
-          //! Returns the name of the variable.
-          const std::string& getName(void) const;
+          //! Returns the name of the variable. Names are always something like this: SymVar_X.
+          std::string getName(void) const;
 
           //! Returns the id of the variable.
           triton::uint32 getId(void) const;
@@ -67,6 +64,9 @@ namespace triton {
           //! Constructor.
           SolverModel(const std::string& name, triton::uint512 value);
 
+          //! Constructor from the id of the variable.
+          SolverModel(triton::uint32 id, triton::uint512 value);
+
           //! Constructor by copy.
           SolverModel(const SolverModel& other);
 
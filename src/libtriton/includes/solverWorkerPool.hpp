@@ -0,0 +1,89 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#ifndef TRITON_SOLVERWORKERPOOL_H
+#define TRITON_SOLVERWORKERPOOL_H
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "tritonTypes.hpp"
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+  //! The Engines namespace
+  namespace engines {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup engines
+   *  @{
+   */
+    //! The Solver namespace
+    namespace solver {
+    /*!
+     *  \ingroup engines
+     *  \addtogroup solver
+     *  @{
+     */
+
+      //! \class SolverWorkerPool
+      /*! \brief A pool of threads running solver jobs in the background.
+       *
+       * \description
+       * Jobs are run in their submission order. A job must not use the AST nor the engines, everything it needs
+       * (e.g. the SMT2 formula) is copied into it when submitted. Jobs which have not started are dropped when
+       * the pool is destroyed.
+       */
+      class SolverWorkerPool {
+        private:
+          //! The threads of the pool.
+          std::vector<std::thread> workers;
+
+          //! The jobs waiting for a thread.
+          std::deque<std::function<void(void)>> jobs;
+
+          //! Protects the jobs and the stopping flag.
+          std::mutex mutex;
+
+          //! Wakes up the threads when a job is submitted or when the pool is stopped.
+          std::condition_variable wakeup;
+
+          //! True if the pool is being destroyed.
+          bool stopping;
+
+          //! The loop of a thread.
+          void work(void);
+
+        public:
+          //! Constructor.
+          SolverWorkerPool(triton::uint32 threads);
+
+          //! Destructor. Waits for the running jobs.
+          ~SolverWorkerPool();
+
+          //! Submits a job.
+          void submit(const std::function<void(void)>& job);
+      };
+
+    /*! @} End of solver namespace */
+    };
+  /*! @} End of engines namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_SOLVERWORKERPOOL_H */
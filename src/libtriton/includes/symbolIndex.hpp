@@ -0,0 +1,106 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#ifndef TRITON_SYMBOLINDEX_H
+#define TRITON_SYMBOLINDEX_H
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "tritonTypes.hpp"
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The Format namespace
+  namespace format {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup format
+   *  @{
+   */
+
+    /*! \class SymbolIndex
+     *  \brief Indexes of the symbols and relocations of a binary.
+     *
+     * \description
+     * Symbols are hashed by name and sorted by address, so a name is resolved in constant time and an
+     * address in logarithmic time. Relocations are hashed by the name of their symbol and give the address
+     * patched by the loader (e.g. a GOT slot or an IAT entry). Addresses are the ones of the memory areas
+     * of the binary (see triton::format::MemoryMapping). When several symbols or relocations share a name,
+     * the first one added is kept.
+     */
+    class SymbolIndex {
+      private:
+        //! A symbol.
+        struct Symbol {
+          //! The address of the symbol.
+          triton::uint64 address;
+
+          //! The size of the symbol. 0 if unknown.
+          triton::uint64 size;
+
+          //! The name of the symbol.
+          std::string name;
+
+          //! Orders symbols by address, then by size.
+          bool operator<(const Symbol& other) const;
+        };
+
+        //! Symbols sorted by address once the index is built.
+        std::vector<Symbol> symbols;
+
+        //! Addresses of the symbols by name.
+        std::unordered_map<std::string, triton::uint64> addresses;
+
+        //! Addresses of the relocations by name of their symbol.
+        std::unordered_map<std::string, triton::uint64> relocations;
+
+      public:
+        //! Adds a symbol. Symbols without name are ignored.
+        void addSymbol(const std::string& name, triton::uint64 address, triton::uint64 size);
+
+        //! Adds a relocation. Relocations without name are ignored.
+        void addRelocation(const std::string& name, triton::uint64 address);
+
+        //! Sorts the symbols by address. Must be called once every symbol has been added.
+        void build(void);
+
+        //! Returns true if a symbol is defined.
+        bool isSymbolDefined(const std::string& name) const;
+
+        //! Returns the address of a symbol. Raises an exception if the symbol is not defined.
+        triton::uint64 getSymbolAddress(const std::string& name) const;
+
+        /*!
+         * \brief Returns the name of the symbol containing an address.
+         *
+         * \description An address is contained by a symbol if it is in `[address:address+size)`, or
+         * if it is the address of a symbol without size. Returns an empty string if there is none.
+         */
+        std::string getSymbolName(triton::uint64 address) const;
+
+        //! Returns true if a relocation is defined for a symbol.
+        bool isRelocationDefined(const std::string& name) const;
+
+        //! Returns the address patched by the relocation of a symbol. Raises an exception if there is none.
+        triton::uint64 getRelocationAddress(const std::string& name) const;
+    };
+
+  /*! @} End of format namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_SYMBOLINDEX_H */
@@ -8,20 +8,32 @@
 #ifndef TRITON_SYMBOLICENGINE_H
 #define TRITON_SYMBOLICENGINE_H
 
+#include <deque>
+#include <functional>
+#include <istream>
 #include <list>
 #include <map>
+#include <ostream>
+#include <set>
 #include <string>
+#include <tuple>
+#include <unordered_map>
+#include <vector>
 
+#include "alignedMemoryMap.hpp"
 #include "architecture.hpp"
 #include "ast.hpp"
 #include "callbacks.hpp"
+#include "dependencySink.hpp"
 #include "memoryAccess.hpp"
 #include "modes.hpp"
 #include "pathManager.hpp"
 #include "register.hpp"
 #include "symbolicEnums.hpp"
 #include "symbolicExpression.hpp"
+#include "symbolicMemoryMap.hpp"
 #include "symbolicSimplification.hpp"
+#include "symbolicTable.hpp"
 #include "symbolicVariable.hpp"
 #include "tritonTypes.hpp"
 
@@ -50,6 +62,41 @@ namespace triton {
      *  @{
      */
 
+      //! The profile of the expressions built at an instruction address (EXPRESSION_PROFILING mode).
+      struct ExpressionProfile {
+        //! Number of instructions built.
+        triton::usize instructions;
+
+        //! Number of AST nodes allocated while building their semantics.
+        triton::usize nodes;
+
+        //! Number of symbolic expressions emitted.
+        triton::usize expressions;
+
+        //! Maximum unrolled size of an expression emitted (cf. triton::ast::AbstractNode::getUnrolledSize()).
+        triton::uint64 maxSize;
+
+        //! Maximum depth of an expression emitted.
+        triton::uint32 maxDepth;
+
+        //! Number of solver queries which reference an expression emitted.
+        triton::usize queries;
+
+        //! Time spent in these queries, in nanoseconds.
+        triton::uint64 solverTime;
+      };
+
+
+      //! The policy of the memory accesses whose address is symbolized, at an instruction address.
+      struct PointerPolicy {
+        //! The policy.
+        triton::engines::symbolic::pointer_policy_e kind;
+
+        //! The number of bytes accessed on each side of the concrete address, at most (POINTER_RANGE and POINTER_SOLVER).
+        triton::uint32 range;
+      };
+
+
       //! \class SymbolicEngine
       /*! \brief The symbolic engine class. */
       class SymbolicEngine
@@ -69,37 +116,26 @@ namespace triton {
           //! Symbolic variables id.
           triton::usize uniqueSymVarId;
 
-          /*! \brief The map of symbolic variables
-           *
-           * \description
-           * **item1**: variable id<br>
-           * **item2**: symbolic variable
-           */
-          std::map<triton::usize, SymbolicVariable*> symbolicVariables;
+          //! The table of symbolic variables indexed by variable id.
+          triton::engines::symbolic::SymbolicTable<SymbolicVariable> symbolicVariables;
 
-          /*! \brief The map of symbolic expressions
-           *
-           * \description
-           * **item1**: symbolic reference id<br>
-           * **item2**: symbolic expression
-           */
-          std::map<triton::usize, SymbolicExpression*> symbolicExpressions;
+          //! The table of symbolic expressions indexed by symbolic reference id.
+          triton::engines::symbolic::SymbolicTable<SymbolicExpression> symbolicExpressions;
 
-          /*! \brief map of address -> symbolic expression
-           *
-           * \description
-           * **item1**: memory address<br>
-           * **item2**: symbolic reference id
-           */
-          std::map<triton::uint64, triton::usize> memoryReference;
+          //! The ids of the tainted symbolic expressions in ascending order, indexed up to `taintedIndexId`.
+          mutable std::vector<triton::usize> taintedExpressions;
 
-          /*! \brief map of <address:size> -> symbolic expression.
-           *
-           * \description
-           * **item1**: <addr:size><br>
-           * **item2**: symbolic reference id
-           */
-          std::map<std::pair<triton::uint64, triton::uint32>, triton::ast::AbstractNode*> alignedMemoryReference;
+          //! The symbolic expressions below this id are indexed by `taintedExpressions`.
+          mutable triton::usize taintedIndexId;
+
+          //! The paged map of address -> symbolic reference id.
+          triton::engines::symbolic::SymbolicMemoryMap memoryReference;
+
+          //! The hashed map of <address:size> -> AST of the memory access (ALIGNED_MEMORY mode).
+          triton::engines::symbolic::AlignedMemoryMap alignedMemoryReference;
+
+          //! The aligned entries of the cleared generations, the oldest first. Their nodes are released lazily. \sa concretizeAllMemory()
+          std::list<triton::engines::symbolic::AlignedMemoryMap> retiredAlignedMemory;
 
         private:
           //! Architecture API
@@ -111,14 +147,206 @@ namespace triton {
           //! Modes API.
           triton::modes::Modes* modes;
 
-          //! Defines if this instance is used as a backup.
-          bool backupFlag;
+          //! Defines if changes are recorded into the journal.
+          bool journalFlag;
+
+          //! The state of the symbolic engine when a journal has been started. \sa startJournal().
+          struct JournalMark {
+            //! The symbolic expression id.
+            triton::usize symExprId;
+
+            //! The symbolic variable id.
+            triton::usize symVarId;
+
+            //! The number of path constraints.
+            triton::usize pathConstraints;
+
+            //! The memory array id.
+            triton::usize memoryArrayId;
+
+            //! The number of entries of `journalRegisters`.
+            triton::usize registers;
+
+            //! The number of entries of `journalMemory`.
+            triton::usize memory;
+
+            //! The number of entries of `journalAlignedMemory`.
+            triton::usize alignedMemory;
+          };
+
+          //! The journals started, the innermost last.
+          std::vector<JournalMark> journalMarks;
+
+          //! Previous references of modified registers (register id, symbolic reference id).
+          std::vector<std::pair<triton::uint32, triton::usize>> journalRegisters;
+
+          //! Previous references of modified memory cells (address, symbolic reference id or UNSET, offset of the byte in the expression).
+          std::vector<std::tuple<triton::uint64, triton::usize, triton::uint32>> journalMemory;
+
+          //! Previous aligned memory entries (<addr:size>, node or nullptr).
+          std::vector<std::pair<std::pair<triton::uint64, triton::uint32>, triton::ast::AbstractNode*>> journalAlignedMemory;
+
+          //! A flag expression which is built only when the flag is read (LAZY_FLAGS mode).
+          struct LazyFlag {
+            //! Builds the AST of the flag.
+            std::function<triton::ast::AbstractNode*(void)> builder;
+
+            //! Nodes used by the builder. They are held until the flag is built or dropped.
+            std::vector<triton::ast::AbstractNode*> nodes;
+
+            //! The symbolic expression id of the result the flag is computed from.
+            triton::usize parent;
+
+            //! True if the flag is tainted.
+            bool isTainted;
+
+            //! The comment of the flag expression.
+            std::string comment;
+          };
+
+          //! Deferred flag expressions indexed by flag id.
+          std::map<triton::uint32, LazyFlag> lazyFlags;
+
+          //! Minimum number of symbolic expressions from which unreachable expressions are collected.
+          static const triton::usize minCollectThreshold = 0x10000;
+
+          //! Symbolic expressions kept alive by the user.
+          std::set<triton::usize> pinnedExpressions;
+
+          //! Number of symbolic expressions from which unreachable expressions are collected (ONLY_LIVE_EXPRESSIONS mode).
+          triton::usize collectThreshold;
+
+          //! Maximum number of AST nodes before the oldest symbolic references are concretized. 0 if unlimited.
+          triton::usize nodeBudget;
+
+          //! Number of AST nodes from which the oldest symbolic references are concretized. \sa setNodeBudget().
+          triton::usize nodeBudgetThreshold;
+
+          //! The references assigned between two instructions of the window. \sa setInstructionWindow().
+          struct WindowSlot {
+            //! The number of path constraints when the slot has been opened.
+            triton::usize pathConstraints;
+
+            //! The registers assigned (parent id, symbolic reference id).
+            std::vector<std::pair<triton::uint32, triton::usize>> registers;
+
+            //! The memory cells assigned (address, symbolic reference id).
+            std::vector<std::pair<triton::uint64, triton::usize>> memory;
+          };
 
-          //! Slices all expressions from a given node.
-          void sliceExpressions(triton::ast::AbstractNode* node, std::map<triton::usize, SymbolicExpression*>& exprs);
+          //! Maximum number of instructions whose references are kept symbolic. 0 if unlimited. \sa setInstructionWindow().
+          triton::usize instructionWindow;
+
+          //! The receiver of the dependency graph, not owned. nullptr if the graph is not streamed. \sa setDependencySink().
+          DependencySink* dependencySink;
+
+          //! The ids of the expressions built since the last call to writeDependencies().
+          std::vector<triton::usize> dependencyPending;
+
+          //! The slots of the last instructions, the oldest first. The last one is open.
+          std::deque<WindowSlot> windowSlots;
+
+          //! The number of slides since the last collection of the window.
+          triton::usize windowSlides;
+
+          //! The generation of the memory array at the last collection of the window. UNSET if no store had been recorded on it.
+          triton::usize windowArrayGeneration;
+
+          //! The profiles of the expressions by instruction address (EXPRESSION_PROFILING mode). They cover the whole run and are not copied with the state.
+          std::map<triton::uint64, ExpressionProfile> expressionProfile;
+
+          //! The instruction address of the profiled expressions, by symbolic expression id.
+          std::unordered_map<triton::usize, triton::uint64> expressionAddresses;
+
+          //! The pointer policies by instruction address. \sa setPointerPolicy().
+          std::map<triton::uint64, PointerPolicy> pointerPolicies;
+
+          //! The pointer policy of the instructions without their own.
+          PointerPolicy defaultPointerPolicy;
+
+          //! The bounds of the address expressions given by the solver, by hash of the address expression (POINTER_SOLVER).
+          std::map<triton::uint512, std::pair<triton::uint64, triton::uint64>> pointerBounds;
+
+          //! Computes the unsigned bounds of an address expression, false if they are unknown. \sa setPointerBoundsSolver().
+          std::function<bool(triton::ast::AbstractNode*, triton::uint64&, triton::uint64&)> pointerBoundsSolver;
+
+          //! Returns the window of addresses an access at an instruction may target. Returns false if only its concrete address is accessed.
+          bool getPointerWindow(const triton::arch::Instruction& inst, const triton::arch::MemoryAccess& mem, triton::uint64& low, triton::uint64& high);
+
+          //! Concretizes the references of a slot which still point to the expressions assigned in it. Returns the number of references concretized.
+          triton::usize expireWindowSlot(const WindowSlot& slot);
+
+          //! Maximum depth of a new symbolic expression. 0 if unlimited. \sa setExpressionLimits().
+          triton::uint32 maxExpressionDepth;
+
+          //! Maximum unrolled size of a new symbolic expression. 0 if unlimited. \sa setExpressionLimits().
+          triton::uint64 maxExpressionSize;
+
+          //! Maximum number of nodes of an AST used instead of a reference to it (INLINE_REFERENCES mode). \sa setInlineReferenceSize().
+          triton::usize inlineReferenceSize;
+
+          //! The symbolic expression id of the memory array (MEMORY_ARRAY mode). UNSET while no store has been recorded on the base array.
+          triton::usize memoryArrayId;
+
+          //! The number of base memory arrays started. Each base array gets its own name. \sa resetMemoryArray().
+          triton::usize memoryArrayGeneration;
+
+          //! The symbolic regions, the first address of each region mapped to its end (excluded). Empty if every address is symbolic.
+          std::map<triton::uint64, triton::uint64> symbolicRegions;
+
+          //! True while an instruction outside the symbolic regions is built: the registers and the memory are read as constants.
+          bool concreteOnly;
+
+          //! Returns the index of the byte `offset` of a memory access into the memory array. The index is symbolic if the LEA is.
+          triton::ast::AbstractNode* getMemoryArrayIndex(const triton::arch::MemoryAccess& mem, triton::uint32 offset);
+
+          //! Records the bytes of a memory store into the memory array. The bytes are batched into one expression.
+          SymbolicExpression* storeMemoryArray(const triton::arch::MemoryAccess& mem, triton::ast::AbstractNode* node, const std::string& comment);
+
+          //! Returns a memory access loaded from the memory array, one select per byte.
+          triton::ast::AbstractNode* loadMemoryArray(const triton::arch::MemoryAccess& mem);
+
+          //! Unrolled ASTs of symbolic expressions (without reference nodes) indexed by symbolic expression id.
+          std::map<triton::usize, triton::ast::AbstractNode*> fullAsts;
+
+          //! The revision of symbolic expressions `fullAsts` has been built on. \sa triton::engines::symbolic::SymbolicExpression::getRevision()
+          triton::usize fullAstsRevision;
+
+          //! Releases the unrolled AST of a symbolic expression.
+          void dropFullAst(triton::usize symExprId);
+
+          //! Pushes the ids of the reference nodes whose expression is not unrolled yet. Returns true if there is any.
+          bool getUncachedReferences(const std::vector<triton::ast::AbstractNode*>& nodes, std::vector<triton::usize>& ids) const;
+
+          //! Unrolls nodes given in post-order. The expressions they reference must be unrolled already.
+          triton::ast::AbstractNode* unrollNodes(const std::vector<triton::ast::AbstractNode*>& nodes, std::map<triton::ast::AbstractNode*, triton::ast::AbstractNode*>& unrolled);
+
+          //! Releases the nodes of a deferred flag expression and removes it.
+          void dropLazyFlag(std::map<triton::uint32, LazyFlag>::iterator it);
+
+          //! Builds a deferred flag expression and assigns it to the flag.
+          void materializeLazyFlag(std::map<triton::uint32, LazyFlag>::iterator it);
+
+          //! The expressions reached by the current slice, by id. Always cleared once a slice is done, so it is reused by the next one.
+          std::vector<bool> sliceMarks;
+
+          //! Sets the symbolic reference of a parent register and records the previous one into the journal.
+          void setRegisterReference(triton::uint32 regId, triton::usize symExprId);
+
+          //! Sets the symbolic reference of a memory cell (UNSET removes it) and the offset of the byte in the expression, and records the previous one into the journal.
+          void setMemoryReference(triton::uint64 addr, triton::usize symExprId, triton::uint32 offset=0);
+
+          //! Sets an aligned memory entry (nullptr removes it) and records the previous one into the journal.
+          void setAlignedMemoryReference(triton::uint64 address, triton::uint32 size, triton::ast::AbstractNode* node);
+
+          //! Number of retired aligned entries released when an aligned entry is added.
+          static const triton::usize releasedAlignedEntries = 2;
+
+          //! Releases the nodes of up to `count` retired aligned entries.
+          void releaseRetiredAlignedMemory(triton::usize count);
 
         public:
-          //! Constructor. If you use this class as backup or copy you should define the `isBackup` flag as true.
+          //! Constructor. `isBackup` is kept for compatibility, copies of an engine share their expressions and variables safely.
           SymbolicEngine(triton::arch::Architecture* architecture,
                          triton::modes::Modes* modes,
                          triton::callbacks::Callbacks* callbacks=nullptr,
@@ -145,10 +373,235 @@ namespace triton {
           //! Removes the symbolic expression corresponding to the id.
           void removeSymbolicExpression(triton::usize symExprId);
 
+          //! Pins a symbolic expression. Pinned expressions, and the ones they reference, are never collected.
+          void pinSymbolicExpression(triton::usize symExprId);
+
+          //! Unpins a symbolic expression.
+          void unpinSymbolicExpression(triton::usize symExprId);
+
+          //! Returns true if there are enough symbolic expressions to collect the unreachable ones (ONLY_LIVE_EXPRESSIONS mode).
+          bool isCollectionNeeded(void) const;
+
+          /*!
+           * \brief Sets the maximum number of AST nodes. 0 if unlimited, which is the default.
+           *
+           * \description
+           * Once the budget is exceeded, the oldest half of the symbolic register and memory references are concretized
+           * and the expressions which are not reachable anymore are collected. The id of an expression tells when it has
+           * been assigned, so the references concretized are the ones which have not been written for the longest time.
+           * If the nodes still held (e.g. by path constraints) exceed the budget, the next relief waits until their number
+           * has doubled, as the collection of ONLY_LIVE_EXPRESSIONS does.
+           */
+          void setNodeBudget(triton::usize budget);
+
+          //! Returns the maximum number of AST nodes. 0 if unlimited.
+          triton::usize getNodeBudget(void) const;
+
+          //! Returns true if `nodes` AST nodes exceed the budget. \sa setNodeBudget().
+          bool isNodeBudgetExceeded(triton::usize nodes) const;
+
+          //! Updates the budget threshold with the number of AST nodes left after a relief. \sa setNodeBudget().
+          void updateNodeBudgetThreshold(triton::usize nodes);
+
+          //! Concretizes the oldest half of the symbolic register and memory references. Returns the number of references concretized.
+          triton::usize concretizeOldestReferences(void);
+
+          /*!
+           * \brief Sets the maximum number of instructions whose references are kept symbolic. 0 if unlimited, which is the default.
+           *
+           * \description
+           * The register and memory references are recorded by the instruction, or the interval between two instructions,
+           * which assigns them. Once an instruction is older than the last `size` ones, the references it assigned and
+           * which have not been assigned again are concretized, so only the dependencies within the window stay symbolic.
+           * Every `size` instructions, the path constraints recorded before the window are dropped, the memory array is
+           * started again if its stores are older than the window and the expressions which are not reachable anymore
+           * are collected. The cost of the window is proportional to the number of references assigned, and the number of
+           * live expressions stays bounded by twice the window. The references assigned before the window is set are kept.
+           * The number of AST nodes can be bounded as well with setNodeBudget().
+           */
+          void setInstructionWindow(triton::usize size);
+
+          //! Returns the maximum number of instructions whose references are kept symbolic. 0 if unlimited.
+          triton::usize getInstructionWindow(void) const;
+
+          //! Closes the slot of an instruction and concretizes the references which leave the window. Returns true if the unreachable expressions must be collected. \sa setInstructionWindow().
+          bool slideInstructionWindow(void);
+
+          /*!
+           * \brief Attaches a receiver of the dependency graph of the symbolic expressions (nullptr detaches it).
+           *
+           * \details
+           * The sink is not owned and receives the expressions built from now on, once their instruction has been processed,
+           * so their origin is known. Expressions removed before the end of their instruction (e.g. by ONLY_ON_TAINTED) are
+           * not written. The expressions pending are written to the previous sink, which is flushed.
+           */
+          void setDependencySink(DependencySink* sink);
+
+          /*!
+           * \brief Sets the policy of the memory accesses whose address is symbolized, for an instruction address.
+           *
+           * \description
+           * With POINTER_CONCRETE, an access only targets its concrete address. With POINTER_RANGE, a load reads an ite table
+           * over the addresses of the window of `range` bytes on each side of the concrete address which the abstract interval
+           * of the address expression allows, the concrete address being the last case. A store updates each address of the
+           * window under the condition that the address expression is equal to it. POINTER_SOLVER narrows the window to the
+           * bounds of the address expression given by the solver (see setPointerBoundsSolver()), which are cached by address
+           * expression. The accesses with the MEMORY_ARRAY mode read and store the memory array instead.
+           */
+          void setPointerPolicy(triton::uint64 address, triton::engines::symbolic::pointer_policy_e policy, triton::uint32 range=SymbolicEngine::defaultPointerRange);
+
+          //! Sets the policy of the instructions without their own. \sa setPointerPolicy().
+          void setDefaultPointerPolicy(triton::engines::symbolic::pointer_policy_e policy, triton::uint32 range=SymbolicEngine::defaultPointerRange);
+
+          //! Returns the policy of the memory accesses at an instruction address.
+          const PointerPolicy& getPointerPolicy(triton::uint64 address) const;
+
+          //! Removes the policies of the instruction addresses and the cached bounds. The default policy is kept.
+          void clearPointerPolicies(void);
+
+          //! Sets the function which computes the unsigned bounds of an address expression for POINTER_SOLVER, and clears the cached bounds.
+          void setPointerBoundsSolver(const std::function<bool(triton::ast::AbstractNode*, triton::uint64&, triton::uint64&)>& solver);
+
+          //! Returns the receiver of the dependency graph, nullptr if the graph is not streamed.
+          DependencySink* getDependencySink(void) const;
+
+          //! Writes the expressions built since the last call to the dependency sink, with the address of their instruction.
+          void writeDependencies(triton::uint64 address);
+
+          /*!
+           * \brief Sets the maximum depth and unrolled size of the symbolic expressions (0 if unlimited).
+           *
+           * \description
+           * The depth and the unrolled size of a node are maintained while it is built, so checking the expressions of
+           * an instruction is cheap. An expression which exceeds a limit is reported to the EXPRESSION_LIMIT callbacks
+           * and, with the CONCRETIZE_LARGE_EXPRESSIONS mode, its destination is concretized, so the next instructions
+           * do not build on it. This stops the blowup of hash and crypto loops before getFullAst() or the solver chokes.
+           */
+          void setExpressionLimits(triton::uint32 depth, triton::uint64 size);
+
+          //! Returns the maximum depth of the symbolic expressions. 0 if unlimited.
+          triton::uint32 getMaxExpressionDepth(void) const;
+
+          //! Returns the maximum unrolled size of the symbolic expressions. 0 if unlimited.
+          triton::uint64 getMaxExpressionSize(void) const;
+
+          //! Returns true if a limit is set on the depth or the unrolled size of the symbolic expressions.
+          bool isExpressionLimitSet(void) const;
+
+          //! Default maximum number of nodes of an inlined AST (INLINE_REFERENCES mode).
+          static const triton::usize defaultInlineReferenceSize = 8;
+
+          //! Default number of bytes accessed on each side of the concrete address (POINTER_RANGE and POINTER_SOLVER).
+          static const triton::uint32 defaultPointerRange = 16;
+
+          /*!
+           * \brief Sets the maximum number of nodes of the ASTs used instead of a reference (INLINE_REFERENCES mode).
+           *
+           * \description
+           * The nodes are counted up to the references, which are not followed. The default keeps the extractions, the
+           * flags and the copies of a register, which are the most common links of the chains of references.
+           */
+          void setInlineReferenceSize(triton::usize size);
+
+          //! Returns the maximum number of nodes of the ASTs used instead of a reference (INLINE_REFERENCES mode).
+          triton::usize getInlineReferenceSize(void) const;
+
+          //! Returns the AST pointed by a reference node if it is small enough to be inlined, the reference node otherwise (INLINE_REFERENCES mode).
+          triton::ast::AbstractNode* inlineReference(triton::ast::AbstractNode* node) const;
+
+          /*!
+           * \brief Adds the addresses `[start:end)` to the symbolic regions.
+           *
+           * \description
+           * Once a region is defined, only the instructions inside the regions are executed symbolically. The other ones
+           * read the registers and the memory as constants, so their ASTs are small and never symbolized, and their
+           * expressions are removed after the processing: they only update the concrete state and concretize what they write.
+           */
+          void addSymbolicRegion(triton::uint64 start, triton::uint64 end);
+
+          //! Removes the addresses `[start:end)` from the symbolic regions.
+          void removeSymbolicRegion(triton::uint64 start, triton::uint64 end);
+
+          //! Removes every symbolic region, every address is symbolic again.
+          void clearSymbolicRegions(void);
+
+          //! Returns the symbolic regions, the first address of each region mapped to its end (excluded).
+          const std::map<triton::uint64, triton::uint64>& getSymbolicRegions(void) const;
+
+          //! Returns true if the instruction at `addr` is executed symbolically. \sa addSymbolicRegion().
+          bool isSymbolicRegion(triton::uint64 addr) const;
+
+          //! Reads the registers and the memory as constants (true) or not. \sa addSymbolicRegion().
+          void setConcreteOnly(bool flag);
+
+          //! Returns true if the registers and the memory are read as constants.
+          bool isConcreteOnly(void) const;
+
+          //! Removes the register and memory expressions of an instruction executed outside the symbolic regions and concretizes their destinations, without looking for other references.
+          void removeConcreteExpressions(const std::vector<SymbolicExpression*>& exprs);
+
+          //! Returns true if a symbolic expression exceeds the expression limits.
+          bool isExpressionLimitExceeded(const SymbolicExpression* expr) const;
+
+          //! Reports and concretizes the expressions which exceed the expression limits. Returns the number of expressions exceeding them. \sa setExpressionLimits().
+          triton::usize checkExpressionLimits(const std::vector<SymbolicExpression*>& exprs);
+
+          //! Adds an instruction, its expressions and the AST nodes allocated by its semantics to the profile of its address (EXPRESSION_PROFILING mode).
+          void profileExpressions(const triton::arch::Instruction& inst, triton::usize nodes);
+
+          /*!
+           * \brief Adds a solver query and its time (in nanoseconds) to the profiles of the expressions it references (EXPRESSION_PROFILING mode).
+           *
+           * \description
+           * The references are not followed, the query is attributed to the addresses of the expressions it reads
+           * directly, e.g. the flags of a path constraint. Each address gets the whole time of the query.
+           */
+          void profileQuery(triton::ast::AbstractNode* node, triton::uint64 time);
+
+          //! Returns the profiles of the expressions by instruction address.
+          const std::map<triton::uint64, ExpressionProfile>& getExpressionProfile(void) const;
+
+          //! Clears the profiles of the expressions.
+          void clearExpressionProfile(void);
+
+          //! Writes the profiles of the `count` addresses (0 for all) which allocated the most nodes, as CSV, or as JSON if `json` is true.
+          void dumpExpressionProfile(std::ostream& stream, triton::usize count=0, bool json=false) const;
+
+          /*!
+           * \brief Removes the symbolic expressions which are not reachable anymore.
+           *
+           * \description
+           * An expression is reachable if it is referenced by a register, a memory cell, a path constraint, an aligned
+           * memory entry, a deferred flag, a pinned expression or an expression of `roots`, or by a reachable expression.
+           * The ASTs of removed expressions are pinned into `asts`, the caller releases them through the AST garbage collector.
+           */
+          void collectUnreachableExpressions(const std::vector<SymbolicExpression*>& roots, std::vector<triton::ast::AbstractNode*>& asts);
+
+          /*!
+           * \brief Returns the AST of the memory array (MEMORY_ARRAY mode).
+           *
+           * \description
+           * With the MEMORY_ARRAY mode, every store is also recorded as `store` nodes on an array of bytes indexed by
+           * addresses, and loads whose LEA is symbolized are built as `select` nodes on it instead of being concretized
+           * at their concrete address. The solver translates them in the theory of arrays (QF_ABV). The cells of the base
+           * array are unconstrained, concrete areas a symbolic index may read (e.g. tables) must be copied into the array
+           * with initMemoryArrayArea(). Returns a reference to the last array expression or the base array.
+           */
+          triton::ast::AbstractNode* getMemoryArray(void);
+
+          //! Returns the symbolic expression id of the memory array. UNSET while no store has been recorded on the base array.
+          triton::usize getMemoryArrayId(void) const;
+
+          //! Copies the concrete bytes of a memory area into the memory array, so that symbolic loads in this area are constrained by them.
+          void initMemoryArrayArea(triton::uint64 baseAddr, triton::usize size);
+
+          //! Starts a new base memory array. The previous stores are forgotten.
+          void resetMemoryArray(void);
+
           //! Adds an aligned entry.
           void addAlignedMemory(triton::uint64 address, triton::uint32 size, triton::ast::AbstractNode* node);
 
-          //! Gets an aligned entry.
+          //! Gets an aligned entry, or nullptr if there is none.
           triton::ast::AbstractNode* getAlignedMemory(triton::uint64 address, triton::uint32 size);
 
           //! Checks if the aligned memory is recored.
@@ -166,6 +619,9 @@ namespace triton {
           //! Converts a symbolic memory expression to a symbolic variable.
           SymbolicVariable* convertMemoryToSymbolicVariable(const triton::arch::MemoryAccess& mem, const std::string& symVarComment="");
 
+          //! Converts each word of `wordSize` bytes of a memory area to a symbolic variable. The concrete values of the bytes are read once for the whole area.
+          std::vector<SymbolicVariable*> convertMemoryAreaToSymbolicVariables(triton::uint64 baseAddr, triton::usize size, const std::string& symVarComment="", triton::uint32 wordSize=BYTE_SIZE);
+
           //! Converts a symbolic register expression to a symbolic variable.
           SymbolicVariable* convertRegisterToSymbolicVariable(const triton::arch::Register& reg, const std::string& symVarComment="");
 
@@ -175,9 +631,12 @@ namespace triton {
           //! Returns the symbolic variable corresponding to the symbolic variable name.
           SymbolicVariable* getSymbolicVariableFromName(const std::string& symVarName) const;
 
-          //! Returns the symbolic expression id corresponding to the memory address.
+          //! Returns the symbolic expression id corresponding to the memory address. The expression may hold several bytes. \sa getSymbolicMemoryId(triton::uint64, triton::uint32&).
           triton::usize getSymbolicMemoryId(triton::uint64 addr) const;
 
+          //! Returns the symbolic expression id corresponding to the memory address, and the offset (in bytes, from the least significant one) of the memory cell in the expression.
+          triton::usize getSymbolicMemoryId(triton::uint64 addr, triton::uint32& offset) const;
+
           //! Returns the symbolic expression corresponding to an id.
           SymbolicExpression* getSymbolicExpressionFromId(triton::usize symExprId) const;
 
@@ -187,6 +646,18 @@ namespace triton {
           //! Returns the map (addr:expr) of all symbolic memory defined.
           std::map<triton::uint64, SymbolicExpression*> getSymbolicMemory(void) const;
 
+          //! Returns the map (addr:expr) of the symbolic memory defined in [start, end).
+          std::map<triton::uint64, SymbolicExpression*> getSymbolicMemory(triton::uint64 start, triton::uint64 end) const;
+
+          //! Calls `callback` with every symbolic register and its expression without building a map.
+          void forEachSymbolicRegister(const std::function<void(const triton::arch::Register&, SymbolicExpression*)>& callback) const;
+
+          //! Calls `callback` with every address of [start, end) which has a symbolic expression, in ascending order, without building a map.
+          void forEachSymbolicMemory(triton::uint64 start, triton::uint64 end, const std::function<void(triton::uint64, SymbolicExpression*)>& callback) const;
+
+          //! Calls `callback` with every address which has a symbolic expression and the id of the expression, in ascending order of address.
+          void forEachSymbolicMemoryId(const std::function<void(triton::uint64, triton::usize)>& callback) const;
+
           //! Returns the symbolic expression id corresponding to the register.
           triton::usize getSymbolicRegisterId(const triton::arch::Register& reg) const;
 
@@ -199,7 +670,7 @@ namespace triton {
           //! Returns the symbolic values of a memory area.
           std::vector<triton::uint8> getSymbolicMemoryAreaValue(triton::uint64 baseAddr, triton::usize size);
 
-          //! Returns the symbolic register value.
+          //! Returns the symbolic register value. It is read from the evaluation of the register expression, no node is built.
           triton::uint512 getSymbolicRegisterValue(const triton::arch::Register& reg);
 
           //! Returns a symbolic operand based on the abstract wrapper.
@@ -238,6 +709,35 @@ namespace triton {
           //! Returns the new symbolic flag expression expression and links this expression to the instruction.
           SymbolicExpression* createSymbolicFlagExpression(triton::arch::Instruction& inst, triton::ast::AbstractNode* node, triton::arch::Register& flag, const std::string& comment="");
 
+          /*!
+           * \brief Returns the new symbolic flag expression built by `builder` and links this expression to the instruction.
+           *
+           * \description
+           * If the LAZY_FLAGS mode is enabled, the expression is only recorded and nullptr is returned. The flag expression
+           * is built the first time the flag is read or before the expression `parent` is removed, and is dropped if the flag
+           * is written before. `nodes` are the AST nodes used by the builder. The expression is built immediately if the
+           * mode is disabled, if the engine is disabled or if ONLY_ON_SYMBOLIZED or ONLY_ON_TAINTED are enabled.
+           */
+          SymbolicExpression* createLazySymbolicFlagExpression(triton::arch::Instruction& inst,
+                                                               triton::arch::Register& flag,
+                                                               SymbolicExpression* parent,
+                                                               const std::vector<triton::ast::AbstractNode*>& nodes,
+                                                               const std::function<triton::ast::AbstractNode*(void)>& builder,
+                                                               bool isTainted,
+                                                               const std::string& comment="");
+
+          //! Builds the deferred expression of a flag if there is one.
+          void materializeLazyFlag(const triton::arch::Register& flag);
+
+          //! Builds all deferred flag expressions.
+          void materializeLazyFlags(void);
+
+          //! Drops the deferred expression of a flag which is overwritten without being read.
+          void dropLazyFlag(const triton::arch::Register& flag);
+
+          //! Returns true if the expression of a flag is deferred.
+          bool isLazyFlag(const triton::arch::Register& flag) const;
+
           //! Returns the new symbolic volatile expression expression and links this expression to the instruction.
           SymbolicExpression* createSymbolicVolatileExpression(triton::arch::Instruction& inst, triton::ast::AbstractNode* node, const std::string& comment="");
 
@@ -247,35 +747,65 @@ namespace triton {
           //! Returns an unique symbolic variable id.
           triton::usize getUniqueSymVarId(void);
 
+          //! Returns the id of the next symbolic expression, without reserving it.
+          triton::usize getNextSymbolicExpressionId(void) const;
+
           //! Assigns a symbolic expression to a register.
           void assignSymbolicExpressionToRegister(SymbolicExpression *se, const triton::arch::Register& reg);
 
           //! Assigns a symbolic expression to a memory.
           void assignSymbolicExpressionToMemory(SymbolicExpression *se, const triton::arch::MemoryAccess& mem);
 
-          //! Returns the full AST of a root node.
-          triton::ast::AbstractNode* getFullAst(triton::ast::AbstractNode* node, std::set<triton::usize>& processed);
-
-          //! Returns the full AST of a root node.
+          //! Returns the full AST of a root node. The node is not modified, unrolled expressions are cached and shared between full ASTs.
           triton::ast::AbstractNode* getFullAst(triton::ast::AbstractNode* node);
 
+          //! Releases the cached unrolled ASTs.
+          void clearFullAsts(void);
+
           //! Slices all expressions from a given one.
           std::map<triton::usize, SymbolicExpression*> sliceExpressions(SymbolicExpression* expr);
 
-          //! Returns the list of the tainted symbolic expressions.
-          std::list<SymbolicExpression*> getTaintedSymbolicExpressions(void) const;
+          //! Returns the list of the tainted symbolic expressions whose id is greater than or equal to `fromId`.
+          std::list<SymbolicExpression*> getTaintedSymbolicExpressions(triton::usize fromId=0) const;
 
           //! Returns all symbolic expressions.
-          const std::map<triton::usize, SymbolicExpression*>& getSymbolicExpressions(void) const;
+          std::map<triton::usize, SymbolicExpression*> getSymbolicExpressions(void) const;
+
+          //! Returns the number of symbolic expressions.
+          triton::usize getNumberOfSymbolicExpressions(void) const;
 
           //! Returns all symbolic variables.
-          const std::map<triton::usize, SymbolicVariable*>& getSymbolicVariables(void) const;
+          std::map<triton::usize, SymbolicVariable*> getSymbolicVariables(void) const;
+
+          //! Returns the number of symbolic variables.
+          triton::usize getNumberOfSymbolicVariables(void) const;
+
+          //! Returns the estimated number of bytes used by the symbolic expressions, variables and references. The ASTs and the path constraints are not counted.
+          triton::usize getMemoryUsage(void) const;
 
           //! Returns all variable declarations representation.
           std::string getVariablesDeclaration(void) const;
 
-          //! Adds a symbolic memory reference.
-          void addMemoryReference(triton::uint64 mem, triton::usize id);
+          /*!
+           * \brief Writes the symbolic state in the binary serialization format. \sa triton::ast::AstWriter
+           *
+           * \description
+           * The state is made of the symbolic variables, the symbolic expressions (deferred flags are built first),
+           * the symbolic references of registers and memory cells and the path constraints.
+           */
+          void serializeState(std::ostream& stream);
+
+          /*!
+           * \brief Reads a symbolic state written by serializeState().
+           *
+           * \description
+           * Variables and expressions read get new ids (references are translated), and the register and memory
+           * references and the path constraints read are added to the current state.
+           */
+          void deserializeState(std::istream& stream);
+
+          //! Adds a symbolic memory reference. `offset` is the offset (in bytes) of the memory cell in the expression.
+          void addMemoryReference(triton::uint64 mem, triton::usize id, triton::uint32 offset=0);
 
           //! Concretizes all symbolic memory references.
           void concretizeAllMemory(void);
@@ -289,6 +819,12 @@ namespace triton {
           //! Concretizes a specific symbolic memory reference.
           void concretizeMemory(triton::uint64 addr);
 
+          //! Concretizes the symbolic memory references of an area. The aligned memory of the area is removed at once.
+          void concretizeMemoryArea(triton::uint64 baseAddr, triton::usize size);
+
+          //! Copies the symbolic memory references of an area to another one, as memmove() would copy the bytes. The copy is not recorded into the memory array.
+          void copyMemoryReferences(triton::uint64 dst, triton::uint64 src, triton::usize size);
+
           //! Concretizes a specific symbolic register reference.
           void concretizeRegister(const triton::arch::Register& reg);
 
@@ -298,6 +834,31 @@ namespace triton {
           //! Returns true if the symbolic execution engine is enabled.
           bool isEnabled(void) const;
 
+          /*!
+           * \brief Starts recording every change of the symbolic state into a journal.
+           *
+           * \description
+           * Journals are nested: a journal started while another one records is rolled back first. The deferred flags
+           * are built when a journal is started, and the unreachable expressions are not collected while a journal
+           * records, as the journal may restore the references to them.
+           */
+          void startJournal(void);
+
+          /*!
+           * \brief Reverts all changes recorded since the innermost journal has been started and stops it.
+           *
+           * \description
+           * The expressions and variables created since are removed and their ids are given again. If `asts` is given, the
+           * ASTs of the removed expressions are pinned into it, the caller releases them through the AST garbage collector.
+           */
+          void rollbackJournal(std::vector<triton::ast::AbstractNode*>* asts=nullptr);
+
+          //! Stops every journal and keeps the changes they recorded.
+          void clearJournal(void);
+
+          //! Returns true if changes are recorded into the journal.
+          bool isJournalStarted(void) const;
+
           //! Returns true if the symbolic expression ID exists.
           bool isSymbolicExpressionIdExists(triton::usize symExprId) const;
 
@@ -309,6 +870,15 @@ namespace triton {
 
           //! Returns true if the register expression contains a symbolic variable.
           bool isRegisterSymbolized(const triton::arch::Register& reg) const;
+
+          /*!
+           * \brief Returns false if no expression can be symbolized, in O(1).
+           *
+           * \description An expression is only symbolized if it reaches a symbolic variable or, with MEMORY_ARRAY, the
+           * memory array. Until a variable is created, every register and memory cell is concrete and the checks of the
+           * operands are skipped.
+           */
+          bool isSymbolized(void) const;
       };
 
     /*! @} End of symbolic namespace */
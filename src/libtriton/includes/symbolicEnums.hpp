@@ -51,6 +51,13 @@ namespace triton {
         MEM        //!< Assigned to a memory.
       };
 
+      //! Enumerates the policies of the memory accesses whose address is symbolized (without the MEMORY_ARRAY mode).
+      enum pointer_policy_e {
+        POINTER_CONCRETE = 0, //!< Only the concrete address is accessed (default).
+        POINTER_RANGE,        //!< The addresses of a window around the concrete one, within the abstract interval of the address, are accessed through an ite table.
+        POINTER_SOLVER        //!< As POINTER_RANGE, within the bounds of the address given by the solver, cached by address expression.
+      };
+
     /*! @} End of symbolic namespace */
     };
   /*! @} End of engines namespace */
@@ -8,7 +8,9 @@
 #ifndef TRITON_SYMBOLICEXPRESSION_H
 #define TRITON_SYMBOLICEXPRESSION_H
 
+#include <atomic>
 #include <string>
+#include <vector>
 
 #include "ast.hpp"
 #include "memoryAccess.hpp"
@@ -52,17 +54,35 @@ namespace triton {
           //! The root node (AST) of the symbolic expression.
           triton::ast::AbstractNode* ast;
 
-          //! The comment of the symbolic expression.
-          std::string comment;
-
           //! The symbolic expression id. This id is unique.
           triton::usize id;
 
-          //! The origin memory address if `kind` is equal to `triton::engines::symbolic::MEM`, invalid memory otherwise.
-          triton::arch::MemoryAccess originMemory;
+          //! The origin memory address if `originKind` is `MEM`, the origin register id if it is `REG`.
+          triton::uint64 origin;
+
+          //! The size in bytes of the origin memory access.
+          triton::uint32 originSize;
+
+          //! The id of the comment in the table of comments shared by all expressions. 0 is the empty comment.
+          triton::uint32 commentId;
+
+          //! `MEM` or `REG` if the expression has an origin, `UNDEF` otherwise.
+          triton::uint8 originKind;
+
+          //! The sorted ids of the expressions referenced by the root node. The edges of the def-use graph walked by the slicing.
+          std::vector<triton::usize> references;
+
+          //! Collects the ids of the expressions referenced by the root node into `references`.
+          void indexReferences(void);
+
+          //! Returns the id of a comment, interned on first use.
+          static triton::uint32 internComment(const std::string& comment);
 
-          //! The origin register if `kind` is equal to `triton::engines::symbolic::REG`, `REG_INVALID` otherwise.
-          triton::arch::Register originRegister;
+          //! Number of root nodes replaced by `setAst()` in all symbolic expressions. Shared by all APIs, a bump from another one only invalidates the caches.
+          static std::atomic<triton::usize> revision;
+
+          //! Number of symbolic expressions deleted in all APIs. A bump from another API only makes the reference nodes look up their expression again.
+          static std::atomic<triton::usize> deletions;
 
         public:
           //! True if the symbolic expression is tainted.
@@ -80,9 +100,18 @@ namespace triton {
           //! Returns true if the expression contains a symbolic variable.
           bool isSymbolized(void) const;
 
+          //! Returns the depth of the expression, references unrolled. 0 if there is no root node.
+          triton::uint32 getDepth(void) const;
+
+          //! Returns the number of nodes of the expression once unrolled, saturated. 0 if there is no root node.
+          triton::uint64 getUnrolledSize(void) const;
+
           //! Returns the kind of the symbolic expression.
           symkind_e getKind(void) const;
 
+          //! Returns the sorted ids of the expressions directly referenced by the root node.
+          const std::vector<triton::usize>& getReferences(void) const;
+
           //! Returns the SMT AST root node of the symbolic expression. This is the semantics.
           triton::ast::AbstractNode* getAst(void) const;
 
@@ -98,11 +127,17 @@ namespace triton {
           //! Returns the comment as string of the symbolic expression according the mode of the AST representation.
           std::string getFormattedComment(void) const;
 
-          //! Returns the origin memory access if `kind` is equal to `triton::engines::symbolic::MEM`, invalid memory otherwise.
-          const triton::arch::MemoryAccess& getOriginMemory(void) const;
+          //! Returns the origin memory access if it has been set, invalid memory otherwise. The concrete value is the one of the AST.
+          triton::arch::MemoryAccess getOriginMemory(void) const;
+
+          //! Returns the origin register if it has been set, `REG_INVALID` otherwise.
+          triton::arch::Register getOriginRegister(void) const;
+
+          //! Returns the number of root nodes replaced so far. Caches of unrolled ASTs are valid as long as it does not change.
+          static triton::usize getRevision(void);
 
-          //! Returns the origin register if `kind` is equal to `triton::engines::symbolic::REG`, `REG_INVALID` otherwise.
-          const triton::arch::Register& getOriginRegister(void) const;
+          //! Returns the number of symbolic expressions deleted so far. The expressions kept by the reference nodes are valid as long as it does not change.
+          static triton::usize getDeletions(void);
 
           //! Sets a root node.
           void setAst(triton::ast::AbstractNode* node);
@@ -113,10 +148,10 @@ namespace triton {
           //! Sets the kind of the symbolic expression.
           void setKind(symkind_e k);
 
-          //! Sets the origin memory acccess.
+          //! Sets the origin memory acccess. Only its address and its size are kept, it replaces the origin register.
           void setOriginMemory(const triton::arch::MemoryAccess& mem);
 
-          //! Sets the origin register.
+          //! Sets the origin register. Only its id is kept, it replaces the origin memory access.
           void setOriginRegister(const triton::arch::Register& reg);
 
           //! Constructor.
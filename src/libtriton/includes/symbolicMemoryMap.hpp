@@ -0,0 +1,171 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#ifndef TRITON_SYMBOLICMEMORYMAP_H
+#define TRITON_SYMBOLICMEMORYMAP_H
+
+#include <functional>
+#include <list>
+#include <map>
+#include <memory>
+#include <vector>
+
+#include "hugePageArena.hpp"
+#include "tritonTypes.hpp"
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The Engines namespace
+  namespace engines {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup engines
+   *  @{
+   */
+
+    //! The Symbolic Execution namespace
+    namespace symbolic {
+    /*!
+     *  \ingroup engines
+     *  \addtogroup symbolic
+     *  @{
+     */
+
+      //! \class SymbolicMemoryMap
+      /*! \brief The symbolic memory map class.
+       *
+       * \description
+       * Maps every byte address to a symbolic expression id and to the offset of the byte in the
+       * expression, so that a wide store is a single expression. Addresses are split into 4 KiB pages
+       * of id slots which are allocated on demand and released when they become empty. Unset slots
+       * contain `UNSET`. The last page used is cached, so accesses to consecutive bytes do a single
+       * page lookup. Copies of a map share their pages, a shared page is duplicated on its first
+       * write (copy-on-write), so copying a map costs one reference per page. Clearing a map is constant
+       * time: its pages are retired as a whole generation, which is released a few pages at a time when
+       * new pages are allocated.
+       */
+      class SymbolicMemoryMap {
+        public:
+          //! Number of bits of an address used to index a page.
+          static const triton::uint32 pageBits = 12;
+
+          //! Number of bytes per page.
+          static const triton::uint64 pageSize = (1 << pageBits);
+
+        private:
+          //! The slots of a page, allocated from the huge page arena (HUGE_PAGES mode).
+          typedef std::vector<triton::usize, triton::utils::HugePageAllocator<triton::usize>> SlotVector;
+
+          //! A page of id slots.
+          struct Page {
+            //! Slots of the page indexed by the page offset.
+            SlotVector slots;
+
+            //! Offsets of the bytes in the expressions of the slots.
+            std::vector<triton::uint8, triton::utils::HugePageAllocator<triton::uint8>> offsets;
+
+            //! Number of slots set.
+            triton::usize count;
+          };
+
+          //! Number of retired pages released when a page is allocated.
+          static const triton::usize releasedPages = 2;
+
+          //! Pages indexed by their page number. A page may be shared with copies of this map.
+          std::map<triton::uint64, std::shared_ptr<Page>> pages;
+
+          //! The pages of the cleared generations, the oldest first. They are no longer part of the map.
+          std::list<std::map<triton::uint64, std::shared_ptr<Page>>> retired;
+
+          //! Number of slots set.
+          triton::usize count;
+
+          //! Page number of the cached page.
+          mutable triton::uint64 cachedNumber;
+
+          //! The cached page. nullptr if there is no page cached.
+          mutable Page* cachedPage;
+
+          //! True if the cached page is not shared and may be written.
+          mutable bool cachedWritable;
+
+          //! Returns the page of an address or nullptr if it is not allocated.
+          const Page* findPage(triton::uint64 addr) const;
+
+          //! Returns the page of an address, not shared with another map. Allocates it if `create` is true, otherwise returns nullptr if it is not allocated.
+          Page* findWritablePage(triton::uint64 addr, bool create);
+
+          //! Releases up to `count` retired pages.
+          void releaseRetired(triton::usize count);
+
+        public:
+          //! Constructor.
+          SymbolicMemoryMap();
+
+          //! Constructor by copy.
+          SymbolicMemoryMap(const SymbolicMemoryMap& other);
+
+          //! Copies a SymbolicMemoryMap.
+          void operator=(const SymbolicMemoryMap& other);
+
+          //! Returns the symbolic expression id of an address or UNSET.
+          triton::usize get(triton::uint64 addr) const;
+
+          //! Returns the symbolic expression id of an address or UNSET, and the offset of the byte in the expression.
+          triton::usize get(triton::uint64 addr, triton::uint32& offset) const;
+
+          //! Sets the symbolic expression id of an address and the offset of the byte in the expression. UNSET removes the entry and returns the previous id.
+          triton::usize set(triton::uint64 addr, triton::usize symExprId, triton::uint32 offset=0);
+
+          /*!
+           * \brief Returns the slots of a page starting at `addr`, or nullptr if the page is not allocated.
+           *
+           * \description
+           * `length` receives the number of slots available from `addr` to the end of the page.
+           */
+          const triton::usize* getSlots(triton::uint64 addr, triton::uint64& length) const;
+
+          //! Looks for the lowest address mapped to a symbolic expression id. Returns false if there is none.
+          bool find(triton::usize symExprId, triton::uint64& addr) const;
+
+          //! Removes every entry in constant time. The pages are released lazily.
+          void clear(void);
+
+          //! Returns the number of addresses mapped.
+          triton::usize size(void) const;
+
+          //! Appends the symbolic expression id of every address mapped to `ids`.
+          void getIds(std::vector<triton::usize>& ids) const;
+
+          //! Calls `callback` with the address and the symbolic expression id of every entry, in ascending order of address.
+          void forEach(const std::function<void(triton::uint64, triton::usize)>& callback) const;
+
+          //! Calls `callback` with the address and the symbolic expression id of the entries in [start, end), in ascending order of address. Only the pages of the range are visited.
+          void forEach(triton::uint64 start, triton::uint64 end, const std::function<void(triton::uint64, triton::usize)>& callback) const;
+
+          //! Returns the entries as an ordered map of address -> symbolic expression id.
+          std::map<triton::uint64, triton::usize> toMap(void) const;
+
+          //! Returns the estimated number of bytes used by the pages, retired ones included. Shared pages are counted by every map holding them.
+          triton::usize getMemoryUsage(void) const;
+      };
+
+    /*! @} End of symbolic namespace */
+    };
+  /*! @} End of engines namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_SYMBOLICMEMORYMAP_H */
@@ -8,8 +8,15 @@
 #ifndef TRITON_SYMBOLICSIMPLIFICATION_H
 #define TRITON_SYMBOLICSIMPLIFICATION_H
 
+#include <map>
+#include <utility>
+#include <vector>
+
 #include "ast.hpp"
+#include "astEnums.hpp"
 #include "callbacks.hpp"
+#include "mbaSimplification.hpp"
+#include "tritonTypes.hpp"
 
 
 
@@ -36,6 +43,13 @@ namespace triton {
      *  @{
      */
 
+      /*! \brief The prototype of a built-in rewriting rule.
+       *
+       * \description The rule takes as unique argument a node whose children are already rewritten. It returns
+       * the node which replaces it, or nullptr if the rule does not apply.
+       */
+      typedef triton::ast::AbstractNode* (*rewritingRule)(triton::ast::AbstractNode* node);
+
       //! \class SymbolicSimplification
       /*! \brief The symbolic simplification class */
       class SymbolicSimplification {
@@ -43,6 +57,33 @@ namespace triton {
           //! Callbacks API
           triton::callbacks::Callbacks* callbacks;
 
+          //! The linear MBA simplification.
+          MbaSimplification mba;
+
+          //! The built-in rewriting rules by kind of node.
+          std::map<enum triton::ast::kind_e, std::vector<rewritingRule>> rules;
+
+          //! Records the built-in rewriting rules.
+          void initRewritingRules(void);
+
+          //! Maximum number of cached simplifications.
+          static const triton::usize maxSimplifications = 0x10000;
+
+          //! The cached simplifications (original, simplified) by structural hash of the original node and kind of simplification.
+          mutable std::map<triton::uint128, std::vector<std::pair<triton::ast::AbstractNode*, triton::ast::AbstractNode*>>> simplifications;
+
+          //! The number of cached simplifications.
+          mutable triton::usize numberOfSimplifications;
+
+          //! The revision of the callbacks the cached simplifications are valid for.
+          mutable triton::usize callbacksRevision;
+
+          //! The revision of the symbolic expressions the cached simplifications are valid for.
+          mutable triton::usize expressionsRevision;
+
+          //! Returns the structural hash of a node.
+          triton::uint128 hashNode(triton::ast::AbstractNode* node) const;
+
         public:
           //! Constructor.
           SymbolicSimplification(triton::callbacks::Callbacks* callbacks=nullptr);
@@ -56,8 +97,17 @@ namespace triton {
           //! Copies a SymbolicSimplification.
           void copy(const SymbolicSimplification& other);
 
-          //! Processes all recorded simplifications. Returns the simplified node.
-          triton::ast::AbstractNode* processSimplification(triton::ast::AbstractNode* node) const;
+          //! Processes all recorded simplifications, after the linear MBA simplification if `mba` is true and the Z3 simplification if `z3` is true. Returns the simplified node.
+          triton::ast::AbstractNode* processSimplification(triton::ast::AbstractNode* node, bool z3=false, bool mba=false) const;
+
+          //! Releases the cached simplifications.
+          void clearSimplifications(void) const;
+
+          //! Returns a constant node if the node is a bitvector which is not symbolized, the node otherwise.
+          triton::ast::AbstractNode* foldConcreteNode(triton::ast::AbstractNode* node) const;
+
+          //! Applies the built-in rewriting rules on a node whose children are already rewritten. Returns the rewritten node.
+          triton::ast::AbstractNode* rewriteNode(triton::ast::AbstractNode* node) const;
 
           //! Copies a SymbolicSimplification.
           void operator=(const SymbolicSimplification& other);
@@ -0,0 +1,223 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#ifndef TRITON_SYMBOLICTABLE_H
+#define TRITON_SYMBOLICTABLE_H
+
+#include <map>
+#include <memory>
+#include <vector>
+
+#include "tritonTypes.hpp"
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The Engines namespace
+  namespace engines {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup engines
+   *  @{
+   */
+
+    //! The Symbolic Execution namespace
+    namespace symbolic {
+    /*!
+     *  \ingroup engines
+     *  \addtogroup symbolic
+     *  @{
+     */
+
+      //! \class SymbolicTable
+      /*! \brief A dense table of pointers indexed by id.
+       *
+       * \description
+       * Symbolic expressions and variables get monotonic ids, so they are stored in fixed size
+       * chunks indexed by id instead of a tree. Removed entries are tombstones (nullptr), lookups
+       * are O(1) and chunks are only allocated when an id inside them is set and released when they
+       * become empty. Entries are owned by the table and shared with its copies, an entry is deleted
+       * once no table holds it anymore. Chunks are shared with the copies too and duplicated on their
+       * first write (copy-on-write), so copying a table costs one reference per chunk.
+       */
+      template <typename T>
+      class SymbolicTable {
+        private:
+          //! Number of bits of an id used to index a chunk.
+          static const triton::usize chunkBits = 12;
+
+          //! Number of entries per chunk.
+          static const triton::usize chunkSize = (1 << chunkBits);
+
+          //! A chunk of entries.
+          typedef std::vector<std::shared_ptr<T>> Chunk;
+
+          //! Chunks of entries, may be shared with copies of this table. nullptr if no entry of the chunk is set.
+          std::vector<std::shared_ptr<Chunk>> chunks;
+
+          //! Number of live entries per chunk.
+          std::vector<triton::usize> chunkCounts;
+
+          //! Number of live entries.
+          triton::usize count;
+
+          //! Returns a chunk which is not shared with another table. Allocates it if needed.
+          Chunk& getWritableChunk(triton::usize index) {
+            std::shared_ptr<Chunk>& chunk = this->chunks[index];
+
+            if (chunk == nullptr)
+              chunk = std::make_shared<Chunk>(chunkSize);
+
+            /* Copy-on-write, the shared chunk stays with the other tables */
+            else if (!chunk.unique())
+              chunk = std::make_shared<Chunk>(*chunk);
+
+            return *chunk;
+          }
+
+        public:
+          //! Constructor.
+          SymbolicTable() {
+            this->count = 0;
+          }
+
+          //! Returns the entry of an id or nullptr if there is none.
+          T* get(triton::usize id) const {
+            triton::usize index = (id >> chunkBits);
+            if (index >= this->chunks.size() || this->chunks[index] == nullptr)
+              return nullptr;
+            return (*this->chunks[index])[id & (chunkSize - 1)].get();
+          }
+
+          //! Returns true if an entry exists for an id.
+          bool contains(triton::usize id) const {
+            return this->get(id) != nullptr;
+          }
+
+          //! Sets the entry of an id and takes its ownership. A nullptr value removes the entry.
+          void set(triton::usize id, T* value) {
+            triton::usize index = (id >> chunkBits);
+
+            if (value == nullptr) {
+              this->erase(id);
+              return;
+            }
+
+            if (index >= this->chunks.size()) {
+              this->chunks.resize(index + 1);
+              this->chunkCounts.resize(index + 1, 0);
+            }
+
+            std::shared_ptr<T>& slot = this->getWritableChunk(index)[id & (chunkSize - 1)];
+            if (slot == nullptr) {
+              this->chunkCounts[index]++;
+              this->count++;
+            }
+            if (slot.get() != value)
+              slot.reset(value);
+          }
+
+          //! Removes the entry of an id and returns it (nullptr if there was none). The entry is deleted with the last holder.
+          std::shared_ptr<T> erase(triton::usize id) {
+            triton::usize index = (id >> chunkBits);
+            std::shared_ptr<T> old;
+
+            /* Do not duplicate a shared chunk for nothing */
+            if (!this->contains(id))
+              return old;
+
+            old.swap(this->getWritableChunk(index)[id & (chunkSize - 1)]);
+            this->count--;
+
+            /* Release empty chunks */
+            if (--this->chunkCounts[index] == 0)
+              this->chunks[index].reset();
+
+            return old;
+          }
+
+          //! Removes every entry.
+          void clear(void) {
+            this->chunks.clear();
+            this->chunkCounts.clear();
+            this->count = 0;
+          }
+
+          //! Returns the number of live entries.
+          triton::usize size(void) const {
+            return this->count;
+          }
+
+          //! Returns the estimated number of bytes used by the table and its entries. Shared chunks are counted by every table holding them.
+          triton::usize getMemoryUsage(void) const {
+            triton::usize chunks = 0;
+
+            for (triton::usize index = 0; index < this->chunks.size(); index++) {
+              if (this->chunks[index] != nullptr)
+                chunks++;
+            }
+
+            return this->chunks.capacity() * (sizeof(std::shared_ptr<Chunk>) + sizeof(triton::usize)) +
+                   chunks * (sizeof(Chunk) + chunkSize * sizeof(std::shared_ptr<T>)) +
+                   this->count * (sizeof(T) + 3 * sizeof(void*));
+          }
+
+          //! Returns an upper bound of ids which may have an entry.
+          triton::usize getUpperBound(void) const {
+            return this->chunks.size() << chunkBits;
+          }
+
+          //! Returns the ids which have an entry, in ascending order.
+          std::vector<triton::usize> getIds(void) const {
+            std::vector<triton::usize> ret;
+
+            ret.reserve(this->count);
+            for (triton::usize index = 0; index < this->chunks.size(); index++) {
+              if (this->chunks[index] == nullptr)
+                continue;
+              const Chunk& chunk = *this->chunks[index];
+              for (triton::usize offset = 0; offset < chunk.size(); offset++) {
+                if (chunk[offset] != nullptr)
+                  ret.push_back((index << chunkBits) | offset);
+              }
+            }
+
+            return ret;
+          }
+
+          //! Returns the entries as an ordered map.
+          std::map<triton::usize, T*> toMap(void) const {
+            std::map<triton::usize, T*> ret;
+
+            for (triton::usize index = 0; index < this->chunks.size(); index++) {
+              if (this->chunks[index] == nullptr)
+                continue;
+              const Chunk& chunk = *this->chunks[index];
+              for (triton::usize offset = 0; offset < chunk.size(); offset++) {
+                if (chunk[offset] != nullptr)
+                  ret.insert(ret.end(), std::make_pair((index << chunkBits) | offset, chunk[offset].get()));
+              }
+            }
+
+            return ret;
+          }
+      };
+
+    /*! @} End of symbolic namespace */
+    };
+  /*! @} End of engines namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_SYMBOLICTABLE_H */
@@ -8,6 +8,7 @@
 #ifndef TRITON_SYMBOLICVARIABLE_H
 #define TRITON_SYMBOLICVARIABLE_H
 
+#include <mutex>
 #include <string>
 
 #include "symbolicEnums.hpp"
@@ -49,7 +50,10 @@ namespace triton {
           std::string comment;
 
           //! The name of the symbolic variable. Names are always something like this: SymVar_X. \sa TRITON_SYMVAR_NAME
-          std::string name;
+          mutable std::string name;
+
+          //! Builds the name on the first call of getName(), most variables of a symbolized input are never named.
+          mutable std::once_flag nameBuilt;
 
           //! The id of the symbolic variable. This id is unique.
           triton::usize id;
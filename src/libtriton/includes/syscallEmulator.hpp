@@ -0,0 +1,189 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#ifndef TRITON_SYSCALLEMULATOR_H
+#define TRITON_SYSCALLEMULATOR_H
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include "tritonTypes.hpp"
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  class API;
+
+  //! The Operating System namespace
+  namespace os {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup os
+   *  @{
+   */
+
+    //! The Unix namespace
+    namespace unix {
+    /*!
+     *  \ingroup os
+     *  \addtogroup unix
+     *  @{
+     */
+
+      //! The Linux x86-64 syscalls emulated by triton::os::unix::SyscallEmulator.
+      enum linuxSyscalls64_e {
+        LINUX64_SYS_READ        = 0,   //!< read
+        LINUX64_SYS_WRITE       = 1,   //!< write
+        LINUX64_SYS_OPEN        = 2,   //!< open
+        LINUX64_SYS_CLOSE       = 3,   //!< close
+        LINUX64_SYS_LSEEK       = 8,   //!< lseek
+        LINUX64_SYS_MMAP        = 9,   //!< mmap
+        LINUX64_SYS_MUNMAP      = 11,  //!< munmap
+        LINUX64_SYS_BRK         = 12,  //!< brk
+        LINUX64_SYS_EXIT        = 60,  //!< exit
+        LINUX64_SYS_EXIT_GROUP  = 231, //!< exit_group
+        LINUX64_SYS_OPENAT      = 257, //!< openat
+      };
+
+      /*! \class SyscallEmulator
+       *  \brief Emulates the Linux x86-64 syscalls of a program run by triton::API::run().
+       *
+       * \description
+       * When it is enabled, a `syscall` instruction processed by triton::API::run() is followed by its emulation: the number
+       * and the arguments are read from the concrete registers, the result is written into `rax`, `rcx` and `r11` get the
+       * return address and the flags, and the memory written by the syscall is updated. A descriptor is only read or written
+       * if its access mode allows it, and a `write` takes at most 1 MiB per call. Files live in a virtual file system, `/dev/stdin`, `/dev/stdout` and `/dev/stderr` being the
+       * files of the descriptors 0, 1 and 2. The bytes returned by `read` are symbolized (one variable per byte) if the
+       * symbolic inputs are enabled. The syscalls which are not emulated return `-ENOSYS`.
+       */
+      class SyscallEmulator {
+        private:
+          //! An open file description.
+          struct Descriptor {
+            //! The path of the file in the virtual file system.
+            std::string path;
+
+            //! The current offset.
+            triton::uint64 offset;
+
+            //! The flags given to open.
+            triton::uint64 flags;
+          };
+
+          //! The API the syscalls are emulated on.
+          triton::API* api;
+
+          //! True if the emulation is enabled.
+          bool enabled;
+
+          //! True if the bytes read are symbolized.
+          bool symbolicInputs;
+
+          //! True once the program has called `exit` or `exit_group`.
+          bool exited;
+
+          //! The exit status of the program.
+          triton::uint64 exitStatus;
+
+          //! The start of the heap.
+          triton::uint64 brkBase;
+
+          //! The current end of the heap.
+          triton::uint64 brkCurrent;
+
+          //! The address of the next anonymous mapping.
+          triton::uint64 mmapNext;
+
+          //! The virtual file system, by path.
+          std::map<std::string, std::vector<triton::uint8>> files;
+
+          //! The open descriptors.
+          std::map<triton::uint64, Descriptor> descriptors;
+
+          //! Returns the string at `addr` in the concrete memory.
+          std::string readString(triton::uint64 addr) const;
+
+          //! Returns the lowest free descriptor.
+          triton::uint64 newDescriptor(void) const;
+
+          //! Emulates read(2).
+          triton::sint64 read(triton::uint64 fd, triton::uint64 buf, triton::uint64 count);
+
+          //! Emulates write(2).
+          triton::sint64 write(triton::uint64 fd, triton::uint64 buf, triton::uint64 count);
+
+          //! Emulates open(2).
+          triton::sint64 open(triton::uint64 path, triton::uint64 flags);
+
+          //! Emulates close(2).
+          triton::sint64 close(triton::uint64 fd);
+
+          //! Emulates lseek(2).
+          triton::sint64 lseek(triton::uint64 fd, triton::uint64 offset, triton::uint64 whence);
+
+          //! Emulates mmap(2).
+          triton::sint64 mmap(triton::uint64 addr, triton::uint64 length, triton::uint64 flags, triton::uint64 fd, triton::uint64 offset);
+
+          //! Emulates munmap(2).
+          triton::sint64 munmap(triton::uint64 addr, triton::uint64 length);
+
+          //! Emulates brk(2).
+          triton::sint64 brk(triton::uint64 addr);
+
+        public:
+          //! Constructor. The emulation is disabled.
+          SyscallEmulator(triton::API* api);
+
+          //! Enables or disables the emulation.
+          void enable(bool flag);
+
+          //! Returns true if the emulation is enabled.
+          bool isEnabled(void) const;
+
+          //! Symbolizes the bytes read (default) or not.
+          void setSymbolicInputs(bool flag);
+
+          //! Sets the start of the heap returned by `brk(0)`.
+          void setBrk(triton::uint64 addr);
+
+          //! Sets the address of the next anonymous mapping.
+          void setMmapBase(triton::uint64 addr);
+
+          //! Creates or replaces a file of the virtual file system.
+          void setFile(const std::string& path, const std::vector<triton::uint8>& content);
+
+          //! Returns the content of a file of the virtual file system, empty if it does not exist.
+          std::vector<triton::uint8> getFile(const std::string& path) const;
+
+          //! Returns true once the program has called `exit` or `exit_group`.
+          bool hasExited(void) const;
+
+          //! Returns the exit status of the program.
+          triton::uint64 getExitStatus(void) const;
+
+          //! Closes the descriptors, forgets the exit and restores the standard descriptors. The files are kept.
+          void reset(void);
+
+          //! Emulates the syscall described by the concrete registers. Returns false once the program has exited.
+          bool emulate(void);
+      };
+
+    /*! @} End of unix namespace */
+    };
+  /*! @} End of os namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_SYSCALLEMULATOR_H */
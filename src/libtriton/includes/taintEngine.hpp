@@ -8,11 +8,18 @@
 #ifndef TRITON_TAINTENGINE_H
 #define TRITON_TAINTENGINE_H
 
+#include <istream>
+#include <ostream>
 #include <set>
+#include <unordered_map>
+#include <vector>
 
 #include "memoryAccess.hpp"
 #include "register.hpp"
 #include "symbolicEngine.hpp"
+#include "taintLabels.hpp"
+#include "taintMemoryMap.hpp"
+#include "taintPlan.hpp"
 #include "tritonTypes.hpp"
 
 
@@ -57,11 +64,50 @@ namespace triton {
           //! Defines if the taint engine is enabled or disabled.
           bool enableFlag;
 
-          //! The set of tainted addresses.
-          std::set<triton::uint64> taintedMemory;
+          //! The shadow memory of tainted addresses.
+          triton::engines::taint::TaintMemoryMap taintedMemory;
 
-          //! The set of tainted registers. Currently it is an over approximation of the taint.
-          std::set<triton::arch::Register> taintedRegisters;
+          //! The tainted registers, as a bitmap indexed by parent register id. Currently it is an over approximation of the taint.
+          std::vector<bool> taintedRegisters;
+
+          //! The interned sets of labels. Mutable as the unions are also memoized when the labels are read.
+          mutable triton::engines::taint::TaintLabels labels;
+
+          //! The set of labels of each labeled byte. The bytes without labels are not stored.
+          std::unordered_map<triton::uint64, triton::uint32> memoryLabels;
+
+          //! The set of labels of each register, indexed by parent register id.
+          std::vector<triton::uint32> registerLabels;
+
+          //! True once a label has been attached. The labels are not spread before.
+          bool labelsUsed;
+
+          //! The number of entries of the journals when a journal has been started. \sa startJournal().
+          struct JournalMark {
+            //! The number of entries of `journalRegisters`.
+            triton::usize registers;
+
+            //! The number of entries of `journalRegisterLabels`.
+            triton::usize registerLabels;
+
+            //! The number of entries of `journalMemoryLabels`.
+            triton::usize memoryLabels;
+          };
+
+          //! The journals started, the innermost last.
+          std::vector<JournalMark> journalMarks;
+
+          //! Previous taint of the registers written (parent id, taint).
+          std::vector<std::pair<triton::uint32, bool>> journalRegisters;
+
+          //! Previous label sets of the registers written (parent id, set).
+          std::vector<std::pair<triton::uint32, triton::uint32>> journalRegisterLabels;
+
+          //! Previous label sets of the bytes written (address, set).
+          std::vector<std::pair<triton::uint64, triton::uint32>> journalMemoryLabels;
+
+          //! Sets the taint of a parent register and records the previous one into the journal.
+          void setRegisterTaint(triton::uint32 parent, bool flag);
 
           //! Copies a TaintEngine.
           void copy(const TaintEngine& other);
@@ -83,10 +129,22 @@ namespace triton {
           void enable(bool flag);
 
           //! Returns the tainted addresses.
-          const std::set<triton::uint64>& getTaintedMemory(void) const;
+          std::set<triton::uint64> getTaintedMemory(void) const;
+
+          //! Calls `callback` with the address and the size of every range of tainted memory, in ascending order, without building a set.
+          void forEachTaintedMemoryRange(const std::function<void(triton::uint64, triton::usize)>& callback) const;
 
           //! Returns the tainted registers.
-          const std::set<triton::arch::Register>& getTaintedRegisters(void) const;
+          std::set<triton::arch::Register> getTaintedRegisters(void) const;
+
+          //! Returns the number of tainted bytes.
+          triton::usize getNumberOfTaintedBytes(void) const;
+
+          //! Returns the number of tainted registers.
+          triton::usize getNumberOfTaintedRegisters(void) const;
+
+          //! Returns the estimated number of bytes used by the shadow memory, the tainted registers and the labels.
+          triton::usize getMemoryUsage(void) const;
 
           //! Returns true if the taint engine is enabled.
           bool isEnabled(void) const;
@@ -103,6 +161,21 @@ namespace triton {
           //! Abstract taint verification. Returns true if the operand is tainted.
           bool isTainted(const triton::arch::OperandWrapper& op) const;
 
+          //! Starts recording the previous taint and labels of the registers and the memory written into a journal. Journals are nested.
+          void startJournal(void);
+
+          //! Restores the taint and the labels written since the innermost journal has been started and stops it.
+          void rollbackJournal(void);
+
+          //! Stops every journal and keeps the changes they recorded.
+          void clearJournal(void);
+
+          //! Writes the tainted registers, the shadow memory and the labels to a stream.
+          void serializeState(std::ostream& stream) const;
+
+          //! Replaces the taint and the labels by the ones written by serializeState(). Journals are stopped. Raises a triton::exceptions::TaintEngine if the stream is truncated.
+          void deserializeState(std::istream& stream);
+
           //! Sets the flag (taint or untaint) to an abstract operand (Register or Memory).
           bool setTaint(const triton::arch::OperandWrapper& op, bool flag);
 
@@ -121,21 +194,53 @@ namespace triton {
           //! Taints a register. Returns TAINTED if the register has been tainted correctly. Otherwise it returns the last defined state.
           bool taintRegister(const triton::arch::Register& reg);
 
+          //! Taints a memory area. Returns TAINTED if the area has been tainted correctly. Otherwise it returns the last defined state.
+          bool taintMemoryArea(triton::uint64 baseAddr, triton::usize size);
+
+          //! Spreads the taint of a copy of `size` bytes from `src` to `dst` (e.g. memcpy). Returns TAINTED if the destination is tainted.
+          bool taintAssignmentMemoryArea(triton::uint64 dst, triton::uint64 src, triton::usize size);
+
+          //! Spreads the taint of a union of `size` bytes from `src` into `dst`. Returns TAINTED if the destination is tainted.
+          bool taintUnionMemoryArea(triton::uint64 dst, triton::uint64 src, triton::usize size);
+
           //! Untaints an address. Returns !TAINTED if the address has been untainted correctly. Otherwise it returns the last defined state.
           bool untaintMemory(triton::uint64 addr);
 
           //! Untaints a memory. Returns !TAINTED if the memory has been untainted correctly. Otherwise it returns the last defined state.
           bool untaintMemory(const triton::arch::MemoryAccess& mem);
 
+          //! Untaints a memory area. Returns !TAINTED if the area has been untainted correctly. Otherwise it returns the last defined state.
+          bool untaintMemoryArea(triton::uint64 baseAddr, triton::usize size);
+
           //! Untaints a register. Returns !TAINTED if the register has been untainted correctly. Otherwise it returns the last defined state.
           bool untaintRegister(const triton::arch::Register& reg);
 
+          //! Taints an address with a label added to its labels. Returns TAINTED if the address has been tainted correctly. Otherwise it returns the last defined state.
+          bool labelMemory(triton::uint64 addr, triton::uint32 label);
+
+          //! Taints a register with a label added to its labels. Returns TAINTED if the register has been tainted correctly. Otherwise it returns the last defined state.
+          bool labelRegister(const triton::arch::Register& reg, triton::uint32 label);
+
+          //! Returns the labels of a memory area.
+          std::set<triton::uint32> getMemoryLabels(triton::uint64 addr, triton::usize size=1) const;
+
+          //! Returns the labels of a register.
+          std::set<triton::uint32> getRegisterLabels(const triton::arch::Register& reg) const;
+
           //! Abstract union tainting.
           bool taintUnion(const triton::arch::OperandWrapper& op1, const triton::arch::OperandWrapper& op2);
 
           //! Abstract assignment tainting.
           bool taintAssignment(const triton::arch::OperandWrapper& op1, const triton::arch::OperandWrapper& op2);
 
+          /*!
+           * \brief Runs a taint plan on the operands of an instruction and sets `tainted` to its result.
+           *
+           * \description Returns false, without spreading anything, if the engine is disabled or if labels are used. The
+           * taint of the symbolic expressions of the memory written is not updated, plans are meant for taint only analyses.
+           */
+          bool runPlan(const TaintPlan& plan, const std::vector<triton::arch::OperandWrapper>& operands, bool& tainted);
+
           //! Taints MemoryImmediate with union. Returns true if the memDst is TAINTED.
           bool taintUnionMemoryImmediate(const triton::arch::MemoryAccess& memDst);
 
@@ -173,6 +278,18 @@ namespace triton {
           bool taintAssignmentRegisterRegister(const triton::arch::Register& regDst, const triton::arch::Register& regSrc);
 
         private:
+          //! Returns the set of labels of a memory area, the union of the sets of its bytes.
+          triton::uint32 getMemoryLabelSet(triton::uint64 addr, triton::usize size) const;
+
+          //! Sets the set of labels of a memory area.
+          void setMemoryLabelSet(triton::uint64 addr, triton::usize size, triton::uint32 set);
+
+          //! Returns the set of labels of a register.
+          triton::uint32 getRegisterLabelSet(const triton::arch::Register& reg) const;
+
+          //! Sets the set of labels of a register.
+          void setRegisterLabelSet(const triton::arch::Register& reg, triton::uint32 set);
+
           //! Spreads MemoryImmediate with union.
           bool unionMemoryImmediate(const triton::arch::MemoryAccess& memDst);
 
@@ -0,0 +1,98 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#ifndef TRITON_TAINTLABELS_H
+#define TRITON_TAINTLABELS_H
+
+#include <map>
+#include <unordered_map>
+#include <vector>
+
+#include "tritonTypes.hpp"
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The Engines namespace
+  namespace engines {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup engines
+   *  @{
+   */
+
+    //! The Taint namespace
+    namespace taint {
+    /*!
+     *  \ingroup engines
+     *  \addtogroup taint
+     *  @{
+     */
+
+      //! The id of the empty set of labels.
+      const triton::uint32 NO_LABEL = 0;
+
+      //! \class TaintLabels
+      /*! \brief The interned sets of taint labels.
+       *
+       * \description
+       * Every distinct set of labels is stored once and referred to by a 32-bit id, so a tainted byte or
+       * register only carries an id. The union of two sets is memoized by pair of ids, so spreading the
+       * labels of an instruction is a table lookup once the union has been seen. Sets are never freed
+       * until the labels are cleared.
+       */
+      class TaintLabels {
+        private:
+          //! The sets of labels by id, sorted. The set 0 is the empty set.
+          std::vector<std::vector<triton::uint32>> sets;
+
+          //! The ids of the sets.
+          std::map<std::vector<triton::uint32>, triton::uint32> ids;
+
+          //! The memoized unions, keyed by the pair of ids (smallest first).
+          std::unordered_map<triton::uint64, triton::uint32> unions;
+
+          //! Returns the id of a sorted set of labels, interning it if needed.
+          triton::uint32 intern(const std::vector<triton::uint32>& labels);
+
+        public:
+          //! Constructor.
+          TaintLabels();
+
+          //! Returns the id of the set which only contains `label`.
+          triton::uint32 single(triton::uint32 label);
+
+          //! Returns the id of the union of two sets.
+          triton::uint32 merge(triton::uint32 set1, triton::uint32 set2);
+
+          //! Returns the labels of a set. Raises a triton::exceptions::TaintEngine if the id is invalid.
+          const std::vector<triton::uint32>& getLabels(triton::uint32 set) const;
+
+          //! Returns the number of distinct sets, the empty set included.
+          triton::usize size(void) const;
+
+          //! Returns the estimated number of bytes used by the sets and the memoized unions.
+          triton::usize getMemoryUsage(void) const;
+
+          //! Removes every set but the empty one.
+          void clear(void);
+      };
+
+    /*! @} End of taint namespace */
+    };
+  /*! @} End of engines namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_TAINTLABELS_H */
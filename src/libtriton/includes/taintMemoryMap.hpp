@@ -0,0 +1,217 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#ifndef TRITON_TAINTMEMORYMAP_H
+#define TRITON_TAINTMEMORYMAP_H
+
+#include <functional>
+#include <istream>
+#include <map>
+#include <ostream>
+#include <set>
+#include <vector>
+
+#include "hugePageArena.hpp"
+#include "tritonTypes.hpp"
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The Engines namespace
+  namespace engines {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup engines
+   *  @{
+   */
+
+    //! The Taint namespace
+    namespace taint {
+    /*!
+     *  \ingroup engines
+     *  \addtogroup taint
+     *  @{
+     */
+
+      //! \class TaintMemoryMap
+      /*! \brief The shadow memory of the taint engine.
+       *
+       * \description
+       * One bit per byte of memory, grouped into 4 KiB pages of 64-bit words. Pages are allocated on
+       * demand and released when they become untainted. Accesses and ranges are checked and updated
+       * a word at a time, and the copies between ranges of the same alignment use SSE2 (or AVX2) kernels.
+       *
+       * The whole pages of a tainted range are stored as runs of page numbers instead of bitmaps, so that
+       * tainting or untainting a large area (e.g. a mapped input file) does not depend on its size. The page of
+       * a run is split into a bitmap on its first partial write.
+       */
+      class TaintMemoryMap {
+        public:
+          //! Number of bits of an address used to index a page.
+          static const triton::uint32 pageBits = 12;
+
+          //! Number of bytes per page.
+          static const triton::uint64 pageSize = (1 << pageBits);
+
+          //! Number of words per page.
+          static const triton::uint32 wordsPerPage = (pageSize / 64);
+
+        private:
+          //! A page of shadow bits.
+          struct Page {
+            //! The shadow bits, one per byte.
+            triton::uint64 words[wordsPerPage];
+
+            //! Number of tainted bytes in the page.
+            triton::uint32 count;
+          };
+
+          //! Pages indexed by their page number, allocated from the huge page arena (HUGE_PAGES mode).
+          std::map<triton::uint64, Page, std::less<triton::uint64>, triton::utils::HugePageAllocator<std::pair<const triton::uint64, Page>>> pages;
+
+          //! Runs of whole tainted pages, the first page number -> the page number after the run. They have no page in `pages`.
+          std::map<triton::uint64, triton::uint64> runs;
+
+          //! Number of tainted bytes.
+          triton::usize count;
+
+          //! A range of bytes of the same taint.
+          struct Extent {
+            //! The first address.
+            triton::uint64 addr;
+
+            //! The number of bytes.
+            triton::usize size;
+
+            //! True if the bytes are tainted.
+            bool tainted;
+          };
+
+          //! The previous taint of the ranges written since the journals have been started, in the order they have been written.
+          std::vector<Extent> journal;
+
+          //! The number of entries of `journal` when each journal has been started, the innermost last.
+          std::vector<triton::usize> journalMarks;
+
+          //! Records the taint of a range into the journal before it is written.
+          void record(triton::uint64 addr, triton::usize size);
+
+          //! Page number of the cached page.
+          mutable triton::uint64 cachedNumber;
+
+          //! The cached page. nullptr if there is no page cached.
+          mutable Page* cachedPage;
+
+          //! Returns the page of a run, every bit is set.
+          static const Page* getFullPage(void);
+
+          //! Returns the page of an address to be read, the full page if it is in a run, or nullptr if it is untainted.
+          const Page* findPage(triton::uint64 addr) const;
+
+          //! Returns the page of an address to be written or nullptr if it is untainted. Splits the run of the page.
+          Page* getPage(triton::uint64 addr);
+
+          //! Returns the page of an address to be written and allocates it if needed. Splits the run of the page.
+          Page* getOrCreatePage(triton::uint64 addr);
+
+          //! Releases the page of an address.
+          void releasePage(triton::uint64 addr);
+
+          //! Returns the run of a page number or the end of the runs.
+          std::map<triton::uint64, triton::uint64>::const_iterator findRun(triton::uint64 number) const;
+
+          //! Taints the pages from `first` to `end` (excluded) as a run.
+          void addRun(triton::uint64 first, triton::uint64 end);
+
+          //! Untaints the pages from `first` to `end` (excluded).
+          void removePages(triton::uint64 first, triton::uint64 end);
+
+          //! Taints or untaints the bits of a range of bytes which fits in a page.
+          void setBits(triton::uint64 addr, triton::uint32 size, bool flag);
+
+          //! Taints or untaints a range of bytes, whole pages at once.
+          void setRange(triton::uint64 addr, triton::usize size, bool flag);
+
+          //! Copies or merges (OR) a range of shadow bits which fits in a word of the source and a word of the destination.
+          void transferBits(triton::uint64 dst, triton::uint64 src, triton::uint32 size, bool merge);
+
+          //! Copies or merges (OR) whole words of shadow bits between two pages. Returns the number of bytes transferred.
+          triton::usize transferWords(triton::uint64 dst, triton::uint64 src, triton::usize size, bool merge);
+
+          //! Copies or merges (OR) a range of shadow bits, from the lowest to the highest address.
+          void transfer(triton::uint64 dst, triton::uint64 src, triton::usize size, bool merge);
+
+        public:
+          //! Constructor.
+          TaintMemoryMap();
+
+          //! Constructor by copy.
+          TaintMemoryMap(const TaintMemoryMap& other);
+
+          //! Copies a TaintMemoryMap.
+          void operator=(const TaintMemoryMap& other);
+
+          //! Returns true if at least one byte of the range is tainted.
+          bool isTainted(triton::uint64 addr, triton::usize size=1) const;
+
+          //! Taints a range of bytes.
+          void taint(triton::uint64 addr, triton::usize size=1);
+
+          //! Untaints a range of bytes.
+          void untaint(triton::uint64 addr, triton::usize size=1);
+
+          //! Copies the taint of a range of bytes to another one, as memmove() would copy the bytes.
+          void copy(triton::uint64 dst, triton::uint64 src, triton::usize size);
+
+          //! Merges (OR) the taint of a range of bytes into another one.
+          void merge(triton::uint64 dst, triton::uint64 src, triton::usize size);
+
+          //! Untaints every byte. This is not journaled.
+          void clear(void);
+
+          //! Starts recording the previous taint of the ranges written into a journal. Journals are nested.
+          void startJournal(void);
+
+          //! Restores the ranges written since the innermost journal has been started and stops it.
+          void rollbackJournal(void);
+
+          //! Stops every journal and keeps the changes they recorded.
+          void clearJournal(void);
+
+          //! Returns the number of tainted bytes.
+          triton::usize size(void) const;
+
+          //! Returns the tainted addresses.
+          std::set<triton::uint64> toSet(void) const;
+
+          //! Calls `callback` with the address and the size of every range of tainted bytes, in ascending order of address. Adjacent ranges are merged.
+          void forEachRange(const std::function<void(triton::uint64, triton::usize)>& callback) const;
+
+          //! Returns the estimated number of bytes used by the pages and the runs.
+          triton::usize getMemoryUsage(void) const;
+
+          //! Writes the runs and the pages to a stream.
+          void save(std::ostream& stream) const;
+
+          //! Replaces the taint by the one written by save(). This is not journaled. Raises a triton::exceptions::TaintEngine if the stream is truncated.
+          void load(std::istream& stream);
+      };
+
+    /*! @} End of taint namespace */
+    };
+  /*! @} End of engines namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_TAINTMEMORYMAP_H */
@@ -0,0 +1,104 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#ifndef TRITON_TAINTPLAN_H
+#define TRITON_TAINTPLAN_H
+
+#include <vector>
+
+#include "tritonTypes.hpp"
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The Engines namespace
+  namespace engines {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup engines
+   *  @{
+   */
+
+    //! The Taint namespace
+    namespace taint {
+    /*!
+     *  \ingroup engines
+     *  \addtogroup taint
+     *  @{
+     */
+
+      //! The operations of the steps of a taint plan.
+      enum plan_op_e {
+        PLAN_ASSIGN = 0,  /*!< The destination takes the taint of the source, as TaintEngine::taintAssignment(). */
+        PLAN_UNION,       /*!< The destination takes the union of its taint and of the source, as TaintEngine::taintUnion(). */
+        PLAN_TEST,        /*!< The taint of the destination is added to the result. */
+        PLAN_SET,         /*!< The destination register takes the result. */
+        PLAN_CLEAR,       /*!< The destination register is untainted. */
+      };
+
+      //! The kinds of the locations of a step.
+      enum plan_location_e {
+        LOCATION_NONE = 0,  /*!< No location. */
+        LOCATION_IMMEDIATE, /*!< An immediate, never tainted. */
+        LOCATION_REGISTER,  /*!< A register, by parent id. */
+        LOCATION_MEMORY,    /*!< A memory operand of the instruction, by operand index. */
+      };
+
+      //! A location read or written by a step.
+      struct TaintLocation {
+        //! The kind of the location as plan_location_e.
+        triton::uint8 kind;
+
+        //! The parent id of a register or the index of a memory operand.
+        triton::uint32 index;
+      };
+
+      //! A step of a taint plan.
+      struct TaintStep {
+        //! The operation as plan_op_e.
+        triton::uint8 op;
+
+        //! The location written (or read by PLAN_TEST).
+        TaintLocation dst;
+
+        //! The location read by PLAN_ASSIGN and PLAN_UNION.
+        TaintLocation src;
+      };
+
+      /*! \class TaintPlan
+       *  \brief The taint spreading of an instruction, compiled once for the shape of its operands.
+       *
+       * \description
+       * The registers are resolved to their parent id and the memory operands to their index, so running a plan does
+       * not dispatch on the types of the operands. The result of a plan is the result of its last PLAN_ASSIGN or
+       * PLAN_UNION, or the union of its PLAN_TEST steps. See TaintEngine::runPlan().
+       */
+      class TaintPlan {
+        public:
+          //! The steps, run in order.
+          std::vector<TaintStep> steps;
+
+          //! Adds a step.
+          void add(triton::uint8 op, const TaintLocation& dst, const TaintLocation& src=TaintLocation{LOCATION_NONE, 0}) {
+            this->steps.push_back(TaintStep{op, dst, src});
+          }
+      };
+
+    /*! @} End of taint namespace */
+    };
+  /*! @} End of engines namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_TAINTPLAN_H */
@@ -0,0 +1,112 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#ifndef TRITON_TRACEEVENTS_H
+#define TRITON_TRACEEVENTS_H
+
+#include <atomic>
+#include <ostream>
+
+#include "coreUtils.hpp"
+#include "tritonTypes.hpp"
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The Utils namespace
+  namespace utils {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup utils
+   *  @{
+   */
+
+    /*! \class TraceEvents
+     *  \brief Records the spans of the pipeline in the Chrome trace-event format.
+     *
+     * \description
+     * Spans (disassembly, semantics, post IR, callbacks and solver queries) are appended to a buffer owned by
+     * the thread which records them, so threads do not contend with each other. dump() writes every buffer as
+     * a JSON document which can be loaded by chrome://tracing or Perfetto. The recorder is shared by the whole
+     * process and enabled by the TRACE_EVENTS mode. While it is disabled, a span only costs the test of a flag.
+     */
+    class TraceEvents {
+      private:
+        //! True while spans are recorded.
+        static std::atomic<bool> enabled;
+
+      public:
+        //! Maximum number of spans buffered per thread. Next spans are dropped until the buffers are cleared.
+        static const triton::usize maxEventsPerThread = (1 << 20);
+
+        //! Returns true while spans are recorded.
+        static bool isEnabled(void) {
+          return enabled.load(std::memory_order_relaxed);
+        }
+
+        //! Enables or disables the recording. Spans already recorded are kept.
+        static void enable(bool flag);
+
+        //! Records a complete span of the calling thread. `name` and `category` must be string literals.
+        static void record(const char* name, const char* category, triton::uint64 start, triton::uint64 end);
+
+        //! Writes every recorded span as a Chrome trace-event JSON document (timestamps in microseconds).
+        static void dump(std::ostream& stream);
+
+        //! Removes every recorded span.
+        static void clear(void);
+    };
+
+
+    /*! \class TraceSpan
+     *  \brief Records a span from its construction to its destruction while the trace events are enabled.
+     */
+    class TraceSpan {
+      private:
+        //! The name of the span.
+        const char* name;
+
+        //! The category of the span.
+        const char* category;
+
+        //! The start of the span. 0 if the trace events are disabled.
+        triton::uint64 start;
+
+      public:
+        //! Constructor. `name` and `category` must be string literals.
+        TraceSpan(const char* name, const char* category) {
+          this->name     = name;
+          this->category = category;
+          this->start    = (TraceEvents::isEnabled() ? triton::utils::getMonotonicTime() : 0);
+        }
+
+        //! Destructor. Records the span.
+        ~TraceSpan() {
+          if (this->start != 0)
+            TraceEvents::record(this->name, this->category, this->start, triton::utils::getMonotonicTime());
+        }
+
+      private:
+        //! Disallows copies. A span is recorded once.
+        TraceSpan(const TraceSpan& other);
+
+        //! Disallows copies. A span is recorded once.
+        void operator=(const TraceSpan& other);
+    };
+
+  /*! @} End of utils namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_TRACEEVENTS_H */
@@ -0,0 +1,240 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#ifndef TRITON_TRACEFILE_H
+#define TRITON_TRACEFILE_H
+
+#include <fstream>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "mappedFile.hpp"
+#include "tritonTypes.hpp"
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The Format namespace
+  namespace format {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup format
+   *  @{
+   */
+
+    //! An instruction of an execution trace.
+    struct TraceInstruction {
+      //! The address of the instruction.
+      triton::uint64 address;
+
+      //! The thread which executed the instruction.
+      triton::uint32 threadId;
+
+      //! The opcodes of the instruction.
+      std::vector<triton::uint8> opcodes;
+
+      //! The concrete values of the registers (register id, value) before the instruction.
+      std::vector<std::pair<triton::uint32, triton::uint512>> registers;
+
+      //! The memory read by the instruction (address, bytes).
+      std::vector<std::pair<triton::uint64, std::vector<triton::uint8>>> memoryReads;
+    };
+
+
+    //! A chunk of an execution trace.
+    struct TraceChunk {
+      //! The offset of the first record of the chunk in the file.
+      triton::uint64 offset;
+
+      //! The number of the first instruction of the chunk.
+      triton::uint64 firstInstruction;
+
+      //! The address following the instruction preceding the chunk.
+      triton::uint64 nextAddress;
+
+      //! The address of the memory read preceding the chunk.
+      triton::uint64 lastMemoryAddress;
+    };
+
+
+    /*! \class TraceWriter
+     *  \brief Records an execution trace into a file.
+     *
+     * \description
+     * The file starts with a header giving the architecture, followed by one record per instruction. Only the
+     * registers which changed since the previous instruction of the same thread are written, and integers are
+     * written as variable-length deltas, so a record of straight-line code usually takes a few bytes besides its
+     * opcodes and memory reads.
+     *
+     * The records are grouped into chunks of `chunkSize` instructions. The first record of each thread in a chunk
+     * holds all its registers, so a chunk is a concrete checkpoint from which the trace may be replayed. The
+     * index of the chunks is written after the records when the trace is closed.
+     */
+    class TraceWriter {
+      private:
+        //! The trace file.
+        std::ofstream stream;
+
+        //! The number of bytes written.
+        triton::uint64 offset;
+
+        //! The number of instructions written.
+        triton::uint64 count;
+
+        //! The number of instructions of a chunk.
+        triton::usize chunkSize;
+
+        //! The chunks written.
+        std::vector<TraceChunk> chunks;
+
+        //! The address following the previous instruction.
+        triton::uint64 nextAddress;
+
+        //! The address of the previous memory read.
+        triton::uint64 lastMemoryAddress;
+
+        //! The last values written for the registers of each thread.
+        std::map<triton::uint32, std::map<triton::uint32, triton::uint512>> registers;
+
+        //! Writes an unsigned variable-length integer.
+        void writeVarint(triton::uint64 value);
+
+        //! Writes a signed variable-length integer.
+        void writeSignedVarint(triton::sint64 value);
+
+        //! Writes raw bytes.
+        void writeBytes(const triton::uint8* data, triton::usize size);
+
+        //! Writes the index of the chunks.
+        void writeIndex(void);
+
+      public:
+        //! The default number of instructions of a chunk.
+        static const triton::usize defaultChunkSize = 1 << 16;
+
+        //! Constructor.
+        TraceWriter();
+
+        //! Creates a trace file for an architecture (see triton::arch::architectures_e), cut into chunks of `chunkSize` instructions. Raises an exception on failure.
+        void open(const std::string& path, triton::uint32 architecture, triton::usize chunkSize=defaultChunkSize);
+
+        //! Returns true if a trace file is open.
+        bool isOpen(void) const;
+
+        //! Records an instruction. `inst.registers` may hold all registers, only the ones which changed are written.
+        void write(const TraceInstruction& inst);
+
+        //! Writes the index, flushes and closes the trace file.
+        void close(void);
+    };
+
+
+    /*! \class TraceReader
+     *  \brief Reads an execution trace recorded by a triton::format::TraceWriter.
+     *
+     * \description
+     * The file is mapped into memory and records are decoded one after another. The registers of a record
+     * are the ones which changed since the previous instruction of the same thread. The index of the chunks
+     * gives a direct access to any instruction (see seek()), so distinct readers may replay distinct parts
+     * of the trace in parallel. A trace without index (not closed or of the first version) is a single chunk.
+     */
+    class TraceReader {
+      private:
+        //! The trace file.
+        triton::format::MappedFile file;
+
+        //! The offset of the next record.
+        triton::usize offset;
+
+        //! The offset following the last record.
+        triton::usize end;
+
+        //! The number of the next instruction.
+        triton::uint64 position;
+
+        //! The number of instructions of the trace, given by the index.
+        triton::uint64 count;
+
+        //! True if the trace has an index.
+        bool indexed;
+
+        //! The chunks of the trace.
+        std::vector<TraceChunk> chunks;
+
+        //! The registers of the instructions skipped by seek(), given with the next instruction of their thread.
+        std::map<triton::uint32, std::map<triton::uint32, triton::uint512>> skipped;
+
+        //! The architecture of the trace.
+        triton::uint32 architecture;
+
+        //! The address following the previous instruction.
+        triton::uint64 nextAddress;
+
+        //! The address of the previous memory read.
+        triton::uint64 lastMemoryAddress;
+
+        //! Reads an unsigned variable-length integer.
+        triton::uint64 readVarint(void);
+
+        //! Reads a signed variable-length integer.
+        triton::sint64 readSignedVarint(void);
+
+        //! Returns a pointer on the next `size` bytes and skips them. Raises an exception if the file is truncated.
+        const triton::uint8* readBytes(triton::usize size);
+
+        //! Reads the index at the end of the file, if any.
+        void readIndex(triton::usize header);
+
+        //! Decodes the next record. Returns false at the end of the trace.
+        bool decode(TraceInstruction& inst);
+
+      public:
+        //! Constructor.
+        TraceReader();
+
+        //! Opens a trace file. Raises an exception if it is not a trace.
+        void open(const std::string& path);
+
+        //! Returns the architecture of the trace (see triton::arch::architectures_e).
+        triton::uint32 getArchitecture(void) const;
+
+        //! Reads the next instruction. Returns false at the end of the trace.
+        bool next(TraceInstruction& inst);
+
+        //! Returns true if the trace has an index.
+        bool isIndexed(void) const;
+
+        //! Returns the number of instructions of the trace. Counts them if the trace has no index.
+        triton::uint64 getInstructionCount(void);
+
+        //! Returns the chunks of the trace.
+        const std::vector<TraceChunk>& getChunks(void) const;
+
+        //! Returns the number of the next instruction.
+        triton::uint64 getPosition(void) const;
+
+        /*!
+         * Moves to an instruction, from the start of its chunk. The next instruction of each thread is given
+         * with all the registers known at this point. Returns false if the trace has fewer instructions.
+         */
+        bool seek(triton::uint64 instruction);
+    };
+
+  /*! @} End of format namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_TRACEFILE_H */
@@ -8,6 +8,7 @@
 #ifndef TRITON_TRITONTOZ3AST_H
 #define TRITON_TRITONTOZ3AST_H
 
+#include <unordered_map>
 #include <z3++.h>
 
 #include "ast.hpp"
@@ -46,6 +47,21 @@ namespace triton {
         //! The map of symbols. E.g: (let (symbols expr1) expr2)
         std::map<std::string, triton::ast::AbstractNode*> symbols;
 
+        //! The translated nodes of the AST being evaluated. Persistent translations also hold a reference on their node.
+        std::unordered_map<triton::ast::AbstractNode*, z3::expr> translations;
+
+        //! If true, translations are kept between evaluations.
+        bool persistent;
+
+        //! The revision of the symbolic expressions when translations were made.
+        triton::usize revision;
+
+        //! Returns the translation of a node. Nodes are translated after their children.
+        z3::expr& getExpr(triton::ast::AbstractNode& e);
+
+        //! Records the translation of a node.
+        void setExpr(triton::ast::AbstractNode& e, z3::expr& expr);
+
       protected:
         //! The result.
         Z3Result result;
@@ -60,9 +76,23 @@ namespace triton {
         //! Evaluates a Triton AST.
         virtual Z3Result& eval(triton::ast::AbstractNode& e);
 
+        //! Returns the Z3 context of the translated expressions.
+        z3::context& getContext(void);
+
+        //! Keeps translations between evaluations, so shared sub-ASTs are translated once per context. Only symbolic (not evaluated) translations are kept.
+        void setPersistent(bool flag);
+
+        //! Removes every translation. If `release` is false, the nodes are not dereferenced (e.g. they are about to be freed).
+        void clearTranslations(bool release=true);
+
+        //! Binds the translator to a symbolic engine and a kind of conversion, and drops its translations and symbols. The Z3 context is kept.
+        void reset(triton::engines::symbolic::SymbolicEngine* symbolicEngine, bool eval=true);
+
         //! Evaluate operator.
         virtual void operator()(triton::ast::AbstractNode& e);
         //! Evaluate operator.
+        virtual void operator()(triton::ast::ArrayNode& e);
+        //! Evaluate operator.
         virtual void operator()(triton::ast::AssertNode& e);
         //! Evaluate operator.
         virtual void operator()(triton::ast::BvaddNode& e);
@@ -153,12 +183,20 @@ namespace triton {
         //! Evaluate operator.
         virtual void operator()(triton::ast::ReferenceNode& e);
         //! Evaluate operator.
+        virtual void operator()(triton::ast::SelectNode& e);
+        //! Evaluate operator.
+        virtual void operator()(triton::ast::StoreNode& e);
+        //! Evaluate operator.
         virtual void operator()(triton::ast::StringNode& e);
         //! Evaluate operator.
         virtual void operator()(triton::ast::SxNode& e);
         //! Evaluate operator.
+        virtual void operator()(triton::ast::VaddNode& e);
+        //! Evaluate operator.
         virtual void operator()(triton::ast::VariableNode& e);
         //! Evaluate operator.
+        virtual void operator()(triton::ast::VeqNode& e);
+        //! Evaluate operator.
         virtual void operator()(triton::ast::ZxNode& e);
     };
 
@@ -14,8 +14,10 @@
 
 #include "callbacks.hpp"
 #include "cpuInterface.hpp"
+#include "decodeCache.hpp"
 #include "instruction.hpp"
 #include "memoryAccess.hpp"
+#include "pagedMemory.hpp"
 #include "register.hpp"
 #include "registerSpecification.hpp"
 #include "tritonTypes.hpp"
@@ -53,14 +55,18 @@ namespace triton {
           //! Callbacks API
           triton::callbacks::Callbacks* callbacks;
 
+          //! The Capstone handle (a `csh`), opened on the first disassembly. 0 if it is not opened yet.
+          mutable triton::usize handle;
+
+          //! The cache of decoded instructions.
+          mutable triton::arch::DecodeCache decodeCache;
+
+          //! Gives the pages of a range which are not allocated to the MEMORY_MISS callbacks.
+          void resolveMemoryMisses(triton::uint64 baseAddr, triton::usize size) const;
+
         protected:
-          /*! \brief map of address -> concrete value
-           *
-           * \description
-           * **item1**: memory address<br>
-           * **item2**: concrete value
-           */
-          std::map<triton::uint64, triton::uint8> memory;
+          //! The concrete memory.
+          triton::arch::PagedMemory memory;
 
           //! Concrete value of eax
           triton::uint8 eax[DWORD_SIZE];
@@ -193,6 +199,12 @@ namespace triton {
           //! Copies a x86Cpu class.
           void copy(const x86Cpu& other);
 
+          //! Sets the concrete values of the registers of a context at once. Callbacks are not executed.
+          void setConcreteRegisterContext(const triton::arch::x86::RegisterContext& context);
+
+          //! Returns the concrete values of the registers of a context at once. Callbacks are not executed.
+          void getConcreteRegisterContext(triton::arch::x86::RegisterContext& context) const;
+
           //! Returns true if regId is a GRP.
           bool isGPR(triton::uint32 regId) const;
 
@@ -219,7 +231,11 @@ namespace triton {
           std::set<triton::arch::Register*> getAllRegisters(void) const;
           std::set<triton::arch::Register*> getParentRegisters(void) const;
           std::vector<triton::uint8> getConcreteMemoryAreaValue(triton::uint64 baseAddr, triton::usize size, bool execCallbacks=true) const;
+          void getConcreteMemoryAreaValue(triton::uint64 baseAddr, triton::uint8* area, triton::usize size, bool execCallbacks=true) const;
           triton::arch::RegisterSpecification getRegisterSpecification(triton::uint32 regId) const;
+          const triton::arch::RegisterSpecificationEntry& getRegisterSpecificationEntry(triton::uint32 regId) const;
+          triton::usize getNumberOfMemoryPages(void) const;
+          triton::usize getMemoryUsage(void) const;
           triton::uint32 numberOfRegisters(void) const;
           triton::uint32 registerBitSize(void) const;
           triton::uint32 registerSize(void) const;
@@ -228,6 +244,11 @@ namespace triton {
           triton::uint8 getConcreteMemoryValue(triton::uint64 addr) const;
           void clear(void);
           void disassembly(triton::arch::Instruction& inst) const;
+          triton::usize openDecoder(void) const;
+          void closeDecoder(triton::usize handle) const;
+          bool decode(triton::usize handle, const triton::uint8* opcodes, triton::usize size, triton::uint64 addr, triton::arch::DecodedInstruction& decoded) const;
+          triton::arch::DecodeCache& getDecodeCache(void);
+          triton::arch::PagedMemory& getPagedMemory(void);
           void init(void);
           void setConcreteMemoryAreaValue(triton::uint64 baseAddr, const std::vector<triton::uint8>& values);
           void setConcreteMemoryAreaValue(triton::uint64 baseAddr, const triton::uint8* area, triton::usize size);
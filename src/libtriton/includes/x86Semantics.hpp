@@ -8,6 +8,9 @@
 #ifndef TRITON_X86SEMANTICS_H
 #define TRITON_X86SEMANTICS_H
 
+#include <unordered_map>
+#include <vector>
+
 #include "architecture.hpp"
 #include "instruction.hpp"
 #include "semanticsInterface.hpp"
@@ -52,6 +55,156 @@ namespace triton {
           //! Taint Engine API
           triton::engines::taint::TaintEngine* taintEngine;
 
+          //! A semantics handler.
+          typedef void (x86Semantics::*handler_t)(triton::arch::Instruction& inst);
+
+          //! The handlers indexed by instruction id, nullptr for the unsupported instructions.
+          const std::vector<handler_t>* handlers;
+
+          //! Returns the table of the handlers indexed by instruction id. Built once on the first call.
+          static const std::vector<handler_t>& getHandlers(void);
+
+          //! How the taint of the operands of a summarized instruction is spread.
+          enum taint_spread_e {
+            SPREAD_INVALID = 0, //!< The instruction has no taint summary.
+            SPREAD_ASSIGN,      //!< operand0 = operand1.
+            SPREAD_COMPARE,     //!< Nothing is written, the result is tainted if operand0 or operand1 is tainted.
+            SPREAD_NONE,        //!< Nothing is spread.
+            SPREAD_SELF,        //!< operand0 = f(operand0).
+            SPREAD_UNION,       //!< operand0 = f(operand0, operand1).
+            SPREAD_UNION_CF,    //!< operand0 = f(operand0, operand1, cf).
+          };
+
+          //! Which flags take the taint of the result of a summarized instruction.
+          enum taint_flags_e {
+            FLAGS_NONE = 0,     //!< No flag is written.
+            FLAGS_ARITH,        //!< af, cf, of, pf, sf and zf take the taint of the result.
+            FLAGS_INCDEC,       //!< af, of, pf, sf and zf take the taint of the result.
+            FLAGS_LOGIC,        //!< cf and of are cleared, pf, sf and zf take the taint of the result.
+          };
+
+          //! The taint summary of an instruction, which mirrors the taint spreading of its handler.
+          struct TaintSummary {
+            //! The spreading of the operands as taint_spread_e.
+            triton::uint8 spread;
+
+            //! The flags written as taint_flags_e.
+            triton::uint8 flags;
+
+            //! The number of operands read by the summary.
+            triton::uint8 operands;
+          };
+
+          //! The taint summaries indexed by instruction id.
+          const std::vector<TaintSummary>* taintSummaries;
+
+          //! Returns the table of the taint summaries indexed by instruction id. Built once on the first call.
+          static const std::vector<TaintSummary>& getTaintSummaries(void);
+
+          //! The taint plan of the instruction at an address, compiled from its summary.
+          struct CachedTaintPlan {
+            //! The instruction id the plan has been compiled for.
+            triton::uint32 type;
+
+            //! The shape of the operands the plan has been compiled for: their type and the parent id of a register or the size of a memory access.
+            std::vector<triton::uint64> shape;
+
+            //! The plan.
+            triton::engines::taint::TaintPlan plan;
+          };
+
+          //! Maximum number of cached taint plans. The cache is flushed once it is reached.
+          static const triton::usize maxTaintPlans = 0x10000;
+
+          //! The taint plans by address.
+          std::unordered_map<triton::uint64, CachedTaintPlan> taintPlans;
+
+          //! Compiles the taint summary of an instruction into a plan. Returns false if the operands cannot be summarized.
+          bool compileTaintPlan(const TaintSummary& summary, const triton::arch::Instruction& inst, triton::engines::taint::TaintPlan& plan) const;
+
+          //! Returns the form of a pair of operand types, used to select the specialization of a handler.
+          static constexpr triton::uint32 operandsForm(triton::uint32 dstType, triton::uint32 srcType) {
+            return (dstType << 2) | srcType;
+          }
+
+          //! Builds the symbolic operand of an operand whose type is known at compile time.
+          template <triton::uint32 type>
+          triton::ast::AbstractNode* operand_s(triton::arch::Instruction& inst, triton::arch::OperandWrapper& op);
+
+          //! Creates the symbolic expression of a destination whose type is known at compile time.
+          template <triton::uint32 type>
+          triton::engines::symbolic::SymbolicExpression* assign_s(triton::arch::Instruction& inst,
+                                                                  triton::ast::AbstractNode* node,
+                                                                  triton::arch::OperandWrapper& dst,
+                                                                  const std::string& comment);
+
+          //! Returns true if an operand whose type is known at compile time is tainted.
+          template <triton::uint32 type>
+          bool isTainted_s(const triton::arch::OperandWrapper& op) const;
+
+          //! Spreads the taint of a union between operands whose types are known at compile time.
+          template <triton::uint32 dstType, triton::uint32 srcType>
+          bool taintUnion_s(const triton::arch::OperandWrapper& dst, const triton::arch::OperandWrapper& src);
+
+          //! Spreads the taint of an assignment between operands whose types are known at compile time.
+          template <triton::uint32 dstType, triton::uint32 srcType>
+          bool taintAssignment_s(const triton::arch::OperandWrapper& dst, const triton::arch::OperandWrapper& src);
+
+          //! Returns true if a register is neither symbolized nor tainted. A deferred flag is built first.
+          bool isConcreteRegister_n(const triton::arch::Register& reg);
+
+          //! Returns true if an operand and the registers of its address are neither symbolized nor tainted. The content of a memory operand is only checked if `content` is true.
+          bool isConcreteOperand_n(const triton::arch::OperandWrapper& op, bool content=true);
+
+          //! Returns the concrete value of an operand.
+          triton::uint64 getConcreteOperand_n(const triton::arch::OperandWrapper& op) const;
+
+          //! Writes the concrete value of a register, which is concretized and untainted.
+          void setConcreteRegister_n(const triton::arch::Register& reg, triton::uint64 value);
+
+          //! Writes the concrete value of a memory access, which is concretized and untainted.
+          void setConcreteMemory_n(const triton::arch::MemoryAccess& mem, triton::uint64 value);
+
+          //! Writes the concrete value of an operand, which is concretized and untainted.
+          void setConcreteOperand_n(const triton::arch::OperandWrapper& op, triton::uint64 value);
+
+          //! Writes the concrete value of a flag, which is concretized and untainted.
+          void setConcreteFlag_n(const triton::arch::Register& flag, bool value);
+
+          //! Writes pf, sf and zf from the result of `bits` bits.
+          void setResultFlags_n(triton::uint64 result, triton::uint32 bits);
+
+          //! Writes af, of and, if `carry` is true, cf from `op1 + op2` or, if `sub` is true, `op1 - op2`. Then pf, sf and zf.
+          void setArithFlags_n(triton::uint64 op1, triton::uint64 op2, triton::uint64 result, triton::uint32 bits, bool sub, bool carry);
+
+          //! The ADD semantics of a form of operands.
+          template <triton::uint32 dstType, triton::uint32 srcType>
+          void addForm_s(triton::arch::Instruction& inst);
+
+          //! The CMP semantics of a form of operands.
+          template <triton::uint32 dstType, triton::uint32 srcType>
+          void cmpForm_s(triton::arch::Instruction& inst);
+
+          //! The MOV semantics of a form of operands.
+          template <triton::uint32 dstType, triton::uint32 srcType>
+          void movForm_s(triton::arch::Instruction& inst);
+
+          //! The POP semantics of a form of operands.
+          template <triton::uint32 dstType>
+          void popForm_s(triton::arch::Instruction& inst);
+
+          //! The PUSH semantics of a form of operands.
+          template <triton::uint32 srcType>
+          void pushForm_s(triton::arch::Instruction& inst);
+
+          //! The SUB semantics of a form of operands.
+          template <triton::uint32 dstType, triton::uint32 srcType>
+          void subForm_s(triton::arch::Instruction& inst);
+
+          //! The XOR semantics of a form of operands.
+          template <triton::uint32 dstType, triton::uint32 srcType>
+          void xorForm_s(triton::arch::Instruction& inst);
+
         public:
           //! Constructor.
           x86Semantics(triton::arch::Architecture* architecture,
@@ -64,6 +217,41 @@ namespace triton {
           //! Builds the semantics of the instruction. Returns true if the instruction is supported.
           bool buildSemantics(triton::arch::Instruction& inst);
 
+          //! Spreads only the taint of the instruction, without building its semantics. Returns false if the instruction has no taint summary. The summary is compiled into a plan cached by address.
+          bool buildTaintSemantics(triton::arch::Instruction& inst);
+
+          /*!
+           * \brief Builds all the iterations of a `rep movs` or a `rep stos` as a single ranged operation. Returns false if the loop cannot be summarized.
+           *
+           * \description The counter and DF must be concrete, and the areas of a `movs` must not overlap. The bytes copied keep the
+           * symbolic references and the taint of their source, and the bytes stored reference a single expression of the accumulator.
+           * The counter and the program counter get their concrete values after the last iteration, and a symbolized index gets a
+           * single expression of its final value.
+           */
+          bool buildLoopSemantics(triton::arch::Instruction& inst);
+
+          /*!
+           * \brief Applies at once the iterations but the last one of a counted loop whose body is `body`, its branch back included. Returns false if it is not such a loop.
+           *
+           * \description The body must only move full general purpose registers, its induction variables, by constants (`add`, `sub`,
+           * `inc`, `dec`, `lea reg, [reg + disp]`) or by registers it does not write, and end with a `cmp reg, imm`, a `test reg, reg`
+           * or the update of the counter, followed by the conditional branch. The counter and its stride must be concrete. The number of
+           * iterations left is computed from the branch condition, and the loop is not summarized if the counter may wrap around. Each
+           * variable gets its concrete value after these iterations, and a symbolized one a single expression of its closed form. The last
+           * iteration is left to the emulation, so the flags and the exit of the loop are built as usual. `iterations` is set to the
+           * number of iterations applied.
+           */
+          bool buildInductionLoopSemantics(const std::vector<triton::arch::Instruction>& body, triton::usize& iterations);
+
+          /*!
+           * \brief Executes natively `mov`, `lea`, the arithmetic and logic instructions, `push`, `pop` and the jumps, calls and returns. Returns false if the instruction cannot be executed natively.
+           *
+           * \description The operands, the registers of their addresses, the stack and the flags read must be neither symbolized nor
+           * tainted. The concrete state is updated with native arithmetic, and the registers, the memory and the flags written are
+           * concretized and untainted. No AST, symbolic expression nor path constraint is created.
+           */
+          bool buildNativeSemantics(triton::arch::Instruction& inst);
+
           //! Aligns the stack (add). Returns the new stack value.
           triton::uint64 alignAddStack_s(triton::arch::Instruction& inst, triton::uint32 delta);
 
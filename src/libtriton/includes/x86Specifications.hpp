@@ -8,8 +8,10 @@
 #ifndef TRITON_X86SPECIFICATIONS_H
 #define TRITON_X86SPECIFICATIONS_H
 
+#include "cpuSize.hpp"
 #include "register.hpp"
 #include "registerSpecification.hpp"
+#include "tritonTypes.hpp"
 
 
 
@@ -260,6 +262,31 @@ namespace triton {
       extern triton::arch::Register x86_reg_ss;
 
 
+      /*! \brief The concrete values of the main registers of a x86 or x86-64 CPU.
+       *
+       * \description
+       * Copied at once by triton::API::setConcreteRegisterContext() and triton::API::getConcreteRegisterContext(),
+       * instead of one Register per value. The x86 CPU only uses the 8 first GPRs and XMM registers, truncated to
+       * 32 bits for the GPRs.
+       */
+      struct RegisterContext {
+        //! rax, rbx, rcx, rdx, rdi, rsi, rbp, rsp, r8, r9, r10, r11, r12, r13, r14 and r15.
+        triton::uint64 gprs[16];
+
+        //! rip.
+        triton::uint64 pc;
+
+        //! eflags.
+        triton::uint64 flags;
+
+        //! cs, ds, es, fs, gs and ss.
+        triton::uint64 segments[6];
+
+        //! xmm0 to xmm15, little-endian.
+        triton::uint8 xmms[16][DQWORD_SIZE];
+      };
+
+
       //! \class x86Specifications
       /*! \brief The x86Specifications class defines specifications about the x86 and x86_64 CPU */
       class x86Specifications {
@@ -273,6 +300,9 @@ namespace triton {
           //! Returns all specifications about a register from its ID according to the arch (32 or 64-bits).
           triton::arch::RegisterSpecification getX86RegisterSpecification(triton::uint32 arch, triton::uint32 regId) const;
 
+          //! Returns the row of the constant specification table of a register according to the arch (32 or 64-bits). No allocation.
+          const triton::arch::RegisterSpecificationEntry& getX86RegisterSpecificationEntry(triton::uint32 arch, triton::uint32 regId) const;
+
           //! Converts a capstone's register id to a triton's register id.
           triton::uint32 capstoneRegisterToTritonRegister(triton::uint32 id) const;
 
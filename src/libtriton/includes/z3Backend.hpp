@@ -0,0 +1,103 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#ifndef TRITON_Z3BACKEND_H
+#define TRITON_Z3BACKEND_H
+
+#include <atomic>
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <z3++.h>
+
+#include "ast.hpp"
+#include "solverBackend.hpp"
+#include "symbolicEngine.hpp"
+#include "tritonTypes.hpp"
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+  //! The Engines namespace
+  namespace engines {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup engines
+   *  @{
+   */
+    //! The Solver namespace
+    namespace solver {
+    /*!
+     *  \ingroup engines
+     *  \addtogroup solver
+     *  @{
+     */
+
+      //! \class Z3Backend
+      /*! \brief The Z3 solver backend. ASTs are translated by triton::ast::TritonToZ3Ast.
+       *
+       * \description
+       * A tactic and a random seed may be given, so that several Z3 backends explore the same query differently.
+       */
+      class Z3Backend : public SolverBackend {
+        private:
+          //! Symbolic Engine API
+          triton::engines::symbolic::SymbolicEngine* symbolicEngine;
+
+          //! True once the backend has been interrupted.
+          std::atomic<bool> interrupted;
+
+          //! Protects `context`.
+          std::mutex lock;
+
+          //! The context of the query being solved. nullptr if there is none.
+          z3::context* context;
+
+          //! The tactic the solver is built from. Empty for the default solver.
+          std::string tactic;
+
+          //! The random seed of the solver.
+          triton::uint32 seed;
+
+        public:
+          //! Constructor.
+          Z3Backend(triton::engines::symbolic::SymbolicEngine* symbolicEngine, const std::string& tactic="", triton::uint32 seed=0);
+
+          //! Returns the name of the backend.
+          std::string getName(void) const;
+
+          //! Solves a conjunction of constraints, see triton::engines::solver::SolverBackend::solve().
+          triton::engines::solver::status_e solve(const std::vector<triton::ast::AbstractNode*>& constraints, triton::uint32 timeout, triton::uint32 resourceLimit, std::map<triton::uint32, SolverModel>& model);
+
+          //! Stops the query being solved, or the next one.
+          void interrupt(void);
+
+          //! Gets the id of the symbolic variable declared by `decl`. Returns false if `decl` is not a symbolic variable.
+          static bool getVariableId(const z3::func_decl& decl, triton::uint32& id);
+
+          //! Returns the value of a bitvector numeral. Values up to 64 bits are read without a string.
+          static triton::uint512 getValue(const z3::expr& numeral);
+
+          //! Converts a Z3 model into a map of symbolic variable id -> model.
+          static std::map<triton::uint32, SolverModel> convertModel(const z3::model& m);
+      };
+
+    /*! @} End of solver namespace */
+    };
+  /*! @} End of engines namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_Z3BACKEND_H */
@@ -0,0 +1,92 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#ifndef TRITON_Z3CONTEXTPOOL_H
+#define TRITON_Z3CONTEXTPOOL_H
+
+#include <z3++.h>
+
+#include "symbolicEngine.hpp"
+#include "tritonToZ3Ast.hpp"
+#include "tritonTypes.hpp"
+
+
+
+//! The Triton namespace
+namespace triton {
+/*!
+ *  \addtogroup triton
+ *  @{
+ */
+
+  //! The AST namespace
+  namespace ast {
+  /*!
+   *  \ingroup triton
+   *  \addtogroup ast
+   *  @{
+   */
+
+    //! \class Z3ContextLease
+    /*! \brief A translator (and its Z3 context) borrowed from the pool of the current thread.
+     *
+     * \description
+     * Creating a Z3 context costs much more than translating a small AST, so the evaluations, the simplifications
+     * and the solver queries of a thread share long-lived translators. A translator is given back to the pool when
+     * the lease is destroyed, so the Z3 objects built on its context must be destroyed before. It is recreated after
+     * `resetInterval` leases, to release what its context retains. When the translators of the pool are all leased
+     * (nested uses), the lease owns a translator of its own.
+     */
+    class Z3ContextLease {
+      private:
+        //! The index of the translator in the pool of the thread, or -1 if the lease owns its translator.
+        triton::sint32 slot;
+
+        //! The translator owned by the lease if the pool has none available.
+        TritonToZ3Ast* owned;
+
+        //! The leased translator.
+        TritonToZ3Ast* translator;
+
+        //! If true, the translator is dropped instead of being given back to the pool.
+        bool invalidated;
+
+        //! Not copyable.
+        Z3ContextLease(const Z3ContextLease& copy);
+
+        //! Not copyable.
+        void operator=(const Z3ContextLease& other);
+
+      public:
+        //! Maximum number of translators of a thread.
+        static const triton::uint32 maxTranslators = 4;
+
+        //! Number of leases after which a translator and its context are recreated.
+        static const triton::usize resetInterval = 1000;
+
+        //! Constructor. Borrows a translator bound to a symbolic engine, which evaluates the nodes if `eval` is true.
+        Z3ContextLease(triton::engines::symbolic::SymbolicEngine* symbolicEngine, bool eval=true);
+
+        //! Destructor. Gives the translator back to the pool.
+        ~Z3ContextLease();
+
+        //! Returns the leased translator.
+        TritonToZ3Ast& getTranslator(void);
+
+        //! Returns the Z3 context of the leased translator.
+        z3::context& getContext(void);
+
+        //! Drops the translator when the lease ends (e.g. its context has been interrupted).
+        void invalidate(void);
+    };
+
+  /*! @} End of ast namespace */
+  };
+/*! @} End of triton namespace */
+};
+
+#endif /* TRITON_Z3CONTEXTPOOL_H */
@@ -68,6 +68,9 @@ namespace triton {
 
         //! Returns the value as integer.
         triton::__uint getUintValue(void) const;
+
+        //! Returns the value of a bitvector. Values up to 64 bits are read without a string.
+        triton::uint512 getValue(void) const;
     };
 
   /*! @} End of ast namespace */
@@ -8,6 +8,7 @@
 #ifndef TRITON_Z3TOTRITONAST_H
 #define TRITON_Z3TOTRITONAST_H
 
+#include <unordered_map>
 #include <z3++.h>
 
 #include "ast.hpp"
@@ -38,13 +39,13 @@ namespace triton {
         //! Symbolic Engine API
         triton::engines::symbolic::SymbolicEngine* symbolicEngine;
 
+        //! The nodes already converted by Z3's AST id, so a subterm shared in the Z3's DAG is converted once.
+        std::unordered_map<unsigned int, triton::ast::AbstractNode*> nodes;
+
         //! Vists and converts
         triton::ast::AbstractNode* visit(z3::expr const& expr);
 
       protected:
-        //! Z3's context
-        z3::context context;
-
         //! The Z3's expression which must be converted to a Triton's expression.
         z3::expr expr;
 
@@ -64,7 +65,7 @@ namespace triton {
         //! Sets the expression.
         void setExpr(z3::expr& expr);
 
-        //! Converts to Triton's AST
+        //! Converts to Triton's AST. Subterms shared in the Z3's expression are shared in the Triton's one.
         triton::ast::AbstractNode* convert(void);
     };
 
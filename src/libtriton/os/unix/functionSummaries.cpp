@@ -0,0 +1,838 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#include <api.hpp>
+#include <astTraversal.hpp>
+#include <astVariableSet.hpp>
+#include <cpuSize.hpp>
+#include <exceptions.hpp>
+#include <functionSummaries.hpp>
+#include <x86Specifications.hpp>
+
+
+
+namespace triton {
+  namespace os {
+    namespace unix {
+
+      /* The registers of the arguments (System V x86-64) */
+      static const triton::arch::Register* argumentRegisters[] = {
+        &TRITON_X86_REG_RDI,
+        &TRITON_X86_REG_RSI,
+        &TRITON_X86_REG_RDX,
+        &TRITON_X86_REG_RCX,
+        &TRITON_X86_REG_R8,
+        &TRITON_X86_REG_R9,
+      };
+
+
+      FunctionSummaries::FunctionSummaries(triton::API* api) {
+        if (api == nullptr)
+          throw triton::exceptions::API("FunctionSummaries::FunctionSummaries(): The API cannot be null.");
+
+        this->api      = api;
+        this->nextStub = 0xffffffff00000000;
+
+        this->learning.function = 0;
+      }
+
+
+      std::vector<std::string> FunctionSummaries::getNames(void) {
+        return {"memcpy", "memmove", "memset", "strcmp", "strlen"};
+      }
+
+
+      triton::callbacks::addressHookCallback FunctionSummaries::getSummary(const std::string& name) {
+        if (name == "memcpy" || name == "memmove")
+          return [this](triton::uint64) { return this->memcpy(); };
+
+        if (name == "memset")
+          return [this](triton::uint64) { return this->memset(); };
+
+        if (name == "strcmp")
+          return [this](triton::uint64) { return this->strcmp(); };
+
+        if (name == "strlen")
+          return [this](triton::uint64) { return this->strlen(); };
+
+        throw triton::exceptions::API("FunctionSummaries::getSummary(): There is no summary of " + name + ".");
+      }
+
+
+      void FunctionSummaries::attach(triton::uint64 address, const std::string& name) {
+        triton::callbacks::addressHookCallback summary = this->getSummary(name);
+        this->detach(address);
+        this->hooks[address] = summary;
+      }
+
+
+      triton::usize FunctionSummaries::attach(const triton::format::SymbolIndex& symbols) {
+        triton::usize count = 0;
+
+        for (const auto& name : FunctionSummaries::getNames()) {
+          if (symbols.isSymbolDefined(name)) {
+            this->attach(symbols.getSymbolAddress(name), name);
+            count++;
+          }
+
+          /* The import is resolved to a stub, and the stub is summarized */
+          else if (symbols.isRelocationDefined(name)) {
+            triton::uint64 stub = this->nextStub;
+            this->nextStub += QWORD_SIZE;
+            this->api->setConcreteMemoryValue(triton::arch::MemoryAccess(symbols.getRelocationAddress(name), QWORD_SIZE, stub));
+            this->attach(stub, name);
+            count++;
+          }
+        }
+
+        return count;
+      }
+
+
+      void FunctionSummaries::detach(triton::uint64 address) {
+        auto it = this->learned.find(address);
+
+        if (it != this->learned.end()) {
+          if (this->learning.function == address)
+            this->abortLearning();
+          for (auto path = it->second.paths.begin(); path != it->second.paths.end(); path++)
+            this->releasePath(*path);
+          this->learned.erase(it);
+        }
+
+        this->hooks.erase(address);
+      }
+
+
+      const triton::callbacks::addressHookCallback* FunctionSummaries::getHook(triton::uint64 address) const {
+        auto it = this->hooks.find(address);
+        if (it == this->hooks.end())
+          return nullptr;
+        return &it->second;
+      }
+
+
+      void FunctionSummaries::setStubBase(triton::uint64 address) {
+        this->nextStub = address;
+      }
+
+
+      /* [private method] */
+      triton::uint64 FunctionSummaries::getArgument(triton::uint32 index) const {
+        switch (index) {
+          case 0:  return this->api->getConcreteRegisterValue(TRITON_X86_REG_RDI).convert_to<triton::uint64>();
+          case 1:  return this->api->getConcreteRegisterValue(TRITON_X86_REG_RSI).convert_to<triton::uint64>();
+          case 2:  return this->api->getConcreteRegisterValue(TRITON_X86_REG_RDX).convert_to<triton::uint64>();
+          default:
+            throw triton::exceptions::API("FunctionSummaries::getArgument(): Invalid argument index.");
+        }
+      }
+
+
+      /* [private method] */
+      void FunctionSummaries::setResult(triton::uint64 value, triton::ast::AbstractNode* node, const std::string& comment) {
+        triton::arch::Register rax(triton::arch::x86::ID_REG_RAX, value);
+
+        this->api->setConcreteRegisterValue(rax);
+
+        /* The assignment synchronizes the concrete value with the one of the register given */
+        if (this->api->isSymbolicEngineEnabled()) {
+          if (node != nullptr)
+            this->api->assignSymbolicExpressionToRegister(this->api->newSymbolicExpression(node, comment), rax);
+          else
+            this->api->concretizeRegister(TRITON_X86_REG_RAX);
+        }
+      }
+
+
+      /* [private method] */
+      void FunctionSummaries::returnToCaller(void) {
+        triton::uint64 rsp = this->api->getConcreteRegisterValue(TRITON_X86_REG_RSP).convert_to<triton::uint64>();
+        triton::uint64 ret = this->api->getConcreteMemoryValue(triton::arch::MemoryAccess(rsp, QWORD_SIZE)).convert_to<triton::uint64>();
+
+        this->api->setConcreteRegisterValue(triton::arch::Register(triton::arch::x86::ID_REG_RSP, rsp + QWORD_SIZE));
+        this->api->setConcreteRegisterValue(triton::arch::Register(triton::arch::x86::ID_REG_RIP, ret));
+
+        if (this->api->isSymbolicEngineEnabled()) {
+          this->api->concretizeRegister(TRITON_X86_REG_RSP);
+          this->api->concretizeRegister(TRITON_X86_REG_RIP);
+        }
+      }
+
+
+      /* [private method] */
+      void FunctionSummaries::copyMemory(triton::uint64 dst, triton::uint64 src, triton::usize size) {
+        /* The source is read entirely before the destination is written, so the areas may overlap */
+        this->api->setConcreteMemoryAreaValue(dst, this->api->getConcreteMemoryAreaValue(src, size));
+
+        /* The memory array only sees the stores, so the bytes are stored as expressions */
+        if (this->api->isSymbolicEngineEnabled() && this->api->isModeEnabled(triton::modes::MEMORY_ARRAY)) {
+          std::vector<std::pair<triton::usize, triton::uint32>> references(size);
+
+          for (triton::usize index = 0; index < size; index++)
+            references[index].first = this->api->getSymbolicMemoryId(src + index, references[index].second);
+
+          for (triton::usize index = 0; index < size; index++) {
+            this->api->concretizeMemory(dst + index);
+            if (references[index].first == triton::engines::symbolic::UNSET)
+              continue;
+            triton::ast::AbstractNode* node = triton::ast::extract(references[index].second * BYTE_SIZE_BIT + 7, references[index].second * BYTE_SIZE_BIT, triton::ast::reference(references[index].first));
+            this->api->assignSymbolicExpressionToMemory(this->api->newSymbolicExpression(node, "memcpy summary"), triton::arch::MemoryAccess(dst + index, BYTE_SIZE));
+          }
+        }
+
+        else if (this->api->isSymbolicEngineEnabled())
+          this->api->getSymbolicEngine()->copyMemoryReferences(dst, src, size);
+
+        this->api->getTaintEngine()->taintAssignmentMemoryArea(dst, src, size);
+      }
+
+
+      /* [private method] void* memcpy(void* dst, const void* src, size_t n) */
+      bool FunctionSummaries::memcpy(void) {
+        triton::uint64 dst = this->getArgument(0);
+        triton::uint64 src = this->getArgument(1);
+        triton::uint64 n   = this->getArgument(2);
+
+        this->copyMemory(dst, src, n);
+        this->setResult(dst, nullptr, "memcpy summary");
+        this->returnToCaller();
+
+        return true;
+      }
+
+
+      /* [private method] void* memset(void* dst, int c, size_t n) */
+      bool FunctionSummaries::memset(void) {
+        triton::uint64 dst = this->getArgument(0);
+        triton::uint64 c   = this->getArgument(1);
+        triton::uint64 n   = this->getArgument(2);
+
+        this->api->setConcreteMemoryAreaValue(dst, std::vector<triton::uint8>(n, static_cast<triton::uint8>(c)));
+
+        /* Every byte references the same expression of the low byte of c */
+        if (this->api->isSymbolicEngineEnabled()) {
+          this->api->getSymbolicEngine()->concretizeMemoryArea(dst, n);
+
+          if (this->api->isRegisterSymbolized(TRITON_X86_REG_RSI)) {
+            triton::engines::symbolic::SymbolicExpression* expr = this->api->newSymbolicExpression(triton::ast::extract(7, 0, this->api->buildSymbolicRegister(TRITON_X86_REG_RSI)), "memset summary");
+            for (triton::uint64 index = 0; index < n; index++)
+              this->api->assignSymbolicExpressionToMemory(expr, triton::arch::MemoryAccess(dst + index, BYTE_SIZE));
+          }
+        }
+
+        if (this->api->isRegisterTainted(TRITON_X86_REG_RSI))
+          this->api->getTaintEngine()->taintMemoryArea(dst, n);
+        else
+          this->api->getTaintEngine()->untaintMemoryArea(dst, n);
+
+        this->setResult(dst, nullptr, "memset summary");
+        this->returnToCaller();
+
+        return true;
+      }
+
+
+      /* [private method] int strcmp(const char* s1, const char* s2) */
+      bool FunctionSummaries::strcmp(void) {
+        triton::uint64 s1 = this->getArgument(0);
+        triton::uint64 s2 = this->getArgument(1);
+        triton::uint64 last = 0;
+
+        while (this->api->getConcreteMemoryValue(s1 + last) == this->api->getConcreteMemoryValue(s2 + last) && this->api->getConcreteMemoryValue(s1 + last) != 0)
+          last++;
+
+        triton::sint32 diff = static_cast<triton::sint32>(this->api->getConcreteMemoryValue(s1 + last)) - static_cast<triton::sint32>(this->api->getConcreteMemoryValue(s2 + last));
+        triton::uint32 size = static_cast<triton::uint32>(last + 1);
+        triton::ast::AbstractNode* node = nullptr;
+
+        /* (ite (= a b) (ite (= a 0) 0 next) (- a b)) over the symbolic bytes, from the last byte compared to the first one */
+        if (this->api->isSymbolicEngineEnabled() && (this->api->isMemorySymbolized(s1, size) || this->api->isMemorySymbolized(s2, size))) {
+          for (triton::uint64 index = last + 1; index-- > 0;) {
+            if (node != nullptr && !this->api->isMemorySymbolized(s1 + index) && !this->api->isMemorySymbolized(s2 + index))
+              continue;
+
+            triton::ast::AbstractNode* a   = this->api->buildSymbolicMemory(triton::arch::MemoryAccess(s1 + index, BYTE_SIZE));
+            triton::ast::AbstractNode* b   = this->api->buildSymbolicMemory(triton::arch::MemoryAccess(s2 + index, BYTE_SIZE));
+            triton::ast::AbstractNode* sub = triton::ast::bvsub(triton::ast::zx(24, a), triton::ast::zx(24, b));
+
+            if (node == nullptr)
+              node = sub;
+            else
+              node = triton::ast::ite(triton::ast::equal(a, b), triton::ast::ite(triton::ast::equal(a, triton::ast::bv(0, BYTE_SIZE_BIT)), triton::ast::bv(0, DWORD_SIZE_BIT), node), sub);
+          }
+          node = triton::ast::sx(DWORD_SIZE_BIT, node);
+        }
+
+        this->setResult(static_cast<triton::uint64>(static_cast<triton::sint64>(diff)), node, "strcmp summary");
+        this->returnToCaller();
+
+        return true;
+      }
+
+
+      /* [private method] size_t strlen(const char* s) */
+      bool FunctionSummaries::strlen(void) {
+        triton::uint64 s   = this->getArgument(0);
+        triton::uint64 len = 0;
+        bool symbolic      = false;
+
+        while (this->api->getConcreteMemoryValue(s + len) != 0)
+          len++;
+
+        if (this->api->isSymbolicEngineEnabled()) {
+          for (triton::uint64 index = 0; index <= len && !symbolic; index++)
+            symbolic = this->api->isMemorySymbolized(s + index);
+        }
+
+        /* (ite (= s[0] 0) 0 (ite (= s[1] 0) 1 ... len)) over the symbolic bytes, the concrete ones are not null */
+        triton::ast::AbstractNode* node = nullptr;
+        if (symbolic) {
+          node = triton::ast::bv(len, QWORD_SIZE_BIT);
+          for (triton::uint64 index = len; index-- > 0;) {
+            if (!this->api->isMemorySymbolized(s + index))
+              continue;
+            triton::ast::AbstractNode* c = this->api->buildSymbolicMemory(triton::arch::MemoryAccess(s + index, BYTE_SIZE));
+            node = triton::ast::ite(triton::ast::equal(c, triton::ast::bv(0, BYTE_SIZE_BIT)), triton::ast::bv(index, QWORD_SIZE_BIT), node);
+          }
+        }
+
+        this->setResult(len, node, "strlen summary");
+        this->returnToCaller();
+
+        return true;
+      }
+
+
+      void FunctionSummaries::learn(triton::uint64 address, triton::uint32 argc) {
+        if (argc > FunctionSummaries::maxLearnedArguments)
+          throw triton::exceptions::API("FunctionSummaries::learn(): A learned function takes at most 6 arguments.");
+
+        this->detach(address);
+
+        LearnedFunction& function = this->learned[address];
+        function.argc     = argc;
+        function.disabled = false;
+
+        this->hooks[address] = [this, address](triton::uint64) { return this->learnedSummary(address); };
+      }
+
+
+      bool FunctionSummaries::isLearned(triton::uint64 address) const {
+        return this->learned.find(address) != this->learned.end();
+      }
+
+
+      triton::usize FunctionSummaries::getNumberOfLearnedPaths(triton::uint64 address) const {
+        auto it = this->learned.find(address);
+        if (it == this->learned.end())
+          return 0;
+        return it->second.paths.size();
+      }
+
+
+      bool FunctionSummaries::isLearning(void) const {
+        return this->learning.function != 0;
+      }
+
+
+      void FunctionSummaries::prepareInstruction(const triton::arch::Instruction& inst) {
+        LearnedCall& call = this->learning;
+        triton::arch::Instruction copy;
+
+        call.sp = this->api->getConcreteRegisterValue(TRITON_X86_REG_RSP).convert_to<triton::uint64>();
+
+        /* Outside the symbolic regions, the instructions read their operands as constants */
+        if (!this->api->getSymbolicEngine()->isSymbolicRegion(inst.getAddress())) {
+          this->abortLearning();
+          return;
+        }
+
+        /* The memory operands are decoded before the instruction is processed */
+        copy.setOpcodes(inst.getOpcodes(), inst.getSize());
+        copy.setAddress(inst.getAddress());
+        this->api->disassembly(copy);
+
+        if (copy.getType() == triton::arch::x86::ID_INS_LEA || copy.getType() == triton::arch::x86::ID_INS_NOP)
+          return;
+
+        for (auto it = copy.operands.begin(); it != copy.operands.end(); it++) {
+          if (it->getType() != triton::arch::OP_MEM)
+            continue;
+
+          triton::arch::MemoryAccess& mem = it->getMemory();
+          mem.initAddress(false, true);
+
+          triton::uint64 addr = mem.getAddress();
+          triton::uint32 size = mem.getSize();
+          if (this->isInLearnedFrame(addr, size))
+            continue;
+
+          if (size > DQWORD_SIZE) {
+            this->abortLearning();
+            return;
+          }
+
+          bool symbolic = false;
+          for (triton::uint32 index = 0; index < size && !symbolic; index++)
+            symbolic = (this->api->getSymbolicMemoryId(addr + index) != triton::engines::symbolic::UNSET);
+
+          /* The loaded value is replaced by a symbolic variable until the instruction is processed */
+          triton::arch::MemoryAccess area(addr, size);
+          triton::ast::AbstractNode* original = this->api->buildSymbolicMemory(area);
+          triton::usize id = 0;
+
+          triton::engines::symbolic::SymbolicExpression* expr = this->newLearnedVariable(original, this->api->getConcreteMemoryValue(area), size * BYTE_SIZE_BIT, "learned load", id);
+          this->api->assignSymbolicExpressionToMemory(expr, area);
+
+          LearnedLoad load;
+          load.variable = id;
+          load.size     = size;
+          load.address  = mem.getLeaAst();
+          load.address->incReference();
+
+          call.path.loads.push_back(load);
+          call.pending.push_back(std::make_tuple(addr, size, original, symbolic));
+        }
+      }
+
+
+      void FunctionSummaries::observeInstruction(const triton::arch::Instruction& inst) {
+        LearnedCall& call = this->learning;
+        triton::uint32 type = inst.getType();
+        bool valid = (++call.instructions <= FunctionSummaries::maxLearnedInstructions);
+
+        if (type == triton::arch::x86::ID_INS_SYSCALL || type == triton::arch::x86::ID_INS_SYSENTER || type == triton::arch::x86::ID_INS_INT)
+          valid = false;
+
+        /* A learned function only writes into its frame */
+        for (auto it = inst.getStoreAccessHandles().begin(); it != inst.getStoreAccessHandles().end(); it++) {
+          if (!this->isInLearnedFrame(it->first.address, it->first.size))
+            valid = false;
+          else
+            call.frameStores.insert(std::make_pair(it->first.address, it->first.size));
+        }
+
+        /* The loads outside of the frame must have been replaced (they are not implicit ones) */
+        for (auto it = inst.getLoadAccessHandles().begin(); it != inst.getLoadAccessHandles().end(); it++) {
+          bool replaced = this->isInLearnedFrame(it->first.address, it->first.size);
+          for (auto load = call.pending.begin(); load != call.pending.end() && !replaced; load++)
+            replaced = (std::get<0>(*load) <= it->first.address && it->first.address + it->first.size <= std::get<0>(*load) + std::get<1>(*load));
+          valid = valid && replaced;
+        }
+
+        if (!valid) {
+          this->abortLearning();
+          return;
+        }
+
+        /* The memory gets back its value */
+        for (auto it = call.pending.begin(); it != call.pending.end(); it++) {
+          if (std::get<3>(*it))
+            this->api->assignSymbolicExpressionToMemory(this->api->newSymbolicExpression(std::get<2>(*it), "learned load"), triton::arch::MemoryAccess(std::get<0>(*it), std::get<1>(*it)));
+          else
+            this->api->getSymbolicEngine()->concretizeMemoryArea(std::get<0>(*it), std::get<1>(*it));
+        }
+        call.pending.clear();
+
+        triton::uint64 pc = this->api->getConcreteRegisterValue(TRITON_X86_REG_PC).convert_to<triton::uint64>();
+        triton::uint64 sp = this->api->getConcreteRegisterValue(TRITON_X86_REG_RSP).convert_to<triton::uint64>();
+        if (pc == call.returnAddress && sp == call.entrySp + QWORD_SIZE)
+          this->finishLearning();
+      }
+
+
+      void FunctionSummaries::abortLearning(void) {
+        LearnedCall& call = this->learning;
+        triton::ast::AbstractNode* constraint = nullptr;
+
+        if (call.function == 0)
+          return;
+
+        /* The symbolic variables of the call keep the values they replaced */
+        for (triton::usize index = 0; index < call.originals.size(); index++) {
+          triton::usize id = (index < call.path.inputs.size() ? call.path.inputs[index] : call.path.loads[index - call.path.inputs.size()].variable);
+          triton::ast::AbstractNode* node = triton::ast::equal(triton::ast::variable(*this->api->getSymbolicVariableFromId(id)), call.originals[index]);
+          constraint = (constraint == nullptr ? node : triton::ast::land(constraint, node));
+        }
+
+        if (constraint != nullptr) {
+          triton::engines::symbolic::PathConstraint pco;
+          pco.addBranchConstraint(true, call.function, call.function, constraint);
+          this->api->getSymbolicEngine()->addPathConstraint(pco);
+        }
+
+        auto it = this->learned.find(call.function);
+        if (it != this->learned.end())
+          it->second.disabled = true;
+
+        this->releaseLearning();
+      }
+
+
+      /* [private method] */
+      bool FunctionSummaries::learnedSummary(triton::uint64 address) {
+        const LearnedFunction& function = this->learned.at(address);
+
+        /* The nested calls are executed as a part of the call being learned */
+        if (this->isLearning() || !this->api->isSymbolicEngineEnabled())
+          return true;
+
+        std::vector<triton::ast::AbstractNode*> inputs;
+        for (triton::uint32 index = 0; index < function.argc; index++)
+          inputs.push_back(this->api->buildSymbolicRegister(*argumentRegisters[index]));
+        inputs.push_back(this->api->buildSymbolicRegister(TRITON_X86_REG_RSP));
+
+        for (auto it = function.paths.begin(); it != function.paths.end(); it++) {
+          std::vector<triton::engines::symbolic::PathConstraint> constraints;
+          triton::ast::AbstractNode* result = nullptr;
+          bool tainted = false;
+
+          if (this->instantiate(*it, inputs, result, constraints, tainted)) {
+            this->applyInstance(result, constraints, tainted);
+            this->returnToCaller();
+            return true;
+          }
+        }
+
+        /* The memory array and the taint-only mode do not build the expressions of the loads */
+        if (function.disabled || function.paths.size() >= FunctionSummaries::maxLearnedPaths)
+          return true;
+
+        if (this->api->isModeEnabled(triton::modes::MEMORY_ARRAY) || this->api->isModeEnabled(triton::modes::ONLY_ON_TAINTED))
+          return true;
+
+        this->startLearning(address, function);
+        return true;
+      }
+
+
+      /* [private method] */
+      void FunctionSummaries::startLearning(triton::uint64 address, const LearnedFunction& function) {
+        LearnedCall& call = this->learning;
+        triton::uint64 sp = this->api->getConcreteRegisterValue(TRITON_X86_REG_RSP).convert_to<triton::uint64>();
+
+        call.function        = address;
+        call.returnAddress   = this->api->getConcreteMemoryValue(triton::arch::MemoryAccess(sp, QWORD_SIZE)).convert_to<triton::uint64>();
+        call.entrySp         = sp;
+        call.sp              = sp;
+        call.pathConstraints = this->api->getSymbolicEngine()->getNumberOfPathConstraints();
+        call.resultId        = this->api->getSymbolicRegisterId(TRITON_X86_REG_RAX);
+        call.instructions    = 0;
+        call.path.result     = nullptr;
+
+        /* The arguments and the stack pointer are replaced by symbolic variables */
+        for (triton::uint32 index = 0; index <= function.argc; index++) {
+          const triton::arch::Register& reg = (index < function.argc ? *argumentRegisters[index] : TRITON_X86_REG_RSP);
+          triton::uint64 value = this->api->getConcreteRegisterValue(reg).convert_to<triton::uint64>();
+          triton::usize id = 0;
+
+          triton::engines::symbolic::SymbolicExpression* expr = this->newLearnedVariable(this->api->buildSymbolicRegister(reg), value, reg.getBitSize(), "learned input", id);
+          this->api->assignSymbolicExpressionToRegister(expr, triton::arch::Register(reg.getId(), value));
+          call.path.inputs.push_back(id);
+
+          if (index == 0) {
+            call.firstExprId = expr->getId();
+            call.firstVarId  = id;
+          }
+        }
+      }
+
+
+      /* [private method] */
+      void FunctionSummaries::finishLearning(void) {
+        std::unordered_map<triton::ast::AbstractNode*, triton::ast::AbstractNode*> templates;
+        std::vector<triton::engines::symbolic::PathConstraint> constraints;
+        triton::engines::symbolic::SymbolicEngine* engine = this->api->getSymbolicEngine();
+        triton::ast::AbstractNode* result = nullptr;
+        LearnedCall& call = this->learning;
+        LearnedPath path = call.path;
+        bool tainted = false;
+        bool valid = true;
+
+        for (auto it = path.loads.begin(); it != path.loads.end(); it++) {
+          it->address = this->buildTemplate(it->address, templates);
+          valid = valid && it->address != nullptr;
+        }
+
+        const std::vector<triton::engines::symbolic::PathConstraint>& pcs = engine->getPathConstraints();
+        for (triton::usize index = call.pathConstraints; index < pcs.size() && valid; index++) {
+          std::vector<LearnedBranch> branches;
+          for (auto it = pcs[index].getBranchConstraints().begin(); it != pcs[index].getBranchConstraints().end(); it++) {
+            LearnedBranch branch;
+            branch.taken      = std::get<0>(*it);
+            branch.srcAddr    = std::get<1>(*it);
+            branch.dstAddr    = std::get<2>(*it);
+            branch.constraint = this->buildTemplate(std::get<3>(*it), templates);
+            valid = valid && branch.constraint != nullptr;
+            branches.push_back(branch);
+          }
+          path.constraints.push_back(branches);
+        }
+
+        /* A function which does not write the return register leaves it as it is */
+        if (call.resultId == triton::engines::symbolic::UNSET || this->api->getSymbolicRegisterId(TRITON_X86_REG_RAX) != call.resultId) {
+          path.result = this->buildTemplate(this->api->buildSymbolicRegister(TRITON_X86_REG_RAX), templates);
+          valid = valid && path.result != nullptr;
+        }
+
+        /* The call itself gets the instance of its path over the values its variables replaced */
+        std::vector<triton::ast::AbstractNode*> inputs(call.originals.begin(), call.originals.begin() + path.inputs.size());
+        if (!valid || !this->instantiate(path, inputs, result, constraints, tainted)) {
+          this->abortLearning();
+          return;
+        }
+
+        engine->truncatePathConstraints(call.pathConstraints);
+        this->applyInstance(result, constraints, tainted);
+
+        /* The registers and the frame do not keep the variables of the call */
+        std::set<triton::arch::Register*> registers = this->api->getParentRegisters();
+        for (auto it = registers.begin(); it != registers.end(); it++) {
+          if (this->isLearnedValue(this->api->buildSymbolicRegister(**it)))
+            this->api->concretizeRegister(**it);
+        }
+
+        for (auto it = call.frameStores.begin(); it != call.frameStores.end(); it++)
+          engine->concretizeMemoryArea(it->first, it->second);
+
+        /* The templates survive the call */
+        for (auto it = path.loads.begin(); it != path.loads.end(); it++)
+          it->address->incReference();
+        for (auto it = path.constraints.begin(); it != path.constraints.end(); it++) {
+          for (auto branch = it->begin(); branch != it->end(); branch++)
+            branch->constraint->incReference();
+        }
+        if (path.result != nullptr)
+          path.result->incReference();
+
+        auto it = this->learned.find(call.function);
+        if (it != this->learned.end())
+          it->second.paths.push_back(path);
+        else
+          this->releasePath(path);
+
+        this->releaseLearning();
+      }
+
+
+      /* [private method] */
+      void FunctionSummaries::releaseLearning(void) {
+        LearnedCall& call = this->learning;
+
+        for (auto it = call.originals.begin(); it != call.originals.end(); it++)
+          (*it)->decReference();
+
+        for (auto it = call.path.loads.begin(); it != call.path.loads.end(); it++)
+          it->address->decReference();
+
+        call.function = 0;
+        call.path     = LearnedPath();
+        call.originals.clear();
+        call.pending.clear();
+        call.frameStores.clear();
+      }
+
+
+      /* [private method] The nodes are freed with the engines, so they are only released while the summaries live */
+      void FunctionSummaries::releasePath(LearnedPath& path) const {
+        for (auto it = path.loads.begin(); it != path.loads.end(); it++)
+          it->address->decReference();
+
+        for (auto it = path.constraints.begin(); it != path.constraints.end(); it++) {
+          for (auto branch = it->begin(); branch != it->end(); branch++)
+            branch->constraint->decReference();
+        }
+
+        if (path.result != nullptr)
+          path.result->decReference();
+
+        path = LearnedPath();
+      }
+
+
+      /* [private method] */
+      triton::engines::symbolic::SymbolicExpression* FunctionSummaries::newLearnedVariable(triton::ast::AbstractNode* original, const triton::uint512& value, triton::uint32 size, const std::string& comment, triton::usize& id) {
+        triton::engines::symbolic::SymbolicVariable* var = this->api->newSymbolicVariable(size, comment);
+
+        var->setConcreteValue(value);
+        id = var->getId();
+
+        original->incReference();
+        this->learning.originals.push_back(original);
+
+        return this->api->newSymbolicExpression(triton::ast::variable(*var), comment);
+      }
+
+
+      /* [private method] The frame spans from the red zone under the stack pointer to the return address */
+      bool FunctionSummaries::isInLearnedFrame(triton::uint64 addr, triton::uint32 size) const {
+        return addr + FunctionSummaries::redZoneSize >= this->learning.sp && addr + size <= this->learning.entrySp + QWORD_SIZE;
+      }
+
+
+      /* [private method] */
+      bool FunctionSummaries::isLearnedValue(triton::ast::AbstractNode* node) const {
+        std::vector<triton::usize> ids = triton::ast::VariableSet::getIds(node->getVariables());
+        return !ids.empty() && ids.back() >= this->learning.firstVarId;
+      }
+
+
+      /* [private method] */
+      triton::ast::AbstractNode* FunctionSummaries::buildTemplate(triton::ast::AbstractNode* node, std::unordered_map<triton::ast::AbstractNode*, triton::ast::AbstractNode*>& templates) const {
+        std::vector<std::pair<triton::ast::AbstractNode*, bool>> worklist;
+
+        /* Post-order walk, the references to the expressions of the call are unrolled */
+        worklist.push_back(std::make_pair(node, false));
+        while (!worklist.empty()) {
+          triton::ast::AbstractNode* current = worklist.back().first;
+          bool expanded = worklist.back().second;
+          std::vector<triton::ast::AbstractNode*> childs;
+
+          if (templates.find(current) != templates.end()) {
+            worklist.pop_back();
+            continue;
+          }
+
+          if (current->getKind() == triton::ast::REFERENCE_NODE) {
+            triton::ast::ReferenceNode* ref = reinterpret_cast<triton::ast::ReferenceNode*>(current);
+            if (ref->getValue() < this->learning.firstExprId || ref->getSymbolicExpression() == nullptr)
+              return nullptr;
+            childs.push_back(ref->getAst());
+          }
+
+          /* The older symbolic variables would be read from the state of another call */
+          else if (current->getKind() == triton::ast::VARIABLE_NODE) {
+            if (reinterpret_cast<triton::ast::VariableNode*>(current)->getVariableId() < this->learning.firstVarId)
+              return nullptr;
+          }
+
+          else
+            childs = current->getChilds();
+
+          if (!expanded) {
+            worklist.back().second = true;
+            for (auto it = childs.rbegin(); it != childs.rend(); it++) {
+              if (templates.find(*it) == templates.end())
+                worklist.push_back(std::make_pair(*it, false));
+            }
+            continue;
+          }
+
+          worklist.pop_back();
+
+          if (current->getKind() == triton::ast::REFERENCE_NODE) {
+            templates[current] = templates.at(childs.front());
+            continue;
+          }
+
+          std::vector<triton::ast::AbstractNode*> newChilds;
+          bool changed = false;
+
+          for (auto it = childs.begin(); it != childs.end(); it++) {
+            triton::ast::AbstractNode* child = templates.at(*it);
+            changed = changed || (child != *it);
+            newChilds.push_back(child);
+          }
+
+          templates[current] = (changed ? triton::ast::newInstance(current, newChilds) : current);
+        }
+
+        return templates.at(node);
+      }
+
+
+      /* [private method] */
+      triton::ast::AbstractNode* FunctionSummaries::instantiate(triton::ast::AbstractNode* node, const std::unordered_map<triton::usize, triton::ast::AbstractNode*>& values) const {
+        std::unordered_map<triton::ast::AbstractNode*, triton::ast::AbstractNode*> instances;
+        std::vector<triton::ast::AbstractNode*> nodes;
+
+        triton::ast::nodesExtraction(nodes, node);
+        for (auto it = nodes.begin(); it != nodes.end(); it++) {
+          triton::ast::AbstractNode* current = *it;
+
+          if (current->getKind() == triton::ast::VARIABLE_NODE) {
+            auto value = values.find(reinterpret_cast<triton::ast::VariableNode*>(current)->getVariableId());
+            instances[current] = (value != values.end() ? value->second : current);
+            continue;
+          }
+
+          const std::vector<triton::ast::AbstractNode*>& childs = current->getChilds();
+          std::vector<triton::ast::AbstractNode*> newChilds;
+          bool changed = false;
+
+          for (auto child = childs.begin(); child != childs.end(); child++) {
+            triton::ast::AbstractNode* instance = instances.at(*child);
+            changed = changed || (instance != *child);
+            newChilds.push_back(instance);
+          }
+
+          instances[current] = (changed ? triton::ast::newInstance(current, newChilds) : current);
+        }
+
+        return instances.at(node);
+      }
+
+
+      /* [private method] */
+      bool FunctionSummaries::instantiate(const LearnedPath& path, const std::vector<triton::ast::AbstractNode*>& inputs, triton::ast::AbstractNode*& result, std::vector<triton::engines::symbolic::PathConstraint>& constraints, bool& tainted) {
+        std::unordered_map<triton::usize, triton::ast::AbstractNode*> values;
+
+        tainted = false;
+        for (triton::usize index = 0; index < path.inputs.size(); index++) {
+          values[path.inputs[index]] = inputs[index];
+          if (index + 1 < path.inputs.size())
+            tainted = tainted || this->api->isRegisterTainted(*argumentRegisters[index]);
+        }
+
+        /* The loads are done at the addresses of this call */
+        for (auto it = path.loads.begin(); it != path.loads.end(); it++) {
+          triton::uint64 addr = this->instantiate(it->address, values)->evaluate().convert_to<triton::uint64>();
+          triton::arch::MemoryAccess mem(addr, it->size);
+          values[it->variable] = this->api->buildSymbolicMemory(mem);
+          tainted = tainted || this->api->isMemoryTainted(mem);
+        }
+
+        for (auto it = path.constraints.begin(); it != path.constraints.end(); it++) {
+          triton::engines::symbolic::PathConstraint pco;
+          bool symbolized = false;
+
+          for (auto branch = it->begin(); branch != it->end(); branch++) {
+            triton::ast::AbstractNode* node = this->instantiate(branch->constraint, values);
+            if (branch->taken) {
+              if (node->evaluate() == 0)
+                return false;
+              symbolized = node->isSymbolized();
+            }
+            pco.addBranchConstraint(branch->taken, branch->srcAddr, branch->dstAddr, node);
+          }
+
+          if (symbolized)
+            constraints.push_back(pco);
+        }
+
+        result = (path.result != nullptr ? this->instantiate(path.result, values) : nullptr);
+
+        return true;
+      }
+
+
+      /* [private method] */
+      void FunctionSummaries::applyInstance(triton::ast::AbstractNode* result, const std::vector<triton::engines::symbolic::PathConstraint>& constraints, bool tainted) {
+        for (auto it = constraints.begin(); it != constraints.end(); it++)
+          this->api->getSymbolicEngine()->addPathConstraint(*it);
+
+        if (result != nullptr) {
+          this->setResult(result->evaluate().convert_to<triton::uint64>(), (result->isSymbolized() ? result : nullptr), "learned summary");
+          this->api->setTaintRegister(TRITON_X86_REG_RAX, tainted);
+        }
+      }
+
+
+    }; /* unix namespace */
+  }; /* os namespace */
+}; /* triton namespace */
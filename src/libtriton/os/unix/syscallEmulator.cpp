@@ -0,0 +1,355 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#include <algorithm>
+
+#include <api.hpp>
+#include <architecture.hpp>
+#include <cpuSize.hpp>
+#include <exceptions.hpp>
+#include <syscallEmulator.hpp>
+#include <x86Specifications.hpp>
+
+
+
+namespace triton {
+  namespace os {
+    namespace unix {
+
+      /* The Linux values, whatever the host */
+      const triton::sint64 LINUX_ENOENT = 2;
+      const triton::sint64 LINUX_EBADF  = 9;
+      const triton::sint64 LINUX_EINVAL = 22;
+      const triton::sint64 LINUX_ENOSYS = 38;
+
+      const triton::uint64 LINUX_O_ACCMODE   = 0x3;
+      const triton::uint64 LINUX_O_WRONLY    = 0x1;
+      const triton::uint64 LINUX_O_CREAT     = 0x40;
+      const triton::uint64 LINUX_O_TRUNC     = 0x200;
+      const triton::uint64 LINUX_O_APPEND    = 0x400;
+      const triton::uint64 LINUX_MAP_FIXED   = 0x10;
+      const triton::uint64 LINUX_MAP_ANON    = 0x20;
+      const triton::uint64 LINUX_PAGE_SIZE   = 0x1000;
+      const triton::usize  LINUX_PATH_MAX    = 4096;
+
+      /* The bytes written by one call, a larger write is short like on a pipe */
+      const triton::uint64 MAX_WRITE_COUNT   = 0x100000;
+
+
+      SyscallEmulator::SyscallEmulator(triton::API* api) {
+        if (api == nullptr)
+          throw triton::exceptions::API("SyscallEmulator::SyscallEmulator(): The API cannot be null.");
+
+        this->api            = api;
+        this->enabled        = false;
+        this->symbolicInputs = true;
+        this->brkBase        = 0x10000000;
+        this->brkCurrent     = this->brkBase;
+        this->mmapNext       = 0x7f0000000000;
+
+        this->files["/dev/stdin"];
+        this->files["/dev/stdout"];
+        this->files["/dev/stderr"];
+
+        this->reset();
+      }
+
+
+      void SyscallEmulator::enable(bool flag) {
+        this->enabled = flag;
+      }
+
+
+      bool SyscallEmulator::isEnabled(void) const {
+        return this->enabled;
+      }
+
+
+      void SyscallEmulator::setSymbolicInputs(bool flag) {
+        this->symbolicInputs = flag;
+      }
+
+
+      void SyscallEmulator::setBrk(triton::uint64 addr) {
+        this->brkBase    = addr;
+        this->brkCurrent = addr;
+      }
+
+
+      void SyscallEmulator::setMmapBase(triton::uint64 addr) {
+        this->mmapNext = addr;
+      }
+
+
+      void SyscallEmulator::setFile(const std::string& path, const std::vector<triton::uint8>& content) {
+        this->files[path] = content;
+      }
+
+
+      std::vector<triton::uint8> SyscallEmulator::getFile(const std::string& path) const {
+        auto it = this->files.find(path);
+        if (it == this->files.end())
+          return std::vector<triton::uint8>();
+        return it->second;
+      }
+
+
+      bool SyscallEmulator::hasExited(void) const {
+        return this->exited;
+      }
+
+
+      triton::uint64 SyscallEmulator::getExitStatus(void) const {
+        return this->exitStatus;
+      }
+
+
+      void SyscallEmulator::reset(void) {
+        this->exited     = false;
+        this->exitStatus = 0;
+
+        this->descriptors.clear();
+        this->descriptors[0] = {"/dev/stdin",  0, 0};
+        this->descriptors[1] = {"/dev/stdout", 0, LINUX_O_APPEND | 1};
+        this->descriptors[2] = {"/dev/stderr", 0, LINUX_O_APPEND | 1};
+      }
+
+
+      /* [private method] */
+      std::string SyscallEmulator::readString(triton::uint64 addr) const {
+        std::string ret;
+
+        for (triton::usize index = 0; index < LINUX_PATH_MAX; index++) {
+          triton::uint8 c = this->api->getConcreteMemoryValue(addr + index);
+          if (c == 0)
+            break;
+          ret += static_cast<char>(c);
+        }
+
+        return ret;
+      }
+
+
+      /* [private method] */
+      triton::uint64 SyscallEmulator::newDescriptor(void) const {
+        triton::uint64 fd = 0;
+
+        while (this->descriptors.find(fd) != this->descriptors.end())
+          fd++;
+
+        return fd;
+      }
+
+
+      /* [private method] */
+      triton::sint64 SyscallEmulator::read(triton::uint64 fd, triton::uint64 buf, triton::uint64 count) {
+        auto it = this->descriptors.find(fd);
+        if (it == this->descriptors.end() || (it->second.flags & LINUX_O_ACCMODE) == LINUX_O_WRONLY)
+          return -LINUX_EBADF;
+
+        Descriptor& desc = it->second;
+        const std::vector<triton::uint8>& content = this->files[desc.path];
+
+        if (desc.offset >= content.size())
+          return 0;
+
+        count = std::min<triton::uint64>(count, content.size() - desc.offset);
+        this->api->setConcreteMemoryAreaValue(buf, content.data() + desc.offset, count);
+
+        /* The symbolic state of the buffer is replaced by the input */
+        for (triton::uint64 index = 0; index < count; index++) {
+          if (this->symbolicInputs && this->api->isSymbolicEngineEnabled())
+            this->api->convertMemoryToSymbolicVariable(triton::arch::MemoryAccess(buf + index, BYTE_SIZE), "read(" + desc.path + ")");
+          else
+            this->api->concretizeMemory(buf + index);
+        }
+
+        desc.offset += count;
+        return static_cast<triton::sint64>(count);
+      }
+
+
+      /* [private method] */
+      triton::sint64 SyscallEmulator::write(triton::uint64 fd, triton::uint64 buf, triton::uint64 count) {
+        auto it = this->descriptors.find(fd);
+        if (it == this->descriptors.end() || (it->second.flags & LINUX_O_ACCMODE) == 0)
+          return -LINUX_EBADF;
+
+        /* The count comes from the program, it does not size the buffer unchecked */
+        count = std::min<triton::uint64>(count, MAX_WRITE_COUNT);
+
+        Descriptor& desc = it->second;
+        std::vector<triton::uint8>& content = this->files[desc.path];
+        std::vector<triton::uint8> data = this->api->getConcreteMemoryAreaValue(buf, count);
+
+        if (desc.flags & LINUX_O_APPEND)
+          desc.offset = content.size();
+
+        if (content.size() < desc.offset + count)
+          content.resize(desc.offset + count, 0);
+
+        std::copy(data.begin(), data.end(), content.begin() + desc.offset);
+        desc.offset += count;
+
+        return static_cast<triton::sint64>(count);
+      }
+
+
+      /* [private method] */
+      triton::sint64 SyscallEmulator::open(triton::uint64 path, triton::uint64 flags) {
+        std::string name = this->readString(path);
+
+        if (this->files.find(name) == this->files.end()) {
+          if ((flags & LINUX_O_CREAT) == 0)
+            return -LINUX_ENOENT;
+          this->files[name];
+        }
+
+        if (flags & LINUX_O_TRUNC)
+          this->files[name].clear();
+
+        triton::uint64 fd = this->newDescriptor();
+        this->descriptors[fd] = {name, 0, flags};
+
+        return static_cast<triton::sint64>(fd);
+      }
+
+
+      /* [private method] */
+      triton::sint64 SyscallEmulator::close(triton::uint64 fd) {
+        if (this->descriptors.erase(fd) == 0)
+          return -LINUX_EBADF;
+        return 0;
+      }
+
+
+      /* [private method] */
+      triton::sint64 SyscallEmulator::lseek(triton::uint64 fd, triton::uint64 offset, triton::uint64 whence) {
+        auto it = this->descriptors.find(fd);
+        if (it == this->descriptors.end())
+          return -LINUX_EBADF;
+
+        triton::sint64 base = 0;
+        switch (whence) {
+          case 0: base = 0; break;
+          case 1: base = static_cast<triton::sint64>(it->second.offset); break;
+          case 2: base = static_cast<triton::sint64>(this->files[it->second.path].size()); break;
+          default:
+            return -LINUX_EINVAL;
+        }
+
+        /* The offset is signed */
+        base += static_cast<triton::sint64>(offset);
+        if (base < 0)
+          return -LINUX_EINVAL;
+
+        it->second.offset = static_cast<triton::uint64>(base);
+        return base;
+      }
+
+
+      /* [private method] */
+      triton::sint64 SyscallEmulator::mmap(triton::uint64 addr, triton::uint64 length, triton::uint64 flags, triton::uint64 fd, triton::uint64 offset) {
+        length = (length + LINUX_PAGE_SIZE - 1) & ~(LINUX_PAGE_SIZE - 1);
+        if (length == 0 || (addr & (LINUX_PAGE_SIZE - 1)))
+          return -LINUX_EINVAL;
+
+        auto desc = this->descriptors.find(fd);
+        if ((flags & LINUX_MAP_ANON) == 0 && desc == this->descriptors.end())
+          return -LINUX_EBADF;
+
+        if ((flags & LINUX_MAP_FIXED) == 0) {
+          addr = this->mmapNext;
+          this->mmapNext += length;
+        }
+
+        /* Unmapped memory reads as zero */
+        this->api->unmapMemory(addr, length);
+
+        if ((flags & LINUX_MAP_ANON) == 0) {
+          const std::vector<triton::uint8>& content = this->files[desc->second.path];
+          if (offset < content.size()) {
+            triton::usize size = std::min<triton::uint64>(length, content.size() - offset);
+            this->api->setConcreteMemoryAreaValue(addr, content.data() + offset, size);
+          }
+        }
+
+        return static_cast<triton::sint64>(addr);
+      }
+
+
+      /* [private method] */
+      triton::sint64 SyscallEmulator::munmap(triton::uint64 addr, triton::uint64 length) {
+        if (addr & (LINUX_PAGE_SIZE - 1))
+          return -LINUX_EINVAL;
+
+        this->api->unmapMemory(addr, length);
+        return 0;
+      }
+
+
+      /* [private method] */
+      triton::sint64 SyscallEmulator::brk(triton::uint64 addr) {
+        /* Like the kernel, an invalid request returns the current break */
+        if (addr >= this->brkBase)
+          this->brkCurrent = addr;
+        return static_cast<triton::sint64>(this->brkCurrent);
+      }
+
+
+      bool SyscallEmulator::emulate(void) {
+        if (this->api->getArchitecture() != triton::arch::ARCH_X86_64)
+          throw triton::exceptions::API("SyscallEmulator::emulate(): Only the Linux x86-64 syscalls are emulated.");
+
+        triton::uint64 number = this->api->getConcreteRegisterValue(TRITON_X86_REG_RAX).convert_to<triton::uint64>();
+        triton::uint64 arg0   = this->api->getConcreteRegisterValue(TRITON_X86_REG_RDI).convert_to<triton::uint64>();
+        triton::uint64 arg1   = this->api->getConcreteRegisterValue(TRITON_X86_REG_RSI).convert_to<triton::uint64>();
+        triton::uint64 arg2   = this->api->getConcreteRegisterValue(TRITON_X86_REG_RDX).convert_to<triton::uint64>();
+        triton::uint64 arg3   = this->api->getConcreteRegisterValue(TRITON_X86_REG_R10).convert_to<triton::uint64>();
+        triton::uint64 arg4   = this->api->getConcreteRegisterValue(TRITON_X86_REG_R8).convert_to<triton::uint64>();
+        triton::uint64 arg5   = this->api->getConcreteRegisterValue(TRITON_X86_REG_R9).convert_to<triton::uint64>();
+        triton::sint64 ret    = -LINUX_ENOSYS;
+
+        switch (number) {
+          case LINUX64_SYS_READ:    ret = this->read(arg0, arg1, arg2);                  break;
+          case LINUX64_SYS_WRITE:   ret = this->write(arg0, arg1, arg2);                 break;
+          case LINUX64_SYS_OPEN:    ret = this->open(arg0, arg1);                        break;
+          case LINUX64_SYS_OPENAT:  ret = this->open(arg1, arg2);                        break;
+          case LINUX64_SYS_CLOSE:   ret = this->close(arg0);                             break;
+          case LINUX64_SYS_LSEEK:   ret = this->lseek(arg0, arg1, arg2);                 break;
+          case LINUX64_SYS_MMAP:    ret = this->mmap(arg0, arg1, arg3, arg4, arg5);      break;
+          case LINUX64_SYS_MUNMAP:  ret = this->munmap(arg0, arg1);                      break;
+          case LINUX64_SYS_BRK:     ret = this->brk(arg0);                               break;
+
+          case LINUX64_SYS_EXIT:
+          case LINUX64_SYS_EXIT_GROUP:
+            this->exited     = true;
+            this->exitStatus = arg0 & 0xff;
+            return false;
+
+          default:
+            break;
+        }
+
+        /* The result is concrete, rcx and r11 get the return address and the flags like on the hardware */
+        triton::uint64 rip    = this->api->getConcreteRegisterValue(TRITON_X86_REG_RIP).convert_to<triton::uint64>();
+        triton::uint64 rflags = this->api->getConcreteRegisterValue(TRITON_X86_REG_EFLAGS).convert_to<triton::uint64>();
+        this->api->setConcreteRegisterValue(triton::arch::Register(triton::arch::x86::ID_REG_RAX, static_cast<triton::uint64>(ret)));
+        this->api->setConcreteRegisterValue(triton::arch::Register(triton::arch::x86::ID_REG_RCX, rip));
+        this->api->setConcreteRegisterValue(triton::arch::Register(triton::arch::x86::ID_REG_R11, rflags));
+        if (this->api->isSymbolicEngineEnabled()) {
+          this->api->concretizeRegister(TRITON_X86_REG_RAX);
+          this->api->concretizeRegister(TRITON_X86_REG_RCX);
+          this->api->concretizeRegister(TRITON_X86_REG_R11);
+        }
+
+        return true;
+      }
+
+    }; /* unix namespace */
+  }; /* os namespace */
+}; /* triton namespace */
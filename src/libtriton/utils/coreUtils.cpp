@@ -5,6 +5,19 @@
 **  This program is under the terms of the BSD License.
 */
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <exception>
+#include <thread>
+#include <vector>
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+  #include <intrin.h>
+#elif defined(__x86_64__) || defined(__i386__)
+  #include <x86intrin.h>
+#endif
+
 #include <coreUtils.hpp>
 #include <cpuSize.hpp>
 
@@ -64,6 +77,74 @@ namespace triton {
       return value;
     }
 
+
+    triton::uint64 getMonotonicTime(void) {
+      return static_cast<triton::uint64>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+    }
+
+
+    triton::uint64 getCycles(void) {
+      #if (defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))) || defined(__x86_64__) || defined(__i386__)
+      return __rdtsc();
+      #else
+      return getMonotonicTime();
+      #endif
+    }
+
+
+    triton::usize getTreeNodeSize(triton::usize valueSize) {
+      /* Red-black tree nodes: color, parent, left and right links in front of the value */
+      return valueSize + 4 * sizeof(void*);
+    }
+
+
+    triton::usize getHashNodeSize(triton::usize valueSize) {
+      /* Singly linked nodes, plus one bucket per node at the default load factor */
+      return valueSize + 2 * sizeof(void*);
+    }
+
+
+    void parallelFor(triton::usize count, triton::usize grain, const std::function<void(triton::usize, triton::usize)>& body) {
+      if (grain == 0)
+        grain = 1;
+
+      triton::usize chunks = (count + grain - 1) / grain;
+      if (chunks <= 1) {
+        if (count)
+          body(0, count);
+        return;
+      }
+
+      triton::usize threads = std::min<triton::usize>(std::max<triton::usize>(std::thread::hardware_concurrency(), 1), chunks);
+      std::vector<std::exception_ptr> errors(threads);
+      std::vector<std::thread> workers;
+      std::atomic<triton::usize> next(0);
+
+      /* The calling thread takes its share of the chunks */
+      auto work = [&](triton::usize index) {
+        try {
+          for (triton::usize chunk = next++; chunk < chunks; chunk = next++)
+            body(chunk * grain, std::min(count, (chunk + 1) * grain));
+        }
+        catch (...) {
+          errors[index] = std::current_exception();
+          next = chunks;
+        }
+      };
+
+      for (triton::usize index = 1; index < threads; index++)
+        workers.push_back(std::thread(work, index));
+      work(0);
+
+      for (auto it = workers.begin(); it != workers.end(); it++)
+        it->join();
+
+      for (auto it = errors.begin(); it != errors.end(); it++) {
+        if (*it)
+          std::rethrow_exception(*it);
+      }
+    }
+
   }; /* utils namespace */
 }; /* triton namespace */
 
@@ -0,0 +1,201 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#include <mutex>
+#include <unordered_set>
+#include <vector>
+
+#if defined(__linux__)
+  #include <sys/mman.h>
+#endif
+
+#include <hugePageArena.hpp>
+
+
+
+namespace triton {
+  namespace utils {
+
+    /* The chunks and the free blocks of the arena */
+    struct ArenaState {
+      //! Guards the state, the arena is shared by the threads.
+      std::mutex lock;
+
+      //! The base addresses of the chunks.
+      std::unordered_set<triton::uint64> chunks;
+
+      //! The heads of the intrusive free lists, indexed by size class.
+      std::vector<void*> freeLists;
+
+      //! The chunk blocks are carved out of. nullptr if there is none.
+      triton::uint8* current;
+
+      //! The number of bytes of the current chunk carved out.
+      triton::usize offset;
+
+      //! The number of chunks backed by explicit huge pages.
+      triton::usize explicitChunks;
+
+      //! The number of chunks advised as transparent huge pages.
+      triton::usize transparentChunks;
+
+      //! The number of bytes of the live blocks.
+      triton::usize usedBytes;
+
+      ArenaState() {
+        this->freeLists.resize((HugePageArena::maxBlockSize / HugePageArena::granularity) + 1, nullptr);
+        this->current           = nullptr;
+        this->offset            = 0;
+        this->explicitChunks    = 0;
+        this->transparentChunks = 0;
+        this->usedBytes         = 0;
+      }
+    };
+
+
+    /* Never destroyed, blocks may be released by static destructors */
+    static ArenaState& getArena(void) {
+      static ArenaState* arena = new ArenaState();
+      return *arena;
+    }
+
+
+    /* True once a chunk has been mapped, the blocks released before do not need a lookup */
+    static std::atomic<bool> arenaMapped(false);
+
+
+    /* Maps a chunk aligned on its size. Returns nullptr if it cannot be mapped. */
+    static triton::uint8* mapChunk(ArenaState& arena) {
+      #if defined(__linux__)
+      const triton::usize size = HugePageArena::chunkSize;
+
+      /* Explicit huge pages are aligned on their size */
+      #if defined(MAP_HUGETLB)
+      int flags = (MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB);
+      #if defined(MAP_HUGE_SHIFT)
+      flags |= (21 << MAP_HUGE_SHIFT);
+      #endif
+      void* chunk = mmap(nullptr, size, PROT_READ | PROT_WRITE, flags, -1, 0);
+      if (chunk != MAP_FAILED) {
+        arena.explicitChunks++;
+        return static_cast<triton::uint8*>(chunk);
+      }
+      #endif
+
+      /* Otherwise, an aligned area which the kernel may back with transparent huge pages */
+      void* area = mmap(nullptr, size * 2, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+      if (area == MAP_FAILED)
+        return nullptr;
+
+      triton::uint8* start = static_cast<triton::uint8*>(area);
+      triton::uint8* base  = reinterpret_cast<triton::uint8*>((reinterpret_cast<triton::uint64>(start) + (size - 1)) & ~static_cast<triton::uint64>(size - 1));
+      if (base != start)
+        munmap(start, base - start);
+      if (base + size != start + (size * 2))
+        munmap(base + size, (start + (size * 2)) - (base + size));
+
+      #if defined(MADV_HUGEPAGE)
+      madvise(base, size, MADV_HUGEPAGE);
+      #endif
+
+      arena.transparentChunks++;
+      return base;
+      #else
+      return nullptr;
+      #endif
+    }
+
+
+    std::atomic<bool> HugePageArena::enabled(false);
+
+
+    void HugePageArena::enable(bool flag) {
+      HugePageArena::enabled.store(flag);
+    }
+
+
+    void* HugePageArena::allocate(std::size_t size) {
+      if (size == 0)
+        size = 1;
+
+      if (!HugePageArena::isEnabled() || size > HugePageArena::maxBlockSize)
+        return ::operator new(size, std::nothrow);
+
+      triton::usize sizeClass = (size + HugePageArena::granularity - 1) / HugePageArena::granularity;
+      triton::usize bytes     = sizeClass * HugePageArena::granularity;
+      ArenaState& arena       = getArena();
+
+      std::lock_guard<std::mutex> guard(arena.lock);
+
+      /* A block of the same size class released before */
+      void*& head = arena.freeLists[sizeClass];
+      if (head != nullptr) {
+        void* block = head;
+        head = *static_cast<void**>(block);
+        arena.usedBytes += bytes;
+        return block;
+      }
+
+      /* The tail of the current chunk is dropped if it is too small */
+      if (arena.current == nullptr || arena.offset + bytes > HugePageArena::chunkSize) {
+        triton::uint8* chunk = mapChunk(arena);
+        if (chunk == nullptr)
+          return ::operator new(size, std::nothrow);
+        arena.chunks.insert(reinterpret_cast<triton::uint64>(chunk));
+        arena.current = chunk;
+        arena.offset  = 0;
+        arenaMapped.store(true);
+      }
+
+      void* block = arena.current + arena.offset;
+      arena.offset    += bytes;
+      arena.usedBytes += bytes;
+      return block;
+    }
+
+
+    void HugePageArena::deallocate(void* ptr, std::size_t size) {
+      if (ptr == nullptr)
+        return;
+
+      if (size == 0)
+        size = 1;
+
+      /* The chunks are aligned on their size, a block belongs to the chunk of its aligned address */
+      if (arenaMapped.load() && size <= HugePageArena::maxBlockSize) {
+        triton::uint64 base = reinterpret_cast<triton::uint64>(ptr) & ~static_cast<triton::uint64>(HugePageArena::chunkSize - 1);
+        ArenaState& arena   = getArena();
+
+        std::lock_guard<std::mutex> guard(arena.lock);
+        if (arena.chunks.find(base) != arena.chunks.end()) {
+          triton::usize sizeClass = (size + HugePageArena::granularity - 1) / HugePageArena::granularity;
+          *static_cast<void**>(ptr) = arena.freeLists[sizeClass];
+          arena.freeLists[sizeClass] = ptr;
+          arena.usedBytes -= sizeClass * HugePageArena::granularity;
+          return;
+        }
+      }
+
+      ::operator delete(ptr);
+    }
+
+
+    std::map<std::string, triton::usize> HugePageArena::getStatistics(void) {
+      std::map<std::string, triton::usize> stats;
+      ArenaState& arena = getArena();
+
+      std::lock_guard<std::mutex> guard(arena.lock);
+      stats["explicitChunks"]    = arena.explicitChunks;
+      stats["transparentChunks"] = arena.transparentChunks;
+      stats["reservedBytes"]     = arena.chunks.size() * HugePageArena::chunkSize;
+      stats["usedBytes"]         = arena.usedBytes;
+
+      return stats;
+    }
+
+  }; /* utils namespace */
+}; /* triton namespace */
@@ -0,0 +1,306 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#include <cstring>
+
+#if defined(__unix__) || defined(__APPLE__)
+  #include <netdb.h>
+  #include <poll.h>
+  #include <sys/socket.h>
+  #include <sys/un.h>
+  #include <unistd.h>
+#endif
+
+#include <exceptions.hpp>
+#include <networkUtils.hpp>
+
+
+
+namespace triton {
+  namespace utils {
+
+    /* The largest frame accepted, a bound against corrupted streams */
+    static const triton::uint32 maxFrameSize = 0x40000000;
+
+
+    void writeVarint(std::string& buffer, triton::uint64 value) {
+      do {
+        triton::uint8 byte = (value & 0x7f);
+        value >>= 7;
+        buffer += static_cast<char>(value ? (byte | 0x80) : byte);
+      } while (value);
+    }
+
+
+    void writeString(std::string& buffer, const std::string& value) {
+      writeVarint(buffer, value.size());
+      buffer += value;
+    }
+
+
+    triton::uint64 readVarint(const std::string& buffer, triton::usize& offset) {
+      triton::uint64 value = 0;
+
+      for (triton::uint32 shift = 0; shift < 64; shift += 7) {
+        if (offset >= buffer.size())
+          throw triton::exceptions::Network("readVarint(): Truncated message.");
+        triton::uint8 byte = static_cast<triton::uint8>(buffer[offset++]);
+        value |= (static_cast<triton::uint64>(byte & 0x7f) << shift);
+        if ((byte & 0x80) == 0)
+          return value;
+      }
+
+      throw triton::exceptions::Network("readVarint(): Invalid varint.");
+    }
+
+
+    std::string readString(const std::string& buffer, triton::usize& offset) {
+      triton::uint64 size = readVarint(buffer, offset);
+
+      if (size > buffer.size() - offset)
+        throw triton::exceptions::Network("readString(): Truncated message.");
+
+      std::string value = buffer.substr(offset, size);
+      offset += size;
+      return value;
+    }
+
+
+    #if defined(__unix__) || defined(__APPLE__)
+
+    /* A peer which has disconnected must not raise SIGPIPE */
+    #if defined(MSG_NOSIGNAL)
+    static const int sendFlags = MSG_NOSIGNAL;
+    #else
+    static const int sendFlags = 0;
+    #endif
+
+
+    /* Sends all the bytes of a buffer */
+    static bool sendAll(int fd, const char* data, triton::usize size) {
+      while (size > 0) {
+        ssize_t sent = ::send(fd, data, size, sendFlags);
+        if (sent <= 0)
+          return false;
+        data += sent;
+        size -= sent;
+      }
+      return true;
+    }
+
+
+    /* Receives exactly `size` bytes */
+    static bool recvAll(int fd, char* data, triton::usize size) {
+      while (size > 0) {
+        ssize_t received = ::recv(fd, data, size, 0);
+        if (received <= 0)
+          return false;
+        data += received;
+        size -= received;
+      }
+      return true;
+    }
+
+
+    bool sendFrame(int socket, const std::string& payload) {
+      triton::uint32 size = static_cast<triton::uint32>(payload.size());
+      char header[4] = {
+        static_cast<char>(size), static_cast<char>(size >> 8), static_cast<char>(size >> 16), static_cast<char>(size >> 24)
+      };
+      return sendAll(socket, header, sizeof(header)) && sendAll(socket, payload.data(), payload.size());
+    }
+
+
+    bool recvFrame(int socket, std::string& payload) {
+      triton::uint8 header[4];
+
+      if (!recvAll(socket, reinterpret_cast<char*>(header), sizeof(header)))
+        return false;
+
+      triton::uint32 size = header[0] | (header[1] << 8) | (header[2] << 16) | (static_cast<triton::uint32>(header[3]) << 24);
+      if (size > maxFrameSize)
+        throw triton::exceptions::Network("recvFrame(): Frame too large.");
+
+      payload.resize(size);
+      return size == 0 || recvAll(socket, &payload[0], size);
+    }
+
+
+    int openSocket(const std::string& address, bool listen) {
+      std::string action = (listen ? "listen on " : "connect to ");
+
+      if (address.compare(0, 5, "unix:") == 0) {
+        struct sockaddr_un addr;
+        std::string path = address.substr(5);
+
+        if (path.empty() || path.size() >= sizeof(addr.sun_path))
+          throw triton::exceptions::Network("openSocket(): Invalid Unix socket path.");
+
+        std::memset(&addr, 0, sizeof(addr));
+        addr.sun_family = AF_UNIX;
+        std::strncpy(addr.sun_path, path.c_str(), sizeof(addr.sun_path) - 1);
+
+        int fd = ::socket(AF_UNIX, SOCK_STREAM, 0);
+        if (fd < 0)
+          throw triton::exceptions::Network("openSocket(): Cannot create a socket.");
+
+        #if defined(SO_NOSIGPIPE)
+        int nosigpipe = 1;
+        ::setsockopt(fd, SOL_SOCKET, SO_NOSIGPIPE, &nosigpipe, sizeof(nosigpipe));
+        #endif
+
+        if (listen)
+          ::unlink(path.c_str());
+
+        int ret = listen ? ::bind(fd, reinterpret_cast<struct sockaddr*>(&addr), sizeof(addr)) : ::connect(fd, reinterpret_cast<struct sockaddr*>(&addr), sizeof(addr));
+        if (ret != 0 || (listen && ::listen(fd, SOMAXCONN) != 0)) {
+          ::close(fd);
+          throw triton::exceptions::Network("openSocket(): Cannot " + action + address + ".");
+        }
+
+        return fd;
+      }
+
+      triton::usize colon = address.rfind(':');
+      if (colon == std::string::npos)
+        throw triton::exceptions::Network("openSocket(): Expects unix:<path> or <host>:<port> as address.");
+
+      std::string host = address.substr(0, colon);
+      std::string port = address.substr(colon + 1);
+      struct addrinfo hints;
+      struct addrinfo* infos = nullptr;
+
+      std::memset(&hints, 0, sizeof(hints));
+      hints.ai_family   = AF_UNSPEC;
+      hints.ai_socktype = SOCK_STREAM;
+      hints.ai_flags    = (listen ? AI_PASSIVE : 0);
+
+      if (::getaddrinfo(host.empty() ? nullptr : host.c_str(), port.c_str(), &hints, &infos) != 0)
+        throw triton::exceptions::Network("openSocket(): Cannot resolve " + address + ".");
+
+      int fd = -1;
+      for (struct addrinfo* info = infos; info != nullptr && fd < 0; info = info->ai_next) {
+        fd = ::socket(info->ai_family, info->ai_socktype, info->ai_protocol);
+        if (fd < 0)
+          continue;
+
+        #if defined(SO_NOSIGPIPE)
+        int nosigpipe = 1;
+        ::setsockopt(fd, SOL_SOCKET, SO_NOSIGPIPE, &nosigpipe, sizeof(nosigpipe));
+        #endif
+
+        int ret = -1;
+        if (listen) {
+          int reuse = 1;
+          ::setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+          ret = ::bind(fd, info->ai_addr, info->ai_addrlen);
+          if (ret == 0)
+            ret = ::listen(fd, SOMAXCONN);
+        }
+        else {
+          ret = ::connect(fd, info->ai_addr, info->ai_addrlen);
+        }
+
+        if (ret != 0) {
+          ::close(fd);
+          fd = -1;
+        }
+      }
+
+      ::freeaddrinfo(infos);
+
+      if (fd < 0)
+        throw triton::exceptions::Network("openSocket(): Cannot " + action + address + ".");
+
+      return fd;
+    }
+
+
+    int acceptSocket(int listener) {
+      return ::accept(listener, nullptr, nullptr);
+    }
+
+
+    std::vector<int> waitReadable(const std::vector<int>& sockets, triton::sint32 timeout) {
+      std::vector<struct pollfd> events(sockets.size());
+      std::vector<int> ret;
+
+      for (triton::usize index = 0; index < sockets.size(); index++) {
+        events[index].fd      = sockets[index];
+        events[index].events  = POLLIN;
+        events[index].revents = 0;
+      }
+
+      if (::poll(events.data(), events.size(), timeout) <= 0)
+        return ret;
+
+      for (const auto& event : events) {
+        if (event.revents & (POLLIN | POLLHUP | POLLERR))
+          ret.push_back(event.fd);
+      }
+
+      return ret;
+    }
+
+
+    void shutdownSocket(int socket) {
+      ::shutdown(socket, SHUT_RDWR);
+    }
+
+
+    void closeSocket(int socket) {
+      ::close(socket);
+    }
+
+
+    void unlinkSocket(const std::string& address) {
+      if (address.compare(0, 5, "unix:") == 0)
+        ::unlink(address.substr(5).c_str());
+    }
+
+    #else
+
+    bool sendFrame(int socket, const std::string& payload) {
+      return false;
+    }
+
+
+    bool recvFrame(int socket, std::string& payload) {
+      return false;
+    }
+
+
+    int openSocket(const std::string& address, bool listen) {
+      throw triton::exceptions::Network("openSocket(): The sockets are only available on Unix.");
+    }
+
+
+    int acceptSocket(int listener) {
+      return -1;
+    }
+
+
+    std::vector<int> waitReadable(const std::vector<int>& sockets, triton::sint32 timeout) {
+      return std::vector<int>();
+    }
+
+
+    void shutdownSocket(int socket) {
+    }
+
+
+    void closeSocket(int socket) {
+    }
+
+
+    void unlinkSocket(const std::string& address) {
+    }
+
+    #endif
+
+  }; /* utils namespace */
+}; /* triton namespace */
@@ -0,0 +1,187 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#include <cstring>
+
+#if defined(__linux__)
+  #include <linux/perf_event.h>
+  #include <sys/ioctl.h>
+  #include <sys/syscall.h>
+  #include <unistd.h>
+#endif
+
+#include <perfCounters.hpp>
+
+
+
+namespace triton {
+  namespace utils {
+
+    /* The names of the stages and of the counters in the statistics */
+    static const char* perfStageNames[PERF_NUMBER_OF_STAGES]     = {"disassembly", "semantics", "gc", "solver"};
+    static const char* perfCounterNames[PERF_NUMBER_OF_COUNTERS] = {"cycles", "instructions", "cacheMisses", "branchMisses"};
+
+
+    /* The counters of a thread, opened as one group to be read by a single syscall */
+    struct PerfGroup {
+      //! The descriptor of the leader of the group, -1 if no counter is opened.
+      int leader;
+
+      //! The descriptors of the counters, -1 if a counter is not opened.
+      int fds[PERF_NUMBER_OF_COUNTERS];
+
+      //! The counter of each value read from the group, in the order they have been opened.
+      triton::uint32 slots[PERF_NUMBER_OF_COUNTERS];
+
+      //! The number of counters opened.
+      triton::uint32 size;
+
+      //! True once the counters have been opened.
+      bool opened;
+
+      PerfGroup() {
+        this->leader = -1;
+        this->size   = 0;
+        this->opened = false;
+        for (triton::uint32 index = 0; index < PERF_NUMBER_OF_COUNTERS; index++)
+          this->fds[index] = -1;
+      }
+
+      ~PerfGroup() {
+        #if defined(__linux__)
+        for (triton::uint32 index = 0; index < PERF_NUMBER_OF_COUNTERS; index++) {
+          if (this->fds[index] != -1)
+            close(this->fds[index]);
+        }
+        #endif
+      }
+
+      void open(void) {
+        this->opened = true;
+
+        #if defined(__linux__)
+        static const triton::uint64 configs[PERF_NUMBER_OF_COUNTERS] = {
+          PERF_COUNT_HW_CPU_CYCLES,
+          PERF_COUNT_HW_INSTRUCTIONS,
+          PERF_COUNT_HW_CACHE_MISSES,
+          PERF_COUNT_HW_BRANCH_MISSES,
+        };
+
+        for (triton::uint32 index = 0; index < PERF_NUMBER_OF_COUNTERS; index++) {
+          struct perf_event_attr attr;
+
+          std::memset(&attr, 0x00, sizeof(attr));
+          attr.type           = PERF_TYPE_HARDWARE;
+          attr.size           = sizeof(attr);
+          attr.config         = configs[index];
+          attr.read_format    = PERF_FORMAT_GROUP;
+          attr.disabled       = (this->leader == -1);
+          attr.exclude_kernel = 1;
+          attr.exclude_hv     = 1;
+
+          /* The calling thread, on any CPU */
+          int fd = static_cast<int>(syscall(__NR_perf_event_open, &attr, 0, -1, this->leader, 0));
+          if (fd == -1)
+            continue;
+
+          if (this->leader == -1)
+            this->leader = fd;
+
+          this->fds[index]          = fd;
+          this->slots[this->size++] = index;
+        }
+
+        if (this->leader != -1)
+          ioctl(this->leader, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+        #endif
+      }
+
+      bool read(PerfSample& sample) {
+        std::memset(&sample, 0x00, sizeof(sample));
+
+        if (!this->opened)
+          this->open();
+
+        if (this->leader == -1)
+          return false;
+
+        #if defined(__linux__)
+        /* The number of values, then the values */
+        triton::uint64 buffer[PERF_NUMBER_OF_COUNTERS + 1];
+        if (::read(this->leader, buffer, sizeof(buffer)) < static_cast<ssize_t>(sizeof(triton::uint64) * (this->size + 1)))
+          return false;
+
+        for (triton::uint32 index = 0; index < this->size && index < buffer[0]; index++)
+          sample.values[this->slots[index]] = buffer[index + 1];
+
+        return true;
+        #else
+        return false;
+        #endif
+      }
+    };
+
+
+    static thread_local PerfGroup perfGroup;
+    static std::atomic<triton::uint64> perfTotals[PERF_NUMBER_OF_STAGES][PERF_NUMBER_OF_COUNTERS];
+    static std::atomic<triton::uint64> perfSamples[PERF_NUMBER_OF_STAGES];
+
+    std::atomic<bool> PerfCounters::enabled(false);
+
+
+    void PerfCounters::enable(bool flag) {
+      PerfCounters::enabled.store(flag);
+    }
+
+
+    bool PerfCounters::isSupported(void) {
+      PerfSample sample;
+      return perfGroup.read(sample);
+    }
+
+
+    bool PerfCounters::sample(PerfSample& sample) {
+      return perfGroup.read(sample);
+    }
+
+
+    void PerfCounters::record(perf_stage_e stage, const PerfSample& start) {
+      PerfSample end;
+
+      if (!perfGroup.read(end))
+        return;
+
+      for (triton::uint32 index = 0; index < PERF_NUMBER_OF_COUNTERS; index++)
+        perfTotals[stage][index].fetch_add(end.values[index] - start.values[index], std::memory_order_relaxed);
+      perfSamples[stage].fetch_add(1, std::memory_order_relaxed);
+    }
+
+
+    std::map<std::string, triton::usize> PerfCounters::getStatistics(void) {
+      std::map<std::string, triton::usize> stats;
+
+      for (triton::uint32 stage = 0; stage < PERF_NUMBER_OF_STAGES; stage++) {
+        std::string prefix = std::string(perfStageNames[stage]) + ".";
+        for (triton::uint32 counter = 0; counter < PERF_NUMBER_OF_COUNTERS; counter++)
+          stats[prefix + perfCounterNames[counter]] = static_cast<triton::usize>(perfTotals[stage][counter].load());
+        stats[prefix + "samples"] = static_cast<triton::usize>(perfSamples[stage].load());
+      }
+
+      return stats;
+    }
+
+
+    void PerfCounters::clear(void) {
+      for (triton::uint32 stage = 0; stage < PERF_NUMBER_OF_STAGES; stage++) {
+        for (triton::uint32 counter = 0; counter < PERF_NUMBER_OF_COUNTERS; counter++)
+          perfTotals[stage][counter].store(0);
+        perfSamples[stage].store(0);
+      }
+    }
+
+  }; /* utils namespace */
+}; /* triton namespace */
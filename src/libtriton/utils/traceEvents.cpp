@@ -0,0 +1,114 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include <traceEvents.hpp>
+
+
+
+namespace triton {
+  namespace utils {
+
+    /* A span recorded */
+    struct TraceEvent {
+      const char* name;
+      const char* category;
+      triton::uint64 start;
+      triton::uint64 end;
+    };
+
+
+    /* The spans of a thread. The lock is only taken by its thread and by dump() or clear() */
+    struct TraceBuffer {
+      std::mutex lock;
+      triton::uint32 threadId;
+      std::vector<TraceEvent> events;
+    };
+
+
+    /* The buffers of every thread which has recorded a span, kept alive after the thread exits */
+    static std::mutex traceBuffersLock;
+    static std::vector<std::shared_ptr<TraceBuffer>> traceBuffers;
+    static std::atomic<triton::uint64> traceOrigin(0);
+    static thread_local std::shared_ptr<TraceBuffer> traceBuffer;
+
+    std::atomic<bool> TraceEvents::enabled(false);
+
+
+    void TraceEvents::enable(bool flag) {
+      triton::uint64 origin = 0;
+
+      /* Timestamps are relative to the first time the recorder has been enabled */
+      if (flag)
+        traceOrigin.compare_exchange_strong(origin, triton::utils::getMonotonicTime());
+
+      TraceEvents::enabled.store(flag);
+    }
+
+
+    void TraceEvents::record(const char* name, const char* category, triton::uint64 start, triton::uint64 end) {
+      if (traceBuffer == nullptr) {
+        std::lock_guard<std::mutex> guard(traceBuffersLock);
+        traceBuffer = std::make_shared<TraceBuffer>();
+        traceBuffer->threadId = static_cast<triton::uint32>(traceBuffers.size() + 1);
+        traceBuffers.push_back(traceBuffer);
+      }
+
+      std::lock_guard<std::mutex> guard(traceBuffer->lock);
+      if (traceBuffer->events.size() >= TraceEvents::maxEventsPerThread)
+        return;
+
+      TraceEvent event = {name, category, start, end};
+      traceBuffer->events.push_back(event);
+    }
+
+
+    /* Writes nanoseconds as microseconds with three decimals */
+    static void writeMicroseconds(std::ostream& stream, triton::uint64 ns) {
+      triton::uint64 fraction = ns % 1000;
+
+      stream << (ns / 1000) << ".";
+      stream << static_cast<char>('0' + fraction / 100) << static_cast<char>('0' + (fraction / 10) % 10) << static_cast<char>('0' + fraction % 10);
+    }
+
+
+    void TraceEvents::dump(std::ostream& stream) {
+      std::lock_guard<std::mutex> guard(traceBuffersLock);
+      triton::uint64 origin = traceOrigin.load();
+      bool first = true;
+
+      stream << "{\"traceEvents\":[";
+      for (auto buffer = traceBuffers.begin(); buffer != traceBuffers.end(); buffer++) {
+        std::lock_guard<std::mutex> bufferGuard((*buffer)->lock);
+        for (auto it = (*buffer)->events.begin(); it != (*buffer)->events.end(); it++) {
+          stream << (first ? "\n" : ",\n");
+          stream << "{\"name\":\"" << it->name << "\",\"cat\":\"" << it->category << "\",\"ph\":\"X\",\"ts\":";
+          writeMicroseconds(stream, (it->start > origin ? it->start - origin : 0));
+          stream << ",\"dur\":";
+          writeMicroseconds(stream, it->end - it->start);
+          stream << ",\"pid\":1,\"tid\":" << (*buffer)->threadId << "}";
+          first = false;
+        }
+      }
+      stream << "\n],\"displayTimeUnit\":\"ns\"}\n";
+    }
+
+
+    void TraceEvents::clear(void) {
+      std::lock_guard<std::mutex> guard(traceBuffersLock);
+
+      for (auto buffer = traceBuffers.begin(); buffer != traceBuffers.end(); buffer++) {
+        std::lock_guard<std::mutex> bufferGuard((*buffer)->lock);
+        (*buffer)->events.clear();
+      }
+    }
+
+  }; /* utils namespace */
+}; /* triton namespace */
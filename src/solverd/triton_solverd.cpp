@@ -0,0 +1,90 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+/*
+** The remote solver daemon of libTriton. Built with -DSOLVERD=ON.
+**
+** Usage:
+**
+**  $ ./triton-solverd [--threads N] [--cache N] <unix:path | host:port>
+**
+** The daemon solves the queries of the clients connected with
+** triton::API::setRemoteSolver() on a pool of N solver threads (one per core
+** by default) and caches up to N decided results (4096 by default), shared by
+** all the clients. SIGINT and SIGTERM stop it and print its statistics.
+*/
+
+#include <csignal>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <thread>
+
+#include <exceptions.hpp>
+#include <remoteSolver.hpp>
+
+using namespace triton::engines::solver;
+
+
+
+/* The server stopped by the signals */
+static RemoteSolverServer* server = nullptr;
+
+
+static void onSignal(int signum) {
+  if (server != nullptr)
+    server->stop();
+}
+
+
+static int usage(const char* name) {
+  std::cerr << "Usage: " << name << " [--threads N] [--cache N] <unix:path | host:port>" << std::endl;
+  return 1;
+}
+
+
+int main(int ac, const char** av) {
+  triton::uint32 threads = std::thread::hardware_concurrency();
+  triton::usize cache    = 0x1000;
+  std::string address;
+
+  for (int index = 1; index < ac; index++) {
+    if (!std::strcmp(av[index], "--threads") && index + 1 < ac)
+      threads = std::strtoul(av[++index], nullptr, 0);
+    else if (!std::strcmp(av[index], "--cache") && index + 1 < ac)
+      cache = std::strtoull(av[++index], nullptr, 0);
+    else if (address.empty() && av[index][0] != '-')
+      address = av[index];
+    else
+      return usage(av[0]);
+  }
+
+  if (address.empty())
+    return usage(av[0]);
+
+  try {
+    RemoteSolverServer daemon(address, (threads ? threads : 1), cache);
+
+    server = &daemon;
+    std::signal(SIGINT, onSignal);
+    std::signal(SIGTERM, onSignal);
+
+    std::cout << "[+] Listening on " << address << std::endl;
+    daemon.run();
+    server = nullptr;
+
+    auto stats = daemon.getStatistics();
+    std::cout << "[+] " << stats["requests"] << " requests, " << stats["cacheHits"] << " answered by the cache" << std::endl;
+  }
+  catch (const triton::exceptions::Exception& e) {
+    std::cerr << "[-] " << e.what() << std::endl;
+    return 1;
+  }
+
+  return 0;
+}
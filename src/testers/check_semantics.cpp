@@ -0,0 +1,435 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+/*
+** The native semantics checker of libTriton. Built with -DTESTERS=ON.
+**
+** Usage:
+**
+**  $ ./triton_check_semantics [--jobs N] [--shards N] [--quiet] trace ...
+**
+** Each trace (recorded by the pintool, see TraceWriter) is replayed through
+** processing(), like check_semantics.py does under Pin but without Python in
+** the loop. After each instruction, the registers written by its semantics are
+** compared to the values recorded before the next instruction of the same
+** thread, and the bytes it stores are compared to the next reads of them.
+** Traces are cut into shards which are replayed in parallel, each worker with
+** its own API. A shard seeks to its first instruction through the index of the
+** chunks of the trace, which rebuilds the registers of every thread, and memory
+** is synchronized from the reads of each record, so shards do not depend on
+** each other.
+**
+** Output:
+**
+**  [KO] 0x400667: imul cx (2 error(s))
+**       Register       : cf
+**       Expected Value : 0000000000000000
+**       Triton Value   : 0000000000000001
+**  [...]
+**  ir: 152431 instructions, 152429 checked, 2 KO, 2 unsupported, 1.204 s (126605 insns/s)
+**
+** The exit status is 1 if an instruction is KO.
+*/
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include <api.hpp>
+#include <exceptions.hpp>
+#include <traceFile.hpp>
+#include <x86Specifications.hpp>
+
+using namespace triton;
+using namespace triton::arch;
+using namespace triton::arch::x86;
+
+
+
+/* A part of a trace replayed by a worker */
+struct Shard {
+  std::string   path;
+  triton::usize begin;
+  triton::usize end;
+
+  /* The results */
+  std::ostringstream                   report;
+  triton::usize                        checked;
+  triton::usize                        failures;
+  std::map<std::string, triton::usize> unsupported;
+  std::string                          error;
+};
+
+
+/* The registers written by an instruction, checked at the next instruction of its thread */
+struct PendingCheck {
+  triton::uint64                                          address;
+  std::string                                             disassembly;
+  std::vector<std::pair<triton::uint32, triton::uint512>> registers;
+};
+
+
+/* A byte stored by an instruction, checked at the next read of it */
+struct StoredByte {
+  triton::uint8  value;
+  triton::uint64 address;
+  std::string    disassembly;
+};
+
+
+/* The options of the checker */
+static triton::usize jobs   = 0;
+static triton::usize shards = 0;
+static bool          quiet  = false;
+
+/* The maximum number of stored bytes remembered by a worker. Older ones are forgotten */
+static const triton::usize maxStoredBytes = (1 << 20);
+
+
+/* A wall clock timer */
+class Timer {
+  private:
+    std::chrono::steady_clock::time_point begin;
+
+  public:
+    Timer() {
+      this->begin = std::chrono::steady_clock::now();
+    }
+
+    double seconds(void) const {
+      return std::chrono::duration<double>(std::chrono::steady_clock::now() - this->begin).count();
+    }
+};
+
+
+/* Returns a value as hexadecimal digits */
+static std::string toHex(const triton::uint512& value, triton::uint32 digits) {
+  std::ostringstream ret;
+  ret << std::hex << std::setfill('0') << std::setw(digits) << value;
+  return ret.str();
+}
+
+
+/* Returns the number of instructions of a trace */
+static triton::usize countInstructions(const std::string& path) {
+  triton::format::TraceReader trace;
+
+  trace.open(path);
+  return static_cast<triton::usize>(trace.getInstructionCount());
+}
+
+
+/* Writes the errors of an instruction */
+static void reportFailure(Shard& shard, triton::uint64 address, const std::string& disassembly, const std::vector<std::string>& errors) {
+  shard.failures++;
+
+  if (quiet)
+    return;
+
+  shard.report << "[KO] 0x" << std::hex << address << std::dec << ": " << disassembly << " (" << errors.size() << " error(s))" << std::endl;
+  for (auto it = errors.begin(); it != errors.end(); it++)
+    shard.report << *it;
+}
+
+
+/* Compares the registers written by the previous instruction of a thread to the recorded ones */
+static void checkRegisters(Shard& shard, const PendingCheck& check, const std::map<triton::uint32, triton::uint512>& expected) {
+  std::vector<std::string> errors;
+
+  for (auto it = check.registers.begin(); it != check.registers.end(); it++) {
+    auto value = expected.find(it->first);
+    if (value == expected.end() || value->second == it->second)
+      continue;
+
+    Register reg(it->first);
+    std::ostringstream error;
+    error << "     Register       : " << reg.getName() << std::endl;
+    error << "     Expected Value : " << toHex(value->second, reg.getSize() * 2) << std::endl;
+    error << "     Triton Value   : " << toHex(it->second, reg.getSize() * 2) << std::endl;
+    errors.push_back(error.str());
+  }
+
+  if (!errors.empty())
+    reportFailure(shard, check.address, check.disassembly, errors);
+}
+
+
+/* Compares the bytes read by an instruction to the ones stored by the previous instructions */
+static void checkMemory(Shard& shard, const triton::format::TraceInstruction& record, std::unordered_map<triton::uint64, StoredByte>& stored) {
+  for (auto mem = record.memoryReads.begin(); mem != record.memoryReads.end(); mem++) {
+    for (triton::usize index = 0; index < mem->second.size(); index++) {
+      auto it = stored.find(mem->first + index);
+      if (it == stored.end())
+        continue;
+
+      if (it->second.value != mem->second[index]) {
+        std::ostringstream error;
+        error << "     Memory         : 0x" << std::hex << (mem->first + index) << std::dec << std::endl;
+        error << "     Expected Value : " << toHex(mem->second[index], 2) << std::endl;
+        error << "     Triton Value   : " << toHex(it->second.value, 2) << std::endl;
+        reportFailure(shard, it->second.address, it->second.disassembly, std::vector<std::string>(1, error.str()));
+      }
+
+      /* The byte is synchronized with the trace from now on */
+      stored.erase(it);
+    }
+  }
+}
+
+
+/* Replays a shard with the API bound to the calling thread */
+static void replayShard(triton::API& context, Shard& shard) {
+  std::map<triton::uint32, std::map<triton::uint32, triton::uint512>> registers;
+  std::map<triton::uint32, PendingCheck> pending;
+  std::unordered_map<triton::uint64, StoredByte> stored;
+  triton::format::TraceInstruction record;
+  triton::format::TraceReader trace;
+  triton::arch::Instruction inst;
+  triton::uint32 lastThread = 0;
+  bool synchronized = false;
+
+  trace.open(shard.path);
+  context.setArchitecture(trace.getArchitecture());
+
+  /* The first record of each thread then holds all its registers */
+  if (!trace.seek(shard.begin))
+    return;
+
+  for (triton::usize index = shard.begin; trace.next(record); index++) {
+    std::map<triton::uint32, triton::uint512>& threadRegisters = registers[record.threadId];
+
+    for (auto it = record.registers.begin(); it != record.registers.end(); it++)
+      threadRegisters[it->first] = it->second;
+
+    /* The previous instruction of this thread is complete */
+    auto check = pending.find(record.threadId);
+    if (check != pending.end()) {
+      checkRegisters(shard, check->second, threadRegisters);
+
+      /* Registers badly computed are set back to the recorded values */
+      if (index < shard.end) {
+        for (auto it = check->second.registers.begin(); it != check->second.registers.end(); it++) {
+          auto value = threadRegisters.find(it->first);
+          if (value != threadRegisters.end())
+            context.setConcreteRegisterValue(Register(value->first, value->second));
+        }
+      }
+      pending.erase(check);
+    }
+
+    /* Past the shard, records only complete the pending checks */
+    if (index >= shard.end) {
+      if (pending.empty())
+        break;
+      continue;
+    }
+
+    /* Other threads may have written the memory stored by this one */
+    if (!synchronized || record.threadId != lastThread) {
+      for (auto it = threadRegisters.begin(); it != threadRegisters.end(); it++)
+        context.setConcreteRegisterValue(Register(it->first, it->second));
+      stored.clear();
+      synchronized = true;
+      lastThread   = record.threadId;
+    }
+    else {
+      for (auto it = record.registers.begin(); it != record.registers.end(); it++)
+        context.setConcreteRegisterValue(Register(it->first, it->second));
+    }
+
+    checkMemory(shard, record, stored);
+    for (auto it = record.memoryReads.begin(); it != record.memoryReads.end(); it++)
+      context.setConcreteMemoryAreaValue(it->first, it->second);
+
+    /* Only the expressions of the current instruction are kept alive */
+    context.concretizeAllRegister();
+    context.concretizeAllMemory();
+
+    inst.reset();
+    inst.setOpcodes(record.opcodes.data(), static_cast<triton::uint32>(record.opcodes.size()));
+    inst.setAddress(record.address);
+    inst.setThreadId(record.threadId);
+
+    try {
+      if (!context.processing(inst)) {
+        std::string disassembly = inst.getDisassembly();
+        shard.unsupported[disassembly.substr(0, disassembly.find(' '))]++;
+        continue;
+      }
+    }
+    catch (const triton::exceptions::Exception& e) {
+      reportFailure(shard, record.address, inst.getDisassembly(), std::vector<std::string>(1, std::string("     Exception      : ") + e.what() + "\n"));
+      continue;
+    }
+
+    shard.checked++;
+
+    PendingCheck& next = pending[record.threadId];
+    next.address     = record.address;
+    next.disassembly = inst.getDisassembly();
+    next.registers.clear();
+    const auto& writtenRegisters = inst.getWrittenRegisterHandles();
+    for (auto it = writtenRegisters.begin(); it != writtenRegisters.end(); it++) {
+      Register parent(it->first.parent);
+      bool known = false;
+
+      for (auto reg = next.registers.begin(); reg != next.registers.end(); reg++)
+        known |= (reg->first == parent.getId());
+
+      if (!known)
+        next.registers.push_back(std::make_pair(parent.getId(), context.getConcreteRegisterValue(parent)));
+    }
+
+    /* The memory written by the kernel is not in the trace */
+    if (inst.getType() == ID_INS_SYSCALL || inst.getType() == ID_INS_SYSENTER || inst.getType() == ID_INS_INT) {
+      stored.clear();
+      continue;
+    }
+
+    if (stored.size() >= maxStoredBytes)
+      stored.clear();
+
+    const auto& storeAccess = inst.getStoreAccessHandles();
+    for (auto it = storeAccess.begin(); it != storeAccess.end(); it++) {
+      triton::uint64 address = it->first.address;
+      std::vector<triton::uint8> values = context.getConcreteMemoryAreaValue(address, it->first.size);
+      for (triton::usize offset = 0; offset < values.size(); offset++) {
+        StoredByte& byte = stored[address + offset];
+        byte.value       = values[offset];
+        byte.address     = record.address;
+        byte.disassembly = next.disassembly;
+      }
+    }
+  }
+}
+
+
+/* Replays the shards given by the index until there are no more */
+static void worker(std::vector<Shard>& work, std::atomic<triton::usize>& nextShard) {
+  triton::API context;
+  context.bind();
+
+  for (triton::usize index = nextShard++; index < work.size(); index = nextShard++) {
+    try {
+      replayShard(context, work[index]);
+    }
+    catch (const triton::exceptions::Exception& e) {
+      work[index].error = e.what();
+    }
+  }
+}
+
+
+int main(int ac, const char** av) {
+  std::vector<std::string> traces;
+  std::vector<triton::usize> counts;
+  std::vector<std::thread> workers;
+  std::atomic<triton::usize> nextShard(0);
+  bool failed = false;
+
+  for (int index = 1; index < ac; index++) {
+    if (!std::strcmp(av[index], "--jobs") && index + 1 < ac)
+      jobs = std::strtoull(av[++index], nullptr, 0);
+    else if (!std::strcmp(av[index], "--shards") && index + 1 < ac)
+      shards = std::strtoull(av[++index], nullptr, 0);
+    else if (!std::strcmp(av[index], "--quiet"))
+      quiet = true;
+    else
+      traces.push_back(av[index]);
+  }
+
+  if (traces.empty()) {
+    std::cerr << "Usage: " << av[0] << " [--jobs N] [--shards N] [--quiet] trace ..." << std::endl;
+    return -1;
+  }
+
+  if (jobs == 0)
+    jobs = std::max<triton::usize>(std::thread::hardware_concurrency(), 1);
+
+  if (shards == 0)
+    shards = jobs;
+
+  /* Cuts each trace into shards of the same size */
+  std::vector<Shard> work;
+  try {
+    for (auto it = traces.begin(); it != traces.end(); it++) {
+      triton::usize count = countInstructions(*it);
+      triton::usize size  = std::max<triton::usize>((count + shards - 1) / shards, 1);
+      counts.push_back(count);
+
+      for (triton::usize begin = 0; begin < count; begin += size) {
+        work.emplace_back();
+        work.back().path     = *it;
+        work.back().begin    = begin;
+        work.back().end      = std::min(begin + size, count);
+        work.back().checked  = 0;
+        work.back().failures = 0;
+      }
+    }
+  }
+  catch (const triton::exceptions::Exception& e) {
+    std::cerr << "triton_check_semantics: " << e.what() << std::endl;
+    return -1;
+  }
+
+  Timer timer;
+  for (triton::usize index = 0; index < std::min(jobs, work.size()); index++)
+    workers.push_back(std::thread(worker, std::ref(work), std::ref(nextShard)));
+
+  for (auto it = workers.begin(); it != workers.end(); it++)
+    it->join();
+  double seconds = timer.seconds();
+
+  /* Reports in the order of the traces */
+  auto shard = work.begin();
+  for (triton::usize index = 0; index < traces.size(); index++) {
+    std::map<std::string, triton::usize> unsupported;
+    triton::usize checked  = 0;
+    triton::usize failures = 0;
+
+    for (; shard != work.end() && shard->path == traces[index]; shard++) {
+      std::cout << shard->report.str();
+      if (!shard->error.empty()) {
+        std::cerr << "triton_check_semantics: " << traces[index] << ": " << shard->error << std::endl;
+        failed = true;
+      }
+      checked  += shard->checked;
+      failures += shard->failures;
+      for (auto it = shard->unsupported.begin(); it != shard->unsupported.end(); it++)
+        unsupported[it->first] += it->second;
+    }
+
+    triton::usize count = 0;
+    for (auto it = unsupported.begin(); it != unsupported.end(); it++)
+      count += it->second;
+
+    std::cout << traces[index] << ": " << counts[index] << " instructions, " << checked << " checked, " << failures << " KO, " << count << " unsupported" << std::endl;
+    for (auto it = unsupported.begin(); it != unsupported.end(); it++)
+      std::cout << "     Unsupported    : " << it->first << " (" << it->second << ")" << std::endl;
+
+    failed |= (failures != 0);
+  }
+
+  triton::usize total = 0;
+  for (auto it = counts.begin(); it != counts.end(); it++)
+    total += *it;
+
+  std::cout << total << " instructions in " << std::fixed << std::setprecision(3) << seconds << " s ("
+            << std::setprecision(0) << (seconds > 0 ? total / seconds : 0) << " insns/s, " << workers.size() << " jobs)" << std::endl;
+
+  return failed ? 1 : 0;
+}
@@ -104,6 +104,8 @@ def cafter(instruction):
 
 if __name__ == '__main__':
     setArchitecture(ARCH.X86_64)
+    # The LEA of every memory operand is checked
+    enableMode(MODE.LEA_ASTS, True)
     startAnalysisFromEntry()
     #startAnalysisFromSymbol('check')
     insertCall(cafter,  INSERT_POINT.AFTER)
@@ -0,0 +1,156 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#include <atomic>
+#include <cstdlib>
+#include <vector>
+
+#include <pin.H>
+
+/* libTriton */
+#include <pythonObjects.hpp>
+#include <pythonXFunctions.hpp>
+
+/* pintool */
+#include "asyncCallbacks.hpp"
+#include "bindings.hpp"
+
+
+
+namespace tracer {
+  namespace pintool {
+    namespace asyncCallbacks {
+
+      /* The number of instructions consumed between two releases of the GIL */
+      static const triton::usize batchSize = 64;
+
+      /* The queue, slots[head % queueSize] is the next slot written and slots[tail % queueSize] the next one read */
+      static std::vector<triton::arch::Instruction> slots;
+
+      /* Written by the producer only */
+      static std::atomic<triton::usize> head(0);
+
+      /* Written by the consumer only */
+      static std::atomic<triton::usize> tail(0);
+
+      /* Asks the consumer to stop once the queue is empty */
+      static std::atomic<bool> stopping(false);
+
+      /* True once the consumer thread is spawned */
+      static bool enabled = false;
+
+      /* The consumer thread */
+      static PIN_THREAD_UID consumerUid;
+
+      /* The GIL state of the thread holding the client lock */
+      static PyGILState_STATE gilState;
+
+
+      /* Calls the AFTER callback with a queued instruction. The GIL must be held. */
+      static void callAfter(const triton::arch::Instruction& inst) {
+        /* CallObject needs a tuple. The size of the tuple is the number of arguments.
+         * Triton sends only one argument to the callback. This argument is the Instruction
+         * class and contains all information. */
+        PyObject* args = triton::bindings::python::xPyTuple_New(1);
+        PyTuple_SetItem(args, 0, triton::bindings::python::PyInstruction(inst));
+
+        PyObject* ret = PyObject_CallObject(tracer::pintool::options::callbackAfter, args);
+        if (ret == nullptr) {
+          PyErr_Print();
+          exit(1);
+        }
+
+        Py_DECREF(ret);
+        Py_DECREF(args);
+      }
+
+
+      /* The consumer thread */
+      static VOID consume(VOID* arg) {
+        while (true) {
+          triton::usize first = tail.load(std::memory_order_relaxed);
+          triton::usize last  = head.load(std::memory_order_acquire);
+
+          if (first == last) {
+            if (stopping.load(std::memory_order_acquire) || PIN_IsProcessExiting())
+              break;
+            PIN_Sleep(1);
+            continue;
+          }
+
+          /* The GIL is released between the batches, so that the instrumented threads are not stalled */
+          PyGILState_STATE state = PyGILState_Ensure();
+          for (triton::usize index = first; index != last && index - first < batchSize; index++) {
+            callAfter(slots[index % queueSize]);
+            tail.store(index + 1, std::memory_order_release);
+          }
+          PyGILState_Release(state);
+        }
+      }
+
+
+      bool isEnabled(void) {
+        return enabled;
+      }
+
+
+      bool start(void) {
+        if (enabled)
+          return true;
+
+        slots.resize(queueSize);
+
+        /* The GIL is created by the first call */
+        PyEval_InitThreads();
+
+        if (PIN_SpawnInternalThread(consume, nullptr, 0, &consumerUid) == INVALID_THREADID)
+          return false;
+
+        enabled = true;
+        return true;
+      }
+
+
+      void push(const triton::arch::Instruction& inst) {
+        triton::usize index = head.load(std::memory_order_relaxed);
+
+        /* The queue is full, the consumer needs the GIL to make room */
+        if (index - tail.load(std::memory_order_acquire) == queueSize) {
+          PyThreadState* state = PyEval_SaveThread();
+          while (index - tail.load(std::memory_order_acquire) == queueSize)
+            PIN_Yield();
+          PyEval_RestoreThread(state);
+        }
+
+        slots[index % queueSize] = inst;
+        head.store(index + 1, std::memory_order_release);
+      }
+
+
+      void stop(void) {
+        if (!enabled)
+          return;
+
+        stopping.store(true, std::memory_order_release);
+        PIN_WaitForThreadTermination(consumerUid, PIN_INFINITE_TIMEOUT, nullptr);
+      }
+
+
+      void enterPython(void) {
+        if (enabled)
+          gilState = PyGILState_Ensure();
+      }
+
+
+      void leavePython(void) {
+        if (enabled)
+          PyGILState_Release(gilState);
+      }
+
+    };
+  };
+};
@@ -0,0 +1,81 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#ifndef TRITON_PIN_ASYNCCALLBACKS_H
+#define TRITON_PIN_ASYNCCALLBACKS_H
+
+#include <pin.H>
+
+/* libTriton */
+#include <instruction.hpp>
+#include <tritonTypes.hpp>
+
+
+
+//! The Tracer namespace
+namespace tracer {
+/*!
+ *  \addtogroup tracer
+ *  @{
+ */
+
+  //! The Pintool namespace
+  namespace pintool {
+  /*!
+   *  \ingroup tracer
+   *  \addtogroup pintool
+   *  @{
+   */
+
+    /*!
+     *  \brief The Async Callbacks namespace
+     *
+     *  \description
+     *  When enabled, the instructions given to the `AFTER` callback are pushed into a single producer single consumer
+     *  queue and the callback is called by an internal thread instead of the instrumented one. The producers are the
+     *  instrumented threads, which only push under the client lock, so there is a single producer at a time.
+     *
+     *  The main thread releases the GIL before the program starts. The consumer holds it while it calls the callback,
+     *  and the instrumented threads hold it while they execute Python code or use the Triton API (cf: enterPython()).
+     *  The callback is thus called after the instruction is executed and must only read the instruction.
+     */
+    namespace asyncCallbacks {
+    /*!
+     *  \ingroup pintool
+     *  \addtogroup asyncCallbacks
+     *  @{
+     */
+
+      //! The number of instructions the queue can hold.
+      const triton::usize queueSize = 4096;
+
+      //! True once the consumer thread is spawned. The GIL is then released by the main thread.
+      bool isEnabled(void);
+
+      //! Spawns the consumer thread. Returns false if the thread cannot be spawned.
+      bool start(void);
+
+      //! Pushes a copy of an instruction. Waits for the consumer, without the GIL, if the queue is full.
+      void push(const triton::arch::Instruction& inst);
+
+      //! Waits until the queued instructions are consumed, then stops the consumer thread.
+      void stop(void);
+
+      //! Acquires the GIL for the calling thread if the async callbacks are enabled. The client lock must be held.
+      void enterPython(void);
+
+      //! Releases the GIL acquired by enterPython(). The client lock must be held.
+      void leavePython(void);
+
+    /*! @} End of asyncCallbacks namespace */
+    };
+  /*! @} End of pintool namespace */
+  };
+/*! @} End of tracer namespace */
+};
+
+#endif /* TRITON_PIN_ASYNCCALLBACKS_H */
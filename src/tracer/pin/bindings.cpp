@@ -13,15 +13,24 @@
 #include <tritonTypes.hpp>
 
 /* pintool */
+#include "asyncCallbacks.hpp"
 #include "bindings.hpp"
 #include "context.hpp"
 #include "snapshot.hpp"
+#include "utils.hpp"
 
 
 
 namespace tracer {
   namespace pintool {
 
+    static PyObject* pintool_analyzeAllThreads(PyObject* self, PyObject* noarg) {
+      tracer::pintool::options::analyzeAllThreads = true;
+      Py_INCREF(Py_None);
+      return Py_None;
+    }
+
+
     static PyObject* pintool_checkReadAccess(PyObject* self, PyObject* addr) {
       if (!PyLong_Check(addr) && !PyInt_Check(addr))
         return PyErr_Format(PyExc_TypeError, "tracer::pintool::checkReadAccess(): Expected an address (integer) as argument.");
@@ -59,6 +68,23 @@ namespace tracer {
     }
 
 
+    static PyObject* pintool_dumpFlightRecorder(PyObject* self, PyObject* noarg) {
+      if (!tracer::pintool::flightRecorder.isEnabled())
+        return PyErr_Format(PyExc_TypeError, "tracer::pintool::dumpFlightRecorder(): The flight recorder is not enabled (-flight-recorder option).");
+
+      tracer::pintool::flightRecorder.dump();
+      Py_INCREF(Py_None);
+      return Py_None;
+    }
+
+
+    static PyObject* pintool_enableAsyncCallbacks(PyObject* self, PyObject* noarg) {
+      tracer::pintool::options::asyncCallbacks = true;
+      Py_INCREF(Py_None);
+      return Py_None;
+    }
+
+
     static PyObject* pintool_getCurrentMemoryValue(PyObject* self, PyObject* args) {
       PyObject* mem   = nullptr;
       PyObject* size  = nullptr;
@@ -236,6 +262,16 @@ namespace tracer {
     }
 
 
+    static PyObject* pintool_recordTrace(PyObject* self, PyObject* path) {
+      if (!PyString_Check(path))
+        return PyErr_Format(PyExc_TypeError, "tracer::pintool::recordTrace(): Expected a path (string) as argument.");
+
+      tracer::pintool::recorder.enable(PyString_AsString(path));
+      Py_INCREF(Py_None);
+      return Py_None;
+    }
+
+
     static PyObject* pintool_restoreSnapshot(PyObject* self, PyObject* noarg) {
       tracer::pintool::snapshot.setRestore(true);
       Py_INCREF(Py_None);
@@ -247,6 +283,14 @@ namespace tracer {
       /* Check if the architecture is definied */
       if (triton::api.getArchitecture() == triton::arch::ARCH_INVALID)
         return PyErr_Format(PyExc_TypeError, "tracer::pintool::runProgram(): Architecture is not defined.");
+      /* The GIL is released for the analysis thread */
+      PyThreadState* state = nullptr;
+      if (tracer::pintool::options::asyncCallbacks) {
+        if (!tracer::pintool::asyncCallbacks::start())
+          return PyErr_Format(PyExc_TypeError, "tracer::pintool::runProgram(): Cannot spawn the analysis thread.");
+        state = PyEval_SaveThread();
+      }
+
       /* Never returns - Rock 'n roll baby \o/ */
       try {
         /* Provide concrete values only if Triton needs them - cf #376 */
@@ -254,6 +298,8 @@ namespace tracer {
         PIN_StartProgram();
       }
       catch (const std::exception& e) {
+        if (state != nullptr)
+          PyEval_RestoreThread(state);
         return PyErr_Format(PyExc_TypeError, "%s", e.what());
       }
       Py_INCREF(Py_None);
@@ -341,6 +387,9 @@ namespace tracer {
         tracer::pintool::options::imageBlacklist.push_back(PyString_AsString(item));
       }
 
+      /* The loaded images are matched again */
+      tracer::pintool::updateImageRanges();
+
       Py_INCREF(Py_None);
       return Py_None;
     }
@@ -361,6 +410,9 @@ namespace tracer {
         tracer::pintool::options::imageWhitelist.push_back(PyString_AsString(item));
       }
 
+      /* The loaded images are matched again */
+      tracer::pintool::updateImageRanges();
+
       Py_INCREF(Py_None);
       return Py_None;
     }
@@ -431,10 +483,13 @@ namespace tracer {
 
 
     PyMethodDef pintoolCallbacks[] = {
+      {"analyzeAllThreads",         pintool_analyzeAllThreads,          METH_NOARGS,    ""},
       {"checkReadAccess",           pintool_checkReadAccess,            METH_O,         ""},
       {"checkWriteAccess",          pintool_checkWriteAccess,           METH_O,         ""},
       {"detachProcess",             pintool_detachProcess,              METH_NOARGS,    ""},
       {"disableSnapshot",           pintool_disableSnapshot,            METH_NOARGS,    ""},
+      {"dumpFlightRecorder",        pintool_dumpFlightRecorder,         METH_NOARGS,    ""},
+      {"enableAsyncCallbacks",      pintool_enableAsyncCallbacks,       METH_NOARGS,    ""},
       {"getCurrentMemoryValue",     pintool_getCurrentMemoryValue,      METH_VARARGS,   ""},
       {"getCurrentRegisterValue",   pintool_getCurrentRegisterValue,    METH_O,         ""},
       {"getImageName",              pintool_getImageName,               METH_O,         ""},
@@ -444,6 +499,7 @@ namespace tracer {
       {"getSyscallReturn",          pintool_getSyscallReturn,           METH_O,         ""},
       {"insertCall",                pintool_insertCall,                 METH_VARARGS,   ""},
       {"isSnapshotEnabled",         pintool_isSnapshotEnabled,          METH_NOARGS,    ""},
+      {"recordTrace",               pintool_recordTrace,                METH_O,         ""},
       {"restoreSnapshot",           pintool_restoreSnapshot,            METH_NOARGS,    ""},
       {"runProgram",                pintool_runProgram,                 METH_NOARGS,    ""},
       {"setCurrentMemoryValue",     pintool_setCurrentMemoryValue,      METH_VARARGS,   ""},
@@ -20,6 +20,8 @@
 #include <tritonTypes.hpp>
 
 /* pintool */
+#include "flightRecorder.hpp"
+#include "recorder.hpp"
 #include "snapshot.hpp"
 #include "trigger.hpp"
 #include "utils.hpp"
@@ -46,6 +48,12 @@ namespace tracer {
     //! Snapshot engine
     extern Snapshot snapshot;
 
+    //! Trace recorder
+    extern Recorder recorder;
+
+    //! Last instructions of each thread
+    extern FlightRecorder flightRecorder;
+
     //! Python callbacks of the pintool module.
     extern PyMethodDef pintoolCallbacks[];
 
@@ -134,6 +142,12 @@ namespace tracer {
       //! TID focused during the JIT
       extern triton::uint32 targetThreadId;
 
+      //! Analyze all threads instead of only the targeted one, each one with its own API (cf: context::bindThread()).
+      extern bool analyzeAllThreads;
+
+      //! Call the `AFTER` callback from an analysis thread instead of the instrumented one.
+      extern bool asyncCallbacks;
+
     /*! @} End of options namespace */
     };
 
@@ -19,6 +19,7 @@
 #include <pythonXFunctions.hpp>
 
 /* pintool */
+#include "asyncCallbacks.hpp"
 #include "bindings.hpp"
 #include "utils.hpp"
 
@@ -33,6 +34,12 @@ namespace tracer {
         /* Check if there is a callback wich must be called at each instruction instrumented */
         if (tracer::pintool::analysisTrigger.getState() && tracer::pintool::options::callbackAfter) {
 
+          /* The callback is called by the analysis thread */
+          if (tracer::pintool::asyncCallbacks::isEnabled()) {
+            tracer::pintool::asyncCallbacks::push(*inst);
+            return;
+          }
+
           /* Create the Instruction Python class */
           PyObject* instClass = triton::bindings::python::PyInstruction(*inst);
 
@@ -6,7 +6,9 @@
 */
 
 #include <cstring>
+#include <map>
 #include <stdexcept>
+#include <vector>
 
 /* libTriton */
 #include <cpuSize.hpp>
@@ -14,6 +16,7 @@
 #include <x86Specifications.hpp>
 
 /* pintool */
+#include "asyncCallbacks.hpp"
 #include "bindings.hpp"
 #include "context.hpp"
 
@@ -23,8 +26,17 @@ namespace tracer {
   namespace pintool {
     namespace context {
 
-      CONTEXT* lastContext    = nullptr;
-      bool     mustBeExecuted = false;
+      thread_local CONTEXT* lastContext    = nullptr;
+      thread_local bool     mustBeExecuted = false;
+
+      //! The states of the analyzed threads. The map is guarded by the client lock, a state is only used by its thread.
+      static std::map<triton::uint32, ThreadState> threadStates;
+
+      //! The state of the calling thread, once bound.
+      static thread_local ThreadState* boundState = nullptr;
+
+      //! True once a thread has been bound to triton::api.
+      static bool defaultApiBound = false;
 
 
       triton::uint512 getCurrentRegisterValue(const triton::arch::Register& reg) {
@@ -247,10 +259,10 @@ namespace tracer {
 
         value = triton::utils::fromBufferToUint<triton::uint512>(buffer);
         syncReg.setConcreteValue(value);
-        triton::api.setConcreteRegisterValue(syncReg);
+        triton::getCurrentApi().setConcreteRegisterValue(syncReg);
 
         /* Returns the good casted value */
-        return triton::api.getConcreteRegisterValue(reg, false);
+        return triton::getCurrentApi().getConcreteRegisterValue(reg, false);
       }
 
 
@@ -408,10 +420,10 @@ namespace tracer {
         /* Sync with the libTriton */
         triton::arch::Register syncReg(reg);
         syncReg.setConcreteValue(value);
-        triton::api.setConcreteRegisterValue(syncReg);
+        triton::getCurrentApi().setConcreteRegisterValue(syncReg);
 
         /* We must concretize the register because the last symbolic value is now false */
-        triton::api.concretizeRegister(reg);
+        triton::getCurrentApi().concretizeRegister(reg);
 
         /* Define that the context must be executed as soon as possible */
         tracer::pintool::context::mustBeExecuted = true;
@@ -429,10 +441,10 @@ namespace tracer {
 
         /* Sync with the libTriton */
         mem.setConcreteValue(value);
-        triton::api.setConcreteMemoryValue(mem);
+        triton::getCurrentApi().setConcreteMemoryValue(mem);
 
         /* We must concretize the memory because the last symbolic value is now false */
-        triton::api.concretizeMemory(mem);
+        triton::getCurrentApi().concretizeMemory(mem);
 
         /* Inject memory value */
         for (triton::uint32 i = 0; i < size; i++) {
@@ -449,10 +461,10 @@ namespace tracer {
           throw std::runtime_error("tracer::pintool::context::setCurrentMemoryValue(): Page not writable.");
 
         /* Sync with the libTriton */
-        triton::api.setConcreteMemoryValue(addr, value);
+        triton::getCurrentApi().setConcreteMemoryValue(addr, value);
 
         /* We must concretize the memory because the last symbolic value is now false */
-        triton::api.concretizeMemory(addr);
+        triton::getCurrentApi().concretizeMemory(addr);
 
         /* Inject memory value */
         *((triton::uint8*)(addr)) = (value & 0xff);
@@ -461,6 +473,7 @@ namespace tracer {
 
       void executeContext(void) {
         if (tracer::pintool::context::mustBeExecuted == true) {
+          tracer::pintool::asyncCallbacks::leavePython();
           PIN_UnlockClient();
           PIN_ExecuteAt(tracer::pintool::context::lastContext);
         }
@@ -470,29 +483,101 @@ namespace tracer {
       void needConcreteRegisterValue(triton::arch::Register& reg) {
         triton::uint512 value = tracer::pintool::context::getCurrentRegisterValue(reg);
         triton::arch::Register tmp(reg.getId(), value);
-        triton::api.setConcreteRegisterValue(tmp);
+        triton::getCurrentApi().setConcreteRegisterValue(tmp);
+      }
+
+
+      /* Returns the parent registers synchronized with Pin */
+      static std::vector<triton::arch::Register> getSynchronizedRegisters(void) {
+        std::vector<triton::arch::Register> registers;
+
+        for (triton::arch::Register* reg : triton::getCurrentApi().getParentRegisters()) {
+          if (reg->getId() <= triton::arch::x86::ID_REG_EFLAGS)
+            registers.push_back(*reg);
+        }
+
+        return registers;
       }
 
 
       void synchronizeContext(void) {
-        if (triton::api.isSymbolicEngineEnabled() == false)
+        if (triton::getCurrentApi().isSymbolicEngineEnabled() == false)
           return;
 
-        for (triton::arch::Register* reg : triton::api.getParentRegisters()) {
-          if (reg->getId() > triton::arch::x86::ID_REG_EFLAGS)
-            continue;
+        /* Built once the architecture is set, the threads share the architecture */
+        static const std::vector<triton::arch::Register> synchronizedRegisters = getSynchronizedRegisters();
 
-          if (triton::api.getSymbolicRegisterId(*reg) == triton::engines::symbolic::UNSET)
+        /* Only the symbolic registers are read from Pin, their value is the evaluation of their expression */
+        for (const triton::arch::Register& reg : synchronizedRegisters) {
+          if (triton::getCurrentApi().getSymbolicRegisterId(reg) == triton::engines::symbolic::UNSET)
             continue;
 
-          triton::uint512 cv = tracer::pintool::context::getCurrentRegisterValue(*reg);
-          triton::uint512 sv = triton::api.getSymbolicRegisterValue(*reg);
+          triton::uint512 cv = tracer::pintool::context::getCurrentRegisterValue(reg);
+          triton::uint512 sv = triton::getCurrentApi().getSymbolicRegisterValue(reg);
 
           if (sv != cv) {
-            triton::api.concretizeRegister(*reg);
-            triton::api.setConcreteRegisterValue(triton::arch::Register(reg->getId(), cv));
+            triton::getCurrentApi().concretizeRegister(reg);
+            triton::getCurrentApi().setConcreteRegisterValue(triton::arch::Register(reg.getId(), cv));
+          }
+        }
+      }
+
+
+      ThreadState::ThreadState() {
+        this->api = nullptr;
+      }
+
+
+      /* Returns a new API, bound to the calling thread and set up like triton::api. The client lock must be held. */
+      static triton::API* newThreadApi(void) {
+        triton::API* api = new triton::API();
+
+        api->bind();
+        api->setArchitecture(triton::api.getArchitecture(), triton::api.getEngineProfile());
+        api->enableSymbolicEngine(triton::api.isSymbolicEngineEnabled());
+        api->enableTaintEngine(triton::api.isTaintEngineEnabled());
+
+        for (triton::uint32 mode = triton::modes::AST_DICTIONARIES; mode <= triton::modes::TRACE_EVENTS; mode++) {
+          if (triton::api.isModeEnabled(static_cast<triton::modes::mode_e>(mode)))
+            api->enableMode(static_cast<triton::modes::mode_e>(mode), true);
+        }
+
+        /* Provide concrete values only if Triton needs them - cf #376 */
+        api->addCallback(tracer::pintool::context::needConcreteRegisterValue);
+
+        return api;
+      }
+
+
+      ThreadState* bindThread(triton::uint32 threadId) {
+        if (boundState == nullptr) {
+          PIN_LockClient();
+          ThreadState& state = threadStates[threadId];
+          if (defaultApiBound == false) {
+            state.api = &triton::api;
+            defaultApiBound = true;
           }
+          else
+            state.api = newThreadApi();
+          PIN_UnlockClient();
+          boundState = &state;
         }
+
+        boundState->api->bind();
+        return boundState;
+      }
+
+
+      void removeThread(triton::uint32 threadId) {
+        auto it = threadStates.find(threadId);
+        if (it == threadStates.end())
+          return;
+
+        /* The async callbacks may still read the instructions of the thread */
+        if (it->second.api != &triton::api && tracer::pintool::asyncCallbacks::isEnabled() == false)
+          delete it->second.api;
+
+        threadStates.erase(it);
       }
 
     };
@@ -39,11 +39,11 @@ namespace tracer {
      *  @{
      */
 
-      //! The last Pin CONTEXT known.
-      extern CONTEXT* lastContext;
+      //! The last Pin CONTEXT known by the calling thread.
+      extern thread_local CONTEXT* lastContext;
 
-      //! True if the context must be executed.
-      extern bool mustBeExecuted;
+      //! True if the context of the calling thread must be executed.
+      extern thread_local bool mustBeExecuted;
 
       //! Returns the current register value from a Register.
       triton::uint512 getCurrentRegisterValue(const triton::arch::Register& reg);
@@ -81,6 +81,31 @@ namespace tracer {
       //! Synchronize weird behavior from Pin to libTriton.
       void synchronizeContext(void);
 
+      //! The analysis state of a thread when all threads are analyzed.
+      struct ThreadState {
+        //! The API which analyzes the thread.
+        triton::API* api;
+
+        //! The instruction analyzed by the thread. Threads running the same code cannot share the instruction of Pin's cache.
+        triton::arch::Instruction instruction;
+
+        //! Constructor.
+        ThreadState();
+      };
+
+      /*!
+       * \brief Binds the API of a thread to the calling thread, which must be `threadId`, and returns the state of the thread.
+       *
+       * \description The first thread bound keeps triton::api and the states set up by the script. The other ones get
+       * their own API, set up like triton::api (architecture, engines, modes and concrete register callback), so that
+       * they are analyzed without the client lock. Their concrete, symbolic and taint states start empty and the memory
+       * states are not shared between threads. The client lock must not be held.
+       */
+      ThreadState* bindThread(triton::uint32 threadId);
+
+      //! Releases the state and the API of a thread which exits. The client lock must be held.
+      void removeThread(triton::uint32 threadId);
+
     /*! @} End of context namespace */
     };
   /*! @} End of pintool namespace */
@@ -0,0 +1,175 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+
+/* pintool */
+#include "flightRecorder.hpp"
+
+
+
+namespace tracer {
+  namespace pintool {
+
+      /* Records an instruction into the ring buffer of the thread. Without call nor branch, so Pin inlines it */
+      static VOID PIN_FAST_ANALYSIS_CALL recordInstruction(FlightRecorder::Ring* ring, const FlightRecorder::Instruction* inst, ADDRINT sp, ADDRINT ax, ADDRINT flags) {
+        FlightRecorder::Entry* entry = ring->entries + (ring->count & ring->mask);
+        entry->instruction = inst;
+        entry->sp          = sp;
+        entry->ax          = ax;
+        entry->flags       = flags;
+        ring->count++;
+      }
+
+
+      FlightRecorder::FlightRecorder() {
+        this->size = 0;
+        this->reg  = REG_INVALID();
+      }
+
+
+      FlightRecorder::~FlightRecorder() {
+        for (auto& ring : this->rings) {
+          delete[] ring.second->entries;
+          delete ring.second;
+        }
+      }
+
+
+      void FlightRecorder::enable(triton::uint32 entries, const std::string& path) {
+        if (entries == 0 || this->isEnabled())
+          return;
+
+        this->reg = PIN_ClaimToolRegister();
+        if (!REG_valid(this->reg)) {
+          std::cerr << "FlightRecorder::enable(): No tool register available, the flight recorder is disabled." << std::endl;
+          return;
+        }
+
+        /* A power of two, so the index is masked instead of being checked */
+        this->size = 1;
+        while (this->size < entries)
+          this->size <<= 1;
+
+        this->path = path;
+      }
+
+
+      bool FlightRecorder::isEnabled(void) const {
+        return this->size != 0;
+      }
+
+
+      const FlightRecorder::Instruction* FlightRecorder::saveInstruction(ADDRINT address, triton::uint32 size) {
+        Instruction inst;
+
+        inst.address = address;
+        inst.size    = std::min(size, static_cast<triton::uint32>(sizeof(inst.opcodes)));
+        std::memset(inst.opcodes, 0, sizeof(inst.opcodes));
+        PIN_SafeCopy(inst.opcodes, reinterpret_cast<void*>(address), inst.size);
+
+        /* The code may have been modified since the last instrumentation */
+        auto it = this->lastInstructions.find(address);
+        if (it != this->lastInstructions.end() && it->second->size == inst.size && std::memcmp(it->second->opcodes, inst.opcodes, inst.size) == 0)
+          return it->second;
+
+        this->instructions.push_back(inst);
+        this->lastInstructions[address] = &this->instructions.back();
+
+        return &this->instructions.back();
+      }
+
+
+      void FlightRecorder::instrument(INS ins) {
+        const Instruction* inst = this->saveInstruction(INS_Address(ins), INS_Size(ins));
+
+        INS_InsertCall(ins, IPOINT_BEFORE, (AFUNPTR)recordInstruction,
+          IARG_FAST_ANALYSIS_CALL,
+          IARG_REG_VALUE, this->reg,
+          IARG_PTR, inst,
+          IARG_REG_VALUE, REG_STACK_PTR,
+          IARG_REG_VALUE, REG_GAX,
+          IARG_REG_VALUE, REG_GFLAGS,
+          IARG_END);
+      }
+
+
+      void FlightRecorder::threadStart(triton::uint32 threadId, CONTEXT* ctx) {
+        Ring* ring = new Ring();
+
+        ring->entries = new Entry[this->size]();
+        ring->mask    = this->size - 1;
+        ring->count   = 0;
+
+        this->threadFini(threadId);
+        this->rings[threadId] = ring;
+        PIN_SetContextReg(ctx, this->reg, reinterpret_cast<ADDRINT>(ring));
+      }
+
+
+      void FlightRecorder::threadFini(triton::uint32 threadId) {
+        auto it = this->rings.find(threadId);
+        if (it == this->rings.end())
+          return;
+
+        delete[] it->second->entries;
+        delete it->second;
+        this->rings.erase(it);
+      }
+
+
+      void FlightRecorder::dump(std::ostream& stream) const {
+        for (const auto& it : this->rings) {
+          const Ring* ring     = it.second;
+          triton::uint64 count = std::min(ring->count, this->size);
+
+          stream << "[flight recorder] thread " << std::dec << it.first << ": "
+                 << ring->count << " instructions executed, the last " << count << ":" << std::endl;
+
+          for (triton::uint64 index = ring->count - count; index < ring->count; index++) {
+            const Entry& entry = ring->entries[index & ring->mask];
+            if (entry.instruction == nullptr)
+              continue;
+
+            std::ostringstream opcodes;
+            for (triton::uint32 i = 0; i < entry.instruction->size; i++)
+              opcodes << std::hex << std::setw(2) << std::setfill('0') << static_cast<triton::uint32>(entry.instruction->opcodes[i]) << " ";
+
+            stream << "  0x" << std::hex << entry.instruction->address << ": "
+                   << std::left << std::setw(48) << std::setfill(' ') << opcodes.str() << std::right
+                   << "sp: 0x" << entry.sp
+                   << " ax: 0x" << entry.ax
+                   << " flags: 0x" << entry.flags << std::endl;
+          }
+        }
+        stream << std::dec;
+      }
+
+
+      void FlightRecorder::dump(void) const {
+        if (this->path.empty()) {
+          this->dump(std::cerr);
+          return;
+        }
+
+        std::ofstream stream(this->path.c_str(), std::ios::out | std::ios::app);
+        if (!stream.is_open()) {
+          std::cerr << "FlightRecorder::dump(): Cannot open " << this->path << ", dumped into the standard error." << std::endl;
+          this->dump(std::cerr);
+          return;
+        }
+
+        this->dump(stream);
+      }
+
+  };
+};
@@ -0,0 +1,145 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#ifndef PINTOOL_FLIGHTRECORDER_H
+#define PINTOOL_FLIGHTRECORDER_H
+
+#include <deque>
+#include <map>
+#include <ostream>
+#include <string>
+
+#include <pin.H>
+
+/* libTriton */
+#include <tritonTypes.hpp>
+
+
+//! The Tracer namespace
+namespace tracer {
+/*!
+ *  \addtogroup tracer
+ *  @{
+ */
+
+  //! The Pintool namespace
+  namespace pintool {
+  /*!
+   *  \ingroup tracer
+   *  \addtogroup pintool
+   *  @{
+   */
+
+    //! \class FlightRecorder
+    /*! \brief Keeps the last instructions executed by each thread, to be dumped when the program crashes.
+     *
+     * \description
+     * Each thread has a ring buffer of the last instructions it executed, with the stack pointer, the accumulator
+     * and the flags before their execution. The buffer of a thread is held by a Pin tool register, so the record of
+     * an instruction is a few stores, without any call or lock, which Pin inlines. The opcodes are saved once, when
+     * the instruction is instrumented. Unlike the recording of a trace, every instruction is recorded, even when
+     * the analysis is locked, so the recorder may be left enabled.
+     */
+    class FlightRecorder {
+
+      public:
+        //! An instrumented instruction.
+        struct Instruction {
+          //! The address of the instruction.
+          ADDRINT address;
+
+          //! The size of the instruction.
+          triton::uint32 size;
+
+          //! The opcodes of the instruction.
+          triton::uint8 opcodes[16];
+        };
+
+        //! An executed instruction.
+        struct Entry {
+          //! The instruction, nullptr if the entry is not used yet.
+          const Instruction* instruction;
+
+          //! The stack pointer.
+          ADDRINT sp;
+
+          //! The accumulator.
+          ADDRINT ax;
+
+          //! The flags.
+          ADDRINT flags;
+        };
+
+        //! The ring buffer of a thread.
+        struct Ring {
+          //! The entries, their number is a power of two.
+          Entry* entries;
+
+          //! The mask of the indexes of the entries.
+          triton::uint64 mask;
+
+          //! The number of instructions recorded.
+          triton::uint64 count;
+        };
+
+      private:
+        //! The number of entries of the ring buffers. 0 if the recorder is disabled.
+        triton::uint64 size;
+
+        //! The path of the dumps. Empty for the standard error.
+        std::string path;
+
+        //! The tool register holding the ring buffer of a thread.
+        REG reg;
+
+        //! The ring buffer of each thread.
+        std::map<triton::uint32, Ring*> rings;
+
+        //! The instrumented instructions. A deque never moves them.
+        std::deque<Instruction> instructions;
+
+        //! The last instruction instrumented at each address.
+        std::map<ADDRINT, const Instruction*> lastInstructions;
+
+        //! Returns the instruction instrumented at an address, which is saved if its opcodes changed.
+        const Instruction* saveInstruction(ADDRINT address, triton::uint32 size);
+
+      public:
+        //! Constructor.
+        FlightRecorder();
+
+        //! Destructor.
+        ~FlightRecorder();
+
+        //! Enables the recorder with `entries` entries per thread, dumped into `path` (the standard error if empty). Must be called before the program starts.
+        void enable(triton::uint32 entries, const std::string& path);
+
+        //! Returns true if the recorder is enabled.
+        bool isEnabled(void) const;
+
+        //! Inserts the record of an instruction.
+        void instrument(INS ins);
+
+        //! Must be called when a thread starts, to give it a ring buffer.
+        void threadStart(triton::uint32 threadId, CONTEXT* ctx);
+
+        //! Must be called when a thread ends.
+        void threadFini(triton::uint32 threadId);
+
+        //! Dumps the ring buffers, the oldest instructions first.
+        void dump(std::ostream& stream) const;
+
+        //! Dumps the ring buffers into the file given to enable() or into the standard error.
+        void dump(void) const;
+    };
+
+  /*! @} End of pintool namespace */
+  };
+/*! @} End of tracer namespace */
+};
+
+#endif /* PINTOOL_FLIGHTRECORDER_H */
@@ -0,0 +1,179 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#include <algorithm>
+#include <iostream>
+#include <sstream>
+#include <vector>
+
+#include <sys/uio.h>
+
+/* libTriton */
+#include <api.hpp>
+#include <exceptions.hpp>
+#include <syscalls.hpp>
+
+/* pintool */
+#include "inputs.hpp"
+
+
+
+namespace tracer {
+  namespace pintool {
+
+      /* The maximum length of a path read from the memory of the program */
+      static const triton::usize maxPathLength = 4096;
+
+
+      /* Reads a null-terminated string from the memory of the program */
+      static std::string readString(triton::__uint address) {
+        std::string str;
+        char c = 0;
+
+        while (str.size() < maxPathLength && PIN_SafeCopy(&c, reinterpret_cast<void*>(address + str.size()), 1) == 1 && c != 0)
+          str.push_back(c);
+
+        return str;
+      }
+
+
+      Inputs::Inputs() {
+        this->taint = false;
+      }
+
+
+      void Inputs::addFileDescriptor(triton::sint32 fd) {
+        this->fds.insert(fd);
+      }
+
+
+      void Inputs::addFile(const std::string& path) {
+        this->paths.insert(path);
+      }
+
+
+      void Inputs::setTaint(bool flag) {
+        this->taint = flag;
+      }
+
+
+      bool Inputs::isEnabled(void) const {
+        return !this->fds.empty() || !this->paths.empty();
+      }
+
+
+      bool Inputs::isSelected(triton::sint32 fd) const {
+        return this->fds.find(fd) != this->fds.end() || this->openedFds.find(fd) != this->openedFds.end();
+      }
+
+
+      void Inputs::syscallEntry(triton::uint32 threadId, CONTEXT* ctx, SYSCALL_STANDARD std) {
+        PendingSyscall& syscall = this->pending[threadId];
+
+        syscall.number   = PIN_GetSyscallNumber(ctx, std);
+        syscall.fd       = static_cast<triton::sint32>(PIN_GetSyscallArgument(ctx, std, 0));
+        syscall.buffer   = PIN_GetSyscallArgument(ctx, std, 1);
+        syscall.size     = PIN_GetSyscallArgument(ctx, std, 2);
+        syscall.selected = false;
+
+        switch (syscall.number) {
+          case __NR_open:
+            syscall.selected = (this->paths.find(readString(PIN_GetSyscallArgument(ctx, std, 0))) != this->paths.end());
+            break;
+
+          case __NR_openat:
+            syscall.selected = (this->paths.find(readString(PIN_GetSyscallArgument(ctx, std, 1))) != this->paths.end());
+            break;
+
+          default:
+            break;
+        }
+      }
+
+
+      void Inputs::syscallExit(triton::uint32 threadId, CONTEXT* ctx, SYSCALL_STANDARD std, bool analyzed) {
+        auto it = this->pending.find(threadId);
+        if (it == this->pending.end())
+          return;
+
+        const PendingSyscall syscall = it->second;
+        triton::sint64 ret = static_cast<triton::sint64>(PIN_GetSyscallReturn(ctx, std));
+        this->pending.erase(it);
+
+        switch (syscall.number) {
+          case __NR_open:
+          case __NR_openat:
+            if (syscall.selected && ret >= 0) {
+              std::string path = readString(syscall.number == __NR_open ? PIN_GetSyscallArgument(ctx, std, 0) : PIN_GetSyscallArgument(ctx, std, 1));
+              this->openedFds[static_cast<triton::sint32>(ret)] = path;
+              this->offsets[static_cast<triton::sint32>(ret)] = 0;
+            }
+            break;
+
+          case __NR_close:
+            if (ret == 0)
+              this->openedFds.erase(syscall.fd);
+            break;
+
+          case __NR_read:
+          case __NR_pread64:
+          #if defined(__NR_recvfrom)
+          case __NR_recvfrom:
+          #endif
+            if (ret > 0 && analyzed && this->isSelected(syscall.fd))
+              this->symbolize(syscall.fd, syscall.buffer, static_cast<triton::usize>(ret));
+            break;
+
+          case __NR_readv:
+            if (ret > 0 && analyzed && this->isSelected(syscall.fd)) {
+              for (triton::__uint index = 0; index < syscall.size && ret > 0; index++) {
+                struct iovec iov;
+                if (PIN_SafeCopy(&iov, reinterpret_cast<struct iovec*>(syscall.buffer) + index, sizeof(iov)) != sizeof(iov))
+                  break;
+                triton::usize size = std::min(static_cast<triton::usize>(ret), static_cast<triton::usize>(iov.iov_len));
+                this->symbolize(syscall.fd, reinterpret_cast<triton::__uint>(iov.iov_base), size);
+                ret -= size;
+              }
+            }
+            break;
+
+          default:
+            break;
+        }
+      }
+
+
+      void Inputs::symbolize(triton::sint32 fd, triton::__uint buffer, triton::usize size) {
+        std::vector<triton::uint8> values(size);
+        std::ostringstream comment;
+
+        /* The concrete values are synchronized before the conversion */
+        size = PIN_SafeCopy(values.data(), reinterpret_cast<void*>(buffer), size);
+        values.resize(size);
+
+        auto path = this->openedFds.find(fd);
+        if (path != this->openedFds.end())
+          comment << path->second;
+        else
+          comment << "fd " << std::dec << fd;
+        comment << " offset " << std::dec << this->offsets[fd];
+        this->offsets[fd] += size;
+
+        try {
+          triton::getCurrentApi().setConcreteMemoryAreaValue(buffer, values);
+          if (this->taint)
+            triton::getCurrentApi().taintMemoryArea(buffer, size);
+          else
+            triton::getCurrentApi().convertMemoryAreaToSymbolicVariables(buffer, size, comment.str());
+        }
+        catch (const triton::exceptions::Exception& e) {
+          std::cerr << e.what() << std::endl;
+        }
+      }
+
+  };
+};
@@ -0,0 +1,118 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#ifndef PINTOOL_INPUTS_H
+#define PINTOOL_INPUTS_H
+
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+
+#include <pin.H>
+
+/* libTriton */
+#include <tritonTypes.hpp>
+
+
+//! The Tracer namespace
+namespace tracer {
+/*!
+ *  \addtogroup tracer
+ *  @{
+ */
+
+  //! The Pintool namespace
+  namespace pintool {
+  /*!
+   *  \ingroup tracer
+   *  \addtogroup pintool
+   *  @{
+   */
+
+    //! \class Inputs
+    /*! \brief Symbolizes (or taints) the buffers filled by the input syscalls, without Python callbacks.
+     *
+     * \description
+     * The buffers of `read`, `pread64`, `readv` and `recvfrom` on the selected file descriptors, and on the
+     * ones returned by `open` and `openat` for the selected paths, are symbolized at the syscall exit. Each
+     * byte read becomes a symbolic variable whose comment gives its origin and offset.
+     */
+    class Inputs {
+
+      private:
+        //! A syscall of a thread, from its entry to its exit.
+        struct PendingSyscall {
+          //! The syscall number.
+          triton::uint64 number;
+
+          //! The file descriptor read.
+          triton::sint32 fd;
+
+          //! The buffer (or the iovec array of `readv`).
+          triton::__uint buffer;
+
+          //! The size of the buffer (or the number of iovec of `readv`).
+          triton::__uint size;
+
+          //! True if the opened path is selected (`open` and `openat`).
+          bool selected;
+        };
+
+        //! The file descriptors selected by the user.
+        std::set<triton::sint32> fds;
+
+        //! The paths selected by the user.
+        std::set<std::string> paths;
+
+        //! The file descriptors opened on a selected path, and their path.
+        std::map<triton::sint32, std::string> openedFds;
+
+        //! The syscall being executed by each thread.
+        std::map<triton::uint32, PendingSyscall> pending;
+
+        //! The number of bytes already read on each file descriptor.
+        std::map<triton::sint32, triton::uint64> offsets;
+
+        //! If true, the buffers are tainted instead of being symbolized.
+        bool taint;
+
+        //! Returns true if a file descriptor is selected.
+        bool isSelected(triton::sint32 fd) const;
+
+        //! Symbolizes (or taints) a buffer read on a file descriptor, in the API bound to the calling thread.
+        void symbolize(triton::sint32 fd, triton::__uint buffer, triton::usize size);
+
+      public:
+        //! Constructor.
+        Inputs();
+
+        //! Selects a file descriptor.
+        void addFileDescriptor(triton::sint32 fd);
+
+        //! Selects a file, by the path given to `open` or `openat`.
+        void addFile(const std::string& path);
+
+        //! Taints the buffers instead of symbolizing them.
+        void setTaint(bool flag);
+
+        //! Returns true if a file descriptor or a file is selected.
+        bool isEnabled(void) const;
+
+        //! Must be called at the syscall entry.
+        void syscallEntry(triton::uint32 threadId, CONTEXT* ctx, SYSCALL_STANDARD std);
+
+        //! Must be called at the syscall exit. The buffers are only symbolized if the thread is `analyzed`.
+        void syscallExit(triton::uint32 threadId, CONTEXT* ctx, SYSCALL_STANDARD std, bool analyzed);
+    };
+
+  /*! @} End of pintool namespace */
+  };
+/*! @} End of tracer namespace */
+};
+
+#endif /* PINTOOL_INPUTS_H */
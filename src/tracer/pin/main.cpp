@@ -6,6 +6,7 @@
 */
 
 #include <csignal>
+#include <cstdlib>
 #include <cstring>
 #include <iostream>
 #include <stdexcept>
@@ -18,8 +19,12 @@
 #include <pythonBindings.hpp>
 
 /* Pintool */
+#include "asyncCallbacks.hpp"
 #include "bindings.hpp"
 #include "context.hpp"
+#include "flightRecorder.hpp"
+#include "inputs.hpp"
+#include "recorder.hpp"
 #include "snapshot.hpp"
 #include "trigger.hpp"
 #include "utils.hpp"
@@ -509,6 +514,40 @@ if __name__ == '__main__':
     runProgram()
 ~~~~~~~~~~~~~
 
+<hr>
+\subsection Tracer_pintool_flight_recorder The flight recorder
+
+With the `-flight-recorder N` option, the pintool keeps the last `N` instructions executed by each thread (rounded up
+to a power of two), with their opcodes and the values of the stack pointer, the accumulator and the flags before their
+execution. They are dumped when the program receives a signal, before the `SIGNALS` callback, or when the
+`dumpFlightRecorder()` function is called. The dumps are written into the standard error, or appended to the file
+given by `-flight-recorder-file`. The record of an instruction is inlined by Pin and takes no lock, so the recorder is
+cheap enough to be always enabled, instead of logging each instruction from a Python callback.
+
+~~~~~~~~~~~~~
+$ TRITON_PINTOOL_OPTIONS="-flight-recorder 64" ./triton ./src/examples/pin/callback_signals.py ./binary
+[flight recorder] thread 0: 128734 instructions executed, the last 64:
+  0x400526: 55                                              sp: 0x7ffd2b5e1f28 ax: 0x400526 flags: 0x246
+  0x400527: 48 89 e5                                        sp: 0x7ffd2b5e1f20 ax: 0x400526 flags: 0x246
+  ...
+~~~~~~~~~~~~~
+
+<hr>
+\subsection Tracer_pintool_inputs Symbolizing the inputs
+
+The bytes read by the program can be symbolized by the pintool itself, without intercepting the syscalls in Python.
+The `-symbolize-fd` option selects a file descriptor and the `-symbolize-file` option a file, by the path given to
+`open` or `openat`. Both options may be repeated. At the exit of `read`, `pread64`, `readv` and `recvfrom` on a
+selected file descriptor, each byte of the buffer is converted into a symbolic variable, whose comment gives the
+file and the offset of the byte. With `-taint-input`, the buffers are tainted instead. Only the bytes read during the
+analysis are symbolized.
+
+The `triton` script passes the options of the `TRITON_PINTOOL_OPTIONS` environment variable to the pintool.
+
+~~~~~~~~~~~~~
+$ TRITON_PINTOOL_OPTIONS="-symbolize-fd 0 -symbolize-file ./input.txt" ./triton ./src/examples/pin/ir.py ./binary
+~~~~~~~~~~~~~
+
 */
 
 
@@ -520,37 +559,185 @@ namespace tracer {
     //! Pin options: -script
     KNOB<std::string> KnobPythonModule(KNOB_MODE_WRITEONCE, "pintool", "script", "", "Python script");
 
+    //! Pin options: -flight-recorder
+    KNOB<UINT32> KnobFlightRecorder(KNOB_MODE_WRITEONCE, "pintool", "flight-recorder", "0", "Number of instructions kept per thread by the flight recorder (0 disables it)");
+
+    //! Pin options: -flight-recorder-file
+    KNOB<std::string> KnobFlightRecorderFile(KNOB_MODE_WRITEONCE, "pintool", "flight-recorder-file", "", "File of the flight recorder dumps (standard error by default)");
+
+    //! Pin options: -symbolize-fd
+    KNOB<std::string> KnobSymbolizeFd(KNOB_MODE_APPEND, "pintool", "symbolize-fd", "", "Symbolize the bytes read on a file descriptor");
+
+    //! Pin options: -symbolize-file
+    KNOB<std::string> KnobSymbolizeFile(KNOB_MODE_APPEND, "pintool", "symbolize-file", "", "Symbolize the bytes read from a file");
+
+    //! Pin options: -taint-input
+    KNOB<BOOL> KnobTaintInput(KNOB_MODE_WRITEONCE, "pintool", "taint-input", "0", "Taint the bytes read instead of symbolizing them");
+
     //! Lock / Unlock InsertCall
     Trigger analysisTrigger = Trigger();
 
     //! Snapshot engine
     Snapshot snapshot = Snapshot();
 
+    //! Trace recorder
+    Recorder recorder = Recorder();
+
+    //! Input symbolization
+    Inputs inputs = Inputs();
+
+    //! Last instructions of each thread
+    FlightRecorder flightRecorder = FlightRecorder();
+
+
+
+    /* Check if the instructions of a thread must be analyzed */
+    static bool isThreadAnalyzed(triton::uint32 threadId) {
+      if (tracer::pintool::options::analyzeAllThreads)
+        return true;
+      return (threadId == tracer::pintool::options::targetThreadId);
+    }
+
+
+    /*
+     * Predicates guarding the analysis calls (INS_InsertIfCall). They do not make any call
+     * so that Pin inlines them into the JIT-ed code, and the analysis routines are only
+     * called when the analysis is unlocked for the thread.
+     */
+    static ADDRINT PIN_FAST_ANALYSIS_CALL predicateAnalysis(THREADID threadId) {
+      return (tracer::pintool::analysisTrigger.getState() && (tracer::pintool::options::analyzeAllThreads || threadId == tracer::pintool::options::targetThreadId));
+    }
+
+
+    static ADDRINT PIN_FAST_ANALYSIS_CALL predicateTrigger(void) {
+      return tracer::pintool::analysisTrigger.getState();
+    }
+
+
+    /* Bind the API of a thread when all threads are analyzed. The client lock must not be held. */
+    static void selectThread(triton::uint32 threadId) {
+      if (tracer::pintool::options::analyzeAllThreads)
+        tracer::pintool::context::bindThread(threadId);
+    }
+
+
+    /* True if the traces have been instrumented with the full context given to the analysis callbacks */
+    static bool fullContext = true;
+
+
+    /*
+     * The Python callbacks of the instructions may read and write any register, and the snapshot
+     * engine restores a whole state. Otherwise the analysis only reads the registers given by
+     * instructionRegisters().
+     */
+    static bool needFullContext(void) {
+      return (tracer::pintool::options::callbackBefore       != nullptr ||
+              tracer::pintool::options::callbackBeforeIRProc != nullptr ||
+              tracer::pintool::options::callbackAfter        != nullptr ||
+              tracer::pintool::snapshot.isLocked() == false);
+    }
+
+
+    /*
+     * The traces are instrumented for the state of the trigger: while the analysis is locked, only
+     * the trigger points are instrumented and the code runs natively. When the state changes, the
+     * instrumentation is removed so that the traces are instrumented again for the new state. The
+     * same goes when the context needed by the analysis changes (cf: needFullContext).
+     */
+    static bool refreshInstrumentation(void) {
+      bool changed = tracer::pintool::analysisTrigger.takeChange();
+
+      if (!changed && tracer::pintool::fullContext == tracer::pintool::needFullContext())
+        return false;
+
+      PIN_RemoveInstrumentation();
+      return changed;
+    }
 
 
-    /* Switch lock */
-    static void toggleWrapper(bool flag) {
+    /* Switch lock on the entry and the exit of the routine given by startAnalysisFromSymbol() */
+    static void toggleWrapper(bool flag, CONTEXT* ctx, THREADID threadId) {
       PIN_LockClient();
+      if (flag && tracer::pintool::options::targetThreadId == -1)
+        tracer::pintool::options::targetThreadId = threadId;
       tracer::pintool::analysisTrigger.update(flag);
       PIN_UnlockClient();
+
+      /* The routine was not instrumented, it is executed again from its entry */
+      if (refreshInstrumentation() && flag)
+        PIN_ExecuteAt(ctx);
+    }
+
+
+    /* Unlocks the analysis at a trigger point (cf: isAnalysisTrigger) */
+    static void callbackStartAnalysis(CONTEXT* ctx, THREADID threadId) {
+      PIN_LockClient();
+      if (tracer::pintool::options::targetThreadId == -1) {
+        tracer::pintool::options::targetThreadId = threadId;
+        tracer::pintool::analysisTrigger.update(true);
+      }
+      PIN_UnlockClient();
+
+      /* The instruction is executed again, instrumented */
+      if (refreshInstrumentation())
+        PIN_ExecuteAt(ctx);
+    }
+
+
+    /*
+     * Each analyzed thread has its own API when all threads are analyzed, so the analysis of an
+     * instruction only needs the client lock for the Python callbacks, which are not reentrant,
+     * and for the snapshot engine, which is shared.
+     */
+    static bool needClientLock(void) {
+      return (tracer::pintool::options::analyzeAllThreads == false || tracer::pintool::needFullContext());
+    }
+
+
+    /* Save a memory access into the memory of the API bound to the thread */
+    static void saveMemoryAccess(triton::__uint addr, triton::uint32 size) {
+      triton::uint512 value = tracer::pintool::context::getCurrentMemoryValue(addr, size);
+      triton::getCurrentApi().setConcreteMemoryValue(triton::arch::MemoryAccess(addr, size, value));
     }
 
 
-    /* Callback before instruction processing */
-    static void callbackBefore(triton::arch::Instruction* tritonInst, triton::uint8* addr, triton::uint32 size, CONTEXT* ctx, THREADID threadId) {
+    /*
+     * Callback before instruction processing. The memory reads of the instruction are given
+     * as arguments (with a size of 0 if there is none), which saves an analysis call and a
+     * lock per read.
+     */
+    static void callbackBefore(triton::arch::Instruction* tritonInst, triton::uint8* addr, triton::uint32 size, CONTEXT* ctx, THREADID threadId,
+                               triton::__uint read1Addr, triton::uint32 read1Size, triton::__uint read2Addr, triton::uint32 read2Size) {
+      /* A change of the trigger left by a callback which did not return */
+      tracer::pintool::refreshInstrumentation();
+
       /* Some configurations must be applied before processing */
       tracer::pintool::callbacks::preProcessing(tritonInst, threadId);
 
-      if (!tracer::pintool::analysisTrigger.getState() || threadId != tracer::pintool::options::targetThreadId)
+      if (!tracer::pintool::analysisTrigger.getState() || !tracer::pintool::isThreadAnalyzed(threadId))
       /* Analysis locked */
         return;
 
+      /* Threads running the same code cannot share the instruction of Pin's cache */
+      if (tracer::pintool::options::analyzeAllThreads)
+        tritonInst = &tracer::pintool::context::bindThread(threadId)->instruction;
+
       /* Mutex */
-      PIN_LockClient();
+      bool locked = tracer::pintool::needClientLock();
+      if (locked) {
+        PIN_LockClient();
+        tracer::pintool::asyncCallbacks::enterPython();
+      }
 
       /* Update CTX */
       tracer::pintool::context::lastContext = ctx;
 
+      /* Save the memory read by the instruction */
+      if (read1Size)
+        tracer::pintool::saveMemoryAccess(read1Addr, read1Size);
+      if (read2Size)
+        tracer::pintool::saveMemoryAccess(read2Addr, read2Size);
+
       /* Setup Triton information */
       tritonInst->partialReset();
       tritonInst->setOpcodes(addr, size);
@@ -558,7 +745,7 @@ namespace tracer {
       tritonInst->setThreadId(reinterpret_cast<triton::uint32>(threadId));
 
       /* Disassemble the instruction */
-      triton::api.disassembly(*tritonInst);
+      triton::getCurrentApi().disassembly(*tritonInst);
 
       /* Execute the Python callback before the IR processing */
       if (tracer::pintool::context::mustBeExecuted == false)
@@ -576,7 +763,7 @@ namespace tracer {
       tracer::pintool::context::synchronizeContext();
 
       /* Process the IR and taint */
-      triton::api.buildSemantics(*tritonInst);
+      triton::getCurrentApi().buildSemantics(*tritonInst);
 
       /* Execute the Python callback */
       if (tracer::pintool::context::mustBeExecuted == false)
@@ -592,18 +779,35 @@ namespace tracer {
       tracer::pintool::callbacks::postProcessing(tritonInst, threadId);
 
       /* Mutex */
-      PIN_UnlockClient();
+      if (locked) {
+        tracer::pintool::asyncCallbacks::leavePython();
+        PIN_UnlockClient();
+      }
+
+      /* The analysis may have been stopped */
+      tracer::pintool::refreshInstrumentation();
     }
 
 
     /* Callback after instruction processing */
     static void callbackAfter(triton::arch::Instruction* tritonInst, CONTEXT* ctx, THREADID threadId) {
-      if (!tracer::pintool::analysisTrigger.getState() || threadId != tracer::pintool::options::targetThreadId)
+      /* A change of the trigger left by a callback which did not return */
+      tracer::pintool::refreshInstrumentation();
+
+      if (!tracer::pintool::analysisTrigger.getState() || !tracer::pintool::isThreadAnalyzed(threadId))
       /* Analysis locked */
         return;
 
+      /* Threads running the same code cannot share the instruction of Pin's cache */
+      if (tracer::pintool::options::analyzeAllThreads)
+        tritonInst = &tracer::pintool::context::bindThread(threadId)->instruction;
+
       /* Mutex */
-      PIN_LockClient();
+      bool locked = tracer::pintool::needClientLock();
+      if (locked) {
+        PIN_LockClient();
+        tracer::pintool::asyncCallbacks::enterPython();
+      }
 
       /* Update CTX */
       tracer::pintool::context::lastContext = ctx;
@@ -617,25 +821,49 @@ namespace tracer {
       /* Clear Instruction information because of the Pin's cache */
       tritonInst->reset();
 
-      /* Check if we must execute a new context */
-      if (tracer::pintool::context::mustBeExecuted == true)
+      /* Check if we must execute a new context, only a Python callback asks for it */
+      if (locked && tracer::pintool::context::mustBeExecuted == true)
         tracer::pintool::context::executeContext();
 
       /* Check if we must restore the snapshot */
       if (tracer::pintool::snapshot.mustBeRestored() == true)
         tracer::pintool::snapshot.restoreSnapshot(ctx);
 
+      /* Mutex */
+      if (locked) {
+        tracer::pintool::asyncCallbacks::leavePython();
+        PIN_UnlockClient();
+      }
+
+      /* The analysis may have been stopped */
+      tracer::pintool::refreshInstrumentation();
+    }
+
+
+    /* Callback recording an instruction into the trace */
+    static void callbackRecord(triton::uint8* addr, triton::uint32 size, CONTEXT* ctx, THREADID threadId) {
+      if (!tracer::pintool::analysisTrigger.getState() || !tracer::pintool::isThreadAnalyzed(threadId))
+      /* Analysis locked */
+        return;
+
+      /* Mutex */
+      PIN_LockClient();
+
+      /* Update CTX */
+      tracer::pintool::context::lastContext = ctx;
+
+      tracer::pintool::recorder.beginInstruction(threadId, reinterpret_cast<triton::__uint>(addr), addr, size);
+
       /* Mutex */
       PIN_UnlockClient();
     }
 
 
-    /* Save the memory access into the Triton instruction */
-    static void saveMemoryAccess(triton::arch::Instruction* tritonInst, triton::__uint addr, triton::uint32 size) {
+    /* Callback recording a memory read into the trace */
+    static void callbackRecordMemoryRead(THREADID threadId, triton::__uint addr, triton::uint32 size) {
       /* Mutex */
       PIN_LockClient();
-      triton::uint512 value = tracer::pintool::context::getCurrentMemoryValue(addr, size);
-      triton::api.setConcreteMemoryValue(triton::arch::MemoryAccess(addr, size, value));
+      tracer::pintool::recorder.addMemoryRead(threadId, addr, size);
       /* Mutex */
       PIN_UnlockClient();
     }
@@ -654,8 +882,7 @@ namespace tracer {
       /* Mutex */
       PIN_LockClient();
 
-      for (triton::uint32 i = 0; i < writeSize ; i++)
-        tracer::pintool::snapshot.addModification(mem+i, *(reinterpret_cast<triton::uint8*>(mem+i)));
+      tracer::pintool::snapshot.addModification(mem, writeSize);
 
       /* Mutex */
       PIN_UnlockClient();
@@ -664,12 +891,16 @@ namespace tracer {
 
     /* Callback at a routine entry */
     static void callbackRoutineEntry(CONTEXT* ctx, THREADID threadId, PyObject* callback) {
-      if (!tracer::pintool::analysisTrigger.getState() || threadId != tracer::pintool::options::targetThreadId)
+      if (!tracer::pintool::analysisTrigger.getState() || !tracer::pintool::isThreadAnalyzed(threadId))
       /* Analysis locked */
         return;
 
+      /* Bind the API of the thread */
+      tracer::pintool::selectThread(threadId);
+
       /* Mutex lock */
       PIN_LockClient();
+      tracer::pintool::asyncCallbacks::enterPython();
 
       /* Update CTX */
       tracer::pintool::context::lastContext = ctx;
@@ -678,18 +909,23 @@ namespace tracer {
       tracer::pintool::callbacks::routine(threadId, callback);
 
       /* Mutex unlock */
+      tracer::pintool::asyncCallbacks::leavePython();
       PIN_UnlockClient();
     }
 
 
     /* Callback at a routine exit */
     static void callbackRoutineExit(CONTEXT* ctx, THREADID threadId, PyObject* callback) {
-      if (!tracer::pintool::analysisTrigger.getState() || threadId != tracer::pintool::options::targetThreadId)
+      if (!tracer::pintool::analysisTrigger.getState() || !tracer::pintool::isThreadAnalyzed(threadId))
       /* Analysis locked */
         return;
 
+      /* Bind the API of the thread */
+      tracer::pintool::selectThread(threadId);
+
       /* Mutex lock */
       PIN_LockClient();
+      tracer::pintool::asyncCallbacks::enterPython();
 
       /* Update CTX */
       tracer::pintool::context::lastContext = ctx;
@@ -698,25 +934,94 @@ namespace tracer {
       tracer::pintool::callbacks::routine(threadId, callback);
 
       /* Mutex unlock */
+      tracer::pintool::asyncCallbacks::leavePython();
       PIN_UnlockClient();
     }
 
 
+    /* Callback before the end of the execution, the internal threads must be stopped here */
+    static void callbackPrepareForFini(VOID *) {
+      /* The queued instructions are given to the AFTER callback before the FINI one */
+      tracer::pintool::asyncCallbacks::stop();
+    }
+
+
     /* Callback at the end of the execution */
     static void callbackFini(int, VOID *) {
+      /* Write the end of the trace */
+      if (tracer::pintool::recorder.isEnabled())
+        tracer::pintool::recorder.close();
+
+      /* Mutex */
+      PIN_LockClient();
+      tracer::pintool::asyncCallbacks::enterPython();
+
       /* Execute the Python callback */
       tracer::pintool::callbacks::fini();
+
+      /* Mutex */
+      tracer::pintool::asyncCallbacks::leavePython();
+      PIN_UnlockClient();
+    }
+
+
+    /* Callback at a thread start */
+    static void callbackThreadStart(THREADID threadId, CONTEXT* ctx, INT32 flags, VOID* v) {
+      /* Mutex */
+      PIN_LockClient();
+
+      /* Give a ring buffer to this thread */
+      tracer::pintool::flightRecorder.threadStart(threadId, ctx);
+
+      /* Mutex */
+      PIN_UnlockClient();
+    }
+
+
+    /* Callback at a thread exit */
+    static void callbackThreadFini(THREADID threadId, const CONTEXT* ctx, INT32 code, VOID* v) {
+      /* Mutex */
+      PIN_LockClient();
+
+      /* Release the ring buffer of this thread */
+      if (tracer::pintool::flightRecorder.isEnabled())
+        tracer::pintool::flightRecorder.threadFini(threadId);
+
+      /* Write the last instruction of this thread */
+      if (tracer::pintool::recorder.isEnabled())
+        tracer::pintool::recorder.flush(threadId);
+
+      /* Release the API of this thread */
+      if (tracer::pintool::options::analyzeAllThreads)
+        tracer::pintool::context::removeThread(threadId);
+
+      /* Mutex */
+      PIN_UnlockClient();
     }
 
 
     /* Callback at a syscall entry */
     static void callbackSyscallEntry(unsigned int threadId, CONTEXT* ctx, SYSCALL_STANDARD std, void* v) {
-      if (!tracer::pintool::analysisTrigger.getState() || threadId != tracer::pintool::options::targetThreadId)
+      bool analyzed = tracer::pintool::analysisTrigger.getState() && tracer::pintool::isThreadAnalyzed(threadId);
+
+      /* Bind the API of the thread, the inputs are symbolized in it */
+      if (analyzed)
+        tracer::pintool::selectThread(threadId);
+
+      /* The inputs are followed even outside the range analysis */
+      if (tracer::pintool::inputs.isEnabled()) {
+        PIN_LockClient();
+        tracer::pintool::inputs.syscallEntry(threadId, ctx, std);
+        PIN_UnlockClient();
+      }
+
+      if (!analyzed)
       /* Analysis locked */
         return;
 
       /* Mutex */
       PIN_LockClient();
+      tracer::pintool::asyncCallbacks::enterPython();
 
       /* Update CTX */
       tracer::pintool::context::lastContext = ctx;
@@ -725,18 +1030,33 @@ namespace tracer {
       tracer::pintool::callbacks::syscallEntry(threadId, std);
 
       /* Mutex */
+      tracer::pintool::asyncCallbacks::leavePython();
       PIN_UnlockClient();
     }
 
 
     /* Callback at the syscall exit */
     static void callbackSyscallExit(unsigned int threadId, CONTEXT* ctx, SYSCALL_STANDARD std, void* v) {
-      if (!tracer::pintool::analysisTrigger.getState() || threadId != tracer::pintool::options::targetThreadId)
+      bool analyzed = tracer::pintool::analysisTrigger.getState() && tracer::pintool::isThreadAnalyzed(threadId);
+
+      /* Bind the API of the thread, the inputs are symbolized in it */
+      if (analyzed)
+        tracer::pintool::selectThread(threadId);
+
+      /* The inputs are followed even outside the range analysis */
+      if (tracer::pintool::inputs.isEnabled()) {
+        PIN_LockClient();
+        tracer::pintool::inputs.syscallExit(threadId, ctx, std, analyzed);
+        PIN_UnlockClient();
+      }
+
+      if (!analyzed)
       /* Analysis locked */
         return;
 
       /* Mutex */
       PIN_LockClient();
+      tracer::pintool::asyncCallbacks::enterPython();
 
       /* Update CTX */
       tracer::pintool::context::lastContext = ctx;
@@ -745,6 +1065,7 @@ namespace tracer {
       tracer::pintool::callbacks::syscallExit(threadId, std);
 
       /* Mutex */
+      tracer::pintool::asyncCallbacks::leavePython();
       PIN_UnlockClient();
     }
 
@@ -756,6 +1077,7 @@ namespace tracer {
     static void callbackImageLoad(IMG img) {
       /* Mutex */
       PIN_LockClient();
+      tracer::pintool::asyncCallbacks::enterPython();
 
       /* Collect image information */
       std::string imagePath     = IMG_Name(img);
@@ -766,6 +1088,7 @@ namespace tracer {
       tracer::pintool::callbacks::imageLoad(imagePath, imageBase, imageSize);
 
       /* Mutex */
+      tracer::pintool::asyncCallbacks::leavePython();
       PIN_UnlockClient();
     }
 
@@ -775,6 +1098,12 @@ namespace tracer {
       /* Mutex */
       PIN_LockClient();
 
+      /* Dump the last instructions before the Python callback, which may fail */
+      if (tracer::pintool::flightRecorder.isEnabled())
+        tracer::pintool::flightRecorder.dump();
+
+      tracer::pintool::asyncCallbacks::enterPython();
+
       /* Update CTX */
       tracer::pintool::context::lastContext = ctx;
 
@@ -782,6 +1111,7 @@ namespace tracer {
       tracer::pintool::callbacks::signals(threadId, sig);
 
       /* Mutex */
+      tracer::pintool::asyncCallbacks::leavePython();
       PIN_UnlockClient();
 
       /*
@@ -813,12 +1143,16 @@ namespace tracer {
               IPOINT_BEFORE,
               (AFUNPTR) toggleWrapper,
               IARG_BOOL, true,
+              IARG_CONTEXT,
+              IARG_THREAD_ID,
               IARG_END);
 
           RTN_InsertCall(targetRTN,
               IPOINT_AFTER,
               (AFUNPTR) toggleWrapper,
               IARG_BOOL, false,
+              IARG_CONTEXT,
+              IARG_THREAD_ID,
               IARG_END);
 
           RTN_Close(targetRTN);
@@ -850,116 +1184,208 @@ namespace tracer {
        * Callback when a new image is loaded.
        * This callback must be called even outside the range analysis.
        */
-      if (IMG_Valid(img))
+      if (IMG_Valid(img)) {
+        tracer::pintool::addImageRange(img);
         tracer::pintool::callbackImageLoad(img);
+      }
     }
 
 
-    /* Check if the analysis must be unlocked */
-    static bool checkUnlockAnalysis(triton::__uint address) {
+    /* Image unloading */
+    static void IMG_Unload(IMG img, void *v) {
+      if (IMG_Valid(img))
+        tracer::pintool::removeImageRange(img);
+    }
+
+
+    /* Check if the analysis must be unlocked at an instruction. The routine from symbol is instrumented by IMG_Instrumentation. */
+    static bool isAnalysisTrigger(triton::__uint address) {
       if (tracer::pintool::options::targetThreadId != -1)
         return false;
 
-      /* Unlock the analysis at the entry point from symbol */
-      if (tracer::pintool::options::startAnalysisFromSymbol != nullptr) {
-        if ((RTN_FindNameByAddress(address) == tracer::pintool::options::startAnalysisFromSymbol)) {
-          tracer::pintool::options::targetThreadId = PIN_ThreadId();
-          tracer::pintool::toggleWrapper(true);
-          return true;
-        }
-      }
-
       /* Unlock the analysis at the entry point from address */
-      else if (tracer::pintool::options::startAnalysisFromAddress.find(address) != tracer::pintool::options::startAnalysisFromAddress.end()) {
-          tracer::pintool::options::targetThreadId = PIN_ThreadId();
-          tracer::pintool::toggleWrapper(true);
-          return true;
-      }
+      if (tracer::pintool::options::startAnalysisFromAddress.find(address) != tracer::pintool::options::startAnalysisFromAddress.end())
+        return true;
 
       /* Unlock the analysis at the entry point from offset */
-      else if (tracer::pintool::options::startAnalysisFromOffset.find(tracer::pintool::getInsOffset(address)) != tracer::pintool::options::startAnalysisFromOffset.end()) {
-          tracer::pintool::options::targetThreadId = PIN_ThreadId();
-          tracer::pintool::toggleWrapper(true);
-          return true;
-      }
+      if (!tracer::pintool::options::startAnalysisFromOffset.empty() &&
+          tracer::pintool::options::startAnalysisFromOffset.find(tracer::pintool::getInsOffset(address)) != tracer::pintool::options::startAnalysisFromOffset.end())
+        return true;
+
       return false;
     }
 
 
-    /* Check if the instruction is blacklisted */
+    /* Check if the instruction is blacklisted, the filters are matched once per image */
     static bool instructionBlacklisted(triton::__uint address) {
-      std::list<const char *>::iterator it;
-      for (it = tracer::pintool::options::imageBlacklist.begin(); it != tracer::pintool::options::imageBlacklist.end(); it++) {
-        if (strstr(tracer::pintool::getImageName(address).c_str(), *it))
-          return true;
-      }
-      return false;
+      return tracer::pintool::isImageBlacklisted(address);
     }
 
 
-    /* Check if the instruction is whitelisted */
+    /* Check if the instruction is whitelisted, the filters are matched once per image */
     static bool instructionWhitelisted(triton::__uint address) {
-      std::list<const char *>::iterator it;
+      return tracer::pintool::isImageWhitelisted(address);
+    }
 
-      /* If there is no whitelist -> jit everything */
-      if (tracer::pintool::options::imageWhitelist.empty())
-        return true;
 
-      for (it = tracer::pintool::options::imageWhitelist.begin(); it != tracer::pintool::options::imageWhitelist.end(); it++) {
-        if (strstr(tracer::pintool::getImageName(address).c_str(), *it))
-          return true;
+    /* Adds a register accessed by an instruction to a set, as the register read by Triton */
+    static void insertRegister(REGSET& regs, REG reg) {
+      if (!REG_valid(reg))
+        return;
+
+      reg = REG_FullRegName(reg);
+      REGSET_Insert(regs, reg);
+
+      /* The SSE registers are synchronized with their AVX parent and the control register */
+      if (REG_is_xmm(reg)) {
+        REGSET_Insert(regs, static_cast<REG>(REG_YMM0 + (reg - REG_XMM0)));
+        REGSET_Insert(regs, REG_MXCSR);
+      }
+      else if (REG_is_ymm(reg)) {
+        REGSET_Insert(regs, static_cast<REG>(REG_XMM0 + (reg - REG_YMM0)));
+        REGSET_Insert(regs, REG_MXCSR);
       }
+    }
 
-      return false;
+
+    /*
+     * The registers read by the analysis of an instruction: the general purpose ones, which are
+     * synchronized with the symbolic ones (cf: synchronizeContext), the segments and the registers
+     * the instruction reads or writes. The FP, SSE and AVX state is only spilled when used.
+     */
+    static void instructionRegisters(INS ins, REGSET& regs) {
+      REGSET_Clear(regs);
+
+      for (REG reg = REG_GR_BASE; reg <= REG_GR_LAST; reg = static_cast<REG>(reg + 1))
+        REGSET_Insert(regs, reg);
+
+      REGSET_Insert(regs, REG_INST_PTR);
+      REGSET_Insert(regs, REG_GFLAGS);
+      REGSET_Insert(regs, REG_SEG_CS);
+      REGSET_Insert(regs, REG_SEG_DS);
+      REGSET_Insert(regs, REG_SEG_ES);
+      REGSET_Insert(regs, REG_SEG_SS);
+      REGSET_Insert(regs, REG_SEG_FS_BASE);
+      REGSET_Insert(regs, REG_SEG_GS_BASE);
+
+      for (UINT32 index = 0; index < INS_MaxNumRRegs(ins); index++)
+        tracer::pintool::insertRegister(regs, INS_RegR(ins, index));
+
+      for (UINT32 index = 0; index < INS_MaxNumWRegs(ins); index++)
+        tracer::pintool::insertRegister(regs, INS_RegW(ins, index));
     }
 
 
     /* Trace instrumentation */
     static void TRACE_Instrumentation(TRACE trace, VOID *v) {
+      /* The register sets are read when the calls are inserted, the context is never written back */
+      REGSET inRegs;
+      REGSET outRegs;
+
+      REGSET_Clear(outRegs);
+      tracer::pintool::fullContext = tracer::pintool::needFullContext();
 
       for (BBL bbl = TRACE_BblHead(trace); BBL_Valid(bbl); bbl = BBL_Next(bbl)) {
         for (INS ins = BBL_InsHead(bbl); INS_Valid(ins); ins = INS_Next(ins)) {
 
-          /* Check if the analysis me be unlocked */
-          tracer::pintool::checkUnlockAnalysis(INS_Address(ins));
+          /* Every instruction is recorded by the flight recorder, even if the analysis is locked */
+          if (tracer::pintool::flightRecorder.isEnabled())
+            tracer::pintool::flightRecorder.instrument(ins);
 
-          if (!tracer::pintool::analysisTrigger.getState())
-          /* Analysis locked */
+          /* Analysis locked, only the trigger points are instrumented */
+          if (!tracer::pintool::analysisTrigger.getState()) {
+            if (tracer::pintool::isAnalysisTrigger(INS_Address(ins)))
+              INS_InsertCall(ins, IPOINT_BEFORE, (AFUNPTR)callbackStartAnalysis, IARG_CONTEXT, IARG_THREAD_ID, IARG_END);
             continue;
+          }
 
           if (tracer::pintool::instructionBlacklisted(INS_Address(ins)) == true || tracer::pintool::instructionWhitelisted(INS_Address(ins)) == false)
           /* Insruction blacklisted */
             continue;
 
+          /* Only record the execution, the trace is analyzed offline */
+          if (tracer::pintool::recorder.isEnabled()) {
+            INS_InsertIfCall(ins, IPOINT_BEFORE, (AFUNPTR)predicateAnalysis, IARG_FAST_ANALYSIS_CALL, IARG_THREAD_ID, IARG_END);
+            INS_InsertThenCall(ins, IPOINT_BEFORE, (AFUNPTR)callbackRecord,
+              IARG_INST_PTR,
+              IARG_UINT32, INS_Size(ins),
+              IARG_CONTEXT,
+              IARG_THREAD_ID,
+              IARG_END);
+
+            if (INS_IsMemoryRead(ins)) {
+              INS_InsertIfCall(ins, IPOINT_BEFORE, (AFUNPTR)predicateAnalysis, IARG_FAST_ANALYSIS_CALL, IARG_THREAD_ID, IARG_END);
+              INS_InsertThenCall(ins, IPOINT_BEFORE, (AFUNPTR)callbackRecordMemoryRead,
+                IARG_THREAD_ID,
+                IARG_MEMORYREAD_EA,
+                IARG_MEMORYREAD_SIZE,
+                IARG_END);
+            }
+
+            if (INS_HasMemoryRead2(ins)) {
+              INS_InsertIfCall(ins, IPOINT_BEFORE, (AFUNPTR)predicateAnalysis, IARG_FAST_ANALYSIS_CALL, IARG_THREAD_ID, IARG_END);
+              INS_InsertThenCall(ins, IPOINT_BEFORE, (AFUNPTR)callbackRecordMemoryRead,
+                IARG_THREAD_ID,
+                IARG_MEMORYREAD2_EA,
+                IARG_MEMORYREAD_SIZE,
+                IARG_END);
+            }
+
+            continue;
+          }
+
           /* Prepare the Triton's instruction */
           triton::arch::Instruction* tritonInst = new triton::arch::Instruction();
 
-          /* Save memory read1 informations */
-          if (INS_IsMemoryRead(ins)) {
-            INS_InsertCall(ins, IPOINT_BEFORE, (AFUNPTR)saveMemoryAccess,
+          /* The context given to the analysis, only the registers it reads unless the full one is needed */
+          IARGLIST context = IARGLIST_Alloc();
+
+          if (tracer::pintool::fullContext)
+            IARGLIST_AddArguments(context, IARG_CONTEXT, IARG_END);
+          else {
+            tracer::pintool::instructionRegisters(ins, inRegs);
+            IARGLIST_AddArguments(context, IARG_PARTIAL_CONTEXT, &inRegs, &outRegs, IARG_END);
+          }
+
+          /* Memory reads informations, given to the callback before */
+          IARGLIST reads = IARGLIST_Alloc();
+
+          if (INS_IsMemoryRead(ins))
+            IARGLIST_AddArguments(reads, IARG_MEMORYREAD_EA, IARG_MEMORYREAD_SIZE, IARG_END);
+          else
+            IARGLIST_AddArguments(reads, IARG_ADDRINT, static_cast<ADDRINT>(0), IARG_UINT32, 0, IARG_END);
+
+          if (INS_HasMemoryRead2(ins))
+            IARGLIST_AddArguments(reads, IARG_MEMORYREAD2_EA, IARG_MEMORYREAD_SIZE, IARG_END);
+          else
+            IARGLIST_AddArguments(reads, IARG_ADDRINT, static_cast<ADDRINT>(0), IARG_UINT32, 0, IARG_END);
+
+          /* Callback before. An entry point of the analysis must always reach the pre-processing */
+          triton::__uint address = INS_Address(ins);
+          if (tracer::pintool::options::startAnalysisFromAddress.find(address) != tracer::pintool::options::startAnalysisFromAddress.end() ||
+              tracer::pintool::options::startAnalysisFromOffset.find(tracer::pintool::getInsOffset(address)) != tracer::pintool::options::startAnalysisFromOffset.end()) {
+            INS_InsertCall(ins, IPOINT_BEFORE, (AFUNPTR)callbackBefore,
               IARG_PTR, tritonInst,
-              IARG_MEMORYREAD_EA,
-              IARG_MEMORYREAD_SIZE,
+              IARG_INST_PTR,
+              IARG_UINT32, INS_Size(ins),
+              IARG_IARGLIST, context,
+              IARG_THREAD_ID,
+              IARG_IARGLIST, reads,
               IARG_END);
           }
-
-          /* Save memory read2 informations */
-          if (INS_HasMemoryRead2(ins)) {
-            INS_InsertCall(ins, IPOINT_BEFORE, (AFUNPTR)saveMemoryAccess,
+          else {
+            INS_InsertIfCall(ins, IPOINT_BEFORE, (AFUNPTR)predicateAnalysis, IARG_FAST_ANALYSIS_CALL, IARG_THREAD_ID, IARG_END);
+            INS_InsertThenCall(ins, IPOINT_BEFORE, (AFUNPTR)callbackBefore,
               IARG_PTR, tritonInst,
-              IARG_MEMORYREAD2_EA,
-              IARG_MEMORYREAD_SIZE,
+              IARG_INST_PTR,
+              IARG_UINT32, INS_Size(ins),
+              IARG_IARGLIST, context,
+              IARG_THREAD_ID,
+              IARG_IARGLIST, reads,
               IARG_END);
           }
 
-          /* Callback before */
-          INS_InsertCall(ins, IPOINT_BEFORE, (AFUNPTR)callbackBefore,
-            IARG_PTR, tritonInst,
-            IARG_INST_PTR,
-            IARG_UINT32, INS_Size(ins),
-            IARG_CONTEXT,
-            IARG_THREAD_ID,
-            IARG_END);
+          IARGLIST_Free(reads);
 
           /* Callback after */
           /* Syscall after context must be catcher with INSERT_POINT.SYSCALL_EXIT */
@@ -967,12 +1393,16 @@ namespace tracer {
             IPOINT where = IPOINT_AFTER;
             if (INS_HasFallThrough(ins) == false)
               where = IPOINT_TAKEN_BRANCH;
-            INS_InsertCall(ins, where, (AFUNPTR)callbackAfter, IARG_PTR, tritonInst, IARG_CONTEXT, IARG_THREAD_ID, IARG_END);
+            INS_InsertIfCall(ins, where, (AFUNPTR)predicateAnalysis, IARG_FAST_ANALYSIS_CALL, IARG_THREAD_ID, IARG_END);
+            INS_InsertThenCall(ins, where, (AFUNPTR)callbackAfter, IARG_PTR, tritonInst, IARG_IARGLIST, context, IARG_THREAD_ID, IARG_END);
           }
 
+          IARGLIST_Free(context);
+
           /* I/O memory monitoring for snapshot */
           if (INS_OperandCount(ins) > 1 && INS_MemoryOperandIsWritten(ins, 0)) {
-            INS_InsertCall(
+            INS_InsertIfCall(ins, IPOINT_BEFORE, (AFUNPTR)predicateTrigger, IARG_FAST_ANALYSIS_CALL, IARG_END);
+            INS_InsertThenCall(
               ins, IPOINT_BEFORE, (AFUNPTR)callbackSnapshot,
               IARG_MEMORYOP_EA, 0,
               IARG_UINT32, INS_MemoryWriteSize(ins),
@@ -998,18 +1428,41 @@ namespace tracer {
       if(PIN_Init(argc, argv))
           return Usage();
 
+      /* Setup the input symbolization */
+      for (triton::uint32 index = 0; index < KnobSymbolizeFd.NumberOfValues(); index++) {
+        if (!KnobSymbolizeFd.Value(index).empty())
+          tracer::pintool::inputs.addFileDescriptor(std::strtol(KnobSymbolizeFd.Value(index).c_str(), nullptr, 0));
+      }
+      for (triton::uint32 index = 0; index < KnobSymbolizeFile.NumberOfValues(); index++) {
+        if (!KnobSymbolizeFile.Value(index).empty())
+          tracer::pintool::inputs.addFile(KnobSymbolizeFile.Value(index));
+      }
+      tracer::pintool::inputs.setTaint(KnobTaintInput.Value());
+
+      /* Setup the flight recorder */
+      tracer::pintool::flightRecorder.enable(KnobFlightRecorder.Value(), KnobFlightRecorderFile.Value());
+
       /* Init the Triton module */
       triton::bindings::python::inittriton();
 
       /* Image callback */
       IMG_AddInstrumentFunction(IMG_Instrumentation, nullptr);
+      IMG_AddUnloadFunction(IMG_Unload, nullptr);
 
       /* Instruction callback */
       TRACE_AddInstrumentFunction(TRACE_Instrumentation, nullptr);
 
-      /* End instrumentation callback */
+      /* End instrumentation callbacks */
+      PIN_AddPrepareForFiniFunction(callbackPrepareForFini, nullptr);
       PIN_AddFiniFunction(callbackFini, nullptr);
 
+      /* Thread start callback */
+      if (tracer::pintool::flightRecorder.isEnabled())
+        PIN_AddThreadStartFunction(callbackThreadStart, nullptr);
+
+      /* Thread exit callback */
+      PIN_AddThreadFiniFunction(callbackThreadFini, nullptr);
+
       /* Syscall entry callback */
       PIN_AddSyscallEntryFunction(callbackSyscallEntry, nullptr);
 
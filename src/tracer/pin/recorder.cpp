@@ -0,0 +1,97 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#include <iostream>
+
+/* libTriton */
+#include <api.hpp>
+#include <exceptions.hpp>
+
+/* pintool */
+#include "context.hpp"
+#include "recorder.hpp"
+
+
+
+namespace tracer {
+  namespace pintool {
+
+      Recorder::Recorder() {
+      }
+
+
+      void Recorder::enable(const std::string& path) {
+        this->path = path;
+      }
+
+
+      bool Recorder::isEnabled(void) const {
+        return !this->path.empty();
+      }
+
+
+      void Recorder::beginInstruction(triton::uint32 threadId, triton::__uint address, const triton::uint8* opcodes, triton::uint32 size) {
+        /* The trace is created once the architecture is known */
+        if (!this->writer.isOpen()) {
+          try {
+            this->writer.open(this->path, triton::api.getArchitecture());
+          }
+          catch (const triton::exceptions::Exception& e) {
+            std::cerr << e.what() << std::endl;
+            exit(1);
+          }
+
+          for (triton::arch::Register* reg : triton::api.getParentRegisters())
+            this->registers.push_back(*reg);
+        }
+
+        /* The previous instruction of this thread is complete */
+        this->flush(threadId);
+
+        triton::format::TraceInstruction& inst = this->pending[threadId];
+        inst.registers.clear();
+        inst.memoryReads.clear();
+        inst.address  = address;
+        inst.threadId = threadId;
+        inst.opcodes.assign(opcodes, opcodes + size);
+
+        for (const triton::arch::Register& reg : this->registers)
+          inst.registers.push_back(std::make_pair(reg.getId(), tracer::pintool::context::getCurrentRegisterValue(reg)));
+      }
+
+
+      void Recorder::addMemoryRead(triton::uint32 threadId, triton::__uint address, triton::uint32 size) {
+        auto it = this->pending.find(threadId);
+        if (it == this->pending.end() || it->second.opcodes.empty())
+          return;
+
+        std::vector<triton::uint8> value(size);
+        PIN_SafeCopy(value.data(), reinterpret_cast<void*>(address), size);
+        it->second.memoryReads.push_back(std::make_pair(static_cast<triton::uint64>(address), value));
+      }
+
+
+      void Recorder::flush(triton::uint32 threadId) {
+        auto it = this->pending.find(threadId);
+        if (it == this->pending.end() || it->second.opcodes.empty())
+          return;
+
+        /* The record is kept, so its buffers are reused by the next instruction */
+        this->writer.write(it->second);
+        it->second.opcodes.clear();
+      }
+
+
+      void Recorder::close(void) {
+        for (auto it = this->pending.begin(); it != this->pending.end(); it++)
+          this->flush(it->first);
+        this->pending.clear();
+        this->writer.close();
+      }
+
+  };
+};
@@ -0,0 +1,84 @@
+//! \file
+/*
+**  Copyright (C) - Triton
+**
+**  This program is under the terms of the BSD License.
+*/
+
+#ifndef PINTOOL_RECORDER_H
+#define PINTOOL_RECORDER_H
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include <pin.H>
+
+/* libTriton */
+#include <register.hpp>
+#include <traceFile.hpp>
+#include <tritonTypes.hpp>
+
+
+//! The Tracer namespace
+namespace tracer {
+/*!
+ *  \addtogroup tracer
+ *  @{
+ */
+
+  //! The Pintool namespace
+  namespace pintool {
+  /*!
+   *  \ingroup tracer
+   *  \addtogroup pintool
+   *  @{
+   */
+
+    //! \class Recorder
+    //! \brief Records the execution into a trace file, without analyzing it.
+    class Recorder {
+
+      private:
+        //! The path of the trace file. Empty if the recording is disabled.
+        std::string path;
+
+        //! The trace file.
+        triton::format::TraceWriter writer;
+
+        //! The instruction being recorded by each thread, without opcodes if there is none. It is written once its memory reads are known.
+        std::map<triton::uint32, triton::format::TraceInstruction> pending;
+
+        //! The registers recorded.
+        std::vector<triton::arch::Register> registers;
+
+
+      public:
+        //! Constructor.
+        Recorder();
+
+        //! Enables the recording into a trace file.
+        void enable(const std::string& path);
+
+        //! Returns true if the recording is enabled.
+        bool isEnabled(void) const;
+
+        //! Starts the record of an instruction. The registers are read from `tracer::pintool::context::lastContext`.
+        void beginInstruction(triton::uint32 threadId, triton::__uint address, const triton::uint8* opcodes, triton::uint32 size);
+
+        //! Adds a memory read to the instruction being recorded by a thread.
+        void addMemoryRead(triton::uint32 threadId, triton::__uint address, triton::uint32 size);
+
+        //! Writes the instruction being recorded by a thread.
+        void flush(triton::uint32 threadId);
+
+        //! Writes all pending instructions and closes the trace file.
+        void close(void);
+    };
+
+  /*! @} End of pintool namespace */
+  };
+/*! @} End of tracer namespace */
+};
+
+#endif /* PINTOOL_RECORDER_H */
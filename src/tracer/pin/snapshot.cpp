@@ -5,7 +5,9 @@
 **  This program is under the terms of the BSD License.
 */
 
+#include <cstring>
 #include <iostream>
+#include "asyncCallbacks.hpp"
 #include "snapshot.hpp"
 
 
@@ -17,44 +19,58 @@ namespace tracer {
         this->locked              = true;
         this->snapshotTaintEngine = nullptr;
         this->snapshotSymEngine   = nullptr;
+        this->cpu                 = nullptr;
         this->mustBeRestore       = false;
       }
 
 
       Snapshot::~Snapshot() {
+        this->resetEngine();
       }
 
 
-      /* Add the modification byte. */
-      void Snapshot::addModification(triton::__uint mem, char byte) {
-        if (this->locked == false && this->memory.find(mem) == this->memory.end())
-          this->memory[mem] = byte;
+      /* Save the pages about to be written. A whole page is mapped if one of its bytes is. */
+      void Snapshot::addModification(triton::__uint mem, triton::uint32 size) {
+        if (this->locked == true || size == 0)
+          return;
+
+        triton::__uint first = mem & ~(pageSize - 1);
+        triton::__uint last  = (mem + size - 1) & ~(pageSize - 1);
+
+        for (triton::__uint page = first; page <= last && page >= first; page += pageSize) {
+          if (this->pages.find(page) != this->pages.end())
+            continue;
+          std::vector<triton::uint8>& content = this->pages[page];
+          content.resize(pageSize);
+          std::memcpy(content.data(), reinterpret_cast<const void*>(page), pageSize);
+        }
       }
 
 
       /* Enable the snapshot engine. */
       void Snapshot::takeSnapshot(CONTEXT *ctx) {
-        /* 1 - Unlock the engine */
+        /* 1 - Discard the previous snapshot and unlock the engine */
+        this->resetEngine();
         this->locked = false;
 
         /* 2 - Save current symbolic engine state */
-        this->snapshotSymEngine = new triton::engines::symbolic::SymbolicEngine(*triton::api.getSymbolicEngine());
+        this->snapshotSymEngine = new triton::engines::symbolic::SymbolicEngine(*triton::getCurrentApi().getSymbolicEngine());
 
         /* 3 - Save current taint engine state */
-        this->snapshotTaintEngine = new triton::engines::taint::TaintEngine(*triton::api.getTaintEngine());
+        this->snapshotTaintEngine = new triton::engines::taint::TaintEngine(*triton::getCurrentApi().getTaintEngine());
 
-        /* 4 - Save current set of nodes */
-        this->nodesList = triton::api.getAllocatedAstNodes();
+        /* 4 - Freeze current set of nodes, they are shared instead of copied */
+        this->generation = triton::getCurrentApi().freezeAstNodes();
 
         /* 5 - Save current map of variables */
-        this->variablesMap = triton::api.getAstVariableNodes();
+        this->variablesMap = triton::getCurrentApi().getAstVariableNodes();
 
         /* 6 - Save the Triton CPU state */
         #if defined(__x86_64__) || defined(_M_X64)
-        this->cpu = new triton::arch::x86::x8664Cpu(*dynamic_cast<triton::arch::x86::x8664Cpu*>(triton::api.getCpu()));
+        this->cpu = new triton::arch::x86::x8664Cpu(*dynamic_cast<triton::arch::x86::x8664Cpu*>(triton::getCurrentApi().getCpu()));
         #endif
         #if defined(__i386) || defined(_M_IX86)
-        this->cpu = new triton::arch::x86::x86Cpu(*dynamic_cast<triton::arch::x86::x86Cpu*>(triton::api.getCpu()));
+        this->cpu = new triton::arch::x86::x86Cpu(*dynamic_cast<triton::arch::x86::x86Cpu*>(triton::getCurrentApi().getCpu()));
         #endif
 
         /* 7 - Save Pin registers context */
@@ -68,36 +84,36 @@ namespace tracer {
         if (this->mustBeRestore == false)
           return;
 
-        /* 1 - Restore all memory modification. */
-        for(auto i = this->memory.begin(); i != this->memory.end(); ++i){
-          *(reinterpret_cast<char*>(i->first)) = i->second;
-        }
-        this->memory.clear();
+        /* 1 - Restore the pages written since the snapshot, they are saved again on their next write */
+        for (auto it = this->pages.begin(); it != this->pages.end(); ++it)
+          std::memcpy(reinterpret_cast<void*>(it->first), it->second.data(), pageSize);
+        this->pages.clear();
 
         /* 2 - Restore current symbolic engine state */
-        *triton::api.getSymbolicEngine() = *this->snapshotSymEngine;
+        *triton::getCurrentApi().getSymbolicEngine() = *this->snapshotSymEngine;
 
         /* 3 - Restore current taint engine state */
-        *triton::api.getTaintEngine() = *this->snapshotTaintEngine;
+        *triton::getCurrentApi().getTaintEngine() = *this->snapshotTaintEngine;
 
-        /* 4 - Restore current AST node state */
-        triton::api.setAllocatedAstNodes(this->nodesList);
+        /* 4 - Restore current AST node state, nodes created since the snapshot are freed */
+        triton::getCurrentApi().setAstGeneration(this->generation);
 
         /* 5 - Restore current variables map state */
-        triton::api.setAstVariableNodes(this->variablesMap);
+        triton::getCurrentApi().setAstVariableNodes(this->variablesMap);
 
         /* 6 - Restore the Triton CPU state */
         #if defined(__x86_64__) || defined(_M_X64)
-        *dynamic_cast<triton::arch::x86::x8664Cpu*>(triton::api.getCpu()) = *this->cpu;
+        *dynamic_cast<triton::arch::x86::x8664Cpu*>(triton::getCurrentApi().getCpu()) = *this->cpu;
         #endif
         #if defined(__i386) || defined(_M_IX86)
-        *dynamic_cast<triton::arch::x86::x86Cpu*>(triton::api.getCpu()) = *this->cpu;
+        *dynamic_cast<triton::arch::x86::x86Cpu*>(triton::getCurrentApi().getCpu()) = *this->cpu;
         #endif
 
         /* 7 - Restore Pin registers context */
         PIN_SaveContext(&this->pinCtx, ctx);
 
         this->mustBeRestore = false;
+        tracer::pintool::asyncCallbacks::leavePython();
         PIN_UnlockClient();
         PIN_ExecuteAt(ctx);
       }
@@ -112,13 +128,19 @@ namespace tracer {
       /* Reset the snapshot engine.
        * Clear all backups for a new snapshot. */
       void Snapshot::resetEngine(void) {
-        this->memory.clear();
+        this->pages.clear();
 
         delete this->snapshotSymEngine;
         this->snapshotSymEngine = nullptr;
 
         delete this->snapshotTaintEngine;
         this->snapshotTaintEngine = nullptr;
+
+        delete this->cpu;
+        this->cpu = nullptr;
+
+        if (this->generation)
+          triton::getCurrentApi().releaseAstGeneration(this->generation);
       }
 
 
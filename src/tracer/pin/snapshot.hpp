@@ -9,7 +9,10 @@
 #define PINTOOL_SNAPSHOT_H
 
 #include <map>
+#include <memory>
 #include <set>
+#include <unordered_map>
+#include <vector>
 
 #include <pin.H>
 
@@ -42,8 +45,11 @@ namespace tracer {
     class Snapshot {
 
       private:
-        //! I/O memory monitoring for snapshot.
-        std::map<triton::__uint, char> memory;
+        //! The size of the pages saved by the snapshot engine.
+        static const triton::__uint pageSize = 0x1000;
+
+        //! The original content of the pages written since the snapshot, by page address.
+        std::unordered_map<triton::__uint, std::vector<triton::uint8>> pages;
 
         //! Status of the snapshot engine.
         bool locked;
@@ -51,11 +57,11 @@ namespace tracer {
         //! Flag which defines if we must restore the snapshot.
         bool mustBeRestore;
 
-        //! AST node state.
-        std::set<triton::ast::AbstractNode*> nodesList;
+        //! AST node state, frozen and shared with the current state.
+        std::shared_ptr<triton::ast::AstGeneration> generation;
 
         //! Variables node state.
-        std::map<std::string, triton::ast::AbstractNode*> variablesMap;
+        std::unordered_map<triton::usize, triton::ast::AbstractNode*> variablesMap;
 
         //! Snapshot of the symbolic engine.
         triton::engines::symbolic::SymbolicEngine* snapshotSymEngine;
@@ -91,8 +97,8 @@ namespace tracer {
         //! Returns true if we must restore the context.
         bool mustBeRestored(void);
 
-        //! Adds a memory modifiction.
-        void addModification(triton::__uint address, char byte);
+        //! Saves the original content of the pages about to be written by `[address:address+size)`, if not already saved.
+        void addModification(triton::__uint address, triton::uint32 size);
 
         //! Disables the snapshot engine.
         void disableSnapshot(void);
@@ -100,13 +106,13 @@ namespace tracer {
         //! Resets the snapshot engine.
         void resetEngine(void);
 
-        //! Restores a snapshot.
+        //! Restores a snapshot. The Triton states restored are the ones of the API bound to the calling thread.
         void restoreSnapshot(CONTEXT *ctx);
 
         //! Sets the restore flag.
         void setRestore(bool flag);
 
-        //! Takes a snapshot.
+        //! Takes a snapshot of the API bound to the calling thread. The previous one is discarded.
         void takeSnapshot(CONTEXT *ctx);
     };
 
@@ -13,33 +13,37 @@ namespace tracer {
   namespace pintool {
 
     Trigger::Trigger()
-      : state(false) {
+      : state(false), changed(false) {
     }
 
 
     void Trigger::toggle() {
-      this->state = !this->state;
-    }
-
-
-    bool Trigger::getState() {
-      return this->state;
+      this->update(!this->state);
     }
 
 
     void Trigger::enable(void) {
-      this->state = true;
+      this->update(true);
     }
 
 
     void Trigger::disable(void) {
-      this->state = false;
+      this->update(false);
     }
 
 
     void Trigger::update(bool flag) {
+      if (this->state != flag)
+        this->changed = true;
       this->state = flag;
     }
 
+
+    bool Trigger::takeChange(void) {
+      bool ret = this->changed;
+      this->changed = false;
+      return ret;
+    }
+
   };
 };
@@ -30,6 +30,9 @@ namespace tracer {
       protected:
         bool state;
 
+        //! True if the state has changed since the last call to takeChange().
+        bool changed;
+
       public:
         //! Constructor.
         Trigger();
@@ -37,8 +40,8 @@ namespace tracer {
         //! Switchs the trigger.
         void toggle();
 
-        //! Returns true if the switch is ON, false otherwise.
-        bool getState();
+        //! Returns true if the switch is ON, false otherwise. Defined here so that Pin may inline the analysis predicates reading it.
+        bool getState() { return this->state; }
 
         //! Sets the state to true
         void enable(void);
@@ -48,6 +51,9 @@ namespace tracer {
 
         //! Sets the state to flag
         void update(bool flag);
+
+        //! Returns true if the state has changed since the last call, and forgets the change.
+        bool takeChange(void);
     };
 
   /*! @} End of pintool namespace */
@@ -5,11 +5,16 @@
 **  This program is under the terms of the BSD License.
 */
 
+#include <cstring>
+#include <list>
+#include <map>
+
 /* libTriton */
 #include <api.hpp>
 #include <x86Specifications.hpp>
 
 /* pintool */
+#include "bindings.hpp"
 #include "utils.hpp"
 
 
@@ -17,6 +22,98 @@
 namespace tracer {
   namespace pintool {
 
+    //! The address range of a loaded image and the image filters matching its name.
+    struct ImageRange {
+      //! The highest address of the image (included).
+      triton::__uint high;
+
+      //! The name of the image.
+      std::string name;
+
+      //! True if the image blacklist matches the name.
+      bool blacklisted;
+
+      //! True if the image whitelist matches the name.
+      bool whitelisted;
+    };
+
+    //! The loaded images indexed by their lowest address.
+    static std::map<triton::__uint, ImageRange> imageRanges;
+
+
+    /* Returns true if a pattern of the list is in the name */
+    static bool matchImageFilter(const std::string& name, const std::list<const char*>& filter) {
+      for (auto it = filter.begin(); it != filter.end(); it++) {
+        if (strstr(name.c_str(), *it))
+          return true;
+      }
+      return false;
+    }
+
+
+    /* Returns the range of the image holding an address, or nullptr */
+    static const ImageRange* findImageRange(triton::__uint address) {
+      auto it = imageRanges.upper_bound(address);
+      if (it == imageRanges.begin())
+        return nullptr;
+      it--;
+      if (address > it->second.high)
+        return nullptr;
+      return &it->second;
+    }
+
+
+    void addImageRange(IMG img) {
+      ImageRange range;
+
+      range.high        = IMG_HighAddress(img);
+      range.name        = IMG_Name(img);
+      range.blacklisted = matchImageFilter(range.name, tracer::pintool::options::imageBlacklist);
+      range.whitelisted = matchImageFilter(range.name, tracer::pintool::options::imageWhitelist);
+
+      imageRanges[IMG_LowAddress(img)] = range;
+    }
+
+
+    void removeImageRange(IMG img) {
+      imageRanges.erase(IMG_LowAddress(img));
+    }
+
+
+    void updateImageRanges(void) {
+      for (auto it = imageRanges.begin(); it != imageRanges.end(); it++) {
+        it->second.blacklisted = matchImageFilter(it->second.name, tracer::pintool::options::imageBlacklist);
+        it->second.whitelisted = matchImageFilter(it->second.name, tracer::pintool::options::imageWhitelist);
+      }
+    }
+
+
+    bool isImageBlacklisted(triton::__uint address) {
+      const ImageRange* range = findImageRange(address);
+
+      /* The code outside the images has no name */
+      if (range == nullptr)
+        return matchImageFilter("", tracer::pintool::options::imageBlacklist);
+
+      return range->blacklisted;
+    }
+
+
+    bool isImageWhitelisted(triton::__uint address) {
+      /* If there is no whitelist -> jit everything */
+      if (tracer::pintool::options::imageWhitelist.empty())
+        return true;
+
+      const ImageRange* range = findImageRange(address);
+
+      /* The code outside the images has no name */
+      if (range == nullptr)
+        return matchImageFilter("", tracer::pintool::options::imageWhitelist);
+
+      return range->whitelisted;
+    }
+
+
     triton::__uint getBaseAddress(triton::__uint address) {
       RTN rtn;
       SEC sec;
@@ -41,6 +41,21 @@ namespace tracer {
     //! Returns the routine name from a given address.
     std::string getRoutineName(triton::__uint address);
 
+    //! Records the address range of a loaded image and matches the image filters against its name.
+    void addImageRange(IMG img);
+
+    //! Forgets the address range of an unloaded image.
+    void removeImageRange(IMG img);
+
+    //! Matches the image filters again against the loaded images. Called when the filters change.
+    void updateImageRanges(void);
+
+    //! Returns true if the address is in an image matched by the image blacklist. O(log n) in the number of images.
+    bool isImageBlacklisted(triton::__uint address);
+
+    //! Returns true if there is no image whitelist or the address is in an image matched by it. O(log n) in the number of images.
+    bool isImageWhitelisted(triton::__uint address);
+
   /*! @} End of pintool namespace */
   };
 /*! @} End of tracer namespace */